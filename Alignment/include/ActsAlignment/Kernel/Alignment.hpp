@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Alignment.hpp"
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/TrackFitting/KalmanFitter.hpp"
@@ -21,6 +22,7 @@
 #include "ActsAlignment/Kernel/AlignmentError.hpp"
 #include "ActsAlignment/Kernel/detail/AlignmentEngine.hpp"
 
+#include <cstddef>
 #include <limits>
 #include <map>
 #include <queue>
@@ -30,6 +32,38 @@ namespace ActsAlignment {
 using AlignedTransformUpdater =
     std::function<bool(Acts::DetectorElementBase*, const Acts::GeometryContext&,
                        const Acts::Transform3&)>;
+
+/// @brief The method to solve for the change of the alignment parameters
+enum class AlignmentSolver {
+  /// LU decomposition of the dense chi2 second derivative, O(n^3)
+  Dense,
+  /// Sparse Cholesky (LDLT) decomposition of the chi2 second derivative
+  SparseCholesky,
+  /// Diagonally preconditioned conjugate gradient on the sparse chi2 second
+  /// derivative
+  ConjugateGradient,
+};
+
+/// @brief Options for solving the alignment linear system
+///
+/// The sparse solvers never build the dense chi2 second derivative. They
+/// only provide the covariance of the alignment parameters of each surface,
+/// i.e. the diagonal blocks, and leave the full covariance empty. Degrees of
+/// freedom without any constraint, e.g. masked ones, are kept fixed.
+struct AlignmentSolverOptions {
+  // The solver to use
+  AlignmentSolver solver = AlignmentSolver::Dense;
+
+  // Whether to compute the covariance of the alignment parameters
+  bool computeCovariance = true;
+
+  // The relative tolerance of the conjugate gradient solver
+  double tolerance = 1e-10;
+
+  // The maximum number of conjugate gradient iterations, 0 means the number
+  // of alignment degrees of freedom
+  std::size_t maxIterations = 0;
+};
 ///
 /// @brief Options for align() call
 ///
@@ -86,6 +120,13 @@ struct AlignmentOptions {
 
   // The alignment mask for different iterations
   std::map<unsigned int, AlignmentMask> iterationState;
+
+  // The options of the solver for the alignment parameters change
+  AlignmentSolverOptions solverOptions;
+
+  // The geometry containing the aligned detector elements. If set, its
+  // surface arrays are updated for the moved surfaces after every iteration.
+  Acts::TrackingGeometry* trackingGeometry = nullptr;
 };
 
 /// @brief Alignment result struct
@@ -101,6 +142,10 @@ struct AlignmentResult {
   // The covariance of alignment parameters
   Acts::ActsDynamicMatrix alignmentCovariance;
 
+  // The covariance of the alignment parameters of each aligned surface,
+  // ordered by surface index
+  std::vector<Acts::AlignmentMatrix> alignmentCovarianceBlocks;
+
   // The average chi2/ndf (ndf is the measurement dim)
   double averageChi2ONdf = std::numeric_limits<double>::max();
 
@@ -169,6 +214,9 @@ struct Alignment {
 
   /// @brief calculate the alignment parameters delta
   ///
+  /// The trajectories are fitted in contiguous ranges on up to
+  /// @c Acts::maxThreads threads.
+  ///
   /// @tparam trajectory_container_t The trajectories container type
   /// @tparam start_parameters_t The initial parameters container type
   /// @tparam fit_options_t The fit options type
@@ -180,13 +228,15 @@ struct Alignment {
   /// @param fitOptions The fit Options steering the fit
   /// @param alignResult [in, out] The aligned result
   /// @param alignMask The alignment mask (same for all measurements now)
+  /// @param solverOptions The options to solve for the alignment parameters
   template <typename trajectory_container_t,
             typename start_parameters_container_t, typename fit_options_t>
   void calculateAlignmentParameters(
       const trajectory_container_t& trajectoryCollection,
       const start_parameters_container_t& startParametersCollection,
       const fit_options_t& fitOptions, AlignmentResult& alignResult,
-      const AlignmentMask& alignMask = AlignmentMask::All) const;
+      const AlignmentMask& alignMask = AlignmentMask::All,
+      const AlignmentSolverOptions& solverOptions = {}) const;
 
   /// @brief update the detector element alignment parameters
   ///
@@ -8,6 +8,14 @@
 
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
 
 template <typename fitter_t>
 template <typename source_link_t, typename start_parameters_t,
@@ -59,7 +67,8 @@ void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
     const start_parameters_container_t& startParametersCollection,
     const fit_options_t& fitOptions,
     ActsAlignment::AlignmentResult& alignResult,
-    const ActsAlignment::AlignmentMask& alignMask) const {
+    const ActsAlignment::AlignmentMask& alignMask,
+    const ActsAlignment::AlignmentSolverOptions& solverOptions) const {
   // The number of trajectories must be equal to the number of starting
   // parameters
   assert(trajectoryCollection.size() == startParametersCollection.size());
@@ -67,85 +76,248 @@ void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
   // The total alignment degree of freedom
   alignResult.alignmentDof =
       alignResult.idxedAlignSurfaces.size() * Acts::eAlignmentSize;
-  // Initialize derivative of chi2 w.r.t. alignment parameters for all tracks
-  Acts::ActsDynamicVector sumChi2Derivative =
-      Acts::ActsDynamicVector::Zero(alignResult.alignmentDof);
-  Acts::ActsDynamicMatrix sumChi2SecondDerivative =
-      Acts::ActsDynamicMatrix::Zero(alignResult.alignmentDof,
-                                    alignResult.alignmentDof);
-  // Copy the fit options
-  fit_options_t fitOptionsWithRefSurface = fitOptions;
-  // Calculate contribution to chi2 derivatives from all input trajectories
+  const std::size_t nSurfaces = alignResult.idxedAlignSurfaces.size();
+
+  // The contributions of the trajectories of one thread. The second
+  // derivative only has blocks for pairs of surfaces on a common track, it
+  // is therefore accumulated sparsely by surface pair.
+  struct Accumulator {
+    Acts::ActsDynamicVector chi2Derivative;
+    std::unordered_map<std::size_t, Acts::AlignmentMatrix> chi2SecondDerivative;
+    double chi2 = 0;
+    std::size_t measurementDim = 0;
+    double sumChi2ONdf = 0;
+  };
+
+  // Calculate contribution to chi2 derivatives from the input trajectories
+  // in [begin, end)
   // @Todo: How to update the source link error iteratively?
+  auto accumulate = [&](std::size_t begin, std::size_t end,
+                        Accumulator& acc) {
+    acc.chi2Derivative =
+        Acts::ActsDynamicVector::Zero(alignResult.alignmentDof);
+    // Copy the fit options
+    fit_options_t fitOptionsWithRefSurface = fitOptions;
+    for (std::size_t iTraj = begin; iTraj < end; iTraj++) {
+      const auto& sourcelinks = trajectoryCollection.at(iTraj);
+      const auto& sParameters = startParametersCollection.at(iTraj);
+      // Set the target surface
+      fitOptionsWithRefSurface.referenceSurface =
+          &sParameters.referenceSurface();
+      // The result for one single track
+      auto evaluateRes = evaluateTrackAlignmentState(
+          fitOptions.geoContext, sourcelinks, sParameters,
+          fitOptionsWithRefSurface, alignResult.idxedAlignSurfaces, alignMask);
+      if (!evaluateRes.ok()) {
+        ACTS_DEBUG("Evaluation of alignment state for track " << iTraj
+                                                              << " failed");
+        continue;
+      }
+      const auto& alignState = evaluateRes.value();
+      for (const auto& [rowSurface, rows] : alignState.alignedSurfaces) {
+        const auto& [dstRow, srcRow] = rows;
+        acc.chi2Derivative.template segment<Acts::eAlignmentSize>(
+            dstRow * Acts::eAlignmentSize) +=
+            alignState.alignmentToChi2Derivative.segment(
+                srcRow * Acts::eAlignmentSize, Acts::eAlignmentSize);
+
+        for (const auto& [colSurface, cols] : alignState.alignedSurfaces) {
+          const auto& [dstCol, srcCol] = cols;
+          auto [block, inserted] = acc.chi2SecondDerivative.try_emplace(
+              dstRow * nSurfaces + dstCol, Acts::AlignmentMatrix::Zero());
+          block->second += alignState.alignmentToChi2SecondDerivative.block(
+              srcRow * Acts::eAlignmentSize, srcCol * Acts::eAlignmentSize,
+              Acts::eAlignmentSize, Acts::eAlignmentSize);
+        }
+      }
+      acc.chi2 += alignState.chi2;
+      acc.measurementDim += alignState.measurementDim;
+      acc.sumChi2ONdf += alignState.chi2 / alignState.measurementDim;
+    }
+  };
+
+  // Every thread processes a contiguous range of trajectories, such that the
+  // result does not depend on the scheduling
+  const std::size_t nTrajectories = trajectoryCollection.size();
+  const std::size_t nThreads =
+      std::max<std::size_t>(1, std::min(Acts::maxThreads(), nTrajectories));
+  std::vector<Accumulator> accumulators(nThreads);
+  Acts::parallelFor(nThreads, [&](std::size_t iThread) {
+    accumulate(iThread * nTrajectories / nThreads,
+               (iThread + 1) * nTrajectories / nThreads,
+               accumulators[iThread]);
+  });
+
+  // Merge the contributions of the threads
   alignResult.chi2 = 0;
   alignResult.measurementDim = 0;
-  alignResult.numTracks = trajectoryCollection.size();
+  alignResult.numTracks = nTrajectories;
   double sumChi2ONdf = 0;
-  for (unsigned int iTraj = 0; iTraj < trajectoryCollection.size(); iTraj++) {
-    const auto& sourcelinks = trajectoryCollection.at(iTraj);
-    const auto& sParameters = startParametersCollection.at(iTraj);
-    // Set the target surface
-    fitOptionsWithRefSurface.referenceSurface = &sParameters.referenceSurface();
-    // The result for one single track
-    auto evaluateRes = evaluateTrackAlignmentState(
-        fitOptions.geoContext, sourcelinks, sParameters,
-        fitOptionsWithRefSurface, alignResult.idxedAlignSurfaces, alignMask);
-    if (!evaluateRes.ok()) {
-      ACTS_DEBUG("Evaluation of alignment state for track " << iTraj
-                                                            << " failed");
-      continue;
-    }
-    const auto& alignState = evaluateRes.value();
-    for (const auto& [rowSurface, rows] : alignState.alignedSurfaces) {
-      const auto& [dstRow, srcRow] = rows;
-      // Fill the results into full chi2 derivative matrix
-      sumChi2Derivative.segment<Acts::eAlignmentSize>(dstRow *
-                                                      Acts::eAlignmentSize) +=
-          alignState.alignmentToChi2Derivative.segment(
-              srcRow * Acts::eAlignmentSize, Acts::eAlignmentSize);
-
-      for (const auto& [colSurface, cols] : alignState.alignedSurfaces) {
-        const auto& [dstCol, srcCol] = cols;
-        sumChi2SecondDerivative
-            .block<Acts::eAlignmentSize, Acts::eAlignmentSize>(
-                dstRow * Acts::eAlignmentSize, dstCol * Acts::eAlignmentSize) +=
-            alignState.alignmentToChi2SecondDerivative.block(
-                srcRow * Acts::eAlignmentSize, srcCol * Acts::eAlignmentSize,
-                Acts::eAlignmentSize, Acts::eAlignmentSize);
-      }
-    }
-    alignResult.chi2 += alignState.chi2;
-    alignResult.measurementDim += alignState.measurementDim;
-    sumChi2ONdf += alignState.chi2 / alignState.measurementDim;
+  Acts::ActsDynamicVector sumChi2Derivative =
+      Acts::ActsDynamicVector::Zero(alignResult.alignmentDof);
+  for (const Accumulator& acc : accumulators) {
+    sumChi2Derivative += acc.chi2Derivative;
+    alignResult.chi2 += acc.chi2;
+    alignResult.measurementDim += acc.measurementDim;
+    sumChi2ONdf += acc.sumChi2ONdf;
   }
   alignResult.averageChi2ONdf = sumChi2ONdf / alignResult.numTracks;
 
-  // Get the inverse of chi2 second derivative matrix (we need this to
-  // calculate the covariance of the alignment parameters)
-  // @Todo: use more stable method for solving the inverse
   std::size_t alignDof = alignResult.alignmentDof;
-  Acts::ActsDynamicMatrix sumChi2SecondDerivativeInverse =
-      Acts::ActsDynamicMatrix::Zero(alignDof, alignDof);
-  sumChi2SecondDerivativeInverse = sumChi2SecondDerivative.inverse();
-  if (sumChi2SecondDerivativeInverse.hasNaN()) {
-    ACTS_DEBUG("Chi2 second derivative inverse has NaN");
-    // return AlignmentError::AlignmentParametersUpdateFailure;
-  }
-
   // Initialize the alignment results
+  alignResult.result = Acts::Result<void>::success();
   alignResult.deltaAlignmentParameters =
       Acts::ActsDynamicVector::Zero(alignDof);
-  alignResult.alignmentCovariance =
-      Acts::ActsDynamicMatrix::Zero(alignDof, alignDof);
-  // Solve the linear equation to get alignment parameters change
-  alignResult.deltaAlignmentParameters =
-      -sumChi2SecondDerivative.fullPivLu().solve(sumChi2Derivative);
-  ACTS_VERBOSE("sumChi2SecondDerivative = \n" << sumChi2SecondDerivative);
+  alignResult.alignmentCovariance = Acts::ActsDynamicMatrix();
+  alignResult.alignmentCovarianceBlocks.assign(nSurfaces,
+                                               Acts::AlignmentMatrix::Zero());
+
+  if (solverOptions.solver == AlignmentSolver::Dense) {
+    // Fill the contributions into the full chi2 second derivative matrix
+    Acts::ActsDynamicMatrix sumChi2SecondDerivative =
+        Acts::ActsDynamicMatrix::Zero(alignDof, alignDof);
+    for (const Accumulator& acc : accumulators) {
+      for (const auto& [index, block] : acc.chi2SecondDerivative) {
+        sumChi2SecondDerivative
+            .block<Acts::eAlignmentSize, Acts::eAlignmentSize>(
+                (index / nSurfaces) * Acts::eAlignmentSize,
+                (index % nSurfaces) * Acts::eAlignmentSize) += block;
+      }
+    }
+
+    // Solve the linear equation to get alignment parameters change
+    alignResult.deltaAlignmentParameters =
+        -sumChi2SecondDerivative.fullPivLu().solve(sumChi2Derivative);
+    ACTS_VERBOSE("sumChi2SecondDerivative = \n" << sumChi2SecondDerivative);
+
+    if (solverOptions.computeCovariance) {
+      // Get the inverse of chi2 second derivative matrix (we need this to
+      // calculate the covariance of the alignment parameters)
+      // @Todo: use more stable method for solving the inverse
+      Acts::ActsDynamicMatrix sumChi2SecondDerivativeInverse =
+          sumChi2SecondDerivative.inverse();
+      if (sumChi2SecondDerivativeInverse.hasNaN()) {
+        ACTS_DEBUG("Chi2 second derivative inverse has NaN");
+        // return AlignmentError::AlignmentParametersUpdateFailure;
+      }
+      // Alignment parameters covariance
+      alignResult.alignmentCovariance = 2 * sumChi2SecondDerivativeInverse;
+      for (std::size_t iSurface = 0; iSurface < nSurfaces; ++iSurface) {
+        alignResult.alignmentCovarianceBlocks[iSurface] =
+            alignResult.alignmentCovariance
+                .block<Acts::eAlignmentSize, Acts::eAlignmentSize>(
+                    iSurface * Acts::eAlignmentSize,
+                    iSurface * Acts::eAlignmentSize);
+      }
+    }
+  } else {
+    using SparseMatrix = Eigen::SparseMatrix<Acts::ActsScalar>;
+    using SurfaceColumns =
+        Eigen::Matrix<Acts::ActsScalar, Eigen::Dynamic, Acts::eAlignmentSize>;
+    // Assemble the sparse chi2 second derivative from the blocks of all
+    // pairs of surfaces on a common track
+    std::vector<Eigen::Triplet<Acts::ActsScalar>> triplets;
+    Acts::ActsDynamicVector diagonal = Acts::ActsDynamicVector::Zero(alignDof);
+    for (const Accumulator& acc : accumulators) {
+      triplets.reserve(triplets.size() + acc.chi2SecondDerivative.size() *
+                                             Acts::eAlignmentSize *
+                                             Acts::eAlignmentSize);
+      for (const auto& [index, block] : acc.chi2SecondDerivative) {
+        const std::size_t row0 = (index / nSurfaces) * Acts::eAlignmentSize;
+        const std::size_t col0 = (index % nSurfaces) * Acts::eAlignmentSize;
+        for (std::size_t i = 0; i < Acts::eAlignmentSize; ++i) {
+          for (std::size_t j = 0; j < Acts::eAlignmentSize; ++j) {
+            if (block(i, j) == 0) {
+              continue;
+            }
+            triplets.emplace_back(row0 + i, col0 + j, block(i, j));
+            if (row0 + i == col0 + j) {
+              diagonal(row0 + i) += block(i, j);
+            }
+          }
+        }
+      }
+    }
+    // Keep the unconstrained degrees of freedom fixed, their chi2 derivative
+    // is zero
+    std::vector<bool> fixed(alignDof, false);
+    for (std::size_t i = 0; i < alignDof; ++i) {
+      if (diagonal(i) == 0) {
+        fixed[i] = true;
+        triplets.emplace_back(i, i, 1);
+      }
+    }
+    SparseMatrix sumChi2SecondDerivative(alignDof, alignDof);
+    sumChi2SecondDerivative.setFromTriplets(triplets.begin(), triplets.end());
+    triplets = {};
+    ACTS_DEBUG("Chi2 second derivative has "
+               << sumChi2SecondDerivative.nonZeros() << " non-zero entries for "
+               << alignDof << " alignment degrees of freedom");
+
+    // Solve the linear equation and get the covariance of the alignment
+    // parameters of each surface, the unit vectors of the fixed degrees of
+    // freedom would wrongly give a unit variance
+    auto solve = [&](auto& solver) {
+      if (solver.info() != Eigen::Success) {
+        ACTS_ERROR("Decomposition of chi2 second derivative failed");
+        return false;
+      }
+      alignResult.deltaAlignmentParameters = -solver.solve(sumChi2Derivative);
+      if (solver.info() != Eigen::Success) {
+        ACTS_ERROR("Solving for the alignment parameters failed");
+        return false;
+      }
+      if (!solverOptions.computeCovariance) {
+        return true;
+      }
+      SurfaceColumns unit(alignDof, Acts::eAlignmentSize);
+      for (std::size_t iSurface = 0; iSurface < nSurfaces; ++iSurface) {
+        const std::size_t row0 = iSurface * Acts::eAlignmentSize;
+        unit.setZero();
+        unit.template block<Acts::eAlignmentSize, Acts::eAlignmentSize>(row0,
+                                                                        0)
+            .setIdentity();
+        const SurfaceColumns inverseColumns = solver.solve(unit);
+        Acts::AlignmentMatrix& covariance =
+            alignResult.alignmentCovarianceBlocks[iSurface];
+        covariance = 2 * inverseColumns.template block<Acts::eAlignmentSize,
+                                                       Acts::eAlignmentSize>(
+                             row0, 0);
+        for (std::size_t i = 0; i < Acts::eAlignmentSize; ++i) {
+          if (fixed[row0 + i]) {
+            covariance.row(i).setZero();
+            covariance.col(i).setZero();
+          }
+        }
+      }
+      return true;
+    };
+
+    bool solved = false;
+    if (solverOptions.solver == AlignmentSolver::SparseCholesky) {
+      Eigen::SimplicialLDLT<SparseMatrix> solver(sumChi2SecondDerivative);
+      solved = solve(solver);
+    } else {
+      Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower | Eigen::Upper>
+          solver;
+      solver.setTolerance(solverOptions.tolerance);
+      if (solverOptions.maxIterations > 0) {
+        solver.setMaxIterations(solverOptions.maxIterations);
+      }
+      solver.compute(sumChi2SecondDerivative);
+      solved = solve(solver);
+      ACTS_DEBUG("Conjugate gradient finished after "
+                 << solver.iterations() << " iterations with error "
+                 << solver.error());
+    }
+    if (!solved) {
+      alignResult.deltaAlignmentParameters.setZero();
+      alignResult.result = AlignmentError::LinearSystemSolveFailure;
+    }
+  }
   ACTS_VERBOSE("sumChi2Derivative = \n" << sumChi2Derivative);
   ACTS_VERBOSE("alignResult.deltaAlignmentParameters \n");
 
-  // Alignment parameters covariance
-  alignResult.alignmentCovariance = 2 * sumChi2SecondDerivativeInverse;
   // chi2 change
   alignResult.deltaChi2 = 0.5 * sumChi2Derivative.transpose() *
                           alignResult.deltaAlignmentParameters;
@@ -248,7 +420,13 @@ ActsAlignment::Alignment<fitter_t>::align(
     // Calculate the alignment parameters delta etc.
     calculateAlignmentParameters(
         trajectoryCollection, startParametersCollection,
-        alignOptions.fitOptions, alignResult, alignMask);
+        alignOptions.fitOptions, alignResult, alignMask,
+        alignOptions.solverOptions);
+    if (!alignResult.result.ok()) {
+      ACTS_ERROR("Calculation of alignment parameters failed: "
+                 << alignResult.result.error());
+      return alignResult.result.error();
+    }
     // Screen out the information
     ACTS_INFO("iIter = " << iIter << ", total chi2 = " << alignResult.chi2
                          << ", total measurementDim = "
@@ -294,6 +472,18 @@ ActsAlignment::Alignment<fitter_t>::align(
       ACTS_ERROR("Update alignment parameters failed: " << updateRes.error());
       return updateRes.error();
     }
+    if (alignOptions.trackingGeometry != nullptr) {
+      // Keep the navigation in sync with the moved surfaces
+      std::vector<const Acts::Surface*> movedSurfaces;
+      movedSurfaces.reserve(alignOptions.alignedDetElements.size());
+      for (const auto& det : alignOptions.alignedDetElements) {
+        movedSurfaces.push_back(&det->surface());
+      }
+      const std::size_t nChanged =
+          alignOptions.trackingGeometry->updateMovedSurfaces(
+              alignOptions.fitOptions.geoContext, movedSurfaces);
+      ACTS_VERBOSE(nChanged << " aligned surfaces changed their bin");
+    }
     alignmentParametersUpdated = true;
   }  // end of all iterations
 
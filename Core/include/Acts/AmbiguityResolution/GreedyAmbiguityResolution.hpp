@@ -14,9 +14,11 @@
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
-#include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 
 namespace Acts {
@@ -34,6 +36,11 @@ namespace Acts {
 ///  3) Else, remove the track with the highest relative shared hits (i.e.
 ///     shared hits / hits).
 ///  4) Back to square 1.
+///
+/// The tracks are kept in a priority queue ordered by their relative shared
+/// hits and chi2. Removing a track only updates the shared hits of the
+/// tracks it shares measurements with, such that each iteration does not
+/// rescan all tracks.
 class GreedyAmbiguityResolution {
  public:
   struct Config {
@@ -46,21 +53,32 @@ class GreedyAmbiguityResolution {
     std::size_t nMeasurementsMin = 7;
   };
 
+  /// The relations between tracks and measurements are stored in compressed
+  /// sparse row layout, e.g. the measurements of track `i` are
+  /// `measurementsPerTrack[measurementOffsets[i]]` up to
+  /// `measurementsPerTrack[measurementOffsets[i + 1]]` excluded.
+  /// A track is expected to contain each measurement only once.
   struct State {
     std::size_t numberOfTracks{};
 
     std::vector<int> trackTips;
     std::vector<float> trackChi2;
-    std::vector<std::vector<std::size_t>> measurementsPerTrack;
+    std::vector<std::size_t> measurementOffsets;
+    std::vector<std::size_t> measurementsPerTrack;
 
-    // TODO consider boost 1.81 unordered_flat_map
-    boost::container::flat_map<std::size_t,
-                               boost::container::flat_set<std::size_t>>
-        tracksPerMeasurement;
+    std::vector<std::size_t> trackOffsets;
+    std::vector<std::size_t> tracksPerMeasurement;
+    /// Number of the selected tracks containing each measurement
+    std::vector<std::size_t> selectedTracksPerMeasurement;
     std::vector<std::size_t> sharedMeasurementsPerTrack;
 
     // TODO consider boost 1.81 unordered_flat_map
     boost::container::flat_set<std::size_t> selectedTracks;
+
+    /// Number of measurements of a track
+    std::size_t nMeasurements(std::size_t iTrack) const {
+      return measurementOffsets[iTrack + 1] - measurementOffsets[iTrack];
+    }
   };
 
   GreedyAmbiguityResolution(const Config& cfg,
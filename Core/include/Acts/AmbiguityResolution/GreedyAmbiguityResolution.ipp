@@ -9,8 +9,12 @@
 #pragma once
 
 #include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <unordered_map>
+#include <vector>
 
 namespace Acts {
 
@@ -26,50 +30,109 @@ void GreedyAmbiguityResolution::computeInitialState(
                          source_link_equality_t>(0, sourceLinkHash,
                                                  sourceLinkEquality);
 
-  // Iterate through all input tracks, collect their properties like measurement
-  // count and chi2 and fill the measurement map in order to relate tracks to
-  // each other if they have shared hits.
-  for (const auto& track : tracks) {
-    // Kick out tracks that do not fulfill our initial requirements
-    if (track.nMeasurements() < m_cfg.nMeasurementsMin) {
-      continue;
+  // Iterate through all input tracks and collect their properties like
+  // measurement count and chi2. Reading the tracks is independent, so
+  // contiguous ranges of tracks are read concurrently, keeping the track order.
+  constexpr std::size_t minTracksPerChunk = 256;
+  const std::size_t nInputTracks = tracks.size();
+  const std::size_t nChunks =
+      std::min(maxThreads(),
+               std::max<std::size_t>(nInputTracks / minTracksPerChunk, 1));
+  struct Chunk {
+    std::vector<int> trackTips;
+    std::vector<float> trackChi2;
+    std::vector<std::size_t> sourceLinkOffsets{0};
+    std::vector<SourceLink> sourceLinks;
+  };
+  std::vector<Chunk> chunks(nChunks);
+  parallelFor(nChunks, [&](std::size_t ic) {
+    Chunk& chunk = chunks[ic];
+    for (std::size_t iTrack = nInputTracks * ic / nChunks;
+         iTrack < nInputTracks * (ic + 1) / nChunks; ++iTrack) {
+      const auto track = tracks.getTrack(iTrack);
+      // Kick out tracks that do not fulfill our initial requirements
+      if (track.nMeasurements() < m_cfg.nMeasurementsMin) {
+        continue;
+      }
+      for (auto ts : track.trackStatesReversed()) {
+        if (ts.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
+          chunk.sourceLinks.push_back(ts.getUncalibratedSourceLink());
+        }
+      }
+      chunk.sourceLinkOffsets.push_back(chunk.sourceLinks.size());
+      chunk.trackTips.push_back(track.index());
+      chunk.trackChi2.push_back(track.chi2() / track.nDoF());
     }
-    std::vector<std::size_t> measurements;
-    for (auto ts : track.trackStatesReversed()) {
-      if (ts.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
-        SourceLink sourceLink = ts.getUncalibratedSourceLink();
+  });
+
+  // Fill the measurement map in order to relate tracks to each other if they
+  // have shared hits. The measurement indices are assigned in the order in
+  // which the source links are first seen, which requires a sequential pass.
+  state.measurementOffsets.push_back(0);
+  for (const Chunk& chunk : chunks) {
+    for (std::size_t i = 0; i < chunk.trackTips.size(); ++i) {
+      for (std::size_t j = chunk.sourceLinkOffsets[i];
+           j < chunk.sourceLinkOffsets[i + 1]; ++j) {
         // assign a new measurement index if the source link was not seen yet
         auto emplace = measurementIndexMap.try_emplace(
-            sourceLink, measurementIndexMap.size());
-        measurements.push_back(emplace.first->second);
+            chunk.sourceLinks[j], measurementIndexMap.size());
+        state.measurementsPerTrack.push_back(emplace.first->second);
       }
-    }
+      state.measurementOffsets.push_back(state.measurementsPerTrack.size());
 
-    state.trackTips.push_back(track.index());
-    state.trackChi2.push_back(track.chi2() / track.nDoF());
-    state.measurementsPerTrack.push_back(std::move(measurements));
-    state.selectedTracks.insert(state.numberOfTracks);
+      state.trackTips.push_back(chunk.trackTips[i]);
+      state.trackChi2.push_back(chunk.trackChi2[i]);
+      state.selectedTracks.insert(state.selectedTracks.end(),
+                                  state.numberOfTracks);
 
-    ++state.numberOfTracks;
+      ++state.numberOfTracks;
+    }
   }
 
-  // Now we relate measurements to tracks
+  // Now we relate measurements to tracks by counting the tracks per
+  // measurement first, the tracks of a measurement are ordered by index
+  const std::size_t nMeasurements = measurementIndexMap.size();
+  state.selectedTracksPerMeasurement.assign(nMeasurements, 0);
+  for (auto iMeasurement : state.measurementsPerTrack) {
+    ++state.selectedTracksPerMeasurement[iMeasurement];
+  }
+  state.trackOffsets.assign(nMeasurements + 1, 0);
+  for (std::size_t iMeasurement = 0; iMeasurement < nMeasurements;
+       ++iMeasurement) {
+    state.trackOffsets[iMeasurement + 1] =
+        state.trackOffsets[iMeasurement] +
+        state.selectedTracksPerMeasurement[iMeasurement];
+  }
+  state.tracksPerMeasurement.resize(state.measurementsPerTrack.size());
+  std::vector<std::size_t> fill(state.trackOffsets.begin(),
+                                state.trackOffsets.end() - 1);
   for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
-    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
-      state.tracksPerMeasurement[iMeasurement].insert(iTrack);
+    for (std::size_t i = state.measurementOffsets[iTrack];
+         i < state.measurementOffsets[iTrack + 1]; ++i) {
+      state.tracksPerMeasurement[fill[state.measurementsPerTrack[i]]++] =
+          iTrack;
     }
   }
 
-  // Finally, we can accumulate the number of shared measurements per track
+  // Finally, we can accumulate the number of shared measurements per track,
+  // every track only writes its own counter
   state.sharedMeasurementsPerTrack =
       std::vector<std::size_t>(state.trackTips.size(), 0);
-  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
-    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
-      if (state.tracksPerMeasurement[iMeasurement].size() > 1) {
-        ++state.sharedMeasurementsPerTrack[iTrack];
+  const std::size_t nSharedChunks = std::min(
+      maxThreads(),
+      std::max<std::size_t>(state.numberOfTracks / minTracksPerChunk, 1));
+  parallelFor(nSharedChunks, [&](std::size_t ic) {
+    for (std::size_t iTrack = state.numberOfTracks * ic / nSharedChunks;
+         iTrack < state.numberOfTracks * (ic + 1) / nSharedChunks; ++iTrack) {
+      for (std::size_t i = state.measurementOffsets[iTrack];
+           i < state.measurementOffsets[iTrack + 1]; ++i) {
+        auto iMeasurement = state.measurementsPerTrack[i];
+        if (state.selectedTracksPerMeasurement[iMeasurement] > 1) {
+          ++state.sharedMeasurementsPerTrack[iTrack];
+        }
       }
     }
-  }
+  });
 }
 
 }  // namespace Acts
@@ -12,8 +12,12 @@
 #include "Acts/EventData/TrackContainer.hpp"
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -133,11 +137,13 @@ class ScoreBasedAmbiguityResolution {
     std::vector<OptionalScoreModifier> scores = {};
   };
 
+  /// @param cfg is the configuration, the detector configurations are
+  ///        compiled into the dense scoring tables here
+  /// @param logger is the logging instance
   ScoreBasedAmbiguityResolution(
       const Config& cfg,
       std::unique_ptr<const Logger> logger =
-          getDefaultLogger("ScoreBasedAmbiguityResolution", Logging::INFO))
-      : m_cfg{cfg}, m_logger{std::move(logger)} {}
+          getDefaultLogger("ScoreBasedAmbiguityResolution", Logging::INFO));
 
   /// Compute the initial state of the tracks.
   ///
@@ -215,8 +221,101 @@ class ScoreBasedAmbiguityResolution {
           optionalCuts = {}) const;
 
  private:
+  /// @brief The detector configurations flattened into dense arrays
+  ///
+  /// The plan is compiled once from the configuration, such that the scoring
+  /// neither searches the volume map nor copies detector configurations and
+  /// the cuts of a detector are applied to all tracks in one loop.
+  struct ScoringPlan {
+    static constexpr std::size_t kNoDetector =
+        std::numeric_limits<std::size_t>::max();
+
+    /// The detector ID for each volume ID, `kNoDetector` if not mapped
+    std::vector<std::size_t> detectorIds;
+
+    std::vector<std::size_t> minHits;
+    std::vector<std::size_t> maxHits;
+    std::vector<std::size_t> maxHoles;
+    std::vector<std::size_t> maxOutliers;
+    std::vector<std::size_t> maxSharedHits;
+    std::vector<std::uint8_t> sharedHitsFlag;
+
+    std::vector<double> hitsScoreWeight;
+    std::vector<double> holesScoreWeight;
+    std::vector<double> outliersScoreWeight;
+    std::vector<double> otherScoreWeight;
+
+    /// The factors of all detectors, the ones of detector `d` are in
+    /// `[factorHitsOffsets[d], factorHitsOffsets[d + 1])`
+    std::vector<double> factorHits;
+    std::vector<std::size_t> factorHitsOffsets;
+    /// The factors of all detectors, the ones of detector `d` are in
+    /// `[factorHolesOffsets[d], factorHolesOffsets[d + 1])`
+    std::vector<double> factorHoles;
+    std::vector<std::size_t> factorHolesOffsets;
+
+    std::size_t nDetectors() const { return minHits.size(); }
+
+    /// @return the detector ID of a volume or `kNoDetector`
+    std::size_t detectorId(std::size_t iVolume) const {
+      return iVolume < detectorIds.size() ? detectorIds[iVolume] : kNoDetector;
+    }
+  };
+
+  /// The number of contiguous ranges of tracks which are scored concurrently
+  /// within the thread budget of Acts::maxThreads().
+  ///
+  /// @param nTracks is the number of tracks
+  /// @return the number of ranges
+  static std::size_t nTrackRanges(std::size_t nTracks) {
+    // the score of a track costs a few operations, smaller ranges are not
+    // worth a thread
+    constexpr std::size_t minTracksPerRange = 1024;
+    return std::min(maxThreads(),
+                    std::max<std::size_t>(nTracks / minTracksPerRange, 1));
+  }
+
+  /// Compile the scoring plan from the configuration.
+  ///
+  /// @return the scoring plan
+  ScoringPlan compilePlan() const;
+
+  /// Apply the detector cuts and compute the detector term of the score.
+  ///
+  /// The features are transposed into one contiguous array per feature, such
+  /// that the cuts and weights of a detector are evaluated over all tracks in
+  /// one loop. The detector term is the weighted sum of the features for the
+  /// simple score and the product of the hit and hole factors for the
+  /// ambiguity function.
+  ///
+  /// @param trackFeaturesVectors is the trackFeatures map for each track
+  /// @param accepted is cleared for each track which fails the detector cuts,
+  ///        tracks not accepted on input are not scored
+  /// @return the detector term of the score for each track
+  std::vector<double> scoreDetectorFeatures(
+      const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
+      std::vector<std::uint8_t>& accepted) const;
+
+  /// Apply the kinematic cuts, the detector cuts and the optional cuts.
+  ///
+  /// @param tracks is the input track container
+  /// @param trackFeaturesVectors is the trackFeatures map for each track
+  /// @param optionalCuts is the user defined optional cuts to be applied.
+  /// @param accepted is set for each track which passes all cuts
+  /// @return the detector term of the score for each track
+  template <typename track_container_t, typename traj_t,
+            template <typename> class holder_t, bool ReadOnly>
+  std::vector<double> applyCuts(
+      const TrackContainer<track_container_t, traj_t, holder_t>& tracks,
+      const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
+      const OptionalCuts<track_container_t, traj_t, holder_t, ReadOnly>&
+          optionalCuts,
+      std::vector<std::uint8_t>& accepted) const;
+
   Config m_cfg;
 
+  ScoringPlan m_plan;
+
   /// Logging instance
   std::unique_ptr<const Logger> m_logger = nullptr;
 
@@ -10,6 +10,7 @@
 
 #include "Acts/AmbiguityResolution/ScoreBasedAmbiguityResolution.hpp"
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 
 #include <unordered_map>
@@ -38,9 +39,9 @@ ScoreBasedAmbiguityResolution::computeInitialState(
   measurementsPerTrack.reserve(tracks.size());
   ACTS_VERBOSE("Starting to compute initial state");
 
+  const std::size_t numberOfDetectors = m_plan.nDetectors();
   for (const auto& track : tracks) {
-    int numberOfDetectors = m_cfg.detectorConfigs.size();
-    int numberOfTrackStates = track.nTrackStates();
+    std::size_t numberOfTrackStates = track.nTrackStates();
     std::vector<MeasurementInfo> measurements;
     measurements.reserve(numberOfTrackStates);
     std::vector<TrackFeatures> trackFeaturesVector(numberOfDetectors);
@@ -51,12 +52,11 @@ ScoreBasedAmbiguityResolution::computeInitialState(
         continue;
       }
       auto iVolume = ts.referenceSurface().geometryId().volume();
-      auto volume_it = m_cfg.volumeMap.find(iVolume);
-      if (volume_it == m_cfg.volumeMap.end()) {
+      auto detectorId = m_plan.detectorId(iVolume);
+      if (detectorId == ScoringPlan::kNoDetector) {
         ACTS_ERROR("Volume " << iVolume << "not found in the volume map");
         continue;
       }
-      auto detectorId = volume_it->second;
 
       if (ts.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
         Acts::SourceLink sourceLink = ts.getUncalibratedSourceLink();
@@ -100,149 +100,138 @@ ScoreBasedAmbiguityResolution::computeInitialState(
 
 template <typename track_container_t, typename traj_t,
           template <typename> class holder_t, bool ReadOnly>
-std::vector<double> Acts::ScoreBasedAmbiguityResolution::simpleScore(
+std::vector<double> Acts::ScoreBasedAmbiguityResolution::applyCuts(
     const TrackContainer<track_container_t, traj_t, holder_t>& tracks,
     const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
     const OptionalCuts<track_container_t, traj_t, holder_t, ReadOnly>&
-        optionalCuts) const {
-  std::vector<double> trackScore;
-  trackScore.reserve(tracks.size());
+        optionalCuts,
+    std::vector<std::uint8_t>& accepted) const {
+  accepted.assign(tracks.size(), 0);
+
+  const std::size_t nTracks = tracks.size();
+  const std::size_t nRanges = nTrackRanges(nTracks);
+  parallelFor(nRanges, [&](std::size_t iRange) {
+    for (std::size_t iTrack = nTracks * iRange / nRanges;
+         iTrack < nTracks * (iRange + 1) / nRanges; ++iTrack) {
+      const auto track = tracks.getTrack(iTrack);
+      auto pT = Acts::VectorHelpers::perp(track.momentum());
+      auto eta = Acts::VectorHelpers::eta(track.momentum());
+      auto phi = Acts::VectorHelpers::phi(track.momentum());
+      // cuts on pT
+      if (pT < m_cfg.pTMin || pT > m_cfg.pTMax) {
+        ACTS_DEBUG("Track: " << iTrack
+                             << " has score = 0, due to pT cuts --- pT = "
+                             << pT);
+      }
+      // cuts on phi
+      else if (phi > m_cfg.phiMax || phi < m_cfg.phiMin) {
+        ACTS_DEBUG("Track: " << iTrack
+                             << " has score = 0, due to phi cuts --- phi =  "
+                             << phi);
+      }
+      // cuts on eta
+      else if (eta > m_cfg.etaMax || eta < m_cfg.etaMin) {
+        ACTS_DEBUG("Track: " << iTrack
+                             << " has score = 0, due to eta cuts --- eta =  "
+                             << eta);
+      } else {
+        accepted[iTrack] = 1;
+      }
+    }
+  });
 
-  int iTrack = 0;
+  // Reject tracks which didn't pass the detector cuts.
+  std::vector<double> detectorTerms =
+      scoreDetectorFeatures(trackFeaturesVectors, accepted);
 
-  ACTS_VERBOSE("Number of detectors: " << m_cfg.detectorConfigs.size());
+  // The optional cuts are only evaluated for the remaining tracks. They are
+  // user functions and called sequentially in track order.
+  if (!optionalCuts.cuts.empty()) {
+    for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+      if (accepted[iTrack] == 0) {
+        continue;
+      }
+      const auto track = tracks.getTrack(iTrack);
+      for (const auto& cutFunction : optionalCuts.cuts) {
+        if (cutFunction(track)) {
+          accepted[iTrack] = 0;
+          ACTS_DEBUG("Track: " << iTrack
+                               << " has score = 0, due to optional cuts.");
+          break;
+        }
+      }
+    }
+  }
+
+  return detectorTerms;
+}
+
+template <typename track_container_t, typename traj_t,
+          template <typename> class holder_t, bool ReadOnly>
+std::vector<double> Acts::ScoreBasedAmbiguityResolution::simpleScore(
+    const TrackContainer<track_container_t, traj_t, holder_t>& tracks,
+    const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
+    const OptionalCuts<track_container_t, traj_t, holder_t, ReadOnly>&
+        optionalCuts) const {
+  ACTS_VERBOSE("Number of detectors: " << m_plan.nDetectors());
 
   ACTS_INFO("Starting to score tracks");
 
-  // Loop over all the tracks in the container
-  for (const auto& track : tracks) {
-    // get the trackFeatures map for the track
-    const auto& trackFeaturesVector = trackFeaturesVectors[iTrack];
-    double score = 1;
-    auto pT = Acts::VectorHelpers::perp(track.momentum());
-    auto eta = Acts::VectorHelpers::eta(track.momentum());
-    auto phi = Acts::VectorHelpers::phi(track.momentum());
-    // cuts on pT
-    if (pT < m_cfg.pTMin || pT > m_cfg.pTMax) {
-      score = 0;
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack
-                           << " has score = 0, due to pT cuts --- pT = " << pT);
-      continue;
-    }
+  std::vector<std::uint8_t> accepted;
+  const std::vector<double> detectorTerms =
+      applyCuts(tracks, trackFeaturesVectors, optionalCuts, accepted);
 
-    // cuts on phi
-    if (phi > m_cfg.phiMax || phi < m_cfg.phiMin) {
-      score = 0;
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack
-                           << " has score = 0, due to phi cuts --- phi =  "
-                           << phi);
-      continue;
-    }
+  ACTS_VERBOSE("Using Simple Scoring function");
 
-    // cuts on eta
-    if (eta > m_cfg.etaMax || eta < m_cfg.etaMin) {
-      score = 0;
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack
-                           << " has score = 0, due to eta cuts --- eta =  "
-                           << eta);
-      continue;
-    }
+  // Tracks which didn't pass the cuts keep a score of 0
+  std::vector<double> trackScore(tracks.size(), 0);
+  // The chi2 term is added after the optional weights
+  std::vector<double> chi2Terms(tracks.size(), 0);
 
-    // cuts on optional cuts
-    for (const auto& cutFunction : optionalCuts.cuts) {
-      if (cutFunction(track)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to optional cuts.");
-        break;
+  // The score terms without the optional weights are independent per track
+  const std::size_t nTracks = tracks.size();
+  const std::size_t nRanges = nTrackRanges(nTracks);
+  parallelFor(nRanges, [&](std::size_t iRange) {
+    for (std::size_t iTrack = nTracks * iRange / nRanges;
+         iTrack < nTracks * (iRange + 1) / nRanges; ++iTrack) {
+      if (accepted[iTrack] == 0) {
+        continue;
       }
-    }
+      const auto track = tracks.getTrack(iTrack);
 
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
-    // Reject tracks which didn't pass the detector cuts.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
-
-      ACTS_DEBUG("---> Found summary information");
-      ACTS_DEBUG("---> Detector ID: " << detectorId);
-      ACTS_DEBUG("---> Number of hits: " << trackFeatures.nHits);
-      ACTS_DEBUG("---> Number of holes: " << trackFeatures.nHoles);
-      ACTS_DEBUG("---> Number of outliers: " << trackFeatures.nOutliers);
-
-      if ((trackFeatures.nHits < detector.minHits) ||
-          (trackFeatures.nHits > detector.maxHits) ||
-          (trackFeatures.nHoles > detector.maxHoles) ||
-          (trackFeatures.nOutliers > detector.maxOutliers)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to detector cuts");
-        break;
+      // Adding the score for each detector.
+      // detector score is determined by the number of hits/hole/outliers *
+      // hit/hole/outlier scoreWeights in a detector.
+      trackScore[iTrack] = 100 + detectorTerms[iTrack];
+
+      // The score based on the chi2/ndf
+      if (track.chi2() > 0 && track.nDoF() > 0) {
+        double p = 1. / std::log10(10. + 10. * track.chi2() / track.nDoF());
+        chi2Terms[iTrack] = (p > 0) ? p : -50.;
       }
     }
+  });
 
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
+  // The optional weights are user functions and applied sequentially in
+  // track order
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    if (accepted[iTrack] == 0) {
+      ACTS_DEBUG("Track: " << iTrack << " score : " << 0);
       continue;
     }
-
-    // real scoring starts here
-    // if the ambiguity scoring function is used, the score is processed with a
-    // different algorithm than the simple score.
-
-    ACTS_VERBOSE("Using Simple Scoring function");
-
-    score = 100;
-    // Adding the score for each detector.
-    // detector score is determined by the number of hits/hole/outliers *
-    // hit/hole/outlier scoreWeights in a detector.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
-
-      score += trackFeatures.nHits * detector.hitsScoreWeight;
-      score += trackFeatures.nHoles * detector.holesScoreWeight;
-      score += trackFeatures.nOutliers * detector.outliersScoreWeight;
-      score += trackFeatures.nSharedHits * detector.otherScoreWeight;
-    }
+    double& score = trackScore[iTrack];
 
     // Adding scores based on optional weights
-    for (const auto& weightFunction : optionalCuts.weights) {
-      weightFunction(track, score);
-    }
-
-    // Adding the score based on the chi2/ndf
-    if (track.chi2() > 0 && track.nDoF() > 0) {
-      double p = 1. / std::log10(10. + 10. * track.chi2() / track.nDoF());
-      if (p > 0) {
-        score += p;
-      } else {
-        score -= 50;
+    if (!optionalCuts.weights.empty()) {
+      const auto track = tracks.getTrack(iTrack);
+      for (const auto& weightFunction : optionalCuts.weights) {
+        weightFunction(track, score);
       }
     }
 
-    iTrack++;
-
-    // Add the score to the vector
-    trackScore.push_back(score);
+    // Adding the score based on the chi2/ndf
+    score += chi2Terms[iTrack];
     ACTS_VERBOSE("Track: " << iTrack << " score: " << score);
-
   }  // end of loop over tracks
 
   return trackScore;
@@ -255,176 +244,80 @@ std::vector<double> Acts::ScoreBasedAmbiguityResolution::ambiguityScore(
     const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
     const OptionalCuts<track_container_t, traj_t, holder_t, ReadOnly>&
         optionalCuts) const {
-  std::vector<double> trackScore;
-  trackScore.reserve(tracks.size());
-
   ACTS_VERBOSE("Using Ambiguity Scoring function");
 
-  int iTrack = 0;
-
-  ACTS_VERBOSE("Number of detectors: " << m_cfg.detectorConfigs.size());
+  ACTS_VERBOSE("Number of detectors: " << m_plan.nDetectors());
 
   ACTS_INFO("Starting to score tracks");
 
-  // Loop over all the tracks in the container
-  for (const auto& track : tracks) {
-    // get the trackFeatures map for the track
-    const auto& trackFeaturesVector = trackFeaturesVectors[iTrack];
-    double score = 1;
-    auto pT = Acts::VectorHelpers::perp(track.momentum());
-    auto eta = Acts::VectorHelpers::eta(track.momentum());
-    auto phi = Acts::VectorHelpers::phi(track.momentum());
-    // cuts on pT
-    if (pT < m_cfg.pTMin || pT > m_cfg.pTMax) {
-      score = 0;
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack
-                           << " has score = 0, due to pT cuts --- pT = " << pT);
-      continue;
-    }
-
-    // cuts on phi
-    if (phi > m_cfg.phiMax || phi < m_cfg.phiMin) {
-      score = 0;
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack
-                           << " has score = 0, due to phi cuts --- phi =  "
-                           << phi);
-      continue;
-    }
-
-    // cuts on eta
-    if (eta > m_cfg.etaMax || eta < m_cfg.etaMin) {
-      score = 0;
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack
-                           << " has score = 0, due to eta cuts --- eta =  "
-                           << eta);
-      continue;
-    }
-
-    // cuts on optional cuts
-    for (const auto& cutFunction : optionalCuts.cuts) {
-      if (cutFunction(track)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to optional cuts.");
-        break;
-      }
-    }
-
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
-    // Reject tracks which didn't pass the detector cuts.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
-
-      ACTS_DEBUG("---> Found summary information");
-      ACTS_DEBUG("---> Detector ID: " << detectorId);
-      ACTS_DEBUG("---> Number of hits: " << trackFeatures.nHits);
-      ACTS_DEBUG("---> Number of holes: " << trackFeatures.nHoles);
-      ACTS_DEBUG("---> Number of outliers: " << trackFeatures.nOutliers);
-
-      if ((trackFeatures.nHits < detector.minHits) ||
-          (trackFeatures.nHits > detector.maxHits) ||
-          (trackFeatures.nHoles > detector.maxHoles) ||
-          (trackFeatures.nOutliers > detector.maxOutliers)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to detector cuts");
-        break;
-      }
-    }
-
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
-
-    // start with larger score for tracks with higher pT.
-    score = std::log10(pT / UnitConstants::MeV) - 1.;
-    // pT in GeV, hence 100 MeV is minimum and gets score = 1
-    ACTS_DEBUG("Modifier for pT = " << pT << " GeV is : " << score
-                                    << "  New score now: " << score);
-
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
-
-      // choosing a scaling factor based on the number of hits in a track per
-      // detector.
-      std::size_t nHits = trackFeatures.nHits;
-      if (detector.factorHits.size() < nHits) {
-        ACTS_WARNING("Detector " << detectorId
-                                 << " has not enough factorhits in the "
-                                    "detector.factorHits vector");
+  std::vector<std::uint8_t> accepted;
+  const std::vector<double> detectorTerms =
+      applyCuts(tracks, trackFeaturesVectors, optionalCuts, accepted);
+
+  // Tracks which didn't pass the cuts keep a score of 0
+  std::vector<double> trackScore(tracks.size(), 0);
+  // The chi2 factor is applied after the optional scores
+  std::vector<double> chi2Factors(tracks.size(), 1);
+
+  // The score terms without the optional scores are independent per track
+  const std::size_t nTracks = tracks.size();
+  const std::size_t nRanges = nTrackRanges(nTracks);
+  parallelFor(nRanges, [&](std::size_t iRange) {
+    for (std::size_t iTrack = nTracks * iRange / nRanges;
+         iTrack < nTracks * (iRange + 1) / nRanges; ++iTrack) {
+      if (accepted[iTrack] == 0) {
         continue;
       }
-      if (nHits > detector.maxHits) {
-        score = score * (detector.maxHits - nHits + 1);  // hits are good !
-        nHits = detector.maxHits;
-      }
-      score = score * detector.factorHits[nHits];
-      ACTS_DEBUG("Modifier for " << nHits
-                                 << " hits: " << detector.factorHits[nHits]
-                                 << "  New score now: " << score);
+      const auto track = tracks.getTrack(iTrack);
 
-      // choosing a scaling factor based on the number of holes in a track per
+      // start with larger score for tracks with higher pT.
+      auto pT = Acts::VectorHelpers::perp(track.momentum());
+      double score = std::log10(pT / UnitConstants::MeV) - 1.;
+      // pT in GeV, hence 100 MeV is minimum and gets score = 1
+      ACTS_DEBUG("Modifier for pT = " << pT << " GeV is : " << score
+                                      << "  New score now: " << score);
+
+      // scaling factors based on the number of hits and holes in a track per
       // detector.
-      std::size_t iHoles = trackFeatures.nHoles;
-      if (detector.factorHoles.size() < iHoles) {
-        ACTS_WARNING("Detector " << detectorId
-                                 << " has not enough factorholes in the "
-                                    "detector.factorHoles vector");
-        continue;
-      }
-      if (iHoles > detector.maxHoles) {
-        score /= (iHoles - detector.maxHoles + 1);  // holes are bad !
-        iHoles = detector.maxHoles;
+      score = score * detectorTerms[iTrack];
+      ACTS_DEBUG("Modifier for hits and holes: "
+                 << detectorTerms[iTrack] << "  New score now: " << score);
+      trackScore[iTrack] = score;
+
+      if (track.chi2() > 0 && track.nDoF() > 0) {
+        double chi2 = track.chi2();
+        int indf = track.nDoF();
+        double fac = 1. / std::log10(10. + 10. * chi2 / indf);
+        chi2Factors[iTrack] = fac;
+        ACTS_DEBUG("Modifier for chi2 = " << chi2 << " and NDF = " << indf
+                                          << " is : " << fac);
       }
-      score = score * detector.factorHoles[iHoles];
-      ACTS_DEBUG("Modifier for " << iHoles
-                                 << " holes: " << detector.factorHoles[iHoles]
-                                 << "  New score now: " << score);
     }
+  });
 
-    for (const auto& scoreFunction : optionalCuts.scores) {
-      scoreFunction(track, score);
+  // The optional scores are user functions and applied sequentially in
+  // track order
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    if (accepted[iTrack] == 0) {
+      ACTS_DEBUG("Track: " << iTrack << " score : " << 0);
+      continue;
     }
+    double& score = trackScore[iTrack];
 
-    if (track.chi2() > 0 && track.nDoF() > 0) {
-      double chi2 = track.chi2();
-      int indf = track.nDoF();
-      double fac = 1. / std::log10(10. + 10. * chi2 / indf);
-      score = score * fac;
-      ACTS_DEBUG("Modifier for chi2 = " << chi2 << " and NDF = " << indf
-                                        << " is : " << fac
-                                        << "  New score now: " << score)
+    if (!optionalCuts.scores.empty()) {
+      const auto track = tracks.getTrack(iTrack);
+      for (const auto& scoreFunction : optionalCuts.scores) {
+        scoreFunction(track, score);
+      }
     }
-    iTrack++;
 
-    // Add the score to the vector
-    trackScore.push_back(score);
+    score = score * chi2Factors[iTrack];
     ACTS_VERBOSE("Track: " << iTrack << " score: " << score);
-
   }  // end of loop over tracks
 
   return trackScore;
 }
+
 template <typename track_container_t, typename traj_t,
           template <typename> class holder_t, bool ReadOnly>
 std::vector<int> Acts::ScoreBasedAmbiguityResolution::solveAmbiguity(
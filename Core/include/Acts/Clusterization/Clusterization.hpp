@@ -65,6 +65,10 @@ struct DefaultConnect<Cell, 1> : public Connect1D<Cell> {};
 ///   int  getCellColumn(const Cell&)
 ///   int& getCellLabel(Cell&)
 ///
+/// With the default 2-D connectivity (`Connect2D` or `DefaultConnect`) the
+/// cells are labelled by merging runs of consecutive rows between adjacent
+/// columns; any other connection type uses the generic neighbour search.
+///
 /// @param [in] cells the cell collection to be labeled
 /// @param [in] connect the connection type (see DefaultConnect)
 template <typename CellCollection, std::size_t GridDim = 2,
@@ -6,7 +6,9 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <array>
+#include <type_traits>
 #include <vector>
 
 #include <boost/pending/disjoint_sets.hpp>
@@ -132,6 +134,121 @@ class DisjointSets {
   boost::disjoint_sets<std::size_t*, std::size_t*> m_ds;
 };
 
+// Union-find over a flat label array with path halving. The root of a
+// merged set is always its smallest label.
+class FlatDisjointSets {
+ public:
+  Label makeSet() {
+    const auto label = static_cast<Label>(m_parent.size());
+    m_parent.push_back(label);
+    return label;
+  }
+
+  void unionSet(Label x, Label y) {
+    x = findSet(x);
+    y = findSet(y);
+    if (x < y) {
+      m_parent[y] = x;
+    } else if (y < x) {
+      m_parent[x] = y;
+    }
+  }
+
+  Label findSet(Label x) {
+    while (m_parent[x] != x) {
+      m_parent[x] = m_parent[m_parent[x]];
+      x = m_parent[x];
+    }
+    return x;
+  }
+
+ private:
+  // Slot 0 is reserved for NO_LABEL
+  std::vector<Label> m_parent{NO_LABEL};
+};
+
+// Labelling specialised for the default 2-D connectivity. The column-wise
+// sorted cells are grouped into runs of consecutive rows within a column,
+// and each run only has to be compared to the overlapping runs of the
+// previous column. Both columns are ordered by row, so this is a linear
+// merge instead of a backward search per cell.
+template <typename CellCollection>
+void labelClustersRuns(CellCollection& cells, bool commonCorner) {
+  using Cell = typename CellCollection::value_type;
+
+  struct Run {
+    int col;
+    int row0;
+    int row1;
+    std::size_t begin;
+    std::size_t end;
+    Label label = NO_LABEL;
+  };
+
+  std::sort(cells.begin(), cells.end(), Compare<Cell, 2>());
+
+  std::vector<Run> runs;
+  runs.reserve(cells.size());
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    const int col = getCellColumn(cells[i]);
+    const int row = getCellRow(cells[i]);
+    if (!runs.empty() && runs.back().col == col &&
+        row <= runs.back().row1 + 1) {
+      runs.back().row1 = row;
+      runs.back().end = i + 1;
+    } else {
+      runs.push_back(Run{col, row, row, i, i + 1});
+    }
+  }
+
+  // Runs in neighbouring columns touch if their rows overlap, or are
+  // diagonally adjacent with 8-cell connectivity
+  const int reach = commonCorner ? 1 : 0;
+
+  FlatDisjointSets ds;
+  // Runs of the previous column and the first candidate among them
+  std::size_t prevBegin = 0;
+  std::size_t prevEnd = 0;
+  std::size_t candidate = 0;
+  std::size_t columnBegin = 0;
+  for (std::size_t ir = 0; ir < runs.size(); ++ir) {
+    Run& run = runs[ir];
+    if (ir == 0 || run.col != runs[ir - 1].col) {
+      if (ir > 0 && runs[ir - 1].col == run.col - 1) {
+        prevBegin = columnBegin;
+        prevEnd = ir;
+      } else {
+        prevBegin = ir;
+        prevEnd = ir;
+      }
+      candidate = prevBegin;
+      columnBegin = ir;
+    }
+    // Previous runs ending below this run can not touch any later run either
+    while (candidate < prevEnd && runs[candidate].row1 + reach < run.row0) {
+      ++candidate;
+    }
+    for (std::size_t ip = candidate;
+         ip < prevEnd && runs[ip].row0 <= run.row1 + reach; ++ip) {
+      if (run.label == NO_LABEL) {
+        run.label = runs[ip].label;
+      } else {
+        ds.unionSet(run.label, runs[ip].label);
+      }
+    }
+    if (run.label == NO_LABEL) {
+      run.label = ds.makeSet();
+    }
+  }
+
+  for (const Run& run : runs) {
+    const Label label = ds.findSet(run.label);
+    for (std::size_t i = run.begin; i < run.end; ++i) {
+      getCellLabel(cells[i]) = label;
+    }
+  }
+}
+
 template <std::size_t BufSize>
 struct ConnectionsBase {
   std::size_t nconn{0};
@@ -270,6 +387,14 @@ void labelClusters(CellCollection& cells, Connect connect) {
   using Cell = typename CellCollection::value_type;
   internal::staticCheckCellType<Cell, GridDim>();
 
+  // The default 2-D connectivity has a dedicated linear-time labelling
+  if constexpr (GridDim == 2 &&
+                (std::is_same_v<Connect, Connect2D<Cell>> ||
+                 std::is_same_v<Connect, DefaultConnect<Cell, 2>>)) {
+    internal::labelClustersRuns(cells, connect.conn8);
+    return;
+  }
+
   internal::DisjointSets ds{};
 
   // Sort cells by position to enable in-order scan
@@ -59,6 +59,10 @@ class CylindricalContainerBuilder : public IDetectorComponentBuilder {
     std::map<unsigned int, BinningDescription> portalMaterialBinning = {};
     /// An eventual reverse geometry id generation
     bool geoIdReverseGen = false;
+    /// Run the builders concurrently within the @c Acts::maxThreads budget,
+    /// the components are connected in builder order, i.e. independent of it
+    /// @note the builders have to be safe to run concurrently
+    bool buildConcurrently = false;
     /// Auxiliary information, mainly for screen output
     std::string auxiliary = "";
   };
@@ -78,6 +82,8 @@ class CylindricalContainerBuilder : public IDetectorComponentBuilder {
   ///
   /// @param bpNode is the entry blue print node
   /// @param logLevel is the logging output level for the builder tools
+  /// @param buildConcurrently is the flag to build the branches of this and
+  ///        the nested containers concurrently
   ///
   /// @note no checking is being done on consistency of the blueprint,
   /// it is assumed it has passed first through gap filling via the
@@ -88,7 +94,8 @@ class CylindricalContainerBuilder : public IDetectorComponentBuilder {
   /// @return a cylindrical container builder representing this blueprint
   CylindricalContainerBuilder(
       const Acts::Experimental::Blueprint::Node& bpNode,
-      Acts::Logging::Level logLevel = Acts::Logging::INFO);
+      Acts::Logging::Level logLevel = Acts::Logging::INFO,
+      bool buildConcurrently = false);
 
   /// The final implementation of the cylindrical container builder
   ///
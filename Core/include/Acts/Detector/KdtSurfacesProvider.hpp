@@ -16,6 +16,7 @@
 #include "Acts/Utilities/KDTree.hpp"
 
 #include <array>
+#include <iterator>
 #include <stdexcept>
 #include <tuple>
 #include <vector>
@@ -89,9 +90,25 @@ class KdtSurfaces {
       const RangeXD<kDIM, ActsScalar>& range) const {
     // Strip the surfaces
     std::vector<std::shared_ptr<Surface>> surfacePtrs;
-    auto surfaceQuery = m_kdt->rangeSearchWithKey(range);
-    std::for_each(surfaceQuery.begin(), surfaceQuery.end(),
-                  [&](auto& surf) { surfacePtrs.push_back(surf.second); });
+    m_kdt->rangeSearchInserter(range, std::back_inserter(surfacePtrs));
+    return surfacePtrs;
+  }
+
+  /// Query with several Range objects in a single traversal of the tree
+  ///
+  /// @param ranges are the ranges to be queried
+  ///
+  /// @return the matching surfaces for each of the ranges, in the same
+  /// order as the individual queries would return them
+  std::vector<std::vector<std::shared_ptr<Surface>>> surfaces(
+      const std::vector<RangeXD<kDIM, ActsScalar>>& ranges) const {
+    std::vector<std::vector<std::shared_ptr<Surface>>> surfacePtrs(
+        ranges.size());
+    m_kdt->rangeSearchMultiMapDiscard(
+        ranges, [&](std::size_t ir, const Query& /*unused*/,
+                    const std::shared_ptr<Surface>& surface) {
+          surfacePtrs[ir].push_back(surface);
+        });
     return surfacePtrs;
   }
 
@@ -101,11 +118,26 @@ class KdtSurfaces {
   ///
   /// @return the matching surfaces fpulled from the KDT structure
   std::vector<std::shared_ptr<Surface>> surfaces(const Extent& extent) const {
-    RangeXD<kDIM, ActsScalar> qRange;
-    for (auto [ibv, v] : enumerate(m_casts)) {
-      qRange[ibv] = extent.range(v);
+    return surfaces(queryRange(extent));
+  }
+
+  /// Query with several Extent objects in a single traversal of the tree
+  ///
+  /// This is the cheaper way to pull the surfaces of many regions, e.g. of
+  /// all layers of a detector, which can then be handed to the layer
+  /// builders with a @c LayerStructureBuilder::SurfacesHolder
+  ///
+  /// @param extents are the range Extents to be queried
+  ///
+  /// @return the matching surfaces for each of the extents
+  std::vector<std::vector<std::shared_ptr<Surface>>> surfaces(
+      const std::vector<Extent>& extents) const {
+    std::vector<RangeXD<kDIM, ActsScalar>> qRanges;
+    qRanges.reserve(extents.size());
+    for (const auto& extent : extents) {
+      qRanges.push_back(queryRange(extent));
     }
-    return surfaces(qRange);
+    return surfaces(qRanges);
   }
 
  private:
@@ -118,6 +150,16 @@ class KdtSurfaces {
   /// Helper to generate reference points for filling
   reference_generator m_rGenerator;
 
+  /// Convert an Extent into the query range of the tree
+  /// @param extent is the range Extent to be converted
+  RangeXD<kDIM, ActsScalar> queryRange(const Extent& extent) const {
+    RangeXD<kDIM, ActsScalar> qRange;
+    for (auto [ibv, v] : enumerate(m_casts)) {
+      qRange[ibv] = extent.range(v);
+    }
+    return qRange;
+  }
+
   /// Unroll the cast loop
   /// @param position is the position of the update call
   /// @param a is the array to be filled
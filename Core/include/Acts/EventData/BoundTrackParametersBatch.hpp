@@ -0,0 +1,179 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// Collection of bound track parameters stored as separate columns
+///
+/// Compared to a vector of @c BoundTrackParameters the parameter vectors and
+/// covariances are contiguous, and each reference surface is stored once and
+/// referred to by index. Adding an entry does not copy the surface pointer
+/// unless the surface is new, which avoids the reference counting per track.
+class BoundTrackParametersBatch {
+ public:
+  using ParametersVector = BoundVector;
+  using CovarianceMatrix = BoundSquareMatrix;
+  using SurfaceIndex = std::uint32_t;
+
+  /// Reserve space for a number of entries
+  /// @param size The expected number of entries
+  void reserve(std::size_t size) {
+    m_parameters.reserve(size);
+    m_covariances.reserve(size);
+    m_hasCovariance.reserve(size);
+    m_surfaceIndices.reserve(size);
+    m_particleHypotheses.reserve(size);
+  }
+
+  /// Add an entry
+  /// @param surface The reference surface
+  /// @param params The bound parameters vector
+  /// @param cov The optional covariance matrix
+  /// @param particleHypothesis The particle hypothesis
+  /// @return The index of the new entry
+  std::size_t emplace_back(std::shared_ptr<const Surface> surface,
+                           const ParametersVector& params,
+                           const std::optional<CovarianceMatrix>& cov,
+                           const ParticleHypothesis& particleHypothesis) {
+    assert(surface != nullptr && "Reference surface must not be null");
+    auto [it, inserted] = m_surfaceLookup.try_emplace(
+        surface.get(), static_cast<SurfaceIndex>(m_surfaces.size()));
+    if (inserted) {
+      m_surfaces.push_back(std::move(surface));
+    }
+    return addEntry(it->second, params, cov, particleHypothesis);
+  }
+
+  /// Add an entry from track parameters
+  /// @param parameters The track parameters
+  /// @return The index of the new entry
+  std::size_t push_back(const BoundTrackParameters& parameters) {
+    const Surface& surface = parameters.referenceSurface();
+    auto it = m_surfaceLookup.find(&surface);
+    if (it == m_surfaceLookup.end()) {
+      return emplace_back(surface.getSharedPtr(), parameters.parameters(),
+                          parameters.covariance(),
+                          parameters.particleHypothesis());
+    }
+    return addEntry(it->second, parameters.parameters(),
+                    parameters.covariance(), parameters.particleHypothesis());
+  }
+
+  std::size_t size() const { return m_parameters.size(); }
+
+  bool empty() const { return m_parameters.empty(); }
+
+  /// Remove all entries and surfaces, keeping the allocated storage
+  void clear() {
+    m_parameters.clear();
+    m_covariances.clear();
+    m_hasCovariance.clear();
+    m_surfaceIndices.clear();
+    m_particleHypotheses.clear();
+    m_surfaces.clear();
+    m_surfaceLookup.clear();
+  }
+
+  /// All parameter vectors, contiguous in memory
+  const std::vector<ParametersVector>& parameters() const {
+    return m_parameters;
+  }
+
+  /// All covariance matrices, contiguous in memory. Entries without
+  /// covariance hold a zero matrix.
+  const std::vector<CovarianceMatrix>& covariances() const {
+    return m_covariances;
+  }
+
+  /// The reference surface index of all entries
+  const std::vector<SurfaceIndex>& surfaceIndices() const {
+    return m_surfaceIndices;
+  }
+
+  /// The distinct reference surfaces
+  const std::vector<std::shared_ptr<const Surface>>& surfaces() const {
+    return m_surfaces;
+  }
+
+  const ParametersVector& parameters(std::size_t i) const {
+    return m_parameters[i];
+  }
+
+  bool hasCovariance(std::size_t i) const { return m_hasCovariance[i] != 0; }
+
+  std::optional<CovarianceMatrix> covariance(std::size_t i) const {
+    if (!hasCovariance(i)) {
+      return std::nullopt;
+    }
+    return m_covariances[i];
+  }
+
+  const Surface& referenceSurface(std::size_t i) const {
+    return *m_surfaces[m_surfaceIndices[i]];
+  }
+
+  const ParticleHypothesis& particleHypothesis(std::size_t i) const {
+    return m_particleHypotheses[i];
+  }
+
+  /// Recreate the track parameters of an entry
+  /// @param i The index of the entry
+  BoundTrackParameters at(std::size_t i) const {
+    return BoundTrackParameters{m_surfaces[m_surfaceIndices[i]],
+                                m_parameters[i], covariance(i),
+                                m_particleHypotheses[i]};
+  }
+
+  /// The index of an entry given its parameter vector
+  /// @param params Reference to a parameter vector of this batch
+  std::size_t index(const ParametersVector& params) const {
+    assert(&params >= m_parameters.data() &&
+           &params < m_parameters.data() + m_parameters.size() &&
+           "Parameters are not part of this batch");
+    return static_cast<std::size_t>(&params - m_parameters.data());
+  }
+
+ private:
+  std::size_t addEntry(SurfaceIndex isurface, const ParametersVector& params,
+                       const std::optional<CovarianceMatrix>& cov,
+                       const ParticleHypothesis& particleHypothesis) {
+    m_surfaceIndices.push_back(isurface);
+    m_parameters.push_back(params);
+    m_covariances.push_back(cov.value_or(CovarianceMatrix::Zero()));
+    m_hasCovariance.push_back(cov.has_value());
+    m_particleHypotheses.push_back(particleHypothesis);
+    return m_parameters.size() - 1;
+  }
+
+  std::vector<ParametersVector> m_parameters;
+  std::vector<CovarianceMatrix> m_covariances;
+  std::vector<std::uint8_t> m_hasCovariance;
+  std::vector<SurfaceIndex> m_surfaceIndices;
+  std::vector<ParticleHypothesis> m_particleHypotheses;
+
+  std::vector<std::shared_ptr<const Surface>> m_surfaces;
+  std::unordered_map<const Surface*, SurfaceIndex> m_surfaceLookup;
+};
+
+}  // namespace Acts
@@ -0,0 +1,72 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// Memory footprint of the columns of a track or track state container
+///
+/// This only reads the sizes and capacities of the columns and is cheap
+/// enough to be collected for every event, e.g. to size the reserves or to
+/// monitor the combinatorics of the track finding.
+struct ContainerFootprint {
+  struct Column {
+    /// Name of the column, dynamic columns are named by their key hash
+    std::string name;
+    /// Number of elements in use
+    std::size_t size = 0;
+    /// Number of elements allocated
+    std::size_t capacity = 0;
+    /// Size of one element in bytes
+    std::size_t elementSize = 0;
+
+    std::size_t bytes() const { return size * elementSize; }
+    std::size_t capacityBytes() const { return capacity * elementSize; }
+  };
+
+  std::vector<Column> columns;
+
+  /// Number of times the storage of the container grew since it was
+  /// constructed or cleared
+  std::size_t growthEvents = 0;
+
+  /// Total bytes in use
+  std::size_t bytes() const {
+    std::size_t total = 0;
+    for (const auto& column : columns) {
+      total += column.bytes();
+    }
+    return total;
+  }
+
+  /// Total bytes allocated
+  std::size_t capacityBytes() const {
+    std::size_t total = 0;
+    for (const auto& column : columns) {
+      total += column.capacityBytes();
+    }
+    return total;
+  }
+
+  /// Add a column stored in a vector-like container
+  /// @param name The name of the column
+  /// @param column The column storage
+  template <typename column_t>
+  void add(std::string name, const column_t& column) {
+    columns.push_back({std::move(name), column.size(), column.capacity(),
+                       sizeof(typename column_t::value_type)});
+  }
+};
+
+}  // namespace Acts
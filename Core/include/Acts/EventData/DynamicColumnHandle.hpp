@@ -0,0 +1,96 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/Types.hpp"
+#include "Acts/EventData/detail/DynamicColumn.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Acts {
+
+/// Typed handle on the storage of a dynamic column of a vector backend
+///
+/// The column is looked up once when the handle is created, e.g. with
+/// @c VectorMultiTrajectory::dynamicColumnHandle, after which an access is
+/// a plain index into the column storage. This avoids hashing and looking up
+/// the key for every track or track state in a loop.
+///
+/// The handle stays valid when tracks or track states are added, and is
+/// invalidated when the backend is destroyed.
+///
+/// @tparam T The value type of the column
+/// @tparam ReadOnly true if the handle only gives const access
+template <typename T, bool ReadOnly>
+class DynamicColumnHandle {
+  using Column = std::conditional_t<ReadOnly, const detail::DynamicColumn<T>,
+                                    detail::DynamicColumn<T>>;
+
+ public:
+  using Reference = std::conditional_t<ReadOnly, const T&, T&>;
+
+  /// @param column The column the handle refers to
+  explicit DynamicColumnHandle(Column& column) : m_column{&column} {}
+
+  /// Access the value of the column at an index
+  /// @param index The index of the track or track state
+  Reference operator[](TrackIndexType index) const {
+    return m_column->value(index);
+  }
+
+  /// Access the value of the column for a track or track state proxy
+  /// @tparam proxy_t The type of the proxy, which has to refer to the
+  ///         backend the handle was created from
+  /// @param proxy The proxy
+  template <typename proxy_t>
+  Reference operator()(const proxy_t& proxy) const {
+    return m_column->value(proxy.index());
+  }
+
+  /// The number of entries in the column
+  std::size_t size() const { return m_column->size(); }
+
+ private:
+  Column* m_column;
+};
+
+template <typename T>
+using MutableDynamicColumnHandle = DynamicColumnHandle<T, false>;
+template <typename T>
+using ConstDynamicColumnHandle = DynamicColumnHandle<T, true>;
+
+namespace detail {
+
+/// Find a dynamic column in the column map of a vector backend
+/// @throw std::invalid_argument if the column does not exist or has a
+///        different type
+template <typename T, typename column_map_t>
+auto& findDynamicColumn(column_map_t& columns, HashedString key) {
+  using column_t =
+      std::conditional_t<std::is_const_v<column_map_t>,
+                         const DynamicColumn<T>, DynamicColumn<T>>;
+
+  auto it = columns.find(key);
+  if (it == columns.end()) {
+    throw std::invalid_argument("Unable to find the dynamic column");
+  }
+  auto* column = dynamic_cast<column_t*>(it->second.get());
+  if (column == nullptr) {
+    throw std::invalid_argument("Dynamic column has a different type");
+  }
+  return *column;
+}
+
+}  // namespace detail
+
+}  // namespace Acts
@@ -0,0 +1,574 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/PdgParticle.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackContainerBackendConcept.hpp"
+#include "Acts/EventData/TrackStateType.hpp"
+#include "Acts/EventData/Types.hpp"
+#include "Acts/EventData/detail/DynamicColumn.hpp"
+#include "Acts/EventData/detail/DynamicKeyIterator.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Concepts.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+#include "Acts/Utilities/MappedFile.hpp"
+
+#include <any>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+template <typename T>
+struct IsReadOnlyTrackContainer;
+template <typename T>
+struct IsReadOnlyMultiTrajectory;
+
+namespace detail_mtc {
+
+using IndexType = MultiTrajectoryTraits::IndexType;
+static constexpr auto kInvalid = MultiTrajectoryTraits::kInvalid;
+
+/// Sections of a mapped track file. Every section is a contiguous array and
+/// starts at an offset aligned to @c kSectionAlignment.
+enum Section : std::size_t {
+  eTracks = 0,
+  eTrackParameters,
+  eTrackCovariances,
+  eStates,
+  eParameters,
+  eCovariances,
+  eJacobians,
+  eMeasurements,
+  eMeasurementCovariances,
+  eSurfaces,
+  eNumSections,
+};
+
+static constexpr std::size_t kSectionAlignment = 64;
+static constexpr std::uint32_t kVersion = 1;
+static constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S',
+                                               'T', 'R', 'K', 'C'};
+
+struct SectionRange {
+  std::uint64_t offset = 0;
+  std::uint64_t size = 0;
+};
+
+struct FileHeader {
+  std::array<char, 8> magic = kMagic;
+  std::uint32_t version = kVersion;
+  /// Sizes of the records, to detect files written with a different layout
+  std::uint32_t headerSize = 0;
+  std::uint32_t trackRecordSize = 0;
+  std::uint32_t stateRecordSize = 0;
+  std::uint32_t surfaceRecordSize = 0;
+  std::uint32_t reserved = 0;
+  std::array<SectionRange, eNumSections> sections{};
+};
+
+struct TrackRecord {
+  IndexType tipIndex = kInvalid;
+  IndexType stemIndex = kInvalid;
+  unsigned int nMeasurements = 0;
+  unsigned int nHoles = 0;
+  unsigned int ndf = 0;
+  unsigned int nOutliers = 0;
+  unsigned int nSharedHits = 0;
+  float chi2 = 0;
+  /// Index into the surface section
+  IndexType surface = kInvalid;
+  std::int32_t absPdg = 0;
+  float mass = 0;
+  float absQ = 0;
+};
+
+struct StateRecord {
+  IndexType previous = kInvalid;
+  IndexType next = kInvalid;
+  IndexType ipredicted = kInvalid;
+  IndexType ifiltered = kInvalid;
+  IndexType ismoothed = kInvalid;
+  IndexType ijacobian = kInvalid;
+  IndexType measOffset = kInvalid;
+  IndexType measCovOffset = kInvalid;
+  IndexType measdim = kInvalid;
+  /// Index into the surface section
+  IndexType surface = kInvalid;
+  float chi2 = 0;
+  std::uint32_t hasProjector = 0;
+  double pathLength = 0;
+  TrackStateType::raw_type typeFlags{};
+  ProjectorBitset projector{};
+};
+
+struct SurfaceRecord {
+  enum Type : std::uint32_t { eGeometry = 0, ePerigee = 1 };
+
+  /// Geometry identifier of a surface of the tracking geometry
+  std::uint64_t geometryId = 0;
+  std::uint32_t type = eGeometry;
+  std::uint32_t reserved = 0;
+  /// Position of a free-standing perigee surface
+  std::array<double, 3> center{};
+};
+
+static_assert(std::is_trivially_copyable_v<TrackRecord>);
+static_assert(std::is_trivially_copyable_v<StateRecord>);
+static_assert(std::is_trivially_copyable_v<SurfaceRecord>);
+
+/// In-memory content of a mapped track file before it is written
+struct FileContent {
+  std::vector<TrackRecord> tracks;
+  std::vector<double> trackParameters;
+  std::vector<double> trackCovariances;
+  std::vector<StateRecord> states;
+  std::vector<double> parameters;
+  std::vector<double> covariances;
+  std::vector<double> jacobians;
+  std::vector<double> measurements;
+  std::vector<double> measurementCovariances;
+  std::vector<SurfaceRecord> surfaces;
+};
+
+/// Write the header and all sections of @p content
+void writeFile(std::ostream& os, const FileContent& content);
+
+/// Empty dynamic key range, as the mapped backends have no dynamic columns
+detail::DynamicKeyRange<detail::DynamicColumnBase> noDynamicKeys();
+
+}  // namespace detail_mtc
+
+/// Read-only memory mapping of a track file written by @c writeMappedTracks
+///
+/// The file is a columnar image of the track and track state columns: fixed
+/// size records per track and track state, followed by pools of parameters,
+/// covariances, Jacobians and calibrated measurements which are referenced by
+/// index. Nothing is copied when the file is opened, the operating system
+/// pages the data in on access. The header, the section bounds and the
+/// indices of the track and track state records are validated when the file
+/// is opened, which reads the records once. The values are trusted.
+///
+/// @note The file uses the native byte order and record layout and is meant
+///       to be read on the same platform it was written on.
+class MappedTrackFile {
+ public:
+  /// Map a file into memory
+  /// @param path The path of the file
+  /// @throw std::runtime_error if the file can not be mapped or is not a
+  ///        valid track file
+  explicit MappedTrackFile(const std::string& path);
+
+  MappedTrackFile(const MappedTrackFile&) = delete;
+  MappedTrackFile& operator=(const MappedTrackFile&) = delete;
+
+  /// The number of tracks in the file
+  std::size_t nTracks() const;
+
+  /// The number of track states in the file
+  std::size_t nTrackStates() const;
+
+  /// The first element of a section
+  /// @tparam T The element type of the section
+  /// @param section The section
+  template <typename T>
+  const T* section(detail_mtc::Section section) const {
+    return reinterpret_cast<const T*>(m_file.data() +
+                                      header().sections[section].offset);
+  }
+
+  /// The size of a section in units of its element type
+  /// @tparam T The element type of the section
+  /// @param section The section
+  template <typename T>
+  std::size_t sectionSize(detail_mtc::Section section) const {
+    return header().sections[section].size / sizeof(T);
+  }
+
+ private:
+  const detail_mtc::FileHeader& header() const {
+    return *reinterpret_cast<const detail_mtc::FileHeader*>(m_file.data());
+  }
+
+  MappedFile m_file;
+};
+
+/// Lookup of the surfaces of the tracking geometry by geometry identifier,
+/// e.g. @c TrackingGeometry::findSurface
+using MappedSurfaceLookup =
+    std::function<const Surface*(const GeometryIdentifier&)>;
+
+namespace detail_mtc {
+
+/// Reference surfaces of a mapped track file
+///
+/// Surfaces of the tracking geometry are resolved with the lookup, free
+/// standing perigee surfaces are recreated and owned.
+class MappedSurfaces {
+ public:
+  MappedSurfaces(const MappedTrackFile& file,
+                 const MappedSurfaceLookup& lookup);
+
+  const Surface* at(IndexType isurface) const {
+    return isurface == kInvalid ? nullptr : m_surfaces[isurface];
+  }
+
+ private:
+  std::vector<const Surface*> m_surfaces;
+  std::vector<std::shared_ptr<const Surface>> m_owned;
+};
+
+}  // namespace detail_mtc
+
+class ConstMappedTrackContainer;
+
+template <>
+struct IsReadOnlyTrackContainer<ConstMappedTrackContainer> : std::true_type {};
+
+/// Read-only track backend on top of a @c MappedTrackFile
+///
+/// @note Dynamic columns are not stored in the file.
+class ConstMappedTrackContainer final {
+ public:
+  using IndexType = MultiTrajectoryTraits::IndexType;
+  static constexpr auto kInvalid = MultiTrajectoryTraits::kInvalid;
+  static constexpr auto MeasurementSizeMax =
+      MultiTrajectoryTraits::MeasurementSizeMax;
+
+  using ConstParameters =
+      typename detail_lt::Types<eBoundSize, true>::CoefficientsMap;
+  using ConstCovariance =
+      typename detail_lt::Types<eBoundSize, true>::CovarianceMap;
+
+  /// @param file The mapped track file
+  /// @param lookup Lookup of the reference surfaces
+  ConstMappedTrackContainer(std::shared_ptr<const MappedTrackFile> file,
+                            const MappedSurfaceLookup& lookup);
+
+  // BEGIN INTERFACE
+
+  std::any component_impl(HashedString key, IndexType itrack) const;
+
+  ConstParameters parameters(IndexType itrack) const {
+    return ConstParameters{m_parameters + itrack * eBoundSize};
+  }
+
+  ConstCovariance covariance(IndexType itrack) const {
+    return ConstCovariance{m_covariances + itrack * eBoundSize * eBoundSize};
+  }
+
+  bool hasColumn_impl(HashedString /*key*/) const { return false; }
+
+  const Surface* referenceSurface_impl(IndexType itrack) const {
+    return m_surfaces->at(m_tracks[itrack].surface);
+  }
+
+  ParticleHypothesis particleHypothesis_impl(IndexType itrack) const {
+    const auto& track = m_tracks[itrack];
+    return ParticleHypothesis{static_cast<PdgParticle>(track.absPdg),
+                              track.mass, AnyCharge{track.absQ}};
+  }
+
+  std::size_t size_impl() const { return m_size; }
+
+  detail::DynamicKeyRange<detail::DynamicColumnBase> dynamicKeys_impl() const {
+    return detail_mtc::noDynamicKeys();
+  }
+
+  // END INTERFACE
+
+ private:
+  std::shared_ptr<const MappedTrackFile> m_file;
+  std::shared_ptr<const detail_mtc::MappedSurfaces> m_surfaces;
+
+  const detail_mtc::TrackRecord* m_tracks = nullptr;
+  const double* m_parameters = nullptr;
+  const double* m_covariances = nullptr;
+  std::size_t m_size = 0;
+};
+
+ACTS_STATIC_CHECK_CONCEPT(ConstTrackContainerBackend,
+                          ConstMappedTrackContainer);
+
+class ConstMappedMultiTrajectory;
+
+template <>
+struct IsReadOnlyMultiTrajectory<ConstMappedMultiTrajectory> : std::true_type {
+};
+
+/// Read-only track state backend on top of a @c MappedTrackFile
+///
+/// @note Uncalibrated source links and dynamic columns are not stored in the
+///       file.
+class ConstMappedMultiTrajectory final
+    : public MultiTrajectory<ConstMappedMultiTrajectory> {
+#ifndef DOXYGEN
+  friend MultiTrajectory<ConstMappedMultiTrajectory>;
+#endif
+
+ public:
+  /// @param file The mapped track file
+  /// @param lookup Lookup of the reference surfaces
+  ConstMappedMultiTrajectory(std::shared_ptr<const MappedTrackFile> file,
+                             const MappedSurfaceLookup& lookup);
+
+  // BEGIN INTERFACE
+
+  ConstTrackStateProxy::Parameters parameters_impl(IndexType parIdx) const {
+    return ConstTrackStateProxy::Parameters{m_parameters + parIdx * eBoundSize};
+  }
+
+  ConstTrackStateProxy::Covariance covariance_impl(IndexType parIdx) const {
+    return ConstTrackStateProxy::Covariance{m_covariances +
+                                            parIdx * eBoundSize * eBoundSize};
+  }
+
+  ConstTrackStateProxy::Covariance jacobian_impl(IndexType istate) const {
+    IndexType jacIdx = m_states[istate].ijacobian;
+    return ConstTrackStateProxy::Covariance{m_jacobians +
+                                            jacIdx * eBoundSize * eBoundSize};
+  }
+
+  template <std::size_t measdim>
+  ConstTrackStateProxy::Measurement<measdim> measurement_impl(
+      IndexType istate) const {
+    IndexType offset = m_states[istate].measOffset;
+    return ConstTrackStateProxy::Measurement<measdim>{&m_measurements[offset]};
+  }
+
+  template <std::size_t measdim>
+  ConstTrackStateProxy::MeasurementCovariance<measdim>
+  measurementCovariance_impl(IndexType istate) const {
+    IndexType offset = m_states[istate].measCovOffset;
+    return ConstTrackStateProxy::MeasurementCovariance<measdim>{
+        &m_measurementCovariances[offset]};
+  }
+
+  bool has_impl(HashedString key, IndexType istate) const;
+
+  IndexType size_impl() const { return m_size; }
+
+  std::any component_impl(HashedString key, IndexType istate) const;
+
+  bool hasColumn_impl(HashedString key) const;
+
+  IndexType calibratedSize_impl(IndexType istate) const {
+    return m_states[istate].measdim;
+  }
+
+  SourceLink getUncalibratedSourceLink_impl(IndexType istate) const;
+
+  const Surface* referenceSurface_impl(IndexType istate) const {
+    return m_surfaces->at(m_states[istate].surface);
+  }
+
+  detail::DynamicKeyRange<detail::DynamicColumnBase> dynamicKeys_impl() const {
+    return detail_mtc::noDynamicKeys();
+  }
+
+  // END INTERFACE
+
+ private:
+  std::shared_ptr<const MappedTrackFile> m_file;
+  std::shared_ptr<const detail_mtc::MappedSurfaces> m_surfaces;
+
+  const detail_mtc::StateRecord* m_states = nullptr;
+  const double* m_parameters = nullptr;
+  const double* m_covariances = nullptr;
+  const double* m_jacobians = nullptr;
+  const double* m_measurements = nullptr;
+  const double* m_measurementCovariances = nullptr;
+  IndexType m_size = 0;
+};
+
+ACTS_STATIC_CHECK_CONCEPT(ConstMultiTrajectoryBackend,
+                          ConstMappedMultiTrajectory);
+
+/// Write a track container in the layout read by @c MappedTrackFile
+///
+/// All track states are written in their index order, such that the track
+/// tip and stem indices stay valid. Parameters, Jacobians and calibrated
+/// measurements shared between track states are written once.
+///
+/// @param os The output stream, which has to be opened in binary mode
+/// @param gctx The geometry context to place free-standing perigee surfaces
+/// @param tracks The track container to write
+/// @throw std::invalid_argument if a reference surface is neither part of
+///        the tracking geometry nor a free-standing perigee surface
+template <typename track_container_t>
+void writeMappedTracks(std::ostream& os, const GeometryContext& gctx,
+                       const track_container_t& tracks) {
+  using namespace detail_mtc;
+  FileContent content;
+
+  std::unordered_map<const Surface*, IndexType> surfaceIndices;
+  auto addSurface = [&](const Surface* surface) -> IndexType {
+    if (surface == nullptr) {
+      return kInvalid;
+    }
+    auto [it, inserted] = surfaceIndices.try_emplace(
+        surface, static_cast<IndexType>(content.surfaces.size()));
+    if (!inserted) {
+      return it->second;
+    }
+    SurfaceRecord record;
+    if (surface->geometryId() != GeometryIdentifier{}) {
+      record.geometryId = surface->geometryId().value();
+    } else if (surface->type() == Surface::Perigee) {
+      Vector3 center = surface->center(gctx);
+      record.type = SurfaceRecord::ePerigee;
+      record.center = {center.x(), center.y(), center.z()};
+    } else {
+      throw std::invalid_argument(
+          "Unable to write a reference surface without geometry identifier");
+    }
+    content.surfaces.push_back(record);
+    return it->second;
+  };
+
+  // shared components are identified by their storage
+  auto addOnce = [](std::unordered_map<const double*, IndexType>& indices,
+                    const double* data, IndexType next) {
+    return indices.try_emplace(data, next);
+  };
+
+  constexpr std::size_t kParSize = eBoundSize;
+  constexpr std::size_t kCovSize = eBoundSize * eBoundSize;
+
+  const auto& trajectory = tracks.trackStateContainer();
+  content.states.reserve(trajectory.size());
+  std::unordered_map<const double*, IndexType> parIndices;
+  std::unordered_map<const double*, IndexType> jacIndices;
+  std::unordered_map<const double*, IndexType> measOffsets;
+  std::unordered_map<const double*, IndexType> measCovOffsets;
+
+  auto addParameters = [&](const auto& pars, const auto& cov) -> IndexType {
+    auto [it, inserted] = addOnce(
+        parIndices, pars.data(),
+        static_cast<IndexType>(content.parameters.size() / kParSize));
+    if (inserted) {
+      content.parameters.insert(content.parameters.end(), pars.data(),
+                                pars.data() + kParSize);
+      content.covariances.insert(content.covariances.end(), cov.data(),
+                                 cov.data() + kCovSize);
+    }
+    return it->second;
+  };
+
+  for (IndexType istate = 0; istate < trajectory.size(); ++istate) {
+    auto ts = trajectory.getTrackState(istate);
+    StateRecord record;
+    record.previous = ts.previous();
+    record.next = ts.template component<IndexType>(hashString("next"));
+    if (ts.hasPredicted()) {
+      record.ipredicted =
+          addParameters(ts.predicted(), ts.predictedCovariance());
+    }
+    if (ts.hasFiltered()) {
+      record.ifiltered = addParameters(ts.filtered(), ts.filteredCovariance());
+    }
+    if (ts.hasSmoothed()) {
+      record.ismoothed = addParameters(ts.smoothed(), ts.smoothedCovariance());
+    }
+    if (ts.hasJacobian()) {
+      auto jac = ts.jacobian();
+      auto [it, inserted] = addOnce(
+          jacIndices, jac.data(),
+          static_cast<IndexType>(content.jacobians.size() / kCovSize));
+      if (inserted) {
+        content.jacobians.insert(content.jacobians.end(), jac.data(),
+                                 jac.data() + kCovSize);
+      }
+      record.ijacobian = it->second;
+    }
+    if (ts.hasCalibrated()) {
+      std::size_t measdim = ts.calibratedSize();
+      auto meas = ts.effectiveCalibrated();
+      auto measCov = ts.effectiveCalibratedCovariance();
+      auto [measIt, measInserted] =
+          addOnce(measOffsets, meas.data(),
+                  static_cast<IndexType>(content.measurements.size()));
+      if (measInserted) {
+        content.measurements.insert(content.measurements.end(), meas.data(),
+                                    meas.data() + measdim);
+      }
+      auto [covIt, covInserted] = addOnce(
+          measCovOffsets, measCov.data(),
+          static_cast<IndexType>(content.measurementCovariances.size()));
+      if (covInserted) {
+        content.measurementCovariances.insert(
+            content.measurementCovariances.end(), measCov.data(),
+            measCov.data() + measdim * measdim);
+      }
+      record.measOffset = measIt->second;
+      record.measCovOffset = covIt->second;
+      record.measdim = static_cast<IndexType>(measdim);
+    }
+    if (ts.hasProjector()) {
+      record.hasProjector = 1;
+      record.projector = ts.projectorBitset();
+    }
+    record.chi2 = ts.chi2();
+    record.pathLength = ts.pathLength();
+    record.typeFlags = ts.template component<TrackStateType::raw_type>(
+        hashString("typeFlags"));
+    record.surface = addSurface(
+        ts.hasReferenceSurface() ? &ts.referenceSurface() : nullptr);
+    content.states.push_back(record);
+  }
+
+  content.tracks.reserve(tracks.size());
+  content.trackParameters.reserve(tracks.size() * kParSize);
+  content.trackCovariances.reserve(tracks.size() * kCovSize);
+  for (const auto& track : tracks) {
+    TrackRecord record;
+    record.tipIndex = track.tipIndex();
+    record.stemIndex = track.stemIndex();
+    record.nMeasurements = track.nMeasurements();
+    record.nHoles = track.nHoles();
+    record.ndf = track.nDoF();
+    record.nOutliers = track.nOutliers();
+    record.nSharedHits = track.nSharedHits();
+    record.chi2 = track.chi2();
+    record.surface = addSurface(
+        track.hasReferenceSurface() ? &track.referenceSurface() : nullptr);
+    ParticleHypothesis hypothesis = track.particleHypothesis();
+    record.absPdg = hypothesis.absolutePdg();
+    record.mass = hypothesis.mass();
+    record.absQ = hypothesis.absoluteCharge();
+    content.tracks.push_back(record);
+
+    auto pars = track.parameters();
+    auto cov = track.covariance();
+    content.trackParameters.insert(content.trackParameters.end(), pars.data(),
+                                   pars.data() + kParSize);
+    content.trackCovariances.insert(content.trackCovariances.end(),
+                                    cov.data(), cov.data() + kCovSize);
+  }
+
+  writeFile(os, content);
+}
+
+}  // namespace Acts
@@ -0,0 +1,83 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace Acts {
+
+/// Upper triangle of a symmetric matrix stored row by row
+///
+/// @tparam scalar_t The scalar type of the stored elements
+/// @tparam kSize The number of rows and columns of the matrix
+template <typename scalar_t, std::size_t kSize>
+using PackedSymmetricMatrix = std::array<scalar_t, kSize * (kSize + 1) / 2>;
+
+/// Compact storage of a bound covariance with 21 single precision values
+///
+/// This is meant for output and intermediate storage, e.g. as a dynamic
+/// column of a track container, and takes less than a third of the size of
+/// the full double precision matrix. The fit itself should keep using the
+/// full matrix.
+using PackedBoundCovariance = PackedSymmetricMatrix<float, eBoundSize>;
+
+/// Pack the upper triangle of a symmetric matrix
+///
+/// @tparam scalar_t The scalar type of the packed elements
+/// @param matrix The symmetric input matrix
+/// @return The packed upper triangle, converted to @p scalar_t
+template <typename scalar_t, typename derived_t>
+PackedSymmetricMatrix<scalar_t, derived_t::RowsAtCompileTime> packSymmetric(
+    const Eigen::MatrixBase<derived_t>& matrix) {
+  constexpr std::size_t kSize = derived_t::RowsAtCompileTime;
+  static_assert(derived_t::ColsAtCompileTime == kSize,
+                "Only square matrices can be packed");
+
+  PackedSymmetricMatrix<scalar_t, kSize> packed{};
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < kSize; ++i) {
+    for (std::size_t j = i; j < kSize; ++j) {
+      packed[k++] = static_cast<scalar_t>(matrix(i, j));
+    }
+  }
+  return packed;
+}
+
+/// Unpack a packed upper triangle into a full symmetric matrix
+///
+/// @param packed The packed upper triangle
+/// @return The full symmetric matrix in double precision
+template <typename scalar_t, std::size_t kN>
+auto unpackSymmetric(const std::array<scalar_t, kN>& packed) {
+  // the matrix size is the positive solution of kSize*(kSize+1)/2 == kN
+  constexpr std::size_t kSize = [] {
+    std::size_t n = 0;
+    while (n * (n + 1) / 2 < kN) {
+      ++n;
+    }
+    return n;
+  }();
+  static_assert(kSize * (kSize + 1) / 2 == kN,
+                "Input is not a packed symmetric matrix");
+
+  ActsSquareMatrix<kSize> matrix;
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < kSize; ++i) {
+    for (std::size_t j = i; j < kSize; ++j) {
+      matrix(i, j) = matrix(j, i) = static_cast<ActsScalar>(packed[k++]);
+    }
+  }
+  return matrix;
+}
+
+}  // namespace Acts
@@ -14,6 +14,7 @@
 #include "Acts/Utilities/HashedString.hpp"
 
 #include <type_traits>
+#include <utility>
 
 #if defined(__cpp_concepts)
 #include <concepts>
@@ -108,6 +109,20 @@ struct ProxyAccessorBase {
       return cproxy.template component<T>(key);
     }
   }
+
+  /// Resolve the key once into a handle on the column storage of a backend,
+  /// e.g. a @c VectorMultiTrajectory, for use in loops over many proxies
+  /// @tparam backend_t the type of the backend
+  /// @param backend the backend that holds the column
+  /// @return handle with the constness of this accessor
+  template <typename backend_t>
+  auto resolve(backend_t& backend) const {
+    if constexpr (ReadOnly) {
+      return std::as_const(backend).template dynamicColumnHandle<T>(key);
+    } else {
+      return backend.template dynamicColumnHandle<T>(key);
+    }
+  }
 };
 
 template <typename T>
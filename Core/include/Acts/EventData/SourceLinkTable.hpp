@@ -0,0 +1,126 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/SourceLink.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// Per-event table of typed source links which are referenced by index
+///
+/// Source links larger than the small buffer of @c SourceLink are allocated
+/// on the heap whenever they are wrapped. The table instead stores the
+/// experiment specific source links contiguously and hands out @c Link
+/// objects, which only hold the table and an index and always fit into the
+/// small buffer.
+///
+/// @tparam payload_t The experiment specific source link type
+///
+/// @note The links refer to the table object, which can therefore neither be
+///       copied nor moved. Keep it at a stable address, e.g. in a unique
+///       pointer, for as long as the source links are used.
+template <typename payload_t>
+class SourceLinkTable {
+ public:
+  using Payload = payload_t;
+  using Index = std::uint32_t;
+
+  /// Reference to one entry of the table, to be wrapped in a @c SourceLink
+  class Link {
+   public:
+    Link(const SourceLinkTable& table, Index index)
+        : m_table{&table}, m_index{index} {}
+
+    /// The source link this link refers to
+    const payload_t& payload() const { return (*m_table)[m_index]; }
+
+    /// The index of the source link in the table
+    Index index() const { return m_index; }
+
+    /// The table the source link is stored in
+    const SourceLinkTable& table() const { return *m_table; }
+
+    friend bool operator==(const Link& lhs, const Link& rhs) {
+      return lhs.m_table == rhs.m_table && lhs.m_index == rhs.m_index;
+    }
+
+    friend bool operator!=(const Link& lhs, const Link& rhs) {
+      return !(lhs == rhs);
+    }
+
+   private:
+    const SourceLinkTable* m_table;
+    Index m_index;
+  };
+
+  static_assert(sizeof(Link) <= ACTS_SOURCELINK_SBO_SIZE,
+                "Table links have to fit into the source link buffer");
+
+  SourceLinkTable() = default;
+  SourceLinkTable(const SourceLinkTable&) = delete;
+  SourceLinkTable& operator=(const SourceLinkTable&) = delete;
+
+  /// Reserve space for the source links of an event
+  /// @param size The expected number of source links
+  void reserve(std::size_t size) { m_payloads.reserve(size); }
+
+  /// Add a source link to the table
+  /// @param args The arguments to construct the source link from
+  /// @return The index of the new source link
+  template <typename... args_t>
+  Index emplace_back(args_t&&... args) {
+    m_payloads.emplace_back(std::forward<args_t>(args)...);
+    return static_cast<Index>(m_payloads.size() - 1);
+  }
+
+  /// Wrap an entry of the table into a source link without allocation
+  /// @param index The index of the table entry
+  SourceLink sourceLink(Index index) const {
+    assert(index < m_payloads.size() && "Source link index out of range");
+    return SourceLink{Link{*this, index}};
+  }
+
+  /// Unpack a source link created by any table of this type
+  /// @param sourceLink The source link holding a @c Link
+  static const payload_t& payload(const SourceLink& sourceLink) {
+    return sourceLink.get<Link>().payload();
+  }
+
+  const payload_t& operator[](Index index) const {
+    assert(index < m_payloads.size() && "Source link index out of range");
+    return m_payloads[index];
+  }
+
+  payload_t& operator[](Index index) {
+    assert(index < m_payloads.size() && "Source link index out of range");
+    return m_payloads[index];
+  }
+
+  std::size_t size() const { return m_payloads.size(); }
+
+  bool empty() const { return m_payloads.empty(); }
+
+  /// Remove all source links, e.g. at the end of an event, and keep the
+  /// storage for the next one
+  void clear() { m_payloads.clear(); }
+
+  auto begin() const { return m_payloads.begin(); }
+  auto end() const { return m_payloads.end(); }
+
+ private:
+  std::vector<payload_t> m_payloads;
+};
+
+}  // namespace Acts
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/ContainerFootprint.hpp"
+#include "Acts/EventData/DynamicColumnHandle.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/MultiTrajectoryBackendConcept.hpp"
 #include "Acts/EventData/SourceLink.hpp"
@@ -25,6 +27,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -165,6 +168,21 @@ class VectorMultiTrajectoryBase {
 
   VectorMultiTrajectoryBase() = default;
 
+  explicit VectorMultiTrajectoryBase(std::pmr::memory_resource* resource)
+      : m_index{resource},
+        m_previous{resource},
+        m_next{resource},
+        m_params{resource},
+        m_cov{resource},
+        m_meas{resource},
+        m_measOffset{resource},
+        m_measCov{resource},
+        m_measCovOffset{resource},
+        m_jac{resource},
+        m_sourceLinks{resource},
+        m_projectors{resource},
+        m_referenceSurfaces{resource} {}
+
   VectorMultiTrajectoryBase(const VectorMultiTrajectoryBase& other)
       : m_index{other.m_index},
         m_previous{other.m_previous},
@@ -178,7 +196,8 @@ class VectorMultiTrajectoryBase {
         m_jac{other.m_jac},
         m_sourceLinks{other.m_sourceLinks},
         m_projectors{other.m_projectors},
-        m_referenceSurfaces{other.m_referenceSurfaces} {
+        m_referenceSurfaces{other.m_referenceSurfaces},
+        m_nonOwningDetectorSurfaces{other.m_nonOwningDetectorSurfaces} {
     for (const auto& [key, value] : other.m_dynamic) {
       m_dynamic.insert({key, value->clone()});
     }
@@ -187,6 +206,18 @@ class VectorMultiTrajectoryBase {
 
   VectorMultiTrajectoryBase(VectorMultiTrajectoryBase&& other) = default;
 
+  /// Append all track states of another trajectory and shift their indices
+  /// @return The index of the first appended track state
+  IndexType appendColumns(const VectorMultiTrajectoryBase& other);
+
+  /// Append selected track states of another trajectory and remap indices
+  /// @return The new index per track state of @p other, or kInvalid
+  std::vector<IndexType> appendColumns(const VectorMultiTrajectoryBase& other,
+                                       const std::vector<IndexType>& istates);
+
+  /// Throw if @p other has dynamic columns that do not exist here
+  void requireDynamicColumns(const VectorMultiTrajectoryBase& other) const;
+
   // BEGIN INTERFACE HELPER
   template <typename T>
   static constexpr bool has_impl(T& instance, HashedString key,
@@ -297,6 +328,20 @@ class VectorMultiTrajectoryBase {
 
   // END INTERFACE HELPER
 
+  /// Memory footprint of all columns, including the dynamic ones
+  ContainerFootprint footprint() const;
+
+  /// Resolve a dynamic column once for repeated const access
+  /// @tparam T The value type of the column
+  /// @param key The hashed key of the column
+  /// @throw std::invalid_argument if the column does not exist or has a
+  ///        different type
+  template <typename T>
+  ConstDynamicColumnHandle<T> dynamicColumnHandle(HashedString key) const {
+    return ConstDynamicColumnHandle<T>{
+        detail::findDynamicColumn<T>(m_dynamic, key)};
+  }
+
  public:
   IndexType calibratedSize_impl(IndexType istate) const {
     return m_index[istate].measdim;
@@ -312,31 +357,38 @@ class VectorMultiTrajectoryBase {
 
  protected:
   /// index to map track states to the corresponding
-  std::vector<IndexData> m_index;
-  std::vector<IndexType> m_previous;
-  std::vector<IndexType> m_next;
-  std::vector<typename detail_lt::Types<eBoundSize>::Coefficients> m_params;
-  std::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_cov;
-
-  std::vector<double> m_meas;
-  std::vector<MultiTrajectoryTraits::IndexType> m_measOffset;
-  std::vector<double> m_measCov;
-  std::vector<MultiTrajectoryTraits::IndexType> m_measCovOffset;
-
-  std::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_jac;
-  std::vector<std::optional<SourceLink>> m_sourceLinks;
-  std::vector<ProjectorBitset> m_projectors;
+  std::pmr::vector<IndexData> m_index;
+  std::pmr::vector<IndexType> m_previous;
+  std::pmr::vector<IndexType> m_next;
+  std::pmr::vector<typename detail_lt::Types<eBoundSize>::Coefficients>
+      m_params;
+  std::pmr::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_cov;
+
+  std::pmr::vector<double> m_meas;
+  std::pmr::vector<MultiTrajectoryTraits::IndexType> m_measOffset;
+  std::pmr::vector<double> m_measCov;
+  std::pmr::vector<MultiTrajectoryTraits::IndexType> m_measCovOffset;
+
+  std::pmr::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_jac;
+  std::pmr::vector<std::optional<SourceLink>> m_sourceLinks;
+  std::pmr::vector<ProjectorBitset> m_projectors;
 
   // owning vector of shared pointers to surfaces
   //
   // This might be problematic when appending a large number of surfaces
   // trackstates, because vector has to reallocated and thus copy. This might
   // be handled in a smart way by moving but not sure.
-  std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  std::pmr::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  /// Store surfaces of detector elements without shared ownership
+  bool m_nonOwningDetectorSurfaces = false;
 
   std::vector<HashedString> m_dynamicKeys;
   std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
       m_dynamic;
+
+  /// Number of reallocations of the track state index since construction
+  /// or the last clear
+  std::size_t m_growthEvents = 0;
 };
 
 }  // namespace detail_vmt
@@ -355,6 +407,20 @@ class VectorMultiTrajectory final
 
  public:
   VectorMultiTrajectory() = default;
+
+  /// Constructor drawing all columns from a memory resource
+  ///
+  /// The resource is typically an arena owned by the caller, e.g. a
+  /// `std::pmr::monotonic_buffer_resource` over a buffer kept for the whole
+  /// job. The trajectory has to be destroyed before the arena is released
+  /// for the next event, after which the buffer is reused without returning
+  /// memory to the system. Copies of the trajectory use the default
+  /// resource.
+  ///
+  /// @param resource The memory resource, has to outlive the trajectory
+  explicit VectorMultiTrajectory(std::pmr::memory_resource* resource)
+      : VectorMultiTrajectoryBase{resource} {}
+
   VectorMultiTrajectory(const VectorMultiTrajectory& other)
       : VectorMultiTrajectoryBase{other} {}
 
@@ -365,6 +431,19 @@ class VectorMultiTrajectory final
     return detail_vmt::VectorMultiTrajectoryBase::statistics(*this);
   }
 
+  /// Store the reference surfaces of detector elements without ownership
+  ///
+  /// The stored pointers have no control block, so copying track states
+  /// and trajectories does not touch the reference counts of detector
+  /// surfaces, which are shared between threads. The detector then has to
+  /// outlive the trajectory. Free-standing surfaces, e.g. perigees, are
+  /// always kept alive. Only affects surfaces that are set afterwards.
+  ///
+  /// @param enable Whether to store detector surfaces without ownership
+  void setNonOwningDetectorSurfaces(bool enable) {
+    m_nonOwningDetectorSurfaces = enable;
+  }
+
   // BEGIN INTERFACE
   TrackStateProxy::Parameters parameters_impl(IndexType parIdx) {
     return TrackStateProxy::Parameters{m_params[parIdx].data()};
@@ -428,6 +507,46 @@ class VectorMultiTrajectory final
 
   void reserve(std::size_t n);
 
+  /// Append all track states of another trajectory
+  ///
+  /// This copies each column in bulk and shifts the internal indices, which
+  /// is much cheaper than copying the track states one by one. Tasks can
+  /// fill separate trajectories without synchronization and merge them
+  /// into the event trajectory afterwards. All dynamic columns of @p other
+  /// must exist in this trajectory, columns missing in @p other are filled
+  /// with default values.
+  ///
+  /// @param other The trajectory to append
+  /// @return The index of the first appended track state, to be added to
+  ///         the track state indices of @p other
+  IndexType append(const detail_vmt::VectorMultiTrajectoryBase& other) {
+    return appendColumns(other);
+  }
+
+  /// Append selected track states of another trajectory
+  ///
+  /// The selected states are gathered column by column in the given order,
+  /// e.g. to keep only the states of the tracks that survived the
+  /// ambiguity resolution. Components shared between the selected states
+  /// stay shared. Links to states that are not selected are invalidated,
+  /// so all states of a track have to be selected to keep it intact.
+  ///
+  /// @param other The trajectory to copy from
+  /// @param istates The indices of the states in @p other to append
+  /// @return The new index for each state of @p other, kInvalid for the
+  ///         states that were not selected
+  std::vector<IndexType> append(
+      const detail_vmt::VectorMultiTrajectoryBase& other,
+      const std::vector<IndexType>& istates) {
+    return appendColumns(other, istates);
+  }
+
+  /// Remove the Jacobians of all track states and release their memory
+  ///
+  /// The Jacobians are only needed by the smoother. Dropping them once the
+  /// fit is done reduces the size of trajectories that are kept for output.
+  void dropJacobians();
+
   void shareFrom_impl(IndexType iself, IndexType iother,
                       TrackStatePropMask shareSource,
                       TrackStatePropMask shareTarget);
@@ -457,13 +576,32 @@ class VectorMultiTrajectory final
   template <typename T>
   void addColumn_impl(std::string_view key) {
     Acts::HashedString hashedKey = hashString(key);
-    m_dynamic.insert({hashedKey, std::make_unique<detail::DynamicColumn<T>>()});
+    m_dynamic.insert({hashedKey, std::make_unique<detail::DynamicColumn<T>>(
+                                     m_index.get_allocator().resource())});
   }
 
   bool hasColumn_impl(HashedString key) const {
     return detail_vmt::VectorMultiTrajectoryBase::hasColumn_impl(*this, key);
   }
 
+  using detail_vmt::VectorMultiTrajectoryBase::dynamicColumnHandle;
+
+  /// Resolve a dynamic column once for repeated mutable access
+  /// @tparam T The value type of the column
+  /// @param key The hashed key of the column
+  /// @throw std::invalid_argument if the column does not exist or has a
+  ///        different type
+  template <typename T>
+  MutableDynamicColumnHandle<T> dynamicColumnHandle(HashedString key) {
+    return MutableDynamicColumnHandle<T>{
+        detail::findDynamicColumn<T>(m_dynamic, key)};
+  }
+
+  /// The memory resource the columns are drawn from
+  std::pmr::memory_resource* memoryResource() const {
+    return m_index.get_allocator().resource();
+  }
+
   void allocateCalibrated_impl(IndexType istate, std::size_t measdim) {
     throw_assert(measdim > 0 && measdim <= eBoundSize,
                  "Invalid measurement dimension detected");
@@ -488,9 +626,7 @@ class VectorMultiTrajectory final
   }
 
   void setReferenceSurface_impl(IndexType istate,
-                                std::shared_ptr<const Surface> surface) {
-    m_referenceSurfaces[istate] = std::move(surface);
-  }
+                                std::shared_ptr<const Surface> surface);
 
   void copyDynamicFrom_impl(IndexType dstIdx, HashedString key,
                             const std::any& srcPtr);
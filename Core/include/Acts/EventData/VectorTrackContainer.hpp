@@ -9,6 +9,8 @@
 #pragma once
 
 #include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/ContainerFootprint.hpp"
+#include "Acts/EventData/DynamicColumnHandle.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/ParticleHypothesis.hpp"
 #include "Acts/EventData/TrackContainer.hpp"
@@ -171,12 +173,28 @@ class VectorTrackContainerBase {
 
   // END INTERFACE HELPER
 
+  /// Memory footprint of all columns, including the dynamic ones
+  ContainerFootprint footprint() const;
+
+  /// Resolve a dynamic column once for repeated const access
+  /// @tparam T The value type of the column
+  /// @param key The hashed key of the column
+  /// @throw std::invalid_argument if the column does not exist or has a
+  ///        different type
+  template <typename T>
+  ConstDynamicColumnHandle<T> dynamicColumnHandle(HashedString key) const {
+    return ConstDynamicColumnHandle<T>{
+        detail::findDynamicColumn<T>(m_dynamic, key)};
+  }
+
   std::vector<IndexType> m_tipIndex;
   std::vector<IndexType> m_stemIndex;
   std::vector<ParticleHypothesis> m_particleHypothesis;
   std::vector<typename detail_lt::Types<eBoundSize>::Coefficients> m_params;
   std::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_cov;
   std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  /// Store surfaces of detector elements without shared ownership
+  bool m_nonOwningDetectorSurfaces = false;
 
   std::vector<unsigned int> m_nMeasurements;
   std::vector<unsigned int> m_nHoles;
@@ -188,6 +206,10 @@ class VectorTrackContainerBase {
   std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
       m_dynamic;
   std::vector<HashedString> m_dynamicKeys;
+
+  /// Number of reallocations of the track columns since construction or the
+  /// last clear
+  std::size_t m_growthEvents = 0;
 };
 
 }  // namespace detail_vtc
@@ -229,6 +251,19 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
     m_dynamic.insert({hashedKey, std::make_unique<detail::DynamicColumn<T>>()});
   }
 
+  using detail_vtc::VectorTrackContainerBase::dynamicColumnHandle;
+
+  /// Resolve a dynamic column once for repeated mutable access
+  /// @tparam T The value type of the column
+  /// @param key The hashed key of the column
+  /// @throw std::invalid_argument if the column does not exist or has a
+  ///        different type
+  template <typename T>
+  MutableDynamicColumnHandle<T> dynamicColumnHandle(HashedString key) {
+    return MutableDynamicColumnHandle<T>{
+        detail::findDynamicColumn<T>(m_dynamic, key)};
+  }
+
   Parameters parameters(IndexType itrack) {
     return Parameters{m_params[itrack].data()};
   }
@@ -254,17 +289,61 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
   void reserve(IndexType size);
   void clear();
 
-  void setReferenceSurface_impl(IndexType itrack,
-                                std::shared_ptr<const Surface> surface) {
-    m_referenceSurfaces[itrack] = std::move(surface);
+  /// Store the reference surfaces of detector elements without ownership
+  ///
+  /// Copies of the tracks then do not touch the reference counts of
+  /// detector surfaces, which are shared between threads, and the detector
+  /// has to outlive the container. Free-standing surfaces, e.g. perigees,
+  /// are always kept alive. Only affects surfaces that are set afterwards.
+  ///
+  /// @param enable Whether to store detector surfaces without ownership
+  void setNonOwningDetectorSurfaces(bool enable) {
+    m_nonOwningDetectorSurfaces = enable;
   }
 
+  /// Append all tracks of another container
+  ///
+  /// The columns are copied in bulk, see VectorMultiTrajectory::append for
+  /// merging the corresponding track states. All dynamic columns of
+  /// @p other must exist in this container, columns missing in @p other are
+  /// filled with default values.
+  ///
+  /// @param other The container to append
+  /// @param stateOffset The offset returned when appending the track states
+  ///        of @p other to the trajectory of this container
+  /// @return The index of the first appended track
+  IndexType append(const detail_vtc::VectorTrackContainerBase& other,
+                   IndexType stateOffset);
+
+  /// Append selected tracks of another container
+  ///
+  /// The selected tracks are gathered column by column in the given order,
+  /// e.g. to keep the tracks that survived the ambiguity resolution.
+  ///
+  /// @param other The container to copy from
+  /// @param itracks The indices of the tracks in @p other to append
+  /// @param stateMap The new track state indices as returned by
+  ///        VectorMultiTrajectory::append, or empty if this container keeps
+  ///        using the track states of @p other
+  /// @return The index of the first appended track
+  IndexType append(const detail_vtc::VectorTrackContainerBase& other,
+                   const std::vector<IndexType>& itracks,
+                   const std::vector<IndexType>& stateMap = {});
+
+  void setReferenceSurface_impl(IndexType itrack,
+                                std::shared_ptr<const Surface> surface);
+
   void setParticleHypothesis_impl(
       IndexType itrack, const ParticleHypothesis& particleHypothesis) {
     m_particleHypothesis[itrack] = particleHypothesis;
   }
 
   // END INTERFACE
+
+ private:
+  /// Throw if @p other has dynamic columns that do not exist here
+  void requireDynamicColumns(
+      const detail_vtc::VectorTrackContainerBase& other) const;
 };
 
 ACTS_STATIC_CHECK_CONCEPT(TrackContainerBackend, VectorTrackContainer);
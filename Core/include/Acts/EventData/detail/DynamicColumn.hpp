@@ -8,9 +8,16 @@
 
 #pragma once
 
+#include "Acts/EventData/ContainerFootprint.hpp"
+#include "Acts/EventData/Types.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+
+#include <algorithm>
 #include <any>
 #include <cassert>
 #include <memory>
+#include <memory_resource>
+#include <string>
 #include <vector>
 
 namespace Acts::detail {
@@ -26,9 +33,14 @@ struct DynamicColumnBase {
   virtual void reserve(std::size_t size) = 0;
   virtual void erase(std::size_t i) = 0;
   virtual std::size_t size() const = 0;
+  virtual std::size_t capacity() const = 0;
+  virtual std::size_t elementSize() const = 0;
   virtual void copyFrom(std::size_t dstIdx, const DynamicColumnBase& src,
                         std::size_t srcIdx) = 0;
   virtual void copyFrom(std::size_t dstIdx, const std::any& srcPtr) = 0;
+  virtual void append(const DynamicColumnBase& src) = 0;
+  virtual void append(const DynamicColumnBase& src,
+                      const std::vector<TrackIndexType>& srcIdxs) = 0;
 
   virtual std::unique_ptr<DynamicColumnBase> clone(
       bool empty = false) const = 0;
@@ -36,6 +48,13 @@ struct DynamicColumnBase {
 
 template <typename T>
 struct DynamicColumn : public DynamicColumnBase {
+  DynamicColumn() = default;
+
+  /// Constructor drawing the column memory from a memory resource
+  /// @param resource The memory resource, has to outlive the column
+  explicit DynamicColumn(std::pmr::memory_resource* resource)
+      : m_vector(resource) {}
+
   std::any get(std::size_t i) override {
     assert(i < m_vector.size() && "DynamicColumn out of bounds");
     return &m_vector[i];
@@ -46,11 +65,26 @@ struct DynamicColumn : public DynamicColumnBase {
     return &m_vector[i];
   }
 
+  /// Typed access without going through @c std::any
+  T& value(std::size_t i) {
+    assert(i < m_vector.size() && "DynamicColumn out of bounds");
+    return m_vector[i];
+  }
+
+  const T& value(std::size_t i) const {
+    assert(i < m_vector.size() && "DynamicColumn out of bounds");
+    return m_vector[i];
+  }
+
   void add() override { m_vector.emplace_back(); }
   void clear() override { m_vector.clear(); }
   void reserve(std::size_t size) override { m_vector.reserve(size); }
   void erase(std::size_t i) override { m_vector.erase(m_vector.begin() + i); }
   std::size_t size() const override { return m_vector.size(); }
+  std::size_t capacity() const override { return m_vector.capacity(); }
+  std::size_t elementSize() const override {
+    return sizeof(typename decltype(m_vector)::value_type);
+  }
 
   std::unique_ptr<DynamicColumnBase> clone(bool empty) const override {
     if (empty) {
@@ -67,6 +101,25 @@ struct DynamicColumn : public DynamicColumnBase {
     m_vector.at(dstIdx) = other->m_vector.at(srcIdx);
   }
 
+  void append(const DynamicColumnBase& src) override {
+    const auto* other = dynamic_cast<const DynamicColumn<T>*>(&src);
+    assert(other != nullptr &&
+           "Source column is not of same type as destination");
+    m_vector.insert(m_vector.end(), other->m_vector.begin(),
+                    other->m_vector.end());
+  }
+
+  void append(const DynamicColumnBase& src,
+              const std::vector<TrackIndexType>& srcIdxs) override {
+    const auto* other = dynamic_cast<const DynamicColumn<T>*>(&src);
+    assert(other != nullptr &&
+           "Source column is not of same type as destination");
+    m_vector.reserve(m_vector.size() + srcIdxs.size());
+    for (TrackIndexType i : srcIdxs) {
+      m_vector.push_back(other->m_vector.at(i));
+    }
+  }
+
   void copyFrom(std::size_t dstIdx, const std::any& srcPtr) override {
     const auto* other = std::any_cast<const T*>(srcPtr);
     assert(other != nullptr &&
@@ -74,7 +127,7 @@ struct DynamicColumn : public DynamicColumnBase {
     m_vector.at(dstIdx) = *other;
   }
 
-  std::vector<T> m_vector;
+  std::pmr::vector<T> m_vector;
 };
 
 template <>
@@ -83,6 +136,13 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
     bool value;
   };
 
+  DynamicColumn() = default;
+
+  /// Constructor drawing the column memory from a memory resource
+  /// @param resource The memory resource, has to outlive the column
+  explicit DynamicColumn(std::pmr::memory_resource* resource)
+      : m_vector(resource) {}
+
   std::any get(std::size_t i) override {
     assert(i < m_vector.size() && "DynamicColumn out of bounds");
     return &m_vector[i].value;
@@ -93,11 +153,26 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
     return &m_vector[i].value;
   }
 
+  /// Typed access without going through @c std::any
+  bool& value(std::size_t i) {
+    assert(i < m_vector.size() && "DynamicColumn out of bounds");
+    return m_vector[i].value;
+  }
+
+  const bool& value(std::size_t i) const {
+    assert(i < m_vector.size() && "DynamicColumn out of bounds");
+    return m_vector[i].value;
+  }
+
   void add() override { m_vector.emplace_back(); }
   void reserve(std::size_t size) override { m_vector.reserve(size); }
   void clear() override { m_vector.clear(); }
   void erase(std::size_t i) override { m_vector.erase(m_vector.begin() + i); }
   std::size_t size() const override { return m_vector.size(); }
+  std::size_t capacity() const override { return m_vector.capacity(); }
+  std::size_t elementSize() const override {
+    return sizeof(typename decltype(m_vector)::value_type);
+  }
 
   std::unique_ptr<DynamicColumnBase> clone(bool empty) const override {
     if (empty) {
@@ -114,6 +189,25 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
     m_vector.at(dstIdx) = other->m_vector.at(srcIdx);
   }
 
+  void append(const DynamicColumnBase& src) override {
+    const auto* other = dynamic_cast<const DynamicColumn<bool>*>(&src);
+    assert(other != nullptr &&
+           "Source column is not of same type as destination");
+    m_vector.insert(m_vector.end(), other->m_vector.begin(),
+                    other->m_vector.end());
+  }
+
+  void append(const DynamicColumnBase& src,
+              const std::vector<TrackIndexType>& srcIdxs) override {
+    const auto* other = dynamic_cast<const DynamicColumn<bool>*>(&src);
+    assert(other != nullptr &&
+           "Source column is not of same type as destination");
+    m_vector.reserve(m_vector.size() + srcIdxs.size());
+    for (TrackIndexType i : srcIdxs) {
+      m_vector.push_back(other->m_vector.at(i));
+    }
+  }
+
   void copyFrom(std::size_t dstIdx, const std::any& srcPtr) override {
     const auto* other = std::any_cast<const bool*>(srcPtr);
     assert(other != nullptr &&
@@ -121,7 +215,26 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
     m_vector.at(dstIdx).value = *other;
   }
 
-  std::vector<Wrapper> m_vector;
+  std::pmr::vector<Wrapper> m_vector;
 };
 
+/// Add the dynamic columns of a vector backend to its footprint, ordered by
+/// their key hash
+template <typename column_map_t>
+void addDynamicFootprint(ContainerFootprint& footprint,
+                         const column_map_t& columns) {
+  std::vector<HashedString> keys;
+  keys.reserve(columns.size());
+  for (const auto& [key, column] : columns) {
+    keys.push_back(key);
+  }
+  std::sort(keys.begin(), keys.end());
+  for (HashedString key : keys) {
+    const DynamicColumnBase& column = *columns.at(key);
+    footprint.columns.push_back({"dynamic:" + std::to_string(key),
+                                 column.size(), column.capacity(),
+                                 column.elementSize()});
+  }
+}
+
 }  // namespace Acts::detail
@@ -488,6 +488,10 @@ class CylinderVolumeBuilder : public ITrackingVolumeBuilder {
     double ringTolerance = 0 * UnitConstants::mm;
     /// Builder to construct layers within the volume
     std::shared_ptr<const ILayerBuilder> layerBuilder = nullptr;
+    /// Build the negative, central and positive layers concurrently within
+    /// the @c Acts::maxThreads budget, requires a layer builder that can be
+    /// called concurrently
+    bool buildLayersConcurrently = false;
     /// Builder to construct confined volumes within the volume
     std::shared_ptr<const IConfinedTrackingVolumeBuilder> ctVolumeBuilder =
         nullptr;
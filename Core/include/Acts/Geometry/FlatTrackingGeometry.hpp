@@ -0,0 +1,133 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Acts {
+
+class Layer;
+class SurfaceBounds;
+class TrackingGeometry;
+class TrackingVolume;
+
+/// @class FlatTrackingGeometry
+///
+/// A frozen, flattened view of a closed TrackingGeometry.
+///
+/// The tracking geometry is a tree of volumes, layers and surface arrays
+/// connected through shared pointers. The flat view stores the volumes,
+/// layers and surfaces in contiguous arrays sorted by their geometry
+/// identifier, such that
+///
+/// - the layers of a volume and the surfaces of a volume or layer are
+///   consecutive index ranges,
+/// - the surface transforms of one geometry context are stored contiguously
+///   next to each other,
+/// - the surface type and bounds are available without a virtual call,
+/// - the lookup by geometry identifier is a binary search.
+///
+/// The view does not own the geometry objects, the TrackingGeometry has to
+/// outlive it. The transforms are evaluated once at construction, the view
+/// has to be rebuilt for a different alignment context.
+class FlatTrackingGeometry {
+ public:
+  /// Range of indices into one of the flat arrays
+  struct IndexRange {
+    std::size_t begin = 0;
+    std::size_t end = 0;
+
+    std::size_t size() const { return end - begin; }
+    bool empty() const { return begin == end; }
+  };
+
+  struct VolumeEntry {
+    GeometryIdentifier geometryId;
+    const TrackingVolume* volume = nullptr;
+    /// The confined layers of the volume
+    IndexRange layers;
+    /// The boundary, layer and sensitive surfaces of the volume
+    IndexRange surfaces;
+  };
+
+  struct LayerEntry {
+    GeometryIdentifier geometryId;
+    const Layer* layer = nullptr;
+    /// The representing, approach and sensitive surfaces of the layer
+    IndexRange surfaces;
+  };
+
+  struct SurfaceEntry {
+    GeometryIdentifier geometryId;
+    const Surface* surface = nullptr;
+    Surface::SurfaceType type = Surface::Other;
+    const SurfaceBounds* bounds = nullptr;
+  };
+
+  /// Constructor from a closed tracking geometry
+  ///
+  /// @param gctx The geometry context to evaluate the surface transforms
+  /// @param trackingGeometry The tracking geometry to flatten
+  FlatTrackingGeometry(const GeometryContext& gctx,
+                       const TrackingGeometry& trackingGeometry);
+
+  /// All volumes sorted by geometry identifier
+  const std::vector<VolumeEntry>& volumes() const { return m_volumes; }
+
+  /// All layers sorted by geometry identifier
+  const std::vector<LayerEntry>& layers() const { return m_layers; }
+
+  /// All surfaces sorted by geometry identifier
+  const std::vector<SurfaceEntry>& surfaces() const { return m_surfaces; }
+
+  /// The surface transforms, with the same indices as the surfaces
+  const std::vector<Transform3>& transforms() const { return m_transforms; }
+
+  /// Search for a volume with the given identifier
+  ///
+  /// @param id is the geometry identifier of the volume
+  /// @retval nullptr if no such volume exists
+  /// @retval pointer to the volume entry otherwise
+  const VolumeEntry* findVolume(GeometryIdentifier id) const;
+
+  /// Search for a layer with the given identifier
+  ///
+  /// @param id is the geometry identifier of the layer
+  /// @retval nullptr if no such layer exists
+  /// @retval pointer to the layer entry otherwise
+  const LayerEntry* findLayer(GeometryIdentifier id) const;
+
+  /// Search for a surface with the given identifier
+  ///
+  /// @param id is the geometry identifier of the surface
+  /// @retval nullptr if no such surface exists
+  /// @retval pointer to the surface entry otherwise
+  const SurfaceEntry* findSurface(GeometryIdentifier id) const;
+
+  /// The transform of a surface entry of this view
+  ///
+  /// @param entry is a surface entry returned by this view
+  const Transform3& transform(const SurfaceEntry& entry) const {
+    return m_transforms[static_cast<std::size_t>(&entry - m_surfaces.data())];
+  }
+
+ private:
+  std::vector<VolumeEntry> m_volumes;
+  std::vector<LayerEntry> m_layers;
+  std::vector<SurfaceEntry> m_surfaces;
+  std::vector<Transform3> m_transforms;
+};
+
+}  // namespace Acts
@@ -0,0 +1,95 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Surfaces/SurfaceBounds.hpp"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @class GeometryComponentRegistry
+///
+/// Registry of the surface bounds and surface material created during the
+/// geometry building. Components are interned by their type and values,
+/// such that all identical modules share one bounds and one material object
+/// instead of owning copies.
+///
+/// @note access is guarded, one registry can be filled by several threads
+class GeometryComponentRegistry {
+ public:
+  /// Create the bounds or return an identical already registered object
+  ///
+  /// @tparam bounds_t the concrete bounds type
+  /// @param args the arguments of the bounds constructor
+  ///
+  /// @return the shared bounds object
+  template <typename bounds_t, typename... args_t>
+  std::shared_ptr<const bounds_t> makeBounds(args_t&&... args) {
+    return shareBounds(std::make_shared<const bounds_t>(
+        std::forward<args_t>(args)...));
+  }
+
+  /// Register the bounds or return an identical already registered object
+  ///
+  /// @tparam bounds_t the concrete bounds type
+  /// @param bounds the bounds to register, returned untouched if nullptr
+  ///
+  /// @return the shared bounds object
+  template <typename bounds_t>
+  std::shared_ptr<const bounds_t> shareBounds(
+      std::shared_ptr<const bounds_t> bounds) {
+    if (bounds == nullptr) {
+      return bounds;
+    }
+    // The key includes the dynamic type, the downcast is therefore safe
+    std::type_index type(typeid(*bounds));
+    return std::static_pointer_cast<const bounds_t>(
+        shareBounds(type, std::move(bounds)));
+  }
+
+  /// Create homogeneous surface material or return an identical one
+  ///
+  /// @param slab the material slab of the surface
+  /// @param splitFactor the split for pre/post update
+  ///
+  /// @return the shared material object
+  std::shared_ptr<const HomogeneousSurfaceMaterial> makeHomogeneousMaterial(
+      const MaterialSlab& slab, double splitFactor = 1.);
+
+  /// @return the number of distinct bounds objects
+  std::size_t numberOfBounds() const;
+
+  /// @return the number of distinct material objects
+  std::size_t numberOfMaterials() const;
+
+ private:
+  /// Type erased registration of bounds of a given dynamic type
+  std::shared_ptr<const SurfaceBounds> shareBounds(
+      std::type_index type, std::shared_ptr<const SurfaceBounds> bounds);
+
+  mutable std::mutex m_mutex;
+  std::map<std::tuple<std::type_index, std::vector<double>>,
+           std::shared_ptr<const SurfaceBounds>>
+      m_bounds;
+  std::map<std::vector<double>,
+           std::shared_ptr<const HomogeneousSurfaceMaterial>>
+      m_materials;
+};
+
+}  // namespace Acts
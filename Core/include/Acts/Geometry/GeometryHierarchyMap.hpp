@@ -12,6 +12,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
 #include <stdexcept>
@@ -111,8 +113,16 @@ class GeometryHierarchyMap {
   /// @param id geometry identifier for which information is requested
   /// @retval iterator to an existing value
   /// @retval `.end()` iterator if no matching element exists
+  ///
+  /// @note A direct lookup table is precomputed on construction, which
+  ///   resolves the identifier with one load per hierarchy level. The
+  ///   binary search is only used if the stored identifiers differ only in
+  ///   their extra level or are too sparse for a dense table.
   Iterator find(GeometryIdentifier id) const;
 
+  /// Check whether the direct lookup table is available.
+  bool hasDirectLookup() const { return !m_lookup.empty(); }
+
  private:
   // NOTE this class assumes that it knows the ordering of the levels within
   //      the geometry id. if the geometry id changes, this code has to be
@@ -132,11 +142,50 @@ class GeometryHierarchyMap {
 
   using Identifier = GeometryIdentifier::Value;
 
+  /// Node of the direct lookup table, one per identifier prefix.
+  ///
+  /// The children of a node are stored contiguously and are indexed by the
+  /// value of the next hierarchy level.
+  struct LookupNode {
+    /// index of the element stored for this prefix, if any
+    std::uint32_t element = s_noElement;
+    /// index of the node for a zero value of the next level
+    std::uint32_t firstChild = 0u;
+    /// number of children, i.e. the largest next level value plus one
+    std::uint32_t nChildren = 0u;
+  };
+
+  static constexpr std::uint32_t s_noElement = ~std::uint32_t{0u};
+  /// number of levels used by the lookup, the extra level is ignored
+  static constexpr unsigned int s_nLevels = 5u;
+  /// the lookup table is dropped if it grows beyond this many nodes per
+  /// element, e.g. for very sparse sensitive indices
+  static constexpr std::size_t s_maxNodesPerElement = 16u;
+
   // encoded ids for all elements for faster lookup.
   std::vector<Identifier> m_ids;
   // validity bit masks for the ids: which parts to use for comparison
   std::vector<Identifier> m_masks;
   std::vector<Value> m_values;
+  // direct lookup table, the first node is the root
+  std::vector<LookupNode> m_lookup;
+
+  /// Value of the identifier at the given hierarchy level.
+  static constexpr Identifier levelValue(Identifier id, unsigned int level) {
+    GeometryIdentifier geoId(id);
+    switch (level) {
+      case 0u:
+        return geoId.volume();
+      case 1u:
+        return geoId.boundary();
+      case 2u:
+        return geoId.layer();
+      case 3u:
+        return geoId.approach();
+      default:
+        return geoId.sensitive();
+    }
+  }
 
   /// Construct a mask where all leading non-zero levels are set.
   static constexpr Identifier makeLeadingLevelsMask(GeometryIdentifier id) {
@@ -190,6 +239,17 @@ class GeometryHierarchyMap {
   /// their identifiers.
   template <typename iterator_t>
   void fill(iterator_t beg, iterator_t end);
+
+  /// Build the direct lookup table from the sorted identifiers.
+  void buildLookup();
+
+  /// Fill the lookup node for the identifiers in [beg, end).
+  ///
+  /// The identifiers in the range share all levels before the given level.
+  ///
+  /// @return false if the table grows too large
+  bool buildLookupNode(std::size_t node, std::size_t beg, std::size_t end,
+                       unsigned int level);
 };
 
 // implementations
@@ -240,6 +300,72 @@ inline void GeometryHierarchyMap<value_t>::fill(iterator_t beg,
     m_masks.push_back(makeLeadingLevelsMask(beg->first.value()));
     m_values.push_back(std::move(beg->second));
   }
+  buildLookup();
+}
+
+template <typename value_t>
+inline void GeometryHierarchyMap<value_t>::buildLookup() {
+  m_lookup.clear();
+  if (m_ids.empty() || s_noElement <= m_ids.size()) {
+    return;
+  }
+  // the hierarchy ignores the extra level; identifiers that only differ in it
+  // would end up in the same node and are left to the binary search
+  const Identifier withoutExtra =
+      makeLeadingLevelsMask(GeometryIdentifier(0u).setSensitive(1u));
+  for (std::size_t i = 1; i < m_ids.size(); ++i) {
+    if (equalWithinMask(m_ids[i - 1], m_ids[i], withoutExtra)) {
+      return;
+    }
+  }
+  m_lookup.emplace_back();
+  if (!buildLookupNode(0u, 0u, m_ids.size(), 0u)) {
+    m_lookup.clear();
+  }
+  m_lookup.shrink_to_fit();
+}
+
+template <typename value_t>
+inline bool GeometryHierarchyMap<value_t>::buildLookupNode(std::size_t node,
+                                                           std::size_t beg,
+                                                           std::size_t end,
+                                                           unsigned int level) {
+  // the element without non-zero levels below the shared prefix belongs to
+  // this node. it is sorted before all elements with further levels.
+  bool isPrefix = true;
+  for (unsigned int l = level; l < s_nLevels; ++l) {
+    isPrefix = isPrefix && (levelValue(m_ids[beg], l) == 0u);
+  }
+  if (isPrefix) {
+    m_lookup[node].element = static_cast<std::uint32_t>(beg);
+    ++beg;
+  }
+  if (beg == end) {
+    return true;
+  }
+  assert(level < s_nLevels && "Inconsistent container state: duplicates");
+
+  // the elements are sorted, the last one has the largest next level value
+  const std::size_t nChildren = levelValue(m_ids[end - 1], level) + 1u;
+  const std::size_t firstChild = m_lookup.size();
+  if (s_maxNodesPerElement * m_ids.size() < firstChild + nChildren) {
+    return false;
+  }
+  m_lookup[node].firstChild = static_cast<std::uint32_t>(firstChild);
+  m_lookup[node].nChildren = static_cast<std::uint32_t>(nChildren);
+  m_lookup.resize(firstChild + nChildren);
+  while (beg < end) {
+    const Identifier child = levelValue(m_ids[beg], level);
+    std::size_t next = beg + 1;
+    while (next < end && levelValue(m_ids[next], level) == child) {
+      ++next;
+    }
+    if (!buildLookupNode(firstChild + child, beg, next, level + 1u)) {
+      return false;
+    }
+    beg = next;
+  }
+  return true;
 }
 
 template <typename value_t>
@@ -250,6 +376,26 @@ inline auto GeometryHierarchyMap<value_t>::find(GeometryIdentifier id) const
   assert((m_masks.size() == m_values.size()) &&
          "Inconsistent container state: #masks != #values");
 
+  // walk down the lookup table and keep the most specific element on the way
+  if (!m_lookup.empty()) {
+    const LookupNode* node = &m_lookup.front();
+    std::uint32_t element = node->element;
+    for (unsigned int level = 0u; level < s_nLevels; ++level) {
+      const Identifier child = levelValue(id.value(), level);
+      if (node->nChildren <= child) {
+        break;
+      }
+      node = &m_lookup[node->firstChild + child];
+      if (node->element != s_noElement) {
+        element = node->element;
+      }
+    }
+    if (element == s_noElement) {
+      return end();
+    }
+    return std::next(begin(), element);
+  }
+
   // we can not search for the element directly since the relevant one
   // might be stored at a higher level. ids for higher levels would always
   // be sorted before the requested id. searching for the first element
@@ -20,6 +20,7 @@
 namespace Acts {
 
 class Surface;
+class SurfaceExtentCache;
 struct ProtoLayer;
 
 /// @class ProtoLayerHelper
@@ -66,6 +67,18 @@ class ProtoLayerHelper {
       const std::vector<SortingConfig>& sortings) const;
 
  private:
+  /// Sort the surfaces into clusters overlapping in the sorting direction
+  ///
+  /// @param gctx The geometry context
+  /// @param surfaces The surfaces to be sorted
+  /// @param sorting The sorting setup
+  /// @param extents The cached extents of the surfaces
+  ///
+  /// @return The surfaces of each cluster
+  std::vector<std::vector<const Surface*>> clusters(
+      const GeometryContext& gctx, const std::vector<const Surface*>& surfaces,
+      const SortingConfig& sorting, SurfaceExtentCache& extents) const;
+
   /// Logging instance
   std::unique_ptr<const Logger> m_logger;
 
@@ -10,8 +10,10 @@
 
 #include "Acts/Geometry/Extent.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/SurfaceExtentCache.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -22,10 +24,16 @@ struct SurfaceBinningMatcher {
   using Range = std::pair<double, double>;
   std::vector<Range> tolerances{static_cast<int>(binValues), {0., 0.}};
 
+  /// Optional cache of the surface extents, shared by the copies of the
+  /// matcher. The surfaces are otherwise tessellated for every check.
+  /// @note The cached extents are only valid for one geometry context
+  std::shared_ptr<SurfaceExtentCache> extentCache = nullptr;
+
   SurfaceBinningMatcher() = default;
 
-  SurfaceBinningMatcher(const std::vector<Range>& tolpars)
-      : tolerances(tolpars) {}
+  SurfaceBinningMatcher(const std::vector<Range>& tolpars,
+                        std::shared_ptr<SurfaceExtentCache> cache = nullptr)
+      : tolerances(tolpars), extentCache(std::move(cache)) {}
 
   /// Check function for surface equivalent
   ///
@@ -40,9 +48,17 @@ struct SurfaceBinningMatcher {
       return true;
     }
 
-    auto oneExt = one->polyhedronRepresentation(gctx, 1).extent();
-    auto otherExt = other->polyhedronRepresentation(gctx, 1).extent();
+    if (extentCache != nullptr) {
+      return match(bValue, extentCache->extent(gctx, *one),
+                   extentCache->extent(gctx, *other));
+    }
+    return match(bValue, SurfaceExtentCache::compute(gctx, *one),
+                 SurfaceExtentCache::compute(gctx, *other));
+  }
 
+ private:
+  bool match(Acts::BinningValue bValue, const Extent& oneExt,
+             const Extent& otherExt) const {
     double oneMin = oneExt.min(bValue);
     double oneMax = oneExt.max(bValue);
 
@@ -0,0 +1,69 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+/// @brief Cache of the extents of surfaces
+///
+/// The extent of a surface is given by its polyhedron representation with
+/// one segment, which is built at the first request and reused for all
+/// further ones. This avoids tessellating the same modules again for each
+/// binning check while building the geometry.
+///
+/// The extents are computed with the geometry context of the first request
+/// and are not updated afterwards, the cache has to be cleared if the
+/// placements change. The cache can be shared between threads.
+class SurfaceExtentCache {
+ public:
+  /// Get the extent of a surface, compute it if it is not cached yet
+  ///
+  /// @param gctx The geometry context, e.g. the building context
+  /// @param surface The surface
+  ///
+  /// @return the extent, valid until the cache is cleared
+  const Extent& extent(const GeometryContext& gctx, const Surface& surface);
+
+  /// Compute the extents of the surfaces that are not cached yet, split over
+  /// up to @c Acts::maxThreads threads
+  ///
+  /// @param gctx The geometry context, e.g. the building context
+  /// @param surfaces The surfaces
+  void fill(const GeometryContext& gctx,
+            const std::vector<const Surface*>& surfaces);
+
+  /// The number of cached extents
+  std::size_t size() const;
+
+  /// Remove all cached extents
+  void clear();
+
+  /// The extent of a surface without caching
+  ///
+  /// @param gctx The geometry context
+  /// @param surface The surface
+  static Extent compute(const GeometryContext& gctx, const Surface& surface);
+
+ private:
+  mutable std::mutex m_mutex;
+  // node based, such that the extents do not move on insertion
+  std::unordered_map<const Surface*, Extent> m_extents;
+};
+
+}  // namespace Acts
@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryHierarchyMap.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Geometry/TrackingVolumeVisitorConcept.hpp"
@@ -17,10 +18,12 @@
 #include "Acts/Utilities/Concepts.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -164,6 +167,20 @@ class TrackingGeometry {
   const std::unordered_map<GeometryIdentifier, const Surface*>&
   geoIdSurfaceMap() const;
 
+  /// Update the geometry after surfaces have been moved, e.g. by alignment
+  ///
+  /// Only the surface arrays of the layers holding the moved surfaces are
+  /// updated, instead of rebuilding the geometry.
+  ///
+  /// @note This must not run concurrently with navigation in this geometry
+  ///
+  /// @param gctx The geometry context with the new placements
+  /// @param surfaces The surfaces which have been moved
+  ///
+  /// @return the number of surfaces that changed their surface array bin
+  std::size_t updateMovedSurfaces(const GeometryContext& gctx,
+                                  const std::vector<const Surface*>& surfaces);
+
  private:
   // the known world
   TrackingVolumePtr m_world;
@@ -172,6 +189,10 @@ class TrackingGeometry {
   // lookup containers
   std::unordered_map<GeometryIdentifier, const TrackingVolume*> m_volumesById;
   std::unordered_map<GeometryIdentifier, const Surface*> m_surfacesById;
+  // dense lookup of volumes with only the volume level set
+  std::vector<const TrackingVolume*> m_volumesByIndex;
+  // direct lookup table for the surfaces
+  GeometryHierarchyMap<const Surface*> m_surfaceLookup;
 };
 
 }  // namespace Acts
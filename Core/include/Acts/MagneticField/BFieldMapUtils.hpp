@@ -140,6 +140,73 @@ fieldMapXYZ(
     double lengthUnit = UnitConstants::mm, double BFieldUnit = UnitConstants::T,
     bool firstOctant = false);
 
+/// Field map in r,z with single precision field values
+using CompactFieldMapRZ = Acts::InterpolatedBFieldMap<
+    Acts::Grid<Eigen::Matrix<float, 2, 1>, Acts::detail::EquidistantAxis,
+               Acts::detail::EquidistantAxis>>;
+
+/// Field map in x,y,z with single precision field values
+using CompactFieldMapXYZ = Acts::InterpolatedBFieldMap<
+    Acts::Grid<Eigen::Matrix<float, 3, 1>, Acts::detail::EquidistantAxis,
+               Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>;
+
+/// Method to setup a field map in r,z with a compact storage
+///
+/// Same as @c fieldMapRZ, but the field values are stored in single
+/// precision. If only the first quadrant is given, it is not mirrored into
+/// the grid: the grid covers only the given quadrant and the z position is
+/// mirrored at every look-up instead. This stores about a quarter of the
+/// memory of @c fieldMapRZ. The minima and maxima of the map are then the
+/// ones of the given quadrant.
+///
+/// @param localToGlobalBin See @c fieldMapRZ
+/// @param[in] rPos See @c fieldMapRZ
+/// @param[in] zPos See @c fieldMapRZ
+/// @param[in] bField See @c fieldMapRZ
+/// @param[in] lengthUnit The unit of the grid points
+/// @param[in] BFieldUnit The unit of the magnetic field
+/// @param[in] firstQuadrant Flag if set to true indicating that only the first
+///            quadrant of the grid points and the BField values has been
+///            given, with the first z position on the symmetry plane
+/// @return A field map instance for use in interpolation.
+CompactFieldMapRZ compactFieldMapRZ(
+    const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
+                                    std::array<std::size_t, 2> nBinsRZ)>&
+        localToGlobalBin,
+    std::vector<double> rPos, std::vector<double> zPos,
+    const std::vector<Acts::Vector2>& bField,
+    double lengthUnit = UnitConstants::mm, double BFieldUnit = UnitConstants::T,
+    bool firstQuadrant = false);
+
+/// Method to setup a field map in x,y,z with a compact storage
+///
+/// Same as @c fieldMapXYZ, but the field values are stored in single
+/// precision. If only the first octant is given, it is not mirrored into the
+/// grid: the grid covers only the given octant and the position is mirrored
+/// at every look-up instead. Together with the single precision this stores
+/// about a sixteenth of the memory of @c fieldMapXYZ. The minima and maxima
+/// of the map are then the ones of the given octant.
+///
+/// @param localToGlobalBin See @c fieldMapXYZ
+/// @param[in] xPos See @c fieldMapXYZ
+/// @param[in] yPos See @c fieldMapXYZ
+/// @param[in] zPos See @c fieldMapXYZ
+/// @param[in] bField See @c fieldMapXYZ
+/// @param[in] lengthUnit The unit of the grid points
+/// @param[in] BFieldUnit The unit of the magnetic field
+/// @param[in] firstOctant Flag if set to true indicating that only the first
+///            octant of the grid points and the BField values has been given,
+///            with the first positions on the symmetry planes
+/// @return A field map instance for use in interpolation.
+CompactFieldMapXYZ compactFieldMapXYZ(
+    const std::function<std::size_t(std::array<std::size_t, 3> binsXYZ,
+                                    std::array<std::size_t, 3> nBinsXYZ)>&
+        localToGlobalBin,
+    std::vector<double> xPos, std::vector<double> yPos,
+    std::vector<double> zPos, const std::vector<Acts::Vector3>& bField,
+    double lengthUnit = UnitConstants::mm, double BFieldUnit = UnitConstants::T,
+    bool firstOctant = false);
+
 /// Function which takes an existing SolenoidBField instance and
 /// creates a field mapper by sampling grid points from the analytical
 /// solenoid field.
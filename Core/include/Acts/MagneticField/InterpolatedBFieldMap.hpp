@@ -16,6 +16,7 @@
 #include "Acts/Utilities/Interpolation.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <optional>
 #include <vector>
@@ -52,6 +53,34 @@ class InterpolatedMagneticField : public MagneticFieldProvider {
   /// @param position The lookup position in 3D
   /// @return The field value at @p position
   virtual Vector3 getFieldUnchecked(const Vector3& position) const = 0;
+
+  /// Get the field values for a batch of positions
+  ///
+  /// The default implementation checks and evaluates every position on its
+  /// own.
+  ///
+  /// @param positions The lookup positions in 3D
+  /// @param n The number of lookup positions
+  /// @param [out] fields The field values, has to provide space for n
+  ///        entries. Positions outside of the interpolation domain get a zero
+  ///        field.
+  /// @param [out] inside Optional inside flags, has to provide space for n
+  ///        entries if given
+  /// @return The number of positions inside of the interpolation domain
+  virtual std::size_t getFields(const Vector3* positions, std::size_t n,
+                                Vector3* fields,
+                                bool* inside = nullptr) const {
+    std::size_t nInside = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      bool isIn = isInside(positions[i]);
+      fields[i] = isIn ? getFieldUnchecked(positions[i]) : Vector3::Zero();
+      nInside += isIn;
+      if (inside != nullptr) {
+        inside[i] = isIn;
+      }
+    }
+    return nInside;
+  }
 };
 
 /// @ingroup MagneticField
@@ -294,6 +323,58 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
                                  position);
   }
 
+  /// @copydoc InterpolatedMagneticField::getFields
+  ///
+  /// The corner values of the last grid cell are kept, such that positions
+  /// in the same cell, e.g. along a scan of the grid or a track, are
+  /// interpolated without reading the grid again. The results are identical
+  /// to the ones of @c getField.
+  std::size_t getFields(const Vector3* positions, std::size_t n,
+                        Vector3* fields,
+                        bool* inside = nullptr) const final {
+    constexpr std::size_t nCorners = 1 << DIM_POS;
+    std::array<FieldType, nCorners> corners{};
+    typename Grid::point_t lowerLeft{};
+    typename Grid::point_t upperRight{};
+    bool hasCell = false;
+
+    std::size_t nInside = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto gridPosition = m_cfg.transformPos(positions[i]);
+      bool isIn = isInsideLocal(gridPosition);
+      if (inside != nullptr) {
+        inside[i] = isIn;
+      }
+      if (!isIn) {
+        fields[i] = Vector3::Zero();
+        continue;
+      }
+      ++nInside;
+
+      bool inCell = hasCell;
+      for (std::size_t d = 0; d < DIM_POS; ++d) {
+        inCell = inCell && gridPosition[d] >= lowerLeft[d] &&
+                 gridPosition[d] < upperRight[d];
+      }
+      if (!inCell) {
+        // same lookup as Grid::interpolate
+        const auto& indices = m_cfg.grid.localBinsFromPosition(gridPosition);
+        lowerLeft = m_cfg.grid.lowerLeftBinEdge(indices);
+        upperRight = m_cfg.grid.upperRightBinEdge(indices);
+        std::size_t c = 0;
+        for (std::size_t index :
+             m_cfg.grid.closestPointsIndices(gridPosition)) {
+          corners[c++] = m_cfg.grid.at(index);
+        }
+        hasCell = true;
+      }
+      fields[i] = m_cfg.transformBField(
+          interpolate(gridPosition, lowerLeft, upperRight, corners),
+          positions[i]);
+    }
+    return nInside;
+  }
+
   /// @copydoc MagneticFieldProvider::getField(const Vector3&,MagneticFieldProvider::Cache&) const
   Result<Vector3> getField(const Vector3& position,
                            MagneticFieldProvider::Cache& cache) const final {
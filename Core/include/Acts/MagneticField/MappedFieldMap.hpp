@@ -0,0 +1,241 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/Utilities/Grid.hpp"
+#include "Acts/Utilities/Interpolation.hpp"
+#include "Acts/Utilities/MappedFile.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "Acts/Utilities/detail/grid_helper.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace Acts {
+
+namespace detail_mfm {
+
+static constexpr std::size_t kValuesAlignment = 64;
+static constexpr std::uint32_t kVersion = 1;
+static constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S',
+                                               'B', 'F', 'L', 'D'};
+
+struct FileHeader {
+  std::array<char, 8> magic = kMagic;
+  std::uint32_t version = kVersion;
+  /// Sizes of the header and of one value, to detect files written with a
+  /// different layout
+  std::uint32_t headerSize = 0;
+  std::uint32_t valueSize = 0;
+  /// 2 for a map in r,z and 3 for a map in x,y,z
+  std::uint32_t dimensions = 0;
+  /// The equidistant axes, only the first @c dimensions are used
+  std::array<double, 3> min{};
+  std::array<double, 3> max{};
+  std::array<std::uint64_t, 3> nBins{};
+  /// The field values in the global bin order of the grid, including the
+  /// under- and overflow bins
+  std::uint64_t valuesOffset = 0;
+  std::uint64_t nValues = 0;
+};
+
+}  // namespace detail_mfm
+
+/// Read-only memory mapping of a field map file written by
+/// @c writeMappedFieldMap
+///
+/// The file holds the axes of the grid and the field values as stored by
+/// @c Grid, such that the values can be used in place. All processes that
+/// map the same file thus share one copy of the field map in memory.
+///
+/// @note The file uses the native byte order and is meant to be read on the
+///       same platform it was written on.
+class MappedFieldMapFile {
+ public:
+  /// Map a file into memory
+  /// @param path The path of the file
+  /// @throw std::runtime_error if the file can not be mapped or is not a
+  ///        valid field map file
+  explicit MappedFieldMapFile(const std::string& path);
+
+  MappedFieldMapFile(const MappedFieldMapFile&) = delete;
+  MappedFieldMapFile& operator=(const MappedFieldMapFile&) = delete;
+
+  /// The header of the file
+  const detail_mfm::FileHeader& header() const {
+    return *reinterpret_cast<const detail_mfm::FileHeader*>(m_file.data());
+  }
+
+  /// The field values of the file
+  /// @tparam T The field type, @c Vector2 or @c Vector3
+  template <typename T>
+  const T* values() const {
+    return reinterpret_cast<const T*>(m_file.data() + header().valuesOffset);
+  }
+
+ private:
+  MappedFile m_file;
+};
+
+/// Read-only grid with the values in a mapped field map file
+///
+/// Provides the part of the @c Grid interface used by
+/// @c InterpolatedBFieldMap, with the same bin look-up and interpolation.
+///
+/// @tparam T The type of the values
+/// @tparam Axes The types of the axes
+template <typename T, class... Axes>
+class MappedFieldGrid {
+ public:
+  /// number of dimensions of the grid
+  static constexpr std::size_t DIM = sizeof...(Axes);
+
+  /// type of values stored
+  using value_type = T;
+  /// constant reference type to values stored
+  using const_reference = const value_type&;
+  /// type for points in d-dimensional grid space
+  using point_t = std::array<ActsScalar, DIM>;
+  /// index type using local bin indices along each axis
+  using index_t = std::array<std::size_t, DIM>;
+
+  /// Constructor
+  ///
+  /// @param file The mapped file, kept alive by the grid
+  /// @param axes The axes of the grid
+  /// @param values The values of all bins, including under- and overflow
+  MappedFieldGrid(std::shared_ptr<const MappedFieldMapFile> file,
+                  std::tuple<Axes...> axes, const T* values)
+      : m_file(std::move(file)), m_axes(std::move(axes)), m_values(values) {}
+
+  /// @copydoc Grid::at(std::size_t) const
+  const_reference at(std::size_t bin) const { return m_values[bin]; }
+
+  /// @copydoc Grid::closestPointsIndices
+  template <class Point>
+  detail::GlobalNeighborHoodIndices<DIM> closestPointsIndices(
+      const Point& position) const {
+    return detail::grid_helper::closestPointsIndices(
+        localBinsFromPosition(position), m_axes);
+  }
+
+  /// @copydoc Grid::localBinsFromPosition
+  template <class Point>
+  index_t localBinsFromPosition(const Point& point) const {
+    return detail::grid_helper::getLocalBinIndices(point, m_axes);
+  }
+
+  /// @copydoc Grid::lowerLeftBinEdge
+  point_t lowerLeftBinEdge(const index_t& localBins) const {
+    return detail::grid_helper::getLowerLeftBinEdge(localBins, m_axes);
+  }
+
+  /// @copydoc Grid::upperRightBinEdge
+  point_t upperRightBinEdge(const index_t& localBins) const {
+    return detail::grid_helper::getUpperRightBinEdge(localBins, m_axes);
+  }
+
+  /// @copydoc Grid::numLocalBins
+  index_t numLocalBins() const { return detail::grid_helper::getNBins(m_axes); }
+
+  /// @copydoc Grid::minPosition
+  point_t minPosition() const { return detail::grid_helper::getMin(m_axes); }
+
+  /// @copydoc Grid::maxPosition
+  point_t maxPosition() const { return detail::grid_helper::getMax(m_axes); }
+
+  /// @copydoc Grid::interpolate
+  template <class Point>
+  T interpolate(const Point& point) const {
+    // there are 2^DIM corner points used during the interpolation
+    constexpr std::size_t nCorners = 1 << DIM;
+
+    std::array<value_type, nCorners> neighbors{};
+    const auto& llIndices = localBinsFromPosition(point);
+    std::size_t i = 0;
+    for (std::size_t index :
+         detail::grid_helper::closestPointsIndices(llIndices, m_axes)) {
+      neighbors.at(i++) = at(index);
+    }
+
+    return Acts::interpolate(point, lowerLeftBinEdge(llIndices),
+                             upperRightBinEdge(llIndices), neighbors);
+  }
+
+ private:
+  std::shared_ptr<const MappedFieldMapFile> m_file;
+  std::tuple<Axes...> m_axes;
+  const T* m_values = nullptr;
+};
+
+/// Field map in r,z with the field values in a mapped file
+using MappedFieldMapRZ = InterpolatedBFieldMap<MappedFieldGrid<
+    Vector2, detail::EquidistantAxis, detail::EquidistantAxis>>;
+
+/// Field map in x,y,z with the field values in a mapped file
+using MappedFieldMapXYZ = InterpolatedBFieldMap<
+    MappedFieldGrid<Vector3, detail::EquidistantAxis, detail::EquidistantAxis,
+                    detail::EquidistantAxis>>;
+
+/// Write the grid of a field map in r,z made by @c fieldMapRZ to a file
+/// that can be memory mapped
+///
+/// @param os The output stream, opened in binary mode
+/// @param fieldMap The field map
+void writeMappedFieldMap(
+    std::ostream& os,
+    const InterpolatedBFieldMap<Grid<Vector2, detail::EquidistantAxis,
+                                     detail::EquidistantAxis>>& fieldMap);
+
+/// Write the grid of a field map in x,y,z made by @c fieldMapXYZ to a file
+/// that can be memory mapped
+///
+/// @param os The output stream, opened in binary mode
+/// @param fieldMap The field map
+void writeMappedFieldMap(
+    std::ostream& os,
+    const InterpolatedBFieldMap<
+        Grid<Vector3, detail::EquidistantAxis, detail::EquidistantAxis,
+             detail::EquidistantAxis>>& fieldMap);
+
+/// Create the field map in r,z of a mapped file
+///
+/// The field values are used in place, the position and field transforms
+/// are the ones of @c fieldMapRZ.
+///
+/// @param file The mapped file
+/// @throw std::invalid_argument if the file does not hold a map in r,z
+MappedFieldMapRZ mappedFieldMapRZ(
+    std::shared_ptr<const MappedFieldMapFile> file);
+
+/// Create the field map in x,y,z of a mapped file
+///
+/// The field values are used in place, the position and field transforms
+/// are the ones of @c fieldMapXYZ.
+///
+/// @param file The mapped file
+/// @throw std::invalid_argument if the file does not hold a map in x,y,z
+MappedFieldMapXYZ mappedFieldMapXYZ(
+    std::shared_ptr<const MappedFieldMapFile> file);
+
+/// Map a field map file and create the field map in r,z or x,y,z it holds
+///
+/// @param path The path of the file written by @c writeMappedFieldMap
+std::shared_ptr<InterpolatedMagneticField> readMappedFieldMap(
+    const std::string& path);
+
+}  // namespace Acts
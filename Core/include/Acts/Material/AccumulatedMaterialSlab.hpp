@@ -71,6 +71,17 @@ class AccumulatedMaterialSlab {
   /// unless explicitly requested.
   void trackAverage(bool useEmptyTrack = false);
 
+  /// Add the total average and variance of another accumulator.
+  ///
+  /// @param other Accumulator filled with a different set of tracks
+  ///
+  /// The result is the same as if the tracks of the other accumulator had
+  /// been averaged by this one, up to rounding. This allows the tracks to be
+  /// accumulated in parts, e.g. per thread, and combined afterwards. The
+  /// per-track stores are not merged, i.e. the last track of the other
+  /// accumulator has to be finished with `.trackAverage(...)` before.
+  void merge(const AccumulatedMaterialSlab& other);
+
   /// Return the average material properties from all accumulated tracks.
   ///
   /// @returns Average material properties and the number of contributing tracks
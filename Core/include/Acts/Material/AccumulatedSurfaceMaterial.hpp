@@ -134,6 +134,14 @@ class AccumulatedSurfaceMaterial {
   /// @param emptyHit indicator if this is an empty assignment
   void trackAverage(const Vector3& gp, bool emptyHit = false);
 
+  /// Add the material accumulated by another object for the same surface
+  ///
+  /// @param other Accumulated material with the same binning, filled with
+  ///        a different set of tracks
+  ///
+  /// @note Throws std::invalid_argument if the binning does not match
+  void merge(const AccumulatedSurfaceMaterial& other);
+
   /// Total average creates SurfaceMaterial
   std::unique_ptr<const ISurfaceMaterial> totalAverage();
 
@@ -22,6 +22,11 @@ class AccumulatedVolumeMaterial {
   /// Add one entry with the given material properties.
   void accumulate(const MaterialSlab& mat);
 
+  /// Add all entries of another accumulator.
+  ///
+  /// @param other Accumulator filled with a different set of entries
+  void merge(const AccumulatedVolumeMaterial& other);
+
   /// Compute the average material collected so far.
   ///
   /// @returns Vacuum properties if no matter has been accumulated yet.
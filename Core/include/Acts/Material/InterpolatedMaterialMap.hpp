@@ -67,9 +67,19 @@ struct MaterialMapper {
     ///
     /// @pre The given @c position must lie within the current cell.
     Material getMaterial(const Vector3& position) const {
+      return getMaterialLocal(m_transformPos(position));
+    }
+
+    /// @brief Retrieve material at given position in grid space
+    ///
+    /// @param [in] gridPosition Position in grid space
+    /// @return Material at the given position
+    ///
+    /// @pre The given @c gridPosition must lie within the current cell.
+    Material getMaterialLocal(const ActsVector<DIM_POS>& gridPosition) const {
       // defined in Interpolation.hpp
-      return Material(interpolate(m_transformPos(position), m_lowerLeft,
-                                  m_upperRight, m_materialValues));
+      return Material(interpolate(gridPosition, m_lowerLeft, m_upperRight,
+                                  m_materialValues));
     }
 
     /// @brief Check whether given 3D position is inside this cell
@@ -78,10 +88,18 @@ struct MaterialMapper {
     /// @return @c true if position is inside the current cell,
     ///         otherwise @c false
     bool isInside(const Vector3& position) const {
-      const auto& gridCoordinates = m_transformPos(position);
+      return isInsideLocal(m_transformPos(position));
+    }
+
+    /// @brief Check whether given position in grid space is inside this cell
+    ///
+    /// @param [in] gridPosition Position in grid space
+    /// @return @c true if position is inside the current cell,
+    ///         otherwise @c false
+    bool isInsideLocal(const ActsVector<DIM_POS>& gridPosition) const {
       for (unsigned int i = 0; i < DIM_POS; ++i) {
-        if (gridCoordinates[i] < m_lowerLeft.at(i) ||
-            gridCoordinates[i] >= m_upperRight.at(i)) {
+        if (gridPosition[i] < m_lowerLeft[i] ||
+            gridPosition[i] >= m_upperRight[i]) {
           return false;
         }
       }
@@ -115,6 +133,14 @@ struct MaterialMapper {
       Grid_t grid)
       : m_transformPos(std::move(transformPos)), m_grid(std::move(grid)) {}
 
+  /// @brief Transform a global position into grid space
+  ///
+  /// @param [in] position Global 3D position
+  /// @return Position in grid space
+  ActsVector<DIM_POS> transformPos(const Vector3& position) const {
+    return m_transformPos(position);
+  }
+
   /// @brief Retrieve binned material at given position
   ///
   /// @param [in] position Global 3D position
@@ -147,8 +173,7 @@ struct MaterialMapper {
   /// map.
   MaterialCell getMaterialCell(const Vector3& position) const {
     const auto& gridPosition = m_transformPos(position);
-    std::size_t bin = m_grid.globalBinFromPosition(gridPosition);
-    const auto& indices = m_grid.localBinsFromPosition(bin);
+    const auto& indices = m_grid.localBinsFromPosition(gridPosition);
     const auto& lowerLeft = m_grid.lowerLeftBinEdge(indices);
     const auto& upperRight = m_grid.upperRightBinEdge(indices);
 
@@ -281,12 +306,16 @@ class InterpolatedMaterialMap : public IVolumeMaterial {
   /// interpolation
   ///
   /// @return material at given position
+  ///
+  /// @note The position is transformed into grid space once, the cell is
+  /// only looked up again in the grid if the position leaves it.
   Material getMaterial(const Vector3& position, Cache& cache) const {
-    if (!cache.initialized || !(*cache.matCell).isInside(position)) {
+    const auto gridPosition = m_mapper.transformPos(position);
+    if (!cache.initialized || !(*cache.matCell).isInsideLocal(gridPosition)) {
       cache.matCell = getMaterialCell(position);
       cache.initialized = true;
     }
-    return (*cache.matCell).getMaterial(position);
+    return (*cache.matCell).getMaterialLocal(gridPosition);
   }
 
   /// @brief Retrieve material value & its "gradient"
@@ -307,12 +336,11 @@ class InterpolatedMaterialMap : public IVolumeMaterial {
   /// @return Material
   ///
   /// @note Currently the derivative is not calculated
-  /// @note Cache is not used currently
   /// @todo return derivative
   Material getMaterialGradient(const Vector3& position,
                                ActsMatrix<5, 5>& /*derivative*/,
-                               Cache& /*cache*/) const {
-    return m_mapper.getMaterial(position);
+                               Cache& cache) const {
+    return getMaterial(position, cache);
   }
 
   /// @brief Convenience method to access underlying material mapper
@@ -9,12 +9,17 @@
 #pragma once
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/Detector/DetectorVolume.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Material/interface/IAssignmentFinder.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/BoundingBox.hpp"
 
+#include <cstddef>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -30,7 +35,10 @@ namespace Acts {
 /// needs to be preconditioned with the surfaces and volumes that are tested
 /// for candidate inclusion.
 ///
-/// In a large-n material interaction scenario, this is not the most efficient
+/// In a large-n material interaction scenario, this is not the most efficient,
+/// unless the surfaces are pre-selected with a bounding box hierarchy: the
+/// straight line of each track is then only intersected with the surfaces
+/// whose bounding box it crosses.
 class IntersectionMaterialAssigner final : public IAssignmentFinder {
  public:
   /// @brief Nested configuration struct
@@ -41,6 +49,15 @@ class IntersectionMaterialAssigner final : public IAssignmentFinder {
     std::vector<const TrackingVolume*> trackingVolumes;
     /// @brief  The volumes to be tested: DetectorVolume
     std::vector<const Experimental::DetectorVolume*> detectorVolumes;
+
+    /// @brief Pre-select the surfaces with a bounding box hierarchy
+    bool useBoundingBoxes = false;
+    /// @brief The geometry context in which the bounding boxes are built
+    GeometryContext boxContext = GeometryContext();
+    /// @brief The envelope added to the surface bounding boxes
+    ActsScalar boxEnvelope = 1 * UnitConstants::mm;
+    /// @brief The maximum depth of the octree
+    std::size_t maxOctreeDepth = 8;
   };
 
   /// @brief Construct with the configuration
@@ -50,8 +67,7 @@ class IntersectionMaterialAssigner final : public IAssignmentFinder {
   IntersectionMaterialAssigner(
       const Config& cfg,
       std::unique_ptr<const Logger> mlogger =
-          getDefaultLogger("IntersectionMaterialAssigner", Logging::INFO))
-      : m_cfg(cfg), m_logger(std::move(mlogger)) {}
+          getDefaultLogger("IntersectionMaterialAssigner", Logging::INFO));
 
   /// @brief Method for generating assignment candidates for the
   /// material interaction assignment to surfaces or volumes
@@ -73,9 +89,23 @@ class IntersectionMaterialAssigner final : public IAssignmentFinder {
   /// Access method to the logger
   const Logger& logger() const { return *m_logger; }
 
+  using Box = AxisAlignedBoundingBox<Surface, ActsScalar, 3>;
+
   /// The configuration
   Config m_cfg;
 
+  /// The boundary surfaces of the tracking volumes
+  std::vector<std::vector<const Surface*>> m_trackingVolumeSurfaces;
+  /// The portal surfaces of the detector volumes
+  std::vector<std::vector<const Surface*>> m_detectorVolumeSurfaces;
+
+  /// The surface bounding boxes, the leaves of the tree
+  std::vector<std::unique_ptr<Box>> m_boxes;
+  /// The nodes of the octree
+  std::vector<std::unique_ptr<Box>> m_nodes;
+  /// The top node, if the bounding boxes are used
+  const Box* m_top = nullptr;
+
   /// The logger
   std::unique_ptr<const Logger> m_logger;
 };
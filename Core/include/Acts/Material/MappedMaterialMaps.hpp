@@ -0,0 +1,262 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Material/IMaterialDecorator.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/IVolumeMaterial.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/MappedFile.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Acts {
+
+/// Surface and volume material maps by geometry identifier
+using MappedMaterialMaps = std::pair<
+    std::map<GeometryIdentifier, std::shared_ptr<const ISurfaceMaterial>>,
+    std::map<GeometryIdentifier, std::shared_ptr<const IVolumeMaterial>>>;
+
+namespace detail_mmm {
+
+/// Sections of a mapped material file. Every section is a contiguous array
+/// and starts at an offset aligned to @c kSectionAlignment.
+enum Section : std::size_t {
+  eSurfaces = 0,
+  eVolumes,
+  eBinnings,
+  eBoundaries,
+  eSlabs,
+  eMaterials,
+  eNumSections
+};
+
+static constexpr std::size_t kSectionAlignment = 64;
+static constexpr std::uint32_t kVersion = 1;
+static constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S',
+                                               'M', 'A', 'T', 'M'};
+
+struct SectionRange {
+  std::uint64_t offset = 0;
+  std::uint64_t size = 0;
+};
+
+struct FileHeader {
+  std::array<char, 8> magic = kMagic;
+  std::uint32_t version = kVersion;
+  /// Sizes of the records, to detect files written with a different layout
+  std::uint32_t headerSize = 0;
+  std::uint32_t surfaceRecordSize = 0;
+  std::uint32_t volumeRecordSize = 0;
+  std::uint32_t binningRecordSize = 0;
+  std::uint32_t slabSize = 0;
+  std::array<SectionRange, eNumSections> sections{};
+};
+
+/// One dimension of a bin utility
+struct BinningRecord {
+  std::uint32_t type = 0;
+  std::uint32_t option = 0;
+  std::uint32_t value = 0;
+  std::uint32_t bins = 0;
+  float min = 0;
+  float max = 0;
+  /// Range in the boundaries section, for arbitrary binnings
+  std::uint64_t boundariesOffset = 0;
+  std::uint64_t nBoundaries = 0;
+};
+
+/// Shared by surfaces and volumes: the binning and the range of the values
+struct MaterialRecord {
+  enum Type : std::uint32_t {
+    eHomogeneous = 0,
+    eBinned = 1,
+    eGrid2D = 2,
+    eGrid3D = 3
+  };
+
+  std::uint64_t geometryId = 0;
+  std::uint32_t type = eHomogeneous;
+  std::int32_t mappingType = 0;
+  /// Range in the binnings section
+  std::uint32_t binningOffset = 0;
+  std::uint32_t nBinnings = 0;
+  /// Range in the slabs section for surfaces and in the materials section
+  /// for volumes
+  std::uint64_t valuesOffset = 0;
+  std::uint64_t nValues = 0;
+  /// Local to global transform of the binning, column major
+  std::array<double, 16> transform{};
+};
+
+static_assert(std::is_trivially_copyable_v<BinningRecord>);
+static_assert(std::is_trivially_copyable_v<MaterialRecord>);
+static_assert(std::is_trivially_copyable_v<MaterialSlab>);
+
+}  // namespace detail_mmm
+
+/// Read-only memory mapping of a material file written by
+/// @c writeMappedMaterialMaps
+///
+/// The file holds one fixed size record per surface and volume, which
+/// reference pools of binnings and material values. The material slabs of
+/// the binned surfaces are stored with the in-memory layout of
+/// @c MaterialSlab and are used in place by @c MappedBinnedSurfaceMaterial.
+/// Only the header and the section bounds are validated, the content is
+/// trusted.
+///
+/// @note The file uses the native byte order and record layout and is meant
+///       to be read on the same platform it was written on.
+class MappedMaterialFile {
+ public:
+  /// Map a file into memory
+  /// @param path The path of the file
+  /// @throw std::runtime_error if the file can not be mapped or is not a
+  ///        valid material file
+  explicit MappedMaterialFile(const std::string& path);
+
+  MappedMaterialFile(const MappedMaterialFile&) = delete;
+  MappedMaterialFile& operator=(const MappedMaterialFile&) = delete;
+
+  /// The first element of a section
+  /// @tparam T The element type of the section
+  /// @param section The section
+  template <typename T>
+  const T* section(detail_mmm::Section section) const {
+    return reinterpret_cast<const T*>(m_file.data() +
+                                      header().sections[section].offset);
+  }
+
+  /// The size of a section in units of its element type
+  /// @tparam T The element type of the section
+  /// @param section The section
+  template <typename T>
+  std::size_t sectionSize(detail_mmm::Section section) const {
+    return header().sections[section].size / sizeof(T);
+  }
+
+ private:
+  const detail_mmm::FileHeader& header() const {
+    return *reinterpret_cast<const detail_mmm::FileHeader*>(m_file.data());
+  }
+
+  MappedFile m_file;
+};
+
+/// @class MappedBinnedSurfaceMaterial
+///
+/// Binned surface material with the material slabs in a mapped file. The
+/// lookup is the one of @c BinnedSurfaceMaterial, the slabs are not copied
+/// and can thus not be scaled.
+class MappedBinnedSurfaceMaterial final : public ISurfaceMaterial {
+ public:
+  /// Constructor
+  ///
+  /// @param file The mapped file, kept alive by the material
+  /// @param binUtility The binning structure on the surface
+  /// @param slabs The slabs of the bins, with the first bin index running
+  ///        fastest
+  /// @param mappingType The type of surface mapping associated to the surface
+  MappedBinnedSurfaceMaterial(std::shared_ptr<const MappedMaterialFile> file,
+                              const BinUtility& binUtility,
+                              const MaterialSlab* slabs,
+                              MappingType mappingType = MappingType::Default);
+
+  /// Scale operator
+  ///
+  /// @throw std::logic_error as the mapped slabs are read-only
+  MappedBinnedSurfaceMaterial& operator*=(double scale) final;
+
+  /// Return the BinUtility
+  const BinUtility& binUtility() const { return m_binUtility; }
+
+  /// The slab of a bin
+  ///
+  /// @param bin0 The bin along the first binning dimension
+  /// @param bin1 The bin along the second binning dimension
+  const MaterialSlab& slab(std::size_t bin0, std::size_t bin1) const {
+    return m_slabs[bin1 * m_bins0 + bin0];
+  }
+
+  /// @copydoc ISurfaceMaterial::materialSlab(const Vector2&) const
+  const MaterialSlab& materialSlab(const Vector2& lp) const final;
+
+  /// @copydoc ISurfaceMaterial::materialSlab(const Vector3&) const
+  const MaterialSlab& materialSlab(const Vector3& gp) const final;
+
+  /// Output Method for std::ostream
+  std::ostream& toStream(std::ostream& sl) const final;
+
+ private:
+  std::shared_ptr<const MappedMaterialFile> m_file;
+  BinUtility m_binUtility;
+  const MaterialSlab* m_slabs = nullptr;
+  std::size_t m_bins0 = 1;
+};
+
+/// Write material maps to a file that can be memory mapped
+///
+/// Homogeneous and binned surface material as well as homogeneous and
+/// interpolated 2D/3D volume material are supported. As for the JSON format,
+/// the split factors of the surface material are not stored.
+///
+/// @param os The output stream, opened in binary mode
+/// @param maps The surface and volume material maps
+/// @throw std::invalid_argument for unsupported material or binning types
+void writeMappedMaterialMaps(std::ostream& os, const MappedMaterialMaps& maps);
+
+/// Create the material maps of a mapped file
+///
+/// Binned surface material references the slabs in the file, volume material
+/// grids are copied.
+///
+/// @param file The mapped file
+MappedMaterialMaps readMappedMaterialMaps(
+    const std::shared_ptr<const MappedMaterialFile>& file);
+
+/// @brief Material decorator from a mapped material file
+class MappedMaterialDecorator : public IMaterialDecorator {
+ public:
+  /// Constructor
+  ///
+  /// @param fileName The path of the file written by @c writeMappedMaterialMaps
+  /// @param clearSurfaceMaterial Remove the material of undecorated surfaces
+  /// @param clearVolumeMaterial Remove the material of undecorated volumes
+  MappedMaterialDecorator(const std::string& fileName,
+                          bool clearSurfaceMaterial = true,
+                          bool clearVolumeMaterial = true);
+
+  /// Decorate a surface
+  ///
+  /// @param surface the non-cost surface that is decorated
+  void decorate(Surface& surface) const final;
+
+  /// Decorate a TrackingVolume
+  ///
+  /// @param volume the non-cost volume that is decorated
+  void decorate(TrackingVolume& volume) const final;
+
+ private:
+  MappedMaterialMaps m_maps;
+  bool m_clearSurfaceMaterial = true;
+  bool m_clearVolumeMaterial = true;
+};
+
+}  // namespace Acts
@@ -100,7 +100,9 @@ class Material {
   /// Return the mass density.
   float massDensity() const;
   /// Return the mean electron excitation energy.
-  float meanExcitationEnergy() const;
+  constexpr float meanExcitationEnergy() const {
+    return m_meanExcitationEnergy;
+  }
 
   /// Encode the properties into an opaque parameters vector.
   ParametersVector parameters() const;
@@ -111,6 +113,12 @@ class Material {
   float m_ar = 0.0f;
   float m_z = 0.0f;
   float m_molarRho = 0.0f;
+  // derived from the nuclear charge number, but needed for every energy loss
+  // computation and thus only evaluated once
+  float m_meanExcitationEnergy = 0.0f;
+
+  /// Compute the mean electron excitation energy from the nuclear charge.
+  static float computeMeanExcitationEnergy(float z);
 
   friend constexpr bool operator==(const Material& lhs, const Material& rhs) {
     return (lhs.m_x0 == rhs.m_x0) && (lhs.m_l0 == rhs.m_l0) &&
@@ -100,6 +100,13 @@ struct RecordedMaterial {
   double materialInL0 = 0.;
   /// This one is only filled when recordInteractions is switched on
   std::vector<MaterialInteraction> materialInteractions;
+
+  /// Clear the recorded material, keeping the allocated memory
+  void reset() {
+    materialInX0 = 0.;
+    materialInL0 = 0.;
+    materialInteractions.clear();
+  }
 };
 
 /// And recorded material track
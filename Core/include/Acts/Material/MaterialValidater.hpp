@@ -14,12 +14,61 @@
 #include "Acts/Material/MaterialInteraction.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 
 class IAssignmentFinder;
 
+/// @brief Material integrated along rays and summed in bins of eta and phi
+///
+/// The bin contents are laid out with the eta bin running fastest and can be
+/// written directly as profile histograms of x/X0 and L/L0 vs. eta and phi.
+/// Rays outside of the ranges are not counted.
+struct MaterialProfile {
+  /// Constructor
+  /// @param nEtaBins_ The number of eta bins
+  /// @param etaRange_ The eta range
+  /// @param nPhiBins_ The number of phi bins
+  /// @param phiRange_ The phi range
+  MaterialProfile(std::size_t nEtaBins_,
+                  const std::pair<ActsScalar, ActsScalar>& etaRange_,
+                  std::size_t nPhiBins_,
+                  const std::pair<ActsScalar, ActsScalar>& phiRange_);
+
+  /// Add the material of one ray
+  /// @param eta The eta of the ray
+  /// @param phi The phi of the ray
+  /// @param inX0 The material of the ray in units of the radiation length
+  /// @param inL0 The material of the ray in units of the interaction length
+  void fill(ActsScalar eta, ActsScalar phi, ActsScalar inX0, ActsScalar inL0);
+
+  /// Add the content of another profile with the same binning
+  /// @param other The other profile
+  /// @throw std::invalid_argument if the binnings differ
+  void merge(const MaterialProfile& other);
+
+  /// The global index of a bin
+  std::size_t bin(std::size_t iEta, std::size_t iPhi) const {
+    return iPhi * nEtaBins + iEta;
+  }
+
+  std::size_t nEtaBins = 1;
+  std::pair<ActsScalar, ActsScalar> etaRange;
+  std::size_t nPhiBins = 1;
+  std::pair<ActsScalar, ActsScalar> phiRange;
+
+  /// The number of rays per bin
+  std::vector<std::size_t> entries;
+  /// The summed x/X0 per bin
+  std::vector<ActsScalar> sumInX0;
+  /// The summed L/L0 per bin
+  std::vector<ActsScalar> sumInL0;
+};
+
 /// @brief The material validater is a tool that allows to record the material
 /// seen by a ray through a set of material surfaces.
 ///
@@ -51,6 +100,21 @@ class MaterialValidater {
                                        const Vector3& position,
                                        const Vector3& direction) const;
 
+  /// Method to integrate the material along a ray
+  ///
+  /// Same as @c recordMaterial, but without keeping the material
+  /// interactions, which avoids their allocation for large validation runs.
+  ///
+  /// @param gctx the geometry context
+  /// @param mctx the magnetic field context
+  /// @param position the starting position of the ray
+  /// @param direction the direction of the ray (unit vector)
+  ///
+  /// @return the material in units of the radiation and interaction length
+  std::pair<ActsScalar, ActsScalar> integrateMaterial(
+      const GeometryContext& gctx, const MagneticFieldContext& mctx,
+      const Vector3& position, const Vector3& direction) const;
+
  private:
   /// Access method to the logger
   const Logger& logger() const { return *m_logger; }
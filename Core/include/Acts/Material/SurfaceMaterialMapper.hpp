@@ -165,6 +165,16 @@ class SurfaceMaterialMapper {
   /// @param mState
   void finalizeMaps(State& mState) const;
 
+  /// @brief Method to merge the accumulated material of two states
+  ///
+  /// Both states have to be created for the same tracking geometry. This
+  /// allows to map the tracks with several states, e.g. one per thread, and
+  /// to combine them before the maps are finalized.
+  ///
+  /// @param mState The state receiving the accumulated material
+  /// @param other The state whose accumulated material is added
+  void mergeStates(State& mState, const State& other) const;
+
   /// Process/map a single track
   ///
   /// @param mState The current state map
@@ -16,11 +16,13 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Geometry/Layer.hpp"
 #include "Acts/Navigation/NavigationState.hpp"
+#include "Acts/Propagator/NavigationProfiler.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cmath>
 #include <iomanip>
 #include <iterator>
 #include <sstream>
@@ -44,6 +46,9 @@ class DetectorNavigator {
     bool resolveMaterial = true;
     /// stop at every surface regardless what it is
     bool resolvePassive = false;
+
+    /// Collect navigation counters per volume, opt-in
+    std::shared_ptr<NavigationProfiler> profiler = nullptr;
   };
 
   /// Nested State struct
@@ -62,6 +67,11 @@ class DetectorNavigator {
     bool targetReached = false;
     /// Navigation state : a break has been detected
     bool navigationBreak = false;
+
+    /// Profiling: the volume the counters are attributed to
+    GeometryIdentifier profileId;
+    /// Profiling: the counters of that volume
+    NavigationProfiler::Counters* profileCounters = nullptr;
   };
 
   /// Constructor with configuration object
@@ -185,6 +195,7 @@ class DetectorNavigator {
     }
 
     auto& nState = state.navigation;
+    NavigationProfiler::ScopedTimer profileTimer(profile(nState));
     fillNavigationState(state, stepper, nState);
 
     if (nState.currentSurface != nullptr) {
@@ -232,6 +243,9 @@ class DetectorNavigator {
                    << ")");
       // Estimate the surface status
       bool boundaryCheck = c.boundaryCheck.isEnabled();
+      if (auto* counters = profile(nState)) {
+        ++counters->intersections;
+      }
       auto surfaceStatus = stepper.updateSurfaceStatus(
           state.stepping, surface, c.objectIntersection.index(),
           state.options.direction, BoundaryCheck(boundaryCheck),
@@ -275,6 +289,8 @@ class DetectorNavigator {
       return;
     }
 
+    NavigationProfiler::ScopedTimer profileTimer(profile(nState));
+
     if (nState.surfaceCandidateIndex == nState.surfaceCandidates.size()) {
       ACTS_VERBOSE(volInfo(state)
                    << posInfo(state, stepper)
@@ -301,6 +317,9 @@ class DetectorNavigator {
     }
 
     // TODO not sure about the boundary check
+    if (auto* counters = profile(nState)) {
+      ++counters->intersections;
+    }
     auto surfaceStatus = stepper.updateSurfaceStatus(
         state.stepping, *nextSurface,
         nState.surfaceCandidate().objectIntersection.index(),
@@ -360,6 +379,25 @@ class DetectorNavigator {
 
   const Logger& logger() const { return *m_logger; }
 
+  /// The profiling counters of the current volume
+  ///
+  /// @param [in,out] state is the navigation state caching the counters
+  /// @return nullptr if profiling is disabled
+  NavigationProfiler::Counters* profile(State& state) const {
+    if (m_cfg.profiler == nullptr) {
+      return nullptr;
+    }
+    GeometryIdentifier geoId;
+    if (state.currentVolume != nullptr) {
+      geoId = state.currentVolume->geometryId();
+    }
+    if (state.profileCounters == nullptr || geoId != state.profileId) {
+      state.profileId = geoId;
+      state.profileCounters = &m_cfg.profiler->counters(geoId);
+    }
+    return state.profileCounters;
+  }
+
   /// This checks if a navigation break had been triggered or navigator
   /// is misconfigured
   ///
@@ -406,6 +444,9 @@ class DetectorNavigator {
     nState.currentVolume->updateNavigationState(state.geoContext, nState);
 
     ACTS_VERBOSE("SURFACE CANDIDATES: " << nState.surfaceCandidates.size());
+    if (auto* counters = profile(nState)) {
+      counters->candidates += nState.surfaceCandidates.size();
+    }
 
     // Sort properly the surface candidates
     auto& nCandidates = nState.surfaceCandidates;
@@ -427,6 +468,7 @@ class DetectorNavigator {
     nState.direction =
         state.options.direction * stepper.direction(state.stepping);
     nState.absMomentum = stepper.absoluteMomentum(state.stepping);
+    nState.absCharge = std::abs(stepper.charge(state.stepping));
     auto fieldResult = stepper.getField(state.stepping, nState.position);
     if (!fieldResult.ok()) {
       std::string msg = "DetectorNavigator: " + volInfo(state) +
@@ -15,10 +15,14 @@
 #include "Acts/Navigation/NavigationState.hpp"
 #include "Acts/Navigation/NavigationStateFillers.hpp"
 #include "Acts/Navigation/NavigationStateUpdaters.hpp"
+#include "Acts/Utilities/BoundingBox.hpp"
 #include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 
+#include <cstddef>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace Acts::Experimental {
 
@@ -66,6 +70,67 @@ struct TrialAndErrorVolumeFinder : public IExternalNavigation {
   }
 };
 
+/// @brief A volume finder using a bounding volume hierarchy
+///
+/// The bounding boxes of the volumes are arranged in an octree. The volume
+/// at a position is found by descending only into the boxes containing the
+/// position, followed by the exact inside check of the candidate volumes.
+/// This avoids the linear trials for large numbers of irregularly placed
+/// volumes, e.g. in a muon system.
+///
+/// @note The bounding boxes are taken from the volumes at construction,
+/// i.e. they are not updated for a different geometry context.
+struct BoundingBoxVolumeFinder : public IExternalNavigation {
+  using Box = DetectorVolume::BoundingBox;
+
+  /// Constructor from the volumes to search
+  ///
+  /// @param volumes the volumes to be found
+  /// @param maxDepth the maximum depth of the octree
+  explicit BoundingBoxVolumeFinder(
+      const std::vector<const DetectorVolume*>& volumes,
+      std::size_t maxDepth = 8) {
+    std::vector<Box*> prims;
+    prims.reserve(volumes.size());
+    for (const auto* v : volumes) {
+      m_boxes.push_back(std::make_unique<Box>(v->getBoundingBox()));
+      prims.push_back(m_boxes.back().get());
+    }
+    if (!prims.empty()) {
+      m_top = make_octree(m_nodes, prims, maxDepth);
+    }
+  }
+
+  inline void update(const GeometryContext& gctx,
+                     NavigationState& nState) const {
+    const Box* node = m_top;
+    while (node != nullptr) {
+      if (!node->intersect(nState.position)) {
+        node = node->getSkip();
+      } else if (node->hasEntity()) {
+        const DetectorVolume* v = node->entity();
+        if (v->inside(gctx, nState.position)) {
+          nState.currentVolume = v;
+          v->externalNavigation()(gctx, nState);
+          return;
+        }
+        node = node->getSkip();
+      } else {
+        node = node->getLeftChild();
+      }
+    }
+    nState.currentVolume = nullptr;
+  }
+
+ private:
+  /// The copies of the volume bounding boxes, the leaves of the tree
+  std::vector<std::unique_ptr<Box>> m_boxes;
+  /// The nodes of the octree
+  std::vector<std::unique_ptr<Box>> m_nodes;
+  /// The top node
+  const Box* m_top = nullptr;
+};
+
 /// Generate a delegate to try the root volumes
 inline static ExternalNavigationDelegate tryRootVolumes() {
   ExternalNavigationDelegate vFinder;
@@ -82,6 +147,19 @@ inline static ExternalNavigationDelegate tryAllSubVolumes() {
   return vFinder;
 }
 
+/// Generate a delegate to find the volumes with a bounding volume hierarchy
+///
+/// @param volumes the volumes to be found
+/// @param maxDepth the maximum depth of the octree
+inline static ExternalNavigationDelegate tryBoundingBoxVolumes(
+    const std::vector<const DetectorVolume*>& volumes,
+    std::size_t maxDepth = 8) {
+  ExternalNavigationDelegate vFinder;
+  vFinder.connect<&BoundingBoxVolumeFinder::update>(
+      std::make_unique<const BoundingBoxVolumeFinder>(volumes, maxDepth));
+  return vFinder;
+}
+
 /// Generate a delegate to try no volume
 inline static ExternalNavigationDelegate tryNoVolumes() {
   ExternalNavigationDelegate vFinder;
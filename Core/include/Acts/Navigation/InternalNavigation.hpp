@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Common.hpp"
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/Detector/DetectorVolume.hpp"
 #include "Acts/Detector/Portal.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
@@ -18,9 +19,14 @@
 #include "Acts/Navigation/NavigationStateFillers.hpp"
 #include "Acts/Navigation/NavigationStateUpdaters.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/BoundingBox.hpp"
+#include "Acts/Utilities/Frustum.hpp"
 
+#include <cmath>
+#include <cstddef>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 namespace Acts::Experimental {
 
@@ -135,6 +141,141 @@ struct AdditionalSurfacesNavigation : public IInternalNavigation {
   }
 };
 
+/// @brief Surface candidates from a frustum query of a bounding box hierarchy
+///
+/// The bounding boxes of the surfaces of a volume are arranged in an octree,
+/// or optionally in a bounding volume hierarchy with SAH splits. When the
+/// candidates are filled, a frustum is opened from the position along the
+/// direction, with an opening angle covering the bending of the track over
+/// the extent of all surfaces. Only the surfaces with a bounding
+/// box inside the frustum become candidates, together with the portals of
+/// the volume, for the whole traversal of the volume.
+///
+/// @note The bounding boxes are evaluated in the geometry context given at
+/// construction.
+struct BoundingBoxSurfacesNavigation : public IInternalNavigation {
+  using Box = AxisAlignedBoundingBox<Surface, ActsScalar, 3>;
+  using Frustum = Acts::Frustum<ActsScalar, 3, 4>;
+
+  struct Config {
+    /// The opening angle of the frustum for a straight track, covers e.g.
+    /// the multiple scattering
+    ActsScalar minOpeningAngle = 0.1;
+    /// Above this opening angle all surfaces are candidates, has to be < pi
+    ActsScalar maxOpeningAngle = 0.75 * M_PI;
+    /// The envelope added to the surface bounding boxes
+    ActsScalar envelope = 1 * UnitConstants::mm;
+    /// The maximum depth of the octree
+    std::size_t maxDepth = 8;
+    /// Build a bounding volume hierarchy with at most this many surfaces per
+    /// leaf instead of the octree if > 0
+    std::size_t bvhLeafSize = 0;
+  };
+
+  /// Constructor from the surfaces to search
+  ///
+  /// @param gctx the geometry context for the bounding boxes
+  /// @param surfaces the surfaces of the volume
+  /// @param cfg the configuration
+  BoundingBoxSurfacesNavigation(const GeometryContext& gctx,
+                                std::vector<const Surface*> surfaces,
+                                const Config& cfg)
+      : m_cfg(cfg), m_surfaces(std::move(surfaces)) {
+    std::vector<Box*> prims;
+    prims.reserve(m_surfaces.size());
+    for (const auto* surface : m_surfaces) {
+      auto extent = surface->polyhedronRepresentation(gctx, 1).extent();
+      Vector3 vmin(extent.min(binX), extent.min(binY), extent.min(binZ));
+      Vector3 vmax(extent.max(binX), extent.max(binY), extent.max(binZ));
+      m_boxes.push_back(std::make_unique<Box>(
+          surface, vmin - Vector3::Constant(m_cfg.envelope),
+          vmax + Vector3::Constant(m_cfg.envelope)));
+      prims.push_back(m_boxes.back().get());
+    }
+    if (!prims.empty()) {
+      m_top = m_cfg.bvhLeafSize > 0
+                  ? make_bvh(m_nodes, prims, m_cfg.bvhLeafSize)
+                  : make_octree(m_nodes, prims, m_cfg.maxDepth);
+      m_extent = (m_top->max() - m_top->min()).norm();
+    }
+  }
+
+  /// Fill the portals and selected surfaces when the volume is entered and
+  /// update the candidates
+  ///
+  /// @param gctx is the Geometry context of this call
+  /// @param nState is the navigation state to be updated
+  inline void update(const GeometryContext& gctx,
+                     NavigationState& nState) const {
+    if (nState.currentVolume == nullptr) {
+      throw std::runtime_error(
+          "BoundingBoxSurfacesNavigation: no detector volume set to "
+          "navigation state.");
+    }
+    if (nState.surfaceCandidates.empty()) {
+      for (const auto v : nState.currentVolume->volumes()) {
+        PortalsFiller::fill(nState, v->portals());
+      }
+      PortalsFiller::fill(nState, nState.currentVolume->portals());
+      SurfacesFiller::fill(nState, select(nState));
+    }
+    updateCandidates(gctx, nState);
+  }
+
+  /// Select the surfaces inside the frustum of the navigation state
+  ///
+  /// @param nState is the navigation state with position, direction,
+  ///        momentum, charge and magnetic field
+  ///
+  /// @return the surfaces that can be reached in this volume
+  std::vector<const Surface*> select(const NavigationState& nState) const {
+    if (m_top == nullptr) {
+      return {};
+    }
+    // the direction changes by curvature * path length, the positions along
+    // the path stay within half of this angle around the start direction
+    const ActsScalar curvature =
+        nState.absMomentum > 0
+            ? nState.absCharge *
+                  nState.direction.cross(nState.magneticField).norm() /
+                  nState.absMomentum
+            : 0;
+    const ActsScalar openingAngle =
+        m_cfg.minOpeningAngle + curvature * m_extent;
+    if (openingAngle >= m_cfg.maxOpeningAngle) {
+      return m_surfaces;
+    }
+
+    const Frustum frustum(nState.position, nState.direction, openingAngle);
+    std::vector<const Surface*> selected;
+    const Box* node = m_top;
+    while (node != nullptr) {
+      if (!node->intersect(frustum)) {
+        node = node->getSkip();
+      } else if (node->hasEntity()) {
+        selected.push_back(node->entity());
+        node = node->getSkip();
+      } else {
+        node = node->getLeftChild();
+      }
+    }
+    return selected;
+  }
+
+ private:
+  Config m_cfg;
+  /// The surfaces of the volume
+  std::vector<const Surface*> m_surfaces;
+  /// The surface bounding boxes, the leaves of the tree
+  std::vector<std::unique_ptr<Box>> m_boxes;
+  /// The nodes of the octree or bounding volume hierarchy
+  std::vector<std::unique_ptr<Box>> m_nodes;
+  /// The top node
+  const Box* m_top = nullptr;
+  /// The diagonal of the top node
+  ActsScalar m_extent = 0;
+};
+
 /// @brief  An indexed surface implementation access
 ///
 /// @tparam grid_type is the grid type used for this indexed lookup
@@ -158,4 +299,24 @@ using IndexedSurfacesAllPortalsNavigation =
     ChainedUpdaterImpl<IInternalNavigation, AllPortalsNavigation,
                        indexed_updator<grid_type>>;
 
+/// Generate a provider for the portals and the surfaces pre-selected by a
+/// frustum query of their bounding boxes
+///
+/// @param gctx the geometry context for the bounding boxes
+/// @param surfaces the surfaces of the volume
+/// @param cfg the configuration of the query
+///
+/// @return a connected navigationstate updator
+inline static InternalNavigationDelegate tryBoundingBoxSurfaces(
+    const GeometryContext& gctx, std::vector<const Surface*> surfaces,
+    const BoundingBoxSurfacesNavigation::Config& cfg =
+        BoundingBoxSurfacesNavigation::Config()) {
+  auto bbs = std::make_unique<const BoundingBoxSurfacesNavigation>(
+      gctx, std::move(surfaces), cfg);
+  InternalNavigationDelegate nStateUpdater;
+  nStateUpdater.connect<&BoundingBoxSurfacesNavigation::update>(
+      std::move(bbs));
+  return nStateUpdater;
+}
+
 }  // namespace Acts::Experimental
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/Propagator/ActorTrigger.hpp"
 #include "Acts/Propagator/detail/action_list_implementation.hpp"
 #include "Acts/Utilities/detail/Extendable.hpp"
 #include "Acts/Utilities/detail/MPL/all_of.hpp"
@@ -73,6 +74,9 @@ struct ActionList : public detail::Extendable<actors_t...> {
   /// Call operator that is that broadcasts the call to the tuple()
   /// members of the list
   ///
+  /// The current surface is looked up once for all actors with the
+  /// ActorTrigger::onSurface trigger.
+  ///
   /// @tparam propagator_state_t is the state type of the propagator
   /// @tparam stepper_t Type of the stepper used for the propagation
   /// @tparam navigator_t Type of the navigator used for the propagation
@@ -86,7 +90,14 @@ struct ActionList : public detail::Extendable<actors_t...> {
   void operator()(propagator_state_t& state, const stepper_t& stepper,
                   const navigator_t& navigator, Args&&... args) const {
     using impl = detail::action_list_impl<actors_t...>;
-    impl::action(tuple(), state, stepper, navigator,
+    constexpr bool hasSurfaceTrigger =
+        ((detail::actor_trigger_v<actors_t> == ActorTrigger::onSurface) ||
+         ...);
+    bool onSurface = true;
+    if constexpr (hasSurfaceTrigger) {
+      onSurface = navigator.currentSurface(state.navigation) != nullptr;
+    }
+    impl::action(tuple(), onSurface, state, stepper, navigator,
                  std::forward<Args>(args)...);
   }
 };
@@ -0,0 +1,25 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+namespace Acts {
+
+/// @brief Condition under which an actor of an ActionList is called
+///
+/// An actor can declare a static constexpr `trigger` member to be skipped by
+/// the ActionList when the condition is not met. The condition is evaluated
+/// once for the whole list. Actors without the member are always called.
+enum class ActorTrigger {
+  /// Called in every stage of the propagation
+  always,
+  /// Only called if the navigator reports a current surface
+  onSurface,
+};
+
+}  // namespace Acts
@@ -30,6 +30,7 @@
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <optional>
 #include <type_traits>
 
 namespace Acts {
@@ -130,6 +131,9 @@ class EigenStepper {
     /// Totoal number of attempted steps
     std::size_t nStepTrials = 0;
 
+    /// Total number of magnetic field lookups
+    std::size_t nFieldLookups = 0;
+
     /// Adaptive step size of the runge-kutta integration
     ConstrainedStep stepSize;
 
@@ -164,9 +168,16 @@ class EigenStepper {
   /// Constructor requires knowledge of the detector's magnetic field
   /// @param bField The magnetic field provider
   /// @param overstepLimit The limit for the overstep check
+  /// @param helixFieldTolerance If positive, steps along which the field is
+  ///        homogeneous within this relative tolerance are taken analytically
+  ///        along a helix, see step()
+  /// @param helixMaxSagitta Largest sagitta of a helix step towards a
+  ///        surface before the step is halved, see step()
   /// @note `overstepLimit` will be removed in a future release
   explicit EigenStepper(std::shared_ptr<const MagneticFieldProvider> bField,
-                        double overstepLimit = 100 * UnitConstants::um);
+                        double overstepLimit = 100 * UnitConstants::um,
+                        double helixFieldTolerance = 0,
+                        double helixMaxSagitta = 50 * UnitConstants::um);
 
   State makeState(std::reference_wrapper<const GeometryContext> gctx,
                   std::reference_wrapper<const MagneticFieldContext> mctx,
@@ -192,6 +203,7 @@ class EigenStepper {
   ///                 the magnetic field cell is used (and potentially updated)
   /// @param [in] pos is the field position
   Result<Vector3> getField(State& state, const Vector3& pos) const {
+    ++state.nFieldLookups;
     // get the field from the cell
     return m_bField->getField(pos, state.fieldCache);
   }
@@ -419,6 +431,15 @@ class EigenStepper {
   ///       backwards track propagation, and since we're using an adaptive
   ///       algorithm, it can be modified by the stepper class during
   ///       propagation.
+  ///
+  /// @note If the helix field tolerance is set and the default extension is
+  ///       used, the field is compared at the start and the end of a helix
+  ///       step of the full step size first. If it agrees within the
+  ///       tolerance, the helix step is taken with an analytic Jacobian and no
+  ///       step size control. The comparison is skipped for a ConstantBField.
+  ///       The distance to the next surface is estimated along a straight
+  ///       line, so a step limited by a surface is halved once if the
+  ///       sagitta of the helix exceeds the helix maximum sagitta.
   template <typename propagator_state_t, typename navigator_t>
   Result<double> step(propagator_state_t& state,
                       const navigator_t& navigator) const;
@@ -432,6 +453,25 @@ class EigenStepper {
  protected:
   /// Magnetic field inside of the detector
   std::shared_ptr<const MagneticFieldProvider> m_bField;
+
+  /// Relative field tolerance for helix steps, disabled if not positive
+  double m_helixFieldTolerance = 0;
+
+  /// Sagitta of a helix step towards a surface above which it is halved
+  double m_helixMaxSagitta = 50 * UnitConstants::um;
+
+  /// Whether the field is a ConstantBField
+  bool m_constantField = false;
+
+ private:
+  /// Try to perform a helix step with the current step size
+  ///
+  /// @param [in,out] state The propagator state
+  ///
+  /// @return The step size if the helix step was taken, std::nullopt if the
+  ///         field is not homogeneous along the step
+  template <typename propagator_state_t>
+  std::optional<Result<double>> helixStep(propagator_state_t& state) const;
 };
 
 template <typename navigator_t>
@@ -7,17 +7,28 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "Acts/EventData/TransformationHelpers.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
 #include "Acts/Propagator/detail/CovarianceEngine.hpp"
+#include "Acts/Propagator/detail/HelixStep.hpp"
 #include "Acts/Utilities/QuickMath.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <optional>
+#include <utility>
 
 template <typename E, typename A>
 Acts::EigenStepper<E, A>::EigenStepper(
     std::shared_ptr<const MagneticFieldProvider> bField,
-    double /*overstepLimit*/)
-    : m_bField(std::move(bField)) {}
+    double /*overstepLimit*/, double helixFieldTolerance,
+    double helixMaxSagitta)
+    : m_bField(std::move(bField)),
+      m_helixFieldTolerance(helixFieldTolerance),
+      m_helixMaxSagitta(helixMaxSagitta),
+      m_constantField(dynamic_cast<const ConstantBField*>(m_bField.get()) !=
+                      nullptr) {}
 
 template <typename E, typename A>
 auto Acts::EigenStepper<E, A>::makeState(
@@ -155,6 +166,15 @@ template <typename E, typename A>
 template <typename propagator_state_t, typename navigator_t>
 Acts::Result<double> Acts::EigenStepper<E, A>::step(
     propagator_state_t& state, const navigator_t& navigator) const {
+  // The helix is not valid with the energy loss of other extensions
+  if constexpr (std::is_same_v<E, StepperExtensionList<DefaultExtension>>) {
+    if (m_helixFieldTolerance > 0) {
+      if (auto res = helixStep(state)) {
+        return std::move(*res);
+      }
+    }
+  }
+
   // Runge-Kutta integrator state
   auto& sd = state.stepping.stepData;
 
@@ -362,6 +382,87 @@ Acts::Result<double> Acts::EigenStepper<E, A>::step(
   return h;
 }
 
+template <typename E, typename A>
+template <typename propagator_state_t>
+std::optional<Acts::Result<double>> Acts::EigenStepper<E, A>::helixStep(
+    propagator_state_t& state) const {
+  auto& stepping = state.stepping;
+
+  double h = stepping.stepSize.value() * state.options.direction;
+  // without any step size constraint the helix would leave to infinity,
+  // leave the step size control to the Runge-Kutta step in that case
+  if (std::abs(h) == std::numeric_limits<double>::max()) {
+    return std::nullopt;
+  }
+
+  auto fieldRes = getField(stepping, position(stepping));
+  if (!fieldRes.ok()) {
+    return Result<double>::failure(fieldRes.error());
+  }
+  const Vector3 bStart = *fieldRes;
+
+  // The distance to the next surface is estimated along a straight line,
+  // which the helix deviates from by its sagitta. If the sagitta exceeds the
+  // configured maximum, the step is halved once, which quarters the sagitta,
+  // and the distance is estimated again from the new position. Halving until
+  // the sagitta is below the maximum would limit the helix to steps of a few
+  // centimeters.
+  const ConstrainedStep& stepSize = stepping.stepSize;
+  if (stepSize.value() == stepSize.value(ConstrainedStep::actor) ||
+      stepSize.value() == stepSize.value(ConstrainedStep::aborter)) {
+    const double curvature =
+        std::abs(qOverP(stepping)) * direction(stepping).cross(bStart).norm();
+    if (0.5 * curvature * h * h > m_helixMaxSagitta) {
+      h *= 0.5;
+    }
+  }
+
+  const double mass = particleHypothesis(stepping).mass();
+  const double absMomentum = absoluteMomentum(stepping);
+
+  FreeVector pars = stepping.pars;
+  FreeMatrix D;
+  Vector3 dTds;
+  detail::helixStep(pars, bStart, h, mass, absMomentum,
+                    stepping.covTransport ? &D : nullptr, &dTds);
+
+  if (!m_constantField) {
+    // the helix is only exact if the field does not change along the step
+    auto endFieldRes = getField(stepping, pars.template segment<3>(eFreePos0));
+    if (!endFieldRes.ok() ||
+        (*endFieldRes - bStart).norm() >
+            m_helixFieldTolerance *
+                std::max(bStart.norm(), endFieldRes->norm())) {
+      return std::nullopt;
+    }
+  }
+
+  if (stepping.covTransport) {
+    // Same blocked update as for the Runge-Kutta step, the left blocks of D
+    // are identity and zero
+    stepping.jacTransport.template topRightCorner<4, 4>() +=
+        D.topRightCorner<4, 4>() *
+        stepping.jacTransport.template bottomRightCorner<4, 4>();
+    stepping.jacTransport.template bottomRightCorner<4, 4>() =
+        (D.bottomRightCorner<4, 4>() *
+         stepping.jacTransport.template bottomRightCorner<4, 4>())
+            .eval();
+
+    stepping.derivative.template head<3>() =
+        pars.template segment<3>(eFreeDir0);
+    stepping.derivative(3) =
+        std::sqrt(1 + mass * mass / (absMomentum * absMomentum));
+    stepping.derivative.template segment<3>(4) = dTds;
+  }
+
+  stepping.pars = pars;
+  stepping.pathAccumulated += h;
+  ++stepping.nSteps;
+  ++stepping.nStepTrials;
+
+  return Result<double>::success(h);
+}
+
 template <typename E, typename A>
 void Acts::EigenStepper<E, A>::setIdentityJacobian(State& state) const {
   state.jacobian = BoundMatrix::Identity();
@@ -208,6 +208,7 @@ struct MaxMomentumReducerLoop {
 /// * There are certain redundancies between the global State and the component
 /// states
 /// * The components do not share a single magnetic-field-cache
+/// * The components are stepped one after the other, not in SIMD lanes
 /// @tparam extensionlist_t See EigenStepper for details
 /// @tparam component_reducer_t How to map the multi-component state to a single
 /// component
@@ -263,6 +264,21 @@ class MultiEigenStepperLoop
       : EigenStepper<extensionlist_t, auctioneer_t>(std::move(bField)),
         m_logger(std::move(logger)) {}
 
+  /// Constructor enabling the analytic helix step of the components
+  ///
+  /// @param bField The magnetic field provider
+  /// @param helixFieldTolerance Relative field change along a step up to
+  ///        which each component is transported on an analytic helix, see
+  ///        EigenStepper
+  /// @param logger The logger
+  MultiEigenStepperLoop(std::shared_ptr<const MagneticFieldProvider> bField,
+                        double helixFieldTolerance,
+                        std::unique_ptr<const Logger> logger =
+                            getDefaultLogger("GSF", Logging::INFO))
+      : EigenStepper<extensionlist_t, auctioneer_t>(
+            std::move(bField), 100 * UnitConstants::um, helixFieldTolerance),
+        m_logger(std::move(logger)) {}
+
   struct State {
     /// The struct that stores the individual components
     struct Component {
@@ -0,0 +1,111 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Opt-in counters of the navigation work per volume and layer.
+///
+/// The Navigator and the DetectorNavigator fill the counters if a profiler
+/// is set in their configuration. The counters are kept per thread, such
+/// that the navigation does not need to synchronize, and are summed over
+/// the threads on request.
+///
+/// The counters are attributed to the layer the navigation is in, or to the
+/// volume if there is no current layer. The volume summary sums the layers
+/// of each volume.
+///
+/// @note The summaries must only be requested when no propagation using the
+///       profiler is running, e.g. at the end of the job.
+class NavigationProfiler {
+ public:
+  struct Counters {
+    /// Number of navigator calls
+    std::size_t calls = 0;
+    /// Number of surface, layer and boundary candidates found
+    std::size_t candidates = 0;
+    /// Number of surface status updates, i.e. intersections with candidates
+    std::size_t intersections = 0;
+    /// Number of times the boundaries had to be searched again
+    std::size_t retargets = 0;
+    /// Wall time spent in the navigator calls
+    std::chrono::nanoseconds time{0};
+
+    Counters& operator+=(const Counters& other);
+  };
+
+  using CounterMap = std::map<GeometryIdentifier, Counters>;
+
+  /// @brief Accumulates the wall time of a navigator call.
+  class ScopedTimer {
+   public:
+    explicit ScopedTimer(Counters* counters)
+        : m_counters(counters),
+          m_start(counters != nullptr
+                    ? std::chrono::steady_clock::now()
+                    : std::chrono::steady_clock::time_point{}) {
+      if (m_counters != nullptr) {
+        ++m_counters->calls;
+      }
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    ~ScopedTimer() {
+      if (m_counters != nullptr) {
+        m_counters->time += std::chrono::steady_clock::now() - m_start;
+      }
+    }
+
+   private:
+    Counters* m_counters;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+  NavigationProfiler();
+  NavigationProfiler(const NavigationProfiler&) = delete;
+  NavigationProfiler& operator=(const NavigationProfiler&) = delete;
+  ~NavigationProfiler();
+
+  /// The counters of the calling thread for a volume or layer
+  ///
+  /// @param geoId The geometry identifier of the volume or layer
+  ///
+  /// @note The reference stays valid for the lifetime of the profiler.
+  Counters& counters(GeometryIdentifier geoId);
+
+  /// The counters per volume and layer, summed over all threads
+  CounterMap summary() const;
+
+  /// The counters per volume including their layers, summed over all threads
+  CounterMap volumeSummary() const;
+
+  /// Reset all counters to zero
+  void clear();
+
+ private:
+  /// The counters of the calling thread
+  CounterMap& threadCounters();
+
+  /// Unique identifier to find the thread buffers of this profiler
+  std::size_t m_id;
+
+  mutable std::mutex m_mutex;
+  std::vector<std::unique_ptr<CounterMap>> m_threadCounters;
+};
+
+}  // namespace Acts
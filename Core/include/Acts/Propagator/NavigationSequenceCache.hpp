@@ -0,0 +1,188 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Cache of the surface sequences found by the navigation.
+///
+/// Refits and the branches of a combinatorial Kalman filter navigate the
+/// same path through the tracking geometry repeatedly. The cache stores the
+/// sensitive and material surfaces found by a full navigation per start
+/// volume, direction and q/p bin. A cached sequence can be given to the
+/// DirectNavigator, which only verifies the surfaces instead of resolving
+/// layers and boundaries again.
+///
+/// @note The sequence of the first track in a bin is kept. Tracks in the same
+///       bin may cross a different set of surfaces close to module edges, so
+///       the bin widths need to be small compared to the module sizes.
+/// @note The cache is not thread-safe, it is meant to be owned by a single
+///       thread or algorithm instance.
+class NavigationSequenceCache {
+ public:
+  using SurfaceSequence = std::vector<const Surface*>;
+
+  struct Config {
+    /// Width of the azimuthal direction bins
+    double phiBinWidth = 0.001;
+    /// Width of the pseudorapidity bins
+    double etaBinWidth = 0.001;
+    /// Width of the q/p bins
+    double qOverPBinWidth = 0.001 / UnitConstants::GeV;
+  };
+
+  NavigationSequenceCache() = default;
+
+  /// Constructor from configuration
+  /// @param cfg The configuration
+  explicit NavigationSequenceCache(const Config& cfg) : m_cfg(cfg) {}
+
+  /// Look up the surface sequence for a start volume and track
+  /// @param volumeId The geometry identifier of the start volume
+  /// @param direction The propagation direction at the start
+  /// @param qOverP The charge over momentum at the start
+  /// @return The recorded sequence or nullptr if there is none
+  const SurfaceSequence* find(GeometryIdentifier volumeId,
+                              const Vector3& direction, double qOverP) const {
+    auto it = m_sequences.find(key(volumeId, direction, qOverP));
+    if (it == m_sequences.end()) {
+      return nullptr;
+    }
+    return &it->second;
+  }
+
+  /// Record the surface sequence of a track, a sequence already recorded for
+  /// the same bin is kept
+  /// @param volumeId The geometry identifier of the start volume
+  /// @param direction The propagation direction at the start
+  /// @param qOverP The charge over momentum at the start
+  /// @param sequence The surfaces in the order they were reached
+  void record(GeometryIdentifier volumeId, const Vector3& direction,
+              double qOverP, SurfaceSequence sequence) {
+    m_sequences.try_emplace(key(volumeId, direction, qOverP),
+                            std::move(sequence));
+  }
+
+  /// Number of recorded sequences
+  std::size_t size() const { return m_sequences.size(); }
+
+  /// Remove all recorded sequences
+  void clear() { m_sequences.clear(); }
+
+ private:
+  using Key = std::tuple<GeometryIdentifier::Value, int, int, int>;
+
+  Key key(GeometryIdentifier volumeId, const Vector3& direction,
+          double qOverP) const {
+    auto bin = [](double value, double width) {
+      return static_cast<int>(std::floor(value / width));
+    };
+    return {volumeId.value(),
+            bin(VectorHelpers::phi(direction), m_cfg.phiBinWidth),
+            bin(VectorHelpers::eta(direction), m_cfg.etaBinWidth),
+            bin(qOverP, m_cfg.qOverPBinWidth)};
+  }
+
+  Config m_cfg;
+  std::map<Key, SurfaceSequence> m_sequences;
+};
+
+/// @brief Actor recording the navigated surfaces in a NavigationSequenceCache.
+///
+/// The sensitive and material surfaces reported by the navigator are
+/// collected during the propagation and stored in the cache at the end,
+/// keyed by the start volume and the start parameters. Without a cache the
+/// actor does nothing.
+struct NavigationSequenceRecorder {
+  /// The cache to update, opt-in
+  NavigationSequenceCache* cache = nullptr;
+
+  struct this_result {
+    /// The volume the propagation started in
+    const TrackingVolume* startVolume = nullptr;
+    /// The propagation direction at the start
+    Vector3 startDirection = Vector3::Zero();
+    /// The charge over momentum at the start
+    double startQOverP = 0;
+    /// The surfaces reached so far
+    NavigationSequenceCache::SurfaceSequence surfaces;
+  };
+
+  using result_type = this_result;
+
+  /// Actor call for the ActionList of the Propagator
+  ///
+  /// @tparam propagator_state_t is the type of Propagator state
+  /// @tparam stepper_t Type of the stepper used for the propagation
+  /// @tparam navigator_t Type of the navigator used for the propagation
+  ///
+  /// @param [in,out] state is the mutable propagator state object
+  /// @param [in] stepper The stepper in use
+  /// @param [in] navigator The navigator in use
+  /// @param [in,out] result is the mutable result object
+  /// @param logger the logger object
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t>
+  void operator()(propagator_state_t& state, const stepper_t& stepper,
+                  const navigator_t& navigator, result_type& result,
+                  const Logger& logger) const {
+    if (cache == nullptr) {
+      return;
+    }
+
+    if (state.stage == PropagatorStage::prePropagation) {
+      result.startVolume = navigator.currentVolume(state.navigation);
+      result.startDirection =
+          state.options.direction * stepper.direction(state.stepping);
+      result.startQOverP = stepper.qOverP(state.stepping);
+      return;
+    }
+
+    if (state.stage == PropagatorStage::postPropagation) {
+      if (result.startVolume != nullptr && !result.surfaces.empty()) {
+        ACTS_VERBOSE("Record a sequence of " << result.surfaces.size()
+                                             << " surfaces");
+        cache->record(result.startVolume->geometryId(), result.startDirection,
+                      result.startQOverP, result.surfaces);
+      }
+      return;
+    }
+
+    const Surface* surface = navigator.currentSurface(state.navigation);
+    if (surface == nullptr) {
+      return;
+    }
+    // only surfaces the direct navigation has to stop at
+    if (surface->associatedDetectorElement() == nullptr &&
+        surface->surfaceMaterial() == nullptr) {
+      return;
+    }
+    if (result.surfaces.empty() || result.surfaces.back() != surface) {
+      result.surfaces.push_back(surface);
+    }
+  }
+};
+
+}  // namespace Acts
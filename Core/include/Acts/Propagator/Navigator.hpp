@@ -14,6 +14,7 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/NavigationProfiler.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/StringHelpers.hpp"
@@ -109,6 +110,9 @@ class Navigator {
     bool resolveMaterial = true;
     /// stop at every surface regardless what it is
     bool resolvePassive = false;
+
+    /// Collect navigation counters per volume and layer, opt-in
+    std::shared_ptr<NavigationProfiler> profiler = nullptr;
   };
 
   /// @brief Nested State struct
@@ -176,6 +180,11 @@ class Navigator {
     Stage navigationStage = Stage::undefined;
     /// Force intersection with boundaries
     bool forceIntersectBoundaries = false;
+
+    /// Profiling: the volume or layer the counters are attributed to
+    GeometryIdentifier profileId;
+    /// Profiling: the counters of that volume or layer
+    NavigationProfiler::Counters* profileCounters = nullptr;
   };
 
   /// Constructor with configuration object
@@ -342,6 +351,8 @@ class Navigator {
       return;
     }
 
+    NavigationProfiler::ScopedTimer profileTimer(profile(state.navigation));
+
     // Call the navigation helper prior to actual navigation
     ACTS_VERBOSE(volInfo(state) << "Entering navigator::preStep.");
 
@@ -398,6 +409,8 @@ class Navigator {
       return;
     }
 
+    NavigationProfiler::ScopedTimer profileTimer(profile(state.navigation));
+
     // Set the navigation stage
     state.navigation.navigationStage = Stage::undefined;
 
@@ -558,6 +571,9 @@ class Navigator {
     // Check if we are at a surface
     // If we are on the surface pointed at by the index, we can make
     // it the current one to pass it to the other actors
+    if (auto* counters = profile(state.navigation)) {
+      ++counters->intersections;
+    }
     auto surfaceStatus = stepper.updateSurfaceStatus(
         state.stepping, *surface, intersection.index(), state.options.direction,
         BoundaryCheck(true), state.options.surfaceTolerance, logger());
@@ -649,6 +665,9 @@ class Navigator {
           break;
         }
       }
+      if (auto* counters = profile(state.navigation)) {
+        ++counters->intersections;
+      }
       auto surfaceStatus = stepper.updateSurfaceStatus(
           state.stepping, *surface, intersection.index(),
           state.options.direction, BoundaryCheck(boundaryCheck),
@@ -744,6 +763,9 @@ class Navigator {
         }
       }
       // Try to step towards it
+      if (auto* counters = profile(state.navigation)) {
+        ++counters->intersections;
+      }
       auto layerStatus = stepper.updateSurfaceStatus(
           state.stepping, *layerSurface, intersection.index(),
           state.options.direction, BoundaryCheck(true),
@@ -859,6 +881,9 @@ class Navigator {
                 [](const auto& a, const auto& b) {
                   return SurfaceIntersection::pathLengthOrder(a.first, b.first);
                 });
+      if (auto* counters = profile(state.navigation)) {
+        counters->candidates += state.navigation.navBoundaries.size();
+      }
 
       // Print boundary information
       if (logger().doPrint(Logging::VERBOSE)) {
@@ -897,6 +922,9 @@ class Navigator {
       // That is the current boundary surface
       const auto* boundarySurface = intersection.object();
       // Step towards the boundary surfrace
+      if (auto* counters = profile(state.navigation)) {
+        ++counters->intersections;
+      }
       auto boundaryStatus = stepper.updateSurfaceStatus(
           state.stepping, *boundarySurface, intersection.index(),
           state.options.direction, BoundaryCheck(true),
@@ -921,6 +949,9 @@ class Navigator {
     // We have to leave the volume somehow, so try again
     state.navigation.navBoundaries.clear();
     ACTS_VERBOSE(volInfo(state) << "Boundary navigation lost, re-targetting.");
+    if (auto* counters = profile(state.navigation)) {
+      ++counters->retargets;
+    }
     state.navigation.forceIntersectBoundaries = true;
     if (findBoundaries()) {
       // Resetting intersection check for boundary surfaces
@@ -1058,6 +1089,9 @@ class Navigator {
     std::sort(state.navigation.navSurfaces.begin(),
               state.navigation.navSurfaces.end(),
               SurfaceIntersection::pathLengthOrder);
+    if (auto* counters = profile(state.navigation)) {
+      counters->candidates += state.navigation.navSurfaces.size();
+    }
 
     // Print surface information
     if (logger().doPrint(Logging::VERBOSE)) {
@@ -1128,6 +1162,9 @@ class Navigator {
               [](const auto& a, const auto& b) {
                 return SurfaceIntersection::pathLengthOrder(a.first, b.first);
               });
+    if (auto* counters = profile(state.navigation)) {
+      counters->candidates += state.navigation.navLayers.size();
+    }
 
     // Print layer information
     if (logger().doPrint(Logging::VERBOSE)) {
@@ -1227,6 +1264,27 @@ class Navigator {
            " | ";
   }
 
+  /// The profiling counters of the current layer or volume
+  ///
+  /// @param [in,out] state is the navigation state caching the counters
+  /// @return nullptr if profiling is disabled
+  NavigationProfiler::Counters* profile(State& state) const {
+    if (m_cfg.profiler == nullptr) {
+      return nullptr;
+    }
+    GeometryIdentifier geoId;
+    if (state.currentLayer != nullptr) {
+      geoId = state.currentLayer->geometryId();
+    } else if (state.currentVolume != nullptr) {
+      geoId = state.currentVolume->geometryId();
+    }
+    if (state.profileCounters == nullptr || geoId != state.profileId) {
+      state.profileId = geoId;
+      state.profileCounters = &m_cfg.profiler->counters(geoId);
+    }
+    return state.profileCounters;
+  }
+
   const Logger& logger() const { return *m_logger; }
 
   Config m_cfg;
@@ -495,6 +495,39 @@ class Propagator final
   auto makeState(const parameters_t& start, const Surface& target,
                  const propagator_options_t& options) const;
 
+  /// @brief Reset a propagator state for the propagation of new parameters
+  ///
+  /// Reinitializes a state created by makeState, keeping its options, so that
+  /// many tracks can be propagated with the same state object. Actor results
+  /// providing a `reset()` method, like the ones of the SteppingLogger and
+  /// the MaterialInteractor, keep their allocated memory. After the
+  /// propagation the actor results can be read directly from the state, e.g.
+  /// with `state.template get<result_type>()`, to retain it for the next call.
+  ///
+  /// @tparam propagator_state_t Type of the propagator state
+  /// @tparam parameters_t Type of initial track parameters to propagate
+  /// @tparam path_aborter_t The path aborter type used by makeState
+  ///
+  /// @param [in,out] state The propagator state to reset
+  /// @param [in] start The new initial track parameters
+  template <typename propagator_state_t, typename parameters_t,
+            typename path_aborter_t = PathLimitReached>
+  void resetState(propagator_state_t& state, const parameters_t& start) const;
+
+  /// @brief Reset a propagator state for the propagation of new parameters
+  /// to a target surface
+  ///
+  /// @copydetails resetState(propagator_state_t&,const parameters_t&) const
+  ///
+  /// @tparam target_aborter_t The target aborter type used by makeState
+  ///
+  /// @param [in] target The new target surface
+  template <typename propagator_state_t, typename parameters_t,
+            typename target_aborter_t = SurfaceReached,
+            typename path_aborter_t = PathLimitReached>
+  void resetState(propagator_state_t& state, const parameters_t& start,
+                  const Surface& target) const;
+
   template <typename propagator_state_t, typename propagator_options_t>
   Result<
       action_list_t_result_t<StepperCurvilinearTrackParameters,
@@ -12,6 +12,8 @@
 #include "Acts/Propagator/PropagatorError.hpp"
 #include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Propagator/detail/LoopProtection.hpp"
+#include "Acts/Propagator/detail/ResultReset.hpp"
+#include "Acts/Utilities/TraceSpans.hpp"
 
 #include <type_traits>
 
@@ -19,6 +21,8 @@ template <typename S, typename N>
 template <typename propagator_state_t>
 auto Acts::Propagator<S, N>::propagate(propagator_state_t& state) const
     -> Result<void> {
+  ACTS_TRACE_SPAN("Propagator::propagate");
+
   // Pre-stepping call to the navigator and action list
   ACTS_VERBOSE("Entering propagation.");
 
@@ -230,6 +234,40 @@ auto Acts::Propagator<S, N>::makeState(
   return state;
 }
 
+template <typename S, typename N>
+template <typename propagator_state_t, typename parameters_t,
+          typename path_aborter_t>
+void Acts::Propagator<S, N>::resetState(propagator_state_t& state,
+                                        const parameters_t& start) const {
+  static_assert(Concepts::BoundTrackParametersConcept<parameters_t>,
+                "Parameters do not fulfill bound parameters concept.");
+
+  state.stage = PropagatorStage::invalid;
+  state.steps = 0;
+  state.pathLength = 0.;
+  state.stepping = m_stepper.makeState(state.options.geoContext,
+                                       state.options.magFieldContext, start,
+                                       state.options.maxStepSize);
+  state.navigation = m_navigator.makeState(&start.referenceSurface(), nullptr);
+  detail::resetResults(state.tuple());
+
+  // Apply the loop protection - it resets the internal path limit
+  auto& pathAborter = state.options.abortList.template get<path_aborter_t>();
+  pathAborter.internalLimit = state.options.pathLimit;
+  detail::setupLoopProtection(state, m_stepper, pathAborter, false, logger());
+}
+
+template <typename S, typename N>
+template <typename propagator_state_t, typename parameters_t,
+          typename target_aborter_t, typename path_aborter_t>
+void Acts::Propagator<S, N>::resetState(propagator_state_t& state,
+                                        const parameters_t& start,
+                                        const Surface& target) const {
+  resetState<propagator_state_t, parameters_t, path_aborter_t>(state, start);
+  state.navigation = m_navigator.makeState(&start.referenceSurface(), &target);
+  state.options.abortList.template get<target_aborter_t>().surface = &target;
+}
+
 template <typename S, typename N>
 template <typename propagator_state_t, typename propagator_options_t>
 auto Acts::Propagator<S, N>::makeResult(propagator_state_t state,
@@ -7,6 +7,10 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <cstddef>
+#include <optional>
 
 template <typename propagator_t>
 template <typename parameters_t, typename propagator_options_t>
@@ -125,12 +129,15 @@ auto Acts::RiddersPropagator<propagator_t>::wiggleAndCalculateJacobian(
   // Derivations of each parameter around the nominal parameters
   std::array<std::vector<BoundVector>, eBoundSize> derivatives;
 
-  // Wiggle each dimension individually
-  for (unsigned int i = 0; i < eBoundSize; i++) {
-    derivatives[i] =
-        wiggleParameter(opts, start, i, target,
-                        nominalFinalParameters.parameters(), *deviations);
-  }
+  // Wiggle each dimension individually. The deviated propagations are
+  // independent calls of the const propagator and are distributed within the
+  // thread budget, each dimension writes its own derivatives.
+  Acts::parallelFor(eBoundSize, [&](std::size_t i) {
+    derivatives[i] = wiggleParameter(opts, start, static_cast<unsigned int>(i),
+                                     target,
+                                     nominalFinalParameters.parameters(),
+                                     *deviations);
+  });
 
   // Test if target is disc - this may lead to inconsistent results
   if (target.type() == Surface::Disc) {
@@ -192,9 +199,10 @@ Acts::RiddersPropagator<propagator_t>::wiggleParameter(
     BoundVector values = start.parameters();
     values[param] += h;
 
-    // Propagate with updated start parameters
+    // Propagate with updated start parameters, only the end parameters are
+    // used so the jacobian transport is skipped as for the nominal propagation
     BoundTrackParameters tp(start.referenceSurface().getSharedPtr(), values,
-                            start.covariance(), start.particleHypothesis());
+                            std::nullopt, start.particleHypothesis());
     const auto& r = m_propagator.propagate(tp, target, options).value();
     // Collect the slope
     derivatives.push_back((r.endParameters->parameters() - nominal) / h);
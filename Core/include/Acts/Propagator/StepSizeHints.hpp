@@ -0,0 +1,159 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <optional>
+#include <utility>
+
+namespace Acts {
+
+/// @brief Cache of the adaptive step sizes reached in previous propagations.
+///
+/// The Runge-Kutta steppers adapt the accuracy of the step size during the
+/// propagation, starting from the user or navigation step size. Propagating
+/// similar trajectories through the same volumes repeatedly (e.g. in the
+/// branches of a combinatorial Kalman filter or in a refit) repeats this
+/// adaptation each time. The cache stores the accuracy reached per volume and
+/// momentum bin, so that it can be used as starting value the next time.
+///
+/// @note The cache is not thread-safe, it is meant to be owned by a single
+/// thread or algorithm instance.
+class StepSizeHintCache {
+ public:
+  struct Config {
+    /// Width of the momentum bins in log10(p / GeV)
+    double momentumBinWidth = 0.1;
+  };
+
+  StepSizeHintCache() = default;
+
+  /// Constructor from configuration
+  /// @param cfg The configuration
+  explicit StepSizeHintCache(const Config& cfg) : m_cfg(cfg) {}
+
+  /// Look up the step size hint for a volume and momentum
+  /// @param volumeId The geometry identifier of the volume
+  /// @param absMomentum The absolute momentum of the track
+  /// @return The recorded step size accuracy, if any
+  std::optional<double> hint(GeometryIdentifier volumeId,
+                             double absMomentum) const {
+    auto it = m_hints.find(key(volumeId, absMomentum));
+    if (it == m_hints.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  /// Record the step size accuracy reached in a volume, replacing any
+  /// previous value for the same volume and momentum bin
+  /// @param volumeId The geometry identifier of the volume
+  /// @param absMomentum The absolute momentum of the track
+  /// @param accuracy The step size accuracy, has to be positive
+  void record(GeometryIdentifier volumeId, double absMomentum,
+              double accuracy) {
+    m_hints[key(volumeId, absMomentum)] = accuracy;
+  }
+
+  /// Number of recorded hints
+  std::size_t size() const { return m_hints.size(); }
+
+  /// Remove all recorded hints
+  void clear() { m_hints.clear(); }
+
+ private:
+  using Key = std::pair<GeometryIdentifier::Value, int>;
+
+  Key key(GeometryIdentifier volumeId, double absMomentum) const {
+    int bin = static_cast<int>(std::floor(
+        std::log10(absMomentum / UnitConstants::GeV) / m_cfg.momentumBinWidth));
+    return {volumeId.value(), bin};
+  }
+
+  Config m_cfg;
+  std::map<Key, double> m_hints;
+};
+
+/// @brief Actor seeding the stepper accuracy from a StepSizeHintCache.
+///
+/// Whenever the navigator enters a new volume, the accuracy reached in the
+/// previous volume is recorded in the cache and the hint for the new volume
+/// is applied, if available. Without a cache the actor does nothing.
+///
+/// @note This requires a stepper state with a ConstrainedStep `stepSize`
+/// member, like the EigenStepper, SympyStepper or AtlasStepper.
+struct StepSizeHintActor {
+  /// The cache to read and update, opt-in
+  StepSizeHintCache* cache = nullptr;
+
+  struct this_result {
+    /// The volume the accuracy is currently recorded for
+    const TrackingVolume* volume = nullptr;
+  };
+
+  using result_type = this_result;
+
+  /// Actor call for the ActionList of the Propagator
+  ///
+  /// @tparam propagator_state_t is the type of Propagator state
+  /// @tparam stepper_t Type of the stepper used for the propagation
+  /// @tparam navigator_t Type of the navigator used for the propagation
+  ///
+  /// @param [in,out] state is the mutable propagator state object
+  /// @param [in] stepper The stepper in use
+  /// @param [in] navigator The navigator in use
+  /// @param [in,out] result is the mutable result object
+  /// @param logger the logger object
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t>
+  void operator()(propagator_state_t& state, const stepper_t& stepper,
+                  const navigator_t& navigator, result_type& result,
+                  const Logger& logger) const {
+    if (cache == nullptr) {
+      return;
+    }
+
+    const TrackingVolume* volume = navigator.currentVolume(state.navigation);
+    const bool finished = state.stage == PropagatorStage::postPropagation;
+    if (volume == result.volume && !finished) {
+      return;
+    }
+
+    auto& stepSize = state.stepping.stepSize;
+    const double absMomentum = stepper.absoluteMomentum(state.stepping);
+    const double accuracy = stepSize.accuracy();
+
+    // the accuracy is not set before the first accepted step
+    if (result.volume != nullptr &&
+        accuracy < std::numeric_limits<double>::max()) {
+      cache->record(result.volume->geometryId(), absMomentum, accuracy);
+    }
+    result.volume = volume;
+
+    if (volume == nullptr || finished) {
+      return;
+    }
+    if (auto hint = cache->hint(volume->geometryId(), absMomentum)) {
+      ACTS_VERBOSE("Seed step size accuracy " << *hint << " in volume "
+                                              << volume->geometryId());
+      stepSize.setAccuracy(*hint);
+    }
+  }
+};
+
+}  // namespace Acts
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/Propagator/ActorTrigger.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
@@ -67,6 +68,9 @@ struct SurfaceCollector {
   /// The selector used for this surface
   Selector selector;
 
+  /// Only surfaces are collected
+  static constexpr ActorTrigger trigger = ActorTrigger::onSurface;
+
   /// Simple result struct to be returned
   /// It has all the SurfaceHit objects that
   /// are collected (and thus have been selected)
@@ -107,6 +107,9 @@ class SympyStepper {
     /// Totoal number of attempted steps
     std::size_t nStepTrials = 0;
 
+    /// Total number of magnetic field lookups
+    std::size_t nFieldLookups = 0;
+
     /// Adaptive step size of the runge-kutta integration
     ConstrainedStep stepSize;
 
@@ -160,6 +163,7 @@ class SympyStepper {
   ///                 the magnetic field cell is used (and potentially updated)
   /// @param [in] pos is the field position
   Result<Vector3> getField(State& state, const Vector3& pos) const {
+    ++state.nFieldLookups;
     // get the field from the cell
     return m_bField->getField(pos, state.fieldCache);
   }
@@ -413,6 +417,10 @@ class SympyStepper {
   /// Overstep limit
   double m_overstepLimit;
 
+  /// Whether the magnetic field is constant, in which case the field is only
+  /// looked up once per step
+  bool m_constantField = false;
+
  private:
   Result<double> stepImpl(State& state, Direction stepDirection,
                           double stepTolerance, double stepSizeCutOff,
@@ -0,0 +1,33 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+
+namespace Acts::detail {
+
+/// @brief Propagate free parameters along a helix in a homogeneous field
+///
+/// In a homogeneous magnetic field the helix is the exact solution of the
+/// equations of motion dr/ds = T and dT/ds = q/p * (T x B), which allows to
+/// take steps of any length without step size control.
+///
+/// @param [in,out] pars The free parameters, updated in place
+/// @param [in] bField The homogeneous magnetic field
+/// @param [in] h The signed path length of the step
+/// @param [in] mass The particle mass
+/// @param [in] absMomentum The absolute momentum
+/// @param [out] D The free transport matrix of the step, if not null
+/// @param [out] dTds The derivative of the direction at the end, if not null
+void helixStep(FreeVector& pars, const Vector3& bField, double h, double mass,
+               double absMomentum, FreeMatrix* D = nullptr,
+               Vector3* dTds = nullptr);
+
+}  // namespace Acts::detail
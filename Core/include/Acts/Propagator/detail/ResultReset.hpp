@@ -0,0 +1,47 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Acts::detail {
+
+template <typename result_t, typename = void>
+struct has_reset : std::false_type {};
+
+template <typename result_t>
+struct has_reset<result_t,
+                 std::void_t<decltype(std::declval<result_t&>().reset())>>
+    : std::true_type {};
+
+/// Reset an actor result to its initial state. Results providing a `reset()`
+/// method can keep their allocated memory, all others are replaced by a
+/// default constructed object.
+///
+/// @param result The actor result to reset
+template <typename result_t>
+void resetResult(result_t& result) {
+  if constexpr (has_reset<result_t>::value) {
+    result.reset();
+  } else {
+    result = result_t{};
+  }
+}
+
+/// Reset all actor results of a tuple
+///
+/// @param results The tuple of actor results
+template <typename... results_t>
+void resetResults(std::tuple<results_t...>& results) {
+  std::apply([](auto&... result) { (resetResult(result), ...); }, results);
+}
+
+}  // namespace Acts::detail
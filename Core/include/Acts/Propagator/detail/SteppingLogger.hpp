@@ -49,6 +49,9 @@ struct SteppingLogger {
   /// Simple result struct to be returned
   struct this_result {
     std::vector<Step> steps;
+
+    /// Clear the recorded steps, keeping the allocated memory
+    void reset() { steps.clear(); }
   };
 
   using result_type = this_result;
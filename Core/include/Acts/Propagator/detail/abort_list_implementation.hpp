@@ -10,6 +10,7 @@
 
 #include "Acts/Utilities/detail/MPL/type_collector.hpp"
 
+#include <tuple>
 #include <utility>
 
 namespace Acts::detail {
@@ -8,12 +8,28 @@
 
 #pragma once
 
+#include "Acts/Propagator/ActorTrigger.hpp"
 #include "Acts/Utilities/detail/MPL/type_collector.hpp"
 
+#include <type_traits>
 #include <utility>
 
 namespace Acts::detail {
 
+/// Extract the trigger of an actor, defaults to ActorTrigger::always
+template <typename actor_t, typename = void>
+struct actor_trigger {
+  static constexpr ActorTrigger value = ActorTrigger::always;
+};
+
+template <typename actor_t>
+struct actor_trigger<actor_t, std::void_t<decltype(actor_t::trigger)>> {
+  static constexpr ActorTrigger value = actor_t::trigger;
+};
+
+template <typename actor_t>
+constexpr ActorTrigger actor_trigger_v = actor_trigger<actor_t>::value;
+
 namespace {
 
 /// The action caller struct, it's called with the the right result object,
@@ -49,21 +65,24 @@ template <typename... actors>
 struct action_list_impl;
 
 /// The action list call implementation
-/// - it calls 'action' on the current entry of the tuple
+/// - it calls 'action' on the current entry of the tuple, unless its trigger
+///   is not met
 /// - then broadcasts the action call to the remaining tuple
 template <typename first, typename... others>
 struct action_list_impl<first, others...> {
   template <typename T, typename propagator_state_t, typename stepper_t,
             typename navigator_t, typename... Args>
-  static void action(const T& actors_tuple, propagator_state_t& state,
-                     const stepper_t& stepper, const navigator_t& navigator,
-                     Args&&... args) {
+  static void action(const T& actors_tuple, bool onSurface,
+                     propagator_state_t& state, const stepper_t& stepper,
+                     const navigator_t& navigator, Args&&... args) {
     constexpr bool has_result = has_result_type_v<first>;
     const auto& this_actor = std::get<first>(actors_tuple);
-    action_caller<has_result>::action(this_actor, state, stepper, navigator,
-                                      args...);
-    action_list_impl<others...>::action(actors_tuple, state, stepper, navigator,
+    if (actor_trigger_v<first> != ActorTrigger::onSurface || onSurface) {
+      action_caller<has_result>::action(this_actor, state, stepper, navigator,
                                         args...);
+    }
+    action_list_impl<others...>::action(actors_tuple, onSurface, state, stepper,
+                                        navigator, args...);
   }
 };
 
@@ -73,13 +92,15 @@ template <typename last>
 struct action_list_impl<last> {
   template <typename T, typename propagator_state_t, typename stepper_t,
             typename navigator_t, typename... Args>
-  static void action(const T& actors_tuple, propagator_state_t& state,
-                     const stepper_t& stepper, const navigator_t& navigator,
-                     Args&&... args) {
+  static void action(const T& actors_tuple, bool onSurface,
+                     propagator_state_t& state, const stepper_t& stepper,
+                     const navigator_t& navigator, Args&&... args) {
     constexpr bool has_result = has_result_type_v<last>;
     const auto& this_actor = std::get<last>(actors_tuple);
-    action_caller<has_result>::action(this_actor, state, stepper, navigator,
-                                      std::forward<Args>(args)...);
+    if (actor_trigger_v<last> != ActorTrigger::onSurface || onSurface) {
+      action_caller<has_result>::action(this_actor, state, stepper, navigator,
+                                        std::forward<Args>(args)...);
+    }
   }
 };
 
@@ -88,7 +109,8 @@ template <>
 struct action_list_impl<> {
   template <typename T, typename propagator_state_t, typename stepper_t,
             typename navigator_t, typename... Args>
-  static void action(const T& /*actors_tuple*/, propagator_state_t& /*state*/,
+  static void action(const T& /*actors_tuple*/, bool /*onSurface*/,
+                     propagator_state_t& /*state*/,
                      const stepper_t& /*stepper*/,
                      const navigator_t& /*navigator*/, Args&&... /*args*/) {}
 };
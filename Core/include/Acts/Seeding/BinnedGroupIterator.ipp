@@ -57,7 +57,8 @@ Acts::BinnedGroupIterator<grid_t>::operator*() const {
   std::size_t global_index =
       m_group->grid().globalBinFromLocalBins(localPosition);
 
-  /// Get the neighbouring bins
+  /// Get the neighbouring bins, copied from the bin table if the finders
+  /// have precomputed one for this grid
   boost::container::small_vector<std::size_t, Acts::detail::ipow(3, DIM)>
       bottoms =
           m_group->m_bottomBinFinder->findBins(localPosition, m_group->grid());
@@ -79,6 +79,13 @@ class CandidatesForMiddleSp {
   /// @returns Vector of triplet candidates
   std::vector<value_type> storage();
 
+  /// @brief Retrieve the triplet candidates into a buffer owned by the collection,
+  /// elements with higher quality first. The buffer keeps its capacity
+  /// between calls, so no memory is allocated once it has reached the maximum
+  /// number of candidates. The content is only valid until the next call.
+  /// @returns Reference to the sorted triplet candidates
+  std::vector<value_type>& sortedStorage();
+
   /// @brief Adding a new triplet candidate to the collection, should it satisfy the
   /// selection criteria
   /// @param SpB Bottom space point
@@ -173,6 +180,11 @@ class CandidatesForMiddleSp {
   void addToCollection(std::vector<std::size_t>& indices, std::size_t& n,
                        const std::size_t n_max, value_type&& element);
 
+  /// @brief Move all the stored candidates into a collection, sorted from high to low
+  /// quality, and clear the internal storage
+  /// @param output The collection to fill, its previous content is discarded
+  void retrieve(std::vector<value_type>& output);
+
  private:
   // sizes
   // m_max_size_* is the maximum size of the indices collections. These values
@@ -200,6 +212,10 @@ class CandidatesForMiddleSp {
   std::vector<std::size_t> m_indices_high{};
   // list of indexes of candidates with low quality in the storage
   std::vector<std::size_t> m_indices_low{};
+
+  // sorted copy of the candidates handed out by sortedStorage(); kept as a
+  // member so that its memory is reused for every middle space point
+  std::vector<value_type> m_sorted{};
 };
 
 }  // namespace Acts
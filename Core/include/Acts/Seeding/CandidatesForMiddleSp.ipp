@@ -25,6 +25,7 @@ inline void CandidatesForMiddleSp<external_space_point_t>::setMaxElements(
   m_storage.reserve(n_low + n_high);
   m_indices_high.reserve(n_high);
   m_indices_low.reserve(n_low);
+  m_sorted.reserve(n_low + n_high);
 }
 
 template <typename external_space_point_t>
@@ -213,7 +214,24 @@ std::vector<typename CandidatesForMiddleSp<external_space_point_t>::value_type>
 CandidatesForMiddleSp<external_space_point_t>::storage() {
   // this will retrieve the entire storage
   // the resulting vector is already sorted from high to low quality
-  std::vector<value_type> output(m_n_high + m_n_low);
+  std::vector<value_type> output;
+  retrieve(output);
+  return output;
+}
+
+template <typename external_space_point_t>
+std::vector<typename CandidatesForMiddleSp<external_space_point_t>::value_type>&
+CandidatesForMiddleSp<external_space_point_t>::sortedStorage() {
+  retrieve(m_sorted);
+  return m_sorted;
+}
+
+template <typename external_space_point_t>
+void CandidatesForMiddleSp<external_space_point_t>::retrieve(
+    std::vector<value_type>& output) {
+  // resizing does not release memory, so a reused output collection stops
+  // allocating once it has reached the maximum number of candidates
+  output.resize(m_n_high + m_n_low);
   std::size_t out_idx = output.size() - 1;
 
   // rely on the fact that m_indices_* are both min heap trees
@@ -253,7 +271,6 @@ CandidatesForMiddleSp<external_space_point_t>::storage() {
   }  // while loop
 
   clear();
-  return output;
 }
 
 template <typename external_space_point_t>
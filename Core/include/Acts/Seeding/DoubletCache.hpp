@@ -0,0 +1,152 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/SeedFinderUtils.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Acts {
+
+/// @brief The cuts applied by the seed finder when building doublets.
+///
+/// Used to decide whether the doublets found with one set of cuts are a
+/// superset of the doublets that would be found with another one.
+struct DoubletCuts {
+  float deltaRMin = 0;
+  float deltaRMax = 0;
+  float collisionRegionMin = 0;
+  float collisionRegionMax = 0;
+  float cotThetaMax = 0;
+  float deltaZMax = 0;
+  float impactMax = 0;
+  float minHelixDiameter2 = 0;
+  bool interactionPointCut = false;
+
+  /// Check if every doublet passing @p other also passes these cuts.
+  ///
+  /// The impact parameter enters the curvature cut in a non-monotonic way,
+  /// so it has to be identical if the interaction point cut is applied. The
+  /// experiment specific cuts are assumed to be identical.
+  ///
+  /// @param other The cuts to compare to
+  bool contains(const DoubletCuts& other) const {
+    if (deltaRMin > other.deltaRMin || deltaRMax < other.deltaRMax ||
+        collisionRegionMin > other.collisionRegionMin ||
+        collisionRegionMax < other.collisionRegionMax ||
+        cotThetaMax < other.cotThetaMax) {
+      return false;
+    }
+    if (interactionPointCut) {
+      // the deltaZ cut is not applied together with the interaction point cut
+      return other.interactionPointCut && impactMax == other.impactMax &&
+             minHelixDiameter2 <= other.minHelixDiameter2;
+    }
+    if (other.interactionPointCut) {
+      return std::isinf(deltaZMax);
+    }
+    return deltaZMax >= other.deltaZMax;
+  }
+};
+
+/// @brief Cache of the compatible doublets of each middle space point.
+///
+/// Allows several seed finding passes over the same grid with different cuts
+/// to reuse the result of the doublet search. If the cached doublets of a
+/// middle space point were found with cuts at least as loose as the current
+/// ones, the current cuts are applied to the cached doublets instead of
+/// scanning the grid again. Running the loosest pass first therefore gives the
+/// best reuse.
+///
+/// @note The cache is keyed by the internal space point index and is only
+/// valid for a single grid. All passes must use the same grid and bin finders.
+///
+/// @tparam external_spacepoint_t The external space point type
+template <typename external_spacepoint_t>
+class DoubletCache {
+ public:
+  /// A cached doublet with the quantities needed to reapply the cuts
+  struct Doublet {
+    InternalSpacePoint<external_spacepoint_t>* sp = nullptr;
+    LinCircle linCircle;
+    /// radial distance to the middle space point, positive
+    float deltaR = 0;
+    /// longitudinal distance to the middle space point, signed outwards
+    float deltaZ = 0;
+    /// 3D distance to the middle space point
+    float distance = 0;
+  };
+
+  /// The cached doublets of a middle space point
+  struct Entry {
+    bool valid = false;
+    DoubletCuts cuts;
+    std::vector<Doublet> doublets;
+  };
+
+  /// Enable the cache and invalidate all entries
+  /// @param nSpacePoints The number of internal space points in the grid
+  void reset(std::size_t nSpacePoints) {
+    m_enabled = true;
+    for (auto* entries : {&m_bottom, &m_top}) {
+      entries->resize(nSpacePoints);
+      for (Entry& entry : *entries) {
+        entry.valid = false;
+        entry.doublets.clear();
+      }
+    }
+  }
+
+  /// Disable the cache and release its memory
+  void clear() {
+    m_enabled = false;
+    m_bottom.clear();
+    m_top.clear();
+  }
+
+  /// Whether the cache is used by the seed finder
+  bool isEnabled() const { return m_enabled; }
+
+  /// Access the bottom or top entry of a middle space point
+  /// @param index The internal space point index of the middle space point
+  /// @param bottom Whether to access the bottom or top doublets
+  /// @return The entry or nullptr if the index is not covered by the cache
+  Entry* entry(std::size_t index, bool bottom) {
+    auto& entries = bottom ? m_bottom : m_top;
+    return index < entries.size() ? &entries[index] : nullptr;
+  }
+
+  /// Find a valid entry computed with cuts containing @p cuts
+  /// @param index The internal space point index of the middle space point
+  /// @param bottom Whether to access the bottom or top doublets
+  /// @param cuts The cuts that will be applied
+  /// @return The entry or nullptr if it can not be used
+  const Entry* find(std::size_t index, bool bottom,
+                    const DoubletCuts& cuts) const {
+    const auto& entries = bottom ? m_bottom : m_top;
+    if (index >= entries.size()) {
+      return nullptr;
+    }
+    const Entry& e = entries[index];
+    if (!e.valid || !e.cuts.contains(cuts)) {
+      return nullptr;
+    }
+    return &e;
+  }
+
+ private:
+  bool m_enabled = false;
+  std::vector<Entry> m_bottom;
+  std::vector<Entry> m_top;
+};
+
+}  // namespace Acts
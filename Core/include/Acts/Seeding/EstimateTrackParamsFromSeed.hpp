@@ -11,15 +11,22 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/Seeding/Seed.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <iostream>
 #include <iterator>
+#include <numeric>
 #include <optional>
+#include <system_error>
 #include <vector>
 
 namespace Acts {
@@ -212,8 +219,9 @@ std::optional<BoundVector> estimateTrackParamsFromSeed(
   Transform3 transform(trans * rotation);
 
   // The coordinate of the middle and top space point in the new frame
-  Vector3 local1 = transform.inverse() * spGlobalPositions[1];
-  Vector3 local2 = transform.inverse() * spGlobalPositions[2];
+  Transform3 inverseTransform = transform.inverse();
+  Vector3 local1 = inverseTransform * spGlobalPositions[1];
+  Vector3 local2 = inverseTransform * spGlobalPositions[2];
 
   // In the new frame the bottom sp is at the origin, while the middle
   // sp in along the x axis. As such, the x-coordinate of the circle is
@@ -287,4 +295,111 @@ std::optional<BoundVector> estimateTrackParamsFromSeed(
   return params;
 }
 
+/// Output of @c estimateTrackParamsFromSeeds, with one entry per seed
+///
+/// The buffers are resized for every batch but never shrunk. Reusing the same
+/// object for consecutive batches therefore avoids reallocating them.
+struct SeedTrackParamsBatch {
+  /// The estimated bound parameters, only meaningful if @c valid is set
+  std::vector<BoundVector> params;
+  /// Whether the estimation succeeded for the seed
+  std::vector<bool> valid;
+  /// Order in which the seeds were processed, grouped by bottom surface
+  std::vector<std::size_t> order;
+};
+
+/// Estimate the full track parameters for a batch of seeds
+///
+/// The seeds are processed grouped by the surface and the space point at their
+/// bottom. Consecutive field lookups are then close in space, which lets the
+/// field cache be reused, and the field is looked up only once for all seeds
+/// sharing the same bottom space point. The results are stored in the order
+/// of the input seeds.
+///
+/// @tparam seed_container_t The type of the seed container; the seeds have to
+///         provide the space points (bottom first) through @c sp()
+///
+/// @param gctx is the geometry context
+/// @param seeds are the seeds to estimate the parameters for
+/// @param surfaces are the surfaces of the bottom space points, one per seed.
+/// Seeds with a null surface are skipped.
+/// @param bField is the magnetic field provider
+/// @param bCache is the magnetic field cache
+/// @param bFieldMin is the minimum magnetic field required to trigger the
+/// estimation of q/pt
+/// @param batch is the output, see @c SeedTrackParamsBatch
+/// @param logger A logger instance
+///
+/// @return the error of a failed magnetic field lookup, if any
+template <typename seed_container_t>
+Result<void> estimateTrackParamsFromSeeds(
+    const GeometryContext& gctx, const seed_container_t& seeds,
+    const std::vector<const Surface*>& surfaces,
+    const MagneticFieldProvider& bField, MagneticFieldProvider::Cache& bCache,
+    ActsScalar bFieldMin, SeedTrackParamsBatch& batch,
+    const Logger& logger = getDummyLogger()) {
+  const std::size_t numSeeds = std::size(seeds);
+  if (surfaces.size() != numSeeds) {
+    ACTS_ERROR("There should be exactly one surface per seed.")
+    return Result<void>::failure(
+        std::make_error_code(std::errc::invalid_argument));
+  }
+
+  batch.params.resize(numSeeds);
+  batch.valid.assign(numSeeds, false);
+
+  // Group the seeds by bottom surface and bottom space point
+  auto bottomSP = [&](std::size_t i) {
+    return *std::begin(std::next(std::begin(seeds), i)->sp());
+  };
+  batch.order.resize(numSeeds);
+  std::iota(batch.order.begin(), batch.order.end(), 0);
+  auto firstValid = std::stable_partition(
+      batch.order.begin(), batch.order.end(),
+      [&](std::size_t i) { return surfaces[i] == nullptr; });
+  std::stable_sort(firstValid, batch.order.end(),
+                   [&](std::size_t i, std::size_t j) {
+                     const auto idI = surfaces[i]->geometryId();
+                     const auto idJ = surfaces[j]->geometryId();
+                     if (idI != idJ) {
+                       return idI < idJ;
+                     }
+                     return std::less<>{}(bottomSP(i), bottomSP(j));
+                   });
+
+  decltype(bottomSP(0)) lastBottomSP = nullptr;
+  Vector3 field = Vector3::Zero();
+  for (auto it = firstValid; it != batch.order.end(); ++it) {
+    const std::size_t iseed = *it;
+    const auto& seed = *std::next(std::begin(seeds), iseed);
+    const auto* bottom = bottomSP(iseed);
+    if (bottom == nullptr) {
+      ACTS_ERROR("Empty space point found. This should not happen.")
+      continue;
+    }
+
+    // Get the magnetic field at the bottom space point
+    if (bottom != lastBottomSP) {
+      auto fieldRes =
+          bField.getField({bottom->x(), bottom->y(), bottom->z()}, bCache);
+      if (!fieldRes.ok()) {
+        ACTS_ERROR("Field lookup error: " << fieldRes.error());
+        return Result<void>::failure(fieldRes.error());
+      }
+      field = *fieldRes;
+      lastBottomSP = bottom;
+    }
+
+    auto optParams = estimateTrackParamsFromSeed(
+        gctx, std::begin(seed.sp()), std::end(seed.sp()), *surfaces[iseed],
+        field, bFieldMin, logger);
+    if (optParams.has_value()) {
+      batch.params[iseed] = *optParams;
+      batch.valid[iseed] = true;
+    }
+  }
+
+  return Result<void>::success();
+}
+
 }  // namespace Acts
@@ -11,13 +11,17 @@
 #pragma once
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <map>
 #include <optional>
-#include <set>
+#include <tuple>
 #include <unordered_set>
+#include <vector>
 
 #include "HoughVectors.hpp"
 
@@ -169,6 +173,29 @@ class HoughPlane {
             LineParametrisation<PointType> widthPar,
             const identifier_t& identifier, unsigned layer = 0,
             YieldType weight = 1.0f);
+  /// @brief add several measurements to the hough plane
+  /// The result is the same as calling the single-measurement fill for each
+  /// measurement in order, including the order of the non-empty bins and the
+  /// location of the maxima in case of ties. Ranges of columns of the
+  /// histogram are filled concurrently within the thread budget of
+  /// Acts::maxThreads(), each thread visits all measurements for its columns.
+  /// @tparam PointType: Type of the objects to use when adding measurements (e.g. experiment EDM object)
+  /// @param measurements: The measurements to add
+  /// @param axisRanges: Ranges of the hough axes, used to map the bin numbers to parameter values
+  /// @param linePar: The function y(x) parametrising the hough space line for a given measurement.
+  ///                 Called concurrently if more than one thread is allowed
+  /// @param widthPar: The function dy(x) parametrising the width of the y(x) curve
+  ///                   for a given measurement. Called concurrently as linePar
+  /// @param identifiers: The unique identifier of each measurement
+  /// @param layers: The layer index of each measurement
+  /// @param weight: An optional weight to assign to all hits
+  template <class PointType>
+  void fill(const std::vector<PointType>& measurements,
+            const HoughAxisRanges& axisRanges,
+            LineParametrisation<PointType> linePar,
+            LineParametrisation<PointType> widthPar,
+            const std::vector<identifier_t>& identifiers,
+            const std::vector<unsigned>& layers, YieldType weight = 1.0f);
   /// @brief resets the contents of the grid. Can be used to avoid reallocating the histogram
   /// when switching regions / (sub)detectors
   void reset();
@@ -217,10 +244,12 @@ class HoughPlane {
   /// cell across the entire histrogram.
   YieldType maxHits() const { return m_maxHits; }
 
-  /// @brief get the list of cells with non-zero content.
+  /// @brief get the list of cells with non-zero content, in the order
+  /// in which they were first filled.
   /// Useful for peak-finders in sparse data
   /// to avoid looping over all cells
-  const std::set<std::pair<std::size_t, std::size_t>>& getNonEmptyBins() const {
+  const std::vector<std::pair<std::size_t, std::size_t>>& getNonEmptyBins()
+      const {
     return m_touchedBins;
   }
 
@@ -241,6 +270,20 @@ class HoughPlane {
   }
 
  private:
+  /// @brief Helper method to find the range of y bins covered by a measurement
+  /// in one column of the hough histogram, clipped to the histogram.
+  /// @param measurement: The measurement
+  /// @param axisRanges: Ranges of the hough axes
+  /// @param linePar: The function y(x) parametrising the hough space line
+  /// @param widthPar: The function dy(x) parametrising the width of the line
+  /// @param xBin: bin number along x
+  /// @return the first and last y bin, the range is empty if first > last
+  template <class PointType>
+  std::pair<int, int> yBinRange(const PointType& measurement,
+                                const HoughAxisRanges& axisRanges,
+                                const LineParametrisation<PointType>& linePar,
+                                const LineParametrisation<PointType>& widthPar,
+                                std::size_t xBin) const;
   /// @brief Helper method to fill a bin of the hough histogram.
   /// Updates the internal helper data structures (maximum tracker etc).
   /// @param binX: bin number along x
@@ -257,8 +300,10 @@ class HoughPlane {
       0, 0};  // track the location of the maximum in hits
   std::pair<std::size_t, std::size_t> m_maxLocLayers = {
       0, 0};  // track the location of the maximum in layers
-  std::set<std::pair<std::size_t, std::size_t>> m_touchedBins =
-      {};                  // track the bins with non-trivial content
+  std::vector<std::pair<std::size_t, std::size_t>> m_touchedBins =
+      {};  // track the bins with non-trivial content
+  std::vector<char> m_isTouched =
+      {};                  // flag the touched bins, indexed by x * nBinsY + y
   HoughPlaneConfig m_cfg;  // the configuration object
   HoughHist m_houghHist;   // the histogram data object
 };
@@ -8,6 +8,27 @@
 
 #include <algorithm>
 
+template <class identifier_t>
+template <class PointType>
+std::pair<int, int>
+Acts::HoughTransformUtils::HoughPlane<identifier_t>::yBinRange(
+    const PointType& measurement, const HoughAxisRanges& axisRanges,
+    const LineParametrisation<PointType>& linePar,
+    const LineParametrisation<PointType>& widthPar, std::size_t xBin) const {
+  // get the x-coordinate for the given bin
+  auto x = binCenter(axisRanges.xMin, axisRanges.xMax, m_cfg.nBinsX, xBin);
+  // now evaluate the line equation provided by the user
+  CoordType y = linePar(x, measurement);
+  CoordType dy = widthPar(x, measurement);
+  // translate the y-coordinate range to a bin range
+  int yBinDown =
+      binIndex(axisRanges.yMin, axisRanges.yMax, m_cfg.nBinsY, y - dy);
+  int yBinUp = binIndex(axisRanges.yMin, axisRanges.yMax, m_cfg.nBinsY, y + dy);
+  // clip the bin range to the histogram instead of testing each bin
+  return {std::max(yBinDown, 0),
+          std::min(yBinUp, static_cast<int>(m_cfg.nBinsY) - 1)};
+}
+
 template <class identifier_t>
 template <class PointType>
 void Acts::HoughTransformUtils::HoughPlane<identifier_t>::fill(
@@ -17,27 +38,118 @@ void Acts::HoughTransformUtils::HoughPlane<identifier_t>::fill(
     unsigned layer, YieldType weight) {
   // loop over all bins in the first coordinate to populate the line
   for (std::size_t xBin = 0; xBin < m_cfg.nBinsX; xBin++) {
-    // get the x-coordinate for the given bin
-    auto x = binCenter(axisRanges.xMin, axisRanges.xMax, m_cfg.nBinsX, xBin);
-    // now evaluate the line equation provided by the user
-    CoordType y = linePar(x, measurement);
-    CoordType dy = widthPar(x, measurement);
-    // translate the y-coordinate range to a bin range
-    int yBinDown =
-        binIndex(axisRanges.yMin, axisRanges.yMax, m_cfg.nBinsY, y - dy);
-    int yBinUp =
-        binIndex(axisRanges.yMin, axisRanges.yMax, m_cfg.nBinsY, y + dy);
+    auto [yBinDown, yBinUp] =
+        yBinRange(measurement, axisRanges, linePar, widthPar, xBin);
     // now we can loop over the bin range to fill the corresponding cells
     for (int yBin = yBinDown; yBin <= yBinUp; ++yBin) {
-      // skip 'out of bounds' cases
-      if (yBin >= static_cast<int>(m_cfg.nBinsY) || yBin < 0) {
-        continue;
-      }
       fillBin(xBin, yBin, identifier, layer, weight);
     }
   }
 }
 
+template <class identifier_t>
+template <class PointType>
+void Acts::HoughTransformUtils::HoughPlane<identifier_t>::fill(
+    const std::vector<PointType>& measurements,
+    const HoughAxisRanges& axisRanges, LineParametrisation<PointType> linePar,
+    LineParametrisation<PointType> widthPar,
+    const std::vector<identifier_t>& identifiers,
+    const std::vector<unsigned>& layers, YieldType weight) {
+  // a column costs a few bins per measurement, smaller ranges of columns
+  // are not worth a thread
+  constexpr std::size_t minColumns = 16;
+  const std::size_t nChunks =
+      std::min(Acts::maxThreads(),
+               std::max<std::size_t>(m_cfg.nBinsX / minColumns, 1));
+  if (nChunks == 1) {
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+      fill(measurements[i], axisRanges, linePar, widthPar, identifiers[i],
+           layers[i], weight);
+    }
+    return;
+  }
+
+  // a fill is ordered by measurement, then by bin. This is the order the
+  // sequential fills visit the bins in, and decides the order of the
+  // non-empty bins and the location of the maxima in case of ties
+  using FillKey = std::tuple<std::size_t, std::size_t, std::size_t>;
+  struct ChunkResult {
+    std::vector<FillKey> touched;
+    YieldType maxHits = 0;
+    YieldType maxLayers = 0;
+    std::optional<FillKey> maxLocHits;
+    std::optional<FillKey> maxLocLayers;
+  };
+  std::vector<ChunkResult> chunks(nChunks);
+
+  // each chunk owns a range of columns, so the cells and their touched flags
+  // are only written by one thread. The cells receive the measurements in the
+  // same order as in the sequential fills.
+  Acts::parallelFor(nChunks, [&](std::size_t ic) {
+    const std::size_t xBegin = m_cfg.nBinsX * ic / nChunks;
+    const std::size_t xEnd = m_cfg.nBinsX * (ic + 1) / nChunks;
+    ChunkResult& chunk = chunks[ic];
+    chunk.maxHits = m_maxHits;
+    chunk.maxLayers = m_maxLayers;
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+      for (std::size_t xBin = xBegin; xBin < xEnd; ++xBin) {
+        auto [yBinDown, yBinUp] =
+            yBinRange(measurements[i], axisRanges, linePar, widthPar, xBin);
+        for (int yBin = yBinDown; yBin <= yBinUp; ++yBin) {
+          const std::size_t binY = static_cast<std::size_t>(yBin);
+          char& touched = m_isTouched[xBin * m_cfg.nBinsY + binY];
+          if (touched == 0) {
+            touched = 1;
+            chunk.touched.emplace_back(i, xBin, binY);
+          }
+          HoughCell<identifier_t>& cell = m_houghHist(xBin, binY);
+          cell.fill(identifiers[i], layers[i], weight);
+          if (cell.nLayers() > chunk.maxLayers) {
+            chunk.maxLayers = cell.nLayers();
+            chunk.maxLocLayers = FillKey{i, xBin, binY};
+          }
+          if (cell.nHits() > chunk.maxHits) {
+            chunk.maxHits = cell.nHits();
+            chunk.maxLocHits = FillKey{i, xBin, binY};
+          }
+        }
+      }
+    }
+  });
+
+  // the sequential fills keep the first fill which reaches the maximum
+  std::optional<FillKey> maxLocHits;
+  std::optional<FillKey> maxLocLayers;
+  std::vector<FillKey> touched;
+  for (ChunkResult& chunk : chunks) {
+    if (chunk.maxLocHits.has_value() &&
+        (chunk.maxHits > m_maxHits ||
+         (maxLocHits.has_value() && chunk.maxHits == m_maxHits &&
+          *chunk.maxLocHits < *maxLocHits))) {
+      m_maxHits = chunk.maxHits;
+      maxLocHits = chunk.maxLocHits;
+    }
+    if (chunk.maxLocLayers.has_value() &&
+        (chunk.maxLayers > m_maxLayers ||
+         (maxLocLayers.has_value() && chunk.maxLayers == m_maxLayers &&
+          *chunk.maxLocLayers < *maxLocLayers))) {
+      m_maxLayers = chunk.maxLayers;
+      maxLocLayers = chunk.maxLocLayers;
+    }
+    touched.insert(touched.end(), chunk.touched.begin(), chunk.touched.end());
+  }
+  if (maxLocHits.has_value()) {
+    m_maxLocHits = {std::get<1>(*maxLocHits), std::get<2>(*maxLocHits)};
+  }
+  if (maxLocLayers.has_value()) {
+    m_maxLocLayers = {std::get<1>(*maxLocLayers), std::get<2>(*maxLocLayers)};
+  }
+  std::sort(touched.begin(), touched.end());
+  for (const auto& [i, xBin, yBin] : touched) {
+    m_touchedBins.emplace_back(xBin, yBin);
+  }
+}
+
 template <class identifier_t>
 void Acts::HoughTransformUtils::HoughCell<identifier_t>::fill(
     const identifier_t& identifier, unsigned layer, YieldType weight) {
@@ -70,18 +182,25 @@ Acts::HoughTransformUtils::HoughPlane<identifier_t>::HoughPlane(
     : m_cfg(cfg) {
   // instantiate our histogram.
   m_houghHist = HoughHist(m_cfg.nBinsX, m_cfg.nBinsY);
+  m_isTouched.assign(m_cfg.nBinsX * m_cfg.nBinsY, 0);
 }
 template <class identifier_t>
 void Acts::HoughTransformUtils::HoughPlane<identifier_t>::fillBin(
     std::size_t binX, std::size_t binY, const identifier_t& identifier,
     unsigned layer, double w) {
-  // mark that this bin was filled with non trivial content
-  m_touchedBins.insert({binX, binY});
+  // mark that this bin was filled with non trivial content.
+  // The flag array avoids a lookup in the list of touched bins.
+  char& touched = m_isTouched[binX * m_cfg.nBinsY + binY];
+  if (touched == 0) {
+    touched = 1;
+    m_touchedBins.emplace_back(binX, binY);
+  }
   // add content to the cell
-  m_houghHist(binX, binY).fill(identifier, layer, w);
+  HoughCell<identifier_t>& cell = m_houghHist(binX, binY);
+  cell.fill(identifier, layer, w);
   // and update our cached maxima
-  YieldType nLayers = m_houghHist(binX, binY).nLayers();
-  YieldType nHits = m_houghHist(binX, binY).nHits();
+  YieldType nLayers = cell.nLayers();
+  YieldType nHits = cell.nHits();
   if (nLayers > m_maxLayers) {
     m_maxLayers = nLayers;
     m_maxLocLayers = {binX, binY};
@@ -98,6 +217,7 @@ void Acts::HoughTransformUtils::HoughPlane<identifier_t>::reset() {
   // avoid calling this on empty cells to save time
   for (auto bin : m_touchedBins) {
     m_houghHist(bin).reset();
+    m_isTouched[bin.first * m_cfg.nBinsY + bin.second] = 0;
   }
   // don't forget to reset our cached maxima
   m_maxHits = 0.;
@@ -119,8 +239,12 @@ Acts::HoughTransformUtils::PeakFinders::LayerGuidedCombinatoric<
   // book the vector for the maxima
   std::vector<PeakFinders::LayerGuidedCombinatoric<identifier_t>::Maximum>
       maxima;
-  // loop over the non empty bins
-  for (auto [x, y] : plane.getNonEmptyBins()) {
+  // loop over the non empty bins in bin order, the plane keeps them in the
+  // order in which they were filled
+  std::vector<std::pair<std::size_t, std::size_t>> nonEmptyBins =
+      plane.getNonEmptyBins();
+  std::sort(nonEmptyBins.begin(), nonEmptyBins.end());
+  for (auto [x, y] : nonEmptyBins) {
     // and look for the ones that represent a maximum
     if (passThreshold(plane, x, y)) {
       // write out a maximum
@@ -222,12 +346,15 @@ Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
       yieldMap[{x, y}] = plane.nHits(x, y);
     }
   }
-  // sort the candidate cells descending in content
+  // sort the candidate cells descending in content.
+  // Ties are broken by the bin index, so that the result does not depend on
+  // the order in which the cells were filled
   std::sort(candidates.begin(), candidates.end(),
             [&plane](const std::pair<std::size_t, std::size_t>& bin1,
                      const std::pair<std::size_t, std::size_t>& bin2) {
-              return (plane.nHits(bin1.first, bin1.second) >
-                      plane.nHits(bin2.first, bin2.second));
+              YieldType hits1 = plane.nHits(bin1.first, bin1.second);
+              YieldType hits2 = plane.nHits(bin2.first, bin2.second);
+              return hits1 > hits2 || (hits1 == hits2 && bin1 < bin2);
             });
 
   // now we build islands from the candidate cells, starting with the most
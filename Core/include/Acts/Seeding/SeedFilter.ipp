@@ -255,7 +255,7 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_1SpFixed(
   // retrieve all candidates
   // this collection is already sorted
   // higher weights first
-  auto extended_collection = candidates_collector.storage();
+  auto& extended_collection = candidates_collector.sortedStorage();
   filterSeeds_1SpFixed(spacePointData, extended_collection, numQualitySeeds,
                        outIt);
 }
@@ -12,12 +12,16 @@
 #include "Acts/EventData/SpacePointData.hpp"
 #include "Acts/Geometry/Extent.hpp"
 #include "Acts/Seeding/CandidatesForMiddleSp.hpp"
+#include "Acts/Seeding/DoubletCache.hpp"
 #include "Acts/Seeding/InternalSeed.hpp"
 #include "Acts/Seeding/InternalSpacePoint.hpp"
 #include "Acts/Seeding/Neighbour.hpp"
 #include "Acts/Seeding/SeedFilter.hpp"
 #include "Acts/Seeding/SeedFinderConfig.hpp"
 #include "Acts/Seeding/SeedFinderUtils.hpp"
+#include "Acts/Seeding/SpacePointStore.hpp"
+#include "Acts/Seeding/detail/BinSpacePoints.hpp"
+#include "Acts/Utilities/TraceSpans.hpp"
 
 #include <array>
 #include <limits>
@@ -52,6 +56,12 @@ class SeedFinder {
     std::vector<LinCircle> linCircleBottom;
     // ...for middle-top
     std::vector<LinCircle> linCircleTop;
+    // ...for middle-top, sorted and stored as structure-of-arrays
+    LinCircleSoA sortedLinCircleTop;
+
+    // sorting order of the bottom and top doublets
+    std::vector<std::size_t> sortedBottoms;
+    std::vector<std::size_t> sortedTops;
 
     // create vectors here to avoid reallocation in each loop
     std::vector<const InternalSpacePoint<external_spacepoint_t>*> topSpVec;
@@ -72,6 +82,16 @@ class SeedFinder {
 
     // Adding space point info
     Acts::SpacePointData spacePointData;
+
+    // doublets shared between seeding passes with different cuts, only used
+    // after being enabled with DoubletCache::reset
+    Acts::DoubletCache<external_spacepoint_t> doubletCache;
+
+    // optional copy of the grid passed to createSeedsForGroup, filled with
+    // SpacePointStore::fill. If set, the doublet search reads the bottom and
+    // top candidates from its columns instead of the internal space points
+    const Acts::SpacePointStore<external_spacepoint_t>* spacePointStore =
+        nullptr;
   };
 
   /// The only constructor. Requires a config object.
@@ -137,6 +157,7 @@ class SeedFinder {
   /// Iterates over dublets and tests the compatibility between them by applying
   /// a series of cuts that can be tested with only two SPs
   /// @param spacePointData object containing the spacepoint data
+  /// @param spacePointStore optional column store filled from the grid
   /// @param options frequently changing configuration (like beam position)
   /// @param grid spacepoint grid
   /// @param otherSPsNeighbours inner or outer space points to be used in the dublet
@@ -152,6 +173,7 @@ class SeedFinder {
   template <Acts::SpacePointCandidateType candidateType, typename out_range_t>
   void getCompatibleDoublets(
       Acts::SpacePointData& spacePointData,
+      const Acts::SpacePointStore<external_spacepoint_t>* spacePointStore,
       const Acts::SeedFinderOptions& options, const grid_t& grid,
       boost::container::small_vector<Acts::Neighbour<grid_t>,
                                      Acts::detail::ipow(3, grid_t::DIM)>&
@@ -161,6 +183,43 @@ class SeedFinder {
       const float deltaRMinSP, const float deltaRMaxSP, const float uIP,
       const float uIP2, const float cosPhiM, const float sinPhiM) const;
 
+  /// Provides the compatible dublets of a middle SP, either from the grid or
+  /// by applying the cuts to the dublets stored in the doublet cache of the
+  /// state. See getCompatibleDoublets for the parameters.
+  /// @param state State object that holds memory used
+  template <Acts::SpacePointCandidateType candidateType, typename out_range_t>
+  void findDoublets(
+      SeedingState& state, const Acts::SeedFinderOptions& options,
+      const grid_t& grid,
+      boost::container::small_vector<Acts::Neighbour<grid_t>,
+                                     Acts::detail::ipow(3, grid_t::DIM)>&
+          otherSPsNeighbours,
+      const InternalSpacePoint<external_spacepoint_t>& mediumSP,
+      std::vector<LinCircle>& linCircleVec, out_range_t& outVec,
+      const float deltaRMinSP, const float deltaRMaxSP, const float uIP,
+      const float uIP2, const float cosPhiM, const float sinPhiM) const;
+
+  /// Applies the dublet cuts to dublets found in a previous pass
+  /// @param spacePointData object containing the spacepoint data
+  /// @param options frequently changing configuration (like beam position)
+  /// @param entry The cached dublets of the middle SP
+  /// @param mediumSP space point candidate to be used as middle SP in a seed
+  /// @param linCircleVec vector containing inner or outer SP parameters after reference frame transformation to the u-v space
+  /// @param outVec Output object containing top or bottom SPs that are compatible with a certain middle SPs
+  /// @param deltaRMinSP minimum allowed r-distance between dublet components
+  /// @param deltaRMaxSP maximum allowed r-distance between dublet components
+  /// @param uIP minus one over radius of middle SP
+  /// @param uIP2 square of uIP
+  template <Acts::SpacePointCandidateType candidateType, typename out_range_t>
+  void filterCachedDoublets(
+      Acts::SpacePointData& spacePointData,
+      const Acts::SeedFinderOptions& options,
+      const typename DoubletCache<external_spacepoint_t>::Entry& entry,
+      const InternalSpacePoint<external_spacepoint_t>& mediumSP,
+      std::vector<LinCircle>& linCircleVec, out_range_t& outVec,
+      const float deltaRMinSP, const float deltaRMaxSP, const float uIP,
+      const float uIP2) const;
+
   /// Iterates over the seed candidates tests the compatibility between three
   /// SPs and calls for the seed confirmation
   /// @param spacePointData object containing the spacepoint data
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <stdexcept>
 #include <type_traits>
 
 namespace Acts {
@@ -44,6 +45,8 @@ void SeedFinder<external_spacepoint_t, grid_t, platform_t>::createSeedsForGroup(
     const sp_range_t& bottomSPsIdx, const std::size_t middleSPsIdx,
     const sp_range_t& topSPsIdx,
     const Acts::Range1D<float>& rMiddleSPRange) const {
+  ACTS_TRACE_SPAN("SeedFinder::createSeedsForGroup");
+
   if (!options.isInInternalUnits) {
     throw std::runtime_error(
         "SeedFinderOptions not in ACTS internal units in SeedFinder");
@@ -142,8 +145,8 @@ void SeedFinder<external_spacepoint_t, grid_t, platform_t>::createSeedsForGroup(
     const float uIP2 = uIP * uIP;
 
     // Iterate over middle-top dublets
-    getCompatibleDoublets<Acts::SpacePointCandidateType::eTop>(
-        state.spacePointData, options, grid, state.topNeighbours, *spM.get(),
+    findDoublets<Acts::SpacePointCandidateType::eTop>(
+        state, options, grid, state.topNeighbours, *spM.get(),
         state.linCircleTop, state.compatTopSP, m_config.deltaRMinTopSP,
         m_config.deltaRMaxTopSP, uIP, uIP2, cosPhiM, sinPhiM);
 
@@ -175,8 +178,8 @@ void SeedFinder<external_spacepoint_t, grid_t, platform_t>::createSeedsForGroup(
     }
 
     // Iterate over middle-bottom dublets
-    getCompatibleDoublets<Acts::SpacePointCandidateType::eBottom>(
-        state.spacePointData, options, grid, state.bottomNeighbours, *spM.get(),
+    findDoublets<Acts::SpacePointCandidateType::eBottom>(
+        state, options, grid, state.bottomNeighbours, *spM.get(),
         state.linCircleBottom, state.compatBottomSP, m_config.deltaRMinBottomSP,
         m_config.deltaRMaxBottomSP, uIP, uIP2, cosPhiM, sinPhiM);
 
@@ -201,11 +204,163 @@ void SeedFinder<external_spacepoint_t, grid_t, platform_t>::createSeedsForGroup(
   }  // loop on mediums
 }
 
+template <typename external_spacepoint_t, typename grid_t, typename platform_t>
+template <Acts::SpacePointCandidateType candidateType, typename out_range_t>
+inline void SeedFinder<external_spacepoint_t, grid_t, platform_t>::findDoublets(
+    SeedingState& state, const Acts::SeedFinderOptions& options,
+    const grid_t& grid,
+    boost::container::small_vector<Acts::Neighbour<grid_t>,
+                                   Acts::detail::ipow(3, grid_t::DIM)>&
+        otherSPsNeighbours,
+    const InternalSpacePoint<external_spacepoint_t>& mediumSP,
+    std::vector<LinCircle>& linCircleVec, out_range_t& outVec,
+    const float deltaRMinSP, const float deltaRMaxSP, const float uIP,
+    const float uIP2, const float cosPhiM, const float sinPhiM) const {
+  constexpr bool isBottomCandidate =
+      candidateType == Acts::SpacePointCandidateType::eBottom;
+
+  auto& cache = state.doubletCache;
+  if (!cache.isEnabled()) {
+    getCompatibleDoublets<candidateType>(
+        state.spacePointData, state.spacePointStore, options, grid,
+        otherSPsNeighbours, mediumSP, linCircleVec, outVec, deltaRMinSP,
+        deltaRMaxSP, uIP, uIP2, cosPhiM, sinPhiM);
+    return;
+  }
+
+  const DoubletCuts cuts{deltaRMinSP,
+                         deltaRMaxSP,
+                         m_config.collisionRegionMin,
+                         m_config.collisionRegionMax,
+                         m_config.cotThetaMax,
+                         m_config.deltaZMax,
+                         m_config.impactMax,
+                         options.minHelixDiameter2,
+                         m_config.interactionPointCut};
+
+  // reuse the dublets of a previous pass with looser cuts
+  const auto* cached = cache.find(mediumSP.index(), isBottomCandidate, cuts);
+  if (cached != nullptr) {
+    filterCachedDoublets<candidateType>(state.spacePointData, options, *cached,
+                                        mediumSP, linCircleVec, outVec,
+                                        deltaRMinSP, deltaRMaxSP, uIP, uIP2);
+    return;
+  }
+
+  getCompatibleDoublets<candidateType>(
+      state.spacePointData, state.spacePointStore, options, grid,
+      otherSPsNeighbours, mediumSP, linCircleVec, outVec, deltaRMinSP,
+      deltaRMaxSP, uIP, uIP2, cosPhiM, sinPhiM);
+
+  auto* entry = cache.entry(mediumSP.index(), isBottomCandidate);
+  if (entry == nullptr) {
+    return;
+  }
+  entry->valid = true;
+  entry->cuts = cuts;
+  entry->doublets.clear();
+  entry->doublets.reserve(outVec.size());
+  for (std::size_t i = 0; i < outVec.size(); ++i) {
+    auto* otherSP = outVec[i];
+    // same operations as in getCompatibleDoublets, so the cuts can be
+    // reapplied bit by bit
+    const float deltaR = isBottomCandidate
+                             ? (mediumSP.radius() - otherSP->radius())
+                             : (otherSP->radius() - mediumSP.radius());
+    const float deltaZ = isBottomCandidate ? (mediumSP.z() - otherSP->z())
+                                           : (otherSP->z() - mediumSP.z());
+    entry->doublets.push_back({otherSP, linCircleVec[i], deltaR, deltaZ,
+                               state.spacePointData.deltaR(otherSP->index())});
+  }
+}
+
+template <typename external_spacepoint_t, typename grid_t, typename platform_t>
+template <Acts::SpacePointCandidateType candidateType, typename out_range_t>
+inline void
+SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCachedDoublets(
+    Acts::SpacePointData& spacePointData,
+    const Acts::SeedFinderOptions& options,
+    const typename DoubletCache<external_spacepoint_t>::Entry& entry,
+    const InternalSpacePoint<external_spacepoint_t>& mediumSP,
+    std::vector<LinCircle>& linCircleVec, out_range_t& outVec,
+    const float deltaRMinSP, const float deltaRMaxSP, const float uIP,
+    const float uIP2) const {
+  float impactMax = m_config.impactMax;
+
+  constexpr bool isBottomCandidate =
+      candidateType == Acts::SpacePointCandidateType::eBottom;
+
+  if constexpr (isBottomCandidate) {
+    impactMax = -impactMax;
+  }
+
+  outVec.clear();
+  linCircleVec.clear();
+  linCircleVec.reserve(entry.doublets.size());
+  outVec.reserve(entry.doublets.size());
+
+  const float rM = mediumSP.radius();
+  const float zM = mediumSP.z();
+
+  float vIPAbs = 0;
+  if (m_config.interactionPointCut) {
+    vIPAbs = impactMax * uIP2;
+  }
+
+  // the cuts below mirror the ones in getCompatibleDoublets
+  for (const auto& doublet : entry.doublets) {
+    const float deltaR = doublet.deltaR;
+    const float deltaZ = doublet.deltaZ;
+    const LinCircle& lc = doublet.linCircle;
+
+    if (deltaR < deltaRMinSP || deltaR > deltaRMaxSP) {
+      continue;
+    }
+
+    const float zOriginTimesDeltaR = (zM * deltaR - rM * deltaZ);
+    if (zOriginTimesDeltaR < m_config.collisionRegionMin * deltaR ||
+        zOriginTimesDeltaR > m_config.collisionRegionMax * deltaR) {
+      continue;
+    }
+
+    if (deltaZ > m_config.cotThetaMax * deltaR ||
+        deltaZ < -m_config.cotThetaMax * deltaR) {
+      continue;
+    }
+
+    if (!m_config.interactionPointCut) {
+      if (deltaZ > m_config.deltaZMax || deltaZ < -m_config.deltaZMax) {
+        continue;
+      }
+    } else if (std::abs(rM * lc.y) > impactMax * lc.x) {
+      // curvature cut for dublets outside the impact parameter region
+      const float vIP = (lc.y > 0.) ? -vIPAbs : vIPAbs;
+      const float aCoef = (lc.V - vIP) / (lc.U - uIP);
+      const float bCoef = vIP - aCoef * uIP;
+      if ((bCoef * bCoef) * options.minHelixDiameter2 > (1 + aCoef * aCoef)) {
+        continue;
+      }
+    }
+
+    if constexpr (isBottomCandidate) {
+      if (m_config.interactionPointCut &&
+          !m_config.experimentCuts(doublet.sp->radius(), lc.cotTheta)) {
+        continue;
+      }
+    }
+
+    linCircleVec.push_back(lc);
+    spacePointData.setDeltaR(doublet.sp->index(), doublet.distance);
+    outVec.push_back(doublet.sp);
+  }
+}
+
 template <typename external_spacepoint_t, typename grid_t, typename platform_t>
 template <Acts::SpacePointCandidateType candidateType, typename out_range_t>
 inline void
 SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
     Acts::SpacePointData& spacePointData,
+    const Acts::SpacePointStore<external_spacepoint_t>* spacePointStore,
     const Acts::SeedFinderOptions& options, const grid_t& grid,
     boost::container::small_vector<Acts::Neighbour<grid_t>,
                                    Acts::detail::ipow(3, grid_t::DIM)>&
@@ -251,49 +406,36 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
   float deltaR = 0.;
   float deltaZ = 0.;
 
-  for (auto& otherSPCol : otherSPsNeighbours) {
-    const auto& otherSPs = grid.at(otherSPCol.index);
-    if (otherSPs.size() == 0) {
-      continue;
-    }
-
-    // we make a copy of the iterator here since we need it to remain
-    // the same in the Neighbour object
-    auto min_itr = otherSPCol.itr;
-
-    // find the first SP inside the radius region of interest and update
-    // the iterator so we don't need to look at the other SPs again
-    for (; min_itr != otherSPs.end(); ++min_itr) {
-      const auto& otherSP = *min_itr;
+  // scans the space points of a bin starting at the first one that was in
+  // the radius range of the previous middle SP, returns the position of the
+  // first one in the radius range of this middle SP
+  auto scanBin = [&](const auto& bin, std::size_t begin) -> std::size_t {
+    // find the first SP inside the radius region of interest
+    std::size_t first = begin;
+    for (; first != bin.size(); ++first) {
       if constexpr (isBottomCandidate) {
         // if r-distance is too big, try next SP in bin
-        if ((rM - otherSP->radius()) <= deltaRMaxSP) {
+        if ((rM - bin.radius(first)) <= deltaRMaxSP) {
           break;
         }
       } else {
         // if r-distance is too small, try next SP in bin
-        if ((otherSP->radius() - rM) >= deltaRMinSP) {
+        if ((bin.radius(first) - rM) >= deltaRMinSP) {
           break;
         }
       }
     }
-    // We update the iterator in the Neighbour object
-    // that mean that we have changed the middle space point
-    // and the lower bound has moved accordingly
-    otherSPCol.itr = min_itr;
-
-    for (; min_itr != otherSPs.end(); ++min_itr) {
-      const auto& otherSP = *min_itr;
 
+    for (std::size_t i = first; i != bin.size(); ++i) {
       if constexpr (isBottomCandidate) {
-        deltaR = (rM - otherSP->radius());
+        deltaR = (rM - bin.radius(i));
 
         // if r-distance is too small, try next SP in bin
         if (deltaR < deltaRMinSP) {
           break;
         }
       } else {
-        deltaR = (otherSP->radius() - rM);
+        deltaR = (bin.radius(i) - rM);
 
         // if r-distance is too big, try next SP in bin
         if (deltaR > deltaRMaxSP) {
@@ -302,9 +444,9 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
       }
 
       if constexpr (isBottomCandidate) {
-        deltaZ = (zM - otherSP->z());
+        deltaZ = (zM - bin.z(i));
       } else {
-        deltaZ = (otherSP->z() - zM);
+        deltaZ = (bin.z(i) - zM);
       }
 
       // the longitudinal impact parameter zOrigin is defined as (zM - rM *
@@ -336,8 +478,8 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
         }
 
         // transform SP coordinates to the u-v reference frame
-        const float deltaX = otherSP->x() - xM;
-        const float deltaY = otherSP->y() - yM;
+        const float deltaX = bin.x(i) - xM;
+        const float deltaY = bin.y(i) - yM;
 
         const float xNewFrame = deltaX * cosPhiM + deltaY * sinPhiM;
         const float yNewFrame = deltaY * cosPhiM - deltaX * sinPhiM;
@@ -352,22 +494,22 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
         const float cotTheta = deltaZ * iDeltaR;
 
         const float Er =
-            ((varianceZM + otherSP->varianceZ()) +
-             (cotTheta * cotTheta) * (varianceRM + otherSP->varianceR())) *
+            ((varianceZM + bin.varianceZ(i)) +
+             (cotTheta * cotTheta) * (varianceRM + bin.varianceR(i))) *
             iDeltaR2;
 
         // fill output vectors
         linCircleVec.emplace_back(cotTheta, iDeltaR, Er, uT, vT, xNewFrame,
                                   yNewFrame);
-        spacePointData.setDeltaR(otherSP->index(),
+        spacePointData.setDeltaR(bin.index(i),
                                  std::sqrt(deltaR2 + (deltaZ * deltaZ)));
-        outVec.push_back(otherSP.get());
+        outVec.push_back(bin.internal(i));
         continue;
       }
 
       // transform SP coordinates to the u-v reference frame
-      const float deltaX = otherSP->x() - xM;
-      const float deltaY = otherSP->y() - yM;
+      const float deltaX = bin.x(i) - xM;
+      const float deltaY = bin.y(i) - yM;
 
       const float xNewFrame = deltaX * cosPhiM + deltaY * sinPhiM;
       const float yNewFrame = deltaY * cosPhiM - deltaX * sinPhiM;
@@ -395,22 +537,22 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
         // discard bottom-middle dublets in a certain (r, eta) region according
         // to detector specific cuts
         if constexpr (isBottomCandidate) {
-          if (!m_config.experimentCuts(otherSP->radius(), cotTheta)) {
+          if (!m_config.experimentCuts(bin.radius(i), cotTheta)) {
             continue;
           }
         }
 
         const float Er =
-            ((varianceZM + otherSP->varianceZ()) +
-             (cotTheta * cotTheta) * (varianceRM + otherSP->varianceR())) *
+            ((varianceZM + bin.varianceZ(i)) +
+             (cotTheta * cotTheta) * (varianceRM + bin.varianceR(i))) *
             iDeltaR2;
 
         // fill output vectors
         linCircleVec.emplace_back(cotTheta, iDeltaR, Er, uT, vT, xNewFrame,
                                   yNewFrame);
-        spacePointData.setDeltaR(otherSP->index(),
+        spacePointData.setDeltaR(bin.index(i),
                                  std::sqrt(deltaR2 + (deltaZ * deltaZ)));
-        outVec.emplace_back(otherSP.get());
+        outVec.emplace_back(bin.internal(i));
         continue;
       }
 
@@ -444,23 +586,51 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
       // discard bottom-middle dublets in a certain (r, eta) region according
       // to detector specific cuts
       if constexpr (isBottomCandidate) {
-        if (!m_config.experimentCuts(otherSP->radius(), cotTheta)) {
+        if (!m_config.experimentCuts(bin.radius(i), cotTheta)) {
           continue;
         }
       }
 
       const float Er =
-          ((varianceZM + otherSP->varianceZ()) +
-           (cotTheta * cotTheta) * (varianceRM + otherSP->varianceR())) *
+          ((varianceZM + bin.varianceZ(i)) +
+           (cotTheta * cotTheta) * (varianceRM + bin.varianceR(i))) *
           iDeltaR2;
 
       // fill output vectors
       linCircleVec.emplace_back(cotTheta, iDeltaR, Er, uT, vT, xNewFrame,
                                 yNewFrame);
-      spacePointData.setDeltaR(otherSP->index(),
+      spacePointData.setDeltaR(bin.index(i),
                                std::sqrt(deltaR2 + (deltaZ * deltaZ)));
-      outVec.emplace_back(otherSP.get());
+      outVec.emplace_back(bin.internal(i));
+    }
+    return first;
+  };
+
+  for (auto& otherSPCol : otherSPsNeighbours) {
+    const auto& otherSPs = grid.at(otherSPCol.index);
+    if (otherSPs.size() == 0) {
+      continue;
     }
+
+    using bin_t = typename grid_t::value_type;
+    const std::size_t begin = std::distance(otherSPs.begin(), otherSPCol.itr);
+    std::size_t first = 0;
+    if (spacePointStore != nullptr) {
+      auto [storeBegin, storeEnd] = spacePointStore->binRange(otherSPCol.index);
+      if (storeEnd - storeBegin != otherSPs.size()) {
+        throw std::runtime_error(
+            "SpacePointStore was not filled from the seeding grid");
+      }
+      first = scanBin(detail::StoreBinSpacePoints<external_spacepoint_t, bin_t>{
+                          *spacePointStore, storeBegin, otherSPs},
+                      begin);
+    } else {
+      first = scanBin(detail::GridBinSpacePoints<bin_t>{otherSPs}, begin);
+    }
+    // We update the iterator in the Neighbour object
+    // that mean that we have changed the middle space point
+    // and the lower bound has moved accordingly
+    otherSPCol.itr = otherSPs.begin() + first;
   }
 }
 
@@ -481,15 +651,13 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCandidates(
   std::size_t numTopSP = state.compatTopSP.size();
 
   // sort: make index vector
-  std::vector<std::size_t> sorted_bottoms(state.linCircleBottom.size());
-  for (std::size_t i(0); i < sorted_bottoms.size(); ++i) {
-    sorted_bottoms[i] = i;
-  }
+  std::vector<std::size_t>& sorted_bottoms = state.sortedBottoms;
+  sorted_bottoms.resize(state.linCircleBottom.size());
+  std::iota(sorted_bottoms.begin(), sorted_bottoms.end(), 0);
 
-  std::vector<std::size_t> sorted_tops(state.linCircleTop.size());
-  for (std::size_t i(0); i < sorted_tops.size(); ++i) {
-    sorted_tops[i] = i;
-  }
+  std::vector<std::size_t>& sorted_tops = state.sortedTops;
+  sorted_tops.resize(state.linCircleTop.size());
+  std::iota(sorted_tops.begin(), sorted_tops.end(), 0);
 
   if constexpr (detailedMeasurement ==
                 Acts::DetectorMeasurementInfo::eDefault) {
@@ -506,6 +674,18 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCandidates(
               });
   }
 
+  // lay out the top doublets contiguously in the order in which they are
+  // visited, so the inner loop below walks linearly through memory for every
+  // bottom doublet
+  gatherLinCircles(state.linCircleTop, sorted_tops, state.sortedLinCircleTop);
+  const float* const topCotTheta = state.sortedLinCircleTop.cotTheta.data();
+  const float* const topIDeltaR = state.sortedLinCircleTop.iDeltaR.data();
+  const float* const topEr = state.sortedLinCircleTop.Er.data();
+  const float* const topU = state.sortedLinCircleTop.U.data();
+  const float* const topV = state.sortedLinCircleTop.V.data();
+  const float* const topX = state.sortedLinCircleTop.x.data();
+  const float* const topY = state.sortedLinCircleTop.y.data();
+
   // Reserve enough space, in case current capacity is too little
   state.topSpVec.reserve(numTopSP);
   state.curvatures.reserve(numTopSP);
@@ -575,9 +755,7 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCandidates(
     for (std::size_t index_t = t0; index_t < numTopSP; index_t++) {
       const std::size_t t = sorted_tops[index_t];
 
-      auto lt = state.linCircleTop[t];
-
-      float cotThetaT = lt.cotTheta;
+      float cotThetaT = topCotTheta[index_t];
       float rMxy = 0.;
       float ub = 0.;
       float vb = 0.;
@@ -594,13 +772,13 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCandidates(
       if constexpr (detailedMeasurement ==
                     Acts::DetectorMeasurementInfo::eDetailed) {
         // protects against division by 0
-        float dU = lt.U - Ub;
+        float dU = topU[index_t] - Ub;
         if (dU == 0.) {
           continue;
         }
         // A and B are evaluated as a function of the circumference parameters
         // x_0 and y_0
-        float A0 = (lt.V - Vb) / dU;
+        float A0 = (topV[index_t] - Vb) / dU;
 
         float zPositionMiddle = cosTheta * std::sqrt(1 + A0 * A0);
 
@@ -633,8 +811,8 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCandidates(
         }
 
         // coordinate transformation and checks for top spacepoint
-        float Ct = 1. - B0 * lt.y;
-        float St = A0 + B0 * lt.x;
+        float Ct = 1. - B0 * topY[index_t];
+        float St = A0 + B0 * topX[index_t];
         double positionTop[3] = {
             rotationTermsUVtoXY[0] * Ct - rotationTermsUVtoXY[1] * St,
             rotationTermsUVtoXY[0] * St + rotationTermsUVtoXY[1] * Ct,
@@ -675,9 +853,9 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCandidates(
 
       // add errors of spB-spM and spM-spT pairs and add the correlation term
       // for errors on spM
-      float error2 =
-          lt.Er + ErB +
-          2 * (cotThetaAvg2 * varianceRM + varianceZM) * iDeltaRB * lt.iDeltaR;
+      float error2 = topEr[index_t] + ErB +
+                     2 * (cotThetaAvg2 * varianceRM + varianceZM) * iDeltaRB *
+                         topIDeltaR[index_t];
 
       float deltaCotTheta = cotThetaB - cotThetaT;
       float deltaCotTheta2 = deltaCotTheta * deltaCotTheta;
@@ -738,14 +916,14 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCandidates(
         B = vb - A * ub;
         B2 = B * B;
       } else {
-        dU = lt.U - Ub;
+        dU = topU[index_t] - Ub;
         // protects against division by 0
         if (dU == 0.) {
           continue;
         }
         // A and B are evaluated as a function of the circumference parameters
         // x_0 and y_0
-        A = (lt.V - Vb) / dU;
+        A = (topV[index_t] - Vb) / dU;
         S2 = 1. + A * A;
         B = Vb - A * Ub;
         B2 = B * B;
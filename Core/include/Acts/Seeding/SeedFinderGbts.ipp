@@ -16,8 +16,11 @@
 #include "Acts/Seeding/SeedFinderGbtsConfig.hpp"
 #include "Acts/Seeding/SeedFinderUtils.hpp"
 #include "Acts/Utilities/BinningType.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <fstream>
 #include <functional>
 #include <iostream>
@@ -331,89 +334,117 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
 
   int nNodes = vNodes.size();
 
-  for (int nodeIdx = 0; nodeIdx < nNodes; nodeIdx++) {
-    const GbtsNode<external_spacepoint_t>* pN = vNodes.at(nodeIdx);
-
+  // The nodes and edges are split into contiguous chunks, which are
+  // processed concurrently within the Acts::maxThreads budget
+  auto numChunks = [](std::size_t n) {
+    constexpr std::size_t minChunk = 1024;
+    return std::min(Acts::maxThreads(), std::max<std::size_t>(n / minChunk, 1));
+  };
+  auto forEachChunk = [](std::size_t n, std::size_t nChunks,
+                         const std::function<void(std::size_t, std::size_t,
+                                                  std::size_t)>& f) {
+    const std::size_t chunk = (n + nChunks - 1) / nChunks;
+    Acts::parallelFor(nChunks, [&](std::size_t ic) {
+      f(ic, std::min(ic * chunk, n), std::min((ic + 1) * chunk, n));
+    });
+  };
+
+  // Every edge is an incoming edge of exactly one node, so each node only
+  // modifies its own edges and the nodes can be connected concurrently. The
+  // sorting buffers are re-used between the nodes of a chunk.
+  forEachChunk(nNodes, numChunks(nNodes), [&](std::size_t /*ic*/,
+                                              std::size_t begin,
+                                              std::size_t end) {
     std::vector<std::pair<float, int>> in_sort, out_sort;
-    in_sort.resize(pN->m_in.size());
-    out_sort.resize(pN->m_out.size());
-
-    for (int inIdx = 0; inIdx < static_cast<int>(pN->m_in.size()); inIdx++) {
-      int inEdgeIdx = pN->m_in.at(inIdx);
-      Acts::GbtsEdge<external_spacepoint_t>* pS = &(edgeStorage.at(inEdgeIdx));
-      in_sort[inIdx].second = inEdgeIdx;
-      in_sort[inIdx].first = pS->m_p[0];
-    }
-    for (int outIdx = 0; outIdx < static_cast<int>(pN->m_out.size());
-         outIdx++) {
-      int outEdgeIdx = pN->m_out.at(outIdx);
-      Acts::GbtsEdge<external_spacepoint_t>* pS = &(edgeStorage.at(outEdgeIdx));
-      out_sort[outIdx].second = outEdgeIdx;
-      out_sort[outIdx].first = pS->m_p[0];
-    }
 
-    std::sort(in_sort.begin(), in_sort.end());
-    std::sort(out_sort.begin(), out_sort.end());
+    for (std::size_t nodeIdx = begin; nodeIdx < end; nodeIdx++) {
+      const GbtsNode<external_spacepoint_t>* pN = vNodes[nodeIdx];
 
-    unsigned int last_out = 0;
+      in_sort.resize(pN->m_in.size());
+      out_sort.resize(pN->m_out.size());
 
-    for (unsigned int in_idx = 0; in_idx < in_sort.size();
-         in_idx++) {  // loop over incoming edges
+      for (int inIdx = 0; inIdx < static_cast<int>(pN->m_in.size());
+           inIdx++) {
+        int inEdgeIdx = pN->m_in.at(inIdx);
+        Acts::GbtsEdge<external_spacepoint_t>* pS =
+            &(edgeStorage.at(inEdgeIdx));
+        in_sort[inIdx].second = inEdgeIdx;
+        in_sort[inIdx].first = pS->m_p[0];
+      }
+      for (int outIdx = 0; outIdx < static_cast<int>(pN->m_out.size());
+           outIdx++) {
+        int outEdgeIdx = pN->m_out.at(outIdx);
+        Acts::GbtsEdge<external_spacepoint_t>* pS =
+            &(edgeStorage.at(outEdgeIdx));
+        out_sort[outIdx].second = outEdgeIdx;
+        out_sort[outIdx].first = pS->m_p[0];
+      }
 
-      int inEdgeIdx = in_sort[in_idx].second;
+      std::sort(in_sort.begin(), in_sort.end());
+      std::sort(out_sort.begin(), out_sort.end());
 
-      Acts::GbtsEdge<external_spacepoint_t>* pS = &(edgeStorage.at(inEdgeIdx));
+      unsigned int last_out = 0;
 
-      pS->m_nNei = 0;
-      float tau1 = pS->m_p[0];
-      float uat_1 = 1.0f / tau1;
-      float curv1 = pS->m_p[1];
-      float Phi1 = pS->m_p[2];
+      for (unsigned int in_idx = 0; in_idx < in_sort.size();
+           in_idx++) {  // loop over incoming edges
 
-      for (unsigned int out_idx = last_out; out_idx < out_sort.size();
-           out_idx++) {
-        int outEdgeIdx = out_sort[out_idx].second;
+        int inEdgeIdx = in_sort[in_idx].second;
 
-        Acts::GbtsEdge<external_spacepoint_t>* pNS =
-            &(edgeStorage.at(outEdgeIdx));
+        Acts::GbtsEdge<external_spacepoint_t>* pS =
+            &(edgeStorage.at(inEdgeIdx));
 
-        float tau2 = pNS->m_p[0];
-        float tau_ratio = tau2 * uat_1 - 1.0f;
+        pS->m_nNei = 0;
+        float tau1 = pS->m_p[0];
+        float uat_1 = 1.0f / tau1;
+        float curv1 = pS->m_p[1];
+        float Phi1 = pS->m_p[2];
 
-        if (tau_ratio < -m_config.cut_tau_ratio_max) {
-          last_out = out_idx;
-          continue;
-        }
-        if (tau_ratio > m_config.cut_tau_ratio_max) {
-          break;
-        }
+        for (unsigned int out_idx = last_out; out_idx < out_sort.size();
+             out_idx++) {
+          int outEdgeIdx = out_sort[out_idx].second;
 
-        float dPhi = pNS->m_p[3] - Phi1;
+          Acts::GbtsEdge<external_spacepoint_t>* pNS =
+              &(edgeStorage.at(outEdgeIdx));
 
-        if (dPhi < -M_PI) {
-          dPhi += 2 * M_PI;
-        } else if (dPhi > M_PI) {
-          dPhi -= 2 * M_PI;
-        }
+          float tau2 = pNS->m_p[0];
+          float tau_ratio = tau2 * uat_1 - 1.0f;
 
-        if (dPhi < -m_config.cut_dphi_max || dPhi > m_config.cut_dphi_max) {
-          continue;
-        }
+          if (tau_ratio < -m_config.cut_tau_ratio_max) {
+            last_out = out_idx;
+            continue;
+          }
+          if (tau_ratio > m_config.cut_tau_ratio_max) {
+            break;
+          }
 
-        float curv2 = pNS->m_p[1];
-        float dcurv = curv2 - curv1;
+          float dPhi = pNS->m_p[3] - Phi1;
 
-        if (dcurv < -m_config.cut_dcurv_max || dcurv > m_config.cut_dcurv_max) {
-          continue;
-        }
+          if (dPhi < -M_PI) {
+            dPhi += 2 * M_PI;
+          } else if (dPhi > M_PI) {
+            dPhi -= 2 * M_PI;
+          }
 
-        pS->m_vNei[pS->m_nNei++] = outEdgeIdx;
-        if (pS->m_nNei >= N_SEG_CONNS) {
-          break;
+          if (dPhi < -m_config.cut_dphi_max || dPhi > m_config.cut_dphi_max) {
+            continue;
+          }
+
+          float curv2 = pNS->m_p[1];
+          float dcurv = curv2 - curv1;
+
+          if (dcurv < -m_config.cut_dcurv_max ||
+              dcurv > m_config.cut_dcurv_max) {
+            continue;
+          }
+
+          pS->m_vNei[pS->m_nNei++] = outEdgeIdx;
+          if (pS->m_nNei >= N_SEG_CONNS) {
+            break;
+          }
         }
       }
     }
-  }
+  });
 
   const int maxIter = 15;
 
@@ -422,6 +453,11 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
   int iter = 0;
 
   std::vector<Acts::GbtsEdge<external_spacepoint_t>*> v_old;
+  std::vector<Acts::GbtsEdge<external_spacepoint_t>*> v_new;
+  v_old.reserve(nEdges);
+  v_new.reserve(nEdges);
+  // the proposals of each chunk, concatenated in edge order
+  std::vector<std::vector<Acts::GbtsEdge<external_spacepoint_t>*>> v_chunks;
 
   for (int edgeIndex = 0; edgeIndex < nEdges; edgeIndex++) {
     Acts::GbtsEdge<external_spacepoint_t>* pS = &(edgeStorage.at(edgeIndex));
@@ -433,27 +469,38 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
   }
 
   for (; iter < maxIter; iter++) {
-    // generate proposals
-    std::vector<Acts::GbtsEdge<external_spacepoint_t>*> v_new;
+    // generate proposals, each edge only updates its own proposal and the
+    // levels are only read, so the edges can be processed concurrently
     v_new.clear();
-
-    for (auto pS : v_old) {
-      int next_level = pS->m_level;
-
-      for (int nIdx = 0; nIdx < pS->m_nNei; nIdx++) {
-        unsigned int nextEdgeIdx = pS->m_vNei[nIdx];
-
-        Acts::GbtsEdge<external_spacepoint_t>* pN =
-            &(edgeStorage.at(nextEdgeIdx));
-
-        if (pS->m_level == pN->m_level) {
-          next_level = pS->m_level + 1;
-          v_new.push_back(pS);
-          break;
+    const std::size_t nChunks = numChunks(v_old.size());
+    v_chunks.resize(nChunks);
+
+    forEachChunk(v_old.size(), nChunks, [&](std::size_t ic, std::size_t begin,
+                                            std::size_t end) {
+      auto& v_chunk = (ic == 0) ? v_new : v_chunks[ic];
+      v_chunk.clear();
+      for (std::size_t idx = begin; idx < end; idx++) {
+        auto pS = v_old[idx];
+        int next_level = pS->m_level;
+
+        for (int nIdx = 0; nIdx < pS->m_nNei; nIdx++) {
+          unsigned int nextEdgeIdx = pS->m_vNei[nIdx];
+
+          Acts::GbtsEdge<external_spacepoint_t>* pN =
+              &(edgeStorage.at(nextEdgeIdx));
+
+          if (pS->m_level == pN->m_level) {
+            next_level = pS->m_level + 1;
+            v_chunk.push_back(pS);
+            break;
+          }
         }
-      }
 
-      pS->m_next = next_level;  // proposal
+        pS->m_next = next_level;  // proposal
+      }
+    });
+    for (std::size_t ic = 1; ic < nChunks; ic++) {
+      v_new.insert(v_new.end(), v_chunks[ic].begin(), v_chunks[ic].end());
     }
     // update
 
@@ -473,8 +520,8 @@ void SeedFinderGbts<external_spacepoint_t>::runGbts_TrackFinder(
       break;
     }
 
-    v_old = std::move(v_new);
-    v_new.clear();
+    // keep the memory of both collections for the next iteration
+    std::swap(v_old, v_new);
   }
 
   int minLevel = 3;  // a triplet + 2 confirmation
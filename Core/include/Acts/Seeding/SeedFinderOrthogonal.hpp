@@ -9,11 +9,14 @@
 #pragma once
 
 #include "Acts/EventData/SpacePointData.hpp"
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Seeding/CandidatesForMiddleSp.hpp"
 #include "Acts/Seeding/InternalSeed.hpp"
 #include "Acts/Seeding/InternalSpacePoint.hpp"
 #include "Acts/Seeding/SeedFilter.hpp"
 #include "Acts/Seeding/SeedFinderConfig.hpp"
 #include "Acts/Seeding/SeedFinderOrthogonalConfig.hpp"
+#include "Acts/Seeding/SeedFinderUtils.hpp"
 #include "Acts/Utilities/KDTree.hpp"
 
 #include <array>
@@ -21,6 +24,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
@@ -55,6 +59,46 @@ class SeedFinderOrthogonal {
    */
   using tree_t = KDTree<NDims, internal_sp_t *, ActsScalar, std::array, 4>;
 
+  /**
+   * @brief The event data and working memory of the seeder.
+   *
+   * The state holds the internal spacepoints and the k-d tree built from
+   * them, so that several seeding passes (e.g. with different configurations)
+   * can be run over the same event without rebuilding the tree. It also holds
+   * the candidate buffers used for every middle spacepoint, which keep their
+   * memory between middle spacepoints, passes and events.
+   */
+  struct SeedingState {
+    /// The internal spacepoints, in the order of the input container
+    std::vector<std::unique_ptr<internal_sp_t>> spacePoints;
+    /// Auxiliary variables used by the seeding
+    SpacePointData spacePointData;
+    /// The k-d tree over the internal spacepoints
+    std::optional<tree_t> tree;
+    /// The extent of the spacepoints
+    Extent rRangeSPExtent;
+    /// The beam position the internal spacepoints were created with
+    Vector2 beamPos = Vector2::Zero();
+
+    /// @name Buffers re-used for every middle spacepoint
+    /// @{
+    std::vector<internal_sp_t *> bottom_lh_v;
+    std::vector<internal_sp_t *> bottom_hl_v;
+    std::vector<internal_sp_t *> top_lh_v;
+    std::vector<internal_sp_t *> top_hl_v;
+    CandidatesForMiddleSp<const InternalSpacePoint<external_spacepoint_t>>
+        candidates_collector;
+    std::vector<const internal_sp_t *> top_valid;
+    std::vector<float> curvatures;
+    std::vector<float> impactParameters;
+    std::vector<LinCircle> linCircleBottom;
+    std::vector<LinCircle> linCircleTop;
+    std::vector<std::size_t> sorted_bottoms;
+    std::vector<std::size_t> sorted_tops;
+    std::vector<float> tanMT;
+    /// @}
+  };
+
   /**
    * @brief Construct a new orthogonal seed finder.
    *
@@ -131,6 +175,39 @@ class SeedFinderOrthogonal {
                                   const input_container_t &spacePoints,
                                   callable_t &&extract_coordinates) const;
 
+  /**
+   * @brief Fill a seeding state with the spacepoints of an event.
+   *
+   * Creates the internal spacepoints and builds the k-d tree. The state can
+   * then be used for any number of seeding passes, by this or by other
+   * orthogonal seed finders, as long as the same beam position is used.
+   *
+   * @tparam input_container_t The type of the input spacepoint container.
+   *
+   * @param options frequently changing configuration (like beam position)
+   * @param spacePoints The input spacepoints from which to create seeds.
+   * @param state The seeding state to fill, any previous content is dropped.
+   * @param extract_coordinates User-defined function for extracting global position and
+   * covariance of the external space point
+   */
+  template <typename input_container_t, typename callable_t>
+  void fillState(const Acts::SeedFinderOptions &options,
+                 const input_container_t &spacePoints, SeedingState &state,
+                 callable_t &&extract_coordinates) const;
+
+  /**
+   * @brief Perform seed finding on a previously filled seeding state.
+   *
+   * @tparam output_container_t The type of the output seed container.
+   *
+   * @param options frequently changing configuration (like beam position)
+   * @param state The seeding state, filled by @c fillState
+   * @param out_cont The output container to write seeds to.
+   */
+  template <typename output_container_t>
+  void createSeeds(const Acts::SeedFinderOptions &options, SeedingState &state,
+                   output_container_t &out_cont) const;
+
  private:
   /**
    * @brief Enumeration of the different dimensions in which we can apply cuts.
@@ -210,17 +287,15 @@ class SeedFinderOrthogonal {
    * @param bottom The (vector of) candidate bottom spacepoints.
    * @param top The (vector of) candidate top spacepoints.
    * @param seedFilterState  holds quantities used in seed filter
-   * @param candidates_collector The container to write the resulting
-   * seed candidates to.
-   * @param spacePointData Auxiliary variables used by the seeding
+   * @param state The seeding state, holding the candidate collector and the
+   * working memory.
    */
-  void filterCandidates(
-      const SeedFinderOptions &options, internal_sp_t &middle,
-      std::vector<internal_sp_t *> &bottom, std::vector<internal_sp_t *> &top,
-      SeedFilterState seedFilterState,
-      CandidatesForMiddleSp<const InternalSpacePoint<external_spacepoint_t>>
-          &candidates_collector,
-      Acts::SpacePointData &spacePointData) const;
+  void filterCandidates(const SeedFinderOptions &options,
+                        internal_sp_t &middle,
+                        std::vector<internal_sp_t *> &bottom,
+                        std::vector<internal_sp_t *> &top,
+                        SeedFilterState seedFilterState,
+                        SeedingState &state) const;
 
   /**
    * @brief Search for seeds starting from a given middle space point.
@@ -229,16 +304,15 @@ class SeedFinderOrthogonal {
    * @tparam NDims Number of dimensions for our spatial embedding (probably 3).
    * @tparam output_container_t Type of the output container.
    *
-   * @param tree The k-d tree to use for searching.
+   * @param state The seeding state, holding the k-d tree to use for
+   * searching and the working memory.
    * @param out_cont The container write output seeds to.
    * @param middle_p The middle spacepoint to find seeds for.
-   * @param spacePointData Aux data for the spacepoints
    */
   template <typename output_container_t>
-  void processFromMiddleSP(const SeedFinderOptions &options, const tree_t &tree,
-                           output_container_t &out_cont,
-                           const typename tree_t::pair_t &middle_p,
-                           Acts::SpacePointData &spacePointData) const;
+  void processFromMiddleSP(const SeedFinderOptions &options,
+                           SeedingState &state, output_container_t &out_cont,
+                           const typename tree_t::pair_t &middle_p) const;
 
   /**
    * @brief The configuration for the seeding algorithm.
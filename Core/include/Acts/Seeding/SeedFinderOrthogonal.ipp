@@ -16,6 +16,7 @@
 #include <cmath>
 #include <functional>
 #include <numeric>
+#include <stdexcept>
 #include <type_traits>
 
 namespace Acts {
@@ -256,10 +257,10 @@ template <typename external_spacepoint_t>
 void SeedFinderOrthogonal<external_spacepoint_t>::filterCandidates(
     const SeedFinderOptions &options, internal_sp_t &middle,
     std::vector<internal_sp_t *> &bottom, std::vector<internal_sp_t *> &top,
-    SeedFilterState seedFilterState,
-    CandidatesForMiddleSp<const InternalSpacePoint<external_spacepoint_t>>
-        &candidates_collector,
-    Acts::SpacePointData &spacePointData) const {
+    SeedFilterState seedFilterState, SeedingState &state) const {
+  Acts::SpacePointData &spacePointData = state.spacePointData;
+  auto &candidates_collector = state.candidates_collector;
+
   float rM = middle.radius();
   float zM = middle.z();
   float varianceRM = middle.varianceR();
@@ -286,30 +287,28 @@ void SeedFinderOrthogonal<external_spacepoint_t>::filterCandidates(
     }
   }
 
-  std::vector<const internal_sp_t *> top_valid;
-  std::vector<float> curvatures;
-  std::vector<float> impactParameters;
+  std::vector<const internal_sp_t *> &top_valid = state.top_valid;
+  std::vector<float> &curvatures = state.curvatures;
+  std::vector<float> &impactParameters = state.impactParameters;
 
   // contains parameters required to calculate circle with linear equation
   // ...for bottom-middle
-  std::vector<LinCircle> linCircleBottom;
+  std::vector<LinCircle> &linCircleBottom = state.linCircleBottom;
   // ...for middle-top
-  std::vector<LinCircle> linCircleTop;
+  std::vector<LinCircle> &linCircleTop = state.linCircleTop;
 
   // transform coordinates
   transformCoordinates(spacePointData, bottom, middle, true, linCircleBottom);
   transformCoordinates(spacePointData, top, middle, false, linCircleTop);
 
   // sort: make index vector
-  std::vector<std::size_t> sorted_bottoms(linCircleBottom.size());
-  for (std::size_t i(0); i < sorted_bottoms.size(); ++i) {
-    sorted_bottoms[i] = i;
-  }
+  std::vector<std::size_t> &sorted_bottoms = state.sorted_bottoms;
+  sorted_bottoms.resize(linCircleBottom.size());
+  std::iota(sorted_bottoms.begin(), sorted_bottoms.end(), 0);
 
-  std::vector<std::size_t> sorted_tops(linCircleTop.size());
-  for (std::size_t i(0); i < sorted_tops.size(); ++i) {
-    sorted_tops[i] = i;
-  }
+  std::vector<std::size_t> &sorted_tops = state.sorted_tops;
+  sorted_tops.resize(linCircleTop.size());
+  std::iota(sorted_tops.begin(), sorted_tops.end(), 0);
 
   std::sort(
       sorted_bottoms.begin(), sorted_bottoms.end(),
@@ -322,7 +321,8 @@ void SeedFinderOrthogonal<external_spacepoint_t>::filterCandidates(
               return linCircleTop[a].cotTheta < linCircleTop[b].cotTheta;
             });
 
-  std::vector<float> tanMT;
+  std::vector<float> &tanMT = state.tanMT;
+  tanMT.clear();
   tanMT.reserve(top.size());
 
   std::size_t numTopSP = top.size();
@@ -481,11 +481,12 @@ void SeedFinderOrthogonal<external_spacepoint_t>::filterCandidates(
 template <typename external_spacepoint_t>
 template <typename output_container_t>
 void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
-    const SeedFinderOptions &options, const tree_t &tree,
-    output_container_t &out_cont, const typename tree_t::pair_t &middle_p,
-    Acts::SpacePointData &spacePointData) const {
+    const SeedFinderOptions &options, SeedingState &state,
+    output_container_t &out_cont,
+    const typename tree_t::pair_t &middle_p) const {
   using range_t = typename tree_t::range_t;
   internal_sp_t &middle = *middle_p.second;
+  const tree_t &tree = *state.tree;
 
   /*
    * Prepare four output vectors for seed candidates:
@@ -497,20 +498,16 @@ void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
    * increasing z track, and top_hl_v are the candidate top points for a
    * decreasing z track.
    */
-  std::vector<internal_sp_t *> bottom_lh_v, bottom_hl_v, top_lh_v, top_hl_v;
+  std::vector<internal_sp_t *> &bottom_lh_v = state.bottom_lh_v;
+  std::vector<internal_sp_t *> &bottom_hl_v = state.bottom_hl_v;
+  std::vector<internal_sp_t *> &top_lh_v = state.top_lh_v;
+  std::vector<internal_sp_t *> &top_hl_v = state.top_hl_v;
 
   /*
-   * Storage for seed candidates
+   * Storage for seed candidates, its size is set once per seeding pass
    */
-  std::size_t max_num_quality_seeds_per_spm =
-      m_config.seedFilter->getSeedFilterConfig().maxQualitySeedsPerSpMConf;
-  std::size_t max_num_seeds_per_spm =
-      m_config.seedFilter->getSeedFilterConfig().maxSeedsPerSpMConf;
-
-  CandidatesForMiddleSp<const InternalSpacePoint<external_spacepoint_t>>
-      candidates_collector;
-  candidates_collector.setMaxElements(max_num_seeds_per_spm,
-                                      max_num_quality_seeds_per_spm);
+  auto &candidates_collector = state.candidates_collector;
+  candidates_collector.clear();
 
   /*
    * Calculate the search ranges for bottom and top candidates for this middle
@@ -662,14 +659,14 @@ void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
    */
   if (!bottom_lh_v.empty() && !top_lh_v.empty()) {
     filterCandidates(options, middle, bottom_lh_v, top_lh_v, seedFilterState,
-                     candidates_collector, spacePointData);
+                     state);
   }
   /*
    * Try to combine candidates for decreasing z tracks.
    */
   if (!bottom_hl_v.empty() && !top_hl_v.empty()) {
     filterCandidates(options, middle, bottom_hl_v, top_hl_v, seedFilterState,
-                     candidates_collector, spacePointData);
+                     state);
   }
   /*
    * Run a seed filter, just like in other seeding algorithms.
@@ -677,8 +674,8 @@ void SeedFinderOrthogonal<external_spacepoint_t>::processFromMiddleSP(
   if ((!bottom_lh_v.empty() && !top_lh_v.empty()) ||
       (!bottom_hl_v.empty() && !top_hl_v.empty())) {
     m_config.seedFilter->filterSeeds_1SpFixed(
-        spacePointData, candidates_collector, seedFilterState.numQualitySeeds,
-        std::back_inserter(out_cont));
+        state.spacePointData, candidates_collector,
+        seedFilterState.numQualitySeeds, std::back_inserter(out_cont));
   }
 }
 
@@ -706,25 +703,16 @@ auto SeedFinderOrthogonal<external_spacepoint_t>::createTree(
 }
 
 template <typename external_spacepoint_t>
-template <typename input_container_t, typename output_container_t,
-          typename callable_t>
-void SeedFinderOrthogonal<external_spacepoint_t>::createSeeds(
+template <typename input_container_t, typename callable_t>
+void SeedFinderOrthogonal<external_spacepoint_t>::fillState(
     const Acts::SeedFinderOptions &options,
-    const input_container_t &spacePoints, output_container_t &out_cont,
+    const input_container_t &spacePoints, SeedingState &state,
     callable_t &&extract_coordinates) const {
   if (!options.isInInternalUnits) {
     throw std::runtime_error(
         "SeedFinderOptions not in ACTS internal units in "
         "SeedFinderOrthogonal");
   }
-  /*
-   * The template parameters we accept are a little too generic, so we want to
-   * run some basic checks to make sure the containers have the correct value
-   * types.
-   */
-  static_assert(std::is_same_v<typename output_container_t::value_type,
-                               Seed<external_spacepoint_t>>,
-                "Output iterator container type must accept seeds.");
   static_assert(std::is_same_v<typename input_container_t::value_type,
                                const external_spacepoint_t *>,
                 "Input container must contain external spacepoints.");
@@ -733,38 +721,76 @@ void SeedFinderOrthogonal<external_spacepoint_t>::createSeeds(
    * Sadly, for the time being, we will need to construct our internal space
    * points on the heap. This adds some additional overhead and work. Here we
    * take each external spacepoint, allocate a corresponding internal space
-   * point, and save it in a vector.
+   * point, and save it in the state.
    */
-  Acts::Extent rRangeSPExtent;
+  state.tree.reset();
+  state.spacePoints.clear();
+  state.spacePoints.reserve(spacePoints.size());
+  state.rRangeSPExtent = Acts::Extent();
+  state.beamPos = options.beamPos;
+  state.spacePointData.clear();
+  state.spacePointData.resize(spacePoints.size());
+
   std::size_t counter = 0;
   std::vector<internal_sp_t *> internalSpacePoints;
-  Acts::SpacePointData spacePointData;
-  spacePointData.resize(spacePoints.size());
-
+  internalSpacePoints.reserve(spacePoints.size());
   for (const external_spacepoint_t *p : spacePoints) {
     auto [position, variance, time] = extract_coordinates(p);
-    internalSpacePoints.push_back(new InternalSpacePoint<external_spacepoint_t>(
-        counter++, *p, position, options.beamPos, variance, time));
+    state.spacePoints.push_back(
+        std::make_unique<InternalSpacePoint<external_spacepoint_t>>(
+            counter++, *p, position, options.beamPos, variance, time));
+    internalSpacePoints.push_back(state.spacePoints.back().get());
     // store x,y,z values in extent
-    rRangeSPExtent.extend(position);
+    state.rRangeSPExtent.extend(position);
   }
-  // variable middle SP radial region of interest
-  const Acts::Range1D<float> rMiddleSPRange(
-      std::floor(rRangeSPExtent.min(Acts::binR) / 2) * 2 +
-          m_config.deltaRMiddleMinSPRange,
-      std::floor(rRangeSPExtent.max(Acts::binR) / 2) * 2 -
-          m_config.deltaRMiddleMaxSPRange);
 
   /*
    * Construct the k-d tree from these points. Note that this not consume or
    * take ownership of the points.
    */
-  tree_t tree = createTree(internalSpacePoints);
+  state.tree.emplace(createTree(internalSpacePoints));
+}
+
+template <typename external_spacepoint_t>
+template <typename output_container_t>
+void SeedFinderOrthogonal<external_spacepoint_t>::createSeeds(
+    const Acts::SeedFinderOptions &options, SeedingState &state,
+    output_container_t &out_cont) const {
+  if (!options.isInInternalUnits) {
+    throw std::runtime_error(
+        "SeedFinderOptions not in ACTS internal units in "
+        "SeedFinderOrthogonal");
+  }
+  static_assert(std::is_same_v<typename output_container_t::value_type,
+                               Seed<external_spacepoint_t>>,
+                "Output iterator container type must accept seeds.");
+  if (!state.tree.has_value()) {
+    throw std::invalid_argument(
+        "Seeding state was not filled in SeedFinderOrthogonal");
+  }
+  if (options.beamPos != state.beamPos) {
+    throw std::invalid_argument(
+        "Seeding state was filled with a different beam position in "
+        "SeedFinderOrthogonal");
+  }
+
+  // variable middle SP radial region of interest
+  const Acts::Range1D<float> rMiddleSPRange(
+      std::floor(state.rRangeSPExtent.min(Acts::binR) / 2) * 2 +
+          m_config.deltaRMiddleMinSPRange,
+      std::floor(state.rRangeSPExtent.max(Acts::binR) / 2) * 2 -
+          m_config.deltaRMiddleMaxSPRange);
+
+  // the candidate collector is shared by all middle spacepoints of the pass
+  state.candidates_collector.setMaxElements(
+      m_config.seedFilter->getSeedFilterConfig().maxSeedsPerSpMConf,
+      m_config.seedFilter->getSeedFilterConfig().maxQualitySeedsPerSpMConf);
+
   /*
    * Run the seeding algorithm by iterating over all the points in the tree
    * and seeing what happens if we take them to be our middle spacepoint.
    */
-  for (const typename tree_t::pair_t &middle_p : tree) {
+  for (const typename tree_t::pair_t &middle_p : *state.tree) {
     internal_sp_t &middle = *middle_p.second;
     auto rM = middle.radius();
 
@@ -792,15 +818,21 @@ void SeedFinderOrthogonal<external_spacepoint_t>::createSeeds(
       continue;
     }
 
-    processFromMiddleSP(options, tree, out_cont, middle_p, spacePointData);
+    processFromMiddleSP(options, state, out_cont, middle_p);
   }
+}
 
-  /*
-   * Don't forget to get rid of all the spacepoints we just allocated!
-   */
-  for (const internal_sp_t *p : internalSpacePoints) {
-    delete p;
-  }
+template <typename external_spacepoint_t>
+template <typename input_container_t, typename output_container_t,
+          typename callable_t>
+void SeedFinderOrthogonal<external_spacepoint_t>::createSeeds(
+    const Acts::SeedFinderOptions &options,
+    const input_container_t &spacePoints, output_container_t &out_cont,
+    callable_t &&extract_coordinates) const {
+  SeedingState state;
+  fillState(options, spacePoints, state,
+            std::forward<callable_t>(extract_coordinates));
+  createSeeds(options, state, out_cont);
 }
 
 template <typename external_spacepoint_t>
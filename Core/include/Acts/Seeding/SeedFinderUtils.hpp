@@ -13,6 +13,9 @@
 #include "Acts/Seeding/InternalSpacePoint.hpp"
 #include "Acts/Seeding/SeedFinderConfig.hpp"
 
+#include <cstddef>
+#include <vector>
+
 namespace Acts {
 /// @brief A partial description of a circle in u-v space.
 struct LinCircle {
@@ -29,6 +32,69 @@ struct LinCircle {
   float y{0.};
 };
 
+/// @brief Structure-of-arrays storage for a collection of LinCircle objects.
+///
+/// The triplet compatibility loop reads the same few members for every top
+/// candidate. Keeping each member in its own contiguous array turns that loop
+/// into linear memory walks which the compiler can vectorize.
+struct LinCircleSoA {
+  std::vector<float> cotTheta;
+  std::vector<float> iDeltaR;
+  std::vector<float> Er;
+  std::vector<float> U;
+  std::vector<float> V;
+  std::vector<float> x;
+  std::vector<float> y;
+
+  std::size_t size() const { return cotTheta.size(); }
+
+  void clear() {
+    cotTheta.clear();
+    iDeltaR.clear();
+    Er.clear();
+    U.clear();
+    V.clear();
+    x.clear();
+    y.clear();
+  }
+
+  void reserve(std::size_t n) {
+    cotTheta.reserve(n);
+    iDeltaR.reserve(n);
+    Er.reserve(n);
+    U.reserve(n);
+    V.reserve(n);
+    x.reserve(n);
+    y.reserve(n);
+  }
+
+  void push_back(const LinCircle& lc) {
+    cotTheta.push_back(lc.cotTheta);
+    iDeltaR.push_back(lc.iDeltaR);
+    Er.push_back(lc.Er);
+    U.push_back(lc.U);
+    V.push_back(lc.V);
+    x.push_back(lc.x);
+    y.push_back(lc.y);
+  }
+};
+
+/// @brief Fill a structure-of-arrays copy of @p linCircleVec in the order
+/// given by @p order.
+///
+/// @param[in] linCircleVec The input LinCircle objects
+/// @param[in] order Indices into @p linCircleVec defining the output order
+/// @param[out] soa The output structure-of-arrays, cleared before filling
+inline void gatherLinCircles(const std::vector<LinCircle>& linCircleVec,
+                             const std::vector<std::size_t>& order,
+                             LinCircleSoA& soa) {
+  soa.clear();
+  soa.reserve(order.size());
+  for (const std::size_t i : order) {
+    soa.push_back(linCircleVec[i]);
+  }
+}
+
 /// @brief Transform two spacepoints to a u-v space circle.
 ///
 /// This function is a non-vectorized version of @a transformCoordinates.
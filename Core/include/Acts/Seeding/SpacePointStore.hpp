@@ -0,0 +1,236 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/EventData/SpacePointData.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @class SpacePointStore
+/// Contiguous, structure-of-arrays copy of the space points stored in a
+/// seeding grid.
+///
+/// The space points of each grid bin occupy a contiguous index range of the
+/// store, in the same order (sorted in radius) as in the grid bin. Doublet
+/// searches can therefore scan a bin by walking linearly through the coordinate
+/// arrays instead of dereferencing one internal space point after the other.
+/// The SeedFinder reads its bottom and top candidates from a store set in
+/// its seeding state.
+///
+/// @tparam external_spacepoint_t The external space point type
+template <typename external_spacepoint_t>
+class SpacePointStore {
+ public:
+  /// Index range [first, second) of the space points of a grid bin
+  using BinRange = std::pair<std::size_t, std::size_t>;
+
+  SpacePointStore() = default;
+
+  /// Fill the store from a grid whose bins hold (smart) pointers to
+  /// InternalSpacePoint objects. Existing content is discarded.
+  ///
+  /// @tparam grid_t The grid type
+  /// @param grid The filled space point grid
+  template <typename grid_t>
+  void fill(const grid_t& grid);
+
+  /// Copy the strip information of the stored space points from the
+  /// auxiliary space point data. This is a no-op if @p spacePointData does not
+  /// contain the strip variables.
+  ///
+  /// @param spacePointData The data indexed by the internal space point index
+  void fillStripInfo(const SpacePointData& spacePointData);
+
+  /// Number of stored space points
+  std::size_t size() const { return m_x.size(); }
+
+  /// Number of grid bins the store was filled from
+  std::size_t nBins() const {
+    return m_binOffsets.empty() ? 0 : m_binOffsets.size() - 1;
+  }
+
+  /// Index range of the space points of a grid bin
+  /// @param globalBin The global bin index in the grid
+  BinRange binRange(std::size_t globalBin) const {
+    return {m_binOffsets[globalBin], m_binOffsets[globalBin + 1]};
+  }
+
+  /// First space point of a grid bin with a radius not smaller than @p r.
+  /// Relies on the space points being sorted in radius within each bin.
+  ///
+  /// @param globalBin The global bin index in the grid
+  /// @param r The radius threshold
+  /// @return The store index, equal to the end of the bin range if none found
+  std::size_t lowerBoundRadius(std::size_t globalBin, float r) const {
+    auto [first, last] = binRange(globalBin);
+    auto begin = m_r.begin();
+    return std::distance(begin,
+                         std::lower_bound(begin + first, begin + last, r));
+  }
+
+  /// @name Per space point accessors
+  /// @{
+  float x(std::size_t i) const { return m_x[i]; }
+  float y(std::size_t i) const { return m_y[i]; }
+  float z(std::size_t i) const { return m_z[i]; }
+  float radius(std::size_t i) const { return m_r[i]; }
+  float phi(std::size_t i) const { return m_phi[i]; }
+  float varianceR(std::size_t i) const { return m_varianceR[i]; }
+  float varianceZ(std::size_t i) const { return m_varianceZ[i]; }
+  std::optional<float> t(std::size_t i) const { return m_t[i]; }
+  /// Index of the space point in the auxiliary SpacePointData
+  std::size_t index(std::size_t i) const { return m_index[i]; }
+  const external_spacepoint_t& sp(std::size_t i) const { return *m_sp[i]; }
+  /// @}
+
+  /// @name Contiguous column access
+  /// @{
+  const std::vector<float>& xs() const { return m_x; }
+  const std::vector<float>& ys() const { return m_y; }
+  const std::vector<float>& zs() const { return m_z; }
+  const std::vector<float>& radii() const { return m_r; }
+  const std::vector<float>& phis() const { return m_phi; }
+  const std::vector<float>& variancesR() const { return m_varianceR; }
+  const std::vector<float>& variancesZ() const { return m_varianceZ; }
+  /// @}
+
+  /// @name Strip information, only available after fillStripInfo
+  /// @{
+  bool hasStripInfo() const { return !m_topStripVector.empty(); }
+  const Vector3& topStripVector(std::size_t i) const {
+    return m_topStripVector[i];
+  }
+  const Vector3& bottomStripVector(std::size_t i) const {
+    return m_bottomStripVector[i];
+  }
+  const Vector3& stripCenterDistance(std::size_t i) const {
+    return m_stripCenterDistance[i];
+  }
+  const Vector3& topStripCenterPosition(std::size_t i) const {
+    return m_topStripCenterPosition[i];
+  }
+  /// @}
+
+  /// Remove all space points and bins
+  void clear();
+
+ private:
+  std::vector<float> m_x;
+  std::vector<float> m_y;
+  std::vector<float> m_z;
+  std::vector<float> m_r;
+  std::vector<float> m_phi;
+  std::vector<float> m_varianceR;
+  std::vector<float> m_varianceZ;
+  std::vector<std::optional<float>> m_t;
+  std::vector<std::size_t> m_index;
+  std::vector<const external_spacepoint_t*> m_sp;
+
+  std::vector<Vector3> m_topStripVector;
+  std::vector<Vector3> m_bottomStripVector;
+  std::vector<Vector3> m_stripCenterDistance;
+  std::vector<Vector3> m_topStripCenterPosition;
+
+  /// Offsets of the bins in the columns, one more entry than bins
+  std::vector<std::size_t> m_binOffsets;
+};
+
+template <typename external_spacepoint_t>
+template <typename grid_t>
+void SpacePointStore<external_spacepoint_t>::fill(const grid_t& grid) {
+  clear();
+
+  const std::size_t nGridBins = grid.size();
+  std::size_t nSpacePoints = 0;
+  for (std::size_t bin = 0; bin < nGridBins; ++bin) {
+    nSpacePoints += grid.at(bin).size();
+  }
+
+  m_x.reserve(nSpacePoints);
+  m_y.reserve(nSpacePoints);
+  m_z.reserve(nSpacePoints);
+  m_r.reserve(nSpacePoints);
+  m_phi.reserve(nSpacePoints);
+  m_varianceR.reserve(nSpacePoints);
+  m_varianceZ.reserve(nSpacePoints);
+  m_t.reserve(nSpacePoints);
+  m_index.reserve(nSpacePoints);
+  m_sp.reserve(nSpacePoints);
+  m_binOffsets.reserve(nGridBins + 1);
+
+  m_binOffsets.push_back(0);
+  for (std::size_t bin = 0; bin < nGridBins; ++bin) {
+    for (const auto& isp : grid.at(bin)) {
+      m_x.push_back(isp->x());
+      m_y.push_back(isp->y());
+      m_z.push_back(isp->z());
+      m_r.push_back(isp->radius());
+      m_phi.push_back(isp->phi());
+      m_varianceR.push_back(isp->varianceR());
+      m_varianceZ.push_back(isp->varianceZ());
+      m_t.push_back(isp->t());
+      m_index.push_back(isp->index());
+      m_sp.push_back(&isp->sp());
+    }
+    m_binOffsets.push_back(m_x.size());
+  }
+}
+
+template <typename external_spacepoint_t>
+void SpacePointStore<external_spacepoint_t>::fillStripInfo(
+    const SpacePointData& spacePointData) {
+  m_topStripVector.clear();
+  m_bottomStripVector.clear();
+  m_stripCenterDistance.clear();
+  m_topStripCenterPosition.clear();
+  if (!spacePointData.hasDynamicVariable()) {
+    return;
+  }
+
+  m_topStripVector.reserve(size());
+  m_bottomStripVector.reserve(size());
+  m_stripCenterDistance.reserve(size());
+  m_topStripCenterPosition.reserve(size());
+  for (const std::size_t idx : m_index) {
+    m_topStripVector.push_back(spacePointData.getTopStripVector(idx));
+    m_bottomStripVector.push_back(spacePointData.getBottomStripVector(idx));
+    m_stripCenterDistance.push_back(spacePointData.getStripCenterDistance(idx));
+    m_topStripCenterPosition.push_back(
+        spacePointData.getTopStripCenterPosition(idx));
+  }
+}
+
+template <typename external_spacepoint_t>
+void SpacePointStore<external_spacepoint_t>::clear() {
+  m_x.clear();
+  m_y.clear();
+  m_z.clear();
+  m_r.clear();
+  m_phi.clear();
+  m_varianceR.clear();
+  m_varianceZ.clear();
+  m_t.clear();
+  m_index.clear();
+  m_sp.clear();
+  m_topStripVector.clear();
+  m_bottomStripVector.clear();
+  m_stripCenterDistance.clear();
+  m_topStripCenterPosition.clear();
+  m_binOffsets.clear();
+}
+
+}  // namespace Acts
@@ -0,0 +1,60 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Seeding/SpacePointStore.hpp"
+
+#include <cstddef>
+
+namespace Acts::detail {
+
+/// Space points of a grid bin, read through the internal space points
+///
+/// @tparam collection_t The grid bin type, holding (smart) pointers to
+///         internal space points
+template <typename collection_t>
+struct GridBinSpacePoints {
+  const collection_t& sps;
+
+  std::size_t size() const { return sps.size(); }
+  float radius(std::size_t i) const { return sps[i]->radius(); }
+  float x(std::size_t i) const { return sps[i]->x(); }
+  float y(std::size_t i) const { return sps[i]->y(); }
+  float z(std::size_t i) const { return sps[i]->z(); }
+  float varianceR(std::size_t i) const { return sps[i]->varianceR(); }
+  float varianceZ(std::size_t i) const { return sps[i]->varianceZ(); }
+  std::size_t index(std::size_t i) const { return sps[i]->index(); }
+  auto* internal(std::size_t i) const { return &*sps[i]; }
+};
+
+/// Space points of a grid bin, read from the columns of a SpacePointStore
+/// filled from the same grid. Only the internal space points of accepted
+/// candidates are accessed through the grid bin.
+///
+/// @tparam external_spacepoint_t The external space point type
+/// @tparam collection_t The grid bin type
+template <typename external_spacepoint_t, typename collection_t>
+struct StoreBinSpacePoints {
+  const SpacePointStore<external_spacepoint_t>& store;
+  /// Store index of the first space point of the bin
+  std::size_t first;
+  const collection_t& sps;
+
+  std::size_t size() const { return sps.size(); }
+  float radius(std::size_t i) const { return store.radius(first + i); }
+  float x(std::size_t i) const { return store.x(first + i); }
+  float y(std::size_t i) const { return store.y(first + i); }
+  float z(std::size_t i) const { return store.z(first + i); }
+  float varianceR(std::size_t i) const { return store.varianceR(first + i); }
+  float varianceZ(std::size_t i) const { return store.varianceZ(first + i); }
+  std::size_t index(std::size_t i) const { return store.index(first + i); }
+  auto* internal(std::size_t i) const { return &*sps[i]; }
+};
+
+}  // namespace Acts::detail
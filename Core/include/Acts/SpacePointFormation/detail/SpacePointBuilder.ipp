@@ -8,6 +8,10 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 
+#include <limits>
+#include <tuple>
+#include <vector>
+
 namespace Acts {
 
 template <typename spacepoint_t>
@@ -97,29 +101,30 @@ void SpacePointBuilder<spacepoint_t>::makeSourceLinkPairs(
   if (slinksFront.empty() || slinksBack.empty()) {
     return;
   }
+  // The global positions only depend on the single measurements, so they
+  // are computed once per source link instead of once per combination
+  auto globalPositions = [&](const std::vector<SourceLink>& slinks) {
+    std::vector<Vector3> positions;
+    positions.reserve(slinks.size());
+    for (const auto& slink : slinks) {
+      const auto [param, cov] = pairOpt.paramCovAccessor(slink);
+      positions.push_back(std::get<0>(m_spUtility->globalCoords(
+          gctx, slink, m_config.slSurfaceAccessor, param, cov)));
+    }
+    return positions;
+  };
+  const std::vector<Vector3> gposFront = globalPositions(slinksFront);
+  const std::vector<Vector3> gposBack = globalPositions(slinksBack);
+
   double minDistance = 0;
   unsigned int closestIndex = 0;
 
   for (unsigned int i = 0; i < slinksFront.size(); i++) {
-    const auto& slinkFront = slinksFront[i];
     minDistance = std::numeric_limits<double>::max();
     closestIndex = slinksBack.size();
     for (unsigned int j = 0; j < slinksBack.size(); j++) {
-      const auto& slinkBack = slinksBack[j];
-
-      const auto [paramFront, covFront] = pairOpt.paramCovAccessor(slinkFront);
-      const auto [gposFront, gtimeFront, gcovFront, gcovtFront] =
-          m_spUtility->globalCoords(gctx, slinkFront,
-                                    m_config.slSurfaceAccessor, paramFront,
-                                    covFront);
-
-      const auto [paramBack, covBack] = pairOpt.paramCovAccessor(slinkBack);
-      const auto [gposBack, gtimeBack, gcovBack, gcovtBack] =
-          m_spUtility->globalCoords(gctx, slinkBack, m_config.slSurfaceAccessor,
-                                    paramBack, covBack);
-
       auto res = m_spUtility->differenceOfMeasurementsChecked(
-          gposFront, gposBack, pairOpt.vertex, pairOpt.diffDist,
+          gposFront[i], gposBack[j], pairOpt.vertex, pairOpt.diffDist,
           pairOpt.diffPhi2, pairOpt.diffTheta2);
       if (!res.ok()) {
         continue;
@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Acts {
 
@@ -185,6 +186,32 @@ class DiscSurface : public RegularSurface {
       const GeometryContext& gctx, const Vector3& position,
       double tolerance = s_onSurfaceTolerance) const final;
 
+  /// Local to global transformation of many positions at once, the
+  /// transform is only fetched once
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param lpositions local 2D positions in specialized surface frame
+  /// @param positions the global positions, resized to match @p lpositions
+  void localToGlobalBatch(const GeometryContext& gctx,
+                          const std::vector<Vector2>& lpositions,
+                          std::vector<Vector3>& positions) const final;
+
+  /// Global to local transformation of many positions at once, the inverse
+  /// transform is only computed once
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param positions global 3D positions - considered to be on surface but
+  /// not inside bounds (check is done)
+  /// @param lpositions the local positions, resized to match @p positions
+  /// @param tolerance optional tolerance within which a point is considered
+  /// valid on surface
+  ///
+  /// @return a Result<void> which is !ok() if any position is not on surface
+  Result<void> globalToLocalBatch(
+      const GeometryContext& gctx, const std::vector<Vector3>& positions,
+      std::vector<Vector2>& lpositions,
+      double tolerance = s_onSurfaceTolerance) const final;
+
   /// Special method for DiscSurface : local<->local transformations polar <->
   /// cartesian
   ///
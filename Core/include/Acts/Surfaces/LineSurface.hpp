@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Acts {
 
@@ -190,6 +191,38 @@ class LineSurface : public Surface {
       const Vector3& direction,
       double tolerance = s_onSurfaceTolerance) const final;
 
+  /// Local to global transformation of many positions at once, the line
+  /// direction and center are only computed once
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param lpositions the local positions to be transformed
+  /// @param directions the global momentum directions, one per position
+  /// @param positions the global positions, resized to match @p lpositions
+  ///
+  /// @throws std::invalid_argument if the number of directions does not match
+  void localToGlobalBatch(const GeometryContext& gctx,
+                          const std::vector<Vector2>& lpositions,
+                          const std::vector<Vector3>& directions,
+                          std::vector<Vector3>& positions) const;
+
+  /// Global to local transformation of many positions at once, the line
+  /// direction and center are only computed once
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param positions global 3D positions - considered to be on surface but
+  /// not inside bounds (check is done)
+  /// @param directions the global momentum directions, one per position
+  /// @param lpositions the local positions, resized to match @p positions
+  /// @param tolerance the tolerance for the on-surface check
+  ///
+  /// @throws std::invalid_argument if the number of directions does not match
+  /// @return a Result<void> which is !ok() if any position is not the point
+  /// of closest approach to the line surface
+  Result<void> globalToLocalBatch(
+      const GeometryContext& gctx, const std::vector<Vector3>& positions,
+      const std::vector<Vector3>& directions, std::vector<Vector2>& lpositions,
+      double tolerance = s_onSurfaceTolerance) const;
+
   /// Calculate the straight-line intersection with the line surface.
   ///
   /// <b>Mathematical motivation:</b>
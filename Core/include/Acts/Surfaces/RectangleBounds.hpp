@@ -15,6 +15,7 @@
 
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <iosfwd>
 #include <limits>
 #include <stdexcept>
@@ -84,6 +85,18 @@ class RectangleBounds : public PlanarBounds {
   bool inside(const Vector2& lposition,
               const BoundaryCheck& bcheck) const final;
 
+  /// Inside check for a batch of local positions
+  ///
+  /// The absolute check is a comparison with the rectangle grown by the
+  /// tolerances, evaluated without branches.
+  ///
+  /// @param lpositions Local positions (assumed to be in right surface frame)
+  /// @param n Number of local positions
+  /// @param bcheck boundary check directive
+  /// @param [out] results Inside flags, has to provide space for n entries
+  void insideBatch(const Vector2* lpositions, std::size_t n,
+                   const BoundaryCheck& bcheck, bool* results) const final;
+
   /// Return the vertices
   ///
   /// @param lseg the number of segments used to approximate
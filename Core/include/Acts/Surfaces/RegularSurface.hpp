@@ -11,6 +11,8 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/ThrowAssert.hpp"
 
+#include <vector>
+
 namespace Acts {
 
 /// A physical surface which does not depend on the direction you look at it
@@ -97,5 +99,37 @@ class RegularSurface : public Surface {
   /// @return The global position by value
   virtual Vector3 localToGlobal(const GeometryContext& gctx,
                                 const Vector2& lposition) const = 0;
+
+  /// Local to global transformation of many positions at once.
+  ///
+  /// The default implementation calls @ref localToGlobal for every position,
+  /// specialized surfaces fetch the transform only once and convert all
+  /// positions in a single pass.
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param lpositions local 2D positions in specialized surface frame
+  /// @param positions the global positions, resized to match @p lpositions
+  virtual void localToGlobalBatch(const GeometryContext& gctx,
+                                  const std::vector<Vector2>& lpositions,
+                                  std::vector<Vector3>& positions) const;
+
+  /// Convert many global positions to local ones at once.
+  ///
+  /// The default implementation calls @ref globalToLocal for every position,
+  /// specialized surfaces fetch the transform only once and convert all
+  /// positions in a single pass.
+  ///
+  /// @note All @p positions are required to be on-surface, a failure is
+  ///       returned if any is not. The local positions of those are
+  ///       unspecified.
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param positions the global positions to be converted
+  /// @param lpositions the local positions, resized to match @p positions
+  /// @param tolerance is the tolerance for the on-surface check
+  /// @return Result which is not ok if any position is not on the surface
+  virtual Result<void> globalToLocalBatch(
+      const GeometryContext& gctx, const std::vector<Vector3>& positions,
+      std::vector<Vector2>& lpositions,
+      double tolerance = s_onSurfaceTolerance) const;
 };
 }  // namespace Acts
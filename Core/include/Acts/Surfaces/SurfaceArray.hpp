@@ -13,16 +13,58 @@
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/IAxis.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace Acts {
 
 using SurfaceVector = std::vector<const Surface*>;
 
+/// @brief Read-only view of contiguously stored surface pointers
+///
+/// Returned by the neighbor lookup of the @c SurfaceArray, which keeps the
+/// candidates of all bins in one array.
+class SurfaceSpan {
+ public:
+  using value_type = const Surface*;
+  using const_iterator = const value_type*;
+  using iterator = const_iterator;
+
+  SurfaceSpan() = default;
+
+  /// @param begin pointer to the first surface
+  /// @param end pointer behind the last surface
+  SurfaceSpan(const_iterator begin, const_iterator end)
+      : m_begin(begin), m_end(end) {}
+
+  /// @param surfaces the surfaces to view, they must outlive the view
+  SurfaceSpan(const SurfaceVector& surfaces)
+      : m_begin(surfaces.data()), m_end(surfaces.data() + surfaces.size()) {}
+
+  const_iterator begin() const { return m_begin; }
+  const_iterator end() const { return m_end; }
+  std::size_t size() const { return m_end - m_begin; }
+  bool empty() const { return m_begin == m_end; }
+  value_type operator[](std::size_t i) const { return m_begin[i]; }
+
+  /// Copy of the viewed surfaces, this allocates
+  operator SurfaceVector() const { return SurfaceVector(m_begin, m_end); }
+
+ private:
+  const_iterator m_begin = nullptr;
+  const_iterator m_end = nullptr;
+};
+
 /// @brief Provides Surface binning in N dimensions
 ///
 /// Uses @c Grid under the hood to implement the storage and lookup
@@ -50,6 +92,17 @@ class SurfaceArray {
     virtual std::size_t completeBinning(const GeometryContext& gctx,
                                         const SurfaceVector& surfaces) = 0;
 
+    /// @brief Moves surfaces whose placement changed to their new bins
+    ///
+    /// @param gctx The geometry context with the new placements
+    /// @param moved The surfaces which have been moved
+    /// @param surfaces All surfaces of the lookup, to redo the binning
+    ///        completion with
+    /// @return number of surfaces that changed their bin
+    virtual std::size_t update(const GeometryContext& gctx,
+                               const SurfaceVector& moved,
+                               const SurfaceVector& surfaces) = 0;
+
     /// @brief Performs lookup at @c pos and returns bin content as reference
     /// @param position Lookup position
     /// @return @c SurfaceVector at given bin
@@ -76,8 +129,8 @@ class SurfaceArray {
     /// @brief Performs a lookup at @c pos, but returns neighbors as well
     ///
     /// @param position Lookup position
-    /// @return @c SurfaceVector at given bin. Copy of all bins selected
-    virtual const SurfaceVector& neighbors(const Vector3& position) const = 0;
+    /// @return the surfaces of the bin at @c pos and of its neighbors
+    virtual SurfaceSpan neighbors(const Vector3& position) const = 0;
 
     /// @brief Returns the total size of the grid (including under/overflow
     /// bins)
@@ -133,6 +186,8 @@ class SurfaceArray {
     /// @param localToGlobal Callable that converts from local to global
     /// @param axes The axes to build the grid data structure.
     /// @param bValues What the axes represent (optional)
+    /// @note The bins are filled and completed by up to @c Acts::maxThreads
+    ///       threads, the callables must be safe to call concurrently.
     /// @note Signature of localToGlobal and globalToLocal depends on @c DIM.
     ///       If DIM > 1, local coords are @c ActsVector<DIM> else
     ///       @c std::array<double, 1>.
@@ -144,14 +199,14 @@ class SurfaceArray {
           m_localToGlobal(std::move(localToGlobal)),
           m_grid(std::move(axes)),
           m_binValues(std::move(bValues)) {
-      m_neighborMap.resize(m_grid.size());
+      m_neighborOffsets.assign(m_grid.size() + 1, 0);
     }
 
     /// @brief Fill provided surfaces into the contained @c Grid.
     ///
     /// This is done by iterating, accessing the binningPosition, lookup
     /// and append.
-    /// Also populates the neighbor map by combining the filled bins of
+    /// Also populates the neighbor cache by combining the filled bins of
     /// all bins around a given one.
     ///
     /// @param gctx The current geometry context object, e.g. alignment
@@ -159,8 +214,9 @@ class SurfaceArray {
     void fill(const GeometryContext& gctx,
               const SurfaceVector& surfaces) override {
       for (const auto& srf : surfaces) {
-        Vector3 pos = srf->binningPosition(gctx, binR);
-        lookup(pos).push_back(srf);
+        std::size_t bin = binOf(gctx, *srf);
+        m_grid.at(bin).push_back(srf);
+        m_surfaceBins[srf] = bin;
       }
 
       populateNeighborCache();
@@ -177,38 +233,123 @@ class SurfaceArray {
                                 const SurfaceVector& surfaces) override {
       std::size_t binCompleted = 0;
       std::size_t nBins = size();
-      double minPath = 0;
-      double curPath = 0;
-      const Surface* minSrf = nullptr;
+
+      // The closest surface search dominates, it is done for the bins in
+      // parallel and the results are filled in afterwards
+      const std::vector<Vector3> positions = binningPositions(gctx, surfaces);
+      std::vector<char> complete(nBins, 0);
+      std::vector<const Surface*> closest(nBins, nullptr);
+      forEachBinRange(
+          nBinRanges(),
+          [&](std::size_t /*range*/, std::size_t begin, std::size_t end) {
+            for (std::size_t b = begin; b < end; ++b) {
+              // only complete if we have an empty bin
+              if (!isValidBin(b) || !m_grid.at(b).empty()) {
+                continue;
+              }
+              complete[b] = 1;
+              closest[b] = closestSurface(b, surfaces, positions);
+            }
+          });
 
       for (std::size_t b = 0; b < nBins; ++b) {
-        if (!isValidBin(b)) {
+        if (complete[b] == 0) {
           continue;
         }
-        std::vector<const Surface*>& binContent = lookup(b);
-        // only complete if we have an empty bin
-        if (!binContent.empty()) {
+        m_grid.at(b).push_back(closest[b]);
+        m_completedBins[b] = closest[b];
+        ++binCompleted;
+      }
+      m_completeBinning = true;
+
+      // recreate neighborcache
+      populateNeighborCache();
+      return binCompleted;
+    }
+
+    /// @brief Moves surfaces whose placement changed to their new bins
+    ///
+    /// Only the bins the surfaces leave or enter, the completed bins and the
+    /// neighbor cache around them are recomputed. The result is the same as
+    /// filling (and completing) a new lookup with the new placements.
+    ///
+    /// @param gctx The geometry context with the new placements
+    /// @param moved The surfaces which have been moved
+    /// @param surfaces All surfaces of the lookup, to redo the binning
+    ///        completion with
+    /// @return number of surfaces that changed their bin
+    std::size_t update(const GeometryContext& gctx, const SurfaceVector& moved,
+                       const SurfaceVector& surfaces) override {
+      std::size_t nChanged = 0;
+      std::vector<std::size_t> changedBins;
+      for (const Surface* srf : moved) {
+        auto it = m_surfaceBins.find(srf);
+        if (it == m_surfaceBins.end()) {
           continue;
         }
+        std::size_t bin = binOf(gctx, *srf);
+        if (bin == it->second) {
+          continue;
+        }
+        eraseOne(m_grid.at(it->second), srf);
+        m_grid.at(bin).push_back(srf);
+        changedBins.push_back(it->second);
+        changedBins.push_back(bin);
+        it->second = bin;
+        ++nChanged;
+      }
 
-        Vector3 binCtr = getBinCenter(b);
-        minPath = std::numeric_limits<double>::max();
-        for (const auto& srf : surfaces) {
-          curPath = (binCtr - srf->binningPosition(gctx, binR)).norm();
-
-          if (curPath < minPath) {
-            minPath = curPath;
-            minSrf = srf;
+      // The closest surface of the completed bins can change with any move,
+      // and bins can be emptied or filled
+      if (m_completeBinning && !moved.empty()) {
+        std::vector<std::size_t> candidates = changedBins;
+        for (const auto& [bin, srf] : m_completedBins) {
+          candidates.push_back(bin);
+        }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                         candidates.end());
+        const std::vector<Vector3> positions =
+            binningPositions(gctx, surfaces);
+        std::unordered_map<std::size_t, const Surface*> completedBins;
+        for (std::size_t bin : candidates) {
+          if (!isValidBin(bin)) {
+            continue;
+          }
+          SurfaceVector& binContent = m_grid.at(bin);
+          const Surface* oldSrf = nullptr;
+          if (auto it = m_completedBins.find(bin);
+              it != m_completedBins.end()) {
+            oldSrf = it->second;
+            eraseOne(binContent, oldSrf);
+          }
+          const Surface* newSrf = nullptr;
+          if (binContent.empty()) {
+            newSrf = closestSurface(bin, surfaces, positions);
+            binContent.push_back(newSrf);
+            completedBins[bin] = newSrf;
+          }
+          if (newSrf != oldSrf) {
+            changedBins.push_back(bin);
           }
         }
-
-        binContent.push_back(minSrf);
-        ++binCompleted;
+        m_completedBins = std::move(completedBins);
       }
 
-      // recreate neighborcache
-      populateNeighborCache();
-      return binCompleted;
+      // Only the neighborhoods of changed bins see a different content
+      std::vector<std::size_t> neighborBins;
+      for (std::size_t bin : changedBins) {
+        auto neighborIdxs =
+            m_grid.neighborHoodIndices(m_grid.localBinsFromGlobalBin(bin), 1u);
+        for (const auto idx : neighborIdxs) {
+          neighborBins.push_back(idx);
+        }
+      }
+      std::sort(neighborBins.begin(), neighborBins.end());
+      neighborBins.erase(std::unique(neighborBins.begin(), neighborBins.end()),
+                         neighborBins.end());
+      updateNeighborCache(neighborBins);
+      return nChanged;
     }
 
     /// @brief Performs lookup at @c pos and returns bin content as reference
@@ -243,10 +384,13 @@ class SurfaceArray {
     /// @brief Performs a lookup at @c pos, but returns neighbors as well
     ///
     /// @param position Lookup position
-    /// @return @c SurfaceVector at given bin. Copy of all bins selected
-    const SurfaceVector& neighbors(const Vector3& position) const override {
+    /// @return the surfaces of the bin at @c pos and of its neighbors
+    SurfaceSpan neighbors(const Vector3& position) const override {
       auto lposition = m_globalToLocal(position);
-      return m_neighborMap.at(m_grid.globalBinFromPosition(lposition));
+      std::size_t bin = m_grid.globalBinFromPosition(lposition);
+      const Surface* const* data = m_neighborSurfaces.data();
+      return SurfaceSpan(data + m_neighborOffsets.at(bin),
+                         data + m_neighborOffsets.at(bin + 1));
     }
 
     /// @brief Returns the total size of the grid (including under/overflow
@@ -298,23 +442,141 @@ class SurfaceArray {
     }
 
    private:
+    /// Minimal number of bins processed by one thread
+    static constexpr std::size_t s_minBinsPerThread = 256;
+
+    /// Rebuild the neighbor cache of all bins
+    ///
+    /// The candidates of each range of bins are collected in parallel and
+    /// concatenated in bin order, such that the bin boundaries are given by
+    /// the offsets of the counts.
     void populateNeighborCache() {
-      // calculate neighbors for every bin and store in map
-      for (std::size_t i = 0; i < m_grid.size(); i++) {
-        if (!isValidBin(i)) {
-          continue;
+      const std::size_t nBins = m_grid.size();
+      const std::size_t nRanges = nBinRanges();
+      std::vector<SurfaceVector> rangeSurfaces(nRanges);
+      m_neighborOffsets.assign(nBins + 1, 0);
+      forEachBinRange(nRanges, [&](std::size_t range, std::size_t begin,
+                                   std::size_t end) {
+        SurfaceVector& surfaces = rangeSurfaces[range];
+        for (std::size_t bin = begin; bin < end; ++bin) {
+          const std::size_t nBefore = surfaces.size();
+          appendNeighbors(bin, surfaces);
+          m_neighborOffsets[bin + 1] = surfaces.size() - nBefore;
         }
-        typename Grid_t::index_t loc = m_grid.localBinsFromGlobalBin(i);
-        auto neighborIdxs = m_grid.neighborHoodIndices(loc, 1u);
-        std::vector<const Surface*>& neighbors = m_neighborMap.at(i);
-        neighbors.clear();
+      });
+      std::partial_sum(m_neighborOffsets.begin(), m_neighborOffsets.end(),
+                       m_neighborOffsets.begin());
 
-        for (const auto idx : neighborIdxs) {
-          const std::vector<const Surface*>& binContent = m_grid.at(idx);
-          std::copy(binContent.begin(), binContent.end(),
-                    std::back_inserter(neighbors));
+      if (nRanges == 1) {
+        m_neighborSurfaces = std::move(rangeSurfaces.front());
+        return;
+      }
+      m_neighborSurfaces.clear();
+      m_neighborSurfaces.reserve(m_neighborOffsets.back());
+      for (const SurfaceVector& surfaces : rangeSurfaces) {
+        m_neighborSurfaces.insert(m_neighborSurfaces.end(), surfaces.begin(),
+                                  surfaces.end());
+      }
+    }
+
+    /// Recompute the neighbor cache of some bins in place, the cache is
+    /// only rebuilt if their number of candidates changes
+    void updateNeighborCache(const std::vector<std::size_t>& bins) {
+      SurfaceVector surfaces;
+      for (std::size_t bin : bins) {
+        surfaces.clear();
+        appendNeighbors(bin, surfaces);
+        const std::size_t offset = m_neighborOffsets.at(bin);
+        if (surfaces.size() != m_neighborOffsets.at(bin + 1) - offset) {
+          populateNeighborCache();
+          return;
+        }
+        std::copy(surfaces.begin(), surfaces.end(),
+                  m_neighborSurfaces.begin() + offset);
+      }
+    }
+
+    /// Append the surfaces of a bin and its neighbors
+    void appendNeighbors(std::size_t bin, SurfaceVector& neighbors) const {
+      if (!isValidBin(bin)) {
+        return;
+      }
+      typename Grid_t::index_t loc = m_grid.localBinsFromGlobalBin(bin);
+      auto neighborIdxs = m_grid.neighborHoodIndices(loc, 1u);
+      const auto first = static_cast<std::ptrdiff_t>(neighbors.size());
+
+      // surfaces spanning several bins are only added once, so that they
+      // are not intersected repeatedly during the navigation
+      for (const auto idx : neighborIdxs) {
+        const std::vector<const Surface*>& binContent = m_grid.at(idx);
+        for (const Surface* srf : binContent) {
+          if (std::find(neighbors.begin() + first, neighbors.end(), srf) ==
+              neighbors.end()) {
+            neighbors.push_back(srf);
+          }
+        }
+      }
+    }
+
+    /// Number of bin ranges processed in parallel
+    std::size_t nBinRanges() const {
+      return std::clamp<std::size_t>(
+          maxThreads(), 1u,
+          std::max<std::size_t>(m_grid.size() / s_minBinsPerThread, 1u));
+    }
+
+    /// Split the bins into contiguous ranges processed by separate threads
+    ///
+    /// @param nRanges The number of ranges
+    /// @param f Callable with the range index, the first and the end bin
+    void forEachBinRange(
+        std::size_t nRanges,
+        const std::function<void(std::size_t, std::size_t, std::size_t)>& f)
+        const {
+      const std::size_t nBins = m_grid.size();
+      const std::size_t rangeSize = (nBins + nRanges - 1) / nRanges;
+      parallelFor(nRanges, [&](std::size_t range) {
+        f(range, std::min(range * rangeSize, nBins),
+          std::min((range + 1) * rangeSize, nBins));
+      });
+    }
+
+    std::size_t binOf(const GeometryContext& gctx, const Surface& srf) const {
+      return m_grid.globalBinFromPosition(
+          m_globalToLocal(srf.binningPosition(gctx, binR)));
+    }
+
+    static std::vector<Vector3> binningPositions(
+        const GeometryContext& gctx, const SurfaceVector& surfaces) {
+      std::vector<Vector3> positions;
+      positions.reserve(surfaces.size());
+      for (const auto& srf : surfaces) {
+        positions.push_back(srf->binningPosition(gctx, binR));
+      }
+      return positions;
+    }
+
+    const Surface* closestSurface(
+        std::size_t bin, const SurfaceVector& surfaces,
+        const std::vector<Vector3>& positions) const {
+      Vector3 binCtr = getBinCenter(bin);
+      double minPath = std::numeric_limits<double>::max();
+      const Surface* minSrf = nullptr;
+      for (std::size_t i = 0; i < surfaces.size(); ++i) {
+        double curPath = (binCtr - positions[i]).norm();
+        if (curPath < minPath) {
+          minPath = curPath;
+          minSrf = surfaces[i];
         }
       }
+      return minSrf;
+    }
+
+    static void eraseOne(SurfaceVector& surfaces, const Surface* srf) {
+      auto it = std::find(surfaces.begin(), surfaces.end(), srf);
+      if (it != surfaces.end()) {
+        surfaces.erase(it);
+      }
     }
 
     /// Internal method.
@@ -345,7 +607,15 @@ class SurfaceArray {
     std::function<Vector3(const point_t&)> m_localToGlobal;
     Grid_t m_grid;
     std::vector<BinningValue> m_binValues;
-    std::vector<SurfaceVector> m_neighborMap;
+    // the neighbor candidates of all bins, those of bin i are stored between
+    // the offsets i and i + 1
+    std::vector<std::size_t> m_neighborOffsets;
+    SurfaceVector m_neighborSurfaces;
+    // the bin each surface was filled into
+    std::unordered_map<const Surface*, std::size_t> m_surfaceBins;
+    // the closest surface each empty bin was completed with
+    std::unordered_map<std::size_t, const Surface*> m_completedBins;
+    bool m_completeBinning = false;
   };
 
   /// @brief Lookup implementation which wraps one element and always returns
@@ -383,8 +653,8 @@ class SurfaceArray {
     }
 
     /// @brief Lookup, always returns @c element
-    /// @return reference to vector containing only @c element
-    const SurfaceVector& neighbors(const Vector3& /*position*/) const override {
+    /// @return view of the vector containing only @c element
+    SurfaceSpan neighbors(const Vector3& /*position*/) const override {
       return m_element;
     }
 
@@ -418,6 +688,14 @@ class SurfaceArray {
       return 0;
     }
 
+    /// @brief Comply with concept and provide update method
+    /// @note Does nothing
+    std::size_t update(const GeometryContext& /*gctx*/,
+                       const SurfaceVector& /*moved*/,
+                       const SurfaceVector& /*surfaces*/) override {
+      return 0;
+    }
+
     /// @brief Returns if the bin is valid (it is)
     /// @return always true
     bool isValidBin(std::size_t /*bin*/) const override { return true; }
@@ -470,14 +748,23 @@ class SurfaceArray {
 
   /// @brief Get all surfaces in bin at @p pos and its neighbors
   /// @param position The position to lookup as nominal
-  /// @return Merged @c SurfaceVector of neighbors and nominal
-  /// @note The @c SurfaceVector will be combined. For technical reasons, the
-  ///       different bin content vectors have to be copied, so the resulting
-  ///       vector contains copies.
-  const SurfaceVector& neighbors(const Vector3& position) const {
+  /// @return View of the merged surfaces of neighbors and nominal
+  /// @note The merged surfaces of all bins are precomputed and stored in
+  ///       one contiguous array, the view is valid until the lookup is
+  ///       updated.
+  SurfaceSpan neighbors(const Vector3& position) const {
     return p_gridLookup->neighbors(position);
   }
 
+  /// @brief Update the binning after surfaces have been moved, e.g. by
+  /// alignment, without rebuilding the lookup
+  /// @param gctx The geometry context with the new placements
+  /// @param moved The surfaces of this array which have been moved
+  /// @return number of surfaces that changed their bin
+  std::size_t update(const GeometryContext& gctx, const SurfaceVector& moved) {
+    return p_gridLookup->update(gctx, moved, m_surfacesRawPointers);
+  }
+
   /// @brief Get the size of the underlying grid structure including
   /// under/overflow bins
   /// @return the size
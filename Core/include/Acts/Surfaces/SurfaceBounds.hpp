@@ -10,6 +10,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 
+#include <cstddef>
 #include <ostream>
 
 namespace Acts {
@@ -68,6 +69,23 @@ class SurfaceBounds {
   virtual bool inside(const Vector2& lposition,
                       const BoundaryCheck& bcheck) const = 0;
 
+  /// Inside check for a batch of local positions
+  ///
+  /// The default implementation calls inside() for every position. Bounds
+  /// with a simple shape override it with a loop without branches, which
+  /// the compiler can vectorize for the absolute boundary checks.
+  ///
+  /// @param lpositions Local positions (assumed to be in right surface frame)
+  /// @param n Number of local positions
+  /// @param bcheck boundary check directive
+  /// @param [out] results Inside flags, has to provide space for n entries
+  virtual void insideBatch(const Vector2* lpositions, std::size_t n,
+                           const BoundaryCheck& bcheck, bool* results) const {
+    for (std::size_t i = 0; i < n; ++i) {
+      results[i] = inside(lpositions[i], bcheck);
+    }
+  }
+
   /// Output Method for std::ostream, to be overloaded by child classes
   ///
   /// @param os is the outstream in which the string dump is done
@@ -0,0 +1,76 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryContext.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+/// @brief Binary snapshot of a collection of surfaces
+///
+/// The snapshot stores the geometry identifier, surface type, bounds values
+/// and transform of each surface in a compact binary layout, such that the
+/// surfaces of a detector can be reconstituted without the geometry backend
+/// (e.g. DD4hep or TGeo) they were originally built from. Identical bounds
+/// are written once and shared again by the read surfaces.
+///
+/// The layout is
+///   - magic bytes "ACTSSNAP" and a 32 bit format version
+///   - the number of bounds, then per bounds the bounds type, the number of
+///     values and the values
+///   - the number of surfaces, then per surface the geometry identifier,
+///     the surface type, the index of its bounds and the 3x4 transform
+///
+/// @note The values are written in the native byte order, a snapshot can
+///       only be read on a machine with the same endianness.
+/// @note Surface material is not part of the snapshot.
+namespace SurfaceSnapshot {
+
+/// The current version of the format
+static constexpr std::uint32_t s_version = 1;
+
+/// Write the snapshot of surfaces to a stream
+///
+/// @param os the output stream, should be opened in binary mode
+/// @param gctx the geometry context for the transforms
+/// @param surfaces the surfaces to be written
+///
+/// @throws std::invalid_argument for surfaces of unsupported type
+void write(std::ostream& os, const GeometryContext& gctx,
+           const std::vector<const Surface*>& surfaces);
+
+/// Read the surfaces from a snapshot in memory, e.g. a memory mapped file
+///
+/// @param data the beginning of the snapshot
+/// @param size the size of the snapshot in bytes
+///
+/// @throws std::runtime_error for a corrupt or incompatible snapshot
+///
+/// @return the surfaces in the order they were written
+std::vector<std::shared_ptr<Surface>> read(const char* data, std::size_t size);
+
+/// Read the surfaces from a snapshot stream
+///
+/// @param is the input stream, should be opened in binary mode
+///
+/// @throws std::runtime_error for a corrupt or incompatible snapshot
+///
+/// @return the surfaces in the order they were written
+std::vector<std::shared_ptr<Surface>> read(std::istream& is);
+
+}  // namespace SurfaceSnapshot
+}  // namespace Acts
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <iosfwd>
 #include <stdexcept>
 #include <vector>
@@ -106,6 +107,19 @@ class TrapezoidBounds : public PlanarBounds {
   bool inside(const Vector2& lposition,
               const BoundaryCheck& bcheck) const final;
 
+  /// Inside check for a batch of local positions
+  ///
+  /// For the absolute check the cases (1) to (3) are decided for all
+  /// positions without branches, only the positions in the triangles
+  /// (4) and (5) are checked individually.
+  ///
+  /// @param lpositions Local positions (assumed to be in right surface frame)
+  /// @param n Number of local positions
+  /// @param bcheck boundary check directive
+  /// @param [out] results Inside flags, has to provide space for n entries
+  void insideBatch(const Vector2* lpositions, std::size_t n,
+                   const BoundaryCheck& bcheck, bool* results) const final;
+
   /// Return the vertices
   ///
   /// @param lseg the number of segments used to approximate
@@ -38,6 +38,7 @@
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/TraceSpans.hpp"
 #include "Acts/Utilities/Zip.hpp"
 
 #include <functional>
@@ -88,6 +89,8 @@ struct CombinatorialKalmanFilterExtensions {
   using BranchStopper =
       Delegate<BranchStopperResult(const CombinatorialKalmanFilterTipState&,
                                    typename traj_t::TrackStateProxy&)>;
+  using SourceLinkPreSelector =
+      Delegate<bool(const BoundTrackParameters&, const SourceLink&)>;
 
   /// The Calibrator is a dedicated calibration algorithm that allows to
   /// calibrate measurements using track information, this could be e.g. sagging
@@ -105,6 +108,12 @@ struct CombinatorialKalmanFilterExtensions {
   /// The branch stopper is called during the filtering by the Actor.
   BranchStopper branchStopper{DelegateFuncTag<voidBranchStopper>{}};
 
+  /// The optional source link pre-selector is called with the predicted
+  /// parameters before the calibration. Only the compatible source links are
+  /// calibrated and passed to the measurement selector. If none of the source
+  /// links on a surface is compatible, all of them are calibrated.
+  SourceLinkPreSelector sourceLinkPreSelector;
+
  private:
   /// Default measurement selector which will return all measurements
   /// @param candidates Measurement track state candidates
@@ -133,14 +142,29 @@ using SourceLinkAccessorDelegate =
     Delegate<std::pair<source_link_iterator_t, source_link_iterator_t>(
         const Surface&)>;
 
+/// Delegate type that narrows the range of source links on a surface down to
+/// the ones compatible with the predicted track parameters. Only the source
+/// links in the returned range are calibrated and tested by the measurement
+/// selector.
+template <typename source_link_iterator_t>
+using SourceLinkWindowDelegate =
+    Delegate<std::pair<source_link_iterator_t, source_link_iterator_t>(
+        const BoundTrackParameters&, source_link_iterator_t,
+        source_link_iterator_t)>;
+
 /// Combined options for the combinatorial Kalman filter.
 ///
 /// @tparam source_link_iterator_t Type of the source link iterator
 /// @tparam traj_t Type of the trajectory
-template <typename source_link_iterator_t, typename traj_t>
+/// @tparam extensions_t Type of the extensions, the members can be bound at
+///         compile time (see @c StaticDelegate) to allow inlining the calls
+template <typename source_link_iterator_t, typename traj_t,
+          typename extensions_t = CombinatorialKalmanFilterExtensions<traj_t>>
 struct CombinatorialKalmanFilterOptions {
   using SourceLinkIterator = source_link_iterator_t;
+  using Extensions = extensions_t;
   using SourceLinkAccessor = SourceLinkAccessorDelegate<source_link_iterator_t>;
+  using SourceLinkWindow = SourceLinkWindowDelegate<source_link_iterator_t>;
 
   /// PropagatorOptions with context
   ///
@@ -155,8 +179,7 @@ struct CombinatorialKalmanFilterOptions {
   CombinatorialKalmanFilterOptions(
       const GeometryContext& gctx, const MagneticFieldContext& mctx,
       std::reference_wrapper<const CalibrationContext> cctx,
-      SourceLinkAccessor accessor_,
-      CombinatorialKalmanFilterExtensions<traj_t> extensions_,
+      SourceLinkAccessor accessor_, extensions_t extensions_,
       const PropagatorPlainOptions& pOptions, bool mScattering = true,
       bool eLoss = true)
       : geoContext(gctx),
@@ -181,8 +204,13 @@ struct CombinatorialKalmanFilterOptions {
   /// The source link accessor
   SourceLinkAccessor sourcelinkAccessor;
 
+  /// Optional window on the source links of a surface, which is applied to
+  /// the range given by the accessor once the track is bound to the surface.
+  /// If the window is empty, all source links of the surface are used.
+  SourceLinkWindow sourceLinkWindow;
+
   /// The filter extensions
-  CombinatorialKalmanFilterExtensions<traj_t> extensions;
+  extensions_t extensions;
 
   /// The trivial propagator options
   PropagatorPlainOptions propagatorPlainOptions;
@@ -197,8 +225,31 @@ struct CombinatorialKalmanFilterOptions {
 
   /// Whether to consider energy loss.
   bool energyLoss = true;
+
+  /// Whether to only keep the track states of the found tracks.
+  /// The track states are then created in a temporary trajectory, and only
+  /// the ones reachable from the found tips are appended to the output at the
+  /// end. Prefixes and components shared between the found tracks stay
+  /// shared, and the states of the dropped branches are discarded. This is
+  /// ignored if the trajectory does not support appending selected states.
+  bool compactTrackStates = false;
 };
 
+namespace detail {
+
+/// Whether a trajectory can append selected states of another one
+template <typename traj_t, typename = void>
+struct SupportsSelectiveAppend : std::false_type {};
+
+template <typename traj_t>
+struct SupportsSelectiveAppend<
+    traj_t, std::void_t<decltype(std::declval<traj_t&>().append(
+                std::declval<const traj_t&>(),
+                std::declval<const std::vector<TrackIndexType>&>()))>>
+    : std::true_type {};
+
+}  // namespace detail
+
 template <typename traj_t>
 struct CombinatorialKalmanFilterResult {
   /// Fitted states that the actor has handled.
@@ -289,12 +340,14 @@ class CombinatorialKalmanFilter {
 
   /// @brief Propagator Actor plugin for the CombinatorialKalmanFilter
   ///
-  /// @tparam source_link_accessor_t The type of source link accessor
+  /// @tparam source_link_iterator_t The type of the source link iterator
   /// @tparam parameters_t The type of parameters used for "local" parameters.
+  /// @tparam extensions_t The type of the extensions
   ///
   /// The CombinatorialKalmanFilter Actor does not rely on the measurements to
   /// be sorted along the track.
-  template <typename source_link_accessor_t, typename parameters_t>
+  template <typename source_link_iterator_t, typename parameters_t,
+            typename extensions_t>
   class Actor {
    public:
     using TipState = CombinatorialKalmanFilterTipState;
@@ -508,6 +561,16 @@ class CombinatorialKalmanFilter {
         auto& [boundParams, jacobian, pathLength] = boundState;
         boundParams.covariance() = state.stepping.cov;
 
+        // Skip the source links outside the window around the prediction
+        if (m_sourceLinkWindow.connected()) {
+          auto [windowBegin, windowEnd] =
+              m_sourceLinkWindow(boundParams, slBegin, slEnd);
+          if (windowBegin != windowEnd) {
+            slBegin = windowBegin;
+            slEnd = windowEnd;
+          }
+        }
+
         // Retrieve the previous tip and its state
         // The states created on this surface will have the common previous tip
         std::size_t prevTip = kTrackIndexInvalid;
@@ -696,7 +759,6 @@ class CombinatorialKalmanFilter {
     /// @param prevTip Index pointing at previous trajectory state (i.e. tip)
     /// @param slBegin Begin iterator for sourcelinks
     /// @param slEnd End iterator for sourcelinks
-    template <typename source_link_iterator_t>
     void createSourceLinkTrackStates(const Acts::GeometryContext& gctx,
                                      result_type& result,
                                      const BoundState& boundState,
@@ -717,16 +779,15 @@ class CombinatorialKalmanFilter {
 
       using PM = TrackStatePropMask;
 
-      // Calibrate all the source links on the surface since the selection has
+      // Calibrate the source links on the surface since the selection has
       // to be done based on calibrated measurement
-      for (auto it = slBegin; it != slEnd; ++it) {
-        // get the source link
-        const auto sourceLink = *it;
+      auto calibrate = [&](const SourceLink& sourceLink) {
+        const bool isFirst = result.trackStateCandidates.empty();
 
         // prepare the track state
         PM mask = PM::Predicted | PM::Jacobian | PM::Calibrated;
 
-        if (it != slBegin) {
+        if (!isFirst) {
           // not the first TrackState, only need uncalibrated and calibrated
           mask = PM::Calibrated;
         }
@@ -737,7 +798,7 @@ class CombinatorialKalmanFilter {
         // fail!
         auto ts = result.stateBuffer->makeTrackState(mask, prevTip);
 
-        if (it == slBegin) {
+        if (isFirst) {
           // only set these for first
           ts.predicted() = boundParams.parameters();
           if (boundParams.covariance()) {
@@ -759,6 +820,22 @@ class CombinatorialKalmanFilter {
         m_extensions.calibrator(gctx, *calibrationContextPtr, sourceLink, ts);
 
         result.trackStateCandidates.push_back(ts);
+      };
+
+      // Skip the calibration of the source links which are not compatible
+      // with the prediction, unless there is none
+      const bool preSelect = m_extensions.sourceLinkPreSelector.connected();
+      for (auto it = slBegin; it != slEnd; ++it) {
+        const auto sourceLink = *it;
+        if (!preSelect ||
+            m_extensions.sourceLinkPreSelector(boundParams, sourceLink)) {
+          calibrate(sourceLink);
+        }
+      }
+      if (result.trackStateCandidates.empty()) {
+        for (auto it = slBegin; it != slEnd; ++it) {
+          calibrate(*it);
+        }
       }
     }
 
@@ -1031,10 +1108,13 @@ class CombinatorialKalmanFilter {
       }
     }
 
-    CombinatorialKalmanFilterExtensions<traj_t> m_extensions;
+    extensions_t m_extensions;
 
     /// The source link accessor
-    source_link_accessor_t m_sourcelinkAccessor;
+    SourceLinkAccessorDelegate<source_link_iterator_t> m_sourcelinkAccessor;
+
+    /// The optional window on the source links of a surface
+    SourceLinkWindowDelegate<source_link_iterator_t> m_sourceLinkWindow;
 
     /// End of world aborter
     EndOfWorldReached endOfWorldReached;
@@ -1047,11 +1127,13 @@ class CombinatorialKalmanFilter {
     const Logger& logger() const { return *actorLogger; }
   };
 
-  template <typename source_link_accessor_t, typename parameters_t>
+  template <typename source_link_iterator_t, typename parameters_t,
+            typename extensions_t>
   class Aborter {
    public:
     /// Broadcast the action type
-    using action_type = Actor<source_link_accessor_t, parameters_t>;
+    using action_type =
+        Actor<source_link_iterator_t, parameters_t, extensions_t>;
 
     template <typename propagator_state_t, typename stepper_t,
               typename navigator_t, typename result_t>
@@ -1089,6 +1171,7 @@ class CombinatorialKalmanFilter {
   /// @tparam measurement_selector_t Type of the measurement selector
   /// @tparam track_container_t Type of the track container backend
   /// @tparam holder_t Type defining track container backend ownership
+  /// @tparam extensions_t Type of the extensions
   /// @tparam parameters_t Type of parameters used for local parameters
   ///
   /// @param initialParameters The initial track parameters
@@ -1103,23 +1186,23 @@ class CombinatorialKalmanFilter {
   /// parameters
   template <typename source_link_iterator_t, typename start_parameters_t,
             typename track_container_t, template <typename> class holder_t,
-            typename parameters_t = BoundTrackParameters>
+            typename extensions_t, typename parameters_t = BoundTrackParameters>
   auto findTracks(
       const start_parameters_t& initialParameters,
-      const CombinatorialKalmanFilterOptions<source_link_iterator_t, traj_t>&
-          tfOptions,
+      const CombinatorialKalmanFilterOptions<source_link_iterator_t, traj_t,
+                                             extensions_t>& tfOptions,
       TrackContainer<track_container_t, traj_t, holder_t>& trackContainer) const
       -> Result<std::vector<
           typename std::decay_t<decltype(trackContainer)>::TrackProxy>> {
+    ACTS_TRACE_SPAN("CombinatorialKalmanFilter::findTracks");
+
     using TrackContainer = typename std::decay_t<decltype(trackContainer)>;
-    using SourceLinkAccessor =
-        SourceLinkAccessorDelegate<source_link_iterator_t>;
 
     // Create the ActionList and AbortList
     using CombinatorialKalmanFilterAborter =
-        Aborter<SourceLinkAccessor, parameters_t>;
+        Aborter<source_link_iterator_t, parameters_t, extensions_t>;
     using CombinatorialKalmanFilterActor =
-        Actor<SourceLinkAccessor, parameters_t>;
+        Actor<source_link_iterator_t, parameters_t, extensions_t>;
     using Actors = ActionList<CombinatorialKalmanFilterActor>;
     using Aborters = AbortList<CombinatorialKalmanFilterAborter>;
 
@@ -1142,14 +1225,24 @@ class CombinatorialKalmanFilter {
 
     // copy source link accessor, calibrator and measurement selector
     combKalmanActor.m_sourcelinkAccessor = tfOptions.sourcelinkAccessor;
+    combKalmanActor.m_sourceLinkWindow = tfOptions.sourceLinkWindow;
     combKalmanActor.m_extensions = tfOptions.extensions;
 
     auto propState =
         m_propagator.template makeState(initialParameters, propOptions);
 
+    constexpr bool canCompact = detail::SupportsSelectiveAppend<traj_t>::value;
+    const bool compact = canCompact && tfOptions.compactTrackStates;
+
     auto& r = propState.template get<CombinatorialKalmanFilterResult<traj_t>>();
-    r.fittedStates = &trackContainer.trackStateContainer();
     r.stateBuffer = std::make_shared<traj_t>();
+    std::shared_ptr<traj_t> compactBuffer;
+    if (compact) {
+      compactBuffer = std::make_shared<traj_t>();
+      r.fittedStates = compactBuffer.get();
+    } else {
+      r.fittedStates = &trackContainer.trackStateContainer();
+    }
 
     auto propagationResult = m_propagator.propagate(propState);
 
@@ -1190,12 +1283,36 @@ class CombinatorialKalmanFilter {
                  << initialParameters.parameters());
     }
 
+    // Move the states of the found tracks to the output, the indices of the
+    // result refer to the temporary trajectory until then
+    std::vector<TrackIndexType> outputIndices;
+    if constexpr (canCompact) {
+      if (compact) {
+        std::vector<bool> reachable(compactBuffer->size(), false);
+        for (auto tip : combKalmanResult.lastMeasurementIndices) {
+          for (auto istate = tip;
+               istate != kTrackIndexInvalid && !reachable[istate];
+               istate = compactBuffer->getTrackState(istate).previous()) {
+            reachable[istate] = true;
+          }
+        }
+        std::vector<TrackIndexType> istates;
+        for (std::size_t istate = 0; istate < reachable.size(); ++istate) {
+          if (reachable[istate]) {
+            istates.push_back(istate);
+          }
+        }
+        outputIndices = trackContainer.trackStateContainer().append(
+            *compactBuffer, istates);
+      }
+    }
+
     std::vector<typename TrackContainer::TrackProxy> tracks;
     tracks.reserve(combKalmanResult.lastMeasurementIndices.size());
 
     for (auto tip : combKalmanResult.lastMeasurementIndices) {
       auto track = trackContainer.makeTrack();
-      track.tipIndex() = tip;
+      track.tipIndex() = compact ? outputIndices[tip] : tip;
 
       // Set fitted track parameters if available. This will only be the case if
       // a target surface is set. Without a target surface there cannot be
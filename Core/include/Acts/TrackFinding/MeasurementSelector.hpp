@@ -20,6 +20,7 @@
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <iterator>
@@ -27,6 +28,8 @@
 #include <utility>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 namespace Acts {
 
 /// Selection cuts for associating measurements with predicted track
@@ -110,6 +113,19 @@ class MeasurementSelector {
                        false>::Projector projector,
       unsigned int calibratedSize) const;
 
+  /// Compute the chi2 of measurements with the same dimension and projector
+  /// against one predicted state, which is projected only once.
+  void calculateChi2(
+      const double* const* fullCalibrated,
+      const double* const* fullCalibratedCovariance, std::size_t size,
+      TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                       false>::Parameters predicted,
+      TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                       false>::Covariance predictedCovariance,
+      TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                       false>::Projector projector,
+      unsigned int calibratedSize, double* chi2) const;
+
   Config m_config;
 };
 
@@ -54,28 +54,72 @@ MeasurementSelector::select(
 
   isOutlier = false;
 
+  // The candidates on a surface usually share the predicted parameters and
+  // come from one detector type. If they also share the projector, the
+  // prediction is projected once and the chi2 is computed in one batch.
+  auto& first = candidates.front();
+  bool batch = candidates.size() > 1;
+  for (std::size_t i(1ul); batch && i < candidates.size(); ++i) {
+    const auto& trackState = candidates[i];
+    batch = trackState.calibratedSize() == first.calibratedSize() &&
+            trackState.projectorBitset() == first.projectorBitset() &&
+            trackState.predicted().data() == first.predicted().data() &&
+            trackState.predictedCovariance().data() ==
+                first.predictedCovariance().data();
+  }
+
+  if (batch) {
+    boost::container::small_vector<const double*, 32> calibrated;
+    boost::container::small_vector<const double*, 32> calibratedCovariance;
+    boost::container::small_vector<double, 32> chi2(candidates.size());
+    calibrated.reserve(candidates.size());
+    calibratedCovariance.reserve(candidates.size());
+    for (auto& trackState : candidates) {
+      // This abuses an incorrectly sized vector / matrix to access the
+      // data pointer! This works (don't use the matrix as is!), but be
+      // careful!
+      calibrated.push_back(
+          trackState
+              .template calibrated<MultiTrajectoryTraits::MeasurementSizeMax>()
+              .data());
+      calibratedCovariance.push_back(
+          trackState
+              .template calibratedCovariance<
+                  MultiTrajectoryTraits::MeasurementSizeMax>()
+              .data());
+    }
+    calculateChi2(calibrated.data(), calibratedCovariance.data(),
+                  candidates.size(), first.predicted(),
+                  first.predictedCovariance(), first.projector(),
+                  first.calibratedSize(), chi2.data());
+    for (std::size_t i(0ul); i < candidates.size(); ++i) {
+      candidates[i].chi2() = chi2[i];
+    }
+  } else {
+    for (auto& trackState : candidates) {
+      // This abuses an incorrectly sized vector / matrix to access the
+      // data pointer! This works (don't use the matrix as is!), but be
+      // careful!
+      trackState.chi2() = calculateChi2(
+          trackState
+              .template calibrated<MultiTrajectoryTraits::MeasurementSizeMax>()
+              .data(),
+          trackState
+              .template calibratedCovariance<
+                  MultiTrajectoryTraits::MeasurementSizeMax>()
+              .data(),
+          trackState.predicted(), trackState.predictedCovariance(),
+          trackState.projector(), trackState.calibratedSize());
+    }
+  }
+
   // Loop over all measurements to select the compatible measurements
   // Sort track states which do not satisfy the chi2 cut to the end.
   // When done trackStateIterEnd will point to the first element that
   // does not satisfy the chi2 cut.
   std::size_t passedCandidates = 0ul;
   for (std::size_t i(0ul); i < candidates.size(); ++i) {
-    auto& trackState = candidates[i];
-
-    // This abuses an incorrectly sized vector / matrix to access the
-    // data pointer! This works (don't use the matrix as is!), but be
-    // careful!
-    double chi2 = calculateChi2(
-        trackState
-            .template calibrated<MultiTrajectoryTraits::MeasurementSizeMax>()
-            .data(),
-        trackState
-            .template calibratedCovariance<
-                MultiTrajectoryTraits::MeasurementSizeMax>()
-            .data(),
-        trackState.predicted(), trackState.predictedCovariance(),
-        trackState.projector(), trackState.calibratedSize());
-    trackState.chi2() = chi2;
+    const double chi2 = candidates[i].chi2();
 
     if (chi2 < minChi2) {
       minChi2 = chi2;
@@ -111,17 +155,23 @@ MeasurementSelector::select(
                                           candidates.begin() + minIndex + 1));
   }
 
-  std::sort(
-      candidates.begin(), candidates.begin() + passedCandidates,
-      [](const auto& tsa, const auto& tsb) { return tsa.chi2() < tsb.chi2(); });
+  auto chi2Less = [](const auto& tsa, const auto& tsb) {
+    return tsa.chi2() < tsb.chi2();
+  };
 
   if (passedCandidates <= numMeasurementsCut) {
+    std::sort(candidates.begin(), candidates.begin() + passedCandidates,
+              chi2Less);
     ACTS_VERBOSE("Number of selected measurements: "
                  << passedCandidates << ", max: " << numMeasurementsCut);
     return Result::success(std::make_pair(
         candidates.begin(), candidates.begin() + passedCandidates));
   }
 
+  // only the best candidates are returned, the rest need not be ordered
+  std::partial_sort(candidates.begin(), candidates.begin() + numMeasurementsCut,
+                    candidates.begin() + passedCandidates, chi2Less);
+
   ACTS_VERBOSE("Number of selected measurements: "
                << numMeasurementsCut << ", max: " << numMeasurementsCut);
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/EventData/TrackStateType.hpp"
+#include "Acts/EventData/Types.hpp"
 #include "Acts/Geometry/GeometryHierarchyMap.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 
@@ -17,12 +18,31 @@
 #include <limits>
 #include <numeric>
 #include <ostream>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
 
 namespace Acts {
 
+namespace detail {
+
+/// Whether a track backend can append selected tracks of another one
+template <typename output_backend_t, typename input_backend_t,
+          typename = void>
+struct SupportsTrackSelectionAppend : std::false_type {};
+
+template <typename output_backend_t, typename input_backend_t>
+struct SupportsTrackSelectionAppend<
+    output_backend_t, input_backend_t,
+    std::void_t<decltype(std::declval<output_backend_t&>().append(
+        std::declval<const input_backend_t&>(),
+        std::declval<const std::vector<TrackIndexType>&>()))>>
+    : std::true_type {};
+
+}  // namespace detail
+
 /// Class which performs filtering of tracks. It accepts an input and an output
 /// track container and uses the built-in copy facility to copy tracks into the
 /// output container.
@@ -214,6 +234,10 @@ class TrackSelector {
 
   /// Select tracks from an input container and copy them into an output
   /// container
+  /// @note If the backend of the output container can append a selection of
+  ///       the input backend, the selected tracks are copied in bulk column
+  ///       by column, otherwise track by track. The copied tracks keep
+  ///       pointing to the track states of the input container.
   /// @tparam input_tracks_t is the type of the input track container
   /// @tparam output_tracks_t is the type of the output track container
   /// @param inputTracks is the input track container
@@ -222,6 +246,14 @@ class TrackSelector {
   void selectTracks(const input_tracks_t& inputTracks,
                     output_tracks_t& outputTracks) const;
 
+  /// Get the indices of the valid tracks of a container
+  /// @tparam track_container_t is the type of the track container
+  /// @param tracks is the track container
+  /// @return the indices of the valid tracks in ascending order
+  template <typename track_container_t>
+  std::vector<TrackIndexType> selectTrackIndices(
+      const track_container_t& tracks) const;
+
   /// Helper function to check if a track is valid
   /// @tparam track_proxy_t is the type of the track proxy
   /// @param track is the track proxy
@@ -377,16 +409,37 @@ inline std::ostream& operator<<(std::ostream& os,
 template <typename input_tracks_t, typename output_tracks_t>
 void TrackSelector::selectTracks(const input_tracks_t& inputTracks,
                                  output_tracks_t& outputTracks) const {
-  for (auto track : inputTracks) {
-    if (!isValidTrack(track)) {
-      continue;
+  using InputBackend = std::decay_t<decltype(inputTracks.container())>;
+  using OutputBackend = std::decay_t<decltype(outputTracks.container())>;
+
+  const std::vector<TrackIndexType> selected = selectTrackIndices(inputTracks);
+
+  if constexpr (detail::SupportsTrackSelectionAppend<OutputBackend,
+                                                     InputBackend>::value) {
+    outputTracks.container().append(inputTracks.container(), selected);
+  } else {
+    for (TrackIndexType itrack : selected) {
+      auto track = inputTracks.getTrack(itrack);
+      auto destProxy = outputTracks.makeTrack();
+      destProxy.copyFrom(track, false);
+      destProxy.tipIndex() = track.tipIndex();
     }
-    auto destProxy = outputTracks.makeTrack();
-    destProxy.copyFrom(track, false);
-    destProxy.tipIndex() = track.tipIndex();
   }
 }
 
+template <typename track_container_t>
+std::vector<TrackIndexType> TrackSelector::selectTrackIndices(
+    const track_container_t& tracks) const {
+  std::vector<TrackIndexType> selected;
+  selected.reserve(tracks.size());
+  for (auto track : tracks) {
+    if (isValidTrack(track)) {
+      selected.push_back(track.index());
+    }
+  }
+  return selected;
+}
+
 template <typename track_proxy_t>
 bool TrackSelector::isValidTrack(const track_proxy_t& track) const {
   auto checkMin = [](auto x, auto min) { return min <= x; };
@@ -423,20 +476,26 @@ bool TrackSelector::isValidTrack(const track_proxy_t& track) const {
 
   const Config& cuts = *cutsPtr;
 
-  return track.hasReferenceSurface() &&
-         within(track.transverseMomentum(), cuts.ptMin, cuts.ptMax) &&
-         (m_noEtaCuts || (within(absEta(), cuts.absEtaMin, cuts.absEtaMax) &&
-                          within(_eta, cuts.etaMin, cuts.etaMax))) &&
-         within(track.phi(), cuts.phiMin, cuts.phiMax) &&
-         within(track.loc0(), cuts.loc0Min, cuts.loc0Max) &&
-         within(track.loc1(), cuts.loc1Min, cuts.loc1Max) &&
-         within(track.time(), cuts.timeMin, cuts.timeMax) &&
-         checkMin(track.nMeasurements(), cuts.minMeasurements) &&
-         checkMax(track.nHoles(), cuts.maxHoles) &&
-         checkMax(track.nOutliers(), cuts.maxOutliers) &&
-         checkMax(track.nSharedHits(), cuts.maxSharedHits) &&
-         checkMax(track.chi2(), cuts.maxChi2) &&
-         cuts.measurementCounter.isValidTrack(track);
+  // The quantities are cheap to read, so all cuts are evaluated without
+  // short-circuiting which leaves a single branch to be mispredicted
+  bool valid = track.hasReferenceSurface();
+  if (!m_noEtaCuts) {
+    valid &= within(absEta(), cuts.absEtaMin, cuts.absEtaMax);
+    valid &= within(_eta, cuts.etaMin, cuts.etaMax);
+  }
+  valid &= within(track.transverseMomentum(), cuts.ptMin, cuts.ptMax);
+  valid &= within(track.phi(), cuts.phiMin, cuts.phiMax);
+  valid &= within(track.loc0(), cuts.loc0Min, cuts.loc0Max);
+  valid &= within(track.loc1(), cuts.loc1Min, cuts.loc1Max);
+  valid &= within(track.time(), cuts.timeMin, cuts.timeMax);
+  valid &= checkMin(track.nMeasurements(), cuts.minMeasurements);
+  valid &= checkMax(track.nHoles(), cuts.maxHoles);
+  valid &= checkMax(track.nOutliers(), cuts.maxOutliers);
+  valid &= checkMax(track.nSharedHits(), cuts.maxSharedHits);
+  valid &= checkMax(track.chi2(), cuts.maxChi2);
+
+  // The measurement counter loops over the track states
+  return valid && cuts.measurementCounter.isValidTrack(track);
 }
 
 inline TrackSelector::TrackSelector(
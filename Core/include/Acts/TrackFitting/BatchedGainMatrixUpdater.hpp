@@ -0,0 +1,248 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/TrackFitting/KalmanFitterError.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace Acts {
+
+/// Kalman update step using the gain matrix formalism for many track states
+/// at once.
+///
+/// The track states are sorted by measurement dimension into
+/// structure-of-arrays buffers, in which each matrix element of all track
+/// states is contiguous. The update then runs in loops over the track
+/// states of a buffer, which the compiler can vectorise. Only one and two
+/// dimensional measurements with a projector that selects bound parameters
+/// take this path, all other track states are passed to
+/// @c GainMatrixUpdater one by one.
+///
+/// The buffers are kept between calls, so an updater should be reused for
+/// the track states of many events, but must not be shared between threads.
+class BatchedGainMatrixUpdater {
+ public:
+  /// Structure-of-arrays storage for the track states of one measurement
+  /// dimension. Component @c c of track state @c t is at @c c * size + t.
+  struct Batch {
+    std::size_t measurementSize = 0;
+    std::size_t size = 0;
+    /// Predicted parameters, updated to the filtered ones
+    std::vector<double> parameters;
+    /// Predicted covariance, updated to the filtered one
+    std::vector<double> covariance;
+    /// Projected columns of the covariance, i.e. P H^T
+    std::vector<double> covarianceColumns;
+    /// Projected rows of the covariance, i.e. H P
+    std::vector<double> covarianceRows;
+    /// Projected covariance H P H^T
+    std::vector<double> projectedCovariance;
+    /// Calibrated measurement covariance
+    std::vector<double> measurementCovariance;
+    /// Predicted residual
+    std::vector<double> residual;
+    /// Scratch space for the inverse residual covariance and the gain matrix
+    std::vector<double> inverseResidualCovariance;
+    std::vector<double> gain;
+    std::vector<double> chi2;
+    std::vector<std::uint8_t> valid;
+
+    /// Resize the buffers for a number of track states
+    /// @param dim The measurement dimension of the batch
+    /// @param n The number of track states
+    void resize(std::size_t dim, std::size_t n);
+  };
+
+  /// Run the Kalman update step for a set of track states.
+  ///
+  /// @tparam traj_t The track state container backend
+  /// @param[in] gctx The geometry context
+  /// @param[in,out] trackStates The track states to update, which have to be
+  ///                calibrated and have predicted and filtered storage
+  /// @param[out] errors The result of each update, an empty error code for
+  ///             a successful one
+  /// @param[in] direction The navigation direction
+  /// @param[in] logger Where to write logging information to
+  template <typename traj_t>
+  void operator()(
+      const GeometryContext& gctx,
+      const std::vector<typename traj_t::TrackStateProxy>& trackStates,
+      std::vector<std::error_code>& errors,
+      Direction direction = Direction::Forward,
+      const Logger& logger = getDummyLogger()) {
+    constexpr std::size_t kFallback = 0;
+
+    errors.assign(trackStates.size(), std::error_code{});
+    m_slots.resize(trackStates.size());
+
+    // Sort the track states by measurement dimension and count them
+    std::array<std::size_t, kMaxBatchedSize + 1> counts{};
+    for (std::size_t i = 0; i < trackStates.size(); ++i) {
+      const auto& trackState = trackStates[i];
+      std::size_t dim = trackState.calibratedSize();
+      auto& slot = m_slots[i];
+      slot.dim = kFallback;
+      if (dim <= kMaxBatchedSize &&
+          selectedParameters(trackState.projector(), dim, slot.indices)) {
+        slot.dim = dim;
+        slot.index = counts[dim]++;
+      }
+    }
+
+    for (std::size_t dim = 1; dim <= kMaxBatchedSize; ++dim) {
+      m_batches[dim - 1].resize(dim, counts[dim]);
+    }
+
+    GainMatrixUpdater updater;
+    for (std::size_t i = 0; i < trackStates.size(); ++i) {
+      const auto& slot = m_slots[i];
+      if (slot.dim == kFallback) {
+        auto res = updater.template operator()<traj_t>(gctx, trackStates[i],
+                                                        direction, logger);
+        if (!res.ok()) {
+          errors[i] = res.error();
+        }
+        continue;
+      }
+      pack(m_batches[slot.dim - 1], slot, trackStates[i]);
+    }
+
+    for (std::size_t dim = 1; dim <= kMaxBatchedSize; ++dim) {
+      ACTS_VERBOSE("Batched update of " << counts[dim] << " track states with "
+                                        << dim << "D measurements");
+      update(m_batches[dim - 1]);
+    }
+
+    for (std::size_t i = 0; i < trackStates.size(); ++i) {
+      const auto& slot = m_slots[i];
+      if (slot.dim == kFallback) {
+        continue;
+      }
+      const Batch& batch = m_batches[slot.dim - 1];
+      if (batch.valid[slot.index] == 0) {
+        errors[i] = (direction == Direction::Forward)
+                        ? KalmanFitterError::ForwardUpdateFailed
+                        : KalmanFitterError::BackwardUpdateFailed;
+        continue;
+      }
+      unpack(batch, slot, trackStates[i]);
+    }
+  }
+
+ private:
+  static constexpr std::size_t kMaxBatchedSize = 2;
+
+  struct Slot {
+    std::size_t dim = 0;
+    std::size_t index = 0;
+    std::array<std::uint8_t, kMaxBatchedSize> indices{};
+  };
+
+  /// Find the bound parameters selected by the rows of a projector
+  /// @return false if a row does not select exactly one parameter
+  template <typename projector_t>
+  static bool selectedParameters(
+      const projector_t& projector, std::size_t dim,
+      std::array<std::uint8_t, kMaxBatchedSize>& indices) {
+    for (std::size_t row = 0; row < dim; ++row) {
+      std::size_t nSelected = 0;
+      for (std::size_t col = 0; col < eBoundSize; ++col) {
+        if (projector(row, col) == 1) {
+          indices[row] = static_cast<std::uint8_t>(col);
+          ++nSelected;
+        } else if (projector(row, col) != 0) {
+          return false;
+        }
+      }
+      if (nSelected != 1) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename track_state_proxy_t>
+  static void pack(Batch& batch, const Slot& slot,
+                   const track_state_proxy_t& trackState) {
+    const std::size_t n = batch.size;
+    const std::size_t t = slot.index;
+    const std::size_t dim = slot.dim;
+
+    const auto predicted = trackState.predicted();
+    const auto covariance = trackState.predictedCovariance();
+    const double* calibrated =
+        trackState
+            .template calibrated<MultiTrajectoryTraits::MeasurementSizeMax>()
+            .data();
+    const double* calibratedCovariance =
+        trackState
+            .template calibratedCovariance<
+                MultiTrajectoryTraits::MeasurementSizeMax>()
+            .data();
+
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      batch.parameters[i * n + t] = predicted[i];
+      for (std::size_t j = 0; j < eBoundSize; ++j) {
+        batch.covariance[(i * eBoundSize + j) * n + t] = covariance(i, j);
+      }
+      for (std::size_t k = 0; k < dim; ++k) {
+        batch.covarianceColumns[(i * dim + k) * n + t] =
+            covariance(i, slot.indices[k]);
+        batch.covarianceRows[(k * eBoundSize + i) * n + t] =
+            covariance(slot.indices[k], i);
+      }
+    }
+    // the calibrated covariance is stored column major with dim rows
+    for (std::size_t k = 0; k < dim; ++k) {
+      batch.residual[k * n + t] = calibrated[k] - predicted[slot.indices[k]];
+      for (std::size_t l = 0; l < dim; ++l) {
+        batch.projectedCovariance[(k * dim + l) * n + t] =
+            covariance(slot.indices[k], slot.indices[l]);
+        batch.measurementCovariance[(k * dim + l) * n + t] =
+            calibratedCovariance[l * dim + k];
+      }
+    }
+  }
+
+  template <typename track_state_proxy_t>
+  static void unpack(const Batch& batch, const Slot& slot,
+                     track_state_proxy_t trackState) {
+    const std::size_t n = batch.size;
+    const std::size_t t = slot.index;
+
+    auto filtered = trackState.filtered();
+    auto filteredCovariance = trackState.filteredCovariance();
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      filtered[i] = batch.parameters[i * n + t];
+      for (std::size_t j = 0; j < eBoundSize; ++j) {
+        filteredCovariance(i, j) =
+            batch.covariance[(i * eBoundSize + j) * n + t];
+      }
+    }
+    trackState.chi2() = batch.chi2[t];
+  }
+
+  /// Run the update on all track states of a batch
+  static void update(Batch& batch);
+
+  std::array<Batch, kMaxBatchedSize> m_batches;
+  std::vector<Slot> m_slots;
+};
+
+}  // namespace Acts
@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <boost/container/static_vector.hpp>
 
@@ -126,6 +127,97 @@ class AtlasBetheHeitlerApprox {
   double m_lowLimit = 0.10;
   double m_highLimit = 0.20;
 
+  /// Optional mixtures on a uniform grid in x/x0, NComponents per grid point
+  std::vector<detail::GaussianComponent> m_lowTable;
+  std::vector<detail::GaussianComponent> m_highTable;
+
+  using Array =
+      boost::container::static_vector<detail::GaussianComponent, NComponents>;
+
+  /// Evaluate a polynom with the Horner scheme
+  static ActsScalar poly(ActsScalar xx,
+                         const std::array<ActsScalar, PolyDegree + 1> &coeffs) {
+    ActsScalar sum{0.};
+    for (const auto c : coeffs) {
+      sum = xx * sum + c;
+    }
+    assert((std::isfinite(sum) && "polynom result not finite"));
+    return sum;
+  }
+
+  /// Build the components from the polynomials
+  static Array makeMixture(const Data &data, double xx, bool transform) {
+    // Value initialization should garanuee that all is initialized to zero
+    Array ret(NComponents);
+    ActsScalar weight_sum = 0;
+    for (int i = 0; i < NComponents; ++i) {
+      // These transformations must be applied to the data according to ATHENA
+      // (TrkGaussianSumFilter/src/GsfCombinedMaterialEffects.cxx:79)
+      if (transform) {
+        ret[i] = detail::inverseTransformComponent(
+            poly(xx, data[i].weightCoeffs), poly(xx, data[i].meanCoeffs),
+            poly(xx, data[i].varCoeffs));
+      } else {
+        ret[i].weight = poly(xx, data[i].weightCoeffs);
+        ret[i].mean = poly(xx, data[i].meanCoeffs);
+        ret[i].var = poly(xx, data[i].varCoeffs);
+      }
+
+      weight_sum += ret[i].weight;
+    }
+
+    for (int i = 0; i < NComponents; ++i) {
+      ret[i].weight /= weight_sum;
+    }
+
+    return ret;
+  }
+
+  static std::vector<detail::GaussianComponent> makeTable(
+      const Data &data, bool transform, double xMin, double xMax,
+      std::size_t nBins) {
+    // a range without width, e.g. in the default parametrization, only
+    // needs the value at its limit
+    if (!(xMax > xMin)) {
+      nBins = 0;
+    }
+    std::vector<detail::GaussianComponent> table;
+    table.reserve((nBins + 1) * NComponents);
+    for (std::size_t bin = 0; bin <= nBins; ++bin) {
+      const double x =
+          nBins == 0 ? xMax : xMin + (xMax - xMin) * bin / nBins;
+      for (const auto &cmp : makeMixture(data, x, transform)) {
+        table.push_back(cmp);
+      }
+    }
+    return table;
+  }
+
+  /// Interpolate linearly between the two grid points around x. Since the
+  /// weights at each grid point sum up to 1, so do the interpolated ones.
+  static Array interpolate(const std::vector<detail::GaussianComponent> &table,
+                           double xMin, double xMax, double x) {
+    constexpr auto nCmps = static_cast<std::size_t>(NComponents);
+    const std::size_t nBins = table.size() / nCmps - 1;
+    if (nBins == 0) {
+      return Array(table.begin(), table.end());
+    }
+    const double pos = (x - xMin) / (xMax - xMin) * nBins;
+    const std::size_t bin =
+        std::min(static_cast<std::size_t>(std::max(pos, 0.)), nBins - 1);
+    const double f = pos - bin;
+
+    Array ret(NComponents);
+    for (std::size_t i = 0; i < nCmps; ++i) {
+      const auto &a = table[bin * nCmps + i];
+      const auto &b = table[(bin + 1) * nCmps + i];
+      ret[i].weight = a.weight + f * (b.weight - a.weight);
+      ret[i].mean = a.mean + f * (b.mean - a.mean);
+      ret[i].var = a.var + f * (b.var - a.var);
+    }
+    return ret;
+  }
+
  public:
   /// Construct the Bethe-Heitler approximation description with two
   /// parameterizations, one for lower ranges, one for higher ranges.
@@ -157,52 +249,27 @@ class AtlasBetheHeitlerApprox {
   /// @param x pathlength in terms of the radiation length
   constexpr bool validXOverX0(ActsScalar x) const { return x < m_highLimit; }
 
+  /// Precompute the mixtures on a uniform grid in x/x0 for the low and the
+  /// high range. Afterwards @ref mixture interpolates linearly between the
+  /// grid points instead of evaluating the polynomials for every component.
+  ///
+  /// @param nBins number of grid intervals per range
+  void useLookupTable(std::size_t nBins = 1000) {
+    assert(nBins > 0 && "need at least one bin");
+    m_lowTable = makeTable(m_lowData, m_lowTransform, m_singleGaussianLimit,
+                           m_lowLimit, nBins);
+    m_highTable = makeTable(m_highData, m_highTransform, m_lowLimit,
+                            m_highLimit, nBins);
+  }
+
+  /// Whether @ref mixture uses the precomputed tables
+  bool usesLookupTable() const { return !m_lowTable.empty(); }
+
   /// Generates the mixture from the polynomials and reweights them, so
   /// that the sum of all weights is 1
   ///
   /// @param x pathlength in terms of the radiation length
   auto mixture(ActsScalar x) const {
-    using Array =
-        boost::container::static_vector<detail::GaussianComponent, NComponents>;
-    // Build a polynom
-    auto poly = [](ActsScalar xx,
-                   const std::array<ActsScalar, PolyDegree + 1> &coeffs) {
-      ActsScalar sum{0.};
-      for (const auto c : coeffs) {
-        sum = xx * sum + c;
-      }
-      assert((std::isfinite(sum) && "polynom result not finite"));
-      return sum;
-    };
-
-    // Lambda which builds the components
-    auto make_mixture = [&](const Data &data, double xx, bool transform) {
-      // Value initialization should garanuee that all is initialized to zero
-      Array ret(NComponents);
-      ActsScalar weight_sum = 0;
-      for (int i = 0; i < NComponents; ++i) {
-        // These transformations must be applied to the data according to ATHENA
-        // (TrkGaussianSumFilter/src/GsfCombinedMaterialEffects.cxx:79)
-        if (transform) {
-          ret[i] = detail::inverseTransformComponent(
-              poly(xx, data[i].weightCoeffs), poly(xx, data[i].meanCoeffs),
-              poly(xx, data[i].varCoeffs));
-        } else {
-          ret[i].weight = poly(xx, data[i].weightCoeffs);
-          ret[i].mean = poly(xx, data[i].meanCoeffs);
-          ret[i].var = poly(xx, data[i].varCoeffs);
-        }
-
-        weight_sum += ret[i].weight;
-      }
-
-      for (int i = 0; i < NComponents; ++i) {
-        ret[i].weight /= weight_sum;
-      }
-
-      return ret;
-    };
-
     // Return no change
     if (x < m_noChangeLimit) {
       Array ret(1);
@@ -221,12 +288,18 @@ class AtlasBetheHeitlerApprox {
     }
     // Return a component representation for lower x0
     if (x < m_lowLimit) {
-      return make_mixture(m_lowData, x, m_lowTransform);
+      if (!m_lowTable.empty()) {
+        return interpolate(m_lowTable, m_singleGaussianLimit, m_lowLimit, x);
+      }
+      return makeMixture(m_lowData, x, m_lowTransform);
     }
     // Return a component representation for higher x0
     // Cap the x because beyond the parameterization goes wild
     const auto high_x = std::min(m_highLimit, x);
-    return make_mixture(m_highData, high_x, m_highTransform);
+    if (!m_highTable.empty()) {
+      return interpolate(m_highTable, m_lowLimit, m_highLimit, high_x);
+    }
+    return makeMixture(m_highData, high_x, m_highTransform);
   }
 
   /// Loads a parameterization from a file according to the Atlas file
@@ -0,0 +1,107 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+namespace Acts {
+
+/// The phases of the track fitters which can be timed
+enum class FitterPhase : std::size_t {
+  ePropagation = 0,
+  eCalibration = 1,
+  eUpdate = 2,
+  eSmoothing = 3,
+  eMixtureReduction = 4,
+};
+
+/// @brief Opt-in wall time accounting of the track fitter phases.
+///
+/// The fitters mark their phases with @c ACTS_FITTER_TIMER, which expands to
+/// nothing unless @c ACTS_ENABLE_FITTER_TIMERS is defined when the fitter is
+/// compiled. The fitters are header only, so the timers are enabled per
+/// target, e.g. for a benchmark. The times are accumulated per thread.
+///
+/// @note The phases can be nested. The calibration, update and smoothing of
+///       the Kalman fitter and the mixture reduction of the GSF run inside
+///       the propagation, whose time includes them.
+class FitterTimers {
+ public:
+  static constexpr std::size_t kNumPhases = 5;
+
+  struct Phase {
+    /// Accumulated wall time
+    std::chrono::nanoseconds time{0};
+    /// Number of timed calls
+    std::size_t calls = 0;
+  };
+
+  /// @brief Accumulates the wall time of a scope to a phase of the calling
+  /// thread.
+  class ScopedTimer {
+   public:
+    explicit ScopedTimer(FitterPhase phase)
+        : m_phase(local()[phase]), m_start(std::chrono::steady_clock::now()) {}
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    ~ScopedTimer() {
+      m_phase.time += std::chrono::steady_clock::now() - m_start;
+      ++m_phase.calls;
+    }
+
+   private:
+    Phase& m_phase;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+  /// The timers of the calling thread
+  static FitterTimers& local() {
+    thread_local FitterTimers timers;
+    return timers;
+  }
+
+  /// The name of a phase for printing
+  static constexpr std::string_view name(FitterPhase phase) {
+    constexpr std::array<std::string_view, kNumPhases> names = {
+        "propagation", "calibration", "update", "smoothing",
+        "mixture reduction"};
+    return names[static_cast<std::size_t>(phase)];
+  }
+
+  Phase& operator[](FitterPhase phase) {
+    return m_phases[static_cast<std::size_t>(phase)];
+  }
+  const Phase& operator[](FitterPhase phase) const {
+    return m_phases[static_cast<std::size_t>(phase)];
+  }
+
+  /// Reset all phases to zero
+  void clear() { m_phases = {}; }
+
+ private:
+  std::array<Phase, kNumPhases> m_phases{};
+};
+
+}  // namespace Acts
+
+#define ACTS_FITTER_TIMER_CONCAT_IMPL(a, b) a##b
+#define ACTS_FITTER_TIMER_CONCAT(a, b) ACTS_FITTER_TIMER_CONCAT_IMPL(a, b)
+
+/// Time the rest of the enclosing scope as a fitter phase, e.g.
+/// `ACTS_FITTER_TIMER(eUpdate);`
+#ifdef ACTS_ENABLE_FITTER_TIMERS
+#define ACTS_FITTER_TIMER(phase)                                     \
+  const ::Acts::FitterTimers::ScopedTimer ACTS_FITTER_TIMER_CONCAT( \
+      actsFitterTimer, __LINE__)(::Acts::FitterPhase::phase)
+#else
+#define ACTS_FITTER_TIMER(phase) static_cast<void>(0)
+#endif
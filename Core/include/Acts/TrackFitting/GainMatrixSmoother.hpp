@@ -18,6 +18,7 @@
 #include <cassert>
 #include <cstddef>
 #include <system_error>
+#include <type_traits>
 
 namespace Acts {
 
@@ -34,13 +35,24 @@ class GainMatrixSmoother {
 
   /// Run the Kalman smoothing for one trajectory.
   ///
+  /// @tparam traj_t The track state container backend
+  /// @tparam scalar_t The precision of the smoothing algebra, either double
+  ///         or float. The track states are always stored in double
+  ///         precision. In single precision the covariances are scaled to
+  ///         unit diagonal before the conversion, and a step falls back to
+  ///         double precision if a covariance is not positive definite.
   /// @param[in,out] trajectory The trajectory to be smoothed
   /// @param[in] entryIndex The index of state to start the smoothing
   /// @param[in] logger Where to write logging information to
-  template <typename traj_t>
+  template <typename traj_t, typename scalar_t = ActsScalar>
   Result<void> operator()(const GeometryContext& /*gctx*/, traj_t& trajectory,
                           std::size_t entryIndex,
                           const Logger& logger = getDummyLogger()) const {
+    static_assert(std::is_same_v<scalar_t, double> ||
+                      std::is_same_v<scalar_t, float>,
+                  "The smoothing is only available in double or float "
+                  "precision");
+
     using TrackStateProxy = typename traj_t::TrackStateProxy;
 
     GetParameters filtered;
@@ -114,10 +126,15 @@ class GainMatrixSmoother {
       // ensure the track state has a smoothed component
       ts.addComponents(TrackStatePropMask::Smoothed);
 
-      if (auto res = calculate(&ts, &prev_ts, filtered, filteredCovariance,
-                               smoothed, predicted, predictedCovariance,
-                               smoothedCovariance, jacobian, logger);
-          !res.ok()) {
+      auto res = std::is_same_v<scalar_t, float>
+                     ? calculateSinglePrecision(
+                           &ts, &prev_ts, filtered, filteredCovariance,
+                           smoothed, predicted, predictedCovariance,
+                           smoothedCovariance, jacobian, logger)
+                     : calculate(&ts, &prev_ts, filtered, filteredCovariance,
+                                 smoothed, predicted, predictedCovariance,
+                                 smoothedCovariance, jacobian, logger);
+      if (!res.ok()) {
         error = res.error();
         return false;
       }
@@ -144,6 +161,15 @@ class GainMatrixSmoother {
                          const GetCovariance& smoothedCovariance,
                          const GetCovariance& jacobian,
                          const Logger& logger) const;
+
+  /// Same as @ref calculate with the algebra in single precision, see
+  /// @ref operator()
+  Result<void> calculateSinglePrecision(
+      void* ts, void* prev_ts, const GetParameters& filtered,
+      const GetCovariance& filteredCovariance, const GetParameters& smoothed,
+      const GetParameters& predicted, const GetCovariance& predictedCovariance,
+      const GetCovariance& smoothedCovariance, const GetCovariance& jacobian,
+      const Logger& logger) const;
 };
 
 }  // namespace Acts
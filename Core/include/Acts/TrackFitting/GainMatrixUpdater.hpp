@@ -20,6 +20,7 @@
 #include <cassert>
 #include <system_error>
 #include <tuple>
+#include <type_traits>
 
 namespace Acts {
 
@@ -45,15 +46,25 @@ class GainMatrixUpdater {
  public:
   /// Run the Kalman update step for a single trajectory state.
   ///
-  /// @tparam kMeasurementSizeMax
+  /// @tparam traj_t The track state container backend
+  /// @tparam scalar_t The precision of the update algebra, either double or
+  ///         float. The track state is always stored in double precision. In
+  ///         single precision the covariance is scaled to unit diagonal
+  ///         before the conversion, and the update falls back to double
+  ///         precision if the residual or filtered covariance is not
+  ///         positive definite.
   /// @param[in,out] trackState The track state
   /// @param[in] direction The navigation direction
   /// @param[in] logger Where to write logging information to
-  template <typename traj_t>
+  template <typename traj_t, typename scalar_t = ActsScalar>
   Result<void> operator()(const GeometryContext& /*gctx*/,
                           typename traj_t::TrackStateProxy trackState,
                           Direction direction = Direction::Forward,
                           const Logger& logger = getDummyLogger()) const {
+    static_assert(std::is_same_v<scalar_t, double> ||
+                      std::is_same_v<scalar_t, float>,
+                  "The update is only available in double or float precision");
+
     ACTS_VERBOSE("Invoked GainMatrixUpdater");
 
     // there should be a calibrated measurement
@@ -76,27 +87,29 @@ class GainMatrixUpdater {
     // auto filtered = trackState.filtered();
     // auto filteredCovariance = trackState.filteredCovariance();
 
-    auto [chi2, error] = visitMeasurement(
-        InternalTrackState{
-            trackState.predicted(),
-            trackState.predictedCovariance(),
-            trackState.filtered(),
-            trackState.filteredCovariance(),
-            // This abuses an incorrectly sized vector / matrix to access the
-            // data pointer! This works (don't use the matrix as is!), but be
-            // careful!
-            trackState
-                .template calibrated<
-                    MultiTrajectoryTraits::MeasurementSizeMax>()
-                .data(),
-            trackState
-                .template calibratedCovariance<
-                    MultiTrajectoryTraits::MeasurementSizeMax>()
-                .data(),
-            trackState.projector(),
-            trackState.calibratedSize(),
-        },
-        direction, logger);
+    InternalTrackState internalState{
+        trackState.predicted(),
+        trackState.predictedCovariance(),
+        trackState.filtered(),
+        trackState.filteredCovariance(),
+        // This abuses an incorrectly sized vector / matrix to access the
+        // data pointer! This works (don't use the matrix as is!), but be
+        // careful!
+        trackState
+            .template calibrated<MultiTrajectoryTraits::MeasurementSizeMax>()
+            .data(),
+        trackState
+            .template calibratedCovariance<
+                MultiTrajectoryTraits::MeasurementSizeMax>()
+            .data(),
+        trackState.projector(),
+        trackState.calibratedSize(),
+    };
+
+    auto [chi2, error] =
+        std::is_same_v<scalar_t, float>
+            ? visitMeasurementSinglePrecision(internalState, direction, logger)
+            : visitMeasurement(internalState, direction, logger);
 
     trackState.chi2() = chi2;
 
@@ -107,6 +120,10 @@ class GainMatrixUpdater {
   std::tuple<double, std::error_code> visitMeasurement(
       InternalTrackState trackState, Direction direction,
       const Logger& logger) const;
+
+  std::tuple<double, std::error_code> visitMeasurementSinglePrecision(
+      InternalTrackState trackState, Direction direction,
+      const Logger& logger) const;
 };
 
 }  // namespace Acts
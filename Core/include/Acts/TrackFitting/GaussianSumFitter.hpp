@@ -14,6 +14,7 @@
 #include "Acts/Propagator/MultiStepperAborters.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/TrackFitting/FitterTimers.hpp"
 #include "Acts/TrackFitting/GsfOptions.hpp"
 #include "Acts/TrackFitting/detail/GsfActor.hpp"
 #include "Acts/Utilities/Logger.hpp"
@@ -250,6 +251,16 @@ struct GaussianSumFitter {
       return GsfError::StartParametersHaveNoCovariance;
     }
 
+    // The component buffers are shared by both passes, and over many fits if
+    // the options provide them
+    std::optional<GsfComponentPool<traj_t>> localComponentPool;
+    GsfComponentPool<traj_t>* componentPool = options.componentPool;
+    if (componentPool == nullptr) {
+      componentPool = &localComponentPool.emplace();
+    }
+    componentPool->reserve(options.maxComponents,
+                           m_betheHeitlerApproximation.numComponents());
+
     /////////////////
     // Forward pass
     /////////////////
@@ -267,6 +278,7 @@ struct GaussianSumFitter {
       actor.m_cfg.numberMeasurements = inputMeasurements.size();
       actor.m_cfg.inReversePass = false;
       actor.m_cfg.logger = m_actorLogger.get();
+      actor.m_cfg.componentPool = componentPool;
 
       fwdPropOptions.direction = gsfForward;
 
@@ -293,7 +305,11 @@ struct GaussianSumFitter {
       auto& r = state.template get<typename GsfActor::result_type>();
       r.fittedStates = &trackContainer.trackStateContainer();
 
-      auto propagationResult = m_propagator.propagate(state);
+      Result<void> propagationResult = Result<void>::success();
+      {
+        ACTS_FITTER_TIMER(ePropagation);
+        propagationResult = m_propagator.propagate(state);
+      }
 
       return m_propagator.makeResult(std::move(state), propagationResult,
                                      fwdPropOptions, false);
@@ -318,6 +334,9 @@ struct GaussianSumFitter {
     ACTS_VERBOSE("- visited surfaces: " << fwdGsfResult.visitedSurfaces.size());
     ACTS_VERBOSE("- processed states: " << fwdGsfResult.processedStates);
     ACTS_VERBOSE("- measurement states: " << fwdGsfResult.measurementStates);
+    ACTS_VERBOSE("- component pool allocations: "
+                 << fwdGsfResult.nComponentPoolAllocations
+                 << ", reuses: " << fwdGsfResult.nComponentPoolReuses);
 
     std::size_t nInvalidBetheHeitler = fwdGsfResult.nInvalidBetheHeitler.val();
     double maxPathXOverX0 = fwdGsfResult.maxPathXOverX0.val();
@@ -337,6 +356,7 @@ struct GaussianSumFitter {
       actor.m_cfg.inputMeasurements = &inputMeasurements;
       actor.m_cfg.inReversePass = true;
       actor.m_cfg.logger = m_actorLogger.get();
+      actor.m_cfg.componentPool = componentPool;
 
       bwdPropOptions.direction = gsfBackward;
 
@@ -370,7 +390,11 @@ struct GaussianSumFitter {
       r.measurementStates++;
       r.processedStates++;
 
-      auto propagationResult = m_propagator.propagate(state);
+      Result<void> propagationResult = Result<void>::success();
+      {
+        ACTS_FITTER_TIMER(ePropagation);
+        propagationResult = m_propagator.propagate(state);
+      }
 
       return m_propagator.makeResult(std::move(state), propagationResult,
                                      target, bwdPropOptions);
@@ -421,6 +445,12 @@ struct GaussianSumFitter {
     ACTS_VERBOSE("- Bwd measurement states: " << bwdGsfResult.measurementStates
                                               << ", holes: "
                                               << bwdGsfResult.measurementHoles);
+    ACTS_VERBOSE("- Component pool allocations: "
+                 << fwdGsfResult.nComponentPoolAllocations +
+                        bwdGsfResult.nComponentPoolAllocations
+                 << ", reuses: "
+                 << fwdGsfResult.nComponentPoolReuses +
+                        bwdGsfResult.nComponentPoolReuses);
 
     // TODO should this be warning level? it happens quite often... Investigate!
     if (bwdGsfResult.measurementStates != fwdGsfResult.measurementStates) {
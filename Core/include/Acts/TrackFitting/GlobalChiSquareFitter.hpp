@@ -32,7 +32,9 @@
 #include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Propagator/detail/PointwiseMaterialInteraction.hpp"
+#include "Acts/TrackFitting/FitterTimers.hpp"
 #include "Acts/TrackFitting/GlobalChiSquareFitterError.hpp"
+#include "Acts/TrackFitting/Gx2fBandedSystem.hpp"
 #include "Acts/TrackFitting/detail/VoidFitterComponents.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Delegate.hpp"
@@ -42,6 +44,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 
 namespace Acts::Experimental {
 
@@ -170,6 +173,12 @@ struct Gx2FitterOptions {
 
   /// Check for convergence (abort condition). Set to 0 to skip.
   double relChi2changeCutOff = 1e-7;
+
+  /// Accumulate and solve the normal equations with a Gx2fBandedSystem
+  /// instead of the dense BoundMatrix. The contributions of the measurements
+  /// are only replaced between iterations, as long as their number does not
+  /// change.
+  bool useBandedSystem = false;
 };
 
 template <typename traj_t>
@@ -481,8 +490,11 @@ class Gx2Fitter {
 
           // We have predicted parameters, so calibrate the uncalibrated input
           // measurement
-          extensions.calibrator(state.geoContext, *calibrationContext,
-                                sourcelink_it->second, trackStateProxy);
+          {
+            ACTS_FITTER_TIMER(eCalibration);
+            extensions.calibrator(state.geoContext, *calibrationContext,
+                                  sourcelink_it->second, trackStateProxy);
+          }
 
           // Get and set the type flags
           auto typeFlags = trackStateProxy.typeFlags();
@@ -732,6 +744,10 @@ class Gx2Fitter {
     BoundMatrix aMatrix = BoundMatrix::Zero();
     BoundVector bVector = BoundVector::Zero();
 
+    // Only used with useBandedSystem. It persists over the iterations to
+    // update the contributions of the measurements in place.
+    std::optional<Gx2fBandedSystem> bandedSystem;
+
     // Create an index of the 'tip' of the track stored in multitrajectory. It
     // is needed outside the update loop. It will be updated with each iteration
     // and used for the final track
@@ -774,7 +790,11 @@ class Gx2Fitter {
       // existing states, but this needs some more thinking.
       trackContainer.clear();
 
-      auto propagationResult = m_propagator.template propagate(propagatorState);
+      Result<void> propagationResult = Result<void>::success();
+      {
+        ACTS_FITTER_TIMER(ePropagation);
+        propagationResult = m_propagator.template propagate(propagatorState);
+      }
 
       auto result = m_propagator.template makeResult(std::move(propagatorState),
                                                      propagationResult,
@@ -813,31 +833,75 @@ class Gx2Fitter {
         return Experimental::GlobalChiSquareFitterError::NotEnoughMeasurements;
       }
 
-      chi2sum = 0;
-      aMatrix = BoundMatrix::Zero();
-      bVector = BoundVector::Zero();
-
-      // TODO generalize for non-2D measurements
-      for (std::size_t iMeas = 0; iMeas < gx2fResult.collectorResiduals.size();
-           iMeas++) {
-        const auto ri = gx2fResult.collectorResiduals[iMeas];
-        const auto covi = gx2fResult.collectorCovariances[iMeas];
-        const auto projectedJacobian =
-            gx2fResult.collectorProjectedJacobians[iMeas];
-
-        const double chi2meas = ri / covi * ri;
-        const BoundMatrix aMatrixMeas =
-            projectedJacobian * projectedJacobian.transpose() / covi;
-        const BoundVector bVectorMeas = projectedJacobian / covi * ri;
-
-        chi2sum += chi2meas;
-        aMatrix += aMatrixMeas;
-        bVector += bVectorMeas;
-      }
+      {
+        ACTS_FITTER_TIMER(eUpdate);
+        chi2sum = 0;
+        aMatrix = BoundMatrix::Zero();
+        bVector = BoundVector::Zero();
+
+        if (!gx2fOptions.useBandedSystem) {
+          // TODO generalize for non-2D measurements
+          for (std::size_t iMeas = 0;
+               iMeas < gx2fResult.collectorResiduals.size(); iMeas++) {
+            const auto ri = gx2fResult.collectorResiduals[iMeas];
+            const auto covi = gx2fResult.collectorCovariances[iMeas];
+            const auto projectedJacobian =
+                gx2fResult.collectorProjectedJacobians[iMeas];
+
+            const double chi2meas = ri / covi * ri;
+            const BoundMatrix aMatrixMeas =
+                projectedJacobian * projectedJacobian.transpose() / covi;
+            const BoundVector bVectorMeas = projectedJacobian / covi * ri;
+
+            chi2sum += chi2meas;
+            aMatrix += aMatrixMeas;
+            bVector += bVectorMeas;
+          }
 
-      // calculate delta params [a] * delta = b
-      deltaParams =
-          calculateDeltaParams(gx2fOptions.zeroField, aMatrix, bVector);
+          // calculate delta params [a] * delta = b
+          deltaParams =
+              calculateDeltaParams(gx2fOptions.zeroField, aMatrix, bVector);
+        } else {
+          // The track parameters are the only block of unknowns. The time
+          // and, without field, q/p are not fitted and therefore excluded.
+          const std::size_t nParams = gx2fOptions.zeroField ? 4 : 5;
+          const std::size_t nMeasurements =
+              gx2fResult.collectorResiduals.size();
+          // Replace the contributions of the previous iteration if the
+          // measurements can be matched one-to-one
+          const bool update = bandedSystem.has_value() &&
+                              bandedSystem->nMeasurements() == nMeasurements;
+          if (!update) {
+            bandedSystem.emplace(1, nParams, 0);
+          }
+
+          for (std::size_t iMeas = 0; iMeas < nMeasurements; iMeas++) {
+            const Gx2fBandedSystem::Vector jacobian =
+                gx2fResult.collectorProjectedJacobians[iMeas].head(nParams);
+            const double ri = gx2fResult.collectorResiduals[iMeas];
+            const double covi = gx2fResult.collectorCovariances[iMeas];
+            if (update) {
+              bandedSystem->updateMeasurement(iMeas, jacobian, ri, covi);
+            } else {
+              bandedSystem->addMeasurement(0, jacobian, ri, covi);
+            }
+          }
+
+          const auto solution = bandedSystem->solve();
+          if (!solution) {
+            ACTS_INFO("The banded system is not positive definite.");
+            return Experimental::GlobalChiSquareFitterError::AIsNotInvertible;
+          }
+
+          // The dense [a] is still needed for the final covariance
+          chi2sum = bandedSystem->chi2();
+          aMatrix.topLeftCorner(nParams, nParams) =
+              bandedSystem->denseMatrix();
+          bVector.head(nParams) = bandedSystem->vector();
+          deltaParams = BoundVector::Zero();
+          deltaParams.head(nParams) = *solution;
+        }
+      }
 
       ACTS_VERBOSE("aMatrix:\n"
                    << aMatrix << "\n"
@@ -943,6 +1007,7 @@ class Gx2Fitter {
       // existing states, but this needs some more thinking.
       trackContainer.clear();
 
+      ACTS_FITTER_TIMER(ePropagation);
       m_propagator.template propagate(propagatorState);
     }
 
@@ -18,6 +18,10 @@
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 namespace Acts {
 
 /// @enum ComponentMergeMethod
@@ -34,6 +38,70 @@ struct GsfComponent {
   BoundSquareMatrix boundCov = BoundSquareMatrix::Identity();
 };
 
+/// Buffers for the temporary track states of the GSF components.
+///
+/// On every surface the GSF creates a track state per component before the
+/// components are merged, and a component cache for the convolution with
+/// the energy loss. The pool keeps these buffers, they are cleared between
+/// surfaces without releasing their memory. A pool can be passed to the
+/// fitter to reuse it for many fits, but it must not be used by two fits at
+/// the same time.
+template <typename traj_t>
+struct GsfComponentPool {
+  /// The temporary track states of the components on the current surface
+  traj_t traj;
+  /// The indices of the component track states in @c traj
+  std::vector<MultiTrajectoryTraits::IndexType> tips;
+  /// The component weights, indexed by the track state index
+  std::vector<double> weights;
+  /// The components after the convolution with the energy loss
+  std::vector<GsfComponent> componentCache;
+
+  /// Reserve the buffers for a number of components
+  /// @param maxComponents The maximum number of components of the fit
+  /// @param nMixtureComponents The number of components of the energy loss
+  ///        mixture
+  void reserve(std::size_t maxComponents, std::size_t nMixtureComponents) {
+    tips.reserve(maxComponents);
+    weights.reserve(maxComponents);
+    componentCache.reserve(maxComponents * nMixtureComponents);
+  }
+
+  /// Clear the buffers for the next surface, keeping their memory
+  void clear() {
+    m_maxStates = maxStates();
+    traj.clear();
+    tips.clear();
+    weights.clear();
+    componentCache.clear();
+  }
+
+  /// Add a component track state
+  /// @param tip The index of the track state in @c traj
+  /// @param weight The weight of the component
+  void addComponent(MultiTrajectoryTraits::IndexType tip, double weight) {
+    tips.push_back(tip);
+    if (weights.size() <= tip) {
+      weights.resize(tip + 1, 0.);
+    }
+    weights[tip] = weight;
+  }
+
+  /// A measure of the memory held by the pool, which only changes if one of
+  /// the buffers had to grow
+  std::size_t capacity() const {
+    return maxStates() + tips.capacity() + weights.capacity() +
+           componentCache.capacity();
+  }
+
+ private:
+  std::size_t maxStates() const {
+    return std::max(m_maxStates, static_cast<std::size_t>(traj.size()));
+  }
+
+  std::size_t m_maxStates = 0;
+};
+
 namespace GsfConstants {
 constexpr std::string_view kFinalMultiComponentStateColumn =
     "gsf-final-multi-component-state";
@@ -116,6 +184,11 @@ struct GsfOptions {
 
   ComponentMergeMethod componentMergeMethod = ComponentMergeMethod::eMaxWeight;
 
+  /// Optional buffers for the component states, which are reused over the
+  /// fits using these options, e.g. one pool per thread. If not set, every
+  /// fit uses its own buffers.
+  GsfComponentPool<traj_t> *componentPool = nullptr;
+
 #if __cplusplus < 202002L
   GsfOptions() = delete;
 #endif
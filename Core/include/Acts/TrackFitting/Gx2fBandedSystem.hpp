@@ -0,0 +1,131 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Acts::Experimental {
+
+/// Normal equations of a Global Chi Square fit with a configurable number of
+/// unknowns and a block-banded structure.
+///
+/// The unknowns are grouped into blocks of equal size, e.g. the track
+/// parameters followed by the scattering angles of each material surface.
+/// A measurement only depends on the unknowns of a limited number of
+/// consecutive blocks, so the matrix [a] only has non-zero blocks within a
+/// band around the diagonal. Only these blocks are stored and the system is
+/// solved with a block-banded Cholesky decomposition, whose cost grows
+/// linearly with the number of blocks.
+///
+/// The contribution of every one dimensional measurement is kept. Updating
+/// a measurement, e.g. with the Jacobian of the next iteration or with a
+/// larger variance for an outlier, replaces only its own contribution
+/// instead of accumulating the whole system again.
+class Gx2fBandedSystem {
+ public:
+  using Vector = Eigen::Matrix<ActsScalar, Eigen::Dynamic, 1>;
+  using Matrix = Eigen::Matrix<ActsScalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+  /// @param nBlocks The number of blocks of unknowns
+  /// @param blockSize The number of unknowns per block
+  /// @param bandwidth The number of blocks below the diagonal that can be
+  ///        non-zero, a measurement may depend on bandwidth + 1 blocks
+  Gx2fBandedSystem(std::size_t nBlocks, std::size_t blockSize,
+                   std::size_t bandwidth);
+
+  /// The total number of unknowns
+  std::size_t size() const { return m_nBlocks * m_blockSize; }
+
+  std::size_t nBlocks() const { return m_nBlocks; }
+  std::size_t blockSize() const { return m_blockSize; }
+  std::size_t bandwidth() const { return m_bandwidth; }
+
+  /// The number of measurements added, including removed ones
+  std::size_t nMeasurements() const { return m_measurements.size(); }
+
+  /// Add a one dimensional measurement
+  ///
+  /// @param firstBlock The first block of unknowns the measurement depends on
+  /// @param jacobian Derivative of the measurement with respect to the
+  ///        unknowns, starting at @p firstBlock. Its size has to be a
+  ///        multiple of the block size and cover at most bandwidth + 1 blocks.
+  /// @param residual The residual of the measurement
+  /// @param variance The variance of the measurement
+  /// @return The index of the measurement to update it later
+  std::size_t addMeasurement(std::size_t firstBlock, const Vector& jacobian,
+                             ActsScalar residual, ActsScalar variance);
+
+  /// Replace the contribution of a measurement
+  ///
+  /// @param index The index returned by @ref addMeasurement
+  /// @param jacobian The new derivative, with the same size as before
+  /// @param residual The new residual
+  /// @param variance The new variance
+  void updateMeasurement(std::size_t index, const Vector& jacobian,
+                         ActsScalar residual, ActsScalar variance);
+
+  /// Remove the contribution of a measurement, e.g. for an outlier
+  /// @param index The index returned by @ref addMeasurement
+  void removeMeasurement(std::size_t index);
+
+  /// Accumulate the system again from the stored contributions, which
+  /// removes the rounding errors of many updates
+  void rebuild();
+
+  /// The sum of the chi2 of all measurements
+  ActsScalar chi2() const { return m_chi2; }
+
+  /// The vector [b] of the normal equations
+  const Vector& vector() const { return m_bVector; }
+
+  /// The matrix [a] of the normal equations as a dense matrix
+  Matrix denseMatrix() const;
+
+  /// Solve [a] * delta = [b]
+  /// @return The solution, or nothing if [a] is not positive definite
+  std::optional<Vector> solve() const;
+
+ private:
+  struct Measurement {
+    std::size_t firstBlock = 0;
+    Vector jacobian;
+    ActsScalar residual = 0;
+    ActsScalar variance = 0;
+    bool active = false;
+  };
+
+  /// Add or subtract the contribution of a measurement
+  void accumulate(const Measurement& measurement, ActsScalar sign);
+
+  /// Block (i, j) of the lower triangle with i - bandwidth <= j <= i
+  Matrix& block(std::vector<Matrix>& blocks, std::size_t i,
+                std::size_t j) const {
+    return blocks[i * (m_bandwidth + 1) + (i - j)];
+  }
+  const Matrix& block(const std::vector<Matrix>& blocks, std::size_t i,
+                      std::size_t j) const {
+    return blocks[i * (m_bandwidth + 1) + (i - j)];
+  }
+
+  std::size_t m_nBlocks;
+  std::size_t m_blockSize;
+  std::size_t m_bandwidth;
+
+  std::vector<Matrix> m_aBlocks;
+  Vector m_bVector;
+  ActsScalar m_chi2 = 0;
+
+  std::vector<Measurement> m_measurements;
+};
+
+}  // namespace Acts::Experimental
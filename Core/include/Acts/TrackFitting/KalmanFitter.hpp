@@ -25,7 +25,9 @@
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Propagator/detail/PointwiseMaterialInteraction.hpp"
+#include "Acts/TrackFitting/FitterTimers.hpp"
 #include "Acts/TrackFitting/KalmanFitterError.hpp"
+#include "Acts/TrackFitting/detail/KalmanSmoothingCache.hpp"
 #include "Acts/TrackFitting/detail/KalmanUpdateHelpers.hpp"
 #include "Acts/TrackFitting/detail/VoidFitterComponents.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
@@ -185,6 +187,15 @@ struct KalmanFitterOptions {
   /// Whether to include non-linear correction during global to local
   /// transformation
   FreeToBoundCorrection freeToBoundCorrection;
+
+  /// Whether to cache the filtered track states for the smoothing instead of
+  /// calling the smoother extension, see @c detail::KalmanSmoothingCache.
+  /// This has no effect if the reversed filtering is used.
+  bool fusedSmoothing = false;
+
+  /// Whether to store the transport Jacobians in the track states. They can
+  /// only be dropped with the fused smoothing or the reversed filtering.
+  bool storeJacobians = true;
 };
 
 template <typename traj_t>
@@ -234,6 +245,9 @@ struct KalmanFitterResult {
   /// Measurement surfaces handled in both forward and backward filtering
   std::vector<const Surface*> passedAgainSurfaces;
 
+  /// Filtered track states for the fused smoothing
+  detail::KalmanSmoothingCache smoothingCache;
+
   Result<void> result{Result<void>::success()};
 };
 
@@ -324,6 +338,12 @@ class KalmanFitter {
     /// transformation
     FreeToBoundCorrection freeToBoundCorrection;
 
+    /// Whether to smooth from the cached filtered track states
+    bool fusedSmoothing = false;
+
+    /// Whether to store the transport Jacobians in the track states
+    bool storeJacobians = true;
+
     /// Input MultiTrajectory
     std::shared_ptr<traj_t> outputStates;
 
@@ -605,10 +625,12 @@ class KalmanFitter {
 
         // do the kalman update (no need to perform covTransport here, hence no
         // point in performing globalToLocal correction)
+        BoundMatrix jacobian;
         auto trackStateProxyRes = detail::kalmanHandleMeasurement(
             *calibrationContext, state, stepper, extensions, *surface,
             sourcelink_it->second, *result.fittedStates, result.lastTrackIndex,
-            false, logger());
+            false, logger(), FreeToBoundCorrection(false),
+            storeJacobians ? nullptr : &jacobian);
 
         if (!trackStateProxyRes.ok()) {
           return trackStateProxyRes.error();
@@ -616,6 +638,7 @@ class KalmanFitter {
 
         const auto& trackStateProxy = *trackStateProxyRes;
         result.lastTrackIndex = trackStateProxy.index();
+        cacheForSmoothing(trackStateProxy, jacobian, result);
 
         // Update the stepper if it is not an outlier
         if (trackStateProxy.typeFlags().test(
@@ -652,9 +675,11 @@ class KalmanFitter {
         // measurement)
         if (result.measurementStates > 0 ||
             surface->surfaceMaterial() != nullptr) {
+          BoundMatrix jacobian;
           auto trackStateProxyRes = detail::kalmanHandleNoMeasurement(
               state, stepper, *surface, *result.fittedStates,
-              result.lastTrackIndex, true, logger(), freeToBoundCorrection);
+              result.lastTrackIndex, true, logger(), freeToBoundCorrection,
+              storeJacobians ? nullptr : &jacobian);
 
           if (!trackStateProxyRes.ok()) {
             return trackStateProxyRes.error();
@@ -662,6 +687,7 @@ class KalmanFitter {
 
           const auto& trackStateProxy = *trackStateProxyRes;
           result.lastTrackIndex = trackStateProxy.index();
+          cacheForSmoothing(trackStateProxy, jacobian, result);
 
           if (trackStateProxy.typeFlags().test(TrackStateFlag::HoleFlag)) {
             // Count the missed surface
@@ -679,6 +705,26 @@ class KalmanFitter {
       return Result<void>::success();
     }
 
+    /// @brief Record a filtered track state for the fused smoothing
+    ///
+    /// @param trackState The new track state
+    /// @param jacobian The transport Jacobian, if not stored in the state
+    /// @param result The mutable result state object
+    template <typename track_state_proxy_t>
+    void cacheForSmoothing(const track_state_proxy_t& trackState,
+                           const BoundMatrix& jacobian,
+                           result_type& result) const {
+      if (!fusedSmoothing) {
+        return;
+      }
+      if (result.smoothingCache.size() == 0) {
+        result.smoothingCache.reserve(inputMeasurements->size());
+      }
+      result.smoothingCache.record(
+          trackState, storeJacobians ? BoundMatrix(trackState.jacobian())
+                                     : jacobian);
+    }
+
     /// @brief Kalman actor operation: update in reversed direction
     ///
     /// @tparam propagator_state_t is the type of Propagator state
@@ -759,12 +805,19 @@ class KalmanFitter {
 
         // We have predicted parameters, so calibrate the uncalibrated input
         // measurement
-        extensions.calibrator(state.geoContext, *calibrationContext,
-                              sourcelink_it->second, trackStateProxy);
+        {
+          ACTS_FITTER_TIMER(eCalibration);
+          extensions.calibrator(state.geoContext, *calibrationContext,
+                                sourcelink_it->second, trackStateProxy);
+        }
 
         // If the update is successful, set covariance and
-        auto updateRes = extensions.updater(state.geoContext, trackStateProxy,
-                                            state.options.direction, logger());
+        Result<void> updateRes = Result<void>::success();
+        {
+          ACTS_FITTER_TIMER(eUpdate);
+          updateRes = extensions.updater(state.geoContext, trackStateProxy,
+                                         state.options.direction, logger());
+        }
         if (!updateRes.ok()) {
           ACTS_ERROR("Backward update step failed: " << updateRes.error());
           return updateRes.error();
@@ -942,9 +995,17 @@ class KalmanFitter {
                                          << " filtered track states.");
 
       // Smooth the track states
-      auto smoothRes =
-          extensions.smoother(state.geoContext, *result.fittedStates,
-                              result.lastMeasurementIndex, logger());
+      Result<void> smoothRes = Result<void>::success();
+      {
+        ACTS_FITTER_TIMER(eSmoothing);
+        smoothRes =
+            fusedSmoothing
+                ? result.smoothingCache.smooth(*result.fittedStates,
+                                               result.lastMeasurementIndex,
+                                               logger())
+                : extensions.smoother(state.geoContext, *result.fittedStates,
+                                      result.lastMeasurementIndex, logger());
+      }
       if (!smoothRes.ok()) {
         ACTS_ERROR("Smoothing step failed: " << smoothRes.error());
         return smoothRes.error();
@@ -1136,6 +1197,8 @@ class KalmanFitter {
     kalmanActor.reversedFilteringCovarianceScaling =
         kfOptions.reversedFilteringCovarianceScaling;
     kalmanActor.freeToBoundCorrection = kfOptions.freeToBoundCorrection;
+    kalmanActor.fusedSmoothing = kfOptions.fusedSmoothing;
+    kalmanActor.storeJacobians = kfOptions.storeJacobians;
     kalmanActor.calibrationContext = &kfOptions.calibrationContext.get();
     kalmanActor.extensions = kfOptions.extensions;
     kalmanActor.actorLogger = m_actorLogger.get();
@@ -1216,6 +1279,8 @@ class KalmanFitter {
     kalmanActor.reversedFiltering = kfOptions.reversedFiltering;
     kalmanActor.reversedFilteringCovarianceScaling =
         kfOptions.reversedFilteringCovarianceScaling;
+    kalmanActor.fusedSmoothing = kfOptions.fusedSmoothing;
+    kalmanActor.storeJacobians = kfOptions.storeJacobians;
     kalmanActor.extensions = kfOptions.extensions;
     kalmanActor.actorLogger = m_actorLogger.get();
 
@@ -1261,7 +1326,11 @@ class KalmanFitter {
     kalmanResult.fittedStates = &trackContainer.trackStateContainer();
 
     // Run the fitter
-    auto result = m_propagator.template propagate(propagatorState);
+    Result<void> result = Result<void>::success();
+    {
+      ACTS_FITTER_TIMER(ePropagation);
+      result = m_propagator.template propagate(propagatorState);
+    }
 
     if (!result.ok()) {
       ACTS_ERROR("Propagation failed: " << result.error());
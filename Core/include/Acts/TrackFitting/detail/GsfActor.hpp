@@ -17,6 +17,7 @@
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+#include "Acts/TrackFitting/FitterTimers.hpp"
 #include "Acts/TrackFitting/GsfError.hpp"
 #include "Acts/TrackFitting/GsfOptions.hpp"
 #include "Acts/TrackFitting/KalmanFitter.hpp"
@@ -60,11 +61,13 @@ struct GsfResult {
   Updatable<double> maxPathXOverX0;
   Updatable<double> sumPathXOverX0;
 
+  /// Number of surfaces on which a buffer of the component pool had to grow,
+  /// and on which the existing buffers were sufficient
+  std::size_t nComponentPoolAllocations = 0;
+  std::size_t nComponentPoolReuses = 0;
+
   // Propagate potential errors to the outside
   Result<void> result{Result<void>::success()};
-
-  // Internal: component cache to avoid reallocation
-  std::vector<GsfComponent> componentCache;
 };
 
 /// The actor carrying out the GSF algorithm
@@ -124,14 +127,42 @@ struct GsfActor {
     /// Calibration context for the fit
     const CalibrationContext* calibrationContext{nullptr};
 
+    /// Buffers for the component states, reused on all surfaces
+    GsfComponentPool<traj_t>* componentPool{nullptr};
+
   } m_cfg;
 
   const Logger& logger() const { return *m_cfg.logger; }
 
-  struct TemporaryStates {
-    traj_t traj;
-    std::vector<MultiTrajectoryTraits::IndexType> tips;
-    std::map<MultiTrajectoryTraits::IndexType, double> weights;
+  using TemporaryStates = GsfComponentPool<traj_t>;
+
+  /// Clears the component pool for a surface, and counts on destruction
+  /// whether one of its buffers had to grow
+  class ScopedComponentPool {
+   public:
+    ScopedComponentPool(TemporaryStates& pool, result_type& result)
+        : m_pool(pool), m_result(result) {
+      m_pool.clear();
+      m_capacity = m_pool.capacity();
+    }
+
+    ScopedComponentPool(const ScopedComponentPool&) = delete;
+    ScopedComponentPool& operator=(const ScopedComponentPool&) = delete;
+
+    ~ScopedComponentPool() {
+      if (m_pool.capacity() != m_capacity) {
+        ++m_result.nComponentPoolAllocations;
+      } else {
+        ++m_result.nComponentPoolReuses;
+      }
+    }
+
+    TemporaryStates& pool() { return m_pool; }
+
+   private:
+    TemporaryStates& m_pool;
+    result_type& m_result;
+    std::size_t m_capacity = 0;
   };
 
   /// @brief GSF actor operation
@@ -149,6 +180,7 @@ struct GsfActor {
                   const navigator_t& navigator, result_type& result,
                   const Logger& /*logger*/) const {
     assert(result.fittedStates && "No MultiTrajectory set");
+    assert(m_cfg.componentPool && "No component pool set");
 
     // Return is we found an error earlier
     if (!result.result.ok()) {
@@ -226,12 +258,17 @@ struct GsfActor {
     if (!haveMaterial && !haveMeasurement) {
       // No hole before first measurement
       if (result.processedStates > 0 && surface.associatedDetectorElement()) {
-        TemporaryStates tmpStates;
-        noMeasurementUpdate(state, stepper, navigator, result, tmpStates, true);
+        ScopedComponentPool scopedPool(*m_cfg.componentPool, result);
+        noMeasurementUpdate(state, stepper, navigator, result,
+                            scopedPool.pool(), true);
       }
       return;
     }
 
+    // Reuse the memory of the component states over all surfaces
+    ScopedComponentPool scopedPool(*m_cfg.componentPool, result);
+    TemporaryStates& tmpStates = scopedPool.pool();
+
     // Update the counters. Note that this should be done before potential
     // material interactions, because if this is our last measurement this would
     // not influence the fit anymore.
@@ -261,8 +298,6 @@ struct GsfActor {
     // state with the filtered components.
     // NOTE because of early return before we know that we have a measurement
     if (!haveMaterial) {
-      TemporaryStates tmpStates;
-
       auto res = kalmanUpdate(state, stepper, navigator, result, tmpStates,
                               found_source_link->second);
 
@@ -277,7 +312,6 @@ struct GsfActor {
     // convolute the components and later reduce them again before updating
     // the stepper
     else {
-      TemporaryStates tmpStates;
       Result<void> res;
 
       if (haveMeasurement) {
@@ -293,9 +327,7 @@ struct GsfActor {
         return;
       }
 
-      // Reuse memory over all calls to the Actor in a single propagation
-      std::vector<ComponentCache>& componentCache = result.componentCache;
-      componentCache.clear();
+      std::vector<ComponentCache>& componentCache = tmpStates.componentCache;
 
       convoluteComponents(state, stepper, navigator, tmpStates, componentCache,
                           result);
@@ -312,7 +344,11 @@ struct GsfActor {
       // reduce component number
       const auto finalCmpNumber = std::min(
           static_cast<std::size_t>(stepper.maxComponents), m_cfg.maxComponents);
-      m_cfg.extensions.mixtureReducer(componentCache, finalCmpNumber, surface);
+      {
+        ACTS_FITTER_TIMER(eMixtureReduction);
+        m_cfg.extensions.mixtureReducer(componentCache, finalCmpNumber,
+                                        surface);
+      }
 
       removeLowWeightComponents(componentCache);
 
@@ -578,8 +614,7 @@ struct GsfActor {
         is_valid_measurement = true;
       }
 
-      tmpStates.tips.push_back(trackStateProxy.index());
-      tmpStates.weights[tmpStates.tips.back()] = cmp.weight();
+      tmpStates.addComponent(trackStateProxy.index(), cmp.weight());
     }
 
     computePosteriorWeights(tmpStates.traj, tmpStates.tips, tmpStates.weights);
@@ -658,8 +693,7 @@ struct GsfActor {
         is_hole = false;
       }
 
-      tmpStates.tips.push_back(trackStateProxy.index());
-      tmpStates.weights[tmpStates.tips.back()] = cmp.weight();
+      tmpStates.addComponent(trackStateProxy.index(), cmp.weight());
     }
 
     // These things should only be done once for all components
@@ -770,6 +804,7 @@ struct GsfActor {
               result.surfacesVisitedBwdAgain.push_back(&surface);
 
               if (trackState.hasSmoothed()) {
+                ACTS_FITTER_TIMER(eSmoothing);
                 const auto [smtMean, smtCov] = mergeGaussianMixture(
                     tmpStates.tips, surface, m_cfg.mergeMethod,
                     FltProjector{tmpStates.traj, tmpStates.weights});
@@ -794,6 +829,7 @@ struct GsfActor {
     m_cfg.weightCutoff = options.weightCutoff;
     m_cfg.mergeMethod = options.componentMergeMethod;
     m_cfg.calibrationContext = &options.calibrationContext.get();
+    m_cfg.componentPool = options.componentPool;
   }
 };
 
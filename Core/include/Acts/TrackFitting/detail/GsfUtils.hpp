@@ -20,7 +20,6 @@
 #include <cmath>
 #include <cstddef>
 #include <iomanip>
-#include <map>
 #include <numeric>
 #include <ostream>
 #include <tuple>
@@ -165,7 +164,7 @@ ActsScalar calculateDeterminant(
 template <typename traj_t>
 void computePosteriorWeights(
     const traj_t &mt, const std::vector<MultiTrajectoryTraits::IndexType> &tips,
-    std::map<MultiTrajectoryTraits::IndexType, double> &weights) {
+    std::vector<double> &weights) {
   // Helper Function to compute detR
 
   // Find minChi2, this can be used to factor some things later in the
@@ -213,11 +212,11 @@ inline std::ostream &operator<<(std::ostream &os, StatesType type) {
 
 /// @brief Projector type which maps a MultiTrajectory-Index to a tuple of
 /// [weight, parameters, covariance]. Therefore, it contains a MultiTrajectory
-/// and for now a std::map for the weights
+/// and the weights indexed by the track state index
 template <StatesType type, typename traj_t>
 struct MultiTrajectoryProjector {
   const traj_t &mt;
-  const std::map<MultiTrajectoryTraits::IndexType, double> &weights;
+  const std::vector<double> &weights;
 
   auto operator()(MultiTrajectoryTraits::IndexType idx) const {
     const auto proxy = mt.getTrackState(idx);
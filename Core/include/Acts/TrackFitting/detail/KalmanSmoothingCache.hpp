@@ -0,0 +1,126 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/TrackFitting/KalmanFitterError.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Acts::detail {
+
+/// Compact copy of what the gain matrix smoothing needs from the forward
+/// filter.
+///
+/// The Kalman fitter records every track state right after it was filtered,
+/// while the values are still in cache. The smoothing then runs on this
+/// contiguous buffer instead of walking the trajectory and gathering the
+/// predicted, filtered and Jacobian columns again, and it writes the
+/// smoothed parameters into the trajectory once. Since the Jacobians are
+/// part of the cache, the trajectory does not need to store them.
+class KalmanSmoothingCache {
+ public:
+  struct Entry {
+    /// Index of the track state in the trajectory
+    std::size_t index = 0;
+    BoundVector predicted;
+    BoundSquareMatrix predictedCovariance;
+    BoundVector filtered;
+    BoundSquareMatrix filteredCovariance;
+    /// Transport Jacobian from the previous track state
+    BoundMatrix jacobian;
+  };
+
+  void clear() { m_entries.clear(); }
+
+  void reserve(std::size_t size) { m_entries.reserve(size); }
+
+  std::size_t size() const { return m_entries.size(); }
+
+  /// Add a track state after it was filtered
+  /// @param trackState The track state, which is the successor of the last
+  ///        recorded one
+  /// @param jacobian The transport Jacobian from the last recorded state
+  template <typename track_state_proxy_t>
+  void record(const track_state_proxy_t& trackState,
+              const BoundMatrix& jacobian) {
+    Entry& entry = m_entries.emplace_back();
+    entry.index = trackState.index();
+    entry.predicted = trackState.predicted();
+    entry.predictedCovariance = trackState.predictedCovariance();
+    entry.filtered = trackState.filtered();
+    entry.filteredCovariance = trackState.filteredCovariance();
+    entry.jacobian = jacobian;
+  }
+
+  /// Run the gain matrix smoothing backwards from a recorded track state
+  ///
+  /// This is equivalent to @c GainMatrixSmoother, given that the recorded
+  /// track states form the track state sequence.
+  ///
+  /// @param trajectory The trajectory the track states belong to
+  /// @param entryIndex The index of the track state to start the smoothing
+  /// @param logger Where to write logging information to
+  template <typename traj_t>
+  Result<void> smooth(traj_t& trajectory, std::size_t entryIndex,
+                      const Logger& logger) const {
+    std::size_t i = m_entries.size();
+    while (i > 0 && m_entries[i - 1].index != entryIndex) {
+      --i;
+    }
+    if (i == 0) {
+      ACTS_ERROR("Track state " << entryIndex << " was not recorded");
+      return KalmanFitterError::SmoothFailed;
+    }
+    --i;
+
+    ACTS_VERBOSE("Smooth " << i + 1 << " cached track states");
+
+    // For the last state: smoothed is filtered
+    trajectory.getTrackState(entryIndex)
+        .shareFrom(TrackStatePropMask::Filtered, TrackStatePropMask::Smoothed);
+
+    BoundVector smoothed = m_entries[i].filtered;
+    BoundSquareMatrix smoothedCovariance = m_entries[i].filteredCovariance;
+
+    for (; i > 0; --i) {
+      const Entry& next = m_entries[i];
+      const Entry& current = m_entries[i - 1];
+
+      // Gain smoothing matrix
+      BoundMatrix G = current.filteredCovariance * next.jacobian.transpose() *
+                      next.predictedCovariance.inverse();
+      if (G.hasNaN()) {
+        ACTS_VERBOSE("Gain smoothing matrix G has NaNs");
+        return KalmanFitterError::SmoothFailed;
+      }
+
+      smoothed = current.filtered + G * (smoothed - next.predicted);
+      smoothedCovariance =
+          current.filteredCovariance +
+          G * (smoothedCovariance - next.predictedCovariance) * G.transpose();
+
+      auto trackState = trajectory.getTrackState(current.index);
+      trackState.addComponents(TrackStatePropMask::Smoothed);
+      trackState.smoothed() = smoothed;
+      trackState.smoothedCovariance() = smoothedCovariance;
+    }
+
+    return Result<void>::success();
+  }
+
+ private:
+  std::vector<Entry> m_entries;
+};
+
+}  // namespace Acts::detail
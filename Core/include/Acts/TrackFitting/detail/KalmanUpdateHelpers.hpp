@@ -13,6 +13,7 @@
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/detail/CorrectedTransformationFreeToBound.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/TrackFitting/FitterTimers.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Result.hpp"
 
@@ -33,6 +34,8 @@ namespace Acts::detail {
 /// @param doCovTransport Whether to perform a covariance transport when
 /// computing the bound state or not
 /// @param freeToBoundCorrection Correction for non-linearity effect during transform from free to bound (only corrected when performing CovTransport)
+/// @param transportJacobian Optional output for the transport Jacobian, which
+/// is then not stored in the track state
 template <typename propagator_state_t, typename stepper_t,
           typename extensions_t, typename traj_t>
 auto kalmanHandleMeasurement(
@@ -41,13 +44,18 @@ auto kalmanHandleMeasurement(
     const Surface &surface, const SourceLink &source_link, traj_t &fittedStates,
     const std::size_t lastTrackIndex, bool doCovTransport, const Logger &logger,
     const FreeToBoundCorrection &freeToBoundCorrection = FreeToBoundCorrection(
-        false)) -> Result<typename traj_t::TrackStateProxy> {
+        false),
+    BoundMatrix *transportJacobian = nullptr)
+    -> Result<typename traj_t::TrackStateProxy> {
   // Add a <mask> TrackState entry multi trajectory. This allocates storage for
   // all components, which we will set later.
   TrackStatePropMask mask =
       TrackStatePropMask::Predicted | TrackStatePropMask::Filtered |
       TrackStatePropMask::Smoothed | TrackStatePropMask::Jacobian |
       TrackStatePropMask::Calibrated;
+  if (transportJacobian != nullptr) {
+    mask &= ~TrackStatePropMask::Jacobian;
+  }
   typename traj_t::TrackStateProxy trackStateProxy =
       fittedStates.makeTrackState(mask, lastTrackIndex);
 
@@ -69,14 +77,21 @@ auto kalmanHandleMeasurement(
     trackStateProxy.predicted() = boundParams.parameters();
     trackStateProxy.predictedCovariance() = state.stepping.cov;
 
-    trackStateProxy.jacobian() = jacobian;
+    if (transportJacobian != nullptr) {
+      *transportJacobian = jacobian;
+    } else {
+      trackStateProxy.jacobian() = jacobian;
+    }
     trackStateProxy.pathLength() = pathLength;
   }
 
   // We have predicted parameters, so calibrate the uncalibrated input
   // measurement
-  extensions.calibrator(state.geoContext, calibrationContext, source_link,
-                        trackStateProxy);
+  {
+    ACTS_FITTER_TIMER(eCalibration);
+    extensions.calibrator(state.geoContext, calibrationContext, source_link,
+                          trackStateProxy);
+  }
 
   // Get and set the type flags
   {
@@ -94,8 +109,12 @@ auto kalmanHandleMeasurement(
     // Else, just tag it as an outlier
     if (!extensions.outlierFinder(trackStateProxy)) {
       // Run Kalman update
-      auto updateRes = extensions.updater(state.geoContext, trackStateProxy,
-                                          state.options.direction, logger);
+      Result<void> updateRes = Result<void>::success();
+      {
+        ACTS_FITTER_TIMER(eUpdate);
+        updateRes = extensions.updater(state.geoContext, trackStateProxy,
+                                       state.options.direction, logger);
+      }
       if (!updateRes.ok()) {
         ACTS_ERROR("Update step failed: " << updateRes.error());
         return updateRes.error();
@@ -131,18 +150,25 @@ auto kalmanHandleMeasurement(
 /// @param doCovTransport Whether to perform a covariance transport when
 /// computing the bound state or not
 /// @param freeToBoundCorrection Correction for non-linearity effect during transform from free to bound (only corrected when performing CovTransport)
+/// @param transportJacobian Optional output for the transport Jacobian, which
+/// is then not stored in the track state
 template <typename propagator_state_t, typename stepper_t, typename traj_t>
 auto kalmanHandleNoMeasurement(
     propagator_state_t &state, const stepper_t &stepper, const Surface &surface,
     traj_t &fittedStates, const std::size_t lastTrackIndex, bool doCovTransport,
     const Logger &logger,
     const FreeToBoundCorrection &freeToBoundCorrection = FreeToBoundCorrection(
-        false)) -> Result<typename traj_t::TrackStateProxy> {
+        false),
+    BoundMatrix *transportJacobian = nullptr)
+    -> Result<typename traj_t::TrackStateProxy> {
   // Add a <mask> TrackState entry multi trajectory. This allocates storage for
   // all components, which we will set later.
   TrackStatePropMask mask = TrackStatePropMask::Predicted |
                             TrackStatePropMask::Smoothed |
                             TrackStatePropMask::Jacobian;
+  if (transportJacobian != nullptr) {
+    mask &= ~TrackStatePropMask::Jacobian;
+  }
   typename traj_t::TrackStateProxy trackStateProxy =
       fittedStates.makeTrackState(mask, lastTrackIndex);
 
@@ -162,7 +188,11 @@ auto kalmanHandleNoMeasurement(
     trackStateProxy.predicted() = boundParams.parameters();
     trackStateProxy.predictedCovariance() = state.stepping.cov;
 
-    trackStateProxy.jacobian() = jacobian;
+    if (transportJacobian != nullptr) {
+      *transportJacobian = jacobian;
+    } else {
+      trackStateProxy.jacobian() = jacobian;
+    }
     trackStateProxy.pathLength() = pathLength;
 
     // Set the filtered parameter index to be the same with predicted
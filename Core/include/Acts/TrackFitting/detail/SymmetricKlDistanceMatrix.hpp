@@ -14,6 +14,14 @@
 #include "Acts/TrackFitting/detail/GsfComponentMerging.hpp"
 #include "Acts/TrackFitting/detail/GsfUtils.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 namespace Acts::detail {
 
 /// Computes the Kullback-Leibler distance between two components as shown in
@@ -65,28 +73,75 @@ auto mergeComponents(const component_t &a, const component_t &b,
 }
 
 /// @brief Class representing a symmetric distance matrix
+///
+/// The q/p values and variances of the components are kept in separate
+/// arrays, so the distances of one component to all others are computed in
+/// one vectorised expression. The smallest distance is found with a binary
+/// heap. Entries of components which were changed or masked since they were
+/// pushed are outdated and skipped lazily, which makes a merge step
+/// O(n log n) instead of a scan over all O(n^2) pairs.
 class SymmetricKLDistanceMatrix {
   using Array = Eigen::Array<Acts::ActsScalar, Eigen::Dynamic, 1>;
-  using Mask = Eigen::Array<bool, Eigen::Dynamic, 1>;
+
+  struct HeapEntry {
+    Acts::ActsScalar distance;
+    std::size_t index;
+    std::uint32_t versionI;
+    std::uint32_t versionJ;
+  };
+
+  /// Orders the heap by distance and then by the index into the triangular
+  /// matrix, which preserves the choice of a linear scan for equal distances
+  struct HeapCompare {
+    bool operator()(const HeapEntry &a, const HeapEntry &b) const {
+      return a.distance > b.distance ||
+             (a.distance == b.distance && a.index > b.index);
+    }
+  };
 
   Array m_distances;
-  Mask m_mask;
+  Array m_qop;
+  Array m_var;
+  Array m_invVar;
+  std::vector<bool> m_active;
+  std::vector<std::uint32_t> m_version;
   std::vector<std::pair<std::size_t, std::size_t>> m_mapToPair;
+  std::vector<HeapEntry> m_heap;
   std::size_t m_numberComponents;
 
-  template <typename array_t, typename setter_t>
-  void setAssociated(std::size_t n, array_t &array, setter_t &&setter) {
-    const auto indexConst = (n - 1) * n / 2;
+  static std::size_t linearIndex(std::size_t i, std::size_t j) {
+    assert(i > j && "need index of lower triangle");
+    return (i - 1) * i / 2 + j;
+  }
 
-    // Rows
-    for (auto i = 0ul; i < n; ++i) {
-      array[indexConst + i] = setter(n, i);
-    }
+  template <typename component_t, typename projector_t>
+  void setComponent(std::size_t n, const component_t &cmp,
+                    const projector_t &proj) {
+    m_qop[n] = proj(cmp).boundPars[eBoundQOverP];
+    m_var[n] = proj(cmp).boundCov(eBoundQOverP, eBoundQOverP);
+    assert(m_var[n] != 0.0);
+    assert(std::isfinite(m_var[n]));
+    m_invVar[n] = 1 / m_var[n];
+  }
 
-    // Columns
-    for (auto i = n + 1; i < m_numberComponents; ++i) {
-      array[(i - 1) * i / 2 + n] = setter(n, i);
-    }
+  /// Distances of component n to all components, same expression as
+  /// @c computeSymmetricKlDivergence
+  Array distancesTo(std::size_t n) const {
+    const Array diff = m_qop - m_qop[n];
+    return m_var[n] * m_invVar + m_var * m_invVar[n] +
+           diff * (m_invVar + m_invVar[n]) * diff;
+  }
+
+  void push(std::size_t i, std::size_t j) {
+    const std::size_t index = linearIndex(i, j);
+    m_heap.push_back({m_distances[index], index, m_version[i], m_version[j]});
+    std::push_heap(m_heap.begin(), m_heap.end(), HeapCompare{});
+  }
+
+  bool isCurrent(const HeapEntry &entry) const {
+    const auto [i, j] = m_mapToPair[entry.index];
+    return m_active[i] && m_active[j] && m_version[i] == entry.versionI &&
+           m_version[j] == entry.versionJ;
   }
 
  public:
@@ -94,17 +149,29 @@ class SymmetricKLDistanceMatrix {
   SymmetricKLDistanceMatrix(const std::vector<component_t> &cmps,
                             const projector_t &proj)
       : m_distances(Array::Zero(cmps.size() * (cmps.size() - 1) / 2)),
-        m_mask(Mask::Ones(cmps.size() * (cmps.size() - 1) / 2)),
+        m_qop(cmps.size()),
+        m_var(cmps.size()),
+        m_invVar(cmps.size()),
+        m_active(cmps.size(), true),
+        m_version(cmps.size(), 0),
         m_mapToPair(m_distances.size()),
         m_numberComponents(cmps.size()) {
+    for (auto i = 0ul; i < m_numberComponents; ++i) {
+      setComponent(i, cmps[i], proj);
+    }
+
+    m_heap.reserve(m_distances.size() + m_numberComponents);
     for (auto i = 1ul; i < m_numberComponents; ++i) {
       const auto indexConst = (i - 1) * i / 2;
+      const Array row = distancesTo(i);
       for (auto j = 0ul; j < i; ++j) {
-        m_mapToPair.at(indexConst + j) = {i, j};
-        m_distances[indexConst + j] =
-            computeSymmetricKlDivergence(cmps[i], cmps[j], proj);
+        m_mapToPair[indexConst + j] = {i, j};
+        m_distances[indexConst + j] = row[j];
+        assert(row[j] >= 0.0 && "kl-divergence must be non-negative");
+        m_heap.push_back({row[j], indexConst + j, 0, 0});
       }
     }
+    std::make_heap(m_heap.begin(), m_heap.end(), HeapCompare{});
   }
 
   auto at(std::size_t i, std::size_t j) const {
@@ -117,28 +184,31 @@ class SymmetricKLDistanceMatrix {
                                     const projector_t &proj) {
     assert(cmps.size() == m_numberComponents && "size mismatch");
 
-    setAssociated(n, m_distances, [&](std::size_t i, std::size_t j) {
-      return computeSymmetricKlDivergence(cmps[i], cmps[j], proj);
-    });
-  }
+    setComponent(n, cmps[n], proj);
+    ++m_version[n];
 
-  void maskAssociatedDistances(std::size_t n) {
-    setAssociated(n, m_mask, [&](std::size_t, std::size_t) { return false; });
+    const Array row = distancesTo(n);
+    for (auto i = 0ul; i < m_numberComponents; ++i) {
+      if (i == n) {
+        continue;
+      }
+      const auto [a, b] = i < n ? std::pair{n, i} : std::pair{i, n};
+      m_distances[linearIndex(a, b)] = row[i];
+      if (m_active[n] && m_active[i]) {
+        push(a, b);
+      }
+    }
   }
 
-  auto minDistancePair() const {
-    auto min = std::numeric_limits<Acts::ActsScalar>::max();
-    std::size_t idx = 0;
+  void maskAssociatedDistances(std::size_t n) { m_active[n] = false; }
 
-    for (auto i = 0l; i < m_distances.size(); ++i) {
-      if (auto new_min = std::min(min, m_distances[i]);
-          m_mask[i] && new_min < min) {
-        min = new_min;
-        idx = i;
-      }
+  auto minDistancePair() {
+    while (!m_heap.empty() && !isCurrent(m_heap.front())) {
+      std::pop_heap(m_heap.begin(), m_heap.end(), HeapCompare{});
+      m_heap.pop_back();
     }
-
-    return m_mapToPair.at(idx);
+    assert(!m_heap.empty() && "no unmasked distance left");
+    return m_mapToPair.at(m_heap.front().index);
   }
 
   friend std::ostream &operator<<(std::ostream &os,
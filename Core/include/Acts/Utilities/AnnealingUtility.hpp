@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 namespace Acts {
@@ -63,6 +64,21 @@ class AnnealingUtility {
   double getWeight(State& state, double chi2,
                    const std::vector<double>& allChi2) const;
 
+  /// @brief Weight access for a set of tracks
+  ///
+  /// The compatibilities of each track to all vertices it is attached to are
+  /// given as the contiguous range `allChi2[offsets[i], offsets[i + 1])`.
+  /// The weights are written in the same layout and are identical to the
+  /// ones of `getWeight`, but each exponential is only evaluated once.
+  ///
+  /// @param state The state object
+  /// @param allChi2 Compatibilities of all tracks, grouped by track
+  /// @param offsets Offsets of the groups, with one more entry than tracks
+  /// @param weights Calculated weights according to Eq.(5.46) in Ref.(1)
+  void getWeights(State& state, const std::vector<double>& allChi2,
+                  const std::vector<std::size_t>& offsets,
+                  std::vector<double>& weights) const;
+
   /// @brief Weight access
   ///
   /// @param state The state object
@@ -0,0 +1,127 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace Acts {
+namespace Logging {
+
+/// @brief print debug messages asynchronously on a background thread
+///
+/// Messages are pushed into lock-free ring buffers, one per group of logging
+/// threads, and handed over to the wrapped print policy by a single sink
+/// thread. The wrapped policy is therefore only ever called from the sink
+/// thread and does not need to be thread-safe.
+///
+/// This policy is meant to wrap only the policy that writes the message, with
+/// the formatting decorators placed around it. The decorators then run in the
+/// logging thread, such that time stamps and thread IDs refer to it, and only
+/// the finished string is queued.
+///
+/// Messages of one thread are printed in order, messages of different threads
+/// may be reordered.
+///
+/// Messages reaching the failure threshold are printed synchronously after
+/// all pending messages, such that the @c ThresholdFailure is raised in the
+/// logging thread.
+class AsyncPrintPolicy final : public OutputDecorator {
+ public:
+  /// Configuration of the asynchronous backend
+  struct Config {
+    /// Number of ring buffers, the threads are distributed over them
+    std::size_t nBuffers = 16;
+    /// Number of messages each ring buffer can hold
+    std::size_t bufferSize = 1024;
+    /// Drop new messages if the ring buffer is full instead of waiting
+    bool dropWhenFull = false;
+    /// Time the sink thread sleeps when there is nothing to print
+    std::chrono::microseconds pollInterval{500};
+  };
+
+  /// @brief constructor starting a new sink thread
+  ///
+  /// @param [in] wrappee output print policy object to be called on the sink
+  ///        thread
+  /// @param [in] cfg     configuration of the asynchronous backend
+  AsyncPrintPolicy(std::unique_ptr<OutputPrintPolicy> wrappee,
+                   const Config& cfg);
+
+  /// @brief constructor starting a new sink thread with the default config
+  ///
+  /// @param [in] wrappee output print policy object to be called on the sink
+  ///        thread
+  explicit AsyncPrintPolicy(std::unique_ptr<OutputPrintPolicy> wrappee);
+
+  /// @brief constructor sharing the sink thread of another policy
+  ///
+  /// @param [in] wrappee output print policy object to be called on the sink
+  ///        thread
+  /// @param [in] other   policy whose sink thread is used
+  AsyncPrintPolicy(std::unique_ptr<OutputPrintPolicy> wrappee,
+                   const AsyncPrintPolicy& other);
+
+  /// @brief destructor waiting for the pending messages of this policy
+  ~AsyncPrintPolicy() override;
+
+  /// @brief queue the debug message for the sink thread
+  ///
+  /// @param [in] lvl   debug level of debug message
+  /// @param [in] input text of debug message
+  void flush(const Level& lvl, const std::string& input) override;
+
+  /// Make a copy of this print policy with a new name, the copy shares the
+  /// sink thread
+  /// @param name the new name
+  /// @return the copy
+  std::unique_ptr<OutputPrintPolicy> clone(
+      const std::string& name) const override;
+
+  /// Block until all the messages queued so far are printed
+  void waitForFlush() const;
+
+  /// Return the number of messages dropped because of full ring buffers
+  /// @return the number of dropped messages
+  std::size_t nDropped() const;
+
+ private:
+  class Backend;
+
+  /// asynchronous backend, shared between the clones
+  std::shared_ptr<Backend> m_backend;
+};
+
+}  // namespace Logging
+
+/// @brief get default asynchronous debug output logger
+///
+/// @param [in] name       name of the logger instance
+/// @param [in] lvl        debug threshold level
+/// @param [in] log_stream output stream used for printing debug messages
+///
+/// This function returns a pointer to a Logger instance with the same
+/// decorations as @c getDefaultLogger. The messages are formatted in the
+/// logging thread and written to @p log_stream on a sink thread.
+///
+/// All the loggers created with this function share the same sink thread. It
+/// is started by the first call and joined once the last of these loggers is
+/// destroyed, at the latest during static destruction.
+///
+/// @return pointer to logging instance
+std::unique_ptr<const Logger> getDefaultAsyncLogger(
+    const std::string& name, const Logging::Level& lvl,
+    std::ostream* log_stream = &std::cout);
+
+}  // namespace Acts
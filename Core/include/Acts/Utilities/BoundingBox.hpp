@@ -10,12 +10,17 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Utilities/Frustum.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/Ray.hpp"
 #include "Acts/Visualization/IVisualization3D.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace Acts {
@@ -350,6 +355,29 @@ box_t* make_octree(std::vector<std::unique_ptr<box_t>>& store,
                    const std::vector<box_t*>& prims, std::size_t max_depth = 1,
                    typename box_t::value_type envelope1 = 0);
 
+/**
+ * Build a binary bounding volume hierarchy from a list of bounding boxes.
+ * The boxes are split recursively where the surface area heuristic (SAH),
+ * evaluated on a fixed number of bins of the box centers along each axis,
+ * predicts the cheapest traversal. Compared to the octree, this adapts to
+ * unevenly distributed boxes, e.g. the modules of a barrel layer.
+ * The resulting hierarchy is traversed like the octree. Large independent
+ * subtrees are built concurrently if @c Acts::maxThreads allows it.
+ * @note @p store and @p prims do not need to contain the same objects. @p store
+ * is only used to pass ownership back to the caller while preserving memory
+ * location.
+ * @tparam box_t Works with all box types of at least two dimensions.
+ * @param store Owns the created boxes by means of `std::unique_ptr`.
+ * @param prims Boxes to store. This is a read only vector.
+ * @param max_leaf_size Boxes with at most this many children are not split.
+ * @param envelope1 Envelope to add/subtract to dimensions in all directions.
+ * @return Pointer to the top most bounding box, containing the entire BVH
+ */
+template <typename box_t>
+box_t* make_bvh(std::vector<std::unique_ptr<box_t>>& store,
+                const std::vector<box_t*>& prims, std::size_t max_leaf_size = 4,
+                typename box_t::value_type envelope1 = 0);
+
 /**
  * Overload of the << operator for bounding boxes.
  * @tparam T entity type
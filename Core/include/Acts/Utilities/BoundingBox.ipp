@@ -546,6 +546,169 @@ box_t* Acts::make_octree(std::vector<std::unique_ptr<box_t>>& store,
   return top;
 }
 
+template <typename box_t>
+typename box_t::value_type bvh_area(
+    const typename box_t::vertex_array_type& width) {
+  // half of the surface area, the factor does not matter for the comparison
+  typename box_t::value_type area = 0;
+  for (std::size_t i = 0; i < box_t::dim; i++) {
+    for (std::size_t j = i + 1; j < box_t::dim; j++) {
+      area += width[i] * width[j];
+    }
+  }
+  return area;
+}
+
+template <typename box_t>
+typename std::vector<box_t*>::iterator bvh_split(
+    typename std::vector<box_t*>::iterator begin,
+    typename std::vector<box_t*>::iterator end) {
+  using value_type = typename box_t::value_type;
+  using vertex_array_type = typename box_t::vertex_array_type;
+  constexpr std::size_t nBins = 16;
+  constexpr value_type lowest = std::numeric_limits<value_type>::lowest();
+  constexpr value_type highest = std::numeric_limits<value_type>::max();
+
+  vertex_array_type cmin(vertex_array_type::Constant(highest));
+  vertex_array_type cmax(vertex_array_type::Constant(lowest));
+  for (auto it = begin; it != end; ++it) {
+    cmin = cmin.min((*it)->center().array());
+    cmax = cmax.max((*it)->center().array());
+  }
+
+  std::size_t bestAxis = box_t::dim;
+  std::size_t bestBin = 0;
+  value_type bestCost = highest;
+  std::array<std::size_t, nBins> counts{};
+  std::array<vertex_array_type, nBins> bmin{};
+  std::array<vertex_array_type, nBins> bmax{};
+  std::array<value_type, nBins> rightCost{};
+
+  auto binOf = [&](const box_t* box, std::size_t axis) {
+    value_type rel = (box->center()[axis] - cmin[axis]) /
+                     (cmax[axis] - cmin[axis]) * nBins;
+    return std::min(static_cast<std::size_t>(rel), nBins - 1);
+  };
+
+  for (std::size_t axis = 0; axis < box_t::dim; axis++) {
+    if (!(cmax[axis] > cmin[axis])) {
+      continue;
+    }
+    counts.fill(0);
+    bmin.fill(vertex_array_type::Constant(highest));
+    bmax.fill(vertex_array_type::Constant(lowest));
+    for (auto it = begin; it != end; ++it) {
+      std::size_t b = binOf(*it, axis);
+      counts[b]++;
+      bmin[b] = bmin[b].min((*it)->min().array());
+      bmax[b] = bmax[b].max((*it)->max().array());
+    }
+
+    // sweep from the right to get the cost of the upper part of each split
+    vertex_array_type vmin(vertex_array_type::Constant(highest));
+    vertex_array_type vmax(vertex_array_type::Constant(lowest));
+    std::size_t count = 0;
+    for (std::size_t b = nBins - 1; b > 0; b--) {
+      vmin = vmin.min(bmin[b]);
+      vmax = vmax.max(bmax[b]);
+      count += counts[b];
+      rightCost[b] = count * bvh_area<box_t>(vmax - vmin);
+    }
+
+    // sweep from the left, the split is in front of bin b
+    vmin = vertex_array_type::Constant(highest);
+    vmax = vertex_array_type::Constant(lowest);
+    count = 0;
+    for (std::size_t b = 1; b < nBins; b++) {
+      vmin = vmin.min(bmin[b - 1]);
+      vmax = vmax.max(bmax[b - 1]);
+      count += counts[b - 1];
+      if (count == 0 || count == static_cast<std::size_t>(end - begin)) {
+        continue;
+      }
+      value_type cost = count * bvh_area<box_t>(vmax - vmin) + rightCost[b];
+      if (cost < bestCost) {
+        bestCost = cost;
+        bestAxis = axis;
+        bestBin = b;
+      }
+    }
+  }
+
+  if (bestAxis == box_t::dim) {
+    // all centers coincide, split in the middle
+    return begin + (end - begin) / 2;
+  }
+  return std::partition(begin, end, [&](const box_t* box) {
+    return binOf(box, bestAxis) < bestBin;
+  });
+}
+
+template <typename box_t>
+box_t* bvh_inner(std::vector<std::unique_ptr<box_t>>& store,
+                 std::size_t max_leaf_size,
+                 typename box_t::vertex_array_type envelope,
+                 typename std::vector<box_t*>::iterator begin,
+                 typename std::vector<box_t*>::iterator end) {
+  // below this size a subtree is not worth a thread
+  constexpr std::ptrdiff_t min_parallel_size = 256;
+
+  assert(end - begin > 0);
+  if (end - begin == 1) {
+    // just return
+    return *begin;
+  }
+
+  if (end - begin <= static_cast<std::ptrdiff_t>(max_leaf_size)) {
+    // just wrap them all up
+    store.push_back(
+        std::make_unique<box_t>(std::vector<box_t*>(begin, end), envelope));
+    return store.back().get();
+  }
+
+  auto mid = bvh_split<box_t>(begin, end);
+
+  // the two ranges are disjoint, the upper subtree can be built on its own
+  // thread with a separate store, which is merged afterwards
+  std::vector<box_t*> children(2, nullptr);
+  if (Acts::maxThreads() > 1 && end - begin >= 2 * min_parallel_size) {
+    std::vector<std::unique_ptr<box_t>> upper_store;
+    Acts::parallelFor(2, [&](std::size_t half) {
+      if (half == 0) {
+        children[0] = bvh_inner(store, max_leaf_size, envelope, begin, mid);
+      } else {
+        children[1] = bvh_inner(upper_store, max_leaf_size, envelope, mid, end);
+      }
+    });
+    std::move(upper_store.begin(), upper_store.end(),
+              std::back_inserter(store));
+  } else {
+    children[0] = bvh_inner(store, max_leaf_size, envelope, begin, mid);
+    children[1] = bvh_inner(store, max_leaf_size, envelope, mid, end);
+  }
+
+  store.push_back(std::make_unique<box_t>(children, envelope));
+  return store.back().get();
+}
+
+template <typename box_t>
+box_t* Acts::make_bvh(std::vector<std::unique_ptr<box_t>>& store,
+                      const std::vector<box_t*>& prims,
+                      std::size_t max_leaf_size,
+                      typename box_t::value_type envelope1) {
+  static_assert(box_t::dim >= 2, "BVH needs at least two dimensions");
+
+  using vertex_array_type = typename box_t::vertex_array_type;
+
+  vertex_array_type envelope(vertex_array_type::Constant(envelope1));
+
+  // the split reorders the boxes, leave the input untouched
+  std::vector<box_t*> lprims = prims;
+  box_t* top = bvh_inner(store, std::max<std::size_t>(max_leaf_size, 2),
+                         envelope, lprims.begin(), lprims.end());
+  return top;
+}
+
 template <typename T, typename U, std::size_t V>
 std::ostream& Acts::operator<<(
     std::ostream& os, const Acts::AxisAlignedBoundingBox<T, U, V>& box) {
@@ -8,15 +8,18 @@
 
 #pragma once
 
-#include "Acts/Utilities/KDTree.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <iostream>
-#include <memory>
-#include <string>
+#include <limits>
+#include <numeric>
+#include <utility>
 #include <vector>
 
 namespace Acts {
@@ -26,22 +29,24 @@ namespace Acts {
 /// algorithm. The DBScan algorithm uses density information to cluster together
 /// points that are close to each other.
 ///
-/// For each point, we will look for the neighbours that are within the epsilon
-/// radius. If the number of neighbours is greater than the minimum number of
-/// points, we will start a new cluster and assign the current point to it. We
-/// will then look for the neighbours of the neighbours and assign them to the
-/// current cluster if they are not already assigned to a cluster. If the
-/// neighbours have itself more than the minimum number of points as neighbours,
-/// we will repeat the process on those neighbours.
+/// A point with at least the minimum number of points (itself included)
+/// within the epsilon radius is a core point. Core points within the epsilon
+/// radius of each other belong to the same cluster. The remaining points are
+/// assigned to the cluster of a core point in their epsilon radius, or are
+/// noise if there is none.
 ///
-/// To speed up the search for the neighbours, we use the KDTree implemented in
-/// ACTS. It performs a range search in the orthogonal hypercube with a length
-/// of 2 epsilon. An extra cut is used to only keep the neighbours that are
-/// within the epsilon radius.
+/// To speed up the search for the neighbours, the points are sorted into a
+/// grid of cells with a side length of epsilon, such that all neighbours of a
+/// point are found in the adjacent cells. The clusters are then formed by a
+/// union-find over the core points of neighbouring cells. All steps can run
+/// on several threads, the result does not depend on their number:
+/// - the clusters are numbered in the order of their first core point
+/// - a non-core point is assigned to the lowest numbered cluster among its
+///   core neighbours
 ///
 /// @tparam kDims The number of dimensions.
 /// @tparam scalar_t The scalar type used to construct position vectors.
-/// @tparam kLeafSize The maximum number of points in a leaf node of the KDTree.
+/// @tparam kLeafSize Not used by the cell grid, kept for source compatibility.
 template <std::size_t kDims, typename scalar_t = double,
           std::size_t kLeafSize = 4>
 class DBScan {
@@ -58,9 +63,6 @@ class DBScan {
   // The type of a vector of coordinate-ID pairs.
   using VectorPairs = std::vector<Pair>;
 
-  // KDTree used before the DBScan algorithm to find the neighbours.
-  using Tree = KDTree<kDims, std::size_t, scalar_t, std::array, kLeafSize>;
-
   // Remove the default constructor.
   DBScan() = delete;
 
@@ -70,6 +72,9 @@ class DBScan {
   /// @param minPoints The minimum number of points to form a cluster.
   /// @param onePointCluster If true, all the noise points are considered as
   /// individual one point clusters.
+  ///
+  /// The clustering is split over up to @c Acts::maxThreads threads, the
+  /// clusters do not depend on the number of threads.
   DBScan(scalar_t epsilon = 1.0, std::size_t minPoints = 1,
          bool onePointCluster = false)
       : m_eps(epsilon),
@@ -78,9 +83,9 @@ class DBScan {
 
   /// @brief Cluster the input points.
   ///
-  /// This function implements the main loop of the DBScan algorithm.
-  /// It loops over all the point and will try to start new cluster
-  /// if it finds points that have yet to be clustered.
+  /// This function implements the main steps of the DBScan algorithm: it
+  /// sorts the points into cells, flags the core points, connects the core
+  /// points of neighbouring cells and finally labels all points.
   ///
   /// @param inputPoints The input points to cluster.
   /// @param clusteredPoints Vector containing the cluster ID of each point.
@@ -88,39 +93,137 @@ class DBScan {
   ///
   int cluster(const VectorPoints& inputPoints,
               std::vector<int>& clusteredPoints) {
-    // Transform the initial vector of input point to a vector of pairs
-    // with the index of the point in the initial vector.
-    VectorPairs inputPointsWithIndex;
-    for (std::size_t id = 0; id < inputPoints.size(); id++) {
-      inputPointsWithIndex.push_back(std::make_pair(inputPoints[id], id));
+    const std::size_t nPoints = inputPoints.size();
+    // By default all the points are considered as noise.
+    clusteredPoints = std::vector<int>(nPoints, -1);
+
+    // Sort the points into the cells, the order within a cell is the input
+    // order to keep the result reproducible.
+    const scalar_t cellSize = m_eps > 0 ? m_eps : scalar_t{1};
+    std::vector<CellKey> keys(nPoints);
+    forEachChunk(nPoints, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t id = begin; id < end; ++id) {
+        for (std::size_t dim = 0; dim < kDims; dim++) {
+          keys[id][dim] = static_cast<std::int64_t>(
+              std::floor(inputPoints[id][dim] / cellSize));
+        }
+      }
+    });
+    std::vector<std::size_t> sorted(nPoints);
+    std::iota(sorted.begin(), sorted.end(), 0u);
+    std::sort(sorted.begin(), sorted.end(),
+              [&keys](std::size_t a, std::size_t b) {
+                return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+              });
+
+    // The cells are contiguous ranges of the sorted points
+    std::vector<Cell> cells;
+    std::vector<std::size_t> cellOfPoint(nPoints);
+    for (std::size_t i = 0; i < nPoints; ++i) {
+      if (cells.empty() || keys[sorted[i]] != cells.back().key) {
+        cells.push_back({keys[sorted[i]], i, i});
+      }
+      cells.back().end = i + 1;
+      cellOfPoint[sorted[i]] = cells.size() - 1;
     }
-    // Build the KDTree with the input points.
-    Tree tree = Tree(std::move(inputPointsWithIndex));
 
-    // Initialize the cluster ID to 0.
-    int clusterID = 0;
-    // By default all the points are considered as noise.
-    clusteredPoints = std::vector<int>(inputPoints.size(), -1);
+    // The non-empty adjacent cells of each cell, including itself
+    std::vector<std::vector<std::size_t>> adjacentCells(cells.size());
+    forEachChunk(cells.size(), [&](std::size_t begin, std::size_t end) {
+      for (std::size_t ic = begin; ic < end; ++ic) {
+        adjacentCells[ic] = findAdjacentCells(cells, ic);
+      }
+    });
 
-    // Loop over all the points
-    for (std::size_t id = 0; id < inputPoints.size(); id++) {
-      // If the point is already assigned to a cluster, skip it.
-      if (clusteredPoints[id] != -1) {
+    // Loop over all the neighbours of a point with a side-effecting
+    // function, which can stop the loop by returning false.
+    const scalar_t eps2 = m_eps * m_eps;
+    auto forEachNeighbour = [&](std::size_t id, auto&& f) {
+      for (std::size_t ic : adjacentCells[cellOfPoint[id]]) {
+        for (std::size_t i = cells[ic].begin; i < cells[ic].end; ++i) {
+          const std::size_t other = sorted[i];
+          scalar_t distance = 0;
+          for (std::size_t dim = 0; dim < kDims; dim++) {
+            distance += (inputPoints[other][dim] - inputPoints[id][dim]) *
+                        (inputPoints[other][dim] - inputPoints[id][dim]);
+          }
+          if (distance <= eps2 && !f(other)) {
+            return;
+          }
+        }
+      }
+    };
+
+    // Flag the core points, the point itself counts as a neighbour
+    std::vector<char> isCore(nPoints, 0);
+    forEachChunk(nPoints, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t id = begin; id < end; ++id) {
+        std::size_t nNeighbours = 0;
+        forEachNeighbour(id, [&](std::size_t /*other*/) {
+          return ++nNeighbours < m_minPoints;
+        });
+        isCore[id] = nNeighbours >= m_minPoints ? 1 : 0;
+      }
+    });
+
+    // Connect the core points within the epsilon radius. The union-find
+    // always links the larger root to the smaller one, such that it can
+    // safely run on several threads.
+    std::vector<std::atomic<std::size_t>> parents(nPoints);
+    for (std::size_t id = 0; id < nPoints; ++id) {
+      parents[id].store(id, std::memory_order_relaxed);
+    }
+    forEachChunk(nPoints, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t id = begin; id < end; ++id) {
+        if (isCore[id] == 0) {
+          continue;
+        }
+        forEachNeighbour(id, [&](std::size_t other) {
+          if (other < id && isCore[other] != 0) {
+            unite(parents, id, other);
+          }
+          return true;
+        });
+      }
+    });
+
+    // Number the clusters in the order of their first core point
+    int clusterID = 0;
+    for (std::size_t id = 0; id < nPoints; ++id) {
+      if (isCore[id] == 0) {
         continue;
       }
-      // If not we try to build a new cluster
-      std::vector<std::size_t> pointToProcess{id};
-      expandCluster(tree, inputPoints, pointToProcess, clusteredPoints,
-                    clusterID);
-      // If the cluster has been created, increment the cluster ID.
-      if (clusteredPoints[id] != -1) {
-        clusterID++;
+      const std::size_t root = find(parents, id);
+      if (root == id) {
+        clusteredPoints[id] = clusterID++;
+      } else {
+        clusteredPoints[id] = clusteredPoints[root];
       }
     }
+
+    // Assign the remaining points to the lowest numbered cluster of their
+    // core neighbours
+    forEachChunk(nPoints, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t id = begin; id < end; ++id) {
+        if (isCore[id] != 0) {
+          continue;
+        }
+        int label = std::numeric_limits<int>::max();
+        forEachNeighbour(id, [&](std::size_t other) {
+          if (isCore[other] != 0) {
+            label = std::min(label, clusteredPoints[other]);
+          }
+          return true;
+        });
+        if (label != std::numeric_limits<int>::max()) {
+          clusteredPoints[id] = label;
+        }
+      }
+    });
+
     if (m_onePointCluster) {
       // If noise is present and onePointCluster is true, all the noise points
-      // are considered as individual one point clusters. Loop over all the
-      // points in the KDTree.
+      // are considered as individual one point clusters.
       for (auto& cluster : clusteredPoints) {
         // If the point is assigned to noise, assign it to a new cluster.
         if (cluster == -1) {
@@ -133,94 +236,119 @@ class DBScan {
   }
 
  private:
-  /// @brief Extend the cluster.
-  ///
-  /// This function will extend the cluster by finding all the neighbours of the
-  /// current point and assign them to the current cluster.
-  /// The KDTree is used to find the neighbours and an extra cut is used to only
-  /// keep the neighbours that are within the epsilon radius.
+  // The integer coordinates of a cell.
+  using CellKey = std::array<std::int64_t, kDims>;
+
+  // A non-empty cell as range of the sorted points.
+  struct Cell {
+    CellKey key;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+  };
+
+  /// @brief Find the non-empty cells adjacent to a cell.
   ///
-  /// @param tree The KDTree containing all the points.
-  /// @param inputPoints The vector containing the input points.
-  /// @param pointsToProcess The vector containing the ids of the points that need to be
-  /// processed.
-  /// @param clusteredPoints Vector containing the cluster ID of each point.
-  /// @param clusterID The ID of the current cluster.
+  /// @param cells The sorted non-empty cells.
+  /// @param ic The index of the cell.
+  /// @return The indices of the adjacent cells, including the cell itself.
   ///
-  void expandCluster(const Tree& tree, const VectorPoints& inputPoints,
-                     const std::vector<std::size_t>& pointsToProcess,
-                     std::vector<int>& clusteredPoints, const int clusterID) {
-    // Loop over all the points that need to be process.
-    for (const auto id : pointsToProcess) {
-      // Lets look for the neighbours of the current point.
-      const Point currentPoint = inputPoints[id];
-      std::vector<std::size_t> neighbours;
-      // We create the range in which we will look for the neighbours (an
-      // hypercube with a length of 2 epsilon).
-      typename Tree::range_t range;
+  static std::vector<std::size_t> findAdjacentCells(
+      const std::vector<Cell>& cells, std::size_t ic) {
+    std::vector<std::size_t> adjacent;
+    // Loop over the 3^kDims combinations of offsets -1, 0, 1
+    std::array<std::int64_t, kDims> offset;
+    offset.fill(-1);
+    while (true) {
+      CellKey key = cells[ic].key;
       for (std::size_t dim = 0; dim < kDims; dim++) {
-        range[dim] = Range1D<scalar_t>(currentPoint[dim] - m_eps,
-                                       currentPoint[dim] + m_eps);
-      }
-      // We use the KDTree to find the neighbours.
-      // An extra cut needs to be applied to only keep the neighbours that
-      // are within the epsilon radius.
-      tree.rangeSearchMapDiscard(
-          range, [this, &neighbours, currentPoint](
-                     const typename Tree::coordinate_t& pos,
-                     const typename Tree::value_t& val) {
-            scalar_t distance = 0;
-            for (std::size_t dim = 0; dim < kDims; dim++) {
-              distance += (pos[dim] - currentPoint[dim]) *
-                          (pos[dim] - currentPoint[dim]);
-            }
-            if (distance <= m_eps * m_eps) {
-              neighbours.push_back(val);
-            }
-          });
-      std::size_t nNeighbours = neighbours.size();
-      // If a cluster has already been started we add the neighbours to it
-      if (clusteredPoints[id] != -1) {
-        updateNeighbours(neighbours, clusteredPoints, clusterID);
-      }
-      if (nNeighbours >= m_minPoints) {
-        // If the cluster has not been started yet and we have enough
-        // neighbours, we start the cluster and assign the current point and its
-        // neighbours to it.
-        if (clusteredPoints[id] == -1) {
-          clusteredPoints[id] = clusterID;
-          updateNeighbours(neighbours, clusteredPoints, clusterID);
-        }
-        // Try to extend the cluster with the neighbours.
-        expandCluster(tree, inputPoints, neighbours, clusteredPoints,
-                      clusterID);
+        key[dim] += offset[dim];
       }
+      auto it = std::lower_bound(
+          cells.begin(), cells.end(), key,
+          [](const Cell& cell, const CellKey& k) { return cell.key < k; });
+      if (it != cells.end() && it->key == key) {
+        adjacent.push_back(std::distance(cells.begin(), it));
+      }
+      // Next combination
+      std::size_t dim = 0;
+      while (dim < kDims && offset[dim] == 1) {
+        offset[dim] = -1;
+        ++dim;
+      }
+      if (dim == kDims) {
+        break;
+      }
+      ++offset[dim];
     }
+    return adjacent;
   }
 
-  /// @brief Update the neighbours.
+  /// @brief Find the root of a point in the union-find forest.
   ///
-  /// This function will remove the neighbours that are already assigned to a
-  /// cluster and assign the remaining ones to the current cluster.
+  /// @param parents The parent of each point.
+  /// @param id The point.
+  /// @return The root of the point.
   ///
-  /// @param neighbours The vector containing the ids of the neighbours.
-  /// @param clusteredPoints Vector containing the cluster ID of each point.
-  /// @param clusterID The ID of the current cluster.
+  static std::size_t find(std::vector<std::atomic<std::size_t>>& parents,
+                          std::size_t id) {
+    while (true) {
+      std::size_t parent = parents[id].load();
+      if (parent == id) {
+        return id;
+      }
+      // Path halving, losing the race only means less compression
+      std::size_t grandParent = parents[parent].load();
+      if (parent != grandParent) {
+        parents[id].compare_exchange_weak(parent, grandParent);
+      }
+      id = grandParent;
+    }
+  }
+
+  /// @brief Merge the sets of two points in the union-find forest.
   ///
-  void updateNeighbours(std::vector<std::size_t>& neighbours,
-                        std::vector<int>& clusteredPoints,
-                        const int clusterID) {
-    neighbours.erase(std::remove_if(neighbours.begin(), neighbours.end(),
-                                    [&clusteredPoints](int i) {
-                                      return clusteredPoints[i] != -1;
-                                    }),
-                     neighbours.end());
-
-    for (const auto& neighbour : neighbours) {
-      clusteredPoints[neighbour] = clusterID;
+  /// @param parents The parent of each point.
+  /// @param a The first point.
+  /// @param b The second point.
+  ///
+  static void unite(std::vector<std::atomic<std::size_t>>& parents,
+                    std::size_t a, std::size_t b) {
+    while (true) {
+      a = find(parents, a);
+      b = find(parents, b);
+      if (a == b) {
+        return;
+      }
+      if (a < b) {
+        std::swap(a, b);
+      }
+      // Only link a root, retry if another thread linked it before
+      std::size_t expected = a;
+      if (parents[a].compare_exchange_strong(expected, b)) {
+        return;
+      }
     }
   }
 
+  /// @brief Run a function on contiguous chunks of a range of indices.
+  ///
+  /// @param n The number of indices.
+  /// @param f The function to call with the begin and end of a chunk.
+  ///
+  void forEachChunk(
+      std::size_t n,
+      const std::function<void(std::size_t, std::size_t)>& f) const {
+    const std::size_t nChunks = std::min(
+        Acts::maxThreads(), std::max<std::size_t>(n / s_minChunk, 1));
+    const std::size_t chunk = (n + nChunks - 1) / nChunks;
+    Acts::parallelFor(nChunks, [&](std::size_t ic) {
+      f(std::min(ic * chunk, n), std::min((ic + 1) * chunk, n));
+    });
+  }
+
+  // The minimal number of indices processed by a thread.
+  static constexpr std::size_t s_minChunk = 1024;
+
   // The epsilon radius used to find the neighbours.
   scalar_t m_eps;
   // The minimum number of points to form a cluster.
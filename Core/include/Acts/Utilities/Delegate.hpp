@@ -308,6 +308,90 @@ class Delegate<R(Args...), H, O> {
   function_type m_function{nullptr};
 };
 
+/// Delegate type with the callable bound at compile time
+///
+/// This type provides the call interface of @c Delegate, but the callable is
+/// part of the type. This allows the compiler to inline the call in hot loops,
+/// at the price of fixing the callable for a given instantiation. It is meant
+/// to be used in the extension structs of the fitters and the track finding,
+/// which are template parameters of those. It supports:
+/// - a free function pointer, if @c Type is @c void
+/// - a pointer to a member function alongside an instance pointer
+/// @note @c StaticDelegate does not assume ownership of the instance.
+/// @tparam R Return type of the function signature
+/// @tparam Args Types of the arguments of the function signatures
+/// @tparam Callable The compile-time function pointer
+/// @tparam Type The type of the instance the member function is called on
+template <typename, auto Callable, typename Type = void>
+class StaticDelegate;
+
+template <typename R, typename... Args, auto Callable, typename Type>
+class StaticDelegate<R(Args...), Callable, Type> {
+  static_assert(std::is_void_v<Type>
+                    ? std::is_invocable_r_v<R, decltype(Callable), Args...>
+                    : std::is_invocable_r_v<R, decltype(Callable),
+                                            const Type *, Args...>,
+                "Callable given does not correspond to required call "
+                "signature");
+
+ public:
+  /// Alias of the runtime delegate with the same signature
+  using RuntimeDelegate = Delegate<R(Args...)>;
+
+  /// Default constructor, a member function is not connected until an
+  /// instance is given
+  StaticDelegate() = default;
+
+  /// Constructor with the instance for a member function
+  /// @param instance The instance on which the member function should be called on
+  /// @note @c StaticDelegate does not assume owner ship over @p instance. You need to ensure
+  ///       it's lifetime is longer than that of @c StaticDelegate.
+  template <typename T = Type>
+  explicit StaticDelegate(
+      const std::enable_if_t<!std::is_void_v<T>, T> *instance)
+      : m_instance(instance) {}
+
+  /// The call operator that exposes the functionality of the @c StaticDelegate type.
+  /// @param args The arguments to call the contained function with
+  /// @return Return value of the contained function
+  R operator()(Args... args) const {
+    if constexpr (std::is_void_v<Type>) {
+      return std::invoke(Callable, std::forward<Args>(args)...);
+    } else {
+      assert(m_instance != nullptr && "Instance is required, but not set");
+      return std::invoke(Callable, m_instance, std::forward<Args>(args)...);
+    }
+  }
+
+  /// Return whether this delegate can be called
+  /// @return True if this delegate is connected
+  bool connected() const {
+    if constexpr (std::is_void_v<Type>) {
+      return true;
+    } else {
+      return m_instance != nullptr;
+    }
+  }
+
+  /// Return whether this delegate can be called
+  /// @return True if this delegate is connected
+  operator bool() const { return connected(); }
+
+  /// Make a runtime delegate connected to the same callable
+  /// @return the runtime delegate
+  RuntimeDelegate toDelegate() const {
+    if constexpr (std::is_void_v<Type>) {
+      return RuntimeDelegate{DelegateFuncTag<Callable>{}};
+    } else {
+      return RuntimeDelegate{DelegateFuncTag<Callable>{}, m_instance};
+    }
+  }
+
+ private:
+  /// The instance for a member function, unused for a free function
+  const Type *m_instance{nullptr};
+};
+
 template <typename, typename H = void>
 class OwningDelegate;
 
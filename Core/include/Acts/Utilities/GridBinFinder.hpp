@@ -12,6 +12,8 @@
 #include "Acts/Utilities/Holders.hpp"
 #include "Acts/Utilities/detail/grid_helper.hpp"
 
+#include <array>
+#include <cstddef>
 #include <variant>
 #include <vector>
 
@@ -58,6 +60,38 @@ class GridBinFinder {
   findBins(const std::array<std::size_t, DIM>& locPosition,
            const Acts::Grid<stored_t, Axes...>& grid) const;
 
+  /// @brief Iterate the neighbouring bins given a local position in the grid
+  ///
+  /// Same bins and order as @c findBins, but the global bin indices are
+  /// computed while iterating and nothing is allocated.
+  ///
+  /// @tparam stored_t The type of elements stored in the Grid
+  /// @tparam Axes ... The type of the axes of the grid
+  ///
+  /// @param [in] locPosition The N-dimentional local position in the grid
+  /// @param [in] grid The grid
+  /// @return The range of neighbouring bins
+  ///
+  /// @pre The provided local position must be a valid local bins configuration in the grid
+  template <typename stored_t, class... Axes>
+  detail::GlobalNeighborHoodIndices<DIM> neighborHoodIndices(
+      const std::array<std::size_t, DIM>& locPosition,
+      const Acts::Grid<stored_t, Axes...>& grid) const;
+
+  /// @brief Precompute the neighbouring bins of all bins in a grid
+  ///
+  /// For grids that are rebuilt with the same axes, e.g. the space point grid
+  /// in every event, @c findBins then copies the bins from a table instead of
+  /// computing them. The table is used for all grids with the same number of
+  /// local bins, which therefore also need to have the same axis types.
+  ///
+  /// @tparam stored_t The type of elements stored in the Grid
+  /// @tparam Axes ... The type of the axes of the grid
+  ///
+  /// @param [in] grid The grid, only its axes are used
+  template <typename stored_t, class... Axes>
+  void precomputeBins(const Acts::Grid<stored_t, Axes...>& grid);
+
  private:
   /// @brief Store the values provided by the user for each axis in the grid
   /// @tparam first_value_t Type of the first value
@@ -109,6 +143,14 @@ class GridBinFinder {
   /// replaced with a 1 (integer), thus instructing the code to look for
   /// neighbours in the range {-1 ,1}
   std::array<stored_values_t, DIM> m_values{};
+
+  /// The number of local bins of the grid the bin table was computed for
+  std::array<std::size_t, DIM> m_tableNBins{};
+  /// The offsets into the bin table, indexed by the global bin. Empty if no
+  /// table was computed
+  std::vector<std::size_t> m_tableOffsets{};
+  /// The neighbouring bins of all grid bins
+  std::vector<std::size_t> m_tableBins{};
 };
 
 }  // namespace Acts
@@ -81,9 +81,57 @@ Acts::GridBinFinder<DIM>::findBins(
     const Acts::Grid<stored_t, Axes...>& grid) const {
   static_assert(sizeof...(Axes) == DIM);
   assert(isGridCompatible(grid));
+  if (!m_tableOffsets.empty() && m_tableNBins == grid.numLocalBins()) {
+    const std::size_t globalBin = grid.globalBinFromLocalBins(locPosition);
+    return boost::container::small_vector<std::size_t,
+                                          Acts::detail::ipow(3, DIM)>(
+        m_tableBins.begin() + m_tableOffsets[globalBin],
+        m_tableBins.begin() + m_tableOffsets[globalBin + 1ul]);
+  }
+  return neighborHoodIndices(locPosition, grid).collect();
+}
+
+template <std::size_t DIM>
+template <typename stored_t, class... Axes>
+Acts::detail::GlobalNeighborHoodIndices<DIM>
+Acts::GridBinFinder<DIM>::neighborHoodIndices(
+    const std::array<std::size_t, DIM>& locPosition,
+    const Acts::Grid<stored_t, Axes...>& grid) const {
+  static_assert(sizeof...(Axes) == DIM);
+  assert(isGridCompatible(grid));
   std::array<std::pair<int, int>, DIM> sizePerAxis =
       getSizePerAxis(locPosition);
-  return grid.neighborHoodIndices(locPosition, sizePerAxis).collect();
+  return grid.neighborHoodIndices(locPosition, sizePerAxis);
+}
+
+template <std::size_t DIM>
+template <typename stored_t, class... Axes>
+void Acts::GridBinFinder<DIM>::precomputeBins(
+    const Acts::Grid<stored_t, Axes...>& grid) {
+  static_assert(sizeof...(Axes) == DIM);
+  assert(isGridCompatible(grid));
+  m_tableNBins = grid.numLocalBins();
+  m_tableOffsets.clear();
+  m_tableOffsets.reserve(grid.size() + 1ul);
+  m_tableOffsets.push_back(0ul);
+  m_tableBins.clear();
+  for (std::size_t globalBin(0ul); globalBin < grid.size(); ++globalBin) {
+    // under- and overflow bins are not valid query positions
+    const std::array<std::size_t, DIM> locPosition =
+        grid.localBinsFromGlobalBin(globalBin);
+    bool isValid = true;
+    for (std::size_t i(0ul); i < DIM; ++i) {
+      isValid = isValid && locPosition[i] > 0ul &&
+                locPosition[i] <= m_tableNBins[i];
+    }
+    if (isValid) {
+      for (std::size_t bin : neighborHoodIndices(locPosition, grid)) {
+        m_tableBins.push_back(bin);
+      }
+    }
+    m_tableOffsets.push_back(m_tableBins.size());
+  }
+  m_tableBins.shrink_to_fit();
 }
 
 template <std::size_t DIM>
@@ -8,14 +8,18 @@
 
 #pragma once
 
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/RangeXD.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <functional>
-#include <memory>
+#include <iterator>
+#include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Acts {
@@ -30,8 +34,9 @@ namespace Acts {
 /// orthogonal hyperplane in one of the k dimensions. This allows us to
 /// efficiently look up points within certain k-dimensional ranges.
 ///
-/// This particular class is mostly a wrapper class around an underlying node
-/// class which does all the actual work.
+/// The nodes are stored in a single vector in depth-first order, without any
+/// pointers between them, and the range search walks this vector without
+/// recursion.
 ///
 /// @note This type is completely immutable after construction.
 ///
@@ -75,22 +80,18 @@ class KDTree {
   ///
   /// @param d The vector of position-value pairs to construct the k-d tree
   /// from.
-  KDTree(vector_t &&d) : m_elems(d) {
-    // To start out, we need to check whether we need to construct a leaf node
-    // or an internal node. We create a leaf only if we have at most as many
-    // elements as the number of elements that can fit into a leaf node.
-    // Hopefully most invocations of this constructor will have more than a few
-    // elements!
+  ///
+  /// Large sub-trees are built concurrently if @c Acts::maxThreads allows it,
+  /// the resulting tree does not depend on the number of threads.
+  KDTree(vector_t &&d) : m_elems(std::move(d)) {
+    // All of the nodes in the k-d tree refer to a range in the element
+    // vector. They simply make in-place changes to this array while the tree
+    // is built, and they hold no memory of their own.
     //
-    // One interesting thing to note is that all of the nodes in the k-d tree
-    // have a range in the element vector of the outermost node. They simply
-    // make in-place changes to this array, and they hold no memory of their
-    // own.
-    m_root = std::make_unique<KDTreeNode>(m_elems.begin(), m_elems.end(),
-                                          m_elems.size() > LeafSize
-                                              ? KDTreeNode::NodeType::Internal
-                                              : KDTreeNode::NodeType::Leaf,
-                                          0UL);
+    // The nodes are stored in depth-first order: the left-hand child of an
+    // internal node directly follows it, and every node knows where its
+    // sub-tree ends, which is where the right-hand child starts.
+    buildNodes(0, m_elems.size(), 0, m_nodes);
   }
 
   /// @brief Perform an orthogonal range search within the k-d tree.
@@ -252,15 +253,71 @@ class KDTree {
   /// @param f The mapping function to apply to key-value pairs.
   template <typename Callable>
   void rangeSearchMapDiscard(const range_t &r, Callable &&f) const {
-    m_root->rangeSearchMapDiscard(r, std::forward<Callable>(f));
+    // Thanks to the depth-first layout, the search needs no stack: the next
+    // node is either the left-hand child, or the node after the current
+    // sub-tree if nothing below the current node needs to be looked at.
+    std::size_t n = 0;
+    while (n < m_nodes.size()) {
+      const KDTreeNode &node = m_nodes[n];
+
+      // Skip the whole sub-tree if its bounding box does not overlap with the
+      // range at all.
+      if (!(node.range && r)) {
+        n = node.next;
+        continue;
+      }
+
+      // Determine whether the range completely covers the bounding box of
+      // this node. If it is, we can copy all values without having to check
+      // for them being inside the range again, and we do not need to descend
+      // any further.
+      bool contained = r >= node.range;
+
+      if (contained || isLeaf(node)) {
+        // For leaves, this should be a relatively small number of elements
+        // (the LeafSize template parameter).
+        for (std::size_t i = node.begin; i != node.end; ++i) {
+          if (contained || r.contains(m_elems[i].first)) {
+            f(m_elems[i].first, m_elems[i].second);
+          }
+        }
+        n = node.next;
+      } else {
+        n = n + 1;
+      }
+    }
   }
 
-  /// @brief Return the number of elements in the k-d tree.
+  /// @brief Perform several orthogonal range searches in a single traversal
+  /// of the k-d tree, applying a void-returning function with side-effects
+  /// to the index of the range and each matching key-value pair.
   ///
-  /// We simply defer this method to the root node of the k-d tree.
+  /// Every node is visited at most once for all of the ranges together, and
+  /// for every range the key-value pairs are passed to the function in the
+  /// same order as in the search for that range alone.
+  ///
+  /// @param rs The ranges to search for.
+  /// @param f The mapping function to apply to the range index and the
+  /// key-value pairs.
+  template <typename Callable>
+  void rangeSearchMultiMapDiscard(const std::vector<range_t> &rs,
+                                  Callable &&f) const {
+    std::vector<std::size_t> active;
+    active.reserve(rs.size());
+    for (std::size_t ir = 0; ir < rs.size(); ++ir) {
+      if (m_nodes.front().range && rs[ir]) {
+        active.push_back(ir);
+      }
+    }
+    if (!active.empty()) {
+      rangeSearchMultiMapDiscard(0, rs, active, f);
+    }
+  }
+
+  /// @brief Return the number of elements in the k-d tree.
   ///
   /// @return The number of elements in the k-d tree.
-  std::size_t size(void) const { return m_root->size(); }
+  std::size_t size(void) const { return m_elems.size(); }
 
   const_iterator_t begin(void) const { return m_elems.begin(); }
 
@@ -309,194 +366,207 @@ class KDTree {
     return r;
   }
 
-  /// @brief An abstract class containing common features of k-d tree node
-  /// types.
+  /// @brief A node of the k-d tree.
   ///
   /// A k-d tree consists of two different node types: leaf nodes and inner
-  /// nodes. These nodes have some common functionality, which is captured by
-  /// this common parent node type.
-  class KDTreeNode {
-   public:
-    /// @brief Enumeration type for the possible node types (internal and leaf).
-    enum class NodeType { Internal, Leaf };
-
-    /// @brief Construct the common data for all node types.
-    ///
-    /// The node types share a few concepts, like an n-dimensional range, and a
-    /// begin and end of the range of elements managed. This constructor
-    /// calculates these things so that the individual child constructors don't
-    /// have to.
-    KDTreeNode(iterator_t _b, iterator_t _e, NodeType _t, std::size_t _d)
-        : m_type(_t),
-          m_begin_it(_b),
-          m_end_it(_e),
-          m_range(boundingBox(m_begin_it, m_end_it)) {
-      if (m_type == NodeType::Internal) {
-        // This constant determines the maximum number of elements where we
-        // still
-        // calculate the exact median of the values for the purposes of
-        // splitting. In general, the closer the pivot value is to the true
-        // median, the more balanced the tree will be. However, calculating the
-        // median exactly is an O(n log n) operation, while approximating it is
-        // an O(1) time.
-        constexpr std::size_t max_exact_median = 128;
-
-        iterator_t pivot;
-
-        // Next, we need to determine the pivot point of this node, that is to
-        // say the point in the selected pivot dimension along which point we
-        // will split the range. To do this, we check how large the set of
-        // elements is. If it is sufficiently small, we use the median.
-        // Otherwise we use the mean.
-        if (size() > max_exact_median) {
-          // In this case, we have a lot of elements, and sorting the range to
-          // find the true median might be too expensive. Therefore, we will
-          // just use the middle value between the minimum and maximum. This is
-          // not nearly as accurate as using the median, but it's a nice cheat.
-          Scalar mid = static_cast<Scalar>(0.5) *
-                       (m_range[_d].max() + m_range[_d].min());
-
-          pivot = std::partition(m_begin_it, m_end_it, [=](const pair_t &i) {
-            return i.first[_d] < mid;
-          });
-        } else {
-          // If the number of elements is fairly small, we will just calculate
-          // the median exactly. We do this by finding the values in the
-          // dimension, sorting it, and then taking the middle one.
-          std::sort(m_begin_it, m_end_it,
-                    [_d](const typename iterator_t::value_type &a,
-                         const typename iterator_t::value_type &b) {
-                      return a.first[_d] < b.first[_d];
-                    });
-
-          pivot = m_begin_it + (std::distance(m_begin_it, m_end_it) / 2);
-        }
+  /// nodes. Both manage a range of elements with their bounding box, an inner
+  /// node has more than LeafSize elements and is followed by its children.
+  struct KDTreeNode {
+    /// @brief The axis-aligned bounding box of the coordinates under this
+    /// node.
+    range_t range;
 
-        // This should never really happen, but in very select cases where there
-        // are a lot of equal values in the range, the pivot can end up all the
-        // way at the end of the array and we end up in an infinite loop. We
-        // check for pivot points which would not split the range, and fix them
-        // if they occur.
-        if (pivot == m_begin_it || pivot == std::prev(m_end_it)) {
-          pivot = std::next(m_begin_it, LeafSize);
-        }
+    /// @brief The start and end of the range of coordinate-value pairs under
+    /// this node.
+    std::size_t begin = 0;
+    std::size_t end = 0;
 
-        // Calculate the number of elements on the left-hand side, as well as
-        // the right-hand side. We do this by calculating the difference from
-        // the begin and end of the array to the pivot point.
-        std::size_t lhs_size = std::distance(m_begin_it, pivot);
-        std::size_t rhs_size = std::distance(pivot, m_end_it);
-
-        // Next, we check whether the left-hand node should be another internal
-        // node or a leaf node, and we construct the node recursively.
-        m_lhs = std::make_unique<KDTreeNode>(
-            m_begin_it, pivot,
-            lhs_size > LeafSize ? NodeType::Internal : NodeType::Leaf,
-            (_d + 1) % Dims);
-
-        // Same on the right hand side.
-        m_rhs = std::make_unique<KDTreeNode>(
-            pivot, m_end_it,
-            rhs_size > LeafSize ? NodeType::Internal : NodeType::Leaf,
-            (_d + 1) % Dims);
-      }
-    }
+    /// @brief The index of the first node after the sub-tree of this node.
+    std::size_t next = 0;
+  };
 
-    /// @brief Perform a range search in the k-d tree, mapping the key-value
-    /// pairs to a side-effecting function.
-    ///
-    /// This is the most powerful range search method we have, assuming that we
-    /// can use arbitrary side effects, which we can. All other range search
-    /// methods are implemented in terms of this particular function.
-    ///
-    /// @param r The range to search for.
-    /// @param f The mapping function to apply to matching elements.
-    template <typename Callable>
-    void rangeSearchMapDiscard(const range_t &r, Callable &&f) const {
-      // Determine whether the range completely covers the bounding box of
-      // this leaf node. If it is, we can copy all values without having to
-      // check for them being inside the range again.
-      bool contained = r >= m_range;
-
-      if (m_type == NodeType::Internal) {
-        // Firstly, we can check if the range completely contains the bounding
-        // box of this node. If that is the case, we know for certain that any
-        // value contained below this node should end up in the output, and we
-        // can stop recursively looking for them.
-        if (contained) {
-          // We can also pre-allocate space for the number of elements, since we
-          // are inserting all of them anyway.
-          for (iterator_t i = m_begin_it; i != m_end_it; ++i) {
-            f(i->first, i->second);
-          }
+  /// @brief Check whether a node is a leaf node.
+  static bool isLeaf(const KDTreeNode &node) {
+    return node.end - node.begin <= LeafSize;
+  }
 
-          return;
-        }
+  /// @brief The minimal number of elements for which the sub-trees are built
+  /// in parallel.
+  static constexpr std::size_t s_minParallelSize = 4096;
+
+  /// @brief Determine the pivot point splitting the elements of an internal
+  /// node.
+  ///
+  /// @param b The begin of the range of elements.
+  /// @param e The end of the range of elements.
+  /// @param range The bounding box of the elements.
+  /// @param d The pivot dimension.
+  ///
+  /// @return The index of the first element of the right-hand child.
+  std::size_t split(std::size_t b, std::size_t e, const range_t &range,
+                    std::size_t d) {
+    // This constant determines the maximum number of elements where we
+    // still calculate the exact median of the values for the purposes of
+    // splitting. In general, the closer the pivot value is to the true
+    // median, the more balanced the tree will be. However, calculating the
+    // median exactly is an O(n log n) operation, while approximating it is
+    // an O(1) time.
+    constexpr std::size_t max_exact_median = 128;
+
+    iterator_t begin_it = std::next(m_elems.begin(), b);
+    iterator_t end_it = std::next(m_elems.begin(), e);
+    iterator_t pivot;
+
+    // Next, we need to determine the pivot point of this node, that is to
+    // say the point in the selected pivot dimension along which point we
+    // will split the range. To do this, we check how large the set of
+    // elements is. If it is sufficiently small, we use the median.
+    // Otherwise we use the mean.
+    if (e - b > max_exact_median) {
+      // In this case, we have a lot of elements, and sorting the range to
+      // find the true median might be too expensive. Therefore, we will
+      // just use the middle value between the minimum and maximum. This is
+      // not nearly as accurate as using the median, but it's a nice cheat.
+      Scalar mid =
+          static_cast<Scalar>(0.5) * (range[d].max() + range[d].min());
+
+      pivot = std::partition(begin_it, end_it, [=](const pair_t &i) {
+        return i.first[d] < mid;
+      });
+    } else {
+      // If the number of elements is fairly small, we will just calculate
+      // the median exactly. We do this by finding the values in the
+      // dimension, sorting it, and then taking the middle one.
+      std::sort(begin_it, end_it,
+                [d](const typename iterator_t::value_type &lhs,
+                    const typename iterator_t::value_type &rhs) {
+                  return lhs.first[d] < rhs.first[d];
+                });
+
+      pivot = begin_it + (std::distance(begin_it, end_it) / 2);
+    }
 
-        assert(m_lhs && m_rhs && "Did not find lhs and rhs");
+    // This should never really happen, but in very select cases where there
+    // are a lot of equal values in the range, the pivot can end up all the
+    // way at the end of the array and we end up in an infinite loop. We
+    // check for pivot points which would not split the range, and fix them
+    // if they occur.
+    if (pivot == begin_it || pivot == std::prev(end_it)) {
+      pivot = std::next(begin_it, LeafSize);
+    }
 
-        // If we have a left-hand node (which we should!), then we check if
-        // there is any overlap between the target range and the bounding box of
-        // the left-hand node. If there is, we recursively search in that node.
-        if (m_lhs->range() && r) {
-          m_lhs->rangeSearchMapDiscard(r, std::forward<Callable>(f));
-        }
+    return std::distance(m_elems.begin(), pivot);
+  }
 
-        // Then, we perform exactly the same procedure for the right hand side.
-        if (m_rhs->range() && r) {
-          m_rhs->rangeSearchMapDiscard(r, std::forward<Callable>(f));
-        }
-      } else {
-        // Iterate over all the elements in this leaf node. This should be a
-        // relatively small number (the LeafSize template parameter).
-        for (iterator_t i = m_begin_it; i != m_end_it; ++i) {
-          // We need to check whether the element is actually inside the range.
-          // In case this node's bounding box is fully contained within the
-          // range, we don't actually need to check this.
-          if (contained || r.contains(i->first)) {
-            f(i->first, i->second);
+  /// @brief Build the nodes of a sub-tree in depth-first order.
+  ///
+  /// @param b The begin of the range of elements of the sub-tree.
+  /// @param e The end of the range of elements of the sub-tree.
+  /// @param d The pivot dimension of the sub-tree root.
+  /// @param nodes The nodes to append the sub-tree to.
+  void buildNodes(std::size_t b, std::size_t e, std::size_t d,
+                  std::vector<KDTreeNode> &nodes) {
+    const std::size_t self = nodes.size();
+    nodes.push_back({boundingBox(std::next(m_elems.begin(), b),
+                                 std::next(m_elems.begin(), e)),
+                     b, e, 0});
+
+    if (!isLeaf(nodes[self])) {
+      const std::size_t pivot = split(b, e, nodes[self].range, d);
+      const std::size_t nd = (d + 1) % Dims;
+
+      if (maxThreads() > 1 && e - b >= s_minParallelSize) {
+        // The right-hand sub-tree is built into its own node vector, possibly
+        // by a second thread, the two sub-trees work on disjoint element
+        // ranges.
+        std::vector<KDTreeNode> rhsNodes;
+        parallelFor(2, [&](std::size_t side) {
+          if (side == 0) {
+            buildNodes(b, pivot, nd, nodes);
+          } else {
+            buildNodes(pivot, e, nd, rhsNodes);
           }
+        });
+        // Shift the indices of the right-hand nodes behind the left-hand ones
+        const std::size_t offset = nodes.size();
+        for (KDTreeNode &node : rhsNodes) {
+          node.next += offset;
         }
+        nodes.insert(nodes.end(), rhsNodes.begin(), rhsNodes.end());
+      } else {
+        buildNodes(b, pivot, nd, nodes);
+        buildNodes(pivot, e, nd, nodes);
       }
     }
 
-    /// @brief Determine the number of elements managed by this node.
-    ///
-    /// Conveniently, this number is always equal to the distance between the
-    /// begin iterator and the end iterator, so we can simply delegate to the
-    /// relevant standard library method.
-    ///
-    /// @return The number of elements below this node.
-    std::size_t size() const { return std::distance(m_begin_it, m_end_it); }
-
-    /// @brief The axis-aligned bounding box containing all elements in this
-    /// node.
-    ///
-    /// @return The minimal axis-aligned bounding box that contains all the
-    /// elements under this node.
-    const range_t &range() const { return m_range; }
-
-   protected:
-    NodeType m_type;
+    nodes[self].next = nodes.size();
+  }
 
-    /// @brief The start and end of the range of coordinate-value pairs under
-    /// this node.
-    const iterator_t m_begin_it, m_end_it;
+  /// @brief Perform several range searches in a sub-tree at once.
+  ///
+  /// The ranges are filtered on the way down, such that only the ranges
+  /// overlapping with a node are checked against its elements.
+  ///
+  /// @param n The index of the sub-tree root.
+  /// @param rs All ranges to search for.
+  /// @param active The indices of the ranges that overlap with this node.
+  /// @param f The mapping function to apply to matching elements.
+  template <typename Callable>
+  void rangeSearchMultiMapDiscard(std::size_t n, const std::vector<range_t> &rs,
+                                  const std::vector<std::size_t> &active,
+                                  Callable &f) const {
+    const KDTreeNode &node = m_nodes[n];
+
+    std::vector<std::size_t> partial;
+    partial.reserve(active.size());
+    for (std::size_t ir : active) {
+      // Ranges containing the whole node take all of its elements
+      if (rs[ir] >= node.range) {
+        for (std::size_t i = node.begin; i != node.end; ++i) {
+          f(ir, m_elems[i].first, m_elems[i].second);
+        }
+      } else {
+        partial.push_back(ir);
+      }
+    }
 
-    /// @brief The axis-aligned bounding box of the coordinates under this
-    /// node.
-    const range_t m_range;
+    if (partial.empty()) {
+      return;
+    }
 
-    /// @brief Pointers to the left and right children.
-    std::unique_ptr<KDTreeNode> m_lhs;
-    std::unique_ptr<KDTreeNode> m_rhs;
-  };
+    if (!isLeaf(node)) {
+      // The left-hand child follows the node, the right-hand child follows
+      // the left-hand sub-tree
+      std::vector<std::size_t> overlapping;
+      overlapping.reserve(partial.size());
+      for (std::size_t child : {n + 1, m_nodes[n + 1].next}) {
+        overlapping.clear();
+        for (std::size_t ir : partial) {
+          if (m_nodes[child].range && rs[ir]) {
+            overlapping.push_back(ir);
+          }
+        }
+        if (!overlapping.empty()) {
+          rangeSearchMultiMapDiscard(child, rs, overlapping, f);
+        }
+      }
+    } else {
+      for (std::size_t ir : partial) {
+        for (std::size_t i = node.begin; i != node.end; ++i) {
+          if (rs[ir].contains(m_elems[i].first)) {
+            f(ir, m_elems[i].first, m_elems[i].second);
+          }
+        }
+      }
+    }
+  }
 
   /// @brief Vector containing all of the elements in this k-d tree, including
   /// the elements managed by the nodes inside of it.
   vector_t m_elems;
 
-  /// @brief Pointer to the root node of this k-d tree.
-  std::unique_ptr<KDTreeNode> m_root;
+  /// @brief The nodes of the k-d tree in depth-first order, starting with the
+  /// root node.
+  std::vector<KDTreeNode> m_nodes;
 };
 }  // namespace Acts
@@ -8,12 +8,16 @@
 
 #pragma once
 // STL include(s)
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstddef>
 #include <ctime>
 #include <exception>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <sstream>
@@ -143,6 +147,57 @@
 /// The debug message is printed if the current Acts::Logging::Level <=
 /// Acts::Logging::FATAL.
 #define ACTS_FATAL(x)  ACTS_LOG(Acts::Logging::FATAL, x)
+
+/// @brief macro for sampled debug output in hot loops
+/// @ingroup Logging
+///
+/// @param level debug level of the message
+/// @param n     only every n-th call is printed, starting with the first one
+/// @param x     debug message
+///
+/// @pre @c logger() must be a valid expression in the scope where this
+///      macro is used and it must return a Acts::Logger object.
+///
+/// The calls are counted per call site, across all threads and loggers, and
+/// only while @p level is enabled.
+#define ACTS_LOG_SAMPLED(level, n, x)                                          \
+  if (logger().doPrint(level)) {                                               \
+    static std::atomic<std::size_t> __acts_log_calls{0};                       \
+    if (__acts_log_calls.fetch_add(1, std::memory_order_relaxed) % (n) == 0) { \
+      ACTS_LOG(level, x)                                                       \
+    }                                                                          \
+  }
+
+/// @brief macro for rate limited debug output in hot loops
+/// @ingroup Logging
+///
+/// @param level    debug level of the message
+/// @param interval minimal time between two printed messages as
+///                 @c std::chrono::duration
+/// @param x        debug message
+///
+/// @pre @c logger() must be a valid expression in the scope where this
+///      macro is used and it must return a Acts::Logger object.
+///
+/// The interval is measured per call site, across all threads and loggers.
+#define ACTS_LOG_THROTTLED(level, interval, x)                                 \
+  if (logger().doPrint(level)) {                                               \
+    using __acts_log_clock = std::chrono::steady_clock;                        \
+    static std::atomic<__acts_log_clock::rep> __acts_log_next{                 \
+        std::numeric_limits<__acts_log_clock::rep>::min()};                    \
+    const auto __acts_log_now =                                                \
+        __acts_log_clock::now().time_since_epoch().count();                    \
+    auto __acts_log_expected =                                                 \
+        __acts_log_next.load(std::memory_order_relaxed);                       \
+    if (__acts_log_now >= __acts_log_expected &&                               \
+        __acts_log_next.compare_exchange_strong(                               \
+            __acts_log_expected,                                               \
+            __acts_log_now +                                                   \
+                std::chrono::duration_cast<__acts_log_clock::duration>(        \
+                    interval).count())) {                                      \
+      ACTS_LOG(level, x)                                                       \
+    }                                                                          \
+  }
 // clang-format on
 
 namespace Acts {
@@ -0,0 +1,54 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Acts {
+
+/// Read-only memory mapping of a whole file
+///
+/// The file is closed after mapping, the mapping stays valid until the
+/// object is destroyed. Formats built on top of it only need to validate
+/// their own header and record layout.
+class MappedFile {
+ public:
+  /// An empty mapping
+  MappedFile() = default;
+
+  /// Map a file into memory
+  /// @param path The path of the file
+  /// @throw std::runtime_error if the file can not be opened or mapped
+  explicit MappedFile(const std::string& path);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+  ~MappedFile();
+
+  /// The first byte of the file, nullptr for an empty file
+  const std::byte* data() const { return m_data; }
+
+  /// The size of the file in bytes
+  std::size_t size() const { return m_size; }
+
+  /// Ask the operating system to read the whole file ahead, e.g. before it
+  /// is read concurrently from several threads
+  void prefetch() const;
+
+ private:
+  void unmap();
+
+  const std::byte* m_data = nullptr;
+  std::size_t m_size = 0;
+};
+
+}  // namespace Acts
@@ -0,0 +1,48 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace Acts {
+
+/// Set the maximum number of threads the library uses at once
+///
+/// This is the only threading knob of the library: all algorithms that split
+/// their work with @c parallelFor share one budget of @c maxThreads - 1
+/// started threads, including nested calls and calls from several
+/// application threads. The default is 1, such that no threads are started
+/// unless the application opts in, e.g. when it does not already process
+/// independent events concurrently.
+///
+/// @param maxThreads The maximum number of threads, including the calling
+///        one, 0 to use the hardware concurrency
+void setMaxThreads(std::size_t maxThreads);
+
+/// The maximum number of threads the library uses at once
+std::size_t maxThreads();
+
+/// Call a task for every index of a range, split over several threads
+///
+/// The indices are split into contiguous blocks. The calling thread processes
+/// the first block and every other block runs on a thread of its own, as long
+/// as the budget of @c maxThreads allows. Without free threads, all tasks
+/// run in place on the calling thread. The results of the tasks must
+/// therefore not depend on the number of blocks.
+///
+/// A block stops at the first exception of a task, and after all threads
+/// joined, the exception of the lowest failing index is rethrown. If a thread
+/// can not be started, its block runs on the calling thread.
+///
+/// @param n The number of tasks, called with the indices 0 to n - 1
+/// @param task The task to call with each index
+void parallelFor(std::size_t n, const std::function<void(std::size_t)>& task);
+
+}  // namespace Acts
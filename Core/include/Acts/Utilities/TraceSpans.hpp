@@ -0,0 +1,138 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace Acts {
+
+/// Recorder of named time spans on the threads of a program
+///
+/// Every thread records into its own buffer, such that recording does not
+/// need any synchronization after the first span of a thread. The spans can
+/// be written as a Chrome trace, which shows the timeline of every thread and
+/// can be opened in Perfetto or chrome://tracing.
+class SpanRecorder {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Span {
+    /// The name, which has to outlive the recorder
+    std::string_view name;
+    Clock::time_point start;
+    Clock::duration duration;
+    /// The index of the thread, in the order of their first span
+    std::size_t thread = 0;
+    /// The event number, negative if the span does not belong to an event
+    std::int64_t event = -1;
+  };
+
+  SpanRecorder();
+  SpanRecorder(const SpanRecorder&) = delete;
+  SpanRecorder& operator=(const SpanRecorder&) = delete;
+  ~SpanRecorder();
+
+  /// Record a span on the calling thread
+  ///
+  /// @param name The name of the span, which has to outlive the recorder
+  /// @param start The start of the span
+  /// @param end The end of the span
+  /// @param event The event number, negative if there is none
+  void record(std::string_view name, Clock::time_point start,
+              Clock::time_point end, std::int64_t event = -1);
+
+  /// All spans recorded so far, ordered by their start
+  /// @note Must not be called while other threads record spans
+  std::vector<Span> spans() const;
+
+  /// Write all spans as a Chrome trace in JSON
+  ///
+  /// The times are given in microseconds since the creation of the recorder.
+  /// @note Must not be called while other threads record spans
+  ///
+  /// @param os The output stream
+  void writeChromeTrace(std::ostream& os) const;
+
+  /// Install the recorder used by @c ScopedSpan
+  ///
+  /// @param recorder The recorder, nullptr to not record the scoped spans
+  /// @return The previously installed recorder
+  static SpanRecorder* setGlobal(SpanRecorder* recorder);
+
+  /// The recorder used by @c ScopedSpan, nullptr if there is none
+  static SpanRecorder* global();
+
+ private:
+  struct ThreadSpans {
+    std::size_t thread = 0;
+    std::vector<Span> spans;
+  };
+
+  ThreadSpans& threadSpans();
+
+  std::size_t m_id;
+  Clock::time_point m_start;
+  mutable std::mutex m_mutex;
+  std::vector<std::unique_ptr<ThreadSpans>> m_threadSpans;
+};
+
+/// Record the time spent in a scope with the global span recorder
+///
+/// Does nothing but checking for the recorder if none is installed.
+class ScopedSpan {
+ public:
+  /// @param name The name of the span, which has to outlive the recorder
+  /// @param event The event number, negative if there is none
+  explicit ScopedSpan(std::string_view name, std::int64_t event = -1)
+      : m_recorder(SpanRecorder::global()), m_name(name), m_event(event) {
+    if (m_recorder != nullptr) {
+      m_start = SpanRecorder::Clock::now();
+    }
+  }
+
+  ScopedSpan(const ScopedSpan&) = delete;
+  ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+  ~ScopedSpan() {
+    if (m_recorder != nullptr) {
+      m_recorder->record(m_name, m_start, SpanRecorder::Clock::now(), m_event);
+    }
+  }
+
+ private:
+  SpanRecorder* m_recorder;
+  std::string_view m_name;
+  std::int64_t m_event;
+  SpanRecorder::Clock::time_point m_start;
+};
+
+}  // namespace Acts
+
+#define ACTS_TRACE_DETAIL_CONCAT_IMPL(a, b) a##b
+#define ACTS_TRACE_DETAIL_CONCAT(a, b) ACTS_TRACE_DETAIL_CONCAT_IMPL(a, b)
+
+/// @brief Record the rest of the enclosing scope as a named span
+///
+/// Instrumentation of hot code, which compiles to nothing unless the
+/// build enables ACTS_ENABLE_TRACE_SPANS.
+///
+/// @param name The name of the span, usually a string literal
+#ifdef ACTS_ENABLE_TRACE_SPANS
+#define ACTS_TRACE_SPAN(name) \
+  ::Acts::ScopedSpan ACTS_TRACE_DETAIL_CONCAT(_actsTraceSpan, __LINE__)(name)
+#else
+#define ACTS_TRACE_SPAN(name) static_cast<void>(0)
+#endif
@@ -72,6 +72,13 @@ class AdaptiveGridTrackDensity {
 
     bool useTime = false;
 
+    /// Only fill the bins of a track grid which lie inside the ellipse of
+    /// max(nSpatialTrkSigmas, nTemporalTrkSigmas) standard deviations in the
+    /// z-t plane, instead of the whole rectangle. This drops the corners of
+    /// the track grids, which reduces the size of the density map for time
+    /// vertex seeding. Not used if useTime == false
+    bool useEllipticalTrkGrid = false;
+
     /// Do NOT use just the z-bin with the highest
     /// track density, but instead check (up to)
     /// first three density maxima (only those that have
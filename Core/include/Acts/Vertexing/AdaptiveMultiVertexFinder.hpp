@@ -21,8 +21,11 @@
 #include "Acts/Vertexing/TrackLinearizer.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 /// @brief Implements an iterative vertex finder
@@ -216,6 +219,42 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
   /// Private access to logging instance
   const Logger& logger() const { return *m_logger; }
 
+  /// @brief Index of the input tracks built once per event
+  ///
+  /// It caches the z position of the track reference points and keeps the
+  /// tracks ordered by it, such that the tracks close to a vertex candidate
+  /// are found by binary search. It also records which of the input tracks
+  /// are still seed tracks. The input tracks are assumed to be unique.
+  struct TrackIndex {
+    /// @param tracks The input tracks
+    /// @param extractParameters Function to extract the track parameters
+    /// @param geoContext The geometry context
+    TrackIndex(const std::vector<InputTrack>& tracks,
+               const InputTrack::Extractor& extractParameters,
+               const GeometryContext& geoContext);
+
+    /// Position of a track in the input tracks
+    std::size_t find(const InputTrack& trk) const;
+
+    /// Collect the input tracks which are within the given z distance of a
+    /// position, in the order of the input tracks
+    ///
+    /// @param posZ The z position
+    /// @param maxDistance The maximum distance in z
+    /// @param[out] indices The positions of the tracks in the input tracks
+    void zWindow(double posZ, double maxDistance,
+                 std::vector<std::size_t>& indices) const;
+
+    /// The z position of the reference point of each input track
+    std::vector<double> z;
+    /// The positions of the input tracks ordered by `z`
+    std::vector<std::size_t> zOrder;
+    /// The input tracks with their positions ordered by track
+    std::vector<std::pair<InputTrack, std::size_t>> lookup;
+    /// Whether each input track is still a seed track
+    std::vector<bool> isSeed;
+  };
+
   /// @brief Calls the seed finder and sets constraints on the found seed
   /// vertex if desired
   ///
@@ -255,21 +294,25 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
 
   /// @brief Adds compatible track to vertex candidate
   ///
-  /// @param tracks The tracks
+  /// The tracks considered are all tracks or the seed tracks only, depending
+  /// on `doRealMultiVertex`.
+  ///
+  /// @param allTracks All tracks
+  /// @param trackIndex The index of all tracks
   /// @param vtx The vertex candidate
   /// @param[out] fitterState The vertex fitter state
   /// @param vertexingOptions Vertexing options
   Result<void> addCompatibleTracksToVertex(
-      const std::vector<InputTrack>& tracks, Vertex& vtx,
-      VertexFitterState& fitterState,
+      const std::vector<InputTrack>& allTracks, const TrackIndex& trackIndex,
+      Vertex& vtx, VertexFitterState& fitterState,
       const VertexingOptions& vertexingOptions) const;
 
   /// @brief Method that tries to recover from cases where no tracks
   /// were added to the vertex candidate after seeding
   ///
-  /// @param allTracks The tracks to be considered (either origTrack or
-  /// seedTracks)
+  /// @param allTracks All tracks
   /// @param seedTracks The seed tracks
+  /// @param trackIndex The index of all tracks
   /// @param[out] vtx The vertex candidate
   /// @param currentConstraint Vertex constraint
   /// @param[out] fitterState The vertex fitter state
@@ -278,15 +321,16 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
   /// return True if recovery was successful, false otherwise
   Result<bool> canRecoverFromNoCompatibleTracks(
       const std::vector<InputTrack>& allTracks,
-      const std::vector<InputTrack>& seedTracks, Vertex& vtx,
+      const std::vector<InputTrack>& seedTracks, const TrackIndex& trackIndex,
+      Vertex& vtx,
       const Vertex& currentConstraint, VertexFitterState& fitterState,
       const VertexingOptions& vertexingOptions) const;
 
   /// @brief Method that tries to prepare the vertex for the fit
   ///
-  /// @param allTracks The tracks to be considered (either origTrack or
-  /// seedTracks)
+  /// @param allTracks All tracks
   /// @param seedTracks The seed tracks
+  /// @param trackIndex The index of all tracks
   /// @param[out] vtx The vertex candidate
   /// @param currentConstraint Vertex constraint
   /// @param[out] fitterState The vertex fitter state
@@ -295,7 +339,8 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
   /// @return True if preparation was successful, false otherwise
   Result<bool> canPrepareVertexForFit(
       const std::vector<InputTrack>& allTracks,
-      const std::vector<InputTrack>& seedTracks, Vertex& vtx,
+      const std::vector<InputTrack>& seedTracks, const TrackIndex& trackIndex,
+      Vertex& vtx,
       const Vertex& currentConstraint, VertexFitterState& fitterState,
       const VertexingOptions& vertexingOptions) const;
 
@@ -303,13 +348,13 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
   /// compatible tracks are available
   ///
   /// @param vtx The vertex candidate
-  /// @param seedTracks The seed tracks
+  /// @param trackIndex The index of all tracks
   /// @param fitterState The vertex fitter state
   /// @param useVertexConstraintInFit Indicates whether constraint is used in the vertex fit
   ///
   /// @return pair(nCompatibleTracks, isGoodVertex)
   std::pair<int, bool> checkVertexAndCompatibleTracks(
-      Vertex& vtx, const std::vector<InputTrack>& seedTracks,
+      Vertex& vtx, const TrackIndex& trackIndex,
       VertexFitterState& fitterState, bool useVertexConstraintInFit) const;
 
   /// @brief Method that removes all tracks that are compatible with
@@ -317,11 +362,12 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
   ///
   /// @param vtx The vertex candidate
   /// @param[out] seedTracks The seed tracks
+  /// @param[out] trackIndex The index of all tracks
   /// @param fitterState The vertex fitter state
   /// @param[out] removedSeedTracks Collection of seed track that will be
   /// removed
   void removeCompatibleTracksFromSeedTracks(
-      Vertex& vtx, std::vector<InputTrack>& seedTracks,
+      Vertex& vtx, std::vector<InputTrack>& seedTracks, TrackIndex& trackIndex,
       VertexFitterState& fitterState,
       std::vector<InputTrack>& removedSeedTracks) const;
 
@@ -330,17 +376,16 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
   ///
   /// @param vtx The vertex candidate
   /// @param[out] seedTracks The seed tracks
+  /// @param[out] trackIndex The index of all tracks
   /// @param fitterState The vertex fitter state
   /// @param[out] removedSeedTracks Collection of seed track that will be
   /// removed
-  /// @param[in] geoCtx The geometry context to access global positions
   ///
   /// @return Incompatible track was removed
-  bool removeTrackIfIncompatible(Vertex& vtx,
-                                 std::vector<InputTrack>& seedTracks,
-                                 VertexFitterState& fitterState,
-                                 std::vector<InputTrack>& removedSeedTracks,
-                                 const GeometryContext& geoCtx) const;
+  bool removeTrackIfIncompatible(
+      Vertex& vtx, std::vector<InputTrack>& seedTracks, TrackIndex& trackIndex,
+      VertexFitterState& fitterState,
+      std::vector<InputTrack>& removedSeedTracks) const;
 
   /// @brief Method that evaluates if the new vertex candidate should
   /// be kept, i.e. saved, or not
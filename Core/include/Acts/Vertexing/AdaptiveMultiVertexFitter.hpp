@@ -23,6 +23,7 @@
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
 #include <functional>
+#include <vector>
 
 namespace Acts {
 
@@ -40,7 +41,8 @@ class AdaptiveMultiVertexFitter {
     State(const MagneticFieldProvider& field,
           const Acts::MagneticFieldContext& magContext)
         : ipState{field.makeCache(magContext)},
-          fieldCache(field.makeCache(magContext)) {}
+          fieldCache(field.makeCache(magContext)),
+          field(&field) {}
     // Vertex collection to be fitted
     std::vector<Vertex*> vertexCollection;
 
@@ -51,6 +53,14 @@ class AdaptiveMultiVertexFitter {
 
     MagneticFieldProvider::Cache fieldCache;
 
+    // The magnetic field, used to create the field caches of the
+    // concurrent linearizations
+    const MagneticFieldProvider* field;
+
+    // Additional field caches for the concurrent linearizations, the first
+    // range of tracks uses fieldCache
+    std::vector<MagneticFieldProvider::Cache> concurrentFieldCaches;
+
     // Map to store vertices information
     // @TODO Does this have to be a mutable pointer?
     std::map<Vertex*, VertexInfo> vtxInfoMap;
@@ -136,6 +146,12 @@ class AdaptiveMultiVertexFitter {
     InputTrack::Extractor extractParameters;
 
     TrackLinearizer trackLinearizer;
+
+    // Run the track linearizations of an iteration concurrently within the
+    // thread budget of Acts::maxThreads(). The track linearizer is then
+    // called from several threads, each with its own field cache, and has to
+    // be thread safe.
+    bool linearizeConcurrently{false};
   };
 
   /// @brief Constructor for user-defined InputTrack_t type !=
@@ -237,16 +253,6 @@ class AdaptiveMultiVertexFitter {
   Result<void> setWeightsAndUpdate(
       State& state, const VertexingOptions& vertexingOptions) const;
 
-  /// @brief Collects the compatibility values of the track `trk`
-  /// wrt to all of its associated vertices
-  ///
-  /// @param state Fitter state
-  /// @param trk Track
-  ///
-  /// @return Vector of compatibility values
-  std::vector<double> collectTrackToVertexCompatibilities(
-      State& state, const InputTrack& trk) const;
-
   /// @brief Determines if any vertex position has shifted more than
   /// m_cfg.maxRelativeShift in the last iteration
   ///
@@ -55,6 +55,10 @@ class FullBilloirVertexFitter {
     InputTrack::Extractor extractParameters;
 
     TrackLinearizer trackLinearizer;
+
+    /// Optional batch linearizer. If connected, it is used instead of
+    /// trackLinearizer to linearize all tracks of an iteration at once.
+    TrackBatchLinearizer trackBatchLinearizer;
   };
 
   /// @brief Constructor for user-defined InputTrack type
@@ -73,7 +77,8 @@ class FullBilloirVertexFitter {
           "provided.");
     }
 
-    if (!m_cfg.trackLinearizer.connected()) {
+    if (!m_cfg.trackLinearizer.connected() &&
+        !m_cfg.trackBatchLinearizer.connected()) {
       throw std::invalid_argument(
           "FullBilloirVertexFitter: "
           "No track linearizer provided.");
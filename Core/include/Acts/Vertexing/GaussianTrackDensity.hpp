@@ -13,6 +13,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 namespace Acts {
 
@@ -23,40 +24,6 @@ namespace Acts {
 /// matrices (determining the width of the function)
 class GaussianTrackDensity {
  public:
-  /// @brief Struct to store information for a single track
-  struct TrackEntry {
-    /// @brief Default constructor
-    TrackEntry() = default;
-    /// @brief Constructor initializing all members
-    /// @param z_ Trial z position
-    /// @param c0_ z-independent term in exponent
-    /// @param c1_ Linear coefficient in exponent
-    /// @param c2_ Quadratic coefficient in exponent
-    /// @param lowerBound_ The lower bound
-    /// @param upperBound_ The upper bound
-    TrackEntry(double z_, double c0_, double c1_, double c2_,
-               double lowerBound_, double upperBound_)
-        : z(z_),
-          c0(c0_),
-          c1(c1_),
-          c2(c2_),
-          lowerBound(lowerBound_),
-          upperBound(upperBound_) {}
-
-    double z = 0;
-    // Cached information for a single track
-    // z-independent term in exponent
-    double c0 = 0;
-    // linear coefficient in exponent
-    double c1 = 0;
-    // quadratic coefficient in exponent
-    double c2 = 0;
-    // The lower bound
-    double lowerBound = 0;
-    // The upper bound
-    double upperBound = 0;
-  };
-
   /// @brief The Config struct
   struct Config {
     Config(double d0Sig = 3.5, double z0Sig = 12.)
@@ -77,16 +44,49 @@ class GaussianTrackDensity {
     double d0SignificanceCut;
     double z0SignificanceCut;
 
+    // Bin size of the coarse grid on which the density is scanned before the
+    // search for the maximum. The search then only starts from the largest
+    // local maxima on the grid instead of from every track. Disabled if not
+    // positive.
+    double preScanBinSize = 0.;
+    // Number of local maxima on the coarse grid to start the search from
+    unsigned int preScanCandidates = 3;
+
     // Function to extract parameters from InputTrack
     InputTrack::Extractor extractParameters;
   };
 
   /// @brief The State struct
+  ///
+  /// The cached coefficients of the selected tracks are stored as separate
+  /// arrays, ordered by the lower bound of the region in which a track
+  /// contributes to the density. Only a contiguous range of these arrays
+  /// needs to be checked at any z position.
   struct State {
     // Constructor with size track map
-    State(unsigned int nTracks) { trackEntries.reserve(nTracks); }
-    // Vector to cache track information
-    std::vector<TrackEntry> trackEntries;
+    State(unsigned int nTracks) {
+      trackZ.reserve(nTracks);
+      constantTerm.reserve(nTracks);
+      linearTerm.reserve(nTracks);
+      quadraticTerm.reserve(nTracks);
+      lowerBound.reserve(nTracks);
+      upperBound.reserve(nTracks);
+    }
+
+    // z0 of the selected tracks in input order
+    std::vector<double> trackZ;
+    // z-independent term in exponent
+    std::vector<double> constantTerm;
+    // Linear coefficient in exponent
+    std::vector<double> linearTerm;
+    // Quadratic coefficient in exponent
+    std::vector<double> quadraticTerm;
+    // The lower bounds in increasing order
+    std::vector<double> lowerBound;
+    // The upper bounds
+    std::vector<double> upperBound;
+    // Upper limit on the distance between the bounds of any track
+    double maxWidth = 0.;
   };
 
   /// Constructor with config
@@ -110,6 +110,8 @@ class GaussianTrackDensity {
   /// nearest maximum, take that step and then do one final refinement. The
   /// largest density encountered in this procedure (after checking all tracks)
   /// is considered the maximum.
+  /// If the pre-scan is enabled, the steps start from the largest local
+  /// maxima on the coarse grid instead of from every track.
   ///
   /// @param state The track density state
   /// @param trackList All input tracks
@@ -131,7 +133,8 @@ class GaussianTrackDensity {
   /// The configuration
   Config m_cfg;
 
-  /// @brief Add a track to the set being considered
+  /// @brief Fill the state with the selected tracks, replacing the ones
+  /// of a previous call
   ///
   /// @param state The track density state
   /// @param trackList All input tracks
@@ -145,8 +148,16 @@ class GaussianTrackDensity {
   /// @param z z-position along the beamline
   ///
   /// @return Track density, first and second derivatives
-  std::tuple<double, double, double> trackDensityAndDerivatives(State& state,
-                                                                double z) const;
+  std::tuple<double, double, double> trackDensityAndDerivatives(
+      const State& state, double z) const;
+
+  /// @brief Scan the density on a coarse grid and find the z positions of
+  /// its largest local maxima
+  ///
+  /// @param state The track density state
+  ///
+  /// @return z positions of at most m_cfg.preScanCandidates local maxima
+  std::vector<double> preScan(const State& state) const;
 
   /// @brief Update the current maximum values
   ///
@@ -170,28 +181,6 @@ class GaussianTrackDensity {
   ///
   /// @return The step size
   double stepSize(double y, double dy, double ddy) const;
-
-  // Helper class to evaluate and store track density at specific position
-  class GaussianTrackDensityStore {
-   public:
-    // Initialise at the z coordinate at which the density is to be evaluated
-    GaussianTrackDensityStore(double z_coordinate) : m_z(z_coordinate) {}
-
-    // Add the contribution of a single track to the density
-    void addTrackToDensity(const TrackEntry& entry);
-
-    // Return density, first and second derivatives
-    inline std::tuple<double, double, double> densityAndDerivatives() const {
-      return {m_density, m_firstDerivative, m_secondDerivative};
-    }
-
-   private:
-    // Store density and derivatives for z position m_z
-    double m_z;
-    double m_density{0};
-    double m_firstDerivative{0};
-    double m_secondDerivative{0};
-  };
 };
 
 }  // namespace Acts
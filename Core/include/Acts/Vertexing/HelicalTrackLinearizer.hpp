@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/EventData/BoundTrackParametersBatch.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
@@ -21,6 +22,8 @@
 #include "Acts/Vertexing/LinearizedTrack.hpp"
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace Acts {
 
@@ -88,7 +91,51 @@ class HelicalTrackLinearizer {
       const Acts::MagneticFieldContext& mctx,
       MagneticFieldProvider::Cache& fieldCache) const;
 
+  /// @brief Function that linearizes a batch of BoundTrackParameters at
+  /// the PCA to the same Perigee surface
+  ///
+  /// The propagator options and the Perigee position are set up once. The
+  /// z-component of the magnetic field is looked up once at the Perigee
+  /// position and used for all tracks, instead of at each PCA as done by
+  /// `linearizeTrack`. Both agree for a homogeneous field.
+  ///
+  /// @param params Parameters to linearize
+  /// @param linPointTime Time associated to the linearization point
+  /// @param perigeeSurface Perigee surface belonging to the linearization point
+  /// @param gctx Geometry context
+  /// @param mctx Magnetic field context
+  /// @param fieldCache Magnetic field cache
+  /// @param[out] linTracks Linearized tracks in the order of @p params, the
+  ///        storage of the vector is reused
+  ///
+  /// @return Error of the first track that could not be linearized
+  Result<void> linearizeTracks(const BoundTrackParametersBatch& params,
+                               double linPointTime,
+                               const Surface& perigeeSurface,
+                               const Acts::GeometryContext& gctx,
+                               const Acts::MagneticFieldContext& mctx,
+                               MagneticFieldProvider::Cache& fieldCache,
+                               std::vector<LinearizedTrack>& linTracks) const;
+
  private:
+  /// @brief Linearizes one track with prepared propagator options
+  ///
+  /// @param params Parameters to linearize
+  /// @param linPoint Linearization point, i.e. the Perigee position and time
+  /// @param perigeeSurface Perigee surface belonging to @p linPoint
+  /// @param gctx Geometry context
+  /// @param pOptions Propagator options, the direction is set per track
+  /// @param fieldCache Magnetic field cache
+  /// @param sharedBz z-component of the field to use instead of looking
+  ///        it up at the PCA
+  ///
+  /// @return Linearized track
+  Result<LinearizedTrack> linearizeAtPerigee(
+      const BoundTrackParameters& params, const Vector4& linPoint,
+      const Surface& perigeeSurface, const Acts::GeometryContext& gctx,
+      PropagatorOptions<>& pOptions, MagneticFieldProvider::Cache& fieldCache,
+      std::optional<ActsScalar> sharedBz = std::nullopt) const;
+
   /// Configuration object
   const Config m_cfg;
 
@@ -20,6 +20,9 @@
 #include "Acts/Vertexing/TrackAtVertex.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace Acts {
 
 struct ImpactParametersAndSigma {
@@ -129,6 +132,27 @@ class ImpactPointEstimator {
       const BoundTrackParameters& trkParams, const Vector3& vtxPos,
       State& state) const;
 
+  /// @brief Estimates the track parameters at the 3D PCA to a vertex for a
+  /// set of tracks. This is equivalent to calling the single track version
+  /// for each of the tracks. The 3D PCAs of the helical tracks are found in
+  /// one Newton minimization over all tracks, and the B field is only
+  /// retrieved once for consecutive tracks sharing their reference point.
+  ///
+  /// @param gctx The geometry context
+  /// @param mctx The magnetic field context
+  /// @param trkParams Track parameters
+  /// @param vtxPos Reference position (vertex)
+  /// @param state The state object
+  /// @param[out] ipParams Track parameters at the 3D PCA, in the order of
+  /// @p trkParams
+  ///
+  /// @return Error of the first step which failed for any of the tracks
+  Result<void> estimate3DImpactParameters(
+      const GeometryContext& gctx, const Acts::MagneticFieldContext& mctx,
+      const std::vector<BoundTrackParameters>& trkParams,
+      const Vector3& vtxPos, State& state,
+      std::vector<BoundTrackParameters>& ipParams) const;
+
   /// @brief Estimates the compatibility of a track to a vertex based on their
   /// 3D (if nDim = 3) or 4D (if nDim = 4) distance and the track covariance.
   /// @note Confusingly, a *smaller* compatibility means that a track is *more*
@@ -152,6 +176,28 @@ class ImpactPointEstimator {
     return getVertexCompatibility(gctx, trkParams, {vertexPos.data(), nDim});
   }
 
+  /// @brief Estimates the compatibility of a set of tracks to a vertex. This
+  /// is equivalent to calling `getVertexCompatibility` for each of the tracks.
+  ///
+  /// @tparam nDim Number of dimensions used to compute compatibility
+  /// @param gctx The Geometry context
+  /// @param trkParams Track parameters at point of closest
+  /// approach in 3D as retrieved by estimate3DImpactParameters
+  /// @param vertexPos The vertex position
+  /// @param[out] compatibilities The compatibility values, in the order of
+  /// @p trkParams
+  template <int nDim>
+  Result<void> getVertexCompatibilities(
+      const GeometryContext& gctx,
+      const std::vector<BoundTrackParameters>& trkParams,
+      const ActsVector<nDim>& vertexPos,
+      std::vector<double>& compatibilities) const {
+    static_assert(nDim == 3 || nDim == 4,
+                  "Only 3D and 4D vertex positions allowed");
+    return getVertexCompatibilities(gctx, trkParams, {vertexPos.data(), nDim},
+                                    compatibilities);
+  }
+
   /// @brief Calculate the distance between a track and a vertex by finding the
   /// corresponding 3D PCA. Returns also the momentum direction at the 3D PCA.
   /// The template parameter nDim determines whether we calculate the 3D
@@ -237,6 +283,28 @@ class ImpactPointEstimator {
       const GeometryContext& gctx, const BoundTrackParameters* trkParams,
       Eigen::Map<const ActsDynamicVector> vertexPos) const;
 
+  Result<void> getVertexCompatibilities(
+      const GeometryContext& gctx,
+      const std::vector<BoundTrackParameters>& trkParams,
+      Eigen::Map<const ActsDynamicVector> vertexPos,
+      std::vector<double>& compatibilities) const;
+
+  /// @brief Propagates the track parameters to the plane at the vertex which
+  /// is orthogonal to the momentum at the 3D PCA
+  ///
+  /// @param gctx The geometry context
+  /// @param mctx The magnetic field context
+  /// @param trkParams Track parameters
+  /// @param vtxPos Reference position (vertex)
+  /// @param distanceAndMomentum Vector from the vertex to the 3D PCA and
+  /// momentum direction at the 3D PCA
+  ///
+  /// @return Track parameters at the 3D PCA
+  Result<BoundTrackParameters> propagateTo3DPCA(
+      const GeometryContext& gctx, const Acts::MagneticFieldContext& mctx,
+      const BoundTrackParameters& trkParams, const Vector3& vtxPos,
+      const std::pair<Vector4, Vector3>& distanceAndMomentum) const;
+
   /// Configuration object
   const Config m_cfg;
 
@@ -18,11 +18,14 @@
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
 #include "Acts/Vertexing/IVertexFinder.hpp"
 #include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/LinearizedTrack.hpp"
 #include "Acts/Vertexing/TrackLinearizer.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
 #include <functional>
+#include <memory>
+#include <vector>
 
 namespace Acts {
 
@@ -107,6 +110,10 @@ class IterativeVertexFinder final : public IVertexFinder {
     /// If `reassignTracksAfterFirstFit` is set this threshold will be used to
     /// decide if a track should be checked for reassignment to other vertices
     double cutOffTrackWeightReassign = 1;
+    /// If `reassignTracksAfterFirstFit` is set, add the reassigned tracks to
+    /// the current vertex with Kalman updates instead of refitting the vertex
+    /// with all of its tracks
+    bool reassignWithKalmanUpdate = false;
 
     /// Function to extract parameters from InputTrack
     InputTrack::Extractor extractParameters;
@@ -172,6 +179,17 @@ class IterativeVertexFinder final : public IVertexFinder {
   /// Private access to logging instance
   const Logger& logger() const { return *m_logger; }
 
+  /// @brief Quantities of a found vertex which are reused in later
+  /// iterations. The vertex is not refitted once it is found, only tracks
+  /// are taken away from it.
+  struct VertexCache {
+    /// The perigee surface at the vertex position
+    std::shared_ptr<const Surface> perigeeSurface;
+    /// Compatibility of each track at the vertex with it, NaN if not yet
+    /// computed
+    std::vector<double> compatibilities;
+  };
+
   /// @brief Method that calls seed finder to retrieve a vertex seed
   ///
   /// @param state The state object
@@ -204,6 +222,14 @@ class IterativeVertexFinder final : public IVertexFinder {
                                   const VertexingOptions& vertexingOptions,
                                   State& state) const;
 
+  /// @brief Function for calculating how compatible a linearized track is
+  /// to a given vertex
+  ///
+  /// @param linTrack Track linearized at the vertex position
+  /// @param vertex The vertex
+  double getCompatibility(const LinearizedTrack& linTrack,
+                          const Vertex& vertex) const;
+
   /// @brief Function that removes used tracks compatible with
   /// current vertex (`vertex`) from `tracksToFit` and `seedTracks`
   /// as well as outliers from vertex.tracksAtVertex
@@ -236,6 +262,7 @@ class IterativeVertexFinder final : public IVertexFinder {
   ///        to the current vertex if they are more compatible
   ///
   /// @param vertexCollection Collection of vertices
+  /// @param vertexCaches Cached quantities of each vertex in the collection
   /// @param currentVertex Current vertex to assign tracks to
   /// @param tracksToFit Tracks to fit vector
   /// @param seedTracks Seed tracks vector
@@ -245,7 +272,8 @@ class IterativeVertexFinder final : public IVertexFinder {
   ///
   /// @return Bool if currentVertex is still a good vertex
   Result<bool> reassignTracksToNewVertex(
-      std::vector<Vertex>& vertexCollection, Vertex& currentVertex,
+      std::vector<Vertex>& vertexCollection,
+      std::vector<VertexCache>& vertexCaches, Vertex& currentVertex,
       std::vector<InputTrack>& tracksToFit, std::vector<InputTrack>& seedTracks,
       const std::vector<InputTrack>& origTracks,
       const VertexingOptions& vertexingOptions, State& state) const;
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/EventData/BoundTrackParametersBatch.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Vertexing/LinearizedTrack.hpp"
@@ -15,6 +16,7 @@
 #include <any>
 #include <functional>
 #include <typeindex>
+#include <vector>
 
 namespace Acts {
 
@@ -69,6 +71,44 @@ struct InputTrack {
   const void* m_ptr;
 };
 
+/// Use the entries of a parameters batch as vertexing input
+///
+/// The input tracks refer to the parameter vectors of the batch, which has to
+/// outlive the input tracks. Connect @c extractParameters as the parameter
+/// extractor of the vertex finders and fitters, e.g.
+///   `cfg.extractParameters.connect<
+///       &BoundTrackParametersBatchInput::extractParameters>(&input)`
+class BoundTrackParametersBatchInput {
+ public:
+  /// @param batch The parameters batch
+  explicit BoundTrackParametersBatchInput(
+      const BoundTrackParametersBatch& batch)
+      : m_batch{&batch} {}
+
+  /// One input track per entry of the batch
+  std::vector<InputTrack> inputTracks() const {
+    std::vector<InputTrack> tracks;
+    tracks.reserve(m_batch->size());
+    for (const auto& params : m_batch->parameters()) {
+      tracks.emplace_back(&params);
+    }
+    return tracks;
+  }
+
+  /// The index of an input track in the batch
+  std::size_t index(const InputTrack& track) const {
+    using Parameters = BoundTrackParametersBatch::ParametersVector;
+    return m_batch->index(*track.as<Parameters>());
+  }
+
+  BoundTrackParameters extractParameters(const InputTrack& track) const {
+    return m_batch->at(index(track));
+  }
+
+ private:
+  const BoundTrackParametersBatch* m_batch;
+};
+
 /// @class TrackAtVertex
 ///
 /// @brief Defines a track at vertex object
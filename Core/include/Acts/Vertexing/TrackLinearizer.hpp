@@ -14,8 +14,11 @@
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/Utilities/Delegate.hpp"
 
+#include <vector>
+
 namespace Acts {
 struct LinearizedTrack;
+class BoundTrackParametersBatch;
 class Surface;
 
 using TrackLinearizer = Acts::Delegate<Result<LinearizedTrack>(
@@ -23,4 +26,13 @@ using TrackLinearizer = Acts::Delegate<Result<LinearizedTrack>(
     const Surface& perigeeSurface, const Acts::GeometryContext& gctx,
     const Acts::MagneticFieldContext& mctx,
     MagneticFieldProvider::Cache& fieldCache)>;
+
+/// Linearizes a batch of tracks at the same Perigee surface, writing the
+/// linearized tracks to the output vector in the order of the batch
+using TrackBatchLinearizer = Acts::Delegate<Result<void>(
+    const BoundTrackParametersBatch& params, double linPointTime,
+    const Surface& perigeeSurface, const Acts::GeometryContext& gctx,
+    const Acts::MagneticFieldContext& mctx,
+    MagneticFieldProvider::Cache& fieldCache,
+    std::vector<LinearizedTrack>& linTracks)>;
 }  // namespace Acts
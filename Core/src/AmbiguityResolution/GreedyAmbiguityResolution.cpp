@@ -8,83 +8,127 @@
 
 #include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
 
+#include <algorithm>
+#include <queue>
+#include <utility>
+#include <vector>
+
 namespace Acts {
 
 namespace {
 
-/// Removes a track from the state which has to be done for multiple properties
-/// because of redundancy.
-static void removeTrack(GreedyAmbiguityResolution::State& state,
-                        std::size_t iTrack) {
-  for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
-    state.tracksPerMeasurement[iMeasurement].erase(iTrack);
-
-    if (state.tracksPerMeasurement[iMeasurement].size() == 1) {
-      auto jTrack = *state.tracksPerMeasurement[iMeasurement].begin();
-      --state.sharedMeasurementsPerTrack[jTrack];
-    }
-  }
-
-  state.selectedTracks.erase(iTrack);
-}
+/// A track in the eviction queue with the number of shared measurements it
+/// was queued with. The entry is outdated if that number has changed.
+struct Candidate {
+  std::size_t iTrack;
+  std::size_t sharedMeasurements;
+};
 
 }  // namespace
 
 void GreedyAmbiguityResolution::resolve(State& state) const {
-  /// Compares two tracks based on the number of shared measurements in order to
-  /// decide if we already met the final state.
-  auto sharedMeasurementsComperator = [&state](std::size_t a, std::size_t b) {
-    return state.sharedMeasurementsPerTrack[a] <
-           state.sharedMeasurementsPerTrack[b];
+  /// Helper to calculate the relative amount of shared measurements.
+  auto relativeSharedMeasurements = [&state](const Candidate& c) {
+    return 1.0 * c.sharedMeasurements / state.nMeasurements(c.iTrack);
   };
 
   /// Compares two tracks in order to find the one which should be evicted.
   /// First we compare the relative amount of shared measurements. If that is
-  /// indecisive we use the chi2.
-  auto trackComperator = [&state](std::size_t a, std::size_t b) {
-    /// Helper to calculate the relative amount of shared measurements.
-    auto relativeSharedMeasurements = [&state](std::size_t i) {
-      return 1.0 * state.sharedMeasurementsPerTrack[i] /
-             state.measurementsPerTrack[i].size();
-    };
-
+  /// indecisive we use the chi2, and finally prefer the lower index.
+  auto trackComperator = [&](const Candidate& a, const Candidate& b) {
     if (relativeSharedMeasurements(a) != relativeSharedMeasurements(b)) {
       return relativeSharedMeasurements(a) < relativeSharedMeasurements(b);
     }
-    return state.trackChi2[a] < state.trackChi2[b];
+    if (state.trackChi2[a.iTrack] != state.trackChi2[b.iTrack]) {
+      return state.trackChi2[a.iTrack] < state.trackChi2[b.iTrack];
+    }
+    return a.iTrack > b.iTrack;
+  };
+
+  std::vector<Candidate> candidates;
+  candidates.reserve(state.selectedTracks.size());
+  std::vector<bool> isSelected(state.numberOfTracks, false);
+  // Number of selected tracks above the limit of shared measurements, we are
+  // done once there is none.
+  std::size_t nTracksAboveLimit = 0;
+  for (auto iTrack : state.selectedTracks) {
+    candidates.push_back({iTrack, state.sharedMeasurementsPerTrack[iTrack]});
+    isSelected[iTrack] = true;
+    if (state.sharedMeasurementsPerTrack[iTrack] >= m_cfg.maximumSharedHits) {
+      ++nTracksAboveLimit;
+    }
+  }
+  std::priority_queue queue(trackComperator, std::move(candidates));
+
+  /// Removes a track and updates the tracks which shared a measurement with
+  /// it and have it for themselves now.
+  auto removeTrack = [&](std::size_t iTrack) {
+    isSelected[iTrack] = false;
+    if (state.sharedMeasurementsPerTrack[iTrack] >= m_cfg.maximumSharedHits) {
+      --nTracksAboveLimit;
+    }
+
+    for (std::size_t i = state.measurementOffsets[iTrack];
+         i < state.measurementOffsets[iTrack + 1]; ++i) {
+      auto iMeasurement = state.measurementsPerTrack[i];
+      if (--state.selectedTracksPerMeasurement[iMeasurement] != 1) {
+        continue;
+      }
+      for (std::size_t j = state.trackOffsets[iMeasurement];
+           j < state.trackOffsets[iMeasurement + 1]; ++j) {
+        auto jTrack = state.tracksPerMeasurement[j];
+        if (!isSelected[jTrack]) {
+          continue;
+        }
+        auto& shared = state.sharedMeasurementsPerTrack[jTrack];
+        if (shared == m_cfg.maximumSharedHits) {
+          --nTracksAboveLimit;
+        }
+        --shared;
+        queue.push({jTrack, shared});
+        break;
+      }
+    }
   };
 
   for (std::size_t i = 0; i < m_cfg.maximumIterations; ++i) {
+    // Drop the outdated entries of the queue
+    while (!queue.empty() &&
+           (!isSelected[queue.top().iTrack] ||
+            queue.top().sharedMeasurements !=
+                state.sharedMeasurementsPerTrack[queue.top().iTrack])) {
+      queue.pop();
+    }
+
     // Lazy out if there is nothing to filter on.
-    if (state.selectedTracks.empty()) {
+    if (queue.empty()) {
       ACTS_VERBOSE("no tracks left - exit loop");
       break;
     }
 
-    // Find the maximum amount of shared measurements per track to decide if we
-    // are done or not.
-    auto maximumSharedMeasurements = *std::max_element(
-        state.selectedTracks.begin(), state.selectedTracks.end(),
-        sharedMeasurementsComperator);
-    ACTS_VERBOSE(
-        "maximum shared measurements "
-        << state.sharedMeasurementsPerTrack[maximumSharedMeasurements]);
-    if (state.sharedMeasurementsPerTrack[maximumSharedMeasurements] <
-        m_cfg.maximumSharedHits) {
+    ACTS_VERBOSE("tracks above the shared measurements limit "
+                 << nTracksAboveLimit);
+    if (nTracksAboveLimit == 0) {
       break;
     }
 
-    // Find the "worst" track by comparing them to each other
-    auto badTrack =
-        *std::max_element(state.selectedTracks.begin(),
-                          state.selectedTracks.end(), trackComperator);
+    // The "worst" track is on top of the queue
+    auto badTrack = queue.top().iTrack;
+    queue.pop();
     ACTS_VERBOSE("remove track "
-                 << badTrack << " nMeas "
-                 << state.measurementsPerTrack[badTrack].size() << " nShared "
-                 << state.sharedMeasurementsPerTrack[badTrack] << " chi2 "
-                 << state.trackChi2[badTrack]);
-    removeTrack(state, badTrack);
+                 << badTrack << " nMeas " << state.nMeasurements(badTrack)
+                 << " nShared " << state.sharedMeasurementsPerTrack[badTrack]
+                 << " chi2 " << state.trackChi2[badTrack]);
+    removeTrack(badTrack);
   }
+
+  auto selectedTracks = state.selectedTracks.extract_sequence();
+  selectedTracks.erase(
+      std::remove_if(selectedTracks.begin(), selectedTracks.end(),
+                     [&](std::size_t iTrack) { return !isSelected[iTrack]; }),
+      selectedTracks.end());
+  state.selectedTracks.adopt_sequence(boost::container::ordered_unique_range,
+                                      std::move(selectedTracks));
 }
 
 }  // namespace Acts
@@ -11,8 +11,185 @@
 #include "Acts/EventData/Measurement.hpp"
 #include "Acts/EventData/SourceLink.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
+Acts::ScoreBasedAmbiguityResolution::ScoreBasedAmbiguityResolution(
+    const Config& cfg, std::unique_ptr<const Logger> logger)
+    : m_cfg{cfg}, m_logger{std::move(logger)} {
+  m_plan = compilePlan();
+}
+
+Acts::ScoreBasedAmbiguityResolution::ScoringPlan
+Acts::ScoreBasedAmbiguityResolution::compilePlan() const {
+  const Config& cfg = m_cfg;
+  ScoringPlan plan;
+
+  const std::size_t nDetectors = cfg.detectorConfigs.size();
+  for (const auto& [iVolume, detectorId] : cfg.volumeMap) {
+    if (detectorId >= nDetectors) {
+      // the hits in this volume are skipped as if it was not mapped
+      ACTS_WARNING("Volume " << iVolume << " is mapped to the unknown detector "
+                             << detectorId);
+      continue;
+    }
+    if (iVolume >= plan.detectorIds.size()) {
+      plan.detectorIds.resize(iVolume + 1, ScoringPlan::kNoDetector);
+    }
+    plan.detectorIds[iVolume] = detectorId;
+  }
+
+  plan.factorHitsOffsets.push_back(0);
+  plan.factorHolesOffsets.push_back(0);
+  for (const auto& detector : cfg.detectorConfigs) {
+    plan.minHits.push_back(detector.minHits);
+    plan.maxHits.push_back(detector.maxHits);
+    plan.maxHoles.push_back(detector.maxHoles);
+    plan.maxOutliers.push_back(detector.maxOutliers);
+    plan.maxSharedHits.push_back(detector.maxSharedHits);
+    plan.sharedHitsFlag.push_back(detector.sharedHitsFlag);
+
+    plan.hitsScoreWeight.push_back(detector.hitsScoreWeight);
+    plan.holesScoreWeight.push_back(detector.holesScoreWeight);
+    plan.outliersScoreWeight.push_back(detector.outliersScoreWeight);
+    plan.otherScoreWeight.push_back(detector.otherScoreWeight);
+
+    plan.factorHits.insert(plan.factorHits.end(), detector.factorHits.begin(),
+                           detector.factorHits.end());
+    plan.factorHitsOffsets.push_back(plan.factorHits.size());
+    plan.factorHoles.insert(plan.factorHoles.end(),
+                            detector.factorHoles.begin(),
+                            detector.factorHoles.end());
+    plan.factorHolesOffsets.push_back(plan.factorHoles.size());
+  }
+
+  return plan;
+}
+
+std::vector<double>
+Acts::ScoreBasedAmbiguityResolution::scoreDetectorFeatures(
+    const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
+    std::vector<std::uint8_t>& accepted) const {
+  const std::size_t nTracks = trackFeaturesVectors.size();
+  const std::size_t nDetectors = m_plan.nDetectors();
+  if (accepted.size() != nTracks) {
+    throw std::invalid_argument("Track features and tracks size mismatch");
+  }
+
+  // the weighted sum starts from 0 and the product of the factors from 1
+  std::vector<double> detectorTerms(nTracks,
+                                    m_cfg.useAmbiguityFunction ? 1. : 0.);
+
+  std::vector<std::size_t> nHits(nTracks);
+  std::vector<std::size_t> nHoles(nTracks);
+  std::vector<std::size_t> nOutliers(nTracks);
+  std::vector<std::size_t> nSharedHits(nTracks);
+
+  // The tracks are independent, each range of tracks applies all detectors
+  // to its own tracks and counts the missing factors per detector
+  const std::size_t nRanges = nTrackRanges(nTracks);
+  std::vector<std::size_t> nMissingFactorHits(nRanges * nDetectors, 0);
+  std::vector<std::size_t> nMissingFactorHoles(nRanges * nDetectors, 0);
+
+  parallelFor(nRanges, [&](std::size_t iRange) {
+    const std::size_t begin = nTracks * iRange / nRanges;
+    const std::size_t end = nTracks * (iRange + 1) / nRanges;
+    for (std::size_t detectorId = 0; detectorId < nDetectors; ++detectorId) {
+      for (std::size_t iTrack = begin; iTrack < end; ++iTrack) {
+        const auto& trackFeatures = trackFeaturesVectors[iTrack].at(detectorId);
+        nHits[iTrack] = trackFeatures.nHits;
+        nHoles[iTrack] = trackFeatures.nHoles;
+        nOutliers[iTrack] = trackFeatures.nOutliers;
+        nSharedHits[iTrack] = trackFeatures.nSharedHits;
+      }
+
+      const std::size_t minHits = m_plan.minHits[detectorId];
+      const std::size_t maxHits = m_plan.maxHits[detectorId];
+      const std::size_t maxHoles = m_plan.maxHoles[detectorId];
+      const std::size_t maxOutliers = m_plan.maxOutliers[detectorId];
+      for (std::size_t iTrack = begin; iTrack < end; ++iTrack) {
+        const bool pass = (nHits[iTrack] >= minHits) &&
+                          (nHits[iTrack] <= maxHits) &&
+                          (nHoles[iTrack] <= maxHoles) &&
+                          (nOutliers[iTrack] <= maxOutliers);
+        accepted[iTrack] &= static_cast<std::uint8_t>(pass);
+      }
+
+      if (!m_cfg.useAmbiguityFunction) {
+        const double hitsWeight = m_plan.hitsScoreWeight[detectorId];
+        const double holesWeight = m_plan.holesScoreWeight[detectorId];
+        const double outliersWeight = m_plan.outliersScoreWeight[detectorId];
+        const double otherWeight = m_plan.otherScoreWeight[detectorId];
+        for (std::size_t iTrack = begin; iTrack < end; ++iTrack) {
+          detectorTerms[iTrack] += nHits[iTrack] * hitsWeight +
+                                   nHoles[iTrack] * holesWeight +
+                                   nOutliers[iTrack] * outliersWeight +
+                                   nSharedHits[iTrack] * otherWeight;
+        }
+        continue;
+      }
+
+      // The factor tables are indexed by the number of hits and holes, which
+      // cannot exceed the maximum for the accepted tracks.
+      const double* factorHits =
+          m_plan.factorHits.data() + m_plan.factorHitsOffsets[detectorId];
+      const std::size_t nFactorHits =
+          m_plan.factorHitsOffsets[detectorId + 1] -
+          m_plan.factorHitsOffsets[detectorId];
+      const double* factorHoles =
+          m_plan.factorHoles.data() + m_plan.factorHolesOffsets[detectorId];
+      const std::size_t nFactorHoles =
+          m_plan.factorHolesOffsets[detectorId + 1] -
+          m_plan.factorHolesOffsets[detectorId];
+      std::size_t& nMissingHits =
+          nMissingFactorHits[iRange * nDetectors + detectorId];
+      std::size_t& nMissingHoles =
+          nMissingFactorHoles[iRange * nDetectors + detectorId];
+      for (std::size_t iTrack = begin; iTrack < end; ++iTrack) {
+        if (accepted[iTrack] == 0) {
+          continue;
+        }
+        if (nHits[iTrack] >= nFactorHits) {
+          ++nMissingHits;
+          continue;
+        }
+        detectorTerms[iTrack] *= factorHits[nHits[iTrack]];
+        if (nHoles[iTrack] >= nFactorHoles) {
+          ++nMissingHoles;
+          continue;
+        }
+        detectorTerms[iTrack] *= factorHoles[nHoles[iTrack]];
+      }
+    }
+  });
+
+  if (!m_cfg.useAmbiguityFunction) {
+    return detectorTerms;
+  }
+  for (std::size_t detectorId = 0; detectorId < nDetectors; ++detectorId) {
+    std::size_t nMissingHits = 0;
+    std::size_t nMissingHoles = 0;
+    for (std::size_t iRange = 0; iRange < nRanges; ++iRange) {
+      nMissingHits += nMissingFactorHits[iRange * nDetectors + detectorId];
+      nMissingHoles += nMissingFactorHoles[iRange * nDetectors + detectorId];
+    }
+    if (nMissingHits > 0) {
+      ACTS_WARNING("Detector " << detectorId
+                               << " has not enough factorhits in the "
+                                  "detector.factorHits vector for "
+                               << nMissingHits << " tracks");
+    }
+    if (nMissingHoles > 0) {
+      ACTS_WARNING("Detector " << detectorId
+                               << " has not enough factorholes in the "
+                                  "detector.factorHoles vector for "
+                               << nMissingHoles << " tracks");
+    }
+  }
+
+  return detectorTerms;
+}
+
 std::vector<bool> Acts::ScoreBasedAmbiguityResolution::getCleanedOutTracks(
     const std::vector<double>& trackScore,
     const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
@@ -87,7 +264,6 @@ std::vector<bool> Acts::ScoreBasedAmbiguityResolution::getCleanedOutTracks(
       auto isoutliner = measurementObjects.isOutlier;
       auto detectorId = measurementObjects.detectorId;
 
-      auto detector = m_cfg.detectorConfigs.at(detectorId);
       if (isoutliner) {
         ACTS_VERBOSE("Measurement is outlier on a fitter track, copy it over");
         trackStateTypes[index] = Outlier;
@@ -105,7 +281,7 @@ std::vector<bool> Acts::ScoreBasedAmbiguityResolution::getCleanedOutTracks(
       if (tracksPerMeasurement[iMeasurement].size() > 1) {
         ACTS_VERBOSE("Measurement is shared, copy it over");
 
-        if (detector.sharedHitsFlag == true) {
+        if (m_plan.sharedHitsFlag.at(detectorId) != 0) {
           ACTS_VERBOSE("Measurement is shared, Reject it");
           trackStateTypes[index] = RejectedHit;
           index++;
@@ -171,11 +347,10 @@ std::vector<bool> Acts::ScoreBasedAmbiguityResolution::getCleanedOutTracks(
     }
 
     // Check if the track has too many shared hits to be accepted.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
+    for (std::size_t detectorId = 0; detectorId < m_plan.nDetectors();
          detectorId++) {
-      auto detector = m_cfg.detectorConfigs.at(detectorId);
       if (trackFeaturesVector[detectorId].nSharedHits >
-          detector.maxSharedHits) {
+          m_plan.maxSharedHits[detectorId]) {
         trkCouldBeAccepted = false;
         break;
       }
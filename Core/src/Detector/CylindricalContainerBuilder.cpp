@@ -17,6 +17,7 @@
 #include "Acts/Detector/interface/IRootVolumeFinderBuilder.hpp"
 #include "Acts/Material/ProtoSurfaceMaterial.hpp"
 #include "Acts/Navigation/DetectorVolumeFinders.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <algorithm>
 #include <ostream>
@@ -118,7 +119,7 @@ Acts::Experimental::CylindricalContainerBuilder::CylindricalContainerBuilder(
 
 Acts::Experimental::CylindricalContainerBuilder::CylindricalContainerBuilder(
     const Acts::Experimental::Blueprint::Node& bpNode,
-    Acts::Logging::Level logLevel)
+    Acts::Logging::Level logLevel, bool buildConcurrently)
     : IDetectorComponentBuilder(),
       m_logger(getDefaultLogger(bpNode.name + "_cont", logLevel)) {
   if (bpNode.boundsType != VolumeBounds::BoundsType::eCylinder) {
@@ -151,8 +152,8 @@ Acts::Experimental::CylindricalContainerBuilder::CylindricalContainerBuilder(
           dvCfg, getDefaultLogger(child->name, logLevel)));
     } else {
       // This evokes the recursive stepping down the tree
-      m_cfg.builders.push_back(
-          std::make_shared<CylindricalContainerBuilder>(*child, logLevel));
+      m_cfg.builders.push_back(std::make_shared<CylindricalContainerBuilder>(
+          *child, logLevel, buildConcurrently));
     }
   }
 
@@ -190,6 +191,7 @@ Acts::Experimental::CylindricalContainerBuilder::CylindricalContainerBuilder(
   m_cfg.geoIdGenerator = bpNode.geoIdGenerator;
   m_cfg.rootVolumeFinderBuilder = bpNode.rootVolumeFinderBuilder;
   m_cfg.portalMaterialBinning = bpNode.portalMaterialBinning;
+  m_cfg.buildConcurrently = buildConcurrently;
 }
 
 Acts::Experimental::DetectorComponent
@@ -209,17 +211,28 @@ Acts::Experimental::CylindricalContainerBuilder::construct(
   std::vector<std::shared_ptr<DetectorVolume>> volumes;
   std::vector<DetectorComponent::PortalContainer> containers;
   std::vector<std::shared_ptr<DetectorVolume>> rootVolumes;
-  // Run through the builders
-  std::for_each(
-      m_cfg.builders.begin(), m_cfg.builders.end(), [&](const auto& builder) {
-        auto [cVolumes, cContainer, cRoots] = builder->construct(gctx);
-        atNavigationLevel = (atNavigationLevel && cVolumes.size() == 1u);
-        // Collect individual components, volumes, containers, roots
-        volumes.insert(volumes.end(), cVolumes.begin(), cVolumes.end());
-        containers.push_back(cContainer);
-        rootVolumes.insert(rootVolumes.end(), cRoots.volumes.begin(),
-                           cRoots.volumes.end());
-      });
+  // Run through the builders, the independent branches can be built
+  // concurrently, they are collected in builder order afterwards
+  std::vector<DetectorComponent> builtComponents(m_cfg.builders.size());
+  auto build = [&](std::size_t ib) {
+    builtComponents[ib] = m_cfg.builders[ib]->construct(gctx);
+  };
+  if (m_cfg.buildConcurrently) {
+    parallelFor(m_cfg.builders.size(), build);
+  } else {
+    for (std::size_t ib = 0; ib < m_cfg.builders.size(); ++ib) {
+      build(ib);
+    }
+  }
+  for (std::size_t ib = 0; ib < m_cfg.builders.size(); ++ib) {
+    auto& [cVolumes, cContainer, cRoots] = builtComponents[ib];
+    atNavigationLevel = (atNavigationLevel && cVolumes.size() == 1u);
+    // Collect individual components, volumes, containers, roots
+    volumes.insert(volumes.end(), cVolumes.begin(), cVolumes.end());
+    containers.push_back(cContainer);
+    rootVolumes.insert(rootVolumes.end(), cRoots.volumes.begin(),
+                       cRoots.volumes.end());
+  }
   // Navigation level detected, connect volumes (cleaner and faster than
   // connect containers)
   if (atNavigationLevel) {
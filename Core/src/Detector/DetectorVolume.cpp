@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <iterator>
+#include <limits>
 
 namespace Acts {
 class IVolumeMaterial;
@@ -314,8 +315,10 @@ void Acts::Experimental::DetectorVolume::createBoundingBox(
       vertices.push_back(v);
     }
   }
-  Acts::Vector3 vmin = Acts::Vector3::Zero();
-  Acts::Vector3 vmax = Acts::Vector3::Zero();
+  Acts::Vector3 vmin =
+      Acts::Vector3::Constant(std::numeric_limits<ActsScalar>::max());
+  Acts::Vector3 vmax =
+      Acts::Vector3::Constant(std::numeric_limits<ActsScalar>::lowest());
   for (const auto& v : vertices) {
     vmin = vmin.cwiseMin(v);
     vmax = vmax.cwiseMax(v);
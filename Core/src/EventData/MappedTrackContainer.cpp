@@ -0,0 +1,354 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/MappedTrackContainer.hpp"
+
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+
+#include <utility>
+
+namespace Acts {
+
+namespace detail_mtc {
+
+namespace {
+
+constexpr std::array<std::size_t, eNumSections> kElementSizes = {
+    sizeof(TrackRecord), sizeof(double), sizeof(double),
+    sizeof(StateRecord), sizeof(double), sizeof(double),
+    sizeof(double),      sizeof(double), sizeof(double),
+    sizeof(SurfaceRecord),
+};
+
+std::size_t alignSection(std::size_t offset) {
+  return (offset + kSectionAlignment - 1) / kSectionAlignment *
+         kSectionAlignment;
+}
+
+template <typename T>
+std::pair<const char*, std::size_t> bytes(const std::vector<T>& column) {
+  return {reinterpret_cast<const char*>(column.data()),
+          column.size() * sizeof(T)};
+}
+
+const std::unordered_map<HashedString,
+                         std::unique_ptr<detail::DynamicColumnBase>>
+    s_noDynamicColumns;
+
+}  // namespace
+
+void writeFile(std::ostream& os, const FileContent& content) {
+  std::array<std::pair<const char*, std::size_t>, eNumSections> sections = {
+      bytes(content.tracks),
+      bytes(content.trackParameters),
+      bytes(content.trackCovariances),
+      bytes(content.states),
+      bytes(content.parameters),
+      bytes(content.covariances),
+      bytes(content.jacobians),
+      bytes(content.measurements),
+      bytes(content.measurementCovariances),
+      bytes(content.surfaces),
+  };
+
+  FileHeader header;
+  header.headerSize = sizeof(FileHeader);
+  header.trackRecordSize = sizeof(TrackRecord);
+  header.stateRecordSize = sizeof(StateRecord);
+  header.surfaceRecordSize = sizeof(SurfaceRecord);
+  std::size_t offset = alignSection(sizeof(FileHeader));
+  for (std::size_t i = 0; i < eNumSections; ++i) {
+    header.sections[i].offset = offset;
+    header.sections[i].size = sections[i].second;
+    offset = alignSection(offset + sections[i].second);
+  }
+
+  const std::array<char, kSectionAlignment> padding{};
+  os.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+  std::size_t written = sizeof(FileHeader);
+  for (std::size_t i = 0; i < eNumSections; ++i) {
+    os.write(padding.data(), header.sections[i].offset - written);
+    os.write(sections[i].first, sections[i].second);
+    written = header.sections[i].offset + sections[i].second;
+  }
+  if (!os) {
+    throw std::runtime_error("Unable to write the track file");
+  }
+}
+
+detail::DynamicKeyRange<detail::DynamicColumnBase> noDynamicKeys() {
+  return {s_noDynamicColumns.begin(), s_noDynamicColumns.end()};
+}
+
+MappedSurfaces::MappedSurfaces(const MappedTrackFile& file,
+                               const MappedSurfaceLookup& lookup) {
+  const auto* records = file.section<SurfaceRecord>(eSurfaces);
+  std::size_t size = file.sectionSize<SurfaceRecord>(eSurfaces);
+  m_surfaces.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const SurfaceRecord& record = records[i];
+    if (record.type == SurfaceRecord::ePerigee) {
+      auto perigee = Surface::makeShared<PerigeeSurface>(Vector3{
+          record.center[0], record.center[1], record.center[2]});
+      m_surfaces.push_back(perigee.get());
+      m_owned.push_back(std::move(perigee));
+      continue;
+    }
+    GeometryIdentifier geoId{record.geometryId};
+    const Surface* surface = lookup ? lookup(geoId) : nullptr;
+    if (surface == nullptr) {
+      throw std::runtime_error("Unable to find the reference surface " +
+                               std::to_string(record.geometryId));
+    }
+    m_surfaces.push_back(surface);
+  }
+}
+
+}  // namespace detail_mtc
+
+MappedTrackFile::MappedTrackFile(const std::string& path) : m_file{path} {
+  using namespace detail_mtc;
+
+  if (m_file.size() < sizeof(FileHeader)) {
+    throw std::runtime_error(path + " is not a track file");
+  }
+
+  auto fail = [&](const std::string& reason) {
+    throw std::runtime_error(path + ": " + reason);
+  };
+
+  const FileHeader& head = header();
+  if (head.magic != kMagic) {
+    fail("not a track file");
+  }
+  if (head.version != kVersion) {
+    fail("unsupported version " + std::to_string(head.version));
+  }
+  if (head.headerSize != sizeof(FileHeader) ||
+      head.trackRecordSize != sizeof(TrackRecord) ||
+      head.stateRecordSize != sizeof(StateRecord) ||
+      head.surfaceRecordSize != sizeof(SurfaceRecord)) {
+    fail("written with a different record layout");
+  }
+  for (std::size_t i = 0; i < eNumSections; ++i) {
+    const SectionRange& range = head.sections[i];
+    if (range.offset % kSectionAlignment != 0 || range.offset > m_file.size() ||
+        range.size > m_file.size() - range.offset ||
+        range.size % kElementSizes[i] != 0) {
+      fail("section " + std::to_string(i) + " is out of bounds");
+    }
+  }
+  std::size_t nParameters = sectionSize<double>(eParameters) / eBoundSize;
+  if (sectionSize<double>(eTrackParameters) != nTracks() * eBoundSize ||
+      sectionSize<double>(eTrackCovariances) !=
+          nTracks() * eBoundSize * eBoundSize ||
+      sectionSize<double>(eCovariances) !=
+          nParameters * eBoundSize * eBoundSize) {
+    fail("inconsistent section sizes");
+  }
+
+  // the indices of the records are used without checks when accessing the
+  // content, so all of them have to point into their sections
+  const std::size_t nStates = nTrackStates();
+  const std::size_t nJacobians =
+      sectionSize<double>(eJacobians) / (eBoundSize * eBoundSize);
+  const std::size_t nMeasurements = sectionSize<double>(eMeasurements);
+  const std::size_t nMeasurementCovariances =
+      sectionSize<double>(eMeasurementCovariances);
+  const std::size_t nSurfaces = sectionSize<SurfaceRecord>(eSurfaces);
+  auto valid = [](IndexType index, std::size_t size) {
+    return index == kInvalid || index < size;
+  };
+  auto validRange = [](IndexType offset, std::size_t length,
+                       std::size_t size) {
+    return offset == kInvalid || (offset <= size && length <= size - offset);
+  };
+
+  const auto* tracks = section<TrackRecord>(eTracks);
+  for (std::size_t i = 0; i < nTracks(); ++i) {
+    const TrackRecord& track = tracks[i];
+    if (!valid(track.tipIndex, nStates) || !valid(track.stemIndex, nStates) ||
+        !valid(track.surface, nSurfaces)) {
+      fail("track " + std::to_string(i) + " has an index out of bounds");
+    }
+  }
+
+  const auto* states = section<StateRecord>(eStates);
+  for (std::size_t i = 0; i < nStates; ++i) {
+    const StateRecord& state = states[i];
+    bool ok = valid(state.previous, nStates) && valid(state.next, nStates) &&
+              valid(state.ipredicted, nParameters) &&
+              valid(state.ifiltered, nParameters) &&
+              valid(state.ismoothed, nParameters) &&
+              valid(state.ijacobian, nJacobians) &&
+              valid(state.surface, nSurfaces);
+    if (state.measOffset != kInvalid || state.measCovOffset != kInvalid) {
+      const std::size_t measdim = state.measdim;
+      ok = ok && measdim >= 1 && measdim <= eBoundSize &&
+           validRange(state.measOffset, measdim, nMeasurements) &&
+           validRange(state.measCovOffset, measdim * measdim,
+                      nMeasurementCovariances);
+    }
+    if (!ok) {
+      fail("track state " + std::to_string(i) + " has an index out of bounds");
+    }
+  }
+}
+
+std::size_t MappedTrackFile::nTracks() const {
+  return sectionSize<detail_mtc::TrackRecord>(detail_mtc::eTracks);
+}
+
+std::size_t MappedTrackFile::nTrackStates() const {
+  return sectionSize<detail_mtc::StateRecord>(detail_mtc::eStates);
+}
+
+ConstMappedTrackContainer::ConstMappedTrackContainer(
+    std::shared_ptr<const MappedTrackFile> file,
+    const MappedSurfaceLookup& lookup)
+    : m_file{std::move(file)} {
+  using namespace detail_mtc;
+  m_surfaces = std::make_shared<const MappedSurfaces>(*m_file, lookup);
+  m_tracks = m_file->section<TrackRecord>(eTracks);
+  m_parameters = m_file->section<double>(eTrackParameters);
+  m_covariances = m_file->section<double>(eTrackCovariances);
+  m_size = m_file->nTracks();
+}
+
+std::any ConstMappedTrackContainer::component_impl(HashedString key,
+                                                   IndexType itrack) const {
+  using namespace Acts::HashedStringLiteral;
+  const auto& track = m_tracks[itrack];
+  switch (key) {
+    case "tipIndex"_hash:
+      return &track.tipIndex;
+    case "stemIndex"_hash:
+      return &track.stemIndex;
+    case "nMeasurements"_hash:
+      return &track.nMeasurements;
+    case "nHoles"_hash:
+      return &track.nHoles;
+    case "chi2"_hash:
+      return &track.chi2;
+    case "ndf"_hash:
+      return &track.ndf;
+    case "nOutliers"_hash:
+      return &track.nOutliers;
+    case "nSharedHits"_hash:
+      return &track.nSharedHits;
+    default:
+      throw std::runtime_error("Unable to handle this component");
+  }
+}
+
+ConstMappedMultiTrajectory::ConstMappedMultiTrajectory(
+    std::shared_ptr<const MappedTrackFile> file,
+    const MappedSurfaceLookup& lookup)
+    : m_file{std::move(file)} {
+  using namespace detail_mtc;
+  m_surfaces = std::make_shared<const MappedSurfaces>(*m_file, lookup);
+  m_states = m_file->section<StateRecord>(eStates);
+  m_parameters = m_file->section<double>(eParameters);
+  m_covariances = m_file->section<double>(eCovariances);
+  m_jacobians = m_file->section<double>(eJacobians);
+  m_measurements = m_file->section<double>(eMeasurements);
+  m_measurementCovariances = m_file->section<double>(eMeasurementCovariances);
+  m_size = static_cast<IndexType>(m_file->nTrackStates());
+}
+
+bool ConstMappedMultiTrajectory::has_impl(HashedString key,
+                                          IndexType istate) const {
+  using namespace Acts::HashedStringLiteral;
+  const auto& state = m_states[istate];
+  switch (key) {
+    case "predicted"_hash:
+      return state.ipredicted != kInvalid;
+    case "filtered"_hash:
+      return state.ifiltered != kInvalid;
+    case "smoothed"_hash:
+      return state.ismoothed != kInvalid;
+    case "calibrated"_hash:
+      return state.measOffset != kInvalid;
+    case "calibratedCov"_hash:
+      return state.measCovOffset != kInvalid;
+    case "jacobian"_hash:
+      return state.ijacobian != kInvalid;
+    case "projector"_hash:
+      return state.hasProjector != 0;
+    case "previous"_hash:
+    case "next"_hash:
+    case "referenceSurface"_hash:
+    case "measdim"_hash:
+    case "chi2"_hash:
+    case "pathLength"_hash:
+    case "typeFlags"_hash:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::any ConstMappedMultiTrajectory::component_impl(HashedString key,
+                                                    IndexType istate) const {
+  using namespace Acts::HashedStringLiteral;
+  const auto& state = m_states[istate];
+  switch (key) {
+    case "previous"_hash:
+      return &state.previous;
+    case "next"_hash:
+      return &state.next;
+    case "predicted"_hash:
+      return &state.ipredicted;
+    case "filtered"_hash:
+      return &state.ifiltered;
+    case "smoothed"_hash:
+      return &state.ismoothed;
+    case "projector"_hash:
+      return &state.projector;
+    case "measdim"_hash:
+      return &state.measdim;
+    case "chi2"_hash:
+      return &state.chi2;
+    case "pathLength"_hash:
+      return &state.pathLength;
+    case "typeFlags"_hash:
+      return &state.typeFlags;
+    default:
+      throw std::runtime_error("Unable to handle this component");
+  }
+}
+
+bool ConstMappedMultiTrajectory::hasColumn_impl(HashedString key) const {
+  using namespace Acts::HashedStringLiteral;
+  switch (key) {
+    case "predicted"_hash:
+    case "filtered"_hash:
+    case "smoothed"_hash:
+    case "calibrated"_hash:
+    case "calibratedCov"_hash:
+    case "jacobian"_hash:
+    case "projector"_hash:
+    case "previous"_hash:
+    case "next"_hash:
+    case "referenceSurface"_hash:
+    case "measdim"_hash:
+    case "chi2"_hash:
+    case "pathLength"_hash:
+    case "typeFlags"_hash:
+      return true;
+    default:
+      return false;
+  }
+}
+
+SourceLink ConstMappedMultiTrajectory::getUncalibratedSourceLink_impl(
+    IndexType /*istate*/) const {
+  throw std::runtime_error("Source links are not stored in track files");
+}
+
+}  // namespace Acts
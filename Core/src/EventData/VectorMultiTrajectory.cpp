@@ -10,10 +10,13 @@
 
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
 #include <iomanip>
 #include <ostream>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include <boost/histogram.hpp>
@@ -27,6 +30,9 @@ auto VectorMultiTrajectory::addTrackState_impl(TrackStatePropMask mask,
     -> IndexType {
   using PropMask = TrackStatePropMask;
 
+  if (m_index.size() == m_index.capacity()) {
+    ++m_growthEvents;
+  }
   m_index.emplace_back();
   IndexData& p = m_index.back();
   IndexType index = m_index.size() - 1;
@@ -217,6 +223,18 @@ void VectorMultiTrajectory::unset_impl(TrackStatePropMask target,
   }
 }
 
+void VectorMultiTrajectory::setReferenceSurface_impl(
+    IndexType istate, std::shared_ptr<const Surface> surface) {
+  if (m_nonOwningDetectorSurfaces && surface != nullptr &&
+      surface->associatedDetectorElement() != nullptr) {
+    // aliasing an empty owner, copies of it are not reference counted
+    const Surface* detectorSurface = surface.get();
+    surface = std::shared_ptr<const Surface>{std::shared_ptr<const Surface>{},
+                                             detectorSurface};
+  }
+  m_referenceSurfaces[istate] = std::move(surface);
+}
+
 void VectorMultiTrajectory::clear_impl() {
   m_index.clear();
   m_previous.clear();
@@ -234,6 +252,204 @@ void VectorMultiTrajectory::clear_impl() {
   for (auto& [key, vec] : m_dynamic) {
     vec->clear();
   }
+  m_growthEvents = 0;
+}
+
+ContainerFootprint detail_vmt::VectorMultiTrajectoryBase::footprint() const {
+  ContainerFootprint result;
+  result.add("index", m_index);
+  result.add("previous", m_previous);
+  result.add("next", m_next);
+  result.add("params", m_params);
+  result.add("cov", m_cov);
+  result.add("meas", m_meas);
+  result.add("measOffset", m_measOffset);
+  result.add("measCov", m_measCov);
+  result.add("measCovOffset", m_measCovOffset);
+  result.add("jac", m_jac);
+  result.add("sourceLinks", m_sourceLinks);
+  result.add("projectors", m_projectors);
+  result.add("referenceSurfaces", m_referenceSurfaces);
+  detail::addDynamicFootprint(result, m_dynamic);
+  result.growthEvents = m_growthEvents;
+  return result;
+}
+
+auto detail_vmt::VectorMultiTrajectoryBase::appendColumns(
+    const VectorMultiTrajectoryBase& other) -> IndexType {
+  assert(&other != this && "Cannot append a trajectory to itself");
+  requireDynamicColumns(other);
+
+  const IndexType stateOffset = m_index.size();
+  const IndexType paramsOffset = m_params.size();
+  const IndexType jacOffset = m_jac.size();
+  const IndexType sourceLinkOffset = m_sourceLinks.size();
+  const IndexType projectorOffset = m_projectors.size();
+  const IndexType measOffset = m_meas.size();
+  const IndexType measCovOffset = m_measCov.size();
+
+  auto shift = [](IndexType index, IndexType offset) {
+    return index == kInvalid ? kInvalid : index + offset;
+  };
+  auto appendShifted = [&](auto& dst, const auto& src, IndexType offset) {
+    dst.reserve(dst.size() + src.size());
+    for (IndexType index : src) {
+      dst.push_back(shift(index, offset));
+    }
+  };
+  auto appendCopy = [](auto& dst, const auto& src) {
+    dst.insert(dst.end(), src.begin(), src.end());
+  };
+
+  m_index.reserve(m_index.size() + other.m_index.size());
+  for (IndexData index : other.m_index) {
+    index.ipredicted = shift(index.ipredicted, paramsOffset);
+    index.ifiltered = shift(index.ifiltered, paramsOffset);
+    index.ismoothed = shift(index.ismoothed, paramsOffset);
+    index.ijacobian = shift(index.ijacobian, jacOffset);
+    index.iprojector = shift(index.iprojector, projectorOffset);
+    index.iuncalibrated = shift(index.iuncalibrated, sourceLinkOffset);
+    index.icalibratedsourcelink =
+        shift(index.icalibratedsourcelink, sourceLinkOffset);
+    m_index.push_back(index);
+  }
+  appendShifted(m_previous, other.m_previous, stateOffset);
+  appendShifted(m_next, other.m_next, stateOffset);
+  appendShifted(m_measOffset, other.m_measOffset, measOffset);
+  appendShifted(m_measCovOffset, other.m_measCovOffset, measCovOffset);
+
+  appendCopy(m_params, other.m_params);
+  appendCopy(m_cov, other.m_cov);
+  appendCopy(m_meas, other.m_meas);
+  appendCopy(m_measCov, other.m_measCov);
+  appendCopy(m_jac, other.m_jac);
+  appendCopy(m_sourceLinks, other.m_sourceLinks);
+  appendCopy(m_projectors, other.m_projectors);
+  appendCopy(m_referenceSurfaces, other.m_referenceSurfaces);
+
+  for (auto& [key, col] : m_dynamic) {
+    if (auto it = other.m_dynamic.find(key); it != other.m_dynamic.end()) {
+      col->append(*it->second);
+    } else {
+      for (std::size_t i = 0; i < other.m_index.size(); ++i) {
+        col->add();
+      }
+    }
+  }
+
+  return stateOffset;
+}
+
+auto detail_vmt::VectorMultiTrajectoryBase::appendColumns(
+    const VectorMultiTrajectoryBase& other,
+    const std::vector<IndexType>& istates) -> std::vector<IndexType> {
+  assert(&other != this && "Cannot append a trajectory to itself");
+  requireDynamicColumns(other);
+
+  std::vector<IndexType> stateMap(other.m_index.size(), kInvalid);
+  for (std::size_t i = 0; i < istates.size(); ++i) {
+    stateMap.at(istates[i]) = m_index.size() + i;
+  }
+
+  // components can be shared between track states, the maps make sure each
+  // of them is only copied once
+  std::vector<IndexType> paramsMap(other.m_params.size(), kInvalid);
+  std::vector<IndexType> jacMap(other.m_jac.size(), kInvalid);
+  std::vector<IndexType> sourceLinkMap(other.m_sourceLinks.size(), kInvalid);
+  std::vector<IndexType> projectorMap(other.m_projectors.size(), kInvalid);
+  std::vector<IndexType> measMap(other.m_meas.size(), kInvalid);
+  std::vector<IndexType> measCovMap(other.m_measCov.size(), kInvalid);
+
+  auto gather = [](IndexType index, std::vector<IndexType>& map, auto& dst,
+                   const auto& src) {
+    if (index == kInvalid) {
+      return kInvalid;
+    }
+    if (map[index] == kInvalid) {
+      map[index] = dst.size();
+      dst.push_back(src[index]);
+    }
+    return map[index];
+  };
+  auto gatherParams = [&](IndexType index) {
+    if (index != kInvalid && paramsMap[index] == kInvalid) {
+      m_cov.push_back(other.m_cov[index]);
+    }
+    return gather(index, paramsMap, m_params, other.m_params);
+  };
+  auto gatherBlock = [](IndexType offset, std::size_t size,
+                        std::vector<IndexType>& map, auto& dst,
+                        const auto& src) {
+    if (offset == kInvalid) {
+      return kInvalid;
+    }
+    if (map[offset] == kInvalid) {
+      map[offset] = dst.size();
+      dst.insert(dst.end(), src.begin() + offset,
+                 src.begin() + offset + size);
+    }
+    return map[offset];
+  };
+  auto remapState = [&](IndexType istate) {
+    return istate == kInvalid ? kInvalid : stateMap[istate];
+  };
+
+  m_index.reserve(m_index.size() + istates.size());
+  m_previous.reserve(m_previous.size() + istates.size());
+  m_next.reserve(m_next.size() + istates.size());
+  m_measOffset.reserve(m_measOffset.size() + istates.size());
+  m_measCovOffset.reserve(m_measCovOffset.size() + istates.size());
+  m_referenceSurfaces.reserve(m_referenceSurfaces.size() + istates.size());
+
+  for (IndexType istate : istates) {
+    IndexData index = other.m_index[istate];
+    index.ipredicted = gatherParams(index.ipredicted);
+    index.ifiltered = gatherParams(index.ifiltered);
+    index.ismoothed = gatherParams(index.ismoothed);
+    index.ijacobian = gather(index.ijacobian, jacMap, m_jac, other.m_jac);
+    index.iprojector = gather(index.iprojector, projectorMap, m_projectors,
+                              other.m_projectors);
+    index.iuncalibrated = gather(index.iuncalibrated, sourceLinkMap,
+                                 m_sourceLinks, other.m_sourceLinks);
+    index.icalibratedsourcelink =
+        gather(index.icalibratedsourcelink, sourceLinkMap, m_sourceLinks,
+               other.m_sourceLinks);
+    m_index.push_back(index);
+
+    m_previous.push_back(remapState(other.m_previous[istate]));
+    m_next.push_back(remapState(other.m_next[istate]));
+
+    const std::size_t measdim = index.measdim == kInvalid ? 0 : index.measdim;
+    m_measOffset.push_back(gatherBlock(other.m_measOffset[istate], measdim,
+                                       measMap, m_meas, other.m_meas));
+    m_measCovOffset.push_back(gatherBlock(other.m_measCovOffset[istate],
+                                          measdim * measdim, measCovMap,
+                                          m_measCov, other.m_measCov));
+
+    m_referenceSurfaces.push_back(other.m_referenceSurfaces[istate]);
+  }
+
+  for (auto& [key, col] : m_dynamic) {
+    if (auto it = other.m_dynamic.find(key); it != other.m_dynamic.end()) {
+      col->append(*it->second, istates);
+    } else {
+      for (std::size_t i = 0; i < istates.size(); ++i) {
+        col->add();
+      }
+    }
+  }
+
+  return stateMap;
+}
+
+void detail_vmt::VectorMultiTrajectoryBase::requireDynamicColumns(
+    const VectorMultiTrajectoryBase& other) const {
+  for (const auto& [key, col] : other.m_dynamic) {
+    if (m_dynamic.find(key) == m_dynamic.end()) {
+      throw std::invalid_argument{
+          "Destination trajectory does not have matching dynamic column"};
+    }
+  }
 }
 
 void detail_vmt::VectorMultiTrajectoryBase::Statistics::toStream(
@@ -294,6 +510,15 @@ void VectorMultiTrajectory::reserve(std::size_t n) {
   }
 }
 
+void VectorMultiTrajectory::dropJacobians() {
+  for (IndexData& index : m_index) {
+    index.ijacobian = kInvalid;
+    index.allocMask &= ~TrackStatePropMask::Jacobian;
+  }
+  m_jac.clear();
+  m_jac.shrink_to_fit();
+}
+
 void VectorMultiTrajectory::copyDynamicFrom_impl(IndexType dstIdx,
                                                  HashedString key,
                                                  const std::any& srcPtr) {
@@ -9,9 +9,11 @@
 #include "Acts/EventData/VectorTrackContainer.hpp"
 
 #include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/HashedString.hpp"
 
 #include <iterator>
+#include <stdexcept>
 
 namespace Acts {
 
@@ -25,6 +27,7 @@ VectorTrackContainerBase::VectorTrackContainerBase(
       m_params{other.m_params},
       m_cov{other.m_cov},
       m_referenceSurfaces{other.m_referenceSurfaces},
+      m_nonOwningDetectorSurfaces{other.m_nonOwningDetectorSurfaces},
       m_nMeasurements{other.m_nMeasurements},
       m_nHoles{other.m_nHoles},
       m_chi2{other.m_chi2},
@@ -37,11 +40,33 @@ VectorTrackContainerBase::VectorTrackContainerBase(
   m_dynamicKeys = other.m_dynamicKeys;
   assert(checkConsistency());
 }
+
+ContainerFootprint VectorTrackContainerBase::footprint() const {
+  ContainerFootprint result;
+  result.add("tipIndex", m_tipIndex);
+  result.add("stemIndex", m_stemIndex);
+  result.add("particleHypothesis", m_particleHypothesis);
+  result.add("params", m_params);
+  result.add("cov", m_cov);
+  result.add("referenceSurfaces", m_referenceSurfaces);
+  result.add("nMeasurements", m_nMeasurements);
+  result.add("nHoles", m_nHoles);
+  result.add("chi2", m_chi2);
+  result.add("ndf", m_ndf);
+  result.add("nOutliers", m_nOutliers);
+  result.add("nSharedHits", m_nSharedHits);
+  detail::addDynamicFootprint(result, m_dynamic);
+  result.growthEvents = m_growthEvents;
+  return result;
+}
 }  // namespace detail_vtc
 
 VectorTrackContainer::IndexType VectorTrackContainer::addTrack_impl() {
   assert(checkConsistency());
 
+  if (m_tipIndex.size() == m_tipIndex.capacity()) {
+    ++m_growthEvents;
+  }
   m_tipIndex.emplace_back(kInvalid);
   m_stemIndex.emplace_back(kInvalid);
 
@@ -119,6 +144,134 @@ void VectorTrackContainer::ensureDynamicColumns_impl(
   }
 }
 
+void VectorTrackContainer::setReferenceSurface_impl(
+    IndexType itrack, std::shared_ptr<const Surface> surface) {
+  if (m_nonOwningDetectorSurfaces && surface != nullptr &&
+      surface->associatedDetectorElement() != nullptr) {
+    // aliasing an empty owner, copies of it are not reference counted
+    const Surface* detectorSurface = surface.get();
+    surface = std::shared_ptr<const Surface>{std::shared_ptr<const Surface>{},
+                                             detectorSurface};
+  }
+  m_referenceSurfaces[itrack] = std::move(surface);
+}
+
+auto VectorTrackContainer::append(
+    const detail_vtc::VectorTrackContainerBase& other, IndexType stateOffset)
+    -> IndexType {
+  assert(&other != this && "Cannot append a container to itself");
+  requireDynamicColumns(other);
+
+  const IndexType trackOffset = m_tipIndex.size();
+
+  auto appendShifted = [&](auto& dst, const auto& src) {
+    dst.reserve(dst.size() + src.size());
+    for (IndexType index : src) {
+      dst.push_back(index == kInvalid ? kInvalid : index + stateOffset);
+    }
+  };
+  auto appendCopy = [](auto& dst, const auto& src) {
+    dst.insert(dst.end(), src.begin(), src.end());
+  };
+
+  appendShifted(m_tipIndex, other.m_tipIndex);
+  appendShifted(m_stemIndex, other.m_stemIndex);
+
+  appendCopy(m_particleHypothesis, other.m_particleHypothesis);
+  appendCopy(m_params, other.m_params);
+  appendCopy(m_cov, other.m_cov);
+  appendCopy(m_referenceSurfaces, other.m_referenceSurfaces);
+
+  appendCopy(m_nMeasurements, other.m_nMeasurements);
+  appendCopy(m_nHoles, other.m_nHoles);
+
+  appendCopy(m_chi2, other.m_chi2);
+  appendCopy(m_ndf, other.m_ndf);
+
+  appendCopy(m_nOutliers, other.m_nOutliers);
+  appendCopy(m_nSharedHits, other.m_nSharedHits);
+
+  for (auto& [key, col] : m_dynamic) {
+    if (auto it = other.m_dynamic.find(key); it != other.m_dynamic.end()) {
+      col->append(*it->second);
+    } else {
+      for (std::size_t i = 0; i < other.m_tipIndex.size(); ++i) {
+        col->add();
+      }
+    }
+  }
+
+  assert(checkConsistency());
+  return trackOffset;
+}
+
+auto VectorTrackContainer::append(
+    const detail_vtc::VectorTrackContainerBase& other,
+    const std::vector<IndexType>& itracks,
+    const std::vector<IndexType>& stateMap) -> IndexType {
+  assert(&other != this && "Cannot append a container to itself");
+  requireDynamicColumns(other);
+
+  const IndexType trackOffset = m_tipIndex.size();
+
+  auto appendState = [&](auto& dst, const auto& src) {
+    dst.reserve(dst.size() + itracks.size());
+    for (IndexType itrack : itracks) {
+      IndexType istate = src.at(itrack);
+      if (!stateMap.empty() && istate != kInvalid) {
+        istate = stateMap.at(istate);
+      }
+      dst.push_back(istate);
+    }
+  };
+  auto gather = [&](auto& dst, const auto& src) {
+    dst.reserve(dst.size() + itracks.size());
+    for (IndexType itrack : itracks) {
+      dst.push_back(src.at(itrack));
+    }
+  };
+
+  appendState(m_tipIndex, other.m_tipIndex);
+  appendState(m_stemIndex, other.m_stemIndex);
+
+  gather(m_particleHypothesis, other.m_particleHypothesis);
+  gather(m_params, other.m_params);
+  gather(m_cov, other.m_cov);
+  gather(m_referenceSurfaces, other.m_referenceSurfaces);
+
+  gather(m_nMeasurements, other.m_nMeasurements);
+  gather(m_nHoles, other.m_nHoles);
+
+  gather(m_chi2, other.m_chi2);
+  gather(m_ndf, other.m_ndf);
+
+  gather(m_nOutliers, other.m_nOutliers);
+  gather(m_nSharedHits, other.m_nSharedHits);
+
+  for (auto& [key, col] : m_dynamic) {
+    if (auto it = other.m_dynamic.find(key); it != other.m_dynamic.end()) {
+      col->append(*it->second, itracks);
+    } else {
+      for (std::size_t i = 0; i < itracks.size(); ++i) {
+        col->add();
+      }
+    }
+  }
+
+  assert(checkConsistency());
+  return trackOffset;
+}
+
+void VectorTrackContainer::requireDynamicColumns(
+    const detail_vtc::VectorTrackContainerBase& other) const {
+  for (const auto& [key, col] : other.m_dynamic) {
+    if (m_dynamic.find(key) == m_dynamic.end()) {
+      throw std::invalid_argument{
+          "Destination container does not have matching dynamic column"};
+    }
+  }
+}
+
 void VectorTrackContainer::reserve(IndexType size) {
   m_tipIndex.reserve(size);
   m_stemIndex.reserve(size);
@@ -163,6 +316,7 @@ void VectorTrackContainer::clear() {
   for (auto& [key, vec] : m_dynamic) {
     vec->clear();
   }
+  m_growthEvents = 0;
 }
 
 }  // namespace Acts
@@ -26,6 +26,7 @@
 #include "Acts/Surfaces/SurfaceBounds.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <algorithm>
 #include <iterator>
@@ -79,7 +80,20 @@ Acts::CylinderVolumeBuilder::trackingVolume(
   WrappingConfig wConfig;
 
   // the layers are built by the layer builder
-  if (m_cfg.layerBuilder) {
+  if (m_cfg.layerBuilder && m_cfg.buildLayersConcurrently) {
+    // the layer sets are independent and the geometry identifiers are only
+    // assigned when the geometry is closed, so the result does not depend on
+    // the order in which they are built
+    parallelFor(3, [&](std::size_t side) {
+      if (side == 0) {
+        negativeLayers = m_cfg.layerBuilder->negativeLayers(gctx);
+      } else if (side == 1) {
+        centralLayers = m_cfg.layerBuilder->centralLayers(gctx);
+      } else {
+        positiveLayers = m_cfg.layerBuilder->positiveLayers(gctx);
+      }
+    });
+  } else if (m_cfg.layerBuilder) {
     // the negative Layers
     negativeLayers = m_cfg.layerBuilder->negativeLayers(gctx);
     // the central Layers
@@ -0,0 +1,135 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/FlatTrackingGeometry.hpp"
+
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Utilities/BinnedArray.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+/// The identifier of the volume an object belongs to
+Acts::GeometryIdentifier volumeKey(Acts::GeometryIdentifier id) {
+  return Acts::GeometryIdentifier().setVolume(id.volume());
+}
+
+/// The identifier of the layer an object belongs to
+Acts::GeometryIdentifier layerKey(Acts::GeometryIdentifier id) {
+  return volumeKey(id).setBoundary(id.boundary()).setLayer(id.layer());
+}
+
+template <typename entry_t>
+const entry_t* findEntry(const std::vector<entry_t>& entries,
+                         Acts::GeometryIdentifier id) {
+  auto it = std::lower_bound(
+      entries.begin(), entries.end(), id,
+      [](const entry_t& entry, Acts::GeometryIdentifier value) {
+        return entry.geometryId < value;
+      });
+  if (it == entries.end() || it->geometryId != id) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+/// The range of entries with the same key as the given identifier, the key
+/// has to preserve the ordering of the identifiers
+template <typename entry_t, typename key_t>
+Acts::FlatTrackingGeometry::IndexRange keyRange(
+    const std::vector<entry_t>& entries, Acts::GeometryIdentifier id,
+    key_t key) {
+  const Acts::GeometryIdentifier prefix = key(id);
+  auto begin = std::lower_bound(
+      entries.begin(), entries.end(), prefix,
+      [&key](const entry_t& entry, Acts::GeometryIdentifier value) {
+        return key(entry.geometryId) < value;
+      });
+  auto end = std::upper_bound(
+      begin, entries.end(), prefix,
+      [&key](Acts::GeometryIdentifier value, const entry_t& entry) {
+        return value < key(entry.geometryId);
+      });
+  return {static_cast<std::size_t>(std::distance(entries.begin(), begin)),
+          static_cast<std::size_t>(std::distance(entries.begin(), end))};
+}
+
+template <typename entry_t>
+void sortEntries(std::vector<entry_t>& entries) {
+  std::sort(entries.begin(), entries.end(),
+            [](const entry_t& lhs, const entry_t& rhs) {
+              return lhs.geometryId < rhs.geometryId;
+            });
+}
+
+}  // namespace
+
+Acts::FlatTrackingGeometry::FlatTrackingGeometry(
+    const GeometryContext& gctx, const TrackingGeometry& trackingGeometry) {
+  trackingGeometry.visitVolumes([this](const TrackingVolume* volume) {
+    m_volumes.push_back({volume->geometryId(), volume, {}, {}});
+    if (volume->confinedLayers() == nullptr) {
+      return;
+    }
+    for (const auto& layer : volume->confinedLayers()->arrayObjects()) {
+      m_layers.push_back({layer->geometryId(), layer.get(), {}});
+    }
+  });
+
+  trackingGeometry.visitSurfaces(
+      [this](const Surface* surface) {
+        if (surface != nullptr) {
+          m_surfaces.push_back({surface->geometryId(), surface,
+                                surface->type(), &surface->bounds()});
+        }
+      },
+      false);
+
+  sortEntries(m_volumes);
+  sortEntries(m_layers);
+  sortEntries(m_surfaces);
+  // boundary surfaces shared between volumes are visited more than once
+  m_surfaces.erase(std::unique(m_surfaces.begin(), m_surfaces.end(),
+                               [](const SurfaceEntry& lhs,
+                                  const SurfaceEntry& rhs) {
+                                 return lhs.surface == rhs.surface;
+                               }),
+                   m_surfaces.end());
+
+  for (auto& volume : m_volumes) {
+    volume.layers = keyRange(m_layers, volume.geometryId, volumeKey);
+    volume.surfaces = keyRange(m_surfaces, volume.geometryId, volumeKey);
+  }
+  for (auto& layer : m_layers) {
+    layer.surfaces = keyRange(m_surfaces, layer.geometryId, layerKey);
+  }
+
+  m_transforms.reserve(m_surfaces.size());
+  for (const auto& surface : m_surfaces) {
+    m_transforms.push_back(surface.surface->transform(gctx));
+  }
+}
+
+const Acts::FlatTrackingGeometry::VolumeEntry*
+Acts::FlatTrackingGeometry::findVolume(GeometryIdentifier id) const {
+  return findEntry(m_volumes, id);
+}
+
+const Acts::FlatTrackingGeometry::LayerEntry*
+Acts::FlatTrackingGeometry::findLayer(GeometryIdentifier id) const {
+  return findEntry(m_layers, id);
+}
+
+const Acts::FlatTrackingGeometry::SurfaceEntry*
+Acts::FlatTrackingGeometry::findSurface(GeometryIdentifier id) const {
+  return findEntry(m_surfaces, id);
+}
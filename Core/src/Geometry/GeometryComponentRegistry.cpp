@@ -0,0 +1,52 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/GeometryComponentRegistry.hpp"
+
+#include "Acts/Material/Material.hpp"
+
+std::shared_ptr<const Acts::SurfaceBounds>
+Acts::GeometryComponentRegistry::shareBounds(
+    std::type_index type, std::shared_ptr<const SurfaceBounds> bounds) {
+  std::vector<double> values = bounds->values();
+  std::scoped_lock lock(m_mutex);
+  auto [it, inserted] =
+      m_bounds.try_emplace({type, std::move(values)}, std::move(bounds));
+  return it->second;
+}
+
+std::shared_ptr<const Acts::HomogeneousSurfaceMaterial>
+Acts::GeometryComponentRegistry::makeHomogeneousMaterial(
+    const MaterialSlab& slab, double splitFactor) {
+  // The key holds the material parameters, the thickness and the split
+  const Material::ParametersVector parameters = slab.material().parameters();
+  std::vector<double> key(parameters.data(),
+                          parameters.data() + parameters.size());
+  key.push_back(slab.thickness());
+  key.push_back(splitFactor);
+  std::scoped_lock lock(m_mutex);
+  auto it = m_materials.find(key);
+  if (it == m_materials.end()) {
+    it = m_materials
+             .emplace(std::move(key),
+                      std::make_shared<const HomogeneousSurfaceMaterial>(
+                          slab, splitFactor))
+             .first;
+  }
+  return it->second;
+}
+
+std::size_t Acts::GeometryComponentRegistry::numberOfBounds() const {
+  std::scoped_lock lock(m_mutex);
+  return m_bounds.size();
+}
+
+std::size_t Acts::GeometryComponentRegistry::numberOfMaterials() const {
+  std::scoped_lock lock(m_mutex);
+  return m_materials.size();
+}
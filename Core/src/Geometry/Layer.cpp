@@ -13,6 +13,7 @@
 #include "Acts/Material/IMaterialDecorator.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
 
 #include <algorithm>
 #include <functional>
@@ -187,7 +188,8 @@ Acts::Layer::compatibleSurfaces(
       return;
     }
     bool boundaryCheck = options.boundaryCheck.isEnabled();
-    if (std::find(options.externalSurfaces.begin(),
+    if (!options.externalSurfaces.empty() &&
+        std::find(options.externalSurfaces.begin(),
                   options.externalSurfaces.end(),
                   sf.geometryId()) != options.externalSurfaces.end()) {
       boundaryCheck = false;
@@ -227,8 +229,10 @@ Acts::Layer::compatibleSurfaces(
   if (m_surfaceArray && (options.resolveMaterial || options.resolvePassive ||
                          options.resolveSensitive)) {
     // get the candidates
-    const std::vector<const Surface*>& sensitiveSurfaces =
-        m_surfaceArray->neighbors(position);
+    const SurfaceSpan sensitiveSurfaces = m_surfaceArray->neighbors(position);
+    // avoid growing beyond the inline capacity more than once in dense layers
+    sIntersections.reserve(sIntersections.size() + sensitiveSurfaces.size() +
+                           1);
     // loop through and veto
     // - if the approach surface is the parameter surface
     // - if the surface is not compatible with the type(s) that are collected
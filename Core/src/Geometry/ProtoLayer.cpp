@@ -89,7 +89,8 @@ void ProtoLayer::measure(const GeometryContext& gctx,
 
 void ProtoLayer::add(const GeometryContext& gctx, const Surface& surface) {
   m_surfaces.push_back(&surface);
-  measure(gctx, m_surfaces);
+  // the extent of the other surfaces is already included
+  measure(gctx, {&surface});
 }
 
 }  // namespace Acts
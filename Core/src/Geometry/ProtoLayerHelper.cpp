@@ -9,19 +9,19 @@
 #include "Acts/Geometry/ProtoLayerHelper.hpp"
 
 #include "Acts/Geometry/Extent.hpp"
-#include "Acts/Geometry/Polyhedron.hpp"
 #include "Acts/Geometry/ProtoLayer.hpp"
+#include "Acts/Geometry/SurfaceExtentCache.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
 #include <array>
 #include <ostream>
 #include <string>
+#include <utility>
 
-std::vector<Acts::ProtoLayer> Acts::ProtoLayerHelper::protoLayers(
+std::vector<std::vector<const Acts::Surface*>>
+Acts::ProtoLayerHelper::clusters(
     const GeometryContext& gctx, const std::vector<const Surface*>& surfaces,
-    const SortingConfig& sorting) const {
-  std::vector<Acts::ProtoLayer> protoLayers;
-
+    const SortingConfig& sorting, SurfaceExtentCache& extents) const {
   using SurfaceCluster = std::pair<Extent, std::vector<const Surface*>>;
   std::vector<SurfaceCluster> clusteredSurfaces;
   /// Helper function to find/create the cluster of surfaces where
@@ -43,18 +43,33 @@ std::vector<Acts::ProtoLayer> Acts::ProtoLayerHelper::protoLayers(
 
   // Loop over surfaces and sort into clusters
   for (auto& sf : surfaces) {
-    auto sfExtent = sf->polyhedronRepresentation(gctx, 1).extent();
+    Extent sfExtent = extents.extent(gctx, *sf);
     sfExtent.envelope()[sorting.first] = {sorting.second, sorting.second};
     auto& sfCluster = findCluster(sfExtent);
     sfCluster.first.extend(sfExtent);
     sfCluster.second.push_back(sf);
   }
+
+  std::vector<std::vector<const Surface*>> clusteredSurfaceVectors;
+  clusteredSurfaceVectors.reserve(clusteredSurfaces.size());
+  for (auto& cluster : clusteredSurfaces) {
+    clusteredSurfaceVectors.push_back(std::move(cluster.second));
+  }
+  return clusteredSurfaceVectors;
+}
+
+std::vector<Acts::ProtoLayer> Acts::ProtoLayerHelper::protoLayers(
+    const GeometryContext& gctx, const std::vector<const Surface*>& surfaces,
+    const SortingConfig& sorting) const {
+  SurfaceExtentCache extents;
+  extents.fill(gctx, surfaces);
+
+  std::vector<Acts::ProtoLayer> protoLayers;
   // Loop over clusters and create ProtoLayer
-  protoLayers.reserve(clusteredSurfaces.size());
-  for (auto& clusters : clusteredSurfaces) {
-    ACTS_VERBOSE("Creating ProtoLayer with " << clusters.second.size()
+  for (auto& cluster : clusters(gctx, surfaces, sorting, extents)) {
+    ACTS_VERBOSE("Creating ProtoLayer with " << cluster.size()
                                              << " surfaces.");
-    protoLayers.push_back(ProtoLayer(gctx, clusters.second));
+    protoLayers.push_back(ProtoLayer(gctx, cluster));
   }
   return protoLayers;
 }
@@ -63,6 +78,11 @@ std::vector<Acts::ProtoLayer> Acts::ProtoLayerHelper::protoLayers(
     const GeometryContext& gctx, const std::vector<const Surface*>& surfaces,
     const std::vector<SortingConfig>& sortings) const {
   ACTS_DEBUG("Received " << surfaces.size() << " surfaces at input.");
+  // Every sorting step needs the extents of all surfaces, they are only
+  // computed once and the proto layers are only built at the end
+  SurfaceExtentCache extents;
+  extents.fill(gctx, surfaces);
+
   std::vector<std::vector<const Surface*>> sortSurfaces = {surfaces};
   for (const auto& sorting : sortings) {
     ACTS_VERBOSE("-> Sorting a set of " << sortSurfaces.size() << " in "
@@ -70,12 +90,12 @@ std::vector<Acts::ProtoLayer> Acts::ProtoLayerHelper::protoLayers(
     std::vector<std::vector<const Surface*>> subSurfaces;
     for (const auto& ssurfaces : sortSurfaces) {
       ACTS_VERBOSE("-> Surfaces for this sorting step: " << ssurfaces.size());
-      auto pLayers = protoLayers(gctx, ssurfaces, sorting);
-      ACTS_VERBOSE("-> Resulted in " << pLayers.size() << " ProtoLayers.");
-      for (const auto& pLayer : pLayers) {
-        ACTS_VERBOSE("--> ProtoLayer contains " << pLayer.surfaces().size()
+      auto sClusters = clusters(gctx, ssurfaces, sorting, extents);
+      ACTS_VERBOSE("-> Resulted in " << sClusters.size() << " ProtoLayers.");
+      for (auto& cluster : sClusters) {
+        ACTS_VERBOSE("--> ProtoLayer contains " << cluster.size()
                                                 << " surfaces.");
-        subSurfaces.push_back(pLayer.surfaces());
+        subSurfaces.push_back(std::move(cluster));
       }
     }
     sortSurfaces = subSurfaces;
@@ -0,0 +1,75 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/SurfaceExtentCache.hpp"
+
+#include "Acts/Geometry/Polyhedron.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace Acts {
+
+Extent SurfaceExtentCache::compute(const GeometryContext& gctx,
+                                   const Surface& surface) {
+  return surface.polyhedronRepresentation(gctx, 1).extent();
+}
+
+const Extent& SurfaceExtentCache::extent(const GeometryContext& gctx,
+                                         const Surface& surface) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (auto it = m_extents.find(&surface); it != m_extents.end()) {
+      return it->second;
+    }
+  }
+  // Do not block the other threads while tessellating, a concurrent
+  // computation of the same surface keeps the first result
+  Extent sExtent = compute(gctx, surface);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_extents.try_emplace(&surface, std::move(sExtent)).first->second;
+}
+
+void SurfaceExtentCache::fill(const GeometryContext& gctx,
+                              const std::vector<const Surface*>& surfaces) {
+  std::vector<const Surface*> missing;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const Surface* surface : surfaces) {
+      if (m_extents.find(surface) == m_extents.end()) {
+        missing.push_back(surface);
+      }
+    }
+  }
+  std::sort(missing.begin(), missing.end());
+  missing.erase(std::unique(missing.begin(), missing.end()), missing.end());
+
+  std::vector<Extent> extents(missing.size());
+  parallelFor(missing.size(), [&](std::size_t is) {
+    extents[is] = compute(gctx, *missing[is]);
+  });
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (std::size_t is = 0; is < missing.size(); ++is) {
+    m_extents.try_emplace(missing[is], std::move(extents[is]));
+  }
+}
+
+std::size_t SurfaceExtentCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_extents.size();
+}
+
+void SurfaceExtentCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_extents.clear();
+}
+
+}  // namespace Acts
@@ -9,6 +9,7 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/Layer.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
@@ -16,6 +17,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
+#include <unordered_map>
 #include <vector>
 
 Acts::TrackingGeometry::TrackingGeometry(
@@ -36,6 +39,17 @@ Acts::TrackingGeometry::TrackingGeometry(
     }
   });
   m_surfacesById.rehash(0);
+  // dense lookup tables, the volume identifiers are consecutive
+  for (const auto& [id, volume] : m_volumesById) {
+    if (id == GeometryIdentifier().setVolume(id.volume())) {
+      if (m_volumesByIndex.size() <= id.volume()) {
+        m_volumesByIndex.resize(id.volume() + 1, nullptr);
+      }
+      m_volumesByIndex[id.volume()] = volume;
+    }
+  }
+  m_surfaceLookup = GeometryHierarchyMap<const Surface*>(
+      {m_surfacesById.begin(), m_surfacesById.end()});
 }
 
 Acts::TrackingGeometry::~TrackingGeometry() = default;
@@ -78,6 +92,11 @@ const Acts::Surface* Acts::TrackingGeometry::getBeamline() const {
 
 const Acts::TrackingVolume* Acts::TrackingGeometry::findVolume(
     GeometryIdentifier id) const {
+  if (id == GeometryIdentifier().setVolume(id.volume())) {
+    return id.volume() < m_volumesByIndex.size()
+               ? m_volumesByIndex[id.volume()]
+               : nullptr;
+  }
   auto vol = m_volumesById.find(id);
   if (vol == m_volumesById.end()) {
     return nullptr;
@@ -87,6 +106,16 @@ const Acts::TrackingVolume* Acts::TrackingGeometry::findVolume(
 
 const Acts::Surface* Acts::TrackingGeometry::findSurface(
     GeometryIdentifier id) const {
+  if (m_surfaceLookup.hasDirectLookup()) {
+    auto srf = m_surfaceLookup.find(id);
+    // the lookup falls back to higher levels, only an exact match counts
+    if (srf == m_surfaceLookup.end() ||
+        m_surfaceLookup.idAt(std::distance(m_surfaceLookup.begin(), srf)) !=
+            id) {
+      return nullptr;
+    }
+    return *srf;
+  }
   auto srf = m_surfacesById.find(id);
   if (srf == m_surfacesById.end()) {
     return nullptr;
@@ -98,3 +127,23 @@ const std::unordered_map<Acts::GeometryIdentifier, const Acts::Surface*>&
 Acts::TrackingGeometry::geoIdSurfaceMap() const {
   return m_surfacesById;
 }
+
+std::size_t Acts::TrackingGeometry::updateMovedSurfaces(
+    const GeometryContext& gctx, const std::vector<const Surface*>& surfaces) {
+  // group the surfaces by the layer, i.e. surface array, they belong to
+  std::unordered_map<const Layer*, SurfaceVector> movedByLayer;
+  for (const Surface* srf : surfaces) {
+    if (srf != nullptr && srf->associatedLayer() != nullptr) {
+      movedByLayer[srf->associatedLayer()].push_back(srf);
+    }
+  }
+  std::size_t nChanged = 0;
+  for (const auto& [layer, moved] : movedByLayer) {
+    // the layers are owned by this geometry
+    SurfaceArray* surfaceArray = const_cast<Layer*>(layer)->surfaceArray();
+    if (surfaceArray != nullptr) {
+      nChanged += surfaceArray->update(gctx, moved);
+    }
+  }
+  return nChanged;
+}
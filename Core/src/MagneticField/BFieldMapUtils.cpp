@@ -27,6 +27,47 @@
 using Acts::VectorHelpers::perp;
 using Acts::VectorHelpers::phi;
 
+namespace {
+
+/// Sort the grid point values and build the axis, with one additional bin
+/// as the bin values correspond to the left boundary. A mirrored axis also
+/// covers the negative of the given values.
+Acts::detail::EquidistantAxis makeAxis(std::vector<double>& pos,
+                                       double lengthUnit,
+                                       bool mirrored = false) {
+  std::sort(pos.begin(), pos.end());
+  pos.erase(std::unique(pos.begin(), pos.end()), pos.end());
+  pos.shrink_to_fit();
+  std::size_t nBins = pos.size();
+  // We just sorted the vector, so these are the first and last elements
+  double min = pos[0];
+  double max = pos[nBins - 1];
+  const double step = std::fabs(max - min) / (nBins - 1);
+  if (mirrored) {
+    min = -max;
+    nBins = 2 * nBins - 1;
+  }
+  max += step;
+  return Acts::detail::EquidistantAxis(min * lengthUnit, max * lengthUnit,
+                                       nBins);
+}
+
+/// Map the field (Br,Bz) at a position to (Bx,By,Bz)
+template <typename field_t>
+Acts::Vector3 fieldRZToXYZ(const field_t& field, const Acts::Vector3& pos) {
+  double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+  double cos_phi = 1., sin_phi = 0.;
+  if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+    double inv_r_sin_theta = 1. / std::sqrt(r_sin_theta_2);
+    cos_phi = pos.x() * inv_r_sin_theta;
+    sin_phi = pos.y() * inv_r_sin_theta;
+  }
+  double br = field.x();
+  return Acts::Vector3(br * cos_phi, br * sin_phi, field.y());
+}
+
+}  // namespace
+
 Acts::InterpolatedBFieldMap<
     Acts::Grid<Acts::Vector2, Acts::detail::EquidistantAxis,
                Acts::detail::EquidistantAxis>>
@@ -38,45 +79,12 @@ Acts::fieldMapRZ(
     std::vector<Acts::Vector2> bField, double lengthUnit, double BFieldUnit,
     bool firstQuadrant) {
   // [1] Create Grid
-  // sort the values
-  std::sort(rPos.begin(), rPos.end());
-  std::sort(zPos.begin(), zPos.end());
-  // Get unique values
-  rPos.erase(std::unique(rPos.begin(), rPos.end()), rPos.end());
-  zPos.erase(std::unique(zPos.begin(), zPos.end()), zPos.end());
-  rPos.shrink_to_fit();
-  zPos.shrink_to_fit();
-  // get the number of bins
-  std::size_t nBinsR = rPos.size();
-  std::size_t nBinsZ = zPos.size();
-
-  // get the minimum and maximum. We just sorted the vectors, so these are just
-  // the first and last elements.
-  double rMin = rPos[0];
-  double zMin = zPos[0];
-  double rMax = rPos[nBinsR - 1];
-  double zMax = zPos[nBinsZ - 1];
-  // calculate maxima (add one last bin, because bin value always corresponds to
-  // left boundary)
-  double stepZ = std::fabs(zMax - zMin) / (nBinsZ - 1);
-  double stepR = std::fabs(rMax - rMin) / (nBinsR - 1);
-  rMax += stepR;
-  zMax += stepZ;
-  if (firstQuadrant) {
-    zMin = -zPos[nBinsZ - 1];
-    nBinsZ = static_cast<std::size_t>(2. * nBinsZ - 1);
-  }
-
-  // Create the axis for the grid
-  Acts::detail::EquidistantAxis rAxis(rMin * lengthUnit, rMax * lengthUnit,
-                                      nBinsR);
-  Acts::detail::EquidistantAxis zAxis(zMin * lengthUnit, zMax * lengthUnit,
-                                      nBinsZ);
-
-  // Create the grid
   using Grid_t = Acts::Grid<Acts::Vector2, Acts::detail::EquidistantAxis,
                             Acts::detail::EquidistantAxis>;
-  Grid_t grid(std::make_tuple(std::move(rAxis), std::move(zAxis)));
+  Grid_t grid(std::make_tuple(makeAxis(rPos, lengthUnit),
+                              makeAxis(zPos, lengthUnit, firstQuadrant)));
+  std::size_t nBinsR = rPos.size();
+  std::size_t nBinsZ = firstQuadrant ? 2 * zPos.size() - 1 : zPos.size();
 
   // [2] Set the bField values
   for (std::size_t i = 1; i <= nBinsR; ++i) {
@@ -114,20 +122,7 @@ Acts::fieldMapRZ(
 
   // [4] Create the transformation for the bfield
   // map (Br,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Acts::Vector2& field,
-                            const Acts::Vector3& pos) {
-    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
-    double cos_phi = 0, sin_phi = 0;
-    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
-      double inv_r_sin_theta = 1. / sqrt(r_sin_theta_2);
-      cos_phi = pos.x() * inv_r_sin_theta;
-      sin_phi = pos.y() * inv_r_sin_theta;
-    } else {
-      cos_phi = 1.;
-      sin_phi = 0.;
-    }
-    return Acts::Vector3(field.x() * cos_phi, field.x() * sin_phi, field.y());
-  };
+  auto transformBField = fieldRZToXYZ<Acts::Vector2>;
 
   // [5] Create the mapper & BField Service
   // create field mapping
@@ -146,62 +141,15 @@ Acts::fieldMapXYZ(
     std::vector<double> zPos, std::vector<Acts::Vector3> bField,
     double lengthUnit, double BFieldUnit, bool firstOctant) {
   // [1] Create Grid
-  // Sort the values
-  std::sort(xPos.begin(), xPos.end());
-  std::sort(yPos.begin(), yPos.end());
-  std::sort(zPos.begin(), zPos.end());
-  // Get unique values
-  xPos.erase(std::unique(xPos.begin(), xPos.end()), xPos.end());
-  yPos.erase(std::unique(yPos.begin(), yPos.end()), yPos.end());
-  zPos.erase(std::unique(zPos.begin(), zPos.end()), zPos.end());
-  xPos.shrink_to_fit();
-  yPos.shrink_to_fit();
-  zPos.shrink_to_fit();
-  // get the number of bins
-  std::size_t nBinsX = xPos.size();
-  std::size_t nBinsY = yPos.size();
-  std::size_t nBinsZ = zPos.size();
-
-  // Create the axis for the grid
-  // get minima and maximia. We just sorted the vectors, so these are just the
-  // first and last elements.
-  double xMin = xPos[0];
-  double yMin = yPos[0];
-  double zMin = zPos[0];
-  // get maxima
-  double xMax = xPos[nBinsX - 1];
-  double yMax = yPos[nBinsY - 1];
-  double zMax = zPos[nBinsZ - 1];
-  // calculate maxima (add one last bin, because bin value always corresponds to
-  // left boundary)
-  double stepZ = std::fabs(zMax - zMin) / (nBinsZ - 1);
-  double stepY = std::fabs(yMax - yMin) / (nBinsY - 1);
-  double stepX = std::fabs(xMax - xMin) / (nBinsX - 1);
-  xMax += stepX;
-  yMax += stepY;
-  zMax += stepZ;
-
-  // If only the first octant is given
-  if (firstOctant) {
-    xMin = -xPos[nBinsX - 1];
-    yMin = -yPos[nBinsY - 1];
-    zMin = -zPos[nBinsZ - 1];
-    nBinsX = 2 * nBinsX - 1;
-    nBinsY = 2 * nBinsY - 1;
-    nBinsZ = 2 * nBinsZ - 1;
-  }
-  Acts::detail::EquidistantAxis xAxis(xMin * lengthUnit, xMax * lengthUnit,
-                                      nBinsX);
-  Acts::detail::EquidistantAxis yAxis(yMin * lengthUnit, yMax * lengthUnit,
-                                      nBinsY);
-  Acts::detail::EquidistantAxis zAxis(zMin * lengthUnit, zMax * lengthUnit,
-                                      nBinsZ);
-  // Create the grid
   using Grid_t =
       Acts::Grid<Acts::Vector3, Acts::detail::EquidistantAxis,
                  Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>;
-  Grid_t grid(
-      std::make_tuple(std::move(xAxis), std::move(yAxis), std::move(zAxis)));
+  Grid_t grid(std::make_tuple(makeAxis(xPos, lengthUnit, firstOctant),
+                              makeAxis(yPos, lengthUnit, firstOctant),
+                              makeAxis(zPos, lengthUnit, firstOctant)));
+  std::size_t nBinsX = firstOctant ? 2 * xPos.size() - 1 : xPos.size();
+  std::size_t nBinsY = firstOctant ? 2 * yPos.size() - 1 : yPos.size();
+  std::size_t nBinsZ = firstOctant ? 2 * zPos.size() - 1 : zPos.size();
 
   // [2] Set the bField values
   for (std::size_t i = 1; i <= nBinsX; ++i) {
@@ -254,6 +202,80 @@ Acts::fieldMapXYZ(
       {transformPos, transformBField, std::move(grid)});
 }
 
+Acts::CompactFieldMapRZ Acts::compactFieldMapRZ(
+    const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
+                                    std::array<std::size_t, 2> nBinsRZ)>&
+        localToGlobalBin,
+    std::vector<double> rPos, std::vector<double> zPos,
+    const std::vector<Acts::Vector2>& bField, double lengthUnit,
+    double BFieldUnit, bool firstQuadrant) {
+  using Grid_t = CompactFieldMapRZ::Grid;
+  Grid_t grid(std::make_tuple(makeAxis(rPos, lengthUnit),
+                              makeAxis(zPos, lengthUnit)));
+
+  std::array<std::size_t, 2> nIndices = {{rPos.size(), zPos.size()}};
+  for (std::size_t i = 1; i <= rPos.size(); ++i) {
+    for (std::size_t j = 1; j <= zPos.size(); ++j) {
+      grid.atLocalBins({{i, j}}) =
+          (bField.at(localToGlobalBin({{i - 1, j - 1}}, nIndices)) *
+           BFieldUnit)
+              .cast<float>();
+    }
+  }
+  grid.setExteriorBins(Grid_t::value_type::Zero());
+
+  // map (x,y,z) -> (r,z), mirrored to positive z for the first quadrant
+  auto transformPos = [firstQuadrant](const Acts::Vector3& pos) {
+    return Acts::Vector2(perp(pos),
+                         firstQuadrant ? std::abs(pos.z()) : pos.z());
+  };
+
+  // map (Br,Bz) -> (Bx,By,Bz)
+  auto transformBField = fieldRZToXYZ<Grid_t::value_type>;
+
+  return CompactFieldMapRZ({transformPos, transformBField, std::move(grid)});
+}
+
+Acts::CompactFieldMapXYZ Acts::compactFieldMapXYZ(
+    const std::function<std::size_t(std::array<std::size_t, 3> binsXYZ,
+                                    std::array<std::size_t, 3> nBinsXYZ)>&
+        localToGlobalBin,
+    std::vector<double> xPos, std::vector<double> yPos,
+    std::vector<double> zPos, const std::vector<Acts::Vector3>& bField,
+    double lengthUnit, double BFieldUnit, bool firstOctant) {
+  using Grid_t = CompactFieldMapXYZ::Grid;
+  Grid_t grid(std::make_tuple(makeAxis(xPos, lengthUnit),
+                              makeAxis(yPos, lengthUnit),
+                              makeAxis(zPos, lengthUnit)));
+
+  std::array<std::size_t, 3> nIndices = {
+      {xPos.size(), yPos.size(), zPos.size()}};
+  for (std::size_t i = 1; i <= xPos.size(); ++i) {
+    for (std::size_t j = 1; j <= yPos.size(); ++j) {
+      for (std::size_t k = 1; k <= zPos.size(); ++k) {
+        grid.atLocalBins({{i, j, k}}) =
+            (bField.at(localToGlobalBin({{i - 1, j - 1, k - 1}}, nIndices)) *
+             BFieldUnit)
+                .cast<float>();
+      }
+    }
+  }
+  grid.setExteriorBins(Grid_t::value_type::Zero());
+
+  // mirror the position into the first octant
+  auto transformPos = [firstOctant](const Acts::Vector3& pos) {
+    return firstOctant ? Acts::Vector3(pos.cwiseAbs()) : pos;
+  };
+
+  // map (Bx,By,Bz) -> (Bx,By,Bz)
+  auto transformBField = [](const Grid_t::value_type& field,
+                            const Acts::Vector3& /*pos*/) {
+    return Acts::Vector3(field.cast<double>());
+  };
+
+  return CompactFieldMapXYZ({transformPos, transformBField, std::move(grid)});
+}
+
 Acts::InterpolatedBFieldMap<
     Acts::Grid<Acts::Vector2, Acts::detail::EquidistantAxis,
                Acts::detail::EquidistantAxis>>
@@ -291,21 +313,7 @@ Acts::solenoidFieldMap(std::pair<double, double> rlim,
 
   // Create the transformation for the bfield
   // map (Br,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Acts::Vector2& bfield,
-                            const Acts::Vector3& pos) {
-    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
-    double cos_phi = 0, sin_phi = 0;
-    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
-      double inv_r_sin_theta = 1. / sqrt(r_sin_theta_2);
-      cos_phi = pos.x() * inv_r_sin_theta;
-      sin_phi = pos.y() * inv_r_sin_theta;
-    } else {
-      cos_phi = 1.;
-      sin_phi = 0.;
-    }
-    return Acts::Vector3(bfield.x() * cos_phi, bfield.x() * sin_phi,
-                         bfield.y());
-  };
+  auto transformBField = fieldRZToXYZ<Acts::Vector2>;
 
   // iterate over all bins, set their value to the solenoid value
   // at their lower left position
@@ -0,0 +1,188 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/MagneticField/MappedFieldMap.hpp"
+
+#include "Acts/Utilities/VectorHelpers.hpp"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace Acts {
+
+namespace {
+
+using namespace detail_mfm;
+
+template <typename grid_t>
+void writeGrid(std::ostream& os, const grid_t& grid) {
+  using Value = typename grid_t::value_type;
+  constexpr std::size_t kDim = grid_t::DIM;
+
+  FileHeader header;
+  header.headerSize = sizeof(FileHeader);
+  header.valueSize = sizeof(Value);
+  header.dimensions = kDim;
+  auto min = grid.minPosition();
+  auto max = grid.maxPosition();
+  auto nBins = grid.numLocalBins();
+  for (std::size_t i = 0; i < kDim; ++i) {
+    header.min[i] = min[i];
+    header.max[i] = max[i];
+    header.nBins[i] = nBins[i];
+  }
+  header.valuesOffset = (sizeof(FileHeader) + kValuesAlignment - 1) /
+                        kValuesAlignment * kValuesAlignment;
+  header.nValues = grid.size();
+
+  std::vector<Value> values;
+  values.reserve(grid.size());
+  for (std::size_t bin = 0; bin < grid.size(); ++bin) {
+    values.push_back(grid.at(bin));
+  }
+
+  os.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+  std::vector<char> padding(header.valuesOffset - sizeof(FileHeader), 0);
+  os.write(padding.data(), padding.size());
+  os.write(reinterpret_cast<const char*>(values.data()),
+           values.size() * sizeof(Value));
+  if (!os) {
+    throw std::runtime_error("Unable to write the field map file");
+  }
+}
+
+/// The axes of a file, which are all equidistant
+template <std::size_t... Is>
+auto makeAxes(const FileHeader& header, std::index_sequence<Is...> /*dims*/) {
+  return std::make_tuple(detail::EquidistantAxis(
+      header.min[Is], header.max[Is], header.nBins[Is])...);
+}
+
+template <typename map_t, typename transform_pos_t,
+          typename transform_field_t>
+map_t makeMap(std::shared_ptr<const MappedFieldMapFile> file,
+              transform_pos_t transformPos,
+              transform_field_t transformBField) {
+  using Grid = typename map_t::Grid;
+  using Value = typename Grid::value_type;
+  constexpr std::size_t kDim = Grid::DIM;
+
+  const FileHeader& header = file->header();
+  if (header.dimensions != kDim || header.valueSize != sizeof(Value)) {
+    throw std::invalid_argument("The field map file holds a map with " +
+                                std::to_string(header.dimensions) +
+                                " instead of " + std::to_string(kDim) +
+                                " dimensions");
+  }
+  auto axes = makeAxes(header, std::make_index_sequence<kDim>());
+  const Value* values = file->values<Value>();
+  Grid grid(std::move(file), std::move(axes), values);
+  return map_t({std::move(transformPos), std::move(transformBField),
+                std::move(grid)});
+}
+
+}  // namespace
+
+MappedFieldMapFile::MappedFieldMapFile(const std::string& path)
+    : m_file{path} {
+  if (m_file.size() < sizeof(FileHeader)) {
+    throw std::runtime_error(path + " is not a field map file");
+  }
+
+  auto fail = [&](const std::string& reason) {
+    throw std::runtime_error(path + ": " + reason);
+  };
+
+  const FileHeader& head = header();
+  if (head.magic != kMagic) {
+    fail("not a field map file");
+  }
+  if (head.version != kVersion || head.headerSize != sizeof(FileHeader)) {
+    fail("unsupported field map file version");
+  }
+  if (head.dimensions != 2 && head.dimensions != 3) {
+    fail("invalid number of dimensions");
+  }
+  if (head.valueSize != head.dimensions * sizeof(double)) {
+    fail("unsupported field value layout");
+  }
+  std::uint64_t nValues = 1;
+  for (std::size_t i = 0; i < head.dimensions; ++i) {
+    // the field values include the under- and overflow bins
+    nValues *= head.nBins[i] + 2;
+  }
+  if (head.nValues != nValues || head.valuesOffset % kValuesAlignment != 0 ||
+      head.valuesOffset > m_file.size() ||
+      head.nValues > (m_file.size() - head.valuesOffset) / head.valueSize) {
+    fail("the field values do not match the file size");
+  }
+}
+
+void writeMappedFieldMap(
+    std::ostream& os,
+    const InterpolatedBFieldMap<Grid<Vector2, detail::EquidistantAxis,
+                                     detail::EquidistantAxis>>& fieldMap) {
+  writeGrid(os, fieldMap.getGrid());
+}
+
+void writeMappedFieldMap(
+    std::ostream& os,
+    const InterpolatedBFieldMap<
+        Grid<Vector3, detail::EquidistantAxis, detail::EquidistantAxis,
+             detail::EquidistantAxis>>& fieldMap) {
+  writeGrid(os, fieldMap.getGrid());
+}
+
+MappedFieldMapRZ mappedFieldMapRZ(
+    std::shared_ptr<const MappedFieldMapFile> file) {
+  // the transforms of fieldMapRZ
+  auto transformPos = [](const Vector3& pos) {
+    return Vector2(VectorHelpers::perp(pos), pos.z());
+  };
+  auto transformBField = [](const Vector2& field, const Vector3& pos) {
+    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+    double cos_phi = 0, sin_phi = 0;
+    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+      double inv_r_sin_theta = 1. / std::sqrt(r_sin_theta_2);
+      cos_phi = pos.x() * inv_r_sin_theta;
+      sin_phi = pos.y() * inv_r_sin_theta;
+    } else {
+      cos_phi = 1.;
+      sin_phi = 0.;
+    }
+    return Vector3(field.x() * cos_phi, field.x() * sin_phi, field.y());
+  };
+  return makeMap<MappedFieldMapRZ>(std::move(file), transformPos,
+                                   transformBField);
+}
+
+MappedFieldMapXYZ mappedFieldMapXYZ(
+    std::shared_ptr<const MappedFieldMapFile> file) {
+  // the transforms of fieldMapXYZ
+  auto transformPos = [](const Vector3& pos) { return pos; };
+  auto transformBField = [](const Vector3& field, const Vector3& /*pos*/) {
+    return field;
+  };
+  return makeMap<MappedFieldMapXYZ>(std::move(file), transformPos,
+                                    transformBField);
+}
+
+std::shared_ptr<InterpolatedMagneticField> readMappedFieldMap(
+    const std::string& path) {
+  auto file = std::make_shared<const MappedFieldMapFile>(path);
+  if (file->header().dimensions == 2) {
+    return std::make_shared<MappedFieldMapRZ>(mappedFieldMapRZ(file));
+  }
+  return std::make_shared<MappedFieldMapXYZ>(mappedFieldMapXYZ(file));
+}
+
+}  // namespace Acts
@@ -11,6 +11,7 @@
 #include "Acts/Material/BinnedSurfaceMaterial.hpp"
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
 
+#include <stdexcept>
 #include <utility>
 
 // Default Constructor - for homogeneous material
@@ -129,6 +130,26 @@ void Acts::AccumulatedSurfaceMaterial::trackAverage(
   }
 }
 
+// Merge the material accumulated with a different set of tracks
+void Acts::AccumulatedSurfaceMaterial::merge(
+    const AccumulatedSurfaceMaterial& other) {
+  if (other.m_accumulatedMaterial.size() != m_accumulatedMaterial.size()) {
+    throw std::invalid_argument(
+        "AccumulatedSurfaceMaterial: cannot merge different binnings");
+  }
+  for (std::size_t i1 = 0; i1 < m_accumulatedMaterial.size(); ++i1) {
+    auto& matVec = m_accumulatedMaterial[i1];
+    const auto& otherMatVec = other.m_accumulatedMaterial[i1];
+    if (otherMatVec.size() != matVec.size()) {
+      throw std::invalid_argument(
+          "AccumulatedSurfaceMaterial: cannot merge different binnings");
+    }
+    for (std::size_t i0 = 0; i0 < matVec.size(); ++i0) {
+      matVec[i0].merge(otherMatVec[i0]);
+    }
+  }
+}
+
 /// Total average creates SurfaceMaterial
 std::unique_ptr<const Acts::ISurfaceMaterial>
 Acts::AccumulatedSurfaceMaterial::totalAverage() {
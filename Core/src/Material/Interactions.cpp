@@ -124,8 +124,8 @@ inline float computeDeltaHalf(float meanExitationPotential,
   // pre-factor according to RPP2019 table 33.1
   const float plasmaEnergy =
       PlasmaEnergyScale * std::sqrt(1000.f * molarElectronDensity);
-  return std::log(rq.betaGamma) +
-         std::log(plasmaEnergy / meanExitationPotential) - 0.5f;
+  return std::log(rq.betaGamma * plasmaEnergy / meanExitationPotential) -
+         0.5f;
 }
 
 /// Compute derivative w/ respect to q/p for the density correction.
@@ -188,8 +188,9 @@ float Acts::computeEnergyLossBethe(const MaterialSlab& slab, float m,
   // instead of an energy loss per length.
   // the required modification only change the prefactor which becomes
   // identical to the prefactor epsilon for the most probable value.
+  // log(u/I) + log(wmax/I) is evaluated as a single logarithm
   const float running =
-      std::log(u / I) + std::log(wmax / I) - 2.0f * rq.beta2 - 2.0f * dhalf;
+      std::log((u * wmax) / (I * I)) - 2.0f * rq.beta2 - 2.0f * dhalf;
   return eps * running;
 }
 
@@ -224,7 +225,7 @@ float Acts::deriveEnergyLossBetheQOverP(const MaterialSlab& slab, float m,
   const float logDerU = logDeriveMassTerm(qOverP);
   const float logDerWmax = logDeriveWMax(m, qOverP, rq);
   const float derBeta2 = deriveBeta2(qOverP, rq);
-  const float rel = logDerEps * (std::log(u / I) + std::log(wmax / I) -
+  const float rel = logDerEps * (std::log((u * wmax) / (I * I)) -
                                  2.0f * rq.beta2 - 2.0f * dhalf) +
                     logDerU + logDerWmax - 2.0f * derBeta2 - 2.0f * derDHalf;
   return eps * rel;
@@ -245,8 +246,9 @@ float Acts::computeEnergyLossLandau(const MaterialSlab& slab, float m,
   const float dhalf = computeDeltaHalf(I, Ne, rq);
   const float u = computeMassTerm(Me, rq);
   // uses RPP2018 eq. 33.12
+  // log(u/I) + log(eps/I) is evaluated as a single logarithm
   const float running =
-      std::log(u / I) + std::log(eps / I) + 0.2f - rq.beta2 - 2 * dhalf;
+      std::log((u * eps) / (I * I)) + 0.2f - rq.beta2 - 2 * dhalf;
   return eps * running;
 }
 
@@ -279,7 +281,7 @@ float Acts::deriveEnergyLossLandauQOverP(const MaterialSlab& slab, float m,
   const float derDHalf = deriveDeltaHalf(qOverP, rq);
   const float logDerT = logDeriveMassTerm(qOverP);
   const float derBeta2 = deriveBeta2(qOverP, rq);
-  const float rel = logDerEps * (std::log(t / I) + std::log(eps / I) - 0.2f -
+  const float rel = logDerEps * (std::log((t * eps) / (I * I)) - 0.2f -
                                  rq.beta2 - 2 * dhalf) +
                     logDerT + logDerEps - derBeta2 - 2 * derDHalf;
   return eps * rel;
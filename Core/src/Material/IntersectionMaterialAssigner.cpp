@@ -8,8 +8,12 @@
 
 #include "Acts/Material/IntersectionMaterialAssigner.hpp"
 
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Geometry/Polyhedron.hpp"
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+#include "Acts/Utilities/Ray.hpp"
 #include "Acts/Utilities/StringHelpers.hpp"
 
 namespace {
@@ -42,6 +46,41 @@ std::vector<Acts::SurfaceIntersection> forwardOrderedIntersections(
 
 }  // namespace
 
+Acts::IntersectionMaterialAssigner::IntersectionMaterialAssigner(
+    const Config& cfg, std::unique_ptr<const Logger> mlogger)
+    : m_cfg(cfg), m_logger(std::move(mlogger)) {
+  // The volume boundaries do not change from track to track
+  for (const auto& trackingVolume : m_cfg.trackingVolumes) {
+    auto& tSurfaces = m_trackingVolumeSurfaces.emplace_back();
+    for (const auto& boundarySurface : trackingVolume->boundarySurfaces()) {
+      tSurfaces.push_back(&(boundarySurface->surfaceRepresentation()));
+    }
+  }
+  for (const auto& detectorVolume : m_cfg.detectorVolumes) {
+    auto& dSurfaces = m_detectorVolumeSurfaces.emplace_back();
+    for (const auto& portal : detectorVolume->portals()) {
+      dSurfaces.push_back(&(portal->surface()));
+    }
+  }
+
+  if (!m_cfg.useBoundingBoxes || m_cfg.surfaces.empty()) {
+    return;
+  }
+  std::vector<Box*> prims;
+  prims.reserve(m_cfg.surfaces.size());
+  for (const auto* surface : m_cfg.surfaces) {
+    auto extent =
+        surface->polyhedronRepresentation(m_cfg.boxContext, 1).extent();
+    Vector3 vmin(extent.min(binX), extent.min(binY), extent.min(binZ));
+    Vector3 vmax(extent.max(binX), extent.max(binY), extent.max(binZ));
+    m_boxes.push_back(std::make_unique<Box>(
+        surface, vmin - Vector3::Constant(m_cfg.boxEnvelope),
+        vmax + Vector3::Constant(m_cfg.boxEnvelope)));
+    prims.push_back(m_boxes.back().get());
+  }
+  m_top = make_octree(m_nodes, prims, m_cfg.maxOctreeDepth);
+}
+
 std::pair<std::vector<Acts::IAssignmentFinder::SurfaceAssignment>,
           std::vector<Acts::IAssignmentFinder::VolumeAssignment>>
 Acts::IntersectionMaterialAssigner::assignmentCandidates(
@@ -55,9 +94,25 @@ Acts::IntersectionMaterialAssigner::assignmentCandidates(
   ACTS_DEBUG("Finding material assignment from position "
              << toString(position) << " and direction " << toString(direction));
 
-  // Try the surfaces first
-  auto sIntersections =
-      forwardOrderedIntersections(gctx, position, direction, m_cfg.surfaces);
+  // Try the surfaces first, only those with a bounding box along the ray
+  // if the bounding box hierarchy is built
+  std::vector<const Surface*> selected;
+  if (m_top != nullptr) {
+    const Ray3D ray(position, direction);
+    const Box* node = m_top;
+    while (node != nullptr) {
+      if (!node->intersect(ray)) {
+        node = node->getSkip();
+      } else if (node->hasEntity()) {
+        selected.push_back(node->entity());
+        node = node->getSkip();
+      } else {
+        node = node->getLeftChild();
+      }
+    }
+  }
+  auto sIntersections = forwardOrderedIntersections(
+      gctx, position, direction, m_top != nullptr ? selected : m_cfg.surfaces);
   candidates.first.reserve(sIntersections.size());
   for (auto& sIntersection : sIntersections) {
     candidates.first.push_back(IAssignmentFinder::SurfaceAssignment{
@@ -65,44 +120,28 @@ Acts::IntersectionMaterialAssigner::assignmentCandidates(
   }
 
   // Now deal with the volume intersections : tracking volume first
-  if (!m_cfg.trackingVolumes.empty()) {
-    for (auto& trackingVolume : m_cfg.trackingVolumes) {
-      // Collect the boundary surfaces
-      auto boundarySurfaces = trackingVolume->boundarySurfaces();
-      std::vector<const Surface*> tSurfaces;
-      for (auto& boundarySurface : boundarySurfaces) {
-        tSurfaces.push_back(&(boundarySurface->surfaceRepresentation()));
-      }
-      // Get the intersections
-      auto tIntersections =
-          forwardOrderedIntersections(gctx, position, direction, tSurfaces);
-      // Entry/exit exists in forward direction
-      if (tIntersections.size() == 2u) {
-        candidates.second.push_back(IAssignmentFinder::VolumeAssignment{
-            InteractionVolume(trackingVolume), tIntersections[0u].position(),
-            tIntersections[1u].position()});
-      }
+  for (std::size_t iv = 0; iv < m_cfg.trackingVolumes.size(); ++iv) {
+    // Get the intersections with the boundary surfaces
+    auto tIntersections = forwardOrderedIntersections(
+        gctx, position, direction, m_trackingVolumeSurfaces[iv]);
+    // Entry/exit exists in forward direction
+    if (tIntersections.size() == 2u) {
+      candidates.second.push_back(IAssignmentFinder::VolumeAssignment{
+          InteractionVolume(m_cfg.trackingVolumes[iv]),
+          tIntersections[0u].position(), tIntersections[1u].position()});
     }
   }
 
   // Now deal with the volume intersections : detector volume
-  if (!m_cfg.detectorVolumes.empty()) {
-    for (auto& detectorVolume : m_cfg.detectorVolumes) {
-      // Collect the portals
-      auto portals = detectorVolume->portals();
-      std::vector<const Surface*> dSurfaces;
-      for (auto& portal : portals) {
-        dSurfaces.push_back(&(portal->surface()));
-      }
-      // Get the intersections
-      auto dIntersections =
-          forwardOrderedIntersections(gctx, position, direction, dSurfaces);
-      // Entry/exit exists in forward direction
-      if (dIntersections.size() == 2u) {
-        candidates.second.push_back(IAssignmentFinder::VolumeAssignment{
-            InteractionVolume(detectorVolume), dIntersections[0u].position(),
-            dIntersections[1u].position()});
-      }
+  for (std::size_t iv = 0; iv < m_cfg.detectorVolumes.size(); ++iv) {
+    // Get the intersections with the portals
+    auto dIntersections = forwardOrderedIntersections(
+        gctx, position, direction, m_detectorVolumeSurfaces[iv]);
+    // Entry/exit exists in forward direction
+    if (dIntersections.size() == 2u) {
+      candidates.second.push_back(IAssignmentFinder::VolumeAssignment{
+          InteractionVolume(m_cfg.detectorVolumes[iv]),
+          dIntersections[0u].position(), dIntersections[1u].position()});
     }
   }
 
@@ -0,0 +1,482 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Material/MappedMaterialMaps.hpp"
+
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/InterpolatedMaterialMap.hpp"
+#include "Acts/Material/MaterialGridHelper.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+namespace Acts {
+
+namespace {
+
+using namespace detail_mmm;
+
+using MaterialMap2D = InterpolatedMaterialMap<MaterialMapper<MaterialGrid2D>>;
+using MaterialMap3D = InterpolatedMaterialMap<MaterialMapper<MaterialGrid3D>>;
+
+/// Number of floats of a material in the materials section
+constexpr std::size_t kMaterialSize = 5;
+
+constexpr std::array<std::size_t, eNumSections> kElementSizes = {
+    sizeof(MaterialRecord), sizeof(MaterialRecord), sizeof(BinningRecord),
+    sizeof(float),          sizeof(MaterialSlab),   sizeof(float),
+};
+
+std::size_t alignSection(std::size_t offset) {
+  return (offset + kSectionAlignment - 1) / kSectionAlignment *
+         kSectionAlignment;
+}
+
+template <typename T>
+std::pair<const char*, std::size_t> bytes(const std::vector<T>& column) {
+  return {reinterpret_cast<const char*>(column.data()),
+          column.size() * sizeof(T)};
+}
+
+/// The content of a file before it is written
+struct FileContent {
+  std::vector<MaterialRecord> surfaces;
+  std::vector<MaterialRecord> volumes;
+  std::vector<BinningRecord> binnings;
+  std::vector<float> boundaries;
+  std::vector<MaterialSlab> slabs;
+  std::vector<float> materials;
+
+  void addBinning(const BinUtility& binUtility, MaterialRecord& record) {
+    record.binningOffset = static_cast<std::uint32_t>(binnings.size());
+    record.nBinnings = static_cast<std::uint32_t>(binUtility.dimensions());
+    for (const auto& bData : binUtility.binningData()) {
+      if (bData.subBinningData != nullptr) {
+        throw std::invalid_argument(
+            "Sub-binnings are not supported by the mapped material format");
+      }
+      BinningRecord binning;
+      binning.type = bData.type;
+      binning.option = bData.option;
+      binning.value = bData.binvalue;
+      binning.bins = static_cast<std::uint32_t>(bData.bins());
+      binning.min = bData.min;
+      binning.max = bData.max;
+      if (bData.type == arbitrary) {
+        const auto& bounds = bData.boundaries();
+        binning.boundariesOffset = boundaries.size();
+        binning.nBoundaries = bounds.size();
+        boundaries.insert(boundaries.end(), bounds.begin(), bounds.end());
+      }
+      binnings.push_back(binning);
+    }
+    Eigen::Map<SquareMatrix4>(record.transform.data()) =
+        binUtility.transform().matrix();
+  }
+
+  void addMaterial(const Material& material) {
+    Material::ParametersVector parameters = material.parameters();
+    materials.insert(materials.end(), parameters.data(),
+                     parameters.data() + kMaterialSize);
+  }
+
+  template <typename grid_t>
+  void addGrid(const grid_t& grid, MaterialRecord& record) {
+    record.valuesOffset = materials.size() / kMaterialSize;
+    record.nValues = grid.size();
+    for (std::size_t bin = 0; bin < grid.size(); ++bin) {
+      addMaterial(Material(grid.at(bin)));
+    }
+  }
+};
+
+MaterialRecord makeRecord(GeometryIdentifier geoId) {
+  MaterialRecord record;
+  record.geometryId = geoId.value();
+  Eigen::Map<SquareMatrix4>(record.transform.data()) =
+      SquareMatrix4::Identity();
+  return record;
+}
+
+void addSurface(GeometryIdentifier geoId, const ISurfaceMaterial& material,
+                FileContent& content) {
+  MaterialRecord record = makeRecord(geoId);
+  record.mappingType = static_cast<std::int32_t>(material.mappingType());
+  record.valuesOffset = content.slabs.size();
+
+  if (const auto* homogeneous =
+          dynamic_cast<const HomogeneousSurfaceMaterial*>(&material);
+      homogeneous != nullptr) {
+    record.type = MaterialRecord::eHomogeneous;
+    record.nValues = 1;
+    content.slabs.push_back(homogeneous->materialSlab(Vector2(0., 0.)));
+  } else if (const auto* binned =
+                 dynamic_cast<const BinnedSurfaceMaterial*>(&material);
+             binned != nullptr) {
+    const BinUtility& binUtility = binned->binUtility();
+    const MaterialSlabMatrix& full = binned->fullMaterial();
+    // the slabs are stored with the first bin running fastest
+    if (full.size() != binUtility.bins(1)) {
+      throw std::invalid_argument("Inconsistent binned surface material " +
+                                  std::to_string(geoId.value()));
+    }
+    for (const auto& row : full) {
+      if (row.size() != binUtility.bins(0)) {
+        throw std::invalid_argument("Inconsistent binned surface material " +
+                                    std::to_string(geoId.value()));
+      }
+      content.slabs.insert(content.slabs.end(), row.begin(), row.end());
+    }
+    record.type = MaterialRecord::eBinned;
+    record.nValues = binUtility.bins(0) * binUtility.bins(1);
+    content.addBinning(binUtility, record);
+  } else if (const auto* mapped =
+                 dynamic_cast<const MappedBinnedSurfaceMaterial*>(&material);
+             mapped != nullptr) {
+    const BinUtility& binUtility = mapped->binUtility();
+    for (std::size_t bin1 = 0; bin1 < binUtility.bins(1); ++bin1) {
+      for (std::size_t bin0 = 0; bin0 < binUtility.bins(0); ++bin0) {
+        content.slabs.push_back(mapped->slab(bin0, bin1));
+      }
+    }
+    record.type = MaterialRecord::eBinned;
+    record.nValues = binUtility.bins(0) * binUtility.bins(1);
+    content.addBinning(binUtility, record);
+  } else {
+    throw std::invalid_argument("Unsupported material of surface " +
+                                std::to_string(geoId.value()));
+  }
+  content.surfaces.push_back(record);
+}
+
+void addVolume(GeometryIdentifier geoId, const IVolumeMaterial& material,
+               FileContent& content) {
+  MaterialRecord record = makeRecord(geoId);
+
+  if (const auto* homogeneous =
+          dynamic_cast<const HomogeneousVolumeMaterial*>(&material);
+      homogeneous != nullptr) {
+    record.type = MaterialRecord::eHomogeneous;
+    record.valuesOffset = content.materials.size() / kMaterialSize;
+    record.nValues = 1;
+    content.addMaterial(homogeneous->material(Vector3(0., 0., 0.)));
+  } else if (const auto* map2D = dynamic_cast<const MaterialMap2D*>(&material);
+             map2D != nullptr) {
+    record.type = MaterialRecord::eGrid2D;
+    content.addBinning(map2D->binUtility(), record);
+    content.addGrid(map2D->getMapper().getGrid(), record);
+  } else if (const auto* map3D = dynamic_cast<const MaterialMap3D*>(&material);
+             map3D != nullptr) {
+    record.type = MaterialRecord::eGrid3D;
+    content.addBinning(map3D->binUtility(), record);
+    content.addGrid(map3D->getMapper().getGrid(), record);
+  } else {
+    throw std::invalid_argument("Unsupported material of volume " +
+                                std::to_string(geoId.value()));
+  }
+  content.volumes.push_back(record);
+}
+
+BinUtility makeBinUtility(const MappedMaterialFile& file,
+                          const MaterialRecord& record) {
+  Transform3 transform;
+  transform.matrix() = Eigen::Map<const SquareMatrix4>(record.transform.data());
+  BinUtility binUtility(transform);
+  const auto* binnings =
+      file.section<BinningRecord>(eBinnings) + record.binningOffset;
+  const auto* boundaries = file.section<float>(eBoundaries);
+  for (std::size_t i = 0; i < record.nBinnings; ++i) {
+    const BinningRecord& binning = binnings[i];
+    auto option = static_cast<BinningOption>(binning.option);
+    auto value = static_cast<BinningValue>(binning.value);
+    if (binning.type == arbitrary) {
+      const float* first = boundaries + binning.boundariesOffset;
+      std::vector<float> bounds(first, first + binning.nBoundaries);
+      binUtility += BinUtility(BinningData(option, value, bounds));
+    } else {
+      binUtility += BinUtility(
+          BinningData(option, value, binning.bins, binning.min, binning.max));
+    }
+  }
+  return binUtility;
+}
+
+/// Fill a material grid and build its interpolated material map, the way
+/// the JSON converter does
+template <typename material_grid_t, typename local_t>
+std::shared_ptr<const IVolumeMaterial> makeMaterialMap(
+    const BinUtility& binUtility, material_grid_t mGrid,
+    const std::function<local_t(Vector3)>& transfoGlobalToLocal,
+    const float* materials) {
+  for (std::size_t bin = 0; bin < mGrid.size(); ++bin) {
+    mGrid.at(bin) = Eigen::Map<const Material::ParametersVector>(
+        materials + bin * kMaterialSize);
+  }
+  MaterialMapper<material_grid_t> matMap(transfoGlobalToLocal,
+                                         std::move(mGrid));
+  return std::make_shared<
+      InterpolatedMaterialMap<MaterialMapper<material_grid_t>>>(
+      std::move(matMap), binUtility);
+}
+
+}  // namespace
+
+MappedMaterialFile::MappedMaterialFile(const std::string& path)
+    : m_file{path} {
+  if (m_file.size() < sizeof(FileHeader)) {
+    throw std::runtime_error(path + " is not a material file");
+  }
+
+  auto fail = [&](const std::string& reason) {
+    throw std::runtime_error(path + ": " + reason);
+  };
+
+  const FileHeader& head = header();
+  if (head.magic != kMagic) {
+    fail("not a material file");
+  }
+  if (head.version != kVersion) {
+    fail("unsupported version " + std::to_string(head.version));
+  }
+  if (head.headerSize != sizeof(FileHeader) ||
+      head.surfaceRecordSize != sizeof(MaterialRecord) ||
+      head.volumeRecordSize != sizeof(MaterialRecord) ||
+      head.binningRecordSize != sizeof(BinningRecord) ||
+      head.slabSize != sizeof(MaterialSlab)) {
+    fail("written with a different record layout");
+  }
+  for (std::size_t i = 0; i < eNumSections; ++i) {
+    const SectionRange& range = head.sections[i];
+    if (range.offset % kSectionAlignment != 0 || range.offset > m_file.size() ||
+        range.size > m_file.size() - range.offset ||
+        range.size % kElementSizes[i] != 0) {
+      fail("section " + std::to_string(i) + " is out of bounds");
+    }
+  }
+
+  // the records must reference ranges inside the pools
+  const auto* binnings = section<BinningRecord>(eBinnings);
+  std::size_t nBinnings = sectionSize<BinningRecord>(eBinnings);
+  std::size_t nBoundaries = sectionSize<float>(eBoundaries);
+  for (std::size_t i = 0; i < nBinnings; ++i) {
+    if (binnings[i].boundariesOffset > nBoundaries ||
+        binnings[i].nBoundaries > nBoundaries - binnings[i].boundariesOffset) {
+      fail("binning " + std::to_string(i) + " is out of bounds");
+    }
+  }
+  auto checkRecords = [&](Section recordSection, std::size_t nValues) {
+    const auto* records = section<MaterialRecord>(recordSection);
+    std::size_t size = sectionSize<MaterialRecord>(recordSection);
+    for (std::size_t i = 0; i < size; ++i) {
+      const MaterialRecord& record = records[i];
+      if (record.binningOffset > nBinnings ||
+          record.nBinnings > nBinnings - record.binningOffset ||
+          record.valuesOffset > nValues ||
+          record.nValues > nValues - record.valuesOffset) {
+        fail("material " + std::to_string(record.geometryId) +
+             " is out of bounds");
+      }
+    }
+  };
+  checkRecords(eSurfaces, sectionSize<MaterialSlab>(eSlabs));
+  checkRecords(eVolumes, sectionSize<float>(eMaterials) / kMaterialSize);
+}
+
+MappedBinnedSurfaceMaterial::MappedBinnedSurfaceMaterial(
+    std::shared_ptr<const MappedMaterialFile> file,
+    const BinUtility& binUtility, const MaterialSlab* slabs,
+    MappingType mappingType)
+    : ISurfaceMaterial(0., mappingType),
+      m_file(std::move(file)),
+      m_binUtility(binUtility),
+      m_slabs(slabs),
+      m_bins0(binUtility.bins(0)) {}
+
+MappedBinnedSurfaceMaterial& MappedBinnedSurfaceMaterial::operator*=(
+    double /*scale*/) {
+  throw std::logic_error("Mapped surface material can not be scaled");
+}
+
+const MaterialSlab& MappedBinnedSurfaceMaterial::materialSlab(
+    const Vector2& lp) const {
+  std::size_t ibin0 = m_binUtility.bin(lp, 0);
+  std::size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(lp, 1) : 0;
+  return slab(ibin0, ibin1);
+}
+
+const MaterialSlab& MappedBinnedSurfaceMaterial::materialSlab(
+    const Vector3& gp) const {
+  std::size_t ibin0 = m_binUtility.bin(gp, 0);
+  std::size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(gp, 1) : 0;
+  return slab(ibin0, ibin1);
+}
+
+std::ostream& MappedBinnedSurfaceMaterial::toStream(std::ostream& sl) const {
+  sl << "Acts::MappedBinnedSurfaceMaterial : " << std::endl;
+  sl << "   - Number of Material bins [0,1] : " << m_binUtility.max(0) + 1
+     << " / " << m_binUtility.max(1) + 1 << std::endl;
+  sl << "   - Parse full update material    : " << std::endl;
+  return sl;
+}
+
+void writeMappedMaterialMaps(std::ostream& os, const MappedMaterialMaps& maps) {
+  FileContent content;
+  for (const auto& [geoId, material] : maps.first) {
+    addSurface(geoId, *material, content);
+  }
+  for (const auto& [geoId, material] : maps.second) {
+    addVolume(geoId, *material, content);
+  }
+
+  std::array<std::pair<const char*, std::size_t>, eNumSections> sections = {
+      bytes(content.surfaces),   bytes(content.volumes),
+      bytes(content.binnings),   bytes(content.boundaries),
+      bytes(content.slabs),      bytes(content.materials),
+  };
+
+  FileHeader header;
+  header.headerSize = sizeof(FileHeader);
+  header.surfaceRecordSize = sizeof(MaterialRecord);
+  header.volumeRecordSize = sizeof(MaterialRecord);
+  header.binningRecordSize = sizeof(BinningRecord);
+  header.slabSize = sizeof(MaterialSlab);
+  std::size_t offset = alignSection(sizeof(FileHeader));
+  for (std::size_t i = 0; i < eNumSections; ++i) {
+    header.sections[i].offset = offset;
+    header.sections[i].size = sections[i].second;
+    offset = alignSection(offset + sections[i].second);
+  }
+
+  const std::array<char, kSectionAlignment> padding{};
+  os.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+  std::size_t written = sizeof(FileHeader);
+  for (std::size_t i = 0; i < eNumSections; ++i) {
+    os.write(padding.data(), header.sections[i].offset - written);
+    os.write(sections[i].first, sections[i].second);
+    written = header.sections[i].offset + sections[i].second;
+  }
+  if (!os) {
+    throw std::runtime_error("Unable to write the material file");
+  }
+}
+
+MappedMaterialMaps readMappedMaterialMaps(
+    const std::shared_ptr<const MappedMaterialFile>& file) {
+  MappedMaterialMaps maps;
+
+  const auto* slabs = file->section<MaterialSlab>(eSlabs);
+  const auto* surfaces = file->section<MaterialRecord>(eSurfaces);
+  std::size_t nSurfaces = file->sectionSize<MaterialRecord>(eSurfaces);
+  for (std::size_t i = 0; i < nSurfaces; ++i) {
+    const MaterialRecord& record = surfaces[i];
+    GeometryIdentifier geoId{record.geometryId};
+    auto mappingType = static_cast<MappingType>(record.mappingType);
+    if (record.type == MaterialRecord::eHomogeneous && record.nValues == 1) {
+      maps.first[geoId] = std::make_shared<HomogeneousSurfaceMaterial>(
+          slabs[record.valuesOffset], 1., mappingType);
+      continue;
+    }
+    BinUtility binUtility = makeBinUtility(*file, record);
+    if (record.type != MaterialRecord::eBinned ||
+        record.nValues != binUtility.bins(0) * binUtility.bins(1)) {
+      throw std::runtime_error("Invalid material of surface " +
+                               std::to_string(record.geometryId));
+    }
+    maps.first[geoId] = std::make_shared<MappedBinnedSurfaceMaterial>(
+        file, binUtility, slabs + record.valuesOffset, mappingType);
+  }
+
+  const auto* materials = file->section<float>(eMaterials);
+  const auto* volumes = file->section<MaterialRecord>(eVolumes);
+  std::size_t nVolumes = file->sectionSize<MaterialRecord>(eVolumes);
+  for (std::size_t i = 0; i < nVolumes; ++i) {
+    const MaterialRecord& record = volumes[i];
+    GeometryIdentifier geoId{record.geometryId};
+    const float* values = materials + record.valuesOffset * kMaterialSize;
+    if (record.type == MaterialRecord::eHomogeneous && record.nValues == 1) {
+      maps.second[geoId] = std::make_shared<HomogeneousVolumeMaterial>(
+          Material(Eigen::Map<const Material::ParametersVector>(values)));
+      continue;
+    }
+    BinUtility binUtility = makeBinUtility(*file, record);
+    std::shared_ptr<const IVolumeMaterial> material;
+    if (record.type == MaterialRecord::eGrid2D &&
+        binUtility.dimensions() == 2) {
+      std::function<Vector2(Vector3)> transfoGlobalToLocal;
+      Grid2D grid = createGrid2D(binUtility, transfoGlobalToLocal);
+      if (grid.size() == record.nValues) {
+        Grid2D::point_t min = grid.minPosition();
+        Grid2D::point_t max = grid.maxPosition();
+        Grid2D::index_t nBins = grid.numLocalBins();
+        MaterialGrid2D mGrid(std::make_tuple(EAxis(min[0], max[0], nBins[0]),
+                                             EAxis(min[1], max[1], nBins[1])));
+        material = makeMaterialMap(binUtility, std::move(mGrid),
+                                   transfoGlobalToLocal, values);
+      }
+    } else if (record.type == MaterialRecord::eGrid3D &&
+               binUtility.dimensions() == 3) {
+      std::function<Vector3(Vector3)> transfoGlobalToLocal;
+      Grid3D grid = createGrid3D(binUtility, transfoGlobalToLocal);
+      if (grid.size() == record.nValues) {
+        Grid3D::point_t min = grid.minPosition();
+        Grid3D::point_t max = grid.maxPosition();
+        Grid3D::index_t nBins = grid.numLocalBins();
+        MaterialGrid3D mGrid(std::make_tuple(EAxis(min[0], max[0], nBins[0]),
+                                             EAxis(min[1], max[1], nBins[1]),
+                                             EAxis(min[2], max[2], nBins[2])));
+        material = makeMaterialMap(binUtility, std::move(mGrid),
+                                   transfoGlobalToLocal, values);
+      }
+    }
+    if (material == nullptr) {
+      throw std::runtime_error("Invalid material of volume " +
+                               std::to_string(record.geometryId));
+    }
+    maps.second[geoId] = std::move(material);
+  }
+  return maps;
+}
+
+MappedMaterialDecorator::MappedMaterialDecorator(const std::string& fileName,
+                                                 bool clearSurfaceMaterial,
+                                                 bool clearVolumeMaterial)
+    : m_maps(readMappedMaterialMaps(
+          std::make_shared<const MappedMaterialFile>(fileName))),
+      m_clearSurfaceMaterial(clearSurfaceMaterial),
+      m_clearVolumeMaterial(clearVolumeMaterial) {}
+
+void MappedMaterialDecorator::decorate(Surface& surface) const {
+  // Clear the material if registered to do so
+  if (m_clearSurfaceMaterial) {
+    surface.assignSurfaceMaterial(nullptr);
+  }
+  // Try to find the surface in the map
+  auto sMaterial = m_maps.first.find(surface.geometryId());
+  if (sMaterial != m_maps.first.end()) {
+    surface.assignSurfaceMaterial(sMaterial->second);
+  }
+}
+
+void MappedMaterialDecorator::decorate(TrackingVolume& volume) const {
+  // Clear the material if registered to do so
+  if (m_clearVolumeMaterial) {
+    volume.assignVolumeMaterial(nullptr);
+  }
+  // Try to find the volume in the map
+  auto vMaterial = m_maps.second.find(volume.geometryId());
+  if (vMaterial != m_maps.second.end()) {
+    volume.assignVolumeMaterial(vMaterial->second);
+  }
+}
+
+}  // namespace Acts
@@ -48,6 +48,7 @@ Acts::Material Acts::Material::fromMassDensity(float x0, float l0, float ar,
   // perform computations in double precision to avoid loss of precision
   const double atomicMass = static_cast<double>(ar) * 1_u;
   mat.m_molarRho = static_cast<double>(massRho) / (atomicMass * kAvogadro);
+  mat.m_meanExcitationEnergy = computeMeanExcitationEnergy(z);
   return mat;
 }
 
@@ -59,6 +60,7 @@ Acts::Material Acts::Material::fromMolarDensity(float x0, float l0, float ar,
   mat.m_ar = ar;
   mat.m_z = z;
   mat.m_molarRho = molarRho;
+  mat.m_meanExcitationEnergy = computeMeanExcitationEnergy(z);
   return mat;
 }
 
@@ -67,7 +69,8 @@ Acts::Material::Material(const ParametersVector& parameters)
       m_l0(parameters[eInteractionLength]),
       m_ar(parameters[eRelativeAtomicMass]),
       m_z(parameters[eNuclearCharge]),
-      m_molarRho(parameters[eMolarDensity]) {}
+      m_molarRho(parameters[eMolarDensity]),
+      m_meanExcitationEnergy(computeMeanExcitationEnergy(m_z)) {}
 
 float Acts::Material::massDensity() const {
   using namespace Acts::UnitLiterals;
@@ -78,11 +81,11 @@ float Acts::Material::massDensity() const {
   return atomicMass * numberDensity;
 }
 
-float Acts::Material::meanExcitationEnergy() const {
+float Acts::Material::computeMeanExcitationEnergy(float z) {
   using namespace Acts::UnitLiterals;
 
   // use approximative computation as defined in ATL-SOFT-PUB-2008-003
-  return 16_eV * std::pow(m_z, 0.9f);
+  return 16_eV * std::pow(z, 0.9f);
 }
 
 Acts::Material::ParametersVector Acts::Material::parameters() const {
@@ -12,6 +12,52 @@
 #include "Acts/Material/interface/IAssignmentFinder.hpp"
 #include "Acts/Utilities/StringHelpers.hpp"
 
+#include <cmath>
+#include <stdexcept>
+
+Acts::MaterialProfile::MaterialProfile(
+    std::size_t nEtaBins_, const std::pair<ActsScalar, ActsScalar>& etaRange_,
+    std::size_t nPhiBins_, const std::pair<ActsScalar, ActsScalar>& phiRange_)
+    : nEtaBins(nEtaBins_),
+      etaRange(etaRange_),
+      nPhiBins(nPhiBins_),
+      phiRange(phiRange_),
+      entries(nEtaBins * nPhiBins, 0u),
+      sumInX0(nEtaBins * nPhiBins, 0.),
+      sumInL0(nEtaBins * nPhiBins, 0.) {
+  if (nEtaBins == 0 || nPhiBins == 0 || !(etaRange.first < etaRange.second) ||
+      !(phiRange.first < phiRange.second)) {
+    throw std::invalid_argument("Invalid material profile binning");
+  }
+}
+
+void Acts::MaterialProfile::fill(ActsScalar eta, ActsScalar phi,
+                                 ActsScalar inX0, ActsScalar inL0) {
+  ActsScalar fEta = (eta - etaRange.first) / (etaRange.second - etaRange.first);
+  ActsScalar fPhi = (phi - phiRange.first) / (phiRange.second - phiRange.first);
+  if (!(fEta >= 0. && fEta < 1. && fPhi >= 0. && fPhi < 1.)) {
+    return;
+  }
+  std::size_t b = bin(static_cast<std::size_t>(fEta * nEtaBins),
+                      static_cast<std::size_t>(fPhi * nPhiBins));
+  entries[b] += 1;
+  sumInX0[b] += inX0;
+  sumInL0[b] += inL0;
+}
+
+void Acts::MaterialProfile::merge(const MaterialProfile& other) {
+  if (other.nEtaBins != nEtaBins || other.nPhiBins != nPhiBins ||
+      other.etaRange != etaRange || other.phiRange != phiRange) {
+    throw std::invalid_argument("Can not merge material profiles with "
+                                "different binnings");
+  }
+  for (std::size_t b = 0; b < entries.size(); ++b) {
+    entries[b] += other.entries[b];
+    sumInX0[b] += other.sumInX0[b];
+    sumInL0[b] += other.sumInL0[b];
+  }
+}
+
 Acts::MaterialValidater::MaterialValidater(
     const Acts::MaterialValidater::Config& cfg,
     std::unique_ptr<const Acts::Logger> mlogger)
@@ -60,3 +106,25 @@ Acts::RecordedMaterialTrack Acts::MaterialValidater::recordMaterial(
 
   return mTrack;
 }
+
+std::pair<Acts::ActsScalar, Acts::ActsScalar>
+Acts::MaterialValidater::integrateMaterial(const GeometryContext& gctx,
+                                           const MagneticFieldContext& mctx,
+                                           const Vector3& position,
+                                           const Vector3& direction) const {
+  ActsScalar inX0 = 0.;
+  ActsScalar inL0 = 0.;
+
+  auto [surfaceAssignments, volumeAssignments] =
+      m_cfg.materialAssigner->assignmentCandidates(gctx, mctx, position,
+                                                   direction);
+
+  for (auto [surface, sposition, sdirection] : surfaceAssignments) {
+    const auto& materialSlab =
+        surface->surfaceMaterial()->materialSlab(sposition);
+    auto pathCorrection = surface->pathCorrection(gctx, sposition, sdirection);
+    inX0 += materialSlab.thicknessInX0() * pathCorrection;
+    inL0 += materialSlab.thicknessInL0() * pathCorrection;
+  }
+  return {inX0, inL0};
+}
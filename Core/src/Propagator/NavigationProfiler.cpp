@@ -0,0 +1,81 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/NavigationProfiler.hpp"
+
+#include <atomic>
+#include <unordered_map>
+
+namespace {
+std::atomic<std::size_t> s_nextProfilerId{0};
+}  // namespace
+
+Acts::NavigationProfiler::Counters&
+Acts::NavigationProfiler::Counters::operator+=(const Counters& other) {
+  calls += other.calls;
+  candidates += other.candidates;
+  intersections += other.intersections;
+  retargets += other.retargets;
+  time += other.time;
+  return *this;
+}
+
+Acts::NavigationProfiler::NavigationProfiler() : m_id(s_nextProfilerId++) {}
+
+Acts::NavigationProfiler::~NavigationProfiler() = default;
+
+Acts::NavigationProfiler::CounterMap&
+Acts::NavigationProfiler::threadCounters() {
+  // the identifier is never reused, a buffer of a destroyed profiler can not
+  // be found by a new one at the same address
+  thread_local std::unordered_map<std::size_t, CounterMap*> buffers;
+  auto it = buffers.find(m_id);
+  if (it != buffers.end()) {
+    return *it->second;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& buffer = m_threadCounters.emplace_back(std::make_unique<CounterMap>());
+  buffers.emplace(m_id, buffer.get());
+  return *buffer;
+}
+
+Acts::NavigationProfiler::Counters& Acts::NavigationProfiler::counters(
+    GeometryIdentifier geoId) {
+  return threadCounters()[geoId];
+}
+
+Acts::NavigationProfiler::CounterMap Acts::NavigationProfiler::summary()
+    const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  CounterMap result;
+  for (const auto& buffer : m_threadCounters) {
+    for (const auto& [geoId, counters] : *buffer) {
+      result[geoId] += counters;
+    }
+  }
+  return result;
+}
+
+Acts::NavigationProfiler::CounterMap Acts::NavigationProfiler::volumeSummary()
+    const {
+  CounterMap result;
+  for (const auto& [geoId, counters] : summary()) {
+    result[GeometryIdentifier().setVolume(geoId.volume())] += counters;
+  }
+  return result;
+}
+
+void Acts::NavigationProfiler::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  // keep the entries, the navigators may hold references to them
+  for (auto& buffer : m_threadCounters) {
+    for (auto& [geoId, counters] : *buffer) {
+      counters = Counters();
+    }
+  }
+}
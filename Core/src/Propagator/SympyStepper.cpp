@@ -8,12 +8,14 @@
 
 #include "Acts/Propagator/SympyStepper.hpp"
 
+#include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/Propagator/detail/SympyCovarianceEngine.hpp"
 #include "Acts/Propagator/detail/SympyJacobianEngine.hpp"
 #include "Acts/Utilities/QuickMath.hpp"
 
 #include <cmath>
 #include <cstdint>
+#include <system_error>
 
 #include "codegen/sympy_stepper_math.hpp"
 
@@ -21,7 +23,10 @@ namespace Acts {
 
 SympyStepper::SympyStepper(std::shared_ptr<const MagneticFieldProvider> bField,
                            double overstepLimit)
-    : m_bField(std::move(bField)), m_overstepLimit(overstepLimit) {}
+    : m_bField(std::move(bField)),
+      m_overstepLimit(overstepLimit),
+      m_constantField(dynamic_cast<const ConstantBField*>(m_bField.get()) !=
+                      nullptr) {}
 
 SympyStepper::State SympyStepper::makeState(
     std::reference_wrapper<const GeometryContext> gctx,
@@ -115,10 +120,46 @@ Result<double> SympyStepper::stepImpl(
   double m = particleHypothesis(state).mass();
   double p_abs = absoluteMomentum(state);
 
+  // The field at the start position does not change between step trials, so
+  // it is only looked up once per step
+  auto startFieldRes = getField(state, pos);
+  if (!startFieldRes.ok()) {
+    return startFieldRes.error();
+  }
+  const Vector3 startField = *startFieldRes;
+
+  // The generated kernel asks for the start field first in every trial. A
+  // failed lookup is kept and returned after the trial, the kernel itself
+  // can not be interrupted.
+  bool firstStage = true;
+  std::error_code fieldError;
   auto getB = [&](const double* p) -> Vector3 {
+    if (firstStage) {
+      firstStage = false;
+      return startField;
+    }
     auto fieldRes = getField(state, {p[0], p[1], p[2]});
+    if (!fieldRes.ok()) {
+      fieldError = fieldRes.error();
+      return Vector3::Zero();
+    }
     return *fieldRes;
   };
+  // In a constant field all stages see the start field. This instantiates a
+  // kernel without any field lookups.
+  auto getConstantB = [&](const double* /*p*/) -> Vector3 {
+    return startField;
+  };
+
+  const auto tryRungeKuttaStep = [&](auto&& getBField, const double h_,
+                                     double* errorEstimate_) -> bool {
+    return rk4(pos.data(), dir.data(), t, h_, qop, m, p_abs, getBField,
+               errorEstimate_, state.pars.template segment<3>(eFreePos0).data(),
+               state.pars.template segment<3>(eFreeDir0).data(),
+               state.pars.template segment<1>(eFreeTime).data(),
+               state.derivative.data(),
+               state.covTransport ? state.jacTransport.data() : nullptr);
+  };
 
   const auto calcStepSizeScaling = [&](const double errorEstimate_) -> double {
     // For details about these values see ATL-SOFT-PUB-2009-001 for details
@@ -152,13 +193,13 @@ Result<double> SympyStepper::stepImpl(
 
   while (true) {
     nStepTrials++;
-    bool ok =
-        rk4(pos.data(), dir.data(), t, h, qop, m, p_abs, getB, &errorEstimate,
-            state.pars.template segment<3>(eFreePos0).data(),
-            state.pars.template segment<3>(eFreeDir0).data(),
-            state.pars.template segment<1>(eFreeTime).data(),
-            state.derivative.data(),
-            state.covTransport ? state.jacTransport.data() : nullptr);
+    firstStage = true;
+    bool ok = m_constantField
+                  ? tryRungeKuttaStep(getConstantB, h, &errorEstimate)
+                  : tryRungeKuttaStep(getB, h, &errorEstimate);
+    if (fieldError) {
+      return fieldError;
+    }
 
     if (ok) {
       break;
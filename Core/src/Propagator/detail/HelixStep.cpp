@@ -0,0 +1,84 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/detail/HelixStep.hpp"
+
+#include <cmath>
+
+namespace Acts {
+
+void detail::helixStep(FreeVector& pars, const Vector3& bField, double h,
+                       double mass, double absMomentum, FreeMatrix* D,
+                       Vector3* dTds) {
+  const double qop = pars[eFreeQOverP];
+  const double bMag = bField.norm();
+  // unit vector along the field, arbitrary for a vanishing field
+  const Vector3 b = bMag > 0 ? Vector3(bField / bMag) : Vector3::UnitZ();
+  // signed curvature of the projection into the plane transverse to b
+  const double k = qop * bMag;
+
+  const Vector3 dir = pars.segment<3>(eFreeDir0);
+  const Vector3 dirPar = b.dot(dir) * b;
+  const Vector3 dirPerp = dir - dirPar;
+  // dT/ds = k * T x b
+  const Vector3 u = dir.cross(b);
+
+  // sin(ks)/k, (1 - cos(ks))/k and their derivatives with respect to k.
+  // The series expansions avoid the cancellation for small turning angles.
+  const double theta = k * h;
+  const double c = std::cos(theta);
+  const double s = std::sin(theta);
+  double f1 = 0, f2 = 0, g1 = 0, g2 = 0;
+  if (std::abs(theta) < 1e-4) {
+    f1 = h * (1 - theta * theta / 6.);
+    f2 = h * theta / 2.;
+    g1 = -h * h * theta / 3.;
+    g2 = h * h / 2.;
+  } else {
+    f1 = s / k;
+    f2 = (1 - c) / k;
+    g1 = (theta * c - s) / (k * k);
+    g2 = (theta * s - (1 - c)) / (k * k);
+  }
+
+  const Vector3 newDir = dirPar + c * dirPerp + s * u;
+  pars.segment<3>(eFreePos0) += h * dirPar + f1 * dirPerp + f2 * u;
+  pars.segment<3>(eFreeDir0) = newDir.normalized();
+
+  // This evaluation is based on dt/ds = 1/v = 1/(beta * c)
+  const double dtds = std::sqrt(1 + mass * mass / (absMomentum * absMomentum));
+  pars[eFreeTime] += h * dtds;
+
+  if (dTds != nullptr) {
+    *dTds = k * newDir.cross(b);
+  }
+
+  if (D == nullptr) {
+    return;
+  }
+  // Matrices acting on the direction: projection onto b, onto the transverse
+  // plane and the cross product v -> v x b
+  const ActsMatrix<3, 3> P = b * b.transpose();
+  const ActsMatrix<3, 3> Q = ActsMatrix<3, 3>::Identity() - P;
+  ActsMatrix<3, 3> X;
+  // clang-format off
+  X <<     0,  b.z(), -b.y(),
+      -b.z(),      0,  b.x(),
+       b.y(), -b.x(),      0;
+  // clang-format on
+
+  *D = FreeMatrix::Identity();
+  D->block<3, 3>(eFreePos0, eFreeDir0) = h * P + f1 * Q + f2 * X;
+  D->block<3, 1>(eFreePos0, eFreeQOverP) = bMag * (g1 * dirPerp + g2 * u);
+  D->block<3, 3>(eFreeDir0, eFreeDir0) = P + c * Q + s * X;
+  D->block<3, 1>(eFreeDir0, eFreeQOverP) =
+      bMag * h * (-s * dirPerp + c * u);
+  (*D)(eFreeTime, eFreeQOverP) = h * mass * mass * qop / dtds;
+}
+
+}  // namespace Acts
@@ -15,8 +15,94 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/AlgebraHelpers.hpp"
 
+#include <cassert>
+
 namespace Acts {
 
+namespace {
+
+// The jacobians between bound and free parameters have a fixed block
+// structure for all surfaces, see `Surface::boundToFreeJacobian` and
+// `Surface::freeToBoundJacobian`: the local position maps onto the global
+// position, the direction angles onto the global direction and onto the
+// global position for line surfaces, time and q/p map onto themselves. The
+// products below only evaluate the non-zero blocks, the free transport
+// jacobian is treated as dense. Only the zero blocks are assumed, the unit
+// entries of time and q/p are kept as factors.
+
+/// Evaluate freeMatrix * boundToFreeJacobian
+BoundToFreeMatrix transportBoundToFree(
+    const FreeMatrix& freeMatrix,
+    const BoundToFreeMatrix& boundToFreeJacobian) {
+  assert((boundToFreeJacobian.block<1, 5>(eFreeTime, eBoundLoc0).isZero()));
+  assert((boundToFreeJacobian.block<3, 2>(eFreeDir0, eBoundLoc0).isZero()));
+  assert((boundToFreeJacobian.block<3, 2>(eFreeDir0, eBoundQOverP).isZero()));
+  assert((boundToFreeJacobian.block<1, 4>(eFreeQOverP, eBoundLoc0).isZero()));
+  assert((boundToFreeJacobian.block<3, 2>(eFreePos0, eBoundQOverP).isZero()));
+  assert((boundToFreeJacobian(eFreeQOverP, eBoundTime) == 0));
+
+  BoundToFreeMatrix result;
+  result.leftCols<2>().noalias() =
+      freeMatrix.leftCols<3>() *
+      boundToFreeJacobian.block<3, 2>(eFreePos0, eBoundLoc0);
+  result.middleCols<2>(eBoundPhi).noalias() =
+      freeMatrix.leftCols<3>() *
+          boundToFreeJacobian.block<3, 2>(eFreePos0, eBoundPhi) +
+      freeMatrix.middleCols<3>(eFreeDir0) *
+          boundToFreeJacobian.block<3, 2>(eFreeDir0, eBoundPhi);
+  result.col(eBoundQOverP) =
+      freeMatrix.col(eFreeQOverP) *
+      boundToFreeJacobian(eFreeQOverP, eBoundQOverP);
+  result.col(eBoundTime) =
+      freeMatrix.col(eFreeTime) * boundToFreeJacobian(eFreeTime, eBoundTime);
+  return result;
+}
+
+/// Evaluate freeToBoundJacobian * freeMatrix
+template <int kCols>
+ActsMatrix<eBoundSize, kCols> projectFreeToBound(
+    const FreeToBoundMatrix& freeToBoundJacobian,
+    const ActsMatrix<eFreeSize, kCols>& freeMatrix) {
+  assert((freeToBoundJacobian.block<2, 5>(eBoundLoc0, eFreeTime).isZero()));
+  assert((freeToBoundJacobian.block<2, 4>(eBoundPhi, eFreePos0).isZero()));
+  assert((freeToBoundJacobian.block<2, 1>(eBoundPhi, eFreeQOverP).isZero()));
+  assert((freeToBoundJacobian.block<1, 7>(eBoundQOverP, eFreePos0).isZero()));
+  assert((freeToBoundJacobian.block<1, 3>(eBoundTime, eFreePos0).isZero()));
+  assert((freeToBoundJacobian.block<1, 4>(eBoundTime, eFreeDir0).isZero()));
+
+  ActsMatrix<eBoundSize, kCols> result;
+  result.template topRows<2>().noalias() =
+      freeToBoundJacobian.block<2, 3>(eBoundLoc0, eFreePos0) *
+      freeMatrix.template topRows<3>();
+  result.template middleRows<2>(eBoundPhi).noalias() =
+      freeToBoundJacobian.block<2, 3>(eBoundPhi, eFreeDir0) *
+      freeMatrix.template middleRows<3>(eFreeDir0);
+  result.row(eBoundQOverP) =
+      freeToBoundJacobian(eBoundQOverP, eFreeQOverP) *
+      freeMatrix.row(eFreeQOverP);
+  result.row(eBoundTime) =
+      freeToBoundJacobian(eBoundTime, eFreeTime) * freeMatrix.row(eFreeTime);
+  return result;
+}
+
+/// Evaluate freeToBoundJacobian * (1 + freeToPathDerivatives * freeToPath) *
+/// freeTransportJacobian * boundToFreeJacobian
+BoundMatrix fullBoundToBoundJacobian(
+    const FreeToBoundMatrix& freeToBoundJacobian,
+    const FreeToPathMatrix& freeToPath,
+    const FreeVector& freeToPathDerivatives,
+    const FreeMatrix& freeTransportJacobian,
+    const BoundToFreeMatrix& boundToFreeJacobian) {
+  BoundToFreeMatrix transported =
+      transportBoundToFree(freeTransportJacobian, boundToFreeJacobian);
+  // the path correction is a rank one update
+  const ActsMatrix<1, eBoundSize> pathCorrection = freeToPath * transported;
+  transported.noalias() += freeToPathDerivatives * pathCorrection;
+  return projectFreeToBound(freeToBoundJacobian, transported);
+}
+
+}  // namespace
+
 void detail::boundToBoundTransportJacobian(
     const GeometryContext& geoContext, const Surface& surface,
     const FreeVector& freeParameters,
@@ -38,10 +124,9 @@ void detail::boundToBoundTransportJacobian(
   // surface to local/bound parameters at the final surface
   // @note jac(locA->locB) = jac(gloB->locB)*(1+
   // pathCorrectionFactor(gloB))*jacTransport(gloA->gloB) *jac(locA->gloA)
-  fullTransportJacobian =
-      freeToBoundJacobian *
-      (FreeMatrix::Identity() + freeToPathDerivatives * freeToPath) *
-      freeTransportJacobian * boundToFreeJacobian;
+  fullTransportJacobian = fullBoundToBoundJacobian(
+      freeToBoundJacobian, freeToPath, freeToPathDerivatives,
+      freeTransportJacobian, boundToFreeJacobian);
 }
 
 BoundMatrix detail::boundToBoundTransportJacobian(
@@ -62,21 +147,21 @@ void detail::boundToCurvilinearTransportJacobian(
     const FreeVector& freeToPathDerivatives,
     BoundMatrix& fullTransportJacobian) {
   // Calculate the jacobian from global to local at the curvilinear surface
-  FreeToBoundMatrix freeToBoundJacobian =
+  const FreeToBoundMatrix freeToBoundJacobian =
       CurvilinearSurface(direction).freeToBoundJacobian();
 
-  // Update the jacobian to include the derivative of the path length at the
-  // curvilinear surface w.r.t. the free parameters
-  freeToBoundJacobian.topLeftCorner<6, 3>() +=
-      (freeToBoundJacobian * freeToPathDerivatives) *
-      (-1.0 * direction).transpose();
+  // The derivative of the path length at the curvilinear surface w.r.t. the
+  // free parameters
+  FreeToPathMatrix freeToPath = FreeToPathMatrix::Zero();
+  freeToPath.segment<3>(eFreePos0) = -1.0 * direction.transpose();
 
   // Calculate the full jocobian from the local parameters at the start surface
   // to curvilinear parameters
   // @note jac(locA->locB) = jac(gloB->locB)*(1+
   // pathCorrectionFactor(gloB))*jacTransport(gloA->gloB) *jac(locA->gloA)
-  fullTransportJacobian =
-      freeToBoundJacobian * freeTransportJacobian * boundToFreeJacobian;
+  fullTransportJacobian = fullBoundToBoundJacobian(
+      freeToBoundJacobian, freeToPath, freeToPathDerivatives,
+      freeTransportJacobian, boundToFreeJacobian);
 }
 
 BoundToFreeMatrix detail::boundToFreeTransportJacobian(
@@ -84,7 +169,7 @@ BoundToFreeMatrix detail::boundToFreeTransportJacobian(
     const FreeMatrix& freeTransportJacobian) {
   // Calculate the full jacobian, in this case simple a product of
   // jacobian(transport in free) * jacobian(bound to free)
-  return freeTransportJacobian * boundToFreeJacobian;
+  return transportBoundToFree(freeTransportJacobian, boundToFreeJacobian);
 }
 
 void detail::freeToBoundTransportJacobian(
@@ -100,9 +185,11 @@ void detail::freeToBoundTransportJacobian(
   FreeToPathMatrix sVec =
       surface.freeToPathDerivative(geoContext, position, direction);
   // Return the jacobian to local
-  fullTransportJacobian = freeToBoundJacobian * (freeTransportJacobian +
-                                                 freeToPathDerivatives * sVec *
-                                                     freeTransportJacobian);
+  const FreeMatrix correctedTransportJacobian =
+      freeTransportJacobian +
+      freeToPathDerivatives * (sVec * freeTransportJacobian);
+  fullTransportJacobian =
+      projectFreeToBound(freeToBoundJacobian, correctedTransportJacobian);
 }
 
 FreeToBoundMatrix detail::freeToCurvilinearTransportJacobian(
@@ -113,8 +200,10 @@ FreeToBoundMatrix detail::freeToCurvilinearTransportJacobian(
 
   // Since the jacobian to local needs to calculated for the bound parameters
   // here, it is convenient to do the same here
-  return CurvilinearSurface(direction).freeToBoundJacobian() *
-         (freeTransportJacobian - freeToPathDerivatives * sfactors);
+  const FreeMatrix correctedTransportJacobian =
+      freeTransportJacobian - freeToPathDerivatives * sfactors;
+  return projectFreeToBound(CurvilinearSurface(direction).freeToBoundJacobian(),
+                            correctedTransportJacobian);
 }
 
 Result<void> detail::reinitializeJacobians(
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -139,6 +140,45 @@ Acts::Result<Acts::Vector2> Acts::CylinderSurface::globalToLocal(
       {bounds().get(CylinderBounds::eR) * phi(loc3Dframe), loc3Dframe.z()});
 }
 
+void Acts::CylinderSurface::localToGlobalBatch(
+    const GeometryContext& gctx, const std::vector<Vector2>& lpositions,
+    std::vector<Vector3>& positions) const {
+  positions.resize(lpositions.size());
+  const double r = bounds().get(CylinderBounds::eR);
+  const Transform3& sfTransform = transform(gctx);
+  for (std::size_t i = 0; i < lpositions.size(); ++i) {
+    double phi = lpositions[i][Acts::eBoundLoc0] / r;
+    positions[i] = sfTransform * Vector3(r * cos(phi), r * sin(phi),
+                                         lpositions[i][Acts::eBoundLoc1]);
+  }
+}
+
+Acts::Result<void> Acts::CylinderSurface::globalToLocalBatch(
+    const GeometryContext& gctx, const std::vector<Vector3>& positions,
+    std::vector<Vector2>& lpositions, double tolerance) const {
+  const double r = bounds().get(CylinderBounds::eR);
+  // Same tolerance treatment as in the single position conversion
+  double inttol = tolerance;
+  if (tolerance == s_onSurfaceTolerance) {
+    inttol = r * 0.0001;
+  }
+  if (inttol < 0.01) {
+    inttol = 0.01;
+  }
+  lpositions.resize(positions.size());
+  const Transform3 inverseTrans = transform(gctx).inverse();
+  bool onSurface = true;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    Vector3 loc3Dframe = inverseTrans * positions[i];
+    onSurface = onSurface && std::abs(perp(loc3Dframe) - r) <= inttol;
+    lpositions[i] = Vector2(r * phi(loc3Dframe), loc3Dframe.z());
+  }
+  if (!onSurface) {
+    return Result<void>::failure(SurfaceError::GlobalPositionNotOnSurface);
+  }
+  return Result<void>::success();
+}
+
 std::string Acts::CylinderSurface::name() const {
   return "Acts::CylinderSurface";
 }
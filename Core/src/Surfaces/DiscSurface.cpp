@@ -24,6 +24,7 @@
 #include "Acts/Utilities/ThrowAssert.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -102,6 +103,38 @@ Acts::Result<Acts::Vector2> Acts::DiscSurface::globalToLocal(
   return Result<Acts::Vector2>::success({perp(loc3Dframe), phi(loc3Dframe)});
 }
 
+void Acts::DiscSurface::localToGlobalBatch(
+    const GeometryContext& gctx, const std::vector<Vector2>& lpositions,
+    std::vector<Vector3>& positions) const {
+  positions.resize(lpositions.size());
+  const Transform3& sfTransform = transform(gctx);
+  for (std::size_t i = 0; i < lpositions.size(); ++i) {
+    const Vector2& lposition = lpositions[i];
+    positions[i] =
+        sfTransform *
+        Vector3(lposition[Acts::eBoundLoc0] * cos(lposition[Acts::eBoundLoc1]),
+                lposition[Acts::eBoundLoc0] * sin(lposition[Acts::eBoundLoc1]),
+                0.);
+  }
+}
+
+Acts::Result<void> Acts::DiscSurface::globalToLocalBatch(
+    const GeometryContext& gctx, const std::vector<Vector3>& positions,
+    std::vector<Vector2>& lpositions, double tolerance) const {
+  lpositions.resize(positions.size());
+  const Transform3 inverseTrans = transform(gctx).inverse();
+  bool onSurface = true;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    Vector3 loc3Dframe = inverseTrans * positions[i];
+    onSurface = onSurface && std::abs(loc3Dframe.z()) <= std::abs(tolerance);
+    lpositions[i] = Vector2(perp(loc3Dframe), phi(loc3Dframe));
+  }
+  if (!onSurface) {
+    return Result<void>::failure(SurfaceError::GlobalPositionNotOnSurface);
+  }
+  return Result<void>::success();
+}
+
 Acts::Vector2 Acts::DiscSurface::localPolarToLocalCartesian(
     const Vector2& locpol) const {
   const DiscTrapezoidBounds* dtbo =
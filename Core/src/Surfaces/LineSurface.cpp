@@ -22,9 +22,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace Acts {
 class DetectorElementBase;
@@ -102,6 +104,51 @@ Acts::Result<Acts::Vector2> Acts::LineSurface::globalToLocal(
   return Result<Vector2>::success(localXY);
 }
 
+void Acts::LineSurface::localToGlobalBatch(
+    const GeometryContext& gctx, const std::vector<Vector2>& lpositions,
+    const std::vector<Vector3>& directions,
+    std::vector<Vector3>& positions) const {
+  if (lpositions.size() != directions.size()) {
+    throw std::invalid_argument(
+        "LineSurface: number of directions does not match positions");
+  }
+  positions.resize(lpositions.size());
+  const Vector3 unitZ0 = lineDirection(gctx);
+  const Vector3 lineCenter = transform(gctx).translation();
+  for (std::size_t i = 0; i < lpositions.size(); ++i) {
+    Vector3 radiusAxisGlobal = unitZ0.cross(directions[i]).normalized();
+    positions[i] = lineCenter + lpositions[i][eBoundLoc1] * unitZ0 +
+                   lpositions[i][eBoundLoc0] * radiusAxisGlobal;
+  }
+}
+
+Acts::Result<void> Acts::LineSurface::globalToLocalBatch(
+    const GeometryContext& gctx, const std::vector<Vector3>& positions,
+    const std::vector<Vector3>& directions, std::vector<Vector2>& lpositions,
+    double tolerance) const {
+  if (positions.size() != directions.size()) {
+    throw std::invalid_argument(
+        "LineSurface: number of directions does not match positions");
+  }
+  lpositions.resize(positions.size());
+  const Vector3 unitZ0 = lineDirection(gctx);
+  const Vector3 lineCenter = transform(gctx).translation();
+  bool onSurface = true;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    // The reference frame is orthonormal, its inverse is the transpose
+    Vector3 unitD0 = unitZ0.cross(directions[i]).normalized();
+    Vector3 unitDistance = unitD0.cross(unitZ0);
+    Vector3 difference = positions[i] - lineCenter;
+    onSurface = onSurface &&
+                std::abs(unitDistance.dot(difference)) <= std::abs(tolerance);
+    lpositions[i] = Vector2(unitD0.dot(difference), unitZ0.dot(difference));
+  }
+  if (!onSurface) {
+    return Result<void>::failure(SurfaceError::GlobalPositionNotOnSurface);
+  }
+  return Result<void>::success();
+}
+
 std::string Acts::LineSurface::name() const {
   return "Acts::LineSurface";
 }
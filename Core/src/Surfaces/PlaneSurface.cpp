@@ -80,6 +80,49 @@ Acts::Result<Acts::Vector2> Acts::PlaneSurface::globalToLocal(
   return Result<Vector2>::success({loc3Dframe.x(), loc3Dframe.y()});
 }
 
+void Acts::PlaneSurface::localToGlobalBatch(
+    const GeometryContext& gctx, const std::vector<Vector2>& lpositions,
+    std::vector<Vector3>& positions) const {
+  positions.resize(lpositions.size());
+  if (lpositions.empty()) {
+    return;
+  }
+  const Transform3& sfTransform = transform(gctx);
+  // The positions are densely packed, convert all of them in one product
+  Eigen::Map<const Eigen::Matrix<ActsScalar, 2, Eigen::Dynamic>> local(
+      lpositions.front().data(), 2, lpositions.size());
+  Eigen::Map<Eigen::Matrix<ActsScalar, 3, Eigen::Dynamic>> global(
+      positions.front().data(), 3, positions.size());
+  global.noalias() = sfTransform.linear().leftCols<2>() * local;
+  global.colwise() += sfTransform.translation();
+}
+
+Acts::Result<void> Acts::PlaneSurface::globalToLocalBatch(
+    const GeometryContext& gctx, const std::vector<Vector3>& positions,
+    std::vector<Vector2>& lpositions, double tolerance) const {
+  lpositions.resize(positions.size());
+  if (positions.empty()) {
+    return Result<void>::success();
+  }
+  const Transform3 inverseTrans = transform(gctx).inverse();
+  Eigen::Map<const Eigen::Matrix<ActsScalar, 3, Eigen::Dynamic>> global(
+      positions.front().data(), 3, positions.size());
+  Eigen::Map<Eigen::Matrix<ActsScalar, 2, Eigen::Dynamic>> local(
+      lpositions.front().data(), 2, lpositions.size());
+  local.noalias() = inverseTrans.linear().topRows<2>() * global;
+  local.colwise() += inverseTrans.translation().head<2>();
+  // Largest distance of any position from the plane
+  const ActsScalar maxDistance =
+      ((inverseTrans.linear().row(2) * global).array() +
+       inverseTrans.translation().z())
+          .abs()
+          .maxCoeff();
+  if (maxDistance > std::abs(tolerance)) {
+    return Result<void>::failure(SurfaceError::GlobalPositionNotOnSurface);
+  }
+  return Result<void>::success();
+}
+
 std::string Acts::PlaneSurface::name() const {
   return "Acts::PlaneSurface";
 }
@@ -8,6 +8,7 @@
 
 #include "Acts/Surfaces/RectangleBounds.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 
@@ -16,6 +17,37 @@ bool Acts::RectangleBounds::inside(const Acts::Vector2& lposition,
   return bcheck.isInside(lposition, m_min, m_max);
 }
 
+void Acts::RectangleBounds::insideBatch(const Acts::Vector2* lpositions,
+                                        std::size_t n,
+                                        const Acts::BoundaryCheck& bcheck,
+                                        bool* results) const {
+  if (bcheck.type() == BoundaryCheck::Type::eNone) {
+    std::fill(results, results + n, true);
+    return;
+  }
+  if (bcheck.type() == BoundaryCheck::Type::eChi2) {
+    for (std::size_t i = 0; i < n; ++i) {
+      results[i] = bcheck.isInside(lpositions[i], m_min, m_max);
+    }
+    return;
+  }
+
+  // same arithmetic as the distance to the closest point on the rectangle
+  // in the single position check, the bitwise and avoids the branches
+  const double tolX = bcheck.tolerance()[eBoundLoc0];
+  const double tolY = bcheck.tolerance()[eBoundLoc1];
+  const double minX = m_min[eBoundLoc0];
+  const double minY = m_min[eBoundLoc1];
+  const double maxX = m_max[eBoundLoc0];
+  const double maxY = m_max[eBoundLoc1];
+  for (std::size_t i = 0; i < n; ++i) {
+    const double x = lpositions[i][eBoundLoc0];
+    const double y = lpositions[i][eBoundLoc1];
+    results[i] = ((minX - x) <= tolX) & ((x - maxX) <= tolX) &
+                 ((minY - y) <= tolY) & ((y - maxY) <= tolY);
+  }
+}
+
 std::vector<Acts::Vector2> Acts::RectangleBounds::vertices(
     unsigned int /*lseg*/) const {
   // counter-clockwise starting from bottom-left corner
@@ -10,6 +10,10 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/SurfaceError.hpp"
+
+#include <cstddef>
+#include <vector>
 
 namespace Acts {
 
@@ -31,4 +35,32 @@ Vector3 RegularSurface::localToGlobal(const GeometryContext& gctx,
   return localToGlobal(gctx, lposition);
 }
 
+void RegularSurface::localToGlobalBatch(const GeometryContext& gctx,
+                                        const std::vector<Vector2>& lpositions,
+                                        std::vector<Vector3>& positions) const {
+  positions.resize(lpositions.size());
+  for (std::size_t i = 0; i < lpositions.size(); ++i) {
+    positions[i] = localToGlobal(gctx, lpositions[i]);
+  }
+}
+
+Result<void> RegularSurface::globalToLocalBatch(
+    const GeometryContext& gctx, const std::vector<Vector3>& positions,
+    std::vector<Vector2>& lpositions, double tolerance) const {
+  lpositions.resize(positions.size());
+  bool onSurface = true;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    auto lposition = globalToLocal(gctx, positions[i], tolerance);
+    if (lposition.ok()) {
+      lpositions[i] = *lposition;
+    } else {
+      onSurface = false;
+    }
+  }
+  if (!onSurface) {
+    return Result<void>::failure(SurfaceError::GlobalPositionNotOnSurface);
+  }
+  return Result<void>::success();
+}
+
 }  // namespace Acts
@@ -0,0 +1,297 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Surfaces/SurfaceSnapshot.hpp"
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/AnnulusBounds.hpp"
+#include "Acts/Surfaces/ConeBounds.hpp"
+#include "Acts/Surfaces/ConeSurface.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/DiscTrapezoidBounds.hpp"
+#include "Acts/Surfaces/EllipseBounds.hpp"
+#include "Acts/Surfaces/LineBounds.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceBounds.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'S', 'N', 'A', 'P'};
+constexpr std::uint32_t s_noBoundsIndex =
+    std::numeric_limits<std::uint32_t>::max();
+
+template <typename value_t>
+void put(std::ostream& os, const value_t& value) {
+  os.write(reinterpret_cast<const char*>(&value), sizeof(value_t));
+}
+
+/// Sequential reader of the snapshot buffer with range checks
+class Cursor {
+ public:
+  Cursor(const char* data, std::size_t size) : m_data(data), m_size(size) {}
+
+  template <typename value_t>
+  value_t get() {
+    if (m_size - m_pos < sizeof(value_t)) {
+      throw std::runtime_error("SurfaceSnapshot: unexpected end of data");
+    }
+    value_t value;
+    std::memcpy(&value, m_data + m_pos, sizeof(value_t));
+    m_pos += sizeof(value_t);
+    return value;
+  }
+
+ private:
+  const char* m_data = nullptr;
+  std::size_t m_size = 0;
+  std::size_t m_pos = 0;
+};
+
+template <typename bounds_t>
+std::shared_ptr<const Acts::SurfaceBounds> makeBounds(
+    const std::vector<double>& values) {
+  std::array<double, bounds_t::eSize> bValues{};
+  if (values.size() != bValues.size()) {
+    throw std::runtime_error(
+        "SurfaceSnapshot: wrong number of bounds values");
+  }
+  std::copy(values.begin(), values.end(), bValues.begin());
+  return std::make_shared<const bounds_t>(bValues);
+}
+
+std::shared_ptr<const Acts::SurfaceBounds> makeBounds(
+    Acts::SurfaceBounds::BoundsType bType, const std::vector<double>& values) {
+  using Acts::SurfaceBounds;
+  switch (bType) {
+    case SurfaceBounds::eAnnulus:
+      return makeBounds<Acts::AnnulusBounds>(values);
+    case SurfaceBounds::eCone:
+      return makeBounds<Acts::ConeBounds>(values);
+    case SurfaceBounds::eCylinder:
+      return makeBounds<Acts::CylinderBounds>(values);
+    case SurfaceBounds::eDiamond:
+      return makeBounds<Acts::DiamondBounds>(values);
+    case SurfaceBounds::eDisc:
+      return makeBounds<Acts::RadialBounds>(values);
+    case SurfaceBounds::eDiscTrapezoid:
+      return makeBounds<Acts::DiscTrapezoidBounds>(values);
+    case SurfaceBounds::eEllipse:
+      return makeBounds<Acts::EllipseBounds>(values);
+    case SurfaceBounds::eLine:
+      return makeBounds<Acts::LineBounds>(values);
+    case SurfaceBounds::eRectangle:
+      return makeBounds<Acts::RectangleBounds>(values);
+    case SurfaceBounds::eTrapezoid:
+      return makeBounds<Acts::TrapezoidBounds>(values);
+    default:
+      throw std::runtime_error("SurfaceSnapshot: invalid bounds type " +
+                               std::to_string(bType));
+  }
+}
+
+/// Cast the bounds to the type required by the surface
+template <typename bounds_t>
+std::shared_ptr<const bounds_t> castBounds(
+    const std::shared_ptr<const Acts::SurfaceBounds>& bounds) {
+  auto cBounds = std::dynamic_pointer_cast<const bounds_t>(bounds);
+  if (cBounds == nullptr) {
+    throw std::runtime_error(
+        "SurfaceSnapshot: bounds do not match the surface type");
+  }
+  return cBounds;
+}
+
+std::shared_ptr<Acts::Surface> makeSurface(
+    Acts::Surface::SurfaceType sType, const Acts::Transform3& transform,
+    const std::shared_ptr<const Acts::SurfaceBounds>& bounds) {
+  using Acts::Surface;
+  switch (sType) {
+    case Surface::Plane:
+      if (bounds == nullptr) {
+        return Surface::makeShared<Acts::PlaneSurface>(transform);
+      }
+      return Surface::makeShared<Acts::PlaneSurface>(
+          transform, castBounds<Acts::PlanarBounds>(bounds));
+    case Surface::Disc:
+      return Surface::makeShared<Acts::DiscSurface>(
+          transform, castBounds<Acts::DiscBounds>(bounds));
+    case Surface::Cylinder:
+      return Surface::makeShared<Acts::CylinderSurface>(
+          transform, castBounds<Acts::CylinderBounds>(bounds));
+    case Surface::Cone:
+      return Surface::makeShared<Acts::ConeSurface>(
+          transform, castBounds<Acts::ConeBounds>(bounds));
+    case Surface::Straw:
+      return Surface::makeShared<Acts::StrawSurface>(
+          transform, castBounds<Acts::LineBounds>(bounds));
+    case Surface::Perigee:
+      return Surface::makeShared<Acts::PerigeeSurface>(transform);
+    default:
+      throw std::runtime_error("SurfaceSnapshot: invalid surface type " +
+                               std::to_string(sType));
+  }
+}
+
+/// Whether the bounds are stored with the surface type
+bool hasBounds(const Acts::Surface& surface) {
+  switch (surface.type()) {
+    case Acts::Surface::Plane:
+      return surface.bounds().type() != Acts::SurfaceBounds::eBoundless;
+    case Acts::Surface::Disc:
+    case Acts::Surface::Cylinder:
+    case Acts::Surface::Cone:
+    case Acts::Surface::Straw:
+      return true;
+    case Acts::Surface::Perigee:
+      return false;
+    default:
+      throw std::invalid_argument(
+          "SurfaceSnapshot: unsupported surface type " +
+          std::to_string(surface.type()));
+  }
+}
+
+}  // namespace
+
+void Acts::SurfaceSnapshot::write(std::ostream& os,
+                                  const GeometryContext& gctx,
+                                  const std::vector<const Surface*>& surfaces) {
+  // collect the distinct bounds, identical bounds objects are shared
+  std::vector<const SurfaceBounds*> bounds;
+  std::unordered_map<const SurfaceBounds*, std::uint32_t> boundsIndices;
+  std::vector<std::uint32_t> surfaceBounds;
+  surfaceBounds.reserve(surfaces.size());
+  for (const Surface* surface : surfaces) {
+    if (!hasBounds(*surface)) {
+      surfaceBounds.push_back(s_noBoundsIndex);
+      continue;
+    }
+    const SurfaceBounds* sBounds = &surface->bounds();
+    auto [it, inserted] = boundsIndices.try_emplace(
+        sBounds, static_cast<std::uint32_t>(bounds.size()));
+    if (inserted) {
+      bounds.push_back(sBounds);
+    }
+    surfaceBounds.push_back(it->second);
+  }
+
+  os.write(s_magic.data(), s_magic.size());
+  put(os, s_version);
+
+  put(os, static_cast<std::uint64_t>(bounds.size()));
+  for (const SurfaceBounds* sBounds : bounds) {
+    const std::vector<double> values = sBounds->values();
+    put(os, static_cast<std::uint8_t>(sBounds->type()));
+    put(os, static_cast<std::uint8_t>(values.size()));
+    os.write(reinterpret_cast<const char*>(values.data()),
+             values.size() * sizeof(double));
+  }
+
+  put(os, static_cast<std::uint64_t>(surfaces.size()));
+  for (std::size_t i = 0; i < surfaces.size(); ++i) {
+    const Surface& surface = *surfaces[i];
+    put(os, surface.geometryId().value());
+    put(os, static_cast<std::uint8_t>(surface.type()));
+    put(os, surfaceBounds[i]);
+    const Eigen::Matrix<double, 3, 4> matrix =
+        surface.transform(gctx).matrix().topRows<3>();
+    os.write(reinterpret_cast<const char*>(matrix.data()),
+             matrix.size() * sizeof(double));
+  }
+
+  if (!os) {
+    throw std::runtime_error("SurfaceSnapshot: could not write the snapshot");
+  }
+}
+
+std::vector<std::shared_ptr<Acts::Surface>> Acts::SurfaceSnapshot::read(
+    const char* data, std::size_t size) {
+  Cursor cursor(data, size);
+
+  std::array<char, 8> magic{};
+  for (char& c : magic) {
+    c = cursor.get<char>();
+  }
+  if (magic != s_magic) {
+    throw std::runtime_error("SurfaceSnapshot: not a surface snapshot");
+  }
+  const auto version = cursor.get<std::uint32_t>();
+  if (version != s_version) {
+    throw std::runtime_error("SurfaceSnapshot: unsupported version " +
+                             std::to_string(version));
+  }
+
+  const auto nBounds = cursor.get<std::uint64_t>();
+  std::vector<std::shared_ptr<const SurfaceBounds>> bounds;
+  bounds.reserve(std::min<std::uint64_t>(nBounds, size));
+  std::vector<double> values;
+  for (std::uint64_t i = 0; i < nBounds; ++i) {
+    const auto bType =
+        static_cast<SurfaceBounds::BoundsType>(cursor.get<std::uint8_t>());
+    values.resize(cursor.get<std::uint8_t>());
+    for (double& value : values) {
+      value = cursor.get<double>();
+    }
+    bounds.push_back(makeBounds(bType, values));
+  }
+
+  const auto nSurfaces = cursor.get<std::uint64_t>();
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  surfaces.reserve(std::min<std::uint64_t>(nSurfaces, size));
+  for (std::uint64_t i = 0; i < nSurfaces; ++i) {
+    const GeometryIdentifier geoId(cursor.get<GeometryIdentifier::Value>());
+    const auto sType =
+        static_cast<Surface::SurfaceType>(cursor.get<std::uint8_t>());
+    const auto boundsIndex = cursor.get<std::uint32_t>();
+    if (boundsIndex != s_noBoundsIndex && boundsIndex >= bounds.size()) {
+      throw std::runtime_error("SurfaceSnapshot: invalid bounds index");
+    }
+    Eigen::Matrix<double, 3, 4> matrix;
+    for (Eigen::Index j = 0; j < matrix.size(); ++j) {
+      matrix.data()[j] = cursor.get<double>();
+    }
+    Transform3 transform = Transform3::Identity();
+    transform.matrix().topRows<3>() = matrix;
+
+    auto surface = makeSurface(
+        sType, transform,
+        boundsIndex == s_noBoundsIndex ? nullptr : bounds[boundsIndex]);
+    surface->assignGeometryId(geoId);
+    surfaces.push_back(std::move(surface));
+  }
+  return surfaces;
+}
+
+std::vector<std::shared_ptr<Acts::Surface>> Acts::SurfaceSnapshot::read(
+    std::istream& is) {
+  const std::vector<char> buffer((std::istreambuf_iterator<char>(is)),
+                                 std::istreambuf_iterator<char>());
+  return read(buffer.data(), buffer.size());
+}
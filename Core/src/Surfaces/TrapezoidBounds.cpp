@@ -11,6 +11,7 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Surfaces/ConvexPolygonBounds.hpp"
 
+#include <array>
 #include <iomanip>
 #include <iostream>
 
@@ -86,6 +87,51 @@ bool Acts::TrapezoidBounds::inside(const Acts::Vector2& lposition,
   return bcheck.isInside(extPosition, vertices);
 }
 
+void Acts::TrapezoidBounds::insideBatch(const Acts::Vector2* lpositions,
+                                        std::size_t n,
+                                        const Acts::BoundaryCheck& bcheck,
+                                        bool* results) const {
+  if (bcheck.type() != BoundaryCheck::Type::eAbsolute) {
+    SurfaceBounds::insideBatch(lpositions, n, bcheck, results);
+    return;
+  }
+
+  const double hlXnY = get(TrapezoidBounds::eHalfLengthXnegY);
+  const double hlXpY = get(TrapezoidBounds::eHalfLengthXposY);
+  const double hlY = get(TrapezoidBounds::eHalfLengthY);
+  const double hlXMin = std::min(hlXnY, hlXpY);
+  const double hlXMax = std::max(hlXnY, hlXpY);
+  const double tolX = bcheck.tolerance()[eBoundLoc0];
+  const double tolY = bcheck.tolerance()[eBoundLoc1];
+  // evaluate the rotation matrix once instead of once per position
+  const SquareMatrix2 rotation =
+      Eigen::Rotation2Dd(get(TrapezoidBounds::eRotationAngle))
+          .toRotationMatrix();
+
+  // (1) to (3): inside y and inside the minimum x bounds
+  for (std::size_t i = 0; i < n; ++i) {
+    const Vector2 extPosition = rotation * lpositions[i];
+    const double absX = std::abs(extPosition[0]);
+    const double absY = std::abs(extPosition[1]);
+    results[i] = ((absY - hlY) <= tolY) & ((absX - hlXMin) <= tolX);
+  }
+
+  // (4) and (5): only the positions inside the maximum x bounds can still be
+  // inside the triangles, they need the polygon check
+  const std::array<Vector2, 4> vertices = {
+      {{-hlXnY, -hlY}, {hlXnY, -hlY}, {hlXpY, hlY}, {-hlXpY, hlY}}};
+  for (std::size_t i = 0; i < n; ++i) {
+    if (results[i]) {
+      continue;
+    }
+    const Vector2 extPosition = rotation * lpositions[i];
+    if ((std::abs(extPosition[1]) - hlY) <= tolY &&
+        (std::abs(extPosition[0]) - hlXMax) <= tolX) {
+      results[i] = bcheck.isInside(extPosition, vertices);
+    }
+  }
+}
+
 std::vector<Acts::Vector2> Acts::TrapezoidBounds::vertices(
     unsigned int /*lseg*/) const {
   const double hlXnY = get(TrapezoidBounds::eHalfLengthXnegY);
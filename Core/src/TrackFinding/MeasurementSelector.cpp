@@ -12,6 +12,7 @@
 #include "Acts/EventData/MeasurementHelpers.hpp"
 
 #include <algorithm>
+#include <cstddef>
 
 namespace Acts {
 
@@ -64,4 +65,65 @@ double MeasurementSelector::calculateChi2(
       });
 }
 
+void MeasurementSelector::calculateChi2(
+    const double* const* fullCalibrated,
+    const double* const* fullCalibratedCovariance, std::size_t size,
+    TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                     false>::Parameters predicted,
+    TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                     false>::Covariance predictedCovariance,
+    TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
+                     false>::Projector projector,
+    unsigned int calibratedSize, double* chi2) const {
+  visit_measurement(calibratedSize, [&](auto N) {
+    constexpr std::size_t kMeasurementSize = decltype(N)::value;
+
+    using ParametersVector = ActsVector<kMeasurementSize>;
+    using CovarianceMatrix = ActsSquareMatrix<kMeasurementSize>;
+
+    // Project the predicted state once for all measurements
+    const auto H =
+        projector.template topLeftCorner<kMeasurementSize, eBoundSize>()
+            .eval();
+    const ParametersVector projected = H * predicted;
+    const CovarianceMatrix projectedCovariance =
+        H * predictedCovariance * H.transpose();
+
+    // The inverse of the residual covariance is written out for one and two
+    // dimensions, which are the strip and pixel measurements
+    if constexpr (kMeasurementSize == 1) {
+      for (std::size_t i = 0; i < size; ++i) {
+        const double res = fullCalibrated[i][0] - projected[0];
+        chi2[i] = res * res /
+                  (fullCalibratedCovariance[i][0] + projectedCovariance(0, 0));
+      }
+    } else if constexpr (kMeasurementSize == 2) {
+      for (std::size_t i = 0; i < size; ++i) {
+        const double* cov = fullCalibratedCovariance[i];
+        const double r0 = fullCalibrated[i][0] - projected[0];
+        const double r1 = fullCalibrated[i][1] - projected[1];
+        // the covariance is stored column major
+        const double s00 = cov[0] + projectedCovariance(0, 0);
+        const double s01 = cov[2] + projectedCovariance(0, 1);
+        const double s10 = cov[1] + projectedCovariance(1, 0);
+        const double s11 = cov[3] + projectedCovariance(1, 1);
+        chi2[i] = (r0 * r0 * s11 - r0 * r1 * (s01 + s10) + r1 * r1 * s00) /
+                  (s00 * s11 - s01 * s10);
+      }
+    } else {
+      for (std::size_t i = 0; i < size; ++i) {
+        typename TrackStateTraits<kMeasurementSize, true>::Measurement
+            calibrated{fullCalibrated[i]};
+        typename TrackStateTraits<kMeasurementSize, true>::MeasurementCovariance
+            calibratedCovariance{fullCalibratedCovariance[i]};
+
+        ParametersVector res = calibrated - projected;
+        chi2[i] = (res.transpose() *
+                   (calibratedCovariance + projectedCovariance).inverse() * res)
+                      .eval()(0, 0);
+      }
+    }
+  });
+}
+
 }  // namespace Acts
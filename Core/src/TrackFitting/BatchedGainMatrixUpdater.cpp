@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/TrackFitting/BatchedGainMatrixUpdater.hpp"
+
+#include <cmath>
+
+namespace Acts {
+
+namespace {
+
+constexpr std::size_t kBound = eBoundSize;
+
+/// Gain matrix update of all track states of a batch with a fixed
+/// measurement dimension. Every access is component * n + t and the inner
+/// loops run over the track states t, such that they read and write
+/// contiguous memory and can be vectorised.
+template <std::size_t kMeasurementSize>
+void updateBatch(BatchedGainMatrixUpdater::Batch& batch) {
+  constexpr std::size_t N = kMeasurementSize;
+  const std::size_t n = batch.size;
+
+  double* x = batch.parameters.data();
+  double* P = batch.covariance.data();
+  const double* PHt = batch.covarianceColumns.data();
+  const double* HP = batch.covarianceRows.data();
+  const double* HPHt = batch.projectedCovariance.data();
+  const double* V = batch.measurementCovariance.data();
+  const double* r = batch.residual.data();
+  double* Sinv = batch.inverseResidualCovariance.data();
+  double* K = batch.gain.data();
+  double* chi2 = batch.chi2.data();
+
+  // inverse of the residual covariance S = H P H^T + V
+  if constexpr (N == 1) {
+    for (std::size_t t = 0; t < n; ++t) {
+      Sinv[t] = 1 / (HPHt[t] + V[t]);
+    }
+  } else {
+    for (std::size_t t = 0; t < n; ++t) {
+      const double s00 = HPHt[0 * n + t] + V[0 * n + t];
+      const double s01 = HPHt[1 * n + t] + V[1 * n + t];
+      const double s10 = HPHt[2 * n + t] + V[2 * n + t];
+      const double s11 = HPHt[3 * n + t] + V[3 * n + t];
+      const double invDet = 1 / (s00 * s11 - s01 * s10);
+      Sinv[0 * n + t] = s11 * invDet;
+      Sinv[1 * n + t] = -s01 * invDet;
+      Sinv[2 * n + t] = -s10 * invDet;
+      Sinv[3 * n + t] = s00 * invDet;
+    }
+  }
+
+  // gain matrix K = P H^T S^-1
+  for (std::size_t i = 0; i < kBound; ++i) {
+    for (std::size_t l = 0; l < N; ++l) {
+      double* Kil = K + (i * N + l) * n;
+      for (std::size_t t = 0; t < n; ++t) {
+        Kil[t] = 0;
+      }
+      for (std::size_t k = 0; k < N; ++k) {
+        const double* PHtik = PHt + (i * N + k) * n;
+        const double* Sinvkl = Sinv + (k * N + l) * n;
+        for (std::size_t t = 0; t < n; ++t) {
+          Kil[t] += PHtik[t] * Sinvkl[t];
+        }
+      }
+    }
+  }
+
+  // filtered parameters x + K r and covariance P - K H P
+  for (std::size_t i = 0; i < kBound; ++i) {
+    for (std::size_t k = 0; k < N; ++k) {
+      const double* Kik = K + (i * N + k) * n;
+      const double* rk = r + k * n;
+      double* xi = x + i * n;
+      for (std::size_t t = 0; t < n; ++t) {
+        xi[t] += Kik[t] * rk[t];
+      }
+      for (std::size_t j = 0; j < kBound; ++j) {
+        const double* HPkj = HP + (k * kBound + j) * n;
+        double* Pij = P + (i * kBound + j) * n;
+        for (std::size_t t = 0; t < n; ++t) {
+          Pij[t] -= Kik[t] * HPkj[t];
+        }
+      }
+    }
+  }
+
+  // chi2 of the predicted residual, r^T S^-1 r, which is identical to the
+  // one of the filtered residual with its covariance
+  for (std::size_t t = 0; t < n; ++t) {
+    chi2[t] = 0;
+  }
+  for (std::size_t k = 0; k < N; ++k) {
+    for (std::size_t l = 0; l < N; ++l) {
+      const double* rk = r + k * n;
+      const double* rl = r + l * n;
+      const double* Sinvkl = Sinv + (k * N + l) * n;
+      for (std::size_t t = 0; t < n; ++t) {
+        chi2[t] += rk[t] * Sinvkl[t] * rl[t];
+      }
+    }
+  }
+
+  // a singular residual covariance results in a non-finite chi2
+  for (std::size_t t = 0; t < n; ++t) {
+    batch.valid[t] = static_cast<std::uint8_t>(std::isfinite(chi2[t]));
+  }
+}
+
+}  // namespace
+
+void BatchedGainMatrixUpdater::Batch::resize(std::size_t dim, std::size_t n) {
+  measurementSize = dim;
+  size = n;
+  parameters.resize(kBound * n);
+  covariance.resize(kBound * kBound * n);
+  covarianceColumns.resize(kBound * dim * n);
+  covarianceRows.resize(kBound * dim * n);
+  projectedCovariance.resize(dim * dim * n);
+  measurementCovariance.resize(dim * dim * n);
+  residual.resize(dim * n);
+  inverseResidualCovariance.resize(dim * dim * n);
+  gain.resize(kBound * dim * n);
+  chi2.resize(n);
+  valid.resize(n);
+}
+
+void BatchedGainMatrixUpdater::update(Batch& batch) {
+  if (batch.measurementSize == 1) {
+    updateBatch<1>(batch);
+  } else if (batch.measurementSize == 2) {
+    updateBatch<2>(batch);
+  }
+}
+
+}  // namespace Acts
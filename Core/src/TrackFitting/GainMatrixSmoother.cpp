@@ -16,6 +16,8 @@
 #include <ostream>
 #include <utility>
 
+#include <Eigen/Cholesky>
+
 namespace Acts {
 
 Result<void> GainMatrixSmoother::calculate(
@@ -89,4 +91,80 @@ Result<void> GainMatrixSmoother::calculate(
   return Result<void>::success();
 }
 
+Result<void> GainMatrixSmoother::calculateSinglePrecision(
+    void* ts, void* prev_ts, const GetParameters& filtered,
+    const GetCovariance& filteredCovariance, const GetParameters& smoothed,
+    const GetParameters& predicted, const GetCovariance& predictedCovariance,
+    const GetCovariance& smoothedCovariance, const GetCovariance& jacobian,
+    const Logger& logger) const {
+  using FloatBoundVector = Eigen::Matrix<float, eBoundSize, 1>;
+  using FloatBoundMatrix = Eigen::Matrix<float, eBoundSize, eBoundSize>;
+
+  auto fallback = [&](const char* reason) {
+    ACTS_VERBOSE(reason << ", use double precision");
+    return calculate(ts, prev_ts, filtered, filteredCovariance, smoothed,
+                     predicted, predictedCovariance, smoothedCovariance,
+                     jacobian, logger);
+  };
+
+  // Scale the filtered covariance of this state and the predicted
+  // covariance of the previous one to unit diagonal, the Jacobian and the
+  // differences of the previous state are scaled accordingly
+  const BoundVector dCurrent = filteredCovariance(ts).diagonal().cwiseSqrt();
+  const BoundVector dPrevious =
+      predictedCovariance(prev_ts).diagonal().cwiseSqrt();
+  if (!((dCurrent.array() > 0).all() && (dPrevious.array() > 0).all() &&
+        dCurrent.allFinite() && dPrevious.allFinite())) {
+    return fallback("Covariance cannot be scaled to unit diagonal");
+  }
+  const BoundVector dPreviousInv = dPrevious.cwiseInverse();
+
+  const FloatBoundMatrix C =
+      (dCurrent.cwiseInverse().asDiagonal() * filteredCovariance(ts) *
+       dCurrent.cwiseInverse().asDiagonal())
+          .cast<float>();
+  const FloatBoundMatrix J = (dPreviousInv.asDiagonal() * jacobian(prev_ts) *
+                              dCurrent.asDiagonal())
+                                 .cast<float>();
+  const Eigen::LLT<FloatBoundMatrix> predictedLLT(
+      (dPreviousInv.asDiagonal() * predictedCovariance(prev_ts) *
+       dPreviousInv.asDiagonal())
+          .cast<float>());
+  if (predictedLLT.info() != Eigen::Success) {
+    return fallback("Predicted covariance is not positive definite");
+  }
+
+  // Gain smoothing matrix G = C J^T P^-1 = (P^-1 J C)^T
+  const FloatBoundMatrix G = predictedLLT.solve(J * C).transpose();
+  if (G.hasNaN()) {
+    return fallback("Gain smoothing matrix G has NaNs");
+  }
+
+  const FloatBoundVector deltaParameters =
+      dPreviousInv.cwiseProduct(smoothed(prev_ts) - predicted(prev_ts))
+          .cast<float>();
+  const FloatBoundMatrix deltaCovariance =
+      (dPreviousInv.asDiagonal() *
+       (smoothedCovariance(prev_ts) - predictedCovariance(prev_ts)) *
+       dPreviousInv.asDiagonal())
+          .cast<float>();
+
+  const FloatBoundMatrix S = C + G * deltaCovariance * G.transpose();
+  const FloatBoundMatrix covariance = 0.5f * (S + S.transpose());
+  if (covariance.hasNaN() || (covariance.diagonal().array() <= 0).any()) {
+    return fallback("Smoothed covariance is not positive definite");
+  }
+
+  smoothed(ts) =
+      filtered(ts) +
+      dCurrent.cwiseProduct((G * deltaParameters).cast<double>());
+  smoothedCovariance(ts) = dCurrent.asDiagonal() * covariance.cast<double>() *
+                           dCurrent.asDiagonal();
+
+  ACTS_VERBOSE("Smoothed parameters are: " << smoothed(ts).transpose());
+  ACTS_VERBOSE("Smoothed covariance is: \n" << smoothedCovariance(ts));
+
+  return Result<void>::success();
+}
+
 }  // namespace Acts
@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <utility>
 
+#include <Eigen/Cholesky>
 #include <Eigen/src/Core/MatrixBase.h>
 
 namespace Acts {
@@ -94,4 +95,108 @@ std::tuple<double, std::error_code> GainMatrixUpdater::visitMeasurement(
   return {chi2, error};
 }
 
+std::tuple<double, std::error_code>
+GainMatrixUpdater::visitMeasurementSinglePrecision(
+    InternalTrackState trackState, Direction direction,
+    const Logger& logger) const {
+  bool success = false;
+  double chi2 = 0;
+
+  visit_measurement(trackState.calibratedSize, [&](auto N) -> bool {
+    constexpr std::size_t kMeasurementSize = decltype(N)::value;
+    using ParametersVector = ActsVector<kMeasurementSize>;
+    using FloatBoundVector = Eigen::Matrix<float, eBoundSize, 1>;
+    using FloatBoundMatrix = Eigen::Matrix<float, eBoundSize, eBoundSize>;
+    using FloatParametersVector = Eigen::Matrix<float, kMeasurementSize, 1>;
+    using FloatCovarianceMatrix =
+        Eigen::Matrix<float, kMeasurementSize, kMeasurementSize>;
+    using FloatProjector = Eigen::Matrix<float, kMeasurementSize, eBoundSize>;
+
+    typename TrackStateTraits<kMeasurementSize, true>::Measurement calibrated{
+        trackState.calibrated};
+    typename TrackStateTraits<kMeasurementSize, true>::MeasurementCovariance
+        calibratedCovariance{trackState.calibratedCovariance};
+
+    const auto H = trackState.projector
+                       .template topLeftCorner<kMeasurementSize, eBoundSize>()
+                       .eval();
+
+    // The bound parameters span many orders of magnitude, e.g. q/p against
+    // the local positions. The covariances are therefore scaled to unit
+    // diagonal before the conversion, such that single precision resolves
+    // the correlations, and the results are scaled back in double precision.
+    const BoundVector d = trackState.predictedCovariance.diagonal().cwiseSqrt();
+    const ParametersVector residual = calibrated - H * trackState.predicted;
+    const ParametersVector m =
+        (H * trackState.predictedCovariance * H.transpose() +
+         calibratedCovariance)
+            .diagonal()
+            .cwiseSqrt()
+            .cwiseInverse();
+    if (!((d.array() > 0).all() && (m.array() > 0).all() && d.allFinite() &&
+          m.allFinite())) {
+      ACTS_VERBOSE("Covariance cannot be scaled to unit diagonal");
+      return false;
+    }
+    const BoundVector dInv = d.cwiseInverse();
+
+    const FloatBoundMatrix P = (dInv.asDiagonal() *
+                                trackState.predictedCovariance *
+                                dInv.asDiagonal())
+                                   .template cast<float>();
+    const FloatProjector Hs =
+        (m.asDiagonal() * H * d.asDiagonal()).template cast<float>();
+    const FloatCovarianceMatrix V =
+        (m.asDiagonal() * calibratedCovariance * m.asDiagonal())
+            .template cast<float>();
+    const FloatParametersVector r =
+        m.cwiseProduct(residual).template cast<float>();
+
+    // Residual covariance, its decomposition fails if it is not positive
+    // definite in single precision
+    const Eigen::Matrix<float, eBoundSize, kMeasurementSize> PHt =
+        P * Hs.transpose();
+    const Eigen::LLT<FloatCovarianceMatrix> S(Hs * PHt + V);
+    if (S.info() != Eigen::Success) {
+      ACTS_VERBOSE("Residual covariance is not positive definite");
+      return false;
+    }
+
+    // K = P H^T S^-1, with S symmetric
+    const Eigen::Matrix<float, eBoundSize, kMeasurementSize> K =
+        S.solve(PHt.transpose()).transpose();
+    const FloatBoundMatrix C = P - K * PHt.transpose();
+    const FloatBoundMatrix filteredCovariance = 0.5f * (C + C.transpose());
+    if (K.hasNaN() || filteredCovariance.hasNaN() ||
+        (filteredCovariance.diagonal().array() <= 0).any()) {
+      ACTS_VERBOSE("Filtered covariance is not positive definite");
+      return false;
+    }
+    const FloatBoundVector delta = K * r;
+
+    trackState.filtered = trackState.predicted +
+                          d.cwiseProduct(delta.template cast<double>());
+    trackState.filteredCovariance = d.asDiagonal() *
+                                    filteredCovariance.template cast<double>() *
+                                    d.asDiagonal();
+    ACTS_VERBOSE("Filtered parameters: " << trackState.filtered.transpose());
+    ACTS_VERBOSE("Filtered covariance:\n" << trackState.filteredCovariance);
+
+    // The chi2 of the filtered residual with its covariance equals the one
+    // of the predicted residual with S
+    chi2 = static_cast<double>(r.dot(S.solve(r)));
+
+    ACTS_VERBOSE("Chi2: " << chi2);
+    success = true;
+    return true;
+  });
+
+  if (!success) {
+    ACTS_VERBOSE("Single precision update failed, use double precision");
+    return visitMeasurement(trackState, direction, logger);
+  }
+
+  return {chi2, std::error_code{}};
+}
+
 }  // namespace Acts
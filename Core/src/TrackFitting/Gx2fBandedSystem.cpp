@@ -0,0 +1,185 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/TrackFitting/Gx2fBandedSystem.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <Eigen/Cholesky>
+
+namespace Acts::Experimental {
+
+Gx2fBandedSystem::Gx2fBandedSystem(std::size_t nBlocks, std::size_t blockSize,
+                                   std::size_t bandwidth)
+    : m_nBlocks(nBlocks),
+      m_blockSize(blockSize),
+      m_bandwidth(std::min(bandwidth, nBlocks == 0 ? 0 : nBlocks - 1)) {
+  if (nBlocks == 0 || blockSize == 0) {
+    throw std::invalid_argument("Banded system without unknowns");
+  }
+  // Blocks above the first row of the matrix are allocated as well to keep
+  // the indexing simple, they are never touched
+  m_aBlocks.assign(m_nBlocks * (m_bandwidth + 1),
+                   Matrix::Zero(m_blockSize, m_blockSize));
+  m_bVector = Vector::Zero(size());
+}
+
+std::size_t Gx2fBandedSystem::addMeasurement(std::size_t firstBlock,
+                                             const Vector& jacobian,
+                                             ActsScalar residual,
+                                             ActsScalar variance) {
+  const std::size_t span = jacobian.size() / m_blockSize;
+  if (jacobian.size() == 0 ||
+      static_cast<std::size_t>(jacobian.size()) != span * m_blockSize ||
+      span > m_bandwidth + 1 || firstBlock + span > m_nBlocks) {
+    throw std::invalid_argument("Measurement does not fit into the band");
+  }
+  if (!(variance > 0)) {
+    throw std::invalid_argument("Measurement variance is not positive");
+  }
+  Measurement& measurement = m_measurements.emplace_back();
+  measurement.firstBlock = firstBlock;
+  measurement.jacobian = jacobian;
+  measurement.residual = residual;
+  measurement.variance = variance;
+  measurement.active = true;
+  accumulate(measurement, 1);
+  return m_measurements.size() - 1;
+}
+
+void Gx2fBandedSystem::updateMeasurement(std::size_t index,
+                                         const Vector& jacobian,
+                                         ActsScalar residual,
+                                         ActsScalar variance) {
+  Measurement& measurement = m_measurements.at(index);
+  if (jacobian.size() != measurement.jacobian.size()) {
+    throw std::invalid_argument("Measurement changed its number of blocks");
+  }
+  if (!(variance > 0)) {
+    throw std::invalid_argument("Measurement variance is not positive");
+  }
+  if (measurement.active) {
+    accumulate(measurement, -1);
+  }
+  measurement.jacobian = jacobian;
+  measurement.residual = residual;
+  measurement.variance = variance;
+  measurement.active = true;
+  accumulate(measurement, 1);
+}
+
+void Gx2fBandedSystem::removeMeasurement(std::size_t index) {
+  Measurement& measurement = m_measurements.at(index);
+  if (measurement.active) {
+    accumulate(measurement, -1);
+    measurement.active = false;
+  }
+}
+
+void Gx2fBandedSystem::rebuild() {
+  for (auto& a : m_aBlocks) {
+    a.setZero();
+  }
+  m_bVector.setZero();
+  m_chi2 = 0;
+  for (const auto& measurement : m_measurements) {
+    if (measurement.active) {
+      accumulate(measurement, 1);
+    }
+  }
+}
+
+void Gx2fBandedSystem::accumulate(const Measurement& measurement,
+                                  ActsScalar sign) {
+  const std::size_t span = measurement.jacobian.size() / m_blockSize;
+  const ActsScalar weight = sign / measurement.variance;
+  const std::size_t n = m_blockSize;
+
+  for (std::size_t bi = 0; bi < span; ++bi) {
+    const auto ji = measurement.jacobian.segment(bi * n, n);
+    const std::size_t i = measurement.firstBlock + bi;
+    m_bVector.segment(i * n, n) += ji * (weight * measurement.residual);
+    // only the lower triangle of the band is stored
+    for (std::size_t bj = 0; bj <= bi; ++bj) {
+      const auto jj = measurement.jacobian.segment(bj * n, n);
+      const std::size_t j = measurement.firstBlock + bj;
+      block(m_aBlocks, i, j).noalias() += ji * (weight * jj.transpose());
+    }
+  }
+  m_chi2 += weight * measurement.residual * measurement.residual;
+}
+
+Gx2fBandedSystem::Matrix Gx2fBandedSystem::denseMatrix() const {
+  const std::size_t n = m_blockSize;
+  Matrix dense = Matrix::Zero(size(), size());
+  for (std::size_t i = 0; i < m_nBlocks; ++i) {
+    for (std::size_t j = i - std::min(i, m_bandwidth); j <= i; ++j) {
+      const Matrix& a = block(m_aBlocks, i, j);
+      dense.block(i * n, j * n, n, n) = a;
+      if (i != j) {
+        dense.block(j * n, i * n, n, n) = a.transpose();
+      }
+    }
+  }
+  return dense;
+}
+
+std::optional<Gx2fBandedSystem::Vector> Gx2fBandedSystem::solve() const {
+  const std::size_t n = m_blockSize;
+  const std::size_t w = m_bandwidth;
+
+  // Block Cholesky decomposition a = L L^T. The factor L has the same band
+  // structure as a, i.e. no fill-in outside the band.
+  std::vector<Matrix> factor = m_aBlocks;
+  std::vector<Eigen::LLT<Matrix>> diagonal;
+  diagonal.reserve(m_nBlocks);
+
+  for (std::size_t i = 0; i < m_nBlocks; ++i) {
+    const std::size_t first = i - std::min(i, w);
+    for (std::size_t j = first; j <= i; ++j) {
+      Matrix& lij = block(factor, i, j);
+      for (std::size_t k = std::max(first, j - std::min(j, w)); k < j; ++k) {
+        lij.noalias() -= block(factor, i, k) * block(factor, j, k).transpose();
+      }
+      if (j < i) {
+        // L(i,j) = S(i,j) L(j,j)^-T
+        lij = diagonal[j].matrixL().solve(lij.transpose()).transpose();
+      }
+    }
+    diagonal.emplace_back(block(factor, i, i));
+    if (diagonal.back().info() != Eigen::Success) {
+      return std::nullopt;
+    }
+  }
+
+  // Forward substitution L y = b
+  Vector solution = m_bVector;
+  for (std::size_t i = 0; i < m_nBlocks; ++i) {
+    auto yi = solution.segment(i * n, n);
+    for (std::size_t j = i - std::min(i, w); j < i; ++j) {
+      yi.noalias() -= block(factor, i, j) * solution.segment(j * n, n);
+    }
+    diagonal[i].matrixL().solveInPlace(yi);
+  }
+
+  // Backward substitution L^T x = y
+  for (std::size_t i = m_nBlocks; i-- > 0;) {
+    auto xi = solution.segment(i * n, n);
+    const std::size_t last = std::min(m_nBlocks - 1, i + w);
+    for (std::size_t j = i + 1; j <= last; ++j) {
+      xi.noalias() -= block(factor, j, i).transpose() *
+                      solution.segment(j * n, n);
+    }
+    diagonal[i].matrixU().solveInPlace(xi);
+  }
+
+  return solution;
+}
+
+}  // namespace Acts::Experimental
@@ -50,6 +50,29 @@ double Acts::AnnealingUtility::getWeight(
   return num / denom;
 }
 
+void Acts::AnnealingUtility::getWeights(
+    State& state, const std::vector<double>& allChi2,
+    const std::vector<std::size_t>& offsets,
+    std::vector<double>& weights) const {
+  unsigned int idx = state.currentTemperatureIndex;
+  const double currentInvTemp = 1. / (2. * m_cfg.setOfTemperatures[idx]);
+
+  weights.resize(allChi2.size());
+  for (std::size_t i = 0; i < allChi2.size(); ++i) {
+    weights[i] = computeAnnealingWeight(allChi2[i], currentInvTemp);
+  }
+
+  for (std::size_t iTrack = 0; iTrack + 1 < offsets.size(); ++iTrack) {
+    double denom = m_gaussCutTempVec[idx];
+    for (std::size_t i = offsets[iTrack]; i < offsets[iTrack + 1]; ++i) {
+      denom += weights[i];
+    }
+    for (std::size_t i = offsets[iTrack]; i < offsets[iTrack + 1]; ++i) {
+      weights[i] /= denom;
+    }
+  }
+}
+
 double Acts::AnnealingUtility::getWeight(State& state, double chi2) const {
   // Calculate 1/denominator in exp function
   const double currentInvTemp =
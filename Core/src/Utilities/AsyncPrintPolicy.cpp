@@ -0,0 +1,291 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/AsyncPrintPolicy.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+namespace Logging {
+
+namespace {
+
+/// Index of the calling thread, assigned on first use
+std::size_t threadIndex() {
+  static std::atomic<std::size_t> counter{0};
+  thread_local const std::size_t index = counter.fetch_add(1);
+  return index;
+}
+
+}  // namespace
+
+class AsyncPrintPolicy::Backend {
+ public:
+  explicit Backend(const Config& cfg) : m_cfg(cfg) {
+    const std::size_t nBuffers = std::max<std::size_t>(m_cfg.nBuffers, 1);
+    // The sequence numbers cannot tell a full from an empty single cell
+    const std::size_t bufferSize = std::max<std::size_t>(m_cfg.bufferSize, 2);
+    m_buffers.reserve(nBuffers);
+    for (std::size_t i = 0; i < nBuffers; ++i) {
+      m_buffers.push_back(std::make_unique<RingBuffer>(bufferSize));
+    }
+    m_thread = std::thread([this]() { run(); });
+  }
+
+  ~Backend() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+  }
+
+  Backend(const Backend&) = delete;
+  Backend& operator=(const Backend&) = delete;
+
+  /// Queue a message for the sink thread
+  void push(OutputPrintPolicy& target, const Level& lvl,
+            const std::string& text) {
+    RingBuffer& buffer = *m_buffers[threadIndex() % m_buffers.size()];
+    // The only copy of the text, it is moved into the ring buffer
+    Message message{&target, lvl, text};
+    while (!buffer.push(message)) {
+      if (m_cfg.dropWhenFull) {
+        m_nDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      m_cv.notify_all();
+      std::this_thread::yield();
+    }
+  }
+
+  /// Print a message in the calling thread after all pending messages
+  void printSynchronous(OutputPrintPolicy& target, const Level& lvl,
+                        const std::string& text) {
+    waitForFlush();
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    target.flush(lvl, text);
+  }
+
+  /// Block until all the messages queued so far are printed
+  void waitForFlush() {
+    if (std::this_thread::get_id() == m_thread.get_id()) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // The pass running now may have missed messages, the next one will not
+    const std::size_t target = m_nPasses + 2;
+    ++m_nWaiting;
+    m_cv.notify_all();
+    m_cv.wait(lock, [&]() { return m_nPasses >= target; });
+    --m_nWaiting;
+  }
+
+  std::size_t nDropped() const {
+    return m_nDropped.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Message {
+    OutputPrintPolicy* target = nullptr;
+    Level level = Level::INFO;
+    std::string text;
+  };
+
+  /// Bounded lock-free queue with multiple producers and a single consumer
+  class RingBuffer {
+   public:
+    explicit RingBuffer(std::size_t size) : m_cells(size) {
+      for (std::size_t i = 0; i < size; ++i) {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    /// Try to add a message, the message is only moved from on success
+    bool push(Message& message) {
+      std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+      while (true) {
+        Cell& cell = m_cells[pos % m_cells.size()];
+        const std::size_t sequence =
+            cell.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(sequence) -
+                          static_cast<std::intptr_t>(pos);
+        if (diff == 0) {
+          if (m_enqueuePos.compare_exchange_weak(pos, pos + 1,
+                                                 std::memory_order_relaxed)) {
+            cell.message = std::move(message);
+            cell.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0) {
+          // The cell still holds a message of the previous round
+          return false;
+        } else {
+          pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /// Try to take the oldest message, only called from the sink thread
+    bool pop(Message& message) {
+      Cell& cell = m_cells[m_dequeuePos % m_cells.size()];
+      if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+        return false;
+      }
+      message = std::move(cell.message);
+      cell.sequence.store(m_dequeuePos + m_cells.size(),
+                          std::memory_order_release);
+      ++m_dequeuePos;
+      return true;
+    }
+
+   private:
+    struct Cell {
+      std::atomic<std::size_t> sequence{0};
+      Message message;
+    };
+
+    std::vector<Cell> m_cells;
+    alignas(64) std::atomic<std::size_t> m_enqueuePos{0};
+    alignas(64) std::size_t m_dequeuePos = 0;
+  };
+
+  /// Main loop of the sink thread
+  void run() {
+    while (true) {
+      const bool printed = drain();
+      bool stop = false;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_nPasses;
+        stop = m_stop;
+      }
+      m_cv.notify_all();
+      if (stop) {
+        if (!printed) {
+          return;
+        }
+        continue;
+      }
+      if (!printed) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait_for(lock, m_cfg.pollInterval,
+                      [&]() { return m_stop || m_nWaiting > 0; });
+      }
+    }
+  }
+
+  /// Print all queued messages, returns whether there were any
+  bool drain() {
+    bool printed = false;
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    Message message;
+    for (auto& buffer : m_buffers) {
+      while (buffer->pop(message)) {
+        printed = true;
+        try {
+          message.target->flush(message.level, message.text);
+        } catch (const std::exception& e) {
+          std::cerr << "AsyncPrintPolicy: failed to print message: "
+                    << e.what() << std::endl;
+        }
+      }
+    }
+    return printed;
+  }
+
+  Config m_cfg;
+  std::vector<std::unique_ptr<RingBuffer>> m_buffers;
+  std::atomic<std::size_t> m_nDropped{0};
+
+  /// serialises the calls of the wrapped print policies
+  std::mutex m_sinkMutex;
+
+  /// protects the bookkeeping of the sink thread below
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::size_t m_nPasses = 0;
+  std::size_t m_nWaiting = 0;
+  bool m_stop = false;
+
+  std::thread m_thread;
+};
+
+AsyncPrintPolicy::AsyncPrintPolicy(std::unique_ptr<OutputPrintPolicy> wrappee,
+                                   const Config& cfg)
+    : OutputDecorator(std::move(wrappee)),
+      m_backend(std::make_shared<Backend>(cfg)) {}
+
+AsyncPrintPolicy::AsyncPrintPolicy(std::unique_ptr<OutputPrintPolicy> wrappee)
+    : AsyncPrintPolicy(std::move(wrappee), Config{}) {}
+
+AsyncPrintPolicy::AsyncPrintPolicy(std::unique_ptr<OutputPrintPolicy> wrappee,
+                                   const AsyncPrintPolicy& other)
+    : OutputDecorator(std::move(wrappee)), m_backend(other.m_backend) {}
+
+AsyncPrintPolicy::~AsyncPrintPolicy() {
+  // The sink thread must not access the wrappee after its destruction
+  m_backend->waitForFlush();
+}
+
+void AsyncPrintPolicy::flush(const Level& lvl, const std::string& input) {
+  if (lvl >= getFailureThreshold()) {
+    m_backend->printSynchronous(*m_wrappee, lvl, input);
+  } else {
+    m_backend->push(*m_wrappee, lvl, input);
+  }
+}
+
+std::unique_ptr<OutputPrintPolicy> AsyncPrintPolicy::clone(
+    const std::string& name) const {
+  return std::make_unique<AsyncPrintPolicy>(m_wrappee->clone(name), *this);
+}
+
+void AsyncPrintPolicy::waitForFlush() const {
+  m_backend->waitForFlush();
+}
+
+std::size_t AsyncPrintPolicy::nDropped() const {
+  return m_backend->nDropped();
+}
+
+}  // namespace Logging
+
+std::unique_ptr<const Logger> getDefaultAsyncLogger(
+    const std::string& name, const Logging::Level& lvl,
+    std::ostream* log_stream) {
+  using namespace Logging;
+  // Only provides the sink thread shared by all default asynchronous loggers.
+  // The thread is started on the first call. Every logger holds a reference
+  // to the backend, so it is joined when both this static and the last
+  // logger are destroyed.
+  static const AsyncPrintPolicy shared(
+      std::make_unique<DefaultPrintPolicy>(&std::cout));
+  // The decorators format the message in the logging thread, only the
+  // finished string is queued
+  auto output = std::make_unique<LevelOutputDecorator>(
+      std::make_unique<NamedOutputDecorator>(
+          std::make_unique<TimedOutputDecorator>(
+              std::make_unique<AsyncPrintPolicy>(
+                  std::make_unique<DefaultPrintPolicy>(log_stream), shared)),
+          name));
+  auto print = std::make_unique<DefaultFilterPolicy>(lvl);
+  return std::make_unique<const Logger>(std::move(output), std::move(print));
+}
+
+}  // namespace Acts
@@ -0,0 +1,84 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/MappedFile.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Acts {
+
+MappedFile::MappedFile(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Unable to open " + path + ": " +
+                             std::strerror(errno));
+  }
+  struct stat status {};
+  if (::fstat(fd, &status) != 0) {
+    int error = errno;
+    ::close(fd);
+    throw std::runtime_error("Unable to read the size of " + path + ": " +
+                             std::strerror(error));
+  }
+  std::size_t size = static_cast<std::size_t>(status.st_size);
+  // an empty file can not be mapped
+  if (size > 0) {
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+      int error = errno;
+      ::close(fd);
+      throw std::runtime_error("Unable to map " + path + ": " +
+                               std::strerror(error));
+    }
+    m_data = static_cast<const std::byte*>(data);
+    m_size = size;
+  }
+  // the mapping keeps the file alive
+  ::close(fd);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data{std::exchange(other.m_data, nullptr)},
+      m_size{std::exchange(other.m_size, 0)} {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    unmap();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile() {
+  unmap();
+}
+
+void MappedFile::prefetch() const {
+  if (m_data != nullptr) {
+    ::madvise(const_cast<std::byte*>(m_data), m_size, MADV_WILLNEED);
+  }
+}
+
+void MappedFile::unmap() {
+  if (m_data != nullptr) {
+    ::munmap(const_cast<std::byte*>(m_data), m_size);
+    m_data = nullptr;
+    m_size = 0;
+  }
+}
+
+}  // namespace Acts
@@ -0,0 +1,105 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<std::size_t> s_maxThreads{1};
+// The threads started by all running parallelFor calls, without the callers
+std::atomic<std::size_t> s_extraThreads{0};
+
+/// Reserve up to the requested number of additional threads
+std::size_t acquireThreads(std::size_t requested) {
+  std::size_t used = s_extraThreads.load();
+  std::size_t granted = 0;
+  do {
+    const std::size_t limit = s_maxThreads.load() - 1;
+    granted = (used < limit) ? std::min(requested, limit - used) : 0;
+    if (granted == 0) {
+      return 0;
+    }
+  } while (!s_extraThreads.compare_exchange_weak(used, used + granted));
+  return granted;
+}
+
+/// Give the reserved threads back to the budget when going out of scope
+struct ThreadReservation {
+  std::size_t n;
+  ~ThreadReservation() { s_extraThreads -= n; }
+};
+
+}  // namespace
+
+void Acts::setMaxThreads(std::size_t maxThreads) {
+  if (maxThreads == 0) {
+    maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  s_maxThreads = maxThreads;
+}
+
+std::size_t Acts::maxThreads() {
+  return s_maxThreads;
+}
+
+void Acts::parallelFor(std::size_t n,
+                       const std::function<void(std::size_t)>& task) {
+  const std::size_t nExtra = (n > 1) ? acquireThreads(n - 1) : 0;
+  if (nExtra == 0) {
+    for (std::size_t i = 0; i < n; ++i) {
+      task(i);
+    }
+    return;
+  }
+  ThreadReservation reservation{nExtra};
+
+  // Blocks of equal size, without empty ones at the end
+  const std::size_t blockSize = (n + nExtra) / (nExtra + 1);
+  const std::size_t nBlocks = (n + blockSize - 1) / blockSize;
+  std::vector<std::exception_ptr> errors(nBlocks);
+  auto runBlock = [&](std::size_t block) {
+    try {
+      const std::size_t end = std::min(n, (block + 1) * blockSize);
+      for (std::size_t i = block * blockSize; i < end; ++i) {
+        task(i);
+      }
+    } catch (...) {
+      errors[block] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(nBlocks - 1);
+  std::size_t nStarted = 1;
+  try {
+    for (; nStarted < nBlocks; ++nStarted) {
+      threads.emplace_back(runBlock, nStarted);
+    }
+  } catch (const std::system_error&) {
+    // the remaining blocks run on this thread
+  }
+  runBlock(0);
+  for (std::size_t block = nStarted; block < nBlocks; ++block) {
+    runBlock(block);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
@@ -0,0 +1,129 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/TraceSpans.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <unordered_map>
+
+namespace {
+
+std::atomic<std::size_t> s_nextRecorderId{0};
+std::atomic<Acts::SpanRecorder*> s_globalRecorder{nullptr};
+
+void writeJsonString(std::ostream& os, std::string_view str) {
+  os << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      os << escaped;
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+}  // namespace
+
+Acts::SpanRecorder::SpanRecorder()
+    : m_id(s_nextRecorderId++), m_start(Clock::now()) {}
+
+Acts::SpanRecorder::~SpanRecorder() {
+  // do not leave a dangling global recorder behind
+  SpanRecorder* self = this;
+  s_globalRecorder.compare_exchange_strong(self, nullptr);
+}
+
+Acts::SpanRecorder::ThreadSpans& Acts::SpanRecorder::threadSpans() {
+  // the identifier is never reused, a buffer of a destroyed recorder can not
+  // be found by a new one at the same address
+  thread_local std::unordered_map<std::size_t, ThreadSpans*> buffers;
+  auto it = buffers.find(m_id);
+  if (it != buffers.end()) {
+    return *it->second;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& buffer = m_threadSpans.emplace_back(std::make_unique<ThreadSpans>());
+  buffer->thread = m_threadSpans.size() - 1;
+  buffers.emplace(m_id, buffer.get());
+  return *buffer;
+}
+
+void Acts::SpanRecorder::record(std::string_view name, Clock::time_point start,
+                                Clock::time_point end, std::int64_t event) {
+  ThreadSpans& buffer = threadSpans();
+  buffer.spans.push_back({name, start, end - start, buffer.thread, event});
+}
+
+std::vector<Acts::SpanRecorder::Span> Acts::SpanRecorder::spans() const {
+  std::vector<Span> result;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& buffer : m_threadSpans) {
+      result.insert(result.end(), buffer->spans.begin(), buffer->spans.end());
+    }
+  }
+  std::stable_sort(
+      result.begin(), result.end(),
+      [](const Span& a, const Span& b) { return a.start < b.start; });
+  return result;
+}
+
+void Acts::SpanRecorder::writeChromeTrace(std::ostream& os) const {
+  using Microseconds = std::chrono::duration<double, std::micro>;
+
+  std::vector<Span> all = spans();
+  std::size_t nThreads = 0;
+  for (const Span& span : all) {
+    nThreads = std::max(nThreads, span.thread + 1);
+  }
+
+  auto flags = os.flags();
+  auto precision = os.precision();
+  os.setf(std::ios::fixed, std::ios::floatfield);
+  os.precision(3);
+
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  const char* separator = "\n";
+  for (std::size_t thread = 0; thread < nThreads; ++thread) {
+    os << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+       << "\"tid\":" << thread << ",\"args\":{\"name\":\"Thread " << thread
+       << "\"}}";
+    separator = ",\n";
+  }
+  for (const Span& span : all) {
+    os << separator << "{\"name\":";
+    writeJsonString(os, span.name);
+    os << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << span.thread << ",\"ts\":"
+       << Microseconds(span.start - m_start).count()
+       << ",\"dur\":" << Microseconds(span.duration).count();
+    if (span.event >= 0) {
+      os << ",\"args\":{\"event\":" << span.event << "}";
+    }
+    os << "}";
+    separator = ",\n";
+  }
+  os << "\n]}\n";
+
+  os.flags(flags);
+  os.precision(precision);
+}
+
+Acts::SpanRecorder* Acts::SpanRecorder::setGlobal(SpanRecorder* recorder) {
+  return s_globalRecorder.exchange(recorder);
+}
+
+Acts::SpanRecorder* Acts::SpanRecorder::global() {
+  return s_globalRecorder.load(std::memory_order_acquire);
+}
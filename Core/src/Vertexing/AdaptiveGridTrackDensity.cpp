@@ -12,6 +12,8 @@
 #include "Acts/Vertexing/VertexingError.hpp"
 
 #include <algorithm>
+#include <array>
+#include <vector>
 
 namespace Acts {
 
@@ -21,18 +23,66 @@ namespace {
 /// distribution
 /// @note The constant prefactor (2 * pi)^(- nDim / 2) is discarded
 ///
-/// @param args Coordinates where the Gaussian should be evaluated
-/// @note args must be in a coordinate system with origin at the mean
-/// values of the Gaussian
-/// @param cov Covariance matrix
-///
-/// @return Multivariate Gaussian evaluated at args
+/// The inverse and the determinant of the covariance are computed once, such
+/// that the Gaussian can be evaluated cheaply on all bins of a track grid.
 template <unsigned int nDim>
-double multivariateGaussian(const ActsVector<nDim>& args,
-                            const ActsSquareMatrix<nDim>& cov) {
-  double exponent = -0.5 * args.transpose().dot(cov.inverse() * args);
-  double gaussianDensity = safeExp(exponent) / std::sqrt(cov.determinant());
-  return gaussianDensity;
+class MultivariateGaussian {
+ public:
+  /// @param cov Covariance matrix
+  explicit MultivariateGaussian(const ActsSquareMatrix<nDim>& cov)
+      : m_covInverse(cov.inverse()),
+        m_sqrtDeterminant(std::sqrt(cov.determinant())) {}
+
+  /// @param args Coordinates where the Gaussian should be evaluated
+  /// @note args must be in a coordinate system with origin at the mean
+  /// values of the Gaussian
+  ///
+  /// @return Multivariate Gaussian evaluated at args
+  double operator()(const ActsVector<nDim>& args) const {
+    double exponent = -0.5 * args.transpose().dot(m_covInverse * args);
+    return safeExp(exponent) / m_sqrtDeterminant;
+  }
+
+  /// @return Inverse of the covariance matrix
+  const ActsSquareMatrix<nDim>& covInverse() const { return m_covInverse; }
+
+ private:
+  ActsSquareMatrix<nDim> m_covInverse;
+  double m_sqrtDeterminant;
+};
+
+/// @brief Adds the densities of a track to the main density map
+///
+/// The bins of a track are contiguous, so after the first one is found the
+/// following ones are usually the next entries of the main map and are
+/// updated in place. Bins which are not yet in the main map are inserted in
+/// a single merge, instead of shifting the map for each of them.
+///
+/// @param trackDensityMap Map between bins and densities of a single track
+/// @param sign Factor for the track densities, i.e. -1 to subtract them
+/// @param mainDensityMap Map between bins and the summed densities
+void addDensities(const AdaptiveGridTrackDensity::DensityMap& trackDensityMap,
+                  float sign,
+                  AdaptiveGridTrackDensity::DensityMap& mainDensityMap) {
+  using DensityMap = AdaptiveGridTrackDensity::DensityMap;
+
+  std::vector<DensityMap::value_type> missing;
+  auto it = mainDensityMap.begin();
+  for (const auto& [bin, density] : trackDensityMap) {
+    if (it == mainDensityMap.end() || it->first != bin) {
+      it = mainDensityMap.lower_bound(bin);
+    }
+    if (it != mainDensityMap.end() && it->first == bin) {
+      it->second += sign * density;
+      ++it;
+    } else {
+      missing.emplace_back(bin, sign * density);
+    }
+  }
+  if (!missing.empty()) {
+    mainDensityMap.insert(boost::container::ordered_unique_range,
+                          missing.begin(), missing.end());
+  }
 }
 
 }  // namespace
@@ -206,26 +256,20 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::addTrack(
   DensityMap trackDensityMap = createTrackGrid(
       impactParams, centralBin, cov, spatialTrkGridSize, temporalTrkGridSize);
 
-  for (const auto& [bin, density] : trackDensityMap) {
-    mainDensityMap[bin] += density;
-  }
+  addDensities(trackDensityMap, 1, mainDensityMap);
 
   return trackDensityMap;
 }
 
 void AdaptiveGridTrackDensity::subtractTrack(const DensityMap& trackDensityMap,
                                              DensityMap& mainDensityMap) const {
-  for (const auto& [bin, density] : trackDensityMap) {
-    mainDensityMap[bin] -= density;
-  }
+  addDensities(trackDensityMap, -1, mainDensityMap);
 }
 
 AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
     const Vector3& impactParams, const Bin& centralBin,
     const SquareMatrix3& cov, std::uint32_t spatialTrkGridSize,
     std::uint32_t temporalTrkGridSize) const {
-  DensityMap trackDensityMap;
-
   std::uint32_t halfSpatialTrkGridSize = (spatialTrkGridSize - 1) / 2;
   std::int32_t firstZBin = centralBin.first - halfSpatialTrkGridSize;
 
@@ -233,17 +277,57 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
   std::uint32_t halfTemporalTrkGridSize = (temporalTrkGridSize - 1) / 2;
   std::int32_t firstTBin = centralBin.second - halfTemporalTrkGridSize;
 
+  const MultivariateGaussian<3> gaussian3D(cov);
+  const MultivariateGaussian<2> gaussian2D(cov.topLeftCorner<2, 2>());
+
+  // Squared number of standard deviations of the elliptical track grid
+  const bool useEllipse = m_cfg.useTime && m_cfg.useEllipticalTrkGrid;
+  const double nTrkSigmas =
+      std::max(m_cfg.nSpatialTrkSigmas, m_cfg.nTemporalTrkSigmas);
+  const double nTrkSigmas2 = nTrkSigmas * nTrkSigmas;
+  const SquareMatrix3& covInverse = gaussian3D.covInverse();
+
+  // The bins are created in the order of the map, z before t
+  std::vector<DensityMap::value_type> trackDensities;
+  trackDensities.reserve(spatialTrkGridSize * temporalTrkGridSize);
+
   // Loop over bins
-  for (std::uint32_t i = 0; i < temporalTrkGridSize; i++) {
-    std::int32_t tBin = firstTBin + i;
-    double t = getTemporalBinCenter(tBin);
-    if (t < m_cfg.temporalWindow.first || t > m_cfg.temporalWindow.second) {
+  for (std::uint32_t j = 0; j < spatialTrkGridSize; j++) {
+    std::int32_t zBin = firstZBin + j;
+    double z = getSpatialBinCenter(zBin);
+    if (z < m_cfg.spatialWindow.first || z > m_cfg.spatialWindow.second) {
       continue;
     }
-    for (std::uint32_t j = 0; j < spatialTrkGridSize; j++) {
-      std::int32_t zBin = firstZBin + j;
-      double z = getSpatialBinCenter(zBin);
-      if (z < m_cfg.spatialWindow.first || z > m_cfg.spatialWindow.second) {
+    std::uint32_t iBegin = 0;
+    std::uint32_t iEnd = temporalTrkGridSize;
+    if (useEllipse) {
+      // The squared Mahalanobis distance is a quadratic polynomial
+      // a * dt^2 + 2 * b * dt + c in the time offset dt, only the t bins
+      // whose centers are inside the ellipse are filled
+      double dd = -impactParams(0);
+      double dz = z - impactParams(1);
+      double a = covInverse(2, 2);
+      double b = covInverse(2, 0) * dd + covInverse(2, 1) * dz;
+      double c = covInverse(0, 0) * dd * dd +
+                 2 * covInverse(0, 1) * dd * dz + covInverse(1, 1) * dz * dz;
+      double discriminant = b * b - a * (c - nTrkSigmas2);
+      if (discriminant < 0) {
+        continue;
+      }
+      double sqrtDiscriminant = std::sqrt(discriminant);
+      double tMin = impactParams(2) + (-b - sqrtDiscriminant) / a;
+      double tMax = impactParams(2) + (-b + sqrtDiscriminant) / a;
+      double firstT = std::ceil(tMin / m_cfg.temporalBinExtent) - firstTBin;
+      double lastT = std::floor(tMax / m_cfg.temporalBinExtent) - firstTBin;
+      iBegin = static_cast<std::uint32_t>(
+          std::clamp(firstT, 0., static_cast<double>(temporalTrkGridSize)));
+      iEnd = static_cast<std::uint32_t>(
+          std::clamp(lastT + 1, 0., static_cast<double>(temporalTrkGridSize)));
+    }
+    for (std::uint32_t i = iBegin; i < iEnd; i++) {
+      std::int32_t tBin = firstTBin + i;
+      double t = getTemporalBinCenter(tBin);
+      if (t < m_cfg.temporalWindow.first || t > m_cfg.temporalWindow.second) {
         continue;
       }
       // Bin coordinates in the d-z-t plane
@@ -253,19 +337,19 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
       Bin bin = {zBin, tBin};
       double density = 0;
       if (m_cfg.useTime) {
-        density = multivariateGaussian<3>(binCoords, cov);
+        density = gaussian3D(binCoords);
       } else {
-        density = multivariateGaussian<2>(binCoords.head<2>(),
-                                          cov.topLeftCorner<2, 2>());
+        density = gaussian2D(binCoords.head<2>());
       }
       // Only add density if it is positive (otherwise it is 0)
       if (density > 0) {
-        trackDensityMap[bin] = density;
+        trackDensities.emplace_back(bin, density);
       }
     }
   }
 
-  return trackDensityMap;
+  return DensityMap(boost::container::ordered_unique_range,
+                    trackDensities.begin(), trackDensities.end());
 }
 
 Result<double> AdaptiveGridTrackDensity::estimateSeedWidth(
@@ -336,8 +420,24 @@ Result<double> AdaptiveGridTrackDensity::estimateSeedWidth(
 
 AdaptiveGridTrackDensity::Bin AdaptiveGridTrackDensity::highestDensitySumBin(
     DensityMap& densityMap) const {
+  // Find the three highest maxima in a single pass. Equal densities keep the
+  // order of the map, as if the global maximum was searched three times with
+  // the previous maxima removed.
+  std::array<DensityMap::iterator, 3> maxima;
+  maxima.fill(densityMap.end());
+  for (auto it = densityMap.begin(); it != densityMap.end(); ++it) {
+    for (std::size_t i = 0; i < maxima.size(); ++i) {
+      if (maxima[i] == densityMap.end() || it->second > maxima[i]->second) {
+        std::copy_backward(maxima.begin() + i, maxima.end() - 1,
+                           maxima.end());
+        maxima[i] = it;
+        break;
+      }
+    }
+  }
+
   // The global maximum
-  auto firstMax = highestDensityEntry(densityMap);
+  auto firstMax = maxima[0];
   Bin binFirstMax = firstMax->first;
   double valueFirstMax = firstMax->second;
   double firstSum = getDensitySum(densityMap, binFirstMax);
@@ -346,33 +446,33 @@ AdaptiveGridTrackDensity::Bin AdaptiveGridTrackDensity::highestDensitySumBin(
   double densityDeviation = valueFirstMax * m_cfg.maxRelativeDensityDev;
 
   // Get the second highest maximum
-  densityMap[binFirstMax] = 0;
-  auto secondMax = highestDensityEntry(densityMap);
-  Bin binSecondMax = secondMax->first;
-  double valueSecondMax = secondMax->second;
-  double secondSum = 0;
-  if (valueFirstMax - valueSecondMax < densityDeviation) {
-    secondSum = getDensitySum(densityMap, binSecondMax);
-  } else {
+  auto secondMax = maxima[1];
+  if (secondMax == densityMap.end() ||
+      valueFirstMax - secondMax->second >= densityDeviation) {
     // If the second maximum is not sufficiently large the third maximum won't
     // be either
-    densityMap[binFirstMax] = valueFirstMax;
     return binFirstMax;
   }
+  Bin binSecondMax = secondMax->first;
+  double valueSecondMax = secondMax->second;
+  // The sums around the smaller maxima do not include the larger ones
+  firstMax->second = 0;
+  double secondSum = getDensitySum(densityMap, binSecondMax);
 
   // Get the third highest maximum
-  densityMap[binSecondMax] = 0;
-  auto thirdMax = highestDensityEntry(densityMap);
-  Bin binThirdMax = thirdMax->first;
-  double valueThirdMax = thirdMax->second;
+  auto thirdMax = maxima[2];
+  Bin binThirdMax = binFirstMax;
   double thirdSum = 0;
-  if (valueFirstMax - valueThirdMax < densityDeviation) {
+  if (thirdMax != densityMap.end() &&
+      valueFirstMax - thirdMax->second < densityDeviation) {
+    binThirdMax = thirdMax->first;
+    secondMax->second = 0;
     thirdSum = getDensitySum(densityMap, binThirdMax);
   }
 
   // Revert back to original values
-  densityMap[binFirstMax] = valueFirstMax;
-  densityMap[binSecondMax] = valueSecondMax;
+  firstMax->second = valueFirstMax;
+  secondMax->second = valueSecondMax;
 
   // Return the z bin position of the highest density sum
   if (secondSum > firstSum && secondSum > thirdSum) {
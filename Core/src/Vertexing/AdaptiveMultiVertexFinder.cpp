@@ -9,14 +9,65 @@
 #include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
 
 #include "Acts/Utilities/AlgebraHelpers.hpp"
+#include "Acts/Utilities/TraceSpans.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+
 namespace Acts {
 
+AdaptiveMultiVertexFinder::TrackIndex::TrackIndex(
+    const std::vector<InputTrack>& tracks,
+    const InputTrack::Extractor& extractParameters,
+    const GeometryContext& geoContext)
+    : z(tracks.size()), zOrder(tracks.size()), isSeed(tracks.size(), true) {
+  lookup.reserve(tracks.size());
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    z[i] = extractParameters(tracks[i]).position(geoContext)[eZ];
+    lookup.emplace_back(tracks[i], i);
+  }
+  std::iota(zOrder.begin(), zOrder.end(), 0);
+  std::stable_sort(zOrder.begin(), zOrder.end(),
+                   [&](std::size_t a, std::size_t b) { return z[a] < z[b]; });
+  std::stable_sort(
+      lookup.begin(), lookup.end(),
+      [](const auto& a, const auto& b) { return a.first < b.first; });
+}
+
+std::size_t AdaptiveMultiVertexFinder::TrackIndex::find(
+    const InputTrack& trk) const {
+  auto it = std::lower_bound(
+      lookup.begin(), lookup.end(), trk,
+      [](const auto& entry, const InputTrack& t) { return entry.first < t; });
+  assert(it != lookup.end() && it->first == trk);
+  return it->second;
+}
+
+void AdaptiveMultiVertexFinder::TrackIndex::zWindow(
+    double posZ, double maxDistance, std::vector<std::size_t>& indices) const {
+  // This is the same cut as on the distance itself, which is monotonic in z
+  auto isTooFar = [&](std::size_t i) {
+    return maxDistance < std::abs(z[i] - posZ);
+  };
+  auto begin = std::partition_point(
+      zOrder.begin(), zOrder.end(),
+      [&](std::size_t i) { return z[i] < posZ && isTooFar(i); });
+  auto end = std::partition_point(begin, zOrder.end(), [&](std::size_t i) {
+    return z[i] < posZ || !isTooFar(i);
+  });
+  indices.assign(begin, end);
+  std::sort(indices.begin(), indices.end());
+}
+
 Acts::Result<std::vector<Acts::Vertex>> AdaptiveMultiVertexFinder::find(
     const std::vector<InputTrack>& allTracks,
     const VertexingOptions& vertexingOptions,
     IVertexFinder::State& anyState) const {
+  ACTS_TRACE_SPAN("AdaptiveMultiVertexFinder::find");
+
   if (allTracks.empty()) {
     ACTS_ERROR("Empty track collection handed to find method");
     return VertexingError::EmptyInput;
@@ -30,6 +81,10 @@ Acts::Result<std::vector<Acts::Vertex>> AdaptiveMultiVertexFinder::find(
   // Seed tracks
   std::vector<InputTrack> seedTracks = allTracks;
 
+  // Index of the original tracks, which also tracks the seed tracks
+  TrackIndex trackIndex(origTracks, m_cfg.extractParameters,
+                        vertexingOptions.geoContext);
+
   VertexFitterState fitterState(*m_cfg.bField,
                                 vertexingOptions.magFieldContext);
   auto seedFinderState = m_cfg.seedFinder->makeState(state.magContext);
@@ -70,18 +125,9 @@ Acts::Result<std::vector<Acts::Vertex>> AdaptiveMultiVertexFinder::find(
     // now after seed finding is done
     removedSeedTracks.clear();
 
-    // Tracks that are used for searching compatible tracks near a vertex
-    // candidate
-    std::vector<InputTrack> searchTracks;
-    if (m_cfg.doRealMultiVertex) {
-      searchTracks = origTracks;
-    } else {
-      searchTracks = seedTracks;
-    }
-
-    auto prepResult = canPrepareVertexForFit(searchTracks, seedTracks,
-                                             vtxCandidate, currentConstraint,
-                                             fitterState, vertexingOptions);
+    auto prepResult = canPrepareVertexForFit(
+        origTracks, seedTracks, trackIndex, vtxCandidate, currentConstraint,
+        fitterState, vertexingOptions);
 
     if (!prepResult.ok()) {
       return prepResult.error();
@@ -106,17 +152,18 @@ Acts::Result<std::vector<Acts::Vertex>> AdaptiveMultiVertexFinder::find(
                << vtxCandidate.fullPosition().transpose());
     // Check if vertex is good vertex
     auto [nCompatibleTracks, isGoodVertex] =
-        checkVertexAndCompatibleTracks(vtxCandidate, seedTracks, fitterState,
+        checkVertexAndCompatibleTracks(vtxCandidate, trackIndex, fitterState,
                                        vertexingOptions.useConstraintInFit);
 
     ACTS_DEBUG("Vertex is good vertex: " << isGoodVertex);
     if (nCompatibleTracks > 0) {
       removeCompatibleTracksFromSeedTracks(vtxCandidate, seedTracks,
-                                           fitterState, removedSeedTracks);
+                                           trackIndex, fitterState,
+                                           removedSeedTracks);
     } else {
-      bool removedIncompatibleTrack = removeTrackIfIncompatible(
-          vtxCandidate, seedTracks, fitterState, removedSeedTracks,
-          vertexingOptions.geoContext);
+      bool removedIncompatibleTrack =
+          removeTrackIfIncompatible(vtxCandidate, seedTracks, trackIndex,
+                                    fitterState, removedSeedTracks);
       if (!removedIncompatibleTrack) {
         ACTS_DEBUG(
             "Could not remove any further track from seed tracks. Break.");
@@ -241,17 +288,19 @@ Acts::Result<double> AdaptiveMultiVertexFinder::getIPSignificance(
 }
 
 Acts::Result<void> AdaptiveMultiVertexFinder::addCompatibleTracksToVertex(
-    const std::vector<InputTrack>& tracks, Vertex& vtx,
-    VertexFitterState& fitterState,
+    const std::vector<InputTrack>& allTracks, const TrackIndex& trackIndex,
+    Vertex& vtx, VertexFitterState& fitterState,
     const VertexingOptions& vertexingOptions) const {
-  for (const auto& trk : tracks) {
-    auto params = m_cfg.extractParameters(trk);
-    auto pos = params.position(vertexingOptions.geoContext);
-    // If track is too far away from vertex, do not consider checking the IP
-    // significance
-    if (m_cfg.tracksMaxZinterval < std::abs(pos[eZ] - vtx.position()[eZ])) {
+  // If track is too far away from vertex, do not consider checking the IP
+  // significance
+  std::vector<std::size_t> nearTracks;
+  trackIndex.zWindow(vtx.position()[eZ], m_cfg.tracksMaxZinterval, nearTracks);
+  for (std::size_t i : nearTracks) {
+    if (!m_cfg.doRealMultiVertex && !trackIndex.isSeed[i]) {
       continue;
     }
+    const InputTrack& trk = allTracks[i];
+    auto params = m_cfg.extractParameters(trk);
     auto sigRes = getIPSignificance(trk, vtx, vertexingOptions);
     if (!sigRes.ok()) {
       return sigRes.error();
@@ -271,7 +320,8 @@ Acts::Result<void> AdaptiveMultiVertexFinder::addCompatibleTracksToVertex(
 
 Acts::Result<bool> AdaptiveMultiVertexFinder::canRecoverFromNoCompatibleTracks(
     const std::vector<InputTrack>& allTracks,
-    const std::vector<InputTrack>& seedTracks, Vertex& vtx,
+    const std::vector<InputTrack>& seedTracks, const TrackIndex& trackIndex,
+    Vertex& vtx,
     const Vertex& currentConstraint, VertexFitterState& fitterState,
     const VertexingOptions& vertexingOptions) const {
   // Recover from cases where no compatible tracks to vertex
@@ -284,13 +334,12 @@ Acts::Result<bool> AdaptiveMultiVertexFinder::canRecoverFromNoCompatibleTracks(
     double newZ = 0;
     bool nearTrackFound = false;
     for (const auto& trk : seedTracks) {
-      auto pos =
-          m_cfg.extractParameters(trk).position(vertexingOptions.geoContext);
-      auto zDistance = std::abs(pos[eZ] - vtx.position()[eZ]);
+      double trkZ = trackIndex.z[trackIndex.find(trk)];
+      auto zDistance = std::abs(trkZ - vtx.position()[eZ]);
       if (zDistance < smallestDeltaZ) {
         smallestDeltaZ = zDistance;
         nearTrackFound = true;
-        newZ = pos[eZ];
+        newZ = trkZ;
       }
     }
     if (nearTrackFound) {
@@ -301,8 +350,8 @@ Acts::Result<bool> AdaptiveMultiVertexFinder::canRecoverFromNoCompatibleTracks(
           VertexInfo(currentConstraint, vtx.fullPosition());
 
       // Try to add compatible track with adapted vertex position
-      auto res = addCompatibleTracksToVertex(allTracks, vtx, fitterState,
-                                             vertexingOptions);
+      auto res = addCompatibleTracksToVertex(allTracks, trackIndex, vtx,
+                                             fitterState, vertexingOptions);
       if (!res.ok()) {
         return Result<bool>::failure(res.error());
       }
@@ -325,7 +374,8 @@ Acts::Result<bool> AdaptiveMultiVertexFinder::canRecoverFromNoCompatibleTracks(
 
 Acts::Result<bool> AdaptiveMultiVertexFinder::canPrepareVertexForFit(
     const std::vector<InputTrack>& allTracks,
-    const std::vector<InputTrack>& seedTracks, Vertex& vtx,
+    const std::vector<InputTrack>& seedTracks, const TrackIndex& trackIndex,
+    Vertex& vtx,
     const Vertex& currentConstraint, VertexFitterState& fitterState,
     const VertexingOptions& vertexingOptions) const {
   // Add vertex info to fitter state
@@ -333,16 +383,16 @@ Acts::Result<bool> AdaptiveMultiVertexFinder::canPrepareVertexForFit(
       VertexInfo(currentConstraint, vtx.fullPosition());
 
   // Add all compatible tracks to vertex
-  auto resComp = addCompatibleTracksToVertex(allTracks, vtx, fitterState,
-                                             vertexingOptions);
+  auto resComp = addCompatibleTracksToVertex(allTracks, trackIndex, vtx,
+                                             fitterState, vertexingOptions);
   if (!resComp.ok()) {
     return Result<bool>::failure(resComp.error());
   }
 
   // Try to recover from cases where adding compatible track was not possible
-  auto resRec = canRecoverFromNoCompatibleTracks(allTracks, seedTracks, vtx,
-                                                 currentConstraint, fitterState,
-                                                 vertexingOptions);
+  auto resRec = canRecoverFromNoCompatibleTracks(
+      allTracks, seedTracks, trackIndex, vtx, currentConstraint, fitterState,
+      vertexingOptions);
   if (!resRec.ok()) {
     return Result<bool>::failure(resRec.error());
   }
@@ -351,8 +401,8 @@ Acts::Result<bool> AdaptiveMultiVertexFinder::canPrepareVertexForFit(
 }
 
 std::pair<int, bool> AdaptiveMultiVertexFinder::checkVertexAndCompatibleTracks(
-    Vertex& vtx, const std::vector<InputTrack>& seedTracks,
-    VertexFitterState& fitterState, bool useVertexConstraintInFit) const {
+    Vertex& vtx, const TrackIndex& trackIndex, VertexFitterState& fitterState,
+    bool useVertexConstraintInFit) const {
   bool isGoodVertex = false;
   int nCompatibleTracks = 0;
   for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
@@ -365,10 +415,7 @@ std::pair<int, bool> AdaptiveMultiVertexFinder::checkVertexAndCompatibleTracks(
          !m_cfg.useFastCompatibility)) {
       // TODO: Understand why looking for compatible tracks only in seed tracks
       // and not also in all tracks
-      auto foundIter =
-          std::find_if(seedTracks.begin(), seedTracks.end(),
-                       [&trk](auto seedTrk) { return trk == seedTrk; });
-      if (foundIter != seedTracks.end()) {
+      if (trackIndex.isSeed[trackIndex.find(trk)]) {
         nCompatibleTracks++;
         ACTS_DEBUG("Compatible track found.");
 
@@ -388,7 +435,7 @@ std::pair<int, bool> AdaptiveMultiVertexFinder::checkVertexAndCompatibleTracks(
 }
 
 auto AdaptiveMultiVertexFinder::removeCompatibleTracksFromSeedTracks(
-    Vertex& vtx, std::vector<InputTrack>& seedTracks,
+    Vertex& vtx, std::vector<InputTrack>& seedTracks, TrackIndex& trackIndex,
     VertexFitterState& fitterState,
     std::vector<InputTrack>& removedSeedTracks) const -> void {
   for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
@@ -399,26 +446,29 @@ auto AdaptiveMultiVertexFinder::removeCompatibleTracksFromSeedTracks(
         (trkAtVtx.trackWeight > m_cfg.minWeight &&
          trkAtVtx.chi2Track < m_cfg.maxVertexChi2 &&
          !m_cfg.useFastCompatibility)) {
-      // Find and remove track from seedTracks
-      auto foundSeedIter =
-          std::find_if(seedTracks.begin(), seedTracks.end(),
-                       [&trk](auto seedTrk) { return trk == seedTrk; });
-      if (foundSeedIter != seedTracks.end()) {
-        seedTracks.erase(foundSeedIter);
+      // Mark track for removal from seedTracks
+      std::size_t i = trackIndex.find(trk);
+      if (trackIndex.isSeed[i]) {
+        trackIndex.isSeed[i] = false;
         removedSeedTracks.push_back(trk);
       }
     }
   }
+  auto isRemoved = [&](const InputTrack& seedTrk) {
+    return !trackIndex.isSeed[trackIndex.find(seedTrk)];
+  };
+  seedTracks.erase(
+      std::remove_if(seedTracks.begin(), seedTracks.end(), isRemoved),
+      seedTracks.end());
 }
 
 bool AdaptiveMultiVertexFinder::removeTrackIfIncompatible(
-    Vertex& vtx, std::vector<InputTrack>& seedTracks,
-    VertexFitterState& fitterState, std::vector<InputTrack>& removedSeedTracks,
-    const GeometryContext& geoCtx) const {
+    Vertex& vtx, std::vector<InputTrack>& seedTracks, TrackIndex& trackIndex,
+    VertexFitterState& fitterState,
+    std::vector<InputTrack>& removedSeedTracks) const {
   // Try to find the track with highest compatibility
   double maxCompatibility = 0;
 
-  auto maxCompSeedIt = seedTracks.end();
   std::optional<InputTrack> removedTrack = std::nullopt;
   for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
     const auto& trkAtVtx =
@@ -426,19 +476,17 @@ bool AdaptiveMultiVertexFinder::removeTrackIfIncompatible(
     double compatibility = trkAtVtx.vertexCompatibility;
     if (compatibility > maxCompatibility) {
       // Try to find track in seed tracks
-      auto foundSeedIter =
-          std::find_if(seedTracks.begin(), seedTracks.end(),
-                       [&trk](auto seedTrk) { return trk == seedTrk; });
-      if (foundSeedIter != seedTracks.end()) {
+      if (trackIndex.isSeed[trackIndex.find(trk)]) {
         maxCompatibility = compatibility;
-        maxCompSeedIt = foundSeedIter;
         removedTrack = trk;
       }
     }
   }
-  if (maxCompSeedIt != seedTracks.end()) {
+  if (removedTrack.has_value()) {
     // Remove track with highest compatibility from seed tracks
-    seedTracks.erase(maxCompSeedIt);
+    seedTracks.erase(
+        std::find(seedTracks.begin(), seedTracks.end(), *removedTrack));
+    trackIndex.isSeed[trackIndex.find(*removedTrack)] = false;
     removedSeedTracks.push_back(removedTrack.value());
   } else {
     // Could not find any seed with compatibility > 0, use alternative
@@ -447,8 +495,8 @@ bool AdaptiveMultiVertexFinder::removeTrackIfIncompatible(
     double smallestDeltaZ = std::numeric_limits<double>::max();
     auto smallestDzSeedIter = seedTracks.end();
     for (unsigned int i = 0; i < seedTracks.size(); i++) {
-      auto pos = m_cfg.extractParameters(seedTracks[i]).position(geoCtx);
-      double zDistance = std::abs(pos[eZ] - vtx.position()[eZ]);
+      double trkZ = trackIndex.z[trackIndex.find(seedTracks[i])];
+      double zDistance = std::abs(trkZ - vtx.position()[eZ]);
       if (zDistance < smallestDeltaZ) {
         smallestDeltaZ = zDistance;
         smallestDzSeedIter = seedTracks.begin() + i;
@@ -457,6 +505,7 @@ bool AdaptiveMultiVertexFinder::removeTrackIfIncompatible(
     }
     if (smallestDzSeedIter != seedTracks.end()) {
       seedTracks.erase(smallestDzSeedIter);
+      trackIndex.isSeed[trackIndex.find(*removedTrack)] = false;
       removedSeedTracks.push_back(removedTrack.value());
     } else {
       ACTS_DEBUG("No track found to remove. Stop vertex finding now.");
@@ -595,11 +644,10 @@ Acts::Result<void> AdaptiveMultiVertexFinder::deleteLastVertex(
     return removeResult.error();
   }
 
-  for (auto& entry : fitterState.tracksAtVerticesMap) {
-    // Delete all linearized tracks for current (bad) vertex
-    if (entry.first.second == &vtx) {
-      entry.second.isLinearized = false;
-    }
+  // Delete all linearized tracks for current (bad) vertex
+  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
+    fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx))
+        .isLinearized = false;
   }
 
   // If no vertices share tracks with vtx we don't need to refit
@@ -9,9 +9,19 @@
 #include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
 
 #include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Vertexing/KalmanVertexUpdater.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
     State& state, const VertexingOptions& vertexingOptions) const {
   // Reset annealing tool
@@ -199,16 +209,23 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::prepareVertexForFit(
   // Vertex seed position
   const Vector3& seedPos = vtxInfo.seedPosition.template head<3>();
 
-  // Loop over all tracks at the vertex
+  // Estimate the 3D impact parameters of all tracks at the vertex at once
+  std::vector<BoundTrackParameters> trkParams;
+  trkParams.reserve(vtxInfo.trackLinks.size());
   for (const auto& trk : vtxInfo.trackLinks) {
-    auto res = m_cfg.ipEst.estimate3DImpactParameters(
-        vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-        m_cfg.extractParameters(trk), seedPos, state.ipState);
-    if (!res.ok()) {
-      return res.error();
-    }
-    // Save 3D impact parameters of the track
-    vtxInfo.impactParams3D.emplace(trk, res.value());
+    trkParams.push_back(m_cfg.extractParameters(trk));
+  }
+  std::vector<BoundTrackParameters> ipParams;
+  auto res = m_cfg.ipEst.estimate3DImpactParameters(
+      vertexingOptions.geoContext, vertexingOptions.magFieldContext, trkParams,
+      seedPos, state.ipState, ipParams);
+  if (!res.ok()) {
+    return res.error();
+  }
+  // Save 3D impact parameters of the tracks
+  for (std::size_t i = 0; i < ipParams.size(); ++i) {
+    vtxInfo.impactParams3D.emplace(vtxInfo.trackLinks[i],
+                                   std::move(ipParams[i]));
   }
   return {};
 }
@@ -258,6 +275,64 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setAllVertexCompatibilities(
 
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setWeightsAndUpdate(
     State& state, const VertexingOptions& vertexingOptions) const {
+  // The weights only depend on the compatibilities, which are all set before,
+  // so they are computed for all tracks at once. The compatibilities of each
+  // track wrt all of its associated vertices are stored contiguously.
+  std::vector<double> compatibilities;
+  std::vector<const Vertex*> compatibilityVertices;
+  std::vector<std::size_t> offsets = {0};
+  std::map<InputTrack, std::size_t> trackIndices;
+  // For each track-vertex pair in the order of the fit, the track at the
+  // vertex and the index of its compatibility
+  std::vector<TrackAtVertex*> tracksAtVertices;
+  std::vector<std::size_t> pairIndices;
+
+  for (auto vtx : state.vertexCollection) {
+    for (const auto& trk : state.vtxInfoMap[vtx].trackLinks) {
+      auto [it, inserted] = trackIndices.try_emplace(trk, offsets.size() - 1);
+      if (inserted) {
+        auto [begin, end] = state.trackToVerticesMultiMap.equal_range(trk);
+        for (auto vtxIt = begin; vtxIt != end; ++vtxIt) {
+          compatibilities.push_back(
+              state.tracksAtVerticesMap.at(std::make_pair(trk, vtxIt->second))
+                  .vertexCompatibility);
+          compatibilityVertices.push_back(vtxIt->second);
+        }
+        offsets.push_back(compatibilities.size());
+      }
+      const std::size_t iTrack = it->second;
+      auto verticesBegin = compatibilityVertices.begin() + offsets[iTrack];
+      auto verticesEnd = compatibilityVertices.begin() + offsets[iTrack + 1];
+      auto vtxIt = std::find(verticesBegin, verticesEnd, vtx);
+      if (vtxIt == verticesEnd) {
+        ACTS_ERROR("Track is not associated with vertex in the multimap.");
+        return VertexingError::ElementNotFound;
+      }
+      tracksAtVertices.push_back(
+          &state.tracksAtVerticesMap.at(std::make_pair(trk, vtx)));
+      pairIndices.push_back(vtxIt - compatibilityVertices.begin());
+    }
+  }
+
+  std::vector<double> weights;
+  m_cfg.annealingTool.getWeights(state.annealingState, compatibilities,
+                                 offsets, weights);
+  for (std::size_t iPair = 0; iPair < tracksAtVertices.size(); ++iPair) {
+    tracksAtVertices[iPair]->trackWeight = weights[pairIndices[iPair]];
+  }
+
+  // The linearizations only depend on the linearization points, so they are
+  // independent of each other and of the vertex updates below
+  struct Linearization {
+    TrackAtVertex* trkAtVtx = nullptr;
+    const InputTrack* trk = nullptr;
+    const VertexInfo* vtxInfo = nullptr;
+    const Surface* surface = nullptr;
+  };
+  std::vector<Linearization> linearizations;
+  std::vector<std::shared_ptr<PerigeeSurface>> vtxPerigeeSurfaces;
+  vtxPerigeeSurfaces.reserve(state.vertexCollection.size());
+  std::size_t iPair = 0;
   for (auto vtx : state.vertexCollection) {
     VertexInfo& vtxInfo = state.vtxInfoMap[vtx];
 
@@ -265,33 +340,68 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setWeightsAndUpdate(
       vtxInfo.linPoint = vtxInfo.oldPosition;
     }
 
-    const std::shared_ptr<PerigeeSurface> vtxPerigeeSurface =
-        Surface::makeShared<PerigeeSurface>(
-            VectorHelpers::position(vtxInfo.linPoint));
+    vtxPerigeeSurfaces.push_back(Surface::makeShared<PerigeeSurface>(
+        VectorHelpers::position(vtxInfo.linPoint)));
+    const Surface* vtxPerigeeSurface = vtxPerigeeSurfaces.back().get();
 
     for (const auto& trk : vtxInfo.trackLinks) {
-      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+      TrackAtVertex& trkAtVtx = *tracksAtVertices[iPair++];
+      // Check if track is already linearized and whether we need to
+      // relinearize
+      if (trkAtVtx.trackWeight > m_cfg.minWeight &&
+          (!trkAtVtx.isLinearized || vtxInfo.relinearize)) {
+        linearizations.push_back({&trkAtVtx, &trk, &vtxInfo, vtxPerigeeSurface});
+      }
+    }
+  }
 
-      // Set trackWeight for current track
-      trkAtVtx.trackWeight = m_cfg.annealingTool.getWeight(
-          state.annealingState, trkAtVtx.vertexCompatibility,
-          collectTrackToVertexCompatibilities(state, trk));
+  // Each range of linearizations uses its own field cache
+  constexpr std::size_t minLinearizationsPerRange = 16;
+  const std::size_t nRanges =
+      m_cfg.linearizeConcurrently
+          ? std::min(maxThreads(),
+                     std::max<std::size_t>(
+                         linearizations.size() / minLinearizationsPerRange, 1))
+          : 1;
+  while (state.concurrentFieldCaches.size() + 1 < nRanges) {
+    state.concurrentFieldCaches.push_back(
+        state.field->makeCache(vertexingOptions.magFieldContext));
+  }
+  std::vector<std::error_code> errors(linearizations.size());
+  parallelFor(nRanges, [&](std::size_t iRange) {
+    MagneticFieldProvider::Cache& fieldCache =
+        (iRange == 0) ? state.fieldCache
+                      : state.concurrentFieldCaches[iRange - 1];
+    for (std::size_t i = linearizations.size() * iRange / nRanges;
+         i < linearizations.size() * (iRange + 1) / nRanges; ++i) {
+      const Linearization& lin = linearizations[i];
+      auto result = m_cfg.trackLinearizer(
+          m_cfg.extractParameters(*lin.trk), lin.vtxInfo->linPoint[3],
+          *lin.surface, vertexingOptions.geoContext,
+          vertexingOptions.magFieldContext, fieldCache);
+      if (!result.ok()) {
+        errors[i] = result.error();
+        continue;
+      }
 
-      if (trkAtVtx.trackWeight > m_cfg.minWeight) {
-        // Check if track is already linearized and whether we need to
-        // relinearize
-        if (!trkAtVtx.isLinearized || vtxInfo.relinearize) {
-          auto result = m_cfg.trackLinearizer(
-              m_cfg.extractParameters(trk), vtxInfo.linPoint[3],
-              *vtxPerigeeSurface, vertexingOptions.geoContext,
-              vertexingOptions.magFieldContext, state.fieldCache);
-          if (!result.ok()) {
-            return result.error();
-          }
+      lin.trkAtVtx->linearizedState = *result;
+      lin.trkAtVtx->isLinearized = true;
+    }
+  });
+  for (const std::error_code& error : errors) {
+    if (error) {
+      return error;
+    }
+  }
 
-          trkAtVtx.linearizedState = *result;
-          trkAtVtx.isLinearized = true;
-        }
+  auto pairBegin = tracksAtVertices.begin();
+  for (auto vtx : state.vertexCollection) {
+    VertexInfo& vtxInfo = state.vtxInfoMap[vtx];
+    auto pairEnd = pairBegin + vtxInfo.trackLinks.size();
+
+    for (auto pairIt = pairBegin; pairIt != pairEnd; ++pairIt) {
+      TrackAtVertex& trkAtVtx = **pairIt;
+      if (trkAtVtx.trackWeight > m_cfg.minWeight) {
         // Update the vertex with the new track. The second template
         // argument corresponds to the number of fitted vertex dimensions
         // (i.e., 3 if we only fit spatial coordinates and 4 if we also fit
@@ -301,37 +411,14 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setWeightsAndUpdate(
       } else {
         ACTS_VERBOSE("Track weight too low. Skip track.");
       }
-    }  // End loop over tracks at vertex
+    }
     ACTS_VERBOSE("New vertex position: " << vtx->fullPosition().transpose());
+    pairBegin = pairEnd;
   }  // End loop over vertex collection
 
   return {};
 }
 
-std::vector<double>
-Acts::AdaptiveMultiVertexFitter::collectTrackToVertexCompatibilities(
-    State& state, const InputTrack& trk) const {
-  // Compatibilities of trk wrt all of its associated vertices
-  std::vector<double> trkToVtxCompatibilities;
-
-  // Range of vertices that are associated with trk. The range is
-  // represented via its bounds: begin refers to the first iterator of the
-  // range; end refers to the iterator after the last iterator of the range.
-  auto [begin, end] = state.trackToVerticesMultiMap.equal_range(trk);
-  // Allocate space in memory for the vector of compatibilities
-  trkToVtxCompatibilities.reserve(std::distance(begin, end));
-
-  for (auto it = begin; it != end; ++it) {
-    // it->first corresponds to trk, it->second to one of its associated
-    // vertices
-    trkToVtxCompatibilities.push_back(
-        state.tracksAtVerticesMap.at(std::make_pair(trk, it->second))
-            .vertexCompatibility);
-  }
-
-  return trkToVtxCompatibilities;
-}
-
 bool Acts::AdaptiveMultiVertexFitter::checkSmallShift(State& state) const {
   for (auto* vtx : state.vertexCollection) {
     Vector3 diff =
@@ -9,6 +9,7 @@
 #include "Acts/Vertexing/FullBilloirVertexFitter.hpp"
 
 #include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/BoundTrackParametersBatch.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Utilities/detail/periodic.hpp"
@@ -94,6 +95,17 @@ Acts::Result<Acts::Vertex> Acts::FullBilloirVertexFitter::fit(
   Vector4 linPoint = vertexingOptions.constraint.fullPosition();
   Vertex fittedVertex;
 
+  // The batch is only filled once, the linearized tracks are overwritten in
+  // each iteration
+  BoundTrackParametersBatch trackBatch;
+  std::vector<LinearizedTrack> linTracks;
+  if (m_cfg.trackBatchLinearizer.connected()) {
+    trackBatch.reserve(nTracks);
+    for (const InputTrack& trk : paramVector) {
+      trackBatch.push_back(m_cfg.extractParameters(trk));
+    }
+  }
+
   for (int nIter = 0; nIter < m_cfg.maxIterations; ++nIter) {
     billoirTracks.clear();
     double newChi2 = 0;
@@ -105,21 +117,34 @@ Acts::Result<Acts::Vertex> Acts::FullBilloirVertexFitter::fit(
     const std::shared_ptr<PerigeeSurface> perigeeSurface =
         Surface::makeShared<PerigeeSurface>(linPointPos);
 
-    // iterate over all tracks
-    for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
-      const InputTrack& trackContainer = paramVector[iTrack];
-
-      const auto& trackParams = m_cfg.extractParameters(trackContainer);
-
-      auto result =
-          m_cfg.trackLinearizer(trackParams, linPoint[3], *perigeeSurface,
-                                vertexingOptions.geoContext,
-                                vertexingOptions.magFieldContext, fieldCache);
+    if (m_cfg.trackBatchLinearizer.connected()) {
+      auto result = m_cfg.trackBatchLinearizer(
+          trackBatch, linPoint[3], *perigeeSurface, vertexingOptions.geoContext,
+          vertexingOptions.magFieldContext, fieldCache, linTracks);
       if (!result.ok()) {
         return result.error();
       }
+    } else {
+      linTracks.clear();
+      for (const InputTrack& trackContainer : paramVector) {
+        const auto& trackParams = m_cfg.extractParameters(trackContainer);
+
+        auto result =
+            m_cfg.trackLinearizer(trackParams, linPoint[3], *perigeeSurface,
+                                  vertexingOptions.geoContext,
+                                  vertexingOptions.magFieldContext, fieldCache);
+        if (!result.ok()) {
+          return result.error();
+        }
+        linTracks.push_back(std::move(*result));
+      }
+    }
+
+    // iterate over all tracks
+    for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+      const InputTrack& trackContainer = paramVector[iTrack];
 
-      const auto& linTrack = *result;
+      const auto& linTrack = linTracks[iTrack];
       const auto& parametersAtPCA = linTrack.parametersAtPCA;
       double d0 = parametersAtPCA[BoundIndices::eBoundLoc0];
       double z0 = parametersAtPCA[BoundIndices::eBoundLoc1];
@@ -8,8 +8,15 @@
 
 #include "Acts/Vertexing/GaussianTrackDensity.hpp"
 
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <tuple>
+
 #include <math.h>
 
 namespace Acts {
@@ -22,40 +29,62 @@ Acts::GaussianTrackDensity::globalMaximumWithWidth(
     return result.error();
   }
 
-  double maxPosition = 0.;
-  double maxDensity = 0.;
-  double maxSecondDerivative = 0.;
+  const std::vector<double> trialPositions =
+      m_cfg.preScanBinSize > 0. ? preScan(state) : state.trackZ;
 
-  for (const auto& track : state.trackEntries) {
-    double trialZ = track.z;
+  // The Newton searches from the trial positions are independent. Each range
+  // of trial positions keeps the first of its largest maxima, combining the
+  // ranges in order gives the same maximum as a single sequential loop.
+  using Maximum = std::tuple<double, double, double>;
+  constexpr std::size_t minTrialsPerRange = 64;
+  const std::size_t nTrials = trialPositions.size();
+  const std::size_t nRanges = std::min(
+      maxThreads(), std::max<std::size_t>(nTrials / minTrialsPerRange, 1));
+  std::vector<Maximum> rangeMaxima(nRanges, Maximum{0., 0., 0.});
 
-    auto [density, firstDerivative, secondDerivative] =
-        trackDensityAndDerivatives(state, trialZ);
-    if (secondDerivative >= 0. || density <= 0.) {
-      continue;
-    }
-    std::tie(maxPosition, maxDensity, maxSecondDerivative) =
-        updateMaximum(trialZ, density, secondDerivative, maxPosition,
-                      maxDensity, maxSecondDerivative);
+  parallelFor(nRanges, [&](std::size_t iRange) {
+    auto& [maxPosition, maxDensity, maxSecondDerivative] = rangeMaxima[iRange];
+    for (std::size_t iTrial = nTrials * iRange / nRanges;
+         iTrial < nTrials * (iRange + 1) / nRanges; ++iTrial) {
+      double trialZ = trialPositions[iTrial];
 
-    trialZ += stepSize(density, firstDerivative, secondDerivative);
-    std::tie(density, firstDerivative, secondDerivative) =
-        trackDensityAndDerivatives(state, trialZ);
+      auto [density, firstDerivative, secondDerivative] =
+          trackDensityAndDerivatives(state, trialZ);
+      if (secondDerivative >= 0. || density <= 0.) {
+        continue;
+      }
+      std::tie(maxPosition, maxDensity, maxSecondDerivative) =
+          updateMaximum(trialZ, density, secondDerivative, maxPosition,
+                        maxDensity, maxSecondDerivative);
 
-    if (secondDerivative >= 0. || density <= 0.) {
-      continue;
-    }
-    std::tie(maxPosition, maxDensity, maxSecondDerivative) =
-        updateMaximum(trialZ, density, secondDerivative, maxPosition,
-                      maxDensity, maxSecondDerivative);
-    trialZ += stepSize(density, firstDerivative, secondDerivative);
-    std::tie(density, firstDerivative, secondDerivative) =
-        trackDensityAndDerivatives(state, trialZ);
-    if (secondDerivative >= 0. || density <= 0.) {
-      continue;
+      trialZ += stepSize(density, firstDerivative, secondDerivative);
+      std::tie(density, firstDerivative, secondDerivative) =
+          trackDensityAndDerivatives(state, trialZ);
+
+      if (secondDerivative >= 0. || density <= 0.) {
+        continue;
+      }
+      std::tie(maxPosition, maxDensity, maxSecondDerivative) =
+          updateMaximum(trialZ, density, secondDerivative, maxPosition,
+                        maxDensity, maxSecondDerivative);
+      trialZ += stepSize(density, firstDerivative, secondDerivative);
+      std::tie(density, firstDerivative, secondDerivative) =
+          trackDensityAndDerivatives(state, trialZ);
+      if (secondDerivative >= 0. || density <= 0.) {
+        continue;
+      }
+      std::tie(maxPosition, maxDensity, maxSecondDerivative) =
+          updateMaximum(trialZ, density, secondDerivative, maxPosition,
+                        maxDensity, maxSecondDerivative);
     }
+  });
+
+  double maxPosition = 0.;
+  double maxDensity = 0.;
+  double maxSecondDerivative = 0.;
+  for (const auto& [position, density, secondDerivative] : rangeMaxima) {
     std::tie(maxPosition, maxDensity, maxSecondDerivative) =
-        updateMaximum(trialZ, density, secondDerivative, maxPosition,
+        updateMaximum(position, density, secondDerivative, maxPosition,
                       maxDensity, maxSecondDerivative);
   }
 
@@ -81,6 +110,13 @@ Result<std::optional<double>> Acts::GaussianTrackDensity::globalMaximum(
 
 Result<void> Acts::GaussianTrackDensity::addTracks(
     State& state, const std::vector<InputTrack>& trackList) const {
+  state.trackZ.clear();
+  std::vector<double> constantTerms;
+  std::vector<double> linearTerms;
+  std::vector<double> quadraticTerms;
+  std::vector<double> lowerBounds;
+  std::vector<double> upperBounds;
+
   for (auto trk : trackList) {
     const BoundTrackParameters& boundParams = m_cfg.extractParameters(trk);
     // Get required track parameters
@@ -126,20 +162,120 @@ Result<void> Acts::GaussianTrackDensity::addTracks(
     const double zMin = (-linearTerm + discriminant) / (2. * quadraticTerm);
     constantTerm -= std::log(2. * M_PI * std::sqrt(covDeterminant));
 
-    state.trackEntries.emplace_back(z0, constantTerm, linearTerm, quadraticTerm,
-                                    zMin, zMax);
+    state.trackZ.push_back(z0);
+    constantTerms.push_back(constantTerm);
+    linearTerms.push_back(linearTerm);
+    quadraticTerms.push_back(quadraticTerm);
+    lowerBounds.push_back(zMin);
+    upperBounds.push_back(zMax);
+  }
+
+  std::vector<std::size_t> order(lowerBounds.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+    return lowerBounds[a] < lowerBounds[b];
+  });
+
+  auto fill = [&](std::vector<double>& target,
+                  const std::vector<double>& source) {
+    target.clear();
+    for (std::size_t i : order) {
+      target.push_back(source[i]);
+    }
+  };
+  fill(state.constantTerm, constantTerms);
+  fill(state.linearTerm, linearTerms);
+  fill(state.quadraticTerm, quadraticTerms);
+  fill(state.lowerBound, lowerBounds);
+  fill(state.upperBound, upperBounds);
+
+  state.maxWidth = 0.;
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    state.maxWidth = std::max(state.maxWidth, upperBounds[i] - lowerBounds[i]);
   }
+  // leave a margin for the rounding of the widths
+  state.maxWidth *= 1.001;
+
   return Result<void>::success();
 }
 
 std::tuple<double, double, double>
-Acts::GaussianTrackDensity::trackDensityAndDerivatives(State& state,
+Acts::GaussianTrackDensity::trackDensityAndDerivatives(const State& state,
                                                        double z) const {
-  GaussianTrackDensityStore densityResult(z);
-  for (const auto& trackEntry : state.trackEntries) {
-    densityResult.addTrackToDensity(trackEntry);
+  // Only the tracks with a lower bound within the widest region below z can
+  // contribute
+  const auto lowerBegin = state.lowerBound.begin();
+  const std::size_t first =
+      std::lower_bound(lowerBegin, state.lowerBound.end(), z - state.maxWidth) -
+      lowerBegin;
+  const std::size_t last =
+      std::lower_bound(lowerBegin + first, state.lowerBound.end(), z) -
+      lowerBegin;
+
+  double density = 0.;
+  double firstDerivative = 0.;
+  double secondDerivative = 0.;
+  for (std::size_t i = first; i < last; ++i) {
+    // Take track only if it's within bounds
+    if (z < state.upperBound[i]) {
+      const double c1 = state.linearTerm[i];
+      const double c2 = state.quadraticTerm[i];
+      double delta = std::exp(state.constantTerm[i] + z * (c1 + z * c2));
+      double qPrime = c1 + 2. * z * c2;
+      double deltaPrime = delta * qPrime;
+      density += delta;
+      firstDerivative += deltaPrime;
+      secondDerivative += 2. * c2 * delta + qPrime * deltaPrime;
+    }
   }
-  return densityResult.densityAndDerivatives();
+  return {density, firstDerivative, secondDerivative};
+}
+
+std::vector<double> Acts::GaussianTrackDensity::preScan(
+    const State& state) const {
+  std::vector<double> candidates;
+  if (state.lowerBound.empty()) {
+    return candidates;
+  }
+
+  const double zMin = state.lowerBound.front();
+  const double zMax =
+      *std::max_element(state.upperBound.begin(), state.upperBound.end());
+  const auto nBins =
+      static_cast<std::size_t>(std::ceil((zMax - zMin) / m_cfg.preScanBinSize));
+
+  // The grid points are evaluated concurrently, each writes its own density
+  constexpr std::size_t minBinsPerRange = 256;
+  const std::size_t nRanges = std::min(
+      maxThreads(), std::max<std::size_t>((nBins + 1) / minBinsPerRange, 1));
+  std::vector<double> densities(nBins + 1);
+  parallelFor(nRanges, [&](std::size_t iRange) {
+    for (std::size_t i = (nBins + 1) * iRange / nRanges;
+         i < (nBins + 1) * (iRange + 1) / nRanges; ++i) {
+      densities[i] = std::get<0>(
+          trackDensityAndDerivatives(state, zMin + i * m_cfg.preScanBinSize));
+    }
+  });
+
+  std::vector<std::size_t> maxima;
+  for (std::size_t i = 0; i <= nBins; ++i) {
+    if (densities[i] > 0. && (i == 0 || densities[i] >= densities[i - 1]) &&
+        (i == nBins || densities[i] > densities[i + 1])) {
+      maxima.push_back(i);
+    }
+  }
+
+  const std::size_t nCandidates =
+      std::min<std::size_t>(m_cfg.preScanCandidates, maxima.size());
+  std::partial_sort(maxima.begin(), maxima.begin() + nCandidates, maxima.end(),
+                    [&](std::size_t a, std::size_t b) {
+                      return densities[a] > densities[b];
+                    });
+
+  for (std::size_t k = 0; k < nCandidates; ++k) {
+    candidates.push_back(zMin + maxima[k] * m_cfg.preScanBinSize);
+  }
+  return candidates;
 }
 
 std::tuple<double, double, double> Acts::GaussianTrackDensity::updateMaximum(
@@ -158,17 +294,4 @@ double Acts::GaussianTrackDensity::stepSize(double y, double dy,
   return (m_cfg.isGaussianShaped ? (y * dy) / (dy * dy - y * ddy) : -dy / ddy);
 }
 
-void Acts::GaussianTrackDensity::GaussianTrackDensityStore::addTrackToDensity(
-    const TrackEntry& entry) {
-  // Take track only if it's within bounds
-  if (entry.lowerBound < m_z && m_z < entry.upperBound) {
-    double delta = std::exp(entry.c0 + m_z * (entry.c1 + m_z * entry.c2));
-    double qPrime = entry.c1 + 2. * m_z * entry.c2;
-    double deltaPrime = delta * qPrime;
-    m_density += delta;
-    m_firstDerivative += deltaPrime;
-    m_secondDerivative += 2. * entry.c2 * delta + qPrime * deltaPrime;
-  }
-}
-
 }  // namespace Acts
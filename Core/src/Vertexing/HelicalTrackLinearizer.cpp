@@ -11,6 +11,9 @@
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Vertexing/LinearizerTrackParameters.hpp"
 
+#include <cstddef>
+#include <utility>
+
 Acts::Result<Acts::LinearizedTrack>
 Acts::HelicalTrackLinearizer::linearizeTrack(
     const BoundTrackParameters& params, double linPointTime,
@@ -24,6 +27,53 @@ Acts::HelicalTrackLinearizer::linearizeTrack(
   // surface to skip the propagation.
   pOptions.surfaceTolerance = m_cfg.targetTolerance;
 
+  Vector4 linPoint;
+  linPoint.head<3>() = perigeeSurface.center(gctx);
+  linPoint[3] = linPointTime;
+
+  return linearizeAtPerigee(params, linPoint, perigeeSurface, gctx, pOptions,
+                            fieldCache);
+}
+
+Acts::Result<void> Acts::HelicalTrackLinearizer::linearizeTracks(
+    const BoundTrackParametersBatch& params, double linPointTime,
+    const Surface& perigeeSurface, const Acts::GeometryContext& gctx,
+    const Acts::MagneticFieldContext& mctx,
+    MagneticFieldProvider::Cache& fieldCache,
+    std::vector<LinearizedTrack>& linTracks) const {
+  PropagatorOptions<> pOptions(gctx, mctx);
+  pOptions.surfaceTolerance = m_cfg.targetTolerance;
+
+  Vector4 linPoint;
+  linPoint.head<3>() = perigeeSurface.center(gctx);
+  linPoint[3] = linPointTime;
+
+  // One field lookup for all tracks
+  auto field =
+      m_cfg.bField->getField(VectorHelpers::position(linPoint), fieldCache);
+  if (!field.ok()) {
+    return field.error();
+  }
+  ActsScalar Bz = (*field)[eZ];
+
+  linTracks.resize(params.size());
+  for (std::size_t i = 0; i < params.size(); ++i) {
+    auto result = linearizeAtPerigee(params.at(i), linPoint, perigeeSurface,
+                                     gctx, pOptions, fieldCache, Bz);
+    if (!result.ok()) {
+      return result.error();
+    }
+    linTracks[i] = std::move(*result);
+  }
+  return Result<void>::success();
+}
+
+Acts::Result<Acts::LinearizedTrack>
+Acts::HelicalTrackLinearizer::linearizeAtPerigee(
+    const BoundTrackParameters& params, const Vector4& linPoint,
+    const Surface& perigeeSurface, const Acts::GeometryContext& gctx,
+    PropagatorOptions<>& pOptions, MagneticFieldProvider::Cache& fieldCache,
+    std::optional<ActsScalar> sharedBz) const {
   // Get intersection of the track with the Perigee if the particle would
   // move on a straight line.
   // This allows us to determine whether we need to propagate the track
@@ -94,11 +144,17 @@ Acts::HelicalTrackLinearizer::linearizeTrack(
   ActsScalar absoluteCharge = params.particleHypothesis().absoluteCharge();
 
   // get the z-component of the B-field at the PCA
-  auto field = m_cfg.bField->getField(VectorHelpers::position(pca), fieldCache);
-  if (!field.ok()) {
-    return field.error();
+  ActsScalar Bz = 0;
+  if (sharedBz.has_value()) {
+    Bz = *sharedBz;
+  } else {
+    auto field =
+        m_cfg.bField->getField(VectorHelpers::position(pca), fieldCache);
+    if (!field.ok()) {
+      return field.error();
+    }
+    Bz = (*field)[eZ];
   }
-  ActsScalar Bz = (*field)[eZ];
 
   // Complete Jacobian (consists of positionJacobian and momentumJacobian)
   ActsMatrix<eBoundSize, eLinSize> completeJacobian =
@@ -144,8 +200,8 @@ Acts::HelicalTrackLinearizer::linearizeTrack(
     ActsScalar h = (rho < 0.) ? -1 : 1;
 
     // Quantities from Eq. 5.34 in Ref. (1) (see .hpp)
-    ActsScalar X = pca(0) - perigeeSurface.center(gctx).x() + rho * sinPhi;
-    ActsScalar Y = pca(1) - perigeeSurface.center(gctx).y() - rho * cosPhi;
+    ActsScalar X = pca(0) - linPoint.x() + rho * sinPhi;
+    ActsScalar Y = pca(1) - linPoint.y() - rho * cosPhi;
     ActsScalar S2 = (X * X + Y * Y);
     // S is the 2D distance from the helix center to the reference point
     // in the x-y plane
@@ -205,10 +261,6 @@ Acts::HelicalTrackLinearizer::linearizeTrack(
   // The parameter weight
   BoundSquareMatrix weightAtPCA = parCovarianceAtPCA.inverse();
 
-  Vector4 linPoint;
-  linPoint.head<3>() = perigeeSurface.center(gctx);
-  linPoint[3] = linPointTime;
-
   return LinearizedTrack(paramsAtPCA, parCovarianceAtPCA, weightAtPCA, linPoint,
                          positionJacobian, momentumJacobian, pca, momentumAtPCA,
                          constTerm);
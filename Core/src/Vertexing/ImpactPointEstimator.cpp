@@ -14,6 +14,13 @@
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
 namespace Acts {
 
 namespace {
@@ -87,54 +94,118 @@ Result<double> getVertexCompatibilityImpl(const GeometryContext& gctx,
   return residual.dot(weight * residual);
 }
 
+/// @brief Parameters of the helix of a charged particle in a constant B field,
+/// see Sec 4.2 in the reference
+struct Helix {
+  /// Position of the helix center
+  Vector3 center;
+  /// Azimuthal momentum angle at the 2D PCA
+  double phiP = 0.;
+  /// Polar momentum angle (constant along the track)
+  double theta = 0.;
+  /// Cotangent of theta
+  double cotTheta = 0.;
+  /// Signed helix radius
+  double rho = 0.;
+};
+
+/// @brief Constructs the helix of a track from its Perigee parameters
+///
+/// @param trkParams Track parameters
+/// @param refPoint Reference point of the track parameters
+/// @param bZ Z-component of the B field
+///
+/// @return The helix
+Helix makeHelix(const BoundTrackParameters& trkParams, const Vector3& refPoint,
+                double bZ) {
+  double qOvP = trkParams.parameters()[BoundIndices::eBoundQOverP];
+
+  // Spatial Perigee parameters (i.e., spatial parameters of 2D PCA)
+  double d0 = trkParams.parameters()[BoundIndices::eBoundLoc0];
+  double z0 = trkParams.parameters()[BoundIndices::eBoundLoc1];
+
+  Helix helix;
+  // Momentum angles at 2D PCA
+  helix.phiP = trkParams.parameters()[BoundIndices::eBoundPhi];
+  helix.theta = trkParams.parameters()[BoundIndices::eBoundTheta];
+  // Functions of the polar angle theta for later use
+  double sinTheta = std::sin(helix.theta);
+  helix.cotTheta = 1. / std::tan(helix.theta);
+
+  // Signed radius of the helix on which the particle moves
+  helix.rho = sinTheta * (1. / qOvP) / bZ;
+
+  // Position of the helix center.
+  // We can set the z-position to a convenient value since it is not fixed by
+  // the Perigee parameters. Note that we evaluate it at phi = phiP, i.e.,
+  // before the optimization.
+  double phi = helix.phiP;
+  helix.center = refPoint + Vector3(-(d0 - helix.rho) * std::sin(phi),
+                                    (d0 - helix.rho) * std::cos(phi),
+                                    z0 + helix.rho * phi * helix.cotTheta);
+  return helix;
+}
+
+/// @brief Performs one step of the Newton approximation
+///
+/// @param dx X-position of the vertex relative to the helix center
+/// @param dy Y-position of the vertex relative to the helix center
+/// @param dz Z-position of the vertex relative to the helix center
+/// @param phi Current azimuthal momentum angle
+/// @param sinPhi Sine of phi
+/// @param cosPhi Cosine of phi
+/// @param cotTheta Cotangent of the polar momentum angle
+/// @param rho Signed helix radius
+/// @param[out] deltaPhi Change of phi
+///
+/// @return False if the second derivative is negative
+bool newtonStep(double dx, double dy, double dz, double phi, double sinPhi,
+                double cosPhi, double cotTheta, double rho, double& deltaPhi) {
+  double derivative = rho * (dx * cosPhi + dy * sinPhi +
+                             (dz + rho * phi * cotTheta) * cotTheta);
+  double secDerivative =
+      rho * (-dx * sinPhi + dy * cosPhi + rho * cotTheta * cotTheta);
+
+  deltaPhi = -derivative / secDerivative;
+  return !(secDerivative < 0.);
+}
+
 /// @brief Performs a Newton approximation to retrieve a point
 /// of closest approach in 3D to a reference position
 ///
-/// @param helixCenter Position of the helix center
+/// @param helix The helix of the track
 /// @param vtxPos Vertex position
-/// @param phi Azimuthal momentum angle
 /// @note Modifying phi corresponds to moving along the track. This function
-/// optimizes phi until we reach a 3D PCA.
-/// @param theta Polar momentum angle (constant along the track)
-/// @param rho Signed helix radius
+/// optimizes phi, starting at the angle at the 2D PCA, until we reach a 3D
+/// PCA.
 ///
 /// @return Phi value at 3D PCA
 Result<double> performNewtonOptimization(
-    const Vector3& helixCenter, const Vector3& vtxPos, double phi, double theta,
-    double rho, const ImpactPointEstimator::Config& cfg, const Logger& logger) {
+    const Helix& helix, const Vector3& vtxPos,
+    const ImpactPointEstimator::Config& cfg, const Logger& logger) {
+  double phi = helix.phiP;
   double sinPhi = std::sin(phi);
   double cosPhi = std::cos(phi);
 
   int nIter = 0;
   bool hasConverged = false;
 
-  double cotTheta = 1. / std::tan(theta);
-
-  double xO = helixCenter.x();
-  double yO = helixCenter.y();
-  double zO = helixCenter.z();
-
-  double xVtx = vtxPos.x();
-  double yVtx = vtxPos.y();
-  double zVtx = vtxPos.z();
+  double dx = vtxPos.x() - helix.center.x();
+  double dy = vtxPos.y() - helix.center.y();
+  double dz = vtxPos.z() - helix.center.z();
 
   // Iterate until convergence is reached or the maximum amount of iterations
   // is exceeded
   while (!hasConverged && nIter < cfg.maxIterations) {
-    double derivative = rho * ((xVtx - xO) * cosPhi + (yVtx - yO) * sinPhi +
-                               (zVtx - zO + rho * phi * cotTheta) * cotTheta);
-    double secDerivative = rho * (-(xVtx - xO) * sinPhi + (yVtx - yO) * cosPhi +
-                                  rho * cotTheta * cotTheta);
-
-    if (secDerivative < 0.) {
+    double deltaPhi = 0.;
+    if (!newtonStep(dx, dy, dz, phi, sinPhi, cosPhi, helix.cotTheta,
+                    helix.rho, deltaPhi)) {
       ACTS_ERROR(
           "Encountered negative second derivative during Newton "
           "optimization.");
       return VertexingError::NumericFailure;
     }
 
-    double deltaPhi = -derivative / secDerivative;
-
     phi += deltaPhi;
     sinPhi = std::sin(phi);
     cosPhi = std::cos(phi);
@@ -153,137 +224,164 @@ Result<double> performNewtonOptimization(
   return phi;
 }
 
-// Note: always return Vector4, we'll chop off the last component if needed
-template <typename vector_t>
-Result<std::pair<Vector4, Vector3>> getDistanceAndMomentumImpl(
-    const GeometryContext& gctx, const BoundTrackParameters& trkParams,
-    const vector_t& vtxPos, const ImpactPointEstimator::Config& cfg,
-    ImpactPointEstimator::State& state, const Logger& logger) {
-  static constexpr int nDim = vector_t::RowsAtCompileTime;
-  static_assert(nDim == 3 || nDim == 4,
-                "The number of dimensions nDim must be either 3 or 4.");
+/// @brief Performs the Newton approximation of `performNewtonOptimization`
+/// for many helices at once
+///
+/// The helices are given as structure of arrays. The iterations of all
+/// helices which did not converge yet run together, such that the loops over
+/// them can be vectorized. The result for each helix is the same as the one
+/// of `performNewtonOptimization`.
+///
+/// @param dx X-positions of the vertex relative to the helix centers
+/// @param dy Y-positions of the vertex relative to the helix centers
+/// @param dz Z-positions of the vertex relative to the helix centers
+/// @param cotTheta Cotangents of the polar momentum angles
+/// @param rho Signed helix radii
+/// @param[in,out] phi Phi values at the 2D PCA, replaced by the ones at the
+/// 3D PCA
+Result<void> performNewtonOptimizations(
+    const std::vector<double>& dx, const std::vector<double>& dy,
+    const std::vector<double>& dz, const std::vector<double>& cotTheta,
+    const std::vector<double>& rho, std::vector<double>& phi,
+    const ImpactPointEstimator::Config& cfg, const Logger& logger) {
+  const std::size_t nHelices = phi.size();
+  std::vector<double> sinPhi(nHelices);
+  std::vector<double> cosPhi(nHelices);
+  std::vector<double> deltaPhi(nHelices);
+  for (std::size_t i = 0; i < nHelices; ++i) {
+    sinPhi[i] = std::sin(phi[i]);
+    cosPhi[i] = std::cos(phi[i]);
+  }
 
-  // Reference point R
-  Vector3 refPoint = trkParams.referenceSurface().center(gctx);
+  // Helices which did not converge yet
+  std::vector<std::size_t> active(nHelices);
+  std::iota(active.begin(), active.end(), 0);
 
-  // Extract charge-related particle parameters
-  double absoluteCharge = trkParams.particleHypothesis().absoluteCharge();
-  double qOvP = trkParams.parameters()[BoundIndices::eBoundQOverP];
+  for (int nIter = 0; nIter < cfg.maxIterations && !active.empty(); ++nIter) {
+    bool isValid = true;
+    for (std::size_t i : active) {
+      isValid &= newtonStep(dx[i], dy[i], dz[i], phi[i], sinPhi[i], cosPhi[i],
+                            cotTheta[i], rho[i], deltaPhi[i]);
+      phi[i] += deltaPhi[i];
+    }
+    if (!isValid) {
+      ACTS_ERROR(
+          "Encountered negative second derivative during Newton "
+          "optimization.");
+      return VertexingError::NumericFailure;
+    }
+    for (std::size_t i : active) {
+      sinPhi[i] = std::sin(phi[i]);
+      cosPhi[i] = std::cos(phi[i]);
+    }
+    active.erase(std::remove_if(active.begin(), active.end(),
+                                [&](std::size_t i) {
+                                  return std::abs(deltaPhi[i]) < cfg.precision;
+                                }),
+                 active.end());
+  }
 
-  // Z-component of the B field at the reference position.
-  // Note that we assume a constant B field here!
-  auto fieldRes = cfg.bField->getField(refPoint, state.fieldCache);
-  if (!fieldRes.ok()) {
-    ACTS_ERROR("In getDistanceAndMomentum, the B field at\n"
-               << refPoint << "\ncould not be retrieved.");
-    return fieldRes.error();
+  if (!active.empty()) {
+    ACTS_ERROR("Newton optimization did not converge.");
+    return VertexingError::NotConverged;
   }
-  double bZ = (*fieldRes)[eZ];
+  return {};
+}
 
-  // The particle moves on a straight trajectory if its charge is 0 or if there
-  // is no B field. In that case, the 3D PCA can be calculated analytically, see
-  // Sec 3.2 of the reference.
-  if (absoluteCharge == 0. || bZ == 0.) {
-    // Momentum direction (constant for straight tracks)
-    Vector3 momDirStraightTrack = trkParams.direction();
-
-    // Current position on the track
-    Vector3 positionOnTrack = trkParams.position(gctx);
-
-    // Distance between positionOnTrack and the 3D PCA
-    ActsScalar distanceToPca =
-        (vtxPos.template head<3>() - positionOnTrack).dot(momDirStraightTrack);
-
-    // 3D PCA
-    ActsVector<nDim> pcaStraightTrack;
-    pcaStraightTrack.template head<3>() =
-        positionOnTrack + distanceToPca * momDirStraightTrack;
-    if constexpr (nDim == 4) {
-      // Track time at positionOnTrack
-      double timeOnTrack = trkParams.parameters()[BoundIndices::eBoundTime];
-
-      ActsScalar m0 = trkParams.particleHypothesis().mass();
-      ActsScalar p = trkParams.particleHypothesis().extractMomentum(qOvP);
-
-      // Speed in units of c
-      ActsScalar beta = p / std::hypot(p, m0);
-
-      pcaStraightTrack[3] = timeOnTrack + distanceToPca / beta;
-    }
+/// @brief Calculates the distance and momentum direction at the 3D PCA of a
+/// particle moving on a straight trajectory, see Sec 3.2 of the reference
+///
+/// @param gctx Geometry context
+/// @param trkParams Track parameters
+/// @param vtxPos Vertex position
+///
+/// @return Vector from the vertex to the 3D PCA and momentum direction
+template <typename vector_t>
+std::pair<Vector4, Vector3> getStraightDistanceAndMomentum(
+    const GeometryContext& gctx, const BoundTrackParameters& trkParams,
+    const vector_t& vtxPos) {
+  static constexpr int nDim = vector_t::RowsAtCompileTime;
 
-    // Vector pointing from the vertex position to the 3D PCA
-    Vector4 deltaRStraightTrack{Vector4::Zero()};
-    deltaRStraightTrack.head<nDim>() = pcaStraightTrack - vtxPos;
+  // Momentum direction (constant for straight tracks)
+  Vector3 momDirStraightTrack = trkParams.direction();
 
-    return std::make_pair(deltaRStraightTrack, momDirStraightTrack);
-  }
+  // Current position on the track
+  Vector3 positionOnTrack = trkParams.position(gctx);
 
-  // Charged particles in a constant B field follow a helical trajectory. In
-  // that case, we calculate the 3D PCA using the Newton method, see Sec 4.2 in
-  // the reference.
+  // Distance between positionOnTrack and the 3D PCA
+  ActsScalar distanceToPca =
+      (vtxPos.template head<3>() - positionOnTrack).dot(momDirStraightTrack);
 
-  // Spatial Perigee parameters (i.e., spatial parameters of 2D PCA)
-  double d0 = trkParams.parameters()[BoundIndices::eBoundLoc0];
-  double z0 = trkParams.parameters()[BoundIndices::eBoundLoc1];
-  // Momentum angles at 2D PCA
-  double phiP = trkParams.parameters()[BoundIndices::eBoundPhi];
-  double theta = trkParams.parameters()[BoundIndices::eBoundTheta];
-  // Functions of the polar angle theta for later use
-  double sinTheta = std::sin(theta);
-  double cotTheta = 1. / std::tan(theta);
+  // 3D PCA
+  ActsVector<nDim> pcaStraightTrack;
+  pcaStraightTrack.template head<3>() =
+      positionOnTrack + distanceToPca * momDirStraightTrack;
+  if constexpr (nDim == 4) {
+    // Track time at positionOnTrack
+    double timeOnTrack = trkParams.parameters()[BoundIndices::eBoundTime];
 
-  // Set optimization variable phi to the angle at the 2D PCA as a first guess.
-  // Note that phi corresponds to phiV in the reference.
-  double phi = phiP;
+    double qOvP = trkParams.parameters()[BoundIndices::eBoundQOverP];
+    ActsScalar m0 = trkParams.particleHypothesis().mass();
+    ActsScalar p = trkParams.particleHypothesis().extractMomentum(qOvP);
 
-  // Signed radius of the helix on which the particle moves
-  double rho = sinTheta * (1. / qOvP) / bZ;
+    // Speed in units of c
+    ActsScalar beta = p / std::hypot(p, m0);
 
-  // Position of the helix center.
-  // We can set the z-position to a convenient value since it is not fixed by
-  // the Perigee parameters. Note that phi = phiP because we did not start the
-  // optimization yet.
-  Vector3 helixCenter =
-      refPoint + Vector3(-(d0 - rho) * std::sin(phi),
-                         (d0 - rho) * std::cos(phi), z0 + rho * phi * cotTheta);
-
-  // Use Newton optimization method to iteratively change phi until we arrive at
-  // the 3D PCA
-  auto res = performNewtonOptimization(helixCenter, vtxPos.template head<3>(),
-                                       phi, theta, rho, cfg, logger);
-  if (!res.ok()) {
-    return res.error();
+    pcaStraightTrack[3] = timeOnTrack + distanceToPca / beta;
   }
-  // Set new phi value
-  phi = *res;
+
+  // Vector pointing from the vertex position to the 3D PCA
+  Vector4 deltaRStraightTrack{Vector4::Zero()};
+  deltaRStraightTrack.head<nDim>() = pcaStraightTrack - vtxPos;
+
+  return std::make_pair(deltaRStraightTrack, momDirStraightTrack);
+}
+
+/// @brief Calculates the distance and momentum direction at the 3D PCA of a
+/// helical track
+///
+/// @param trkParams Track parameters
+/// @param helix The helix of the track
+/// @param phi Phi value at the 3D PCA
+/// @param vtxPos Vertex position
+///
+/// @return Vector from the vertex to the 3D PCA and momentum direction
+template <typename vector_t>
+std::pair<Vector4, Vector3> getHelixDistanceAndMomentum(
+    const BoundTrackParameters& trkParams, const Helix& helix, double phi,
+    const vector_t& vtxPos) {
+  static constexpr int nDim = vector_t::RowsAtCompileTime;
 
   double cosPhi = std::cos(phi);
   double sinPhi = std::sin(phi);
+  double sinTheta = std::sin(helix.theta);
 
   // Momentum direction at the 3D PCA.
   // Note that we have thetaV = thetaP = theta since the polar angle does not
   // change in a constant B field.
   Vector3 momDir =
-      Vector3(cosPhi * sinTheta, sinPhi * sinTheta, std::cos(theta));
+      Vector3(cosPhi * sinTheta, sinPhi * sinTheta, std::cos(helix.theta));
 
   // 3D PCA (point P' in the reference). Note that the prefix "3D" does not
   // refer to the dimension of the pca variable. Rather, it indicates that we
   // minimized the 3D distance between the track and the reference point.
   ActsVector<nDim> pca;
   pca.template head<3>() =
-      helixCenter + rho * Vector3(-sinPhi, cosPhi, -cotTheta * phi);
+      helix.center +
+      helix.rho * Vector3(-sinPhi, cosPhi, -helix.cotTheta * phi);
 
   if constexpr (nDim == 4) {
     // Time at the 2D PCA P
     double tP = trkParams.parameters()[BoundIndices::eBoundTime];
 
+    double qOvP = trkParams.parameters()[BoundIndices::eBoundQOverP];
     ActsScalar m0 = trkParams.particleHypothesis().mass();
     ActsScalar p = trkParams.particleHypothesis().extractMomentum(qOvP);
 
     // Speed in units of c
     ActsScalar beta = p / std::hypot(p, m0);
 
-    pca[3] = tP - rho / (beta * sinTheta) * (phi - phiP);
+    pca[3] = tP - helix.rho / (beta * sinTheta) * (phi - helix.phiP);
   }
   // Vector pointing from the vertex position to the 3D PCA
   Vector4 deltaR{Vector4::Zero()};
@@ -292,6 +390,121 @@ Result<std::pair<Vector4, Vector3>> getDistanceAndMomentumImpl(
   return std::make_pair(deltaR, momDir);
 }
 
+// Note: always return Vector4, we'll chop off the last component if needed
+template <typename vector_t>
+Result<std::pair<Vector4, Vector3>> getDistanceAndMomentumImpl(
+    const GeometryContext& gctx, const BoundTrackParameters& trkParams,
+    const vector_t& vtxPos, const ImpactPointEstimator::Config& cfg,
+    ImpactPointEstimator::State& state, const Logger& logger) {
+  static constexpr int nDim = vector_t::RowsAtCompileTime;
+  static_assert(nDim == 3 || nDim == 4,
+                "The number of dimensions nDim must be either 3 or 4.");
+
+  // Reference point R
+  Vector3 refPoint = trkParams.referenceSurface().center(gctx);
+
+  // Z-component of the B field at the reference position.
+  // Note that we assume a constant B field here!
+  auto fieldRes = cfg.bField->getField(refPoint, state.fieldCache);
+  if (!fieldRes.ok()) {
+    ACTS_ERROR("In getDistanceAndMomentum, the B field at\n"
+               << refPoint << "\ncould not be retrieved.");
+    return fieldRes.error();
+  }
+  double bZ = (*fieldRes)[eZ];
+
+  // The particle moves on a straight trajectory if its charge is 0 or if there
+  // is no B field. In that case, the 3D PCA can be calculated analytically.
+  if (trkParams.particleHypothesis().absoluteCharge() == 0. || bZ == 0.) {
+    return getStraightDistanceAndMomentum(gctx, trkParams, vtxPos);
+  }
+
+  // Charged particles in a constant B field follow a helical trajectory. In
+  // that case, we calculate the 3D PCA using the Newton method.
+  Helix helix = makeHelix(trkParams, refPoint, bZ);
+  auto res = performNewtonOptimization(helix, vtxPos.template head<3>(), cfg,
+                                       logger);
+  if (!res.ok()) {
+    return res.error();
+  }
+
+  return getHelixDistanceAndMomentum(trkParams, helix, *res, vtxPos);
+}
+
+// Batch version of getDistanceAndMomentumImpl
+template <typename vector_t>
+Result<void> getDistancesAndMomentaImpl(
+    const GeometryContext& gctx,
+    const std::vector<BoundTrackParameters>& trkParams, const vector_t& vtxPos,
+    const ImpactPointEstimator::Config& cfg,
+    ImpactPointEstimator::State& state, const Logger& logger,
+    std::vector<std::pair<Vector4, Vector3>>& distancesAndMomenta) {
+  static constexpr int nDim = vector_t::RowsAtCompileTime;
+  static_assert(nDim == 3 || nDim == 4,
+                "The number of dimensions nDim must be either 3 or 4.");
+
+  distancesAndMomenta.resize(trkParams.size());
+
+  // Tracks on a helical trajectory and their helices
+  std::vector<std::size_t> helixTracks;
+  std::vector<Helix> helices;
+
+  // The tracks typically share their reference point, e.g., the beam line, so
+  // the B field is only retrieved when it changes
+  std::optional<Vector3> lastRefPoint;
+  double bZ = 0.;
+  for (std::size_t i = 0; i < trkParams.size(); ++i) {
+    Vector3 refPoint = trkParams[i].referenceSurface().center(gctx);
+    if (!lastRefPoint.has_value() || *lastRefPoint != refPoint) {
+      auto fieldRes = cfg.bField->getField(refPoint, state.fieldCache);
+      if (!fieldRes.ok()) {
+        ACTS_ERROR("In getDistanceAndMomentum, the B field at\n"
+                   << refPoint << "\ncould not be retrieved.");
+        return fieldRes.error();
+      }
+      bZ = (*fieldRes)[eZ];
+      lastRefPoint = refPoint;
+    }
+
+    if (trkParams[i].particleHypothesis().absoluteCharge() == 0. ||
+        bZ == 0.) {
+      distancesAndMomenta[i] =
+          getStraightDistanceAndMomentum(gctx, trkParams[i], vtxPos);
+    } else {
+      helixTracks.push_back(i);
+      helices.push_back(makeHelix(trkParams[i], refPoint, bZ));
+    }
+  }
+
+  const std::size_t nHelices = helices.size();
+  std::vector<double> dx(nHelices);
+  std::vector<double> dy(nHelices);
+  std::vector<double> dz(nHelices);
+  std::vector<double> cotTheta(nHelices);
+  std::vector<double> rho(nHelices);
+  std::vector<double> phi(nHelices);
+  for (std::size_t k = 0; k < nHelices; ++k) {
+    dx[k] = vtxPos.x() - helices[k].center.x();
+    dy[k] = vtxPos.y() - helices[k].center.y();
+    dz[k] = vtxPos.z() - helices[k].center.z();
+    cotTheta[k] = helices[k].cotTheta;
+    rho[k] = helices[k].rho;
+    phi[k] = helices[k].phiP;
+  }
+
+  auto res = performNewtonOptimizations(dx, dy, dz, cotTheta, rho, phi, cfg,
+                                        logger);
+  if (!res.ok()) {
+    return res.error();
+  }
+
+  for (std::size_t k = 0; k < nHelices; ++k) {
+    distancesAndMomenta[helixTracks[k]] = getHelixDistanceAndMomentum(
+        trkParams[helixTracks[k]], helices[k], phi[k], vtxPos);
+  }
+  return {};
+}
+
 }  // namespace
 
 Result<double> ImpactPointEstimator::calculateDistance(
@@ -320,14 +533,45 @@ Result<BoundTrackParameters> ImpactPointEstimator::estimate3DImpactParameters(
     return res.error();
   }
 
+  return propagateTo3DPCA(gctx, mctx, trkParams, vtxPos, *res);
+}
+
+Result<void> ImpactPointEstimator::estimate3DImpactParameters(
+    const GeometryContext& gctx, const MagneticFieldContext& mctx,
+    const std::vector<BoundTrackParameters>& trkParams, const Vector3& vtxPos,
+    State& state, std::vector<BoundTrackParameters>& ipParams) const {
+  std::vector<std::pair<Vector4, Vector3>> distancesAndMomenta;
+  auto res = getDistancesAndMomentaImpl(gctx, trkParams, vtxPos, m_cfg, state,
+                                        *m_logger, distancesAndMomenta);
+  if (!res.ok()) {
+    return res.error();
+  }
+
+  ipParams.clear();
+  ipParams.reserve(trkParams.size());
+  for (std::size_t i = 0; i < trkParams.size(); ++i) {
+    auto result = propagateTo3DPCA(gctx, mctx, trkParams[i], vtxPos,
+                                   distancesAndMomenta[i]);
+    if (!result.ok()) {
+      return result.error();
+    }
+    ipParams.push_back(std::move(*result));
+  }
+  return {};
+}
+
+Result<BoundTrackParameters> ImpactPointEstimator::propagateTo3DPCA(
+    const GeometryContext& gctx, const MagneticFieldContext& mctx,
+    const BoundTrackParameters& trkParams, const Vector3& vtxPos,
+    const std::pair<Vector4, Vector3>& distanceAndMomentum) const {
   // Vector pointing from vertex to 3D PCA
-  Vector3 deltaR = res.value().first.head<3>();
+  Vector3 deltaR = distanceAndMomentum.first.head<3>();
 
   // Get corresponding unit vector
   deltaR.normalize();
 
   // Momentum direction at vtxPos
-  Vector3 momDir = res.value().second;
+  Vector3 momDir = distanceAndMomentum.second;
 
   // To understand why deltaR and momDir are not orthogonal, let us look at the
   // x-y-plane. Since we computed the 3D PCA, the 2D distance between the vertex
@@ -399,6 +643,22 @@ Result<double> ImpactPointEstimator::getVertexCompatibility(
   }
 }
 
+Result<void> ImpactPointEstimator::getVertexCompatibilities(
+    const GeometryContext& gctx,
+    const std::vector<BoundTrackParameters>& trkParams,
+    Eigen::Map<const ActsDynamicVector> vertexPos,
+    std::vector<double>& compatibilities) const {
+  compatibilities.resize(trkParams.size());
+  for (std::size_t i = 0; i < trkParams.size(); ++i) {
+    auto res = getVertexCompatibility(gctx, &trkParams[i], vertexPos);
+    if (!res.ok()) {
+      return res.error();
+    }
+    compatibilities[i] = *res;
+  }
+  return {};
+}
+
 Result<std::pair<Acts::Vector4, Acts::Vector3>>
 ImpactPointEstimator::getDistanceAndMomentum(
     const GeometryContext& gctx, const BoundTrackParameters& trkParams,
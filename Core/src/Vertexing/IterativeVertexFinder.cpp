@@ -9,8 +9,12 @@
 #include "Acts/Vertexing/IterativeVertexFinder.hpp"
 
 #include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Vertexing/KalmanVertexUpdater.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <cmath>
+#include <limits>
+
 Acts::IterativeVertexFinder::IterativeVertexFinder(
     Config cfg, std::unique_ptr<const Logger> logger)
     : m_cfg(std::move(cfg)), m_logger(std::move(logger)) {
@@ -52,6 +56,15 @@ auto Acts::IterativeVertexFinder::find(
 
   // List of vertices to be filled below
   std::vector<Vertex> vertexCollection;
+  // Cached quantities of each vertex in the collection
+  std::vector<VertexCache> vertexCaches;
+  auto addVertex = [&](const Vertex& vertex) {
+    vertexCollection.push_back(vertex);
+    vertexCaches.push_back(
+        {Surface::makeShared<PerigeeSurface>(vertex.position()),
+         std::vector<double>(vertex.tracks().size(),
+                             std::numeric_limits<double>::quiet_NaN())});
+  };
 
   int nInterations = 0;
   // begin iterating
@@ -141,8 +154,8 @@ auto Acts::IterativeVertexFinder::find(
         // but add tracks which may have been missed
 
         auto result = reassignTracksToNewVertex(
-            vertexCollection, currentVertex, tracksToFit, seedTracks,
-            origTracks, vertexingOptions, state);
+            vertexCollection, vertexCaches, currentVertex, tracksToFit,
+            seedTracks, origTracks, vertexingOptions, state);
         if (!result.ok()) {
           return result.error();
         }
@@ -175,10 +188,10 @@ auto Acts::IterativeVertexFinder::find(
     }
     // Now fill vertex collection with vertex
     if (isGoodVertex) {
-      vertexCollection.push_back(currentVertex);
+      addVertex(currentVertex);
     }
     if (isGoodSplitVertex && m_cfg.createSplitVertices) {
-      vertexCollection.push_back(currentSplitVertex);
+      addVertex(currentSplitVertex);
     }
 
     nInterations++;
@@ -248,8 +261,11 @@ Acts::Result<double> Acts::IterativeVertexFinder::getCompatibility(
     return result.error();
   }
 
-  auto linTrack = std::move(*result);
+  return getCompatibility(*result, vertex);
+}
 
+double Acts::IterativeVertexFinder::getCompatibility(
+    const LinearizedTrack& linTrack, const Vertex& vertex) const {
   // Calculate reduced weight
   SquareMatrix2 weightReduced =
       linTrack.covarianceAtPCA.template block<2, 2>(0, 0);
@@ -434,7 +450,8 @@ Acts::Result<void> Acts::IterativeVertexFinder::fillTracksToFit(
 }
 
 Acts::Result<bool> Acts::IterativeVertexFinder::reassignTracksToNewVertex(
-    std::vector<Vertex>& vertexCollection, Vertex& currentVertex,
+    std::vector<Vertex>& vertexCollection,
+    std::vector<VertexCache>& vertexCaches, Vertex& currentVertex,
     std::vector<InputTrack>& tracksToFit, std::vector<InputTrack>& seedTracks,
     const std::vector<InputTrack>& /* origTracks */,
     const VertexingOptions& vertexingOptions, State& state) const {
@@ -444,75 +461,84 @@ Acts::Result<bool> Acts::IterativeVertexFinder::reassignTracksToNewVertex(
       Surface::makeShared<PerigeeSurface>(
           VectorHelpers::position(currentVertex.fullPosition()));
 
+  // reassigned tracks linearized at the current vertex
+  std::vector<TrackAtVertex> addedTracks;
+
   // iterate over all vertices and check if tracks need to be reassigned
   // to new (current) vertex
-  for (auto& vertexIt : vertexCollection) {
+  for (std::size_t iVertex = 0; iVertex < vertexCollection.size(); ++iVertex) {
+    Vertex& vertexIt = vertexCollection[iVertex];
+    VertexCache& vertexCache = vertexCaches[iVertex];
+
     // tracks at vertexIt
     std::vector<TrackAtVertex> tracksAtVertex = vertexIt.tracks();
-    auto tracksBegin = tracksAtVertex.begin();
-    auto tracksEnd = tracksAtVertex.end();
 
-    const std::shared_ptr<PerigeeSurface> vertexItPerigeeSurface =
-        Surface::makeShared<PerigeeSurface>(
-            VectorHelpers::position(vertexIt.fullPosition()));
-
-    for (auto tracksIter = tracksBegin; tracksIter != tracksEnd;) {
+    for (std::size_t iTrack = 0; iTrack < tracksAtVertex.size();) {
+      const TrackAtVertex& trackAtVertex = tracksAtVertex[iTrack];
       // consider only tracks that are not too tightly assigned to other
       // vertex
-      if (tracksIter->trackWeight > m_cfg.cutOffTrackWeightReassign) {
-        tracksIter++;
+      if (trackAtVertex.trackWeight > m_cfg.cutOffTrackWeightReassign) {
+        ++iTrack;
         continue;
       }
       // use original perigee parameters
-      BoundTrackParameters origParams =
-          m_cfg.extractParameters(tracksIter->originalParams);
+      const BoundTrackParameters& origParams =
+          m_cfg.extractParameters(trackAtVertex.originalParams);
 
       // compute compatibility
-      auto resultNew = getCompatibility(origParams, currentVertex,
-                                        *currentVertexPerigeeSurface,
-                                        vertexingOptions, state);
-      if (!resultNew.ok()) {
-        return Result<bool>::failure(resultNew.error());
+      auto linResult = m_cfg.trackLinearizer(
+          origParams, currentVertex.fullPosition()[3],
+          *currentVertexPerigeeSurface, vertexingOptions.geoContext,
+          vertexingOptions.magFieldContext, state.fieldCache);
+      if (!linResult.ok()) {
+        return Result<bool>::failure(linResult.error());
       }
-      double chi2NewVtx = *resultNew;
-
-      auto resultOld =
-          getCompatibility(origParams, vertexIt, *vertexItPerigeeSurface,
-                           vertexingOptions, state);
-      if (!resultOld.ok()) {
-        return Result<bool>::failure(resultOld.error());
+      double chi2NewVtx = getCompatibility(*linResult, currentVertex);
+
+      // the old vertex is unchanged since it was found, so the compatibility
+      // of its tracks only needs to be computed once
+      double& chi2OldVtx = vertexCache.compatibilities[iTrack];
+      if (std::isnan(chi2OldVtx)) {
+        auto resultOld =
+            getCompatibility(origParams, vertexIt, *vertexCache.perigeeSurface,
+                             vertexingOptions, state);
+        if (!resultOld.ok()) {
+          return Result<bool>::failure(resultOld.error());
+        }
+        chi2OldVtx = *resultOld;
       }
-      double chi2OldVtx = *resultOld;
 
       ACTS_DEBUG("Compatibility to new vs old vertex: " << chi2NewVtx << " vs "
                                                         << chi2OldVtx);
 
       if (chi2NewVtx < chi2OldVtx) {
-        tracksToFit.push_back(tracksIter->originalParams);
+        tracksToFit.push_back(trackAtVertex.originalParams);
         // origTrack was already deleted from seedTracks previously
         // (when assigned to old vertex)
         // add it now back to seedTracks to be able to consistently
         // delete it later
         // when all tracks used to fit current vertex are deleted
-        seedTracks.push_back(tracksIter->originalParams);
-        // seedTracks.push_back(*std::find_if(
-        //     origTracks.begin(), origTracks.end(),
-        //     [&origParams, this](auto origTrack) {
-        //       return origParams == m_extractParameters(*origTrack);
-        //     }));
+        seedTracks.push_back(trackAtVertex.originalParams);
+
+        if (m_cfg.reassignWithKalmanUpdate) {
+          TrackAtVertex addedTrack(origParams, trackAtVertex.originalParams);
+          addedTrack.linearizedState = std::move(*linResult);
+          addedTrack.isLinearized = true;
+          addedTracks.push_back(std::move(addedTrack));
+        }
 
         numberOfAddedTracks += 1;
 
         // remove track from old vertex
-        tracksIter = tracksAtVertex.erase(tracksIter);
-        tracksBegin = tracksAtVertex.begin();
-        tracksEnd = tracksAtVertex.end();
+        tracksAtVertex.erase(tracksAtVertex.begin() + iTrack);
+        vertexCache.compatibilities.erase(
+            vertexCache.compatibilities.begin() + iTrack);
 
       }  // end chi2NewVtx < chi2OldVtx
 
       else {
         // go and check next track
-        ++tracksIter;
+        ++iTrack;
       }
     }  // end loop over tracks at old vertexIt
 
@@ -522,25 +548,41 @@ Acts::Result<bool> Acts::IterativeVertexFinder::reassignTracksToNewVertex(
   ACTS_DEBUG("Added " << numberOfAddedTracks
                       << " tracks from old (other) vertices for new fit");
 
-  // override current vertex with new fit
-  // set first to default vertex to be able to check if still good vertex
-  // later
-  currentVertex = Vertex();
-  if (vertexingOptions.useConstraintInFit && !tracksToFit.empty()) {
-    auto fitResult =
-        m_cfg.vertexFitter.fit(tracksToFit, vertexingOptions, state.fieldCache);
-    if (fitResult.ok()) {
-      currentVertex = std::move(*fitResult);
-    } else {
-      return Result<bool>::success(false);
+  // the fit of the current vertex is still valid if no track was added
+  if (numberOfAddedTracks > 0 && m_cfg.reassignWithKalmanUpdate) {
+    // update the current vertex with the added tracks only, which are
+    // linearized at its position before the update
+    std::vector<TrackAtVertex> tracksAtVertex = currentVertex.tracks();
+    for (auto& addedTrack : addedTracks) {
+      KalmanVertexUpdater::updateVertexWithTrack(currentVertex, addedTrack, 4);
     }
-  } else if (!vertexingOptions.useConstraintInFit && tracksToFit.size() > 1) {
-    auto fitResult =
-        m_cfg.vertexFitter.fit(tracksToFit, vertexingOptions, state.fieldCache);
-    if (fitResult.ok()) {
-      currentVertex = std::move(*fitResult);
-    } else {
-      return Result<bool>::success(false);
+    for (auto& addedTrack : addedTracks) {
+      KalmanVertexUpdater::updateTrackWithVertex(addedTrack, currentVertex, 4);
+      tracksAtVertex.push_back(std::move(addedTrack));
+    }
+    currentVertex.setTracksAtVertex(std::move(tracksAtVertex));
+  } else if (numberOfAddedTracks > 0) {
+    // override current vertex with new fit
+    // set first to default vertex to be able to check if still good vertex
+    // later
+    currentVertex = Vertex();
+    if (vertexingOptions.useConstraintInFit && !tracksToFit.empty()) {
+      auto fitResult = m_cfg.vertexFitter.fit(tracksToFit, vertexingOptions,
+                                              state.fieldCache);
+      if (fitResult.ok()) {
+        currentVertex = std::move(*fitResult);
+      } else {
+        return Result<bool>::success(false);
+      }
+    } else if (!vertexingOptions.useConstraintInFit &&
+               tracksToFit.size() > 1) {
+      auto fitResult = m_cfg.vertexFitter.fit(tracksToFit, vertexingOptions,
+                                              state.fieldCache);
+      if (fitResult.ok()) {
+        currentVertex = std::move(*fitResult);
+      } else {
+        return Result<bool>::success(false);
+      }
     }
   }
 
@@ -112,6 +112,8 @@ class AlignmentAlgorithm final : public IAlgorithm {
     std::size_t maxNumIterations = 100;
     /// Number of tracks to be used for alignment
     int maxNumTracks = -1;
+    /// The options of the solver for the alignment parameters change
+    ActsAlignment::AlignmentSolverOptions solverOptions;
     std::vector<AlignmentGroup> m_groups;
   };
 
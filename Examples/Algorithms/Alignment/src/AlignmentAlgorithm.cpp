@@ -121,6 +121,7 @@ ActsExamples::ProcessCode ActsExamples::AlignmentAlgorithm::execute(
   ActsAlignment::AlignmentOptions<TrackFitterOptions> alignOptions(
       kfOptions, m_cfg.alignedTransformUpdater, m_cfg.alignedDetElements,
       m_cfg.chi2ONdfCutOff, m_cfg.deltaChi2ONdfCutOff, m_cfg.maxNumIterations);
+  alignOptions.solverOptions = m_cfg.solverOptions;
 
   ACTS_DEBUG("Invoke track-based alignment with " << numTracksUsed
                                                   << " input tracks");
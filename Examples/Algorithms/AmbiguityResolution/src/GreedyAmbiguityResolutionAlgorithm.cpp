@@ -20,6 +20,7 @@
 #include <iterator>
 #include <numeric>
 #include <stdexcept>
+#include <vector>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
@@ -86,12 +87,13 @@ ActsExamples::GreedyAmbiguityResolutionAlgorithm::execute(
                               std::make_shared<Acts::VectorMultiTrajectory>()};
   solvedTracks.ensureDynamicColumns(tracks);
 
+  // the selected tracks keep pointing to the input track states
+  std::vector<Acts::TrackIndexType> selectedTracks;
+  selectedTracks.reserve(state.selectedTracks.size());
   for (auto iTrack : state.selectedTracks) {
-    auto destProxy = solvedTracks.makeTrack();
-    auto srcProxy = tracks.getTrack(state.trackTips.at(iTrack));
-    destProxy.copyFrom(srcProxy, false);
-    destProxy.tipIndex() = srcProxy.tipIndex();
+    selectedTracks.push_back(state.trackTips.at(iTrack));
   }
+  solvedTracks.container().append(tracks.container(), selectedTracks);
 
   ActsExamples::ConstTrackContainer outputTracks{
       std::make_shared<Acts::ConstVectorTrackContainer>(
@@ -18,6 +18,7 @@
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
 #include <fstream>
+#include <vector>
 
 namespace {
 
@@ -135,12 +136,10 @@ ActsExamples::ScoreBasedAmbiguityResolutionAlgorithm::execute(
   TrackContainer solvedTracks{std::make_shared<Acts::VectorTrackContainer>(),
                               std::make_shared<Acts::VectorMultiTrajectory>()};
   solvedTracks.ensureDynamicColumns(tracks);
-  for (auto iTrack : goodTracks) {
-    auto destProxy = solvedTracks.makeTrack();
-    auto srcProxy = tracks.getTrack(iTrack);
-    destProxy.copyFrom(srcProxy, false);
-    destProxy.tipIndex() = srcProxy.tipIndex();
-  }
+  // the selected tracks keep pointing to the input track states
+  std::vector<Acts::TrackIndexType> selectedTracks(goodTracks.begin(),
+                                                   goodTracks.end());
+  solvedTracks.container().append(tracks.container(), selectedTracks);
 
   ActsExamples::ConstTrackContainer outputTracks{
       std::make_shared<Acts::ConstVectorTrackContainer>(
@@ -25,12 +25,14 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Utilities/Range.hpp"
 #include "ActsFatras/Digitization/Channelizer.hpp"
 #include "ActsFatras/Digitization/Segmentizer.hpp"
 #include "ActsFatras/Digitization/UncorrelatedHitSmearer.hpp"
 
 #include <cstddef>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -63,6 +65,34 @@ class DigitizationAlgorithm final : public IAlgorithm {
   const DigitizationConfig& config() const { return m_cfg; }
 
  private:
+  /// The simulated hits on a single module
+  using ModuleSimHits = Range<SimHitContainer::const_iterator>;
+
+  /// Digitized clusters of a single module before they are assigned their
+  /// measurement indices
+  struct ModuleOutput {
+    std::vector<std::pair<DigitizedParameters,
+                          std::set<SimHitContainer::size_type>>>
+        clusters;
+    std::size_t skippedHits = 0;
+  };
+
+  /// Digitize the simulated hits of a single module
+  ///
+  /// @param ctx is the algorithm context with event information
+  /// @param moduleGeoId is the geometry identifier of the module
+  /// @param moduleSimHits are the simulated hits on the module
+  /// @param simHits is the full hit container the module hits belong to
+  /// @param rng the random number engine used for this module
+  /// @param output is filled with the digitized clusters
+  ///
+  /// @return false if the module surface is unknown
+  bool digitizeModule(const AlgorithmContext& ctx,
+                      Acts::GeometryIdentifier moduleGeoId,
+                      const ModuleSimHits& moduleSimHits,
+                      const SimHitContainer& simHits, RandomEngine& rng,
+                      ModuleOutput& output) const;
+
   /// Helper method for creating digitized parameters from clusters
   ///
   /// @todo ADD random smearing
@@ -162,6 +162,11 @@ class DigitizationConfig {
   /// Table 35.10)
   /// @NOTE The default is set to 0 because this works only well with Geant4
   double minEnergyDeposit = 0.0;  // 1000 * 3.65 * Acts::UnitConstants::eV;
+  /// Digitize the modules of one event in parallel. Every module then uses
+  /// its own random number stream derived from the event seed and the module
+  /// identifier, so the results differ from the sequential mode but do not
+  /// depend on the number of threads.
+  bool parallelModules = false;
   /// The digitizers per GeometryIdentifiers
   Acts::GeometryHierarchyMap<DigiComponentsConfig> digitizationConfigs;
 
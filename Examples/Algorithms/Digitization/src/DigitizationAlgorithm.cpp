@@ -23,18 +23,24 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Utilities/GroupBy.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
+#include <functional>
 #include <ostream>
+#include <random>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 ActsExamples::DigitizationAlgorithm::DigitizationAlgorithm(
     DigitizationConfig config, Acts::Logging::Level level)
@@ -129,6 +135,151 @@ ActsExamples::DigitizationAlgorithm::DigitizationAlgorithm(
   m_digitizers = Acts::GeometryHierarchyMap<Digitizer>(digitizerInput);
 }
 
+bool ActsExamples::DigitizationAlgorithm::digitizeModule(
+    const AlgorithmContext& ctx, Acts::GeometryIdentifier moduleGeoId,
+    const ModuleSimHits& moduleSimHits, const SimHitContainer& simHits,
+    RandomEngine& rng, ModuleOutput& output) const {
+  auto surfaceItr = m_cfg.surfaceByIdentifier.find(moduleGeoId);
+
+  if (surfaceItr == m_cfg.surfaceByIdentifier.end()) {
+    // this is either an invalid geometry id or a misconfigured smearer
+    // setup; both cases can not be handled and should be fatal.
+    ACTS_ERROR("Could not find surface " << moduleGeoId
+                                         << " for configured smearer");
+    return false;
+  }
+
+  const Acts::Surface* surfacePtr = surfaceItr->second;
+
+  auto digitizerItr = m_digitizers.find(moduleGeoId);
+  if (digitizerItr == m_digitizers.end()) {
+    ACTS_VERBOSE("No digitizer present for module " << moduleGeoId);
+    return true;
+  } else {
+    ACTS_VERBOSE("Digitizer found for module " << moduleGeoId);
+  }
+
+  // Run the digitizer. Iterate over the hits for this surface inside the
+  // visitor so we do not need to lookup the variant object per-hit.
+  std::visit(
+      [&](const auto& digitizer) {
+        ModuleClusters moduleClusters(
+            digitizer.geometric.segmentation, digitizer.geometric.indices,
+            m_cfg.doMerge, m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
+
+        // Pure smearing: compute all bound parameters of the module first
+        // and smear them in one go, the random numbers are drawn in the same
+        // order as in the per-hit loop below
+        if (digitizer.geometric.indices.empty() &&
+            !digitizer.smearing.indices.empty()) {
+          std::vector<std::reference_wrapper<const SimHit>> selectedHits;
+          std::vector<Index> selectedIndices;
+          for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
+            if (h->depositedEnergy() < m_cfg.minEnergyDeposit) {
+              ACTS_VERBOSE("Skip hit because energy deposit to small")
+              continue;
+            }
+            selectedHits.push_back(*h);
+            selectedIndices.push_back(simHits.index_of(h));
+          }
+
+          using SmearResult =
+              typename std::decay_t<decltype(digitizer.smearing)>::Result;
+          std::vector<SmearResult> results;
+          digitizer.smearing(rng, selectedHits, *surfacePtr, ctx.geoContext,
+                             results);
+
+          for (std::size_t i = 0; i < results.size(); ++i) {
+            if (!results[i].ok()) {
+              ++output.skippedHits;
+              ACTS_DEBUG("Problem in hit smearing, skip hit ("
+                         << results[i].error().message() << ")");
+              continue;
+            }
+            const auto& [par, cov] = results[i].value();
+            DigitizedParameters dParameters;
+            for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
+              dParameters.indices.push_back(digitizer.smearing.indices[ip]);
+              dParameters.values.push_back(par[ip]);
+              dParameters.variances.push_back(cov(ip, ip));
+            }
+            moduleClusters.add(std::move(dParameters), selectedIndices[i]);
+          }
+
+          output.clusters = moduleClusters.digitizedParameters();
+          return;
+        }
+
+        for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
+          const auto& simHit = *h;
+          const auto simHitIdx = simHits.index_of(h);
+
+          DigitizedParameters dParameters;
+
+          if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
+            ACTS_VERBOSE("Skip hit because energy deposit to small")
+            continue;
+          }
+
+          // Geometric part - 0, 1, 2 local parameters are possible
+          if (!digitizer.geometric.indices.empty()) {
+            ACTS_VERBOSE("Configured to geometric digitize "
+                         << digitizer.geometric.indices.size()
+                         << " parameters.");
+            const auto& cfg = digitizer.geometric;
+            Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
+            auto channelsRes = m_channelizer.channelize(
+                simHit, *surfacePtr, ctx.geoContext, driftDir,
+                cfg.segmentation, cfg.thickness);
+            if (!channelsRes.ok() || channelsRes->empty()) {
+              ACTS_DEBUG(
+                  "Geometric channelization did not work, skipping this hit.")
+              continue;
+            }
+            ACTS_VERBOSE("Activated " << channelsRes->size()
+                                      << " channels for this hit.");
+            dParameters =
+                localParameters(digitizer.geometric, *channelsRes, rng);
+          }
+
+          // Smearing part - (optionally) rest
+          if (!digitizer.smearing.indices.empty()) {
+            ACTS_VERBOSE("Configured to smear "
+                         << digitizer.smearing.indices.size()
+                         << " parameters.");
+            auto res =
+                digitizer.smearing(rng, simHit, *surfacePtr, ctx.geoContext);
+            if (!res.ok()) {
+              ++output.skippedHits;
+              ACTS_DEBUG("Problem in hit smearing, skip hit ("
+                         << res.error().message() << ")");
+              continue;
+            }
+            const auto& [par, cov] = res.value();
+            for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
+              dParameters.indices.push_back(digitizer.smearing.indices[ip]);
+              dParameters.values.push_back(par[ip]);
+              dParameters.variances.push_back(cov(ip, ip));
+            }
+          }
+
+          // Check on success - threshold could have eliminated all channels
+          if (dParameters.values.empty()) {
+            ACTS_VERBOSE(
+                "Parameter digitization did not yield a measurement.")
+            continue;
+          }
+
+          moduleClusters.add(std::move(dParameters), simHitIdx);
+        }
+
+        output.clusters = moduleClusters.digitizedParameters();
+      },
+      *digitizerItr);
+
+  return true;
+}
+
 ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
     const AlgorithmContext& ctx) const {
   // Retrieve input
@@ -147,140 +298,92 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
   measurementParticlesMap.reserve(simHits.size());
   measurementSimHitsMap.reserve(simHits.size());
 
-  // Setup random number generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-
   // Some statistics
   std::size_t skippedHits = 0;
 
-  ACTS_DEBUG("Starting loop over modules ...");
-  for (const auto& simHitsGroup : groupByModule(simHits)) {
-    // Manual pair unpacking instead of using
-    //   auto [moduleGeoId, moduleSimHits] : ...
-    // otherwise clang on macos complains that it is unable to capture the local
-    // binding in the lambda used for visiting the smearer below.
-    Acts::GeometryIdentifier moduleGeoId = simHitsGroup.first;
-    const auto& moduleSimHits = simHitsGroup.second;
-
-    auto surfaceItr = m_cfg.surfaceByIdentifier.find(moduleGeoId);
-
-    if (surfaceItr == m_cfg.surfaceByIdentifier.end()) {
-      // this is either an invalid geometry id or a misconfigured smearer
-      // setup; both cases can not be handled and should be fatal.
-      ACTS_ERROR("Could not find surface " << moduleGeoId
-                                           << " for configured smearer");
-      return ProcessCode::ABORT;
+  // Move the digitized clusters of one module into the output containers
+  auto appendModule = [&](Acts::GeometryIdentifier moduleGeoId,
+                          ModuleOutput& output) {
+    skippedHits += output.skippedHits;
+    for (auto& [dParameters, simhits] : output.clusters) {
+      // The measurement container is unordered and the index under which
+      // the measurement will be stored is known before adding it.
+      Index measurementIdx = measurements.size();
+      IndexSourceLink sourceLink{moduleGeoId, measurementIdx};
+
+      // Add to output containers:
+      // index map and source link container are geometry-ordered.
+      // since the input is also geometry-ordered, new items can
+      // be added at the end.
+      sourceLinks.insert(sourceLinks.end(), sourceLink);
+
+      measurements.emplace_back(createMeasurement(dParameters, sourceLink));
+      clusters.emplace_back(std::move(dParameters.cluster));
+      // this digitization does hit merging so there can be more than one
+      // mapping entry for each digitized hit.
+      for (auto simHitIdx : simhits) {
+        measurementParticlesMap.emplace_hint(
+            measurementParticlesMap.end(), measurementIdx,
+            simHits.nth(simHitIdx)->particleId());
+        measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
+                                           measurementIdx, simHitIdx);
+      }
     }
+  };
 
-    const Acts::Surface* surfacePtr = surfaceItr->second;
-
-    auto digitizerItr = m_digitizers.find(moduleGeoId);
-    if (digitizerItr == m_digitizers.end()) {
-      ACTS_VERBOSE("No digitizer present for module " << moduleGeoId);
-      continue;
-    } else {
-      ACTS_VERBOSE("Digitizer found for module " << moduleGeoId);
+  ACTS_DEBUG("Starting loop over modules ...");
+  if (!m_cfg.parallelModules) {
+    // Setup random number generator
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+
+    ModuleOutput output;
+    for (const auto& simHitsGroup : groupByModule(simHits)) {
+      output.clusters.clear();
+      output.skippedHits = 0;
+      if (!digitizeModule(ctx, simHitsGroup.first, simHitsGroup.second,
+                          simHits, rng, output)) {
+        return ProcessCode::ABORT;
+      }
+      appendModule(simHitsGroup.first, output);
+    }
+  } else {
+    std::vector<std::pair<Acts::GeometryIdentifier, ModuleSimHits>> groups;
+    for (const auto& simHitsGroup : groupByModule(simHits)) {
+      groups.push_back(simHitsGroup);
     }
 
-    // Run the digitizer. Iterate over the hits for this surface inside the
-    // visitor so we do not need to lookup the variant object per-hit.
-    std::visit(
-        [&](const auto& digitizer) {
-          ModuleClusters moduleClusters(
-              digitizer.geometric.segmentation, digitizer.geometric.indices,
-              m_cfg.doMerge, m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
-
-          for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
-            const auto& simHit = *h;
-            const auto simHitIdx = simHits.index_of(h);
-
-            DigitizedParameters dParameters;
-
-            if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
-              ACTS_VERBOSE("Skip hit because energy deposit to small")
-              continue;
-            }
-
-            // Geometric part - 0, 1, 2 local parameters are possible
-            if (!digitizer.geometric.indices.empty()) {
-              ACTS_VERBOSE("Configured to geometric digitize "
-                           << digitizer.geometric.indices.size()
-                           << " parameters.");
-              const auto& cfg = digitizer.geometric;
-              Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
-              auto channelsRes = m_channelizer.channelize(
-                  simHit, *surfacePtr, ctx.geoContext, driftDir,
-                  cfg.segmentation, cfg.thickness);
-              if (!channelsRes.ok() || channelsRes->empty()) {
-                ACTS_DEBUG(
-                    "Geometric channelization did not work, skipping this hit.")
-                continue;
-              }
-              ACTS_VERBOSE("Activated " << channelsRes->size()
-                                        << " channels for this hit.");
-              dParameters =
-                  localParameters(digitizer.geometric, *channelsRes, rng);
-            }
-
-            // Smearing part - (optionally) rest
-            if (!digitizer.smearing.indices.empty()) {
-              ACTS_VERBOSE("Configured to smear "
-                           << digitizer.smearing.indices.size()
-                           << " parameters.");
-              auto res =
-                  digitizer.smearing(rng, simHit, *surfacePtr, ctx.geoContext);
-              if (!res.ok()) {
-                ++skippedHits;
-                ACTS_DEBUG("Problem in hit smearing, skip hit ("
-                           << res.error().message() << ")");
-                continue;
-              }
-              const auto& [par, cov] = res.value();
-              for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
-                dParameters.indices.push_back(digitizer.smearing.indices[ip]);
-                dParameters.values.push_back(par[ip]);
-                dParameters.variances.push_back(cov(ip, ip));
-              }
-            }
-
-            // Check on success - threshold could have eliminated all channels
-            if (dParameters.values.empty()) {
-              ACTS_VERBOSE(
-                  "Parameter digitization did not yield a measurement.")
-              continue;
+    // outputs are collected per module and merged in geometry order
+    // afterwards, so the result does not depend on the scheduling
+    std::vector<ModuleOutput> outputs(groups.size());
+    std::atomic<bool> success = true;
+
+    const std::uint64_t eventSeed = m_cfg.randomNumbers->generateSeed(ctx);
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, groups.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t i = range.begin(); i != range.end(); ++i) {
+            // one random stream per module
+            const std::uint64_t moduleId = groups[i].first.value();
+            std::seed_seq seeds{static_cast<std::uint32_t>(eventSeed),
+                                static_cast<std::uint32_t>(eventSeed >> 32),
+                                static_cast<std::uint32_t>(moduleId),
+                                static_cast<std::uint32_t>(moduleId >> 32)};
+            RandomEngine rng(seeds);
+            if (!digitizeModule(ctx, groups[i].first, groups[i].second,
+                                simHits, rng, outputs[i])) {
+              success = false;
             }
-
-            moduleClusters.add(std::move(dParameters), simHitIdx);
           }
+        });
 
-          for (auto& [dParameters, simhits] :
-               moduleClusters.digitizedParameters()) {
-            // The measurement container is unordered and the index under which
-            // the measurement will be stored is known before adding it.
-            Index measurementIdx = measurements.size();
-            IndexSourceLink sourceLink{moduleGeoId, measurementIdx};
-
-            // Add to output containers:
-            // index map and source link container are geometry-ordered.
-            // since the input is also geometry-ordered, new items can
-            // be added at the end.
-            sourceLinks.insert(sourceLinks.end(), sourceLink);
-
-            measurements.emplace_back(
-                createMeasurement(dParameters, sourceLink));
-            clusters.emplace_back(std::move(dParameters.cluster));
-            // this digitization does hit merging so there can be more than one
-            // mapping entry for each digitized hit.
-            for (auto simHitIdx : simhits) {
-              measurementParticlesMap.emplace_hint(
-                  measurementParticlesMap.end(), measurementIdx,
-                  simHits.nth(simHitIdx)->particleId());
-              measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
-                                                 measurementIdx, simHitIdx);
-            }
-          }
-        },
-        *digitizerItr);
+    if (!success) {
+      return ProcessCode::ABORT;
+    }
+
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+      appendModule(groups[i].first, outputs[i]);
+    }
   }
 
   if (skippedHits > 0) {
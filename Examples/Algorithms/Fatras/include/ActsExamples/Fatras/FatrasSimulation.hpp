@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
 #include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
@@ -23,12 +24,17 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Acts {
 class MagneticFieldProvider;
 class TrackingGeometry;
 }  // namespace Acts
 
+namespace ActsFatras {
+struct FailedParticle;
+}  // namespace ActsFatras
+
 namespace ActsExamples {
 class RandomNumbers;
 struct AlgorithmContext;
@@ -89,6 +95,13 @@ class FatrasSimulation final : public IAlgorithm {
     /// algorithm function. It is used to guess the amount of memory to
     /// pre-allocate to avoid allocation during event simulation.
     std::size_t averageHitsPerParticle = 16u;
+
+    /// Simulate the input particles of one event in parallel. Each input
+    /// particle is simulated together with its secondaries by one task, using
+    /// a random number generator seeded from the event seed and its barcode.
+    /// The outputs are merged in input order, i.e. they are reproducible
+    /// independent of the number of threads but differ from the serial mode.
+    bool parallelParticles = false;
   };
 
   /// Construct the algorithm from a config.
@@ -118,6 +131,13 @@ class FatrasSimulation final : public IAlgorithm {
  private:
   Config m_cfg;
   std::unique_ptr<detail::FatrasSimulation> m_sim;
+
+  /// Simulate the input particles of one event concurrently.
+  Acts::Result<std::vector<ActsFatras::FailedParticle>> simulateParallel(
+      const AlgorithmContext& ctx, const SimParticleContainer& inputParticles,
+      SimParticleContainer::sequence_type& particlesInitial,
+      SimParticleContainer::sequence_type& particlesFinal,
+      SimHitContainer::sequence_type& simHits) const;
 };
 
 }  // namespace ActsExamples
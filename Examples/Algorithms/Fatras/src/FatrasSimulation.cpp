@@ -24,6 +24,7 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 #include "ActsFatras/Kernel/InteractionList.hpp"
@@ -37,8 +38,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <iterator>
 #include <map>
 #include <ostream>
+#include <random>
 #include <stdexcept>
 #include <system_error>
 #include <utility>
@@ -77,6 +81,13 @@ struct ActsExamples::detail::FatrasSimulation {
       ActsExamples::SimParticleContainer::sequence_type &,
       ActsExamples::SimParticleContainer::sequence_type &,
       ActsExamples::SimHitContainer::sequence_type &) const = 0;
+  virtual Acts::Result<void> simulateParticle(
+      const Acts::GeometryContext &, const Acts::MagneticFieldContext &,
+      ActsExamples::RandomEngine &, const ActsExamples::SimParticle &,
+      ActsExamples::SimParticleContainer::sequence_type &,
+      ActsExamples::SimParticleContainer::sequence_type &,
+      ActsExamples::SimHitContainer::sequence_type &,
+      std::vector<ActsFatras::FailedParticle> &) const = 0;
 };
 
 namespace {
@@ -184,6 +195,22 @@ struct FatrasSimulationT final : ActsExamples::detail::FatrasSimulation {
                                simulatedParticlesInitial,
                                simulatedParticlesFinal, simHits);
   }
+
+  Acts::Result<void> simulateParticle(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, ActsExamples::RandomEngine &rng,
+      const ActsExamples::SimParticle &inputParticle,
+      ActsExamples::SimParticleContainer::sequence_type
+          &simulatedParticlesInitial,
+      ActsExamples::SimParticleContainer::sequence_type
+          &simulatedParticlesFinal,
+      ActsExamples::SimHitContainer::sequence_type &simHits,
+      std::vector<ActsFatras::FailedParticle> &failedParticles) const final {
+    return simulation.simulateParticle(geoCtx, magCtx, rng, inputParticle,
+                                       simulatedParticlesInitial,
+                                       simulatedParticlesFinal, simHits,
+                                       failedParticles);
+  }
 };
 
 }  // namespace
@@ -222,6 +249,68 @@ ActsExamples::FatrasSimulation::FatrasSimulation(Config cfg,
 // explicit destructor needed for the PIMPL implementation to work
 ActsExamples::FatrasSimulation::~FatrasSimulation() = default;
 
+Acts::Result<std::vector<ActsFatras::FailedParticle>>
+ActsExamples::FatrasSimulation::simulateParallel(
+    const AlgorithmContext &ctx, const SimParticleContainer &inputParticles,
+    SimParticleContainer::sequence_type &particlesInitial,
+    SimParticleContainer::sequence_type &particlesFinal,
+    SimHitContainer::sequence_type &simHits) const {
+  // outputs are collected per input particle and merged in input order
+  // afterwards, so the result does not depend on the scheduling
+  struct ParticleOutput {
+    SimParticleContainer::sequence_type particlesInitial;
+    SimParticleContainer::sequence_type particlesFinal;
+    SimHitContainer::sequence_type simHits;
+    std::vector<ActsFatras::FailedParticle> failedParticles;
+    Acts::Result<void> result = Acts::Result<void>::success();
+  };
+  std::vector<ParticleOutput> outputs(inputParticles.size());
+
+  const std::uint64_t eventSeed = m_cfg.randomNumbers->generateSeed(ctx);
+
+  tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, inputParticles.size()),
+      [&](const tbb::blocked_range<std::size_t> &range) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+          const SimParticle &particle = *(inputParticles.begin() + i);
+          ParticleOutput &output = outputs[i];
+          // one random stream per input particle
+          const std::uint64_t barcode = particle.particleId().value();
+          std::seed_seq seeds{static_cast<std::uint32_t>(eventSeed),
+                              static_cast<std::uint32_t>(eventSeed >> 32),
+                              static_cast<std::uint32_t>(barcode),
+                              static_cast<std::uint32_t>(barcode >> 32)};
+          RandomEngine rng(seeds);
+          output.simHits.reserve(m_cfg.averageHitsPerParticle);
+          output.result = m_sim->simulateParticle(
+              ctx.geoContext, ctx.magFieldContext, rng, particle,
+              output.particlesInitial, output.particlesFinal, output.simHits,
+              output.failedParticles);
+        }
+      });
+
+  std::vector<ActsFatras::FailedParticle> failedParticles;
+  std::size_t nHits = 0;
+  for (const auto &output : outputs) {
+    if (!output.result.ok()) {
+      return output.result.error();
+    }
+    nHits += output.simHits.size();
+  }
+  simHits.reserve(nHits);
+  for (auto &output : outputs) {
+    std::move(output.particlesInitial.begin(), output.particlesInitial.end(),
+              std::back_inserter(particlesInitial));
+    std::move(output.particlesFinal.begin(), output.particlesFinal.end(),
+              std::back_inserter(particlesFinal));
+    std::move(output.simHits.begin(), output.simHits.end(),
+              std::back_inserter(simHits));
+    std::move(output.failedParticles.begin(), output.failedParticles.end(),
+              std::back_inserter(failedParticles));
+  }
+  return failedParticles;
+}
+
 ActsExamples::ProcessCode ActsExamples::FatrasSimulation::execute(
     const AlgorithmContext &ctx) const {
   // read input containers
@@ -239,11 +328,18 @@ ActsExamples::ProcessCode ActsExamples::FatrasSimulation::execute(
   simHitsUnordered.reserve(inputParticles.size() *
                            m_cfg.averageHitsPerParticle);
 
-  // run the simulation w/ a local random generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-  auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
-                             inputParticles, particlesInitialUnordered,
-                             particlesFinalUnordered, simHitsUnordered);
+  Acts::Result<std::vector<ActsFatras::FailedParticle>> ret =
+      std::vector<ActsFatras::FailedParticle>{};
+  if (!m_cfg.parallelParticles) {
+    // run the simulation w/ a local random generator
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+    ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
+                          inputParticles, particlesInitialUnordered,
+                          particlesFinalUnordered, simHitsUnordered);
+  } else {
+    ret = simulateParallel(ctx, inputParticles, particlesInitialUnordered,
+                           particlesFinalUnordered, simHitsUnordered);
+  }
   // fatal error leads to panic
   if (!ret.ok()) {
     ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
@@ -93,6 +93,16 @@ class Geant4SimulationBase : public IAlgorithm {
 
   EventStore& eventStore() const;
 
+  /// Simulate one event with exclusive access to the run manager
+  ///
+  /// The lock is released before the event is checked, the recorded event is
+  /// moved out of the shared event store such that the caller can create the
+  /// outputs while the next event is simulated.
+  ///
+  /// @param ctx the AlgorithmContext for this event
+  /// @param result the recorded event
+  ProcessCode simulate(const AlgorithmContext& ctx, EventStore& result) const;
+
   std::unique_ptr<const Acts::Logger> m_logger;
 
   std::shared_ptr<EventStore> m_eventStore;
@@ -109,58 +109,66 @@ ActsExamples::ProcessCode ActsExamples::Geant4SimulationBase::initialize() {
 
 ActsExamples::ProcessCode ActsExamples::Geant4SimulationBase::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
-  // Ensure exclusive access to the Geant4 run manager
-  std::lock_guard<std::mutex> guard(m_geant4Instance->mutex);
+  EventStore result;
+  return simulate(ctx, result);
+}
 
-  // Set the seed new per event, so that we get reproducible results
-  G4Random::setTheSeed(config().randomNumbers->generateSeed(ctx));
+ActsExamples::ProcessCode ActsExamples::Geant4SimulationBase::simulate(
+    const ActsExamples::AlgorithmContext& ctx, EventStore& result) const {
+  {
+    // Ensure exclusive access to the Geant4 run manager
+    std::lock_guard<std::mutex> guard(m_geant4Instance->mutex);
 
-  // Get and reset event registry state
-  eventStore() = EventStore{};
+    // Set the seed new per event, so that we get reproducible results
+    G4Random::setTheSeed(config().randomNumbers->generateSeed(ctx));
 
-  // Register the current event store to the registry
-  // this will allow access from the User*Actions
-  eventStore().store = &(ctx.eventStore);
+    // Get and reset event registry state
+    eventStore() = EventStore{};
 
-  // Register the input particle read handle
-  eventStore().inputParticles = &m_inputParticles;
+    // Register the current event store to the registry
+    // this will allow access from the User*Actions
+    eventStore().store = &(ctx.eventStore);
 
-  ACTS_DEBUG("Sending Geant RunManager the BeamOn() command.");
-  {
-    Acts::FpeMonitor mon{0};  // disable all FPEs while we're in Geant4
-    // Start simulation. each track is simulated as a separate Geant4 event.
-    runManager().BeamOn(1);
+    // Register the input particle read handle
+    eventStore().inputParticles = &m_inputParticles;
+
+    ACTS_DEBUG("Sending Geant RunManager the BeamOn() command.");
+    {
+      Acts::FpeMonitor mon{0};  // disable all FPEs while we're in Geant4
+      // Start simulation. each track is simulated as a separate Geant4 event.
+      runManager().BeamOn(1);
+    }
+
+    // Take the event out of the shared store, so that the next event can
+    // start simulating while this one is checked and written
+    result = std::move(eventStore());
   }
 
   // Since these are std::set, this ensures that each particle is in both sets
   throw_assert(
-      eventStore().particlesInitial.size() ==
-          eventStore().particlesFinal.size(),
+      result.particlesInitial.size() == result.particlesFinal.size(),
       "initial and final particle collections does not have the same size: "
-          << eventStore().particlesInitial.size() << " vs "
-          << eventStore().particlesFinal.size());
+          << result.particlesInitial.size() << " vs "
+          << result.particlesFinal.size());
 
   // Print out warnings about possible particle collision if happened
-  if (eventStore().particleIdCollisionsInitial > 0 ||
-      eventStore().particleIdCollisionsFinal > 0 ||
-      eventStore().parentIdNotFound > 0) {
+  if (result.particleIdCollisionsInitial > 0 ||
+      result.particleIdCollisionsFinal > 0 || result.parentIdNotFound > 0) {
     ACTS_WARNING(
         "Particle ID collisions detected, don't trust the particle "
         "identification!");
-    ACTS_WARNING(
-        "- initial states: " << eventStore().particleIdCollisionsInitial);
-    ACTS_WARNING("- final states: " << eventStore().particleIdCollisionsFinal);
-    ACTS_WARNING("- parent ID not found: " << eventStore().parentIdNotFound);
+    ACTS_WARNING("- initial states: " << result.particleIdCollisionsInitial);
+    ACTS_WARNING("- final states: " << result.particleIdCollisionsFinal);
+    ACTS_WARNING("- parent ID not found: " << result.parentIdNotFound);
   }
 
-  if (eventStore().hits.empty()) {
+  if (result.hits.empty()) {
     ACTS_DEBUG("Step merging: No steps recorded");
   } else {
     ACTS_DEBUG("Step merging: mean hits per hit: "
-               << static_cast<double>(eventStore().numberGeantSteps) /
-                      eventStore().hits.size());
-    ACTS_DEBUG(
-        "Step merging: max hits per hit: " << eventStore().maxStepsForHit);
+               << static_cast<double>(result.numberGeantSteps) /
+                      result.hits.size());
+    ACTS_DEBUG("Step merging: max hits per hit: " << result.maxStepsForHit);
   }
 
   return ActsExamples::ProcessCode::SUCCESS;
@@ -298,25 +306,28 @@ ActsExamples::Geant4Simulation::~Geant4Simulation() = default;
 
 ActsExamples::ProcessCode ActsExamples::Geant4Simulation::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
-  Geant4SimulationBase::execute(ctx);
+  EventStore result;
+  if (auto code = simulate(ctx, result); code != ProcessCode::SUCCESS) {
+    return code;
+  }
 
   // Output handling: Simulation
   m_outputParticlesInitial(
-      ctx, SimParticleContainer(eventStore().particlesInitial.begin(),
-                                eventStore().particlesInitial.end()));
-  m_outputParticlesFinal(
-      ctx, SimParticleContainer(eventStore().particlesFinal.begin(),
-                                eventStore().particlesFinal.end()));
+      ctx, SimParticleContainer(result.particlesInitial.begin(),
+                                result.particlesInitial.end()));
+  m_outputParticlesFinal(ctx,
+                         SimParticleContainer(result.particlesFinal.begin(),
+                                              result.particlesFinal.end()));
 
 #if BOOST_VERSION < 107800
   SimHitContainer container;
-  for (const auto& hit : eventStore().hits) {
+  for (const auto& hit : result.hits) {
     container.insert(hit);
   }
   m_outputSimHits(ctx, std::move(container));
 #else
-  m_outputSimHits(
-      ctx, SimHitContainer(eventStore().hits.begin(), eventStore().hits.end()));
+  m_outputSimHits(ctx,
+                  SimHitContainer(result.hits.begin(), result.hits.end()));
 #endif
 
   return ActsExamples::ProcessCode::SUCCESS;
@@ -400,11 +411,13 @@ ActsExamples::Geant4MaterialRecording::~Geant4MaterialRecording() = default;
 
 ActsExamples::ProcessCode ActsExamples::Geant4MaterialRecording::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
-  Geant4SimulationBase::execute(ctx);
+  EventStore result;
+  if (auto code = simulate(ctx, result); code != ProcessCode::SUCCESS) {
+    return code;
+  }
 
   // Output handling: Material tracks
-  m_outputMaterialTracks(
-      ctx, decltype(eventStore().materialTracks)(eventStore().materialTracks));
+  m_outputMaterialTracks(ctx, std::move(result.materialTracks));
 
   return ActsExamples::ProcessCode::SUCCESS;
 }
@@ -15,8 +15,31 @@
 
 #include <cstdint>
 #include <ostream>
+#include <random>
 #include <stdexcept>
 
+#ifndef ACTS_EXAMPLES_NO_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+namespace {
+
+/// Random number generator for one of several independent streams
+ActsExamples::RandomEngine spawnStream(std::uint64_t seed, std::size_t i,
+                                       std::size_t j) {
+  std::seed_seq seeds{static_cast<std::uint32_t>(seed),
+                      static_cast<std::uint32_t>(seed >> 32),
+                      static_cast<std::uint32_t>(i),
+                      static_cast<std::uint32_t>(i >> 32),
+                      static_cast<std::uint32_t>(j)};
+  return ActsExamples::RandomEngine(seeds);
+}
+
+// Distinguishes the pool streams from the streams of the event vertices
+constexpr std::size_t s_poolStream = 0xffffffff;
+
+}  // namespace
+
 ActsExamples::EventGenerator::EventGenerator(const Config& cfg,
                                              Acts::Logging::Level lvl)
     : m_cfg(cfg), m_logger(Acts::getDefaultLogger("EventGenerator", lvl)) {
@@ -35,6 +58,36 @@ ActsExamples::EventGenerator::EventGenerator(const Config& cfg,
 
   m_outputParticles.initialize(m_cfg.outputParticles);
   m_outputVertices.initialize(m_cfg.outputVertices);
+
+  // fill the pools with interactions that do not depend on the event
+  m_pools.resize(m_cfg.generators.size());
+  for (std::size_t iGenerate = 0; iGenerate < m_cfg.generators.size();
+       ++iGenerate) {
+    auto& generate = m_cfg.generators[iGenerate];
+    auto& pool = m_pools[iGenerate];
+    pool.resize(generate.poolSize);
+    auto fillPool = [&](std::size_t i) {
+      auto rng = spawnStream(m_cfg.randomNumbers->config().seed, i,
+                             s_poolStream - iGenerate);
+      pool[i] = (*generate.particles)(rng);
+    };
+    if (pool.empty()) {
+      continue;
+    }
+#ifndef ACTS_EXAMPLES_NO_TBB
+    if (generate.particles->isThreadSafe()) {
+      tbb::parallel_for(std::size_t{0}, pool.size(), fillPool);
+    } else
+#endif
+    {
+      for (std::size_t i = 0; i < pool.size(); ++i) {
+        fillPool(i);
+      }
+    }
+    ACTS_DEBUG("Generated a pool of " << pool.size()
+                                      << " interactions for generator "
+                                      << iGenerate);
+  }
 }
 
 std::string ActsExamples::EventGenerator::name() const {
@@ -46,6 +99,18 @@ ActsExamples::EventGenerator::availableEvents() const {
   return {0u, SIZE_MAX};
 }
 
+ActsExamples::EventGenerator::Interaction
+ActsExamples::EventGenerator::generateInteraction(std::size_t iGenerate,
+                                                  RandomEngine& rng) const {
+  const auto& pool = m_pools[iGenerate];
+  if (pool.empty()) {
+    return (*m_cfg.generators[iGenerate].particles)(rng);
+  }
+  std::uniform_int_distribution<std::size_t> drawInteraction(0,
+                                                             pool.size() - 1);
+  return pool[drawInteraction(rng)];
+}
+
 ActsExamples::ProcessCode ActsExamples::EventGenerator::read(
     const AlgorithmContext& ctx) {
   SimParticleContainer particles;
@@ -53,62 +118,120 @@ ActsExamples::ProcessCode ActsExamples::EventGenerator::read(
 
   auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
 
-  std::size_t nPrimaryVertices = 0;
-  for (std::size_t iGenerate = 0; iGenerate < m_cfg.generators.size();
-       ++iGenerate) {
-    auto& generate = m_cfg.generators[iGenerate];
-
-    // generate the primary vertices from this generator
-    for (std::size_t n = (*generate.multiplicity)(rng); 0 < n; --n) {
-      nPrimaryVertices += 1;
-
-      // generate primary vertex position
-      auto vertexPosition = (*generate.vertex)(rng);
-      // generate particles associated to this vertex
-      auto [newVertices, newParticles] = (*generate.particles)(rng);
-
-      ACTS_VERBOSE("Generate vertex at " << vertexPosition.transpose());
-
-      auto updateParticleInPlace = [&](SimParticle& particle) {
-        // only set the primary vertex, leave everything else as-is
-        // using the number of primary vertices as the index ensures
-        // that barcode=0 is not used, since it is used elsewhere
-        // to signify elements w/o an associated particle.
-        const auto pid = SimBarcode{particle.particleId()}.setVertexPrimary(
-            nPrimaryVertices);
-        // move particle to the vertex
-        const auto pos4 = (vertexPosition + particle.fourPosition()).eval();
-        ACTS_VERBOSE(" - particle at " << pos4.transpose());
-        // `withParticleId` returns a copy because it changes the identity
-        particle = particle.withParticleId(pid).setPosition4(pos4);
-      };
-      for (auto& vertexParticle : newParticles) {
-        updateParticleInPlace(vertexParticle);
+  // the interactions of all primary vertices, before moving them to the
+  // vertex position
+  struct VertexInteraction {
+    std::size_t iGenerate = 0;
+    Acts::Vector4 vertexPosition = Acts::Vector4::Zero();
+    Interaction interaction;
+  };
+  std::vector<VertexInteraction> generated;
+
+  if (!m_cfg.parallelVertices) {
+    for (std::size_t iGenerate = 0; iGenerate < m_cfg.generators.size();
+         ++iGenerate) {
+      auto& generate = m_cfg.generators[iGenerate];
+
+      // generate the primary vertices from this generator
+      for (std::size_t n = (*generate.multiplicity)(rng); 0 < n; --n) {
+        auto& vertex = generated.emplace_back();
+        vertex.iGenerate = iGenerate;
+        // generate primary vertex position
+        vertex.vertexPosition = (*generate.vertex)(rng);
+        // generate particles associated to this vertex
+        vertex.interaction = generateInteraction(iGenerate, rng);
+      }
+    }
+  } else {
+    // only the multiplicities use the event generator
+    for (std::size_t iGenerate = 0; iGenerate < m_cfg.generators.size();
+         ++iGenerate) {
+      auto& generate = m_cfg.generators[iGenerate];
+      for (std::size_t n = (*generate.multiplicity)(rng); 0 < n; --n) {
+        generated.emplace_back().iGenerate = iGenerate;
       }
+    }
 
-      auto updateVertexInPlace = [&](SimVertex& vertex) {
-        // only set the primary vertex, leave everything else as-is
-        // using the number of primary vertices as the index ensures
-        // that barcode=0 is not used, since it is used elsewhere
-        // to signify elements w/o an associated particle.
-        vertex.id = SimVertexBarcode{vertex.vertexId()}.setVertexPrimary(
-            nPrimaryVertices);
-        // move vertex
-        const auto pos4 = (vertexPosition + vertex.position4).eval();
-        ACTS_VERBOSE(" - vertex at " << pos4.transpose());
-        vertex.position4 = pos4;
-      };
-      for (auto& vertex : newVertices) {
-        updateVertexInPlace(vertex);
+    const std::uint64_t eventSeed = m_cfg.randomNumbers->generateSeed(ctx);
+    auto generateVertex = [&](std::size_t i) {
+      auto& vertex = generated[i];
+      // one random stream per primary vertex
+      auto vertexRng = spawnStream(eventSeed, i, 0);
+      vertex.vertexPosition =
+          (*m_cfg.generators[vertex.iGenerate].vertex)(vertexRng);
+      vertex.interaction = generateInteraction(vertex.iGenerate, vertexRng);
+    };
+
+    std::vector<std::size_t> concurrent;
+    for (std::size_t i = 0; i < generated.size(); ++i) {
+      const std::size_t iGenerate = generated[i].iGenerate;
+      if (m_pools[iGenerate].empty() &&
+          !m_cfg.generators[iGenerate].particles->isThreadSafe()) {
+        generateVertex(i);
+      } else {
+        concurrent.push_back(i);
       }
+    }
+#ifndef ACTS_EXAMPLES_NO_TBB
+    tbb::parallel_for(std::size_t{0}, concurrent.size(),
+                      [&](std::size_t i) { generateVertex(concurrent[i]); });
+#else
+    for (std::size_t i : concurrent) {
+      generateVertex(i);
+    }
+#endif
+  }
 
-      ACTS_VERBOSE("event=" << ctx.eventNumber << " generator=" << iGenerate
-                            << " primary_vertex=" << nPrimaryVertices
-                            << " n_particles=" << newParticles.size());
+  std::size_t nPrimaryVertices = 0;
+  for (auto& primaryVertex : generated) {
+    nPrimaryVertices += 1;
+
+    const Acts::Vector4& vertexPosition = primaryVertex.vertexPosition;
+    SimVertexContainer& newVertices = primaryVertex.interaction.first;
+    SimParticleContainer& newParticles = primaryVertex.interaction.second;
+
+    ACTS_VERBOSE("Generate vertex at " << vertexPosition.transpose());
+
+    auto updateParticleInPlace = [&](SimParticle& particle) {
+      // only set the primary vertex, leave everything else as-is
+      // using the number of primary vertices as the index ensures
+      // that barcode=0 is not used, since it is used elsewhere
+      // to signify elements w/o an associated particle.
+      const auto pid = SimBarcode{particle.particleId()}.setVertexPrimary(
+          nPrimaryVertices);
+      // move particle to the vertex
+      const auto pos4 = (vertexPosition + particle.fourPosition()).eval();
+      ACTS_VERBOSE(" - particle at " << pos4.transpose());
+      // `withParticleId` returns a copy because it changes the identity
+      particle = particle.withParticleId(pid).setPosition4(pos4);
+    };
+    for (auto& vertexParticle : newParticles) {
+      updateParticleInPlace(vertexParticle);
+    }
 
-      particles.merge(std::move(newParticles));
-      vertices.merge(std::move(newVertices));
+    auto updateVertexInPlace = [&](SimVertex& vertex) {
+      // only set the primary vertex, leave everything else as-is
+      // using the number of primary vertices as the index ensures
+      // that barcode=0 is not used, since it is used elsewhere
+      // to signify elements w/o an associated particle.
+      vertex.id = SimVertexBarcode{vertex.vertexId()}.setVertexPrimary(
+          nPrimaryVertices);
+      // move vertex
+      const auto pos4 = (vertexPosition + vertex.position4).eval();
+      ACTS_VERBOSE(" - vertex at " << pos4.transpose());
+      vertex.position4 = pos4;
+    };
+    for (auto& vertex : newVertices) {
+      updateVertexInPlace(vertex);
     }
+
+    ACTS_VERBOSE("event=" << ctx.eventNumber
+                          << " generator=" << primaryVertex.iGenerate
+                          << " primary_vertex=" << nPrimaryVertices
+                          << " n_particles=" << newParticles.size());
+
+    particles.merge(std::move(newParticles));
+    vertices.merge(std::move(newVertices));
   }
 
   ACTS_DEBUG("event=" << ctx.eventNumber
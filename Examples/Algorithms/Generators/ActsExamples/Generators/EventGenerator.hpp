@@ -81,6 +81,10 @@ class EventGenerator final : public ActsExamples::IReader {
     /// @return The vertex and particle containers
     virtual std::pair<SimVertexContainer, SimParticleContainer> operator()(
         RandomEngine& rng) = 0;
+    /// @brief Whether the generator can be called concurrently
+    ///
+    /// @return true if the generator has no mutable state
+    virtual bool isThreadSafe() const { return false; }
   };
 
   /// @brief Combined struct which contains all generator components
@@ -88,6 +92,10 @@ class EventGenerator final : public ActsExamples::IReader {
     std::shared_ptr<MultiplicityGenerator> multiplicity = nullptr;
     std::shared_ptr<PrimaryVertexPositionGenerator> vertex = nullptr;
     std::shared_ptr<ParticlesGenerator> particles = nullptr;
+    /// Number of interactions generated once at construction. If non-zero,
+    /// each vertex draws a random interaction from this pool instead of
+    /// generating a new one, e.g. for minimum-bias pile-up.
+    std::size_t poolSize = 0;
   };
 
   struct Config {
@@ -99,6 +107,12 @@ class EventGenerator final : public ActsExamples::IReader {
     std::vector<Generator> generators;
     /// The random number service.
     std::shared_ptr<const RandomNumbers> randomNumbers;
+    /// Generate the interactions of one event in parallel. Each interaction
+    /// uses a random number generator seeded from the event seed and its
+    /// index, i.e. the event is reproducible independent of the number of
+    /// threads but differs from the serial mode. Interactions of particle
+    /// generators that are not thread-safe are generated serially.
+    bool parallelVertices = false;
   };
 
   EventGenerator(const Config& cfg, Acts::Logging::Level lvl);
@@ -116,9 +130,18 @@ class EventGenerator final : public ActsExamples::IReader {
  private:
   const Acts::Logger& logger() const { return *m_logger; }
 
+  using Interaction = std::pair<SimVertexContainer, SimParticleContainer>;
+
+  /// Generate or draw from the pool the interaction of one vertex
+  Interaction generateInteraction(std::size_t iGenerate,
+                                  RandomEngine& rng) const;
+
   Config m_cfg;
   std::unique_ptr<const Acts::Logger> m_logger;
 
+  /// Pre-generated interactions, one pool per generator
+  std::vector<std::vector<Interaction>> m_pools;
+
   WriteDataHandle<SimParticleContainer> m_outputParticles{this,
                                                           "OutputParticles"};
   WriteDataHandle<SimVertexContainer> m_outputVertices{this, "OutputVertices"};
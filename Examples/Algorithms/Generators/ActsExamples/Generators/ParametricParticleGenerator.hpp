@@ -70,6 +70,9 @@ class ParametricParticleGenerator : public EventGenerator::ParticlesGenerator {
   std::pair<SimVertexContainer, SimParticleContainer> operator()(
       RandomEngine& rng) override;
 
+  /// The generator has no mutable state.
+  bool isThreadSafe() const override { return true; }
+
  private:
   Config m_cfg;
   // will be automatically set from PDG data tables
@@ -32,6 +32,8 @@
 #include <utility>
 #include <vector>
 
+#include <tbb/enumerable_thread_specific.h>
+
 namespace Acts {
 
 class TrackingGeometry;
@@ -62,8 +64,9 @@ namespace ActsExamples {
 /// However, running it in one single event, puts enormous pressure onto
 /// the I/O structure.
 ///
-/// It therefore saves the mapping state/cache as a private member variable
-/// and is designed to be executed in a single threaded mode.
+/// It therefore saves the mapping state/cache as a private member variable.
+/// Each thread accumulates into its own state, the states are merged when
+/// the maps are finalized.
 class MaterialMapping : public IAlgorithm {
  public:
   /// @class nested Config class
@@ -127,7 +130,15 @@ class MaterialMapping : public IAlgorithm {
       m_mappingState;  //!< Material mapping state
   Acts::VolumeMaterialMapper::State
       m_mappingStateVol;  //!< Material mapping state
-                          //
+
+  /// The mapping states of the threads, merged into the states above
+  mutable tbb::enumerable_thread_specific<Acts::SurfaceMaterialMapper::State>
+      m_threadMappingStates;
+  mutable tbb::enumerable_thread_specific<Acts::VolumeMaterialMapper::State>
+      m_threadMappingStatesVol;
+
+  /// Merge the mapping states of the threads into the main states
+  void mergeThreadStates();
 
   ReadDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
       m_inputMaterialTracks{this, "InputMaterialTracks"};
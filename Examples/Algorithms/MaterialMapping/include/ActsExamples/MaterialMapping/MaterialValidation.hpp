@@ -46,8 +46,19 @@ class MaterialValidation : public IAlgorithm {
     // The validater
     std::shared_ptr<Acts::MaterialValidater> materialValidater = nullptr;
 
-    /// Output collection name
+    /// Number of rays integrated per task when distributing the rays of an
+    /// event over the worker threads
+    std::size_t raysPerTask = 1000;
+
+    /// Output collection name, no tracks are recorded if empty
     std::string outputMaterialTracks = "material_tracks";
+
+    /// Output material profile name, no profile is filled if empty
+    std::string outputMaterialProfile = "";
+    /// Number of eta bins of the profile, spanning the eta range
+    std::size_t profileEtaBins = 80;
+    /// Number of phi bins of the profile, spanning the phi range
+    std::size_t profilePhiBins = 72;
   };
 
   /// Constructor
@@ -75,6 +86,9 @@ class MaterialValidation : public IAlgorithm {
 
   WriteDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
       m_outputMaterialTracks{this, "OutputMaterialTracks"};
+
+  WriteDataHandle<Acts::MaterialProfile> m_outputMaterialProfile{
+      this, "OutputMaterialProfile"};
 };
 
 }  // namespace ActsExamples
@@ -12,18 +12,44 @@
 #include "Acts/Material/AccumulatedSurfaceMaterial.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 
+#include <cstddef>
 #include <iostream>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 namespace ActsExamples {
 
+namespace {
+
+/// Merge the states pairwise in a fixed order of the vector, such that the
+/// rounding errors do not pile up along a single chain of merges. The result
+/// is stored in the first state.
+template <typename mapper_t, typename state_t>
+void reduceStates(const mapper_t& mapper, std::vector<state_t*>& states) {
+  for (std::size_t step = 1; step < states.size(); step *= 2) {
+    for (std::size_t i = 0; i + step < states.size(); i += 2 * step) {
+      mapper.mergeStates(*states[i], *states[i + step]);
+    }
+  }
+}
+
+}  // namespace
+
 MaterialMapping::MaterialMapping(const MaterialMapping::Config& cfg,
                                  Acts::Logging::Level level)
     : IAlgorithm("MaterialMapping", level),
       m_cfg(cfg),
       m_mappingState(cfg.geoContext, cfg.magFieldContext),
-      m_mappingStateVol(cfg.geoContext, cfg.magFieldContext) {
+      m_mappingStateVol(cfg.geoContext, cfg.magFieldContext),
+      m_threadMappingStates([this]() {
+        return m_cfg.materialSurfaceMapper->createState(
+            m_cfg.geoContext, m_cfg.magFieldContext, *m_cfg.trackingGeometry);
+      }),
+      m_threadMappingStatesVol([this]() {
+        return m_cfg.materialVolumeMapper->createState(
+            m_cfg.geoContext, m_cfg.magFieldContext, *m_cfg.trackingGeometry);
+      }) {
   if (!m_cfg.materialSurfaceMapper && !m_cfg.materialVolumeMapper) {
     throw std::invalid_argument("Missing material mapper");
   } else if (!m_cfg.trackingGeometry) {
@@ -33,9 +59,6 @@ MaterialMapping::MaterialMapping(const MaterialMapping::Config& cfg,
   m_inputMaterialTracks.initialize(m_cfg.inputMaterialTracks);
   m_outputMaterialTracks.initialize(m_cfg.mappingMaterialCollection);
 
-  ACTS_INFO("This algorithm requires inter-event information, "
-            << "run in single-threaded mode!");
-
   if (m_cfg.materialSurfaceMapper) {
     // Generate and retrieve the central cache object
     m_mappingState = m_cfg.materialSurfaceMapper->createState(
@@ -49,6 +72,8 @@ MaterialMapping::MaterialMapping(const MaterialMapping::Config& cfg,
 }
 
 MaterialMapping::~MaterialMapping() {
+  mergeThreadStates();
+
   Acts::DetectorMaterialMaps detectorMaterial;
 
   if (m_cfg.materialSurfaceMapper && m_cfg.materialVolumeMapper) {
@@ -101,22 +126,19 @@ ProcessCode MaterialMapping::execute(const AlgorithmContext& context) const {
       mtrackCollection = m_inputMaterialTracks(context);
 
   if (m_cfg.materialSurfaceMapper) {
-    // To make it work with the framework needs a lock guard
-    auto mappingState =
-        const_cast<Acts::SurfaceMaterialMapper::State*>(&m_mappingState);
+    // Each thread accumulates into its own state
+    auto& mappingState = m_threadMappingStates.local();
     for (auto& [idTrack, mTrack] : mtrackCollection) {
       // Map this one onto the geometry
-      m_cfg.materialSurfaceMapper->mapMaterialTrack(*mappingState, mTrack);
+      m_cfg.materialSurfaceMapper->mapMaterialTrack(mappingState, mTrack);
     }
   }
   if (m_cfg.materialVolumeMapper) {
-    // To make it work with the framework needs a lock guard
-    auto mappingState =
-        const_cast<Acts::VolumeMaterialMapper::State*>(&m_mappingStateVol);
-
+    // Each thread accumulates into its own state
+    auto& mappingState = m_threadMappingStatesVol.local();
     for (auto& [idTrack, mTrack] : mtrackCollection) {
       // Map this one onto the geometry
-      m_cfg.materialVolumeMapper->mapMaterialTrack(*mappingState, mTrack);
+      m_cfg.materialVolumeMapper->mapMaterialTrack(mappingState, mTrack);
     }
   }
   // Write take the collection to the EventStore
@@ -124,8 +146,31 @@ ProcessCode MaterialMapping::execute(const AlgorithmContext& context) const {
   return ProcessCode::SUCCESS;
 }
 
+void MaterialMapping::mergeThreadStates() {
+  if (m_cfg.materialSurfaceMapper) {
+    std::vector<Acts::SurfaceMaterialMapper::State*> states = {
+        &m_mappingState};
+    for (auto& state : m_threadMappingStates) {
+      states.push_back(&state);
+    }
+    reduceStates(*m_cfg.materialSurfaceMapper, states);
+    m_threadMappingStates.clear();
+  }
+  if (m_cfg.materialVolumeMapper) {
+    std::vector<Acts::VolumeMaterialMapper::State*> states = {
+        &m_mappingStateVol};
+    for (auto& state : m_threadMappingStatesVol) {
+      states.push_back(&state);
+    }
+    reduceStates(*m_cfg.materialVolumeMapper, states);
+    m_threadMappingStatesVol.clear();
+  }
+}
+
 std::vector<std::pair<double, int>> MaterialMapping::scoringParameters(
     uint64_t surfaceID) {
+  mergeThreadStates();
+
   std::vector<std::pair<double, int>> scoringParameters;
 
   if (m_cfg.materialSurfaceMapper) {
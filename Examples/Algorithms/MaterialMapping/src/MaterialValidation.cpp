@@ -9,8 +9,11 @@
 #include "ActsExamples/MaterialMapping/MaterialValidation.hpp"
 
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
 #include <stdexcept>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -18,7 +21,15 @@ MaterialValidation::MaterialValidation(const MaterialValidation::Config& cfg,
                                        Acts::Logging::Level level)
     : IAlgorithm("MaterialValidation", level), m_cfg(cfg) {
   // Prepare the I/O collections
-  m_outputMaterialTracks.initialize(m_cfg.outputMaterialTracks);
+  m_outputMaterialTracks.maybeInitialize(m_cfg.outputMaterialTracks);
+  m_outputMaterialProfile.maybeInitialize(m_cfg.outputMaterialProfile);
+  if (m_cfg.outputMaterialTracks.empty() &&
+      m_cfg.outputMaterialProfile.empty()) {
+    throw std::invalid_argument("Missing material tracks or profile output.");
+  }
+  if (m_cfg.raysPerTask == 0) {
+    throw std::invalid_argument("Invalid number of rays per task.");
+  }
   // Check the configuration - material validater
   if (m_cfg.materialValidater == nullptr) {
     throw std::invalid_argument("Missing material validater.");
@@ -40,30 +51,83 @@ ProcessCode MaterialValidation::execute(const AlgorithmContext& context) const {
   std::uniform_real_distribution<double> etaDist(m_cfg.etaRange.first,
                                                  m_cfg.etaRange.second);
 
-  // The output recorded material track collection
-  std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
-      recordedMaterialTracks;
-
-  // Loop over the number of tracks
+  // The directions are drawn in sequence, such that they do not depend on
+  // the scheduling of the tasks
+  std::vector<Acts::ActsScalar> phis(m_cfg.ntracks);
+  std::vector<Acts::ActsScalar> etas(m_cfg.ntracks);
+  std::vector<Acts::Vector3> directions(m_cfg.ntracks);
   for (std::size_t iTrack = 0; iTrack < m_cfg.ntracks; ++iTrack) {
     // Generate a random phi and eta
     Acts::ActsScalar phi = phiDist(rng);
     Acts::ActsScalar eta = etaDist(rng);
     Acts::ActsScalar theta = 2 * std::atan(std::exp(-eta));
-    Acts::Vector3 direction(std::cos(phi) * std::sin(theta),
-                            std::sin(phi) * std::sin(theta), std::cos(theta));
+    phis[iTrack] = phi;
+    etas[iTrack] = eta;
+    directions[iTrack] =
+        Acts::Vector3(std::cos(phi) * std::sin(theta),
+                      std::sin(phi) * std::sin(theta), std::cos(theta));
+  }
 
-    // Record the material
-    auto rMaterial = m_cfg.materialValidater->recordMaterial(
-        context.geoContext, context.magFieldContext, m_cfg.startPosition,
-        direction);
+  // Every task processes a contiguous range of rays
+  const std::size_t nTasks =
+      (m_cfg.ntracks + m_cfg.raysPerTask - 1) / m_cfg.raysPerTask;
+  auto forEachTask = [&](const auto& process) {
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nTasks),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t itask = range.begin(); itask != range.end();
+               ++itask) {
+            const std::size_t begin = itask * m_cfg.raysPerTask;
+            const std::size_t end =
+                std::min(begin + m_cfg.raysPerTask, m_cfg.ntracks);
+            process(itask, begin, end);
+          }
+        });
+  };
 
-    recordedMaterialTracks.emplace_hint(recordedMaterialTracks.end(), iTrack,
-                                        rMaterial);
+  if (!m_cfg.outputMaterialTracks.empty()) {
+    std::vector<Acts::RecordedMaterialTrack> tracks(m_cfg.ntracks);
+    forEachTask([&](std::size_t /*itask*/, std::size_t begin,
+                    std::size_t end) {
+      for (std::size_t iTrack = begin; iTrack < end; ++iTrack) {
+        tracks[iTrack] = m_cfg.materialValidater->recordMaterial(
+            context.geoContext, context.magFieldContext, m_cfg.startPosition,
+            directions[iTrack]);
+      }
+    });
+
+    // The output recorded material track collection
+    std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
+        recordedMaterialTracks;
+    for (std::size_t iTrack = 0; iTrack < m_cfg.ntracks; ++iTrack) {
+      recordedMaterialTracks.emplace_hint(recordedMaterialTracks.end(), iTrack,
+                                          std::move(tracks[iTrack]));
+    }
+
+    // Write the mapped and unmapped material tracks to the output
+    m_outputMaterialTracks(context, std::move(recordedMaterialTracks));
   }
 
-  // Write the mapped and unmapped material tracks to the output
-  m_outputMaterialTracks(context, std::move(recordedMaterialTracks));
+  if (!m_cfg.outputMaterialProfile.empty()) {
+    // The task profiles are merged in task order afterwards, such that the
+    // sums do not depend on the scheduling
+    Acts::MaterialProfile profile(m_cfg.profileEtaBins, m_cfg.etaRange,
+                                  m_cfg.profilePhiBins, m_cfg.phiRange);
+    std::vector<Acts::MaterialProfile> taskProfiles(nTasks, profile);
+    forEachTask([&](std::size_t itask, std::size_t begin, std::size_t end) {
+      for (std::size_t iTrack = begin; iTrack < end; ++iTrack) {
+        auto [inX0, inL0] = m_cfg.materialValidater->integrateMaterial(
+            context.geoContext, context.magFieldContext, m_cfg.startPosition,
+            directions[iTrack]);
+        taskProfiles[itask].fill(etas[iTrack], phis[iTrack], inX0, inL0);
+      }
+    });
+    for (const auto& taskProfile : taskProfiles) {
+      profile.merge(taskProfile);
+    }
+
+    m_outputMaterialProfile(context, std::move(profile));
+  }
 
   return ProcessCode::SUCCESS;
 }
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -50,6 +51,11 @@ class MuonHoughSeeder final : public IAlgorithm {
   struct Config {
     std::string inSimHits;
     std::string inDriftCircles;
+    /// Number of bins of the hough planes in tan(theta) and z0
+    std::size_t nBinsTanTheta = 1000;
+    std::size_t nBinsZ0 = 1000;
+    /// Output file for the hough plane plots, empty to disable plotting
+    std::string outHoughPlots = "HoughHistograms.pdf";
   };
 
   MuonHoughSeeder(Config cfg, Acts::Logging::Level lvl);
@@ -70,6 +76,17 @@ class MuonHoughSeeder final : public IAlgorithm {
   std::unique_ptr<const Acts::Logger> m_logger;
   const Acts::Logger& logger() const { return *m_logger; }
 
+  using HoughPlane =
+      Acts::HoughTransformUtils::HoughPlane<Acts::GeometryIdentifier::Value>;
+
+  /// The hough planes are expensive to construct, every task takes one from
+  /// the pool and resets it in place for each station
+  std::unique_ptr<HoughPlane> acquireHoughPlane() const;
+  void releaseHoughPlane(std::unique_ptr<HoughPlane> houghPlane) const;
+
+  mutable std::mutex m_houghPlaneMutex;
+  mutable std::vector<std::unique_ptr<HoughPlane>> m_houghPlanes;
+
   ReadDataHandle<SimHitContainer> m_inputSimHits{this, "InputSimHits"};
   ReadDataHandle<DriftCircleContainer> m_inputDriftCircles{this,
                                                            "InputDriftCircles"};
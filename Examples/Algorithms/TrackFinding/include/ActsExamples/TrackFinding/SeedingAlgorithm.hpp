@@ -64,6 +64,17 @@ class SeedingAlgorithm final : public IAlgorithm {
     // number of phiBin neighbors at each side of the current bin that will be
     // used to search for SPs
     int numPhiNeighbors = 1;
+
+    /// Process the space point groups of one event in parallel tasks, each
+    /// with its own seeding state. The seeds are merged in grid order and are
+    /// the same as in the serial mode. Has no effect with seed confirmation,
+    /// which depends on the seeds of the previous groups.
+    bool parallelGroups = false;
+
+    /// Copy the space points of the grid into a structure-of-arrays store
+    /// once per event, from which the doublet search reads the candidates.
+    /// The seeds are the same as without the store.
+    bool useSpacePointStore = false;
   };
 
   /// Construct the seeding algorithm.
@@ -78,13 +89,20 @@ class SeedingAlgorithm final : public IAlgorithm {
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const final;
 
+  using SeedFinder =
+      Acts::SeedFinder<SimSpacePoint,
+                       Acts::CylindricalSpacePointGrid<SimSpacePoint>>;
+
   /// Const access to the config
   const Config& config() const { return m_cfg; }
 
  private:
-  Acts::SeedFinder<SimSpacePoint,
-                   Acts::CylindricalSpacePointGrid<SimSpacePoint>>
-      m_seedFinder;
+  /// Prepare the auxiliary space point data of a seeding state
+  void prepareSpacePointData(
+      const Acts::CylindricalSpacePointGrid<SimSpacePoint>& grid,
+      std::size_t nSpacePoints, Acts::SpacePointData& spacePointData) const;
+
+  SeedFinder m_seedFinder;
   std::unique_ptr<const Acts::GridBinFinder<2ul>> m_bottomBinFinder;
   std::unique_ptr<const Acts::GridBinFinder<2ul>> m_topBinFinder;
 
@@ -35,6 +35,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <variant>
@@ -122,6 +123,24 @@ class TrackFindingAlgorithm final : public IAlgorithm {
     bool stayOnSeed = false;
     /// Compute shared hit information
     bool computeSharedHits = false;
+    /// Number of seeds processed by one task when distributing the seeds of
+    /// an event over the worker threads. Zero processes all seeds in
+    /// sequence. The seed deduplication only acts within a task.
+    std::size_t seedsPerTask = 0;
+    /// Drop a branch once this many consecutive measurements at its end
+    /// belong to an already found track. Zero disables the check. The
+    /// measurements are claimed by the selected tracks in the order they
+    /// are found, so the result depends on the scheduling of the tasks if
+    /// `seedsPerTask` is set.
+    std::size_t maxClaimedMeasurements = 0;
+    /// Only calibrate the source links on a surface within this many standard
+    /// deviations of the predicted first local coordinate. Zero calibrates
+    /// all source links on a surface.
+    double sourceLinkWindowNSigma = 0;
+    /// Only calibrate the source links whose uncalibrated measurement is
+    /// within this many standard deviations of the prediction in each
+    /// measured local coordinate. Zero calibrates all candidates.
+    double preSelectionNSigma = 0;
   };
 
   /// Constructor of the track finding algorithm
@@ -147,10 +166,30 @@ class TrackFindingAlgorithm final : public IAlgorithm {
 
   ActsExamples::ProcessCode finalize() override;
 
+  /// Temporary output of the seeds processed by one task, which is kept and
+  /// reused for the following events
+  struct FindWorkspace {
+    TrackContainer tracks{std::make_shared<Acts::VectorTrackContainer>(),
+                          std::make_shared<Acts::VectorMultiTrajectory>()};
+    TrackContainer tracksTemp{std::make_shared<Acts::VectorTrackContainer>(),
+                              std::make_shared<Acts::VectorMultiTrajectory>()};
+
+    FindWorkspace() {
+      tracks.addColumn<unsigned int>("trackGroup");
+      tracksTemp.addColumn<unsigned int>("trackGroup");
+    }
+  };
+
+  std::unique_ptr<FindWorkspace> acquireWorkspace() const;
+  void releaseWorkspace(std::unique_ptr<FindWorkspace> workspace) const;
+
  private:
   Config m_cfg;
   std::optional<Acts::TrackSelector> m_trackSelector;
 
+  mutable std::mutex m_workspaceMutex;
+  mutable std::vector<std::unique_ptr<FindWorkspace>> m_workspaces;
+
   ReadDataHandle<MeasurementContainer> m_inputMeasurements{this,
                                                            "InputMeasurements"};
   ReadDataHandle<IndexSourceLinkContainer> m_inputSourceLinks{
@@ -169,6 +208,7 @@ class TrackFindingAlgorithm final : public IAlgorithm {
   mutable std::atomic<std::size_t> m_nFoundTracks{0};
   mutable std::atomic<std::size_t> m_nSelectedTracks{0};
   mutable std::atomic<std::size_t> m_nStoppedBranches{0};
+  mutable std::atomic<std::size_t> m_nDuplicateBranches{0};
 
   mutable tbb::combinable<Acts::VectorMultiTrajectory::Statistics>
       m_memoryStatistics{[]() {
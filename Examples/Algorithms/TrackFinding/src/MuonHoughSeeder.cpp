@@ -9,12 +9,15 @@
 #include "ActsExamples/TrackFinding/MuonHoughSeeder.hpp"
 
 #include "ActsExamples/EventData/MuonSimHit.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
 #include <algorithm>
 #include <cmath>
 #include <iterator>
 #include <ostream>
 #include <stdexcept>
+#include <tuple>
+#include <unordered_map>
 #include <variant>
 
 #include "TBox.h"
@@ -44,23 +47,48 @@ ActsExamples::MuonHoughSeeder::MuonHoughSeeder(
   if (m_cfg.inSimHits.empty()) {
     throw std::invalid_argument("MuonHoughSeeder: Missing sim hit collection");
   }
+  if (m_cfg.nBinsTanTheta == 0 || m_cfg.nBinsZ0 == 0) {
+    throw std::invalid_argument("MuonHoughSeeder: Empty hough plane binning");
+  }
 
   m_inputDriftCircles.initialize(m_cfg.inDriftCircles);
   m_inputSimHits.initialize(m_cfg.inSimHits);
 }
 
+namespace {
+
 using PatternSeed = std::pair<double, double>;  // y0, tan theta
 
+/// Identifier of the station of a drift circle or sim hit, the fields are
+/// masked to 8 bits as the eta index can be negative
+Acts::GeometryIdentifier::Value stationId(int stationName, int stationEta,
+                                          int stationPhi) {
+  auto field = [](int value) {
+    return static_cast<Acts::GeometryIdentifier::Value>(value & 0xFF);
+  };
+  return field(stationName) << 16 | field(stationEta) << 8 | field(stationPhi);
+}
+
+/// The hough transform result of one station
+struct StationResult {
+  using Maximum = Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
+      Acts::GeometryIdentifier::Value>::Maximum;
+
+  std::vector<Maximum> maxima;
+  /// non-empty bins and their hit counts, only kept for plotting
+  std::vector<std::tuple<std::size_t, std::size_t,
+                         Acts::HoughTransformUtils::YieldType>>
+      bins;
+  Acts::HoughTransformUtils::YieldType maxHits = 0;
+};
+
+}  // namespace
+
 ActsExamples::ProcessCode ActsExamples::MuonHoughSeeder::execute(
     const AlgorithmContext& ctx) const {
   // read the hits and circles
-  auto gotSH = m_inputSimHits(ctx);
-  auto gotDC = m_inputDriftCircles(ctx);
-
-  // configure the binning of the hough plane
-  Acts::HoughTransformUtils::HoughPlaneConfig planeCfg;
-  planeCfg.nBinsX = 1000;
-  planeCfg.nBinsY = 1000;
+  const auto& gotSH = m_inputSimHits(ctx);
+  const auto& gotDC = m_inputDriftCircles(ctx);
 
   // instantiate the peak finder
   Acts::HoughTransformUtils::PeakFinders::IslandsAroundMaxConfig peakFinderCfg;
@@ -94,68 +122,132 @@ ActsExamples::ProcessCode ActsExamples::MuonHoughSeeder::execute(
                            // fully reliable at this stage
   };
 
-  // store the true parameters
-  std::vector<PatternSeed> truePatterns;
+  // group the drift circles by station, such that each station only votes
+  // its own drift circles into the hough plane
+  std::unordered_map<Acts::GeometryIdentifier::Value, std::vector<std::size_t>>
+      stationDriftCircles;
+  for (std::size_t i = 0; i < gotDC.size(); ++i) {
+    const DriftCircle& DC = gotDC[i];
+    stationDriftCircles[stationId(DC.stationName(), DC.stationEta(),
+                                  DC.stationPhi())]
+        .push_back(i);
+  }
 
-  // instantiate the hough plane
-  Acts::HoughTransformUtils::HoughPlane<Acts::GeometryIdentifier::Value>
-      houghPlane(planeCfg);
-  // also insantiate the peak finder
-  Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
-      Acts::GeometryIdentifier::Value>
-      peakFinder(peakFinderCfg);
+  // the stations with true hits, several hits may share a station
+  std::vector<Acts::GeometryIdentifier::Value> stations;
+  std::vector<std::size_t> hitStations;
+  hitStations.reserve(gotSH.size());
+  {
+    std::unordered_map<Acts::GeometryIdentifier::Value, std::size_t>
+        stationIndices;
+    for (const auto& SH : gotSH) {
+      muonMdtIdentifierFields detailedInfo =
+          splitId(SH.geometryId().value());
+      auto station =
+          stationId(detailedInfo.stationName, detailedInfo.stationEta,
+                    detailedInfo.stationPhi);
+      auto [it, inserted] =
+          stationIndices.try_emplace(station, stations.size());
+      if (inserted) {
+        stations.push_back(station);
+      }
+      hitStations.push_back(it->second);
+    }
+  }
+
+  const bool plot = !m_cfg.outHoughPlots.empty();
+  const std::vector<std::size_t> noDriftCircles;
+  std::vector<StationResult> results(stations.size());
+
+  // the stations are independent and processed in parallel
+  tbbWrap::parallel_for(
+      tbb::blocked_range<std::size_t>(0, stations.size()),
+      [&](const tbb::blocked_range<std::size_t>& range) {
+        auto houghPlanePtr = acquireHoughPlane();
+        HoughPlane& houghPlane = *houghPlanePtr;
+        Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
+            Acts::GeometryIdentifier::Value>
+            peakFinder(peakFinderCfg);
+        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+          auto found = stationDriftCircles.find(stations[i]);
+          const auto& driftCircles = found != stationDriftCircles.end()
+                                         ? found->second
+                                         : noDriftCircles;
+
+          // reset the hough plane
+          houghPlane.reset();
+          for (std::size_t iDC : driftCircles) {
+            const DriftCircle& DC = gotDC[iDC];
+            // build a single identifier for the drift circles
+            muonMdtIdentifierFields idf;
+            idf.multilayer = DC.multilayer();
+            idf.stationEta = DC.stationEta();
+            idf.stationPhi = DC.stationPhi();
+            idf.stationName = DC.stationName();
+            idf.tubeLayer = DC.tubeLayer();
+            idf.tube = DC.tube();
+            auto identifier = compressId(idf);
+            auto effectiveLayer =
+                3 * (DC.multilayer() - 1) + (DC.tubeLayer() - 1);
+            // populate the hough plane with both solutions.
+            houghPlane.fill<DriftCircle>(DC, axisRanges,
+                                         houghParam_fromDC_left,
+                                         houghWidth_fromDC, identifier,
+                                         effectiveLayer, 1.0);
+            houghPlane.fill<DriftCircle>(DC, axisRanges,
+                                         houghParam_fromDC_right,
+                                         houghWidth_fromDC, identifier,
+                                         effectiveLayer, 1.0);
+          }
+          // now get the peaks
+          StationResult& result = results[i];
+          result.maxima = peakFinder.findPeaks(houghPlane, axisRanges);
+          result.maxHits = houghPlane.maxHits();
+          if (plot) {
+            result.bins.reserve(houghPlane.getNonEmptyBins().size());
+            for (const auto& [bx, by] : houghPlane.getNonEmptyBins()) {
+              result.bins.emplace_back(bx, by, houghPlane.nHits(bx, by));
+            }
+          }
+        }
+        releaseHoughPlane(std::move(houghPlanePtr));
+      });
 
-  // loop pver true hirs
-  for (auto& SH : gotSH) {
+  // loop over true hits
+  std::size_t iSH = 0;
+  for (const auto& SH : gotSH) {
+    const std::size_t iStation = hitStations[iSH++];
+    const StationResult& result = results[iStation];
     // read the identifier
     muonMdtIdentifierFields detailedInfo =
         ActsExamples::splitId(SH.geometryId().value());
 
     // store the true parameters
-    truePatterns.emplace_back(SH.direction().y() / SH.direction().z(),
-                              SH.fourPosition().y());
-    // reset the hough plane
-    houghPlane.reset();
-    int foundDC = 0;
-    // loop over drift circles
-    for (DriftCircle& DC : gotDC) {
-      if (DC.stationEta() == detailedInfo.stationEta &&
-          DC.stationPhi() == detailedInfo.stationPhi &&
-          DC.stationName() == detailedInfo.stationName) {
-        // build a single identifier for the drift circles
-        muonMdtIdentifierFields idf;
-        idf.multilayer = DC.multilayer();
-        idf.stationEta = DC.stationEta();
-        idf.stationPhi = DC.stationPhi();
-        idf.stationName = DC.stationName();
-        idf.tubeLayer = DC.tubeLayer();
-        idf.tube = DC.tube();
-        auto identifier = compressId(idf);
-        auto effectiveLayer = 3 * (DC.multilayer() - 1) + (DC.tubeLayer() - 1);
-        ++foundDC;
-        // populate the hough plane with both solutions.
-        houghPlane.fill<DriftCircle>(DC, axisRanges, houghParam_fromDC_left,
-                                     houghWidth_fromDC, identifier,
-                                     effectiveLayer, 1.0);
-        houghPlane.fill<DriftCircle>(DC, axisRanges, houghParam_fromDC_right,
-                                     houghWidth_fromDC, identifier,
-                                     effectiveLayer, 1.0);
-      }
+    PatternSeed truePattern(SH.direction().y() / SH.direction().z(),
+                            SH.fourPosition().y());
+    auto found = stationDriftCircles.find(stations[iStation]);
+    int foundDC = found != stationDriftCircles.end()
+                      ? static_cast<int>(found->second.size())
+                      : 0;
+    ACTS_DEBUG("Station " << stationDict.at(detailedInfo.stationName)
+                          << ", Eta "
+                          << static_cast<int>(detailedInfo.stationEta)
+                          << ", Phi "
+                          << static_cast<int>(detailedInfo.stationPhi) << ": "
+                          << foundDC << " drift circles, "
+                          << result.maxima.size() << " hough maxima");
+    if (!plot) {
+      continue;
     }
-    // now get the peaks
-    auto maxima = peakFinder.findPeaks(houghPlane, axisRanges);
 
     // visualisation in ROOT
     // represent the hough space as a TH2
     TH2D houghHistoForPlot("houghHist", "HoughPlane;tan(#theta);z0 [mm]",
-                           houghPlane.nBinsX(), axisRanges.xMin,
-                           axisRanges.xMax, houghPlane.nBinsY(),
-                           axisRanges.yMin, axisRanges.yMax);
-    for (int bx = 0; bx < houghHistoForPlot.GetNbinsX(); ++bx) {
-      for (int by = 0; by < houghHistoForPlot.GetNbinsY(); ++by) {
-        houghHistoForPlot.SetBinContent(bx + 1, by + 1,
-                                        houghPlane.nHits(bx, by));
-      }
+                           m_cfg.nBinsTanTheta, axisRanges.xMin,
+                           axisRanges.xMax, m_cfg.nBinsZ0, axisRanges.yMin,
+                           axisRanges.yMax);
+    for (const auto& [bx, by, nHits] : result.bins) {
+      houghHistoForPlot.SetBinContent(bx + 1, by + 1, nHits);
     }
 
     m_outCanvas->SetTitle(Form("Station %s, Eta %i, Phi %i",
@@ -168,7 +260,7 @@ ActsExamples::ProcessCode ActsExamples::MuonHoughSeeder::execute(
              static_cast<int>(detailedInfo.stationEta),
              static_cast<int>(detailedInfo.stationPhi)));
     m_outCanvas->cd();
-    int maxHitsAsInt = static_cast<int>(houghPlane.maxHits());
+    int maxHitsAsInt = static_cast<int>(result.maxHits);
     houghHistoForPlot.SetContour(maxHitsAsInt + 1);
     for (int k = 0; k < maxHitsAsInt + 1; ++k) {
       houghHistoForPlot.SetContourLevel(k, k - 0.5);
@@ -180,13 +272,13 @@ ActsExamples::ProcessCode ActsExamples::MuonHoughSeeder::execute(
     houghHistoForPlot.Draw("COLZ");
     // mark the true parameters
     auto trueMarker = std::make_unique<TMarker>(
-        truePatterns.back().first, truePatterns.back().second, kOpenCrossX);
+        truePattern.first, truePattern.second, kOpenCrossX);
     trueMarker->SetMarkerSize(3);
     trueMarker->SetMarkerColor(kRed);
     trueMarker->Draw();
 
     // now draw the hough maxima
-    for (auto& max : maxima) {
+    for (auto& max : result.maxima) {
       markers.push_back(std::make_unique<TMarker>(max.x, max.y, kFullSquare));
       markers.back()->SetMarkerSize(1);
       markers.back()->SetMarkerColor(kBlue);
@@ -216,7 +308,7 @@ ActsExamples::ProcessCode ActsExamples::MuonHoughSeeder::execute(
     tl.SetTextSize(24);
     tl.SetNDC();
     tl.Draw();
-    m_outCanvas->SaveAs("HoughHistograms.pdf");
+    m_outCanvas->SaveAs(m_cfg.outHoughPlots.c_str());
   }
 
   ACTS_VERBOSE("SH: " << gotSH.size());
@@ -224,10 +316,32 @@ ActsExamples::ProcessCode ActsExamples::MuonHoughSeeder::execute(
   return ActsExamples::ProcessCode::SUCCESS;
 }
 
+std::unique_ptr<ActsExamples::MuonHoughSeeder::HoughPlane>
+ActsExamples::MuonHoughSeeder::acquireHoughPlane() const {
+  std::lock_guard<std::mutex> lock(m_houghPlaneMutex);
+  if (m_houghPlanes.empty()) {
+    return std::make_unique<HoughPlane>(
+        Acts::HoughTransformUtils::HoughPlaneConfig{m_cfg.nBinsTanTheta,
+                                                    m_cfg.nBinsZ0});
+  }
+  auto houghPlane = std::move(m_houghPlanes.back());
+  m_houghPlanes.pop_back();
+  return houghPlane;
+}
+
+void ActsExamples::MuonHoughSeeder::releaseHoughPlane(
+    std::unique_ptr<HoughPlane> houghPlane) const {
+  std::lock_guard<std::mutex> lock(m_houghPlaneMutex);
+  m_houghPlanes.push_back(std::move(houghPlane));
+}
+
 ActsExamples::ProcessCode ActsExamples::MuonHoughSeeder::initialize() {
   // book the output canvas
+  if (m_cfg.outHoughPlots.empty()) {
+    return ProcessCode::SUCCESS;
+  }
   m_outCanvas = std::make_unique<TCanvas>("canvas", "", 800, 800);
-  m_outCanvas->SaveAs("HoughHistograms.pdf[");
+  m_outCanvas->SaveAs((m_cfg.outHoughPlots + "[").c_str());
   m_outCanvas->SetRightMargin(0.12);
   m_outCanvas->SetLeftMargin(0.12);
   gStyle->SetPalette(kGreyScale);
@@ -235,6 +349,8 @@ ActsExamples::ProcessCode ActsExamples::MuonHoughSeeder::initialize() {
   return ProcessCode::SUCCESS;
 }
 ActsExamples::ProcessCode ActsExamples::MuonHoughSeeder::finalize() {
-  m_outCanvas->SaveAs("HoughHistograms.pdf]");
+  if (m_outCanvas != nullptr) {
+    m_outCanvas->SaveAs((m_cfg.outHoughPlots + "]").c_str());
+  }
   return ProcessCode::SUCCESS;
 }
@@ -14,12 +14,14 @@
 #include "Acts/Seeding/BinnedGroup.hpp"
 #include "Acts/Seeding/InternalSpacePoint.hpp"
 #include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SpacePointStore.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/GridBinFinder.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
 #include <cmath>
 #include <csignal>
@@ -28,6 +30,9 @@
 #include <limits>
 #include <ostream>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace ActsExamples {
 struct AlgorithmContext;
@@ -204,17 +209,60 @@ ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
         });
   }
 
-  m_bottomBinFinder = std::make_unique<const Acts::GridBinFinder<2ul>>(
+  // the grid binning is the same in every event, the neighbouring bins are
+  // therefore computed once
+  auto bottomBinFinder = std::make_unique<Acts::GridBinFinder<2ul>>(
       m_cfg.numPhiNeighbors, m_cfg.zBinNeighborsBottom);
-  m_topBinFinder = std::make_unique<const Acts::GridBinFinder<2ul>>(
+  auto topBinFinder = std::make_unique<Acts::GridBinFinder<2ul>>(
       m_cfg.numPhiNeighbors, m_cfg.zBinNeighborsTop);
+  Acts::CylindricalSpacePointGrid<SimSpacePoint> grid =
+      Acts::CylindricalSpacePointGridCreator::createGrid<SimSpacePoint>(
+          m_cfg.gridConfig, m_cfg.gridOptions);
+  bottomBinFinder->precomputeBins(grid);
+  topBinFinder->precomputeBins(grid);
+  m_bottomBinFinder = std::move(bottomBinFinder);
+  m_topBinFinder = std::move(topBinFinder);
 
   m_cfg.seedFinderConfig.seedFilter =
       std::make_unique<Acts::SeedFilter<SimSpacePoint>>(m_cfg.seedFilterConfig);
-  m_seedFinder =
-      Acts::SeedFinder<SimSpacePoint,
-                       Acts::CylindricalSpacePointGrid<SimSpacePoint>>(
-          m_cfg.seedFinderConfig);
+  m_seedFinder = SeedFinder(m_cfg.seedFinderConfig);
+}
+
+void ActsExamples::SeedingAlgorithm::prepareSpacePointData(
+    const Acts::CylindricalSpacePointGrid<SimSpacePoint>& grid,
+    std::size_t nSpacePoints, Acts::SpacePointData& spacePointData) const {
+  spacePointData.resize(
+      nSpacePoints, m_cfg.seedFinderConfig.useDetailedDoubleMeasurementInfo);
+
+  if (!m_cfg.seedFinderConfig.useDetailedDoubleMeasurementInfo) {
+    return;
+  }
+
+  for (std::size_t grid_glob_bin(0); grid_glob_bin < grid.size();
+       ++grid_glob_bin) {
+    const auto& collection = grid.at(grid_glob_bin);
+    for (const auto& sp : collection) {
+      std::size_t index = sp->index();
+
+      const float topHalfStripLength =
+          m_cfg.seedFinderConfig.getTopHalfStripLength(sp->sp());
+      const float bottomHalfStripLength =
+          m_cfg.seedFinderConfig.getBottomHalfStripLength(sp->sp());
+      const Acts::Vector3 topStripDirection =
+          m_cfg.seedFinderConfig.getTopStripDirection(sp->sp());
+      const Acts::Vector3 bottomStripDirection =
+          m_cfg.seedFinderConfig.getBottomStripDirection(sp->sp());
+
+      spacePointData.setTopStripVector(index,
+                                       topHalfStripLength * topStripDirection);
+      spacePointData.setBottomStripVector(
+          index, bottomHalfStripLength * bottomStripDirection);
+      spacePointData.setStripCenterDistance(
+          index, m_cfg.seedFinderConfig.getStripCenterDistance(sp->sp()));
+      spacePointData.setTopStripCenterPosition(
+          index, m_cfg.seedFinderConfig.getTopStripCenterPosition(sp->sp()));
+    }
+  }
 }
 
 ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
@@ -276,50 +324,72 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
       up - m_cfg.seedFinderConfig.deltaRMiddleMaxSPRange);
 
   // run the seeding
-  static thread_local SimSeedContainer seeds;
-  seeds.clear();
-  static thread_local decltype(m_seedFinder)::SeedingState state;
-  state.spacePointData.resize(
-      spacePointPtrs.size(),
-      m_cfg.seedFinderConfig.useDetailedDoubleMeasurementInfo);
+  SimSeedContainer seeds;
 
-  if (m_cfg.seedFinderConfig.useDetailedDoubleMeasurementInfo) {
-    for (std::size_t grid_glob_bin(0);
-         grid_glob_bin < spacePointsGrouping.grid().size(); ++grid_glob_bin) {
-      const auto& collection = spacePointsGrouping.grid().at(grid_glob_bin);
-      for (const auto& sp : collection) {
-        std::size_t index = sp->index();
-
-        const float topHalfStripLength =
-            m_cfg.seedFinderConfig.getTopHalfStripLength(sp->sp());
-        const float bottomHalfStripLength =
-            m_cfg.seedFinderConfig.getBottomHalfStripLength(sp->sp());
-        const Acts::Vector3 topStripDirection =
-            m_cfg.seedFinderConfig.getTopStripDirection(sp->sp());
-        const Acts::Vector3 bottomStripDirection =
-            m_cfg.seedFinderConfig.getBottomStripDirection(sp->sp());
-
-        state.spacePointData.setTopStripVector(
-            index, topHalfStripLength * topStripDirection);
-        state.spacePointData.setBottomStripVector(
-            index, bottomHalfStripLength * bottomStripDirection);
-        state.spacePointData.setStripCenterDistance(
-            index, m_cfg.seedFinderConfig.getStripCenterDistance(sp->sp()));
-        state.spacePointData.setTopStripCenterPosition(
-            index, m_cfg.seedFinderConfig.getTopStripCenterPosition(sp->sp()));
-      }
-    }
+  const auto& groupedGrid = spacePointsGrouping.grid();
+
+  Acts::SpacePointStore<SimSpacePoint> spacePointStore;
+  if (m_cfg.useSpacePointStore) {
+    spacePointStore.fill(groupedGrid);
   }
+  const Acts::SpacePointStore<SimSpacePoint>* store =
+      m_cfg.useSpacePointStore ? &spacePointStore : nullptr;
+
+  // the seed confirmation reads the seed qualities of the space points set by
+  // the previous groups, so these groups can only run in order
+  if (!m_cfg.parallelGroups || m_cfg.seedFilterConfig.seedConfirmation) {
+    static thread_local SeedFinder::SeedingState state;
+    prepareSpacePointData(groupedGrid, spacePointPtrs.size(),
+                          state.spacePointData);
+    state.spacePointStore = store;
+
+    for (const auto [bottom, middle, top] : spacePointsGrouping) {
+      m_seedFinder.createSeedsForGroup(m_cfg.seedFinderOptions, state,
+                                       groupedGrid, std::back_inserter(seeds),
+                                       bottom, middle, top, rMiddleSPRange);
+    }
+  } else {
+    // materialize the groups so they can be distributed over the tasks
+    using Group = decltype(*spacePointsGrouping.begin());
+    std::vector<Group> groups;
+    for (auto [bottom, middle, top] : spacePointsGrouping) {
+      groups.emplace_back(std::move(bottom), middle, std::move(top));
+    }
+
+    // Every task processes a range of groups with its own seeding state.
+    // Nothing is shared with other events running on the same thread, and
+    // the seeds are merged in group order afterwards, such that the output
+    // does not depend on the scheduling.
+    std::vector<SimSeedContainer> groupSeeds(groups.size());
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, groups.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          SeedFinder::SeedingState state;
+          prepareSpacePointData(groupedGrid, spacePointPtrs.size(),
+                                state.spacePointData);
+          state.spacePointStore = store;
+          for (std::size_t i = range.begin(); i != range.end(); ++i) {
+            const auto& [bottom, middle, top] = groups[i];
+            m_seedFinder.createSeedsForGroup(
+                m_cfg.seedFinderOptions, state, groupedGrid,
+                std::back_inserter(groupSeeds[i]), bottom, middle, top,
+                rMiddleSPRange);
+          }
+        });
 
-  for (const auto [bottom, middle, top] : spacePointsGrouping) {
-    m_seedFinder.createSeedsForGroup(
-        m_cfg.seedFinderOptions, state, spacePointsGrouping.grid(),
-        std::back_inserter(seeds), bottom, middle, top, rMiddleSPRange);
+    std::size_t nSeeds = 0;
+    for (const auto& group : groupSeeds) {
+      nSeeds += group.size();
+    }
+    seeds.reserve(nSeeds);
+    for (auto& group : groupSeeds) {
+      std::move(group.begin(), group.end(), std::back_inserter(seeds));
+    }
   }
 
   ACTS_DEBUG("Created " << seeds.size() << " track seeds from "
                         << spacePointPtrs.size() << " space points");
 
-  m_outputSeeds(ctx, SimSeedContainer{seeds});
+  m_outputSeeds(ctx, std::move(seeds));
   return ActsExamples::ProcessCode::SUCCESS;
 }
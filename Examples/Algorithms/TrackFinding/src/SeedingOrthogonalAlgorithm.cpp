@@ -82,8 +82,6 @@ ActsExamples::ProcessCode ActsExamples::SeedingOrthogonalAlgorithm::execute(
     }
   }
 
-  Acts::SeedFinderOrthogonal<SimSpacePoint> finder(m_cfg.seedFinderConfig);
-
   std::function<
       std::tuple<Acts::Vector3, Acts::Vector2, std::optional<Acts::ActsScalar>>(
           const SimSpacePoint *sp)>
@@ -93,8 +91,8 @@ ActsExamples::ProcessCode ActsExamples::SeedingOrthogonalAlgorithm::execute(
         return std::make_tuple(position, variance, sp->t());
       };
 
-  SimSeedContainer seeds = finder.createSeeds(m_cfg.seedFinderOptions,
-                                              spacePoints, create_coordinates);
+  SimSeedContainer seeds = m_finder.createSeeds(
+      m_cfg.seedFinderOptions, spacePoints, create_coordinates);
 
   ACTS_DEBUG("Created " << seeds.size() << " track seeds from "
                         << spacePoints.size() << " space points");
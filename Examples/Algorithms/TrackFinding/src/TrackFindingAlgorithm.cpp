@@ -35,23 +35,29 @@
 #include "Acts/Utilities/Enumerate.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/TrackHelpers.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/IndexSourceLinkWindowAccessor.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/EventData/MeasurementCalibration.hpp"
 #include "ActsExamples/EventData/SimSeed.hpp"
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
 #include <system_error>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <boost/functional/hash.hpp>
 
@@ -181,14 +187,35 @@ class BranchStopper {
                                  Acts::TrackSelector::EtaBinnedConfig>>;
   using BranchStopperResult =
       Acts::CombinatorialKalmanFilterBranchStopperResult;
+  /// Flags of the measurements which are part of an already found track,
+  /// indexed by the source link index
+  using ClaimedMeasurements = std::vector<std::atomic<bool>>;
 
   mutable std::atomic<std::size_t> m_nStoppedBranches{0};
-
-  explicit BranchStopper(const Config& config) : m_config(config) {}
+  mutable std::atomic<std::size_t> m_nDuplicateBranches{0};
+
+  /// @param config The track selector config for the branches
+  /// @param maxClaimedMeasurements Number of consecutive claimed measurements
+  ///        after which a branch is dropped, zero disables the check
+  /// @param claimedMeasurements The claimed measurements flags, needed if
+  ///        @p maxClaimedMeasurements is not zero
+  BranchStopper(const Config& config, std::size_t maxClaimedMeasurements = 0,
+                ClaimedMeasurements* claimedMeasurements = nullptr)
+      : m_config(config),
+        m_maxClaimedMeasurements(maxClaimedMeasurements),
+        m_claimedMeasurements(claimedMeasurements) {}
 
   BranchStopperResult operator()(
       const Acts::CombinatorialKalmanFilterTipState& tipState,
       Acts::VectorMultiTrajectory::TrackStateProxy& trackState) const {
+    // A branch that runs along a found track is a duplicate of it
+    if (m_maxClaimedMeasurements > 0 &&
+        trackState.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag) &&
+        nClaimedMeasurements(trackState) >= m_maxClaimedMeasurements) {
+      ++m_nDuplicateBranches;
+      return BranchStopperResult::StopAndDrop;
+    }
+
     if (!m_config.has_value()) {
       return BranchStopperResult::Continue;
     }
@@ -226,8 +253,94 @@ class BranchStopper {
     return BranchStopperResult::Continue;
   }
 
+  /// Claim the measurements of a found track for the following branches.
+  void claimMeasurements(const TrackProxy& track) const {
+    if (m_maxClaimedMeasurements == 0) {
+      return;
+    }
+    for (const auto& state : track.trackStatesReversed()) {
+      if (state.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
+        (*m_claimedMeasurements)[sourceLinkIndex(state)].store(
+            true, std::memory_order_relaxed);
+      }
+    }
+  }
+
  private:
   Config m_config;
+  std::size_t m_maxClaimedMeasurements = 0;
+  ClaimedMeasurements* m_claimedMeasurements = nullptr;
+
+  template <typename track_state_proxy_t>
+  static Index sourceLinkIndex(const track_state_proxy_t& state) {
+    return state.getUncalibratedSourceLink()
+        .template get<IndexSourceLink>()
+        .index();
+  }
+
+  /// Count the claimed measurements at the end of the branch, up to the
+  /// first measurement which is not claimed. Holes and outliers are skipped.
+  std::size_t nClaimedMeasurements(
+      const Acts::VectorMultiTrajectory::TrackStateProxy& trackState) const {
+    std::size_t nClaimed = 0;
+    trackState.trajectory().visitBackwards(
+        trackState.index(), [&](const auto& state) {
+          if (!state.typeFlags().test(Acts::TrackStateFlag::MeasurementFlag)) {
+            return true;
+          }
+          if (!(*m_claimedMeasurements)[sourceLinkIndex(state)].load(
+                  std::memory_order_relaxed)) {
+            return false;
+          }
+          return ++nClaimed < m_maxClaimedMeasurements;
+        });
+    return nClaimed;
+  }
+};
+
+/// Rejects the source links before the calibration if their uncalibrated
+/// measurement is too far from the prediction in one of the measured local
+/// coordinates
+class MeasurementPreSelector {
+ public:
+  /// @param measurements The measurements referenced by the source links
+  /// @param nSigma The maximum distance in standard deviations of the
+  ///        residual of each local coordinate
+  MeasurementPreSelector(const MeasurementContainer& measurements,
+                         double nSigma)
+      : m_measurements(&measurements), m_nSigma2(nSigma * nSigma) {}
+
+  bool isCompatible(const Acts::BoundTrackParameters& predicted,
+                    const Acts::SourceLink& sourceLink) const {
+    if (!predicted.covariance().has_value()) {
+      return true;
+    }
+    const auto& covariance = *predicted.covariance();
+    const Index index = sourceLink.get<IndexSourceLink>().index();
+    return std::visit(
+        [&](const auto& measurement) {
+          const auto indices = measurement.indices();
+          for (std::size_t i = 0; i < indices.size(); ++i) {
+            const auto bound = indices[i];
+            if (bound != Acts::eBoundLoc0 && bound != Acts::eBoundLoc1) {
+              continue;
+            }
+            const double residual =
+                measurement.parameters()[i] - predicted.parameters()[bound];
+            const double variance =
+                measurement.covariance()(i, i) + covariance(bound, bound);
+            if (residual * residual > m_nSigma2 * variance) {
+              return false;
+            }
+          }
+          return true;
+        },
+        (*m_measurements)[index]);
+  }
+
+ private:
+  const MeasurementContainer* m_measurements;
+  double m_nSigma2;
 };
 
 }  // namespace
@@ -298,30 +411,43 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   PassThroughCalibrator pcalibrator;
   MeasurementCalibratorAdapter calibrator(pcalibrator, measurements);
   Acts::GainMatrixUpdater kfUpdater;
-  MeasurementSelector measSel{
-      Acts::MeasurementSelector(m_cfg.measurementSelectorCfg)};
+  MeasurementPreSelector preSelector(measurements, m_cfg.preSelectionNSigma);
 
   using Extensions =
       Acts::CombinatorialKalmanFilterExtensions<Acts::VectorMultiTrajectory>;
 
-  BranchStopper branchStopper(m_cfg.trackSelectorCfg);
-
-  Extensions extensions;
-  extensions.calibrator.connect<&MeasurementCalibratorAdapter::calibrate>(
-      &calibrator);
-  extensions.updater.connect<
-      &Acts::GainMatrixUpdater::operator()<Acts::VectorMultiTrajectory>>(
-      &kfUpdater);
-  extensions.measurementSelector.connect<&MeasurementSelector::select>(
-      &measSel);
-  extensions.branchStopper.connect<&BranchStopper::operator()>(&branchStopper);
-
+  // Measurements of the found tracks, to stop the branches of other seeds
+  // running into them
+  BranchStopper::ClaimedMeasurements claimedMeasurements(
+      m_cfg.maxClaimedMeasurements > 0 ? sourceLinks.size() : 0);
+  BranchStopper branchStopper(m_cfg.trackSelectorCfg,
+                              m_cfg.maxClaimedMeasurements,
+                              &claimedMeasurements);
+
+  // Look up the source links of each surface in a table instead of
+  // searching all source links of the event
+  GeometryIdRangeTable<IndexSourceLink> slRanges(sourceLinks);
   IndexSourceLinkAccessor slAccessor;
   slAccessor.container = &sourceLinks;
+  slAccessor.ranges = &slRanges;
   Acts::SourceLinkAccessorDelegate<IndexSourceLinkAccessor::Iterator>
       slAccessorDelegate;
   slAccessorDelegate.connect<&IndexSourceLinkAccessor::range>(&slAccessor);
 
+  // Index the source links of each surface by their local position, to only
+  // calibrate the ones close to the predicted track
+  std::optional<IndexSourceLinkWindowAccessor> slWindowAccessor;
+  Acts::SourceLinkWindowDelegate<IndexSourceLinkAccessor::Iterator>
+      slWindowDelegate;
+  if (m_cfg.sourceLinkWindowNSigma > 0) {
+    slWindowAccessor.emplace(sourceLinks, measurements,
+                             m_cfg.sourceLinkWindowNSigma);
+    slAccessorDelegate.connect<&IndexSourceLinkWindowAccessor::range>(
+        &*slWindowAccessor);
+    slWindowDelegate.connect<&IndexSourceLinkWindowAccessor::window>(
+        &*slWindowAccessor);
+  }
+
   Acts::PropagatorPlainOptions firstPropOptions;
   firstPropOptions.maxSteps = m_cfg.maxSteps;
   firstPropOptions.direction = Acts::Direction::Forward;
@@ -330,16 +456,6 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   secondPropOptions.maxSteps = m_cfg.maxSteps;
   secondPropOptions.direction = firstPropOptions.direction.invert();
 
-  // Set the CombinatorialKalmanFilter options
-  TrackFindingAlgorithm::TrackFinderOptions firstOptions(
-      ctx.geoContext, ctx.magFieldContext, ctx.calibContext, slAccessorDelegate,
-      extensions, firstPropOptions);
-
-  TrackFindingAlgorithm::TrackFinderOptions secondOptions(
-      ctx.geoContext, ctx.magFieldContext, ctx.calibContext, slAccessorDelegate,
-      extensions, secondPropOptions);
-  secondOptions.targetSurface = pSurface.get();
-
   Acts::Propagator<Acts::EigenStepper<>, Acts::Navigator> extrapolator(
       Acts::EigenStepper<>(m_cfg.magneticField),
       Acts::Navigator({m_cfg.trackingGeometry},
@@ -357,222 +473,307 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
   auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
 
-  auto trackContainerTemp = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainerTemp =
-      std::make_shared<Acts::VectorMultiTrajectory>();
-
   TrackContainer tracks(trackContainer, trackStateContainer);
-  TrackContainer tracksTemp(trackContainerTemp, trackStateContainerTemp);
 
   tracks.addColumn<unsigned int>("trackGroup");
-  tracksTemp.addColumn<unsigned int>("trackGroup");
   Acts::ProxyAccessor<unsigned int> seedNumber("trackGroup");
 
-  unsigned int nSeed = 0;
-
-  // A map indicating whether a seed has been discovered already
-  std::unordered_map<SeedIdentifier, bool> discoveredSeeds;
-
-  auto addTrack = [&](const TrackProxy& track) {
-    ++m_nFoundTracks;
-
-    // flag seeds which are covered by the track
-    visitSeedIdentifiers(track, [&](const SeedIdentifier& seedIdentifier) {
-      if (auto it = discoveredSeeds.find(seedIdentifier);
-          it != discoveredSeeds.end()) {
-        it->second = true;
-      }
-    });
-
-    if (m_trackSelector.has_value() && !m_trackSelector->isValidTrack(track)) {
-      return;
+  // Find the tracks for a contiguous range of seeds and add them to the
+  // output container. The measurements, source links and the track finder
+  // are only read, the measurement selector and the temporary tracks are
+  // owned by the caller. Returns the number of seeds which were processed,
+  // which numbers the track groups from zero within the range.
+  auto findTracksForSeeds = [&](std::size_t begin, std::size_t end,
+                                TrackContainer& tracksTemp,
+                                TrackContainer& output) -> unsigned int {
+    MeasurementSelector measSel{
+        Acts::MeasurementSelector(m_cfg.measurementSelectorCfg)};
+
+    Extensions extensions;
+    extensions.calibrator.connect<&MeasurementCalibratorAdapter::calibrate>(
+        &calibrator);
+    extensions.updater.connect<
+        &Acts::GainMatrixUpdater::operator()<Acts::VectorMultiTrajectory>>(
+        &kfUpdater);
+    extensions.measurementSelector.connect<&MeasurementSelector::select>(
+        &measSel);
+    extensions.branchStopper.connect<&BranchStopper::operator()>(
+        &branchStopper);
+    if (m_cfg.preSelectionNSigma > 0) {
+      extensions.sourceLinkPreSelector
+          .connect<&MeasurementPreSelector::isCompatible>(&preSelector);
     }
 
-    ++m_nSelectedTracks;
+    // Set the CombinatorialKalmanFilter options
+    TrackFindingAlgorithm::TrackFinderOptions firstOptions(
+        ctx.geoContext, ctx.magFieldContext, ctx.calibContext,
+        slAccessorDelegate, extensions, firstPropOptions);
+    firstOptions.sourceLinkWindow = slWindowDelegate;
 
-    auto destProxy = tracks.makeTrack();
-    // make sure we copy track states!
-    destProxy.copyFrom(track, true);
-  };
+    TrackFindingAlgorithm::TrackFinderOptions secondOptions(
+        ctx.geoContext, ctx.magFieldContext, ctx.calibContext,
+        slAccessorDelegate, extensions, secondPropOptions);
+    secondOptions.sourceLinkWindow = slWindowDelegate;
+    secondOptions.targetSurface = pSurface.get();
 
-  if (seeds != nullptr && m_cfg.seedDeduplication) {
-    // Index the seeds for deduplication
-    for (const auto& seed : *seeds) {
-      SeedIdentifier seedIdentifier = makeSeedIdentifier(seed);
-      discoveredSeeds.emplace(seedIdentifier, false);
-    }
-  }
+    unsigned int nSeed = 0;
 
-  for (std::size_t iSeed = 0; iSeed < initialParameters.size(); ++iSeed) {
-    m_nTotalSeeds++;
+    // A map indicating whether a seed has been discovered already
+    std::unordered_map<SeedIdentifier, bool> discoveredSeeds;
 
-    if (seeds != nullptr) {
-      const SimSeed& seed = seeds->at(iSeed);
+    auto addTrack = [&](const TrackProxy& track) {
+      ++m_nFoundTracks;
 
-      if (m_cfg.seedDeduplication) {
-        SeedIdentifier seedIdentifier = makeSeedIdentifier(seed);
-        // check if the seed has been discovered already
+      // flag seeds which are covered by the track
+      visitSeedIdentifiers(track, [&](const SeedIdentifier& seedIdentifier) {
         if (auto it = discoveredSeeds.find(seedIdentifier);
-            it != discoveredSeeds.end() && it->second) {
-          m_nDeduplicatedSeeds++;
-          ACTS_VERBOSE("Skipping seed " << iSeed << " due to deduplication.");
-          continue;
+            it != discoveredSeeds.end()) {
+          it->second = true;
         }
-      }
+      });
 
-      if (m_cfg.stayOnSeed) {
-        measSel.setSeed(seed);
+      if (m_trackSelector.has_value() &&
+          !m_trackSelector->isValidTrack(track)) {
+        return;
       }
-    }
 
-    // Clear trackContainerTemp and trackStateContainerTemp
-    tracksTemp.clear();
+      ++m_nSelectedTracks;
 
-    const Acts::BoundTrackParameters& firstInitialParameters =
-        initialParameters.at(iSeed);
+      branchStopper.claimMeasurements(track);
 
-    auto firstResult =
-        (*m_cfg.findTracks)(firstInitialParameters, firstOptions, tracksTemp);
-    nSeed++;
+      auto destProxy = output.makeTrack();
+      // make sure we copy track states!
+      destProxy.copyFrom(track, true);
+    };
 
-    if (!firstResult.ok()) {
-      m_nFailedSeeds++;
-      ACTS_WARNING("Track finding failed for seed " << iSeed << " with error"
-                                                    << firstResult.error());
-      continue;
+    if (seeds != nullptr && m_cfg.seedDeduplication) {
+      // Index the seeds for deduplication
+      for (std::size_t iSeed = begin; iSeed < end; ++iSeed) {
+        SeedIdentifier seedIdentifier = makeSeedIdentifier(seeds->at(iSeed));
+        discoveredSeeds.emplace(seedIdentifier, false);
+      }
     }
 
-    auto& firstTracksForSeed = firstResult.value();
-    for (auto& firstTrack : firstTracksForSeed) {
-      // TODO a copy of the track should not be necessary but is the safest way
-      //      with the current EDM
-      // TODO a lightweight copy without copying all the track state components
-      //      might be a solution
-      auto trackCandidate = tracksTemp.makeTrack();
-      trackCandidate.copyFrom(firstTrack, true);
-
-      auto firstSmoothingResult =
-          Acts::smoothTrack(ctx.geoContext, trackCandidate, logger());
-      if (!firstSmoothingResult.ok()) {
-        m_nFailedSmoothing++;
-        ACTS_ERROR("First smoothing for seed "
-                   << iSeed << " and track " << firstTrack.index()
-                   << " failed with error " << firstSmoothingResult.error());
-        continue;
-      }
+    for (std::size_t iSeed = begin; iSeed < end; ++iSeed) {
+      m_nTotalSeeds++;
 
-      // number of second tracks found
-      std::size_t nSecond = 0;
-
-      // Set the seed number, this number decrease by 1 since the seed number
-      // has already been updated
-      seedNumber(trackCandidate) = nSeed - 1;
-
-      if (m_cfg.twoWay) {
-        std::optional<Acts::VectorMultiTrajectory::TrackStateProxy>
-            firstMeasurement;
-        for (auto trackState : trackCandidate.trackStatesReversed()) {
-          bool isMeasurement = trackState.typeFlags().test(
-              Acts::TrackStateFlag::MeasurementFlag);
-          bool isOutlier =
-              trackState.typeFlags().test(Acts::TrackStateFlag::OutlierFlag);
-          // We are excluding non measurement states and outlier here. Those can
-          // decrease resolution because only the smoothing corrected the very
-          // first prediction as filtering is not possible.
-          if (isMeasurement && !isOutlier) {
-            firstMeasurement = trackState;
+      if (seeds != nullptr) {
+        const SimSeed& seed = seeds->at(iSeed);
+
+        if (m_cfg.seedDeduplication) {
+          SeedIdentifier seedIdentifier = makeSeedIdentifier(seed);
+          // check if the seed has been discovered already
+          if (auto it = discoveredSeeds.find(seedIdentifier);
+              it != discoveredSeeds.end() && it->second) {
+            m_nDeduplicatedSeeds++;
+            ACTS_VERBOSE("Skipping seed " << iSeed << " due to deduplication.");
+            continue;
           }
         }
 
-        if (firstMeasurement.has_value()) {
-          Acts::BoundTrackParameters secondInitialParameters =
-              trackCandidate.createParametersFromState(*firstMeasurement);
-
-          auto secondResult = (*m_cfg.findTracks)(secondInitialParameters,
-                                                  secondOptions, tracksTemp);
-
-          if (!secondResult.ok()) {
-            ACTS_WARNING("Second track finding failed for seed "
-                         << iSeed << " with error" << secondResult.error());
-          } else {
-            auto firstState =
-                *std::next(trackCandidate.trackStatesReversed().begin(),
-                           trackCandidate.nTrackStates() - 1);
-            assert(firstState.previous() == Acts::kTrackIndexInvalid);
-
-            auto& secondTracksForSeed = secondResult.value();
-            for (auto& secondTrack : secondTracksForSeed) {
-              if (secondTrack.nTrackStates() < 2) {
-                continue;
-              }
+        if (m_cfg.stayOnSeed) {
+          measSel.setSeed(seed);
+        }
+      }
 
-              // TODO a copy of the track should not be necessary but is the
-              //      safest way with the current EDM
-              // TODO a lightweight copy without copying all the track state
-              //      components might be a solution
-              auto secondTrackCopy = tracksTemp.makeTrack();
-              secondTrackCopy.copyFrom(secondTrack, true);
+      // Clear trackContainerTemp and trackStateContainerTemp
+      tracksTemp.clear();
 
-              // Note that this is only valid if there are no branches
-              // We disallow this by breaking this look after a second track was
-              // processed
-              secondTrackCopy.reverseTrackStates(true);
+      const Acts::BoundTrackParameters& firstInitialParameters =
+          initialParameters.at(iSeed);
 
-              firstState.previous() =
-                  (*std::next(secondTrackCopy.trackStatesReversed().begin()))
-                      .index();
+      auto firstResult =
+          (*m_cfg.findTracks)(firstInitialParameters, firstOptions, tracksTemp);
+      nSeed++;
 
-              Acts::calculateTrackQuantities(trackCandidate);
+      if (!firstResult.ok()) {
+        m_nFailedSeeds++;
+        ACTS_WARNING("Track finding failed for seed " << iSeed << " with error"
+                                                      << firstResult.error());
+        continue;
+      }
 
-              // TODO This extrapolation should not be necessary
-              // TODO The CKF is targeting this surface and should communicate
-              //      the resulting parameters
-              // TODO Removing this requires changes in the core CKF
-              //      implementation
-              auto secondExtrapolationResult =
-                  Acts::extrapolateTrackToReferenceSurface(
-                      trackCandidate, *pSurface, extrapolator,
-                      extrapolationOptions, m_cfg.extrapolationStrategy,
-                      logger());
-              if (!secondExtrapolationResult.ok()) {
-                m_nFailedExtrapolation++;
-                ACTS_ERROR("Second extrapolation for seed "
-                           << iSeed << " and track " << secondTrack.index()
-                           << " failed with error "
-                           << secondExtrapolationResult.error());
-                continue;
-              }
+      auto& firstTracksForSeed = firstResult.value();
+      for (auto& firstTrack : firstTracksForSeed) {
+        // TODO a copy of the track should not be necessary but is the safest
+        //      way with the current EDM
+        // TODO a lightweight copy without copying all the track state
+        //      components might be a solution
+        auto trackCandidate = tracksTemp.makeTrack();
+        trackCandidate.copyFrom(firstTrack, true);
+
+        auto firstSmoothingResult =
+            Acts::smoothTrack(ctx.geoContext, trackCandidate, logger());
+        if (!firstSmoothingResult.ok()) {
+          m_nFailedSmoothing++;
+          ACTS_ERROR("First smoothing for seed "
+                     << iSeed << " and track " << firstTrack.index()
+                     << " failed with error " << firstSmoothingResult.error());
+          continue;
+        }
 
-              addTrack(trackCandidate);
+        // number of second tracks found
+        std::size_t nSecond = 0;
+
+        // Set the seed number, this number decrease by 1 since the seed number
+        // has already been updated
+        seedNumber(trackCandidate) = nSeed - 1;
+
+        if (m_cfg.twoWay) {
+          std::optional<Acts::VectorMultiTrajectory::TrackStateProxy>
+              firstMeasurement;
+          for (auto trackState : trackCandidate.trackStatesReversed()) {
+            bool isMeasurement = trackState.typeFlags().test(
+                Acts::TrackStateFlag::MeasurementFlag);
+            bool isOutlier =
+                trackState.typeFlags().test(Acts::TrackStateFlag::OutlierFlag);
+            // We are excluding non measurement states and outlier here. Those
+            // can decrease resolution because only the smoothing corrected the
+            // very first prediction as filtering is not possible.
+            if (isMeasurement && !isOutlier) {
+              firstMeasurement = trackState;
+            }
+          }
+
+          if (firstMeasurement.has_value()) {
+            Acts::BoundTrackParameters secondInitialParameters =
+                trackCandidate.createParametersFromState(*firstMeasurement);
+
+            auto secondResult = (*m_cfg.findTracks)(secondInitialParameters,
+                                                    secondOptions, tracksTemp);
+
+            if (!secondResult.ok()) {
+              ACTS_WARNING("Second track finding failed for seed "
+                           << iSeed << " with error" << secondResult.error());
+            } else {
+              auto firstState =
+                  *std::next(trackCandidate.trackStatesReversed().begin(),
+                             trackCandidate.nTrackStates() - 1);
+              assert(firstState.previous() == Acts::kTrackIndexInvalid);
+
+              auto& secondTracksForSeed = secondResult.value();
+              for (auto& secondTrack : secondTracksForSeed) {
+                if (secondTrack.nTrackStates() < 2) {
+                  continue;
+                }
+
+                // TODO a copy of the track should not be necessary but is the
+                //      safest way with the current EDM
+                // TODO a lightweight copy without copying all the track state
+                //      components might be a solution
+                auto secondTrackCopy = tracksTemp.makeTrack();
+                secondTrackCopy.copyFrom(secondTrack, true);
+
+                // Note that this is only valid if there are no branches
+                // We disallow this by breaking this look after a second track
+                // was processed
+                secondTrackCopy.reverseTrackStates(true);
+
+                firstState.previous() =
+                    (*std::next(secondTrackCopy.trackStatesReversed().begin()))
+                        .index();
+
+                Acts::calculateTrackQuantities(trackCandidate);
+
+                // TODO This extrapolation should not be necessary
+                // TODO The CKF is targeting this surface and should communicate
+                //      the resulting parameters
+                // TODO Removing this requires changes in the core CKF
+                //      implementation
+                auto secondExtrapolationResult =
+                    Acts::extrapolateTrackToReferenceSurface(
+                        trackCandidate, *pSurface, extrapolator,
+                        extrapolationOptions, m_cfg.extrapolationStrategy,
+                        logger());
+                if (!secondExtrapolationResult.ok()) {
+                  m_nFailedExtrapolation++;
+                  ACTS_ERROR("Second extrapolation for seed "
+                             << iSeed << " and track " << secondTrack.index()
+                             << " failed with error "
+                             << secondExtrapolationResult.error());
+                  continue;
+                }
+
+                addTrack(trackCandidate);
+
+                ++nSecond;
+              }
 
-              ++nSecond;
+              // restore `trackCandidate` to its original state in case we need
+              // it again
+              firstState.previous() = Acts::kTrackIndexInvalid;
+              Acts::calculateTrackQuantities(trackCandidate);
             }
+          }
+        }
 
-            // restore `trackCandidate` to its original state in case we need it
-            // again
-            firstState.previous() = Acts::kTrackIndexInvalid;
-            Acts::calculateTrackQuantities(trackCandidate);
+        // if no second track was found, we will use only the first track
+        if (nSecond == 0) {
+          auto firstExtrapolationResult =
+              Acts::extrapolateTrackToReferenceSurface(
+                  trackCandidate, *pSurface, extrapolator, extrapolationOptions,
+                  m_cfg.extrapolationStrategy, logger());
+          if (!firstExtrapolationResult.ok()) {
+            m_nFailedExtrapolation++;
+            ACTS_ERROR("Extrapolation for seed "
+                       << iSeed << " and track " << firstTrack.index()
+                       << " failed with error "
+                       << firstExtrapolationResult.error());
+            continue;
           }
+
+          addTrack(trackCandidate);
         }
       }
+    }
 
-      // if no second track was found, we will use only the first track
-      if (nSecond == 0) {
-        auto firstExtrapolationResult =
-            Acts::extrapolateTrackToReferenceSurface(
-                trackCandidate, *pSurface, extrapolator, extrapolationOptions,
-                m_cfg.extrapolationStrategy, logger());
-        if (!firstExtrapolationResult.ok()) {
-          m_nFailedExtrapolation++;
-          ACTS_ERROR("Extrapolation for seed "
-                     << iSeed << " and track " << firstTrack.index()
-                     << " failed with error "
-                     << firstExtrapolationResult.error());
-          continue;
-        }
+    return nSeed;
+  };
 
-        addTrack(trackCandidate);
+  if (m_cfg.seedsPerTask == 0) {
+    TrackContainer tracksTemp(std::make_shared<Acts::VectorTrackContainer>(),
+                              std::make_shared<Acts::VectorMultiTrajectory>());
+    tracksTemp.addColumn<unsigned int>("trackGroup");
+
+    findTracksForSeeds(0, initialParameters.size(), tracksTemp, tracks);
+  } else {
+    // Every task processes a contiguous range of seeds into its own
+    // workspace. The workspaces are merged in task order afterwards, such
+    // that the output does not depend on the scheduling.
+    const std::size_t nTasks =
+        (initialParameters.size() + m_cfg.seedsPerTask - 1) /
+        m_cfg.seedsPerTask;
+    std::vector<std::unique_ptr<FindWorkspace>> taskWorkspaces(nTasks);
+    std::vector<unsigned int> taskSeeds(nTasks, 0);
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nTasks),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t itask = range.begin(); itask != range.end();
+               ++itask) {
+            auto workspace = acquireWorkspace();
+            const std::size_t begin = itask * m_cfg.seedsPerTask;
+            const std::size_t end = std::min(begin + m_cfg.seedsPerTask,
+                                             initialParameters.size());
+            taskSeeds[itask] = findTracksForSeeds(
+                begin, end, workspace->tracksTemp, workspace->tracks);
+            taskWorkspaces[itask] = std::move(workspace);
+          }
+        });
+
+    // The track groups continue the numbering of the previous tasks
+    unsigned int groupOffset = 0;
+    for (std::size_t itask = 0; itask < nTasks; ++itask) {
+      auto& workspace = taskWorkspaces[itask];
+      const auto stateOffset = trackStateContainer->append(
+          workspace->tracks.trackStateContainer());
+      const auto trackOffset =
+          trackContainer->append(workspace->tracks.container(), stateOffset);
+      for (auto itrack = trackOffset; itrack < tracks.size(); ++itrack) {
+        seedNumber(tracks.getTrack(itrack)) += groupOffset;
       }
+      groupOffset += taskSeeds[itask];
+      releaseWorkspace(std::move(workspace));
     }
   }
 
@@ -585,6 +786,7 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
                                              << " track candidates.");
 
   m_nStoppedBranches += branchStopper.m_nStoppedBranches;
+  m_nDuplicateBranches += branchStopper.m_nDuplicateBranches;
 
   m_memoryStatistics.local().hist +=
       tracks.trackStateContainer().statistics().hist;
@@ -603,6 +805,26 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   return ProcessCode::SUCCESS;
 }
 
+std::unique_ptr<TrackFindingAlgorithm::FindWorkspace>
+TrackFindingAlgorithm::acquireWorkspace() const {
+  std::lock_guard<std::mutex> lock(m_workspaceMutex);
+  if (m_workspaces.empty()) {
+    return std::make_unique<FindWorkspace>();
+  }
+  auto workspace = std::move(m_workspaces.back());
+  m_workspaces.pop_back();
+  return workspace;
+}
+
+void TrackFindingAlgorithm::releaseWorkspace(
+    std::unique_ptr<FindWorkspace> workspace) const {
+  // keep the allocated storage for the next event
+  workspace->tracks.clear();
+  workspace->tracksTemp.clear();
+  std::lock_guard<std::mutex> lock(m_workspaceMutex);
+  m_workspaces.push_back(std::move(workspace));
+}
+
 ProcessCode TrackFindingAlgorithm::finalize() {
   ACTS_INFO("TrackFindingAlgorithm statistics:");
   ACTS_INFO("- total seeds: " << m_nTotalSeeds);
@@ -615,6 +837,7 @@ ProcessCode TrackFindingAlgorithm::finalize() {
   ACTS_INFO("- found tracks: " << m_nFoundTracks);
   ACTS_INFO("- selected tracks: " << m_nSelectedTracks);
   ACTS_INFO("- stopped branches: " << m_nStoppedBranches);
+  ACTS_INFO("- duplicate branches: " << m_nDuplicateBranches);
 
   auto memoryStatistics =
       m_memoryStatistics.combine([](const auto& a, const auto& b) {
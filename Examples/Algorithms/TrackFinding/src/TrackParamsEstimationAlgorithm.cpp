@@ -122,49 +122,50 @@ ActsExamples::ProcessCode ActsExamples::TrackParamsEstimationAlgorithm::execute(
 
   IndexSourceLink::SurfaceAccessor surfaceAccessor{*m_cfg.trackingGeometry};
 
-  // Loop over all found seeds to estimate track parameters
+  // Get the reference surfaces of the bottom space points
+  std::vector<const Acts::Surface*> surfaces(seeds.size(), nullptr);
   for (std::size_t iseed = 0; iseed < seeds.size(); ++iseed) {
-    const auto& seed = seeds[iseed];
-    // Get the bottom space point and its reference surface
-    const auto bottomSP = seed.sp().front();
+    const auto bottomSP = seeds[iseed].sp().front();
     if (bottomSP->sourceLinks().empty()) {
       ACTS_WARNING("Missing source link in the space point")
       continue;
     }
     const auto& sourceLink = bottomSP->sourceLinks()[0];
-    const Acts::Surface* surface = surfaceAccessor(sourceLink);
+    surfaces[iseed] = surfaceAccessor(sourceLink);
 
-    if (surface == nullptr) {
+    if (surfaces[iseed] == nullptr) {
       ACTS_WARNING(
           "Surface from source link is not found in the tracking geometry");
-      continue;
     }
+  }
 
-    // Get the magnetic field at the bottom space point
-    auto fieldRes = m_cfg.magneticField->getField(
-        {bottomSP->x(), bottomSP->y(), bottomSP->z()}, bCache);
-    if (!fieldRes.ok()) {
-      ACTS_ERROR("Field lookup error: " << fieldRes.error());
-      return ProcessCode::ABORT;
-    }
-    Acts::Vector3 field = *fieldRes;
+  // Estimate the track parameters of all seeds in one go
+  Acts::SeedTrackParamsBatch batch;
+  auto batchRes = Acts::estimateTrackParamsFromSeeds(
+      ctx.geoContext, seeds, surfaces, *m_cfg.magneticField, bCache,
+      m_cfg.bFieldMin, batch, logger());
+  if (!batchRes.ok()) {
+    return ProcessCode::ABORT;
+  }
 
-    // Estimate the track parameters from seed
-    auto optParams = Acts::estimateTrackParamsFromSeed(
-        ctx.geoContext, seed.sp().begin(), seed.sp().end(), *surface, field,
-        m_cfg.bFieldMin, logger());
-    if (!optParams.has_value()) {
+  // Collect the results in the order of the input seeds
+  for (std::size_t iseed = 0; iseed < seeds.size(); ++iseed) {
+    if (surfaces[iseed] == nullptr) {
+      continue;
+    }
+    if (!batch.valid[iseed]) {
       ACTS_WARNING("Estimation of track parameters for seed " << iseed
                                                               << " failed.");
       continue;
     }
 
-    const auto& params = optParams.value();
+    const auto& seed = seeds[iseed];
+    const auto& params = batch.params[iseed];
 
     Acts::BoundSquareMatrix cov =
-        makeInitialCovariance(m_cfg, params, *bottomSP);
+        makeInitialCovariance(m_cfg, params, *seed.sp().front());
 
-    trackParameters.emplace_back(surface->getSharedPtr(), params, cov,
+    trackParameters.emplace_back(surfaces[iseed]->getSharedPtr(), params, cov,
                                  m_cfg.particleHypothesis);
     if (m_outputSeeds.isInitialized()) {
       outputSeeds.push_back(seed);
@@ -20,6 +20,8 @@
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 
+#include <condition_variable>
+#include <cstddef>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -77,6 +79,15 @@ class TrackFindingAlgorithmExaTrkX final : public IAlgorithm {
     /// Target graph properties
     std::size_t targetMinHits = 3;
     double targetMinPT = 500 * Acts::UnitConstants::MeV;
+
+    /// Maximum number of events that run the pipeline concurrently. Each of
+    /// them uses its own CUDA stream, so e.g. the graph construction of one
+    /// event can overlap with the classification of another.
+    std::size_t maxConcurrentEvents = 1;
+
+    /// GPUs to distribute the events over. Every event runs on the device
+    /// with the fewest events in flight. Empty uses the current device.
+    std::vector<int> devices = {};
   };
 
   /// Constructor of the track finding algorithm
@@ -104,6 +115,9 @@ class TrackFindingAlgorithmExaTrkX final : public IAlgorithm {
 
   Acts::ExaTrkXPipeline m_pipeline;
   mutable std::mutex m_mutex;
+  mutable std::condition_variable m_slotFreed;
+  mutable std::size_t m_activeEvents = 0;
+  mutable std::vector<std::size_t> m_deviceEvents;
 
   using Accumulator = boost::accumulators::accumulator_set<
       float, boost::accumulators::features<boost::accumulators::tag::mean,
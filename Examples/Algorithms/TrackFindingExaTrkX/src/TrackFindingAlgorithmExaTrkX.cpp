@@ -18,6 +18,8 @@
 #include "ActsExamples/EventData/SimSpacePoint.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <numeric>
 
 using namespace ActsExamples;
@@ -133,6 +135,14 @@ ActsExamples::TrackFindingAlgorithmExaTrkX::TrackFindingAlgorithmExaTrkX(
   if (m_cfg.outputProtoTracks.empty()) {
     throw std::invalid_argument("Missing protoTrack output collection");
   }
+  if (m_cfg.maxConcurrentEvents == 0) {
+    throw std::invalid_argument("At least one concurrent event is required");
+  }
+  if (std::any_of(m_cfg.devices.begin(), m_cfg.devices.end(),
+                  [](int d) { return d < 0; })) {
+    throw std::invalid_argument("Invalid device ID");
+  }
+  m_deviceEvents.resize(m_cfg.devices.size(), 0);
 
   // Sanitizer run with dummy input to detect configuration issues
   // TODO This would be quite helpful I think, but currently it does not work
@@ -250,12 +260,47 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithmExaTrkX::execute(
 
   // Run the pipeline
   const auto trackCandidates = [&]() {
-    const int deviceHint = -1;
-    std::lock_guard<std::mutex> lock(m_mutex);
+    int deviceHint = -1;
+    std::size_t deviceIdx = 0;
+
+    // Wait for a free pipeline slot, and pick the least busy device
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_slotFreed.wait(lock, [&] {
+        return m_activeEvents < m_cfg.maxConcurrentEvents;
+      });
+      ++m_activeEvents;
+      if (!m_cfg.devices.empty()) {
+        deviceIdx = std::distance(
+            m_deviceEvents.begin(),
+            std::min_element(m_deviceEvents.begin(), m_deviceEvents.end()));
+        ++m_deviceEvents[deviceIdx];
+        deviceHint = m_cfg.devices[deviceIdx];
+      }
+    }
+    ACTS_DEBUG("Run pipeline on device " << deviceHint);
+
+    // Must be called with the mutex locked
+    auto releaseSlot = [&]() {
+      --m_activeEvents;
+      if (!m_cfg.devices.empty()) {
+        --m_deviceEvents[deviceIdx];
+      }
+      m_slotFreed.notify_one();
+    };
 
     Acts::ExaTrkXTiming timing;
-    auto res =
-        m_pipeline.run(features, spacepointIDs, deviceHint, *hook, &timing);
+    std::vector<std::vector<int>> res;
+    try {
+      res = m_pipeline.run(features, spacepointIDs, deviceHint, *hook, &timing);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      releaseSlot();
+      throw;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    releaseSlot();
 
     m_timing.graphBuildingTime(timing.graphBuildingTime.count());
 
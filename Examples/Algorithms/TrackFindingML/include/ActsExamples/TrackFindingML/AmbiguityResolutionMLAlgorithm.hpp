@@ -34,6 +34,8 @@ class AmbiguityResolutionMLAlgorithm final : public AmbiguityResolutionML {
     std::string outputTracks;
     /// Minimum number of measurement to form a track.
     int nMeasurementsMin = 7;
+    /// Run the network with the CUDA execution provider.
+    bool useCuda = false;
   };
 
   /// Construct the ambiguity resolution algorithm.
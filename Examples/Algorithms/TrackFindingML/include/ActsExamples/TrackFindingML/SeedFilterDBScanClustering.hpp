@@ -8,10 +8,14 @@
 
 #pragma once
 
-#include "Acts/Utilities/DBScan.hpp"
-
-#include <map>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Acts {
@@ -19,27 +23,177 @@ namespace Acts {
 /// Clusters seed based on their direction, their Z impact parameter and their
 /// momentum using DBScan
 ///
+/// The neighbours are searched on a grid of cells, such that only the adjacent
+/// cells need to be looked at. The clusters are expanded in the same way as by
+/// @c Acts::DBScan, without recursion, and seeds that do not belong to any
+/// cluster form their own one seed cluster.
+///
 /// @param input Input parameters for the clustering (phi, eta, z, Pt)
 /// @param epsilon Maximum distance between 2 seed to be clustered
 /// @param minPoints Minimum number of seeds to create a cluster
-/// @return an unordered map representing the clusters, the keys the ID of the primary seed of each cluster and the stored value a vector of seed IDs.
-std::vector<std::vector<std::size_t>> dbscanSeedClustering(
+/// @return a vector of clusters, each of them a vector of seed IDs
+inline std::vector<std::vector<std::size_t>> dbscanSeedClustering(
     const std::vector<std::array<double, 4>>& input, float epsilon = 0.03,
     int minPoints = 2) {
-  // Initialize a DBScan of dimension 4 (phi, eta, z, Pt)
-  using DBSCAN = Acts::DBScan<4, double, 4>;
-  DBSCAN dbscan(epsilon, minPoints, true);
+  using Cell = std::array<std::int64_t, 4>;
+  struct CellHash {
+    std::size_t operator()(const Cell& cell) const {
+      std::size_t hash = 0;
+      for (auto c : cell) {
+        hash = hash * 0x9E3779B97F4A7C15ull + std::hash<std::int64_t>{}(c);
+      }
+      return hash;
+    }
+  };
+
+  const std::size_t nPoints = input.size();
+  const double eps2 = static_cast<double>(epsilon) * epsilon;
+
+  // Sort the seeds by cell, every cell is a contiguous range. With cells of
+  // twice epsilon only the neighbouring cell on the closer side needs to be
+  // looked at in every dimension.
+  const double cellSize = 2. * epsilon;
+  std::vector<Cell> cells(nPoints);
+  for (std::size_t i = 0; i < nPoints; ++i) {
+    for (std::size_t d = 0; d < 4; ++d) {
+      cells[i][d] =
+          static_cast<std::int64_t>(std::floor(input[i][d] / cellSize));
+    }
+  }
+  std::vector<std::size_t> sorted(nPoints);
+  for (std::size_t i = 0; i < nPoints; ++i) {
+    sorted[i] = i;
+  }
+  std::sort(sorted.begin(), sorted.end(), [&](std::size_t a, std::size_t b) {
+    return cells[a] < cells[b];
+  });
+  std::unordered_map<Cell, std::pair<std::size_t, std::size_t>, CellHash>
+      cellRanges;
+  cellRanges.reserve(nPoints);
+  for (std::size_t begin = 0; begin < nPoints;) {
+    std::size_t end = begin + 1;
+    while (end < nPoints && cells[sorted[end]] == cells[sorted[begin]]) {
+      ++end;
+    }
+    cellRanges.emplace(cells[sorted[begin]], std::make_pair(begin, end));
+    begin = end;
+  }
 
-  // Cluster track with DBScan
-  std::vector<int> clusterAssignments;
-  std::size_t clusterNb = dbscan.cluster(input, clusterAssignments);
+  // All seeds within epsilon, including the seed itself, in ID order
+  auto findNeighbours = [&](std::size_t id, std::vector<std::size_t>& out) {
+    out.clear();
+    const auto& point = input[id];
+    std::array<int, 4> side{};
+    std::array<double, 4> gap2{};
+    for (std::size_t d = 0; d < 4; ++d) {
+      const double lower = point[d] - cells[id][d] * cellSize;
+      side[d] = lower < epsilon ? -1 : 1;
+      const double gap = side[d] < 0 ? lower : cellSize - lower;
+      gap2[d] = gap * gap;
+    }
+    for (int offset = 0; offset < 16; ++offset) {
+      Cell cell = cells[id];
+      double minDistance = 0;
+      for (std::size_t d = 0; d < 4; ++d) {
+        if ((offset >> d) & 1) {
+          cell[d] += side[d];
+          minDistance += gap2[d];
+        }
+      }
+      if (minDistance > eps2) {
+        continue;
+      }
+      auto it = cellRanges.find(cell);
+      if (it == cellRanges.end()) {
+        continue;
+      }
+      for (std::size_t k = it->second.first; k < it->second.second; ++k) {
+        const std::size_t other = sorted[k];
+        double distance = 0;
+        for (std::size_t d = 0; d < 4; ++d) {
+          const double delta = input[other][d] - point[d];
+          distance += delta * delta;
+        }
+        if (distance <= eps2) {
+          out.push_back(other);
+        }
+      }
+    }
+    std::sort(out.begin(), out.end());
+  };
+
+  std::vector<int> clusterAssignments(nPoints, -1);
+  auto assignUnassigned = [&](std::vector<std::size_t>& neighbours,
+                              int clusterID) {
+    neighbours.erase(std::remove_if(neighbours.begin(), neighbours.end(),
+                                    [&](std::size_t n) {
+                                      return clusterAssignments[n] != -1;
+                                    }),
+                     neighbours.end());
+    for (auto n : neighbours) {
+      clusterAssignments[n] = clusterID;
+    }
+  };
+
+  // Stack of the seeds still to be processed, replacing the recursion. The
+  // seeds of all frames are kept in a single buffer, the ones of the top
+  // frame at its end.
+  struct Frame {
+    std::size_t begin = 0;
+    std::size_t next = 0;
+  };
+  std::vector<Frame> stack;
+  std::vector<std::size_t> pending;
+  std::vector<std::size_t> neighbours;
+
+  int clusterNb = 0;
+  for (std::size_t seed = 0; seed < nPoints; ++seed) {
+    if (clusterAssignments[seed] != -1) {
+      continue;
+    }
+    pending.assign(1, seed);
+    stack.push_back(Frame{0, 0});
+    while (!stack.empty()) {
+      Frame& frame = stack.back();
+      if (frame.begin + frame.next == pending.size()) {
+        pending.resize(frame.begin);
+        stack.pop_back();
+        continue;
+      }
+      const std::size_t id = pending[frame.begin + frame.next++];
+
+      findNeighbours(id, neighbours);
+      const std::size_t nNeighbours = neighbours.size();
+      // If a cluster has already been started we add the neighbours to it
+      if (clusterAssignments[id] != -1) {
+        assignUnassigned(neighbours, clusterNb);
+      }
+      if (nNeighbours >= static_cast<std::size_t>(minPoints)) {
+        if (clusterAssignments[id] == -1) {
+          clusterAssignments[id] = clusterNb;
+          assignUnassigned(neighbours, clusterNb);
+        }
+        // Continue with the newly assigned neighbours
+        stack.push_back(Frame{pending.size(), 0});
+        pending.insert(pending.end(), neighbours.begin(), neighbours.end());
+      }
+    }
+    if (clusterAssignments[seed] != -1) {
+      ++clusterNb;
+    }
+  }
+  // The remaining seeds are their own one seed clusters
+  for (auto& clusterID : clusterAssignments) {
+    if (clusterID == -1) {
+      clusterID = clusterNb++;
+    }
+  }
 
   // Prepare the output
   std::vector<std::vector<std::size_t>> cluster(clusterNb,
                                                 std::vector<std::size_t>());
-  for (std::size_t iD = 0; iD < input.size(); iD++) {
-    int clusterID = clusterAssignments[iD];
-    cluster[clusterID].push_back(iD);
+  for (std::size_t iD = 0; iD < nPoints; iD++) {
+    cluster[clusterAssignments[iD]].push_back(iD);
   }
 
   return cluster;
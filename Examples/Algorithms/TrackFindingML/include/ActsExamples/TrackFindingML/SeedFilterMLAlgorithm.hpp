@@ -14,7 +14,10 @@
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/TrackFindingML/AmbiguityResolutionML.hpp"
 
+#include <array>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -51,6 +54,9 @@ class SeedFilterMLAlgorithm : public IAlgorithm {
     double clusteringWeighZ = 50.0;
     /// Clustering parameters weight for pT used before the DBSCAN
     double clusteringWeighPt = 1.0;
+    /// Largest number of events whose seeds are scored in one network
+    /// inference, if the sequencer runs the events in batches
+    std::size_t maxBatchSize = 1;
   };
 
   /// Construct the seed filter algorithm.
@@ -65,10 +71,40 @@ class SeedFilterMLAlgorithm : public IAlgorithm {
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const final;
 
+  /// Run the seed filter algorithm for a batch of events.
+  ///
+  /// The seeds of all events are scored in a single network inference, the
+  /// clustering and the selection are done per event. The output is the same
+  /// as when executing the events one by one.
+  ///
+  /// @param contexts are the algorithm contexts of the events
+  /// @return a process code indication success or failure
+  ProcessCode executeBatch(
+      const std::vector<AlgorithmContext>& contexts) const final;
+
+  /// The largest number of events processed in one batch
+  std::size_t maxBatchSize() const final { return m_cfg.maxBatchSize; }
+
   /// Const access to the config
   const Config& config() const { return m_cfg; }
 
  private:
+  using ClusteringParameters = std::vector<std::array<double, 4>>;
+
+  /// Fill the network inputs of the seeds of one event into consecutive rows
+  /// starting at @p firstRow and return their clustering parameters
+  ClusteringParameters fillInputs(const SimSeedContainer& seeds,
+                                  const TrackParametersContainer& params,
+                                  Acts::NetworkBatchInput& networkInput,
+                                  std::size_t firstRow) const;
+
+  /// Cluster the seeds of one event, select the best scored seed of every
+  /// cluster and write the selected seeds and parameters
+  void selectSeeds(const AlgorithmContext& ctx, const SimSeedContainer& seeds,
+                   const TrackParametersContainer& params,
+                   const ClusteringParameters& clusteringParams,
+                   std::vector<std::vector<float>>& scores) const;
+
   Config m_cfg;
   // ONNX model for track selection
   Acts::SeedClassifier m_seedClassifier;
@@ -19,7 +19,7 @@ ActsExamples::AmbiguityResolutionMLAlgorithm::AmbiguityResolutionMLAlgorithm(
     : ActsExamples::AmbiguityResolutionML("AmbiguityResolutionMLAlgorithm",
                                           lvl),
       m_cfg(std::move(cfg)),
-      m_duplicateClassifier(m_cfg.inputDuplicateNN.c_str()) {
+      m_duplicateClassifier(m_cfg.inputDuplicateNN.c_str(), m_cfg.useCuda) {
   if (m_cfg.inputTracks.empty()) {
     throw std::invalid_argument("Missing trajectories input collection");
   }
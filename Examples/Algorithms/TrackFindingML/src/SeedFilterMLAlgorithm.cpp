@@ -12,8 +12,11 @@
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/TrackFindingML/SeedFilterDBScanClustering.hpp"
 
+#include <cmath>
 #include <iterator>
 #include <map>
+#include <stdexcept>
+#include <utility>
 
 ActsExamples::SeedFilterMLAlgorithm::SeedFilterMLAlgorithm(
     ActsExamples::SeedFilterMLAlgorithm::Config cfg, Acts::Logging::Level lvl)
@@ -48,9 +51,68 @@ ActsExamples::ProcessCode ActsExamples::SeedFilterMLAlgorithm::execute(
         "The number of seeds and track parameters is different");
   }
 
-  Eigen::Array<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
-      networkInput(seeds.size(), 14);
-  std::vector<std::array<double, 4>> clusteringParams;
+  Acts::NetworkBatchInput networkInput(seeds.size(), 14);
+  ClusteringParameters clusteringParams =
+      fillInputs(seeds, params, networkInput, 0);
+
+  // Use the network to compute a score for all the seeds
+  std::vector<std::vector<float>> scores =
+      m_seedClassifier.inferScores(networkInput);
+
+  selectSeeds(ctx, seeds, params, clusteringParams, scores);
+  return ActsExamples::ProcessCode::SUCCESS;
+}
+
+ActsExamples::ProcessCode ActsExamples::SeedFilterMLAlgorithm::executeBatch(
+    const std::vector<AlgorithmContext>& contexts) const {
+  // Read input data of all events
+  std::vector<const SimSeedContainer*> eventSeeds;
+  std::vector<const TrackParametersContainer*> eventParams;
+  std::vector<std::size_t> firstRows;
+  std::size_t nSeeds = 0;
+  for (const AlgorithmContext& ctx : contexts) {
+    const auto& seeds = m_inputSimSeeds(ctx);
+    const auto& params = m_inputTrackParameters(ctx);
+    if (seeds.size() != params.size()) {
+      throw std::invalid_argument(
+          "The number of seeds and track parameters is different");
+    }
+    eventSeeds.push_back(&seeds);
+    eventParams.push_back(&params);
+    firstRows.push_back(nSeeds);
+    nSeeds += seeds.size();
+  }
+
+  // The seeds of the events are stacked into one network input
+  Acts::NetworkBatchInput networkInput(nSeeds, 14);
+  std::vector<ClusteringParameters> clusteringParams;
+  clusteringParams.reserve(contexts.size());
+  for (std::size_t i = 0; i < contexts.size(); ++i) {
+    clusteringParams.push_back(fillInputs(*eventSeeds[i], *eventParams[i],
+                                          networkInput, firstRows[i]));
+  }
+
+  // Use the network to compute a score for the seeds of all events at once
+  std::vector<std::vector<float>> scores =
+      m_seedClassifier.inferScores(networkInput);
+
+  for (std::size_t i = 0; i < contexts.size(); ++i) {
+    auto first = scores.begin() + firstRows[i];
+    std::vector<std::vector<float>> eventScores(
+        std::make_move_iterator(first),
+        std::make_move_iterator(first + eventSeeds[i]->size()));
+    selectSeeds(contexts[i], *eventSeeds[i], *eventParams[i],
+                clusteringParams[i], eventScores);
+  }
+  return ActsExamples::ProcessCode::SUCCESS;
+}
+
+ActsExamples::SeedFilterMLAlgorithm::ClusteringParameters
+ActsExamples::SeedFilterMLAlgorithm::fillInputs(
+    const SimSeedContainer& seeds, const TrackParametersContainer& params,
+    Acts::NetworkBatchInput& networkInput, std::size_t firstRow) const {
+  ClusteringParameters clusteringParams;
+  clusteringParams.reserve(seeds.size());
   // Loop over the seed and parameters to fill the input for the clustering
   // and the NN
   for (std::size_t i = 0; i < seeds.size(); i++) {
@@ -67,20 +129,27 @@ ActsExamples::ProcessCode ActsExamples::SeedFilterMLAlgorithm::execute(
          seeds[i].z() / m_cfg.clusteringWeighZ, pT / m_cfg.clusteringWeighPt});
 
     // Fill the NN input
-    networkInput.row(i) << pT, eta, phi, seeds[i].sp()[0]->x(),
+    networkInput.row(firstRow + i) << pT, eta, phi, seeds[i].sp()[0]->x(),
         seeds[i].sp()[0]->y(), seeds[i].sp()[0]->z(), seeds[i].sp()[1]->x(),
         seeds[i].sp()[1]->y(), seeds[i].sp()[1]->z(), seeds[i].sp()[2]->x(),
         seeds[i].sp()[2]->y(), seeds[i].sp()[2]->z(), seeds[i].z(),
         seeds[i].seedQuality();
   }
+  return clusteringParams;
+}
 
+void ActsExamples::SeedFilterMLAlgorithm::selectSeeds(
+    const AlgorithmContext& ctx, const SimSeedContainer& seeds,
+    const TrackParametersContainer& params,
+    const ClusteringParameters& clusteringParams,
+    std::vector<std::vector<float>>& scores) const {
   // Cluster the tracks using DBscan
   auto cluster = Acts::dbscanSeedClustering(
       clusteringParams, m_cfg.epsilonDBScan, m_cfg.minPointsDBScan);
 
   // Select the ID of the track we want to keep
-  std::vector<std::size_t> goodSeed = m_seedClassifier.solveAmbiguity(
-      cluster, networkInput, m_cfg.minSeedScore);
+  std::vector<std::size_t> goodSeed =
+      m_seedClassifier.seedSelection(cluster, scores, m_cfg.minSeedScore);
 
   // Create the output seed collection
   SimSeedContainer outputSeeds;
@@ -95,8 +164,6 @@ ActsExamples::ProcessCode ActsExamples::SeedFilterMLAlgorithm::execute(
     outputTrackParameters.push_back(params[i]);
   }
 
-  m_outputSimSeeds(ctx, SimSeedContainer{outputSeeds});
-  m_outputTrackParameters(ctx, TrackParametersContainer{outputTrackParameters});
-
-  return ActsExamples::ProcessCode::SUCCESS;
+  m_outputSimSeeds(ctx, std::move(outputSeeds));
+  m_outputTrackParameters(ctx, std::move(outputTrackParameters));
 }
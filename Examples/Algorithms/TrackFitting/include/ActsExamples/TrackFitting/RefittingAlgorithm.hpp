@@ -8,15 +8,32 @@
 
 #pragma once
 
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MaterialInteractor.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/TrackHelpers.hpp"
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/TrackFitting/RefittingCalibrator.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
+
+namespace Acts {
+class MagneticFieldProvider;
+class TrackingGeometry;
+}  // namespace Acts
 
 namespace ActsExamples {
 class TrackFitterFunction;
@@ -33,6 +50,21 @@ class RefittingAlgorithm final : public IAlgorithm {
     std::shared_ptr<TrackFitterFunction> fit;
     /// Pick a single track for debugging (-1 process all tracks)
     int pickTrack = -1;
+
+    /// Only refit the part of a track after its first modified state, see
+    /// `RefittingCalibrator::isModified`. Unmodified tracks are copied. The
+    /// earlier states are kept, the forward filtering resumes from the last
+    /// of them and the whole track is smoothed again.
+    bool incremental = false;
+    /// The tracking geometry used to extrapolate incrementally refitted
+    /// tracks to their reference surface.
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry;
+    /// The magnetic field used to extrapolate incrementally refitted tracks
+    /// to their reference surface.
+    std::shared_ptr<const Acts::MagneticFieldProvider> magneticField;
+    /// Extrapolation strategy for incrementally refitted tracks
+    Acts::TrackExtrapolationStrategy extrapolationStrategy =
+        Acts::TrackExtrapolationStrategy::firstOrLast;
   };
 
   /// Constructor of the fitting algorithm
@@ -51,6 +83,34 @@ class RefittingAlgorithm final : public IAlgorithm {
   const Config& config() const { return m_cfg; }
 
  private:
+  using Extrapolator = Acts::Propagator<Acts::EigenStepper<>, Acts::Navigator>;
+  using ExtrapolatorOptions =
+      Acts::PropagatorOptions<Acts::ActionList<Acts::MaterialInteractor>,
+                              Acts::AbortList<Acts::EndOfWorldReached>>;
+
+  /// Refit a track from one of its states on, keeping the earlier ones
+  ///
+  /// @param ctx is the algorithm context
+  /// @param track is the input track
+  /// @param inputStates are the states of the input track in forward order
+  /// @param resume is the index of the last state to keep
+  /// @param calibrator is the calibrator for the refitted states
+  /// @param extrapolator is used to reach the reference surface
+  /// @param extrapolationOptions are the options for the extrapolation
+  /// @param tracksTemp is the scratch container of the refitted track
+  /// @param refittedStates is scratch space for the refitted states
+  /// @return the refitted track in @p tracksTemp
+  Acts::Result<TrackContainer::TrackProxy> refitFrom(
+      const AlgorithmContext& ctx,
+      const ConstTrackContainer::ConstTrackProxy& track,
+      const std::vector<RefittingCalibrator::ConstProxy>&
+          inputStates,
+      std::size_t resume, const RefittingCalibrator& calibrator,
+      const Extrapolator& extrapolator,
+      const ExtrapolatorOptions& extrapolationOptions,
+      TrackContainer& tracksTemp,
+      std::vector<RefittingCalibrator::Proxy>& refittedStates) const;
+
   Config m_cfg;
 
   ReadDataHandle<ConstTrackContainer> m_inputTracks{this, "InputTracks"};
@@ -15,6 +15,7 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/HashedString.hpp"
 
 namespace Acts {
 class ConstVectorMultiTrajectory;
@@ -35,9 +36,25 @@ struct RefittingCalibrator {
     }
   };
 
+  /// Key of the optional boolean track state column that marks the states
+  /// whose calibration changed since the track was fitted. It has to be
+  /// added to the container as "refitModified" before the states are created.
+  static constexpr Acts::HashedString kModifiedKey =
+      Acts::hashString("refitModified");
+
   void calibrate(const Acts::GeometryContext& gctx,
                  const Acts::CalibrationContext& cctx,
                  const Acts::SourceLink& sourceLink, Proxy trackState) const;
+
+  /// Mark a track state as modified, such that an incremental refit has to
+  /// filter it again
+  /// @param trackState The track state to mark
+  static void markModified(Proxy trackState);
+
+  /// Check if a track state was marked as modified
+  /// @param trackState The track state to check
+  /// @return false if the container has no modification column
+  static bool isModified(const ConstProxy& trackState);
 };
 
 }  // namespace ActsExamples
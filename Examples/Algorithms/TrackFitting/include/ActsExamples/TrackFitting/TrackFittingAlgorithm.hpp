@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/EventData/SourceLink.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/EventData/Cluster.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
@@ -19,8 +20,11 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace Acts {
 class TrackingGeometry;
@@ -52,6 +56,9 @@ class TrackFittingAlgorithm final : public IAlgorithm {
     int pickTrack = -1;
     // Type erased calibrator for the measurements
     std::shared_ptr<MeasurementCalibrator> calibrator;
+    /// Number of tracks fitted by one task when distributing the tracks of
+    /// an event over the worker threads. Zero fits all tracks in sequence.
+    std::size_t tracksPerTask = 0;
   };
 
   /// Constructor of the fitting algorithm
@@ -70,8 +77,22 @@ class TrackFittingAlgorithm final : public IAlgorithm {
   const Config& config() const { return m_cfg; }
 
  private:
+  /// Temporary output of the tracks fitted by one task, which is kept and
+  /// reused for the following events
+  struct FitWorkspace {
+    TrackContainer tracks{std::make_shared<Acts::VectorTrackContainer>(),
+                          std::make_shared<Acts::VectorMultiTrajectory>()};
+    std::vector<Acts::SourceLink> sourceLinks;
+  };
+
+  std::unique_ptr<FitWorkspace> acquireWorkspace() const;
+  void releaseWorkspace(std::unique_ptr<FitWorkspace> workspace) const;
+
   Config m_cfg;
 
+  mutable std::mutex m_workspaceMutex;
+  mutable std::vector<std::unique_ptr<FitWorkspace>> m_workspaces;
+
   ReadDataHandle<MeasurementContainer> m_inputMeasurements{this,
                                                            "InputMeasurements"};
   ReadDataHandle<IndexSourceLinkContainer> m_inputSourceLinks{
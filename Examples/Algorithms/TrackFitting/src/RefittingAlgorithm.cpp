@@ -13,17 +13,27 @@
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/SourceLink.hpp"
 #include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackHelpers.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackProxy.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MaterialInteractor.hpp"
+#include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/TrackHelpers.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/TrackFitting/RefittingCalibrator.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <optional>
 #include <ostream>
@@ -43,6 +53,15 @@ ActsExamples::RefittingAlgorithm::RefittingAlgorithm(Config config,
     throw std::invalid_argument("Missing output tracks collection");
   }
 
+  if (m_cfg.incremental && m_cfg.trackingGeometry == nullptr) {
+    throw std::invalid_argument(
+        "Missing tracking geometry for the incremental refit");
+  }
+  if (m_cfg.incremental && m_cfg.magneticField == nullptr) {
+    throw std::invalid_argument(
+        "Missing magnetic field for the incremental refit");
+  }
+
   m_inputTracks.initialize(m_cfg.inputTracks);
   m_outputTracks.initialize(m_cfg.outputTracks);
 }
@@ -60,6 +79,29 @@ ActsExamples::ProcessCode ActsExamples::RefittingAlgorithm::execute(
   std::vector<const Acts::Surface*> surfSequence;
   RefittingCalibrator calibrator;
 
+  // Only used for the incremental refit
+  auto tempTrackContainer = std::make_shared<Acts::VectorTrackContainer>();
+  auto tempTrackStateContainer =
+      std::make_shared<Acts::VectorMultiTrajectory>();
+  TrackContainer tracksTemp(tempTrackContainer, tempTrackStateContainer);
+  std::vector<RefittingCalibrator::ConstProxy> inputStates;
+  std::vector<RefittingCalibrator::Proxy> refittedStates;
+  std::optional<Extrapolator> extrapolator;
+  ExtrapolatorOptions extrapolationOptions(ctx.geoContext,
+                                           ctx.magFieldContext);
+  std::size_t nCopied = 0;
+  std::size_t nResumed = 0;
+
+  if (m_cfg.incremental) {
+    tracks.ensureDynamicColumns(inputTracks);
+    tracksTemp.ensureDynamicColumns(inputTracks);
+    extrapolator.emplace(
+        Acts::EigenStepper<>(m_cfg.magneticField),
+        Acts::Navigator({m_cfg.trackingGeometry},
+                        logger().cloneWithSuffix("Navigator")),
+        logger().cloneWithSuffix("Propagator"));
+  }
+
   auto itrack = 0ul;
   for (const auto& track : inputTracks) {
     // Check if you are not in picking mode
@@ -78,6 +120,53 @@ ActsExamples::ProcessCode ActsExamples::RefittingAlgorithm::execute(
     trackSourceLinks.clear();
     surfSequence.clear();
 
+    if (m_cfg.incremental) {
+      inputStates.clear();
+      for (auto state : track.trackStatesReversed()) {
+        inputStates.push_back(state);
+      }
+      std::reverse(inputStates.begin(), inputStates.end());
+
+      auto firstModified = std::find_if(
+          inputStates.begin(), inputStates.end(), [](const auto& state) {
+            return state.hasCalibrated() &&
+                   RefittingCalibrator::isModified(state);
+          });
+
+      if (firstModified == inputStates.end()) {
+        ACTS_VERBOSE("Copy unmodified track " << itrack);
+        auto copiedTrack = tracks.makeTrack();
+        copiedTrack.copyFrom(track, true);
+        ++nCopied;
+        continue;
+      }
+
+      // The forward filtering resumes from the last filtered measurement
+      // before the first modified one
+      auto resume = std::find_if(
+          std::make_reverse_iterator(firstModified), inputStates.rend(),
+          [](const auto& state) {
+            return state.hasCalibrated() && state.hasFiltered();
+          });
+
+      if (resume != inputStates.rend()) {
+        auto result = refitFrom(ctx, track, inputStates,
+                                std::distance(resume, inputStates.rend()) - 1,
+                                calibrator, *extrapolator,
+                                extrapolationOptions, tracksTemp,
+                                refittedStates);
+        if (result.ok()) {
+          auto refittedTrack = tracks.makeTrack();
+          refittedTrack.copyFrom(*result, true);
+          ++nResumed;
+          continue;
+        }
+        ACTS_DEBUG("Incremental refit failed for track "
+                   << itrack << " with error: " << result.error()
+                   << ", fall back to the full refit");
+      }
+    }
+
     for (auto state : track.trackStatesReversed()) {
       surfSequence.push_back(&state.referenceSurface());
 
@@ -118,6 +207,11 @@ ActsExamples::ProcessCode ActsExamples::RefittingAlgorithm::execute(
     }
   }
 
+  if (m_cfg.incremental) {
+    ACTS_DEBUG("Copied " << nCopied << " unmodified tracks and resumed the "
+                         << "fit of " << nResumed << " tracks");
+  }
+
   std::stringstream ss;
   trackStateContainer->statistics().toStream(ss);
   ACTS_DEBUG(ss.str());
@@ -131,3 +225,88 @@ ActsExamples::ProcessCode ActsExamples::RefittingAlgorithm::execute(
   m_outputTracks(ctx, std::move(constTracks));
   return ActsExamples::ProcessCode::SUCCESS;
 }
+
+Acts::Result<ActsExamples::TrackContainer::TrackProxy>
+ActsExamples::RefittingAlgorithm::refitFrom(
+    const ActsExamples::AlgorithmContext& ctx,
+    const ConstTrackContainer::ConstTrackProxy& track,
+    const std::vector<RefittingCalibrator::ConstProxy>& inputStates,
+    std::size_t resume, const RefittingCalibrator& calibrator,
+    const Extrapolator& extrapolator,
+    const ExtrapolatorOptions& extrapolationOptions,
+    TrackContainer& tracksTemp,
+    std::vector<RefittingCalibrator::Proxy>& refittedStates) const {
+  tracksTemp.clear();
+
+  const auto& resumeState = inputStates[resume];
+  const Acts::BoundTrackParameters resumeParams(
+      resumeState.referenceSurface().getSharedPtr(), resumeState.filtered(),
+      resumeState.filteredCovariance(), track.particleHypothesis());
+
+  // Everything after the resume state is filtered again, the reference
+  // surface is handled after smoothing the whole track
+  TrackFitterFunction::GeneralFitterOptions options{
+      ctx.geoContext, ctx.magFieldContext, ctx.calibContext, nullptr,
+      Acts::PropagatorPlainOptions()};
+
+  std::vector<Acts::SourceLink> sourceLinks;
+  std::vector<const Acts::Surface*> surfSequence;
+  for (std::size_t i = resume + 1; i < inputStates.size(); ++i) {
+    const auto& state = inputStates[i];
+    surfSequence.push_back(&state.referenceSurface());
+    if (state.hasCalibrated()) {
+      sourceLinks.push_back(
+          Acts::SourceLink{RefittingCalibrator::RefittingSourceLink{state}});
+    }
+  }
+
+  ACTS_VERBOSE("Resume the fit of track " << track.index() << " at state "
+                                          << resume << " of "
+                                          << inputStates.size());
+  auto result = (*m_cfg.fit)(sourceLinks, resumeParams, options, calibrator,
+                             surfSequence, tracksTemp);
+  if (!result.ok()) {
+    return result.error();
+  }
+
+  refittedStates.clear();
+  for (auto state : result->trackStatesReversed()) {
+    refittedStates.push_back(state);
+  }
+
+  // Stitch the unchanged states and the refitted ones. The Jacobian of the
+  // first refitted state starts at the resume state, so the sequence is
+  // consistent for smoothing.
+  auto stitched = tracksTemp.makeTrack();
+  auto append = [&](const auto& src) {
+    auto dst = stitched.appendTrackState(src.getMask());
+    if (src.hasCalibrated()) {
+      dst.allocateCalibrated(src.calibratedSize());
+    }
+    dst.copyFrom(src, Acts::TrackStatePropMask::All, true);
+  };
+  for (std::size_t i = 0; i <= resume; ++i) {
+    append(inputStates[i]);
+  }
+  for (auto it = refittedStates.rbegin(); it != refittedStates.rend(); ++it) {
+    append(*it);
+  }
+  stitched.setParticleHypothesis(track.particleHypothesis());
+
+  // The smoothed states before the resume state depend on all measurements,
+  // the smoothing is cheap compared to the propagation that is saved
+  if (auto smoothResult = Acts::smoothTrack(ctx.geoContext, stitched, logger());
+      !smoothResult.ok()) {
+    return smoothResult.error();
+  }
+  Acts::calculateTrackQuantities(stitched);
+
+  if (auto extrapolateResult = Acts::extrapolateTrackToReferenceSurface(
+          stitched, track.referenceSurface(), extrapolator,
+          extrapolationOptions, m_cfg.extrapolationStrategy, logger());
+      !extrapolateResult.ok()) {
+    return extrapolateResult.error();
+  }
+
+  return stitched;
+}
@@ -13,6 +13,8 @@
 #include "Acts/EventData/SourceLink.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
 
+#include <stdexcept>
+
 namespace ActsExamples {
 
 void RefittingCalibrator::calibrate(const Acts::GeometryContext& /*gctx*/,
@@ -40,4 +42,17 @@ void RefittingCalibrator::calibrate(const Acts::GeometryContext& /*gctx*/,
   trackState.setProjectorBitset(sl.state.projectorBitset());
 }
 
+void RefittingCalibrator::markModified(Proxy trackState) {
+  if (!trackState.has(kModifiedKey)) {
+    throw std::invalid_argument(
+        "Track state container has no refitModified column");
+  }
+  trackState.template component<bool, kModifiedKey>() = true;
+}
+
+bool RefittingCalibrator::isModified(const ConstProxy& trackState) {
+  return trackState.has(kModifiedKey) &&
+         trackState.template component<bool, kModifiedKey>();
+}
+
 }  // namespace ActsExamples
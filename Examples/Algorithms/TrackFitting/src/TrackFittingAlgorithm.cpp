@@ -22,9 +22,14 @@
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/TrackFitting/TrackFitterFunction.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <stdexcept>
 #include <system_error>
@@ -102,12 +107,13 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
   auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
   TrackContainer tracks(trackContainer, trackStateContainer);
 
-  // Perform the fit for each input track
-  std::vector<Acts::SourceLink> trackSourceLinks;
-  for (std::size_t itrack = 0; itrack < protoTracks.size(); ++itrack) {
+  // Fit a single track into the given container, returns false if the proto
+  // track refers to an invalid hit
+  auto fitTrack = [&](std::size_t itrack, TrackContainer& target,
+                      std::vector<Acts::SourceLink>& trackSourceLinks) {
     // Check if you are not in picking mode
     if (m_cfg.pickTrack > -1 && m_cfg.pickTrack != static_cast<int>(itrack)) {
-      continue;
+      return true;
     }
 
     // The list of hits and the initial start parameters
@@ -118,7 +124,7 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
     // of entries in input and output containers matches.
     if (protoTrack.empty()) {
       ACTS_WARNING("Empty track " << itrack << " found.");
-      continue;
+      return true;
     }
 
     ACTS_VERBOSE("Initial parameters: "
@@ -137,13 +143,13 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
       } else {
         ACTS_FATAL("Proto track " << itrack << " contains invalid hit index"
                                   << hitIndex);
-        return ProcessCode::ABORT;
+        return false;
       }
     }
 
     ACTS_DEBUG("Invoke direct fitter for track " << itrack);
     auto result = (*m_cfg.fit)(trackSourceLinks, initialParams, options,
-                               calibrator, tracks);
+                               calibrator, target);
 
     if (result.ok()) {
       // Get the fit output object
@@ -159,6 +165,60 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
                    << itrack << " with error: " << result.error() << ", "
                    << result.error().message());
     }
+    return true;
+  };
+
+  if (m_cfg.tracksPerTask == 0) {
+    // Perform the fit for each input track
+    std::vector<Acts::SourceLink> trackSourceLinks;
+    for (std::size_t itrack = 0; itrack < protoTracks.size(); ++itrack) {
+      if (!fitTrack(itrack, tracks, trackSourceLinks)) {
+        return ProcessCode::ABORT;
+      }
+    }
+  } else {
+    // Every task fits a contiguous range of tracks into its own workspace.
+    // The workspaces are merged in task order afterwards, such that the
+    // output does not depend on the scheduling.
+    const std::size_t nTasks =
+        (protoTracks.size() + m_cfg.tracksPerTask - 1) / m_cfg.tracksPerTask;
+    std::vector<std::unique_ptr<FitWorkspace>> taskWorkspaces(nTasks);
+    std::atomic<bool> invalidHit = false;
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nTasks),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t itask = range.begin(); itask != range.end();
+               ++itask) {
+            auto workspace = acquireWorkspace();
+            const std::size_t begin = itask * m_cfg.tracksPerTask;
+            const std::size_t end = std::min(begin + m_cfg.tracksPerTask,
+                                             protoTracks.size());
+            for (std::size_t itrack = begin; itrack < end; ++itrack) {
+              if (!fitTrack(itrack, workspace->tracks,
+                            workspace->sourceLinks)) {
+                invalidHit = true;
+                break;
+              }
+            }
+            taskWorkspaces[itask] = std::move(workspace);
+          }
+        });
+
+    for (auto& workspace : taskWorkspaces) {
+      if (!invalidHit) {
+        tracks.ensureDynamicColumns(workspace->tracks);
+        for (const auto& track : workspace->tracks) {
+          auto destTrack = tracks.makeTrack();
+          destTrack.copyFrom(track, true);
+        }
+      }
+      releaseWorkspace(std::move(workspace));
+    }
+
+    if (invalidHit) {
+      return ProcessCode::ABORT;
+    }
   }
 
   std::stringstream ss;
@@ -174,3 +234,23 @@ ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
   m_outputTracks(ctx, std::move(constTracks));
   return ActsExamples::ProcessCode::SUCCESS;
 }
+
+std::unique_ptr<ActsExamples::TrackFittingAlgorithm::FitWorkspace>
+ActsExamples::TrackFittingAlgorithm::acquireWorkspace() const {
+  std::lock_guard<std::mutex> lock(m_workspaceMutex);
+  if (m_workspaces.empty()) {
+    return std::make_unique<FitWorkspace>();
+  }
+  auto workspace = std::move(m_workspaces.back());
+  m_workspaces.pop_back();
+  return workspace;
+}
+
+void ActsExamples::TrackFittingAlgorithm::releaseWorkspace(
+    std::unique_ptr<FitWorkspace> workspace) const {
+  // keep the allocated storage for the next event
+  workspace->tracks.clear();
+  workspace->sourceLinks.clear();
+  std::lock_guard<std::mutex> lock(m_workspaceMutex);
+  m_workspaces.push_back(std::move(workspace));
+}
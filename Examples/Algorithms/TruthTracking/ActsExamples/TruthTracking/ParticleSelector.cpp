@@ -16,9 +16,13 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <ostream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 ActsExamples::ParticleSelector::ParticleSelector(const Config& config,
                                                  Acts::Logging::Level level)
@@ -64,27 +68,50 @@ ActsExamples::ParticleSelector::ParticleSelector(const Config& config,
 
 ActsExamples::ProcessCode ActsExamples::ParticleSelector::execute(
     const AlgorithmContext& ctx) const {
-  using ParticlesMeasurmentMap =
-      boost::container::flat_multimap<ActsFatras::Barcode, Index>;
-
   // prepare input/ output types
   const auto& inputParticles = m_inputParticles(ctx);
+  const std::size_t nParticles = inputParticles.size();
 
-  // Make global particles measurement map if necessary
-  std::optional<ParticlesMeasurmentMap> particlesMeasMap;
+  // count the measurements of each particle. the sorted particle ids of the
+  // measurements are walked along with the sorted particles, which avoids
+  // building the inverse map and looking up each particle in it.
+  std::vector<std::size_t> nMeasurements;
   if (m_inputMap.isInitialized()) {
-    particlesMeasMap = invertIndexMultimap(m_inputMap(ctx));
+    const auto& measurementParticlesMap = m_inputMap(ctx);
+    std::vector<ActsFatras::Barcode> measurementParticles;
+    measurementParticles.reserve(measurementParticlesMap.size());
+    for (const auto& [measurement, particle] : measurementParticlesMap) {
+      measurementParticles.push_back(particle);
+    }
+    std::sort(measurementParticles.begin(), measurementParticles.end());
+
+    nMeasurements.resize(nParticles, 0);
+    auto it = measurementParticles.begin();
+    std::size_t i = 0;
+    for (const auto& p : inputParticles) {
+      it = std::lower_bound(it, measurementParticles.end(), p.particleId());
+      auto end = std::upper_bound(it, measurementParticles.end(),
+                                  p.particleId());
+      nMeasurements[i++] = std::distance(it, end);
+      it = end;
+      ACTS_VERBOSE("Found " << nMeasurements[i - 1] << " measurements for "
+                            << p.particleId());
+    }
   }
 
-  std::size_t nInvalidCharge = 0;
-  std::size_t nInvalidMeasurementCount = 0;
-
   // helper functions to select tracks
   auto within = [](auto x, auto min, auto max) {
     return (min <= x) && (x < max);
   };
 
-  auto isValidParticle = [&](const ActsFatras::Particle& p) {
+  // evaluate all cuts into a mask. every cut is computed for every particle
+  // and the results are only combined at the end, such that the pass over
+  // the particles does not branch on the data.
+  std::vector<std::uint8_t> validCharges(nParticles);
+  std::vector<std::uint8_t> selected(nParticles);
+  auto particle = inputParticles.begin();
+  for (std::size_t i = 0; i < nParticles; ++i, ++particle) {
+    const ActsFatras::Particle& p = *particle;
     const auto eta = Acts::VectorHelpers::eta(p.direction());
     const auto phi = Acts::VectorHelpers::phi(p.direction());
     const auto rho = Acts::VectorHelpers::perp(p.position());
@@ -93,48 +120,53 @@ ActsExamples::ProcessCode ActsExamples::ParticleSelector::execute(
     const bool validCharged = (p.charge() != 0) && !m_cfg.removeCharged;
     const bool validCharge = validNeutral || validCharged;
     const bool validSecondary = !m_cfg.removeSecondaries || !p.isSecondary();
+    const bool validPt =
+        within(p.transverseMomentum(), m_cfg.ptMin, m_cfg.ptMax);
+    const bool validAbsEta =
+        within(std::abs(eta), m_cfg.absEtaMin, m_cfg.absEtaMax);
+    const bool validEta = within(eta, m_cfg.etaMin, m_cfg.etaMax);
+    const bool validPhi = within(phi, m_cfg.phiMin, m_cfg.phiMax);
+    const bool validAbsZ = within(std::abs(p.position()[Acts::ePos2]),
+                                  m_cfg.absZMin, m_cfg.absZMax);
+    const bool validRho = within(rho, m_cfg.rhoMin, m_cfg.rhoMax);
+    const bool validTime = within(p.time(), m_cfg.timeMin, m_cfg.timeMax);
+    const bool validMass = within(p.mass(), m_cfg.mMin, m_cfg.mMax);
+
+    validCharges[i] = validCharge;
+    selected[i] = validCharge && validSecondary && validPt && validAbsEta &&
+                  validEta && validPhi && validAbsZ && validRho && validTime &&
+                  validMass;
+  }
 
-    nInvalidCharge += static_cast<std::size_t>(!validCharge);
-
-    // default valid measurement count to true and only change if we have loaded
-    // the measurement particles map
-    bool validMeasurementCount = true;
-    if (particlesMeasMap) {
-      auto [b, e] = particlesMeasMap->equal_range(p.particleId());
-      validMeasurementCount =
-          within(static_cast<std::size_t>(std::distance(b, e)),
-                 m_cfg.measurementsMin, m_cfg.measurementsMax);
-
-      ACTS_VERBOSE("Found " << std::distance(b, e) << " measurements for "
-                            << p.particleId());
-    }
-
+  std::size_t nInvalidCharge = 0;
+  std::size_t nInvalidMeasurementCount = 0;
+  for (std::size_t i = 0; i < nParticles; ++i) {
+    nInvalidCharge += static_cast<std::size_t>(!validCharges[i]);
+  }
+  // default valid measurement count to true and only change if we have loaded
+  // the measurement particles map
+  for (std::size_t i = 0; i < nMeasurements.size(); ++i) {
+    const bool validMeasurementCount =
+        within(nMeasurements[i], m_cfg.measurementsMin, m_cfg.measurementsMax);
     nInvalidMeasurementCount +=
         static_cast<std::size_t>(!validMeasurementCount);
+    selected[i] &= static_cast<std::uint8_t>(validMeasurementCount);
+  }
 
-    return validCharge && validSecondary && validMeasurementCount &&
-           within(p.transverseMomentum(), m_cfg.ptMin, m_cfg.ptMax) &&
-           within(std::abs(eta), m_cfg.absEtaMin, m_cfg.absEtaMax) &&
-           within(eta, m_cfg.etaMin, m_cfg.etaMax) &&
-           within(phi, m_cfg.phiMin, m_cfg.phiMax) &&
-           within(std::abs(p.position()[Acts::ePos2]), m_cfg.absZMin,
-                  m_cfg.absZMax) &&
-           within(rho, m_cfg.rhoMin, m_cfg.rhoMax) &&
-           within(p.time(), m_cfg.timeMin, m_cfg.timeMax) &&
-           within(p.mass(), m_cfg.mMin, m_cfg.mMax);
-  };
-
-  SimParticleContainer outputParticles;
-  outputParticles.reserve(inputParticles.size());
-
-  // copy selected particles
-  for (const auto& inputParticle : inputParticles) {
-    if (isValidParticle(inputParticle)) {
-      // the input parameters should already be
-      outputParticles.insert(outputParticles.end(), inputParticle);
+  // copy selected particles. they keep the order of the input container and
+  // the output is adopted as a whole instead of inserted one by one.
+  SimParticleContainer::sequence_type outputSequence;
+  outputSequence.reserve(
+      std::count(selected.begin(), selected.end(), std::uint8_t{1}));
+  particle = inputParticles.begin();
+  for (std::size_t i = 0; i < nParticles; ++i, ++particle) {
+    if (selected[i] != 0) {
+      outputSequence.push_back(*particle);
     }
   }
-  outputParticles.shrink_to_fit();
+  SimParticleContainer outputParticles;
+  outputParticles.adopt_sequence(boost::container::ordered_unique_range,
+                                 std::move(outputSequence));
 
   ACTS_DEBUG("event " << ctx.eventNumber << " selected "
                       << outputParticles.size() << " from "
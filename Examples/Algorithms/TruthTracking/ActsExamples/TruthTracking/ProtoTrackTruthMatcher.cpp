@@ -8,15 +8,21 @@
 
 #include "ActsExamples/TruthTracking/ProtoTrackTruthMatcher.hpp"
 
-#include "Acts/Utilities/Enumerate.hpp"
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
 
-#include <map>
+#include <algorithm>
 #include <optional>
 #include <stdexcept>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#ifndef ACTS_EXAMPLES_NO_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace ActsExamples {
 
 ProtoTrackTruthMatcher::ProtoTrackTruthMatcher(const Config& config,
@@ -57,27 +63,25 @@ ActsExamples::ProcessCode ProtoTrackTruthMatcher::execute(
   const auto& particles = m_inputParticles(ctx);
   const auto& hitParticlesMap = m_inputMeasurementParticlesMap(ctx);
 
-  ProtoTrackParticleMatching protoTrackParticleMatching;
-  ParticleProtoTrackMatching particleProtoTrackMatching;
-
   // TODO this may be computed in a separate algorithm
   // TODO can we wire this through?
-  std::map<SimBarcode, std::size_t> particleTruthHitCount;
-  for (const auto& [_, pid] : hitParticlesMap) {
-    particleTruthHitCount[pid]++;
-  }
+  const auto particleTruthHitCount = countParticleHits(hitParticlesMap);
 
-  // For each particle within a track, how many hits did it contribute
-  std::vector<ParticleHitCount> particleHitCounts;
+  // The proto tracks are matched independently of each other in parallel,
+  // only the duplicates are resolved afterwards in proto track order
+  std::vector<std::optional<TrackMatchEntry>> trackMatches(protoTracks.size());
+
+  auto matchProtoTrack = [&](std::size_t index,
+                             std::vector<ParticleHitCount>& particleHitCounts) {
+    const auto& protoTrack = protoTracks[index];
 
-  for (const auto& [index, protoTrack] : Acts::enumerate(protoTracks)) {
     // Get the majority truth particle to this track
     identifyContributingParticles(hitParticlesMap, protoTrack,
                                   particleHitCounts);
     if (particleHitCounts.empty()) {
       ACTS_DEBUG("No truth particle associated with this proto track "
                  << index);
-      continue;
+      return;
     }
 
     // Get the majority particleId and majority particle counts
@@ -92,7 +96,7 @@ ActsExamples::ProcessCode ProtoTrackTruthMatcher::execute(
           "The majority particle is not in the input particle collection, "
           "majorityParticleId = "
           << majorityParticleId);
-      continue;
+      return;
     }
 
     // Check if the trajectory is matched with truth.
@@ -107,43 +111,101 @@ ActsExamples::ProcessCode ProtoTrackTruthMatcher::execute(
 
     if ((!m_cfg.doubleMatching && recoMatched) ||
         (m_cfg.doubleMatching && recoMatched && truthMatched)) {
-      auto& trackParticleMatch = protoTrackParticleMatching[index] = {
-          TrackMatchClassification::Matched, majorityParticleId,
-          particleHitCounts};
-
-      auto& particleTrackMatch = particleProtoTrackMatching[majorityParticleId];
-      if (!particleTrackMatch.track) {
-        particleTrackMatch.track = index;
-      } else {
-        // we already have a track associated with this particle and have to
-        // resolve the ambiguity.
-        // we will use the track with more hits and smaller chi2
-        const auto& otherProtoTrack =
-            protoTracks.at(particleTrackMatch.track.value());
-        if (otherProtoTrack.size() < protoTrack.size()) {
-          protoTrackParticleMatching[particleTrackMatch.track.value()]
-              .classification = TrackMatchClassification::Duplicate;
-          particleTrackMatch.track = index;
-        } else {
-          trackParticleMatch.classification =
-              TrackMatchClassification::Duplicate;
-        }
-
-        ++particleTrackMatch.duplicates;
-      }
+      trackMatches[index] =
+          TrackMatchEntry{TrackMatchClassification::Matched, majorityParticleId,
+                          particleHitCounts};
     } else {
-      protoTrackParticleMatching[index] = {TrackMatchClassification::Fake,
-                                           std::nullopt, particleHitCounts};
+      // keep the majority particle to count the fakes
+      trackMatches[index] =
+          TrackMatchEntry{TrackMatchClassification::Fake, majorityParticleId,
+                          particleHitCounts};
+    }
+  };
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, protoTracks.size()),
+                    [&](const tbb::blocked_range<std::size_t>& range) {
+                      // For each particle within a track, how many hits did it
+                      // contribute
+                      std::vector<ParticleHitCount> particleHitCounts;
+                      for (std::size_t i = range.begin(); i != range.end();
+                           ++i) {
+                        matchProtoTrack(i, particleHitCounts);
+                      }
+                    });
+#else
+  std::vector<ParticleHitCount> particleHitCounts;
+  for (std::size_t i = 0; i < protoTracks.size(); ++i) {
+    matchProtoTrack(i, particleHitCounts);
+  }
+#endif
 
-      auto& particleTrackMatch = particleProtoTrackMatching[majorityParticleId];
+  std::unordered_map<SimBarcode, ParticleMatchEntry> particleMatches;
+
+  for (std::size_t index = 0; index < protoTracks.size(); ++index) {
+    auto& trackMatch = trackMatches[index];
+    if (!trackMatch) {
+      continue;
+    }
+    const SimBarcode majorityParticleId = trackMatch->particle.value();
+    auto& particleTrackMatch = particleMatches[majorityParticleId];
+
+    if (trackMatch->classification == TrackMatchClassification::Fake) {
+      trackMatch->particle = std::nullopt;
       ++particleTrackMatch.fakes;
+      continue;
+    }
+
+    if (!particleTrackMatch.track) {
+      particleTrackMatch.track = index;
+      continue;
+    }
+
+    // we already have a track associated with this particle and have to
+    // resolve the ambiguity.
+    // we will use the track with more hits
+    const auto& otherProtoTrack =
+        protoTracks.at(particleTrackMatch.track.value());
+    if (otherProtoTrack.size() < protoTracks[index].size()) {
+      trackMatches[particleTrackMatch.track.value()]->classification =
+          TrackMatchClassification::Duplicate;
+      particleTrackMatch.track = index;
+    } else {
+      trackMatch->classification = TrackMatchClassification::Duplicate;
+    }
+
+    ++particleTrackMatch.duplicates;
+  }
+
+  // both matchings are filled in sorted order
+  ProtoTrackParticleMatching::sequence_type protoTrackParticleMatching;
+  for (std::size_t index = 0; index < protoTracks.size(); ++index) {
+    if (trackMatches[index]) {
+      protoTrackParticleMatching.emplace_back(index,
+                                              std::move(*trackMatches[index]));
     }
   }
+  ParticleProtoTrackMatching::sequence_type particleProtoTrackMatching(
+      particleMatches.begin(), particleMatches.end());
+  std::sort(particleProtoTrackMatching.begin(),
+            particleProtoTrackMatching.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.first < rhs.first;
+            });
+
+  ProtoTrackParticleMatching protoTrackParticleMatchingMap;
+  protoTrackParticleMatchingMap.adopt_sequence(
+      boost::container::ordered_unique_range,
+      std::move(protoTrackParticleMatching));
+  ParticleProtoTrackMatching particleProtoTrackMatchingMap;
+  particleProtoTrackMatchingMap.adopt_sequence(
+      boost::container::ordered_unique_range,
+      std::move(particleProtoTrackMatching));
 
   m_outputProtoTrackParticleMatching(ctx,
-                                     std::move(protoTrackParticleMatching));
+                                     std::move(protoTrackParticleMatchingMap));
   m_outputParticleProtoTrackMatching(ctx,
-                                     std::move(particleProtoTrackMatching));
+                                     std::move(particleProtoTrackMatchingMap));
 
   return ProcessCode::SUCCESS;
 }
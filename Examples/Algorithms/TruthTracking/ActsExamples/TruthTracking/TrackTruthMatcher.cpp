@@ -12,11 +12,18 @@
 #include "ActsExamples/EventData/TruthMatching.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
 
-#include <map>
+#include <algorithm>
 #include <optional>
 #include <stdexcept>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#ifndef ACTS_EXAMPLES_NO_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace ActsExamples {
 
 TrackTruthMatcher::TrackTruthMatcher(const Config& config,
@@ -54,27 +61,25 @@ ActsExamples::ProcessCode TrackTruthMatcher::execute(
   const auto& particles = m_inputParticles(ctx);
   const auto& hitParticlesMap = m_inputMeasurementParticlesMap(ctx);
 
-  TrackParticleMatching trackParticleMatching;
-  ParticleTrackMatching particleTrackMatching;
-
   // TODO this may be computed in a separate algorithm
   // TODO can we wire this through?
-  std::map<SimBarcode, std::size_t> particleTruthHitCount;
-  for (const auto& [_, pid] : hitParticlesMap) {
-    particleTruthHitCount[pid]++;
-  }
+  const auto particleTruthHitCount = countParticleHits(hitParticlesMap);
 
-  // For each particle within a track, how many hits did it contribute
-  std::vector<ParticleHitCount> particleHitCounts;
+  // The tracks are matched independently of each other in parallel, only the
+  // duplicates are resolved afterwards in track order
+  std::vector<std::optional<TrackMatchEntry>> trackMatches(tracks.size());
+
+  auto matchTrack = [&](std::size_t itrack,
+                        std::vector<ParticleHitCount>& particleHitCounts) {
+    const auto track = tracks.getTrack(itrack);
 
-  for (const auto& track : tracks) {
     // Get the majority truth particle to this track
     identifyContributingParticles(hitParticlesMap, track, particleHitCounts);
     if (particleHitCounts.empty()) {
       ACTS_DEBUG(
           "No truth particle associated with this trajectory with tip index = "
           << track.tipIndex());
-      continue;
+      return;
     }
 
     // Get the majority particleId and majority particle counts
@@ -89,7 +94,7 @@ ActsExamples::ProcessCode TrackTruthMatcher::execute(
           "The majority particle is not in the input particle collection, "
           "majorityParticleId = "
           << majorityParticleId);
-      continue;
+      return;
     }
 
     // Check if the trajectory is matched with truth.
@@ -104,42 +109,97 @@ ActsExamples::ProcessCode TrackTruthMatcher::execute(
 
     if ((!m_cfg.doubleMatching && recoMatched) ||
         (m_cfg.doubleMatching && recoMatched && truthMatched)) {
-      auto& trackParticleMatch = trackParticleMatching[track.index()] = {
-          TrackMatchClassification::Matched, majorityParticleId,
-          particleHitCounts};
-
-      auto& particleTrackMatch = particleTrackMatching[majorityParticleId];
-      if (!particleTrackMatch.track) {
-        particleTrackMatch.track = track.index();
-      } else {
-        // we already have a track associated with this particle and have to
-        // resolve the ambiguity.
-        // we will use the track with more hits and smaller chi2
-        const auto& otherTrack =
-            tracks.getTrack(particleTrackMatch.track.value());
-        if (otherTrack.nMeasurements() < track.nMeasurements() ||
-            otherTrack.chi2() > track.chi2()) {
-          trackParticleMatching[otherTrack.index()].classification =
-              TrackMatchClassification::Duplicate;
-          particleTrackMatch.track = track.index();
-        } else {
-          trackParticleMatch.classification =
-              TrackMatchClassification::Duplicate;
-        }
-
-        ++particleTrackMatch.duplicates;
-      }
+      trackMatches[itrack] =
+          TrackMatchEntry{TrackMatchClassification::Matched, majorityParticleId,
+                          particleHitCounts};
     } else {
-      trackParticleMatching[track.index()] = {TrackMatchClassification::Fake,
-                                              std::nullopt, particleHitCounts};
+      // keep the majority particle to count the fakes
+      trackMatches[itrack] =
+          TrackMatchEntry{TrackMatchClassification::Fake, majorityParticleId,
+                          particleHitCounts};
+    }
+  };
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, tracks.size()),
+                    [&](const tbb::blocked_range<std::size_t>& range) {
+                      // For each particle within a track, how many hits did it
+                      // contribute
+                      std::vector<ParticleHitCount> particleHitCounts;
+                      for (std::size_t i = range.begin(); i != range.end();
+                           ++i) {
+                        matchTrack(i, particleHitCounts);
+                      }
+                    });
+#else
+  std::vector<ParticleHitCount> particleHitCounts;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    matchTrack(i, particleHitCounts);
+  }
+#endif
+
+  std::unordered_map<SimBarcode, ParticleMatchEntry> particleMatches;
+
+  for (std::size_t itrack = 0; itrack < tracks.size(); ++itrack) {
+    auto& trackMatch = trackMatches[itrack];
+    if (!trackMatch) {
+      continue;
+    }
+    const SimBarcode majorityParticleId = trackMatch->particle.value();
+    auto& particleTrackMatch = particleMatches[majorityParticleId];
 
-      auto& particleTrackMatch = particleTrackMatching[majorityParticleId];
+    if (trackMatch->classification == TrackMatchClassification::Fake) {
+      trackMatch->particle = std::nullopt;
       ++particleTrackMatch.fakes;
+      continue;
+    }
+
+    if (!particleTrackMatch.track) {
+      particleTrackMatch.track = itrack;
+      continue;
     }
+
+    // we already have a track associated with this particle and have to
+    // resolve the ambiguity.
+    // we will use the track with more hits and smaller chi2
+    const auto track = tracks.getTrack(itrack);
+    const auto otherTrack = tracks.getTrack(particleTrackMatch.track.value());
+    if (otherTrack.nMeasurements() < track.nMeasurements() ||
+        otherTrack.chi2() > track.chi2()) {
+      trackMatches[otherTrack.index()]->classification =
+          TrackMatchClassification::Duplicate;
+      particleTrackMatch.track = itrack;
+    } else {
+      trackMatch->classification = TrackMatchClassification::Duplicate;
+    }
+
+    ++particleTrackMatch.duplicates;
   }
 
-  m_outputTrackParticleMatching(ctx, std::move(trackParticleMatching));
-  m_outputParticleTrackMatching(ctx, std::move(particleTrackMatching));
+  // both matchings are filled in sorted order
+  TrackParticleMatching::sequence_type trackParticleMatching;
+  for (std::size_t itrack = 0; itrack < tracks.size(); ++itrack) {
+    if (trackMatches[itrack]) {
+      trackParticleMatching.emplace_back(itrack,
+                                         std::move(*trackMatches[itrack]));
+    }
+  }
+  ParticleTrackMatching::sequence_type particleTrackMatching(
+      particleMatches.begin(), particleMatches.end());
+  std::sort(particleTrackMatching.begin(), particleTrackMatching.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.first < rhs.first;
+            });
+
+  TrackParticleMatching trackParticleMatchingMap;
+  trackParticleMatchingMap.adopt_sequence(
+      boost::container::ordered_unique_range, std::move(trackParticleMatching));
+  ParticleTrackMatching particleTrackMatchingMap;
+  particleTrackMatchingMap.adopt_sequence(
+      boost::container::ordered_unique_range, std::move(particleTrackMatching));
+
+  m_outputTrackParticleMatching(ctx, std::move(trackParticleMatchingMap));
+  m_outputParticleTrackMatching(ctx, std::move(particleTrackMatchingMap));
 
   return ProcessCode::SUCCESS;
 }
@@ -8,6 +8,12 @@
 
 #include "ActsExamples/Utilities/HitSelector.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 ActsExamples::HitSelector::HitSelector(const Config& config,
                                        Acts::Logging::Level level)
     : IAlgorithm("HitSelector", level), m_cfg(config) {
@@ -18,11 +24,25 @@ ActsExamples::HitSelector::HitSelector(const Config& config,
 ActsExamples::ProcessCode ActsExamples::HitSelector::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
   const auto& hits = m_inputHits(ctx);
-  SimHitContainer selectedHits;
 
-  std::copy_if(hits.begin(), hits.end(),
-               std::inserter(selectedHits, selectedHits.begin()),
-               [&](const auto& hit) { return hit.time() < m_cfg.maxTime; });
+  // evaluate the cut as a mask first, the selected hits keep the order of
+  // the input container and are adopted as a whole by the output
+  std::vector<std::uint8_t> selected(hits.size());
+  std::transform(hits.begin(), hits.end(), selected.begin(),
+                 [&](const auto& hit) { return hit.time() < m_cfg.maxTime; });
+
+  SimHitContainer::sequence_type selectedSequence;
+  selectedSequence.reserve(
+      std::count(selected.begin(), selected.end(), std::uint8_t{1}));
+  auto hit = hits.begin();
+  for (std::size_t i = 0; i < selected.size(); ++i, ++hit) {
+    if (selected[i] != 0) {
+      selectedSequence.push_back(*hit);
+    }
+  }
+  SimHitContainer selectedHits;
+  selectedHits.adopt_sequence(boost::container::ordered_range,
+                              std::move(selectedSequence));
 
   ACTS_DEBUG("selected " << selectedHits.size() << " from " << hits.size()
                          << " hits");
@@ -17,6 +17,7 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace ActsExamples::Contextual {
@@ -70,7 +71,9 @@ class InternallyAlignedDetectorElement
 
  private:
   std::unordered_map<unsigned int, Acts::Transform3> m_alignedTransforms;
-  mutable std::mutex m_alignmentMutex;
+  /// The transforms are read concurrently by all event threads, but only
+  /// written once per new or flushed IOV
+  mutable std::shared_mutex m_alignmentMutex;
 };
 
 inline const Acts::Transform3& InternallyAlignedDetectorElement::transform(
@@ -81,11 +84,11 @@ inline const Acts::Transform3& InternallyAlignedDetectorElement::transform(
   }
   const auto& alignContext = gctx.get<ContextType&>();
 
-  std::lock_guard lock{m_alignmentMutex};
   if (alignContext.nominal) {
     // nominal alignment
     return nominalTransform(gctx);
   }
+  std::shared_lock lock{m_alignmentMutex};
   auto aTransform = m_alignedTransforms.find(alignContext.iov);
   if (aTransform == m_alignedTransforms.end()) {
     throw std::runtime_error{
@@ -62,6 +62,10 @@ struct TGeoDetector {
 
     double unitScalor = 1.0;
 
+    /// Convert the detector elements of a layer concurrently within the
+    /// @c Acts::maxThreads budget, requires a thread-safe element factory
+    bool convertConcurrently = false;
+
     Acts::TGeoLayerBuilder::ElementFactory elementFactory =
         Acts::TGeoLayerBuilder::defaultElementFactory;
 
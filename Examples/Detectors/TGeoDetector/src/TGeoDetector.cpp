@@ -18,6 +18,7 @@
 #include "Acts/Geometry/ProtoLayerHelper.hpp"
 #include "Acts/Geometry/SurfaceArrayCreator.hpp"
 #include "Acts/Geometry/SurfaceBinningMatcher.hpp"
+#include "Acts/Geometry/SurfaceExtentCache.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingGeometryBuilder.hpp"
 #include "Acts/Geometry/TrackingVolumeArrayCreator.hpp"
@@ -36,6 +37,7 @@
 #include <initializer_list>
 #include <limits>
 #include <list>
+#include <memory>
 #include <optional>
 
 #include <boost/program_options.hpp>
@@ -63,6 +65,7 @@ std::vector<Acts::TGeoLayerBuilder::Config> makeLayerBuilderConfigs(
     layerBuilderConfig.configurationName = volume.name;
     layerBuilderConfig.unit = config.unitScalor;
     layerBuilderConfig.elementFactory = config.elementFactory;
+    layerBuilderConfig.convertConcurrently = config.convertConcurrently;
 
     // configure surface autobinning
     std::vector<std::pair<double, double>> binTolerances(
@@ -75,8 +78,10 @@ std::vector<Acts::TGeoLayerBuilder::Config> makeLayerBuilderConfigs(
                                    volume.binTolerancePhi.upper.value_or(0.)};
 
     layerBuilderConfig.autoSurfaceBinning = true;
-    layerBuilderConfig.surfaceBinMatcher =
-        Acts::SurfaceBinningMatcher(binTolerances);
+    // the geometry is built with a single context, the surface extents
+    // are only computed once for all the binning checks
+    layerBuilderConfig.surfaceBinMatcher = Acts::SurfaceBinningMatcher(
+        binTolerances, std::make_shared<Acts::SurfaceExtentCache>());
 
     // loop over the negative/central/positive layer configurations
     for (auto ncp : {
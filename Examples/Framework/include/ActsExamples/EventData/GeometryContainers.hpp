@@ -18,6 +18,7 @@
 #include <cassert>
 #include <cstddef>
 #include <iostream>
+#include <unordered_map>
 #include <utility>
 
 #include <boost/container/flat_map.hpp>
@@ -214,6 +215,57 @@ groupByModule(const GeometryIdMultiset<T>& container) {
   return makeGroupBy(container, detail::GeometryIdGetter());
 }
 
+/// Table of the element ranges of each module in a GeometryIdMultiset.
+///
+/// The elements of a module are contiguous in the container. The table
+/// stores their offsets by geometry id, such that the elements of a module
+/// are found with a single hash lookup instead of a binary search over all
+/// elements of the event, e.g. for every surface the track finding visits.
+/// Only offsets are stored, the table has to be used with the unmodified
+/// container it was built from.
+template <typename T>
+class GeometryIdRangeTable {
+ public:
+  using Container = GeometryIdMultiset<T>;
+  using Iterator = typename Container::const_iterator;
+
+  GeometryIdRangeTable() = default;
+
+  /// Build the table in one pass over the container
+  explicit GeometryIdRangeTable(const Container& container)
+      : m_nElements(container.size()) {
+    for (auto&& [geoId, elements] : groupByModule(container)) {
+      const std::size_t begin = elements.begin() - container.begin();
+      m_ranges.emplace(geoId.value(),
+                       std::make_pair(begin, begin + elements.size()));
+    }
+  }
+
+  /// Get the elements of a module
+  ///
+  /// @param container The container the table was built from
+  /// @param geoId The geometry id of the module
+  std::pair<Iterator, Iterator> equal_range(
+      const Container& container, Acts::GeometryIdentifier geoId) const {
+    assert(container.size() == m_nElements);
+    auto it = m_ranges.find(geoId.value());
+    if (it == m_ranges.end()) {
+      return {container.end(), container.end()};
+    }
+    return {container.begin() + it->second.first,
+            container.begin() + it->second.second};
+  }
+
+  /// The number of modules with elements
+  std::size_t size() const { return m_ranges.size(); }
+
+ private:
+  std::size_t m_nElements = 0;
+  std::unordered_map<Acts::GeometryIdentifier::Value,
+                     std::pair<std::size_t, std::size_t>>
+      m_ranges;
+};
+
 /// The accessor for the GeometryIdMultiset container
 ///
 /// It wraps up a few lookup methods to be used in the Combinatorial Kalman
@@ -84,10 +84,16 @@ struct IndexSourceLinkAccessor : GeometryIdMultisetAccessor<IndexSourceLink> {
 
   using Iterator = Acts::SourceLinkAdapterIterator<BaseIterator>;
 
+  // optional table of the surface ranges in the container
+  const GeometryIdRangeTable<IndexSourceLink>* ranges = nullptr;
+
   // get the range of elements with requested geoId
   std::pair<Iterator, Iterator> range(const Acts::Surface& surface) const {
     assert(container != nullptr);
-    auto [begin, end] = container->equal_range(surface.geometryId());
+    auto [begin, end] = ranges != nullptr
+                            ? ranges->equal_range(*container,
+                                                  surface.geometryId())
+                            : container->equal_range(surface.geometryId());
     return {Iterator{begin}, Iterator{end}};
   }
 };
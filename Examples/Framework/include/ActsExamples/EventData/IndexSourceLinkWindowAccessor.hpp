@@ -0,0 +1,71 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Source link accessor which narrows the source links on a surface down to
+/// the ones within a window around the predicted track position.
+///
+/// The index is built once per event. It keeps the source links of each
+/// surface ordered by the first local coordinate of their measurements, such
+/// that the window is a contiguous range found by binary search and the
+/// source links outside of it are never calibrated. The window extends over
+/// the given number of standard deviations of the residual, using the
+/// largest measurement variance on the surface. If no source link is within
+/// the window, the closest one is kept to be recorded as an outlier.
+///
+/// Surfaces with a measurement which does not constrain the first local
+/// coordinate are never narrowed.
+class IndexSourceLinkWindowAccessor {
+ public:
+  using Iterator = IndexSourceLinkAccessor::Iterator;
+
+  /// @param sourceLinks The source links of the event
+  /// @param measurements The measurements referenced by the source links
+  /// @param nSigma The half width of the window in standard deviations
+  IndexSourceLinkWindowAccessor(const IndexSourceLinkContainer& sourceLinks,
+                                const MeasurementContainer& measurements,
+                                double nSigma);
+
+  /// Get the range of all source links on a surface
+  std::pair<Iterator, Iterator> range(const Acts::Surface& surface) const;
+
+  /// Get the range of the source links within the window
+  ///
+  /// @param predicted The predicted track parameters on the surface
+  /// @param begin The begin of the source links on the surface from `range`
+  /// @param end The end of the source links on the surface from `range`
+  std::pair<Iterator, Iterator> window(
+      const Acts::BoundTrackParameters& predicted, Iterator begin,
+      Iterator end) const;
+
+ private:
+  double m_nSigma;
+  /// The source links with the ones of each surface sorted by `m_loc0`
+  IndexSourceLinkContainer m_sourceLinks;
+  /// The range of the source links of each surface in `m_sourceLinks`
+  GeometryIdRangeTable<IndexSourceLink> m_ranges;
+  /// The measured first local coordinate for each source link
+  std::vector<double> m_loc0;
+  /// The largest variance of the first local coordinate on the surface of
+  /// each source link, infinite if the surface cannot be narrowed
+  std::vector<double> m_maxVariance;
+};
+
+}  // namespace ActsExamples
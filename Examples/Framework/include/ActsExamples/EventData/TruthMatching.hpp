@@ -14,10 +14,11 @@
 #include "ActsExamples/Validation/TrackClassification.hpp"
 
 #include <cstdint>
-#include <map>
 #include <optional>
 #include <vector>
 
+#include <boost/container/flat_map.hpp>
+
 namespace ActsExamples {
 
 enum class TrackMatchClassification {
@@ -46,10 +47,17 @@ struct ParticleMatchEntry {
   std::uint32_t fakes{};
 };
 
-using ProtoTrackParticleMatching = std::map<TrackIndexType, TrackMatchEntry>;
-using ParticleProtoTrackMatching = std::map<SimBarcode, ParticleMatchEntry>;
+// The matchings are filled once in bulk and then only looked up, so they are
+// stored as sorted vectors.
+
+using ProtoTrackParticleMatching =
+    boost::container::flat_map<TrackIndexType, TrackMatchEntry>;
+using ParticleProtoTrackMatching =
+    boost::container::flat_map<SimBarcode, ParticleMatchEntry>;
 
-using TrackParticleMatching = std::map<TrackIndexType, TrackMatchEntry>;
-using ParticleTrackMatching = std::map<SimBarcode, ParticleMatchEntry>;
+using TrackParticleMatching =
+    boost::container::flat_map<TrackIndexType, TrackMatchEntry>;
+using ParticleTrackMatching =
+    boost::container::flat_map<SimBarcode, ParticleMatchEntry>;
 
 }  // namespace ActsExamples
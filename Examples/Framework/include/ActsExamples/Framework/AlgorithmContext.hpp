@@ -14,6 +14,7 @@
 #include <Acts/Utilities/CalibrationContext.hpp>
 
 #include <memory>
+#include <memory_resource>
 
 namespace ActsExamples {
 
@@ -47,6 +48,10 @@ struct AlgorithmContext {
   Acts::CalibrationContext calibContext;  ///< Per-event calibration context
 
   Acts::FpeMonitor* fpeMonitor = nullptr;
+
+  /// Per-event memory resource, released at the end of the event. Can be
+  /// used for the event data and temporary allocations of the event.
+  std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource();
 };
 
 }  // namespace ActsExamples
@@ -12,7 +12,9 @@
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <cstddef>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <typeinfo>
 
@@ -48,10 +50,34 @@ class DataHandleBase {
 
   std::string fullName() const { return m_parent->name() + "." + name(); }
 
+  /// Resolve the key to its slot in white boards with the given slots
+  ///
+  /// Done by the sequencer before the event loop. The slot is a cache of the
+  /// key look-up and is only used for white boards with the same slots.
+  ///
+  /// @param slots The slots of the white boards, nullptr to reset
+  void resolveSlot(const WhiteBoard::Slots* slots) const {
+    m_slots = nullptr;
+    if (slots == nullptr || !isInitialized()) {
+      return;
+    }
+    if (auto it = slots->indices.find(key()); it != slots->indices.end()) {
+      m_slots = slots;
+      m_slot = it->second;
+    }
+  }
+
  protected:
+  /// Whether the resolved slot can be used for a white board
+  bool hasSlot(const WhiteBoard& wb) const {
+    return m_slots != nullptr && m_slots == wb.slots();
+  }
+
   SequenceElement* m_parent{nullptr};
   std::string m_name;
   std::optional<std::string> m_key{};
+  mutable const WhiteBoard::Slots* m_slots = nullptr;
+  mutable std::size_t m_slot = 0;
 };
 
 template <typename T>
@@ -74,6 +100,10 @@ class WriteDataHandle final : public DataHandleBase {
       throw std::runtime_error{"WriteDataHandle '" + fullName() +
                                "' not initialized"};
     }
+    if (hasSlot(wb)) {
+      wb.addToSlot(m_slot, m_key.value(), std::move(value));
+      return;
+    }
     wb.add(m_key.value(), std::move(value));
   }
 
@@ -117,6 +147,9 @@ class ReadDataHandle final : public DataHandleBase {
       throw std::runtime_error{"ReadDataHandle '" + fullName() +
                                "' not initialized"};
     }
+    if (hasSlot(wb)) {
+      return wb.getFromSlot<T>(m_slot, m_key.value());
+    }
     return wb.get<T>(m_key.value());
   }
 
@@ -0,0 +1,90 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace ActsExamples {
+
+class WhiteBoard;
+
+/// Binary cache of selected white board objects, with one file per event
+///
+/// The files are written in the native byte order and are meant to be read
+/// back on the same machine by later runs of the same configuration. Every
+/// file records the cache key and the event number, files written for another
+/// key or event are rejected.
+///
+/// Supported are the simulated particles, vertices and hits, the hit maps, the
+/// index source links, the measurements, the space points and the proto
+/// tracks. The source links of the measurements and the space points must be
+/// index source links. The reference surfaces of the particles are not
+/// stored.
+class EventCache {
+ public:
+  struct Config {
+    /// directory of the cache files
+    std::string directory;
+    /// key of the configuration that produced the objects, e.g. a hash of the
+    /// configuration of the upstream algorithms. The files are stored in a
+    /// subdirectory of this name, if not empty.
+    std::string key;
+    /// names of the white board objects that are cached
+    std::vector<std::string> collections;
+  };
+
+  EventCache(const Config& cfg, Acts::Logging::Level level);
+
+  /// Whether objects of a type can be cached
+  static bool isSupported(const std::type_info& type);
+
+  /// The cache file of an event
+  std::string path(std::size_t event) const;
+
+  /// Whether the cache file of an event exists
+  bool contains(std::size_t event) const;
+
+  /// Write the cached objects of an event to its cache file
+  ///
+  /// @throws std::runtime_error if an object is missing or its type is not
+  ///         supported, or if the file can not be written
+  void store(std::size_t event, const WhiteBoard& wb) const;
+
+  /// Add objects of an event from its cache file to the white board
+  ///
+  /// @param event The event number
+  /// @param wb The white board of the event
+  /// @param names The cached objects to add
+  /// @throws std::runtime_error if the file can not be read, does not belong
+  ///         to the key and the event, or lacks one of the objects
+  void load(std::size_t event, WhiteBoard& wb,
+            const std::vector<std::string>& names) const;
+
+  const Config& config() const { return m_cfg; }
+
+ private:
+  struct Codec;
+  class Registry;
+
+  static const Registry& registry();
+
+  Config m_cfg;
+  std::string m_directory;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 struct AlgorithmContext;
@@ -46,6 +47,25 @@ class IAlgorithm : public SequenceElement {
     return execute(context);
   };
 
+  /// Execute the algorithm for a batch of events at once.
+  ///
+  /// Lets algorithms process several events together, e.g. in one call to
+  /// an accelerator. Every event keeps its own context and white board. The
+  /// default implementation executes the events one by one, algorithms
+  /// overriding it advertise the largest batch they accept with
+  /// `maxBatchSize`.
+  ///
+  /// @param contexts The contexts of the events, at most `maxBatchSize`
+  virtual ProcessCode executeBatch(
+      const std::vector<AlgorithmContext>& contexts) const;
+
+  /// Internal execute method forwards to the algorithm batch execute method
+  /// @param contexts The algorithm contexts
+  ProcessCode internalExecuteBatch(
+      const std::vector<AlgorithmContext>& contexts) final {
+    return executeBatch(contexts);
+  }
+
   /// Initialize the algorithm
   ProcessCode initialize() override { return ProcessCode::SUCCESS; }
   /// Finalize the algorithm
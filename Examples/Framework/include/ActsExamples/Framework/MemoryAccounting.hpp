@@ -0,0 +1,64 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ActsExamples {
+
+/// Heap memory allocated and freed by a thread within a scope
+struct MemoryCounters {
+  /// number of allocations
+  std::size_t allocations = 0;
+  /// bytes allocated
+  std::size_t allocated = 0;
+  /// bytes freed, including memory allocated outside of the scope
+  std::size_t freed = 0;
+  /// highest difference of the allocated and the freed bytes
+  std::int64_t peak = 0;
+
+  /// Difference of the allocated and the freed bytes
+  std::int64_t net() const {
+    return static_cast<std::int64_t>(allocated) -
+           static_cast<std::int64_t>(freed);
+  }
+};
+
+/// Whether the heap allocations are counted
+///
+/// The allocations are counted by the global allocation functions of the
+/// ActsExamplesMemoryAccounting library, built with
+/// ACTS_EXAMPLES_MEMORY_ACCOUNTING enabled. They only replace the ones of the
+/// standard library if the library is linked into the program or preloaded,
+/// which is checked by counting a test allocation.
+bool memoryAccountingAvailable();
+
+/// The counters of the calling thread, nullptr outside of a counted scope
+///
+/// Used by the replaced allocation functions.
+MemoryCounters* currentMemoryCounters() noexcept;
+
+/// Count the heap allocations of the calling thread while in scope
+///
+/// A nested counter takes over the counting until it goes out of scope, its
+/// allocations are not added to the enclosing counter. Allocations on other
+/// threads, e.g. by parallel loops within the scope, are not counted.
+class ScopedMemoryCounter {
+ public:
+  explicit ScopedMemoryCounter(MemoryCounters& counters);
+  ScopedMemoryCounter(const ScopedMemoryCounter&) = delete;
+  ScopedMemoryCounter& operator=(const ScopedMemoryCounter&) = delete;
+  ~ScopedMemoryCounter();
+
+ private:
+  MemoryCounters* m_previous;
+};
+
+}  // namespace ActsExamples
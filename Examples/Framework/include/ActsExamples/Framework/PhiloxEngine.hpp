@@ -0,0 +1,237 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ActsExamples {
+
+/// Counter-based random number generator using the Philox4x32-10 algorithm.
+///
+/// The state is only a 64bit key, a 64bit stream number and a 64bit counter,
+/// and the n-th output is a pure function of these. Constructing a generator
+/// is therefore cheap and independent streams, e.g. one per particle or
+/// module of an event, are obtained by just changing the stream number. The
+/// output blocks do not depend on each other, which allows to generate them
+/// in vectorizable loops with the batch functions.
+///
+/// Implements the uniform random bit generator requirements and can be used
+/// with the standard library distributions.
+///
+/// See J. K. Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+/// SC '11, doi:10.1145/2063384.2063405.
+class PhiloxEngine {
+ public:
+  using result_type = std::uint32_t;
+
+  static constexpr result_type min() { return 0u; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /// Construct the generator for a given key and stream
+  ///
+  /// @param key the key, e.g. the event and algorithm specific seed
+  /// @param stream the independent stream for this key
+  explicit PhiloxEngine(std::uint64_t key = 0u, std::uint64_t stream = 0u) {
+    seed(key, stream);
+  }
+
+  /// Construct the generator with key and stream from a seed sequence
+  template <typename seed_seq_t,
+            typename = std::enable_if_t<
+                !std::is_convertible_v<seed_seq_t, std::uint64_t>>>
+  explicit PhiloxEngine(seed_seq_t& seq) {
+    seed(seq);
+  }
+
+  /// Restart the generator at the beginning of the given stream
+  void seed(std::uint64_t key, std::uint64_t stream = 0u) {
+    m_key = {static_cast<std::uint32_t>(key),
+             static_cast<std::uint32_t>(key >> 32)};
+    m_stream = stream;
+    m_counter = 0u;
+    m_index = s_blockSize;
+  }
+
+  /// Restart the generator with key and stream from a seed sequence
+  template <typename seed_seq_t,
+            typename = std::enable_if_t<
+                !std::is_convertible_v<seed_seq_t, std::uint64_t>>>
+  void seed(seed_seq_t& seq) {
+    std::array<std::uint32_t, 4> words{};
+    seq.generate(words.begin(), words.end());
+    seed(words[0] | (std::uint64_t{words[1]} << 32),
+         words[2] | (std::uint64_t{words[3]} << 32));
+  }
+
+  /// Generate the next random number
+  result_type operator()() {
+    if (m_index == s_blockSize) {
+      m_buffer = block(m_counter++);
+      m_index = 0;
+    }
+    return m_buffer[m_index++];
+  }
+
+  /// Skip the next random numbers
+  ///
+  /// @param n the number of random numbers to skip
+  void discard(unsigned long long n) {
+    const unsigned long long buffered = s_blockSize - m_index;
+    if (n <= buffered) {
+      m_index += static_cast<unsigned int>(n);
+      return;
+    }
+    n -= buffered;
+    m_counter += n / s_blockSize;
+    m_index = s_blockSize;
+    for (n %= s_blockSize; n > 0; --n) {
+      (*this)();
+    }
+  }
+
+  /// Generate a batch of random numbers
+  ///
+  /// This yields the same numbers as calling the generator @p n times.
+  ///
+  /// @param out the output array with at least @p n elements
+  /// @param n the number of random numbers
+  void generate(result_type* out, std::size_t n) {
+    std::size_t i = 0;
+    for (; i < n && m_index < s_blockSize; ++i) {
+      out[i] = m_buffer[m_index++];
+    }
+    // the blocks only depend on the counter and can be vectorized
+    const std::size_t nBlocks = (n - i) / s_blockSize;
+    for (std::size_t b = 0; b < nBlocks; ++b) {
+      const auto values = block(m_counter + b);
+      for (std::size_t j = 0; j < s_blockSize; ++j) {
+        out[i + b * s_blockSize + j] = values[j];
+      }
+    }
+    m_counter += nBlocks;
+    for (i += nBlocks * s_blockSize; i < n; ++i) {
+      out[i] = (*this)();
+    }
+  }
+
+  /// Generate a batch of uniformly distributed numbers in [0,1)
+  ///
+  /// Each number uses two consecutive 32bit outputs.
+  ///
+  /// @param out the output array with at least @p n elements
+  /// @param n the number of random numbers
+  void uniform(double* out, std::size_t n) {
+    std::array<result_type, 2 * s_batchSize> bits{};
+    for (std::size_t i = 0; i < n; i += s_batchSize) {
+      const std::size_t m = std::min(s_batchSize, n - i);
+      generate(bits.data(), 2 * m);
+      for (std::size_t j = 0; j < m; ++j) {
+        out[i + j] = toUniform(bits[2 * j], bits[2 * j + 1]);
+      }
+    }
+  }
+
+  /// Generate a batch of standard normal distributed numbers
+  ///
+  /// Uses the Box-Muller transform on pairs of uniform numbers, the second
+  /// number of the last pair is dropped for an odd @p n.
+  ///
+  /// @param out the output array with at least @p n elements
+  /// @param n the number of random numbers
+  void normal(double* out, std::size_t n) {
+    constexpr double twoPi = 2 * M_PI;
+    std::array<double, 2 * s_batchSize> u{};
+    for (std::size_t i = 0; i < n; i += 2 * s_batchSize) {
+      const std::size_t m = std::min(2 * s_batchSize, n - i);
+      const std::size_t nPairs = (m + 1) / 2;
+      uniform(u.data(), 2 * nPairs);
+      for (std::size_t j = 0; j < nPairs; ++j) {
+        // avoid log(0)
+        const double r = std::sqrt(-2 * std::log(1. - u[2 * j]));
+        const double phi = twoPi * u[2 * j + 1];
+        u[2 * j] = r * std::cos(phi);
+        u[2 * j + 1] = r * std::sin(phi);
+      }
+      for (std::size_t j = 0; j < m; ++j) {
+        out[i + j] = u[j];
+      }
+    }
+  }
+
+  /// The key of the generator
+  std::uint64_t key() const {
+    return m_key[0] | (std::uint64_t{m_key[1]} << 32);
+  }
+  /// The independent stream of the generator
+  std::uint64_t stream() const { return m_stream; }
+
+  friend bool operator==(const PhiloxEngine& lhs, const PhiloxEngine& rhs) {
+    return lhs.m_key == rhs.m_key && lhs.m_stream == rhs.m_stream &&
+           lhs.m_counter == rhs.m_counter && lhs.m_index == rhs.m_index;
+  }
+  friend bool operator!=(const PhiloxEngine& lhs, const PhiloxEngine& rhs) {
+    return !(lhs == rhs);
+  }
+
+ private:
+  static constexpr unsigned int s_blockSize = 4;
+  static constexpr std::size_t s_batchSize = 64;
+
+  static constexpr std::uint32_t s_multiplier0 = 0xD2511F53;
+  static constexpr std::uint32_t s_multiplier1 = 0xCD9E8D57;
+  static constexpr std::uint32_t s_weyl0 = 0x9E3779B9;
+  static constexpr std::uint32_t s_weyl1 = 0xBB67AE85;
+
+  /// The four outputs for a given counter of the current stream
+  std::array<std::uint32_t, s_blockSize> block(std::uint64_t counter) const {
+    std::array<std::uint32_t, s_blockSize> c = {
+        static_cast<std::uint32_t>(counter),
+        static_cast<std::uint32_t>(counter >> 32),
+        static_cast<std::uint32_t>(m_stream),
+        static_cast<std::uint32_t>(m_stream >> 32)};
+    std::uint32_t k0 = m_key[0];
+    std::uint32_t k1 = m_key[1];
+    for (unsigned int round = 0; round < 10; ++round) {
+      const std::uint64_t p0 = std::uint64_t{s_multiplier0} * c[0];
+      const std::uint64_t p1 = std::uint64_t{s_multiplier1} * c[2];
+      c = {static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k0,
+           static_cast<std::uint32_t>(p1),
+           static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k1,
+           static_cast<std::uint32_t>(p0)};
+      k0 += s_weyl0;
+      k1 += s_weyl1;
+    }
+    return c;
+  }
+
+  /// Combine two outputs to a double with 53 random bits
+  static double toUniform(std::uint32_t a, std::uint32_t b) {
+    constexpr double scale = 1. / (std::uint64_t{1} << 53);
+    return static_cast<double>((std::uint64_t{a >> 5} << 26) | (b >> 6)) *
+           scale;
+  }
+
+  std::array<std::uint32_t, 2> m_key{};
+  std::uint64_t m_stream = 0;
+  /// counter of the next block
+  std::uint64_t m_counter = 0;
+  std::array<std::uint32_t, s_blockSize> m_buffer{};
+  /// number of used outputs of the buffered block
+  unsigned int m_index = s_blockSize;
+};
+
+}  // namespace ActsExamples
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/PhiloxEngine.hpp"
 
 #include <cstdint>
 #include <random>
@@ -55,12 +56,26 @@ class RandomNumbers {
   /// @param context is the AlgorithmContext of the host algorithm
   RandomEngine spawnGenerator(const AlgorithmContext& context) const;
 
+  /// Spawn a counter-based random number generator for one of many
+  /// independent streams of an algorithm invocation, e.g. one per particle
+  /// or module. The generator is keyed by the event and the algorithm and is
+  /// cheap to construct, such that streams can be spawned per work item for
+  /// intra-event parallelism.
+  ///
+  /// @param context is the AlgorithmContext of the host algorithm
+  /// @param stream identifies the stream within the algorithm invocation
+  PhiloxEngine spawnStream(const AlgorithmContext& context,
+                           uint64_t stream) const;
+
   /// Generate a event and algorithm specific seed value.
   ///
   /// This should only be used in special cases e.g. where a custom
   /// random engine is used and `spawnGenerator` can not be used.
   uint64_t generateSeed(const AlgorithmContext& context) const;
 
+  /// Const access to the config
+  const Config& config() const { return m_cfg; }
+
  private:
   Config m_cfg;
 };
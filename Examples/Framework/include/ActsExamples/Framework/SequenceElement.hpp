@@ -11,6 +11,7 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,16 @@ class SequenceElement {
   /// @note Usually, you should not override this method
   virtual ProcessCode internalExecute(const AlgorithmContext& context) = 0;
 
+  /// The largest number of events the element processes at once, one if it
+  /// does not support batches of events.
+  virtual std::size_t maxBatchSize() const { return 1; }
+
+  /// Internal method to execute the algorithm for a batch of events.
+  /// Executes the events one by one unless overridden.
+  /// @note Usually, you should not override this method
+  virtual ProcessCode internalExecuteBatch(
+      const std::vector<AlgorithmContext>& contexts);
+
   const std::vector<const DataHandleBase*>& writeHandles() const;
   const std::vector<const DataHandleBase*>& readHandles() const;
 
@@ -78,19 +78,96 @@ class Sequencer {
     std::string outputDir;
     /// output name of the timing file
     std::string outputTimingFile = "timing.tsv";
+    /// output name of the file with the percentiles of the per-event time of
+    /// every algorithm, which keeps the time of every algorithm and event in
+    /// memory. Empty to disable.
+    std::string outputTimingPercentilesFile = "";
+    /// output name of a Chrome trace in JSON, which shows the decorators and
+    /// sequence elements of every event on the threads they ran on and can
+    /// be opened in Perfetto. Includes the spans of the ACTS_TRACE_SPAN
+    /// instrumentation if enabled in the build. Empty to disable.
+    std::string outputTraceFile = "";
+    /// Count the heap memory allocated and freed by every decorator and
+    /// sequence element in every event, on the thread it runs on. Requires
+    /// the ActsExamplesMemoryAccounting library to be linked or preloaded.
+    bool trackMemory = false;
+    /// output name of the memory file, with the allocations per event
+    std::string outputMemoryFile = "memory.tsv";
+    /// Warn about every decorator or sequence element whose peak of the heap
+    /// memory in an event exceeds this number of bytes, zero to disable
+    std::size_t memoryPeakWarningThreshold = 0;
     /// Callback that is invoked in the event loop.
     /// @warning This function can be called from multiple threads and should therefore be thread-safe
     IterationCallback iterationCallback = []() {};
     /// Run data flow consistency checks
     /// Defaults to false right now until all components are migrated
     bool runDataFlowChecks = true;
+    /// Run the sequence elements of an event concurrently whenever they do
+    /// not depend on each other's outputs. The dependencies are derived from
+    /// the data handles, so all inputs of the elements must be declared as
+    /// read data handles. Requires the data flow checks and multi-threading,
+    /// otherwise the elements run in order.
+    bool concurrentElements = false;
+    /// Process the events in a pipeline of reader, algorithm and writer
+    /// stages with at most this number of events in flight. The readers and
+    /// the writers run for one event at a time and in event order, while the
+    /// algorithms of different events run in parallel. Zero processes every
+    /// event within a single task.
+    std::size_t maxEventsInFlight = 0;
+    /// Process the events in batches of this number of events. The sequence
+    /// elements with batch support process up to their maximum batch size of
+    /// events at once, the other elements process the events of a batch one
+    /// by one. Every event keeps its own white board. The elements of a
+    /// batch run in order, without the event pipeline and the NUMA arenas.
+    std::size_t eventBatchSize = 1;
+    /// Run the context decorators and the readers in a dedicated thread, up
+    /// to this number of events ahead of the event pipeline, such that the
+    /// threads of the event loop do not wait for the input. Uses the event
+    /// pipeline, with one event in flight per thread unless
+    /// `maxEventsInFlight` is set. The readers of an event then run in order,
+    /// also with `concurrentElements`. Zero runs the readers within the
+    /// pipeline.
+    std::size_t readAheadEvents = 0;
+    /// Give every event in flight a memory arena, released at once at the end
+    /// of the event and reused by later events. The white board and the
+    /// algorithm context allocate from it.
+    bool eventMemoryArenas = false;
+    /// Run the event loop in one task arena per NUMA node, with the threads
+    /// of an arena bound to its node. Every event is processed within a
+    /// single arena, such that the memory it allocates and first writes is
+    /// placed on that node by the first-touch policy of the kernel. Data
+    /// shared by all events, e.g. the geometry or the field map, stays on
+    /// the node it was first written on and is remote for the others.
+    /// Requires the tbbbind library of TBB and is not used by the event
+    /// pipeline.
+    bool numaArenas = false;
+    /// Directory of a binary cache of selected white board objects of every
+    /// event, empty to disable. If the cache holds all events to process, the
+    /// objects are loaded from it after the context decorators, and the
+    /// readers and algorithms whose outputs are all cached or only read by
+    /// other skipped elements do not run. Otherwise the objects are stored in
+    /// the cache at the end of every event.
+    std::string cacheDir = "";
+    /// Key of the cache, e.g. a hash of the configuration of the elements
+    /// producing the cached objects. The caches of different keys are kept
+    /// apart, the cache is not invalidated by configuration changes otherwise.
+    std::string cacheKey = "";
+    /// Names of the cached white board objects, not of their aliases
+    std::vector<std::string> cacheCollections = {};
 
     bool trackFpes = true;
     std::vector<FpeMask> fpeMasks{};
     bool failOnFirstFpe = false;
     std::size_t fpeStackTraceLength = 8;
+    /// Trap the FPEs and record their stack traces only in every n-th event.
+    /// The other events only count the FPE types raised by each element from
+    /// the floating point status flags, these are not checked against the
+    /// masks. 1 traps in all events, 0 in none.
+    std::size_t fpeTrapInterval = 1;
   };
 
+  /// @throws std::invalid_argument if the event batch size is zero or
+  ///         event batches are combined with the event pipeline
   Sequencer(const Config &cfg);
 
   /// Add a context decorator to the set of context decorators.
@@ -166,6 +243,62 @@ class Sequencer {
 
   void fpeReport() const;
 
+  /// For every sequence element the earlier elements whose outputs it reads
+  std::vector<std::vector<std::size_t>> elementDependencies() const;
+
+  /// For every sequence element whether it can be skipped when the given
+  /// objects are loaded from the cache
+  std::vector<bool> cachedElements(
+      const std::vector<std::string> &collections) const;
+
+  /// The state of the event loop of a run, shared by all events
+  struct RunState;
+  /// The white board, context and measurements of an event in flight
+  struct EventState;
+
+  /// Assign the white board slots of the data handles for a run
+  void resolveWhiteBoardSlots(RunState &run) const;
+  /// Decide on the event pipeline and the concurrency of the elements
+  void findElementDependencies(RunState &run) const;
+  /// Open the event cache and find the elements it replaces, if configured
+  void setupEventCache(RunState &run) const;
+  /// Split the elements that run into the stages of the event pipeline
+  ///
+  /// @throws SequenceConfigurationException if an element reads from a
+  ///         later stage
+  void assignPipelineStages(RunState &run) const;
+
+  /// Report the floating point exceptions of an execution of an element
+  void checkFpes(std::size_t iElement, Acts::FpeMonitor &mon);
+  /// Execute one sequence element for an event
+  void executeElement(const RunState &run, EventState &state,
+                      std::size_t iElement);
+  /// Execute one sequence element for some events of a batch at once
+  void executeElementBatch(
+      const RunState &run,
+      const std::vector<std::shared_ptr<EventState>> &states,
+      std::size_t begin, std::size_t end, std::size_t iElement);
+  /// Execute some elements of an event, in order or following their
+  /// dependencies in a flow graph within the task arena of the calling thread
+  void executeElements(const RunState &run, EventState &state,
+                       const std::vector<std::size_t> &elements,
+                       bool inOrder = false);
+  /// Create an event and decorate its context
+  std::shared_ptr<EventState> startEvent(RunState &run, std::size_t event);
+  /// Report an event and add its measurements to the ones of the run
+  void finishEvent(RunState &run, const EventState &state);
+
+  /// Run the readers, algorithms and writers as an event pipeline
+  void runPipelined(RunState &run);
+  /// Run all elements of an event within the parallel event loop
+  void runParallel(RunState &run);
+  /// Run all elements of a batch of events within the parallel event loop
+  void runBatched(RunState &run);
+  /// Print and store the timing, memory and trace of a run
+  ///
+  /// @return false if the trace can not be written
+  bool storeRunSummary(RunState &run);
+
   struct SequenceElementWithFpeResult {
     std::shared_ptr<SequenceElement> sequenceElement;
     tbb::enumerable_thread_specific<Acts::FpeMonitor::Result> fpeResult{};
@@ -13,6 +13,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <ostream>
 #include <stdexcept>
 #include <string>
@@ -30,12 +32,27 @@ namespace ActsExamples {
 /// This is an append-only container that takes ownership of the objects
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
-/// Its lifetime is bound to the lifetime of the white board.
+/// Its lifetime is bound to the lifetime of the white board. Objects can be
+/// added and read concurrently.
+///
+/// Objects with a name in the slots given at construction are stored in a
+/// flat vector. Data handles resolved to these slots access them by index,
+/// without looking up their name.
 class WhiteBoard {
  public:
+  /// The slots of the object names, shared by the white boards of all
+  /// events. Aliases share the slot of their object.
+  struct Slots {
+    std::unordered_map<std::string, std::size_t> indices;
+    std::size_t size = 0;
+  };
+
   WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
                  Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO),
-             std::unordered_map<std::string, std::string> objectAliases = {});
+             std::unordered_map<std::string, std::string> objectAliases = {},
+             std::pmr::memory_resource* memoryResource =
+                 std::pmr::get_default_resource(),
+             std::shared_ptr<const Slots> slots = nullptr);
 
   // A WhiteBoard holds unique elements and can not be copied
   WhiteBoard(const WhiteBoard& other) = delete;
@@ -43,6 +60,9 @@ class WhiteBoard {
 
   bool exists(const std::string& name) const;
 
+  /// The slots of the white board, nullptr if there are none
+  const Slots* slots() const { return m_slots.get(); }
+
  private:
   /// Store an object on the white board and transfer ownership.
   ///
@@ -60,6 +80,29 @@ class WhiteBoard {
   template <typename T>
   const T& get(const std::string& name) const;
 
+  /// Store an object in a slot of the white board
+  ///
+  /// @param slot The slot of the name
+  /// @param name Identifier of the object, for the error messages
+  /// @param object Movable reference to the transferable object
+  /// @throws std::invalid_argument if the slot is already filled
+  template <typename T>
+  void addToSlot(std::size_t slot, const std::string& name, T&& object);
+
+  /// Get access to an object stored in a slot
+  ///
+  /// @param slot The slot of the name
+  /// @param name Identifier of the object, for the error messages
+  /// @throws std::out_of_range if the slot is empty
+  template <typename T>
+  const T& getFromSlot(std::size_t slot, const std::string& name) const;
+
+  /// The type of a stored object
+  ///
+  /// @param name Identifier of the object
+  /// @return the type, nullptr if no object is stored under the name
+  const std::type_info* typeOf(const std::string& name) const;
+
  private:
   /// Find similar names for suggestions with levenshtein-distance
   std::vector<std::string_view> similarNames(const std::string_view& name,
@@ -84,9 +127,23 @@ class WhiteBoard {
   std::unique_ptr<const Acts::Logger> m_logger;
   std::unordered_map<std::string, std::shared_ptr<IHolder>> m_store;
   std::unordered_map<std::string, std::string> m_objectAliases;
+  /// allocates the object holders, must outlive the white board
+  std::pmr::memory_resource* m_memoryResource;
+  /// guards the store, as sequence elements can run concurrently
+  mutable std::mutex m_storeMutex;
+
+  std::shared_ptr<const Slots> m_slots;
+  std::vector<std::shared_ptr<IHolder>> m_slotHolders;
 
   const Acts::Logger& logger() const { return *m_logger; }
 
+  /// The slot of a name, @c m_slotHolders.size() if it has none
+  std::size_t slotIndex(const std::string& name) const;
+
+  /// Cast the object of a name to the requested type
+  template <typename T>
+  const T& value(const IHolder* holder, const std::string& name) const;
+
   static std::string typeMismatchMessage(const std::string& name,
                                          const char* req, const char* act);
 
@@ -95,24 +152,52 @@ class WhiteBoard {
 
   template <typename T>
   friend class ReadDataHandle;
+
+  friend class EventCache;
 };
 
 }  // namespace ActsExamples
 
 inline ActsExamples::WhiteBoard::WhiteBoard(
     std::unique_ptr<const Acts::Logger> logger,
-    std::unordered_map<std::string, std::string> objectAliases)
-    : m_logger(std::move(logger)), m_objectAliases(std::move(objectAliases)) {}
+    std::unordered_map<std::string, std::string> objectAliases,
+    std::pmr::memory_resource* memoryResource,
+    std::shared_ptr<const Slots> slots)
+    : m_logger(std::move(logger)),
+      m_objectAliases(std::move(objectAliases)),
+      m_memoryResource(memoryResource),
+      m_slots(std::move(slots)) {
+  if (m_slots != nullptr) {
+    m_slotHolders.resize(m_slots->size);
+  }
+}
+
+inline std::size_t ActsExamples::WhiteBoard::slotIndex(
+    const std::string& name) const {
+  if (m_slots != nullptr) {
+    if (auto it = m_slots->indices.find(name); it != m_slots->indices.end()) {
+      return it->second;
+    }
+  }
+  return m_slotHolders.size();
+}
 
 template <typename T>
 inline void ActsExamples::WhiteBoard::add(const std::string& name, T&& object) {
   if (name.empty()) {
     throw std::invalid_argument("Object can not have an empty name");
   }
+  if (std::size_t slot = slotIndex(name); slot < m_slotHolders.size()) {
+    addToSlot(slot, name, std::forward<T>(object));
+    return;
+  }
+  auto holder = std::allocate_shared<HolderT<T>>(
+      std::pmr::polymorphic_allocator<HolderT<T>>(m_memoryResource),
+      std::forward<T>(object));
+  std::lock_guard<std::mutex> lock(m_storeMutex);
   if (0 < m_store.count(name)) {
     throw std::invalid_argument("Object '" + name + "' already exists");
   }
-  auto holder = std::make_shared<HolderT<T>>(std::forward<T>(object));
   m_store.emplace(name, holder);
   ACTS_VERBOSE("Added object '" << name << "' of type " << typeid(T).name());
   if (auto it = m_objectAliases.find(name); it != m_objectAliases.end()) {
@@ -121,12 +206,55 @@ inline void ActsExamples::WhiteBoard::add(const std::string& name, T&& object) {
   }
 }
 
+template <typename T>
+inline void ActsExamples::WhiteBoard::addToSlot(std::size_t slot,
+                                                const std::string& name,
+                                                T&& object) {
+  auto holder = std::allocate_shared<HolderT<T>>(
+      std::pmr::polymorphic_allocator<HolderT<T>>(m_memoryResource),
+      std::forward<T>(object));
+  std::lock_guard<std::mutex> lock(m_storeMutex);
+  if (m_slotHolders[slot] != nullptr) {
+    throw std::invalid_argument("Object '" + name + "' already exists");
+  }
+  // the aliases of the object share its slot
+  m_slotHolders[slot] = std::move(holder);
+  ACTS_VERBOSE("Added object '" << name << "' of type " << typeid(T).name()
+                                << " to slot " << slot);
+}
+
 template <typename T>
 inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
   ACTS_VERBOSE("Attempt to get object '" << name << "' of type "
                                          << typeid(T).name());
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
+  if (std::size_t slot = slotIndex(name); slot < m_slotHolders.size()) {
+    return getFromSlot<T>(slot, name);
+  }
+  const IHolder* holder = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_storeMutex);
+    if (auto it = m_store.find(name); it != m_store.end()) {
+      holder = it->second.get();
+    }
+  }
+  return value<T>(holder, name);
+}
+
+template <typename T>
+inline const T& ActsExamples::WhiteBoard::getFromSlot(
+    std::size_t slot, const std::string& name) const {
+  const IHolder* holder = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_storeMutex);
+    holder = m_slotHolders[slot].get();
+  }
+  return value<T>(holder, name);
+}
+
+template <typename T>
+inline const T& ActsExamples::WhiteBoard::value(const IHolder* holder,
+                                                const std::string& name) const {
+  if (holder == nullptr) {
     const auto names = similarNames(name, 10, 3);
 
     std::stringstream ss;
@@ -141,19 +269,33 @@ inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
     throw std::out_of_range("Object '" + name + "' does not exists" + ss.str());
   }
 
-  const IHolder* holder = it->second.get();
-
-  const auto* castedHolder = dynamic_cast<const HolderT<T>*>(holder);
-  if (castedHolder == nullptr) {
+  // the objects are never replaced, so the type can be compared directly
+  if (holder->type() != typeid(T)) {
     std::string msg =
         typeMismatchMessage(name, typeid(T).name(), holder->type().name());
     throw std::out_of_range(msg.c_str());
   }
 
   ACTS_VERBOSE("Retrieved object '" << name << "'");
-  return castedHolder->value;
+  return static_cast<const HolderT<T>*>(holder)->value;
+}
+
+inline const std::type_info* ActsExamples::WhiteBoard::typeOf(
+    const std::string& name) const {
+  std::lock_guard<std::mutex> lock(m_storeMutex);
+  const IHolder* holder = nullptr;
+  if (std::size_t slot = slotIndex(name); slot < m_slotHolders.size()) {
+    holder = m_slotHolders[slot].get();
+  } else if (auto it = m_store.find(name); it != m_store.end()) {
+    holder = it->second.get();
+  }
+  return holder != nullptr ? &holder->type() : nullptr;
 }
 
 inline bool ActsExamples::WhiteBoard::exists(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(m_storeMutex);
+  if (std::size_t slot = slotIndex(name); slot < m_slotHolders.size()) {
+    return m_slotHolders[slot] != nullptr;
+  }
   return m_store.find(name) != m_store.end();
 }
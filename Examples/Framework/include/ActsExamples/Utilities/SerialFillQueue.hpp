@@ -0,0 +1,136 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+#include <thread>
+
+#include <tbb/concurrent_queue.h>
+#endif
+
+namespace ActsExamples {
+
+/// Fill the output of a writer on a dedicated thread
+///
+/// The writers prepare the entries of an event on their own thread, without
+/// holding a lock, and push them in one go. A single thread takes the entries
+/// from a bounded queue and passes each one to the fill function, e.g. to
+/// fill a tree or write a frame. Only this thread accesses the output until
+/// `finish` returns. A full queue blocks the writers until the thread caught
+/// up, which limits the memory of the pending entries.
+///
+/// Without TBB the sequencer runs a single thread and the entries are filled
+/// directly.
+///
+/// @tparam row_t The entry type, must be movable
+template <typename row_t>
+class SerialFillQueue {
+ public:
+  /// The function that fills one entry into the output
+  using Fill = std::function<void(row_t&)>;
+
+  /// Start the fill thread
+  ///
+  /// @param fill The function that fills one entry into the output
+  /// @param capacity The number of events that can be pending
+  explicit SerialFillQueue(Fill fill, std::size_t capacity = 64)
+      : m_fill(std::move(fill)) {
+#ifndef ACTS_EXAMPLES_NO_TBB
+    m_queue.set_capacity(static_cast<std::ptrdiff_t>(capacity));
+    m_thread = std::thread([this] { run(); });
+#else
+    static_cast<void>(capacity);
+#endif
+  }
+
+  SerialFillQueue(const SerialFillQueue&) = delete;
+  SerialFillQueue& operator=(const SerialFillQueue&) = delete;
+
+  /// Stop the fill thread, pending entries are still filled
+  ~SerialFillQueue() {
+    try {
+      finish();
+    } catch (...) {
+      // errors of the fill function can only be reported by `finish`
+    }
+  }
+
+  /// Queue the entries of an event, can be called from any thread
+  ///
+  /// The entries of an event are filled consecutively.
+  void push(std::vector<row_t> rows) {
+    if (rows.empty()) {
+      // an empty batch stops the fill thread
+      return;
+    }
+#ifndef ACTS_EXAMPLES_NO_TBB
+    m_queue.push(std::move(rows));
+#else
+    fill(rows);
+#endif
+  }
+
+  /// Fill all pending entries and stop the fill thread
+  ///
+  /// Must be called before the output is closed, no entries can be queued
+  /// afterwards.
+  ///
+  /// @throws The first exception thrown by the fill function
+  void finish() {
+#ifndef ACTS_EXAMPLES_NO_TBB
+    if (m_thread.joinable()) {
+      m_queue.push({});
+      m_thread.join();
+    }
+#endif
+    if (m_error) {
+      std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+  }
+
+ private:
+  void fill(std::vector<row_t>& rows) {
+    if (m_error) {
+      return;
+    }
+    try {
+      for (row_t& row : rows) {
+        m_fill(row);
+      }
+    } catch (...) {
+      m_error = std::current_exception();
+    }
+  }
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+  void run() {
+    std::vector<row_t> rows;
+    while (true) {
+      m_queue.pop(rows);
+      if (rows.empty()) {
+        break;
+      }
+      fill(rows);
+    }
+  }
+
+  tbb::concurrent_bounded_queue<std::vector<row_t>> m_queue;
+  std::thread m_thread;
+#endif
+  Fill m_fill;
+  std::exception_ptr m_error;
+};
+
+}  // namespace ActsExamples
@@ -88,6 +88,13 @@ class DuplicationPlotTool {
   /// @param duplicationPlotCache cache object for duplication plots
   void write(const DuplicationPlotCache& duplicationPlotCache) const;
 
+  /// @brief add the duplication plots of another cache to this one
+  ///
+  /// @param duplicationPlotCache cache object the plots are added to
+  /// @param other cache object with the same booking, e.g. filled on another
+  ///        thread
+  void merge(DuplicationPlotCache& duplicationPlotCache, const DuplicationPlotCache& other) const;
+
   /// @brief delete the duplication plots
   ///
   /// @param duplicationPlotCache cache object for duplication plots
@@ -73,6 +73,13 @@ class EffPlotTool {
   /// @param effPlotCache cache object for efficiency plots
   void write(const EffPlotCache& effPlotCache) const;
 
+  /// @brief add the efficiency plots of another cache to this one
+  ///
+  /// @param effPlotCache cache object the plots are added to
+  /// @param other cache object with the same booking, e.g. filled on another
+  ///        thread
+  void merge(EffPlotCache& effPlotCache, const EffPlotCache& other) const;
+
   /// @brief delete the efficiency plots
   ///
   /// @param effPlotCache cache object for efficiency plots
@@ -94,6 +94,13 @@ class FakeRatePlotTool {
   /// @param fakeRatePlotCache cache object for fake rate plots
   void write(const FakeRatePlotCache& fakeRatePlotCache) const;
 
+  /// @brief add the fake rate plots of another cache to this one
+  ///
+  /// @param fakeRatePlotCache cache object the plots are added to
+  /// @param other cache object with the same booking, e.g. filled on another
+  ///        thread
+  void merge(FakeRatePlotCache& fakeRatePlotCache, const FakeRatePlotCache& other) const;
+
   /// @brief delete the fake rate plots
   ///
   /// @param fakeRatePlotCache cache object for fake rate plots
@@ -0,0 +1,103 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <mutex>
+
+#include <TDirectory.h>
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
+namespace ActsExamples {
+
+/// Per-thread copies of the plots of a plot tool.
+///
+/// Every thread fills its own cache, booked on first use, such that filling
+/// does not require a lock; only the booking itself is serialized. The copies
+/// are detached from any ROOT directory and are added to the cache that is
+/// actually written with `mergeInto` once all events are processed.
+///
+/// @tparam tool_t plot tool type providing book, merge and clear
+/// @tparam cache_t the cache type of the plot tool
+template <typename tool_t, typename cache_t>
+class ThreadLocalPlotCache {
+ public:
+  /// @param tool the plot tool, must outlive this object
+  explicit ThreadLocalPlotCache(const tool_t& tool) : m_tool(&tool) {}
+
+  ThreadLocalPlotCache(const ThreadLocalPlotCache&) = delete;
+  ThreadLocalPlotCache& operator=(const ThreadLocalPlotCache&) = delete;
+
+  ~ThreadLocalPlotCache() {
+#ifndef ACTS_EXAMPLES_NO_TBB
+    for (auto& slot : m_caches) {
+      if (slot.booked) {
+        m_tool->clear(slot.cache);
+      }
+    }
+#else
+    if (m_slot.booked) {
+      m_tool->clear(m_slot.cache);
+    }
+#endif
+  }
+
+  /// The cache of the calling thread.
+  cache_t& local() {
+#ifndef ACTS_EXAMPLES_NO_TBB
+    Slot& slot = m_caches.local();
+#else
+    Slot& slot = m_slot;
+#endif
+    if (!slot.booked) {
+      // booking toggles global ROOT state, e.g. in the TEfficiency constructor
+      static std::mutex bookMutex;
+      std::lock_guard lock(bookMutex);
+      // keep the copy out of the output file
+      TDirectory::TContext context{nullptr};
+      m_tool->book(slot.cache);
+      slot.booked = true;
+    }
+    return slot.cache;
+  }
+
+  /// Add the plots of all threads to the given cache.
+  ///
+  /// Must not be called concurrently with `local`.
+  void mergeInto(cache_t& target) const {
+#ifndef ACTS_EXAMPLES_NO_TBB
+    for (const auto& slot : m_caches) {
+      if (slot.booked) {
+        m_tool->merge(target, slot.cache);
+      }
+    }
+#else
+    if (m_slot.booked) {
+      m_tool->merge(target, m_slot.cache);
+    }
+#endif
+  }
+
+ private:
+  struct Slot {
+    cache_t cache{};
+    bool booked = false;
+  };
+
+  const tool_t* m_tool;
+#ifndef ACTS_EXAMPLES_NO_TBB
+  tbb::enumerable_thread_specific<Slot> m_caches;
+#else
+  Slot m_slot;
+#endif
+};
+
+}  // namespace ActsExamples
@@ -17,6 +17,8 @@
 #include <utility>
 #include <vector>
 
+#include <boost/container/flat_map.hpp>
+
 namespace ActsExamples {
 struct Trajectories;
 
@@ -62,4 +64,11 @@ void identifyContributingParticles(
     const ConstTrackContainer::ConstTrackProxy& track,
     std::vector<ParticleHitCount>& particleHitCounts);
 
+/// Count the hits generated by each particle.
+///
+/// @param[in] hitParticlesMap Map hit indices to contributing particles
+/// @return The number of hits for each particle
+boost::container::flat_map<ActsFatras::Barcode, std::size_t> countParticleHits(
+    const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap);
+
 }  // namespace ActsExamples
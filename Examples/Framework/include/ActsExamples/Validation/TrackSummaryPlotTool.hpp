@@ -80,6 +80,13 @@ class TrackSummaryPlotTool {
   /// @param trackSummaryPlotCache cache object for track info plots
   void write(const TrackSummaryPlotCache& trackSummaryPlotCache) const;
 
+  /// @brief add the track info plots of another cache to this one
+  ///
+  /// @param trackSummaryPlotCache cache object the plots are added to
+  /// @param other cache object with the same booking, e.g. filled on another
+  ///        thread
+  void merge(TrackSummaryPlotCache& trackSummaryPlotCache, const TrackSummaryPlotCache& other) const;
+
   /// @brief delete the track info plots
   ///
   /// @param trackSummaryPlotCache cache object for track info plots
@@ -0,0 +1,135 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/EventData/IndexSourceLinkWindowAccessor.hpp"
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <variant>
+
+#include <boost/container/container_fwd.hpp>
+
+ActsExamples::IndexSourceLinkWindowAccessor::IndexSourceLinkWindowAccessor(
+    const IndexSourceLinkContainer& sourceLinks,
+    const MeasurementContainer& measurements, double nSigma)
+    : m_nSigma(nSigma) {
+  const std::size_t nSourceLinks = sourceLinks.size();
+  std::vector<IndexSourceLink> sorted;
+  sorted.reserve(nSourceLinks);
+  m_loc0.reserve(nSourceLinks);
+  m_maxVariance.reserve(nSourceLinks);
+
+  std::vector<double> loc0(nSourceLinks);
+  std::vector<double> variance(nSourceLinks);
+  for (std::size_t i = 0; i < nSourceLinks; ++i) {
+    const IndexSourceLink& sourceLink = *sourceLinks.nth(i);
+    assert(sourceLink.index() < measurements.size());
+    loc0[i] = std::numeric_limits<double>::quiet_NaN();
+    variance[i] = std::numeric_limits<double>::infinity();
+    std::visit(
+        [&](const auto& measurement) {
+          const auto indices = measurement.indices();
+          for (std::size_t k = 0; k < indices.size(); ++k) {
+            if (indices[k] == Acts::eBoundLoc0) {
+              loc0[i] = measurement.parameters()[k];
+              variance[i] = measurement.covariance()(k, k);
+            }
+          }
+        },
+        measurements[sourceLink.index()]);
+  }
+
+  // The source links of a surface are contiguous in the container
+  std::vector<std::size_t> order;
+  for (std::size_t begin = 0; begin < nSourceLinks;) {
+    const auto geometryId = sourceLinks.nth(begin)->geometryId();
+    std::size_t end = begin + 1;
+    while (end < nSourceLinks &&
+           sourceLinks.nth(end)->geometryId() == geometryId) {
+      ++end;
+    }
+
+    order.resize(end - begin);
+    std::iota(order.begin(), order.end(), begin);
+    bool measuresLoc0 = true;
+    double maxVariance = 0.;
+    for (std::size_t i : order) {
+      measuresLoc0 = measuresLoc0 && !std::isnan(loc0[i]);
+      maxVariance = std::max(maxVariance, variance[i]);
+    }
+    if (measuresLoc0) {
+      std::stable_sort(order.begin(), order.end(),
+                       [&](std::size_t a, std::size_t b) {
+                         return loc0[a] < loc0[b];
+                       });
+    } else {
+      maxVariance = std::numeric_limits<double>::infinity();
+    }
+
+    for (std::size_t i : order) {
+      sorted.push_back(*sourceLinks.nth(i));
+      m_loc0.push_back(loc0[i]);
+      m_maxVariance.push_back(maxVariance);
+    }
+    begin = end;
+  }
+
+  // The order of the surfaces is unchanged
+  m_sourceLinks = IndexSourceLinkContainer(boost::container::ordered_range,
+                                           sorted.begin(), sorted.end());
+  m_ranges = GeometryIdRangeTable<IndexSourceLink>(m_sourceLinks);
+}
+
+std::pair<ActsExamples::IndexSourceLinkWindowAccessor::Iterator,
+          ActsExamples::IndexSourceLinkWindowAccessor::Iterator>
+ActsExamples::IndexSourceLinkWindowAccessor::range(
+    const Acts::Surface& surface) const {
+  auto [begin, end] = m_ranges.equal_range(m_sourceLinks, surface.geometryId());
+  return {Iterator{begin}, Iterator{end}};
+}
+
+std::pair<ActsExamples::IndexSourceLinkWindowAccessor::Iterator,
+          ActsExamples::IndexSourceLinkWindowAccessor::Iterator>
+ActsExamples::IndexSourceLinkWindowAccessor::window(
+    const Acts::BoundTrackParameters& predicted, Iterator begin,
+    Iterator end) const {
+  if (begin == end || !predicted.covariance().has_value()) {
+    return {begin, end};
+  }
+
+  const std::size_t first = begin.m_iterator - m_sourceLinks.begin();
+  const double variance = m_maxVariance[first] +
+                          (*predicted.covariance())(Acts::eBoundLoc0,
+                                                    Acts::eBoundLoc0);
+  if (!std::isfinite(variance)) {
+    return {begin, end};
+  }
+  const double center = predicted.parameters()[Acts::eBoundLoc0];
+  const double halfWidth = m_nSigma * std::sqrt(variance);
+
+  const auto loc0Begin = m_loc0.begin() + first;
+  const auto loc0End = loc0Begin + (end - begin);
+  auto lower = std::lower_bound(loc0Begin, loc0End, center - halfWidth);
+  auto upper = std::upper_bound(lower, loc0End, center + halfWidth);
+  if (lower == upper) {
+    if (lower == loc0End ||
+        (lower != loc0Begin && center - *(lower - 1) < *lower - center)) {
+      --lower;
+    }
+    upper = lower + 1;
+  }
+
+  return {Iterator{begin.m_iterator + (lower - loc0Begin)},
+          Iterator{begin.m_iterator + (upper - loc0Begin)}};
+}
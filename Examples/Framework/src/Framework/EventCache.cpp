@@ -0,0 +1,599 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/EventCache.hpp"
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/EventData/SimVertex.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#include <boost/container/container_fwd.hpp>
+
+namespace ActsExamples {
+
+namespace {
+
+using BoundMeasurement = Acts::BoundVariantMeasurement;
+
+constexpr std::string_view kMagic = "ACTSEVC1";
+
+// fixed-size values, in the native byte order
+
+template <typename T>
+void write(std::ostream& os, const T& value) {
+  static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read(std::istream& is) {
+  static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+  T value{};
+  is.read(reinterpret_cast<char*>(&value), sizeof(T));
+  if (!is) {
+    throw std::runtime_error("Unexpected end of the cache file");
+  }
+  return value;
+}
+
+// the number of elements of a container, whose elements take at least
+// `minElementSize` bytes each. A size which does not fit into the rest of the
+// stream is rejected before anything is allocated for it.
+std::size_t readSize(std::istream& is, std::size_t minElementSize) {
+  auto size = read<std::uint64_t>(is);
+  auto position = is.tellg();
+  is.seekg(0, std::ios::end);
+  auto end = is.tellg();
+  is.seekg(position);
+  if (position < 0 || end < position ||
+      size > static_cast<std::uint64_t>(end - position) / minElementSize) {
+    throw std::runtime_error("Invalid container size in the cache file");
+  }
+  return size;
+}
+
+void writeString(std::ostream& os, std::string_view str) {
+  write<std::uint64_t>(os, str.size());
+  os.write(str.data(), str.size());
+}
+
+std::string readString(std::istream& is) {
+  std::string str(readSize(is, 1), '\0');
+  is.read(str.data(), str.size());
+  if (!is) {
+    throw std::runtime_error("Unexpected end of the cache file");
+  }
+  return str;
+}
+
+template <typename matrix_t>
+void writeMatrix(std::ostream& os, const matrix_t& matrix) {
+  static_assert(matrix_t::SizeAtCompileTime != Eigen::Dynamic);
+  for (Eigen::Index i = 0; i < matrix.size(); ++i) {
+    write(os, matrix.data()[i]);
+  }
+}
+
+template <typename matrix_t>
+matrix_t readMatrix(std::istream& is) {
+  static_assert(matrix_t::SizeAtCompileTime != Eigen::Dynamic);
+  matrix_t matrix;
+  for (Eigen::Index i = 0; i < matrix.size(); ++i) {
+    matrix.data()[i] = read<typename matrix_t::Scalar>(is);
+  }
+  return matrix;
+}
+
+template <typename T>
+void writeOptional(std::ostream& os, const std::optional<T>& value) {
+  write<std::uint8_t>(os, value.has_value());
+  if (value) {
+    write(os, *value);
+  }
+}
+
+template <typename T>
+std::optional<T> readOptional(std::istream& is) {
+  if (read<std::uint8_t>(is) == 0) {
+    return std::nullopt;
+  }
+  return read<T>(is);
+}
+
+void writeSourceLink(std::ostream& os, const Acts::SourceLink& sourceLink) {
+  const auto& indexSourceLink = sourceLink.get<IndexSourceLink>();
+  write(os, indexSourceLink.geometryId().value());
+  write(os, indexSourceLink.index());
+}
+
+IndexSourceLink readIndexSourceLink(std::istream& is) {
+  auto geometryId = read<Acts::GeometryIdentifier::Value>(is);
+  auto index = read<Index>(is);
+  return IndexSourceLink(geometryId, index);
+}
+
+// the elements of the containers
+
+void writeElement(std::ostream& os, const SimParticle& particle) {
+  write(os, particle.particleId().value());
+  write(os, particle.process());
+  write(os, particle.pdg());
+  write(os, particle.charge());
+  write(os, particle.mass());
+  writeMatrix(os, particle.fourPosition());
+  writeMatrix(os, particle.direction());
+  write(os, particle.absoluteMomentum());
+  write(os, particle.properTime());
+  write(os, particle.pathInX0());
+  write(os, particle.pathInL0());
+  write(os, particle.numberOfHits());
+  write(os, particle.outcome());
+}
+
+void readElement(std::istream& is, SimParticle& particle) {
+  using Scalar = SimParticle::Scalar;
+  SimBarcode particleId(read<SimBarcode::Value>(is));
+  auto process = read<ActsFatras::ProcessType>(is);
+  auto pdg = read<Acts::PdgParticle>(is);
+  auto charge = read<Scalar>(is);
+  auto mass = read<Scalar>(is);
+  particle = SimParticle(particleId, pdg, charge, mass);
+  particle.setProcess(process);
+  particle.setPosition4(readMatrix<SimParticle::Vector4>(is));
+  particle.setDirection(readMatrix<SimParticle::Vector3>(is));
+  particle.setAbsoluteMomentum(read<Scalar>(is));
+  particle.setProperTime(read<Scalar>(is));
+  auto pathInX0 = read<Scalar>(is);
+  auto pathInL0 = read<Scalar>(is);
+  particle.setMaterialPassed(pathInX0, pathInL0);
+  particle.setNumberOfHits(read<std::uint32_t>(is));
+  particle.setOutcome(read<ActsFatras::ParticleOutcome>(is));
+}
+
+void writeElement(std::ostream& os, const SimVertex& vertex) {
+  write(os, vertex.id.value());
+  writeMatrix(os, vertex.position4);
+  write(os, vertex.process);
+  for (const auto* barcodes : {&vertex.incoming, &vertex.outgoing}) {
+    write<std::uint64_t>(os, barcodes->size());
+    for (const SimBarcode& barcode : *barcodes) {
+      write(os, barcode.value());
+    }
+  }
+}
+
+void readElement(std::istream& is, SimVertex& vertex) {
+  vertex.id = SimVertexBarcode(read<SimVertexBarcode::Value>(is));
+  vertex.position4 = readMatrix<SimVertex::Vector4>(is);
+  vertex.process = read<ActsFatras::ProcessType>(is);
+  for (auto* barcodes : {&vertex.incoming, &vertex.outgoing}) {
+    std::vector<SimBarcode> values(
+        readSize(is, sizeof(SimBarcode::Value)));
+    for (SimBarcode& barcode : values) {
+      barcode = SimBarcode(read<SimBarcode::Value>(is));
+    }
+    barcodes->insert(boost::container::ordered_unique_range, values.begin(),
+                     values.end());
+  }
+}
+
+void writeElement(std::ostream& os, const SimHit& hit) {
+  write(os, hit.geometryId().value());
+  write(os, hit.particleId().value());
+  writeMatrix(os, hit.fourPosition());
+  writeMatrix(os, hit.momentum4Before());
+  writeMatrix(os, hit.momentum4After());
+  write(os, hit.index());
+}
+
+void readElement(std::istream& is, SimHit& hit) {
+  using Vector4 = SimHit::Vector4;
+  auto geometryId = read<Acts::GeometryIdentifier::Value>(is);
+  SimBarcode particleId(read<SimBarcode::Value>(is));
+  auto pos4 = readMatrix<Vector4>(is);
+  auto before4 = readMatrix<Vector4>(is);
+  auto after4 = readMatrix<Vector4>(is);
+  auto index = read<std::int32_t>(is);
+  hit = SimHit(geometryId, particleId, pos4, before4, after4, index);
+}
+
+void writeElement(std::ostream& os, const IndexSourceLink& sourceLink) {
+  write(os, sourceLink.geometryId().value());
+  write(os, sourceLink.index());
+}
+
+void readElement(std::istream& is, IndexSourceLink& sourceLink) {
+  sourceLink = readIndexSourceLink(is);
+}
+
+template <typename value_t>
+void writeElement(std::ostream& os, const std::pair<Index, value_t>& entry) {
+  write(os, entry.first);
+  if constexpr (std::is_arithmetic_v<value_t>) {
+    write(os, entry.second);
+  } else {
+    write(os, entry.second.value());
+  }
+}
+
+template <typename value_t>
+void readElement(std::istream& is, std::pair<Index, value_t>& entry) {
+  entry.first = read<Index>(is);
+  if constexpr (std::is_arithmetic_v<value_t>) {
+    entry.second = read<value_t>(is);
+  } else {
+    entry.second = value_t(read<typename value_t::Value>(is));
+  }
+}
+
+void writeElement(std::ostream& os, const BoundMeasurement& measurement) {
+  write<std::uint8_t>(os, measurement.index());
+  std::visit(
+      [&](const auto& meas) {
+        writeSourceLink(os, meas.sourceLink());
+        for (auto index : meas.indices()) {
+          write(os, index);
+        }
+        writeMatrix(os, meas.parameters());
+        writeMatrix(os, meas.covariance());
+      },
+      measurement);
+}
+
+template <std::size_t kSize>
+BoundMeasurement readMeasurement(std::istream& is) {
+  using FixedMeasurement = Acts::Measurement<Acts::BoundIndices, kSize>;
+  Acts::SourceLink sourceLink(readIndexSourceLink(is));
+  std::array<Acts::BoundIndices, kSize> indices{};
+  for (auto& index : indices) {
+    index = read<Acts::BoundIndices>(is);
+  }
+  auto parameters = readMatrix<typename FixedMeasurement::ParametersVector>(is);
+  auto covariance = readMatrix<typename FixedMeasurement::CovarianceMatrix>(is);
+  return FixedMeasurement(std::move(sourceLink), indices, parameters,
+                          covariance);
+}
+
+template <std::size_t... kIndices>
+BoundMeasurement readMeasurement(std::istream& is, std::size_t index,
+                                 std::index_sequence<kIndices...> /*indices*/) {
+  using Reader = BoundMeasurement (*)(std::istream&);
+  // the alternative i of the variant holds a measurement of size i + 1
+  static constexpr std::array<Reader, sizeof...(kIndices)> readers = {
+      &readMeasurement<kIndices + 1>...};
+  if (index >= readers.size()) {
+    throw std::runtime_error("Invalid measurement in the cache file");
+  }
+  return readers[index](is);
+}
+
+void readElement(std::istream& is,
+                 std::optional<BoundMeasurement>& measurement) {
+  std::size_t index = read<std::uint8_t>(is);
+  measurement = readMeasurement(
+      is, index,
+      std::make_index_sequence<std::variant_size_v<BoundMeasurement>>());
+}
+
+void writeElement(std::ostream& os, const SimSpacePoint& spacePoint) {
+  write(os, spacePoint.x());
+  write(os, spacePoint.y());
+  write(os, spacePoint.z());
+  writeOptional(os, spacePoint.t());
+  write(os, spacePoint.varianceR());
+  write(os, spacePoint.varianceZ());
+  writeOptional(os, spacePoint.varianceT());
+  write<std::uint8_t>(os, spacePoint.sourceLinks().size());
+  for (const Acts::SourceLink& sourceLink : spacePoint.sourceLinks()) {
+    writeSourceLink(os, sourceLink);
+  }
+  write<std::uint8_t>(os, spacePoint.validDoubleMeasurementDetails());
+  if (spacePoint.validDoubleMeasurementDetails()) {
+    write(os, spacePoint.topHalfStripLength());
+    write(os, spacePoint.bottomHalfStripLength());
+    writeMatrix(os, spacePoint.topStripDirection());
+    writeMatrix(os, spacePoint.bottomStripDirection());
+    writeMatrix(os, spacePoint.stripCenterDistance());
+    writeMatrix(os, spacePoint.topStripCenterPosition());
+  }
+}
+
+void readElement(std::istream& is, std::optional<SimSpacePoint>& spacePoint) {
+  using Scalar = Acts::ActsScalar;
+  Acts::Vector3 position;
+  position[Acts::ePos0] = read<Scalar>(is);
+  position[Acts::ePos1] = read<Scalar>(is);
+  position[Acts::ePos2] = read<Scalar>(is);
+  auto t = readOptional<Scalar>(is);
+  auto varianceR = read<Scalar>(is);
+  auto varianceZ = read<Scalar>(is);
+  auto varianceT = readOptional<Scalar>(is);
+  std::size_t nSourceLinks = read<std::uint8_t>(is);
+  boost::container::static_vector<Acts::SourceLink, 2> sourceLinks;
+  if (nSourceLinks > sourceLinks.capacity()) {
+    throw std::runtime_error("Invalid space point in the cache file");
+  }
+  for (std::size_t i = 0; i < nSourceLinks; ++i) {
+    sourceLinks.emplace_back(readIndexSourceLink(is));
+  }
+  if (read<std::uint8_t>(is) == 0) {
+    spacePoint.emplace(position, t, varianceR, varianceZ, varianceT,
+                       std::move(sourceLinks));
+    return;
+  }
+  auto topHalfStripLength = read<float>(is);
+  auto bottomHalfStripLength = read<float>(is);
+  auto topStripDirection = readMatrix<Acts::Vector3>(is);
+  auto bottomStripDirection = readMatrix<Acts::Vector3>(is);
+  auto stripCenterDistance = readMatrix<Acts::Vector3>(is);
+  auto topStripCenterPosition = readMatrix<Acts::Vector3>(is);
+  spacePoint.emplace(position, t, varianceR, varianceZ, varianceT,
+                     std::move(sourceLinks), topHalfStripLength,
+                     bottomHalfStripLength, topStripDirection,
+                     bottomStripDirection, stripCenterDistance,
+                     topStripCenterPosition);
+}
+
+void writeElement(std::ostream& os, const ProtoTrack& protoTrack) {
+  write<std::uint64_t>(os, protoTrack.size());
+  for (Index index : protoTrack) {
+    write(os, index);
+  }
+}
+
+void readElement(std::istream& is, ProtoTrack& protoTrack) {
+  protoTrack.resize(readSize(is, sizeof(Index)));
+  for (Index& index : protoTrack) {
+    index = read<Index>(is);
+  }
+}
+
+// the containers, the sorted ones are read back without sorting them again
+
+template <typename container_t>
+void writeObject(std::ostream& os, const container_t& container) {
+  write<std::uint64_t>(os, container.size());
+  for (const auto& element : container) {
+    writeElement(os, element);
+  }
+}
+
+template <typename element_t>
+std::vector<element_t> readElements(std::istream& is) {
+  // every element takes at least one byte
+  std::vector<element_t> elements(readSize(is, 1));
+  for (element_t& element : elements) {
+    readElement(is, element);
+  }
+  return elements;
+}
+
+template <typename container_t>
+void readObject(std::istream& is, container_t& container) {
+  auto elements = readElements<typename container_t::value_type>(is);
+  if constexpr (std::is_same_v<container_t, SimParticleContainer> ||
+                std::is_same_v<container_t, SimVertexContainer>) {
+    container.insert(boost::container::ordered_unique_range, elements.begin(),
+                     elements.end());
+  } else {
+    container.insert(boost::container::ordered_range, elements.begin(),
+                     elements.end());
+  }
+}
+
+// the elements without a default constructor
+
+template <typename element_t>
+void readObject(std::istream& is, std::vector<element_t>& container) {
+  auto elements = readElements<std::optional<element_t>>(is);
+  container.reserve(elements.size());
+  for (auto& element : elements) {
+    container.push_back(std::move(*element));
+  }
+}
+
+void readObject(std::istream& is, ProtoTrackContainer& container) {
+  container = readElements<ProtoTrack>(is);
+}
+
+}  // namespace
+
+struct EventCache::Codec {
+  std::string tag;
+  std::function<void(std::ostream&, const WhiteBoard&, const std::string&)>
+      store;
+  std::function<void(std::istream&, WhiteBoard&, const std::string&)> load;
+};
+
+class EventCache::Registry {
+ public:
+  Registry() {
+    add<SimParticleContainer>("SimParticleContainer");
+    add<SimVertexContainer>("SimVertexContainer");
+    add<SimHitContainer>("SimHitContainer");
+    add<HitParticlesMap>("HitParticlesMap");
+    add<HitSimHitsMap>("HitSimHitsMap");
+    add<IndexSourceLinkContainer>("IndexSourceLinkContainer");
+    add<MeasurementContainer>("MeasurementContainer");
+    add<SimSpacePointContainer>("SimSpacePointContainer");
+    add<ProtoTrackContainer>("ProtoTrackContainer");
+  }
+
+  const Codec* find(const std::type_info& type) const {
+    auto it = m_byType.find(type);
+    return it != m_byType.end() ? &it->second : nullptr;
+  }
+
+  const Codec* find(const std::string& tag) const {
+    auto it = m_byTag.find(tag);
+    return it != m_byTag.end() ? it->second : nullptr;
+  }
+
+ private:
+  template <typename T>
+  void add(std::string tag) {
+    Codec codec;
+    codec.tag = tag;
+    codec.store = [](std::ostream& os, const WhiteBoard& wb,
+                     const std::string& name) {
+      writeObject(os, wb.get<T>(name));
+    };
+    codec.load = [](std::istream& is, WhiteBoard& wb, const std::string& name) {
+      T object;
+      readObject(is, object);
+      wb.add(name, std::move(object));
+    };
+    auto [it, inserted] = m_byType.emplace(typeid(T), std::move(codec));
+    m_byTag.emplace(std::move(tag), &it->second);
+  }
+
+  std::unordered_map<std::type_index, Codec> m_byType;
+  std::unordered_map<std::string, const Codec*> m_byTag;
+};
+
+const EventCache::Registry& EventCache::registry() {
+  static const Registry registry;
+  return registry;
+}
+
+EventCache::EventCache(const Config& cfg, Acts::Logging::Level level)
+    : m_cfg(cfg),
+      m_directory(m_cfg.key.empty() ? m_cfg.directory
+                                    : joinPaths(m_cfg.directory, m_cfg.key)),
+      m_logger(Acts::getDefaultLogger("EventCache", level)) {
+  if (m_cfg.directory.empty()) {
+    throw std::invalid_argument("Missing cache directory");
+  }
+  if (m_cfg.collections.empty()) {
+    throw std::invalid_argument("Missing cached collections");
+  }
+}
+
+bool EventCache::isSupported(const std::type_info& type) {
+  return registry().find(type) != nullptr;
+}
+
+std::string EventCache::path(std::size_t event) const {
+  return perEventFilepath(m_directory, "cache.bin", event);
+}
+
+bool EventCache::contains(std::size_t event) const {
+  return std::filesystem::is_regular_file(path(event));
+}
+
+void EventCache::store(std::size_t event, const WhiteBoard& wb) const {
+  std::filesystem::create_directories(m_directory);
+
+  // write to a temporary file first, such that an interrupted run does not
+  // leave an incomplete cache file behind
+  std::string file = path(event);
+  std::string tmpFile = file + ".tmp";
+  {
+    std::ofstream os(tmpFile, std::ios::binary | std::ios::trunc);
+    os.write(kMagic.data(), kMagic.size());
+    writeString(os, m_cfg.key);
+    write<std::uint64_t>(os, event);
+    write<std::uint64_t>(os, m_cfg.collections.size());
+    for (const std::string& name : m_cfg.collections) {
+      const std::type_info* type = wb.typeOf(name);
+      if (type == nullptr) {
+        throw std::runtime_error("Cached object '" + name +
+                                 "' does not exist in event " +
+                                 std::to_string(event));
+      }
+      const Codec* codec = registry().find(*type);
+      if (codec == nullptr) {
+        throw std::runtime_error("Cached object '" + name +
+                                 "' has the unsupported type " +
+                                 type->name());
+      }
+      // the payload is prefixed by its size, such that it can be skipped
+      std::ostringstream payload;
+      codec->store(payload, wb, name);
+      writeString(os, name);
+      writeString(os, codec->tag);
+      writeString(os, payload.str());
+    }
+    if (!os) {
+      throw std::runtime_error("Unable to write the cache file " + tmpFile);
+    }
+  }
+  std::filesystem::rename(tmpFile, file);
+  ACTS_VERBOSE("Stored " << m_cfg.collections.size() << " objects of event "
+                         << event << " in " << file);
+}
+
+void EventCache::load(std::size_t event, WhiteBoard& wb,
+                      const std::vector<std::string>& names) const {
+  std::string file = path(event);
+  std::ifstream is(file, std::ios::binary);
+  if (!is) {
+    throw std::runtime_error("Unable to open the cache file " + file);
+  }
+  std::array<char, kMagic.size()> magic{};
+  is.read(magic.data(), magic.size());
+  if (!is || std::string_view(magic.data(), magic.size()) != kMagic) {
+    throw std::runtime_error("Invalid cache file " + file);
+  }
+  if (readString(is) != m_cfg.key || read<std::uint64_t>(is) != event) {
+    throw std::runtime_error("Cache file " + file +
+                             " belongs to another key or event");
+  }
+
+  std::size_t nLoaded = 0;
+  std::uint64_t nObjects = read<std::uint64_t>(is);
+  for (std::uint64_t i = 0; i < nObjects; ++i) {
+    std::string name = readString(is);
+    std::string tag = readString(is);
+    std::string payload = readString(is);
+    if (std::find(names.begin(), names.end(), name) == names.end()) {
+      continue;
+    }
+    const Codec* codec = registry().find(tag);
+    if (codec == nullptr) {
+      throw std::runtime_error("Cached object '" + name +
+                               "' has the unknown type " + tag);
+    }
+    std::istringstream payloadStream(payload);
+    codec->load(payloadStream, wb, name);
+    ++nLoaded;
+  }
+  if (nLoaded != names.size()) {
+    throw std::runtime_error("Cache file " + file +
+                             " lacks some of the cached objects");
+  }
+  ACTS_VERBOSE("Loaded " << nLoaded << " objects of event " << event
+                         << " from " << file);
+}
+
+}  // namespace ActsExamples
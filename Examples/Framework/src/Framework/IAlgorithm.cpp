@@ -9,6 +9,7 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
 
 #include <utility>
 
@@ -22,4 +23,14 @@ std::string ActsExamples::IAlgorithm::name() const {
   return m_name;
 }
 
+ProcessCode IAlgorithm::executeBatch(
+    const std::vector<AlgorithmContext>& contexts) const {
+  for (const AlgorithmContext& context : contexts) {
+    if (ProcessCode code = execute(context); code != ProcessCode::SUCCESS) {
+      return code;
+    }
+  }
+  return ProcessCode::SUCCESS;
+}
+
 }  // namespace ActsExamples
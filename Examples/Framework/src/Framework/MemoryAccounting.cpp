@@ -0,0 +1,45 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/MemoryAccounting.hpp"
+
+#include <new>
+
+namespace {
+// trivial type, usable from the allocation functions at any time
+thread_local ActsExamples::MemoryCounters* t_counters = nullptr;
+}  // namespace
+
+bool ActsExamples::memoryAccountingAvailable() {
+  // only the replaced allocation functions count into the thread's counters.
+  // The pointer is volatile, such that the allocation is not elided.
+  static const bool available = [] {
+    MemoryCounters counters;
+    {
+      ScopedMemoryCounter counter(counters);
+      void* volatile ptr = ::operator new(1);
+      ::operator delete(ptr);
+    }
+    return counters.allocations > 0;
+  }();
+  return available;
+}
+
+ActsExamples::MemoryCounters* ActsExamples::currentMemoryCounters() noexcept {
+  return t_counters;
+}
+
+ActsExamples::ScopedMemoryCounter::ScopedMemoryCounter(
+    MemoryCounters& counters)
+    : m_previous(t_counters) {
+  t_counters = &counters;
+}
+
+ActsExamples::ScopedMemoryCounter::~ScopedMemoryCounter() {
+  t_counters = m_previous;
+}
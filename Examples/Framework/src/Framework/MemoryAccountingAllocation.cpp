@@ -0,0 +1,152 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+
+#include "ActsExamples/Framework/MemoryAccounting.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#ifdef __APPLE__
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace {
+
+std::size_t allocationSize(void* ptr) {
+#ifdef __APPLE__
+  return malloc_size(ptr);
+#else
+  return malloc_usable_size(ptr);
+#endif
+}
+
+void* allocate(std::size_t size, std::size_t alignment) {
+  if (size == 0) {
+    size = 1;
+  }
+  while (true) {
+    void* ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+      ptr = std::malloc(size);
+    } else if (posix_memalign(&ptr, alignment, size) != 0) {
+      ptr = nullptr;
+    }
+    if (ptr != nullptr) {
+      if (ActsExamples::MemoryCounters* counters =
+              ActsExamples::currentMemoryCounters()) {
+        counters->allocations += 1;
+        counters->allocated += allocationSize(ptr);
+        counters->peak = std::max(counters->peak, counters->net());
+      }
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void* allocateNoThrow(std::size_t size, std::size_t alignment) noexcept {
+  try {
+    return allocate(size, alignment);
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void deallocate(void* ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (ActsExamples::MemoryCounters* counters =
+          ActsExamples::currentMemoryCounters()) {
+    counters->freed += allocationSize(ptr);
+  }
+  std::free(ptr);
+}
+
+constexpr std::size_t kDefaultAlignment = alignof(std::max_align_t);
+
+}  // namespace
+
+// the replaceable allocation functions, all of them use malloc and free such
+// that memory can be released by the functions of the standard library
+
+void* operator new(std::size_t size) {
+  return allocate(size, kDefaultAlignment);
+}
+void* operator new[](std::size_t size) {
+  return allocate(size, kDefaultAlignment);
+}
+void* operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  return allocateNoThrow(size, kDefaultAlignment);
+}
+void* operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  return allocateNoThrow(size, kDefaultAlignment);
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t& /*tag*/) noexcept {
+  return allocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t& /*tag*/) noexcept {
+  return allocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t /*alignment*/) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, std::align_val_t /*alignment*/,
+                     const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t /*alignment*/,
+                       const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::size_t /*size*/,
+                       std::align_val_t /*alignment*/) noexcept {
+  deallocate(ptr);
+}
@@ -18,6 +18,19 @@
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 
+#include <cstdint>
+
+namespace {
+
+/// SplitMix64 finalizer, decorrelates nearby input values
+std::uint64_t mix(std::uint64_t x) {
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9u;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebu;
+  return x ^ (x >> 31);
+}
+
+}  // namespace
+
 ActsExamples::RandomNumbers::RandomNumbers(const Config& cfg) : m_cfg(cfg) {}
 
 ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
@@ -29,3 +42,10 @@ uint64_t ActsExamples::RandomNumbers::generateSeed(
     const AlgorithmContext& context) const {
   return m_cfg.seed + context.eventNumber;
 }
+
+ActsExamples::PhiloxEngine ActsExamples::RandomNumbers::spawnStream(
+    const AlgorithmContext& context, uint64_t stream) const {
+  const uint64_t key =
+      mix(generateSeed(context) ^ mix(context.algorithmNumber + 1));
+  return PhiloxEngine(key, stream);
+}
@@ -10,6 +10,17 @@
 
 namespace ActsExamples {
 
+ProcessCode SequenceElement::internalExecuteBatch(
+    const std::vector<AlgorithmContext>& contexts) {
+  for (const AlgorithmContext& context : contexts) {
+    if (ProcessCode code = internalExecute(context);
+        code != ProcessCode::SUCCESS) {
+      return code;
+    }
+  }
+  return ProcessCode::SUCCESS;
+}
+
 void SequenceElement::registerWriteHandle(const DataHandleBase& handle) {
   m_writeHandles.push_back(&handle);
 }
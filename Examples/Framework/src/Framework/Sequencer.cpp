@@ -11,27 +11,31 @@
 #include "Acts/Plugins/FpeMonitoring/FpeMonitor.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/TraceSpans.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/EventCache.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsExamples/Framework/IReader.hpp"
 #include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/MemoryAccounting.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
 #include <algorithm>
-#include <atomic>
 #include <cctype>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib>
-#include <exception>
+#include <fstream>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <ostream>
 #include <ratio>
@@ -40,6 +44,9 @@
 #include <string>
 #include <string_view>
 #include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <boost/stacktrace/stacktrace.hpp>
 
@@ -53,19 +60,16 @@
 #include <dfe/dfe_io_dsv.hpp>
 #include <dfe/dfe_namedtuple.hpp>
 
+#include "SequencerState.hpp"
+
 namespace ActsExamples {
 
-namespace {
+using detail::Clock;
+using detail::Duration;
+using detail::getAlgorithmType;
+using detail::MemorySummary;
 
-std::string_view getAlgorithmType(const SequenceElement& element) {
-  if (dynamic_cast<const IWriter*>(&element) != nullptr) {
-    return "Writer";
-  }
-  if (dynamic_cast<const IReader*>(&element) != nullptr) {
-    return "Reader";
-  }
-  return "Algorithm";
-}
+namespace {
 
 // Saturated addition that does not overflow and exceed SIZE_MAX.
 //
@@ -126,6 +130,15 @@ Sequencer::Sequencer(const Sequencer::Config& cfg)
         "ACTS_SEQUENCER_DISABLE_FPEMON");
     m_cfg.trackFpes = false;
   }
+
+  if (m_cfg.eventBatchSize == 0) {
+    throw std::invalid_argument("The event batch size must not be zero");
+  }
+  if (m_cfg.eventBatchSize > 1 &&
+      (m_cfg.maxEventsInFlight > 0 || m_cfg.readAheadEvents > 0)) {
+    throw std::invalid_argument(
+        "Event batches can not be processed by the event pipeline");
+  }
 }
 
 void Sequencer::addContextDecorator(
@@ -350,21 +363,9 @@ std::pair<std::size_t, std::size_t> Sequencer::determineEventsRange() const {
 
 // helpers for per-algorithm timing information
 namespace {
-using Clock = std::chrono::high_resolution_clock;
-using Duration = Clock::duration;
-using Timepoint = Clock::time_point;
 using Seconds = std::chrono::duration<double>;
 using NanoSeconds = std::chrono::duration<double, std::nano>;
 
-// RAII-based stopwatch to time execution within a block
-struct StopWatch {
-  Timepoint start;
-  Duration& store;
-
-  StopWatch(Duration& s) : start(Clock::now()), store(s) {}
-  ~StopWatch() { store += Clock::now() - start; }
-};
-
 // Convert duration to a printable string w/ reasonable unit.
 template <typename D>
 inline std::string asString(D duration) {
@@ -386,6 +387,7 @@ inline std::string perEvent(D duration, std::size_t numEvents) {
   return asString(duration / numEvents) + "/event";
 }
 
+
 // Store timing data
 struct TimingInfo {
   std::string identifier;
@@ -408,25 +410,123 @@ void storeTiming(const std::vector<std::string>& identifiers,
     writer.append(info);
   }
 }
+
+// Store the percentiles of the per-event times
+struct TimingPercentilesInfo {
+  std::string identifier;
+  double time_mean_s = 0;
+  double time_p50_s = 0;
+  double time_p90_s = 0;
+  double time_p99_s = 0;
+  double time_max_s = 0;
+
+  DFE_NAMEDTUPLE(TimingPercentilesInfo, identifier, time_mean_s, time_p50_s,
+                 time_p90_s, time_p99_s, time_max_s);
+};
+
+TimingPercentilesInfo timingPercentiles(std::string identifier,
+                                        std::vector<Duration> durations) {
+  TimingPercentilesInfo info;
+  info.identifier = std::move(identifier);
+  if (durations.empty()) {
+    return info;
+  }
+  // nearest-rank percentiles, the earlier ones stay valid when selecting
+  // the later ones from the rest of the range
+  auto percentile = [&](double fraction) {
+    auto rank = static_cast<std::size_t>(
+        std::ceil(fraction * static_cast<double>(durations.size())));
+    auto nth = durations.begin() + std::max<std::size_t>(rank, 1) - 1;
+    std::nth_element(durations.begin(), nth, durations.end());
+    return std::chrono::duration_cast<Seconds>(*nth).count();
+  };
+  info.time_p50_s = percentile(0.5);
+  info.time_p90_s = percentile(0.9);
+  info.time_p99_s = percentile(0.99);
+  info.time_max_s = percentile(1.);
+  Duration total =
+      std::accumulate(durations.begin(), durations.end(), Duration::zero());
+  info.time_mean_s =
+      std::chrono::duration_cast<Seconds>(total).count() / durations.size();
+  return info;
+}
+
+void storeTimingPercentiles(
+    const std::vector<std::string>& identifiers,
+    const std::vector<std::vector<Duration>>& eventDurations,
+    const std::string& path) {
+  dfe::NamedTupleTsvWriter<TimingPercentilesInfo> writer(path, 4);
+  std::vector<Duration> durations(eventDurations.size());
+  for (std::size_t i = 0; i < identifiers.size(); ++i) {
+    for (std::size_t event = 0; event < eventDurations.size(); ++event) {
+      durations[event] = eventDurations[event][i];
+    }
+    writer.append(timingPercentiles(identifiers[i], durations));
+  }
+  // the time of the whole event, summed over the decorators and elements
+  for (std::size_t event = 0; event < eventDurations.size(); ++event) {
+    durations[event] =
+        std::accumulate(eventDurations[event].begin(),
+                        eventDurations[event].end(), Duration::zero());
+  }
+  writer.append(timingPercentiles("Event", durations));
+}
+
+
+// Store memory data
+struct MemoryInfo {
+  std::string identifier;
+  double allocations_perevent = 0;
+  double allocated_perevent_bytes = 0;
+  double freed_perevent_bytes = 0;
+  double peak_perevent_bytes = 0;
+  std::int64_t peak_max_bytes = 0;
+  std::size_t peak_max_event = 0;
+
+  DFE_NAMEDTUPLE(MemoryInfo, identifier, allocations_perevent,
+                 allocated_perevent_bytes, freed_perevent_bytes,
+                 peak_perevent_bytes, peak_max_bytes, peak_max_event);
+};
+
+void storeMemory(const std::vector<std::string>& identifiers,
+                 const std::vector<MemorySummary>& summaries,
+                 std::size_t numEvents, const std::string& path) {
+  dfe::NamedTupleTsvWriter<MemoryInfo> writer(path);
+  for (std::size_t i = 0; i < identifiers.size(); ++i) {
+    const MemorySummary& summary = summaries[i];
+    MemoryInfo info;
+    info.identifier = identifiers[i];
+    info.allocations_perevent =
+        static_cast<double>(summary.total.allocations) / numEvents;
+    info.allocated_perevent_bytes =
+        static_cast<double>(summary.total.allocated) / numEvents;
+    info.freed_perevent_bytes =
+        static_cast<double>(summary.total.freed) / numEvents;
+    info.peak_perevent_bytes = static_cast<double>(summary.peakSum) / numEvents;
+    info.peak_max_bytes = summary.peakMax;
+    info.peak_max_event = summary.peakMaxEvent;
+    writer.append(info);
+  }
+}
 }  // namespace
 
 int Sequencer::run() {
-  // measure overall wall clock
-  Timepoint clockWallStart = Clock::now();
-  // per-algorithm time measures
-  std::vector<std::string> names = listAlgorithmNames();
-  std::vector<Duration> clocksAlgorithms(names.size(), Duration::zero());
-  tbbWrap::queuing_mutex clocksAlgorithmsMutex;
+  // measures the overall wall clock from here
+  RunState run;
+  run.names = listAlgorithmNames();
+  run.clocksAlgorithms.assign(run.names.size(), Duration::zero());
 
   // processing only works w/ a well-known number of events
   // error message is already handled by the helper function
-  std::pair<std::size_t, std::size_t> eventsRange = determineEventsRange();
-  if ((eventsRange.first == SIZE_MAX) && (eventsRange.second == SIZE_MAX)) {
+  run.eventsRange = determineEventsRange();
+  if ((run.eventsRange.first == SIZE_MAX) &&
+      (run.eventsRange.second == SIZE_MAX)) {
     return EXIT_FAILURE;
   }
+  run.nTotalEvents = run.eventsRange.second - run.eventsRange.first;
 
-  ACTS_INFO("Processing events [" << eventsRange.first << ", "
-                                  << eventsRange.second << ")");
+  ACTS_INFO("Processing events [" << run.eventsRange.first << ", "
+                                  << run.eventsRange.second << ")");
   ACTS_INFO("Starting event loop with " << m_cfg.numThreads << " threads");
   ACTS_INFO("  " << m_decorators.size() << " context decorators");
   ACTS_INFO("  " << m_sequenceElements.size() << " sequence elements");
@@ -461,108 +561,51 @@ int Sequencer::run() {
     }
   }
 
-  // execute the parallel event loop
-  std::atomic<std::size_t> nProcessedEvents = 0;
-  std::size_t nTotalEvents = eventsRange.second - eventsRange.first;
-  m_taskArena.execute([&] {
-    tbbWrap::parallel_for(
-        tbb::blocked_range<std::size_t>(eventsRange.first, eventsRange.second),
-        [&](const tbb::blocked_range<std::size_t>& r) {
-          std::vector<Duration> localClocksAlgorithms(names.size(),
-                                                      Duration::zero());
-
-          for (std::size_t event = r.begin(); event != r.end(); ++event) {
-            ACTS_DEBUG("start processing event " << event);
-            m_cfg.iterationCallback();
-            // Use per-event store
-            WhiteBoard eventStore(
-                Acts::getDefaultLogger("EventStore#" + std::to_string(event),
-                                       m_cfg.logLevel),
-                m_whiteboardObjectAliases);
-            // If we ever wanted to run algorithms in parallel, this needs to
-            // be changed to Algorithm context copies
-            AlgorithmContext context(0, event, eventStore);
-            std::size_t ialgo = 0;
-
-            /// Decorate the context
-            for (auto& cdr : m_decorators) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              ACTS_VERBOSE("Execute context decorator: " << cdr->name());
-              if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
-                throw std::runtime_error("Failed to decorate event context");
-              }
-            }
-
-            ACTS_VERBOSE("Execute sequence elements");
-
-            for (auto& [alg, fpe] : m_sequenceElements) {
-              std::optional<Acts::FpeMonitor> mon;
-              if (m_cfg.trackFpes) {
-                mon.emplace();
-                context.fpeMonitor = &mon.value();
-              }
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": "
-                                      << alg->name());
-              if (alg->internalExecute(++context) != ProcessCode::SUCCESS) {
-                ACTS_FATAL("Failed to execute " << getAlgorithmType(*alg)
-                                                << ": " << alg->name());
-                throw std::runtime_error("Failed to process event data");
-              }
-
-              if (mon) {
-                auto& local = fpe.local();
-
-                for (const auto& [count, type, st] :
-                     mon->result().stackTraces()) {
-                  auto [maskLoc, nMasked] = fpeMaskCount(*st, type);
-                  if (nMasked < count) {
-                    std::stringstream ss;
-                    ss << "FPE of type " << type
-                       << " exceeded configured per-event threshold of "
-                       << nMasked << " (mask: " << maskLoc
-                       << ") (seen: " << count << " FPEs)\n"
-                       << Acts::FpeMonitor::stackTraceToString(
-                              *st, m_cfg.fpeStackTraceLength);
-
-                    m_nUnmaskedFpe += (count - nMasked);
-
-                    if (m_cfg.failOnFirstFpe) {
-                      ACTS_ERROR(ss.str());
-                      local.merge(mon->result());  // merge so we get correct
-                                                   // results after throwing
-                      throw FpeFailure{ss.str()};
-                    } else if (!local.contains(type, *st)) {
-                      ACTS_INFO(ss.str());
-                    }
-                  }
-                }
-
-                local.merge(mon->result());
-              }
-              context.fpeMonitor = nullptr;
-            }
-
-            nProcessedEvents++;
-            if (logger().level() <= Acts::Logging::DEBUG) {
-              ACTS_DEBUG("finished event " << event);
-            } else if (nTotalEvents <= 100) {
-              ACTS_INFO("finished event " << event);
-            } else if (nProcessedEvents % 100 == 0) {
-              ACTS_INFO(nProcessedEvents << " / " << nTotalEvents
-                                         << " events processed");
-            }
-          }
-
-          // add timing info to global information
-          {
-            tbbWrap::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
-            for (std::size_t i = 0; i < clocksAlgorithms.size(); ++i) {
-              clocksAlgorithms[i] += localClocksAlgorithms[i];
-            }
-          }
-        });
-  });
+  resolveWhiteBoardSlots(run);
+  findElementDependencies(run);
+  setupEventCache(run);
+  assignPipelineStages(run);
+
+  if (m_cfg.eventMemoryArenas) {
+    run.arenaPool.emplace();
+  }
+  if (m_cfg.trackMemory) {
+    if (memoryAccountingAvailable()) {
+      run.memorySummaries.resize(run.names.size());
+    } else {
+      ACTS_WARNING("Tracking the memory requires the allocation functions "
+                   "of ActsExamplesMemoryAccounting, it is not tracked");
+    }
+  }
+  if (!m_cfg.outputTimingPercentilesFile.empty()) {
+    run.eventClocks.resize(run.nTotalEvents);
+  }
+  if (!m_cfg.outputTraceFile.empty()) {
+    run.spanRecorder.emplace();
+    run.globalSpanRecorder.emplace(&*run.spanRecorder);
+  }
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+  if (run.pipelined) {
+    runPipelined(run);
+  } else
+#endif
+  {
+    if (m_cfg.eventBatchSize > 1) {
+      runBatched(run);
+    } else {
+      runParallel(run);
+    }
+  }
+
+  // the slots are only valid for the white boards of this run
+  for (const auto& [alg, fpe] : m_sequenceElements) {
+    for (const auto* handles : {&alg->writeHandles(), &alg->readHandles()}) {
+      for (const auto* handle : *handles) {
+        handle->resolveSlot(nullptr);
+      }
+    }
+  }
 
   ACTS_VERBOSE("Finalize sequence elements");
   for (auto& [alg, fpe] : m_sequenceElements) {
@@ -576,11 +619,176 @@ int Sequencer::run() {
 
   fpeReport();
 
-  // summarize timing
-  Duration totalWall = Clock::now() - clockWallStart;
+  if (!storeRunSummary(run)) {
+    return EXIT_FAILURE;
+  }
+
+  if (m_nUnmaskedFpe > 0) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+void Sequencer::resolveWhiteBoardSlots(RunState& run) const {
+  // the white board slots of all data handle keys and of their aliases, such
+  // that the handles access the white boards by index
+  run.slots = std::make_shared<WhiteBoard::Slots>();
+  WhiteBoard::Slots& slots = *run.slots;
+  for (const auto& [alg, fpe] : m_sequenceElements) {
+    for (const auto* handles : {&alg->writeHandles(), &alg->readHandles()}) {
+      for (const auto* handle : *handles) {
+        if (handle->isInitialized() &&
+            slots.indices.try_emplace(handle->key(), slots.size).second) {
+          slots.size++;
+        }
+      }
+    }
+  }
+  for (const auto& [objectName, aliasName] : m_whiteboardObjectAliases) {
+    if (auto it = slots.indices.find(objectName); it != slots.indices.end()) {
+      slots.indices[aliasName] = it->second;
+    }
+  }
+  for (const auto& [alg, fpe] : m_sequenceElements) {
+    for (const auto* handles : {&alg->writeHandles(), &alg->readHandles()}) {
+      for (const auto* handle : *handles) {
+        handle->resolveSlot(&slots);
+      }
+    }
+  }
+  ACTS_DEBUG("White boards with " << slots.size << " slots");
+}
+
+void Sequencer::findElementDependencies(RunState& run) const {
+  run.pipelined = (m_cfg.maxEventsInFlight > 0 || m_cfg.readAheadEvents > 0) &&
+                  tbbWrap::enableTBB();
+  if (m_cfg.readAheadEvents > 0 && !run.pipelined) {
+    ACTS_WARNING("Reading ahead needs multi-threading, the readers run "
+                 "within the event loop");
+  }
+  if (m_cfg.runDataFlowChecks && (m_cfg.concurrentElements || run.pipelined)) {
+    run.inputs = elementDependencies();
+  }
+  if (m_cfg.concurrentElements) {
+    if (!m_cfg.runDataFlowChecks || !tbbWrap::enableTBB()) {
+      ACTS_WARNING("Concurrent sequence elements need the data flow checks "
+                   "and multi-threading, running them in order");
+    } else {
+      run.dependencies = run.inputs;
+    }
+  }
+}
+
+void Sequencer::setupEventCache(RunState& run) const {
+  // load the cached objects instead of running the elements producing them
+  // if the cache holds all events, otherwise fill the cache
+  run.skippedElements.assign(m_sequenceElements.size(), false);
+  if (m_cfg.cacheDir.empty()) {
+    return;
+  }
+  run.eventCache.emplace(EventCache::Config{m_cfg.cacheDir, m_cfg.cacheKey,
+                                            m_cfg.cacheCollections},
+                         m_cfg.logLevel);
+  // the producers of the objects and the handles that know their types
+  std::unordered_map<std::string, std::pair<std::size_t, const DataHandleBase*>>
+      producers;
+  for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+    const auto& element = *m_sequenceElements[i].sequenceElement;
+    for (const auto* handle : element.writeHandles()) {
+      if (handle->isInitialized()) {
+        producers[handle->key()] = {i, handle};
+      }
+    }
+  }
+  for (const std::string& name : m_cfg.cacheCollections) {
+    auto it = producers.find(name);
+    if (it != producers.end() &&
+        !EventCache::isSupported(it->second.second->typeInfo())) {
+      ACTS_ERROR("Cached object '"
+                 << name << "' has the unsupported type "
+                 << demangleAndShorten(it->second.second->typeInfo().name()));
+      throw SequenceConfigurationException{};
+    }
+  }
+
+  bool cached = true;
+  for (std::size_t event = run.eventsRange.first;
+       event < run.eventsRange.second; ++event) {
+    if (!run.eventCache->contains(event)) {
+      cached = false;
+      break;
+    }
+  }
+  if (!cached) {
+    run.storeInCache = true;
+    ACTS_INFO("Store " << m_cfg.cacheCollections.size()
+                       << " objects of every event in the cache "
+                       << run.eventCache->path(run.eventsRange.first));
+    return;
+  }
+
+  run.skippedElements = cachedElements(m_cfg.cacheCollections);
+  for (std::size_t i = 0; i < run.skippedElements.size(); ++i) {
+    if (run.skippedElements[i]) {
+      const auto& element = *m_sequenceElements[i].sequenceElement;
+      ACTS_INFO("Skip " << getAlgorithmType(element) << " '" << element.name()
+                        << "', its outputs are cached");
+    }
+  }
+  // the objects of elements that still run are not loaded
+  for (const std::string& name : m_cfg.cacheCollections) {
+    auto it = producers.find(name);
+    if (it == producers.end() || run.skippedElements[it->second.first]) {
+      run.loadedCollections.push_back(name);
+    }
+  }
+  ACTS_INFO("Load " << run.loadedCollections.size()
+                    << " objects of every event from the cache "
+                    << run.eventCache->path(run.eventsRange.first));
+}
+
+void Sequencer::assignPipelineStages(RunState& run) const {
+  run.stageElements.resize(run.pipelined ? 3 : 1);
+  std::vector<std::size_t> elementStages(m_sequenceElements.size(), 0);
+  for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+    const SequenceElement* element =
+        m_sequenceElements[i].sequenceElement.get();
+    if (run.pipelined) {
+      if (dynamic_cast<const IReader*>(element) != nullptr) {
+        elementStages[i] = 0;
+      } else if (dynamic_cast<const IWriter*>(element) != nullptr) {
+        elementStages[i] = 2;
+      } else {
+        elementStages[i] = 1;
+      }
+    }
+    if (!run.skippedElements[i]) {
+      run.stageElements[elementStages[i]].push_back(i);
+    }
+  }
+  for (std::size_t i = 0; i < run.inputs.size(); ++i) {
+    for (std::size_t input : run.inputs[i]) {
+      if (elementStages[input] > elementStages[i]) {
+        const auto& element = *m_sequenceElements[i].sequenceElement;
+        const auto& source = *m_sequenceElements[input].sequenceElement;
+        ACTS_ERROR(getAlgorithmType(element)
+                   << " '" << element.name() << "' reads from "
+                   << getAlgorithmType(source) << " '" << source.name()
+                   << "', which runs in a later stage of the pipeline");
+        throw SequenceConfigurationException{};
+      }
+    }
+  }
+}
+
+bool Sequencer::storeRunSummary(RunState& run) {
+  Duration totalWall = Clock::now() - run.clockWallStart;
+  const auto& names = run.names;
+  const auto& clocksAlgorithms = run.clocksAlgorithms;
   Duration totalReal = std::accumulate(
       clocksAlgorithms.begin(), clocksAlgorithms.end(), Duration::zero());
-  std::size_t numEvents = eventsRange.second - eventsRange.first;
+  std::size_t numEvents = run.nTotalEvents;
   ACTS_INFO("Processed " << numEvents << " events in " << asString(totalWall)
                          << " (wall clock)");
   ACTS_INFO("Average time per event: " << perEvent(totalReal, numEvents));
@@ -593,13 +801,124 @@ int Sequencer::run() {
   if (!m_cfg.outputDir.empty()) {
     storeTiming(names, clocksAlgorithms, numEvents,
                 joinPaths(m_cfg.outputDir, m_cfg.outputTimingFile));
+    if (!run.memorySummaries.empty()) {
+      storeMemory(names, run.memorySummaries, numEvents,
+                  joinPaths(m_cfg.outputDir, m_cfg.outputMemoryFile));
+    }
   }
+  if (!run.eventClocks.empty()) {
+    storeTimingPercentiles(
+        names, run.eventClocks,
+        joinPaths(m_cfg.outputDir, m_cfg.outputTimingPercentilesFile));
+  }
+  if (run.spanRecorder) {
+    run.globalSpanRecorder.reset();
+    std::string path = joinPaths(m_cfg.outputDir, m_cfg.outputTraceFile);
+    std::ofstream trace(path);
+    run.spanRecorder->writeChromeTrace(trace);
+    if (!trace) {
+      ACTS_ERROR("Unable to write the trace to " << path);
+      return false;
+    }
+    ACTS_INFO("Wrote the trace of the event loop to " << path);
+  }
+  return true;
+}
 
-  if (m_nUnmaskedFpe > 0) {
-    return EXIT_FAILURE;
+std::vector<std::vector<std::size_t>> Sequencer::elementDependencies() const {
+  std::vector<std::vector<std::size_t>> dependencies(m_sequenceElements.size());
+  // the element writing each white board key, including the aliases
+  std::unordered_map<std::string, std::size_t> producers;
+
+  for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+    const auto& element = *m_sequenceElements[i].sequenceElement;
+    for (const auto* handle : element.readHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      if (auto it = producers.find(handle->key()); it != producers.end()) {
+        dependencies[i].push_back(it->second);
+      }
+    }
+    std::sort(dependencies[i].begin(), dependencies[i].end());
+    dependencies[i].erase(
+        std::unique(dependencies[i].begin(), dependencies[i].end()),
+        dependencies[i].end());
+
+    for (const auto* handle : element.writeHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      producers[handle->key()] = i;
+      if (auto it = m_whiteboardObjectAliases.find(handle->key());
+          it != m_whiteboardObjectAliases.end()) {
+        producers[it->second] = i;
+      }
+    }
+
+    ACTS_DEBUG(getAlgorithmType(element) << " '" << element.name()
+                                         << "' depends on "
+                                         << dependencies[i].size()
+                                         << " earlier sequence elements");
   }
 
-  return EXIT_SUCCESS;
+  return dependencies;
+}
+
+std::vector<bool> Sequencer::cachedElements(
+    const std::vector<std::string>& collections) const {
+  // the objects of the aliases, the cached objects are given by their names
+  std::unordered_map<std::string, std::string> aliasObjects;
+  for (const auto& [objectName, aliasName] : m_whiteboardObjectAliases) {
+    aliasObjects[aliasName] = objectName;
+  }
+  auto objectName = [&](const std::string& key) -> const std::string& {
+    auto it = aliasObjects.find(key);
+    return it != aliasObjects.end() ? it->second : key;
+  };
+
+  std::unordered_set<std::string> cached(collections.begin(),
+                                         collections.end());
+  std::unordered_set<std::string> read;
+  for (const auto& [alg, fpe] : m_sequenceElements) {
+    for (const auto* handle : alg->readHandles()) {
+      if (handle->isInitialized()) {
+        read.insert(objectName(handle->key()));
+      }
+    }
+  }
+
+  // walk backwards through the sequence, an element is skipped if each of
+  // its outputs is cached or only read by skipped elements. Writers and
+  // elements without outputs always run.
+  std::vector<bool> skipped(m_sequenceElements.size(), false);
+  // the objects that are not cached and read by the elements that run
+  std::unordered_set<std::string> needed;
+  for (std::size_t i = m_sequenceElements.size(); i-- > 0;) {
+    const auto& element = *m_sequenceElements[i].sequenceElement;
+    bool skip = dynamic_cast<const IWriter*>(&element) == nullptr;
+    std::size_t nOutputs = 0;
+    for (const auto* handle : element.writeHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      const std::string& key = handle->key();
+      bool unused = read.count(key) > 0 && needed.count(key) == 0;
+      skip = skip && (cached.count(key) > 0 || unused);
+      ++nOutputs;
+    }
+    skipped[i] = skip && nOutputs > 0;
+    if (skipped[i]) {
+      continue;
+    }
+    for (const auto* handle : element.readHandles()) {
+      if (handle->isInitialized() &&
+          cached.count(objectName(handle->key())) == 0) {
+        needed.insert(objectName(handle->key()));
+      }
+    }
+  }
+  return skipped;
 }
 
 void Sequencer::fpeReport() const {
@@ -611,7 +930,14 @@ void Sequencer::fpeReport() const {
     auto merged = std::accumulate(
         fpe.begin(), fpe.end(), Acts::FpeMonitor::Result{},
         [](const auto& lhs, const auto& rhs) { return lhs.merged(rhs); });
-    if (!merged) {
+    static const std::vector<Acts::FpeType> types = {
+        Acts::FpeType::INTDIV, Acts::FpeType::INTOVF, Acts::FpeType::FLTDIV,
+        Acts::FpeType::FLTOVF, Acts::FpeType::FLTUND, Acts::FpeType::FLTRES,
+        Acts::FpeType::FLTINV, Acts::FpeType::FLTSUB};
+    bool counted = std::any_of(types.begin(), types.end(), [&](auto type) {
+      return merged.encountered(type);
+    });
+    if (!merged && !counted) {
       // no FPEs to report
       continue;
     }
@@ -620,6 +946,16 @@ void Sequencer::fpeReport() const {
                                  << alg->name());
     ACTS_INFO("-----------------------------------");
 
+    if (m_cfg.fpeTrapInterval != 1) {
+      // the events without traps only contribute to the counts
+      for (auto type : types) {
+        if (merged.encountered(type)) {
+          ACTS_INFO("- " << type << ": counted " << merged.count(type)
+                         << " times");
+        }
+      }
+    }
+
     std::vector<std::reference_wrapper<const Acts::FpeMonitor::Result::FpeInfo>>
         sorted;
     std::transform(
@@ -0,0 +1,515 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/FpeMonitoring/FpeMonitor.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/TraceSpans.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/IContextDecorator.hpp"
+#include "ActsExamples/Framework/MemoryAccounting.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+#include <tbb/concurrent_queue.h>
+#include <tbb/flow_graph.h>
+#include <tbb/info.h>
+#include <tbb/parallel_pipeline.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_group.h>
+#endif
+
+#include "SequencerState.hpp"
+
+// The event loops of the sequencer: the elements of an event, the events run
+// in parallel, as a pipeline or in batches
+
+namespace ActsExamples {
+
+using detail::Duration;
+using detail::getAlgorithmType;
+using detail::StopWatch;
+
+namespace {
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+// One task arena per NUMA node, with the threads bound to the node. Empty if
+// the topology of the machine is not known to TBB, which requires its tbbbind
+// library, or if there is a single node.
+std::vector<std::unique_ptr<tbb::task_arena>> makeNumaArenas(int numThreads) {
+  std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+  std::vector<std::unique_ptr<tbb::task_arena>> arenas;
+  if (nodes.size() < 2) {
+    return arenas;
+  }
+  int nNodes = static_cast<int>(nodes.size());
+  for (int i = 0; i < nNodes; ++i) {
+    int concurrency = tbb::info::default_concurrency(nodes[i]);
+    if (numThreads > 0) {
+      // share the requested threads as evenly as possible
+      concurrency = numThreads / nNodes + (i < numThreads % nNodes ? 1 : 0);
+    }
+    if (concurrency > 0) {
+      // no slot is reserved, the calling thread only submits the work
+      arenas.push_back(std::make_unique<tbb::task_arena>(
+          tbb::task_arena::constraints(nodes[i], concurrency), 0));
+    }
+  }
+  return arenas;
+}
+#endif
+
+}  // namespace
+
+void Sequencer::checkFpes(std::size_t iElement, Acts::FpeMonitor& mon) {
+  auto& local = m_sequenceElements[iElement].fpeResult.local();
+
+  for (const auto& [count, type, st] : mon.result().stackTraces()) {
+    auto [maskLoc, nMasked] = fpeMaskCount(*st, type);
+    if (nMasked < count) {
+      std::stringstream ss;
+      ss << "FPE of type " << type
+         << " exceeded configured per-event threshold of " << nMasked
+         << " (mask: " << maskLoc << ") (seen: " << count << " FPEs)\n"
+         << Acts::FpeMonitor::stackTraceToString(*st,
+                                                 m_cfg.fpeStackTraceLength);
+
+      m_nUnmaskedFpe += (count - nMasked);
+
+      if (m_cfg.failOnFirstFpe) {
+        ACTS_ERROR(ss.str());
+        local.merge(mon.result());  // merge so we get correct
+                                    // results after throwing
+        throw FpeFailure{ss.str()};
+      } else if (!local.contains(type, *st)) {
+        ACTS_INFO(ss.str());
+      }
+    }
+  }
+
+  local.merge(mon.result());
+}
+
+void Sequencer::executeElement(const RunState& run, EventState& state,
+                               std::size_t iElement) {
+  auto& alg = m_sequenceElements[iElement].sequenceElement;
+  std::size_t index = m_decorators.size() + iElement;
+  // every element gets its own copy of the decorated context
+  AlgorithmContext context = state.context;
+  context.algorithmNumber = index + 1;
+  std::optional<Acts::FpeMonitor> mon;
+  if (m_cfg.trackFpes) {
+    // only the sampled events trap the FPEs and record their stack traces
+    bool trap = m_cfg.fpeTrapInterval != 0 &&
+                state.event % m_cfg.fpeTrapInterval == 0;
+    mon.emplace(trap ? Acts::FpeMonitor::Mode::Trap
+                     : Acts::FpeMonitor::Mode::Count);
+    context.fpeMonitor = &mon.value();
+  }
+  StopWatch sw(state.clocks[index]);
+  Acts::ScopedSpan span(run.names[index], state.event);
+  ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": " << alg->name());
+  std::optional<ScopedMemoryCounter> memoryCounter;
+  if (!state.memory.empty()) {
+    memoryCounter.emplace(state.memory[index]);
+  }
+  ProcessCode code = alg->internalExecute(context);
+  memoryCounter.reset();
+  if (code != ProcessCode::SUCCESS) {
+    ACTS_FATAL("Failed to execute " << getAlgorithmType(*alg) << ": "
+                                    << alg->name());
+    throw std::runtime_error("Failed to process event data");
+  }
+
+  if (mon) {
+    checkFpes(iElement, *mon);
+  }
+}
+
+void Sequencer::executeElementBatch(
+    const RunState& run, const std::vector<std::shared_ptr<EventState>>& states,
+    std::size_t begin, std::size_t end, std::size_t iElement) {
+  auto& alg = m_sequenceElements[iElement].sequenceElement;
+  std::size_t index = m_decorators.size() + iElement;
+  EventState& first = *states[begin];
+  // the events of the batch share one monitor, sampled by the first event
+  std::optional<Acts::FpeMonitor> mon;
+  if (m_cfg.trackFpes) {
+    bool trap = m_cfg.fpeTrapInterval != 0 &&
+                first.event % m_cfg.fpeTrapInterval == 0;
+    mon.emplace(trap ? Acts::FpeMonitor::Mode::Trap
+                     : Acts::FpeMonitor::Mode::Count);
+  }
+  std::vector<AlgorithmContext> contexts;
+  contexts.reserve(end - begin);
+  for (std::size_t i = begin; i < end; ++i) {
+    AlgorithmContext& context = contexts.emplace_back(states[i]->context);
+    context.algorithmNumber = index + 1;
+    if (mon) {
+      context.fpeMonitor = &mon.value();
+    }
+  }
+  // the time is shared evenly by the events of the batch, the memory is
+  // counted for the first event
+  Duration duration = Duration::zero();
+  ProcessCode code = ProcessCode::SUCCESS;
+  {
+    StopWatch sw(duration);
+    Acts::ScopedSpan span(run.names[index], first.event);
+    ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": " << alg->name()
+                            << " for " << contexts.size() << " events");
+    std::optional<ScopedMemoryCounter> memoryCounter;
+    if (!first.memory.empty()) {
+      memoryCounter.emplace(first.memory[index]);
+    }
+    code = alg->internalExecuteBatch(contexts);
+  }
+  for (std::size_t i = begin; i < end; ++i) {
+    states[i]->clocks[index] += duration / contexts.size();
+  }
+  if (code != ProcessCode::SUCCESS) {
+    ACTS_FATAL("Failed to execute " << getAlgorithmType(*alg) << ": "
+                                    << alg->name());
+    throw std::runtime_error("Failed to process event data");
+  }
+
+  if (mon) {
+    checkFpes(iElement, *mon);
+  }
+}
+
+void Sequencer::executeElements(const RunState& run, EventState& state,
+                                const std::vector<std::size_t>& elements,
+                                bool inOrder) {
+#ifndef ACTS_EXAMPLES_NO_TBB
+  if (!run.dependencies.empty() && !inOrder) {
+    // every element starts once the elements it reads from are done
+    using Node = tbb::flow::continue_node<tbb::flow::continue_msg>;
+    tbb::flow::graph graph;
+    tbb::flow::broadcast_node<tbb::flow::continue_msg> start(graph);
+    std::vector<std::unique_ptr<Node>> nodes(m_sequenceElements.size());
+    for (std::size_t i : elements) {
+      auto body = [&, i](const tbb::flow::continue_msg&) {
+        executeElement(run, state, i);
+      };
+      nodes[i] = std::make_unique<Node>(graph, body);
+      bool hasPredecessor = false;
+      for (std::size_t dependency : run.dependencies[i]) {
+        // elements of earlier stages are done already, skipped elements do
+        // not run at all
+        if (nodes[dependency] != nullptr) {
+          tbb::flow::make_edge(*nodes[dependency], *nodes[i]);
+          hasPredecessor = true;
+        }
+      }
+      if (!hasPredecessor) {
+        tbb::flow::make_edge(start, *nodes[i]);
+      }
+    }
+    start.try_put(tbb::flow::continue_msg());
+    graph.wait_for_all();
+    return;
+  }
+#endif
+  for (std::size_t i : elements) {
+    executeElement(run, state, i);
+  }
+}
+
+std::shared_ptr<Sequencer::EventState> Sequencer::startEvent(
+    RunState& run, std::size_t event) {
+  ACTS_DEBUG("start processing event " << event);
+  m_cfg.iterationCallback();
+  auto state = std::make_shared<EventState>(
+      event, m_cfg.logLevel, m_whiteboardObjectAliases, run.slots,
+      run.arenaPool ? &*run.arenaPool : nullptr, run.names.size(),
+      run.memorySummaries.size());
+  for (std::size_t i = 0; i < m_decorators.size(); ++i) {
+    StopWatch sw(state->clocks[i]);
+    Acts::ScopedSpan span(run.names[i], event);
+    ACTS_VERBOSE("Execute context decorator: " << m_decorators[i]->name());
+    std::optional<ScopedMemoryCounter> memoryCounter;
+    if (!state->memory.empty()) {
+      memoryCounter.emplace(state->memory[i]);
+    }
+    if (m_decorators[i]->decorate(++state->context) != ProcessCode::SUCCESS) {
+      throw std::runtime_error("Failed to decorate event context");
+    }
+  }
+  if (!run.loadedCollections.empty()) {
+    Acts::ScopedSpan span("EventCache", event);
+    run.eventCache->load(event, state->eventStore, run.loadedCollections);
+  }
+  ACTS_VERBOSE("Execute sequence elements");
+  return state;
+}
+
+void Sequencer::finishEvent(RunState& run, const EventState& state) {
+  std::size_t nProcessedEvents = ++run.nProcessedEvents;
+  if (logger().level() <= Acts::Logging::DEBUG) {
+    ACTS_DEBUG("finished event " << state.event);
+  } else if (run.nTotalEvents <= 100) {
+    ACTS_INFO("finished event " << state.event);
+  } else if (nProcessedEvents % 100 == 0) {
+    ACTS_INFO(nProcessedEvents << " / " << run.nTotalEvents
+                               << " events processed");
+  }
+
+  if (run.storeInCache) {
+    Acts::ScopedSpan span("EventCache", state.event);
+    run.eventCache->store(state.event, state.eventStore);
+  }
+  if (!run.eventClocks.empty()) {
+    run.eventClocks[state.event - run.eventsRange.first] = state.clocks;
+  }
+  tbbWrap::queuing_mutex::scoped_lock lock(run.clocksAlgorithmsMutex);
+  for (std::size_t i = 0; i < run.clocksAlgorithms.size(); ++i) {
+    run.clocksAlgorithms[i] += state.clocks[i];
+  }
+  for (std::size_t i = 0; i < run.memorySummaries.size(); ++i) {
+    const MemoryCounters& memory = state.memory[i];
+    run.memorySummaries[i].add(memory, state.event);
+    if (0 < m_cfg.memoryPeakWarningThreshold &&
+        static_cast<std::int64_t>(m_cfg.memoryPeakWarningThreshold) <
+            memory.peak) {
+      ACTS_WARNING(run.names[i] << " reached " << memory.peak
+                                << " bytes of heap memory in event "
+                                << state.event);
+    }
+  }
+}
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+void Sequencer::runPipelined(RunState& run) {
+  // execute the event pipeline, with the readers and writers running for
+  // one event at a time and in event order
+  if (m_cfg.numaArenas) {
+    ACTS_WARNING("The event pipeline runs in a single arena");
+  }
+  std::size_t maxInFlight = m_cfg.maxEventsInFlight;
+  if (maxInFlight == 0) {
+    maxInFlight =
+        m_cfg.numThreads > 0
+            ? m_cfg.numThreads
+            : static_cast<std::size_t>(tbb::info::default_concurrency());
+  }
+  ACTS_INFO("Pipelined event loop with up to " << maxInFlight
+                                               << " events in flight");
+
+  using EventPtr = std::shared_ptr<EventState>;
+  const auto& [firstEvent, endEvent] = run.eventsRange;
+
+  // the events with the readers done, read ahead of the event loop by a
+  // dedicated thread. A null event marks the end of the events.
+  bool readAhead = m_cfg.readAheadEvents > 0;
+  tbb::concurrent_bounded_queue<EventPtr> readEvents;
+  std::exception_ptr readError;
+  std::thread readThread;
+  if (readAhead) {
+    ACTS_INFO("Reading up to " << m_cfg.readAheadEvents << " events ahead");
+    readEvents.set_capacity(m_cfg.readAheadEvents);
+    readThread = std::thread([&] {
+      try {
+        for (std::size_t event = firstEvent; event < endEvent; ++event) {
+          EventPtr state = startEvent(run, event);
+          // the readers run in order on this thread, a flow graph would run
+          // outside of the task arena and its threads
+          executeElements(run, *state, run.stageElements[0], true);
+          readEvents.push(std::move(state));
+        }
+      } catch (const tbb::user_abort&) {
+        // the event loop failed and does not take any more events
+        return;
+      } catch (...) {
+        readError = std::current_exception();
+      }
+      try {
+        readEvents.push(nullptr);
+      } catch (const tbb::user_abort&) {
+      }
+    });
+  }
+
+  std::size_t nextEvent = firstEvent;
+  auto read = [&](tbb::flow_control& control) -> EventPtr {
+    if (readAhead) {
+      EventPtr state;
+      readEvents.pop(state);
+      if (state == nullptr) {
+        control.stop();
+      }
+      return state;
+    }
+    if (nextEvent == endEvent) {
+      control.stop();
+      return nullptr;
+    }
+    EventPtr state = startEvent(run, nextEvent++);
+    executeElements(run, *state, run.stageElements[0]);
+    return state;
+  };
+  auto process = [&](EventPtr state) {
+    executeElements(run, *state, run.stageElements[1]);
+    return state;
+  };
+  auto write = [&](EventPtr state) {
+    executeElements(run, *state, run.stageElements[2]);
+    finishEvent(run, *state);
+  };
+  try {
+    m_taskArena.execute([&] {
+      tbb::parallel_pipeline(
+          maxInFlight,
+          tbb::make_filter<void, EventPtr>(tbb::filter_mode::serial_in_order,
+                                           read) &
+              tbb::make_filter<EventPtr, EventPtr>(tbb::filter_mode::parallel,
+                                                   process) &
+              tbb::make_filter<EventPtr, void>(
+                  tbb::filter_mode::serial_in_order, write));
+    });
+  } catch (...) {
+    if (readThread.joinable()) {
+      readEvents.abort();
+      readThread.join();
+    }
+    throw;
+  }
+  if (readThread.joinable()) {
+    readThread.join();
+  }
+  if (readError) {
+    std::rethrow_exception(readError);
+  }
+}
+#endif
+
+void Sequencer::runParallel(RunState& run) {
+  const auto& [firstEvent, endEvent] = run.eventsRange;
+  auto processEvent = [&](std::size_t event) {
+    std::shared_ptr<EventState> state = startEvent(run, event);
+    executeElements(run, *state, run.stageElements[0]);
+    finishEvent(run, *state);
+  };
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+  std::vector<std::unique_ptr<tbb::task_arena>> numaArenas;
+  if (m_cfg.numaArenas && tbbWrap::enableTBB()) {
+    numaArenas = makeNumaArenas(m_cfg.numThreads);
+    if (numaArenas.empty()) {
+      ACTS_WARNING("No NUMA topology available, using a single arena");
+    }
+  }
+  if (!numaArenas.empty()) {
+    // every arena takes the next event whenever one of its threads is free,
+    // such that an event stays on the node it started on
+    ACTS_INFO("Event loop on " << numaArenas.size() << " NUMA nodes");
+    std::atomic<std::size_t> nextEvent = firstEvent;
+    auto processEvents = [&](const tbb::blocked_range<int>& r) {
+      for (int i = r.begin(); i != r.end(); ++i) {
+        for (std::size_t event = nextEvent++; event < endEvent;
+             event = nextEvent++) {
+          processEvent(event);
+        }
+      }
+    };
+    std::vector<tbb::task_group> groups(numaArenas.size());
+    for (std::size_t i = 0; i < numaArenas.size(); ++i) {
+      numaArenas[i]->execute([&, i] {
+        groups[i].run([&, i] {
+          tbb::parallel_for(
+              tbb::blocked_range<int>(0, numaArenas[i]->max_concurrency(), 1),
+              processEvents, tbb::simple_partitioner());
+        });
+      });
+    }
+    for (std::size_t i = 0; i < numaArenas.size(); ++i) {
+      numaArenas[i]->execute([&, i] { groups[i].wait(); });
+    }
+    return;
+  }
+#endif
+
+  m_taskArena.execute([&] {
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(firstEvent, endEvent),
+        [&](const tbb::blocked_range<std::size_t>& r) {
+          for (std::size_t event = r.begin(); event != r.end(); ++event) {
+            processEvent(event);
+          }
+        });
+  });
+}
+
+void Sequencer::runBatched(RunState& run) {
+  // the events of a batch are started and finished together, each with its
+  // own white board. The elements run in order, every element for all events
+  // of the batch before the next element.
+  if (m_cfg.concurrentElements) {
+    ACTS_WARNING("The sequence elements of event batches run in order");
+  }
+  if (m_cfg.numaArenas) {
+    ACTS_WARNING("Event batches run in a single arena");
+  }
+  const auto& [firstEvent, endEvent] = run.eventsRange;
+  const std::size_t batchSize = m_cfg.eventBatchSize;
+  const std::size_t nBatches =
+      (endEvent - firstEvent + batchSize - 1) / batchSize;
+  ACTS_INFO("Event loop with batches of up to " << batchSize << " events");
+
+  auto processBatch = [&](std::size_t batch) {
+    std::size_t begin = firstEvent + batch * batchSize;
+    std::size_t end = std::min(endEvent, begin + batchSize);
+    std::vector<std::shared_ptr<EventState>> states;
+    states.reserve(end - begin);
+    for (std::size_t event = begin; event < end; ++event) {
+      states.push_back(startEvent(run, event));
+    }
+    for (std::size_t i : run.stageElements[0]) {
+      std::size_t maxBatchSize =
+          m_sequenceElements[i].sequenceElement->maxBatchSize();
+      if (maxBatchSize <= 1) {
+        for (const auto& state : states) {
+          executeElement(run, *state, i);
+        }
+        continue;
+      }
+      for (std::size_t j = 0; j < states.size(); j += maxBatchSize) {
+        executeElementBatch(run, states, j,
+                            std::min(states.size(), j + maxBatchSize), i);
+      }
+    }
+    for (const auto& state : states) {
+      finishEvent(run, *state);
+    }
+  };
+
+  m_taskArena.execute([&] {
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nBatches),
+        [&](const tbb::blocked_range<std::size_t>& r) {
+          for (std::size_t batch = r.begin(); batch != r.end(); ++batch) {
+            processBatch(batch);
+          }
+        });
+  });
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,290 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/TraceSpans.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/EventCache.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/MemoryAccounting.hpp"
+#include "ActsExamples/Framework/SequenceElement.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// The state of a run of the sequencer, shared by the setup and summary in
+// Sequencer.cpp and the event loops in SequencerEventLoop.cpp
+
+namespace ActsExamples {
+
+namespace detail {
+
+inline std::string_view getAlgorithmType(const SequenceElement& element) {
+  if (dynamic_cast<const IWriter*>(&element) != nullptr) {
+    return "Writer";
+  }
+  if (dynamic_cast<const IReader*>(&element) != nullptr) {
+    return "Reader";
+  }
+  return "Algorithm";
+}
+
+using Clock = std::chrono::high_resolution_clock;
+using Duration = Clock::duration;
+using Timepoint = Clock::time_point;
+
+// RAII-based stopwatch to time execution within a block
+struct StopWatch {
+  Timepoint start;
+  Duration& store;
+
+  StopWatch(Duration& s) : start(Clock::now()), store(s) {}
+  ~StopWatch() { store += Clock::now() - start; }
+};
+
+/// Memory arena of one event
+///
+/// The event allocates from a monotonic buffer, which is released at once at
+/// the end of the event. Allocations beyond the buffer are counted, such that
+/// the buffer covers them for the next event using the arena. The
+/// allocations are locked, as the elements of an event can run concurrently.
+class EventArena final : public std::pmr::memory_resource {
+ public:
+  /// Start an event
+  void start() {
+    if (m_buffer.empty()) {
+      m_resource.emplace(&m_upstream);
+    } else {
+      m_resource.emplace(m_buffer.data(), m_buffer.size(), &m_upstream);
+    }
+  }
+
+  /// Release the memory of the event and grow the buffer if needed
+  void finish() {
+    m_resource.reset();
+    if (m_upstream.allocated > 0) {
+      m_buffer.resize(m_buffer.size() + m_upstream.allocated);
+      m_upstream.allocated = 0;
+    }
+  }
+
+  std::pmr::memory_resource* resource() { return this; }
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) final {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_resource->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) final {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_resource->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept final {
+    return this == &other;
+  }
+
+  /// Default resource counting the allocated bytes
+  struct CountingResource final : public std::pmr::memory_resource {
+    std::size_t allocated = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) final {
+      allocated += bytes;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes,
+                       std::size_t alignment) final {
+      std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept final {
+      return this == &other;
+    }
+  };
+
+  std::mutex m_mutex;
+  std::vector<std::byte> m_buffer;
+  CountingResource m_upstream;
+  std::optional<std::pmr::monotonic_buffer_resource> m_resource;
+};
+
+/// Memory arenas of the events in flight, reused across events
+class EventArenaPool {
+ public:
+  /// An arena used by one event, returned to the pool on destruction
+  class Lease {
+   public:
+    /// @param pool The pool to take the arena from, nullptr for none
+    explicit Lease(EventArenaPool* pool) : m_pool(pool) {
+      if (m_pool != nullptr) {
+        m_arena = m_pool->acquire();
+      }
+    }
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    ~Lease() {
+      if (m_arena != nullptr) {
+        m_pool->release(std::move(m_arena));
+      }
+    }
+
+    /// The memory resource of the event, the default one without arena
+    std::pmr::memory_resource* resource() const {
+      return m_arena != nullptr ? m_arena->resource()
+                                : std::pmr::get_default_resource();
+    }
+
+   private:
+    EventArenaPool* m_pool = nullptr;
+    std::unique_ptr<EventArena> m_arena;
+  };
+
+ private:
+  std::unique_ptr<EventArena> acquire() {
+    std::unique_ptr<EventArena> arena;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_arenas.empty()) {
+        arena = std::move(m_arenas.back());
+        m_arenas.pop_back();
+      }
+    }
+    if (arena == nullptr) {
+      arena = std::make_unique<EventArena>();
+    }
+    arena->start();
+    return arena;
+  }
+
+  void release(std::unique_ptr<EventArena> arena) {
+    arena->finish();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_arenas.push_back(std::move(arena));
+  }
+
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<EventArena>> m_arenas;
+};
+
+// The heap memory of a decorator or sequence element over the events
+struct MemorySummary {
+  MemoryCounters total;
+  std::int64_t peakSum = 0;
+  std::int64_t peakMax = 0;
+  std::size_t peakMaxEvent = 0;
+
+  void add(const MemoryCounters& counters, std::size_t event) {
+    total.allocations += counters.allocations;
+    total.allocated += counters.allocated;
+    total.freed += counters.freed;
+    peakSum += counters.peak;
+    if (peakMax < counters.peak) {
+      peakMax = counters.peak;
+      peakMaxEvent = event;
+    }
+  }
+};
+
+// Install a span recorder for the duration of a run
+struct GlobalSpanRecorder {
+  Acts::SpanRecorder* previous = nullptr;
+
+  explicit GlobalSpanRecorder(Acts::SpanRecorder* recorder)
+      : previous(Acts::SpanRecorder::setGlobal(recorder)) {}
+  ~GlobalSpanRecorder() { Acts::SpanRecorder::setGlobal(previous); }
+};
+
+}  // namespace detail
+
+// The state of the event loop of one run, shared by all events
+struct Sequencer::RunState {
+  detail::Timepoint clockWallStart = detail::Clock::now();
+  // the names of the decorators and elements and their accumulated times
+  std::vector<std::string> names;
+  std::vector<detail::Duration> clocksAlgorithms;
+  tbbWrap::queuing_mutex clocksAlgorithmsMutex;
+
+  std::pair<std::size_t, std::size_t> eventsRange;
+  std::size_t nTotalEvents = 0;
+  std::atomic<std::size_t> nProcessedEvents = 0;
+
+  // the white board slots of all data handle keys and of their aliases
+  std::shared_ptr<WhiteBoard::Slots> slots;
+
+  // whether the readers, algorithms and writers run as an event pipeline
+  bool pipelined = false;
+  // the earlier elements every sequence element reads from
+  std::vector<std::vector<std::size_t>> inputs;
+  // dependencies for the concurrent execution of the sequence elements
+  std::vector<std::vector<std::size_t>> dependencies;
+  // the elements of the reader, algorithm and writer stages of the
+  // pipeline, or all elements in a single stage
+  std::vector<std::vector<std::size_t>> stageElements;
+
+  // the cache of the events and the elements it replaces
+  std::optional<EventCache> eventCache;
+  std::vector<bool> skippedElements;
+  std::vector<std::string> loadedCollections;
+  bool storeInCache = false;
+
+  // the memory arenas of the events in flight, if enabled
+  std::optional<detail::EventArenaPool> arenaPool;
+  // the heap memory of every decorator and element, if requested
+  std::vector<detail::MemorySummary> memorySummaries;
+  // the times of every event, if their percentiles are requested
+  std::vector<std::vector<detail::Duration>> eventClocks;
+  // the spans of the event loop, if a trace is requested
+  std::optional<Acts::SpanRecorder> spanRecorder;
+  std::optional<detail::GlobalSpanRecorder> globalSpanRecorder;
+};
+
+// The store and context of an event in flight, the arena outlives the
+// objects on the store
+struct Sequencer::EventState {
+  std::size_t event;
+  detail::EventArenaPool::Lease arena;
+  WhiteBoard eventStore;
+  AlgorithmContext context;
+  std::vector<detail::Duration> clocks;
+  std::vector<MemoryCounters> memory;
+
+  EventState(std::size_t event_, const Acts::Logging::Level level,
+             const std::unordered_map<std::string, std::string>& aliases,
+             std::shared_ptr<const WhiteBoard::Slots> slots,
+             detail::EventArenaPool* pool, std::size_t nClocks,
+             std::size_t nMemoryCounters)
+      : event(event_),
+        arena(pool),
+        eventStore(Acts::getDefaultLogger(
+                       "EventStore#" + std::to_string(event_), level),
+                   aliases, arena.resource(), std::move(slots)),
+        context(0, event_, eventStore),
+        clocks(nClocks, detail::Duration::zero()),
+        memory(nMemoryCounters) {
+    context.memoryResource = arena.resource();
+  }
+};
+
+}  // namespace ActsExamples
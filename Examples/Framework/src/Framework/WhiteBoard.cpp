@@ -61,11 +61,22 @@ std::vector<std::string_view> ActsExamples::WhiteBoard::similarNames(
     const std::string_view &name, int distThreshold,
     std::size_t maxNumber) const {
   std::vector<std::pair<int, std::string_view>> names;
+  std::lock_guard<std::mutex> lock(m_storeMutex);
   for (const auto &[n, h] : m_store) {
     if (const auto d = levenshteinDistance(n, name); d < distThreshold) {
       names.push_back({d, n});
     }
   }
+  if (m_slots != nullptr) {
+    for (const auto &[n, slot] : m_slots->indices) {
+      if (m_slotHolders[slot] == nullptr) {
+        continue;
+      }
+      if (const auto d = levenshteinDistance(n, name); d < distThreshold) {
+        names.push_back({d, n});
+      }
+    }
+  }
 
   std::sort(names.begin(), names.end(),
             [&](const auto &a, const auto &b) { return a.first < b.first; });
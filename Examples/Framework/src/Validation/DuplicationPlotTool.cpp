@@ -80,6 +80,17 @@ void ActsExamples::DuplicationPlotTool::write(
   duplicationPlotCache.nDuplicated_vs_phi->Write();
 }
 
+void ActsExamples::DuplicationPlotTool::merge(
+    DuplicationPlotTool::DuplicationPlotCache& duplicationPlotCache,
+    const DuplicationPlotTool::DuplicationPlotCache& other) const {
+  duplicationPlotCache.duplicationRate_vs_pT->Add(*other.duplicationRate_vs_pT);
+  duplicationPlotCache.duplicationRate_vs_eta->Add(*other.duplicationRate_vs_eta);
+  duplicationPlotCache.duplicationRate_vs_phi->Add(*other.duplicationRate_vs_phi);
+  duplicationPlotCache.nDuplicated_vs_pT->Add(other.nDuplicated_vs_pT);
+  duplicationPlotCache.nDuplicated_vs_eta->Add(other.nDuplicated_vs_eta);
+  duplicationPlotCache.nDuplicated_vs_phi->Add(other.nDuplicated_vs_phi);
+}
+
 void ActsExamples::DuplicationPlotTool::fill(
     DuplicationPlotTool::DuplicationPlotCache& duplicationPlotCache,
     const Acts::BoundTrackParameters& fittedParameters, bool status) const {
@@ -59,6 +59,15 @@ void ActsExamples::EffPlotTool::write(
   effPlotCache.trackEff_vs_DeltaR->Write();
 }
 
+void ActsExamples::EffPlotTool::merge(
+    EffPlotTool::EffPlotCache& effPlotCache,
+    const EffPlotTool::EffPlotCache& other) const {
+  effPlotCache.trackEff_vs_pT->Add(*other.trackEff_vs_pT);
+  effPlotCache.trackEff_vs_eta->Add(*other.trackEff_vs_eta);
+  effPlotCache.trackEff_vs_phi->Add(*other.trackEff_vs_phi);
+  effPlotCache.trackEff_vs_DeltaR->Add(*other.trackEff_vs_DeltaR);
+}
+
 void ActsExamples::EffPlotTool::fill(EffPlotTool::EffPlotCache& effPlotCache,
                                      const ActsFatras::Particle& truthParticle,
                                      double deltaR, bool status) const {
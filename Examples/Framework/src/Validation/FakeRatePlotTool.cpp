@@ -94,6 +94,20 @@ void ActsExamples::FakeRatePlotTool::write(
   fakeRatePlotCache.fakeRate_vs_phi->Write();
 }
 
+void ActsExamples::FakeRatePlotTool::merge(
+    FakeRatePlotTool::FakeRatePlotCache& fakeRatePlotCache,
+    const FakeRatePlotTool::FakeRatePlotCache& other) const {
+  fakeRatePlotCache.fakeRate_vs_pT->Add(*other.fakeRate_vs_pT);
+  fakeRatePlotCache.fakeRate_vs_eta->Add(*other.fakeRate_vs_eta);
+  fakeRatePlotCache.fakeRate_vs_phi->Add(*other.fakeRate_vs_phi);
+  fakeRatePlotCache.nReco_vs_pT->Add(other.nReco_vs_pT);
+  fakeRatePlotCache.nTruthMatched_vs_pT->Add(other.nTruthMatched_vs_pT);
+  fakeRatePlotCache.nFake_vs_pT->Add(other.nFake_vs_pT);
+  fakeRatePlotCache.nReco_vs_eta->Add(other.nReco_vs_eta);
+  fakeRatePlotCache.nTruthMatched_vs_eta->Add(other.nTruthMatched_vs_eta);
+  fakeRatePlotCache.nFake_vs_eta->Add(other.nFake_vs_eta);
+}
+
 void ActsExamples::FakeRatePlotTool::fill(
     FakeRatePlotTool::FakeRatePlotCache& fakeRatePlotCache,
     const Acts::BoundTrackParameters& fittedParameters, bool status) const {
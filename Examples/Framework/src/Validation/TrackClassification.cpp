@@ -112,3 +112,29 @@ void ActsExamples::identifyContributingParticles(
   }
   sortHitCount(particleHitCounts);
 }
+
+boost::container::flat_map<ActsFatras::Barcode, std::size_t>
+ActsExamples::countParticleHits(
+    const IndexMultimap<ActsFatras::Barcode>& hitParticlesMap) {
+  std::vector<ActsFatras::Barcode> particleIds;
+  particleIds.reserve(hitParticlesMap.size());
+  for (const auto& [_, particleId] : hitParticlesMap) {
+    particleIds.push_back(particleId);
+  }
+  std::sort(particleIds.begin(), particleIds.end());
+
+  // run-length encode the sorted ids to fill the map in one go
+  boost::container::flat_map<ActsFatras::Barcode, std::size_t>::sequence_type
+      counts;
+  for (auto particleId : particleIds) {
+    if (counts.empty() || counts.back().first != particleId) {
+      counts.emplace_back(particleId, 0u);
+    }
+    ++counts.back().second;
+  }
+
+  boost::container::flat_map<ActsFatras::Barcode, std::size_t> result;
+  result.adopt_sequence(boost::container::ordered_unique_range,
+                        std::move(counts));
+  return result;
+}
@@ -87,6 +87,21 @@ void ActsExamples::TrackSummaryPlotTool::write(
   trackSummaryPlotCache.nSharedHits_vs_pt->Write();
 }
 
+void ActsExamples::TrackSummaryPlotTool::merge(
+    TrackSummaryPlotTool::TrackSummaryPlotCache& trackSummaryPlotCache,
+    const TrackSummaryPlotTool::TrackSummaryPlotCache& other) const {
+  trackSummaryPlotCache.nStates_vs_eta->Add(other.nStates_vs_eta);
+  trackSummaryPlotCache.nMeasurements_vs_eta->Add(other.nMeasurements_vs_eta);
+  trackSummaryPlotCache.nHoles_vs_eta->Add(other.nHoles_vs_eta);
+  trackSummaryPlotCache.nOutliers_vs_eta->Add(other.nOutliers_vs_eta);
+  trackSummaryPlotCache.nSharedHits_vs_eta->Add(other.nSharedHits_vs_eta);
+  trackSummaryPlotCache.nStates_vs_pt->Add(other.nStates_vs_pt);
+  trackSummaryPlotCache.nMeasurements_vs_pt->Add(other.nMeasurements_vs_pt);
+  trackSummaryPlotCache.nHoles_vs_pt->Add(other.nHoles_vs_pt);
+  trackSummaryPlotCache.nOutliers_vs_pt->Add(other.nOutliers_vs_pt);
+  trackSummaryPlotCache.nSharedHits_vs_pt->Add(other.nSharedHits_vs_pt);
+}
+
 void ActsExamples::TrackSummaryPlotTool::fill(
     TrackSummaryPlotTool::TrackSummaryPlotCache& trackSummaryPlotCache,
     const Acts::BoundTrackParameters& fittedParameters, std::size_t nStates,
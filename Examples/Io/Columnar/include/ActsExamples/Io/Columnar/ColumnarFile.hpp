@@ -0,0 +1,217 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Value types of the columns
+enum class ColumnarType : std::uint8_t {
+  UInt8 = 1,
+  Int32 = 2,
+  UInt32 = 3,
+  UInt64 = 4,
+  Float = 5,
+  Double = 6,
+};
+
+/// The column type of a value type
+template <typename T>
+constexpr ColumnarType columnarType() {
+  if constexpr (std::is_same_v<T, std::uint8_t>) {
+    return ColumnarType::UInt8;
+  } else if constexpr (std::is_same_v<T, std::int32_t>) {
+    return ColumnarType::Int32;
+  } else if constexpr (std::is_same_v<T, std::uint32_t>) {
+    return ColumnarType::UInt32;
+  } else if constexpr (std::is_same_v<T, std::uint64_t>) {
+    return ColumnarType::UInt64;
+  } else if constexpr (std::is_same_v<T, float>) {
+    return ColumnarType::Float;
+  } else {
+    static_assert(std::is_same_v<T, double>, "Unsupported column type");
+    return ColumnarType::Double;
+  }
+}
+
+/// Description of a column
+struct ColumnarColumn {
+  std::string name;
+  ColumnarType type = ColumnarType::Double;
+  /// Number of values per row, zero for columns of variable length whose size
+  /// is given by other columns
+  std::uint32_t width = 1;
+
+  bool operator==(const ColumnarColumn& other) const {
+    return (name == other.name) && (type == other.type) &&
+           (width == other.width);
+  }
+};
+
+/// Read-only view of the values of a column in a mapped file
+template <typename T>
+class ColumnarView {
+ public:
+  ColumnarView() = default;
+  ColumnarView(const T* data, std::size_t size) : m_data(data), m_size(size) {}
+
+  const T* data() const { return m_data; }
+  std::size_t size() const { return m_size; }
+  const T* begin() const { return m_data; }
+  const T* end() const { return m_data + m_size; }
+  const T& operator[](std::size_t i) const { return m_data[i]; }
+
+ private:
+  const T* m_data = nullptr;
+  std::size_t m_size = 0;
+};
+
+/// The columns of one event in a mapped file
+///
+/// The views point into the mapping and are valid as long as the reader.
+class ColumnarEvent {
+ public:
+  /// The number of rows
+  std::size_t rows() const { return m_rows; }
+
+  /// The values of a column
+  ///
+  /// @throws std::invalid_argument if the value type does not match
+  template <typename T>
+  ColumnarView<T> column(std::size_t i) const {
+    if ((*m_columns)[i].type != columnarType<T>()) {
+      throw std::invalid_argument("Invalid value type for column '" +
+                                  (*m_columns)[i].name + "'");
+    }
+    return {reinterpret_cast<const T*>(m_values[i].first), m_values[i].second};
+  }
+
+ private:
+  friend class ColumnarFileReader;
+
+  const std::vector<ColumnarColumn>* m_columns = nullptr;
+  std::size_t m_rows = 0;
+  std::vector<std::pair<const char*, std::size_t>> m_values;
+};
+
+/// Write events into a binary columnar file
+///
+/// All events are stored in one file. The file starts with the kind of the
+/// stored objects and the column descriptions, followed by one block per
+/// event in which the values of each column are stored contiguously, and
+/// ends with an index of the event blocks. The values are stored in the
+/// native byte order and aligned to eight bytes, such that they can be used
+/// in place from a mapping of the file.
+///
+/// The events can be written from multiple threads and in any order.
+class ColumnarFileWriter {
+ public:
+  /// The values of a column for one event
+  struct Values {
+    ColumnarType type;
+    const void* data;
+    std::size_t size;
+
+    /// Implicit, such that the values of an event can be listed in braces
+    template <typename T>
+    Values(const std::vector<T>& values)
+        : type(columnarType<T>()), data(values.data()), size(values.size()) {}
+  };
+
+  /// Create the file and write the column descriptions
+  ///
+  /// @param path The file path
+  /// @param kind The kind of the objects, checked by the reader
+  /// @param columns The column descriptions
+  /// @throws std::runtime_error if the file can not be created
+  ColumnarFileWriter(const std::string& path, std::string kind,
+                     std::vector<ColumnarColumn> columns);
+  ColumnarFileWriter(const ColumnarFileWriter&) = delete;
+  ColumnarFileWriter& operator=(const ColumnarFileWriter&) = delete;
+  /// Close the file if it is still open
+  ~ColumnarFileWriter();
+
+  /// Write the columns of one event, can be called from any thread
+  ///
+  /// @param event The event number, every event can only be written once
+  /// @param rows The number of rows
+  /// @param values The values of every column
+  /// @throws std::invalid_argument if the values do not match the columns
+  /// @throws std::runtime_error if the event was already written or the file
+  ///         can not be written
+  void write(std::size_t event, std::size_t rows,
+             const std::vector<Values>& values);
+
+  /// Write the event index and close the file
+  void close();
+
+ private:
+  std::string m_path;
+  std::vector<ColumnarColumn> m_columns;
+  std::mutex m_mutex;
+  std::ofstream m_file;
+  std::uint64_t m_offset = 0;
+  /// file offset of the event blocks by event number
+  std::map<std::uint64_t, std::uint64_t> m_index;
+};
+
+/// Read events from a binary columnar file
+///
+/// The file is mapped into memory and the columns are accessed in place, the
+/// events can be read in any order and from any thread.
+class ColumnarFileReader {
+ public:
+  /// Map the file and check its column descriptions
+  ///
+  /// @param path The file path
+  /// @param kind The expected kind of the objects
+  /// @param columns The expected column descriptions
+  /// @throws std::runtime_error if the file can not be read or does not match
+  ///         the kind or the columns
+  ColumnarFileReader(const std::string& path, std::string_view kind,
+                     std::vector<ColumnarColumn> columns);
+  ColumnarFileReader(const ColumnarFileReader&) = delete;
+  ColumnarFileReader& operator=(const ColumnarFileReader&) = delete;
+
+  /// The range of the event numbers in the file
+  std::pair<std::size_t, std::size_t> availableEvents() const;
+
+  /// Whether the file contains an event
+  bool contains(std::size_t event) const;
+
+  /// The columns of an event
+  ///
+  /// @throws std::out_of_range if the event is not in the file
+  /// @throws std::runtime_error if the event block is corrupted
+  ColumnarEvent event(std::size_t event) const;
+
+ private:
+  [[noreturn]] void throwCorrupted() const;
+
+  std::string m_path;
+  std::vector<ColumnarColumn> m_columns;
+  Acts::MappedFile m_file;
+  /// event number and file offset of the event blocks, sorted by event
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> m_index;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,69 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace ActsExamples {
+class ColumnarFileReader;
+struct AlgorithmContext;
+
+/// Read simulated particles from a binary columnar file.
+///
+/// The events are read in any order from a mapping of the file. The columns
+/// are used in place to construct the objects directly in the output
+/// container, without intermediate copies.
+class ColumnarParticleReader final : public IReader {
+ public:
+  struct Config {
+    /// Path of the input file.
+    std::string filePath;
+    /// Output particles collection.
+    std::string outputParticles;
+  };
+
+  /// Construct the reader and map the input file.
+  ///
+  /// @param config is the configuration object
+  /// @param level is the logging level
+  ColumnarParticleReader(const Config& config, Acts::Logging::Level level);
+  ~ColumnarParticleReader() override;
+
+  std::string name() const override;
+
+  /// Return the available events range.
+  std::pair<std::size_t, std::size_t> availableEvents() const override;
+
+  /// Read out data from the input stream.
+  ProcessCode read(const ActsExamples::AlgorithmContext& ctx) override;
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  Config m_cfg;
+  std::unique_ptr<ColumnarFileReader> m_file;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  WriteDataHandle<SimParticleContainer> m_outputParticles{this,
+                                                         "OutputParticles"};
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
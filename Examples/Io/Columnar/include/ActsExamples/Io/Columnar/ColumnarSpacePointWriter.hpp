@@ -0,0 +1,64 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WriterT.hpp"
+
+#include <memory>
+#include <string>
+
+namespace ActsExamples {
+class ColumnarFileWriter;
+struct AlgorithmContext;
+
+/// Write space points into a binary columnar file.
+///
+/// All events are written into one file, see `ColumnarFileWriter` for the
+/// layout.
+///
+/// The source links of the space points must be index source links.
+class ColumnarSpacePointWriter final : public WriterT<SimSpacePointContainer> {
+ public:
+  struct Config {
+    /// Input space points collection to write.
+    std::string inputSpacePoints;
+    /// Path of the output file.
+    std::string filePath;
+  };
+
+  /// Construct the writer and create the output file.
+  ///
+  /// @param config is the configuration object
+  /// @param level is the logging level
+  ColumnarSpacePointWriter(const Config& config, Acts::Logging::Level level);
+  ~ColumnarSpacePointWriter() override;
+
+  /// Write the event index and close the file.
+  ProcessCode finalize() override;
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ protected:
+  /// Type-specific write implementation.
+  ///
+  /// @param[in] ctx is the algorithm context
+  /// @param[in] spacePoints are the space points to be written
+  ProcessCode writeT(const AlgorithmContext& ctx,
+                     const SimSpacePointContainer& spacePoints) override;
+
+ private:
+  Config m_cfg;
+  std::unique_ptr<ColumnarFileWriter> m_file;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,172 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// The columns of the event data files, shared by the writers and readers.
+//
+// The columns with width zero hold a variable number of values per row, given
+// by the size columns. Their values are stored in row order.
+
+namespace ActsExamples::Columnar {
+
+namespace Particles {
+
+constexpr std::string_view kKind = "particles";
+
+enum Column : std::size_t {
+  eParticleId,
+  eProcess,
+  ePdg,
+  eCharge,
+  eMass,
+  ePosition4,
+  eDirection,
+  eAbsoluteMomentum,
+  eProperTime,
+  ePathInX0,
+  ePathInL0,
+  eNumberOfHits,
+  eOutcome,
+};
+
+inline std::vector<ColumnarColumn> columns() {
+  return {
+      {"particle_id", ColumnarType::UInt64},
+      {"process", ColumnarType::UInt32},
+      {"pdg", ColumnarType::Int32},
+      {"charge", ColumnarType::Double},
+      {"mass", ColumnarType::Double},
+      {"position4", ColumnarType::Double, 4},
+      {"direction", ColumnarType::Double, 3},
+      {"absolute_momentum", ColumnarType::Double},
+      {"proper_time", ColumnarType::Double},
+      {"path_in_x0", ColumnarType::Double},
+      {"path_in_l0", ColumnarType::Double},
+      {"number_of_hits", ColumnarType::UInt32},
+      {"outcome", ColumnarType::UInt32},
+  };
+}
+
+}  // namespace Particles
+
+namespace SimHits {
+
+constexpr std::string_view kKind = "simhits";
+
+enum Column : std::size_t {
+  eGeometryId,
+  eParticleId,
+  ePosition4,
+  eMomentum4Before,
+  eMomentum4After,
+  eIndex,
+};
+
+inline std::vector<ColumnarColumn> columns() {
+  return {
+      {"geometry_id", ColumnarType::UInt64},
+      {"particle_id", ColumnarType::UInt64},
+      {"position4", ColumnarType::Double, 4},
+      {"momentum4_before", ColumnarType::Double, 4},
+      {"momentum4_after", ColumnarType::Double, 4},
+      {"index", ColumnarType::Int32},
+  };
+}
+
+}  // namespace SimHits
+
+namespace Measurements {
+
+constexpr std::string_view kKind = "measurements";
+
+enum Column : std::size_t {
+  eGeometryId,
+  eIndex,
+  // number of measured parameters
+  eSize,
+  // bound parameter indices, `size` per row
+  eIndices,
+  // `size` per row
+  eParameters,
+  // `size * size` per row, column-major
+  eCovariance,
+  eNumberOfSimHits,
+  // sim hit indices, `number_of_sim_hits` per row
+  eSimHits,
+};
+
+inline std::vector<ColumnarColumn> columns() {
+  return {
+      {"geometry_id", ColumnarType::UInt64},
+      {"index", ColumnarType::UInt32},
+      {"size", ColumnarType::UInt8},
+      {"indices", ColumnarType::UInt8, 0},
+      {"parameters", ColumnarType::Double, 0},
+      {"covariance", ColumnarType::Double, 0},
+      {"number_of_sim_hits", ColumnarType::UInt32},
+      {"sim_hits", ColumnarType::UInt32, 0},
+  };
+}
+
+}  // namespace Measurements
+
+namespace SpacePoints {
+
+constexpr std::string_view kKind = "spacepoints";
+
+enum Flag : std::uint8_t {
+  eHasTime = 1 << 0,
+  eHasVarianceTime = 1 << 1,
+  eHasStripDetails = 1 << 2,
+};
+
+enum Column : std::size_t {
+  ePosition,
+  eTime,
+  eVarianceR,
+  eVarianceZ,
+  eVarianceTime,
+  eFlags,
+  eNumberOfSourceLinks,
+  // `number_of_source_links` per row
+  eSourceLinkGeometryId,
+  eSourceLinkIndex,
+  // top and bottom half length for the rows with strip details
+  eStripHalfLengths,
+  // top direction, bottom direction, center distance and top center position
+  // for the rows with strip details
+  eStripVectors,
+};
+
+inline std::vector<ColumnarColumn> columns() {
+  return {
+      {"position", ColumnarType::Double, 3},
+      {"t", ColumnarType::Double},
+      {"variance_r", ColumnarType::Double},
+      {"variance_z", ColumnarType::Double},
+      {"variance_t", ColumnarType::Double},
+      {"flags", ColumnarType::UInt8},
+      {"number_of_source_links", ColumnarType::UInt8},
+      {"source_link_geometry_id", ColumnarType::UInt64, 0},
+      {"source_link_index", ColumnarType::UInt32, 0},
+      {"strip_half_lengths", ColumnarType::Float, 0},
+      {"strip_vectors", ColumnarType::Double, 0},
+  };
+}
+
+}  // namespace SpacePoints
+
+}  // namespace ActsExamples::Columnar
@@ -0,0 +1,299 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ActsExamples {
+
+namespace {
+
+constexpr std::string_view kMagic = "ACTSCOL1";
+constexpr std::size_t kAlignment = 8;
+
+std::size_t typeSize(ColumnarType type) {
+  switch (type) {
+    case ColumnarType::UInt8:
+      return sizeof(std::uint8_t);
+    case ColumnarType::Int32:
+      return sizeof(std::int32_t);
+    case ColumnarType::UInt32:
+      return sizeof(std::uint32_t);
+    case ColumnarType::UInt64:
+      return sizeof(std::uint64_t);
+    case ColumnarType::Float:
+      return sizeof(float);
+    case ColumnarType::Double:
+      return sizeof(double);
+  }
+  return 0;
+}
+
+// append to an in-memory buffer, the file is written in large pieces
+
+template <typename T>
+void append(std::string& buffer, const T& value) {
+  static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void appendString(std::string& buffer, std::string_view str) {
+  append<std::uint32_t>(buffer, str.size());
+  buffer.append(str);
+}
+
+void pad(std::string& buffer) {
+  buffer.append((kAlignment - buffer.size() % kAlignment) % kAlignment, '\0');
+}
+
+/// Bounds-checked reads from the mapping
+class Cursor {
+ public:
+  Cursor(const char* data, std::size_t size, std::size_t offset)
+      : m_begin(data), m_end(data + size), m_pos(data + offset) {
+    if (offset > size) {
+      m_pos = nullptr;
+    }
+  }
+
+  bool valid() const { return m_pos != nullptr; }
+
+  const char* take(std::size_t size) {
+    if (!valid() || static_cast<std::size_t>(m_end - m_pos) < size) {
+      m_pos = nullptr;
+      return nullptr;
+    }
+    const char* data = m_pos;
+    m_pos += size;
+    return data;
+  }
+
+  template <typename T>
+  T read() {
+    T value{};
+    if (const char* data = take(sizeof(T)); data != nullptr) {
+      std::memcpy(&value, data, sizeof(T));
+    }
+    return value;
+  }
+
+  std::string_view readString() {
+    std::size_t size = read<std::uint32_t>();
+    const char* data = take(size);
+    return (data != nullptr) ? std::string_view(data, size) : "";
+  }
+
+  void skipPadding() {
+    if (valid()) {
+      take((kAlignment - (m_pos - m_begin) % kAlignment) % kAlignment);
+    }
+  }
+
+ private:
+  const char* m_begin;
+  const char* m_end;
+  const char* m_pos;
+};
+
+}  // namespace
+
+ColumnarFileWriter::ColumnarFileWriter(const std::string& path,
+                                       std::string kind,
+                                       std::vector<ColumnarColumn> columns)
+    : m_path(path), m_columns(std::move(columns)) {
+  m_file.open(path, std::ios::binary | std::ios::trunc);
+  if (!m_file) {
+    throw std::runtime_error("Could not create file '" + path + "'");
+  }
+  std::string header(kMagic);
+  appendString(header, kind);
+  append<std::uint32_t>(header, m_columns.size());
+  for (const auto& column : m_columns) {
+    append(header, column.type);
+    append(header, column.width);
+    appendString(header, column.name);
+  }
+  pad(header);
+  m_file.write(header.data(), header.size());
+  m_offset = header.size();
+}
+
+ColumnarFileWriter::~ColumnarFileWriter() {
+  try {
+    close();
+  } catch (...) {
+    // errors can only be reported by an explicit `close`
+  }
+}
+
+void ColumnarFileWriter::write(std::size_t event, std::size_t rows,
+                               const std::vector<Values>& values) {
+  if (values.size() != m_columns.size()) {
+    throw std::invalid_argument("Invalid number of columns for file '" +
+                                m_path + "'");
+  }
+  // assemble the block outside of the lock
+  std::string block;
+  append<std::uint64_t>(block, rows);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    const ColumnarColumn& column = m_columns[i];
+    if (values[i].type != column.type) {
+      throw std::invalid_argument("Invalid value type for column '" +
+                                  column.name + "'");
+    }
+    if ((column.width != 0) && (values[i].size != rows * column.width)) {
+      throw std::invalid_argument("Invalid number of values for column '" +
+                                  column.name + "'");
+    }
+    append<std::uint64_t>(block, values[i].size);
+    block.append(static_cast<const char*>(values[i].data),
+                 values[i].size * typeSize(column.type));
+    pad(block);
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_file.is_open()) {
+    throw std::runtime_error("File '" + m_path + "' is already closed");
+  }
+  if (!m_index.emplace(event, m_offset).second) {
+    throw std::runtime_error("Event " + std::to_string(event) +
+                             " is already written to file '" + m_path + "'");
+  }
+  m_file.write(block.data(), block.size());
+  if (!m_file) {
+    throw std::runtime_error("Could not write to file '" + m_path + "'");
+  }
+  m_offset += block.size();
+}
+
+void ColumnarFileWriter::close() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_file.is_open()) {
+    return;
+  }
+  std::string trailer;
+  for (const auto& [event, offset] : m_index) {
+    append(trailer, event);
+    append(trailer, offset);
+  }
+  append(trailer, m_offset);
+  append<std::uint64_t>(trailer, m_index.size());
+  trailer.append(kMagic);
+  m_file.write(trailer.data(), trailer.size());
+  m_file.close();
+  if (!m_file) {
+    throw std::runtime_error("Could not write to file '" + m_path + "'");
+  }
+}
+
+ColumnarFileReader::ColumnarFileReader(const std::string& path,
+                                       std::string_view kind,
+                                       std::vector<ColumnarColumn> columns)
+    : m_path(path), m_columns(std::move(columns)), m_file(path) {
+  const char* data = reinterpret_cast<const char*>(m_file.data());
+  const std::size_t size = m_file.size();
+
+  Cursor header(data, size, 0);
+  const char* magic = header.take(kMagic.size());
+  if ((magic == nullptr) ||
+      (std::string_view(magic, kMagic.size()) != kMagic)) {
+    throw std::runtime_error("File '" + path +
+                             "' is not a columnar event file");
+  }
+  if (header.readString() != kind) {
+    throw std::runtime_error("File '" + path + "' does not contain " +
+                             std::string(kind));
+  }
+  std::vector<ColumnarColumn> fileColumns(header.read<std::uint32_t>());
+  for (auto& column : fileColumns) {
+    column.type = header.read<ColumnarType>();
+    column.width = header.read<std::uint32_t>();
+    column.name = header.readString();
+  }
+  if (!header.valid()) {
+    throwCorrupted();
+  }
+  if (fileColumns != m_columns) {
+    throw std::runtime_error("Unexpected columns in file '" + path + "'");
+  }
+
+  constexpr std::size_t kTrailerSize = 2 * sizeof(std::uint64_t);
+  if (size < kMagic.size() + kTrailerSize) {
+    throwCorrupted();
+  }
+  Cursor trailer(data, size, size - kTrailerSize - kMagic.size());
+  auto indexOffset = trailer.read<std::uint64_t>();
+  auto nEvents = trailer.read<std::uint64_t>();
+  magic = trailer.take(kMagic.size());
+  if ((magic == nullptr) ||
+      (std::string_view(magic, kMagic.size()) != kMagic)) {
+    // the writer was not closed
+    throwCorrupted();
+  }
+  Cursor index(data, size, indexOffset);
+  m_index.resize(nEvents);
+  for (auto& [event, offset] : m_index) {
+    event = index.read<std::uint64_t>();
+    offset = index.read<std::uint64_t>();
+  }
+  if (!index.valid()) {
+    throwCorrupted();
+  }
+}
+
+std::pair<std::size_t, std::size_t> ColumnarFileReader::availableEvents()
+    const {
+  if (m_index.empty()) {
+    return {0, 0};
+  }
+  return {m_index.front().first, m_index.back().first + 1};
+}
+
+bool ColumnarFileReader::contains(std::size_t event) const {
+  return std::binary_search(
+      m_index.begin(), m_index.end(), std::make_pair(event, 0),
+      [](const auto& a, const auto& b) { return a.first < b.first; });
+}
+
+ColumnarEvent ColumnarFileReader::event(std::size_t event) const {
+  auto it = std::lower_bound(
+      m_index.begin(), m_index.end(), event,
+      [](const auto& entry, std::size_t value) { return entry.first < value; });
+  if ((it == m_index.end()) || (it->first != event)) {
+    throw std::out_of_range("Event " + std::to_string(event) +
+                            " is not in file '" + m_path + "'");
+  }
+
+  ColumnarEvent columns;
+  columns.m_columns = &m_columns;
+  Cursor block(reinterpret_cast<const char*>(m_file.data()), m_file.size(),
+               it->second);
+  columns.m_rows = block.read<std::uint64_t>();
+  columns.m_values.reserve(m_columns.size());
+  for (const ColumnarColumn& column : m_columns) {
+    std::size_t size = block.read<std::uint64_t>();
+    if ((column.width != 0) && (size != columns.m_rows * column.width)) {
+      throwCorrupted();
+    }
+    const char* data = block.take(size * typeSize(column.type));
+    block.skipPadding();
+    columns.m_values.emplace_back(data, size);
+  }
+  if (!block.valid()) {
+    throwCorrupted();
+  }
+  return columns;
+}
+
+void ColumnarFileReader::throwCorrupted() const {
+  throw std::runtime_error("Corrupted columnar event file '" + m_path + "'");
+}
+
+}  // namespace ActsExamples
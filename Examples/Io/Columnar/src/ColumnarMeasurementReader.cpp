@@ -0,0 +1,159 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Columnar/ColumnarMeasurementReader.hpp"
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+
+#include "ColumnarColumns.hpp"
+
+namespace ActsExamples {
+
+namespace {
+
+template <std::size_t kSize>
+Measurement makeMeasurement(const IndexSourceLink& sourceLink,
+                            const std::uint8_t* indices,
+                            const double* parameters,
+                            const double* covariance) {
+  using FixedMeasurement = Acts::Measurement<Acts::BoundIndices, kSize>;
+  std::array<Acts::BoundIndices, kSize> boundIndices{};
+  for (std::size_t i = 0; i < kSize; ++i) {
+    boundIndices[i] = static_cast<Acts::BoundIndices>(indices[i]);
+  }
+  return FixedMeasurement(
+      Acts::SourceLink(sourceLink), boundIndices,
+      Eigen::Map<const typename FixedMeasurement::ParametersVector>(parameters),
+      Eigen::Map<const typename FixedMeasurement::CovarianceMatrix>(
+          covariance));
+}
+
+template <std::size_t... kIndices>
+Measurement makeMeasurement(std::size_t size, const IndexSourceLink& sourceLink,
+                            const std::uint8_t* indices,
+                            const double* parameters, const double* covariance,
+                            std::index_sequence<kIndices...> /*indices*/) {
+  using Maker = Measurement (*)(const IndexSourceLink&, const std::uint8_t*,
+                                const double*, const double*);
+  // the alternative i of the variant holds a measurement of size i + 1
+  static constexpr std::array<Maker, sizeof...(kIndices)> makers = {
+      &makeMeasurement<kIndices + 1>...};
+  return makers.at(size - 1)(sourceLink, indices, parameters, covariance);
+}
+
+}  // namespace
+
+ColumnarMeasurementReader::ColumnarMeasurementReader(const Config& config,
+                                                     Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger(Acts::getDefaultLogger("ColumnarMeasurementReader", level)) {
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  if (m_cfg.outputMeasurements.empty()) {
+    throw std::invalid_argument("Missing measurements output collection");
+  }
+  if (m_cfg.outputSourceLinks.empty()) {
+    throw std::invalid_argument("Missing source links output collection");
+  }
+
+  m_file = std::make_unique<ColumnarFileReader>(
+      m_cfg.filePath, Columnar::Measurements::kKind,
+      Columnar::Measurements::columns());
+  m_outputMeasurements.initialize(m_cfg.outputMeasurements);
+  m_outputSourceLinks.initialize(m_cfg.outputSourceLinks);
+  m_outputMeasurementSimHitsMap.maybeInitialize(
+      m_cfg.outputMeasurementSimHitsMap);
+}
+
+ColumnarMeasurementReader::~ColumnarMeasurementReader() = default;
+
+std::string ColumnarMeasurementReader::name() const {
+  return "ColumnarMeasurementReader";
+}
+
+std::pair<std::size_t, std::size_t>
+ColumnarMeasurementReader::availableEvents() const {
+  return m_file->availableEvents();
+}
+
+ProcessCode ColumnarMeasurementReader::read(const AlgorithmContext& ctx) {
+  using namespace Columnar::Measurements;
+  constexpr std::size_t kMaxSize = std::variant_size_v<Measurement>;
+
+  if (!m_file->contains(ctx.eventNumber)) {
+    ACTS_ERROR("Event " << ctx.eventNumber << " is not in the input file");
+    return ProcessCode::ABORT;
+  }
+  ColumnarEvent columns = m_file->event(ctx.eventNumber);
+  auto geometryId = columns.column<std::uint64_t>(eGeometryId);
+  auto index = columns.column<std::uint32_t>(eIndex);
+  auto size = columns.column<std::uint8_t>(eSize);
+  auto indices = columns.column<std::uint8_t>(eIndices);
+  auto parameters = columns.column<double>(eParameters);
+  auto covariance = columns.column<double>(eCovariance);
+  auto numberOfSimHits = columns.column<std::uint32_t>(eNumberOfSimHits);
+  auto simHits = columns.column<std::uint32_t>(eSimHits);
+
+  MeasurementContainer measurements;
+  IndexSourceLinkContainer sourceLinks;
+  IndexMultimap<Index> measurementSimHitsMap;
+  measurements.reserve(columns.rows());
+  sourceLinks.reserve(columns.rows());
+
+  // offsets into the columns of variable length
+  std::size_t parameterOffset = 0;
+  std::size_t covarianceOffset = 0;
+  std::size_t simHitOffset = 0;
+  for (std::size_t i = 0; i < columns.rows(); ++i) {
+    const std::size_t n = size[i];
+    if ((n == 0) || (n > kMaxSize) ||
+        (parameterOffset + n > indices.size()) ||
+        (parameterOffset + n > parameters.size()) ||
+        (covarianceOffset + n * n > covariance.size()) ||
+        (simHitOffset + numberOfSimHits[i] > simHits.size())) {
+      ACTS_ERROR("Invalid measurement " << i << " in event "
+                                        << ctx.eventNumber);
+      return ProcessCode::ABORT;
+    }
+
+    IndexSourceLink sourceLink(Acts::GeometryIdentifier(geometryId[i]),
+                               index[i]);
+    measurements.push_back(makeMeasurement(
+        n, sourceLink, &indices[parameterOffset], &parameters[parameterOffset],
+        &covariance[covarianceOffset],
+        std::make_index_sequence<kMaxSize>()));
+    sourceLinks.insert(sourceLinks.end(), sourceLink);
+    for (std::size_t j = 0; j < numberOfSimHits[i]; ++j) {
+      measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(), i,
+                                         simHits[simHitOffset + j]);
+    }
+    parameterOffset += n;
+    covarianceOffset += n * n;
+    simHitOffset += numberOfSimHits[i];
+  }
+
+  m_outputMeasurements(ctx, std::move(measurements));
+  m_outputSourceLinks(ctx, std::move(sourceLinks));
+  if (m_outputMeasurementSimHitsMap.isInitialized()) {
+    m_outputMeasurementSimHitsMap(ctx, std::move(measurementSimHitsMap));
+  }
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
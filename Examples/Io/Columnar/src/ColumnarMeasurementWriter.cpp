@@ -0,0 +1,104 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Columnar/ColumnarMeasurementWriter.hpp"
+
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+#include "ColumnarColumns.hpp"
+
+namespace ActsExamples {
+
+ColumnarMeasurementWriter::ColumnarMeasurementWriter(
+    const Config& config, Acts::Logging::Level level)
+    : WriterT(config.inputMeasurements, "ColumnarMeasurementWriter", level),
+      m_cfg(config) {
+  // inputMeasurements is already checked by base constructor
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  m_inputMeasurementSimHitsMap.maybeInitialize(
+      m_cfg.inputMeasurementSimHitsMap);
+  m_file = std::make_unique<ColumnarFileWriter>(
+      m_cfg.filePath, std::string(Columnar::Measurements::kKind),
+      Columnar::Measurements::columns());
+}
+
+ColumnarMeasurementWriter::~ColumnarMeasurementWriter() = default;
+
+ProcessCode ColumnarMeasurementWriter::finalize() {
+  m_file->close();
+  ACTS_INFO("Wrote measurements to file '" << m_cfg.filePath << "'");
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode ColumnarMeasurementWriter::writeT(
+    const AlgorithmContext& ctx, const MeasurementContainer& measurements) {
+  const IndexMultimap<Index>* measurementSimHitsMap = nullptr;
+  if (m_inputMeasurementSimHitsMap.isInitialized()) {
+    measurementSimHitsMap = &m_inputMeasurementSimHitsMap(ctx);
+  }
+
+  const std::size_t n = measurements.size();
+  std::vector<std::uint64_t> geometryId;
+  std::vector<std::uint32_t> index;
+  std::vector<std::uint8_t> size;
+  std::vector<std::uint8_t> indices;
+  std::vector<double> parameters;
+  std::vector<double> covariance;
+  std::vector<std::uint32_t> numberOfSimHits;
+  std::vector<std::uint32_t> simHits;
+  geometryId.reserve(n);
+  index.reserve(n);
+  size.reserve(n);
+  numberOfSimHits.reserve(n);
+
+  for (std::size_t i = 0; i < n; ++i) {
+    std::visit(
+        [&](const auto& meas) {
+          const auto& sourceLink =
+              meas.sourceLink().template get<IndexSourceLink>();
+          geometryId.push_back(sourceLink.geometryId().value());
+          index.push_back(sourceLink.index());
+          size.push_back(meas.size());
+          for (auto boundIndex : meas.indices()) {
+            indices.push_back(boundIndex);
+          }
+          const auto& params = meas.parameters();
+          parameters.insert(parameters.end(), params.data(),
+                            params.data() + params.size());
+          const auto& cov = meas.covariance();
+          covariance.insert(covariance.end(), cov.data(),
+                            cov.data() + cov.size());
+        },
+        measurements[i]);
+
+    std::uint32_t nSimHits = 0;
+    if (measurementSimHitsMap != nullptr) {
+      auto [begin, end] = measurementSimHitsMap->equal_range(i);
+      for (auto it = begin; it != end; ++it, ++nSimHits) {
+        simHits.push_back(it->second);
+      }
+    }
+    numberOfSimHits.push_back(nSimHits);
+  }
+
+  m_file->write(ctx.eventNumber, n,
+                {geometryId, index, size, indices, parameters, covariance,
+                 numberOfSimHits, simHits});
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
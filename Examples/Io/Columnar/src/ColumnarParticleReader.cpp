@@ -0,0 +1,101 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Columnar/ColumnarParticleReader.hpp"
+
+#include "Acts/Definitions/PdgParticle.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+#include "ActsFatras/EventData/ParticleOutcome.hpp"
+#include "ActsFatras/EventData/ProcessType.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "ColumnarColumns.hpp"
+
+namespace ActsExamples {
+
+ColumnarParticleReader::ColumnarParticleReader(const Config& config,
+                                               Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger(Acts::getDefaultLogger("ColumnarParticleReader", level)) {
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  if (m_cfg.outputParticles.empty()) {
+    throw std::invalid_argument("Missing output collection");
+  }
+
+  m_file = std::make_unique<ColumnarFileReader>(m_cfg.filePath,
+                                                Columnar::Particles::kKind,
+                                                Columnar::Particles::columns());
+  m_outputParticles.initialize(m_cfg.outputParticles);
+}
+
+ColumnarParticleReader::~ColumnarParticleReader() = default;
+
+std::string ColumnarParticleReader::name() const {
+  return "ColumnarParticleReader";
+}
+
+std::pair<std::size_t, std::size_t> ColumnarParticleReader::availableEvents()
+    const {
+  return m_file->availableEvents();
+}
+
+ProcessCode ColumnarParticleReader::read(const AlgorithmContext& ctx) {
+  using namespace Columnar::Particles;
+  using Vector4 = SimParticle::Vector4;
+  using Vector3 = SimParticle::Vector3;
+
+  if (!m_file->contains(ctx.eventNumber)) {
+    ACTS_ERROR("Event " << ctx.eventNumber << " is not in the input file");
+    return ProcessCode::ABORT;
+  }
+  ColumnarEvent columns = m_file->event(ctx.eventNumber);
+  auto particleId = columns.column<std::uint64_t>(eParticleId);
+  auto process = columns.column<std::uint32_t>(eProcess);
+  auto pdg = columns.column<std::int32_t>(ePdg);
+  auto charge = columns.column<double>(eCharge);
+  auto mass = columns.column<double>(eMass);
+  auto position4 = columns.column<double>(ePosition4);
+  auto direction = columns.column<double>(eDirection);
+  auto absoluteMomentum = columns.column<double>(eAbsoluteMomentum);
+  auto properTime = columns.column<double>(eProperTime);
+  auto pathInX0 = columns.column<double>(ePathInX0);
+  auto pathInL0 = columns.column<double>(ePathInL0);
+  auto numberOfHits = columns.column<std::uint32_t>(eNumberOfHits);
+  auto outcome = columns.column<std::uint32_t>(eOutcome);
+
+  SimParticleContainer::sequence_type particles;
+  particles.reserve(columns.rows());
+  for (std::size_t i = 0; i < columns.rows(); ++i) {
+    SimParticle& particle =
+        particles.emplace_back(SimBarcode(particleId[i]),
+                               static_cast<Acts::PdgParticle>(pdg[i]),
+                               charge[i], mass[i]);
+    particle.setProcess(static_cast<ActsFatras::ProcessType>(process[i]));
+    particle.setPosition4(Eigen::Map<const Vector4>(&position4[4 * i]));
+    particle.setDirection(Eigen::Map<const Vector3>(&direction[3 * i]));
+    particle.setAbsoluteMomentum(absoluteMomentum[i]);
+    particle.setProperTime(properTime[i]);
+    particle.setMaterialPassed(pathInX0[i], pathInL0[i]);
+    particle.setNumberOfHits(numberOfHits[i]);
+    particle.setOutcome(static_cast<ActsFatras::ParticleOutcome>(outcome[i]));
+  }
+
+  // the particles were written in container order
+  SimParticleContainer container;
+  container.adopt_sequence(boost::container::ordered_unique_range,
+                           std::move(particles));
+  m_outputParticles(ctx, std::move(container));
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,105 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Columnar/ColumnarParticleWriter.hpp"
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "ColumnarColumns.hpp"
+
+namespace ActsExamples {
+
+namespace {
+
+template <typename vector_t>
+void appendVector(std::vector<double>& values, const vector_t& vector) {
+  values.insert(values.end(), vector.data(), vector.data() + vector.size());
+}
+
+}  // namespace
+
+ColumnarParticleWriter::ColumnarParticleWriter(const Config& config,
+                                               Acts::Logging::Level level)
+    : WriterT(config.inputParticles, "ColumnarParticleWriter", level),
+      m_cfg(config) {
+  // inputParticles is already checked by base constructor
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  m_file = std::make_unique<ColumnarFileWriter>(
+      m_cfg.filePath, std::string(Columnar::Particles::kKind),
+      Columnar::Particles::columns());
+}
+
+ColumnarParticleWriter::~ColumnarParticleWriter() = default;
+
+ProcessCode ColumnarParticleWriter::finalize() {
+  m_file->close();
+  ACTS_INFO("Wrote particles to file '" << m_cfg.filePath << "'");
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode ColumnarParticleWriter::writeT(
+    const AlgorithmContext& ctx, const SimParticleContainer& particles) {
+  const std::size_t n = particles.size();
+  std::vector<std::uint64_t> particleId;
+  std::vector<std::uint32_t> process;
+  std::vector<std::int32_t> pdg;
+  std::vector<double> charge;
+  std::vector<double> mass;
+  std::vector<double> position4;
+  std::vector<double> direction;
+  std::vector<double> absoluteMomentum;
+  std::vector<double> properTime;
+  std::vector<double> pathInX0;
+  std::vector<double> pathInL0;
+  std::vector<std::uint32_t> numberOfHits;
+  std::vector<std::uint32_t> outcome;
+  particleId.reserve(n);
+  process.reserve(n);
+  pdg.reserve(n);
+  charge.reserve(n);
+  mass.reserve(n);
+  position4.reserve(4 * n);
+  direction.reserve(3 * n);
+  absoluteMomentum.reserve(n);
+  properTime.reserve(n);
+  pathInX0.reserve(n);
+  pathInL0.reserve(n);
+  numberOfHits.reserve(n);
+  outcome.reserve(n);
+
+  for (const SimParticle& particle : particles) {
+    particleId.push_back(particle.particleId().value());
+    process.push_back(static_cast<std::uint32_t>(particle.process()));
+    pdg.push_back(particle.pdg());
+    charge.push_back(particle.charge());
+    mass.push_back(particle.mass());
+    appendVector(position4, particle.fourPosition());
+    appendVector(direction, particle.direction());
+    absoluteMomentum.push_back(particle.absoluteMomentum());
+    properTime.push_back(particle.properTime());
+    pathInX0.push_back(particle.pathInX0());
+    pathInL0.push_back(particle.pathInL0());
+    numberOfHits.push_back(particle.numberOfHits());
+    outcome.push_back(static_cast<std::uint32_t>(particle.outcome()));
+  }
+
+  m_file->write(ctx.eventNumber, n,
+                {particleId, process, pdg, charge, mass, position4, direction,
+                 absoluteMomentum, properTime, pathInX0, pathInL0,
+                 numberOfHits, outcome});
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
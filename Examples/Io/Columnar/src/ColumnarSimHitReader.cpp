@@ -0,0 +1,86 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Columnar/ColumnarSimHitReader.hpp"
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "ColumnarColumns.hpp"
+
+namespace ActsExamples {
+
+ColumnarSimHitReader::ColumnarSimHitReader(const Config& config,
+                                           Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger(Acts::getDefaultLogger("ColumnarSimHitReader", level)) {
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  if (m_cfg.outputSimHits.empty()) {
+    throw std::invalid_argument("Missing simulated hits output collection");
+  }
+
+  m_file = std::make_unique<ColumnarFileReader>(m_cfg.filePath,
+                                                Columnar::SimHits::kKind,
+                                                Columnar::SimHits::columns());
+  m_outputSimHits.initialize(m_cfg.outputSimHits);
+}
+
+ColumnarSimHitReader::~ColumnarSimHitReader() = default;
+
+std::string ColumnarSimHitReader::name() const {
+  return "ColumnarSimHitReader";
+}
+
+std::pair<std::size_t, std::size_t> ColumnarSimHitReader::availableEvents()
+    const {
+  return m_file->availableEvents();
+}
+
+ProcessCode ColumnarSimHitReader::read(const AlgorithmContext& ctx) {
+  using namespace Columnar::SimHits;
+  using Vector4 = SimHit::Vector4;
+
+  if (!m_file->contains(ctx.eventNumber)) {
+    ACTS_ERROR("Event " << ctx.eventNumber << " is not in the input file");
+    return ProcessCode::ABORT;
+  }
+  ColumnarEvent columns = m_file->event(ctx.eventNumber);
+  auto geometryId = columns.column<std::uint64_t>(eGeometryId);
+  auto particleId = columns.column<std::uint64_t>(eParticleId);
+  auto position4 = columns.column<double>(ePosition4);
+  auto momentum4Before = columns.column<double>(eMomentum4Before);
+  auto momentum4After = columns.column<double>(eMomentum4After);
+  auto index = columns.column<std::int32_t>(eIndex);
+
+  SimHitContainer::sequence_type simHits;
+  simHits.reserve(columns.rows());
+  for (std::size_t i = 0; i < columns.rows(); ++i) {
+    simHits.emplace_back(Acts::GeometryIdentifier(geometryId[i]),
+                         ActsFatras::Barcode(particleId[i]),
+                         Eigen::Map<const Vector4>(&position4[4 * i]),
+                         Eigen::Map<const Vector4>(&momentum4Before[4 * i]),
+                         Eigen::Map<const Vector4>(&momentum4After[4 * i]),
+                         index[i]);
+  }
+
+  // the hits were written in container order
+  SimHitContainer container;
+  container.adopt_sequence(boost::container::ordered_range,
+                           std::move(simHits));
+  m_outputSimHits(ctx, std::move(container));
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,83 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Columnar/ColumnarSimHitWriter.hpp"
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "ColumnarColumns.hpp"
+
+namespace ActsExamples {
+
+namespace {
+
+template <typename vector_t>
+void appendVector(std::vector<double>& values, const vector_t& vector) {
+  values.insert(values.end(), vector.data(), vector.data() + vector.size());
+}
+
+}  // namespace
+
+ColumnarSimHitWriter::ColumnarSimHitWriter(const Config& config,
+                                           Acts::Logging::Level level)
+    : WriterT(config.inputSimHits, "ColumnarSimHitWriter", level),
+      m_cfg(config) {
+  // inputSimHits is already checked by base constructor
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  m_file = std::make_unique<ColumnarFileWriter>(
+      m_cfg.filePath, std::string(Columnar::SimHits::kKind),
+      Columnar::SimHits::columns());
+}
+
+ColumnarSimHitWriter::~ColumnarSimHitWriter() = default;
+
+ProcessCode ColumnarSimHitWriter::finalize() {
+  m_file->close();
+  ACTS_INFO("Wrote simulated hits to file '" << m_cfg.filePath << "'");
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode ColumnarSimHitWriter::writeT(const AlgorithmContext& ctx,
+                                         const SimHitContainer& simHits) {
+  const std::size_t n = simHits.size();
+  std::vector<std::uint64_t> geometryId;
+  std::vector<std::uint64_t> particleId;
+  std::vector<double> position4;
+  std::vector<double> momentum4Before;
+  std::vector<double> momentum4After;
+  std::vector<std::int32_t> index;
+  geometryId.reserve(n);
+  particleId.reserve(n);
+  position4.reserve(4 * n);
+  momentum4Before.reserve(4 * n);
+  momentum4After.reserve(4 * n);
+  index.reserve(n);
+
+  for (const SimHit& hit : simHits) {
+    geometryId.push_back(hit.geometryId().value());
+    particleId.push_back(hit.particleId().value());
+    appendVector(position4, hit.fourPosition());
+    appendVector(momentum4Before, hit.momentum4Before());
+    appendVector(momentum4After, hit.momentum4After());
+    index.push_back(hit.index());
+  }
+
+  m_file->write(ctx.eventNumber, n,
+                {geometryId, particleId, position4, momentum4Before,
+                 momentum4After, index});
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,136 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Columnar/ColumnarSpacePointReader.hpp"
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+
+#include <boost/container/static_vector.hpp>
+
+#include "ColumnarColumns.hpp"
+
+namespace ActsExamples {
+
+ColumnarSpacePointReader::ColumnarSpacePointReader(const Config& config,
+                                                   Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger(Acts::getDefaultLogger("ColumnarSpacePointReader", level)) {
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  if (m_cfg.outputSpacePoints.empty()) {
+    throw std::invalid_argument("Missing space points output collection");
+  }
+
+  m_file = std::make_unique<ColumnarFileReader>(
+      m_cfg.filePath, Columnar::SpacePoints::kKind,
+      Columnar::SpacePoints::columns());
+  m_outputSpacePoints.initialize(m_cfg.outputSpacePoints);
+}
+
+ColumnarSpacePointReader::~ColumnarSpacePointReader() = default;
+
+std::string ColumnarSpacePointReader::name() const {
+  return "ColumnarSpacePointReader";
+}
+
+std::pair<std::size_t, std::size_t> ColumnarSpacePointReader::availableEvents()
+    const {
+  return m_file->availableEvents();
+}
+
+ProcessCode ColumnarSpacePointReader::read(const AlgorithmContext& ctx) {
+  using namespace Columnar::SpacePoints;
+  using Scalar = Acts::ActsScalar;
+  using SourceLinks = boost::container::static_vector<Acts::SourceLink, 2>;
+
+  if (!m_file->contains(ctx.eventNumber)) {
+    ACTS_ERROR("Event " << ctx.eventNumber << " is not in the input file");
+    return ProcessCode::ABORT;
+  }
+  ColumnarEvent columns = m_file->event(ctx.eventNumber);
+  auto position = columns.column<double>(ePosition);
+  auto time = columns.column<double>(eTime);
+  auto varianceR = columns.column<double>(eVarianceR);
+  auto varianceZ = columns.column<double>(eVarianceZ);
+  auto varianceTime = columns.column<double>(eVarianceTime);
+  auto flags = columns.column<std::uint8_t>(eFlags);
+  auto numberOfSourceLinks = columns.column<std::uint8_t>(eNumberOfSourceLinks);
+  auto sourceLinkGeometryId =
+      columns.column<std::uint64_t>(eSourceLinkGeometryId);
+  auto sourceLinkIndex = columns.column<std::uint32_t>(eSourceLinkIndex);
+  auto stripHalfLengths = columns.column<float>(eStripHalfLengths);
+  auto stripVectors = columns.column<double>(eStripVectors);
+
+  SimSpacePointContainer spacePoints;
+  spacePoints.reserve(columns.rows());
+
+  // offsets into the columns of variable length
+  std::size_t sourceLinkOffset = 0;
+  std::size_t stripOffset = 0;
+  for (std::size_t i = 0; i < columns.rows(); ++i) {
+    const std::size_t nSourceLinks = numberOfSourceLinks[i];
+    const bool hasStripDetails = (flags[i] & eHasStripDetails) != 0;
+    if ((nSourceLinks > SourceLinks::static_capacity) ||
+        (sourceLinkOffset + nSourceLinks > sourceLinkGeometryId.size()) ||
+        (sourceLinkOffset + nSourceLinks > sourceLinkIndex.size()) ||
+        (hasStripDetails && ((2 * stripOffset + 2 > stripHalfLengths.size()) ||
+                             (12 * stripOffset + 12 > stripVectors.size())))) {
+      ACTS_ERROR("Invalid space point " << i << " in event "
+                                        << ctx.eventNumber);
+      return ProcessCode::ABORT;
+    }
+
+    Eigen::Map<const Acts::Vector3> pos(&position[3 * i]);
+    std::optional<Scalar> t;
+    if ((flags[i] & eHasTime) != 0) {
+      t = time[i];
+    }
+    std::optional<Scalar> varianceT;
+    if ((flags[i] & eHasVarianceTime) != 0) {
+      varianceT = varianceTime[i];
+    }
+    SourceLinks sourceLinks;
+    for (std::size_t j = sourceLinkOffset;
+         j < sourceLinkOffset + nSourceLinks; ++j) {
+      sourceLinks.emplace_back(IndexSourceLink(
+          Acts::GeometryIdentifier(sourceLinkGeometryId[j]),
+          sourceLinkIndex[j]));
+    }
+    sourceLinkOffset += nSourceLinks;
+
+    if (!hasStripDetails) {
+      spacePoints.emplace_back(pos, t, varianceR[i], varianceZ[i], varianceT,
+                               std::move(sourceLinks));
+      continue;
+    }
+    const double* vectors = &stripVectors[12 * stripOffset];
+    spacePoints.emplace_back(
+        pos, t, varianceR[i], varianceZ[i], varianceT, std::move(sourceLinks),
+        stripHalfLengths[2 * stripOffset], stripHalfLengths[2 * stripOffset + 1],
+        Eigen::Map<const Acts::Vector3>(vectors),
+        Eigen::Map<const Acts::Vector3>(vectors + 3),
+        Eigen::Map<const Acts::Vector3>(vectors + 6),
+        Eigen::Map<const Acts::Vector3>(vectors + 9));
+    ++stripOffset;
+  }
+
+  m_outputSpacePoints(ctx, std::move(spacePoints));
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,117 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Columnar/ColumnarSpacePointWriter.hpp"
+
+#include "Acts/EventData/SourceLink.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarFile.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "ColumnarColumns.hpp"
+
+namespace ActsExamples {
+
+namespace {
+
+template <typename vector_t>
+void appendVector(std::vector<double>& values, const vector_t& vector) {
+  values.insert(values.end(), vector.data(), vector.data() + vector.size());
+}
+
+}  // namespace
+
+ColumnarSpacePointWriter::ColumnarSpacePointWriter(const Config& config,
+                                                   Acts::Logging::Level level)
+    : WriterT(config.inputSpacePoints, "ColumnarSpacePointWriter", level),
+      m_cfg(config) {
+  // inputSpacePoints is already checked by base constructor
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  m_file = std::make_unique<ColumnarFileWriter>(
+      m_cfg.filePath, std::string(Columnar::SpacePoints::kKind),
+      Columnar::SpacePoints::columns());
+}
+
+ColumnarSpacePointWriter::~ColumnarSpacePointWriter() = default;
+
+ProcessCode ColumnarSpacePointWriter::finalize() {
+  m_file->close();
+  ACTS_INFO("Wrote space points to file '" << m_cfg.filePath << "'");
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode ColumnarSpacePointWriter::writeT(
+    const AlgorithmContext& ctx, const SimSpacePointContainer& spacePoints) {
+  using namespace Columnar::SpacePoints;
+  constexpr double kMissing = std::numeric_limits<double>::quiet_NaN();
+
+  const std::size_t n = spacePoints.size();
+  std::vector<double> position;
+  std::vector<double> time;
+  std::vector<double> varianceR;
+  std::vector<double> varianceZ;
+  std::vector<double> varianceTime;
+  std::vector<std::uint8_t> flags;
+  std::vector<std::uint8_t> numberOfSourceLinks;
+  std::vector<std::uint64_t> sourceLinkGeometryId;
+  std::vector<std::uint32_t> sourceLinkIndex;
+  std::vector<float> stripHalfLengths;
+  std::vector<double> stripVectors;
+  position.reserve(3 * n);
+  time.reserve(n);
+  varianceR.reserve(n);
+  varianceZ.reserve(n);
+  varianceTime.reserve(n);
+  flags.reserve(n);
+  numberOfSourceLinks.reserve(n);
+
+  for (const SimSpacePoint& spacePoint : spacePoints) {
+    position.insert(position.end(),
+                    {spacePoint.x(), spacePoint.y(), spacePoint.z()});
+    time.push_back(spacePoint.t().value_or(kMissing));
+    varianceR.push_back(spacePoint.varianceR());
+    varianceZ.push_back(spacePoint.varianceZ());
+    varianceTime.push_back(spacePoint.varianceT().value_or(kMissing));
+
+    std::uint8_t flag = 0;
+    flag |= spacePoint.t().has_value() ? eHasTime : 0;
+    flag |= spacePoint.varianceT().has_value() ? eHasVarianceTime : 0;
+    if (spacePoint.validDoubleMeasurementDetails()) {
+      flag |= eHasStripDetails;
+      stripHalfLengths.push_back(spacePoint.topHalfStripLength());
+      stripHalfLengths.push_back(spacePoint.bottomHalfStripLength());
+      appendVector(stripVectors, spacePoint.topStripDirection());
+      appendVector(stripVectors, spacePoint.bottomStripDirection());
+      appendVector(stripVectors, spacePoint.stripCenterDistance());
+      appendVector(stripVectors, spacePoint.topStripCenterPosition());
+    }
+    flags.push_back(flag);
+
+    numberOfSourceLinks.push_back(spacePoint.sourceLinks().size());
+    for (const Acts::SourceLink& sourceLink : spacePoint.sourceLinks()) {
+      const auto& indexSourceLink = sourceLink.get<IndexSourceLink>();
+      sourceLinkGeometryId.push_back(indexSourceLink.geometryId().value());
+      sourceLinkIndex.push_back(indexSourceLink.index());
+    }
+  }
+
+  m_file->write(ctx.eventNumber, n,
+                {position, time, varianceR, varianceZ, varianceTime, flags,
+                 numberOfSourceLinks, sourceLinkGeometryId, sourceLinkIndex,
+                 stripHalfLengths, stripVectors});
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
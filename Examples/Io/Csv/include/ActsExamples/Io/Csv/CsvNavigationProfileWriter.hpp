@@ -0,0 +1,61 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Propagator/NavigationProfiler.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <memory>
+#include <string>
+
+namespace ActsExamples {
+struct AlgorithmContext;
+
+/// Write out the navigation counters collected by a NavigationProfiler.
+///
+/// The counters of all volumes and layers are written to one file at the
+/// end of the run, the per-volume summary is printed to the log.
+class CsvNavigationProfileWriter : public IWriter {
+ public:
+  struct Config {
+    /// The profiler filled by the navigators of the propagation.
+    std::shared_ptr<const Acts::NavigationProfiler> profiler;
+    /// Where to place the output file.
+    std::string outputDir;
+    /// Name of the output file.
+    std::string fileName = "navigation-profile.csv";
+  };
+
+  /// Construct the navigation profile writer.
+  ///
+  /// @param config is the configuration object
+  /// @param level is the logging level
+  CsvNavigationProfileWriter(const Config& config, Acts::Logging::Level level);
+
+  std::string name() const override;
+
+  /// Nothing to write per event.
+  ProcessCode write(const AlgorithmContext& ctx) override;
+
+  /// Write the counters summed over all threads.
+  ProcessCode finalize() override;
+
+  /// Get readonly access to the config parameters
+  const Config& config() const { return m_cfg; }
+
+ private:
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
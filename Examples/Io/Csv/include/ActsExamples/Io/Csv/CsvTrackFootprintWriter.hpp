@@ -0,0 +1,65 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WriterT.hpp"
+
+#include <string>
+
+namespace ActsExamples {
+struct AlgorithmContext;
+
+/// Write out the memory footprint of a track container.
+///
+/// This writes two files per event into the configured output directory,
+///
+///     event000000001-track-footprint.csv
+///     event000000001-track-footprint-summary.csv
+///
+/// The first one has one line per column of the track and track state
+/// backends, the second one a single line with the number of tracks and
+/// track states and the growth events of both backends.
+class CsvTrackFootprintWriter : public WriterT<ConstTrackContainer> {
+ public:
+  struct Config {
+    /// Input track collection.
+    std::string inputTracks;
+    /// Where to place output files.
+    std::string outputDir;
+    /// Name of the per-column output files.
+    std::string fileName = "track-footprint.csv";
+    /// Name of the summary output files.
+    std::string summaryFileName = "track-footprint-summary.csv";
+  };
+
+  /// Construct the track footprint writer.
+  ///
+  /// @param config is the configuration object
+  /// @param level is the logging level
+  CsvTrackFootprintWriter(const Config& config, Acts::Logging::Level level);
+
+  /// Get readonly access to the config parameters
+  const Config& config() const { return m_cfg; }
+
+ protected:
+  /// Write the footprint of the tracks of one event.
+  ///
+  /// @param ctx is the algorithm context for consistency
+  /// @param tracks is the track collection
+  ProcessCode writeT(const AlgorithmContext& ctx,
+                     const ConstTrackContainer& tracks) override;
+
+ private:
+  Config m_cfg;
+};
+
+}  // namespace ActsExamples
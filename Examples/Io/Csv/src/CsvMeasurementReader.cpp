@@ -29,9 +29,8 @@
 #include <stdexcept>
 #include <vector>
 
-#include <dfe/dfe_io_dsv.hpp>
-
 #include "CsvOutputData.hpp"
+#include "CsvTable.hpp"
 
 ActsExamples::CsvMeasurementReader::CsvMeasurementReader(
     const ActsExamples::CsvMeasurementReader::Config& config,
@@ -108,15 +107,7 @@ inline std::vector<Data> readEverything(
     const std::string& inputDir, const std::string& filename,
     const std::vector<std::string>& optionalColumns, std::size_t event) {
   std::string path = ActsExamples::perEventFilepath(inputDir, filename, event);
-  dfe::NamedTupleCsvReader<Data> reader(path, optionalColumns);
-
-  std::vector<Data> everything;
-  Data one;
-  while (reader.read(one)) {
-    everything.push_back(one);
-  }
-
-  return everything;
+  return ActsExamples::readCsvTable<Data>(path, optionalColumns);
 }
 
 std::vector<ActsExamples::MeasurementData> readMeasurementsByGeometryId(
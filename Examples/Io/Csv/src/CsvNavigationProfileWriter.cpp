@@ -0,0 +1,71 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Csv/CsvNavigationProfileWriter.hpp"
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <chrono>
+#include <stdexcept>
+
+#include <dfe/dfe_io_dsv.hpp>
+
+#include "CsvOutputData.hpp"
+
+using namespace ActsExamples;
+
+CsvNavigationProfileWriter::CsvNavigationProfileWriter(
+    const CsvNavigationProfileWriter::Config& config,
+    Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger(Acts::getDefaultLogger("CsvNavigationProfileWriter", level)) {
+  if (!m_cfg.profiler) {
+    throw std::invalid_argument("Missing navigation profiler");
+  }
+}
+
+std::string CsvNavigationProfileWriter::name() const {
+  return "CsvNavigationProfileWriter";
+}
+
+ProcessCode CsvNavigationProfileWriter::write(
+    const AlgorithmContext& /*ctx*/) {
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode CsvNavigationProfileWriter::finalize() {
+  dfe::NamedTupleCsvWriter<NavigationProfileData> writer(
+      joinPaths(m_cfg.outputDir, m_cfg.fileName));
+
+  NavigationProfileData data;
+  for (const auto& [geoId, counters] : m_cfg.profiler->summary()) {
+    data.geometry_id = geoId.value();
+    data.volume_id = geoId.volume();
+    data.layer_id = geoId.layer();
+    data.calls = counters.calls;
+    data.candidates = counters.candidates;
+    data.intersections = counters.intersections;
+    data.retargets = counters.retargets;
+    data.time_ns = counters.time.count();
+    writer.append(data);
+  }
+
+  for (const auto& [geoId, counters] : m_cfg.profiler->volumeSummary()) {
+    ACTS_INFO("Volume " << geoId.volume() << ": " << counters.calls
+                        << " calls, " << counters.candidates << " candidates, "
+                        << counters.intersections << " intersections, "
+                        << counters.retargets << " re-targets, "
+                        << std::chrono::duration<double, std::milli>(
+                               counters.time)
+                               .count()
+                        << " ms");
+  }
+  return ProcessCode::SUCCESS;
+}
@@ -11,6 +11,7 @@
 #include <ActsExamples/EventData/Index.hpp>
 
 #include <cstdint>
+#include <string>
 
 #include <dfe/dfe_namedtuple.hpp>
 
@@ -341,6 +342,52 @@ struct TrackParameterData {
                  cov_qopphi, cov_qoptheta);
 };
 
+struct NavigationProfileData {
+  /// Volume or layer identifier.
+  uint64_t geometry_id = 0;
+  /// Partially decoded identifier components.
+  uint32_t volume_id = 0, layer_id = 0;
+  /// Navigation counters.
+  uint64_t calls = 0;
+  uint64_t candidates = 0;
+  uint64_t intersections = 0;
+  uint64_t retargets = 0;
+  /// Wall time in the navigator calls in nanoseconds.
+  uint64_t time_ns = 0;
+
+  DFE_NAMEDTUPLE(NavigationProfileData, geometry_id, volume_id, layer_id, calls,
+                 candidates, intersections, retargets, time_ns);
+};
+
+struct TrackFootprintColumnData {
+  /// Backend the column belongs to, either tracks or states.
+  std::string container;
+  /// Name of the column.
+  std::string column;
+  /// Number of elements in use and allocated.
+  uint64_t size = 0, capacity = 0;
+  /// Bytes in use and allocated.
+  uint64_t bytes = 0, capacity_bytes = 0;
+
+  DFE_NAMEDTUPLE(TrackFootprintColumnData, container, column, size, capacity,
+                 bytes, capacity_bytes);
+};
+
+struct TrackFootprintSummaryData {
+  uint64_t n_tracks = 0;
+  uint64_t n_states = 0;
+  uint64_t max_states_per_track = 0;
+  /// Totals of the track backend.
+  uint64_t track_bytes = 0, track_capacity_bytes = 0, track_growth_events = 0;
+  /// Totals of the track state backend.
+  uint64_t state_bytes = 0, state_capacity_bytes = 0, state_growth_events = 0;
+
+  DFE_NAMEDTUPLE(TrackFootprintSummaryData, n_tracks, n_states,
+                 max_states_per_track, track_bytes, track_capacity_bytes,
+                 track_growth_events, state_bytes, state_capacity_bytes,
+                 state_growth_events);
+};
+
 struct ProtoTrackData {
   std::size_t trackId;
   Index measurementId;
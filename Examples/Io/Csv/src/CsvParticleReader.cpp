@@ -23,9 +23,8 @@
 #include <stdexcept>
 #include <string>
 
-#include <dfe/dfe_io_dsv.hpp>
-
 #include "CsvOutputData.hpp"
+#include "CsvTable.hpp"
 
 ActsExamples::CsvParticleReader::CsvParticleReader(
     const ActsExamples::CsvParticleReader::Config& config,
@@ -60,10 +59,8 @@ ActsExamples::ProcessCode ActsExamples::CsvParticleReader::read(
   auto path = perEventFilepath(m_cfg.inputDir, m_cfg.inputStem + ".csv",
                                ctx.eventNumber);
   // vt and m are an optional columns
-  dfe::NamedTupleCsvReader<ParticleData> reader(path, {"vt", "m"});
-  ParticleData data;
-
-  while (reader.read(data)) {
+  for (const ParticleData& data :
+       readCsvTable<ParticleData>(path, {"vt", "m"})) {
     ActsFatras::Particle particle(ActsFatras::Barcode(data.particle_id),
                                   Acts::PdgParticle{data.particle_type},
                                   data.q * Acts::UnitConstants::e,
@@ -19,9 +19,8 @@
 #include <array>
 #include <stdexcept>
 
-#include <dfe/dfe_io_dsv.hpp>
-
 #include "CsvOutputData.hpp"
+#include "CsvTable.hpp"
 
 ActsExamples::CsvSimHitReader::CsvSimHitReader(
     const ActsExamples::CsvSimHitReader::Config& config,
@@ -55,13 +54,10 @@ ActsExamples::ProcessCode ActsExamples::CsvSimHitReader::read(
   auto path = perEventFilepath(m_cfg.inputDir, m_cfg.inputStem + ".csv",
                                ctx.eventNumber);
 
-  dfe::NamedTupleCsvReader<SimHitData> reader(path);
-
   SimHitContainer::sequence_type unordered;
-  SimHitData data;
 
   ACTS_DEBUG("start to read hits ");
-  while (reader.read(data)) {
+  for (const SimHitData& data : readCsvTable<SimHitData>(path)) {
     ACTS_DEBUG("found a sim hit");
     const auto geometryId = Acts::GeometryIdentifier(data.geometry_id);
     // TODO validate geo id consistency
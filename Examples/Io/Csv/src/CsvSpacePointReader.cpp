@@ -21,9 +21,9 @@
 #include <string>
 
 #include <boost/container/static_vector.hpp>
-#include <dfe/dfe_io_dsv.hpp>
 
 #include "CsvOutputData.hpp"
+#include "CsvTable.hpp"
 
 ActsExamples::CsvSpacePointReader::CsvSpacePointReader(
     const ActsExamples::CsvSpacePointReader::Config& cfg,
@@ -61,10 +61,7 @@ ActsExamples::ProcessCode ActsExamples::CsvSpacePointReader::read(
   const auto& path =
       perEventFilepath(m_cfg.inputDir, filename + ".csv", ctx.eventNumber);
 
-  dfe::NamedTupleCsvReader<SpacePointData> reader(path);
-  SpacePointData data;
-
-  while (reader.read(data)) {
+  for (const SpacePointData& data : readCsvTable<SpacePointData>(path)) {
     Acts::Vector3 globalPos(data.sp_x, data.sp_y, data.sp_z);
 
     if (m_cfg.inputCollection == "pixel" || m_cfg.inputCollection == "strip" ||
@@ -0,0 +1,100 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "CsvTable.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// large enough to amortize the scheduling, small enough to balance typical
+// event files over the threads
+constexpr std::size_t kChunkSize = 1 << 20;
+
+}  // namespace
+
+ActsExamples::CsvTable::CsvTable(std::string path)
+    : m_path(std::move(path)), m_file(m_path) {
+  // the chunks are read concurrently, prefetch the whole file
+  m_file.prefetch();
+
+  std::string_view content(reinterpret_cast<const char*>(m_file.data()),
+                           m_file.size());
+  std::size_t headerEnd = content.find('\n');
+  std::string_view header = content.substr(0, headerEnd);
+  if (!header.empty() && header.back() == '\r') {
+    header.remove_suffix(1);
+  }
+  if (header.empty()) {
+    throw std::runtime_error("Missing header line in file '" + m_path + "'");
+  }
+  std::size_t begin = 0;
+  while (true) {
+    std::size_t end = header.find(',', begin);
+    m_columns.emplace_back(header.substr(
+        begin, (end == std::string_view::npos) ? end : end - begin));
+    if (end == std::string_view::npos) {
+      break;
+    }
+    begin = end + 1;
+  }
+  if (headerEnd != std::string_view::npos) {
+    m_records = content.substr(headerEnd + 1);
+  }
+}
+
+std::vector<std::size_t> ActsExamples::CsvTable::mapColumns(
+    const std::vector<std::string>& names,
+    const std::vector<std::string>& optionalColumns) const {
+  std::vector<std::size_t> fileColumns;
+  fileColumns.reserve(names.size());
+  for (const auto& name : names) {
+    auto it = std::find(m_columns.begin(), m_columns.end(), name);
+    if (it != m_columns.end()) {
+      fileColumns.push_back(std::distance(m_columns.begin(), it));
+    } else if (std::find(optionalColumns.begin(), optionalColumns.end(),
+                         name) != optionalColumns.end()) {
+      fileColumns.push_back(std::string::npos);
+    } else {
+      throw std::runtime_error("Missing header column '" + name +
+                               "' in file '" + m_path + "'");
+    }
+  }
+  return fileColumns;
+}
+
+std::vector<std::string_view> ActsExamples::CsvTable::splitChunks() const {
+  std::vector<std::string_view> chunks;
+  chunks.reserve(m_records.size() / kChunkSize + 1);
+  const char* begin = m_records.data();
+  const char* end = begin + m_records.size();
+  while (begin < end) {
+    const char* chunkEnd = end;
+    if (static_cast<std::size_t>(end - begin) > kChunkSize) {
+      // memchr is vectorized by the C library
+      const void* newline =
+          std::memchr(begin + kChunkSize, '\n', end - begin - kChunkSize);
+      if (newline != nullptr) {
+        chunkEnd = static_cast<const char*>(newline) + 1;
+      }
+    }
+    chunks.emplace_back(begin, chunkEnd - begin);
+    begin = chunkEnd;
+  }
+  return chunks;
+}
+
+void ActsExamples::CsvTable::throwInvalidLine(const char* position,
+                                              const std::string& reason) const {
+  // the line number is only needed for the error message
+  const char* begin = reinterpret_cast<const char*>(m_file.data());
+  std::size_t line = 1 + std::count(begin, position, '\n');
+  throw std::runtime_error(reason + " in line " + std::to_string(line) +
+                           " of file '" + m_path + "'");
+}
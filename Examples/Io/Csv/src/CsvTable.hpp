@@ -0,0 +1,247 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/MappedFile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef ACTS_EXAMPLES_NO_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+namespace ActsExamples {
+
+/// Read a comma-separated table into named tuples
+///
+/// Reads the same files as `dfe::NamedTupleCsvReader`: a header line with the
+/// column names followed by one line per record. The file is mapped into
+/// memory and split into chunks at line boundaries, which are parsed in
+/// parallel in the current task arena and concatenated in file order. The
+/// fields are converted with `std::from_chars` without copying them and
+/// without locale lookups.
+///
+/// The columns can appear in any order. Columns of the file that are not part
+/// of the record are ignored, optional columns of the record that are missing
+/// in the file keep the value of a default-constructed record.
+class CsvTable {
+ public:
+  /// Map a file and parse its header
+  ///
+  /// @throws std::runtime_error if the file can not be read
+  explicit CsvTable(std::string path);
+  CsvTable(const CsvTable&) = delete;
+  CsvTable& operator=(const CsvTable&) = delete;
+
+  /// The column names of the file
+  const std::vector<std::string>& columns() const { return m_columns; }
+
+  /// Read all records
+  ///
+  /// @tparam record_t A `DFE_NAMEDTUPLE` type
+  /// @param optionalColumns Record columns that may be missing in the file
+  /// @throws std::runtime_error if a required column is missing, if a line
+  ///         has the wrong number of fields or if a field can not be parsed
+  template <typename record_t>
+  std::vector<record_t> read(
+      const std::vector<std::string>& optionalColumns = {}) const;
+
+ private:
+  /// Parse one field into a record, return false if the field is invalid
+  template <typename record_t>
+  using Parser = bool (*)(std::string_view, record_t&);
+
+  template <typename value_t>
+  static bool parseValue(std::string_view field, value_t& value);
+  template <typename record_t, std::size_t I>
+  static bool parseElement(std::string_view field, record_t& record) {
+    return parseValue(field, record.template get<I>());
+  }
+
+  /// The record parser of every file column, null for ignored columns
+  template <typename record_t, std::size_t... Is>
+  std::vector<Parser<record_t>> makeParsers(
+      std::index_sequence<Is...> indices,
+      const std::vector<std::string>& optionalColumns) const;
+  /// The file column of every record column, npos for missing columns
+  std::vector<std::size_t> mapColumns(
+      const std::vector<std::string>& names,
+      const std::vector<std::string>& optionalColumns) const;
+  /// Split the records into chunks that end at line boundaries
+  std::vector<std::string_view> splitChunks() const;
+  template <typename record_t>
+  void parseChunk(std::string_view chunk,
+                  const std::vector<Parser<record_t>>& parsers,
+                  std::vector<record_t>& records) const;
+  [[noreturn]] void throwInvalidLine(const char* position,
+                                     const std::string& reason) const;
+
+  std::string m_path;
+  Acts::MappedFile m_file;
+  std::string_view m_records;
+  std::vector<std::string> m_columns;
+};
+
+/// Read all records of a comma-separated file
+template <typename record_t>
+inline std::vector<record_t> readCsvTable(
+    const std::string& path,
+    const std::vector<std::string>& optionalColumns = {}) {
+  return CsvTable(path).read<record_t>(optionalColumns);
+}
+
+template <typename value_t>
+inline bool CsvTable::parseValue(std::string_view field, value_t& value) {
+  const char* begin = field.data();
+  const char* end = begin + field.size();
+  if constexpr (std::is_same_v<value_t, std::string>) {
+    value.assign(begin, end);
+    return true;
+  } else if constexpr (std::is_integral_v<value_t>) {
+    auto [ptr, ec] = std::from_chars(begin, end, value);
+    return (ec == std::errc()) && (ptr == end);
+  } else {
+    static_assert(std::is_floating_point_v<value_t>,
+                  "Unsupported column type");
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    auto [ptr, ec] = std::from_chars(begin, end, value);
+    return (ec == std::errc()) && (ptr == end);
+#else
+    // the field is not null-terminated
+    std::string copy(begin, end);
+    char* ptr = nullptr;
+    value = static_cast<value_t>(std::strtod(copy.c_str(), &ptr));
+    return !copy.empty() && (ptr == copy.c_str() + copy.size());
+#endif
+  }
+}
+
+template <typename record_t, std::size_t... Is>
+std::vector<CsvTable::Parser<record_t>> CsvTable::makeParsers(
+    std::index_sequence<Is...> /*indices*/,
+    const std::vector<std::string>& optionalColumns) const {
+  const auto& names = record_t::names();
+  std::vector<std::size_t> fileColumns =
+      mapColumns({std::begin(names), std::end(names)}, optionalColumns);
+  std::array<Parser<record_t>, sizeof...(Is)> elementParsers = {
+      &parseElement<record_t, Is>...};
+
+  std::vector<Parser<record_t>> parsers(m_columns.size(), nullptr);
+  for (std::size_t i = 0; i < fileColumns.size(); ++i) {
+    if (fileColumns[i] != std::string::npos) {
+      parsers[fileColumns[i]] = elementParsers[i];
+    }
+  }
+  return parsers;
+}
+
+template <typename record_t>
+void CsvTable::parseChunk(std::string_view chunk,
+                          const std::vector<Parser<record_t>>& parsers,
+                          std::vector<record_t>& records) const {
+  std::size_t begin = 0;
+  while (begin < chunk.size()) {
+    std::size_t end = chunk.find('\n', begin);
+    if (end == std::string_view::npos) {
+      end = chunk.size();
+    }
+    std::string_view line = chunk.substr(begin, end - begin);
+    begin = end + 1;
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    if (line.empty()) {
+      continue;
+    }
+
+    record_t& record = records.emplace_back();
+    std::size_t column = 0;
+    std::size_t fieldBegin = 0;
+    while (true) {
+      std::size_t fieldEnd = line.find(',', fieldBegin);
+      if (column == parsers.size()) {
+        throwInvalidLine(line.data(), "Too many columns");
+      }
+      std::string_view field = line.substr(
+          fieldBegin, (fieldEnd == std::string_view::npos)
+                          ? std::string_view::npos
+                          : fieldEnd - fieldBegin);
+      if ((parsers[column] != nullptr) && !parsers[column](field, record)) {
+        throwInvalidLine(line.data(), "Invalid value '" + std::string(field) +
+                                          "' in column '" + m_columns[column] +
+                                          "'");
+      }
+      ++column;
+      if (fieldEnd == std::string_view::npos) {
+        break;
+      }
+      fieldBegin = fieldEnd + 1;
+    }
+    if (column != parsers.size()) {
+      throwInvalidLine(line.data(), "Too few columns");
+    }
+  }
+}
+
+template <typename record_t>
+std::vector<record_t> CsvTable::read(
+    const std::vector<std::string>& optionalColumns) const {
+  constexpr std::size_t kSize = std::tuple_size_v<typename record_t::Tuple>;
+  std::vector<Parser<record_t>> parsers = makeParsers<record_t>(
+      std::make_index_sequence<kSize>(), optionalColumns);
+  std::vector<std::string_view> chunks = splitChunks();
+
+  std::vector<std::vector<record_t>> chunkRecords(chunks.size());
+  auto parse = [&](std::size_t i) {
+    parseChunk(chunks[i], parsers, chunkRecords[i]);
+  };
+#ifndef ACTS_EXAMPLES_NO_TBB
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, chunks.size()),
+                    [&](const tbb::blocked_range<std::size_t>& range) {
+                      for (std::size_t i = range.begin(); i != range.end();
+                           ++i) {
+                        parse(i);
+                      }
+                    });
+#else
+  for (std::size_t i = 0; i < chunks.size(); ++i) {
+    parse(i);
+  }
+#endif
+
+  if (chunkRecords.size() == 1) {
+    return std::move(chunkRecords.front());
+  }
+  std::size_t nRecords = 0;
+  for (const auto& records : chunkRecords) {
+    nRecords += records.size();
+  }
+  std::vector<record_t> records;
+  records.reserve(nRecords);
+  for (auto& chunk : chunkRecords) {
+    std::move(chunk.begin(), chunk.end(), std::back_inserter(records));
+  }
+  return records;
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,87 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Csv/CsvTrackFootprintWriter.hpp"
+
+#include "Acts/EventData/ContainerFootprint.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#include <dfe/dfe_io_dsv.hpp>
+
+#include "CsvOutputData.hpp"
+
+using namespace ActsExamples;
+
+CsvTrackFootprintWriter::CsvTrackFootprintWriter(
+    const CsvTrackFootprintWriter::Config& config, Acts::Logging::Level level)
+    : WriterT<ConstTrackContainer>(config.inputTracks,
+                                   "CsvTrackFootprintWriter", level),
+      m_cfg(config) {
+  if (m_cfg.inputTracks.empty()) {
+    throw std::invalid_argument("Missing input tracks collection");
+  }
+}
+
+ProcessCode CsvTrackFootprintWriter::writeT(
+    const AlgorithmContext& ctx, const ConstTrackContainer& tracks) {
+  const Acts::ContainerFootprint trackFootprint =
+      tracks.container().footprint();
+  const Acts::ContainerFootprint stateFootprint =
+      tracks.trackStateContainer().footprint();
+
+  {
+    dfe::NamedTupleCsvWriter<TrackFootprintColumnData> writer(
+        perEventFilepath(m_cfg.outputDir, m_cfg.fileName, ctx.eventNumber));
+
+    TrackFootprintColumnData data;
+    auto writeColumns = [&](const char* container,
+                            const Acts::ContainerFootprint& footprint) {
+      data.container = container;
+      for (const auto& column : footprint.columns) {
+        data.column = column.name;
+        data.size = column.size;
+        data.capacity = column.capacity;
+        data.bytes = column.bytes();
+        data.capacity_bytes = column.capacityBytes();
+        writer.append(data);
+      }
+    };
+    writeColumns("tracks", trackFootprint);
+    writeColumns("states", stateFootprint);
+  }
+
+  TrackFootprintSummaryData summary;
+  summary.n_tracks = tracks.size();
+  summary.n_states = tracks.trackStateContainer().size();
+  for (const auto& track : tracks) {
+    summary.max_states_per_track = std::max<std::uint64_t>(
+        summary.max_states_per_track, track.nTrackStates());
+  }
+  summary.track_bytes = trackFootprint.bytes();
+  summary.track_capacity_bytes = trackFootprint.capacityBytes();
+  summary.track_growth_events = trackFootprint.growthEvents;
+  summary.state_bytes = stateFootprint.bytes();
+  summary.state_capacity_bytes = stateFootprint.capacityBytes();
+  summary.state_growth_events = stateFootprint.growthEvents;
+
+  dfe::NamedTupleCsvWriter<TrackFootprintSummaryData> writer(perEventFilepath(
+      m_cfg.outputDir, m_cfg.summaryFileName, ctx.eventNumber));
+  writer.append(summary);
+
+  ACTS_DEBUG("Track footprint: " << summary.n_tracks << " tracks, "
+                                 << summary.n_states << " track states, "
+                                 << summary.track_capacity_bytes +
+                                        summary.state_capacity_bytes
+                                 << " bytes allocated");
+  return ProcessCode::SUCCESS;
+}
@@ -12,11 +12,14 @@
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Utilities/SerialFillQueue.hpp"
 
+#include <memory>
 #include <string>
 
 #include <edm4hep/TrackerHitCollection.h>
 #include <edm4hep/TrackerHitPlaneCollection.h>
+#include <podio/Frame.h>
 #include <podio/ROOTFrameWriter.h>
 
 namespace ActsExamples {
@@ -65,8 +68,9 @@ class EDM4hepMeasurementWriter final : public WriterT<MeasurementContainer> {
   Config m_cfg;
 
   podio::ROOTFrameWriter m_writer;
-
-  std::mutex m_writeMutex;
+  /// Writes the frames on a dedicated thread, declared after the writer such
+  /// that it is stopped first
+  std::unique_ptr<SerialFillQueue<podio::Frame>> m_writeQueue;
 
   ReadDataHandle<ClusterContainer> m_inputClusters{this, "InputClusters"};
 };
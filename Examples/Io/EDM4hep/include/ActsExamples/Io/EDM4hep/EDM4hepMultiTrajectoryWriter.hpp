@@ -11,11 +11,14 @@
 #include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Utilities/SerialFillQueue.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 
+#include <memory>
 #include <string>
 
+#include <podio/Frame.h>
 #include <podio/ROOTFrameWriter.h>
 
 namespace ActsExamples {
@@ -68,8 +71,10 @@ class EDM4hepMultiTrajectoryWriter : public WriterT<TrajectoriesContainer> {
  private:
   Config m_cfg;
 
-  std::mutex m_writeMutex;
   podio::ROOTFrameWriter m_writer;
+  /// Writes the frames on a dedicated thread, declared after the writer such
+  /// that it is stopped first
+  std::unique_ptr<SerialFillQueue<podio::Frame>> m_writeQueue;
 
   ReadDataHandle<IndexMultimap<ActsFatras::Barcode>>
       m_inputMeasurementParticlesMap{this, "InputMeasurementParticlesMaps"};
@@ -10,10 +10,12 @@
 
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Utilities/SerialFillQueue.hpp"
 
-#include <mutex>
+#include <memory>
 #include <string>
 
+#include <podio/Frame.h>
 #include <podio/ROOTFrameWriter.h>
 
 namespace ActsExamples {
@@ -56,9 +58,10 @@ class EDM4hepParticleWriter final : public WriterT<SimParticleContainer> {
  private:
   Config m_cfg;
 
-  std::mutex m_writeMutex;
-
   podio::ROOTFrameWriter m_writer;
+  /// Writes the frames on a dedicated thread, declared after the writer such
+  /// that it is stopped first
+  std::unique_ptr<SerialFillQueue<podio::Frame>> m_writeQueue;
 };
 
 }  // namespace ActsExamples
@@ -12,11 +12,14 @@
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Utilities/SerialFillQueue.hpp"
 
+#include <memory>
 #include <string>
 
 #include <edm4hep/MCParticleCollection.h>
 #include <edm4hep/SimTrackerHitCollection.h>
+#include <podio/Frame.h>
 #include <podio/ROOTFrameWriter.h>
 
 namespace ActsExamples {
@@ -66,8 +69,9 @@ class EDM4hepSimHitWriter final : public WriterT<SimHitContainer> {
   Config m_cfg;
 
   podio::ROOTFrameWriter m_writer;
-
-  std::mutex m_writeMutex;
+  /// Writes the frames on a dedicated thread, declared after the writer such
+  /// that it is stopped first
+  std::unique_ptr<SerialFillQueue<podio::Frame>> m_writeQueue;
 
   ReadDataHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
 };
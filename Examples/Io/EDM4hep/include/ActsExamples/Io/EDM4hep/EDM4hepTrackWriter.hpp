@@ -12,11 +12,14 @@
 #include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Utilities/SerialFillQueue.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 
+#include <memory>
 #include <string>
 
+#include <podio/Frame.h>
 #include <podio/ROOTFrameWriter.h>
 
 namespace ActsExamples {
@@ -56,9 +59,10 @@ class EDM4hepTrackWriter : public WriterT<ConstTrackContainer> {
  private:
   Config m_cfg;
 
-  std::mutex m_writeMutex;
-
   podio::ROOTFrameWriter m_writer;
+  /// Writes the frames on a dedicated thread, declared after the writer such
+  /// that it is stopped first
+  std::unique_ptr<SerialFillQueue<podio::Frame>> m_writeQueue;
 };
 
 }  // namespace ActsExamples
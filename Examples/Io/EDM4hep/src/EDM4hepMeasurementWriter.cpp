@@ -29,9 +29,13 @@ EDM4hepMeasurementWriter::EDM4hepMeasurementWriter(
 
   // Input container for measurements is already checked by base constructor
   m_inputClusters.maybeInitialize(m_cfg.inputClusters);
+
+  m_writeQueue = std::make_unique<SerialFillQueue<podio::Frame>>(
+      [this](podio::Frame& frame) { m_writer.writeFrame(frame, "events"); });
 }
 
 ActsExamples::ProcessCode EDM4hepMeasurementWriter::finalize() {
+  m_writeQueue->finish();
   m_writer.finish();
 
   return ProcessCode::SUCCESS;
@@ -67,8 +71,10 @@ ActsExamples::ProcessCode EDM4hepMeasurementWriter::writeT(
   frame.put(std::move(hitsPlane), "ActsTrackerHitsPlane");
   frame.put(std::move(hits), "ActsTrackerHitsRaw");
 
-  std::lock_guard guard(m_writeMutex);
-  m_writer.writeFrame(frame, "events");
+  // only the frame write is serialized, on the write thread
+  std::vector<podio::Frame> frames;
+  frames.push_back(std::move(frame));
+  m_writeQueue->push(std::move(frames));
 
   return ActsExamples::ProcessCode::SUCCESS;
 }
@@ -35,9 +35,13 @@ EDM4hepMultiTrajectoryWriter::EDM4hepMultiTrajectoryWriter(
   }
 
   m_inputMeasurementParticlesMap.initialize(m_cfg.inputMeasurementParticlesMap);
+
+  m_writeQueue = std::make_unique<SerialFillQueue<podio::Frame>>(
+      [this](podio::Frame& frame) { m_writer.writeFrame(frame, "events"); });
 }
 
 ActsExamples::ProcessCode EDM4hepMultiTrajectoryWriter::finalize() {
+  m_writeQueue->finish();
   m_writer.finish();
 
   return ProcessCode::SUCCESS;
@@ -63,8 +67,10 @@ ProcessCode EDM4hepMultiTrajectoryWriter::writeT(
 
   frame.put(std::move(trackCollection), "ActsTracks");
 
-  std::lock_guard guard(m_writeMutex);
-  m_writer.writeFrame(frame, "events");
+  // only the frame write is serialized, on the write thread
+  std::vector<podio::Frame> frames;
+  frames.push_back(std::move(frame));
+  m_writeQueue->push(std::move(frames));
 
   return ProcessCode::SUCCESS;
 }
@@ -31,9 +31,13 @@ EDM4hepParticleWriter::EDM4hepParticleWriter(
   if (m_cfg.inputParticles.empty()) {
     throw std::invalid_argument("Missing particles input collection");
   }
+
+  m_writeQueue = std::make_unique<SerialFillQueue<podio::Frame>>(
+      [this](podio::Frame& frame) { m_writer.writeFrame(frame, "events"); });
 }
 
 ActsExamples::ProcessCode EDM4hepParticleWriter::finalize() {
+  m_writeQueue->finish();
   m_writer.finish();
 
   return ProcessCode::SUCCESS;
@@ -52,8 +56,10 @@ ProcessCode EDM4hepParticleWriter::writeT(
 
   frame.put(std::move(mcParticleCollection), m_cfg.outputParticles);
 
-  std::lock_guard guard(m_writeMutex);
-  m_writer.writeFrame(frame, "events");
+  // only the frame write is serialized, on the write thread
+  std::vector<podio::Frame> frames;
+  frames.push_back(std::move(frame));
+  m_writeQueue->push(std::move(frames));
 
   return ProcessCode::SUCCESS;
 }
@@ -42,9 +42,13 @@ EDM4hepSimHitWriter::EDM4hepSimHitWriter(
   }
 
   m_inputParticles.maybeInitialize(m_cfg.inputParticles);
+
+  m_writeQueue = std::make_unique<SerialFillQueue<podio::Frame>>(
+      [this](podio::Frame& frame) { m_writer.writeFrame(frame, "events"); });
 }
 
 ActsExamples::ProcessCode EDM4hepSimHitWriter::finalize() {
+  m_writeQueue->finish();
   m_writer.finish();
 
   return ProcessCode::SUCCESS;
@@ -89,8 +93,10 @@ ProcessCode EDM4hepSimHitWriter::writeT(const AlgorithmContext& ctx,
   frame.put(std::move(mcParticles), m_cfg.outputParticles);
   frame.put(std::move(simTrackerHitCollection), m_cfg.outputSimTrackerHits);
 
-  std::lock_guard lock{m_writeMutex};
-  m_writer.writeFrame(frame, "events");
+  // only the frame write is serialized, on the write thread
+  std::vector<podio::Frame> frames;
+  frames.push_back(std::move(frame));
+  m_writeQueue->push(std::move(frames));
 
   return ProcessCode::SUCCESS;
 }
@@ -27,9 +27,13 @@ EDM4hepTrackWriter::EDM4hepTrackWriter(const Config& config,
   if (m_cfg.inputTracks.empty()) {
     throw std::invalid_argument("Missing input trajectories collection");
   }
+
+  m_writeQueue = std::make_unique<SerialFillQueue<podio::Frame>>(
+      [this](podio::Frame& frame) { m_writer.writeFrame(frame, "events"); });
 }
 
 ActsExamples::ProcessCode EDM4hepTrackWriter::finalize() {
+  m_writeQueue->finish();
   m_writer.finish();
 
   return ProcessCode::SUCCESS;
@@ -48,8 +52,10 @@ ProcessCode EDM4hepTrackWriter::writeT(const AlgorithmContext& context,
 
   frame.put(std::move(trackCollection), m_cfg.outputTracks);
 
-  std::lock_guard guard(m_writeMutex);
-  m_writer.writeFrame(frame, "events");
+  // only the frame write is serialized, on the write thread
+  std::vector<podio::Frame> frames;
+  frames.push_back(std::move(frame));
+  m_writeQueue->push(std::move(frames));
 
   return ProcessCode::SUCCESS;
 }
@@ -11,6 +11,13 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <HepMC3/GenEvent.h>
 #include <HepMC3/ReaderAscii.h>
@@ -18,6 +25,15 @@
 namespace ActsExamples {
 
 /// HepMC3 event reader.
+///
+/// The events are either read from one file per event, or from a single file
+/// with all events. For a single file, the event offsets are indexed once and
+/// the events are parsed independently, such that they can be read in
+/// parallel and in any order. Files ending in `.gz` are decompressed into
+/// memory once.
+///
+/// Optionally, a random number of minimum-bias events is added to every
+/// event. They are read once into memory and then drawn from this pool.
 class HepMC3AsciiReader final : public IReader {
  public:
   struct Config {
@@ -25,8 +41,16 @@ class HepMC3AsciiReader final : public IReader {
     std::string inputDir;
     // The stem of input file names
     std::string inputStem;
+    // The single input file with all events, replaces the per-event files
+    std::string inputPath;
     // The output collection
     std::string outputEvents;
+    // The single input file with the minimum-bias events for pile-up
+    std::string inputPileupPath;
+    // The mean number of pile-up events per event, Poisson distributed
+    double pileup = 0;
+    // The random number service, needed for pile-up
+    std::shared_ptr<const RandomNumbers> randomNumbers;
   };
 
   /// @brief Reads an event from file
@@ -65,6 +89,27 @@ class HepMC3AsciiReader final : public IReader {
   /// The logger
   std::unique_ptr<const Acts::Logger> m_logger;
 
+  /// The events of a single input file
+  struct EventFile {
+    std::string path;
+    /// The text before the first event, e.g. the run info
+    std::string header;
+    /// The decompressed file contents, empty for uncompressed files
+    std::string contents;
+    /// Offset and size of the events
+    std::vector<std::pair<std::size_t, std::size_t>> index;
+  };
+  /// Index the events of a single input file
+  static EventFile openEventFile(const std::string& path);
+  /// Parse one event from a single input file
+  static HepMC3::GenEvent readEventFromFile(const EventFile& file,
+                                            std::size_t event);
+
+  /// The single input file, if used
+  std::unique_ptr<EventFile> m_file;
+  /// The minimum-bias events for pile-up
+  std::vector<HepMC3::GenEvent> m_pileupPool;
+
   const Acts::Logger& logger() const { return *m_logger; }
 
   WriteDataHandle<std::vector<HepMC3::GenEvent>> m_outputEvents{this,
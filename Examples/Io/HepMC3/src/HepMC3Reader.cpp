@@ -11,10 +11,55 @@
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
 #include <HepMC3/Units.h>
+#ifdef ACTS_EXAMPLES_HEPMC3_ZLIB
+#include <zlib.h>
+#endif
+#ifndef ACTS_EXAMPLES_NO_TBB
+#include <tbb/parallel_for.h>
+#endif
 
 namespace ActsExamples {
 
+namespace {
+
+constexpr std::string_view kEndOfListing = "HepMC::Asciiv3-END_EVENT_LISTING";
+
+bool isCompressed(const std::string& path) {
+  return (path.size() > 3) && (path.compare(path.size() - 3, 3, ".gz") == 0);
+}
+
+std::string decompress(const std::string& path) {
+#ifdef ACTS_EXAMPLES_HEPMC3_ZLIB
+  gzFile file = gzopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    throw std::runtime_error("Could not open file '" + path + "'");
+  }
+  std::string contents;
+  std::vector<char> buffer(1 << 20);
+  int n = 0;
+  while ((n = gzread(file, buffer.data(), buffer.size())) > 0) {
+    contents.append(buffer.data(), n);
+  }
+  gzclose(file);
+  if (n < 0) {
+    throw std::runtime_error("Could not decompress file '" + path + "'");
+  }
+  return contents;
+#else
+  throw std::invalid_argument("Could not read '" + path +
+                              "', compressed input requires zlib");
+#endif
+}
+
+}  // namespace
+
 bool HepMC3AsciiReader::readEvent(HepMC3::ReaderAscii& reader,
                                   HepMC3::GenEvent& event) {
   // Read event and store it
@@ -27,20 +72,141 @@ bool HepMC3AsciiReader::status(HepMC3::ReaderAscii& reader) {
 
 HepMC3AsciiReader::HepMC3AsciiReader(const HepMC3AsciiReader::Config& cfg,
                                      Acts::Logging::Level lvl)
-    : m_cfg(cfg),
-      m_eventsRange(
-          determineEventFilesRange(cfg.inputDir, cfg.inputStem + ".hepmc3")),
-      m_logger(Acts::getDefaultLogger("HepMC3AsciiReader", lvl)) {
-  if (m_cfg.inputStem.empty()) {
+    : m_cfg(cfg), m_logger(Acts::getDefaultLogger("HepMC3AsciiReader", lvl)) {
+  if (m_cfg.inputPath.empty() && m_cfg.inputStem.empty()) {
     throw std::invalid_argument("Missing input filename stem");
   }
   if (m_cfg.outputEvents.empty()) {
     throw std::invalid_argument("Missing output collection");
   }
+  if (m_cfg.pileup < 0) {
+    throw std::invalid_argument("Negative pile-up");
+  }
+  if ((m_cfg.pileup > 0) && m_cfg.inputPileupPath.empty()) {
+    throw std::invalid_argument("Missing pile-up input file");
+  }
+  if ((m_cfg.pileup > 0) && !m_cfg.randomNumbers) {
+    throw std::invalid_argument("Missing random numbers service");
+  }
+
+  if (!m_cfg.inputPath.empty()) {
+    m_file = std::make_unique<EventFile>(openEventFile(m_cfg.inputPath));
+    m_eventsRange = {0, m_file->index.size()};
+    ACTS_DEBUG("Indexed " << m_file->index.size() << " events in "
+                          << m_cfg.inputPath);
+  } else {
+    m_eventsRange =
+        determineEventFilesRange(m_cfg.inputDir, m_cfg.inputStem + ".hepmc3");
+  }
+
+  if (m_cfg.pileup > 0) {
+    EventFile pileupFile = openEventFile(m_cfg.inputPileupPath);
+    if (pileupFile.index.empty()) {
+      throw std::invalid_argument("No events in pile-up input file '" +
+                                  m_cfg.inputPileupPath + "'");
+    }
+    m_pileupPool.resize(pileupFile.index.size());
+    auto readPileup = [&](std::size_t i) {
+      m_pileupPool[i] = readEventFromFile(pileupFile, i);
+    };
+#ifndef ACTS_EXAMPLES_NO_TBB
+    tbb::parallel_for(std::size_t{0}, m_pileupPool.size(), readPileup);
+#else
+    for (std::size_t i = 0; i < m_pileupPool.size(); ++i) {
+      readPileup(i);
+    }
+#endif
+    ACTS_DEBUG("Read " << m_pileupPool.size() << " pile-up events from "
+                       << m_cfg.inputPileupPath);
+  }
 
   m_outputEvents.initialize(m_cfg.outputEvents);
 }
 
+HepMC3AsciiReader::EventFile HepMC3AsciiReader::openEventFile(
+    const std::string& path) {
+  EventFile file;
+  file.path = path;
+
+  std::ifstream plainStream;
+  std::istringstream contentsStream;
+  std::istream* stream = &plainStream;
+  if (isCompressed(path)) {
+    file.contents = decompress(path);
+    contentsStream.str(file.contents);
+    stream = &contentsStream;
+  } else {
+    plainStream.open(path, std::ios::binary);
+    if (!plainStream) {
+      throw std::runtime_error("Could not open file '" + path + "'");
+    }
+  }
+
+  // every event starts with an `E` line, the lines before the first event
+  // are needed to parse each event
+  std::size_t offset = 0;
+  std::size_t headerSize = 0;
+  std::string line;
+  while (std::getline(*stream, line)) {
+    const std::size_t lineSize = line.size() + (stream->eof() ? 0 : 1);
+    if (line.compare(0, kEndOfListing.size(), kEndOfListing) == 0) {
+      break;
+    }
+    if ((line.size() > 1) && (line[0] == 'E') && (line[1] == ' ')) {
+      if (file.index.empty()) {
+        headerSize = offset;
+      } else {
+        file.index.back().second = offset - file.index.back().first;
+      }
+      file.index.emplace_back(offset, 0);
+    }
+    offset += lineSize;
+  }
+  if (file.index.empty()) {
+    return file;
+  }
+  file.index.back().second = offset - file.index.back().first;
+
+  if (file.contents.empty()) {
+    plainStream.clear();
+    plainStream.seekg(0);
+    file.header.resize(headerSize);
+    plainStream.read(file.header.data(), headerSize);
+  } else {
+    file.header = file.contents.substr(0, headerSize);
+  }
+  return file;
+}
+
+HepMC3::GenEvent HepMC3AsciiReader::readEventFromFile(const EventFile& file,
+                                                      std::size_t event) {
+  const auto [offset, size] = file.index.at(event);
+  std::string text = file.header;
+  if (file.contents.empty()) {
+    std::ifstream stream(file.path, std::ios::binary);
+    stream.seekg(offset);
+    text.resize(file.header.size() + size);
+    stream.read(text.data() + file.header.size(), size);
+    if (!stream) {
+      throw std::runtime_error("Could not read event " + std::to_string(event) +
+                               " from file '" + file.path + "'");
+    }
+  } else {
+    text.append(file.contents, offset, size);
+  }
+  text.append(kEndOfListing);
+  text.push_back('\n');
+
+  std::istringstream stream(std::move(text));
+  HepMC3::ReaderAscii reader(stream);
+  HepMC3::GenEvent genEvent(HepMC3::Units::GEV, HepMC3::Units::MM);
+  if (!reader.read_event(genEvent)) {
+    throw std::runtime_error("Could not parse event " + std::to_string(event) +
+                             " from file '" + file.path + "'");
+  }
+  return genEvent;
+}
+
 std::string HepMC3AsciiReader::HepMC3AsciiReader::name() const {
   return "HepMC3AsciiReader";
 }
@@ -51,30 +217,50 @@ std::pair<std::size_t, std::size_t> HepMC3AsciiReader::availableEvents() const {
 
 ProcessCode HepMC3AsciiReader::read(const AlgorithmContext& ctx) {
   std::vector<HepMC3::GenEvent> events;
-  HepMC3::GenEvent event(HepMC3::Units::GEV, HepMC3::Units::MM);
 
-  auto path = perEventFilepath(m_cfg.inputDir, m_cfg.inputStem + ".hepmc3",
-                               ctx.eventNumber);
+  if (m_file) {
+    if (ctx.eventNumber >= m_file->index.size()) {
+      ACTS_ERROR("Event " << ctx.eventNumber << " is not in "
+                          << m_cfg.inputPath);
+      return ProcessCode::ABORT;
+    }
+    events.push_back(readEventFromFile(*m_file, ctx.eventNumber));
+  } else {
+    HepMC3::GenEvent event(HepMC3::Units::GEV, HepMC3::Units::MM);
+
+    auto path = perEventFilepath(m_cfg.inputDir, m_cfg.inputStem + ".hepmc3",
+                                 ctx.eventNumber);
 
-  ACTS_DEBUG("Attempting to read event from " << path);
-  HepMC3::ReaderAscii reader(path);
+    ACTS_DEBUG("Attempting to read event from " << path);
+    HepMC3::ReaderAscii reader(path);
 
-  reader.read_event(event);
-  while (!reader.failed()) {
-    events.push_back(std::move(event));
-    event.clear();
     reader.read_event(event);
+    while (!reader.failed()) {
+      events.push_back(std::move(event));
+      event.clear();
+      reader.read_event(event);
+    }
+    reader.close();
   }
 
   if (events.empty()) {
     return ProcessCode::ABORT;
   }
 
+  if (!m_pileupPool.empty()) {
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+    std::poisson_distribution<std::size_t> nPileup(m_cfg.pileup);
+    std::uniform_int_distribution<std::size_t> drawPileup(
+        0, m_pileupPool.size() - 1);
+    for (std::size_t n = nPileup(rng); n > 0; --n) {
+      events.push_back(m_pileupPool[drawPileup(rng)]);
+    }
+  }
+
   ACTS_VERBOSE(events.size()
                << " events read, writing to " << m_cfg.outputEvents);
   m_outputEvents(ctx, std::move(events));
 
-  reader.close();
   return ProcessCode::SUCCESS;
 }
 
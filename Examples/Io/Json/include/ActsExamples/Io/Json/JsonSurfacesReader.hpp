@@ -22,7 +22,8 @@ namespace ActsExamples::JsonSurfacesReader {
 
 /// @brief Options specification for surface reading
 struct Options {
-  /// @brief  Which input file to read from
+  /// @brief  Which input file to read from, the binary json encodings are
+  /// deduced from the file extension
   std::string inputFile = "";
   /// The entry path until you reach the surface entries
   std::vector<std::string> jsonEntryPath = {"Surfaces", "entries"};
@@ -11,32 +11,22 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Plugins/Json/ActsJson.hpp"
 #include "Acts/Plugins/Json/GeometryHierarchyMapJsonConverter.hpp"
+#include "Acts/Plugins/Json/JsonFileReader.hpp"
 #include "Acts/Plugins/Json/SurfaceJsonConverter.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
-#include <fstream>
-#include <iostream>
-
 namespace ActsExamples {
 
 Acts::GeometryHierarchyMap<std::shared_ptr<Acts::Surface>>
 JsonSurfacesReader::read(const JsonSurfacesReader::Options& options) {
-  // Read the json file into a json object
-  nlohmann::json j;
-  std::ifstream in(options.inputFile);
-  in >> j;
-  in.close();
-
   using SurfaceHierachyMap =
       Acts::GeometryHierarchyMap<std::shared_ptr<Acts::Surface>>;
   using GeometryIdHelper = Acts::GeometryHierarchyMapJsonConverter<bool>;
   std::vector<SurfaceHierachyMap::InputElement> surfaceElements;
 
-  // Walk down the path to the surface entries
-  nlohmann::json jSurfaces = j;
-  for (const auto& jep : options.jsonEntryPath) {
-    jSurfaces = jSurfaces[jep];
-  }
+  // Only the surface entries are kept while reading
+  nlohmann::json jSurfaces =
+      Acts::JsonFileReader::read(options.inputFile, options.jsonEntryPath);
 
   // Loop over the surfaces
   surfaceElements.reserve(jSurfaces.size());
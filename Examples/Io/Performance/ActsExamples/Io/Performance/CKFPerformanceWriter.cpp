@@ -87,6 +87,11 @@ CKFPerformanceWriter::~CKFPerformanceWriter() {
 }
 
 ProcessCode CKFPerformanceWriter::finalize() {
+  m_threadEffPlotCache.mergeInto(m_effPlotCache);
+  m_threadFakeRatePlotCache.mergeInto(m_fakeRatePlotCache);
+  m_threadDuplicationPlotCache.mergeInto(m_duplicationPlotCache);
+  m_threadTrackSummaryPlotCache.mergeInto(m_trackSummaryPlotCache);
+
   float eff_tracks = static_cast<float>(m_nTotalMatchedTracks) / m_nTotalTracks;
   float fakeRate_tracks =
       static_cast<float>(m_nTotalFakeTracks) / m_nTotalTracks;
@@ -158,15 +163,27 @@ ProcessCode CKFPerformanceWriter::writeT(const AlgorithmContext& ctx,
   const auto& trackParticleMatching = m_inputTrackParticleMatching(ctx);
   const auto& particleTrackMatching = m_inputParticleTrackMatching(ctx);
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  // Plots of this thread, no lock is needed to fill them
+  auto& effPlotCache = m_threadEffPlotCache.local();
+  auto& fakeRatePlotCache = m_threadFakeRatePlotCache.local();
+  auto& duplicationPlotCache = m_threadDuplicationPlotCache.local();
+  auto& trackSummaryPlotCache = m_threadTrackSummaryPlotCache.local();
+
+  // Counts of this event, added to the totals at the end
+  std::size_t nEventTracks = 0;
+  std::size_t nEventMatchedTracks = 0;
+  std::size_t nEventFakeTracks = 0;
+  std::size_t nEventDuplicateTracks = 0;
+  std::size_t nEventMatchedParticles = 0;
+  std::size_t nEventDuplicateParticles = 0;
+  std::size_t nEventFakeParticles = 0;
 
   // Vector of input features for neural network classification
   std::vector<float> inputFeatures(3);
 
   for (const auto& track : tracks) {
     // Counting number of total trajectories
-    m_nTotalTracks++;
+    nEventTracks++;
 
     // Check if the reco track has fitted track parameters
     if (!track.hasReferenceSurface()) {
@@ -179,7 +196,7 @@ ProcessCode CKFPerformanceWriter::writeT(const AlgorithmContext& ctx,
         track.createParametersAtReference();
 
     // Fill the trajectory summary info
-    m_trackSummaryPlotTool.fill(m_trackSummaryPlotCache, fittedParameters,
+    m_trackSummaryPlotTool.fill(trackSummaryPlotCache, fittedParameters,
                                 track.nTrackStates(), track.nMeasurements(),
                                 track.nOutliers(), track.nHoles(),
                                 track.nSharedHits());
@@ -195,21 +212,21 @@ ProcessCode CKFPerformanceWriter::writeT(const AlgorithmContext& ctx,
     const auto& particleMatch = imatched->second;
 
     if (particleMatch.classification == TrackMatchClassification::Fake) {
-      m_nTotalFakeTracks++;
+      nEventFakeTracks++;
     }
 
     if (particleMatch.classification == TrackMatchClassification::Duplicate) {
-      m_nTotalDuplicateTracks++;
+      nEventDuplicateTracks++;
     }
 
     // Fill fake rate plots
     m_fakeRatePlotTool.fill(
-        m_fakeRatePlotCache, fittedParameters,
+        fakeRatePlotCache, fittedParameters,
         particleMatch.classification == TrackMatchClassification::Fake);
 
     // Fill the duplication rate
     m_duplicationPlotTool.fill(
-        m_duplicationPlotCache, fittedParameters,
+        duplicationPlotCache, fittedParameters,
         particleMatch.classification == TrackMatchClassification::Duplicate);
   }
 
@@ -227,19 +244,19 @@ ProcessCode CKFPerformanceWriter::writeT(const AlgorithmContext& ctx,
                        imatched->second.duplicates;
 
       // Add number for total matched tracks here
-      m_nTotalMatchedTracks += nMatchedTracks;
-      m_nTotalMatchedParticles += 1;
+      nEventMatchedTracks += nMatchedTracks;
+      nEventMatchedParticles += 1;
 
       // Check if the particle has more than one matched track for the duplicate
       // rate
       if (nMatchedTracks > 1) {
-        m_nTotalDuplicateParticles += 1;
+        nEventDuplicateParticles += 1;
       }
       isReconstructed = imatched->second.track.has_value();
 
       nFakeTracks = imatched->second.fakes;
       if (nFakeTracks > 0) {
-        m_nTotalFakeParticles += 1;
+        nEventFakeParticles += 1;
       }
     }
 
@@ -261,20 +278,30 @@ ProcessCode CKFPerformanceWriter::writeT(const AlgorithmContext& ctx,
     }
 
     // Fill efficiency plots
-    m_effPlotTool.fill(m_effPlotCache, particle, minDeltaR, isReconstructed);
+    m_effPlotTool.fill(effPlotCache, particle, minDeltaR, isReconstructed);
     // Fill number of duplicated tracks for this particle
-    m_duplicationPlotTool.fill(m_duplicationPlotCache, particle,
+    m_duplicationPlotTool.fill(duplicationPlotCache, particle,
                                nMatchedTracks - 1);
 
     // Fill number of reconstructed/truth-matched/fake tracks for this particle
-    m_fakeRatePlotTool.fill(m_fakeRatePlotCache, particle, nMatchedTracks,
+    m_fakeRatePlotTool.fill(fakeRatePlotCache, particle, nMatchedTracks,
                             nFakeTracks);
-
-    m_nTotalParticles += 1;
   }
 
+  m_nTotalTracks += nEventTracks;
+  m_nTotalMatchedTracks += nEventMatchedTracks;
+  m_nTotalFakeTracks += nEventFakeTracks;
+  m_nTotalDuplicateTracks += nEventDuplicateTracks;
+  m_nTotalParticles += particles.size();
+  m_nTotalMatchedParticles += nEventMatchedParticles;
+  m_nTotalDuplicateParticles += nEventDuplicateParticles;
+  m_nTotalFakeParticles += nEventFakeParticles;
+
   // Write additional stuff to TTree
   if (m_cfg.writeMatchingDetails && m_matchingTree != nullptr) {
+    // Exclusive access to the tree while writing
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+
     for (const auto& particle : particles) {
       auto particleId = particle.particleId();
 
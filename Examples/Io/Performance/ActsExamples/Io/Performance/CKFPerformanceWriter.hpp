@@ -17,8 +17,10 @@
 #include "ActsExamples/Validation/DuplicationPlotTool.hpp"
 #include "ActsExamples/Validation/EffPlotTool.hpp"
 #include "ActsExamples/Validation/FakeRatePlotTool.hpp"
+#include "ActsExamples/Validation/ThreadLocalPlotCache.hpp"
 #include "ActsExamples/Validation/TrackSummaryPlotTool.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <mutex>
 #include <string>
@@ -40,7 +42,9 @@ struct AlgorithmContext;
 /// A common file can be provided for the writer to attach his TTree, this is
 /// done by setting the Config::rootFile pointer to an existing file.
 ///
-/// Safe to use from multiple writer threads - uses a std::mutex lock.
+/// Safe to use from multiple writer threads. The plots are filled into
+/// per-thread caches that are merged at finalize; only the optional matching
+/// details tree is protected by a std::mutex lock.
 class CKFPerformanceWriter final : public WriterT<ConstTrackContainer> {
  public:
   struct Config {
@@ -82,7 +86,7 @@ class CKFPerformanceWriter final : public WriterT<ConstTrackContainer> {
                      const ConstTrackContainer& tracks) override;
 
   Config m_cfg;
-  /// Mutex used to protect multi-threaded writes.
+  /// Mutex used to protect multi-threaded writes to the matching tree.
   std::mutex m_writeMutex;
   TFile* m_outputFile{nullptr};
   /// Plot tool for efficiency
@@ -98,6 +102,18 @@ class CKFPerformanceWriter final : public WriterT<ConstTrackContainer> {
   TrackSummaryPlotTool m_trackSummaryPlotTool;
   TrackSummaryPlotTool::TrackSummaryPlotCache m_trackSummaryPlotCache{};
 
+  /// Per-thread plots filled by the events, merged into the above at finalize
+  ThreadLocalPlotCache<EffPlotTool, EffPlotTool::EffPlotCache>
+      m_threadEffPlotCache{m_effPlotTool};
+  ThreadLocalPlotCache<FakeRatePlotTool, FakeRatePlotTool::FakeRatePlotCache>
+      m_threadFakeRatePlotCache{m_fakeRatePlotTool};
+  ThreadLocalPlotCache<DuplicationPlotTool,
+                       DuplicationPlotTool::DuplicationPlotCache>
+      m_threadDuplicationPlotCache{m_duplicationPlotTool};
+  ThreadLocalPlotCache<TrackSummaryPlotTool,
+                       TrackSummaryPlotTool::TrackSummaryPlotCache>
+      m_threadTrackSummaryPlotCache{m_trackSummaryPlotTool};
+
   /// For optional output of the matching details
   TTree* m_matchingTree{nullptr};
 
@@ -107,14 +123,14 @@ class CKFPerformanceWriter final : public WriterT<ConstTrackContainer> {
   bool m_treeIsMatched{};
 
   // Adding numbers for efficiency, fake, duplicate calculations
-  std::size_t m_nTotalTracks = 0;
-  std::size_t m_nTotalMatchedTracks = 0;
-  std::size_t m_nTotalFakeTracks = 0;
-  std::size_t m_nTotalDuplicateTracks = 0;
-  std::size_t m_nTotalParticles = 0;
-  std::size_t m_nTotalMatchedParticles = 0;
-  std::size_t m_nTotalDuplicateParticles = 0;
-  std::size_t m_nTotalFakeParticles = 0;
+  std::atomic<std::size_t> m_nTotalTracks = 0;
+  std::atomic<std::size_t> m_nTotalMatchedTracks = 0;
+  std::atomic<std::size_t> m_nTotalFakeTracks = 0;
+  std::atomic<std::size_t> m_nTotalDuplicateTracks = 0;
+  std::atomic<std::size_t> m_nTotalParticles = 0;
+  std::atomic<std::size_t> m_nTotalMatchedParticles = 0;
+  std::atomic<std::size_t> m_nTotalDuplicateParticles = 0;
+  std::atomic<std::size_t> m_nTotalFakeParticles = 0;
 
   ReadDataHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
   ReadDataHandle<TrackParticleMatching> m_inputTrackParticleMatching{
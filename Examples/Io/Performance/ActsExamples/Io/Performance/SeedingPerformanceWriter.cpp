@@ -74,6 +74,9 @@ ActsExamples::SeedingPerformanceWriter::~SeedingPerformanceWriter() {
 }
 
 ActsExamples::ProcessCode ActsExamples::SeedingPerformanceWriter::finalize() {
+  m_threadEffPlotCache.mergeInto(m_effPlotCache);
+  m_threadDuplicationPlotCache.mergeInto(m_duplicationPlotCache);
+
   float eff = static_cast<float>(m_nTotalMatchedParticles) / m_nTotalParticles;
   float fakeRate =
       static_cast<float>(m_nTotalSeeds - m_nTotalMatchedSeeds) / m_nTotalSeeds;
@@ -127,6 +130,10 @@ ActsExamples::ProcessCode ActsExamples::SeedingPerformanceWriter::writeT(
   const auto& particles = m_inputParticles(ctx);
   const auto& hitParticlesMap = m_inputMeasurementParticlesMap(ctx);
 
+  // Plots of this thread, no lock is needed to fill them
+  auto& effPlotCache = m_threadEffPlotCache.local();
+  auto& duplicationPlotCache = m_threadDuplicationPlotCache.local();
+
   std::size_t nSeeds = seeds.size();
   std::size_t nMatchedSeeds = 0;
   // Map from particles to how many times they were successfully found by a seed
@@ -177,8 +184,8 @@ ActsExamples::ProcessCode ActsExamples::SeedingPerformanceWriter::writeT(
         minDeltaR = distance;
       }
     }
-    m_effPlotTool.fill(m_effPlotCache, particle, minDeltaR, isMatched);
-    m_duplicationPlotTool.fill(m_duplicationPlotCache, particle,
+    m_effPlotTool.fill(effPlotCache, particle, minDeltaR, isMatched);
+    m_duplicationPlotTool.fill(duplicationPlotCache, particle,
                                nMatchedSeedsForParticle - 1);
   }
   ACTS_DEBUG("Number of seeds: " << nSeeds);
@@ -17,9 +17,10 @@
 #include "ActsExamples/Framework/WriterT.hpp"
 #include "ActsExamples/Validation/DuplicationPlotTool.hpp"
 #include "ActsExamples/Validation/EffPlotTool.hpp"
+#include "ActsExamples/Validation/ThreadLocalPlotCache.hpp"
 
+#include <atomic>
 #include <cstddef>
-#include <mutex>
 #include <string>
 
 class TFile;
@@ -67,8 +68,6 @@ class SeedingPerformanceWriter final : public WriterT<SimSeedContainer> {
                      const SimSeedContainer& seeds) override;
 
   Config m_cfg;
-  /// Mutex used to protect multi-threaded writes.
-  std::mutex m_writeMutex;
   TFile* m_outputFile{nullptr};
   /// Plot tool for efficiency
   EffPlotTool m_effPlotTool;
@@ -77,11 +76,18 @@ class SeedingPerformanceWriter final : public WriterT<SimSeedContainer> {
   DuplicationPlotTool m_duplicationPlotTool;
   DuplicationPlotTool::DuplicationPlotCache m_duplicationPlotCache{};
 
-  std::size_t m_nTotalSeeds = 0;
-  std::size_t m_nTotalMatchedSeeds = 0;
-  std::size_t m_nTotalParticles = 0;
-  std::size_t m_nTotalMatchedParticles = 0;
-  std::size_t m_nTotalDuplicatedParticles = 0;
+  /// Per-thread plots filled by the events, merged into the above at finalize
+  ThreadLocalPlotCache<EffPlotTool, EffPlotTool::EffPlotCache>
+      m_threadEffPlotCache{m_effPlotTool};
+  ThreadLocalPlotCache<DuplicationPlotTool,
+                       DuplicationPlotTool::DuplicationPlotCache>
+      m_threadDuplicationPlotCache{m_duplicationPlotTool};
+
+  std::atomic<std::size_t> m_nTotalSeeds = 0;
+  std::atomic<std::size_t> m_nTotalMatchedSeeds = 0;
+  std::atomic<std::size_t> m_nTotalParticles = 0;
+  std::atomic<std::size_t> m_nTotalMatchedParticles = 0;
+  std::atomic<std::size_t> m_nTotalDuplicatedParticles = 0;
 
   ReadDataHandle<SimParticleContainer> m_inputParticles{this, "InputParticles"};
   ReadDataHandle<HitParticlesMap> m_inputMeasurementParticlesMap{
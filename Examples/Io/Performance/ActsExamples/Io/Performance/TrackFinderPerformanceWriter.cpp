@@ -225,7 +225,7 @@ struct ActsExamples::TrackFinderPerformanceWriter::Impl {
 
     // write per-particle performance measures
     {
-      std::lock_guard<std::mutex> guardPrt(trkMutex);
+      std::lock_guard<std::mutex> guardPrt(prtMutex);
       for (const auto& particle : particles) {
         // find all hits for this particle
         auto hits =
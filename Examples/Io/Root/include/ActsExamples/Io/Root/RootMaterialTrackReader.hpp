@@ -47,6 +47,10 @@ class RootMaterialTrackReader : public IReader {
 
     // Read surface information for the root file
     bool readCachedSurfaceInformation = false;
+
+    /// Size of the tree cache in bytes, which reads ahead the baskets of the
+    /// decoded branches, 0 disables it
+    std::size_t cacheSize = 64 * 1024 * 1024;
   };
 
   /// Constructor
@@ -0,0 +1,159 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef ACTS_EXAMPLES_ROOT_NTUPLE
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6, 32, 0)
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleReader.hxx>
+#include <ROOT/RNTupleWriter.hxx>
+#else
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#endif
+#endif
+
+class TFile;
+
+namespace ActsExamples {
+
+/// Write the buffers of a writer as the columns of an RNTuple
+///
+/// The columns are declared on the buffers before the RNTuple is opened,
+/// `fill` moves the values of all buffers into a new entry. The pages of the
+/// columns are compressed in parallel if ROOT's implicit multi-threading is
+/// enabled.
+///
+/// RNTuple is only available with ROOT 6.30 or newer, otherwise the
+/// constructor throws.
+class RootNTupleOutput {
+ public:
+#ifdef ACTS_EXAMPLES_ROOT_NTUPLE
+  RootNTupleOutput() : m_model(ROOT::Experimental::RNTupleModel::Create()) {}
+
+  /// Declare a column on a buffer, which must outlive this object
+  template <typename T>
+  void addColumn(const std::string& name, T& buffer) {
+    auto field = m_model->MakeField<T>(name);
+    m_moves.push_back([field, &buffer] { *field = std::move(buffer); });
+  }
+
+  /// Open the RNTuple in a file, no columns can be added afterwards
+  void open(const std::string& name, TFile& file) {
+    m_writer = ROOT::Experimental::RNTupleWriter::Append(std::move(m_model),
+                                                         name, file);
+  }
+
+  /// Write one entry from the current values of the buffers
+  void fill() {
+    for (const auto& moveValue : m_moves) {
+      moveValue();
+    }
+    m_writer->Fill();
+  }
+
+  /// Write the pending pages and the RNTuple description to the file
+  void close() { m_writer.reset(); }
+
+ private:
+  std::unique_ptr<ROOT::Experimental::RNTupleModel> m_model;
+  std::unique_ptr<ROOT::Experimental::RNTupleWriter> m_writer;
+  std::vector<std::function<void()>> m_moves;
+#else
+  RootNTupleOutput() {
+    throw std::runtime_error(
+        "RNTuple output requires the examples to be built with ROOT 6.30 or "
+        "newer");
+  }
+
+  template <typename T>
+  void addColumn(const std::string& /*name*/, T& /*buffer*/) {}
+  void open(const std::string& /*name*/, TFile& /*file*/) {}
+  void fill() {}
+  void close() {}
+#endif
+};
+
+/// Read the columns of an RNTuple into the buffers of a reader
+///
+/// RNTuple is only available with ROOT 6.30 or newer, otherwise the
+/// constructor throws.
+class RootNTupleInput {
+ public:
+#ifdef ACTS_EXAMPLES_ROOT_NTUPLE
+  /// Open an RNTuple
+  ///
+  /// @param name The name of the RNTuple
+  /// @param path The path of the file
+  RootNTupleInput(const std::string& name, const std::string& path)
+      : m_reader(ROOT::Experimental::RNTupleReader::Open(name, path)) {}
+
+  /// The number of entries
+  std::uint64_t entries() const { return m_reader->GetNEntries(); }
+
+  /// Declare a column that is read into a buffer by `load`, the buffer must
+  /// outlive this object
+  template <typename T>
+  void addColumn(const std::string& name, T& buffer) {
+    auto view = std::make_shared<ROOT::Experimental::RNTupleView<T>>(
+        m_reader->GetView<T>(name));
+    m_loads.push_back(
+        [view, &buffer](std::uint64_t entry) { buffer = (*view)(entry); });
+  }
+
+  /// Read the values of one column for all entries
+  template <typename T>
+  std::vector<T> readColumn(const std::string& name) {
+    auto view = m_reader->GetView<T>(name);
+    std::vector<T> values;
+    values.reserve(entries());
+    for (std::uint64_t entry = 0; entry < entries(); ++entry) {
+      values.push_back(view(entry));
+    }
+    return values;
+  }
+
+  /// Read one entry into the buffers of all declared columns
+  void load(std::uint64_t entry) {
+    for (const auto& readValue : m_loads) {
+      readValue(entry);
+    }
+  }
+
+ private:
+  std::unique_ptr<ROOT::Experimental::RNTupleReader> m_reader;
+  std::vector<std::function<void(std::uint64_t)>> m_loads;
+#else
+  RootNTupleInput(const std::string& /*name*/, const std::string& /*path*/) {
+    throw std::runtime_error(
+        "RNTuple input requires the examples to be built with ROOT 6.30 or "
+        "newer");
+  }
+
+  std::uint64_t entries() const { return 0; }
+  template <typename T>
+  void addColumn(const std::string& /*name*/, T& /*buffer*/) {}
+  template <typename T>
+  std::vector<T> readColumn(const std::string& /*name*/) {
+    return {};
+  }
+  void load(std::uint64_t /*entry*/) {}
+#endif
+};
+
+}  // namespace ActsExamples
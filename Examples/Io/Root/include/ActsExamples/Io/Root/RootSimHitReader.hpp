@@ -42,6 +42,14 @@ class RootSimHitReader : public IReader {
     std::string treeName = "hits";
     ///< The name of the input file
     std::string filePath;
+    /// Read the momentum branches. If disabled, the hits are created with
+    /// zero four-momenta which is sufficient for jobs that only need the hit
+    /// positions and identifiers.
+    bool readMomenta = true;
+    /// Optional file to persist the event-to-entry index of the input file.
+    /// It is created by scanning the input file if it does not exist yet and
+    /// loaded instead of scanning the file otherwise.
+    std::string eventIndexPath;
   };
 
   RootSimHitReader(const RootSimHitReader &) = delete;
@@ -78,9 +86,16 @@ class RootSimHitReader : public IReader {
   /// mutex used to protect multi-threaded reads
   std::mutex m_read_mutex;
 
-  /// Vector of {eventNr, entryMin, entryMax}
+  /// Vector of {eventNr, entryMin, entryMax}, sorted by event number
   std::vector<std::tuple<uint32_t, std::size_t, std::size_t>> m_eventMap;
 
+  /// Scan the input chain for the entry ranges of the events
+  void buildEventMap();
+  /// Load the event map from the index file, returns false if not possible
+  bool readEventIndex(std::size_t nEntries);
+  /// Persist the event map to the index file
+  void writeEventIndex() const;
+
   /// The input tree name
   TChain *m_inputChain = nullptr;
 
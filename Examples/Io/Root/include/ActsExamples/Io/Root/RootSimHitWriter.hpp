@@ -12,9 +12,10 @@
 #include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Utilities/SerialFillQueue.hpp"
 
 #include <cstdint>
-#include <mutex>
+#include <memory>
 #include <string>
 
 class TFile;
@@ -30,7 +31,9 @@ struct AlgorithmContext;
 ///
 /// Safe to use from multiple writer threads. To avoid thread-saftey issues,
 /// the writer must be the sole owner of the underlying file. Thus, the
-/// output file pointer can not be given from the outside.
+/// output file pointer can not be given from the outside. The hits are packed
+/// into rows on the writer threads and filled into the tree on a dedicated
+/// thread.
 class RootSimHitWriter final : public WriterT<SimHitContainer> {
  public:
   struct Config {
@@ -68,32 +71,39 @@ class RootSimHitWriter final : public WriterT<SimHitContainer> {
                      const SimHitContainer& hits) override;
 
  private:
+  /// Branch values of one hit
+  struct Row {
+    /// Event identifier.
+    uint32_t eventId = 0;
+    /// Hit surface identifier.
+    uint64_t geometryId = 0;
+    /// Event-unique particle identifier a.k.a. barcode.
+    uint64_t particleId = 0;
+    /// True global hit position components in mm.
+    float tx = 0, ty = 0, tz = 0;
+    // True global hit time in ns.
+    float tt = 0;
+    /// True particle four-momentum in GeV at hit position before interaction.
+    float tpx = 0, tpy = 0, tpz = 0, te = 0;
+    /// True change in particle four-momentum in GeV due to interactions.
+    float deltapx = 0, deltapy = 0, deltapz = 0, deltae = 0;
+    /// Hit index along the particle trajectory
+    int32_t index = 0;
+    // Decoded hit surface identifier components.
+    uint32_t volumeId = 0;
+    uint32_t boundaryId = 0;
+    uint32_t layerId = 0;
+    uint32_t approachId = 0;
+    uint32_t sensitiveId = 0;
+  };
+
   Config m_cfg;
-  std::mutex m_writeMutex;
   TFile* m_outputFile = nullptr;
   TTree* m_outputTree = nullptr;
-  /// Event identifier.
-  uint32_t m_eventId = 0;
-  /// Hit surface identifier.
-  uint64_t m_geometryId = 0;
-  /// Event-unique particle identifier a.k.a. barcode.
-  uint64_t m_particleId = 0;
-  /// True global hit position components in mm.
-  float m_tx = 0, m_ty = 0, m_tz = 0;
-  // True global hit time in ns.
-  float m_tt = 0;
-  /// True particle four-momentum in GeV at hit position before interaction.
-  float m_tpx = 0, m_tpy = 0, m_tpz = 0, m_te = 0;
-  /// True change in particle four-momentum in GeV due to interactions.
-  float m_deltapx = 0, m_deltapy = 0, m_deltapz = 0, m_deltae = 0;
-  /// Hit index along the particle trajectory
-  int32_t m_index = 0;
-  // Decoded hit surface identifier components.
-  uint32_t m_volumeId = 0;
-  uint32_t m_boundaryId = 0;
-  uint32_t m_layerId = 0;
-  uint32_t m_approachId = 0;
-  uint32_t m_sensitiveId = 0;
+  /// Branch buffers, only accessed by the fill thread
+  Row m_row;
+  /// Fills the tree on a dedicated thread
+  std::unique_ptr<SerialFillQueue<Row>> m_fillQueue;
 };
 
 }  // namespace ActsExamples
@@ -17,10 +17,11 @@
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Utilities/SerialFillQueue.hpp"
 
 #include <array>
 #include <cstdint>
-#include <mutex>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -31,21 +32,22 @@ class Barcode;
 }  // namespace ActsFatras
 
 namespace ActsExamples {
+class RootNTupleOutput;
 struct AlgorithmContext;
 
 /// @class RootTrackStatesWriter
 ///
 /// Write out tracks (i.e. a vector of trackState at the moment) into a TTree
 ///
-/// Safe to use from multiple writer threads - uses a std::mutex lock.
-///
 /// Each entry in the TTree corresponds to one track for optimum writing speed.
 /// The event number is part of the written data.
+/// Optionally, an RNTuple with the same columns is written instead.
 ///
 /// A common file can be provided for the writer to attach his TTree, this is
 /// done by setting the Config::rootFile pointer to an existing file.
 ///
-/// Safe to use from multiple writer threads - uses a std::mutex lock.
+/// Safe to use from multiple writer threads. The tracks are packed into rows on
+/// the writer threads and filled into the tree on a dedicated thread.
 class RootTrackStatesWriter final : public WriterT<ConstTrackContainer> {
  public:
   struct Config {
@@ -65,6 +67,9 @@ class RootTrackStatesWriter final : public WriterT<ConstTrackContainer> {
     std::string treeName = "trackstates";
     /// file access mode.
     std::string fileMode = "RECREATE";
+    /// Write an RNTuple with the same columns instead of a TTree, requires
+    /// ROOT 6.30 or newer
+    bool writeRNTuple = false;
   };
 
   /// Constructor
@@ -91,6 +96,154 @@ class RootTrackStatesWriter final : public WriterT<ConstTrackContainer> {
  private:
   enum ParameterType { ePredicted, eFiltered, eSmoothed, eUnbiased, eSize };
 
+  /// Branch values of one track
+  struct Row {
+    /// the event number
+    uint32_t eventNr{0};
+    /// the track number
+    uint32_t trackNr{0};
+
+    /// Global truth hit position x
+    std::vector<float> t_x;
+    /// Global truth hit position y
+    std::vector<float> t_y;
+    /// Global truth hit position z
+    std::vector<float> t_z;
+    /// Global truth hit position r
+    std::vector<float> t_r;
+    /// Truth particle direction x at global hit position
+    std::vector<float> t_dx;
+    /// Truth particle direction y at global hit position
+    std::vector<float> t_dy;
+    /// Truth particle direction z at global hit position
+    std::vector<float> t_dz;
+
+    /// truth parameter eBoundLoc0
+    std::vector<float> t_eLOC0;
+    /// truth parameter eBoundLoc1
+    std::vector<float> t_eLOC1;
+    /// truth parameter ePHI
+    std::vector<float> t_ePHI;
+    /// truth parameter eTHETA
+    std::vector<float> t_eTHETA;
+    /// truth parameter eQOP
+    std::vector<float> t_eQOP;
+    /// truth parameter eT
+    std::vector<float> t_eT;
+
+    /// event-unique particle identifier a.k.a barcode for hits per each surface
+    std::vector<std::vector<std::uint64_t>> particleId;
+
+    /// number of all states
+    unsigned int nStates{0};
+    /// number of states with measurements
+    unsigned int nMeasurements{0};
+    /// volume identifier
+    std::vector<int> volumeID;
+    /// layer identifier
+    std::vector<int> layerID;
+    /// surface identifier
+    std::vector<int> moduleID;
+    /// path length
+    std::vector<float> pathLength;
+    /// uncalibrated measurement local x
+    std::vector<float> lx_hit;
+    /// uncalibrated measurement local y
+    std::vector<float> ly_hit;
+    /// uncalibrated measurement global x
+    std::vector<float> x_hit;
+    /// uncalibrated measurement global y
+    std::vector<float> y_hit;
+    /// uncalibrated measurement global z
+    std::vector<float> z_hit;
+    /// hit residual x
+    std::vector<float> res_x_hit;
+    /// hit residual y
+    std::vector<float> res_y_hit;
+    /// hit err x
+    std::vector<float> err_x_hit;
+    /// hit err y
+    std::vector<float> err_y_hit;
+    /// hit pull x
+    std::vector<float> pull_x_hit;
+    /// hit pull y
+    std::vector<float> pull_y_hit;
+    /// dimension of measurement
+    std::vector<int> dim_hit;
+
+    /// number of states which have filtered/predicted/smoothed/unbiased
+    /// parameters
+    std::array<int, eSize> nParams{};
+    /// status of the filtered/predicted/smoothed/unbiased parameters
+    std::array<std::vector<bool>, eSize> hasParams;
+    /// predicted/filtered/smoothed/unbiased parameter eLOC0
+    std::array<std::vector<float>, eSize> eLOC0;
+    /// predicted/filtered/smoothed/unbiased parameter eLOC1
+    std::array<std::vector<float>, eSize> eLOC1;
+    /// predicted/filtered/smoothed/unbiased parameter ePHI
+    std::array<std::vector<float>, eSize> ePHI;
+    /// predicted/filtered/smoothed/unbiased parameter eTHETA
+    std::array<std::vector<float>, eSize> eTHETA;
+    /// predicted/filtered/smoothed/unbiased parameter eQOP
+    std::array<std::vector<float>, eSize> eQOP;
+    /// predicted/filtered/smoothed/unbiased parameter eT
+    std::array<std::vector<float>, eSize> eT;
+    /// predicted/filtered/smoothed/unbiased parameter eLOC0 residual
+    std::array<std::vector<float>, eSize> res_eLOC0;
+    /// predicted/filtered/smoothed/unbiased parameter eLOC1 residual
+    std::array<std::vector<float>, eSize> res_eLOC1;
+    /// predicted/filtered/smoothed/unbiased parameter ePHI residual
+    std::array<std::vector<float>, eSize> res_ePHI;
+    /// predicted/filtered/smoothed/unbiased parameter eTHETA residual
+    std::array<std::vector<float>, eSize> res_eTHETA;
+    /// predicted/filtered/smoothed/unbiased parameter eQOP residual
+    std::array<std::vector<float>, eSize> res_eQOP;
+    /// predicted/filtered/smoothed/unbiased parameter eT residual
+    std::array<std::vector<float>, eSize> res_eT;
+    /// predicted/filtered/smoothed/unbiased parameter eLOC0 error
+    std::array<std::vector<float>, eSize> err_eLOC0;
+    /// predicted/filtered/smoothed/unbiased parameter eLOC1 error
+    std::array<std::vector<float>, eSize> err_eLOC1;
+    /// predicted/filtered/smoothed/unbiased parameter ePHI error
+    std::array<std::vector<float>, eSize> err_ePHI;
+    /// predicted/filtered/smoothed/unbiased parameter eTHETA error
+    std::array<std::vector<float>, eSize> err_eTHETA;
+    /// predicted/filtered/smoothed/unbiased parameter eQOP error
+    std::array<std::vector<float>, eSize> err_eQOP;
+    /// predicted/filtered/smoothed/unbiased parameter eT error
+    std::array<std::vector<float>, eSize> err_eT;
+    /// predicted/filtered/smoothed/unbiased parameter eLOC0 pull
+    std::array<std::vector<float>, eSize> pull_eLOC0;
+    /// predicted/filtered/smoothed/unbiased parameter eLOC1 pull
+    std::array<std::vector<float>, eSize> pull_eLOC1;
+    /// predicted/filtered/smoothed/unbiased parameter ePHI pull
+    std::array<std::vector<float>, eSize> pull_ePHI;
+    /// predicted/filtered/smoothed/unbiased parameter eTHETA pull
+    std::array<std::vector<float>, eSize> pull_eTHETA;
+    /// predicted/filtered/smoothed/unbiased parameter eQOP pull
+    std::array<std::vector<float>, eSize> pull_eQOP;
+    /// predicted/filtered/smoothed/unbiased parameter eT pull
+    std::array<std::vector<float>, eSize> pull_eT;
+    /// predicted/filtered/smoothed/unbiased parameter global x
+    std::array<std::vector<float>, eSize> x;
+    /// predicted/filtered/smoothed/unbiased parameter global y
+    std::array<std::vector<float>, eSize> y;
+    /// predicted/filtered/smoothed/unbiased parameter global z
+    std::array<std::vector<float>, eSize> z;
+    /// predicted/filtered/smoothed/unbiased parameter px
+    std::array<std::vector<float>, eSize> px;
+    /// predicted/filtered/smoothed/unbiased parameter py
+    std::array<std::vector<float>, eSize> py;
+    /// predicted/filtered/smoothed/unbiased parameter pz
+    std::array<std::vector<float>, eSize> pz;
+    /// predicted/filtered/smoothed/unbiased parameter eta
+    std::array<std::vector<float>, eSize> eta;
+    /// predicted/filtered/smoothed/unbiased parameter pT
+    std::array<std::vector<float>, eSize> pT;
+
+    std::vector<float> chi2;  ///< chisq from filtering
+  };
+
   /// The config class
   Config m_cfg;
 
@@ -101,156 +254,20 @@ class RootTrackStatesWriter final : public WriterT<ConstTrackContainer> {
   ReadDataHandle<HitSimHitsMap> m_inputMeasurementSimHitsMap{
       this, "InputMeasurementSimHitsMap"};
 
-  /// Mutex used to protect multi-threaded writes
-  std::mutex m_writeMutex;
   /// The output file
   TFile* m_outputFile{nullptr};
   /// The output tree
   TTree* m_outputTree{nullptr};
-  /// the event number
-  uint32_t m_eventNr{0};
-  /// the track number
-  uint32_t m_trackNr{0};
-
-  /// Global truth hit position x
-  std::vector<float> m_t_x;
-  /// Global truth hit position y
-  std::vector<float> m_t_y;
-  /// Global truth hit position z
-  std::vector<float> m_t_z;
-  /// Global truth hit position r
-  std::vector<float> m_t_r;
-  /// Truth particle direction x at global hit position
-  std::vector<float> m_t_dx;
-  /// Truth particle direction y at global hit position
-  std::vector<float> m_t_dy;
-  /// Truth particle direction z at global hit position
-  std::vector<float> m_t_dz;
-
-  /// truth parameter eBoundLoc0
-  std::vector<float> m_t_eLOC0;
-  /// truth parameter eBoundLoc1
-  std::vector<float> m_t_eLOC1;
-  /// truth parameter ePHI
-  std::vector<float> m_t_ePHI;
-  /// truth parameter eTHETA
-  std::vector<float> m_t_eTHETA;
-  /// truth parameter eQOP
-  std::vector<float> m_t_eQOP;
-  /// truth parameter eT
-  std::vector<float> m_t_eT;
-
-  /// event-unique particle identifier a.k.a barcode for hits per each surface
-  std::vector<std::vector<std::uint64_t>> m_particleId;
-
-  /// number of all states
-  unsigned int m_nStates{0};
-  /// number of states with measurements
-  unsigned int m_nMeasurements{0};
-  /// volume identifier
-  std::vector<int> m_volumeID;
-  /// layer identifier
-  std::vector<int> m_layerID;
-  /// surface identifier
-  std::vector<int> m_moduleID;
-  /// path length
-  std::vector<float> m_pathLength;
-  /// uncalibrated measurement local x
-  std::vector<float> m_lx_hit;
-  /// uncalibrated measurement local y
-  std::vector<float> m_ly_hit;
-  /// uncalibrated measurement global x
-  std::vector<float> m_x_hit;
-  /// uncalibrated measurement global y
-  std::vector<float> m_y_hit;
-  /// uncalibrated measurement global z
-  std::vector<float> m_z_hit;
-  /// hit residual x
-  std::vector<float> m_res_x_hit;
-  /// hit residual y
-  std::vector<float> m_res_y_hit;
-  /// hit err x
-  std::vector<float> m_err_x_hit;
-  /// hit err y
-  std::vector<float> m_err_y_hit;
-  /// hit pull x
-  std::vector<float> m_pull_x_hit;
-  /// hit pull y
-  std::vector<float> m_pull_y_hit;
-  /// dimension of measurement
-  std::vector<int> m_dim_hit;
-
-  /// number of states which have filtered/predicted/smoothed/unbiased
-  /// parameters
-  std::array<int, eSize> m_nParams{};
-  /// status of the filtered/predicted/smoothed/unbiased parameters
-  std::array<std::vector<bool>, eSize> m_hasParams;
-  /// predicted/filtered/smoothed/unbiased parameter eLOC0
-  std::array<std::vector<float>, eSize> m_eLOC0;
-  /// predicted/filtered/smoothed/unbiased parameter eLOC1
-  std::array<std::vector<float>, eSize> m_eLOC1;
-  /// predicted/filtered/smoothed/unbiased parameter ePHI
-  std::array<std::vector<float>, eSize> m_ePHI;
-  /// predicted/filtered/smoothed/unbiased parameter eTHETA
-  std::array<std::vector<float>, eSize> m_eTHETA;
-  /// predicted/filtered/smoothed/unbiased parameter eQOP
-  std::array<std::vector<float>, eSize> m_eQOP;
-  /// predicted/filtered/smoothed/unbiased parameter eT
-  std::array<std::vector<float>, eSize> m_eT;
-  /// predicted/filtered/smoothed/unbiased parameter eLOC0 residual
-  std::array<std::vector<float>, eSize> m_res_eLOC0;
-  /// predicted/filtered/smoothed/unbiased parameter eLOC1 residual
-  std::array<std::vector<float>, eSize> m_res_eLOC1;
-  /// predicted/filtered/smoothed/unbiased parameter ePHI residual
-  std::array<std::vector<float>, eSize> m_res_ePHI;
-  /// predicted/filtered/smoothed/unbiased parameter eTHETA residual
-  std::array<std::vector<float>, eSize> m_res_eTHETA;
-  /// predicted/filtered/smoothed/unbiased parameter eQOP residual
-  std::array<std::vector<float>, eSize> m_res_eQOP;
-  /// predicted/filtered/smoothed/unbiased parameter eT residual
-  std::array<std::vector<float>, eSize> m_res_eT;
-  /// predicted/filtered/smoothed/unbiased parameter eLOC0 error
-  std::array<std::vector<float>, eSize> m_err_eLOC0;
-  /// predicted/filtered/smoothed/unbiased parameter eLOC1 error
-  std::array<std::vector<float>, eSize> m_err_eLOC1;
-  /// predicted/filtered/smoothed/unbiased parameter ePHI error
-  std::array<std::vector<float>, eSize> m_err_ePHI;
-  /// predicted/filtered/smoothed/unbiased parameter eTHETA error
-  std::array<std::vector<float>, eSize> m_err_eTHETA;
-  /// predicted/filtered/smoothed/unbiased parameter eQOP error
-  std::array<std::vector<float>, eSize> m_err_eQOP;
-  /// predicted/filtered/smoothed/unbiased parameter eT error
-  std::array<std::vector<float>, eSize> m_err_eT;
-  /// predicted/filtered/smoothed/unbiased parameter eLOC0 pull
-  std::array<std::vector<float>, eSize> m_pull_eLOC0;
-  /// predicted/filtered/smoothed/unbiased parameter eLOC1 pull
-  std::array<std::vector<float>, eSize> m_pull_eLOC1;
-  /// predicted/filtered/smoothed/unbiased parameter ePHI pull
-  std::array<std::vector<float>, eSize> m_pull_ePHI;
-  /// predicted/filtered/smoothed/unbiased parameter eTHETA pull
-  std::array<std::vector<float>, eSize> m_pull_eTHETA;
-  /// predicted/filtered/smoothed/unbiased parameter eQOP pull
-  std::array<std::vector<float>, eSize> m_pull_eQOP;
-  /// predicted/filtered/smoothed/unbiased parameter eT pull
-  std::array<std::vector<float>, eSize> m_pull_eT;
-  /// predicted/filtered/smoothed/unbiased parameter global x
-  std::array<std::vector<float>, eSize> m_x;
-  /// predicted/filtered/smoothed/unbiased parameter global y
-  std::array<std::vector<float>, eSize> m_y;
-  /// predicted/filtered/smoothed/unbiased parameter global z
-  std::array<std::vector<float>, eSize> m_z;
-  /// predicted/filtered/smoothed/unbiased parameter px
-  std::array<std::vector<float>, eSize> m_px;
-  /// predicted/filtered/smoothed/unbiased parameter py
-  std::array<std::vector<float>, eSize> m_py;
-  /// predicted/filtered/smoothed/unbiased parameter pz
-  std::array<std::vector<float>, eSize> m_pz;
-  /// predicted/filtered/smoothed/unbiased parameter eta
-  std::array<std::vector<float>, eSize> m_eta;
-  /// predicted/filtered/smoothed/unbiased parameter pT
-  std::array<std::vector<float>, eSize> m_pT;
+  /// The output RNTuple, replaces the tree if enabled
+  std::unique_ptr<RootNTupleOutput> m_ntuple;
+  /// Branch buffers, only accessed by the fill thread
+  Row m_row;
+  /// Fills the tree on a dedicated thread
+  std::unique_ptr<SerialFillQueue<Row>> m_fillQueue;
 
-  std::vector<float> m_chi2;  ///< chisq from filtering
+  /// Declare a branch or an RNTuple column on a buffer
+  template <typename T>
+  void addColumn(const std::string& name, T& buffer);
 };
 
 }  // namespace ActsExamples
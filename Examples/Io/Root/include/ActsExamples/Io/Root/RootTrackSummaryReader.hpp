@@ -30,6 +30,8 @@ class TChain;
 
 namespace ActsExamples {
 
+class RootNTupleInput;
+
 /// @class RootTrackSummaryReader
 ///
 /// @brief Reads in TrackParameter information from a root file
@@ -46,6 +48,9 @@ class RootTrackSummaryReader : public IReader {
     std::string treeName = "tracksummary";
     /// The name of the input file
     std::string filePath;
+    /// Read an RNTuple written by the RootTrackSummaryWriter instead of a
+    /// TTree, requires ROOT 6.30 or newer
+    bool readRNTuple = false;
   };
 
   /// Constructor
@@ -94,6 +99,8 @@ class RootTrackSummaryReader : public IReader {
 
   /// The input tree name
   TChain* m_inputChain = nullptr;
+  /// The input RNTuple, replaces the chain if enabled
+  std::unique_ptr<RootNTupleInput> m_ntuple;
 
   /// the event number
   uint32_t m_eventNr{0};
@@ -19,6 +19,8 @@
 #include <cstdint>
 #include <iostream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <TChain.h>
 #include <TTree.h>
@@ -95,6 +97,31 @@ RootMaterialTrackReader::RootMaterialTrackReader(const Config& config,
                             m_entryNumbers.data(), false);
   }
 
+  // Only the branches that are decoded in read() are enabled, all others
+  // would be decompressed on every entry without being used
+  std::vector<std::string> readBranches = {
+      "v_x", "v_y", "v_z", "v_px", "v_py", "v_pz", "mat_x", "mat_y", "mat_z",
+      "mat_dx", "mat_dy", "mat_dz", "mat_step_length", "mat_X0", "mat_L0",
+      "mat_A", "mat_Z", "mat_rho"};
+  if (m_cfg.readCachedSurfaceInformation) {
+    readBranches.insert(readBranches.end(), {"sur_id", "sur_x", "sur_y",
+                                             "sur_z", "sur_pathCorrection"});
+  }
+  m_inputChain->SetBranchStatus("*", false);
+  for (const auto& branch : readBranches) {
+    m_inputChain->SetBranchStatus(branch.c_str(), true);
+  }
+
+  // The baskets of these branches are read ahead through the tree cache,
+  // with the branches known upfront there is no learning phase
+  if (m_cfg.cacheSize > 0) {
+    m_inputChain->SetCacheSize(static_cast<Long64_t>(m_cfg.cacheSize));
+    for (const auto& branch : readBranches) {
+      m_inputChain->AddBranchToCache(branch.c_str(), true);
+    }
+    m_inputChain->StopCacheLearningPhase();
+  }
+
   m_outputMaterialTracks.initialize(m_cfg.outputMaterialTracks);
 }
 
@@ -80,15 +80,25 @@ ActsExamples::RootMeasurementWriter::RootMeasurementWriter(
 
   m_outputTrees = Acts::GeometryHierarchyMap<std::unique_ptr<DigitizationTree>>(
       std::move(dTrees));
+
+  m_fillQueue =
+      std::make_unique<SerialFillQueue<TreeRow>>([](TreeRow& treeRow) {
+        treeRow.tree->row = std::move(treeRow.values);
+        treeRow.tree->tree->Fill();
+      });
 }
 
 ActsExamples::RootMeasurementWriter::~RootMeasurementWriter() {
+  // stop filling before the file is closed
+  m_fillQueue.reset();
   if (m_outputFile != nullptr) {
     m_outputFile->Close();
   }
 }
 
 ActsExamples::ProcessCode ActsExamples::RootMeasurementWriter::finalize() {
+  m_fillQueue->finish();
+
   /// Close the file if it's yours
   m_outputFile->cd();
   for (auto dTree = m_outputTrees.begin(); dTree != m_outputTrees.end();
@@ -110,8 +120,8 @@ ActsExamples::ProcessCode ActsExamples::RootMeasurementWriter::writeT(
     clusters = m_inputClusters(ctx);
   }
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  std::vector<TreeRow> rows;
+  rows.reserve(measurements.size());
 
   for (Index hitIdx = 0u; hitIdx < measurements.size(); ++hitIdx) {
     const auto& meas = measurements[hitIdx];
@@ -131,10 +141,12 @@ ActsExamples::ProcessCode ActsExamples::RootMeasurementWriter::writeT(
           if (dTreeItr == m_outputTrees.end()) {
             return;
           }
-          auto& dTree = *dTreeItr;
+          TreeRow& treeRow = rows.emplace_back();
+          treeRow.tree = dTreeItr->get();
+          auto& row = treeRow.values;
 
           // Fill the identification
-          dTree->fillIdentification(ctx.eventNumber, geoId);
+          row.fillIdentification(ctx.eventNumber, geoId);
 
           // Find the contributing simulated hits
           auto indices = makeRange(hitSimHitsMap.equal_range(hitIdx));
@@ -148,25 +160,18 @@ ActsExamples::ProcessCode ActsExamples::RootMeasurementWriter::writeT(
                   .inverse();
           std::pair<double, double> angles =
               Acts::VectorHelpers::incidentAngles(dir, rot);
-          dTree->fillTruthParameters(local, pos4, dir, angles);
-          dTree->fillBoundMeasurement(m);
+          row.fillTruthParameters(local, pos4, dir, angles);
+          row.fillBoundMeasurement(m);
           if (!clusters.empty()) {
             const auto& c = clusters[hitIdx];
-            dTree->fillCluster(c);
-          }
-          dTree->tree->Fill();
-          if (dTree->chValue != nullptr) {
-            dTree->chValue->clear();
-          }
-          if (dTree->chId[0] != nullptr) {
-            dTree->chId[0]->clear();
-          }
-          if (dTree->chId[1] != nullptr) {
-            dTree->chId[1]->clear();
+            row.fillCluster(c);
           }
         },
         meas);
   }
 
+  // the trees are filled on the fill thread
+  m_fillQueue->push(std::move(rows));
+
   return ActsExamples::ProcessCode::SUCCESS;
 }
@@ -64,6 +64,13 @@ RootParticleReader::RootParticleReader(const RootParticleReader::Config& config,
   m_inputChain->SetBranchAddress("generation", &m_generation);
   m_inputChain->SetBranchAddress("sub_particle", &m_subParticle);
 
+  // Only read the branches that are converted into the particles
+  m_inputChain->SetBranchStatus("*", false);
+  for (auto key : {"event_id", "particle_id", "particle_type", "process", "vx",
+                   "vy", "vz", "vt", "p", "px", "py", "pz", "m", "q"}) {
+    m_inputChain->SetBranchStatus(key, true);
+  }
+
   auto path = m_cfg.filePath;
 
   // add file to the input chain
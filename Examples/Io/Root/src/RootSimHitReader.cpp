@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <stdexcept>
 
@@ -62,11 +63,37 @@ RootSimHitReader::RootSimHitReader(const RootSimHitReader::Config& config,
   ACTS_DEBUG("Adding File " << m_cfg.filePath << " to tree '" << m_cfg.treeName
                             << "'.");
 
+  auto nEntries = static_cast<std::size_t>(m_inputChain->GetEntriesFast());
+
   // Because each hit is stored in a single entry in the root file, we need to
-  // scan the file first for the positions of the events in the file in order to
-  // efficiently read the events later on.
+  // know the positions of the events in the file in order to efficiently read
+  // the events later on. Either load them from a previous run or scan the file.
   // TODO change the file format to store one event per entry
+  if (m_cfg.eventIndexPath.empty() || !readEventIndex(nEntries)) {
+    buildEventMap();
+    if (!m_cfg.eventIndexPath.empty()) {
+      writeEventIndex();
+    }
+  }
+
+  // Only enable the branches that are converted into the hits
+  m_inputChain->SetBranchStatus("*", false);
+  for (auto key : {"event_id", "geometry_id", "particle_id", "index", "tx",
+                   "ty", "tz", "tt"}) {
+    m_inputChain->SetBranchStatus(key, true);
+  }
+  if (m_cfg.readMomenta) {
+    for (auto key : {"tpx", "tpy", "tpz", "te", "deltapx", "deltapy",
+                     "deltapz", "deltae"}) {
+      m_inputChain->SetBranchStatus(key, true);
+    }
+  }
+
+  ACTS_DEBUG("Event range: " << availableEvents().first << " - "
+                             << availableEvents().second);
+}
 
+void RootSimHitReader::buildEventMap() {
   // Disable all branches and only enable event-id for a first scan of the file
   m_inputChain->SetBranchStatus("*", false);
   m_inputChain->SetBranchStatus("event_id", true);
@@ -95,11 +122,52 @@ RootSimHitReader::RootSimHitReader(const RootSimHitReader::Config& config,
             [](const auto& a, const auto& b) {
               return std::get<0>(a) < std::get<0>(b);
             });
+}
 
-  // Re-Enable all branches
-  m_inputChain->SetBranchStatus("*", true);
-  ACTS_DEBUG("Event range: " << availableEvents().first << " - "
-                             << availableEvents().second);
+bool RootSimHitReader::readEventIndex(std::size_t nEntries) {
+  std::ifstream file(m_cfg.eventIndexPath);
+  if (!file) {
+    return false;
+  }
+
+  // one line per event: event number, first entry, end entry
+  std::uint32_t eventId = 0;
+  std::size_t first = 0;
+  std::size_t last = 0;
+  std::size_t nIndexed = 0;
+  while (file >> eventId >> first >> last) {
+    m_eventMap.push_back({eventId, first, last});
+    nIndexed += last - first;
+  }
+
+  // the index must describe exactly this input
+  if (!file.eof() || m_eventMap.empty() || nIndexed != nEntries ||
+      !std::is_sorted(m_eventMap.begin(), m_eventMap.end(),
+                      [](const auto& a, const auto& b) {
+                        return std::get<0>(a) < std::get<0>(b);
+                      })) {
+    ACTS_WARNING("Event index '" << m_cfg.eventIndexPath
+                                 << "' does not match the input file '"
+                                 << m_cfg.filePath << "', rebuild it");
+    m_eventMap.clear();
+    return false;
+  }
+
+  ACTS_DEBUG("Loaded event index from '" << m_cfg.eventIndexPath << "'");
+  return true;
+}
+
+void RootSimHitReader::writeEventIndex() const {
+  std::ofstream file(m_cfg.eventIndexPath);
+  for (const auto& [eventId, first, last] : m_eventMap) {
+    file << eventId << ' ' << first << ' ' << last << '\n';
+  }
+  if (!file) {
+    ACTS_WARNING("Could not write event index '" << m_cfg.eventIndexPath
+                                                 << "'");
+    return;
+  }
+  ACTS_DEBUG("Wrote event index to '" << m_cfg.eventIndexPath << "'");
 }
 
 std::pair<std::size_t, std::size_t> RootSimHitReader::availableEvents() const {
@@ -107,11 +175,14 @@ std::pair<std::size_t, std::size_t> RootSimHitReader::availableEvents() const {
 }
 
 ProcessCode RootSimHitReader::read(const AlgorithmContext& context) {
-  auto it = std::find_if(
-      m_eventMap.begin(), m_eventMap.end(),
-      [&](const auto& a) { return std::get<0>(a) == context.eventNumber; });
-
-  if (it == m_eventMap.end()) {
+  // the event map is sorted by event number
+  auto it = std::lower_bound(m_eventMap.begin(), m_eventMap.end(),
+                             context.eventNumber,
+                             [](const auto& a, std::size_t eventNr) {
+                               return std::get<0>(a) < eventNr;
+                             });
+
+  if (it == m_eventMap.end() || std::get<0>(*it) != context.eventNumber) {
     // explicitly warn if it happens for the first or last event as that might
     // indicate a human error
     if ((context.eventNumber == availableEvents().first) &&
@@ -154,19 +225,22 @@ ProcessCode RootSimHitReader::read(const AlgorithmContext& context) {
         m_floatColumns.at("tt") * Acts::UnitConstants::mm,
     };
 
-    const Acts::Vector4 before4 = {
-        m_floatColumns.at("tpx") * Acts::UnitConstants::GeV,
-        m_floatColumns.at("tpy") * Acts::UnitConstants::GeV,
-        m_floatColumns.at("tpz") * Acts::UnitConstants::GeV,
-        m_floatColumns.at("te") * Acts::UnitConstants::GeV,
-    };
-
-    const Acts::Vector4 delta = {
-        m_floatColumns.at("deltapx") * Acts::UnitConstants::GeV,
-        m_floatColumns.at("deltapy") * Acts::UnitConstants::GeV,
-        m_floatColumns.at("deltapz") * Acts::UnitConstants::GeV,
-        m_floatColumns.at("deltae") * Acts::UnitConstants::GeV,
-    };
+    Acts::Vector4 before4 = Acts::Vector4::Zero();
+    Acts::Vector4 delta = Acts::Vector4::Zero();
+    if (m_cfg.readMomenta) {
+      before4 = {
+          m_floatColumns.at("tpx") * Acts::UnitConstants::GeV,
+          m_floatColumns.at("tpy") * Acts::UnitConstants::GeV,
+          m_floatColumns.at("tpz") * Acts::UnitConstants::GeV,
+          m_floatColumns.at("te") * Acts::UnitConstants::GeV,
+      };
+      delta = {
+          m_floatColumns.at("deltapx") * Acts::UnitConstants::GeV,
+          m_floatColumns.at("deltapy") * Acts::UnitConstants::GeV,
+          m_floatColumns.at("deltapz") * Acts::UnitConstants::GeV,
+          m_floatColumns.at("deltae") * Acts::UnitConstants::GeV,
+      };
+    }
 
     SimHit hit(geoid, pid, pos4, before4, before4 + delta, index);
 
@@ -17,6 +17,8 @@
 #include <ios>
 #include <ostream>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <TFile.h>
 #include <TTree.h>
@@ -45,36 +47,45 @@ ActsExamples::RootSimHitWriter::RootSimHitWriter(
   }
 
   // setup the branches
-  m_outputTree->Branch("event_id", &m_eventId);
-  m_outputTree->Branch("geometry_id", &m_geometryId, "geometry_id/l");
-  m_outputTree->Branch("particle_id", &m_particleId, "particle_id/l");
-  m_outputTree->Branch("tx", &m_tx);
-  m_outputTree->Branch("ty", &m_ty);
-  m_outputTree->Branch("tz", &m_tz);
-  m_outputTree->Branch("tt", &m_tt);
-  m_outputTree->Branch("tpx", &m_tpx);
-  m_outputTree->Branch("tpy", &m_tpy);
-  m_outputTree->Branch("tpz", &m_tpz);
-  m_outputTree->Branch("te", &m_te);
-  m_outputTree->Branch("deltapx", &m_deltapx);
-  m_outputTree->Branch("deltapy", &m_deltapy);
-  m_outputTree->Branch("deltapz", &m_deltapz);
-  m_outputTree->Branch("deltae", &m_deltae);
-  m_outputTree->Branch("index", &m_index);
-  m_outputTree->Branch("volume_id", &m_volumeId);
-  m_outputTree->Branch("boundary_id", &m_boundaryId);
-  m_outputTree->Branch("layer_id", &m_layerId);
-  m_outputTree->Branch("approach_id", &m_approachId);
-  m_outputTree->Branch("sensitive_id", &m_sensitiveId);
+  m_outputTree->Branch("event_id", &m_row.eventId);
+  m_outputTree->Branch("geometry_id", &m_row.geometryId, "geometry_id/l");
+  m_outputTree->Branch("particle_id", &m_row.particleId, "particle_id/l");
+  m_outputTree->Branch("tx", &m_row.tx);
+  m_outputTree->Branch("ty", &m_row.ty);
+  m_outputTree->Branch("tz", &m_row.tz);
+  m_outputTree->Branch("tt", &m_row.tt);
+  m_outputTree->Branch("tpx", &m_row.tpx);
+  m_outputTree->Branch("tpy", &m_row.tpy);
+  m_outputTree->Branch("tpz", &m_row.tpz);
+  m_outputTree->Branch("te", &m_row.te);
+  m_outputTree->Branch("deltapx", &m_row.deltapx);
+  m_outputTree->Branch("deltapy", &m_row.deltapy);
+  m_outputTree->Branch("deltapz", &m_row.deltapz);
+  m_outputTree->Branch("deltae", &m_row.deltae);
+  m_outputTree->Branch("index", &m_row.index);
+  m_outputTree->Branch("volume_id", &m_row.volumeId);
+  m_outputTree->Branch("boundary_id", &m_row.boundaryId);
+  m_outputTree->Branch("layer_id", &m_row.layerId);
+  m_outputTree->Branch("approach_id", &m_row.approachId);
+  m_outputTree->Branch("sensitive_id", &m_row.sensitiveId);
+
+  m_fillQueue = std::make_unique<SerialFillQueue<Row>>([this](Row& row) {
+    m_row = std::move(row);
+    m_outputTree->Fill();
+  });
 }
 
 ActsExamples::RootSimHitWriter::~RootSimHitWriter() {
+  // stop filling before the file is closed
+  m_fillQueue.reset();
   if (m_outputFile != nullptr) {
     m_outputFile->Close();
   }
 }
 
 ActsExamples::ProcessCode ActsExamples::RootSimHitWriter::finalize() {
+  m_fillQueue->finish();
+
   m_outputFile->cd();
   m_outputTree->Write();
   m_outputFile->Close();
@@ -87,40 +98,40 @@ ActsExamples::ProcessCode ActsExamples::RootSimHitWriter::finalize() {
 
 ActsExamples::ProcessCode ActsExamples::RootSimHitWriter::writeT(
     const AlgorithmContext& ctx, const ActsExamples::SimHitContainer& hits) {
-  // ensure exclusive access to tree/file while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
-
-  // Get the event number
-  m_eventId = ctx.eventNumber;
+  std::vector<Row> rows;
+  rows.reserve(hits.size());
   for (const auto& hit : hits) {
-    m_particleId = hit.particleId().value();
-    m_geometryId = hit.geometryId().value();
+    Row& row = rows.emplace_back();
+    // Get the event number
+    row.eventId = ctx.eventNumber;
+    row.particleId = hit.particleId().value();
+    row.geometryId = hit.geometryId().value();
     // write hit position
-    m_tx = hit.fourPosition().x() / Acts::UnitConstants::mm;
-    m_ty = hit.fourPosition().y() / Acts::UnitConstants::mm;
-    m_tz = hit.fourPosition().z() / Acts::UnitConstants::mm;
-    m_tt = hit.fourPosition().w() / Acts::UnitConstants::mm;
+    row.tx = hit.fourPosition().x() / Acts::UnitConstants::mm;
+    row.ty = hit.fourPosition().y() / Acts::UnitConstants::mm;
+    row.tz = hit.fourPosition().z() / Acts::UnitConstants::mm;
+    row.tt = hit.fourPosition().w() / Acts::UnitConstants::mm;
     // write four-momentum before interaction
-    m_tpx = hit.momentum4Before().x() / Acts::UnitConstants::GeV;
-    m_tpy = hit.momentum4Before().y() / Acts::UnitConstants::GeV;
-    m_tpz = hit.momentum4Before().z() / Acts::UnitConstants::GeV;
-    m_te = hit.momentum4Before().w() / Acts::UnitConstants::GeV;
+    row.tpx = hit.momentum4Before().x() / Acts::UnitConstants::GeV;
+    row.tpy = hit.momentum4Before().y() / Acts::UnitConstants::GeV;
+    row.tpz = hit.momentum4Before().z() / Acts::UnitConstants::GeV;
+    row.te = hit.momentum4Before().w() / Acts::UnitConstants::GeV;
     // write four-momentum change due to interaction
     const auto delta4 = hit.momentum4After() - hit.momentum4Before();
-    m_deltapx = delta4.x() / Acts::UnitConstants::GeV;
-    m_deltapy = delta4.y() / Acts::UnitConstants::GeV;
-    m_deltapz = delta4.z() / Acts::UnitConstants::GeV;
-    m_deltae = delta4.w() / Acts::UnitConstants::GeV;
+    row.deltapx = delta4.x() / Acts::UnitConstants::GeV;
+    row.deltapy = delta4.y() / Acts::UnitConstants::GeV;
+    row.deltapz = delta4.z() / Acts::UnitConstants::GeV;
+    row.deltae = delta4.w() / Acts::UnitConstants::GeV;
     // write hit index along trajectory
-    m_index = hit.index();
+    row.index = hit.index();
     // decoded geometry for simplicity
-    m_volumeId = hit.geometryId().volume();
-    m_boundaryId = hit.geometryId().boundary();
-    m_layerId = hit.geometryId().layer();
-    m_approachId = hit.geometryId().approach();
-    m_sensitiveId = hit.geometryId().sensitive();
-    // Fill the tree
-    m_outputTree->Fill();
+    row.volumeId = hit.geometryId().volume();
+    row.boundaryId = hit.geometryId().boundary();
+    row.layerId = hit.geometryId().layer();
+    row.approachId = hit.geometryId().approach();
+    row.sensitiveId = hit.geometryId().sensitive();
   }
+  // the tree is filled on the fill thread
+  m_fillQueue->push(std::move(rows));
   return ActsExamples::ProcessCode::SUCCESS;
 }
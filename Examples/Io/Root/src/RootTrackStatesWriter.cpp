@@ -23,6 +23,7 @@
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Root/RootNTuple.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
@@ -37,6 +38,7 @@
 #include <ostream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include <TFile.h>
 #include <TTree.h>
@@ -50,6 +52,16 @@ using Acts::VectorHelpers::perp;
 using Acts::VectorHelpers::phi;
 using Acts::VectorHelpers::theta;
 
+template <typename T>
+void ActsExamples::RootTrackStatesWriter::addColumn(const std::string& name,
+                                                    T& buffer) {
+  if (m_ntuple != nullptr) {
+    m_ntuple->addColumn(name, buffer);
+  } else {
+    m_outputTree->Branch(name.c_str(), &buffer);
+  }
+}
+
 ActsExamples::RootTrackStatesWriter::RootTrackStatesWriter(
     const ActsExamples::RootTrackStatesWriter::Config& config,
     Acts::Logging::Level level)
@@ -88,199 +100,225 @@ ActsExamples::RootTrackStatesWriter::RootTrackStatesWriter(
     throw std::ios_base::failure("Could not open '" + path + "'");
   }
   m_outputFile->cd();
-  m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
-  if (m_outputTree == nullptr) {
-    throw std::bad_alloc();
+  if (m_cfg.writeRNTuple) {
+    m_ntuple = std::make_unique<RootNTupleOutput>();
   } else {
-    // I/O parameters
-    m_outputTree->Branch("event_nr", &m_eventNr);
-    m_outputTree->Branch("track_nr", &m_trackNr);
-
-    m_outputTree->Branch("t_x", &m_t_x);
-    m_outputTree->Branch("t_y", &m_t_y);
-    m_outputTree->Branch("t_z", &m_t_z);
-    m_outputTree->Branch("t_r", &m_t_r);
-    m_outputTree->Branch("t_dx", &m_t_dx);
-    m_outputTree->Branch("t_dy", &m_t_dy);
-    m_outputTree->Branch("t_dz", &m_t_dz);
-    m_outputTree->Branch("t_eLOC0", &m_t_eLOC0);
-    m_outputTree->Branch("t_eLOC1", &m_t_eLOC1);
-    m_outputTree->Branch("t_ePHI", &m_t_ePHI);
-    m_outputTree->Branch("t_eTHETA", &m_t_eTHETA);
-    m_outputTree->Branch("t_eQOP", &m_t_eQOP);
-    m_outputTree->Branch("t_eT", &m_t_eT);
-    m_outputTree->Branch("particle_ids", &m_particleId);
-
-    m_outputTree->Branch("nStates", &m_nStates);
-    m_outputTree->Branch("nMeasurements", &m_nMeasurements);
-    m_outputTree->Branch("volume_id", &m_volumeID);
-    m_outputTree->Branch("layer_id", &m_layerID);
-    m_outputTree->Branch("module_id", &m_moduleID);
-    m_outputTree->Branch("pathLength", &m_pathLength);
-    m_outputTree->Branch("l_x_hit", &m_lx_hit);
-    m_outputTree->Branch("l_y_hit", &m_ly_hit);
-    m_outputTree->Branch("g_x_hit", &m_x_hit);
-    m_outputTree->Branch("g_y_hit", &m_y_hit);
-    m_outputTree->Branch("g_z_hit", &m_z_hit);
-    m_outputTree->Branch("res_x_hit", &m_res_x_hit);
-    m_outputTree->Branch("res_y_hit", &m_res_y_hit);
-    m_outputTree->Branch("err_x_hit", &m_err_x_hit);
-    m_outputTree->Branch("err_y_hit", &m_err_y_hit);
-    m_outputTree->Branch("pull_x_hit", &m_pull_x_hit);
-    m_outputTree->Branch("pull_y_hit", &m_pull_y_hit);
-    m_outputTree->Branch("dim_hit", &m_dim_hit);
-
-    m_outputTree->Branch("nPredicted", &m_nParams[ePredicted]);
-    m_outputTree->Branch("predicted", &m_hasParams[ePredicted]);
-    m_outputTree->Branch("eLOC0_prt", &m_eLOC0[ePredicted]);
-    m_outputTree->Branch("eLOC1_prt", &m_eLOC1[ePredicted]);
-    m_outputTree->Branch("ePHI_prt", &m_ePHI[ePredicted]);
-    m_outputTree->Branch("eTHETA_prt", &m_eTHETA[ePredicted]);
-    m_outputTree->Branch("eQOP_prt", &m_eQOP[ePredicted]);
-    m_outputTree->Branch("eT_prt", &m_eT[ePredicted]);
-    m_outputTree->Branch("res_eLOC0_prt", &m_res_eLOC0[ePredicted]);
-    m_outputTree->Branch("res_eLOC1_prt", &m_res_eLOC1[ePredicted]);
-    m_outputTree->Branch("res_ePHI_prt", &m_res_ePHI[ePredicted]);
-    m_outputTree->Branch("res_eTHETA_prt", &m_res_eTHETA[ePredicted]);
-    m_outputTree->Branch("res_eQOP_prt", &m_res_eQOP[ePredicted]);
-    m_outputTree->Branch("res_eT_prt", &m_res_eT[ePredicted]);
-    m_outputTree->Branch("err_eLOC0_prt", &m_err_eLOC0[ePredicted]);
-    m_outputTree->Branch("err_eLOC1_prt", &m_err_eLOC1[ePredicted]);
-    m_outputTree->Branch("err_ePHI_prt", &m_err_ePHI[ePredicted]);
-    m_outputTree->Branch("err_eTHETA_prt", &m_err_eTHETA[ePredicted]);
-    m_outputTree->Branch("err_eQOP_prt", &m_err_eQOP[ePredicted]);
-    m_outputTree->Branch("err_eT_prt", &m_err_eT[ePredicted]);
-    m_outputTree->Branch("pull_eLOC0_prt", &m_pull_eLOC0[ePredicted]);
-    m_outputTree->Branch("pull_eLOC1_prt", &m_pull_eLOC1[ePredicted]);
-    m_outputTree->Branch("pull_ePHI_prt", &m_pull_ePHI[ePredicted]);
-    m_outputTree->Branch("pull_eTHETA_prt", &m_pull_eTHETA[ePredicted]);
-    m_outputTree->Branch("pull_eQOP_prt", &m_pull_eQOP[ePredicted]);
-    m_outputTree->Branch("pull_eT_prt", &m_pull_eT[ePredicted]);
-    m_outputTree->Branch("g_x_prt", &m_x[ePredicted]);
-    m_outputTree->Branch("g_y_prt", &m_y[ePredicted]);
-    m_outputTree->Branch("g_z_prt", &m_z[ePredicted]);
-    m_outputTree->Branch("px_prt", &m_px[ePredicted]);
-    m_outputTree->Branch("py_prt", &m_py[ePredicted]);
-    m_outputTree->Branch("pz_prt", &m_pz[ePredicted]);
-    m_outputTree->Branch("eta_prt", &m_eta[ePredicted]);
-    m_outputTree->Branch("pT_prt", &m_pT[ePredicted]);
-
-    m_outputTree->Branch("nFiltered", &m_nParams[eFiltered]);
-    m_outputTree->Branch("filtered", &m_hasParams[eFiltered]);
-    m_outputTree->Branch("eLOC0_flt", &m_eLOC0[eFiltered]);
-    m_outputTree->Branch("eLOC1_flt", &m_eLOC1[eFiltered]);
-    m_outputTree->Branch("ePHI_flt", &m_ePHI[eFiltered]);
-    m_outputTree->Branch("eTHETA_flt", &m_eTHETA[eFiltered]);
-    m_outputTree->Branch("eQOP_flt", &m_eQOP[eFiltered]);
-    m_outputTree->Branch("eT_flt", &m_eT[eFiltered]);
-    m_outputTree->Branch("res_eLOC0_flt", &m_res_eLOC0[eFiltered]);
-    m_outputTree->Branch("res_eLOC1_flt", &m_res_eLOC1[eFiltered]);
-    m_outputTree->Branch("res_ePHI_flt", &m_res_ePHI[eFiltered]);
-    m_outputTree->Branch("res_eTHETA_flt", &m_res_eTHETA[eFiltered]);
-    m_outputTree->Branch("res_eQOP_flt", &m_res_eQOP[eFiltered]);
-    m_outputTree->Branch("res_eT_flt", &m_res_eT[eFiltered]);
-    m_outputTree->Branch("err_eLOC0_flt", &m_err_eLOC0[eFiltered]);
-    m_outputTree->Branch("err_eLOC1_flt", &m_err_eLOC1[eFiltered]);
-    m_outputTree->Branch("err_ePHI_flt", &m_err_ePHI[eFiltered]);
-    m_outputTree->Branch("err_eTHETA_flt", &m_err_eTHETA[eFiltered]);
-    m_outputTree->Branch("err_eQOP_flt", &m_err_eQOP[eFiltered]);
-    m_outputTree->Branch("err_eT_flt", &m_err_eT[eFiltered]);
-    m_outputTree->Branch("pull_eLOC0_flt", &m_pull_eLOC0[eFiltered]);
-    m_outputTree->Branch("pull_eLOC1_flt", &m_pull_eLOC1[eFiltered]);
-    m_outputTree->Branch("pull_ePHI_flt", &m_pull_ePHI[eFiltered]);
-    m_outputTree->Branch("pull_eTHETA_flt", &m_pull_eTHETA[eFiltered]);
-    m_outputTree->Branch("pull_eQOP_flt", &m_pull_eQOP[eFiltered]);
-    m_outputTree->Branch("pull_eT_flt", &m_pull_eT[eFiltered]);
-    m_outputTree->Branch("g_x_flt", &m_x[eFiltered]);
-    m_outputTree->Branch("g_y_flt", &m_y[eFiltered]);
-    m_outputTree->Branch("g_z_flt", &m_z[eFiltered]);
-    m_outputTree->Branch("px_flt", &m_px[eFiltered]);
-    m_outputTree->Branch("py_flt", &m_py[eFiltered]);
-    m_outputTree->Branch("pz_flt", &m_pz[eFiltered]);
-    m_outputTree->Branch("eta_flt", &m_eta[eFiltered]);
-    m_outputTree->Branch("pT_flt", &m_pT[eFiltered]);
-
-    m_outputTree->Branch("nSmoothed", &m_nParams[eSmoothed]);
-    m_outputTree->Branch("smoothed", &m_hasParams[eSmoothed]);
-    m_outputTree->Branch("eLOC0_smt", &m_eLOC0[eSmoothed]);
-    m_outputTree->Branch("eLOC1_smt", &m_eLOC1[eSmoothed]);
-    m_outputTree->Branch("ePHI_smt", &m_ePHI[eSmoothed]);
-    m_outputTree->Branch("eTHETA_smt", &m_eTHETA[eSmoothed]);
-    m_outputTree->Branch("eQOP_smt", &m_eQOP[eSmoothed]);
-    m_outputTree->Branch("eT_smt", &m_eT[eSmoothed]);
-    m_outputTree->Branch("res_eLOC0_smt", &m_res_eLOC0[eSmoothed]);
-    m_outputTree->Branch("res_eLOC1_smt", &m_res_eLOC1[eSmoothed]);
-    m_outputTree->Branch("res_ePHI_smt", &m_res_ePHI[eSmoothed]);
-    m_outputTree->Branch("res_eTHETA_smt", &m_res_eTHETA[eSmoothed]);
-    m_outputTree->Branch("res_eQOP_smt", &m_res_eQOP[eSmoothed]);
-    m_outputTree->Branch("res_eT_smt", &m_res_eT[eSmoothed]);
-    m_outputTree->Branch("err_eLOC0_smt", &m_err_eLOC0[eSmoothed]);
-    m_outputTree->Branch("err_eLOC1_smt", &m_err_eLOC1[eSmoothed]);
-    m_outputTree->Branch("err_ePHI_smt", &m_err_ePHI[eSmoothed]);
-    m_outputTree->Branch("err_eTHETA_smt", &m_err_eTHETA[eSmoothed]);
-    m_outputTree->Branch("err_eQOP_smt", &m_err_eQOP[eSmoothed]);
-    m_outputTree->Branch("err_eT_smt", &m_err_eT[eSmoothed]);
-    m_outputTree->Branch("pull_eLOC0_smt", &m_pull_eLOC0[eSmoothed]);
-    m_outputTree->Branch("pull_eLOC1_smt", &m_pull_eLOC1[eSmoothed]);
-    m_outputTree->Branch("pull_ePHI_smt", &m_pull_ePHI[eSmoothed]);
-    m_outputTree->Branch("pull_eTHETA_smt", &m_pull_eTHETA[eSmoothed]);
-    m_outputTree->Branch("pull_eQOP_smt", &m_pull_eQOP[eSmoothed]);
-    m_outputTree->Branch("pull_eT_smt", &m_pull_eT[eSmoothed]);
-    m_outputTree->Branch("g_x_smt", &m_x[eSmoothed]);
-    m_outputTree->Branch("g_y_smt", &m_y[eSmoothed]);
-    m_outputTree->Branch("g_z_smt", &m_z[eSmoothed]);
-    m_outputTree->Branch("px_smt", &m_px[eSmoothed]);
-    m_outputTree->Branch("py_smt", &m_py[eSmoothed]);
-    m_outputTree->Branch("pz_smt", &m_pz[eSmoothed]);
-    m_outputTree->Branch("eta_smt", &m_eta[eSmoothed]);
-    m_outputTree->Branch("pT_smt", &m_pT[eSmoothed]);
-
-    m_outputTree->Branch("nUnbiased", &m_nParams[eUnbiased]);
-    m_outputTree->Branch("unbiased", &m_hasParams[eUnbiased]);
-    m_outputTree->Branch("eLOC0_ubs", &m_eLOC0[eUnbiased]);
-    m_outputTree->Branch("eLOC1_ubs", &m_eLOC1[eUnbiased]);
-    m_outputTree->Branch("ePHI_ubs", &m_ePHI[eUnbiased]);
-    m_outputTree->Branch("eTHETA_ubs", &m_eTHETA[eUnbiased]);
-    m_outputTree->Branch("eQOP_ubs", &m_eQOP[eUnbiased]);
-    m_outputTree->Branch("eT_ubs", &m_eT[eUnbiased]);
-    m_outputTree->Branch("res_eLOC0_ubs", &m_res_eLOC0[eUnbiased]);
-    m_outputTree->Branch("res_eLOC1_ubs", &m_res_eLOC1[eUnbiased]);
-    m_outputTree->Branch("res_ePHI_ubs", &m_res_ePHI[eUnbiased]);
-    m_outputTree->Branch("res_eTHETA_ubs", &m_res_eTHETA[eUnbiased]);
-    m_outputTree->Branch("res_eQOP_ubs", &m_res_eQOP[eUnbiased]);
-    m_outputTree->Branch("res_eT_ubs", &m_res_eT[eUnbiased]);
-    m_outputTree->Branch("err_eLOC0_ubs", &m_err_eLOC0[eUnbiased]);
-    m_outputTree->Branch("err_eLOC1_ubs", &m_err_eLOC1[eUnbiased]);
-    m_outputTree->Branch("err_ePHI_ubs", &m_err_ePHI[eUnbiased]);
-    m_outputTree->Branch("err_eTHETA_ubs", &m_err_eTHETA[eUnbiased]);
-    m_outputTree->Branch("err_eQOP_ubs", &m_err_eQOP[eUnbiased]);
-    m_outputTree->Branch("err_eT_ubs", &m_err_eT[eUnbiased]);
-    m_outputTree->Branch("pull_eLOC0_ubs", &m_pull_eLOC0[eUnbiased]);
-    m_outputTree->Branch("pull_eLOC1_ubs", &m_pull_eLOC1[eUnbiased]);
-    m_outputTree->Branch("pull_ePHI_ubs", &m_pull_ePHI[eUnbiased]);
-    m_outputTree->Branch("pull_eTHETA_ubs", &m_pull_eTHETA[eUnbiased]);
-    m_outputTree->Branch("pull_eQOP_ubs", &m_pull_eQOP[eUnbiased]);
-    m_outputTree->Branch("pull_eT_ubs", &m_pull_eT[eUnbiased]);
-    m_outputTree->Branch("g_x_ubs", &m_x[eUnbiased]);
-    m_outputTree->Branch("g_y_ubs", &m_y[eUnbiased]);
-    m_outputTree->Branch("g_z_ubs", &m_z[eUnbiased]);
-    m_outputTree->Branch("px_ubs", &m_px[eUnbiased]);
-    m_outputTree->Branch("py_ubs", &m_py[eUnbiased]);
-    m_outputTree->Branch("pz_ubs", &m_pz[eUnbiased]);
-    m_outputTree->Branch("eta_ubs", &m_eta[eUnbiased]);
-    m_outputTree->Branch("pT_ubs", &m_pT[eUnbiased]);
-
-    m_outputTree->Branch("chi2", &m_chi2);
+    m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
+    if (m_outputTree == nullptr) {
+      throw std::bad_alloc();
+    }
   }
+
+  // I/O parameters
+  addColumn("event_nr", m_row.eventNr);
+  addColumn("track_nr", m_row.trackNr);
+
+  addColumn("t_x", m_row.t_x);
+  addColumn("t_y", m_row.t_y);
+  addColumn("t_z", m_row.t_z);
+  addColumn("t_r", m_row.t_r);
+  addColumn("t_dx", m_row.t_dx);
+  addColumn("t_dy", m_row.t_dy);
+  addColumn("t_dz", m_row.t_dz);
+  addColumn("t_eLOC0", m_row.t_eLOC0);
+  addColumn("t_eLOC1", m_row.t_eLOC1);
+  addColumn("t_ePHI", m_row.t_ePHI);
+  addColumn("t_eTHETA", m_row.t_eTHETA);
+  addColumn("t_eQOP", m_row.t_eQOP);
+  addColumn("t_eT", m_row.t_eT);
+  addColumn("particle_ids", m_row.particleId);
+
+  addColumn("nStates", m_row.nStates);
+  addColumn("nMeasurements", m_row.nMeasurements);
+  addColumn("volume_id", m_row.volumeID);
+  addColumn("layer_id", m_row.layerID);
+  addColumn("module_id", m_row.moduleID);
+  addColumn("pathLength", m_row.pathLength);
+  addColumn("l_x_hit", m_row.lx_hit);
+  addColumn("l_y_hit", m_row.ly_hit);
+  addColumn("g_x_hit", m_row.x_hit);
+  addColumn("g_y_hit", m_row.y_hit);
+  addColumn("g_z_hit", m_row.z_hit);
+  addColumn("res_x_hit", m_row.res_x_hit);
+  addColumn("res_y_hit", m_row.res_y_hit);
+  addColumn("err_x_hit", m_row.err_x_hit);
+  addColumn("err_y_hit", m_row.err_y_hit);
+  addColumn("pull_x_hit", m_row.pull_x_hit);
+  addColumn("pull_y_hit", m_row.pull_y_hit);
+  addColumn("dim_hit", m_row.dim_hit);
+
+  addColumn("nPredicted", m_row.nParams[ePredicted]);
+  addColumn("predicted", m_row.hasParams[ePredicted]);
+  addColumn("eLOC0_prt", m_row.eLOC0[ePredicted]);
+  addColumn("eLOC1_prt", m_row.eLOC1[ePredicted]);
+  addColumn("ePHI_prt", m_row.ePHI[ePredicted]);
+  addColumn("eTHETA_prt", m_row.eTHETA[ePredicted]);
+  addColumn("eQOP_prt", m_row.eQOP[ePredicted]);
+  addColumn("eT_prt", m_row.eT[ePredicted]);
+  addColumn("res_eLOC0_prt", m_row.res_eLOC0[ePredicted]);
+  addColumn("res_eLOC1_prt", m_row.res_eLOC1[ePredicted]);
+  addColumn("res_ePHI_prt", m_row.res_ePHI[ePredicted]);
+  addColumn("res_eTHETA_prt", m_row.res_eTHETA[ePredicted]);
+  addColumn("res_eQOP_prt", m_row.res_eQOP[ePredicted]);
+  addColumn("res_eT_prt", m_row.res_eT[ePredicted]);
+  addColumn("err_eLOC0_prt", m_row.err_eLOC0[ePredicted]);
+  addColumn("err_eLOC1_prt", m_row.err_eLOC1[ePredicted]);
+  addColumn("err_ePHI_prt", m_row.err_ePHI[ePredicted]);
+  addColumn("err_eTHETA_prt", m_row.err_eTHETA[ePredicted]);
+  addColumn("err_eQOP_prt", m_row.err_eQOP[ePredicted]);
+  addColumn("err_eT_prt", m_row.err_eT[ePredicted]);
+  addColumn("pull_eLOC0_prt", m_row.pull_eLOC0[ePredicted]);
+  addColumn("pull_eLOC1_prt", m_row.pull_eLOC1[ePredicted]);
+  addColumn("pull_ePHI_prt", m_row.pull_ePHI[ePredicted]);
+  addColumn("pull_eTHETA_prt", m_row.pull_eTHETA[ePredicted]);
+  addColumn("pull_eQOP_prt", m_row.pull_eQOP[ePredicted]);
+  addColumn("pull_eT_prt", m_row.pull_eT[ePredicted]);
+  addColumn("g_x_prt", m_row.x[ePredicted]);
+  addColumn("g_y_prt", m_row.y[ePredicted]);
+  addColumn("g_z_prt", m_row.z[ePredicted]);
+  addColumn("px_prt", m_row.px[ePredicted]);
+  addColumn("py_prt", m_row.py[ePredicted]);
+  addColumn("pz_prt", m_row.pz[ePredicted]);
+  addColumn("eta_prt", m_row.eta[ePredicted]);
+  addColumn("pT_prt", m_row.pT[ePredicted]);
+
+  addColumn("nFiltered", m_row.nParams[eFiltered]);
+  addColumn("filtered", m_row.hasParams[eFiltered]);
+  addColumn("eLOC0_flt", m_row.eLOC0[eFiltered]);
+  addColumn("eLOC1_flt", m_row.eLOC1[eFiltered]);
+  addColumn("ePHI_flt", m_row.ePHI[eFiltered]);
+  addColumn("eTHETA_flt", m_row.eTHETA[eFiltered]);
+  addColumn("eQOP_flt", m_row.eQOP[eFiltered]);
+  addColumn("eT_flt", m_row.eT[eFiltered]);
+  addColumn("res_eLOC0_flt", m_row.res_eLOC0[eFiltered]);
+  addColumn("res_eLOC1_flt", m_row.res_eLOC1[eFiltered]);
+  addColumn("res_ePHI_flt", m_row.res_ePHI[eFiltered]);
+  addColumn("res_eTHETA_flt", m_row.res_eTHETA[eFiltered]);
+  addColumn("res_eQOP_flt", m_row.res_eQOP[eFiltered]);
+  addColumn("res_eT_flt", m_row.res_eT[eFiltered]);
+  addColumn("err_eLOC0_flt", m_row.err_eLOC0[eFiltered]);
+  addColumn("err_eLOC1_flt", m_row.err_eLOC1[eFiltered]);
+  addColumn("err_ePHI_flt", m_row.err_ePHI[eFiltered]);
+  addColumn("err_eTHETA_flt", m_row.err_eTHETA[eFiltered]);
+  addColumn("err_eQOP_flt", m_row.err_eQOP[eFiltered]);
+  addColumn("err_eT_flt", m_row.err_eT[eFiltered]);
+  addColumn("pull_eLOC0_flt", m_row.pull_eLOC0[eFiltered]);
+  addColumn("pull_eLOC1_flt", m_row.pull_eLOC1[eFiltered]);
+  addColumn("pull_ePHI_flt", m_row.pull_ePHI[eFiltered]);
+  addColumn("pull_eTHETA_flt", m_row.pull_eTHETA[eFiltered]);
+  addColumn("pull_eQOP_flt", m_row.pull_eQOP[eFiltered]);
+  addColumn("pull_eT_flt", m_row.pull_eT[eFiltered]);
+  addColumn("g_x_flt", m_row.x[eFiltered]);
+  addColumn("g_y_flt", m_row.y[eFiltered]);
+  addColumn("g_z_flt", m_row.z[eFiltered]);
+  addColumn("px_flt", m_row.px[eFiltered]);
+  addColumn("py_flt", m_row.py[eFiltered]);
+  addColumn("pz_flt", m_row.pz[eFiltered]);
+  addColumn("eta_flt", m_row.eta[eFiltered]);
+  addColumn("pT_flt", m_row.pT[eFiltered]);
+
+  addColumn("nSmoothed", m_row.nParams[eSmoothed]);
+  addColumn("smoothed", m_row.hasParams[eSmoothed]);
+  addColumn("eLOC0_smt", m_row.eLOC0[eSmoothed]);
+  addColumn("eLOC1_smt", m_row.eLOC1[eSmoothed]);
+  addColumn("ePHI_smt", m_row.ePHI[eSmoothed]);
+  addColumn("eTHETA_smt", m_row.eTHETA[eSmoothed]);
+  addColumn("eQOP_smt", m_row.eQOP[eSmoothed]);
+  addColumn("eT_smt", m_row.eT[eSmoothed]);
+  addColumn("res_eLOC0_smt", m_row.res_eLOC0[eSmoothed]);
+  addColumn("res_eLOC1_smt", m_row.res_eLOC1[eSmoothed]);
+  addColumn("res_ePHI_smt", m_row.res_ePHI[eSmoothed]);
+  addColumn("res_eTHETA_smt", m_row.res_eTHETA[eSmoothed]);
+  addColumn("res_eQOP_smt", m_row.res_eQOP[eSmoothed]);
+  addColumn("res_eT_smt", m_row.res_eT[eSmoothed]);
+  addColumn("err_eLOC0_smt", m_row.err_eLOC0[eSmoothed]);
+  addColumn("err_eLOC1_smt", m_row.err_eLOC1[eSmoothed]);
+  addColumn("err_ePHI_smt", m_row.err_ePHI[eSmoothed]);
+  addColumn("err_eTHETA_smt", m_row.err_eTHETA[eSmoothed]);
+  addColumn("err_eQOP_smt", m_row.err_eQOP[eSmoothed]);
+  addColumn("err_eT_smt", m_row.err_eT[eSmoothed]);
+  addColumn("pull_eLOC0_smt", m_row.pull_eLOC0[eSmoothed]);
+  addColumn("pull_eLOC1_smt", m_row.pull_eLOC1[eSmoothed]);
+  addColumn("pull_ePHI_smt", m_row.pull_ePHI[eSmoothed]);
+  addColumn("pull_eTHETA_smt", m_row.pull_eTHETA[eSmoothed]);
+  addColumn("pull_eQOP_smt", m_row.pull_eQOP[eSmoothed]);
+  addColumn("pull_eT_smt", m_row.pull_eT[eSmoothed]);
+  addColumn("g_x_smt", m_row.x[eSmoothed]);
+  addColumn("g_y_smt", m_row.y[eSmoothed]);
+  addColumn("g_z_smt", m_row.z[eSmoothed]);
+  addColumn("px_smt", m_row.px[eSmoothed]);
+  addColumn("py_smt", m_row.py[eSmoothed]);
+  addColumn("pz_smt", m_row.pz[eSmoothed]);
+  addColumn("eta_smt", m_row.eta[eSmoothed]);
+  addColumn("pT_smt", m_row.pT[eSmoothed]);
+
+  addColumn("nUnbiased", m_row.nParams[eUnbiased]);
+  addColumn("unbiased", m_row.hasParams[eUnbiased]);
+  addColumn("eLOC0_ubs", m_row.eLOC0[eUnbiased]);
+  addColumn("eLOC1_ubs", m_row.eLOC1[eUnbiased]);
+  addColumn("ePHI_ubs", m_row.ePHI[eUnbiased]);
+  addColumn("eTHETA_ubs", m_row.eTHETA[eUnbiased]);
+  addColumn("eQOP_ubs", m_row.eQOP[eUnbiased]);
+  addColumn("eT_ubs", m_row.eT[eUnbiased]);
+  addColumn("res_eLOC0_ubs", m_row.res_eLOC0[eUnbiased]);
+  addColumn("res_eLOC1_ubs", m_row.res_eLOC1[eUnbiased]);
+  addColumn("res_ePHI_ubs", m_row.res_ePHI[eUnbiased]);
+  addColumn("res_eTHETA_ubs", m_row.res_eTHETA[eUnbiased]);
+  addColumn("res_eQOP_ubs", m_row.res_eQOP[eUnbiased]);
+  addColumn("res_eT_ubs", m_row.res_eT[eUnbiased]);
+  addColumn("err_eLOC0_ubs", m_row.err_eLOC0[eUnbiased]);
+  addColumn("err_eLOC1_ubs", m_row.err_eLOC1[eUnbiased]);
+  addColumn("err_ePHI_ubs", m_row.err_ePHI[eUnbiased]);
+  addColumn("err_eTHETA_ubs", m_row.err_eTHETA[eUnbiased]);
+  addColumn("err_eQOP_ubs", m_row.err_eQOP[eUnbiased]);
+  addColumn("err_eT_ubs", m_row.err_eT[eUnbiased]);
+  addColumn("pull_eLOC0_ubs", m_row.pull_eLOC0[eUnbiased]);
+  addColumn("pull_eLOC1_ubs", m_row.pull_eLOC1[eUnbiased]);
+  addColumn("pull_ePHI_ubs", m_row.pull_ePHI[eUnbiased]);
+  addColumn("pull_eTHETA_ubs", m_row.pull_eTHETA[eUnbiased]);
+  addColumn("pull_eQOP_ubs", m_row.pull_eQOP[eUnbiased]);
+  addColumn("pull_eT_ubs", m_row.pull_eT[eUnbiased]);
+  addColumn("g_x_ubs", m_row.x[eUnbiased]);
+  addColumn("g_y_ubs", m_row.y[eUnbiased]);
+  addColumn("g_z_ubs", m_row.z[eUnbiased]);
+  addColumn("px_ubs", m_row.px[eUnbiased]);
+  addColumn("py_ubs", m_row.py[eUnbiased]);
+  addColumn("pz_ubs", m_row.pz[eUnbiased]);
+  addColumn("eta_ubs", m_row.eta[eUnbiased]);
+  addColumn("pT_ubs", m_row.pT[eUnbiased]);
+
+  addColumn("chi2", m_row.chi2);
+
+  if (m_ntuple != nullptr) {
+    m_ntuple->open(m_cfg.treeName, *m_outputFile);
+  }
+
+  m_fillQueue = std::make_unique<SerialFillQueue<Row>>([this](Row& row) {
+    m_row = std::move(row);
+    if (m_ntuple != nullptr) {
+      m_ntuple->fill();
+    } else {
+      m_outputTree->Fill();
+    }
+  });
 }
 
 ActsExamples::RootTrackStatesWriter::~RootTrackStatesWriter() {
+  // stop filling before the file is closed
+  m_fillQueue.reset();
+  m_ntuple.reset();
   m_outputFile->Close();
 }
 
 ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::finalize() {
+  m_fillQueue->finish();
+
   m_outputFile->cd();
-  m_outputTree->Write();
+  if (m_ntuple != nullptr) {
+    m_ntuple->close();
+  } else {
+    m_outputTree->Write();
+  }
   m_outputFile->Close();
 
   ACTS_INFO("Wrote states of trajectories to tree '"
@@ -300,18 +338,19 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
   const auto& simHits = m_inputSimHits(ctx);
   const auto& hitSimHitsMap = m_inputMeasurementSimHitsMap(ctx);
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
-
-  // Get the event number
-  m_eventNr = ctx.eventNumber;
+  std::vector<Row> rows;
+  rows.reserve(tracks.size());
 
   for (const auto& track : tracks) {
-    m_trackNr = track.index();
+    Row& row = rows.emplace_back();
+
+    // Get the event number
+    row.eventNr = ctx.eventNumber;
+    row.trackNr = track.index();
 
     // Collect the track summary info
-    m_nMeasurements = track.nMeasurements();
-    m_nStates = track.nTrackStates();
+    row.nMeasurements = track.nMeasurements();
+    row.nStates = track.nTrackStates();
 
     // Get the majority truth particle to this track
     int truthQ = 1.;
@@ -335,7 +374,7 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
     }
 
     // Get the trackStates on the trajectory
-    m_nParams = {0, 0, 0, 0};
+    row.nParams = {0, 0, 0, 0};
 
     // particle barcodes for a given track state (size depends on a type of
     // digitization, for smeared digitization is not more than 1)
@@ -346,15 +385,15 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
 
       // get the geometry ID
       auto geoID = surface.geometryId();
-      m_volumeID.push_back(geoID.volume());
-      m_layerID.push_back(geoID.layer());
-      m_moduleID.push_back(geoID.sensitive());
+      row.volumeID.push_back(geoID.volume());
+      row.layerID.push_back(geoID.layer());
+      row.moduleID.push_back(geoID.sensitive());
 
       // get the path length
-      m_pathLength.push_back(state.pathLength());
+      row.pathLength.push_back(state.pathLength());
 
       // fill the chi2
-      m_chi2.push_back(state.chi2());
+      row.chi2.push_back(state.chi2());
 
       // get the truth track parameter at this track State
       float truthLOC0 = nan;
@@ -367,25 +406,25 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
       particleIds.clear();
 
       if (!state.hasUncalibratedSourceLink()) {
-        m_t_x.push_back(nan);
-        m_t_y.push_back(nan);
-        m_t_z.push_back(nan);
-        m_t_r.push_back(nan);
-        m_t_dx.push_back(nan);
-        m_t_dy.push_back(nan);
-        m_t_dz.push_back(nan);
-        m_t_eLOC0.push_back(nan);
-        m_t_eLOC1.push_back(nan);
-        m_t_ePHI.push_back(nan);
-        m_t_eTHETA.push_back(nan);
-        m_t_eQOP.push_back(nan);
-        m_t_eT.push_back(nan);
-
-        m_lx_hit.push_back(nan);
-        m_ly_hit.push_back(nan);
-        m_x_hit.push_back(nan);
-        m_y_hit.push_back(nan);
-        m_z_hit.push_back(nan);
+        row.t_x.push_back(nan);
+        row.t_y.push_back(nan);
+        row.t_z.push_back(nan);
+        row.t_r.push_back(nan);
+        row.t_dx.push_back(nan);
+        row.t_dy.push_back(nan);
+        row.t_dz.push_back(nan);
+        row.t_eLOC0.push_back(nan);
+        row.t_eLOC1.push_back(nan);
+        row.t_ePHI.push_back(nan);
+        row.t_eTHETA.push_back(nan);
+        row.t_eQOP.push_back(nan);
+        row.t_eT.push_back(nan);
+
+        row.lx_hit.push_back(nan);
+        row.ly_hit.push_back(nan);
+        row.x_hit.push_back(nan);
+        row.y_hit.push_back(nan);
+        row.z_hit.push_back(nan);
       } else {
         // get the truth hits corresponding to this trackState
         // Use average truth in the case of multiple contributing sim hits
@@ -414,13 +453,13 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
         }
 
         // fill the truth hit info
-        m_t_x.push_back(truthPos4[Acts::ePos0]);
-        m_t_y.push_back(truthPos4[Acts::ePos1]);
-        m_t_z.push_back(truthPos4[Acts::ePos2]);
-        m_t_r.push_back(perp(truthPos4.template segment<3>(Acts::ePos0)));
-        m_t_dx.push_back(truthUnitDir[Acts::eMom0]);
-        m_t_dy.push_back(truthUnitDir[Acts::eMom1]);
-        m_t_dz.push_back(truthUnitDir[Acts::eMom2]);
+        row.t_x.push_back(truthPos4[Acts::ePos0]);
+        row.t_y.push_back(truthPos4[Acts::ePos1]);
+        row.t_z.push_back(truthPos4[Acts::ePos2]);
+        row.t_r.push_back(perp(truthPos4.template segment<3>(Acts::ePos0)));
+        row.t_dx.push_back(truthUnitDir[Acts::eMom0]);
+        row.t_dy.push_back(truthUnitDir[Acts::eMom1]);
+        row.t_dz.push_back(truthUnitDir[Acts::eMom2]);
 
         // get the truth track parameter at this track State
         truthLOC0 = truthLocal[Acts::ePos0];
@@ -430,12 +469,12 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
         truthTHETA = theta(truthUnitDir);
 
         // fill the truth track parameter at this track State
-        m_t_eLOC0.push_back(truthLOC0);
-        m_t_eLOC1.push_back(truthLOC1);
-        m_t_ePHI.push_back(truthPHI);
-        m_t_eTHETA.push_back(truthTHETA);
-        m_t_eQOP.push_back(truthQOP);
-        m_t_eT.push_back(truthTIME);
+        row.t_eLOC0.push_back(truthLOC0);
+        row.t_eLOC1.push_back(truthLOC1);
+        row.t_ePHI.push_back(truthPHI);
+        row.t_eTHETA.push_back(truthTHETA);
+        row.t_eQOP.push_back(truthQOP);
+        row.t_eT.push_back(truthTIME);
 
         // expand the local measurements into the full bound space
         Acts::BoundVector meas = state.effectiveProjector().transpose() *
@@ -446,11 +485,11 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
             surface.localToGlobal(ctx.geoContext, local, truthUnitDir);
 
         // fill the measurement info
-        m_lx_hit.push_back(local[Acts::ePos0]);
-        m_ly_hit.push_back(local[Acts::ePos1]);
-        m_x_hit.push_back(global[Acts::ePos0]);
-        m_y_hit.push_back(global[Acts::ePos1]);
-        m_z_hit.push_back(global[Acts::ePos2]);
+        row.lx_hit.push_back(local[Acts::ePos0]);
+        row.ly_hit.push_back(local[Acts::ePos1]);
+        row.x_hit.push_back(global[Acts::ePos0]);
+        row.y_hit.push_back(global[Acts::ePos1]);
+        row.z_hit.push_back(global[Acts::ePos2]);
       }
 
       // lambda to get the fitted track parameters
@@ -523,97 +562,97 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
         // get the fitted track parameters
         auto trackParamsOpt = getTrackParams(ipar);
         // fill the track parameters status
-        m_hasParams[ipar].push_back(trackParamsOpt.has_value());
+        row.hasParams[ipar].push_back(trackParamsOpt.has_value());
 
         if (!trackParamsOpt) {
           if (ipar == ePredicted) {
             // push default values if no track parameters
-            m_res_x_hit.push_back(nan);
-            m_res_y_hit.push_back(nan);
-            m_err_x_hit.push_back(nan);
-            m_err_y_hit.push_back(nan);
-            m_pull_x_hit.push_back(nan);
-            m_pull_y_hit.push_back(nan);
-            m_dim_hit.push_back(0);
+            row.res_x_hit.push_back(nan);
+            row.res_y_hit.push_back(nan);
+            row.err_x_hit.push_back(nan);
+            row.err_y_hit.push_back(nan);
+            row.pull_x_hit.push_back(nan);
+            row.pull_y_hit.push_back(nan);
+            row.dim_hit.push_back(0);
           }
 
           // push default values if no track parameters
-          m_eLOC0[ipar].push_back(nan);
-          m_eLOC1[ipar].push_back(nan);
-          m_ePHI[ipar].push_back(nan);
-          m_eTHETA[ipar].push_back(nan);
-          m_eQOP[ipar].push_back(nan);
-          m_eT[ipar].push_back(nan);
-          m_res_eLOC0[ipar].push_back(nan);
-          m_res_eLOC1[ipar].push_back(nan);
-          m_res_ePHI[ipar].push_back(nan);
-          m_res_eTHETA[ipar].push_back(nan);
-          m_res_eQOP[ipar].push_back(nan);
-          m_res_eT[ipar].push_back(nan);
-          m_err_eLOC0[ipar].push_back(nan);
-          m_err_eLOC1[ipar].push_back(nan);
-          m_err_ePHI[ipar].push_back(nan);
-          m_err_eTHETA[ipar].push_back(nan);
-          m_err_eQOP[ipar].push_back(nan);
-          m_err_eT[ipar].push_back(nan);
-          m_pull_eLOC0[ipar].push_back(nan);
-          m_pull_eLOC1[ipar].push_back(nan);
-          m_pull_ePHI[ipar].push_back(nan);
-          m_pull_eTHETA[ipar].push_back(nan);
-          m_pull_eQOP[ipar].push_back(nan);
-          m_pull_eT[ipar].push_back(nan);
-          m_x[ipar].push_back(nan);
-          m_y[ipar].push_back(nan);
-          m_z[ipar].push_back(nan);
-          m_px[ipar].push_back(nan);
-          m_py[ipar].push_back(nan);
-          m_pz[ipar].push_back(nan);
-          m_pT[ipar].push_back(nan);
-          m_eta[ipar].push_back(nan);
+          row.eLOC0[ipar].push_back(nan);
+          row.eLOC1[ipar].push_back(nan);
+          row.ePHI[ipar].push_back(nan);
+          row.eTHETA[ipar].push_back(nan);
+          row.eQOP[ipar].push_back(nan);
+          row.eT[ipar].push_back(nan);
+          row.res_eLOC0[ipar].push_back(nan);
+          row.res_eLOC1[ipar].push_back(nan);
+          row.res_ePHI[ipar].push_back(nan);
+          row.res_eTHETA[ipar].push_back(nan);
+          row.res_eQOP[ipar].push_back(nan);
+          row.res_eT[ipar].push_back(nan);
+          row.err_eLOC0[ipar].push_back(nan);
+          row.err_eLOC1[ipar].push_back(nan);
+          row.err_ePHI[ipar].push_back(nan);
+          row.err_eTHETA[ipar].push_back(nan);
+          row.err_eQOP[ipar].push_back(nan);
+          row.err_eT[ipar].push_back(nan);
+          row.pull_eLOC0[ipar].push_back(nan);
+          row.pull_eLOC1[ipar].push_back(nan);
+          row.pull_ePHI[ipar].push_back(nan);
+          row.pull_eTHETA[ipar].push_back(nan);
+          row.pull_eQOP[ipar].push_back(nan);
+          row.pull_eT[ipar].push_back(nan);
+          row.x[ipar].push_back(nan);
+          row.y[ipar].push_back(nan);
+          row.z[ipar].push_back(nan);
+          row.px[ipar].push_back(nan);
+          row.py[ipar].push_back(nan);
+          row.pz[ipar].push_back(nan);
+          row.pT[ipar].push_back(nan);
+          row.eta[ipar].push_back(nan);
 
           continue;
         }
 
-        ++m_nParams[ipar];
+        ++row.nParams[ipar];
         const auto& [parameters, covariance] = *trackParamsOpt;
 
         // track parameters
-        m_eLOC0[ipar].push_back(parameters[Acts::eBoundLoc0]);
-        m_eLOC1[ipar].push_back(parameters[Acts::eBoundLoc1]);
-        m_ePHI[ipar].push_back(parameters[Acts::eBoundPhi]);
-        m_eTHETA[ipar].push_back(parameters[Acts::eBoundTheta]);
-        m_eQOP[ipar].push_back(parameters[Acts::eBoundQOverP]);
-        m_eT[ipar].push_back(parameters[Acts::eBoundTime]);
+        row.eLOC0[ipar].push_back(parameters[Acts::eBoundLoc0]);
+        row.eLOC1[ipar].push_back(parameters[Acts::eBoundLoc1]);
+        row.ePHI[ipar].push_back(parameters[Acts::eBoundPhi]);
+        row.eTHETA[ipar].push_back(parameters[Acts::eBoundTheta]);
+        row.eQOP[ipar].push_back(parameters[Acts::eBoundQOverP]);
+        row.eT[ipar].push_back(parameters[Acts::eBoundTime]);
 
         // track parameters error
         // MARK: fpeMaskBegin(FLTINV, 1, #2348)
-        m_err_eLOC0[ipar].push_back(
+        row.err_eLOC0[ipar].push_back(
             std::sqrt(covariance(Acts::eBoundLoc0, Acts::eBoundLoc0)));
-        m_err_eLOC1[ipar].push_back(
+        row.err_eLOC1[ipar].push_back(
             std::sqrt(covariance(Acts::eBoundLoc1, Acts::eBoundLoc1)));
-        m_err_ePHI[ipar].push_back(
+        row.err_ePHI[ipar].push_back(
             std::sqrt(covariance(Acts::eBoundPhi, Acts::eBoundPhi)));
-        m_err_eTHETA[ipar].push_back(
+        row.err_eTHETA[ipar].push_back(
             std::sqrt(covariance(Acts::eBoundTheta, Acts::eBoundTheta)));
-        m_err_eQOP[ipar].push_back(
+        row.err_eQOP[ipar].push_back(
             std::sqrt(covariance(Acts::eBoundQOverP, Acts::eBoundQOverP)));
-        m_err_eT[ipar].push_back(
+        row.err_eT[ipar].push_back(
             std::sqrt(covariance(Acts::eBoundTime, Acts::eBoundTime)));
         // MARK: fpeMaskEnd(FLTINV)
 
         // further track parameter info
         Acts::FreeVector freeParams =
             Acts::transformBoundToFreeParameters(surface, gctx, parameters);
-        m_x[ipar].push_back(freeParams[Acts::eFreePos0]);
-        m_y[ipar].push_back(freeParams[Acts::eFreePos1]);
-        m_z[ipar].push_back(freeParams[Acts::eFreePos2]);
+        row.x[ipar].push_back(freeParams[Acts::eFreePos0]);
+        row.y[ipar].push_back(freeParams[Acts::eFreePos1]);
+        row.z[ipar].push_back(freeParams[Acts::eFreePos2]);
         auto p = std::abs(1 / freeParams[Acts::eFreeQOverP]);
-        m_px[ipar].push_back(p * freeParams[Acts::eFreeDir0]);
-        m_py[ipar].push_back(p * freeParams[Acts::eFreeDir1]);
-        m_pz[ipar].push_back(p * freeParams[Acts::eFreeDir2]);
-        m_pT[ipar].push_back(p * std::hypot(freeParams[Acts::eFreeDir0],
+        row.px[ipar].push_back(p * freeParams[Acts::eFreeDir0]);
+        row.py[ipar].push_back(p * freeParams[Acts::eFreeDir1]);
+        row.pz[ipar].push_back(p * freeParams[Acts::eFreeDir2]);
+        row.pT[ipar].push_back(p * std::hypot(freeParams[Acts::eFreeDir0],
                                             freeParams[Acts::eFreeDir1]));
-        m_eta[ipar].push_back(
+        row.eta[ipar].push_back(
             Acts::VectorHelpers::eta(freeParams.segment<3>(Acts::eFreeDir0)));
 
         if (!state.hasUncalibratedSourceLink()) {
@@ -621,35 +660,35 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
         }
 
         // track parameters residual
-        m_res_eLOC0[ipar].push_back(parameters[Acts::eBoundLoc0] - truthLOC0);
-        m_res_eLOC1[ipar].push_back(parameters[Acts::eBoundLoc1] - truthLOC1);
+        row.res_eLOC0[ipar].push_back(parameters[Acts::eBoundLoc0] - truthLOC0);
+        row.res_eLOC1[ipar].push_back(parameters[Acts::eBoundLoc1] - truthLOC1);
         float resPhi = Acts::detail::difference_periodic<float>(
             parameters[Acts::eBoundPhi], truthPHI,
             static_cast<float>(2 * M_PI));
-        m_res_ePHI[ipar].push_back(resPhi);
-        m_res_eTHETA[ipar].push_back(parameters[Acts::eBoundTheta] -
+        row.res_ePHI[ipar].push_back(resPhi);
+        row.res_eTHETA[ipar].push_back(parameters[Acts::eBoundTheta] -
                                      truthTHETA);
-        m_res_eQOP[ipar].push_back(parameters[Acts::eBoundQOverP] - truthQOP);
-        m_res_eT[ipar].push_back(parameters[Acts::eBoundTime] - truthTIME);
+        row.res_eQOP[ipar].push_back(parameters[Acts::eBoundQOverP] - truthQOP);
+        row.res_eT[ipar].push_back(parameters[Acts::eBoundTime] - truthTIME);
 
         // track parameters pull
-        m_pull_eLOC0[ipar].push_back(
+        row.pull_eLOC0[ipar].push_back(
             (parameters[Acts::eBoundLoc0] - truthLOC0) /
             std::sqrt(covariance(Acts::eBoundLoc0, Acts::eBoundLoc0)));
-        m_pull_eLOC1[ipar].push_back(
+        row.pull_eLOC1[ipar].push_back(
             (parameters[Acts::eBoundLoc1] - truthLOC1) /
             std::sqrt(covariance(Acts::eBoundLoc1, Acts::eBoundLoc1)));
-        m_pull_ePHI[ipar].push_back(
+        row.pull_ePHI[ipar].push_back(
             resPhi / std::sqrt(covariance(Acts::eBoundPhi, Acts::eBoundPhi)));
-        m_pull_eTHETA[ipar].push_back(
+        row.pull_eTHETA[ipar].push_back(
             (parameters[Acts::eBoundTheta] - truthTHETA) /
             std::sqrt(covariance(Acts::eBoundTheta, Acts::eBoundTheta)));
-        m_pull_eQOP[ipar].push_back(
+        row.pull_eQOP[ipar].push_back(
             (parameters[Acts::eBoundQOverP] - truthQOP) /
             std::sqrt(covariance(Acts::eBoundQOverP, Acts::eBoundQOverP)));
         double sigmaTime =
             std::sqrt(covariance(Acts::eBoundTime, Acts::eBoundTime));
-        m_pull_eT[ipar].push_back(
+        row.pull_eT[ipar].push_back(
             sigmaTime == 0.0
                 ? nan
                 : (parameters[Acts::eBoundTime] - truthTIME) / sigmaTime);
@@ -664,106 +703,35 @@ ActsExamples::ProcessCode ActsExamples::RootTrackStatesWriter::writeT(
 
           res = state.effectiveCalibrated() - H * parameters;
 
-          m_res_x_hit.push_back(res[Acts::eBoundLoc0]);
-          m_err_x_hit.push_back(
+          row.res_x_hit.push_back(res[Acts::eBoundLoc0]);
+          row.err_x_hit.push_back(
               std::sqrt(V(Acts::eBoundLoc0, Acts::eBoundLoc0)));
-          m_pull_x_hit.push_back(
+          row.pull_x_hit.push_back(
               res[Acts::eBoundLoc0] /
               std::sqrt(resCov(Acts::eBoundLoc0, Acts::eBoundLoc0)));
 
           if (state.calibratedSize() >= 2) {
-            m_res_y_hit.push_back(res[Acts::eBoundLoc1]);
-            m_err_y_hit.push_back(
+            row.res_y_hit.push_back(res[Acts::eBoundLoc1]);
+            row.err_y_hit.push_back(
                 std::sqrt(V(Acts::eBoundLoc1, Acts::eBoundLoc1)));
-            m_pull_y_hit.push_back(
+            row.pull_y_hit.push_back(
                 res[Acts::eBoundLoc1] /
                 std::sqrt(resCov(Acts::eBoundLoc1, Acts::eBoundLoc1)));
           } else {
-            m_res_y_hit.push_back(nan);
-            m_err_y_hit.push_back(nan);
-            m_pull_y_hit.push_back(nan);
+            row.res_y_hit.push_back(nan);
+            row.err_y_hit.push_back(nan);
+            row.pull_y_hit.push_back(nan);
           }
 
-          m_dim_hit.push_back(state.calibratedSize());
+          row.dim_hit.push_back(state.calibratedSize());
         }
       }
-      m_particleId.push_back(std::move(particleIds));
+      row.particleId.push_back(std::move(particleIds));
     }
-
-    // fill the variables for one track to tree
-    m_outputTree->Fill();
-
-    // now reset
-    m_t_x.clear();
-    m_t_y.clear();
-    m_t_z.clear();
-    m_t_r.clear();
-    m_t_dx.clear();
-    m_t_dy.clear();
-    m_t_dz.clear();
-    m_t_eLOC0.clear();
-    m_t_eLOC1.clear();
-    m_t_ePHI.clear();
-    m_t_eTHETA.clear();
-    m_t_eQOP.clear();
-    m_t_eT.clear();
-    m_particleId.clear();
-
-    m_volumeID.clear();
-    m_layerID.clear();
-    m_moduleID.clear();
-    m_pathLength.clear();
-    m_lx_hit.clear();
-    m_ly_hit.clear();
-    m_x_hit.clear();
-    m_y_hit.clear();
-    m_z_hit.clear();
-    m_res_x_hit.clear();
-    m_res_y_hit.clear();
-    m_err_x_hit.clear();
-    m_err_y_hit.clear();
-    m_pull_x_hit.clear();
-    m_pull_y_hit.clear();
-    m_dim_hit.clear();
-
-    for (unsigned int ipar = 0; ipar < eSize; ++ipar) {
-      m_hasParams[ipar].clear();
-      m_eLOC0[ipar].clear();
-      m_eLOC1[ipar].clear();
-      m_ePHI[ipar].clear();
-      m_eTHETA[ipar].clear();
-      m_eQOP[ipar].clear();
-      m_eT[ipar].clear();
-      m_res_eLOC0[ipar].clear();
-      m_res_eLOC1[ipar].clear();
-      m_res_ePHI[ipar].clear();
-      m_res_eTHETA[ipar].clear();
-      m_res_eQOP[ipar].clear();
-      m_res_eT[ipar].clear();
-      m_err_eLOC0[ipar].clear();
-      m_err_eLOC1[ipar].clear();
-      m_err_ePHI[ipar].clear();
-      m_err_eTHETA[ipar].clear();
-      m_err_eQOP[ipar].clear();
-      m_err_eT[ipar].clear();
-      m_pull_eLOC0[ipar].clear();
-      m_pull_eLOC1[ipar].clear();
-      m_pull_ePHI[ipar].clear();
-      m_pull_eTHETA[ipar].clear();
-      m_pull_eQOP[ipar].clear();
-      m_pull_eT[ipar].clear();
-      m_x[ipar].clear();
-      m_y[ipar].clear();
-      m_z[ipar].clear();
-      m_px[ipar].clear();
-      m_py[ipar].clear();
-      m_pz[ipar].clear();
-      m_eta[ipar].clear();
-      m_pT[ipar].clear();
-    }
-
-    m_chi2.clear();
   }
 
+  // the tree is filled on the fill thread
+  m_fillQueue->push(std::move(rows));
+
   return ProcessCode::SUCCESS;
 }
@@ -16,6 +16,7 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Root/RootNTuple.hpp"
 #include "ActsExamples/Io/Root/RootUtility.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
 
@@ -31,8 +32,6 @@ RootTrackSummaryReader::RootTrackSummaryReader(
     : IReader(),
       m_logger{Acts::getDefaultLogger(name(), level)},
       m_cfg(config) {
-  m_inputChain = new TChain(m_cfg.treeName.c_str());
-
   if (m_cfg.filePath.empty()) {
     throw std::invalid_argument("Missing input filename");
   }
@@ -40,69 +39,110 @@ RootTrackSummaryReader::RootTrackSummaryReader(
   m_outputTrackParameters.initialize(m_cfg.outputTracks);
   m_outputParticles.initialize(m_cfg.outputParticles);
 
-  // Set the branches
-  m_inputChain->SetBranchAddress("event_nr", &m_eventNr);
-  m_inputChain->SetBranchAddress("multiTraj_nr", &m_multiTrajNr);
-  m_inputChain->SetBranchAddress("subTraj_nr", &m_subTrajNr);
-
-  // These info is not really stored in the event store, but still read in
-  m_inputChain->SetBranchAddress("nStates", &m_nStates);
-  m_inputChain->SetBranchAddress("nMeasurements", &m_nMeasurements);
-  m_inputChain->SetBranchAddress("nOutliers", &m_nOutliers);
-  m_inputChain->SetBranchAddress("nHoles", &m_nHoles);
-  m_inputChain->SetBranchAddress("chi2Sum", &m_chi2Sum);
-  m_inputChain->SetBranchAddress("NDF", &m_NDF);
-  m_inputChain->SetBranchAddress("measurementChi2", &m_measurementChi2);
-  m_inputChain->SetBranchAddress("outlierChi2", &m_outlierChi2);
-  m_inputChain->SetBranchAddress("measurementVolume", &m_measurementVolume);
-  m_inputChain->SetBranchAddress("measurementLayer", &m_measurementLayer);
-  m_inputChain->SetBranchAddress("outlierVolume", &m_outlierVolume);
-  m_inputChain->SetBranchAddress("outlierLayer", &m_outlierLayer);
-
-  m_inputChain->SetBranchAddress("majorityParticleId", &m_majorityParticleId);
-  m_inputChain->SetBranchAddress("nMajorityHits", &m_nMajorityHits);
-  m_inputChain->SetBranchAddress("t_charge", &m_t_charge);
-  m_inputChain->SetBranchAddress("t_time", &m_t_time);
-  m_inputChain->SetBranchAddress("t_vx", &m_t_vx);
-  m_inputChain->SetBranchAddress("t_vy", &m_t_vy);
-  m_inputChain->SetBranchAddress("t_vz", &m_t_vz);
-  m_inputChain->SetBranchAddress("t_px", &m_t_px);
-  m_inputChain->SetBranchAddress("t_py", &m_t_py);
-  m_inputChain->SetBranchAddress("t_pz", &m_t_pz);
-  m_inputChain->SetBranchAddress("t_theta", &m_t_theta);
-  m_inputChain->SetBranchAddress("t_phi", &m_t_phi);
-  m_inputChain->SetBranchAddress("t_eta", &m_t_eta);
-  m_inputChain->SetBranchAddress("t_pT", &m_t_pT);
-
-  m_inputChain->SetBranchAddress("hasFittedParams", &m_hasFittedParams);
-  m_inputChain->SetBranchAddress("eLOC0_fit", &m_eLOC0_fit);
-  m_inputChain->SetBranchAddress("eLOC1_fit", &m_eLOC1_fit);
-  m_inputChain->SetBranchAddress("ePHI_fit", &m_ePHI_fit);
-  m_inputChain->SetBranchAddress("eTHETA_fit", &m_eTHETA_fit);
-  m_inputChain->SetBranchAddress("eQOP_fit", &m_eQOP_fit);
-  m_inputChain->SetBranchAddress("eT_fit", &m_eT_fit);
-  m_inputChain->SetBranchAddress("err_eLOC0_fit", &m_err_eLOC0_fit);
-  m_inputChain->SetBranchAddress("err_eLOC1_fit", &m_err_eLOC1_fit);
-  m_inputChain->SetBranchAddress("err_ePHI_fit", &m_err_ePHI_fit);
-  m_inputChain->SetBranchAddress("err_eTHETA_fit", &m_err_eTHETA_fit);
-  m_inputChain->SetBranchAddress("err_eQOP_fit", &m_err_eQOP_fit);
-  m_inputChain->SetBranchAddress("err_eT_fit", &m_err_eT_fit);
-
-  auto path = m_cfg.filePath;
-
-  // add file to the input chain
-  m_inputChain->Add(path.c_str());
-  ACTS_DEBUG("Adding File " << path << " to tree '" << m_cfg.treeName << "'.");
-
-  m_events = m_inputChain->GetEntries();
-  ACTS_DEBUG("The full chain has " << m_events << " entries.");
-
-  // Sort the entry numbers of the events
-  {
+  if (m_cfg.readRNTuple) {
+    m_ntuple =
+        std::make_unique<RootNTupleInput>(m_cfg.treeName, m_cfg.filePath);
+
+    // Only the columns of the output collections are read
+    m_ntuple->addColumn("majorityParticleId", *m_majorityParticleId);
+    m_ntuple->addColumn("t_time", *m_t_time);
+    m_ntuple->addColumn("t_vx", *m_t_vx);
+    m_ntuple->addColumn("t_vy", *m_t_vy);
+    m_ntuple->addColumn("t_vz", *m_t_vz);
+    m_ntuple->addColumn("t_px", *m_t_px);
+    m_ntuple->addColumn("t_py", *m_t_py);
+    m_ntuple->addColumn("t_pz", *m_t_pz);
+
+    m_ntuple->addColumn("eLOC0_fit", *m_eLOC0_fit);
+    m_ntuple->addColumn("eLOC1_fit", *m_eLOC1_fit);
+    m_ntuple->addColumn("ePHI_fit", *m_ePHI_fit);
+    m_ntuple->addColumn("eTHETA_fit", *m_eTHETA_fit);
+    m_ntuple->addColumn("eQOP_fit", *m_eQOP_fit);
+    m_ntuple->addColumn("eT_fit", *m_eT_fit);
+    m_ntuple->addColumn("err_eLOC0_fit", *m_err_eLOC0_fit);
+    m_ntuple->addColumn("err_eLOC1_fit", *m_err_eLOC1_fit);
+    m_ntuple->addColumn("err_ePHI_fit", *m_err_ePHI_fit);
+    m_ntuple->addColumn("err_eTHETA_fit", *m_err_eTHETA_fit);
+    m_ntuple->addColumn("err_eQOP_fit", *m_err_eQOP_fit);
+    m_ntuple->addColumn("err_eT_fit", *m_err_eT_fit);
+
+    m_events = m_ntuple->entries();
+    ACTS_DEBUG("The RNTuple '" << m_cfg.treeName << "' in " << m_cfg.filePath
+                               << " has " << m_events << " entries.");
+
+    // Sort the entry numbers of the events
+    auto eventNrs = m_ntuple->readColumn<std::uint32_t>("event_nr");
     m_entryNumbers.resize(m_events);
-    m_inputChain->Draw("event_nr", "", "goff");
-    RootUtility::stableSort(m_inputChain->GetEntries(), m_inputChain->GetV1(),
+    RootUtility::stableSort(static_cast<long long>(m_events), eventNrs.data(),
                             m_entryNumbers.data(), false);
+  } else {
+    m_inputChain = new TChain(m_cfg.treeName.c_str());
+
+    // Set the branches
+    m_inputChain->SetBranchAddress("event_nr", &m_eventNr);
+    m_inputChain->SetBranchAddress("multiTraj_nr", &m_multiTrajNr);
+    m_inputChain->SetBranchAddress("subTraj_nr", &m_subTrajNr);
+
+    // These info is not really stored in the event store, but still read in
+    m_inputChain->SetBranchAddress("nStates", &m_nStates);
+    m_inputChain->SetBranchAddress("nMeasurements", &m_nMeasurements);
+    m_inputChain->SetBranchAddress("nOutliers", &m_nOutliers);
+    m_inputChain->SetBranchAddress("nHoles", &m_nHoles);
+    m_inputChain->SetBranchAddress("chi2Sum", &m_chi2Sum);
+    m_inputChain->SetBranchAddress("NDF", &m_NDF);
+    m_inputChain->SetBranchAddress("measurementChi2", &m_measurementChi2);
+    m_inputChain->SetBranchAddress("outlierChi2", &m_outlierChi2);
+    m_inputChain->SetBranchAddress("measurementVolume", &m_measurementVolume);
+    m_inputChain->SetBranchAddress("measurementLayer", &m_measurementLayer);
+    m_inputChain->SetBranchAddress("outlierVolume", &m_outlierVolume);
+    m_inputChain->SetBranchAddress("outlierLayer", &m_outlierLayer);
+
+    m_inputChain->SetBranchAddress("majorityParticleId", &m_majorityParticleId);
+    m_inputChain->SetBranchAddress("nMajorityHits", &m_nMajorityHits);
+    m_inputChain->SetBranchAddress("t_charge", &m_t_charge);
+    m_inputChain->SetBranchAddress("t_time", &m_t_time);
+    m_inputChain->SetBranchAddress("t_vx", &m_t_vx);
+    m_inputChain->SetBranchAddress("t_vy", &m_t_vy);
+    m_inputChain->SetBranchAddress("t_vz", &m_t_vz);
+    m_inputChain->SetBranchAddress("t_px", &m_t_px);
+    m_inputChain->SetBranchAddress("t_py", &m_t_py);
+    m_inputChain->SetBranchAddress("t_pz", &m_t_pz);
+    m_inputChain->SetBranchAddress("t_theta", &m_t_theta);
+    m_inputChain->SetBranchAddress("t_phi", &m_t_phi);
+    m_inputChain->SetBranchAddress("t_eta", &m_t_eta);
+    m_inputChain->SetBranchAddress("t_pT", &m_t_pT);
+
+    m_inputChain->SetBranchAddress("hasFittedParams", &m_hasFittedParams);
+    m_inputChain->SetBranchAddress("eLOC0_fit", &m_eLOC0_fit);
+    m_inputChain->SetBranchAddress("eLOC1_fit", &m_eLOC1_fit);
+    m_inputChain->SetBranchAddress("ePHI_fit", &m_ePHI_fit);
+    m_inputChain->SetBranchAddress("eTHETA_fit", &m_eTHETA_fit);
+    m_inputChain->SetBranchAddress("eQOP_fit", &m_eQOP_fit);
+    m_inputChain->SetBranchAddress("eT_fit", &m_eT_fit);
+    m_inputChain->SetBranchAddress("err_eLOC0_fit", &m_err_eLOC0_fit);
+    m_inputChain->SetBranchAddress("err_eLOC1_fit", &m_err_eLOC1_fit);
+    m_inputChain->SetBranchAddress("err_ePHI_fit", &m_err_ePHI_fit);
+    m_inputChain->SetBranchAddress("err_eTHETA_fit", &m_err_eTHETA_fit);
+    m_inputChain->SetBranchAddress("err_eQOP_fit", &m_err_eQOP_fit);
+    m_inputChain->SetBranchAddress("err_eT_fit", &m_err_eT_fit);
+
+    auto path = m_cfg.filePath;
+
+    // add file to the input chain
+    m_inputChain->Add(path.c_str());
+    ACTS_DEBUG("Adding File " << path << " to tree '" << m_cfg.treeName
+                              << "'.");
+
+    m_events = m_inputChain->GetEntries();
+    ACTS_DEBUG("The full chain has " << m_events << " entries.");
+
+    // Sort the entry numbers of the events
+    {
+      m_entryNumbers.resize(m_events);
+      m_inputChain->Draw("event_nr", "", "goff");
+      RootUtility::stableSort(m_inputChain->GetEntries(), m_inputChain->GetV1(),
+                              m_entryNumbers.data(), false);
+    }
   }
 }
 
@@ -159,7 +199,8 @@ ProcessCode RootTrackSummaryReader::read(const AlgorithmContext& context) {
   ACTS_DEBUG("Trying to read recorded tracks.");
 
   // read in the fitted track parameters and particles
-  if (m_inputChain != nullptr && context.eventNumber < m_events) {
+  if ((m_inputChain != nullptr || m_ntuple != nullptr) &&
+      context.eventNumber < m_events) {
     // lock the mutex
     std::lock_guard<std::mutex> lock(m_read_mutex);
     // now read
@@ -174,7 +215,11 @@ ProcessCode RootTrackSummaryReader::read(const AlgorithmContext& context) {
 
     // Read the correct entry
     auto entry = m_entryNumbers.at(context.eventNumber);
-    m_inputChain->GetEntry(entry);
+    if (m_ntuple != nullptr) {
+      m_ntuple->load(entry);
+    } else {
+      m_inputChain->GetEntry(entry);
+    }
     ACTS_INFO("Reading event: " << context.eventNumber
                                 << " stored as entry: " << entry);
 
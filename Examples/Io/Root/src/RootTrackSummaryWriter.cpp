@@ -22,6 +22,7 @@
 #include "ActsExamples/EventData/TruthMatching.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Io/Root/RootNTuple.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Particle.hpp"
@@ -36,6 +37,7 @@
 #include <optional>
 #include <ostream>
 #include <stdexcept>
+#include <utility>
 
 #include <TFile.h>
 #include <TTree.h>
@@ -47,6 +49,15 @@ using Acts::VectorHelpers::theta;
 
 namespace ActsExamples {
 
+template <typename T>
+void RootTrackSummaryWriter::addColumn(const std::string& name, T& buffer) {
+  if (m_ntuple != nullptr) {
+    m_ntuple->addColumn(name, buffer);
+  } else {
+    m_outputTree->Branch(name.c_str(), &buffer);
+  }
+}
+
 RootTrackSummaryWriter::RootTrackSummaryWriter(
     const RootTrackSummaryWriter::Config& config, Acts::Logging::Level level)
     : WriterT(config.inputTracks, "RootTrackSummaryWriter", level),
@@ -75,137 +86,163 @@ RootTrackSummaryWriter::RootTrackSummaryWriter(
     throw std::ios_base::failure("Could not open '" + path + "'");
   }
   m_outputFile->cd();
-  m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
-  if (m_outputTree == nullptr) {
-    throw std::bad_alloc();
+  if (m_cfg.writeRNTuple) {
+    m_ntuple = std::make_unique<RootNTupleOutput>();
+  } else {
+    m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
+    if (m_outputTree == nullptr) {
+      throw std::bad_alloc();
+    }
   }
 
   // I/O parameters
-  m_outputTree->Branch("event_nr", &m_eventNr);
-  m_outputTree->Branch("track_nr", &m_trackNr);
-
-  m_outputTree->Branch("nStates", &m_nStates);
-  m_outputTree->Branch("nMeasurements", &m_nMeasurements);
-  m_outputTree->Branch("nOutliers", &m_nOutliers);
-  m_outputTree->Branch("nHoles", &m_nHoles);
-  m_outputTree->Branch("nSharedHits", &m_nSharedHits);
-  m_outputTree->Branch("chi2Sum", &m_chi2Sum);
-  m_outputTree->Branch("NDF", &m_NDF);
-  m_outputTree->Branch("measurementChi2", &m_measurementChi2);
-  m_outputTree->Branch("outlierChi2", &m_outlierChi2);
-  m_outputTree->Branch("measurementVolume", &m_measurementVolume);
-  m_outputTree->Branch("measurementLayer", &m_measurementLayer);
-  m_outputTree->Branch("outlierVolume", &m_outlierVolume);
-  m_outputTree->Branch("outlierLayer", &m_outlierLayer);
-
-  m_outputTree->Branch("nMajorityHits", &m_nMajorityHits);
-  m_outputTree->Branch("majorityParticleId", &m_majorityParticleId);
-  m_outputTree->Branch("trackClassification", &m_trackClassification);
-  m_outputTree->Branch("t_charge", &m_t_charge);
-  m_outputTree->Branch("t_time", &m_t_time);
-  m_outputTree->Branch("t_vx", &m_t_vx);
-  m_outputTree->Branch("t_vy", &m_t_vy);
-  m_outputTree->Branch("t_vz", &m_t_vz);
-  m_outputTree->Branch("t_px", &m_t_px);
-  m_outputTree->Branch("t_py", &m_t_py);
-  m_outputTree->Branch("t_pz", &m_t_pz);
-  m_outputTree->Branch("t_theta", &m_t_theta);
-  m_outputTree->Branch("t_phi", &m_t_phi);
-  m_outputTree->Branch("t_eta", &m_t_eta);
-  m_outputTree->Branch("t_p", &m_t_p);
-  m_outputTree->Branch("t_pT", &m_t_pT);
-  m_outputTree->Branch("t_d0", &m_t_d0);
-  m_outputTree->Branch("t_z0", &m_t_z0);
-
-  m_outputTree->Branch("hasFittedParams", &m_hasFittedParams);
-  m_outputTree->Branch("eLOC0_fit", &m_eLOC0_fit);
-  m_outputTree->Branch("eLOC1_fit", &m_eLOC1_fit);
-  m_outputTree->Branch("ePHI_fit", &m_ePHI_fit);
-  m_outputTree->Branch("eTHETA_fit", &m_eTHETA_fit);
-  m_outputTree->Branch("eQOP_fit", &m_eQOP_fit);
-  m_outputTree->Branch("eT_fit", &m_eT_fit);
-  m_outputTree->Branch("err_eLOC0_fit", &m_err_eLOC0_fit);
-  m_outputTree->Branch("err_eLOC1_fit", &m_err_eLOC1_fit);
-  m_outputTree->Branch("err_ePHI_fit", &m_err_ePHI_fit);
-  m_outputTree->Branch("err_eTHETA_fit", &m_err_eTHETA_fit);
-  m_outputTree->Branch("err_eQOP_fit", &m_err_eQOP_fit);
-  m_outputTree->Branch("err_eT_fit", &m_err_eT_fit);
-  m_outputTree->Branch("res_eLOC0_fit", &m_res_eLOC0_fit);
-  m_outputTree->Branch("res_eLOC1_fit", &m_res_eLOC1_fit);
-  m_outputTree->Branch("res_ePHI_fit", &m_res_ePHI_fit);
-  m_outputTree->Branch("res_eTHETA_fit", &m_res_eTHETA_fit);
-  m_outputTree->Branch("res_eQOP_fit", &m_res_eQOP_fit);
-  m_outputTree->Branch("res_eT_fit", &m_res_eT_fit);
-  m_outputTree->Branch("pull_eLOC0_fit", &m_pull_eLOC0_fit);
-  m_outputTree->Branch("pull_eLOC1_fit", &m_pull_eLOC1_fit);
-  m_outputTree->Branch("pull_ePHI_fit", &m_pull_ePHI_fit);
-  m_outputTree->Branch("pull_eTHETA_fit", &m_pull_eTHETA_fit);
-  m_outputTree->Branch("pull_eQOP_fit", &m_pull_eQOP_fit);
-  m_outputTree->Branch("pull_eT_fit", &m_pull_eT_fit);
+  addColumn("event_nr", m_row.eventNr);
+  addColumn("track_nr", m_row.trackNr);
+
+  addColumn("nStates", m_row.nStates);
+  addColumn("nMeasurements", m_row.nMeasurements);
+  addColumn("nOutliers", m_row.nOutliers);
+  addColumn("nHoles", m_row.nHoles);
+  addColumn("nSharedHits", m_row.nSharedHits);
+  addColumn("chi2Sum", m_row.chi2Sum);
+  addColumn("NDF", m_row.NDF);
+  addColumn("measurementChi2", m_row.measurementChi2);
+  addColumn("outlierChi2", m_row.outlierChi2);
+  addColumn("measurementVolume", m_row.measurementVolume);
+  addColumn("measurementLayer", m_row.measurementLayer);
+  addColumn("outlierVolume", m_row.outlierVolume);
+  addColumn("outlierLayer", m_row.outlierLayer);
+
+  addColumn("nMajorityHits", m_row.nMajorityHits);
+  addColumn("majorityParticleId", m_row.majorityParticleId);
+  addColumn("trackClassification", m_row.trackClassification);
+  addColumn("t_charge", m_row.t_charge);
+  addColumn("t_time", m_row.t_time);
+  addColumn("t_vx", m_row.t_vx);
+  addColumn("t_vy", m_row.t_vy);
+  addColumn("t_vz", m_row.t_vz);
+  addColumn("t_px", m_row.t_px);
+  addColumn("t_py", m_row.t_py);
+  addColumn("t_pz", m_row.t_pz);
+  addColumn("t_theta", m_row.t_theta);
+  addColumn("t_phi", m_row.t_phi);
+  addColumn("t_eta", m_row.t_eta);
+  addColumn("t_p", m_row.t_p);
+  addColumn("t_pT", m_row.t_pT);
+  addColumn("t_d0", m_row.t_d0);
+  addColumn("t_z0", m_row.t_z0);
+
+  addColumn("hasFittedParams", m_row.hasFittedParams);
+  addColumn("eLOC0_fit", m_row.eLOC0_fit);
+  addColumn("eLOC1_fit", m_row.eLOC1_fit);
+  addColumn("ePHI_fit", m_row.ePHI_fit);
+  addColumn("eTHETA_fit", m_row.eTHETA_fit);
+  addColumn("eQOP_fit", m_row.eQOP_fit);
+  addColumn("eT_fit", m_row.eT_fit);
+  addColumn("err_eLOC0_fit", m_row.err_eLOC0_fit);
+  addColumn("err_eLOC1_fit", m_row.err_eLOC1_fit);
+  addColumn("err_ePHI_fit", m_row.err_ePHI_fit);
+  addColumn("err_eTHETA_fit", m_row.err_eTHETA_fit);
+  addColumn("err_eQOP_fit", m_row.err_eQOP_fit);
+  addColumn("err_eT_fit", m_row.err_eT_fit);
+  addColumn("res_eLOC0_fit", m_row.res_eLOC0_fit);
+  addColumn("res_eLOC1_fit", m_row.res_eLOC1_fit);
+  addColumn("res_ePHI_fit", m_row.res_ePHI_fit);
+  addColumn("res_eTHETA_fit", m_row.res_eTHETA_fit);
+  addColumn("res_eQOP_fit", m_row.res_eQOP_fit);
+  addColumn("res_eT_fit", m_row.res_eT_fit);
+  addColumn("pull_eLOC0_fit", m_row.pull_eLOC0_fit);
+  addColumn("pull_eLOC1_fit", m_row.pull_eLOC1_fit);
+  addColumn("pull_ePHI_fit", m_row.pull_ePHI_fit);
+  addColumn("pull_eTHETA_fit", m_row.pull_eTHETA_fit);
+  addColumn("pull_eQOP_fit", m_row.pull_eQOP_fit);
+  addColumn("pull_eT_fit", m_row.pull_eT_fit);
 
   if (m_cfg.writeGsfSpecific) {
-    m_outputTree->Branch("max_material_fwd", &m_gsf_max_material_fwd);
-    m_outputTree->Branch("sum_material_fwd", &m_gsf_sum_material_fwd);
+    addColumn("max_material_fwd", m_row.gsf_max_material_fwd);
+    addColumn("sum_material_fwd", m_row.gsf_sum_material_fwd);
   }
 
   if (m_cfg.writeCovMat) {
     // create one branch for every entry of covariance matrix
     // one block for every row of the matrix, every entry gets own branch
-    m_outputTree->Branch("cov_eLOC0_eLOC0", &m_cov_eLOC0_eLOC0);
-    m_outputTree->Branch("cov_eLOC0_eLOC1", &m_cov_eLOC0_eLOC1);
-    m_outputTree->Branch("cov_eLOC0_ePHI", &m_cov_eLOC0_ePHI);
-    m_outputTree->Branch("cov_eLOC0_eTHETA", &m_cov_eLOC0_eTHETA);
-    m_outputTree->Branch("cov_eLOC0_eQOP", &m_cov_eLOC0_eQOP);
-    m_outputTree->Branch("cov_eLOC0_eT", &m_cov_eLOC0_eT);
-
-    m_outputTree->Branch("cov_eLOC1_eLOC0", &m_cov_eLOC1_eLOC0);
-    m_outputTree->Branch("cov_eLOC1_eLOC1", &m_cov_eLOC1_eLOC1);
-    m_outputTree->Branch("cov_eLOC1_ePHI", &m_cov_eLOC1_ePHI);
-    m_outputTree->Branch("cov_eLOC1_eTHETA", &m_cov_eLOC1_eTHETA);
-    m_outputTree->Branch("cov_eLOC1_eQOP", &m_cov_eLOC1_eQOP);
-    m_outputTree->Branch("cov_eLOC1_eT", &m_cov_eLOC1_eT);
-
-    m_outputTree->Branch("cov_ePHI_eLOC0", &m_cov_ePHI_eLOC0);
-    m_outputTree->Branch("cov_ePHI_eLOC1", &m_cov_ePHI_eLOC1);
-    m_outputTree->Branch("cov_ePHI_ePHI", &m_cov_ePHI_ePHI);
-    m_outputTree->Branch("cov_ePHI_eTHETA", &m_cov_ePHI_eTHETA);
-    m_outputTree->Branch("cov_ePHI_eQOP", &m_cov_ePHI_eQOP);
-    m_outputTree->Branch("cov_ePHI_eT", &m_cov_ePHI_eT);
-
-    m_outputTree->Branch("cov_eTHETA_eLOC0", &m_cov_eTHETA_eLOC0);
-    m_outputTree->Branch("cov_eTHETA_eLOC1", &m_cov_eTHETA_eLOC1);
-    m_outputTree->Branch("cov_eTHETA_ePHI", &m_cov_eTHETA_ePHI);
-    m_outputTree->Branch("cov_eTHETA_eTHETA", &m_cov_eTHETA_eTHETA);
-    m_outputTree->Branch("cov_eTHETA_eQOP", &m_cov_eTHETA_eQOP);
-    m_outputTree->Branch("cov_eTHETA_eT", &m_cov_eTHETA_eT);
-
-    m_outputTree->Branch("cov_eQOP_eLOC0", &m_cov_eQOP_eLOC0);
-    m_outputTree->Branch("cov_eQOP_eLOC1", &m_cov_eQOP_eLOC1);
-    m_outputTree->Branch("cov_eQOP_ePHI", &m_cov_eQOP_ePHI);
-    m_outputTree->Branch("cov_eQOP_eTHETA", &m_cov_eQOP_eTHETA);
-    m_outputTree->Branch("cov_eQOP_eQOP", &m_cov_eQOP_eQOP);
-    m_outputTree->Branch("cov_eQOP_eT", &m_cov_eQOP_eT);
-
-    m_outputTree->Branch("cov_eT_eLOC0", &m_cov_eT_eLOC0);
-    m_outputTree->Branch("cov_eT_eLOC1", &m_cov_eT_eLOC1);
-    m_outputTree->Branch("cov_eT_ePHI", &m_cov_eT_ePHI);
-    m_outputTree->Branch("cov_eT_eTHETA", &m_cov_eT_eTHETA);
-    m_outputTree->Branch("cov_eT_eQOP", &m_cov_eT_eQOP);
-    m_outputTree->Branch("cov_eT_eT", &m_cov_eT_eT);
+    addColumn("cov_eLOC0_eLOC0", m_row.cov_eLOC0_eLOC0);
+    addColumn("cov_eLOC0_eLOC1", m_row.cov_eLOC0_eLOC1);
+    addColumn("cov_eLOC0_ePHI", m_row.cov_eLOC0_ePHI);
+    addColumn("cov_eLOC0_eTHETA", m_row.cov_eLOC0_eTHETA);
+    addColumn("cov_eLOC0_eQOP", m_row.cov_eLOC0_eQOP);
+    addColumn("cov_eLOC0_eT", m_row.cov_eLOC0_eT);
+
+    addColumn("cov_eLOC1_eLOC0", m_row.cov_eLOC1_eLOC0);
+    addColumn("cov_eLOC1_eLOC1", m_row.cov_eLOC1_eLOC1);
+    addColumn("cov_eLOC1_ePHI", m_row.cov_eLOC1_ePHI);
+    addColumn("cov_eLOC1_eTHETA", m_row.cov_eLOC1_eTHETA);
+    addColumn("cov_eLOC1_eQOP", m_row.cov_eLOC1_eQOP);
+    addColumn("cov_eLOC1_eT", m_row.cov_eLOC1_eT);
+
+    addColumn("cov_ePHI_eLOC0", m_row.cov_ePHI_eLOC0);
+    addColumn("cov_ePHI_eLOC1", m_row.cov_ePHI_eLOC1);
+    addColumn("cov_ePHI_ePHI", m_row.cov_ePHI_ePHI);
+    addColumn("cov_ePHI_eTHETA", m_row.cov_ePHI_eTHETA);
+    addColumn("cov_ePHI_eQOP", m_row.cov_ePHI_eQOP);
+    addColumn("cov_ePHI_eT", m_row.cov_ePHI_eT);
+
+    addColumn("cov_eTHETA_eLOC0", m_row.cov_eTHETA_eLOC0);
+    addColumn("cov_eTHETA_eLOC1", m_row.cov_eTHETA_eLOC1);
+    addColumn("cov_eTHETA_ePHI", m_row.cov_eTHETA_ePHI);
+    addColumn("cov_eTHETA_eTHETA", m_row.cov_eTHETA_eTHETA);
+    addColumn("cov_eTHETA_eQOP", m_row.cov_eTHETA_eQOP);
+    addColumn("cov_eTHETA_eT", m_row.cov_eTHETA_eT);
+
+    addColumn("cov_eQOP_eLOC0", m_row.cov_eQOP_eLOC0);
+    addColumn("cov_eQOP_eLOC1", m_row.cov_eQOP_eLOC1);
+    addColumn("cov_eQOP_ePHI", m_row.cov_eQOP_ePHI);
+    addColumn("cov_eQOP_eTHETA", m_row.cov_eQOP_eTHETA);
+    addColumn("cov_eQOP_eQOP", m_row.cov_eQOP_eQOP);
+    addColumn("cov_eQOP_eT", m_row.cov_eQOP_eT);
+
+    addColumn("cov_eT_eLOC0", m_row.cov_eT_eLOC0);
+    addColumn("cov_eT_eLOC1", m_row.cov_eT_eLOC1);
+    addColumn("cov_eT_ePHI", m_row.cov_eT_ePHI);
+    addColumn("cov_eT_eTHETA", m_row.cov_eT_eTHETA);
+    addColumn("cov_eT_eQOP", m_row.cov_eT_eQOP);
+    addColumn("cov_eT_eT", m_row.cov_eT_eT);
   }
 
   if (m_cfg.writeGx2fSpecific) {
-    m_outputTree->Branch("nUpdatesGx2f", &m_nUpdatesGx2f);
+    addColumn("nUpdatesGx2f", m_row.nUpdatesGx2f);
   }
+
+  if (m_ntuple != nullptr) {
+    m_ntuple->open(m_cfg.treeName, *m_outputFile);
+  }
+
+  m_fillQueue = std::make_unique<SerialFillQueue<Row>>([this](Row& row) {
+    m_row = std::move(row);
+    if (m_ntuple != nullptr) {
+      m_ntuple->fill();
+    } else {
+      m_outputTree->Fill();
+    }
+  });
 }
 
 RootTrackSummaryWriter::~RootTrackSummaryWriter() {
+  // stop filling before the file is closed
+  m_fillQueue.reset();
+  m_ntuple.reset();
   m_outputFile->Close();
 }
 
 ProcessCode RootTrackSummaryWriter::finalize() {
+  m_fillQueue->finish();
+
   m_outputFile->cd();
-  m_outputTree->Write();
+  if (m_ntuple != nullptr) {
+    m_ntuple->close();
+  } else {
+    m_outputTree->Write();
+  }
   m_outputFile->Close();
 
   if (m_cfg.writeCovMat) {
@@ -226,23 +263,23 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
   // For each particle within a track, how many hits did it contribute
   std::vector<ParticleHitCount> particleHitCounts;
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  std::vector<Row> rows;
+  Row& row = rows.emplace_back();
 
   // Get the event number
-  m_eventNr = ctx.eventNumber;
+  row.eventNr = ctx.eventNumber;
 
   for (const auto& track : tracks) {
-    m_trackNr.push_back(track.index());
+    row.trackNr.push_back(track.index());
 
     // Collect the trajectory summary info
-    m_nStates.push_back(track.nTrackStates());
-    m_nMeasurements.push_back(track.nMeasurements());
-    m_nOutliers.push_back(track.nOutliers());
-    m_nHoles.push_back(track.nHoles());
-    m_nSharedHits.push_back(track.nSharedHits());
-    m_chi2Sum.push_back(track.chi2());
-    m_NDF.push_back(track.nDoF());
+    row.nStates.push_back(track.nTrackStates());
+    row.nMeasurements.push_back(track.nMeasurements());
+    row.nOutliers.push_back(track.nOutliers());
+    row.nHoles.push_back(track.nHoles());
+    row.nSharedHits.push_back(track.nSharedHits());
+    row.chi2Sum.push_back(track.chi2());
+    row.NDF.push_back(track.nDoF());
     {
       std::vector<double> measurementChi2;
       std::vector<std::uint32_t> measurementVolume;
@@ -267,12 +304,12 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
       }
       // IDs are stored as double (as the vector of vector of int is not known
       // to ROOT)
-      m_measurementChi2.push_back(std::move(measurementChi2));
-      m_measurementVolume.push_back(std::move(measurementVolume));
-      m_measurementLayer.push_back(std::move(measurementLayer));
-      m_outlierChi2.push_back(std::move(outlierChi2));
-      m_outlierVolume.push_back(std::move(outlierVolume));
-      m_outlierLayer.push_back(std::move(outlierLayer));
+      row.measurementChi2.push_back(std::move(measurementChi2));
+      row.measurementVolume.push_back(std::move(measurementVolume));
+      row.measurementLayer.push_back(std::move(measurementLayer));
+      row.outlierChi2.push_back(std::move(outlierChi2));
+      row.outlierVolume.push_back(std::move(outlierVolume));
+      row.outlierLayer.push_back(std::move(outlierLayer));
     }
 
     // Initialize the truth particle info
@@ -369,24 +406,24 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
 
     // Push the corresponding truth particle info for the track.
     // Always push back even if majority particle not found
-    m_majorityParticleId.push_back(majorityParticleId.value());
-    m_trackClassification.push_back(static_cast<int>(trackClassification));
-    m_nMajorityHits.push_back(nMajorityHits);
-    m_t_charge.push_back(t_charge);
-    m_t_time.push_back(t_time);
-    m_t_vx.push_back(t_vx);
-    m_t_vy.push_back(t_vy);
-    m_t_vz.push_back(t_vz);
-    m_t_px.push_back(t_px);
-    m_t_py.push_back(t_py);
-    m_t_pz.push_back(t_pz);
-    m_t_theta.push_back(t_theta);
-    m_t_phi.push_back(t_phi);
-    m_t_eta.push_back(t_eta);
-    m_t_p.push_back(t_p);
-    m_t_pT.push_back(t_pT);
-    m_t_d0.push_back(t_d0);
-    m_t_z0.push_back(t_z0);
+    row.majorityParticleId.push_back(majorityParticleId.value());
+    row.trackClassification.push_back(static_cast<int>(trackClassification));
+    row.nMajorityHits.push_back(nMajorityHits);
+    row.t_charge.push_back(t_charge);
+    row.t_time.push_back(t_time);
+    row.t_vx.push_back(t_vx);
+    row.t_vy.push_back(t_vy);
+    row.t_vz.push_back(t_vz);
+    row.t_px.push_back(t_px);
+    row.t_py.push_back(t_py);
+    row.t_pz.push_back(t_pz);
+    row.t_theta.push_back(t_theta);
+    row.t_phi.push_back(t_phi);
+    row.t_eta.push_back(t_eta);
+    row.t_p.push_back(t_p);
+    row.t_pT.push_back(t_pT);
+    row.t_d0.push_back(t_d0);
+    row.t_z0.push_back(t_z0);
 
     // Initialize the fitted track parameters info
     std::array<float, Acts::eBoundSize> param = {NaNfloat, NaNfloat, NaNfloat,
@@ -430,97 +467,97 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
 
     // Push the fitted track parameters.
     // Always push back even if no fitted track parameters
-    m_eLOC0_fit.push_back(param[Acts::eBoundLoc0]);
-    m_eLOC1_fit.push_back(param[Acts::eBoundLoc1]);
-    m_ePHI_fit.push_back(param[Acts::eBoundPhi]);
-    m_eTHETA_fit.push_back(param[Acts::eBoundTheta]);
-    m_eQOP_fit.push_back(param[Acts::eBoundQOverP]);
-    m_eT_fit.push_back(param[Acts::eBoundTime]);
-
-    m_res_eLOC0_fit.push_back(res[Acts::eBoundLoc0]);
-    m_res_eLOC1_fit.push_back(res[Acts::eBoundLoc1]);
-    m_res_ePHI_fit.push_back(res[Acts::eBoundPhi]);
-    m_res_eTHETA_fit.push_back(res[Acts::eBoundTheta]);
-    m_res_eQOP_fit.push_back(res[Acts::eBoundQOverP]);
-    m_res_eT_fit.push_back(res[Acts::eBoundTime]);
-
-    m_err_eLOC0_fit.push_back(error[Acts::eBoundLoc0]);
-    m_err_eLOC1_fit.push_back(error[Acts::eBoundLoc1]);
-    m_err_ePHI_fit.push_back(error[Acts::eBoundPhi]);
-    m_err_eTHETA_fit.push_back(error[Acts::eBoundTheta]);
-    m_err_eQOP_fit.push_back(error[Acts::eBoundQOverP]);
-    m_err_eT_fit.push_back(error[Acts::eBoundTime]);
-
-    m_pull_eLOC0_fit.push_back(pull[Acts::eBoundLoc0]);
-    m_pull_eLOC1_fit.push_back(pull[Acts::eBoundLoc1]);
-    m_pull_ePHI_fit.push_back(pull[Acts::eBoundPhi]);
-    m_pull_eTHETA_fit.push_back(pull[Acts::eBoundTheta]);
-    m_pull_eQOP_fit.push_back(pull[Acts::eBoundQOverP]);
-    m_pull_eT_fit.push_back(pull[Acts::eBoundTime]);
-
-    m_hasFittedParams.push_back(hasFittedParams);
+    row.eLOC0_fit.push_back(param[Acts::eBoundLoc0]);
+    row.eLOC1_fit.push_back(param[Acts::eBoundLoc1]);
+    row.ePHI_fit.push_back(param[Acts::eBoundPhi]);
+    row.eTHETA_fit.push_back(param[Acts::eBoundTheta]);
+    row.eQOP_fit.push_back(param[Acts::eBoundQOverP]);
+    row.eT_fit.push_back(param[Acts::eBoundTime]);
+
+    row.res_eLOC0_fit.push_back(res[Acts::eBoundLoc0]);
+    row.res_eLOC1_fit.push_back(res[Acts::eBoundLoc1]);
+    row.res_ePHI_fit.push_back(res[Acts::eBoundPhi]);
+    row.res_eTHETA_fit.push_back(res[Acts::eBoundTheta]);
+    row.res_eQOP_fit.push_back(res[Acts::eBoundQOverP]);
+    row.res_eT_fit.push_back(res[Acts::eBoundTime]);
+
+    row.err_eLOC0_fit.push_back(error[Acts::eBoundLoc0]);
+    row.err_eLOC1_fit.push_back(error[Acts::eBoundLoc1]);
+    row.err_ePHI_fit.push_back(error[Acts::eBoundPhi]);
+    row.err_eTHETA_fit.push_back(error[Acts::eBoundTheta]);
+    row.err_eQOP_fit.push_back(error[Acts::eBoundQOverP]);
+    row.err_eT_fit.push_back(error[Acts::eBoundTime]);
+
+    row.pull_eLOC0_fit.push_back(pull[Acts::eBoundLoc0]);
+    row.pull_eLOC1_fit.push_back(pull[Acts::eBoundLoc1]);
+    row.pull_ePHI_fit.push_back(pull[Acts::eBoundPhi]);
+    row.pull_eTHETA_fit.push_back(pull[Acts::eBoundTheta]);
+    row.pull_eQOP_fit.push_back(pull[Acts::eBoundQOverP]);
+    row.pull_eT_fit.push_back(pull[Acts::eBoundTime]);
+
+    row.hasFittedParams.push_back(hasFittedParams);
 
     if (m_cfg.writeGsfSpecific) {
       using namespace Acts::GsfConstants;
       if (tracks.hasColumn(Acts::hashString(kFwdMaxMaterialXOverX0))) {
-        m_gsf_max_material_fwd.push_back(
+        row.gsf_max_material_fwd.push_back(
             track.template component<double>(kFwdMaxMaterialXOverX0));
       } else {
-        m_gsf_max_material_fwd.push_back(NaNfloat);
+        row.gsf_max_material_fwd.push_back(NaNfloat);
       }
 
       if (tracks.hasColumn(Acts::hashString(kFwdSumMaterialXOverX0))) {
-        m_gsf_sum_material_fwd.push_back(
+        row.gsf_sum_material_fwd.push_back(
             track.template component<double>(kFwdSumMaterialXOverX0));
       } else {
-        m_gsf_sum_material_fwd.push_back(NaNfloat);
+        row.gsf_sum_material_fwd.push_back(NaNfloat);
       }
     }
 
     if (m_cfg.writeCovMat) {
       // write all entries of covariance matrix to output file
       // one branch for every entry of the matrix.
-      m_cov_eLOC0_eLOC0.push_back(getCov(0, 0));
-      m_cov_eLOC0_eLOC1.push_back(getCov(0, 1));
-      m_cov_eLOC0_ePHI.push_back(getCov(0, 2));
-      m_cov_eLOC0_eTHETA.push_back(getCov(0, 3));
-      m_cov_eLOC0_eQOP.push_back(getCov(0, 4));
-      m_cov_eLOC0_eT.push_back(getCov(0, 5));
-
-      m_cov_eLOC1_eLOC0.push_back(getCov(1, 0));
-      m_cov_eLOC1_eLOC1.push_back(getCov(1, 1));
-      m_cov_eLOC1_ePHI.push_back(getCov(1, 2));
-      m_cov_eLOC1_eTHETA.push_back(getCov(1, 3));
-      m_cov_eLOC1_eQOP.push_back(getCov(1, 4));
-      m_cov_eLOC1_eT.push_back(getCov(1, 5));
-
-      m_cov_ePHI_eLOC0.push_back(getCov(2, 0));
-      m_cov_ePHI_eLOC1.push_back(getCov(2, 1));
-      m_cov_ePHI_ePHI.push_back(getCov(2, 2));
-      m_cov_ePHI_eTHETA.push_back(getCov(2, 3));
-      m_cov_ePHI_eQOP.push_back(getCov(2, 4));
-      m_cov_ePHI_eT.push_back(getCov(2, 5));
-
-      m_cov_eTHETA_eLOC0.push_back(getCov(3, 0));
-      m_cov_eTHETA_eLOC1.push_back(getCov(3, 1));
-      m_cov_eTHETA_ePHI.push_back(getCov(3, 2));
-      m_cov_eTHETA_eTHETA.push_back(getCov(3, 3));
-      m_cov_eTHETA_eQOP.push_back(getCov(3, 4));
-      m_cov_eTHETA_eT.push_back(getCov(3, 5));
-
-      m_cov_eQOP_eLOC0.push_back(getCov(4, 0));
-      m_cov_eQOP_eLOC1.push_back(getCov(4, 1));
-      m_cov_eQOP_ePHI.push_back(getCov(4, 2));
-      m_cov_eQOP_eTHETA.push_back(getCov(4, 3));
-      m_cov_eQOP_eQOP.push_back(getCov(4, 4));
-      m_cov_eQOP_eT.push_back(getCov(4, 5));
-
-      m_cov_eT_eLOC0.push_back(getCov(5, 0));
-      m_cov_eT_eLOC1.push_back(getCov(5, 1));
-      m_cov_eT_ePHI.push_back(getCov(5, 2));
-      m_cov_eT_eTHETA.push_back(getCov(5, 3));
-      m_cov_eT_eQOP.push_back(getCov(5, 4));
-      m_cov_eT_eT.push_back(getCov(5, 5));
+      row.cov_eLOC0_eLOC0.push_back(getCov(0, 0));
+      row.cov_eLOC0_eLOC1.push_back(getCov(0, 1));
+      row.cov_eLOC0_ePHI.push_back(getCov(0, 2));
+      row.cov_eLOC0_eTHETA.push_back(getCov(0, 3));
+      row.cov_eLOC0_eQOP.push_back(getCov(0, 4));
+      row.cov_eLOC0_eT.push_back(getCov(0, 5));
+
+      row.cov_eLOC1_eLOC0.push_back(getCov(1, 0));
+      row.cov_eLOC1_eLOC1.push_back(getCov(1, 1));
+      row.cov_eLOC1_ePHI.push_back(getCov(1, 2));
+      row.cov_eLOC1_eTHETA.push_back(getCov(1, 3));
+      row.cov_eLOC1_eQOP.push_back(getCov(1, 4));
+      row.cov_eLOC1_eT.push_back(getCov(1, 5));
+
+      row.cov_ePHI_eLOC0.push_back(getCov(2, 0));
+      row.cov_ePHI_eLOC1.push_back(getCov(2, 1));
+      row.cov_ePHI_ePHI.push_back(getCov(2, 2));
+      row.cov_ePHI_eTHETA.push_back(getCov(2, 3));
+      row.cov_ePHI_eQOP.push_back(getCov(2, 4));
+      row.cov_ePHI_eT.push_back(getCov(2, 5));
+
+      row.cov_eTHETA_eLOC0.push_back(getCov(3, 0));
+      row.cov_eTHETA_eLOC1.push_back(getCov(3, 1));
+      row.cov_eTHETA_ePHI.push_back(getCov(3, 2));
+      row.cov_eTHETA_eTHETA.push_back(getCov(3, 3));
+      row.cov_eTHETA_eQOP.push_back(getCov(3, 4));
+      row.cov_eTHETA_eT.push_back(getCov(3, 5));
+
+      row.cov_eQOP_eLOC0.push_back(getCov(4, 0));
+      row.cov_eQOP_eLOC1.push_back(getCov(4, 1));
+      row.cov_eQOP_ePHI.push_back(getCov(4, 2));
+      row.cov_eQOP_eTHETA.push_back(getCov(4, 3));
+      row.cov_eQOP_eQOP.push_back(getCov(4, 4));
+      row.cov_eQOP_eT.push_back(getCov(4, 5));
+
+      row.cov_eT_eLOC0.push_back(getCov(5, 0));
+      row.cov_eT_eLOC1.push_back(getCov(5, 1));
+      row.cov_eT_ePHI.push_back(getCov(5, 2));
+      row.cov_eT_eTHETA.push_back(getCov(5, 3));
+      row.cov_eT_eQOP.push_back(getCov(5, 4));
+      row.cov_eT_eT.push_back(getCov(5, 5));
     }
 
     if (m_cfg.writeGx2fSpecific) {
@@ -528,124 +565,15 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
         int nUpdate = static_cast<int>(
             track.template component<std::size_t,
                                      Acts::hashString("Gx2fnUpdateColumn")>());
-        m_nUpdatesGx2f.push_back(nUpdate);
+        row.nUpdatesGx2f.push_back(nUpdate);
       } else {
-        m_nUpdatesGx2f.push_back(-1);
+        row.nUpdatesGx2f.push_back(-1);
       }
     }
   }
 
-  // fill the variables
-  m_outputTree->Fill();
-
-  m_trackNr.clear();
-  m_nStates.clear();
-  m_nMeasurements.clear();
-  m_nOutliers.clear();
-  m_nHoles.clear();
-  m_nSharedHits.clear();
-  m_chi2Sum.clear();
-  m_NDF.clear();
-  m_measurementChi2.clear();
-  m_outlierChi2.clear();
-  m_measurementVolume.clear();
-  m_measurementLayer.clear();
-  m_outlierVolume.clear();
-  m_outlierLayer.clear();
-
-  m_nMajorityHits.clear();
-  m_majorityParticleId.clear();
-  m_trackClassification.clear();
-  m_t_charge.clear();
-  m_t_time.clear();
-  m_t_vx.clear();
-  m_t_vy.clear();
-  m_t_vz.clear();
-  m_t_px.clear();
-  m_t_py.clear();
-  m_t_pz.clear();
-  m_t_theta.clear();
-  m_t_phi.clear();
-  m_t_p.clear();
-  m_t_pT.clear();
-  m_t_eta.clear();
-  m_t_d0.clear();
-  m_t_z0.clear();
-
-  m_hasFittedParams.clear();
-  m_eLOC0_fit.clear();
-  m_eLOC1_fit.clear();
-  m_ePHI_fit.clear();
-  m_eTHETA_fit.clear();
-  m_eQOP_fit.clear();
-  m_eT_fit.clear();
-  m_err_eLOC0_fit.clear();
-  m_err_eLOC1_fit.clear();
-  m_err_ePHI_fit.clear();
-  m_err_eTHETA_fit.clear();
-  m_err_eQOP_fit.clear();
-  m_err_eT_fit.clear();
-  m_res_eLOC0_fit.clear();
-  m_res_eLOC1_fit.clear();
-  m_res_ePHI_fit.clear();
-  m_res_eTHETA_fit.clear();
-  m_res_eQOP_fit.clear();
-  m_res_eT_fit.clear();
-  m_pull_eLOC0_fit.clear();
-  m_pull_eLOC1_fit.clear();
-  m_pull_ePHI_fit.clear();
-  m_pull_eTHETA_fit.clear();
-  m_pull_eQOP_fit.clear();
-  m_pull_eT_fit.clear();
-
-  m_gsf_max_material_fwd.clear();
-  m_gsf_sum_material_fwd.clear();
-
-  if (m_cfg.writeCovMat) {
-    m_cov_eLOC0_eLOC0.clear();
-    m_cov_eLOC0_eLOC1.clear();
-    m_cov_eLOC0_ePHI.clear();
-    m_cov_eLOC0_eTHETA.clear();
-    m_cov_eLOC0_eQOP.clear();
-    m_cov_eLOC0_eT.clear();
-
-    m_cov_eLOC1_eLOC0.clear();
-    m_cov_eLOC1_eLOC1.clear();
-    m_cov_eLOC1_ePHI.clear();
-    m_cov_eLOC1_eTHETA.clear();
-    m_cov_eLOC1_eQOP.clear();
-    m_cov_eLOC1_eT.clear();
-
-    m_cov_ePHI_eLOC0.clear();
-    m_cov_ePHI_eLOC1.clear();
-    m_cov_ePHI_ePHI.clear();
-    m_cov_ePHI_eTHETA.clear();
-    m_cov_ePHI_eQOP.clear();
-    m_cov_ePHI_eT.clear();
-
-    m_cov_eTHETA_eLOC0.clear();
-    m_cov_eTHETA_eLOC1.clear();
-    m_cov_eTHETA_ePHI.clear();
-    m_cov_eTHETA_eTHETA.clear();
-    m_cov_eTHETA_eQOP.clear();
-    m_cov_eTHETA_eT.clear();
-
-    m_cov_eQOP_eLOC0.clear();
-    m_cov_eQOP_eLOC1.clear();
-    m_cov_eQOP_ePHI.clear();
-    m_cov_eQOP_eTHETA.clear();
-    m_cov_eQOP_eQOP.clear();
-    m_cov_eQOP_eT.clear();
-
-    m_cov_eT_eLOC0.clear();
-    m_cov_eT_eLOC1.clear();
-    m_cov_eT_ePHI.clear();
-    m_cov_eT_eTHETA.clear();
-    m_cov_eT_eQOP.clear();
-    m_cov_eT_eT.clear();
-  }
-
-  m_nUpdatesGx2f.clear();
+  // the tree is filled on the fill thread
+  m_fillQueue->push(std::move(rows));
 
   return ProcessCode::SUCCESS;
 }
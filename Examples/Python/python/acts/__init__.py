@@ -52,7 +52,7 @@ def _decoratorFromFile(file: Union[str, Path], **kwargs):
 
     kwargs.setdefault("level", ActsPythonBindings.logging.INFO)
 
-    if file.suffix in (".json", ".cbor"):
+    if file.suffix in (".json", ".cbor", ".msgpack", ".ubjson", ".bson"):
         c = ActsPythonBindings.MaterialMapJsonConverter.Config()
         for k in kwargs.keys():
             if hasattr(c, k):
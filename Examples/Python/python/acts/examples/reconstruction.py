@@ -1022,6 +1022,8 @@ def addSeedFilterML(
             minPointsDBScan=config.minPointsDBScan,
             minSeedScore=config.minSeedScore,
         ),
+        # score the seeds of all events of a batch at once
+        maxBatchSize=s.config.eventBatchSize,
     )
     s.addAlgorithm(filterML)
     s.addWhiteboardAlias(seeds, "filtered-seeds")
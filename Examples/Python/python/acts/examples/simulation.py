@@ -197,6 +197,8 @@ def addPythia8(
     cmsEnergy: Optional[float] = None,  # default: 14 * acts.UnitConstants.TeV
     hardProcess: Optional[Iterable] = None,  # default: ["HardQCD:all = on"]
     pileupProcess: Iterable = ["SoftQCD:all = on"],
+    pileupPoolSize: int = 0,
+    parallelVertices: bool = False,
     vtxGen: Optional[EventGenerator.VertexGenerator] = None,
     outputDirCsv: Optional[Union[Path, str]] = None,
     outputDirRoot: Optional[Union[Path, str]] = None,
@@ -220,6 +222,11 @@ def addPythia8(
         CMS energy
     hardProcess, pileupProcess : [str], ["HardQCD:all = on"], ["SoftQCD:all = on"]
         hard and pileup processes
+    pileupPoolSize : int, 0
+        number of pileup interactions generated once and resampled at the
+        pileup vertices, 0 generates every pileup interaction
+    parallelVertices : bool, False
+        generate the interactions of one event in parallel
     vtxGen : VertexGenerator, None
         vertex generator module
     outputDirCsv : Path|str, path, None
@@ -287,6 +294,7 @@ def addPythia8(
                         settings=pileupProcess,
                     ),
                 ),
+                poolSize=pileupPoolSize,
             )
         )
 
@@ -297,6 +305,7 @@ def addPythia8(
         outputParticles="particles_input",
         outputVertices="vertices_input",
         randomNumbers=rnd,
+        parallelVertices=parallelVertices,
     )
 
     s.addReader(evGen)
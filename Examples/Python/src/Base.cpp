@@ -12,6 +12,7 @@
 #include "Acts/Plugins/Python/Utilities.hpp"
 #include "Acts/Utilities/BinningData.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/detail/AxisFwd.hpp"
 
 #include <array>
@@ -307,4 +308,11 @@ void addBinning(Context& ctx) {
                       .export_values();
 }
 
+void addThreading(Acts::Python::Context& ctx) {
+  auto& m = ctx.get("main");
+
+  m.def("setMaxThreads", &Acts::setMaxThreads, py::arg("maxThreads"));
+  m.def("maxThreads", &Acts::maxThreads);
+}
+
 }  // namespace Acts::Python
@@ -7,17 +7,71 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "Acts/Definitions/PdgParticle.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/EventData/ParticleHypothesis.hpp"
 #include "Acts/Plugins/Python/Utilities.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/SequenceElement.hpp"
 
+#include <cstddef>
+#include <memory>
+#include <string>
 #include <type_traits>
+#include <variant>
+#include <vector>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 namespace py = pybind11;
 
 using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+constexpr py::ssize_t kBoundSize = eBoundSize;
+constexpr py::ssize_t kDoubleSize = sizeof(double);
+
+/// Wrap memory owned by a white board collection into a read-only array.
+///
+/// The array refers to the context as its base object, it must not be used
+/// after the event has been processed.
+py::array readOnlyView(const double* data,
+                       const std::vector<py::ssize_t>& shape,
+                       const std::vector<py::ssize_t>& strides,
+                       const py::object& context) {
+  py::array view(py::dtype::of<double>(), shape, strides, data, context);
+  view.attr("flags").attr("writeable") = false;
+  return view;
+}
+
+/// Bind a read handle which can be registered by python algorithms
+template <typename T>
+auto bindReadHandle(py::module_& mex, const char* name) {
+  using Handle = ReadDataHandle<T>;
+  return py::class_<Handle>(mex, name)
+      .def(py::init([](SequenceElement* parent, const std::string& handleName) {
+             return std::make_unique<Handle>(parent, handleName);
+           }),
+           py::arg("parent"), py::arg("name"))
+      .def("initialize", &Handle::initialize, py::arg("key"))
+      .def("isInitialized", &Handle::isInitialized)
+      .def_property_readonly("key", &Handle::key)
+      .def(
+          "size",
+          [](const Handle& self, const AlgorithmContext& ctx) {
+            return self(ctx).size();
+          },
+          py::arg("context"));
+}
+
+}  // namespace
 
 namespace Acts::Python {
 
@@ -74,6 +128,105 @@ void addEventData(Context& ctx) {
           "chargedGeantino", [](py::object /* self */) {
             return Acts::ParticleHypothesis::chargedGeantino();
           });
+
+  // Column access to the event data of the white board. The bound track
+  // parameters and covariances are stored contiguously by the track
+  // container and are returned as views without copying. The other columns
+  // are gathered from their elements into new arrays in a single pass.
+  bindReadHandle<ConstTrackContainer>(mex, "TrackContainerReadHandle")
+      .def(
+          "parameters",
+          [](const ReadDataHandle<ConstTrackContainer>& self,
+             const py::object& context) -> py::array {
+            const auto& tracks = self(context.cast<const AlgorithmContext&>());
+            const auto n = static_cast<py::ssize_t>(tracks.size());
+            if (n == 0) {
+              return py::array_t<double>({py::ssize_t{0}, kBoundSize});
+            }
+            return readOnlyView(tracks.container().parameters(0).data(),
+                                {n, kBoundSize},
+                                {kBoundSize * kDoubleSize, kDoubleSize},
+                                context);
+          },
+          py::arg("context"))
+      .def(
+          "covariances",
+          [](const ReadDataHandle<ConstTrackContainer>& self,
+             const py::object& context) -> py::array {
+            const auto& tracks = self(context.cast<const AlgorithmContext&>());
+            const auto n = static_cast<py::ssize_t>(tracks.size());
+            if (n == 0) {
+              return py::array_t<double>(
+                  {py::ssize_t{0}, kBoundSize, kBoundSize});
+            }
+            // The covariance matrices are stored column major
+            return readOnlyView(tracks.container().covariance(0).data(),
+                                {n, kBoundSize, kBoundSize},
+                                {kBoundSize * kBoundSize * kDoubleSize,
+                                 kDoubleSize, kBoundSize * kDoubleSize},
+                                context);
+          },
+          py::arg("context"));
+
+  bindReadHandle<SimSpacePointContainer>(mex, "SpacePointReadHandle")
+      .def(
+          "positions",
+          [](const ReadDataHandle<SimSpacePointContainer>& self,
+             const AlgorithmContext& ctx) {
+            const auto& spacePoints = self(ctx);
+            py::array_t<double> positions(
+                {static_cast<py::ssize_t>(spacePoints.size()), py::ssize_t{3}});
+            auto out = positions.mutable_unchecked<2>();
+            for (std::size_t i = 0; i < spacePoints.size(); ++i) {
+              const auto ii = static_cast<py::ssize_t>(i);
+              out(ii, 0) = spacePoints[i].x();
+              out(ii, 1) = spacePoints[i].y();
+              out(ii, 2) = spacePoints[i].z();
+            }
+            return positions;
+          },
+          py::arg("context"))
+      .def(
+          "variances",
+          [](const ReadDataHandle<SimSpacePointContainer>& self,
+             const AlgorithmContext& ctx) {
+            const auto& spacePoints = self(ctx);
+            py::array_t<double> variances(
+                {static_cast<py::ssize_t>(spacePoints.size()), py::ssize_t{2}});
+            auto out = variances.mutable_unchecked<2>();
+            for (std::size_t i = 0; i < spacePoints.size(); ++i) {
+              const auto ii = static_cast<py::ssize_t>(i);
+              out(ii, 0) = spacePoints[i].varianceR();
+              out(ii, 1) = spacePoints[i].varianceZ();
+            }
+            return variances;
+          },
+          py::arg("context"));
+
+  bindReadHandle<MeasurementContainer>(mex, "MeasurementReadHandle")
+      .def(
+          "localPositions",
+          [](const ReadDataHandle<MeasurementContainer>& self,
+             const AlgorithmContext& ctx) {
+            const auto& measurements = self(ctx);
+            py::array_t<double> positions(
+                {static_cast<py::ssize_t>(measurements.size()),
+                 py::ssize_t{2}});
+            auto out = positions.mutable_unchecked<2>();
+            for (std::size_t i = 0; i < measurements.size(); ++i) {
+              const auto ii = static_cast<py::ssize_t>(i);
+              std::visit(
+                  [&](const auto& m) {
+                    // Unmeasured local coordinates are zero
+                    auto parameters = (m.expander() * m.parameters()).eval();
+                    out(ii, 0) = parameters[eBoundLoc0];
+                    out(ii, 1) = parameters[eBoundLoc1];
+                  },
+                  measurements[i]);
+            }
+            return positions;
+          },
+          py::arg("context"));
 }
 
 }  // namespace Acts::Python
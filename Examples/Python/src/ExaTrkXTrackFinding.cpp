@@ -93,6 +93,7 @@ void addExaTrkXTrackFinding(Context &ctx) {
     ACTS_PYTHON_MEMBER(cut);
     ACTS_PYTHON_MEMBER(nChunks);
     ACTS_PYTHON_MEMBER(undirected);
+    ACTS_PYTHON_MEMBER(memoryPerEdge);
     ACTS_PYTHON_STRUCT_END();
   }
   {
@@ -172,7 +173,7 @@ void addExaTrkXTrackFinding(Context &ctx) {
       outputProtoTracks, outputGraph, graphConstructor, edgeClassifiers,
       trackBuilder, rScale, phiScale, zScale, cellCountScale, cellSumScale,
       clusterXScale, clusterYScale, filterShortTracks, targetMinHits,
-      targetMinPT);
+      targetMinPT, maxConcurrentEvents, devices);
 
   {
     auto cls =
@@ -71,6 +71,17 @@ class PyIAlgorithm : public IAlgorithm {
       throw py::type_error("Python algorithm did not conform to interface");
     }
   }
+
+  std::size_t maxBatchSize() const override {
+    py::gil_scoped_acquire acquire{};
+    PYBIND11_OVERRIDE(std::size_t, IAlgorithm, maxBatchSize);
+  }
+
+  ProcessCode executeBatch(
+      const std::vector<AlgorithmContext>& contexts) const override {
+    py::gil_scoped_acquire acquire{};
+    PYBIND11_OVERRIDE(ProcessCode, IAlgorithm, executeBatch, contexts);
+  }
 };
 
 void trigger_divbyzero() {
@@ -145,7 +156,9 @@ void addFramework(Context& ctx) {
                  PyIAlgorithm>(mex, "IAlgorithm")
           .def(py::init_alias<const std::string&, Acts::Logging::Level>(),
                py::arg("name"), py::arg("level"))
-          .def("execute", &IAlgorithm::execute);
+          .def("execute", &IAlgorithm::execute)
+          .def("executeBatch", &IAlgorithm::executeBatch)
+          .def("maxBatchSize", &IAlgorithm::maxBatchSize);
 
   using ActsExamples::Sequencer;
   using Config = Sequencer::Config;
@@ -188,10 +201,25 @@ void addFramework(Context& ctx) {
   ACTS_PYTHON_MEMBER(numThreads);
   ACTS_PYTHON_MEMBER(outputDir);
   ACTS_PYTHON_MEMBER(outputTimingFile);
+  ACTS_PYTHON_MEMBER(outputTimingPercentilesFile);
+  ACTS_PYTHON_MEMBER(outputTraceFile);
+  ACTS_PYTHON_MEMBER(trackMemory);
+  ACTS_PYTHON_MEMBER(outputMemoryFile);
+  ACTS_PYTHON_MEMBER(memoryPeakWarningThreshold);
+  ACTS_PYTHON_MEMBER(concurrentElements);
+  ACTS_PYTHON_MEMBER(maxEventsInFlight);
+  ACTS_PYTHON_MEMBER(eventBatchSize);
+  ACTS_PYTHON_MEMBER(readAheadEvents);
+  ACTS_PYTHON_MEMBER(eventMemoryArenas);
+  ACTS_PYTHON_MEMBER(numaArenas);
+  ACTS_PYTHON_MEMBER(cacheDir);
+  ACTS_PYTHON_MEMBER(cacheKey);
+  ACTS_PYTHON_MEMBER(cacheCollections);
   ACTS_PYTHON_MEMBER(trackFpes);
   ACTS_PYTHON_MEMBER(fpeMasks);
   ACTS_PYTHON_MEMBER(failOnFirstFpe);
   ACTS_PYTHON_MEMBER(fpeStackTraceLength);
+  ACTS_PYTHON_MEMBER(fpeTrapInterval);
   ACTS_PYTHON_STRUCT_END();
 
   auto fpem =
@@ -231,6 +259,7 @@ void addFramework(Context& ctx) {
       .def("merged", &Acts::FpeMonitor::Result::merged)
       .def("merge", &Acts::FpeMonitor::Result::merge)
       .def("count", &Acts::FpeMonitor::Result::count)
+      .def("numStackTraces", &Acts::FpeMonitor::Result::numStackTraces)
       .def("__str__", [](const Acts::FpeMonitor::Result& result) {
         std::stringstream os;
         result.summary(os);
@@ -83,18 +83,22 @@ void addGenerators(Context& ctx) {
             py::init<
                 std::shared_ptr<EventGenerator::MultiplicityGenerator>,
                 std::shared_ptr<EventGenerator::PrimaryVertexPositionGenerator>,
-                std::shared_ptr<EventGenerator::ParticlesGenerator>>(),
-            py::arg("multiplicity"), py::arg("vertex"), py::arg("particles"))
+                std::shared_ptr<EventGenerator::ParticlesGenerator>,
+                std::size_t>(),
+            py::arg("multiplicity"), py::arg("vertex"), py::arg("particles"),
+            py::arg("poolSize") = 0)
         .def_readwrite("multiplicity", &Generator::multiplicity)
         .def_readwrite("vertex", &Generator::vertex)
-        .def_readwrite("particles", &Generator::particles);
+        .def_readwrite("particles", &Generator::particles)
+        .def_readwrite("poolSize", &Generator::poolSize);
 
     py::class_<Config>(gen, "Config")
         .def(py::init<>())
         .def_readwrite("outputParticles", &Config::outputParticles)
         .def_readwrite("outputVertices", &Config::outputVertices)
         .def_readwrite("generators", &Config::generators)
-        .def_readwrite("randomNumbers", &Config::randomNumbers);
+        .def_readwrite("randomNumbers", &Config::randomNumbers)
+        .def_readwrite("parallelVertices", &Config::parallelVertices);
   }
 
   py::class_<
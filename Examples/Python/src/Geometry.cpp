@@ -340,7 +340,10 @@ void addExperimentalGeometry(Context& ctx) {
                       const std::vector<std::shared_ptr<Acts::Surface>>&,
                       const std::array<Acts::BinningValue, 1u>&>())
         .def("surfaces", py::overload_cast<const RangeXDDim1&>(
-                             &KdtSurfacesDim1Bin100::surfaces, py::const_));
+                             &KdtSurfacesDim1Bin100::surfaces, py::const_))
+        .def("surfaces",
+             py::overload_cast<const std::vector<RangeXDDim1>&>(
+                 &KdtSurfacesDim1Bin100::surfaces, py::const_));
 
     py::class_<KdtSurfacesProviderDim1Bin100,
                Acts::Experimental::ISurfacesProvider,
@@ -370,7 +373,10 @@ void addExperimentalGeometry(Context& ctx) {
                       const std::vector<std::shared_ptr<Acts::Surface>>&,
                       const std::array<Acts::BinningValue, 2u>&>())
         .def("surfaces", py::overload_cast<const RangeXDDim2&>(
-                             &KdtSurfacesDim2Bin100::surfaces, py::const_));
+                             &KdtSurfacesDim2Bin100::surfaces, py::const_))
+        .def("surfaces",
+             py::overload_cast<const std::vector<RangeXDDim2>&>(
+                 &KdtSurfacesDim2Bin100::surfaces, py::const_));
 
     py::class_<KdtSurfacesProviderDim2Bin100,
                Acts::Experimental::ISurfacesProvider,
@@ -514,6 +520,7 @@ void addExperimentalGeometry(Context& ctx) {
     ACTS_PYTHON_MEMBER(geoIdGenerator);
     ACTS_PYTHON_MEMBER(geoIdReverseGen);
     ACTS_PYTHON_MEMBER(auxiliary);
+    ACTS_PYTHON_MEMBER(buildConcurrently);
     ACTS_PYTHON_STRUCT_END();
   }
 
@@ -38,6 +38,7 @@ void addHepMC3(Context& ctx) {
 
   ACTS_PYTHON_DECLARE_READER(ActsExamples::HepMC3AsciiReader, hepmc3,
                              "HepMC3AsciiReader", inputDir, inputStem,
-                             outputEvents);
+                             inputPath, outputEvents, inputPileupPath, pileup,
+                             randomNumbers);
 }
 }  // namespace Acts::Python
@@ -8,6 +8,10 @@
 
 #include "Acts/Plugins/Python/Utilities.hpp"
 #include "ActsExamples/EventData/Cluster.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarMeasurementReader.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarParticleReader.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarSimHitReader.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarSpacePointReader.hpp"
 #include "ActsExamples/Io/Csv/CsvDriftCircleReader.hpp"
 #include "ActsExamples/Io/Csv/CsvMeasurementReader.hpp"
 #include "ActsExamples/Io/Csv/CsvMuonSimHitReader.hpp"
@@ -48,11 +52,12 @@ void addInput(Context& ctx) {
 
   ACTS_PYTHON_DECLARE_READER(ActsExamples::RootMaterialTrackReader, mex,
                              "RootMaterialTrackReader", outputMaterialTracks,
-                             treeName, fileList, readCachedSurfaceInformation);
+                             treeName, fileList, readCachedSurfaceInformation,
+                             cacheSize);
 
   ACTS_PYTHON_DECLARE_READER(ActsExamples::RootTrackSummaryReader, mex,
                              "RootTrackSummaryReader", outputTracks,
-                             outputParticles, treeName, filePath);
+                             outputParticles, treeName, filePath, readRNTuple);
 
   // CSV READERS
   ACTS_PYTHON_DECLARE_READER(ActsExamples::CsvParticleReader, mex,
@@ -82,6 +87,22 @@ void addInput(Context& ctx) {
                              "CsvTrackParameterReader", inputDir, inputStem,
                              outputTrackParameters, beamspot);
 
+  ACTS_PYTHON_DECLARE_READER(ActsExamples::ColumnarParticleReader, mex,
+                             "ColumnarParticleReader", filePath,
+                             outputParticles);
+
+  ACTS_PYTHON_DECLARE_READER(ActsExamples::ColumnarSimHitReader, mex,
+                             "ColumnarSimHitReader", filePath, outputSimHits);
+
+  ACTS_PYTHON_DECLARE_READER(
+      ActsExamples::ColumnarMeasurementReader, mex,
+      "ColumnarMeasurementReader", filePath, outputMeasurements,
+      outputSourceLinks, outputMeasurementSimHitsMap);
+
+  ACTS_PYTHON_DECLARE_READER(ActsExamples::ColumnarSpacePointReader, mex,
+                             "ColumnarSpacePointReader", filePath,
+                             outputSpacePoints);
+
   ACTS_PYTHON_DECLARE_READER(ActsExamples::RootAthenaNTupleReader, mex,
                              "RootAthenaNTupleReader", inputTreeName,
                              inputFilePath, outputTrackParameters,
@@ -90,7 +111,7 @@ void addInput(Context& ctx) {
 
   ACTS_PYTHON_DECLARE_READER(ActsExamples::RootSimHitReader, mex,
                              "RootSimHitReader", treeName, filePath,
-                             outputSimHits);
+                             outputSimHits, readMomenta, eventIndexPath);
 }
 
 }  // namespace Acts::Python
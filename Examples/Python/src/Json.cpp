@@ -10,6 +10,7 @@
 #include "Acts/Detector/Detector.hpp"
 #include "Acts/Detector/ProtoDetector.hpp"
 #include "Acts/Plugins/Json/DetectorJsonConverter.hpp"
+#include "Acts/Plugins/Json/JsonFileReader.hpp"
 #include "Acts/Plugins/Json/JsonMaterialDecorator.hpp"
 #include "Acts/Plugins/Json/MaterialMapJsonConverter.hpp"
 #include "Acts/Plugins/Json/ProtoDetectorJsonConverter.hpp"
@@ -141,13 +142,8 @@ void addJson(Context& ctx) {
   {
     py::class_<Acts::ProtoDetector>(mex, "ProtoDetector")
         .def(py::init<>([](std::string pathName) {
-          nlohmann::json jDetector;
-          auto in = std::ifstream(pathName, std::ifstream::in);
-          if (in.good()) {
-            in >> jDetector;
-            in.close();
-          }
-          Acts::ProtoDetector pDetector = jDetector["detector"];
+          Acts::ProtoDetector pDetector =
+              Acts::JsonFileReader::read(pathName, {"detector"});
           return pDetector;
         }));
   }
@@ -223,11 +219,7 @@ void addJson(Context& ctx) {
         "readDetectorFromJson",
         [](const Acts::GeometryContext& gctx,
            const std::string& fileName) -> auto{
-          auto in = std::ifstream(fileName,
-                                  std::ifstream::in | std::ifstream::binary);
-          nlohmann::json jDetectorIn;
-          in >> jDetectorIn;
-          in.close();
+          nlohmann::json jDetectorIn = Acts::JsonFileReader::read(fileName);
 
           return Acts::DetectorJsonConverter::fromJson(gctx, jDetectorIn);
         });
@@ -12,6 +12,7 @@
 #include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/MagneticField/MappedFieldMap.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
 #include "Acts/MagneticField/SolenoidBField.hpp"
 #include "Acts/Plugins/Python/Utilities.hpp"
@@ -21,6 +22,7 @@
 #include <array>
 #include <cstddef>
 #include <filesystem>
+#include <fstream>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -64,6 +66,26 @@ void addMagneticField(Context& ctx) {
              std::shared_ptr<ActsExamples::detail::InterpolatedMagneticField3>>(
       mex, "InterpolatedMagneticField3");
 
+  m.def(
+      "writeMappedFieldMap",
+      [](const ActsExamples::detail::InterpolatedMagneticField2& field,
+         const std::string& filename) {
+        std::ofstream os(filename, std::ios::binary);
+        Acts::writeMappedFieldMap(os, field);
+      },
+      py::arg("field"), py::arg("file"));
+
+  m.def(
+      "writeMappedFieldMap",
+      [](const ActsExamples::detail::InterpolatedMagneticField3& field,
+         const std::string& filename) {
+        std::ofstream os(filename, std::ios::binary);
+        Acts::writeMappedFieldMap(os, field);
+      },
+      py::arg("field"), py::arg("file"));
+
+  m.def("readMappedFieldMap", &Acts::readMappedFieldMap, py::arg("file"));
+
   py::class_<Acts::NullBField, Acts::MagneticFieldProvider,
              std::shared_ptr<Acts::NullBField>>(m, "NullBField")
       .def(py::init<>());
@@ -214,6 +214,10 @@ void addMaterial(Context& ctx) {
     ACTS_PYTHON_MEMBER(surfaces);
     ACTS_PYTHON_MEMBER(trackingVolumes);
     ACTS_PYTHON_MEMBER(detectorVolumes);
+    ACTS_PYTHON_MEMBER(useBoundingBoxes);
+    ACTS_PYTHON_MEMBER(boxContext);
+    ACTS_PYTHON_MEMBER(boxEnvelope);
+    ACTS_PYTHON_MEMBER(maxOctreeDepth);
     ACTS_PYTHON_STRUCT_END();
   }
 
@@ -299,7 +303,8 @@ void addMaterial(Context& ctx) {
                        config, getDefaultLogger("MaterialValidater", level));
                  }),
                  py::arg("config"), py::arg("level"))
-            .def("recordMaterial", &MaterialValidater::recordMaterial);
+            .def("recordMaterial", &MaterialValidater::recordMaterial)
+            .def("integrateMaterial", &MaterialValidater::integrateMaterial);
 
     auto c =
         py::class_<MaterialValidater::Config>(mvc, "Config").def(py::init<>());
@@ -327,7 +332,11 @@ void addMaterial(Context& ctx) {
     ACTS_PYTHON_MEMBER(etaRange);
     ACTS_PYTHON_MEMBER(randomNumberSvc);
     ACTS_PYTHON_MEMBER(materialValidater);
+    ACTS_PYTHON_MEMBER(raysPerTask);
     ACTS_PYTHON_MEMBER(outputMaterialTracks);
+    ACTS_PYTHON_MEMBER(outputMaterialProfile);
+    ACTS_PYTHON_MEMBER(profileEtaBins);
+    ACTS_PYTHON_MEMBER(profilePhiBins);
     ACTS_PYTHON_STRUCT_END();
   }
 }
@@ -45,6 +45,7 @@ void addLogging(Context& ctx);
 void addPdgParticle(Context& ctx);
 void addAlgebra(Context& ctx);
 void addBinning(Context& ctx);
+void addThreading(Context& ctx);
 void addEventData(Context& ctx);
 
 void addPropagation(Context& ctx);
@@ -109,6 +110,7 @@ PYBIND11_MODULE(ActsPythonBindings, m) {
   addPdgParticle(ctx);
   addAlgebra(ctx);
   addBinning(ctx);
+  addThreading(ctx);
   addEventData(ctx);
 
   addPropagation(ctx);
@@ -29,7 +29,7 @@ void addOnnx(Context& ctx) {
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::AmbiguityResolutionMLAlgorithm,
                                 onnx, "AmbiguityResolutionMLAlgorithm",
                                 inputTracks, inputDuplicateNN, outputTracks,
-                                nMeasurementsMin);
+                                nMeasurementsMin, useCuda);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(
       ActsExamples::AmbiguityResolutionMLDBScanAlgorithm, onnx,
@@ -40,6 +40,7 @@ void addOnnx(Context& ctx) {
                                 "SeedFilterMLAlgorithm", inputTrackParameters,
                                 inputSimSeeds, inputSeedFilterNN,
                                 outputTrackParameters, outputSimSeeds,
-                                epsilonDBScan, minPointsDBScan, minSeedScore);
+                                epsilonDBScan, minPointsDBScan, minSeedScore,
+                                maxBatchSize);
 }
 }  // namespace Acts::Python
@@ -13,14 +13,20 @@
 #include "Acts/Visualization/ViewConfig.hpp"
 #include "ActsExamples/Digitization/DigitizationConfig.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarMeasurementWriter.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarParticleWriter.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarSimHitWriter.hpp"
+#include "ActsExamples/Io/Columnar/ColumnarSpacePointWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvBFieldWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvExaTrkXGraphWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvMeasurementWriter.hpp"
+#include "ActsExamples/Io/Csv/CsvNavigationProfileWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvParticleWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvProtoTrackWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvSeedWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvSimHitWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvSpacepointWriter.hpp"
+#include "ActsExamples/Io/Csv/CsvTrackFootprintWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvTrackParameterWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvTrackWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvTrackingGeometryWriter.hpp"
@@ -327,12 +333,13 @@ void addOutput(Context& ctx) {
   ACTS_PYTHON_DECLARE_WRITER(
       ActsExamples::RootTrackStatesWriter, mex, "RootTrackStatesWriter",
       inputTracks, inputParticles, inputTrackParticleMatching, inputSimHits,
-      inputMeasurementSimHitsMap, filePath, treeName, fileMode);
+      inputMeasurementSimHitsMap, filePath, treeName, fileMode, writeRNTuple);
 
   ACTS_PYTHON_DECLARE_WRITER(
       ActsExamples::RootTrackSummaryWriter, mex, "RootTrackSummaryWriter",
       inputTracks, inputParticles, inputTrackParticleMatching, filePath,
-      treeName, fileMode, writeCovMat, writeGsfSpecific, writeGx2fSpecific);
+      treeName, fileMode, writeCovMat, writeGsfSpecific, writeGx2fSpecific,
+      writeRNTuple);
 
   ACTS_PYTHON_DECLARE_WRITER(
       ActsExamples::VertexPerformanceWriter, mex, "VertexPerformanceWriter",
@@ -358,6 +365,21 @@ void addOutput(Context& ctx) {
                              "CsvSpacepointWriter", inputSpacepoints, outputDir,
                              outputPrecision);
 
+  ACTS_PYTHON_DECLARE_WRITER(ActsExamples::ColumnarParticleWriter, mex,
+                             "ColumnarParticleWriter", inputParticles,
+                             filePath);
+
+  ACTS_PYTHON_DECLARE_WRITER(ActsExamples::ColumnarSimHitWriter, mex,
+                             "ColumnarSimHitWriter", inputSimHits, filePath);
+
+  ACTS_PYTHON_DECLARE_WRITER(ActsExamples::ColumnarMeasurementWriter, mex,
+                             "ColumnarMeasurementWriter", inputMeasurements,
+                             inputMeasurementSimHitsMap, filePath);
+
+  ACTS_PYTHON_DECLARE_WRITER(ActsExamples::ColumnarSpacePointWriter, mex,
+                             "ColumnarSpacePointWriter", inputSpacePoints,
+                             filePath);
+
   ACTS_PYTHON_DECLARE_WRITER(ActsExamples::CsvTrackWriter, mex,
                              "CsvTrackWriter", inputTracks, outputDir, fileName,
                              inputMeasurementParticlesMap, outputPrecision,
@@ -396,6 +418,14 @@ void addOutput(Context& ctx) {
                              "CsvProtoTrackWriter", inputSpacepoints,
                              inputPrototracks, outputDir);
 
+  ACTS_PYTHON_DECLARE_WRITER(ActsExamples::CsvNavigationProfileWriter, mex,
+                             "CsvNavigationProfileWriter", profiler, outputDir,
+                             fileName);
+
+  ACTS_PYTHON_DECLARE_WRITER(ActsExamples::CsvTrackFootprintWriter, mex,
+                             "CsvTrackFootprintWriter", inputTracks, outputDir,
+                             fileName, summaryFileName);
+
   {
     using Writer = ActsExamples::CsvBFieldWriter;
 
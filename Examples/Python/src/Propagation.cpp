@@ -12,6 +12,7 @@
 #include "Acts/Plugins/Python/Utilities.hpp"
 #include "Acts/Propagator/AtlasStepper.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/NavigationProfiler.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
@@ -67,6 +68,12 @@ namespace Acts::Python {
 void addPropagation(Context& ctx) {
   auto [m, prop, mex] = ctx.get("main", "propagation", "examples");
 
+  py::class_<Acts::NavigationProfiler,
+             std::shared_ptr<Acts::NavigationProfiler>>(m,
+                                                        "NavigationProfiler")
+      .def(py::init<>())
+      .def("clear", &Acts::NavigationProfiler::clear);
+
   {
     using Config = Acts::Navigator::Config;
     auto nav =
@@ -85,6 +92,7 @@ void addPropagation(Context& ctx) {
     ACTS_PYTHON_MEMBER(resolvePassive);
     ACTS_PYTHON_MEMBER(resolveSensitive);
     ACTS_PYTHON_MEMBER(trackingGeometry);
+    ACTS_PYTHON_MEMBER(profiler);
     ACTS_PYTHON_STRUCT_END();
   }
 
@@ -108,6 +116,7 @@ void addPropagation(Context& ctx) {
     ACTS_PYTHON_MEMBER(resolvePassive);
     ACTS_PYTHON_MEMBER(resolveSensitive);
     ACTS_PYTHON_MEMBER(detector);
+    ACTS_PYTHON_MEMBER(profiler);
     ACTS_PYTHON_STRUCT_END();
   }
 
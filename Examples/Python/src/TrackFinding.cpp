@@ -265,7 +265,8 @@ void addTrackFinding(Context& ctx) {
       ActsExamples::SeedingAlgorithm, mex, "SeedingAlgorithm", inputSpacePoints,
       outputSeeds, seedFilterConfig, seedFinderConfig, seedFinderOptions,
       gridConfig, gridOptions, allowSeparateRMax, zBinNeighborsTop,
-      zBinNeighborsBottom, numPhiNeighbors);
+      zBinNeighborsBottom, numPhiNeighbors, parallelGroups,
+      useSpacePointStore);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::SeedingOrthogonalAlgorithm, mex,
                                 "SeedingOrthogonalAlgorithm", inputSpacePoints,
@@ -286,7 +287,8 @@ void addTrackFinding(Context& ctx) {
       localMaxWindowSize, kA);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::MuonHoughSeeder, mex,
-                                "MuonHoughSeeder", inSimHits, inDriftCircles);
+                                "MuonHoughSeeder", inSimHits, inDriftCircles,
+                                nBinsTanTheta, nBinsZ0, outHoughPlots);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(
       ActsExamples::TrackParamsEstimationAlgorithm, mex,
@@ -336,6 +338,10 @@ void addTrackFinding(Context& ctx) {
     ACTS_PYTHON_MEMBER(twoWay);
     ACTS_PYTHON_MEMBER(seedDeduplication);
     ACTS_PYTHON_MEMBER(stayOnSeed);
+    ACTS_PYTHON_MEMBER(seedsPerTask);
+    ACTS_PYTHON_MEMBER(maxClaimedMeasurements);
+    ACTS_PYTHON_MEMBER(sourceLinkWindowNSigma);
+    ACTS_PYTHON_MEMBER(preSelectionNSigma);
     ACTS_PYTHON_STRUCT_END();
   }
 
@@ -54,11 +54,13 @@ void addTrackFitting(Context& ctx) {
                                 "TrackFittingAlgorithm", inputMeasurements,
                                 inputSourceLinks, inputProtoTracks,
                                 inputInitialTrackParameters, inputClusters,
-                                outputTracks, fit, pickTrack, calibrator);
+                                outputTracks, fit, pickTrack, calibrator,
+                                tracksPerTask);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::RefittingAlgorithm, mex,
                                 "RefittingAlgorithm", inputTracks, outputTracks,
-                                fit, pickTrack);
+                                fit, pickTrack, incremental, trackingGeometry,
+                                magneticField);
 
   {
     py::class_<TrackFitterFunction, std::shared_ptr<TrackFitterFunction>>(
@@ -112,7 +114,10 @@ void addTrackFitting(Context& ctx) {
                     py::arg("lowParametersPath"), py::arg("highParametersPath"),
                     py::arg("lowLimit") = 0.1, py::arg("highLimit") = 0.2)
         .def_static("makeDefault",
-                    []() { return Acts::makeDefaultBetheHeitlerApprox(); });
+                    []() { return Acts::makeDefaultBetheHeitlerApprox(); })
+        .def("useLookupTable",
+             &ActsExamples::BetheHeitlerApprox::useLookupTable,
+             py::arg("nBins") = 1000);
     mex.def(
         "makeGsfFitterFunction",
         [](std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
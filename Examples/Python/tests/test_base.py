@@ -1,3 +1,5 @@
+import json
+
 import pytest
 
 import acts
@@ -21,6 +23,13 @@ def test_logging():
         assert hasattr(acts.logging.Level, l)
 
 
+def test_max_threads():
+    assert acts.maxThreads() == 1
+    acts.setMaxThreads(4)
+    assert acts.maxThreads() == 4
+    acts.setMaxThreads(1)
+
+
 def test_pgd_particle():
     assert len(acts.PdgParticle.__members__) == 19
 
@@ -81,6 +90,148 @@ def test_sequencer_multi_threaded(ptcl_gun, capfd):
     assert "Processed 2 events" in cap.out
 
 
+def test_sequencer_concurrent_elements(ptcl_gun, capfd):
+    s = acts.examples.Sequencer(numThreads=-1, events=2, concurrentElements=True)
+    ptcl_gun(s)
+    s.run()
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Processed 2 events" in cap.out
+
+
+def test_sequencer_pipelined(ptcl_gun, capfd):
+    s = acts.examples.Sequencer(numThreads=-1, events=4, maxEventsInFlight=2)
+    ptcl_gun(s)
+    s.run()
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Processed 4 events" in cap.out
+
+
+def test_sequencer_read_ahead(ptcl_gun, capfd):
+    s = acts.examples.Sequencer(numThreads=-1, events=4, readAheadEvents=2)
+    ptcl_gun(s)
+    s.run()
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Processed 4 events" in cap.out
+
+
+def test_sequencer_event_batches():
+    class BatchAlgorithm(acts.examples.IAlgorithm):
+        def __init__(self):
+            acts.examples.IAlgorithm.__init__(
+                self, "BatchAlgorithm", acts.logging.INFO
+            )
+            self.batches = []
+
+        def maxBatchSize(self):
+            return 3
+
+        def execute(self, context):
+            self.batches.append([context.eventNumber])
+            return acts.examples.ProcessCode.SUCCESS
+
+        def executeBatch(self, contexts):
+            self.batches.append([c.eventNumber for c in contexts])
+            return acts.examples.ProcessCode.SUCCESS
+
+    alg = BatchAlgorithm()
+    s = acts.examples.Sequencer(numThreads=1, events=5, eventBatchSize=4)
+    s.addAlgorithm(alg)
+    s.run()
+    # a batch of four events split by the algorithm and a single event
+    assert alg.batches == [[0, 1, 2], [3], [4]]
+
+
+def test_sequencer_event_memory_arenas(ptcl_gun, capfd):
+    s = acts.examples.Sequencer(numThreads=-1, events=4, eventMemoryArenas=True)
+    ptcl_gun(s)
+    s.run()
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Processed 4 events" in cap.out
+
+
+def test_sequencer_event_cache(ptcl_gun, tmp_path, capfd):
+    def run():
+        s = acts.examples.Sequencer(
+            numThreads=1,
+            events=3,
+            cacheDir=str(tmp_path),
+            cacheKey="gun",
+            cacheCollections=["particles_input", "vertices_input"],
+        )
+        ptcl_gun(s)
+        s.addAlgorithm(
+            acts.examples.ParticlesPrinter(
+                level=acts.logging.INFO, inputParticles="particles_input"
+            )
+        )
+        s.run()
+        cap = capfd.readouterr()
+        assert cap.err == ""
+        return cap.out
+
+    out = run()
+    assert "Store 2 objects of every event" in out
+    assert len(list((tmp_path / "gun").glob("event*-cache.bin"))) == 3
+
+    # the second run loads the particles instead of generating them
+    out = run()
+    assert "Skip Reader 'EventGenerator'" in out
+    assert "Load 2 objects of every event" in out
+
+
+def test_sequencer_timing_trace(ptcl_gun, tmp_path):
+    s = acts.examples.Sequencer(
+        numThreads=-1,
+        events=4,
+        outputDir=str(tmp_path),
+        outputTimingPercentilesFile="timing_percentiles.tsv",
+        outputTraceFile="trace.json",
+    )
+    ptcl_gun(s)
+    s.run()
+
+    percentiles = (tmp_path / "timing_percentiles.tsv").read_text().splitlines()
+    assert percentiles[0].split("\t") == [
+        "identifier",
+        "time_mean_s",
+        "time_p50_s",
+        "time_p90_s",
+        "time_p99_s",
+        "time_max_s",
+    ]
+    assert percentiles[-1].startswith("Event\t")
+
+    trace = json.loads((tmp_path / "trace.json").read_text())
+    spans = [e for e in trace["traceEvents"] if e["ph"] == "X"]
+    assert sorted({e["args"]["event"] for e in spans}) == [0, 1, 2, 3]
+
+
+def test_sequencer_track_memory(ptcl_gun, tmp_path):
+    s = acts.examples.Sequencer(
+        numThreads=1, events=2, outputDir=str(tmp_path), trackMemory=True
+    )
+    ptcl_gun(s)
+    s.run()
+
+    # only written by builds that count the allocations
+    memory = tmp_path / "memory.tsv"
+    if memory.exists():
+        header = memory.read_text().splitlines()[0].split("\t")
+        assert header == [
+            "identifier",
+            "allocations_perevent",
+            "allocated_perevent_bytes",
+            "freed_perevent_bytes",
+            "peak_perevent_bytes",
+            "peak_max_bytes",
+            "peak_max_event",
+        ]
+
+
 def test_random_number():
     rnd = acts.examples.RandomNumbers(seed=42)
 
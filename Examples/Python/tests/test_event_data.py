@@ -1,4 +1,7 @@
+import numpy as np
+
 import acts
+import acts.examples
 
 
 def test_particle_hypothesis():
@@ -49,3 +52,33 @@ def test_particle_hypothesis():
     assert str(proton) == "ParticleHypothesis{absPdg=p, mass=0.938272, absCharge=1}"
     assert str(geantino) == "ParticleHypothesis{absPdg=0, mass=0, absCharge=0}"
     assert str(chargedGeantino) == "ParticleHypothesis{absPdg=0, mass=0, absCharge=1}"
+
+
+def test_measurement_columns(fatras):
+    class MeasurementColumns(acts.examples.IAlgorithm):
+        def __init__(self, inputMeasurements):
+            acts.examples.IAlgorithm.__init__(
+                self, "MeasurementColumns", acts.logging.INFO
+            )
+            self.measurements = acts.examples.MeasurementReadHandle(
+                self, "InputMeasurements"
+            )
+            self.measurements.initialize(inputMeasurements)
+            self.shapes = []
+
+        def execute(self, context):
+            positions = self.measurements.localPositions(context)
+            assert np.all(np.isfinite(positions))
+            self.shapes.append((positions.shape, self.measurements.size(context)))
+            return acts.examples.ProcessCode.SUCCESS
+
+    s = acts.examples.Sequencer(numThreads=1, events=2)
+    _, _, digiAlg = fatras(s)
+    alg = MeasurementColumns(digiAlg.config.outputMeasurements)
+    s.addAlgorithm(alg)
+    s.run()
+
+    assert len(alg.shapes) == 2
+    for shape, size in alg.shapes:
+        assert size > 0
+        assert shape == (size, 2)
@@ -652,6 +652,56 @@ def test_particle_gun(tmp_path, assert_root_hash):
     assert_root_hash(root_file.name, root_file)
 
 
+@pytest.mark.parametrize("poolSize", [0, 10])
+def test_event_generator_parallel_vertices(tmp_path, poolSize):
+    def run(csv_dir, numThreads):
+        s = Sequencer(events=5, numThreads=numThreads)
+        evGen = acts.examples.EventGenerator(
+            level=acts.logging.INFO,
+            generators=[
+                acts.examples.EventGenerator.Generator(
+                    multiplicity=acts.examples.FixedMultiplicityGenerator(n=50),
+                    vertex=acts.examples.GaussianVertexGenerator(
+                        stddev=acts.Vector4(10 * u.um, 10 * u.um, 50 * u.mm, 1 * u.ns),
+                        mean=acts.Vector4(0, 0, 0, 0),
+                    ),
+                    particles=acts.examples.ParametricParticleGenerator(
+                        p=(1 * u.GeV, 10 * u.GeV),
+                        eta=(-2, 2),
+                        numParticles=4,
+                    ),
+                    poolSize=poolSize,
+                )
+            ],
+            outputParticles="particles_input",
+            outputVertices="vertices_input",
+            randomNumbers=acts.examples.RandomNumbers(seed=42),
+            parallelVertices=True,
+        )
+        s.addReader(evGen)
+
+        csv_dir.mkdir()
+        s.addWriter(
+            acts.examples.CsvParticleWriter(
+                level=acts.logging.INFO,
+                inputParticles=evGen.config.outputParticles,
+                outputDir=str(csv_dir),
+                outputStem="particles",
+            )
+        )
+        s.run()
+
+    # the vertex streams do not depend on the number of threads
+    run(tmp_path / "single", 1)
+    run(tmp_path / "multi", -1)
+
+    files = sorted(f.name for f in (tmp_path / "single").iterdir())
+    assert len(files) == 5
+    for name in files:
+        single = (tmp_path / "single" / name).read_bytes()
+        assert single == (tmp_path / "multi" / name).read_bytes()
+
+
 @pytest.mark.slow
 @pytest.mark.odd
 @pytest.mark.skipif(not dd4hepEnabled, reason="DD4hep not set up")
@@ -122,6 +122,36 @@ def test_fpe_single_fail_at_end(fpe_type):
         assert res.count(x) == (s.config.events if x == fpe_type else 0)
 
 
+@pytest.mark.parametrize("interval", [0, 5])
+def test_fpe_trap_interval(fpe_type, interval):
+    s = acts.examples.Sequencer(
+        events=10,
+        failOnFirstFpe=False,
+        fpeTrapInterval=interval,
+    )
+
+    s.addAlgorithm(
+        FuncAlg(
+            _names[fpe_type],
+            lambda _: getattr(
+                acts.FpeMonitor, f"_trigger_{_names[fpe_type].lower()}"
+            )(),
+        )
+    )
+    if interval == 0:
+        # counted FPEs have no stack traces to check against the masks
+        s.run()
+    else:
+        with pytest.raises(RuntimeError):
+            s.run()
+
+    # every event is counted, only the sampled ones are trapped
+    res = s.fpeResult
+    for x in acts.FpeType.values:
+        assert res.count(x) == (s.config.events if x == fpe_type else 0)
+    assert res.numStackTraces() == (0 if interval == 0 else 1)
+
+
 def test_fpe_single_fail_immediately(fpe_type):
     s = acts.examples.Sequencer(
         events=10,
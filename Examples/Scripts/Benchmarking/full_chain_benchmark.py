@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+
+# Throughput benchmark of the ODD full chain
+#
+# Runs Examples/Scripts/Python/full_chain_odd.py (Fatras, digitization,
+# seeding, CKF, ambiguity resolution and vertexing) with fixed seeds for the
+# particle gun and the ttbar sample and a range of thread counts. Each run is
+# a separate process, its events/s, peak RSS and the per algorithm times of
+# `timing.tsv` are collected in a JSON file. Results of different commits
+# can be compared with `--compare`, which fails if the throughput dropped by
+# more than the tolerance.
+#
+# Example:
+#   source build/this_acts_withdeps.sh
+#   full_chain_benchmark.py --samples gun ttbar --threads 1 2 4 8 -o bench
+#   full_chain_benchmark.py --compare bench_main/results.json -o bench
+
+import argparse
+import csv
+import json
+import os
+import pathlib
+import platform
+import re
+import statistics
+import subprocess
+import sys
+import time
+
+fullChainScript = (
+    pathlib.Path(__file__).resolve().parent.parent / "Python" / "full_chain_odd.py"
+)
+
+sampleArguments = {
+    # 200 vertices with 4 muons each
+    "gun": [],
+    # ttbar with 200 pile-up events
+    "ttbar": ["--ttbar", "--ttbar-pu", "200"],
+}
+
+wallClockPattern = re.compile(
+    r"Processed (\d+) events in ([0-9.]+) (s|ms|us|ns) \(wall clock\)"
+)
+wallClockUnits = {"s": 1.0, "ms": 1e-3, "us": 1e-6, "ns": 1e-9}
+
+
+def defaultThreads():
+    n = os.cpu_count() or 1
+    threads = [1]
+    while threads[-1] * 2 < n:
+        threads.append(threads[-1] * 2)
+    if threads[-1] != n:
+        threads.append(n)
+    return threads
+
+
+def gitCommit():
+    try:
+        return subprocess.check_output(
+            ["git", "describe", "--always", "--dirty"],
+            cwd=fullChainScript.parent,
+            text=True,
+            stderr=subprocess.DEVNULL,
+        ).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def readTiming(path):
+    timing = {}
+    with open(path) as f:
+        for row in csv.DictReader(f, delimiter="\t"):
+            timing[row["identifier"]] = float(row["time_perevent_s"])
+    return timing
+
+
+def run(sample, threads, events, outputDir):
+    outputDir.mkdir(parents=True, exist_ok=True)
+    command = [
+        sys.executable,
+        str(fullChainScript),
+        "--events",
+        str(events),
+        "--threads",
+        str(threads),
+        "--output",
+        str(outputDir),
+        "--no-output-root",
+        "--no-output-csv",
+    ] + sampleArguments[sample]
+
+    with open(outputDir / "log.txt", "w") as log:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=log, stderr=subprocess.STDOUT)
+        # the resource usage of this process only, not of all children
+        _, status, usage = os.wait4(process.pid, 0)
+        wall = time.perf_counter() - start
+    if os.waitstatus_to_exitcode(status) != 0:
+        raise RuntimeError(f"Full chain failed, see {outputDir / 'log.txt'}")
+
+    match = wallClockPattern.search((outputDir / "log.txt").read_text())
+    if match is None:
+        raise RuntimeError(f"No event loop summary in {outputDir / 'log.txt'}")
+    nEvents = int(match.group(1))
+    loopWall = float(match.group(2)) * wallClockUnits[match.group(3)]
+
+    return {
+        "sample": sample,
+        "threads": threads,
+        "events": nEvents,
+        "event_loop_s": loopWall,
+        "process_s": wall,
+        "events_per_s": nEvents / loopWall,
+        # ru_maxrss is in kB on linux
+        "peak_rss_mb": usage.ru_maxrss / 1024.0,
+        "timing_perevent_s": readTiming(outputDir / "timing.tsv"),
+    }
+
+
+def summarize(runs):
+    # median over the repetitions of each configuration
+    groups = {}
+    for r in runs:
+        groups.setdefault((r["sample"], r["threads"]), []).append(r)
+    summary = []
+    for (sample, threads), group in sorted(groups.items()):
+        algorithms = group[0]["timing_perevent_s"].keys()
+        summary.append(
+            {
+                "sample": sample,
+                "threads": threads,
+                "events_per_s": statistics.median(r["events_per_s"] for r in group),
+                "peak_rss_mb": max(r["peak_rss_mb"] for r in group),
+                "timing_perevent_s": {
+                    a: statistics.median(r["timing_perevent_s"][a] for r in group)
+                    for a in algorithms
+                },
+            }
+        )
+    return summary
+
+
+def printSummary(summary):
+    print(f"{'sample':<8} {'threads':>7} {'events/s':>10} {'speedup':>8} {'RSS/MB':>8}")
+    single = {s["sample"]: s["events_per_s"] for s in summary if s["threads"] == 1}
+    for s in summary:
+        speedup = (
+            f"{s['events_per_s'] / single[s['sample']]:.2f}"
+            if s["sample"] in single
+            else "-"
+        )
+        print(
+            f"{s['sample']:<8} {s['threads']:>7} {s['events_per_s']:>10.3f} "
+            f"{speedup:>8} {s['peak_rss_mb']:>8.0f}"
+        )
+    for s in summary:
+        if s["threads"] != 1:
+            continue
+        print(f"\nTime per event of '{s['sample']}' on one thread:")
+        for name, t in sorted(
+            s["timing_perevent_s"].items(), key=lambda item: -item[1]
+        ):
+            print(f"  {name:<60} {t * 1e3:>10.2f} ms")
+
+
+def compare(summary, reference, tolerance):
+    ref = {(s["sample"], s["threads"]): s for s in reference["summary"]}
+    ok = True
+    print(f"\nComparison with {reference['commit']} (tolerance {tolerance:.0%}):")
+    for s in summary:
+        key = (s["sample"], s["threads"])
+        if key not in ref:
+            continue
+        ratio = s["events_per_s"] / ref[key]["events_per_s"]
+        regression = ratio < 1 - tolerance
+        ok = ok and not regression
+        print(
+            f"  {s['sample']:<8} {s['threads']:>3} threads: "
+            f"{ratio:.3f}x{'  REGRESSION' if regression else ''}"
+        )
+        for name, t in s["timing_perevent_s"].items():
+            tRef = ref[key]["timing_perevent_s"].get(name)
+            if tRef and t > tRef * (1 + tolerance) and tRef > 1e-4:
+                print(f"    {name}: {tRef * 1e3:.2f} ms -> {t * 1e3:.2f} ms")
+    return ok
+
+
+def plotScaling(summary, path):
+    import matplotlib.pyplot as plt
+
+    fig, ax = plt.subplots()
+    for sample in sorted({s["sample"] for s in summary}):
+        points = [s for s in summary if s["sample"] == sample]
+        ax.plot(
+            [s["threads"] for s in points],
+            [s["events_per_s"] for s in points],
+            "o-",
+            label=sample,
+        )
+    ax.set_xlabel("threads")
+    ax.set_ylabel("events/s")
+    ax.legend()
+    fig.savefig(path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Full chain throughput benchmark")
+    parser.add_argument(
+        "--output",
+        "-o",
+        type=pathlib.Path,
+        default=pathlib.Path.cwd() / "full_chain_benchmark",
+        help="Output directory",
+    )
+    parser.add_argument(
+        "--samples",
+        nargs="+",
+        choices=sampleArguments.keys(),
+        default=["gun"],
+        help="Samples to run",
+    )
+    parser.add_argument(
+        "--threads",
+        nargs="+",
+        type=int,
+        default=defaultThreads(),
+        help="Thread counts of the scaling curve",
+    )
+    parser.add_argument(
+        "--events", "-n", type=int, default=100, help="Number of events per run"
+    )
+    parser.add_argument(
+        "--repeat", type=int, default=3, help="Repetitions of each configuration"
+    )
+    parser.add_argument(
+        "--compare", type=pathlib.Path, help="Results of a reference commit"
+    )
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=0.05,
+        help="Allowed relative throughput drop with respect to the reference",
+    )
+    parser.add_argument(
+        "--plot", action="store_true", help="Plot the thread scaling curves"
+    )
+    args = parser.parse_args()
+
+    runs = []
+    for sample in args.samples:
+        for threads in args.threads:
+            for i in range(args.repeat):
+                runDir = args.output / f"{sample}_{threads}threads_{i}"
+                print(
+                    f"Running {sample} with {threads} threads ({i + 1}/{args.repeat})"
+                )
+                runs.append(run(sample, threads, args.events, runDir))
+
+    summary = summarize(runs)
+    results = {
+        "commit": gitCommit(),
+        "host": platform.node(),
+        "machine": platform.machine(),
+        "cpus": os.cpu_count(),
+        "events": args.events,
+        "summary": summary,
+        "runs": runs,
+    }
+    with open(args.output / "results.json", "w") as f:
+        json.dump(results, f, indent=2)
+
+    printSummary(summary)
+    if args.plot:
+        plotScaling(summary, args.output / "thread_scaling.pdf")
+
+    if args.compare:
+        with open(args.compare) as f:
+            reference = json.load(f)
+        if not compare(summary, reference, args.tolerance):
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
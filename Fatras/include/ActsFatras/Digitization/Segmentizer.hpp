@@ -53,6 +53,14 @@ struct Segmentizer {
           intersect(std::move(intersect_)),
           path((intersect - start).norm()) {}
 
+    /// Constructor with arguments for a ChannelStep with known path length.
+    ///
+    /// @param delta_ The bin delta for this step
+    /// @param intersect_ The intersect with the channel boundary
+    /// @param path_ The path length from the start of the surface segment
+    ChannelStep(BinDelta2D delta_, Acts::Vector2 intersect_, double path_)
+        : delta(delta_), intersect(std::move(intersect_)), path(path_) {}
+
     /// Smaller operator for sorting the ChannelStep objects.
     ///
     /// @param cstep The other ChannelStep to be compared
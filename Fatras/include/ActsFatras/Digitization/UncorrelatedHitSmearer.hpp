@@ -18,6 +18,7 @@
 #include <array>
 #include <functional>
 #include <utility>
+#include <vector>
 
 namespace ActsFatras {
 
@@ -64,27 +65,73 @@ struct BoundParametersSmearer {
   Result operator()(generator_t& rng, const Hit& hit,
                     const Acts::Surface& surface,
                     const Acts::GeometryContext& geoCtx) const {
-    // We use the thickness of the detector element as tolerance, because Geant4
-    // treats the Surfaces as volumes and thus it is not ensured, that each hit
-    // lies exactly on the Acts::Surface
-    const auto tolerance =
-        surface.associatedDetectorElement() != nullptr
-            ? surface.associatedDetectorElement()->thickness()
-            : Acts::s_onSurfaceTolerance;
-
-    // construct full bound parameters. they are probably not all needed, but it
-    // is easier to just create them all and then select the requested ones.
-    Acts::Result<Acts::BoundVector> boundParamsRes =
-        Acts::transformFreeToBoundParameters(hit.position(), hit.time(),
-                                             hit.direction(), 0, surface,
-                                             geoCtx, tolerance);
-
+    auto boundParamsRes =
+        boundParameters(hit, surface, geoCtx, tolerance(surface));
     if (!boundParamsRes.ok()) {
       return boundParamsRes.error();
     }
+    return smear(rng, *boundParamsRes);
+  }
 
-    const auto& boundParams = *boundParamsRes;
+  /// Generate smeared measurements for several hits on the same surface.
+  ///
+  /// The surface dependent setup is done once, then all hits are transformed
+  /// to bound parameters before any of them is smeared. The random numbers
+  /// are consumed in hit order, i.e. the results are identical to calling
+  /// the single hit operator for each hit in turn.
+  ///
+  /// @tparam hit_range_t Range of elements convertible to `const Hit&`
+  /// @param rng Random number generator
+  /// @param hits Simulated hits, all on the given surface
+  /// @param surface Local surface on which the hits are smeared
+  /// @param geoCtx Geometry context
+  /// @param results One smeared result per hit is appended
+  template <typename hit_range_t>
+  void operator()(generator_t& rng, const hit_range_t& hits,
+                  const Acts::Surface& surface,
+                  const Acts::GeometryContext& geoCtx,
+                  std::vector<Result>& results) const {
+    const auto tol = tolerance(surface);
+
+    std::vector<Acts::Result<Acts::BoundVector>> boundParams;
+    for (const Hit& hit : hits) {
+      boundParams.push_back(boundParameters(hit, surface, geoCtx, tol));
+    }
+
+    results.reserve(results.size() + boundParams.size());
+    for (const auto& boundParamsRes : boundParams) {
+      if (!boundParamsRes.ok()) {
+        results.push_back(boundParamsRes.error());
+        continue;
+      }
+      results.push_back(smear(rng, *boundParamsRes));
+    }
+  }
+
+ private:
+  /// The on-surface tolerance for hits on the given surface.
+  static Scalar tolerance(const Acts::Surface& surface) {
+    // We use the thickness of the detector element as tolerance, because Geant4
+    // treats the Surfaces as volumes and thus it is not ensured, that each hit
+    // lies exactly on the Acts::Surface
+    return surface.associatedDetectorElement() != nullptr
+               ? surface.associatedDetectorElement()->thickness()
+               : Acts::s_onSurfaceTolerance;
+  }
+
+  /// Construct the full bound parameters of a hit.
+  static Acts::Result<Acts::BoundVector> boundParameters(
+      const Hit& hit, const Acts::Surface& surface,
+      const Acts::GeometryContext& geoCtx, Scalar tol) {
+    // they are probably not all needed, but it is easier to just create them
+    // all and then select the requested ones.
+    return Acts::transformFreeToBoundParameters(hit.position(), hit.time(),
+                                                hit.direction(), 0, surface,
+                                                geoCtx, tol);
+  }
 
+  /// Smear the configured parameters out of the full bound parameters.
+  Result smear(generator_t& rng, const Acts::BoundVector& boundParams) const {
     ParametersVector par = ParametersVector::Zero();
     CovarianceMatrix cov = CovarianceMatrix::Zero();
     for (int i = 0; i < static_cast<int>(kSize); ++i) {
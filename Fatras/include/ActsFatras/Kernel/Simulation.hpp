@@ -70,12 +70,13 @@ struct SingleParticleSimulation {
   /// @param magCtx is the magnetic field context to access field values
   /// @param generator is the random number generator
   /// @param particle is the initial particle state
+  /// @param recycled is an optional previous result whose containers are reused
   /// @returns Simulated particle state, hits, and generated particles.
   template <typename generator_t>
   Acts::Result<SimulationResult> simulate(
       const Acts::GeometryContext &geoCtx,
       const Acts::MagneticFieldContext &magCtx, generator_t &generator,
-      const Particle &particle) const {
+      const Particle &particle, SimulationResult *recycled = nullptr) const {
     // propagator-related additional types
     using Actor = detail::SimulationActor<generator_t, decay_t, interactions_t,
                                           hit_surface_selector_t>;
@@ -96,6 +97,7 @@ struct SingleParticleSimulation {
     actor.interactions = interactions;
     actor.selectHitSurface = selectHitSurface;
     actor.initialParticle = particle;
+    actor.recycled = recycled;
 
     if (particle.hasReferenceSurface()) {
       auto result = propagator.propagate(
@@ -199,62 +201,15 @@ struct Simulation {
         (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) &&
         "Inconsistent initial sizes of the simulated particle containers");
 
-    using SingleParticleSimulationResult = Acts::Result<SimulationResult>;
-
     std::vector<FailedParticle> failedParticles;
 
     for (const Particle &inputParticle : inputParticles) {
-      // only consider simulatable particles
-      if (!selectParticle(inputParticle)) {
-        continue;
-      }
-      // required to allow correct particle id numbering for secondaries later
-      if ((inputParticle.particleId().generation() != 0u) ||
-          (inputParticle.particleId().subParticle() != 0u)) {
-        return detail::SimulationError::eInvalidInputParticleId;
-      }
-
-      // Do a *depth-first* simulation of the particle and its secondaries,
-      // i.e. we simulate all secondaries, tertiaries, ... before simulating
-      // the next primary particle. Use the end of the output container as
-      // a queue to store particles that should be simulated.
-      //
-      // WARNING the initial particle state output container will be modified
-      //         during iteration. New secondaries are added to and failed
-      //         particles might be removed. To avoid issues, access must always
-      //         occur via indices.
-      auto iinitial = simulatedParticlesInitial.size();
-      simulatedParticlesInitial.push_back(inputParticle);
-      for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
-        const auto &initialParticle = simulatedParticlesInitial[iinitial];
-
-        // only simulatable particles are pushed to the container and here we
-        // only need to switch between charged/neutral.
-        SingleParticleSimulationResult result =
-            SingleParticleSimulationResult::success({});
-        if (initialParticle.charge() != Particle::Scalar{0}) {
-          result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
-        } else {
-          result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
-        }
-
-        if (!result.ok()) {
-          // remove particle from output container since it was not simulated.
-          simulatedParticlesInitial.erase(
-              std::next(simulatedParticlesInitial.begin(), iinitial));
-          // record the particle as failed
-          failedParticles.push_back({initialParticle, result.error()});
-          continue;
-        }
-
-        copyOutputs(result.value(), simulatedParticlesInitial,
-                    simulatedParticlesFinal, hits);
-        // since physics processes are independent, there can be particle id
-        // collisions within the generated secondaries. they can be resolved by
-        // renumbering within each sub-particle generation. this must happen
-        // before the particle is simulated since the particle id is used to
-        // associate generated hits back to the particle.
-        renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+      auto result = simulateParticle(geoCtx, magCtx, generator, inputParticle,
+                                     simulatedParticlesInitial,
+                                     simulatedParticlesFinal, hits,
+                                     failedParticles);
+      if (!result.ok()) {
+        return result.error();
       }
     }
 
@@ -265,6 +220,104 @@ struct Simulation {
     return failedParticles;
   }
 
+  /// Simulate a single input particle and all its generated secondaries.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param generator is the random number generator
+  /// @param inputParticle is the particle that should be simulated
+  /// @param simulatedParticlesInitial contains initial particle states
+  /// @param simulatedParticlesFinal contains final particle states
+  /// @param hits contains all generated hits
+  /// @param failedParticles contains the particles that failed to simulate
+  /// @retval Acts::Result::Error if there is a fundamental issue
+  ///
+  /// This is the building block of `simulate` and appends the outputs of the
+  /// input particle to the given containers. Input particles do not depend on
+  /// each other, i.e. different input particles can be simulated concurrently
+  /// as long as each uses its own generator and output containers.
+  ///
+  /// @tparam generator_t is the type of the random number generator
+  /// @tparam output_particles_t is a SequenceContainer for particles
+  /// @tparam hits_t is a SequenceContainer for hits
+  template <typename generator_t, typename output_particles_t,
+            typename hits_t>
+  Acts::Result<void> simulateParticle(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, generator_t &generator,
+      const Particle &inputParticle,
+      output_particles_t &simulatedParticlesInitial,
+      output_particles_t &simulatedParticlesFinal, hits_t &hits,
+      std::vector<FailedParticle> &failedParticles) const {
+    using SingleParticleSimulationResult = Acts::Result<SimulationResult>;
+
+    // the containers of the single particle results are recycled for all
+    // particles simulated on this thread, such that they stop allocating
+    // once they have grown to the largest particle
+    static thread_local SimulationResult recycled;
+
+    // only consider simulatable particles
+    if (!selectParticle(inputParticle)) {
+      return Acts::Result<void>::success();
+    }
+    // required to allow correct particle id numbering for secondaries later
+    if ((inputParticle.particleId().generation() != 0u) ||
+        (inputParticle.particleId().subParticle() != 0u)) {
+      return detail::SimulationError::eInvalidInputParticleId;
+    }
+
+    // Do a *depth-first* simulation of the particle and its secondaries,
+    // i.e. we simulate all secondaries, tertiaries, ... before simulating
+    // the next primary particle. Use the end of the output container as
+    // a queue to store particles that should be simulated.
+    //
+    // WARNING the initial particle state output container will be modified
+    //         during iteration. New secondaries are added to and failed
+    //         particles might be removed. To avoid issues, access must always
+    //         occur via indices.
+    auto iinitial = simulatedParticlesInitial.size();
+    simulatedParticlesInitial.push_back(inputParticle);
+    for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
+      const auto &initialParticle = simulatedParticlesInitial[iinitial];
+
+      // only simulatable particles are pushed to the container and here we
+      // only need to switch between charged/neutral.
+      SingleParticleSimulationResult result =
+          SingleParticleSimulationResult::success({});
+      if (initialParticle.charge() != Particle::Scalar{0}) {
+        result = charged.simulate(geoCtx, magCtx, generator, initialParticle,
+                                  &recycled);
+      } else {
+        result = neutral.simulate(geoCtx, magCtx, generator, initialParticle,
+                                  &recycled);
+      }
+
+      if (!result.ok()) {
+        // record the particle as failed
+        failedParticles.push_back({initialParticle, result.error()});
+        // remove particle from output container since it was not simulated.
+        simulatedParticlesInitial.erase(
+            std::next(simulatedParticlesInitial.begin(), iinitial));
+        continue;
+      }
+
+      copyOutputs(result.value(), simulatedParticlesInitial,
+                  simulatedParticlesFinal, hits);
+      // hand the containers back for the next particle
+      recycled.generatedParticles =
+          std::move(result.value().generatedParticles);
+      recycled.hits = std::move(result.value().hits);
+      // since physics processes are independent, there can be particle id
+      // collisions within the generated secondaries. they can be resolved by
+      // renumbering within each sub-particle generation. this must happen
+      // before the particle is simulated since the particle id is used to
+      // associate generated hits back to the particle.
+      renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+    }
+
+    return Acts::Result<void>::success();
+  }
+
  private:
   /// Select if the particle should be simulated at all.
   bool selectParticle(const Particle &particle) const {
@@ -69,6 +69,12 @@ struct SimulationActor {
   hit_surface_selector_t selectHitSurface;
   /// Initial particle state.
   Particle initialParticle;
+  /// Optional result whose allocated containers are reused.
+  ///
+  /// Its (empty) generated particles and hits containers are moved into the
+  /// result at the first step, such that the result does not need to allocate
+  /// again once the containers have grown large enough.
+  SimulationResult *recycled = nullptr;
 
   /// Relative tolerance of the particles proper time limit
   Particle::Scalar properTimeRelativeTolerance = 1e-3;
@@ -113,6 +119,12 @@ struct SimulationActor {
     if (std::isnan(result.properTimeLimit)) {
       // first step is special: there is no previous state and we need to arm
       // the decay simulation for all future steps.
+      if (recycled != nullptr) {
+        result.generatedParticles = std::move(recycled->generatedParticles);
+        result.generatedParticles.clear();
+        result.hits = std::move(recycled->hits);
+        result.hits.clear();
+      }
       result.particle =
           makeParticle(initialParticle, state, stepper, navigator);
       result.properTimeLimit =
@@ -154,17 +154,17 @@ struct NuclearInteraction {
             samplePdgIds(generator, parametrisation.pdgMap, multiplicity,
                          particle.pdg(), interactSoft);
 
-        // Construct the particles
-        const auto particles = convertParametersToParticles(
-            generator, pdgIds, kinematics->first, kinematics->second, particle,
-            parametrisation.momentum, interactSoft);
+        // Construct the particles directly in the output container
+        convertParametersToParticles(generator, pdgIds, kinematics->first,
+                                     kinematics->second, particle,
+                                     parametrisation.momentum, interactSoft,
+                                     generated);
 
         // Kill the particle in a hard process
         if (!interactSoft) {
           particle.setAbsoluteMomentum(0);
         }
 
-        generated.insert(generated.end(), particles.begin(), particles.end());
         return !interactSoft;
       }
     }
@@ -222,6 +222,17 @@ struct NuclearInteraction {
       const detail::NuclearInteractionParameters::PdgMap& pdgMap,
       unsigned int multiplicity, int particlePdg, bool soft) const;
 
+  /// Retrieves the branching probabilities of a producer
+  ///
+  /// @param [in] pdgMap The branching probability map
+  /// @param [in] producerPdg The PDG ID of the producing particle
+  ///
+  /// @return Pointer to the branching probabilities, nullptr if the producer
+  /// is not part of the map
+  const std::vector<std::pair<int, float>>* findBranching(
+      const detail::NuclearInteractionParameters::PdgMap& pdgMap,
+      int producerPdg) const;
+
   /// Evaluates the final state invariant masses
   ///
   /// @tparam generator_t The random number generator type
@@ -306,14 +317,14 @@ struct NuclearInteraction {
   /// @param [in] initialParticle The initial particle
   /// @param [in] parametrizedMomentum Momentum of the parametrisation
   /// @param [in] soft Treat it as soft or hard nuclear interaction
-  ///
-  /// @return Vector containing the final state particles
+  /// @param [out] generated Container the final state particles are appended to
   template <typename generator_t>
-  std::vector<Particle> convertParametersToParticles(
+  void convertParametersToParticles(
       generator_t& generator, const std::vector<int>& pdgId,
       const Acts::ActsDynamicVector& momenta,
       const Acts::ActsDynamicVector& invariantMasses, Particle& initialParticle,
-      float parametrizedMomentum, bool soft) const;
+      float parametrizedMomentum, bool soft,
+      std::vector<Particle>& generated) const;
 
   /// This function performs an inverse sampling to provide a discrete
   /// value from a distribution.
@@ -359,45 +370,48 @@ std::vector<int> NuclearInteraction::samplePdgIds(
 
   std::uniform_real_distribution<float> uniformDistribution{0., 1.};
 
-  // Find the producers probability distribution
-  auto citProducer = pdgMap.cbegin();
-  while (citProducer->first != particlePdg && citProducer != pdgMap.end()) {
-    citProducer++;
-  }
+  // The branching probabilities of the last looked up producer. Consecutive
+  // particles of the same type are frequent, so the lookup is only repeated
+  // when the producer changes.
+  int lastProducer = particlePdg;
+  const std::vector<std::pair<int, float>>* branching = findBranching(pdgMap, lastProducer);
+
+  // Dice a particle type from the branching of the producer. Without a
+  // branching the produced particle keeps the type of its producer.
+  auto dice = [&]() {
+    if (branching == nullptr || branching->empty()) {
+      return lastProducer;
+    }
+    const float rnd = uniformDistribution(generator);
+    auto it = std::lower_bound(
+        branching->begin(), branching->end(), rnd,
+        [](const std::pair<int, float>& element, float random) {
+          return element.second < random;
+        });
+    // Protect against rounding in the last bin of the cumulative distribution
+    return (it != branching->end() ? it : std::prev(branching->end()))->first;
+  };
 
-  const std::vector<std::pair<int, float>>& mapInitial = citProducer->second;
   // Set the first particle depending on the interaction type
   if (soft) {
     // Store the initial particle if the interaction is soft
     pdgIds.push_back(particlePdg);
   } else {
     // Otherwise dice the particle
-    const float rndInitial = uniformDistribution(generator);
-
-    pdgIds.push_back(
-        std::lower_bound(mapInitial.begin(), mapInitial.end(), rndInitial,
-                         [](const std::pair<int, float>& element,
-                            float random) { return element.second < random; })
-            ->first);
+    pdgIds.push_back(dice());
   }
 
   // Set the remaining particles
   for (unsigned int i = 1; i < multiplicity; i++) {
     // Find the producers probability distribution from the last produced
     // particle
-    citProducer = pdgMap.cbegin();
-    while (citProducer->first != pdgIds[i - 1] && citProducer != pdgMap.end()) {
-      citProducer++;
+    if (pdgIds[i - 1] != lastProducer) {
+      lastProducer = pdgIds[i - 1];
+      branching = findBranching(pdgMap, lastProducer);
     }
 
     // Set the next particle
-    const std::vector<std::pair<int, float>>& map = citProducer->second;
-    const float rnd = uniformDistribution(generator);
-    pdgIds.push_back(
-        std::lower_bound(map.begin(), map.end(), rnd,
-                         [](const std::pair<int, float>& element,
-                            float random) { return element.second < random; })
-            ->first);
+    pdgIds.push_back(dice());
   }
   return pdgIds;
 }
@@ -496,19 +510,18 @@ NuclearInteraction::sampleKinematics(
 }
 
 template <typename generator_t>
-std::vector<Particle> NuclearInteraction::convertParametersToParticles(
+void NuclearInteraction::convertParametersToParticles(
     generator_t& generator, const std::vector<int>& pdgId,
     const Acts::ActsDynamicVector& momenta,
     const Acts::ActsDynamicVector& invariantMasses, Particle& initialParticle,
-    float parametrizedMomentum, bool soft) const {
+    float parametrizedMomentum, bool soft,
+    std::vector<Particle>& generated) const {
   std::uniform_real_distribution<double> uniformDistribution{0., 1.};
   const auto& initialDirection = initialParticle.direction();
   const double phi = Acts::VectorHelpers::phi(initialDirection);
   const double theta = Acts::VectorHelpers::theta(initialDirection);
   const unsigned int size = momenta.size();
 
-  std::vector<Particle> result;
-  result.reserve(size);
 
   // Build the particles
   for (unsigned int i = 0; i < size; i++) {
@@ -535,10 +548,8 @@ std::vector<Particle> NuclearInteraction::convertParametersToParticles(
     if (i == 0 && soft) {
       initialParticle = p;
     } else {
-      result.push_back(std::move(p));
+      generated.push_back(std::move(p));
     }
   }
-
-  return result;
 }
 }  // namespace ActsFatras
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <memory>
 
 std::vector<ActsFatras::Segmentizer::ChannelSegment>
@@ -50,33 +51,57 @@ ActsFatras::Segmentizer::segments(const Acts::GeometryContext& geoCtx,
     if (bstart == bend) {
       return {ChannelSegment(bstart, {start, end}, segment2d.norm())};
     }
-    // The lines channel segment lines along x
-    if (bstart[0] != bend[0]) {
-      double k = segment2d.y() / segment2d.x();
-      double d = start.y() - k * start.x();
-
-      const auto& xboundaries = segmentation.binningData()[0].boundaries();
-      std::vector<double> xbbounds = {
-          xboundaries.begin() + std::min(bstart[0], bend[0]) + 1,
-          xboundaries.begin() + std::max(bstart[0], bend[0]) + 1};
-      for (const auto x : xbbounds) {
-        cSteps.push_back(ChannelStep{
-            {(bstart[0] < bend[0] ? 1 : -1), 0}, {x, k * x + d}, start});
-      }
-    }
-    // The lines channel segment lines along y
-    if (bstart[1] != bend[1]) {
-      double k = segment2d.x() / segment2d.y();
-      double d = start.x() - k * start.y();
-      const auto& yboundaries = segmentation.binningData()[1].boundaries();
-      std::vector<double> ybbounds = {
-          yboundaries.begin() + std::min(bstart[1], bend[1]) + 1,
-          yboundaries.begin() + std::max(bstart[1], bend[1]) + 1};
-      for (const auto y : ybbounds) {
-        cSteps.push_back(ChannelStep{
-            {0, (bstart[1] < bend[1] ? 1 : -1)}, {k * y + d, y}, start});
+    // Walk the grid lines in the order they are crossed: the crossings with
+    // the x and with the y boundaries are each ordered along the segment, so
+    // merging both sequences yields the ordered steps without sorting. The
+    // crossings are parametrised as a fraction of the segment, which gives
+    // the path length without a norm per step.
+    const auto& xboundaries = segmentation.binningData()[0].boundaries();
+    const auto& yboundaries = segmentation.binningData()[1].boundaries();
+    const int dx = (bstart[0] < bend[0]) ? 1 : -1;
+    const int dy = (bstart[1] < bend[1]) ? 1 : -1;
+    const unsigned int nx = (dx > 0) ? bend[0] - bstart[0]
+                                     : bstart[0] - bend[0];
+    const unsigned int ny = (dy > 0) ? bend[1] - bstart[1]
+                                     : bstart[1] - bend[1];
+    // The boundary crossed with the i-th step in x and y, respectively
+    auto xBoundary = [&](unsigned int i) {
+      return xboundaries[(dx > 0) ? bstart[0] + 1 + i : bstart[0] - i];
+    };
+    auto yBoundary = [&](unsigned int i) {
+      return yboundaries[(dy > 0) ? bstart[1] + 1 + i : bstart[1] - i];
+    };
+    auto xFraction = [&](unsigned int i) {
+      return (i < nx) ? (xBoundary(i) - start.x()) / segment2d.x()
+                      : std::numeric_limits<double>::infinity();
+    };
+    auto yFraction = [&](unsigned int i) {
+      return (i < ny) ? (yBoundary(i) - start.y()) / segment2d.y()
+                      : std::numeric_limits<double>::infinity();
+    };
+
+    const double length = segment2d.norm();
+    cSteps.reserve(nx + ny + 1);
+    unsigned int ix = 0;
+    unsigned int iy = 0;
+    double tx = xFraction(ix);
+    double ty = yFraction(iy);
+    while (ix < nx || iy < ny) {
+      if (tx <= ty) {
+        cSteps.emplace_back(
+            BinDelta2D{dx, 0},
+            Acts::Vector2(xBoundary(ix), start.y() + tx * segment2d.y()),
+            tx * length);
+        tx = xFraction(++ix);
+      } else {
+        cSteps.emplace_back(
+            BinDelta2D{0, dy},
+            Acts::Vector2(start.x() + ty * segment2d.x(), yBoundary(iy)),
+            ty * length);
+        ty = yFraction(++iy);
       }
     }
+    cSteps.emplace_back(BinDelta2D{0, 0}, end, length);
 
   } else if (surface.type() == Acts::Surface::SurfaceType::Disc) {
     Acts::Vector2 pstart(Acts::VectorHelpers::perp(start),
@@ -134,12 +159,12 @@ ActsFatras::Segmentizer::segments(const Acts::GeometryContext& geoCtx,
                                      start});
       }
     }
-  }
 
-  // Register the last step if successful
-  if (!cSteps.empty()) {
-    cSteps.push_back(ChannelStep({0, 0}, end, start));
-    std::sort(cSteps.begin(), cSteps.end());
+    // Register the last step if successful
+    if (!cSteps.empty()) {
+      cSteps.push_back(ChannelStep({0, 0}, end, start));
+      std::sort(cSteps.begin(), cSteps.end());
+    }
   }
 
   std::vector<ChannelSegment> cSegments;
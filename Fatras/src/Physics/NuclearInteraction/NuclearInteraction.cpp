@@ -108,6 +108,15 @@ unsigned int NuclearInteraction::finalStateMultiplicity(
   return sampleDiscreteValues(rnd, distribution);
 }
 
+const std::vector<std::pair<int, float>>* NuclearInteraction::findBranching(
+    const detail::NuclearInteractionParameters::PdgMap& pdgMap,
+    int producerPdg) const {
+  const auto it = std::find_if(
+      pdgMap.begin(), pdgMap.end(),
+      [&](const auto& element) { return element.first == producerPdg; });
+  return (it != pdgMap.end()) ? &it->second : nullptr;
+}
+
 std::pair<ActsFatras::Particle::Scalar, ActsFatras::Particle::Scalar>
 NuclearInteraction::globalAngle(ActsFatras::Particle::Scalar phi1,
                                 ActsFatras::Particle::Scalar theta1, float phi2,
@@ -0,0 +1,139 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// Acts include(s).
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+// CUDA plugin include(s).
+#include "Acts/Plugins/Cuda/Seeding2/Details/Types.hpp"
+#include "Acts/Plugins/Cuda/Utilities/Arrays.hpp"
+#include "Acts/Plugins/Cuda/Utilities/StreamWrapper.hpp"
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Acts {
+namespace Cuda {
+
+/// CUDA implementation of pixel clusterization and space point formation
+///
+/// The cells of all modules of an event are uploaded once. One block per
+/// module labels the connected cells, in the same way as
+/// @c Acts::Ccl::Connect2D, by propagating the smallest cell index through
+/// the cluster. The clusters are then numbered in cell order, their
+/// activation weighted centroids are computed and transformed into global
+/// space points of the type used by the CUDA seed finder.
+///
+/// The space points and the module index of each of them stay on the device.
+/// They are allocated through @c Acts::Cuda::MemoryManager, and are therefore
+/// only valid until its next reset, which e.g. happens at the end of every
+/// @c Acts::Cuda::SeedFinder::createSeedsForGroup call.
+///
+class PixelSpacePointMaker {
+ public:
+  /// The configuration struct
+  struct Config {
+    /// Connect cells that only share a corner (8-cell connectivity)
+    bool commonCorner = true;
+    /// The maximum block size to use on the GPU
+    int maxBlockSize = 256;
+  };
+
+  /// Geometry of a single pixel module
+  struct Module {
+    /// Rotation of the local to global transform, row by row
+    std::array<float, 9> rotation{};
+    /// Translation of the local to global transform
+    std::array<float, 3> translation{};
+    /// Lower edges of the two local bin axes
+    std::array<float, 2> min{};
+    /// Pitches of the two local bin axes
+    std::array<float, 2> pitch{};
+
+    /// Create the module geometry
+    ///
+    /// @param transform The local to global transform of the module surface
+    /// @param segmentation The equidistant 2-D segmentation of the module
+    ///
+    static Module create(const Transform3& transform,
+                         const BinUtility& segmentation);
+  };
+
+  /// A single activated cell
+  struct Cell {
+    /// Index of the module in the module list
+    unsigned int module = 0;
+    /// Bin along the first local axis
+    int bin0 = 0;
+    /// Bin along the second local axis
+    int bin1 = 0;
+    /// Activation, used as the weight in the cluster centroid
+    float activation = 1.f;
+  };
+
+  /// The space points of one event on the device
+  struct Result {
+    /// The number of space points, i.e. clusters
+    std::size_t nSpacePoints = 0;
+    /// The space points, in the order of their first cell
+    device_array<Details::SpacePoint> spacePoints;
+    /// The module index of each space point
+    device_array<unsigned int> modules;
+  };
+
+  /// Create a CUDA backed pixel space point maker
+  ///
+  /// @param cfg The configuration
+  /// @param device The identifier of the CUDA device to run on
+  /// @param logger A @c Logger instance
+  ///
+  PixelSpacePointMaker(const Config& cfg, int device = 0,
+                       std::unique_ptr<const Logger> logger = getDefaultLogger(
+                           "Cuda::PixelSpacePointMaker", Logging::INFO));
+
+  /// Cluster the cells and create one space point per cluster
+  ///
+  /// @param modules The geometry of all modules
+  /// @param cells The activated cells, grouped by module
+  /// @return The space points on the device
+  ///
+  Result makeSpacePoints(const std::vector<Module>& modules,
+                         const std::vector<Cell>& cells) const;
+
+  /// Copy the space points of a result to the host
+  ///
+  /// @param result The result of @c makeSpacePoints
+  /// @return The space points, in the same order as on the device
+  ///
+  std::vector<Details::SpacePoint> copyToHost(const Result& result) const;
+
+ private:
+  /// Private access to the logger
+  ///
+  /// @return a const reference to the logger
+  const Logger& logger() const { return *m_logger; }
+
+  /// The configuration
+  Config m_cfg;
+  /// CUDA device identifier
+  int m_device;
+  /// The stream that all copies and kernels of the object are scheduled in
+  StreamWrapper m_stream;
+  /// The logger object
+  std::unique_ptr<const Logger> m_logger;
+};
+
+}  // namespace Cuda
+}  // namespace Acts
@@ -33,12 +33,14 @@ namespace Details {
 ///        @c Acts::Cuda::Details::findDublets(...) function with the same name
 /// @param middleTopCounts The output from the
 ///        @c Acts::Cuda::Details::findDublets(...) function with the same name
+/// @param stream The stream to schedule the reduction in
 /// @return An object holding all the summary statistics necessary for the
 ///         subsequent steps of GPU execution
 ///
 DubletCounts countDublets(std::size_t maxBlockSize, std::size_t nMiddleSP,
                           const device_array<unsigned int>& middleBottomCounts,
-                          const device_array<unsigned int>& middleTopCounts);
+                          const device_array<unsigned int>& middleTopCounts,
+                          const StreamWrapper& stream);
 
 }  // namespace Details
 }  // namespace Cuda
@@ -55,6 +55,7 @@ namespace Details {
 /// @param[out] middleTopDublets 2-D matrix of size
 ///             @c nMiddleSPs x @c nTopSPs, holding the top spacepoint
 ///             indices for the identified middle-top dublets
+/// @param[in] stream The stream to schedule the kernels in
 ///
 void findDublets(std::size_t maxBlockSize, std::size_t nBottomSPs,
                  const device_array<SpacePoint>& bottomSPs,
@@ -66,7 +67,8 @@ void findDublets(std::size_t maxBlockSize, std::size_t nBottomSPs,
                  device_array<unsigned int>& middleBottomCounts,
                  device_array<std::size_t>& middleBottomDublets,
                  device_array<unsigned int>& middleTopCounts,
-                 device_array<std::size_t>& middleTopDublets);
+                 device_array<std::size_t>& middleTopDublets,
+                 const StreamWrapper& stream);
 
 }  // namespace Details
 }  // namespace Cuda
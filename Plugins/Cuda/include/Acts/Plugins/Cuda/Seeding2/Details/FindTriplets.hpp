@@ -68,6 +68,7 @@ namespace Details {
 /// @param[in] pT2perRadius Configuration parameter from
 ///            @c Acts::SeedFinderConfig
 /// @param[in] impactMax Configuration parameter from @c Acts::SeedFinderConfig
+/// @param[in] stream The stream to schedule the kernels and copies in
 /// @return A 2-D structure holding the parameters of the identified triplets
 ///         for each middle spacepoint
 ///
@@ -83,7 +84,7 @@ std::vector<std::vector<Triplet> > findTriplets(
     const device_array<unsigned int>& middleTopCounts,
     const device_array<std::size_t>& middleTopDublets,
     float maxScatteringAngle2, float sigmaScattering, float minHelixDiameter2,
-    float pT2perRadius, float impactMax);
+    float pT2perRadius, float impactMax, const StreamWrapper& stream);
 
 }  // namespace Details
 }  // namespace Cuda
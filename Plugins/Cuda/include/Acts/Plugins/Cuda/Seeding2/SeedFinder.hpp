@@ -9,7 +9,10 @@
 #pragma once
 
 // CUDA plugin include(s).
+#include "Acts/Plugins/Cuda/Seeding2/Details/Types.hpp"
 #include "Acts/Plugins/Cuda/Seeding2/TripletFilterConfig.hpp"
+#include "Acts/Plugins/Cuda/Utilities/Arrays.hpp"
+#include "Acts/Plugins/Cuda/Utilities/StreamWrapper.hpp"
 
 // Acts include(s).
 #include "Acts/EventData/SpacePointData.hpp"
@@ -20,7 +23,9 @@
 #include "Acts/Utilities/Logger.hpp"
 
 // System include(s).
+#include <cstddef>
 #include <memory>
+#include <mutex>
 
 namespace Acts {
 namespace Cuda {
@@ -50,12 +55,12 @@ class SeedFinder {
                  getDefaultLogger("Cuda::SeedFinder", Logging::INFO));
 
   /// Create all seeds from the space points in the three iterators.
-  /// Can be used to parallelize the seed creation
+  /// Calls on the same object are serialised, since they share the CUDA
+  /// stream and the host staging buffers.
   /// @param bottomSPs group of space points to be used as innermost SP in a seed.
   /// @param middleSPs group of space points to be used as middle SP in a seed.
   /// @param topSPs group of space points to be used as outermost SP in a seed.
   /// Ranges must return pointers.
-  /// Ranges must be separate objects for each parallel call.
   /// @return vector in which all found seeds for this group are stored.
   template <typename sp_range_t>
   std::vector<Seed<external_spacepoint_t> > createSeedsForGroup(
@@ -70,6 +75,23 @@ class SeedFinder {
   void setLogger(std::unique_ptr<const Logger> newLogger);
 
  private:
+  /// Page-locked host array that is kept between the calls, and only
+  /// reallocated when a group needs more elements than it holds
+  template <typename T>
+  struct PinnedBuffer {
+    host_array<T> array;
+    std::size_t capacity = 0;
+
+    /// Get the array with room for at least @p size elements
+    host_array<T>& reserve(std::size_t size) {
+      if (size > capacity) {
+        array = make_pinned_host_array<T>(size);
+        capacity = size;
+      }
+      return array;
+    }
+  };
+
   /// Private access to the logger
   ///
   /// @return a const reference to the logger
@@ -84,6 +106,19 @@ class SeedFinder {
   TripletFilterConfig m_tripletFilterConfig;
   /// CUDA device identifier
   int m_device;
+  /// The stream that all copies and kernels of the object are scheduled in
+  ///
+  /// Using a dedicated (non-blocking) stream instead of the default one lets
+  /// the seed finding share the device with other work, without any
+  /// device-wide synchronisation.
+  StreamWrapper m_stream;
+  /// Serialises the calls, which share the stream and the buffers below
+  mutable std::mutex m_mutex;
+  /// Host staging buffers of the space points and dublet counts
+  mutable PinnedBuffer<Details::SpacePoint> m_bottomSPBuffer;
+  mutable PinnedBuffer<Details::SpacePoint> m_middleSPBuffer;
+  mutable PinnedBuffer<Details::SpacePoint> m_topSPBuffer;
+  mutable PinnedBuffer<unsigned int> m_dubletCountsBuffer;
   /// The logger object
   std::unique_ptr<const Logger> m_logger;
 };
@@ -41,6 +41,7 @@ SeedFinder<external_spacepoint_t>::SeedFinder(
       m_seedFilterConfig(seedFilterConfig),
       m_tripletFilterConfig(tripletFilterConfig),
       m_device(device),
+      m_stream(nullptr, false),
       m_logger(std::move(incomingLogger)) {
   if (not m_commonConfig.isInInternalUnits)
     throw std::runtime_error(
@@ -75,6 +76,9 @@ SeedFinder<external_spacepoint_t>::SeedFinder(
     ACTS_FATAL("Invalid CUDA device requested");
     throw std::runtime_error("Invalid CUDA device requested");
   }
+
+  // Create the stream used by the object.
+  m_stream = createStreamFor(Info::instance().devices()[m_device]);
 }
 
 template <typename external_spacepoint_t>
@@ -124,11 +128,18 @@ SeedFinder<external_spacepoint_t>::createSeedsForGroup(
     return outputVec;
   }
 
-  // Create helper objects for storing information about the spacepoints on the
-  // host in single memory blobs.
-  auto bottomSPArray = make_host_array<Details::SpacePoint>(bottomSPVec.size());
-  auto middleSPArray = make_host_array<Details::SpacePoint>(middleSPVec.size());
-  auto topSPArray = make_host_array<Details::SpacePoint>(topSPVec.size());
+  // The stream, the staging buffers and the device memory are shared by all
+  // calls on this object.
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Store the information about the spacepoints on the host in single memory
+  // blobs. These are in pinned memory, so that they could be copied to the
+  // device asynchronously. The buffers are kept for the following groups and
+  // events, since allocating pinned memory is expensive. Reusing them is safe
+  // because the host waits for the stream before the end of every call.
+  auto& bottomSPArray = m_bottomSPBuffer.reserve(bottomSPVec.size());
+  auto& middleSPArray = m_middleSPBuffer.reserve(middleSPVec.size());
+  auto& topSPArray = m_topSPBuffer.reserve(topSPVec.size());
 
   // Fill these memory blobs.
   auto fillSPArray = [](Details::SpacePoint* array, const auto& spVec) {
@@ -145,16 +156,20 @@ SeedFinder<external_spacepoint_t>::createSeedsForGroup(
   fillSPArray(middleSPArray.get(), middleSPVec);
   fillSPArray(topSPArray.get(), topSPVec);
 
-  // Copy the memory blobs to the device.
+  // Schedule the copy of the memory blobs to the device. The host does not
+  // wait for these to finish, all subsequent device operations are ordered
+  // with respect to them by the stream.
   auto bottomSPDeviceArray =
       make_device_array<Details::SpacePoint>(bottomSPVec.size());
   auto middleSPDeviceArray =
       make_device_array<Details::SpacePoint>(middleSPVec.size());
   auto topSPDeviceArray =
       make_device_array<Details::SpacePoint>(topSPVec.size());
-  copyToDevice(bottomSPDeviceArray, bottomSPArray, bottomSPVec.size());
-  copyToDevice(middleSPDeviceArray, middleSPArray, middleSPVec.size());
-  copyToDevice(topSPDeviceArray, topSPArray, topSPVec.size());
+  copyToDevice(bottomSPDeviceArray, bottomSPArray, bottomSPVec.size(),
+               m_stream);
+  copyToDevice(middleSPDeviceArray, middleSPArray, middleSPVec.size(),
+               m_stream);
+  copyToDevice(topSPDeviceArray, topSPArray, topSPVec.size(), m_stream);
 
   //---------------------------------
   // GPU Execution
@@ -162,12 +177,14 @@ SeedFinder<external_spacepoint_t>::createSeedsForGroup(
 
   // Matrices holding the counts of the viable bottom-middle and middle-top
   // pairs.
-  auto dubletCountsHost = make_host_array<unsigned int>(middleSPVec.size());
+  auto& dubletCountsHost = m_dubletCountsBuffer.reserve(middleSPVec.size());
   memset(dubletCountsHost.get(), 0, middleSPVec.size() * sizeof(unsigned int));
   auto middleBottomCounts = make_device_array<unsigned int>(middleSPVec.size());
-  copyToDevice(middleBottomCounts, dubletCountsHost, middleSPVec.size());
+  copyToDevice(middleBottomCounts, dubletCountsHost, middleSPVec.size(),
+               m_stream);
   auto middleTopCounts = make_device_array<unsigned int>(middleSPVec.size());
-  copyToDevice(middleTopCounts, dubletCountsHost, middleSPVec.size());
+  copyToDevice(middleTopCounts, dubletCountsHost, middleSPVec.size(),
+               m_stream);
 
   // Matrices holding the indices of the viable bottom-middle and middle-top
   // pairs.
@@ -183,13 +200,13 @@ SeedFinder<external_spacepoint_t>::createSeedsForGroup(
       topSPDeviceArray, m_commonConfig.deltaRMin, m_commonConfig.deltaRMax,
       m_commonConfig.cotThetaMax, m_commonConfig.collisionRegionMin,
       m_commonConfig.collisionRegionMax, middleBottomCounts,
-      middleBottomDublets, middleTopCounts, middleTopDublets);
+      middleBottomDublets, middleTopCounts, middleTopDublets, m_stream);
 
   // Count the number of dublets that we have to launch the subsequent steps
-  // for.
+  // for. This is the first point where the host waits for the device.
   Details::DubletCounts dubletCounts =
       Details::countDublets(m_commonConfig.maxBlockSize, middleSPVec.size(),
-                            middleBottomCounts, middleTopCounts);
+                            middleBottomCounts, middleTopCounts, m_stream);
 
   // If no dublets/triplet candidates have been found, stop here.
   if ((dubletCounts.nDublets == 0) || (dubletCounts.nTriplets == 0)) {
@@ -205,7 +222,7 @@ SeedFinder<external_spacepoint_t>::createSeedsForGroup(
       middleBottomCounts, middleBottomDublets, middleTopCounts,
       middleTopDublets, m_commonConfig.maxScatteringAngle2,
       m_commonConfig.sigmaScattering, m_seedFinderOptions.minHelixDiameter2,
-      m_seedFinderOptions.pT2perRadius, m_commonConfig.impactMax);
+      m_seedFinderOptions.pT2perRadius, m_commonConfig.impactMax, m_stream);
   assert(tripletCandidates.size() == middleSPVec.size());
 
   // Perform the final step of the filtering.
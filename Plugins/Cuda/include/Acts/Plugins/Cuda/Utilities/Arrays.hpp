@@ -30,12 +30,19 @@ class DeviceArrayDeleter {
 
 };  // class DeviceArrayDeleter
 
-/// Class performing the deletion of pinned host memory
+/// Class performing the deletion of (possibly pinned) host memory
 class HostArrayDeleter {
  public:
+  /// Constructor, specifying how the memory was allocated
+  HostArrayDeleter(bool pinned = false) : m_pinned(pinned) {}
+
   /// Operator performing the deletion of the memory
   void operator()(void* ptr);
 
+ private:
+  /// Flag showing whether the memory was allocated as page-locked memory
+  bool m_pinned;
+
 };  // class HostArrayDeleter
 
 }  // namespace Details
@@ -56,6 +63,16 @@ using host_array = std::unique_ptr<T, Details::HostArrayDeleter>;
 template <typename T>
 host_array<T> make_host_array(std::size_t size);
 
+/// Function creating a primitive array in page-locked ("pinned") host memory
+///
+/// Copies between pinned host memory and the device can run asynchronously
+/// with respect to the host, and overlap with kernel executions in other
+/// streams. Allocating pinned memory is expensive though, so this should only
+/// be used for the arrays that are transferred in bulk.
+///
+template <typename T>
+host_array<T> make_pinned_host_array(std::size_t size);
+
 /// Copy one array from the host to the device
 template <typename T>
 void copyToDevice(device_array<T>& dev, const host_array<T>& host,
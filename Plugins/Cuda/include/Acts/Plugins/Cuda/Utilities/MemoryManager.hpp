@@ -10,6 +10,7 @@
 
 // System include(s).
 #include <cstddef>
+#include <mutex>
 #include <vector>
 
 namespace Acts {
@@ -30,8 +31,13 @@ namespace Cuda {
 /// that any calculation will need all allocated memory until the end of that
 /// calculation. At which point all of that memory gets re-purpused in one call.
 ///
-/// The code is not thread safe currently in any shape or form. But there should
-/// be ways of making it at least "thread friendly" later on.
+/// The blob of a device is only allocated with the first request for memory on
+/// it, such that jobs that never use the CUDA plugin on a device, but share it
+/// with other GPU libraries, don't reserve any memory on it.
+///
+/// The bookkeeping is protected by a mutex, but since a reset re-purposes all
+/// memory of a device, concurrent calculations on the same device are still
+/// not supported.
 ///
 class MemoryManager {
  public:
@@ -60,8 +66,16 @@ class MemoryManager {
   static MemoryManager& instance();
 
   /// Set the amount of memory to use on a particular device
+  ///
+  /// The memory is allocated with the next @c allocate call on the device.
   void setMemorySize(std::size_t sizeInBytes, int device = -1);
 
+  /// Get the amount of memory currently handed out on a specific device
+  std::size_t usedMemory(int device = -1) const;
+
+  /// Get the maximum amount of memory used at a time on a specific device
+  std::size_t maxUsage(int device = -1) const;
+
   /// @}
 
   /// @name Functions used internally by the Acts code
@@ -95,8 +109,19 @@ class MemoryManager {
     std::ptrdiff_t m_maxUsage = 0;
   };
 
+  /// Get the state of a device, throwing if no memory size was set for it
+  ///
+  /// @note Must be called with @c m_mutex locked
+  DeviceMemory& deviceMemory(int device);
+  /// Get the state of a device, throwing if no memory size was set for it
+  ///
+  /// @note Must be called with @c m_mutex locked
+  const DeviceMemory& deviceMemory(int device) const;
+
   /// Object holding information about memory allocations on all devices
   std::vector<DeviceMemory> m_memory;
+  /// Mutex protecting @c m_memory
+  mutable std::mutex m_mutex;
 
 };  // class MemoryManager
 
@@ -0,0 +1,106 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// Acts include(s).
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Vertexing/GaussianGridTrackDensity.hpp"
+
+// CUDA plugin include(s).
+#include "Acts/Plugins/Cuda/Utilities/StreamWrapper.hpp"
+
+// System include(s).
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Acts {
+namespace Cuda {
+
+/// CUDA implementation of the seeding of @c Acts::GridDensityVertexFinder
+///
+/// The main density grids of a whole batch of events are filled on the device
+/// concurrently, with one thread per track and track grid bin, and the bin of
+/// the highest density is found with one reduction per event. Only the track
+/// impact parameters are uploaded, and only one z position per event is
+/// downloaded.
+///
+/// The track selection and the density functions are the ones of
+/// @c Acts::GridDensityVertexFinder and @c Acts::GaussianGridTrackDensity.
+/// As the track contributions are summed in an undefined order, the densities
+/// can differ from the host ones by the float rounding. The highest sum
+/// approach of @c Acts::GaussianGridTrackDensity, the seed width estimate and
+/// the removal of single tracks are not supported.
+///
+class GridDensitySeedFinder {
+ public:
+  /// The configuration struct
+  struct Config {
+    /// @param gridDensityConfig_ The configuration of the density grids
+    Config(const GaussianGridTrackDensity::Config& gridDensityConfig_)
+        : gridDensityConfig(gridDensityConfig_) {}
+
+    /// The configuration of the density grids
+    GaussianGridTrackDensity::Config gridDensityConfig;
+
+    /// Maximum d0 impact parameter significance to use a track
+    double maxD0TrackSignificance = 3.5;
+    /// Maximum z0 impact parameter significance to use a track
+    double maxZ0TrackSignificance = 12.;
+    /// The actual corresponding cut values in the algorithm
+    double d0SignificanceCut = maxD0TrackSignificance * maxD0TrackSignificance;
+    double z0SignificanceCut = maxZ0TrackSignificance * maxZ0TrackSignificance;
+
+    /// The maximum block size to use on the GPU
+    int maxBlockSize = 256;
+  };
+
+  /// Create a CUDA backed grid density seed finder object
+  ///
+  /// @param cfg The configuration
+  /// @param device The identifier of the CUDA device to run on
+  /// @param logger A @c Logger instance
+  ///
+  GridDensitySeedFinder(const Config& cfg, int device = 0,
+                        std::unique_ptr<const Logger> logger = getDefaultLogger(
+                            "Cuda::GridDensitySeedFinder", Logging::INFO));
+
+  /// Find the z position of the highest track density of each event
+  ///
+  /// @param events The tracks of each event of the batch
+  /// @return The z position of the seed of each event, or no value if no
+  ///         track of the event contributes to its density grid
+  ///
+  std::vector<std::optional<float>> findSeeds(
+      const std::vector<std::vector<const BoundTrackParameters*>>& events)
+      const;
+
+ private:
+  /// Private access to the logger
+  ///
+  /// @return a const reference to the logger
+  const Logger& logger() const { return *m_logger; }
+
+  /// Check whether a track passes the selection of
+  /// @c Acts::GridDensityVertexFinder
+  bool doesPassTrackSelection(const BoundTrackParameters& trk) const;
+
+  /// The configuration
+  Config m_cfg;
+  /// CUDA device identifier
+  int m_device;
+  /// The stream that all copies and kernels of the object are scheduled in
+  StreamWrapper m_stream;
+  /// The logger object
+  std::unique_ptr<const Logger> m_logger;
+};
+
+}  // namespace Cuda
+}  // namespace Acts
@@ -0,0 +1,375 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// CUDA plugin include(s).
+#include "Acts/Plugins/Cuda/Clusterization/PixelSpacePointMaker.hpp"
+#include "Acts/Plugins/Cuda/Utilities/Arrays.hpp"
+#include "Acts/Plugins/Cuda/Utilities/Info.hpp"
+
+#include "../Utilities/ErrorCheck.cuh"
+#include "../Utilities/StreamHandlers.cuh"
+
+// Acts include(s).
+#include "Acts/Utilities/BinningType.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace Acts {
+namespace Cuda {
+namespace Kernels {
+
+/// Check whether two cells of the same module are connected
+__device__ bool areConnected(int bin0a, int bin1a, int bin0b, int bin1b,
+                             bool commonCorner) {
+  const int delta0 = abs(bin0a - bin0b);
+  const int delta1 = abs(bin1a - bin1b);
+  if (delta0 > 1 || delta1 > 1) {
+    return false;
+  }
+  return commonCorner || (delta0 + delta1) <= 1;
+}
+
+/// Kernel labelling the connected cells of each module
+///
+/// Each block handles one module. Every cell starts with its own index as
+/// label, and takes over the smallest label of its neighbours until no label
+/// changes anymore, such that each cell ends up with the index of the first
+/// cell of its cluster. The root cells, labelled with their own index, are
+/// counted per module.
+///
+/// @param[in] moduleOffsets 1-D array of the first cell of each module, with
+///            the total number of cells as last element
+/// @param[in] bin0s 1-D array of the first bin of each cell
+/// @param[in] bin1s 1-D array of the second bin of each cell
+/// @param[in] commonCorner Whether cells sharing a corner are connected
+/// @param[out] labels 1-D array of the cluster label of each cell
+/// @param[out] clusterCounts 1-D array of the number of clusters per module
+///
+__global__ void labelCells(const unsigned int* moduleOffsets, const int* bin0s,
+                           const int* bin1s, bool commonCorner,
+                           unsigned int* labels, unsigned int* clusterCounts) {
+  __shared__ int changed;
+
+  const unsigned int begin = moduleOffsets[blockIdx.x];
+  const unsigned int end = moduleOffsets[blockIdx.x + 1];
+
+  for (unsigned int i = begin + threadIdx.x; i < end; i += blockDim.x) {
+    labels[i] = i;
+  }
+
+  bool again = true;
+  while (again) {
+    __syncthreads();
+    if (threadIdx.x == 0) {
+      changed = 0;
+    }
+    __syncthreads();
+
+    for (unsigned int i = begin + threadIdx.x; i < end; i += blockDim.x) {
+      unsigned int label = labels[i];
+      for (unsigned int j = begin; j < end; ++j) {
+        if (areConnected(bin0s[i], bin1s[i], bin0s[j], bin1s[j],
+                         commonCorner)) {
+          label = min(label, labels[j]);
+        }
+      }
+      // Labels are always cells of the same cluster, so following them one
+      // step shortens the propagation
+      label = min(label, labels[label]);
+      if (label < labels[i]) {
+        atomicMin(&labels[i], label);
+        changed = 1;
+      }
+    }
+
+    __syncthreads();
+    again = (changed != 0);
+  }
+
+  if (threadIdx.x == 0) {
+    unsigned int nClusters = 0;
+    for (unsigned int i = begin; i < end; ++i) {
+      nClusters += (labels[i] == i) ? 1 : 0;
+    }
+    clusterCounts[blockIdx.x] = nClusters;
+  }
+}
+
+/// Kernel turning the cluster counts into offsets
+///
+/// @param[in] nModules The number of modules
+/// @param[in] clusterCounts 1-D array of the number of clusters per module
+/// @param[out] clusterOffsets 1-D array of the first cluster of each module,
+///             with the total number of clusters as last element
+///
+__global__ void countClusters(unsigned int nModules,
+                              const unsigned int* clusterCounts,
+                              unsigned int* clusterOffsets) {
+  if (blockIdx.x != 0 || threadIdx.x != 0) {
+    return;
+  }
+  unsigned int offset = 0;
+  for (unsigned int m = 0; m < nModules; ++m) {
+    clusterOffsets[m] = offset;
+    offset += clusterCounts[m];
+  }
+  clusterOffsets[nModules] = offset;
+}
+
+/// Kernel creating one space point per cluster
+///
+/// Each block handles one module. The clusters are numbered in the order of
+/// their root cells. The centroid of every cluster is weighted with the cell
+/// activations, and its variance is the one of a single pixel.
+///
+/// @param[in] moduleOffsets 1-D array of the first cell of each module
+/// @param[in] clusterOffsets 1-D array of the first cluster of each module
+/// @param[in] moduleGeometry 1-D array of 16 floats per module: rotation,
+///            translation, lower bin edges and pitches
+/// @param[in] bin0s 1-D array of the first bin of each cell
+/// @param[in] bin1s 1-D array of the second bin of each cell
+/// @param[in] activations 1-D array of the activation of each cell
+/// @param[in] labels 1-D array of the cluster label of each cell
+/// @param[out] clusterIds 1-D array of the cluster index of each root cell
+/// @param[out] spacePoints 1-D array of the space points
+/// @param[out] spacePointModules 1-D array of the module of each space point
+///
+__global__ void buildSpacePoints(
+    const unsigned int* moduleOffsets, const unsigned int* clusterOffsets,
+    const float* moduleGeometry, const int* bin0s, const int* bin1s,
+    const float* activations, const unsigned int* labels,
+    unsigned int* clusterIds, Details::SpacePoint* spacePoints,
+    unsigned int* spacePointModules) {
+  const unsigned int module = blockIdx.x;
+  const unsigned int begin = moduleOffsets[module];
+  const unsigned int end = moduleOffsets[module + 1];
+
+  if (threadIdx.x == 0) {
+    unsigned int id = clusterOffsets[module];
+    for (unsigned int i = begin; i < end; ++i) {
+      if (labels[i] == i) {
+        clusterIds[i] = id++;
+      }
+    }
+  }
+  __syncthreads();
+
+  const float* rot = moduleGeometry + module * 16;
+  const float* trans = rot + 9;
+  const float* lower = rot + 12;
+  const float* pitch = rot + 14;
+
+  for (unsigned int i = begin + threadIdx.x; i < end; i += blockDim.x) {
+    if (labels[i] != i) {
+      continue;
+    }
+    float weight = 0.f;
+    float loc0 = 0.f;
+    float loc1 = 0.f;
+    for (unsigned int j = i; j < end; ++j) {
+      if (labels[j] == i) {
+        weight += activations[j];
+        loc0 += activations[j] * (lower[0] + (bin0s[j] + 0.5f) * pitch[0]);
+        loc1 += activations[j] * (lower[1] + (bin1s[j] + 0.5f) * pitch[1]);
+      }
+    }
+    loc0 /= weight;
+    loc1 /= weight;
+
+    Details::SpacePoint sp;
+    sp.x = rot[0] * loc0 + rot[1] * loc1 + trans[0];
+    sp.y = rot[3] * loc0 + rot[4] * loc1 + trans[1];
+    sp.z = rot[6] * loc0 + rot[7] * loc1 + trans[2];
+    sp.radius = sqrtf(sp.x * sp.x + sp.y * sp.y);
+
+    // Propagate the local pixel variances to the radius and z
+    const float var0 = pitch[0] * pitch[0] / 12.f;
+    const float var1 = pitch[1] * pitch[1] / 12.f;
+    const float drdl0 = (sp.x * rot[0] + sp.y * rot[3]) / sp.radius;
+    const float drdl1 = (sp.x * rot[1] + sp.y * rot[4]) / sp.radius;
+    sp.varianceR = drdl0 * drdl0 * var0 + drdl1 * drdl1 * var1;
+    sp.varianceZ = rot[6] * rot[6] * var0 + rot[7] * rot[7] * var1;
+
+    const unsigned int id = clusterIds[i];
+    spacePoints[id] = sp;
+    spacePointModules[id] = module;
+  }
+}
+
+}  // namespace Kernels
+
+PixelSpacePointMaker::Module PixelSpacePointMaker::Module::create(
+    const Transform3& transform, const BinUtility& segmentation) {
+  if (segmentation.dimensions() != 2) {
+    throw std::invalid_argument(
+        "Cuda::PixelSpacePointMaker: "
+        "The segmentation has to be two-dimensional.");
+  }
+  Module module;
+  for (unsigned int row = 0; row < 3; ++row) {
+    for (unsigned int col = 0; col < 3; ++col) {
+      module.rotation[row * 3 + col] = transform.linear()(row, col);
+    }
+    module.translation[row] = transform.translation()[row];
+  }
+  for (unsigned int i = 0; i < 2; ++i) {
+    const auto& binningData = segmentation.binningData()[i];
+    if (binningData.type != equidistant) {
+      throw std::invalid_argument(
+          "Cuda::PixelSpacePointMaker: "
+          "The segmentation has to be equidistant.");
+    }
+    module.min[i] = binningData.min;
+    module.pitch[i] = binningData.step;
+  }
+  return module;
+}
+
+PixelSpacePointMaker::PixelSpacePointMaker(
+    const Config& cfg, int device, std::unique_ptr<const Logger> incomingLogger)
+    : m_cfg(cfg),
+      m_device(device),
+      m_stream(nullptr, false),
+      m_logger(std::move(incomingLogger)) {
+  if (m_cfg.maxBlockSize <= 0) {
+    throw std::invalid_argument(
+        "Cuda::PixelSpacePointMaker: "
+        "The maximum block size has to be positive.");
+  }
+
+  // Tell the user what CUDA device will be used by the object.
+  if (static_cast<std::size_t>(m_device) < Info::instance().devices().size()) {
+    ACTS_DEBUG("Will be using device:\n"
+               << Info::instance().devices()[m_device]);
+  } else {
+    ACTS_FATAL("Invalid CUDA device requested");
+    throw std::runtime_error("Invalid CUDA device requested");
+  }
+
+  // Create the stream used by the object.
+  m_stream = createStreamFor(Info::instance().devices()[m_device]);
+}
+
+PixelSpacePointMaker::Result PixelSpacePointMaker::makeSpacePoints(
+    const std::vector<Module>& modules, const std::vector<Cell>& cells) const {
+  Result result;
+  const std::size_t nModules = modules.size();
+  const std::size_t nCells = cells.size();
+  if (nModules == 0 || nCells == 0) {
+    return result;
+  }
+
+  // Stage the cells and the module ranges in page-locked memory.
+  auto moduleOffsets = make_pinned_host_array<unsigned int>(nModules + 1);
+  auto bin0s = make_pinned_host_array<int>(nCells);
+  auto bin1s = make_pinned_host_array<int>(nCells);
+  auto activations = make_pinned_host_array<float>(nCells);
+  std::size_t module = 0;
+  moduleOffsets.get()[0] = 0;
+  for (std::size_t i = 0; i < nCells; ++i) {
+    const Cell& cell = cells[i];
+    if (cell.module >= nModules || cell.module < module) {
+      throw std::invalid_argument(
+          "Cuda::PixelSpacePointMaker: "
+          "The cells have to be grouped by valid module indices.");
+    }
+    while (module < cell.module) {
+      moduleOffsets.get()[++module] = i;
+    }
+    bin0s.get()[i] = cell.bin0;
+    bin1s.get()[i] = cell.bin1;
+    activations.get()[i] = cell.activation;
+  }
+  while (module < nModules) {
+    moduleOffsets.get()[++module] = nCells;
+  }
+
+  auto moduleGeometry = make_pinned_host_array<float>(nModules * 16);
+  for (std::size_t m = 0; m < nModules; ++m) {
+    float* geo = moduleGeometry.get() + m * 16;
+    std::copy(modules[m].rotation.begin(), modules[m].rotation.end(), geo);
+    std::copy(modules[m].translation.begin(), modules[m].translation.end(),
+              geo + 9);
+    std::copy(modules[m].min.begin(), modules[m].min.end(), geo + 12);
+    std::copy(modules[m].pitch.begin(), modules[m].pitch.end(), geo + 14);
+  }
+
+  auto moduleOffsetsDevice = make_device_array<unsigned int>(nModules + 1);
+  auto bin0sDevice = make_device_array<int>(nCells);
+  auto bin1sDevice = make_device_array<int>(nCells);
+  auto activationsDevice = make_device_array<float>(nCells);
+  auto moduleGeometryDevice = make_device_array<float>(nModules * 16);
+  copyToDevice(moduleOffsetsDevice, moduleOffsets, nModules + 1, m_stream);
+  copyToDevice(bin0sDevice, bin0s, nCells, m_stream);
+  copyToDevice(bin1sDevice, bin1s, nCells, m_stream);
+  copyToDevice(activationsDevice, activations, nCells, m_stream);
+  copyToDevice(moduleGeometryDevice, moduleGeometry, nModules * 16, m_stream);
+
+  // Label the cells of every module.
+  auto labelsDevice = make_device_array<unsigned int>(nCells);
+  auto clusterCountsDevice = make_device_array<unsigned int>(nModules);
+  Kernels::labelCells<<<nModules, m_cfg.maxBlockSize, 0,
+                        getStreamFrom(m_stream)>>>(
+      moduleOffsetsDevice.get(), bin0sDevice.get(), bin1sDevice.get(),
+      m_cfg.commonCorner, labelsDevice.get(), clusterCountsDevice.get());
+  ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
+
+  auto clusterOffsetsDevice = make_device_array<unsigned int>(nModules + 1);
+  Kernels::countClusters<<<1, 1, 0, getStreamFrom(m_stream)>>>(
+      nModules, clusterCountsDevice.get(), clusterOffsetsDevice.get());
+  ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
+
+  // Only the total number of clusters is needed on the host, to size the
+  // output arrays.
+  auto nClusters = make_pinned_host_array<unsigned int>(1);
+  ACTS_CUDA_ERROR_CHECK(cudaMemcpyAsync(
+      nClusters.get(), clusterOffsetsDevice.get() + nModules,
+      sizeof(unsigned int), cudaMemcpyDeviceToHost, getStreamFrom(m_stream)));
+  m_stream.synchronize();
+  result.nSpacePoints = nClusters.get()[0];
+  ACTS_DEBUG("Found " << result.nSpacePoints << " clusters in " << nCells
+                      << " cells of " << nModules << " modules");
+
+  result.spacePoints =
+      make_device_array<Details::SpacePoint>(result.nSpacePoints);
+  result.modules = make_device_array<unsigned int>(result.nSpacePoints);
+  auto clusterIdsDevice = make_device_array<unsigned int>(nCells);
+  Kernels::buildSpacePoints<<<nModules, m_cfg.maxBlockSize, 0,
+                              getStreamFrom(m_stream)>>>(
+      moduleOffsetsDevice.get(), clusterOffsetsDevice.get(),
+      moduleGeometryDevice.get(), bin0sDevice.get(), bin1sDevice.get(),
+      activationsDevice.get(), labelsDevice.get(), clusterIdsDevice.get(),
+      result.spacePoints.get(), result.modules.get());
+  ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
+  m_stream.synchronize();
+
+  return result;
+}
+
+std::vector<Details::SpacePoint> PixelSpacePointMaker::copyToHost(
+    const Result& result) const {
+  std::vector<Details::SpacePoint> spacePoints(result.nSpacePoints);
+  if (result.nSpacePoints == 0) {
+    return spacePoints;
+  }
+  ACTS_CUDA_ERROR_CHECK(cudaMemcpyAsync(
+      spacePoints.data(), result.spacePoints.get(),
+      result.nSpacePoints * sizeof(Details::SpacePoint),
+      cudaMemcpyDeviceToHost, getStreamFrom(m_stream)));
+  m_stream.synchronize();
+  return spacePoints;
+}
+
+}  // namespace Cuda
+}  // namespace Acts
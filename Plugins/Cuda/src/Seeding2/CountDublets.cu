@@ -11,6 +11,7 @@
 #include "Acts/Plugins/Cuda/Seeding2/Details/Types.hpp"
 
 #include "../Utilities/ErrorCheck.cuh"
+#include "../Utilities/StreamHandlers.cuh"
 
 // CUDA include(s).
 #include <cuda_runtime.h>
@@ -103,7 +104,8 @@ namespace Details {
 DubletCounts countDublets(
     std::size_t maxBlockSize, std::size_t nMiddleSP,
     const device_array<unsigned int>& middleBottomCountArray,
-    const device_array<unsigned int>& middleTopCountArray) {
+    const device_array<unsigned int>& middleTopCountArray,
+    const StreamWrapper& stream) {
   // Calculate the parallelisation for the dublet counting.
   const int numBlocks = (nMiddleSP + maxBlockSize - 1) / maxBlockSize;
   const int sharedMem = maxBlockSize * sizeof(DubletCounts);
@@ -113,15 +115,16 @@ DubletCounts countDublets(
   auto dubletCountsDevice = make_device_array<DubletCounts>(numBlocks);
 
   // Run the reduction kernel.
-  Kernels::countDublets<<<numBlocks, maxBlockSize, sharedMem>>>(
+  Kernels::countDublets<<<numBlocks, maxBlockSize, sharedMem,
+                           getStreamFrom(stream)>>>(
       nMiddleSP, middleBottomCountArray.get(), middleTopCountArray.get(),
       dubletCountsDevice.get());
   ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
-  ACTS_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
 
   // Copy the sum(s) back to the host.
   auto dubletCountsHost = make_host_array<DubletCounts>(numBlocks);
-  copyToHost(dubletCountsHost, dubletCountsDevice, numBlocks);
+  copyToHost(dubletCountsHost, dubletCountsDevice, numBlocks, stream);
+  stream.synchronize();
 
   // Perform the final summation on the host. Assuming that the number of
   // middle space points is not so large that it would make sense to do the
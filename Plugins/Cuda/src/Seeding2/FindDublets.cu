@@ -12,6 +12,7 @@
 
 #include "../Utilities/ErrorCheck.cuh"
 #include "../Utilities/MatrixMacros.hpp"
+#include "../Utilities/StreamHandlers.cuh"
 
 // System include(s).
 #include <cassert>
@@ -160,7 +161,8 @@ void findDublets(std::size_t maxBlockSize, std::size_t nBottomSPs,
                  device_array<unsigned int>& middleBottomCounts,
                  device_array<std::size_t>& middleBottomDublets,
                  device_array<unsigned int>& middleTopCounts,
-                 device_array<std::size_t>& middleTopDublets) {
+                 device_array<std::size_t>& middleTopDublets,
+                 const StreamWrapper& stream) {
   // Calculate the parallelisation for the middle<->bottom spacepoint
   // compatibility flagging.
   const dim3 blockSizeMB(1, maxBlockSize);
@@ -168,7 +170,8 @@ void findDublets(std::size_t maxBlockSize, std::size_t nBottomSPs,
                          (nBottomSPs + blockSizeMB.y - 1) / blockSizeMB.y);
 
   // Launch the middle-bottom dublet finding.
-  Kernels::findDublets<BottomSP><<<numBlocksMB, blockSizeMB>>>(
+  Kernels::findDublets<BottomSP>
+      <<<numBlocksMB, blockSizeMB, 0, getStreamFrom(stream)>>>(
       nMiddleSPs, middleSPs.get(), nBottomSPs, bottomSPs.get(), deltaRMin,
       deltaRMax, cotThetaMax, collisionRegionMin, collisionRegionMax,
       middleBottomCounts.get(), middleBottomDublets.get());
@@ -181,12 +184,12 @@ void findDublets(std::size_t maxBlockSize, std::size_t nBottomSPs,
                          (nTopSPs + blockSizeMT.y - 1) / blockSizeMT.y);
 
   // Launch the middle-bottom dublet finding.
-  Kernels::findDublets<TopSP><<<numBlocksMT, blockSizeMT>>>(
+  Kernels::findDublets<TopSP>
+      <<<numBlocksMT, blockSizeMT, 0, getStreamFrom(stream)>>>(
       nMiddleSPs, middleSPs.get(), nTopSPs, topSPs.get(), deltaRMin, deltaRMax,
       cotThetaMax, collisionRegionMin, collisionRegionMax,
       middleTopCounts.get(), middleTopDublets.get());
   ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
-  ACTS_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
   return;
 }
 
@@ -14,6 +14,7 @@
 
 #include "../Utilities/ErrorCheck.cuh"
 #include "../Utilities/MatrixMacros.hpp"
+#include "../Utilities/StreamHandlers.cuh"
 
 // Acts include(s).
 #include "Acts/Seeding/SeedFilterConfig.hpp"
@@ -592,7 +593,7 @@ std::vector<std::vector<Triplet>> findTriplets(
     const device_array<unsigned int>& middleTopCounts,
     const device_array<std::size_t>& middleTopDublets,
     float maxScatteringAngle2, float sigmaScattering, float minHelixDiameter2,
-    float pT2perRadius, float impactMax) {
+    float pT2perRadius, float impactMax, const StreamWrapper& stream) {
   // Calculate the parallelisation for the parameter transformation.
   const int numBlocksLT =
       (dubletCounts.nDublets + maxBlockSize - 1) / maxBlockSize;
@@ -604,14 +605,14 @@ std::vector<std::vector<Triplet>> findTriplets(
       make_device_array<LinCircle>(nMiddleSPs * dubletCounts.maxMTDublets);
 
   // Launch the coordinate transformations.
-  Kernels::transformCoordinates<<<numBlocksLT, maxBlockSize>>>(
+  Kernels::transformCoordinates<<<numBlocksLT, maxBlockSize, 0,
+                                  getStreamFrom(stream)>>>(
       dubletCounts.nDublets, dubletCounts.maxMBDublets,
       dubletCounts.maxMTDublets, nBottomSPs, bottomSPs.get(), nMiddleSPs,
       middleSPs.get(), nTopSPs, topSPs.get(), middleBottomCounts.get(),
       middleBottomDublets.get(), middleTopCounts.get(), middleTopDublets.get(),
       bottomSPLinTransArray.get(), topSPLinTransArray.get());
   ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
-  ACTS_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
 
   // With the information from @c Acts::Cuda::Details::DubletCounts, figure out
   // how many middle spacepoints we could handle at the same time in the triplet
@@ -696,18 +697,20 @@ std::vector<std::vector<Triplet>> findTriplets(
 
   // Copy the dublet counts back to the host.
   auto middleBottomCountsHost = make_host_array<unsigned int>(nMiddleSPs);
-  copyToHost(middleBottomCountsHost, middleBottomCounts, nMiddleSPs);
+  copyToHost(middleBottomCountsHost, middleBottomCounts, nMiddleSPs, stream);
   auto middleTopCountsHost = make_host_array<unsigned int>(nMiddleSPs);
-  copyToHost(middleTopCountsHost, middleTopCounts, nMiddleSPs);
+  copyToHost(middleTopCountsHost, middleTopCounts, nMiddleSPs, stream);
+  stream.synchronize();
 
   // Execute the triplet finding and filtering in the maximal allowed groups of
   // middle spacepoints.
   for (std::size_t middleIndex = 0; middleIndex < nMiddleSPs;
        middleIndex += nParallelMiddleSPs) {
     // Reset the device arrays.
-    copyToDevice(objectCounts, objectCountsHostNull, NObjectCountTypes);
+    copyToDevice(objectCounts, objectCountsHostNull, NObjectCountTypes,
+                 stream);
     copyToDevice(tripletsPerBottomDublet, tripletsPerBottomDubletHost,
-                 nParallelMiddleSPs * dubletCounts.maxMBDublets);
+                 nParallelMiddleSPs * dubletCounts.maxMBDublets, stream);
 
     // The number of middle spacepoints to process in this iteration.
     const std::size_t nMiddleSPsProcessed =
@@ -722,7 +725,8 @@ std::vector<std::vector<Triplet>> findTriplets(
     assert(dubletCounts.maxTriplets > 0);
 
     // Launch the triplet finding for this middle spacepoint.
-    Kernels::findTriplets<<<numBlocksFT, blockSizeFT>>>(
+    Kernels::findTriplets<<<numBlocksFT, blockSizeFT, 0,
+                            getStreamFrom(stream)>>>(
         // Parameters needed to use all the arrays.
         middleIndex, dubletCounts.maxMBDublets, dubletCounts.maxMTDublets,
         dubletCounts.maxTriplets, nParallelMiddleSPs, nMiddleSPsProcessed,
@@ -743,10 +747,10 @@ std::vector<std::vector<Triplet>> findTriplets(
         objectCounts.get() + MaxTripletsPerSpB,
         objectCounts.get() + AllTriplets, allTriplets.get());
     ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
-    ACTS_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
 
     // Retrieve the object counts.
-    copyToHost(objectCountsHost, objectCounts, NObjectCountTypes);
+    copyToHost(objectCountsHost, objectCounts, NObjectCountTypes, stream);
+    stream.synchronize();
     const unsigned int nAllTriplets = objectCountsHost.get()[AllTriplets];
     const unsigned int nMaxTripletsPerSpB =
         objectCountsHost.get()[MaxTripletsPerSpB];
@@ -769,7 +773,8 @@ std::vector<std::vector<Triplet>> findTriplets(
     // Launch the "2SpFixed" filtering of the triplets.
     assert(filterConfig.seedWeight != nullptr);
     assert(filterConfig.singleSeedCut != nullptr);
-    Kernels::filterTriplets2Sp<<<numBlocksF2SP, blockSizeF2SP>>>(
+    Kernels::filterTriplets2Sp<<<numBlocksF2SP, blockSizeF2SP, 0,
+                                 getStreamFrom(stream)>>>(
         // Pointers to the user provided filter functions.
         filterConfig.seedWeight, filterConfig.singleSeedCut,
         // Parameters needed to use all the arrays.
@@ -787,10 +792,10 @@ std::vector<std::vector<Triplet>> findTriplets(
         // Variables storing the results of the filtering.
         objectCounts.get() + FilteredTriplets, filteredTriplets.get());
     ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
-    ACTS_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
 
     // Retrieve the result counts of the filtering.
-    copyToHost(objectCountsHost, objectCounts, NObjectCountTypes);
+    copyToHost(objectCountsHost, objectCounts, NObjectCountTypes, stream);
+    stream.synchronize();
 
     // The number of triplets that survived the 2Sp filtering.
     const unsigned int nFilteredTriplets =
@@ -800,9 +805,9 @@ std::vector<std::vector<Triplet>> findTriplets(
     }
 
     // Move the filtered triplets back to the host for the final selection.
-    ACTS_CUDA_ERROR_CHECK(cudaMemcpy(
-        filteredTripletsHost.get(), filteredTriplets.get(),
-        nFilteredTriplets * sizeof(Triplet), cudaMemcpyDeviceToHost));
+    copyToHost(filteredTripletsHost, filteredTriplets, nFilteredTriplets,
+               stream);
+    stream.synchronize();
 
     // Fill the output variable.
     for (std::size_t i = 0; i < nFilteredTriplets; ++i) {
@@ -37,7 +37,11 @@ void HostArrayDeleter::operator()(void* ptr) {
   }
 
   // Free the host memory.
-  free(ptr);
+  if (m_pinned) {
+    ACTS_CUDA_ERROR_CHECK(cudaFreeHost(ptr));
+  } else {
+    free(ptr);
+  }
   return;
 }
 
@@ -65,6 +69,17 @@ host_array<T> make_host_array(std::size_t size) {
   return host_array<T>(ptr);
 }
 
+template <typename T>
+host_array<T> make_pinned_host_array(std::size_t size) {
+  // Allocate the memory.
+  T* ptr = nullptr;
+  if (size != 0) {
+    ACTS_CUDA_ERROR_CHECK(cudaMallocHost(&ptr, size * sizeof(T)));
+  }
+  // Create the smart pointer.
+  return host_array<T>(ptr, Details::HostArrayDeleter(true));
+}
+
 template <typename T>
 void copyToDevice(device_array<T>& dev, const host_array<T>& host,
                   std::size_t arraySize) {
@@ -116,6 +131,8 @@ void copyToHost(host_array<T>& host, const device_array<T>& dev,
   template class std::unique_ptr<TYPE, Acts::Cuda::Details::HostArrayDeleter>; \
   template std::unique_ptr<TYPE, Acts::Cuda::Details::HostArrayDeleter>        \
       Acts::Cuda::make_host_array<TYPE>(std::size_t);                          \
+  template std::unique_ptr<TYPE, Acts::Cuda::Details::HostArrayDeleter>        \
+      Acts::Cuda::make_pinned_host_array<TYPE>(std::size_t);                   \
   template void Acts::Cuda::copyToDevice<TYPE>(                                \
       std::unique_ptr<TYPE, Acts::Cuda::Details::DeviceArrayDeleter>&,         \
       const std::unique_ptr<TYPE, Acts::Cuda::Details::HostArrayDeleter>&,     \
@@ -15,6 +15,7 @@
 #include <cuda_runtime.h>
 
 // System include(s).
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
@@ -43,6 +44,8 @@ void MemoryManager::setMemorySize(std::size_t sizeInBytes, int device) {
     ACTS_CUDA_ERROR_CHECK(cudaGetDevice(&device));
   }
 
+  std::lock_guard<std::mutex> lock(m_mutex);
+
   // Make sure that the internal storage variable is large enough.
   if (static_cast<std::size_t>(device) >= m_memory.size()) {
     m_memory.resize(device + 1);
@@ -53,16 +56,15 @@ void MemoryManager::setMemorySize(std::size_t sizeInBytes, int device) {
 
   // De-allocate any previously allocated memory.
   if (mem.m_ptr) {
+    mem.m_maxUsage = std::max(mem.m_maxUsage, mem.m_nextAllocation - mem.m_ptr);
     ACTS_CUDA_ERROR_CHECK(cudaFree(mem.m_ptr));
+    mem.m_ptr = nullptr;
   }
 
-  // Allocate the newly requested amount.
-  ACTS_CUDA_ERROR_CHECK(cudaSetDevice(device));
-  ACTS_CUDA_ERROR_CHECK(cudaMalloc(&(mem.m_ptr), sizeInBytes));
-
-  // Set up the internal state of the object correctly.
+  // Set up the internal state of the object correctly. The memory itself is
+  // only allocated once it is needed.
   mem.m_size = sizeInBytes;
-  mem.m_nextAllocation = mem.m_ptr;
+  mem.m_nextAllocation = nullptr;
   return;
 }
 
@@ -73,31 +75,60 @@ std::size_t MemoryManager::availableMemory(int device) const {
     ACTS_CUDA_ERROR_CHECK(cudaGetDevice(&device));
   }
 
-  // Make sure that memory was allocated on the requested device.
-  if (m_memory.size() <= static_cast<std::size_t>(device)) {
-    throw std::bad_alloc();
-  }
-  const DeviceMemory& mem = m_memory[device];
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const DeviceMemory& mem = deviceMemory(device);
 
   // Return the requested information.
   return (mem.m_size - (mem.m_nextAllocation - mem.m_ptr));
 }
 
-void* MemoryManager::allocate(std::size_t sizeInBytes, int device) {
+std::size_t MemoryManager::usedMemory(int device) const {
   // If the user didn't ask for a specific device, use the one currently used by
   // CUDA.
   if (device == -1) {
     ACTS_CUDA_ERROR_CHECK(cudaGetDevice(&device));
   }
 
-  // Make sure that memory was allocated on the requested device.
-  if (m_memory.size() <= static_cast<std::size_t>(device)) {
-    throw std::bad_alloc();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const DeviceMemory& mem = deviceMemory(device);
+
+  // Return the requested information.
+  return (mem.m_nextAllocation - mem.m_ptr);
+}
+
+std::size_t MemoryManager::maxUsage(int device) const {
+  // If the user didn't ask for a specific device, use the one currently used by
+  // CUDA.
+  if (device == -1) {
+    ACTS_CUDA_ERROR_CHECK(cudaGetDevice(&device));
   }
-  DeviceMemory& mem = m_memory[device];
 
-  // We already know what we want to return...
-  void* result = mem.m_nextAllocation;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const DeviceMemory& mem = deviceMemory(device);
+
+  // Take the allocations of the current round into account as well.
+  return std::max(mem.m_maxUsage, mem.m_nextAllocation - mem.m_ptr);
+}
+
+void* MemoryManager::allocate(std::size_t sizeInBytes, int device) {
+  // If the user didn't ask for a specific device, use the one currently used by
+  // CUDA.
+  if (device == -1) {
+    ACTS_CUDA_ERROR_CHECK(cudaGetDevice(&device));
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  DeviceMemory& mem = deviceMemory(device);
+
+  // Allocate the memory of the device on first use.
+  if (mem.m_ptr == nullptr) {
+    int currentDevice = 0;
+    ACTS_CUDA_ERROR_CHECK(cudaGetDevice(&currentDevice));
+    ACTS_CUDA_ERROR_CHECK(cudaSetDevice(device));
+    ACTS_CUDA_ERROR_CHECK(cudaMalloc(&(mem.m_ptr), mem.m_size));
+    ACTS_CUDA_ERROR_CHECK(cudaSetDevice(currentDevice));
+    mem.m_nextAllocation = mem.m_ptr;
+  }
 
   // Make sure that all addresses given out are 8-byte aligned.
   static constexpr std::size_t ALIGN_SIZE = 8;
@@ -105,13 +136,17 @@ void* MemoryManager::allocate(std::size_t sizeInBytes, int device) {
   const std::size_t padding =
       ((misalignment != 0) ? (ALIGN_SIZE - misalignment) : 0);
 
-  // Increment the internal pointer.
-  mem.m_nextAllocation += sizeInBytes + padding;
-  // And make sure that we didn't run out of memory.
-  if (mem.m_nextAllocation - mem.m_ptr >= mem.m_size) {
+  // Make sure that we don't run out of memory.
+  const std::size_t used = mem.m_nextAllocation - mem.m_ptr;
+  if (used + sizeInBytes + padding > mem.m_size) {
     throw std::bad_alloc();
   }
 
+  // We already know what we want to return...
+  void* result = mem.m_nextAllocation;
+  // Increment the internal pointer.
+  mem.m_nextAllocation += sizeInBytes + padding;
+
   // Apparently everything is okay.
   return result;
 }
@@ -123,11 +158,8 @@ void MemoryManager::reset(int device) {
     ACTS_CUDA_ERROR_CHECK(cudaGetDevice(&device));
   }
 
-  // Make sure that memory was allocated on the requested device.
-  if (m_memory.size() <= static_cast<std::size_t>(device)) {
-    throw std::bad_alloc();
-  }
-  DeviceMemory& mem = m_memory[device];
+  std::lock_guard<std::mutex> lock(m_mutex);
+  DeviceMemory& mem = deviceMemory(device);
 
   // Note down how much memory was used in total until the reset.
   mem.m_maxUsage = std::max(mem.m_maxUsage, mem.m_nextAllocation - mem.m_ptr);
@@ -136,8 +168,22 @@ void MemoryManager::reset(int device) {
   return;
 }
 
+MemoryManager::DeviceMemory& MemoryManager::deviceMemory(int device) {
+  return const_cast<DeviceMemory&>(
+      static_cast<const MemoryManager&>(*this).deviceMemory(device));
+}
+
+const MemoryManager::DeviceMemory& MemoryManager::deviceMemory(
+    int device) const {
+  // Make sure that memory was set up for the requested device.
+  if (m_memory.size() <= static_cast<std::size_t>(device)) {
+    throw std::bad_alloc();
+  }
+  return m_memory[device];
+}
+
 MemoryManager::MemoryManager() {
-  // Allocate 1500 MBs of memory as a start on the default device.
+  // Use 1500 MBs of memory as a start on the default device.
   setMemorySize(1500 * 1024l * 1024l);
 }
 
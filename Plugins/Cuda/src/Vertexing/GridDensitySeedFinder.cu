@@ -0,0 +1,336 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// CUDA plugin include(s).
+#include "Acts/Plugins/Cuda/Utilities/Arrays.hpp"
+#include "Acts/Plugins/Cuda/Utilities/Info.hpp"
+#include "Acts/Plugins/Cuda/Utilities/MemoryManager.hpp"
+#include "Acts/Plugins/Cuda/Vertexing/GridDensitySeedFinder.hpp"
+
+#include "../Utilities/ErrorCheck.cuh"
+#include "../Utilities/StreamHandlers.cuh"
+
+// Acts include(s).
+#include "Acts/Definitions/TrackParametrization.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime.h>
+#include <math_constants.h>
+
+// System include(s).
+#include <cstddef>
+#include <stdexcept>
+
+namespace Acts {
+namespace Cuda {
+namespace Kernels {
+
+/// Kernel adding the density contributions of the tracks to the main grids
+///
+/// Each thread computes one bin of the track grid of one track, in the same
+/// way as @c Acts::GaussianGridTrackDensity::addTrack, and adds it to the
+/// main grid of the event of the track.
+///
+/// @param[in] nTracks The number of tracks of all events
+/// @param[in] trkGridSize The size of the 1-dim track grids
+/// @param[in] mainGridSize The size of the main grid of one event
+/// @param[in] binSize The z size of one bin
+/// @param[in] zMinMax The minimum and maximum z of the main grids
+/// @param[in] d0s 1-D array of the track d0 values
+/// @param[in] z0s 1-D array of the track z0 values
+/// @param[in] covDDs 1-D array of the track d0 variances
+/// @param[in] covDZs 1-D array of the track d0-z0 covariances
+/// @param[in] covZZs 1-D array of the track z0 variances
+/// @param[in] trackEvents 1-D array of the event index of each track
+/// @param[out] mainGrids The main grids of all events, one after the other
+///
+__global__ void fillMainGrids(std::size_t nTracks, int trkGridSize,
+                              int mainGridSize, float binSize, float zMinMax,
+                              const float* d0s, const float* z0s,
+                              const double* covDDs, const double* covDZs,
+                              const double* covZZs,
+                              const unsigned int* trackEvents,
+                              float* mainGrids) {
+  const std::size_t index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (index >= nTracks * trkGridSize) {
+    return;
+  }
+  const std::size_t iTrack = index / trkGridSize;
+  const int j = index % trkGridSize;
+
+  const float d0 = d0s[iTrack];
+  const float z0 = z0s[iTrack];
+
+  // Check if the track affects the grid density in the central bins at the
+  // z-axis, and is within the main grid
+  const int dOffset = static_cast<int>(floor(d0 / binSize - 0.5) + 1);
+  if (abs(dOffset) > (trkGridSize - 1) / 2.) {
+    return;
+  }
+  const int zBin = static_cast<int>(z0 / binSize + mainGridSize / 2.);
+  if (zBin < 0 || zBin >= mainGridSize) {
+    return;
+  }
+  // The main grid bin of this track grid bin, track grids overlapping with
+  // the borders are cut off
+  const int bin = zBin - (trkGridSize - 1) / 2 + j;
+  if (bin < 0 || bin >= mainGridSize) {
+    return;
+  }
+
+  // The distance between the IP values and their bin center
+  const float binCtrZ = (zBin + 0.5f) * binSize - zMinMax;
+  const float distCtrZ = z0 - binCtrZ;
+  const float floorHalfTrkGridSize = static_cast<float>(trkGridSize) / 2 - 0.5f;
+  const float z = (j - floorHalfTrkGridSize) * binSize;
+
+  // The 2-dim normal distribution at (-d0, z - distCtrZ)
+  const float d = -d0;
+  const float dz = z - distCtrZ;
+  const double covDD = covDDs[iTrack];
+  const double covDZ = covDZs[iTrack];
+  const double covZZ = covZZs[iTrack];
+  const float det = covDD * covZZ - covDZ * covDZ;
+  const float coef = 1 / sqrt(det);
+  const float expo =
+      -1 / (2 * det) * (covZZ * d * d - 2 * covDZ * d * dz + covDD * dz * dz);
+  // Same limits as Acts::safeExp for float
+  float value = 0.f;
+  if (expo > 50.f) {
+    value = coef * CUDART_INF_F;
+  } else if (expo >= -50.f) {
+    value = coef * expf(expo);
+  }
+
+  atomicAdd(&mainGrids[trackEvents[iTrack] * mainGridSize + bin], value);
+}
+
+/// Kernel finding the bin with the highest density of each main grid
+///
+/// Each block reduces the main grid of one event. Like @c Eigen::maxCoeff,
+/// the first of several bins with the same density is taken.
+///
+/// @param[in] mainGridSize The size of the main grid of one event
+/// @param[in] mainGrids The main grids of all events, one after the other
+/// @param[out] maxBins 1-D array of the bin with the highest density of each
+///             event, -1 for empty grids
+///
+__global__ void findMaxBins(int mainGridSize, const float* mainGrids,
+                            int* maxBins) {
+  // Values and bins shared by all threads in a single execution block.
+  extern __shared__ float maxValues[];
+  int* bins = reinterpret_cast<int*>(maxValues + blockDim.x);
+
+  const float* mainGrid = mainGrids + blockIdx.x * mainGridSize;
+
+  float thisMax = 0.f;
+  int thisBin = -1;
+  for (int bin = threadIdx.x; bin < mainGridSize; bin += blockDim.x) {
+    if (mainGrid[bin] > thisMax) {
+      thisMax = mainGrid[bin];
+      thisBin = bin;
+    }
+  }
+  maxValues[threadIdx.x] = thisMax;
+  bins[threadIdx.x] = thisBin;
+  __syncthreads();
+
+  // Do the reduction in some iterations.
+  for (unsigned int i = blockDim.x / 2; i > 0; i >>= 1) {
+    if (threadIdx.x < i) {
+      const float otherMax = maxValues[threadIdx.x + i];
+      const int otherBin = bins[threadIdx.x + i];
+      if (otherMax > maxValues[threadIdx.x] ||
+          (otherMax == maxValues[threadIdx.x] && otherBin >= 0 &&
+           otherBin < bins[threadIdx.x])) {
+        maxValues[threadIdx.x] = otherMax;
+        bins[threadIdx.x] = otherBin;
+      }
+    }
+    __syncthreads();
+  }
+
+  if (threadIdx.x == 0) {
+    maxBins[blockIdx.x] = bins[0];
+  }
+}
+
+}  // namespace Kernels
+
+GridDensitySeedFinder::GridDensitySeedFinder(
+    const Config& cfg, int device, std::unique_ptr<const Logger> incomingLogger)
+    : m_cfg(cfg),
+      m_device(device),
+      m_stream(nullptr, false),
+      m_logger(std::move(incomingLogger)) {
+  if (m_cfg.gridDensityConfig.useHighestSumZPosition) {
+    throw std::invalid_argument(
+        "Cuda::GridDensitySeedFinder: "
+        "The highest sum z position is not supported.");
+  }
+  if (m_cfg.maxBlockSize <= 0 ||
+      (m_cfg.maxBlockSize & (m_cfg.maxBlockSize - 1)) != 0) {
+    throw std::invalid_argument(
+        "Cuda::GridDensitySeedFinder: "
+        "The maximum block size has to be a power of two.");
+  }
+
+  // Tell the user what CUDA device will be used by the object.
+  if (static_cast<std::size_t>(m_device) < Info::instance().devices().size()) {
+    ACTS_DEBUG("Will be using device:\n"
+               << Info::instance().devices()[m_device]);
+  } else {
+    ACTS_FATAL("Invalid CUDA device requested");
+    throw std::runtime_error("Invalid CUDA device requested");
+  }
+
+  // Create the stream used by the object.
+  m_stream = createStreamFor(Info::instance().devices()[m_device]);
+}
+
+std::vector<std::optional<float>> GridDensitySeedFinder::findSeeds(
+    const std::vector<std::vector<const BoundTrackParameters*>>& events)
+    const {
+  const GaussianGridTrackDensity::Config& gridCfg = m_cfg.gridDensityConfig;
+  const std::size_t nEvents = events.size();
+  std::vector<std::optional<float>> seeds(nEvents);
+
+  // Select the tracks on the host, the selection needs the whole covariance
+  std::vector<const BoundTrackParameters*> selected;
+  std::vector<unsigned int> selectedEvents;
+  for (std::size_t iEvent = 0; iEvent < nEvents; ++iEvent) {
+    for (const BoundTrackParameters* trk : events[iEvent]) {
+      if (doesPassTrackSelection(*trk)) {
+        selected.push_back(trk);
+        selectedEvents.push_back(iEvent);
+      }
+    }
+  }
+  const std::size_t nTracks = selected.size();
+  ACTS_DEBUG("Filling the density grids of " << nEvents << " events with "
+                                             << nTracks << " tracks");
+  if (nTracks == 0) {
+    return seeds;
+  }
+
+  // Stage the impact parameters in page-locked memory.
+  auto d0s = make_pinned_host_array<float>(nTracks);
+  auto z0s = make_pinned_host_array<float>(nTracks);
+  auto covDDs = make_pinned_host_array<double>(nTracks);
+  auto covDZs = make_pinned_host_array<double>(nTracks);
+  auto covZZs = make_pinned_host_array<double>(nTracks);
+  auto trackEvents = make_pinned_host_array<unsigned int>(nTracks);
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    const BoundTrackParameters& trk = *selected[i];
+    const auto& cov = *trk.covariance();
+    d0s.get()[i] = trk.parameters()[eBoundLoc0];
+    z0s.get()[i] = trk.parameters()[eBoundLoc1];
+    covDDs.get()[i] = cov(eBoundLoc0, eBoundLoc0);
+    covDZs.get()[i] = cov(eBoundLoc0, eBoundLoc1);
+    covZZs.get()[i] = cov(eBoundLoc1, eBoundLoc1);
+    trackEvents.get()[i] = selectedEvents[i];
+  }
+
+  auto d0sDevice = make_device_array<float>(nTracks);
+  auto z0sDevice = make_device_array<float>(nTracks);
+  auto covDDsDevice = make_device_array<double>(nTracks);
+  auto covDZsDevice = make_device_array<double>(nTracks);
+  auto covZZsDevice = make_device_array<double>(nTracks);
+  auto trackEventsDevice = make_device_array<unsigned int>(nTracks);
+  copyToDevice(d0sDevice, d0s, nTracks, m_stream);
+  copyToDevice(z0sDevice, z0s, nTracks, m_stream);
+  copyToDevice(covDDsDevice, covDDs, nTracks, m_stream);
+  copyToDevice(covDZsDevice, covDZs, nTracks, m_stream);
+  copyToDevice(covZZsDevice, covZZs, nTracks, m_stream);
+  copyToDevice(trackEventsDevice, trackEvents, nTracks, m_stream);
+
+  // Fill the main grids of all events.
+  const std::size_t gridsSize = nEvents * gridCfg.mainGridSize;
+  auto mainGridsDevice = make_device_array<float>(gridsSize);
+  ACTS_CUDA_ERROR_CHECK(cudaMemsetAsync(mainGridsDevice.get(), 0,
+                                        gridsSize * sizeof(float),
+                                        getStreamFrom(m_stream)));
+
+  const std::size_t nThreads = nTracks * gridCfg.trkGridSize;
+  const int blockSize = m_cfg.maxBlockSize;
+  const std::size_t nBlocks = (nThreads + blockSize - 1) / blockSize;
+  Kernels::fillMainGrids<<<nBlocks, blockSize, 0, getStreamFrom(m_stream)>>>(
+      nTracks, gridCfg.trkGridSize, gridCfg.mainGridSize, gridCfg.binSize,
+      gridCfg.zMinMax, d0sDevice.get(), z0sDevice.get(), covDDsDevice.get(),
+      covDZsDevice.get(), covZZsDevice.get(), trackEventsDevice.get(),
+      mainGridsDevice.get());
+  ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
+
+  // Find the bin of the highest density of each event.
+  auto maxBinsDevice = make_device_array<int>(nEvents);
+  const std::size_t sharedMemSize = blockSize * (sizeof(float) + sizeof(int));
+  Kernels::findMaxBins<<<nEvents, blockSize, sharedMemSize,
+                         getStreamFrom(m_stream)>>>(
+      gridCfg.mainGridSize, mainGridsDevice.get(), maxBinsDevice.get());
+  ACTS_CUDA_ERROR_CHECK(cudaGetLastError());
+
+  auto maxBins = make_pinned_host_array<int>(nEvents);
+  copyToHost(maxBins, maxBinsDevice, nEvents, m_stream);
+  m_stream.synchronize();
+
+  // Free up all memory used on the device.
+  MemoryManager::instance().reset(m_device);
+
+  for (std::size_t iEvent = 0; iEvent < nEvents; ++iEvent) {
+    const int zBin = maxBins.get()[iEvent];
+    if (zBin >= 0) {
+      // Same as Acts::GaussianGridTrackDensity::getMaxZPosition
+      seeds[iEvent] =
+          (zBin - gridCfg.mainGridSize / 2.0f + 0.5f) * gridCfg.binSize;
+    }
+  }
+  return seeds;
+}
+
+bool GridDensitySeedFinder::doesPassTrackSelection(
+    const BoundTrackParameters& trk) const {
+  // Get required track parameters
+  const double d0 = trk.parameters()[BoundIndices::eBoundLoc0];
+  const double z0 = trk.parameters()[BoundIndices::eBoundLoc1];
+  // Get track covariance
+  if (!trk.covariance().has_value()) {
+    return false;
+  }
+  const auto perigeeCov = *(trk.covariance());
+  const double covDD =
+      perigeeCov(BoundIndices::eBoundLoc0, BoundIndices::eBoundLoc0);
+  const double covZZ =
+      perigeeCov(BoundIndices::eBoundLoc1, BoundIndices::eBoundLoc1);
+  const double covDZ =
+      perigeeCov(BoundIndices::eBoundLoc0, BoundIndices::eBoundLoc1);
+  const double covDeterminant = covDD * covZZ - covDZ * covDZ;
+
+  // Do track selection based on track cov matrix and d0SignificanceCut
+  if ((covDD <= 0) || (d0 * d0 / covDD > m_cfg.d0SignificanceCut) ||
+      (covZZ <= 0) || (covDeterminant <= 0)) {
+    return false;
+  }
+
+  // Calculate track density quantities
+  double constantTerm =
+      -(d0 * d0 * covZZ + z0 * z0 * covDD + 2. * d0 * z0 * covDZ) /
+      (2. * covDeterminant);
+  const double linearTerm = (d0 * covDZ + z0 * covDD) / covDeterminant;
+  const double quadraticTerm = -covDD / (2. * covDeterminant);
+  double discriminant =
+      linearTerm * linearTerm -
+      4. * quadraticTerm * (constantTerm + 2. * m_cfg.z0SignificanceCut);
+  if (discriminant < 0) {
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace Cuda
+}  // namespace Acts
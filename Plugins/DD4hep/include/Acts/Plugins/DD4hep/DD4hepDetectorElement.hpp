@@ -14,6 +14,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "DD4hep/DetElement.h"
 #include "DD4hep/Segmentations.h"
@@ -76,10 +77,12 @@ class DD4hepDetectorElement : public TGeoDetectorElement {
   ///       TGeoTubeSeg should be translated to a disc surface. Per default it
   ///       will be translated into a cylindrical surface.
   /// @param material Optional material of detector element
+  /// @param componentRegistry Optional registry to share identical bounds
   DD4hepDetectorElement(
       const dd4hep::DetElement detElement, const std::string& axes = "XYZ",
       double scalor = 1., bool isDisc = false,
-      std::shared_ptr<const ISurfaceMaterial> material = nullptr);
+      std::shared_ptr<const ISurfaceMaterial> material = nullptr,
+      GeometryComponentRegistry* componentRegistry = nullptr);
 
   ~DD4hepDetectorElement() override = default;
 
@@ -92,4 +95,21 @@ class DD4hepDetectorElement : public TGeoDetectorElement {
   /// DD4hep segmentation
   dd4hep::Segmentation m_segmentation;
 };
+
+/// Create the detector elements of several sensitive DD4hep elements
+///
+/// The axis definition is read from the "axis_definitions" parameter of each
+/// element. The elements are independent of each other, such that their
+/// conversion is split over up to @c Acts::maxThreads threads.
+///
+/// @param dd4hepElements the sensitive DD4hep elements to convert
+/// @param scalor is the scale factor for unit conversion
+/// @param isDisc whether the modules should be translated as discs
+/// @param componentRegistry Optional registry to share identical bounds
+///
+/// @return the detector elements, in the order of @p dd4hepElements
+std::vector<std::unique_ptr<DD4hepDetectorElement>> convertDD4hepDetElements(
+    const std::vector<dd4hep::DetElement>& dd4hepElements, double scalor,
+    bool isDisc, GeometryComponentRegistry* componentRegistry = nullptr);
+
 }  // namespace Acts
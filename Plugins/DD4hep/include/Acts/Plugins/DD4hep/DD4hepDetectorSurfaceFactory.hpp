@@ -16,9 +16,12 @@
 #include "Acts/Detector/LayerStructureBuilder.hpp"
 #include "Acts/Detector/ProtoBinning.hpp"
 #include "Acts/Geometry/Extent.hpp"
+#include "Acts/Geometry/GeometryComponentRegistry.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/BinningData.hpp"
 
+#include <cstddef>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -73,6 +76,9 @@ class DD4hepDetectorSurfaceFactory {
     std::vector<BinningValue> extentConstraints = {};
     /// The approximination for extent measuring
     std::size_t nExtentSegments = 1u;
+    /// The registry sharing bounds and material of identical modules,
+    /// created if not given
+    std::shared_ptr<GeometryComponentRegistry> componentRegistry = nullptr;
   };
 
   /// Nested options struct to steer the conversion
@@ -124,26 +130,29 @@ class DD4hepDetectorSurfaceFactory {
   /// @param dd4hepElement the detector element representing the super structure
   /// @param options to steer the conversion
   /// @param level the current level of the tree, used for log message output
+  /// @param sensitiveElements [in,out] the sensitive elements to be converted
   ///
   /// @note this method is called recursively
   void recursiveConstruct(Cache& cache, const GeometryContext& gctx,
                           const dd4hep::DetElement& dd4hepElement,
-                          const Options& options, int level);
+                          const Options& options, int level,
+                          std::vector<dd4hep::DetElement>& sensitiveElements);
 
-  /// Method to convert a single sensitive detector element
+  /// Method to complete a single converted sensitive detector element
   ///
   /// @param cache [in,out] into which the Elements are filled
   /// @param gctx the geometry context
-  /// @param dd4hepElement the detector element
+  /// @param dd4hepDetElement the converted detector element
   /// @param options to steer the conversion
   ///
   /// @note the cache is handed through in order to optionally measure the
   /// extent of the sensitive surface and register it
   ///
-  /// @return a created detector element and surface
+  /// @return the detector element and surface
   DD4hepSensitiveSurface constructSensitiveComponents(
       Cache& cache, const GeometryContext& gctx,
-      const dd4hep::DetElement& dd4hepElement, const Options& options) const;
+      std::shared_ptr<DD4hepDetectorElement> dd4hepDetElement,
+      const Options& options) const;
 
   /// Method to convert a single sensitive detector element
   ///
@@ -165,16 +174,14 @@ class DD4hepDetectorSurfaceFactory {
   /// @param surface the surface to attach the material to
   /// @param thickness the thickness of the condensed component
   /// @param options to steer the conversion
-  ///
-  /// @note the cache is handed through in order to optionally measure the
-  /// extent of the sensitive surface and register it
+  /// @param componentRegistry optional registry to share identical material
   ///
   /// @note void function that also checks the options if the attachment should be applied
-  void attachSurfaceMaterial(const GeometryContext& gctx,
-                             const std::string& prefix,
-                             const dd4hep::DetElement& dd4hepElement,
-                             Acts::Surface& surface, ActsScalar thickness,
-                             const Options& options) const;
+  void attachSurfaceMaterial(
+      const GeometryContext& gctx, const std::string& prefix,
+      const dd4hep::DetElement& dd4hepElement, Acts::Surface& surface,
+      ActsScalar thickness, const Options& options,
+      GeometryComponentRegistry* componentRegistry) const;
 };
 
 }  // namespace Acts
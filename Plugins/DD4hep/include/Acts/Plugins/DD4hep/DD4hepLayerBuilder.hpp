@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryComponentRegistry.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/ILayerBuilder.hpp"
 #include "Acts/Geometry/LayerCreator.hpp"
@@ -80,6 +81,9 @@ class DD4hepLayerBuilder : public ILayerBuilder {
     /// @attention The default thickness should be set thin enough that no
     ///            touching or overlapping with the next layer can happen.
     double defaultThickness = UnitConstants::fm;
+    /// The registry sharing the bounds of identical modules, it can be shared
+    /// between builders and is created if not given
+    std::shared_ptr<GeometryComponentRegistry> componentRegistry = nullptr;
   };
 
   /// Constructor
@@ -156,6 +160,14 @@ class DD4hepLayerBuilder : public ILayerBuilder {
       const dd4hep::DetElement& detElement,
       std::vector<std::shared_ptr<const Acts::Surface>>& surfaces) const;
 
+  /// Private helper function collecting the sensitive DD4hep elements below
+  /// a given element, in the order of the tree walk
+  /// @param detElement the DD4hep::DetElement to start from
+  /// @param sensitiveElements the vector to fill with the sensitive elements
+  void collectSensitive(
+      const dd4hep::DetElement& detElement,
+      std::vector<dd4hep::DetElement>& sensitiveElements) const;
+
   /// Private helper function to create a sensitive surface from a given
   /// detector element
   /// @param detElement the DD4hep::DetElement of sensitive surface to be
@@ -8,6 +8,9 @@
 
 #include "Acts/Plugins/DD4hep/DD4hepDetectorElement.hpp"
 
+#include "Acts/Plugins/DD4hep/DD4hepConversionHelpers.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+
 #include <utility>
 
 #include <DD4hep/Alignments.h>
@@ -16,10 +19,36 @@
 
 Acts::DD4hepDetectorElement::DD4hepDetectorElement(
     const dd4hep::DetElement detElement, const std::string& axes, double scalor,
-    bool /*isDisc*/, std::shared_ptr<const ISurfaceMaterial> material)
+    bool /*isDisc*/, std::shared_ptr<const ISurfaceMaterial> material,
+    GeometryComponentRegistry* componentRegistry)
     : TGeoDetectorElement(
           static_cast<TGeoDetectorElement::Identifier>(detElement.volumeID()),
           *(detElement.placement().ptr()),
           detElement.nominal().worldTransformation(), axes, scalor,
-          std::move(material)),
+          std::move(material), componentRegistry),
       m_detElement(detElement) {}
+
+std::vector<std::unique_ptr<Acts::DD4hepDetectorElement>>
+Acts::convertDD4hepDetElements(
+    const std::vector<dd4hep::DetElement>& dd4hepElements, double scalor,
+    bool isDisc, GeometryComponentRegistry* componentRegistry) {
+  std::vector<std::unique_ptr<DD4hepDetectorElement>> detElements(
+      dd4hepElements.size());
+  if (dd4hepElements.empty()) {
+    return detElements;
+  }
+  // DD4hep creates the nominal alignments on first access, which must not
+  // happen concurrently
+  for (const auto& dd4hepElement : dd4hepElements) {
+    dd4hepElement.nominal();
+  }
+
+  parallelFor(dd4hepElements.size(), [&](std::size_t ie) {
+    const auto& dd4hepElement = dd4hepElements[ie];
+    std::string detAxis =
+        getParamOr<std::string>("axis_definitions", dd4hepElement, "XYZ");
+    detElements[ie] = std::make_unique<DD4hepDetectorElement>(
+        dd4hepElement, detAxis, scalor, isDisc, nullptr, componentRegistry);
+  });
+  return detElements;
+}
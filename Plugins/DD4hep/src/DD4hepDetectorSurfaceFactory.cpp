@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Detector/detail/ProtoMaterialHelper.hpp"
+#include "Acts/Geometry/GeometryComponentRegistry.hpp"
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
 #include "Acts/Plugins/DD4hep/DD4hepBinningHelpers.hpp"
 #include "Acts/Plugins/DD4hep/DD4hepConversionHelpers.hpp"
@@ -18,6 +19,8 @@
 #include "Acts/Plugins/TGeo/TGeoPrimitivesHelper.hpp"
 #include "Acts/Plugins/TGeo/TGeoSurfaceConverter.hpp"
 
+#include <utility>
+
 #include "DD4hep/DetElement.h"
 
 using namespace Acts::detail;
@@ -40,7 +43,31 @@ void Acts::DD4hepDetectorSurfaceFactory::construct(
                             : "")));
   ACTS_DEBUG("Constructing DD4hepDetectorElements - tree level call from  "
              << dd4hepElement.name() << ".");
-  recursiveConstruct(cache, gctx, dd4hepElement, options, 1);
+  if (cache.componentRegistry == nullptr) {
+    cache.componentRegistry = std::make_shared<GeometryComponentRegistry>();
+  }
+  std::vector<dd4hep::DetElement> sensitiveElements;
+  recursiveConstruct(cache, gctx, dd4hepElement, options, 1,
+                     sensitiveElements);
+  // The sensitive elements are converted after the tree walk, such that
+  // the conversion can be split over several threads
+  if (!sensitiveElements.empty()) {
+    ACTS_DEBUG("Converting " << sensitiveElements.size()
+                             << " sensitive element(s).");
+    auto detElements = convertDD4hepDetElements(
+        sensitiveElements, unitLength, false, cache.componentRegistry.get());
+    cache.sensitiveSurfaces.reserve(cache.sensitiveSurfaces.size() +
+                                    detElements.size());
+    for (auto& dd4hepDetElement : detElements) {
+      cache.sensitiveSurfaces.push_back(constructSensitiveComponents(
+          cache, gctx, std::move(dd4hepDetElement), options));
+    }
+  }
+  ACTS_DEBUG("Converted surfaces share "
+             << cache.componentRegistry->numberOfBounds()
+             << " distinct bounds and "
+             << cache.componentRegistry->numberOfMaterials()
+             << " distinct material object(s).");
   ACTS_DEBUG("Recursive search did yield: "
              << cache.sensitiveSurfaces.size() << " sensitive surface(s), "
              << cache.passiveSurfaces.size() << " passive surface(s)");
@@ -53,8 +80,8 @@ void Acts::DD4hepDetectorSurfaceFactory::construct(
 
 void Acts::DD4hepDetectorSurfaceFactory::recursiveConstruct(
     Cache& cache, const GeometryContext& gctx,
-    const dd4hep::DetElement& dd4hepElement, const Options& options,
-    int level) {
+    const dd4hep::DetElement& dd4hepElement, const Options& options, int level,
+    std::vector<dd4hep::DetElement>& sensitiveElements) {
   ACTS_VERBOSE("Conversion call at level " << level << " for element "
                                            << dd4hepElement.name());
 
@@ -82,10 +109,10 @@ void Acts::DD4hepDetectorSurfaceFactory::recursiveConstruct(
       ACTS_VERBOSE("Processing child " << childDetElement.name());
       if (childDetElement.volume().isSensitive() && options.convertSensitive) {
         ACTS_VERBOSE("Sensitive surface detected.");
-        cache.sensitiveSurfaces.push_back(constructSensitiveComponents(
-            cache, gctx, childDetElement, options));
+        sensitiveElements.push_back(childDetElement);
       }
-      recursiveConstruct(cache, gctx, childDetElement, options, level + 1);
+      recursiveConstruct(cache, gctx, childDetElement, options, level + 1,
+                         sensitiveElements);
     }
   } else {
     ACTS_VERBOSE("No children detected.");
@@ -95,15 +122,9 @@ void Acts::DD4hepDetectorSurfaceFactory::recursiveConstruct(
 Acts::DD4hepDetectorSurfaceFactory::DD4hepSensitiveSurface
 Acts::DD4hepDetectorSurfaceFactory::constructSensitiveComponents(
     Cache& cache, const GeometryContext& gctx,
-    const dd4hep::DetElement& dd4hepElement, const Options& options) const {
-  // Extract the axis definition
-  std::string detAxis =
-      getParamOr<std::string>("axis_definitions", dd4hepElement, "XYZ");
-  std::shared_ptr<const Acts::ISurfaceMaterial> surfaceMaterial = nullptr;
-
-  // Create the corresponding detector element
-  auto dd4hepDetElement = std::make_shared<Acts::DD4hepDetectorElement>(
-      dd4hepElement, detAxis, unitLength, false, nullptr);
+    std::shared_ptr<DD4hepDetectorElement> dd4hepDetElement,
+    const Options& options) const {
+  const dd4hep::DetElement& dd4hepElement = dd4hepDetElement->sourceElement();
   auto sSurface = dd4hepDetElement->surface().getSharedPtr();
   // Measure if configured to do so
   if (cache.sExtent.has_value()) {
@@ -115,7 +136,8 @@ Acts::DD4hepDetectorSurfaceFactory::constructSensitiveComponents(
 
   // Attach surface material if present
   attachSurfaceMaterial(gctx, "acts_surface_", dd4hepElement, *sSurface.get(),
-                        dd4hepDetElement->thickness(), options);
+                        dd4hepDetElement->thickness(), options,
+                        cache.componentRegistry.get());
   // return the surface
   return {dd4hepDetElement, sSurface};
 }
@@ -142,7 +164,8 @@ Acts::DD4hepDetectorSurfaceFactory::constructPassiveComponents(
     cache.pExtent.value().extend(sExtent, cache.extentConstraints);
   }
   attachSurfaceMaterial(gctx, "acts_passive_surface", dd4hepElement,
-                        *pSurface.get(), thickness, options);
+                        *pSurface.get(), thickness, options,
+                        cache.componentRegistry.get());
   // Return a passive surface
   return {pSurface, assignToAll};
 }
@@ -150,7 +173,8 @@ Acts::DD4hepDetectorSurfaceFactory::constructPassiveComponents(
 void Acts::DD4hepDetectorSurfaceFactory::attachSurfaceMaterial(
     const GeometryContext& gctx, const std::string& prefix,
     const dd4hep::DetElement& dd4hepElement, Acts::Surface& surface,
-    ActsScalar thickness, const Options& options) const {
+    ActsScalar thickness, const Options& options,
+    GeometryComponentRegistry* componentRegistry) const {
   // Bool proto material overrules converted material
   bool protoMaterial =
       getParamOr<bool>(prefix + "_proto_material", dd4hepElement, false);
@@ -174,8 +198,10 @@ void Acts::DD4hepDetectorSurfaceFactory::attachSurfaceMaterial(
     auto materialSlab = TGeoMaterialConverter::materialSlab(
         *tgeoMaterial, thickness, options.surfaceMaterialThickness,
         materialOptions);
-    auto surfaceMaterial =
-        std::make_shared<HomogeneousSurfaceMaterial>(materialSlab);
+    std::shared_ptr<const ISurfaceMaterial> surfaceMaterial =
+        componentRegistry != nullptr
+            ? componentRegistry->makeHomogeneousMaterial(materialSlab)
+            : std::make_shared<HomogeneousSurfaceMaterial>(materialSlab);
     // Assign the material to the surface
     surface.assignSurfaceMaterial(std::move(surfaceMaterial));
   }
@@ -14,6 +14,7 @@
 #include "Acts/Geometry/CylinderLayer.hpp"
 #include "Acts/Geometry/DiscLayer.hpp"
 #include "Acts/Geometry/Extent.hpp"
+#include "Acts/Geometry/GeometryComponentRegistry.hpp"
 #include "Acts/Geometry/Layer.hpp"
 #include "Acts/Geometry/LayerCreator.hpp"
 #include "Acts/Geometry/ProtoLayer.hpp"
@@ -60,6 +61,9 @@ Acts::DD4hepLayerBuilder::~DD4hepLayerBuilder() = default;
 void Acts::DD4hepLayerBuilder::setConfiguration(
     const Acts::DD4hepLayerBuilder::Config& config) {
   m_cfg = config;
+  if (m_cfg.componentRegistry == nullptr) {
+    m_cfg.componentRegistry = std::make_shared<GeometryComponentRegistry>();
+  }
 }
 
 const Acts::LayerVector Acts::DD4hepLayerBuilder::endcapLayers(
@@ -371,15 +375,29 @@ const Acts::LayerVector Acts::DD4hepLayerBuilder::positiveLayers(
 void Acts::DD4hepLayerBuilder::resolveSensitive(
     const dd4hep::DetElement& detElement,
     std::vector<std::shared_ptr<const Acts::Surface>>& surfaces) const {
+  std::vector<dd4hep::DetElement> sensitiveElements;
+  collectSensitive(detElement, sensitiveElements);
+  auto detElements = convertDD4hepDetElements(
+      sensitiveElements, UnitConstants::cm, false,
+      m_cfg.componentRegistry.get());
+  surfaces.reserve(surfaces.size() + detElements.size());
+  for (auto& dd4hepDetElement : detElements) {
+    // The detector elements are not owned by anyone !- memory leak --!
+    surfaces.push_back(dd4hepDetElement.release()->surface().getSharedPtr());
+  }
+}
+
+void Acts::DD4hepLayerBuilder::collectSensitive(
+    const dd4hep::DetElement& detElement,
+    std::vector<dd4hep::DetElement>& sensitiveElements) const {
   const dd4hep::DetElement::Children& children = detElement.children();
   if (!children.empty()) {
     for (auto& child : children) {
       dd4hep::DetElement childDetElement = child.second;
       if (childDetElement.volume().isSensitive()) {
-        // create the surface
-        surfaces.push_back(createSensitiveSurface(childDetElement, false));
+        sensitiveElements.push_back(childDetElement);
       }
-      resolveSensitive(childDetElement, surfaces);
+      collectSensitive(childDetElement, sensitiveElements);
     }
   }
 }
@@ -392,7 +410,8 @@ Acts::DD4hepLayerBuilder::createSensitiveSurface(
   // Create the corresponding detector element !- memory leak --!
   Acts::DD4hepDetectorElement* dd4hepDetElement =
       new Acts::DD4hepDetectorElement(detElement, detAxis, UnitConstants::cm,
-                                      isDisc, nullptr);
+                                      isDisc, nullptr,
+                                      m_cfg.componentRegistry.get());
 
   // return the surface
   return dd4hepDetElement->surface().getSharedPtr();
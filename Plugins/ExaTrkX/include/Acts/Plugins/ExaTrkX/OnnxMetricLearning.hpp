@@ -41,10 +41,6 @@ class OnnxMetricLearning final : public Acts::GraphConstructionBase {
   Config config() const { return m_cfg; }
 
  private:
-  void buildEdgesWrapper(std::vector<float>& embedFeatures,
-                         std::vector<int64_t>& edgeList, int64_t numSpacepoints,
-                         const Logger& logger) const;
-
   std::unique_ptr<const Acts::Logger> m_logger;
   const auto& logger() const { return *m_logger; }
 
@@ -13,8 +13,10 @@
 
 namespace Acts {
 
-// TODO maybe replace std::any with some kind of variant<unique_ptr<torch>,
-// unique_ptr<onnx>>?
+// All stages exchange the graph as torch::Tensor objects wrapped in std::any,
+// left on the device of the stage that produced them. This allows to mix
+// torch and ONNX stages without copying through the host in between.
+// TODO maybe replace std::any with a dedicated tensor type
 // TODO maybe replace input for GraphConstructionBase with some kind of
 // boost::multi_array / Eigen::Array
 
@@ -11,6 +11,7 @@
 #include "Acts/Plugins/ExaTrkX/Stages.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstddef>
 #include <memory>
 
 namespace torch::jit {
@@ -31,6 +32,11 @@ class TorchEdgeClassifier final : public Acts::EdgeClassificationBase {
     float cut = 0.21;
     int nChunks = 1;  // NOTE for GNN use 1
     bool undirected = false;
+    /// Estimated device memory to classify a single edge in bytes. If set,
+    /// the number of chunks is increased until a chunk fits into the free
+    /// device memory. As nChunks, only valid for models that classify the
+    /// edges independently.
+    std::size_t memoryPerEdge = 0;
   };
 
   TorchEdgeClassifier(const Config &cfg, std::unique_ptr<const Logger> logger);
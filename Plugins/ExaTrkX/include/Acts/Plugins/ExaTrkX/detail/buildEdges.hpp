@@ -33,7 +33,12 @@ at::Tensor buildEdgesFRNN(at::Tensor& embedFeatures, float rVal, int kVal,
 at::Tensor buildEdgesKDTree(at::Tensor& embedFeatures, float rVal, int kVal,
                             bool flipDirections = false);
 
-/// Dispatches either to FRNN or KD-Tree based edge building
+/// Multi-threaded edge building on a uniform grid in embedding space.
+/// Like the KD-Tree there is no maximum number of neighbours, kVal is unused
+at::Tensor buildEdgesGrid(at::Tensor& embedFeatures, float rVal, int kVal,
+                          bool flipDirections = false);
+
+/// Dispatches either to FRNN or grid based edge building
 ///
 /// @param embedFeatures Tensor of shape (n_nodes, embedding_dim)
 /// @param rVal radius for NN search
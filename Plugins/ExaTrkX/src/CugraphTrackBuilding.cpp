@@ -20,9 +20,11 @@ std::vector<std::vector<int>> CugraphTrackBuilding::operator()(
     std::any, std::any edges, std::any edge_weights,
     std::vector<int> &spacepointIDs, int) {
   auto numSpacepoints = spacepointIDs.size();
-  auto edgesAfterFiltering = std::any_cast<std::vector<int64_t>>(edges);
-  auto numEdgesAfterF = edgesAfterFiltering.size() / 2;
-  auto gOutputCTen = std::any_cast<at::Tensor>(edge_weights);
+  const auto edgeTensor =
+      std::any_cast<torch::Tensor>(edges).to(torch::kCPU, torch::kInt32);
+  const auto edgeWeightTensor =
+      std::any_cast<torch::Tensor>(edge_weights).to(torch::kCPU).contiguous();
+  auto numEdgesAfterF = static_cast<std::size_t>(edgeTensor.size(1));
 
   if (numEdgesAfterF == 0) {
     return {};
@@ -31,18 +33,18 @@ std::vector<std::vector<int>> CugraphTrackBuilding::operator()(
   // ************
   // Track Labeling with cugraph::connected_components
   // ************
-  std::vector<int32_t> rowIndices;
-  std::vector<int32_t> colIndices;
-  std::vector<float> edgeWeights;
+  const auto rowTensor = edgeTensor[0].contiguous();
+  const auto colTensor = edgeTensor[1].contiguous();
+  std::vector<int32_t> rowIndices(rowTensor.data_ptr<int32_t>(),
+                                  rowTensor.data_ptr<int32_t>() +
+                                      numEdgesAfterF);
+  std::vector<int32_t> colIndices(colTensor.data_ptr<int32_t>(),
+                                  colTensor.data_ptr<int32_t>() +
+                                      numEdgesAfterF);
+  std::vector<float> edgeWeights(
+      edgeWeightTensor.data_ptr<float>(),
+      edgeWeightTensor.data_ptr<float>() + numEdgesAfterF);
   std::vector<int32_t> trackLabels(numSpacepoints);
-  std::copy(edgesAfterFiltering.begin(),
-            edgesAfterFiltering.begin() + numEdgesAfterF,
-            std::back_insert_iterator(rowIndices));
-  std::copy(edgesAfterFiltering.begin() + numEdgesAfterF,
-            edgesAfterFiltering.end(), std::back_insert_iterator(colIndices));
-  std::copy(gOutputCTen.data_ptr<float>(),
-            gOutputCTen.data_ptr<float>() + numEdgesAfterF,
-            std::back_insert_iterator(edgeWeights));
 
   ACTS_VERBOSE("run weaklyConnectedComponents");
   weaklyConnectedComponents<int32_t, int32_t, float>(
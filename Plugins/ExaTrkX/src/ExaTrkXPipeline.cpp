@@ -8,6 +8,14 @@
 
 #include "Acts/Plugins/ExaTrkX/ExaTrkXPipeline.hpp"
 
+#include <optional>
+
+#ifndef ACTS_EXATRKX_CPUONLY
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAStream.h>
+#include <torch/cuda.h>
+#endif
+
 namespace Acts {
 
 ExaTrkXPipeline::ExaTrkXPipeline(
@@ -35,6 +43,24 @@ ExaTrkXPipeline::ExaTrkXPipeline(
 std::vector<std::vector<int>> ExaTrkXPipeline::run(
     std::vector<float> &features, std::vector<int> &spacepointIDs,
     int deviceHint, const ExaTrkXHook &hook, ExaTrkXTiming *timing) const {
+#ifdef ACTS_EXATRKX_CPUONLY
+  // There is only a single CPU device
+  deviceHint = -1;
+#else
+  if (!torch::cuda::is_available()) {
+    deviceHint = -1;
+  }
+
+  // Schedule the work of this event on a stream of its own, such that
+  // events processed concurrently by different threads can overlap on the
+  // device instead of being serialized on the default stream
+  std::optional<c10::cuda::CUDAStreamGuard> streamGuard;
+  if (torch::cuda::is_available()) {
+    streamGuard.emplace(c10::cuda::getStreamFromPool(
+        false, deviceHint < 0 ? c10::cuda::current_device() : deviceHint));
+  }
+#endif
+
   auto t0 = std::chrono::high_resolution_clock::now();
   auto [nodes, edges] =
       (*m_graphConstructor)(features, spacepointIDs.size(), deviceHint);
@@ -47,7 +73,9 @@ std::vector<std::vector<int>> ExaTrkXPipeline::run(
   hook(nodes, edges, {});
 
   std::any edge_weights;
-  timing->classifierTimes.clear();
+  if (timing != nullptr) {
+    timing->classifierTimes.clear();
+  }
 
   for (auto edgeClassifier : m_edgeClassifiers) {
     t0 = std::chrono::high_resolution_clock::now();
@@ -76,6 +104,12 @@ std::vector<std::vector<int>> ExaTrkXPipeline::run(
     timing->trackBuildingTime = t1 - t0;
   }
 
+#ifndef ACTS_EXATRKX_CPUONLY
+  if (streamGuard) {
+    streamGuard->current_stream().synchronize();
+  }
+#endif
+
   return res;
 }
 
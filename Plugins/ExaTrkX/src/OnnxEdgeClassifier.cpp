@@ -10,6 +10,7 @@
 
 #include <onnxruntime_cxx_api.h>
 #include <torch/script.h>
+#include <torch/torch.h>
 
 #include "runSessionWithIoBinding.hpp"
 
@@ -49,22 +50,27 @@ std::tuple<std::any, std::any, std::any> OnnxEdgeClassifier::operator()(
   auto memoryInfo = Ort::MemoryInfo::CreateCpu(
       OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault);
 
-  auto eInputTensor = std::any_cast<std::shared_ptr<Ort::Value>>(inputNodes);
-  auto edgeList = std::any_cast<std::vector<int64_t>>(inputEdges);
-  const int numEdges = edgeList.size() / 2;
+  // The session runs on the host, bring the graph there once. The edges are
+  // handed on as tensors on their original device.
+  auto nodes = std::any_cast<torch::Tensor>(inputNodes);
+  auto edgeList = std::any_cast<torch::Tensor>(inputEdges);
+  auto hostNodes = nodes.to(torch::kCPU, torch::kFloat32).contiguous();
+  auto hostEdges = edgeList.to(torch::kCPU, torch::kInt64).contiguous();
+  const int64_t numEdges = hostEdges.size(1);
 
   std::vector<const char *> fInputNames{m_inputNameNodes.c_str(),
                                         m_inputNameEdges.c_str()};
   std::vector<Ort::Value> fInputTensor;
-  fInputTensor.push_back(std::move(*eInputTensor));
-  std::vector<int64_t> fEdgeShape{2, numEdges};
+  fInputTensor.push_back(Ort::Value::CreateTensor<float>(
+      memoryInfo, hostNodes.data_ptr<float>(), hostNodes.numel(),
+      hostNodes.sizes().data(), hostNodes.sizes().size()));
   fInputTensor.push_back(Ort::Value::CreateTensor<int64_t>(
-      memoryInfo, edgeList.data(), edgeList.size(), fEdgeShape.data(),
-      fEdgeShape.size()));
+      memoryInfo, hostEdges.data_ptr<int64_t>(), hostEdges.numel(),
+      hostEdges.sizes().data(), hostEdges.sizes().size()));
 
-  // filtering outputs
+  // filtering outputs, written directly into the score tensor
   std::vector<const char *> fOutputNames{m_outputNameScores.c_str()};
-  std::vector<float> fOutputData(numEdges);
+  auto scores = torch::empty({numEdges}, torch::kFloat32);
 
   auto outputDims = m_model->GetOutputTypeInfo(0)
                         .GetTensorTypeAndShapeInfo()
@@ -73,32 +79,22 @@ std::tuple<std::any, std::any, std::any> OnnxEdgeClassifier::operator()(
   Shape fOutputShape = outputDims == 2 ? Shape{numEdges, 1} : Shape{numEdges};
   std::vector<Ort::Value> fOutputTensor;
   fOutputTensor.push_back(Ort::Value::CreateTensor<float>(
-      memoryInfo, fOutputData.data(), fOutputData.size(), fOutputShape.data(),
-      fOutputShape.size()));
+      memoryInfo, scores.data_ptr<float>(), scores.numel(),
+      fOutputShape.data(), fOutputShape.size()));
   runSessionWithIoBinding(*m_model, fInputNames, fInputTensor, fOutputNames,
                           fOutputTensor);
 
   ACTS_DEBUG("Get scores for " << numEdges << " edges.");
-  torch::Tensor edgeListCTen = torch::tensor(edgeList, {torch::kInt64});
-  edgeListCTen = edgeListCTen.reshape({2, numEdges});
+  scores.sigmoid_();
 
-  torch::Tensor fOutputCTen = torch::tensor(fOutputData, {torch::kFloat32});
-  fOutputCTen = fOutputCTen.sigmoid();
+  torch::Tensor mask = scores > m_cfg.cut;
+  torch::Tensor edgesAfterCut =
+      edgeList.index({Slice(), mask.to(edgeList.device())});
+  ACTS_DEBUG("Finished edge classification, after cut: "
+             << edgesAfterCut.size(1) << " edges.");
 
-  torch::Tensor filterMask = fOutputCTen > m_cfg.cut;
-  torch::Tensor edgesAfterFCTen = edgeListCTen.index({Slice(), filterMask});
-
-  std::vector<int64_t> edgesAfterFiltering;
-  std::copy(edgesAfterFCTen.data_ptr<int64_t>(),
-            edgesAfterFCTen.data_ptr<int64_t>() + edgesAfterFCTen.numel(),
-            std::back_inserter(edgesAfterFiltering));
-
-  int64_t numEdgesAfterF = edgesAfterFiltering.size() / 2;
-  ACTS_DEBUG("Finished edge classification, after cut: " << numEdgesAfterF
-                                                         << " edges.");
-
-  return {std::make_shared<Ort::Value>(std::move(fInputTensor[0])),
-          edgesAfterFiltering, fOutputCTen};
+  return {std::move(nodes), std::move(edgesAfterCut),
+          scores.masked_select(mask)};
 }
 
 }  // namespace Acts
@@ -8,10 +8,12 @@
 
 #include "Acts/Plugins/ExaTrkX/OnnxMetricLearning.hpp"
 
+#include "Acts/Plugins/ExaTrkX/detail/TensorVectorConversion.hpp"
 #include "Acts/Plugins/ExaTrkX/detail/buildEdges.hpp"
 
 #include <onnxruntime_cxx_api.h>
 #include <torch/script.h>
+#include <torch/torch.h>
 
 #include "runSessionWithIoBinding.hpp"
 
@@ -34,30 +36,8 @@ OnnxMetricLearning::OnnxMetricLearning(const Config& cfg,
 
 OnnxMetricLearning::~OnnxMetricLearning() {}
 
-void OnnxMetricLearning::buildEdgesWrapper(std::vector<float>& embedFeatures,
-                                           std::vector<int64_t>& edgeList,
-                                           int64_t numSpacepoints,
-                                           const Logger& logger) const {
-  torch::Device device(torch::kCUDA);
-  auto options =
-      torch::TensorOptions().dtype(torch::kFloat32).device(torch::kCUDA);
-
-  torch::Tensor embedTensor =
-      torch::tensor(embedFeatures, options)
-          .reshape({numSpacepoints, m_cfg.embeddingDim});
-
-  auto stackedEdges = detail::buildEdges(embedTensor, m_cfg.rVal, m_cfg.knnVal);
-
-  stackedEdges = stackedEdges.toType(torch::kInt64).to(torch::kCPU);
-
-  ACTS_VERBOSE("copy edges to std::vector");
-  std::copy(stackedEdges.data_ptr<int64_t>(),
-            stackedEdges.data_ptr<int64_t>() + stackedEdges.numel(),
-            std::back_inserter(edgeList));
-}
-
 std::tuple<std::any, std::any> OnnxMetricLearning::operator()(
-    std::vector<float>& inputValues, std::size_t, int) {
+    std::vector<float>& inputValues, std::size_t, int deviceHint) {
   Ort::AllocatorWithDefaultOptions allocator;
   auto memoryInfo = Ort::MemoryInfo::CreateCpu(
       OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault);
@@ -93,19 +73,23 @@ std::tuple<std::any, std::any> OnnxMetricLearning::operator()(
   // ************
   // Building Edges
   // ************
-  std::vector<int64_t> edgeList;
-  buildEdgesWrapper(eOutputData, edgeList, numSpacepoints, logger());
-  int64_t numEdges = edgeList.size() / 2;
-  ACTS_DEBUG("Graph construction: built " << numEdges << " edges.");
-
-  for (std::size_t i = 0; i < 10; i++) {
-    ACTS_VERBOSE(edgeList[i]);
-  }
-  for (std::size_t i = 0; i < 10; i++) {
-    ACTS_VERBOSE(edgeList[numEdges + i]);
-  }
-
-  return {std::make_shared<Ort::Value>(std::move(eInputTensor[0])), edgeList};
+  // The edges are kept on the device as a torch tensor, the format all
+  // other stages expect, so e.g. a torch edge classifier can consume them
+  // without a round trip through the host
+  const torch::Device device(
+      torch::cuda::is_available() ? torch::kCUDA : torch::kCPU, deviceHint);
+  auto embedTensor =
+      detail::vectorToTensor2D(eOutputData, m_cfg.embeddingDim).to(device);
+  auto edgeList = detail::buildEdges(embedTensor, m_cfg.rVal, m_cfg.knnVal)
+                      .toType(torch::kInt64);
+  ACTS_DEBUG("Graph construction: built " << edgeList.size(1) << " edges.");
+  ACTS_VERBOSE("Slice of edgelist:\n" << edgeList.slice(1, 0, 5));
+
+  // The node features are only referenced by the ONNX input, take ownership
+  auto nodeTensor =
+      detail::vectorToTensor2D(inputValues, m_cfg.spacepointFeatures).clone();
+
+  return {std::move(nodeTensor), std::move(edgeList)};
 }
 
 }  // namespace Acts
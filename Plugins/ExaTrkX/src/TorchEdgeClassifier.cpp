@@ -8,6 +8,8 @@
 
 #include "Acts/Plugins/ExaTrkX/TorchEdgeClassifier.hpp"
 
+#include <algorithm>
+
 #include <torch/script.h>
 #include <torch/torch.h>
 
@@ -72,11 +74,25 @@ std::tuple<std::any, std::any, std::any> TorchEdgeClassifier::operator()(
             ? nodes.index({Slice{}, Slice{None, m_cfg.numFeatures}})
             : nodes;
 
-    if (m_cfg.nChunks > 1) {
+    int nChunks = m_cfg.nChunks;
+#ifndef ACTS_EXATRKX_CPUONLY
+    if (m_cfg.memoryPerEdge > 0 && device.is_cuda()) {
+      std::size_t free = 0, total = 0;
+      cudaMemGetInfo(&free, &total);
+      const std::size_t required = edgeListTmp.size(1) * m_cfg.memoryPerEdge;
+      if (free > 0 && required > free) {
+        nChunks = std::max<int>(nChunks, (required + free - 1) / free);
+      }
+      ACTS_DEBUG("Classify " << edgeListTmp.size(1) << " edges in " << nChunks
+                             << " chunks");
+    }
+#endif
+
+    if (nChunks > 1) {
       std::vector<at::Tensor> results;
-      results.reserve(m_cfg.nChunks);
+      results.reserve(nChunks);
 
-      auto chunks = at::chunk(edgeListTmp, m_cfg.nChunks, 1);
+      auto chunks = at::chunk(edgeListTmp, nChunks, 1);
       for (auto& chunk : chunks) {
         ACTS_VERBOSE("Process chunk with shape" << chunk.sizes());
         inputTensors[1] = chunk;
@@ -11,11 +11,16 @@
 #include "Acts/Plugins/ExaTrkX/detail/TensorVectorConversion.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/KDTree.hpp"
+#include "Acts/Utilities/detail/grid_helper.hpp"
 
+#include <algorithm>
+#include <array>
 #include <iostream>
+#include <limits>
 #include <mutex>
 #include <vector>
 
+#include <ATen/Parallel.h>
 #include <torch/script.h>
 #include <torch/torch.h>
 
@@ -263,15 +268,188 @@ torch::Tensor Acts::detail::buildEdgesKDTree(torch::Tensor &embedFeatures,
   return postprocessEdgeTensor(tensor, true, true, flipDirections);
 }
 
+/// Fixed radius neighbour search on a uniform grid of the first (up to) three
+/// embedding coordinates. The cells are at least as large as the radius, so
+/// only the adjacent cells have to be searched. The points are sorted by cell,
+/// which keeps the distance computations on contiguous memory.
+template <std::size_t Dim>
+struct BuildEdgesGrid {
+  static constexpr std::size_t GridDim = std::min<std::size_t>(Dim, 3);
+
+  static torch::Tensor invoke(torch::Tensor &embedFeatures, float rVal, int) {
+    assert(embedFeatures.size(1) == Dim);
+    const auto features =
+        embedFeatures.to(torch::kCPU, torch::kFloat32).contiguous();
+    const int64_t numNodes = features.size(0);
+    const float *dataPtr = features.data_ptr<float>();
+
+    if (numNodes == 0) {
+      return torch::empty({2, 0}, torch::kInt64);
+    }
+
+    ////////////////
+    // Build grid //
+    ////////////////
+    // limit the memory of the grid, like the CUDA implementation
+    const float maxResolution = 128.f;
+
+    std::array<float, GridDim> lower{};
+    std::array<float, GridDim> upper{};
+    lower.fill(std::numeric_limits<float>::max());
+    upper.fill(std::numeric_limits<float>::lowest());
+    for (int64_t i = 0; i < numNodes; ++i) {
+      for (std::size_t d = 0; d < GridDim; ++d) {
+        lower[d] = std::min(lower[d], dataPtr[i * Dim + d]);
+        upper[d] = std::max(upper[d], dataPtr[i * Dim + d]);
+      }
+    }
+
+    std::array<float, GridDim> invCellSize{};
+    std::array<int64_t, GridDim> numCells{};
+    std::array<int64_t, GridDim> cellStride{};
+    int64_t totalCells = 1;
+    for (std::size_t d = 0; d < GridDim; ++d) {
+      const float extent = upper[d] - lower[d];
+      const float cellSize = std::max(rVal, extent / maxResolution);
+      invCellSize[d] = 1.f / cellSize;
+      numCells[d] = static_cast<int64_t>(extent * invCellSize[d]) + 1;
+      cellStride[d] = totalCells;
+      totalCells *= numCells[d];
+    }
+
+    auto cellCoordinates = [&](const float *point) {
+      std::array<int64_t, GridDim> coords{};
+      for (std::size_t d = 0; d < GridDim; ++d) {
+        coords[d] = std::min(
+            static_cast<int64_t>((point[d] - lower[d]) * invCellSize[d]),
+            numCells[d] - 1);
+      }
+      return coords;
+    };
+    auto linearCell = [&](const std::array<int64_t, GridDim> &coords) {
+      int64_t cell = 0;
+      for (std::size_t d = 0; d < GridDim; ++d) {
+        cell += coords[d] * cellStride[d];
+      }
+      return cell;
+    };
+
+    // counting sort of the points by cell
+    std::vector<int64_t> cells(numNodes);
+    std::vector<int64_t> cellOffsets(totalCells + 1, 0);
+    for (int64_t i = 0; i < numNodes; ++i) {
+      cells[i] = linearCell(cellCoordinates(dataPtr + i * Dim));
+      ++cellOffsets[cells[i] + 1];
+    }
+    for (int64_t c = 0; c < totalCells; ++c) {
+      cellOffsets[c + 1] += cellOffsets[c];
+    }
+
+    std::vector<float> sortedPoints(numNodes * Dim);
+    std::vector<int64_t> sortedIds(numNodes);
+    {
+      std::vector<int64_t> fill(cellOffsets.begin(), cellOffsets.end() - 1);
+      for (int64_t i = 0; i < numNodes; ++i) {
+        const int64_t pos = fill[cells[i]]++;
+        std::copy(dataPtr + i * Dim, dataPtr + (i + 1) * Dim,
+                  sortedPoints.begin() + pos * Dim);
+        sortedIds[pos] = i;
+      }
+    }
+
+    /////////////////
+    // Search grid //
+    /////////////////
+    // The points are processed in chunks in parallel, every pair is only
+    // recorded once, directed from the lower to the higher node index
+    constexpr int64_t numNeighbourCells = Acts::detail::ipow(3, GridDim);
+    const float r2 = rVal * rVal;
+    const int64_t chunkSize = 1024;
+    const int64_t numChunks = (numNodes + chunkSize - 1) / chunkSize;
+    std::vector<std::vector<int64_t>> chunkEdges(numChunks);
+
+    at::parallel_for(0, numChunks, 1, [&](int64_t begin, int64_t end) {
+      for (int64_t chunk = begin; chunk < end; ++chunk) {
+        auto &edges = chunkEdges[chunk];
+        const int64_t stop = std::min(numNodes, (chunk + 1) * chunkSize);
+        for (int64_t p = chunk * chunkSize; p < stop; ++p) {
+          const float *self = sortedPoints.data() + p * Dim;
+          const auto selfCoords = cellCoordinates(self);
+
+          for (int64_t n = 0; n < numNeighbourCells; ++n) {
+            std::array<int64_t, GridDim> coords{};
+            bool inside = true;
+            int64_t offset = n;
+            for (std::size_t d = 0; d < GridDim; ++d) {
+              coords[d] = selfCoords[d] + offset % 3 - 1;
+              offset /= 3;
+              inside = inside && coords[d] >= 0 && coords[d] < numCells[d];
+            }
+            if (!inside) {
+              continue;
+            }
+
+            const int64_t cell = linearCell(coords);
+            for (int64_t q = cellOffsets[cell]; q < cellOffsets[cell + 1];
+                 ++q) {
+              if (sortedIds[q] <= sortedIds[p]) {
+                continue;
+              }
+              const float *other = sortedPoints.data() + q * Dim;
+              float d2 = 0.f;
+              for (std::size_t k = 0; k < Dim; ++k) {
+                const float diff = self[k] - other[k];
+                d2 += diff * diff;
+              }
+              if (d2 <= r2) {
+                edges.push_back(sortedIds[p]);
+                edges.push_back(sortedIds[q]);
+              }
+            }
+          }
+        }
+      }
+    });
+
+    std::size_t numEdges = 0;
+    for (const auto &edges : chunkEdges) {
+      numEdges += edges.size() / 2;
+    }
+
+    auto edgeTensor =
+        torch::empty({2, static_cast<int64_t>(numEdges)}, torch::kInt64);
+    auto edgeAccessor = edgeTensor.accessor<int64_t, 2>();
+    int64_t iedge = 0;
+    for (const auto &edges : chunkEdges) {
+      for (std::size_t i = 0; i < edges.size(); i += 2, ++iedge) {
+        edgeAccessor[0][iedge] = edges[i];
+        edgeAccessor[1][iedge] = edges[i + 1];
+      }
+    }
+
+    return edgeTensor;
+  }
+};
+
+torch::Tensor Acts::detail::buildEdgesGrid(torch::Tensor &embedFeatures,
+                                           float rVal, int kVal,
+                                           bool flipDirections) {
+  auto tensor = Acts::template_switch<BuildEdgesGrid, 1, 12>(
+      embedFeatures.size(1), embedFeatures, rVal, kVal);
+
+  // The edges are unique and free of self loops by construction
+  return postprocessEdgeTensor(tensor, false, false, flipDirections);
+}
+
 torch::Tensor Acts::detail::buildEdges(torch::Tensor &embedFeatures, float rVal,
                                        int kVal, bool flipDirections) {
 #ifndef ACTS_EXATRKX_CPUONLY
   if (torch::cuda::is_available()) {
     return detail::buildEdgesFRNN(embedFeatures, rVal, kVal, flipDirections);
   } else {
-    return detail::buildEdgesKDTree(embedFeatures, rVal, kVal, flipDirections);
+    return detail::buildEdgesGrid(embedFeatures, rVal, kVal, flipDirections);
   }
 #else
-  return detail::buildEdgesKDTree(embedFeatures, rVal, kVal, flipDirections);
+  return detail::buildEdgesGrid(embedFeatures, rVal, kVal, flipDirections);
 #endif
 }
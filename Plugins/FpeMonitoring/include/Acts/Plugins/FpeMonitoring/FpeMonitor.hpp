@@ -116,8 +116,20 @@ class FpeMonitor {
     friend FpeMonitor;
   };
 
+  /// How the floating point exceptions are monitored
+  enum class Mode {
+    /// Trap every exception and record its stack trace
+    Trap,
+    /// Only read the floating point status flags whenever the result is
+    /// requested. Each type raised since the previous request is counted
+    /// once, no stack traces are recorded.
+    Count,
+  };
+
   FpeMonitor();
   explicit FpeMonitor(int excepts);
+  explicit FpeMonitor(Mode mode);
+  FpeMonitor(int excepts, Mode mode);
   FpeMonitor(FpeMonitor &&other) = default;
   ~FpeMonitor();
 
@@ -127,6 +139,8 @@ class FpeMonitor {
 
   void rearm();
 
+  Mode mode() const { return m_mode; }
+
   static std::string stackTraceToString(const boost::stacktrace::stacktrace &st,
                                         std::size_t depth);
   static std::string getSourceLocation(const boost::stacktrace::frame &frame);
@@ -135,6 +149,9 @@ class FpeMonitor {
   void enable();
   void disable();
 
+  /// Count and clear the raised status flags in counting mode
+  void collectStatusFlags();
+
   static void ensureSignalHandlerInstalled();
   static void signalHandler(int signal, siginfo_t *si, void *ctx);
 
@@ -148,6 +165,8 @@ class FpeMonitor {
 
   int m_excepts = 0;
 
+  Mode m_mode = Mode::Trap;
+
   Result m_result;
 
   Buffer m_buffer{65536};
@@ -11,6 +11,7 @@
 #include "Acts/Utilities/Helpers.hpp"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <cfenv>
 #include <csignal>
@@ -22,6 +23,7 @@
 #include <mutex>
 #include <stdexcept>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <boost/stacktrace/frame.hpp>
@@ -109,6 +111,7 @@ bool FpeMonitor::Result::contains(
 
 FpeMonitor::Result &FpeMonitor::result() {
   consumeRecorded();
+  collectStatusFlags();
   return m_result;
 }
 
@@ -180,12 +183,16 @@ void FpeMonitor::Result::deduplicate() {
   }
 }
 
-FpeMonitor::FpeMonitor()
-    : m_excepts{FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW | FE_UNDERFLOW} {
-  enable();
-}
+FpeMonitor::FpeMonitor() : FpeMonitor(Mode::Trap) {}
+
+FpeMonitor::FpeMonitor(int excepts) : FpeMonitor(excepts, Mode::Trap) {}
+
+FpeMonitor::FpeMonitor(Mode mode)
+    : FpeMonitor(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW | FE_UNDERFLOW,
+                 mode) {}
 
-FpeMonitor::FpeMonitor(int excepts) : m_excepts(excepts) {
+FpeMonitor::FpeMonitor(int excepts, Mode mode)
+    : m_excepts(excepts), m_mode(mode) {
   enable();
 }
 
@@ -237,29 +244,69 @@ void FpeMonitor::signalHandler(int /*signal*/, siginfo_t *si, void *ctx) {
 
 void FpeMonitor::enable() {
 #if defined(__linux__) && defined(__x86_64__)
-  ensureSignalHandlerInstalled();
-
-  // clear pending exceptions so they don't immediately fire
-  std::feclearexcept(m_excepts);
+  if (m_mode == Mode::Trap) {
+    ensureSignalHandlerInstalled();
+  }
 
   if (!stack().empty()) {
+    // the flags are cleared below, count them for a counting monitor first
+    stack().top()->collectStatusFlags();
     // unset previous except state
     fedisableexcept(stack().top()->m_excepts);
   }
+
+  // clear pending exceptions so they don't immediately fire
+  std::feclearexcept(m_excepts);
+
   // apply this stack
-  feenableexcept(m_excepts);
+  if (m_mode == Mode::Trap) {
+    feenableexcept(m_excepts);
+  }
 
   stack().push(this);
 #else
   (void)m_excepts;
+  (void)m_mode;
 #endif
 }
 
 void FpeMonitor::rearm() {
   consumeRecorded();
+  collectStatusFlags();
 #if defined(__linux__) && defined(__x86_64__)
   std::feclearexcept(m_excepts);
-  feenableexcept(m_excepts);
+  if (m_mode == Mode::Trap) {
+    feenableexcept(m_excepts);
+  }
+#endif
+}
+
+void FpeMonitor::collectStatusFlags() {
+#if defined(__linux__) && defined(__x86_64__)
+  // the flags belong to the innermost monitor only
+  if (m_mode != Mode::Count || stack().empty() || stack().top() != this) {
+    return;
+  }
+
+  int raised = std::fetestexcept(m_excepts);
+  if (raised == 0) {
+    return;
+  }
+
+  static constexpr std::array<std::pair<int, FpeType>, 5> flagTypes = {{
+      {FE_DIVBYZERO, FpeType::FLTDIV},
+      {FE_INVALID, FpeType::FLTINV},
+      {FE_OVERFLOW, FpeType::FLTOVF},
+      {FE_UNDERFLOW, FpeType::FLTUND},
+      {FE_INEXACT, FpeType::FLTRES},
+  }};
+  for (const auto &[flag, type] : flagTypes) {
+    if ((raised & flag) != 0) {
+      m_result.m_counts.at(static_cast<uint32_t>(type))++;
+    }
+  }
+
+  std::feclearexcept(raised);
 #endif
 }
 
@@ -281,6 +328,7 @@ void FpeMonitor::ensureSignalHandlerInstalled() {
 
 void FpeMonitor::disable() {
 #if defined(__linux__) && defined(__x86_64__)
+  collectStatusFlags();
   std::feclearexcept(m_excepts);
   assert(!stack().empty() && "FPE stack shouldn't be empty at this point");
   stack().pop();
@@ -289,7 +337,9 @@ void FpeMonitor::disable() {
   if (!stack().empty()) {
     // restore excepts from next stack element
     std::feclearexcept(stack().top()->m_excepts);
-    feenableexcept(stack().top()->m_excepts);
+    if (stack().top()->m_mode == Mode::Trap) {
+      feenableexcept(stack().top()->m_excepts);
+    }
   }
 #endif
 }
@@ -11,6 +11,10 @@
 #include "Acts/Plugins/GeoModel/GeoModelTree.hpp"
 
 #include <string>
+#include <utility>
+#include <vector>
+
+#include <GeoModelKernel/GeoVPhysVol.h>
 
 namespace Acts::GeoModelReader {
 
@@ -21,4 +25,17 @@ namespace Acts::GeoModelReader {
 /// @return world/top volume of the GeoModel tree in memory
 GeoModelTree readFromDb(const std::string& dbPath);
 
+/// @brief Select sub-detectors of the GeoModel tree by name
+///
+/// Only the direct children of the world volume are searched, such that
+/// a subsequent conversion can visit the requested sub-detectors only.
+///
+/// @param geoModel the GeoModel tree read from the database
+/// @param names the names of the world volume children to select
+///
+/// @return the selected child volumes and their names, in the order of the
+///         world volume children
+std::vector<std::pair<std::string, PVConstLink>> selectSubVolumes(
+    const GeoModelTree& geoModel, const std::vector<std::string>& names);
+
 }  // namespace Acts::GeoModelReader
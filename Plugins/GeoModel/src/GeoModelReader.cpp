@@ -8,6 +8,9 @@
 
 #include "Acts/Plugins/GeoModel/GeoModelReader.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+
 #include <GeoModelDBManager/GMDBManager.h>
 #include <GeoModelKernel/GeoFullPhysVol.h>
 #include <GeoModelRead/ReadGeoModel.h>
@@ -24,3 +27,20 @@ Acts::GeoModelTree Acts::GeoModelReader::readFromDb(const std::string& dbPath) {
   GeoModelTree geoModel{geoReader, geoReader->buildGeoModel()};
   return geoModel;
 }
+
+std::vector<std::pair<std::string, PVConstLink>>
+Acts::GeoModelReader::selectSubVolumes(const GeoModelTree& geoModel,
+                                       const std::vector<std::string>& names) {
+  if (geoModel.worldVolume == nullptr) {
+    throw std::invalid_argument("GeoModelReader: No world volume present");
+  }
+  std::vector<std::pair<std::string, PVConstLink>> subVolumes;
+  const GeoVPhysVol& world = *geoModel.worldVolume;
+  for (unsigned int ic = 0; ic < world.getNChildVols(); ++ic) {
+    std::string name = world.getNameOfChildVol(ic);
+    if (std::find(names.begin(), names.end(), name) != names.end()) {
+      subVolumes.emplace_back(std::move(name), world.getChildVol(ic));
+    }
+  }
+  return subVolumes;
+}
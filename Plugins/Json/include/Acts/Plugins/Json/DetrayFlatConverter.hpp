@@ -0,0 +1,220 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Detector/detail/IndexedSurfacesGenerator.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Navigation/InternalNavigation.hpp"
+#include "Acts/Navigation/NavigationDelegates.hpp"
+#include "Acts/Plugins/Json/DetrayJsonHelper.hpp"
+#include "Acts/Utilities/GridAxisGenerators.hpp"
+#include "Acts/Utilities/IAxis.hpp"
+#include "Acts/Utilities/TypeList.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+namespace Experimental {
+class Detector;
+}
+
+/// Export of a detector into flat, detray ordered buffers
+///
+/// This is the in-memory counterpart of the detray json format written by
+/// @c DetectorJsonConverter::toJsonDetray, i.e. the same shape, mask,
+/// acceleration link and bin conventions apply, but the content is kept in
+/// contiguous arrays that can be copied into the detray stores directly.
+namespace DetrayFlatConverter {
+
+/// A grid axis in the detray convention
+struct Axis {
+  /// 1 for bound, 2 for closed axes
+  unsigned int bounds = 1u;
+  /// 0 for regular, 1 for irregular binning
+  unsigned int binning = 0u;
+  /// The number of bins, without under- and overflow
+  std::size_t bins = 0u;
+  /// The range for regular, all bin edges for irregular binning
+  std::vector<ActsScalar> edges = {};
+};
+
+/// A surface grid with all bin contents in one array
+///
+/// The bins are serialized in local bin order with the last axis running
+/// fastest, under- and overflow bins are dropped. The content of bin @c i
+/// are the entries in [binOffsets[i], binOffsets[i+1]).
+struct SurfaceGrid {
+  /// The index of the volume owning the grid
+  std::size_t ownerLink = 0u;
+  /// The detray acceleration structure type
+  std::size_t accelerationLink = 0u;
+  /// The grid axes, in detray order
+  std::vector<Axis> axes = {};
+  /// The offsets of the bins into the entries
+  std::vector<std::size_t> binOffsets = {0u};
+  /// The surface indices of all bins
+  std::vector<std::size_t> entries = {};
+};
+
+/// A surface with its mask
+struct Surface {
+  /// The translation followed by the rotation, column by column
+  std::array<ActsScalar, 12u> transform = {};
+  /// The detray mask shape
+  unsigned int shape = 13u;
+  /// The offset of the mask boundaries into the mask values
+  std::size_t maskOffset = 0u;
+  /// The number of mask boundaries
+  std::size_t maskSize = 0u;
+  /// The index of the volume the surface belongs to
+  std::size_t volumeLink = 0u;
+  /// 1 for sensitive, 2 for passive surfaces
+  unsigned int type = 2u;
+  /// The geometry identifier of the source surface
+  std::uint64_t source = 0u;
+};
+
+/// The flat detector buffers
+struct Detector {
+  /// The surfaces of all volumes, volume by volume
+  std::vector<Surface> surfaces = {};
+  /// The surface range of each volume, one more entry than volumes
+  std::vector<std::size_t> volumeSurfaceOffsets = {0u};
+  /// The mask boundaries of all surfaces
+  std::vector<ActsScalar> maskValues = {};
+  /// The surface grids of the volumes that have one
+  std::vector<SurfaceGrid> surfaceGrids = {};
+};
+
+/// Fill the axis in detray convention
+///
+/// @param axis the axis to convert
+///
+/// @return the converted axis
+Axis convertAxis(const IAxis& axis);
+
+/// Convert a grid of surface indices
+///
+/// @tparam grid_type the type of the grid
+/// @param grid the grid object
+/// @param swapAxes whether the two axes are swapped for detray
+///
+/// @return the flat grid, without owner and acceleration link
+template <typename grid_type>
+SurfaceGrid convertGrid(const grid_type& grid, bool swapAxes = false) {
+  SurfaceGrid fGrid;
+  std::array<const IAxis*, grid_type::DIM> axes = grid.axes();
+  if constexpr (grid_type::DIM == 2u) {
+    if (swapAxes) {
+      std::swap(axes[0u], axes[1u]);
+    }
+  }
+  for (const auto* axis : axes) {
+    fGrid.axes.push_back(convertAxis(*axis));
+  }
+
+  auto fillBin = [&](typename grid_type::index_t lbin) {
+    const auto& content = grid.atLocalBins(lbin);
+    fGrid.entries.insert(fGrid.entries.end(), content.begin(), content.end());
+    fGrid.binOffsets.push_back(fGrid.entries.size());
+  };
+
+  if constexpr (grid_type::DIM == 1u) {
+    fGrid.binOffsets.reserve(axes[0u]->getNBins() + 1u);
+    for (std::size_t ib0 = 1u; ib0 <= axes[0u]->getNBins(); ++ib0) {
+      fillBin({ib0});
+    }
+  }
+  if constexpr (grid_type::DIM == 2u) {
+    fGrid.binOffsets.reserve(axes[0u]->getNBins() * axes[1u]->getNBins() +
+                             1u);
+    for (std::size_t ib0 = 1u; ib0 <= axes[0u]->getNBins(); ++ib0) {
+      for (std::size_t ib1 = 1u; ib1 <= axes[1u]->getNBins(); ++ib1) {
+        // Lookup bin - respect a potential swap for the lookup
+        fillBin({swapAxes ? ib1 : ib0, swapAxes ? ib0 : ib1});
+      }
+    }
+  }
+  return fGrid;
+}
+
+/// @brief Convert the indexed surfaces if they are of the reference type
+///
+/// @note It does nothing if the type does not match
+///
+/// @param fGrid [in,out] the grid to be filled
+/// @param delegate the delegate to be translated
+/// @param refInstance is a reference instance for the type casting
+template <typename instance_type>
+void convert(std::optional<SurfaceGrid>& fGrid,
+             const Experimental::InternalNavigationDelegate& delegate,
+             [[maybe_unused]] const instance_type& refInstance) {
+  using GridType =
+      typename instance_type::template grid_type<std::vector<std::size_t>>;
+  using DelegateType = Experimental::IndexedSurfacesAllPortalsNavigation<
+      GridType, Experimental::IndexedSurfacesNavigation>;
+  using SubDelegateType = Experimental::IndexedSurfacesNavigation<GridType>;
+
+  const auto* instance = delegate.instance();
+  auto castedDelegate = dynamic_cast<const DelegateType*>(instance);
+  if (castedDelegate != nullptr) {
+    const auto& indexedSurfaces =
+        std::get<SubDelegateType>(castedDelegate->updators);
+    // Same axis swap as in the detray json writing
+    bool swapAxes = false;
+    if constexpr (GridType::DIM == 2u) {
+      swapAxes = indexedSurfaces.casts[0u] == binZ &&
+                 indexedSurfaces.casts[1u] == binPhi;
+    }
+    fGrid = convertGrid(indexedSurfaces.grid, swapAxes);
+    fGrid->accelerationLink =
+        DetrayJsonHelper::accelerationLink(indexedSurfaces.casts);
+  }
+}
+
+/// @brief Unrolling function for catching the right instance
+///
+/// @param fGrid [in,out] the grid to be filled
+/// @param delegate the delegate to be translated
+template <typename... Args>
+void unrollConvert(std::optional<SurfaceGrid>& fGrid,
+                   const Experimental::InternalNavigationDelegate& delegate,
+                   TypeList<Args...> /*unused*/) {
+  (convert(fGrid, delegate, Args{}), ...);
+}
+
+/// Convert the indexed surfaces of a navigation delegate
+///
+/// @param delegate the delegate to be translated
+///
+/// @return the flat grid, if the delegate holds indexed surfaces
+std::optional<SurfaceGrid> convertIndexedSurfaces(
+    const Experimental::InternalNavigationDelegate& delegate);
+
+/// Convert the surfaces and surface grids of a detector
+///
+/// @param gctx the geometry context
+/// @param detector the detector to convert
+///
+/// @note the portals are not part of the flat export, they are written
+///       through the detray json format
+///
+/// @return the flat detector buffers
+Detector convert(const GeometryContext& gctx,
+                 const Experimental::Detector& detector);
+
+}  // namespace DetrayFlatConverter
+}  // namespace Acts
@@ -0,0 +1,53 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Plugins/Json/ActsJson.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Acts {
+
+namespace JsonFileReader {
+
+/// The encodings a json document can be read from
+enum class Encoding {
+  Json,
+  Cbor,
+  MessagePack,
+  Ubjson,
+  Bson,
+};
+
+/// @brief Deduce the encoding from the file extension
+///
+/// @param path the file path, with one of the extensions `.cbor`,
+///        `.msgpack`, `.ubjson` or `.bson` for the binary encodings
+///
+/// @return the encoding, `Json` for any other extension
+Encoding encodingFromPath(const std::string& path);
+
+/// @brief Read a json document from a file
+///
+/// The document is parsed directly from the file in the encoding given by
+/// the file extension. If an entry path is given, the document is parsed
+/// with a SAX handler that only keeps the requested entry: all other values
+/// are discarded while parsing and the parsing stops after the entry, such
+/// that the rest of the document is never held in memory.
+///
+/// @param path the file path
+/// @param entryPath the keys of the nested objects that lead to the entry
+///
+/// @return the json object of the entry, or the whole document
+nlohmann::json read(const std::string& path,
+                    const std::vector<std::string>& entryPath = {});
+
+}  // namespace JsonFileReader
+}  // namespace Acts
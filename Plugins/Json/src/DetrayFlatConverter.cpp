@@ -0,0 +1,78 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/Json/DetrayFlatConverter.hpp"
+
+#include "Acts/Detector/Detector.hpp"
+#include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Enumerate.hpp"
+
+Acts::DetrayFlatConverter::Axis Acts::DetrayFlatConverter::convertAxis(
+    const IAxis& axis) {
+  Axis fAxis;
+  fAxis.bounds =
+      axis.getBoundaryType() == Acts::detail::AxisBoundaryType::Bound ? 1u
+                                                                      : 2u;
+  fAxis.binning = axis.isEquidistant() ? 0u : 1u;
+  fAxis.bins = axis.getNBins();
+  auto edges = axis.getBinEdges();
+  if (axis.isEquidistant()) {
+    fAxis.edges = {edges.front(), edges.back()};
+  } else {
+    fAxis.edges = {edges.begin(), edges.end()};
+  }
+  return fAxis;
+}
+
+std::optional<Acts::DetrayFlatConverter::SurfaceGrid>
+Acts::DetrayFlatConverter::convertIndexedSurfaces(
+    const Experimental::InternalNavigationDelegate& delegate) {
+  std::optional<SurfaceGrid> fGrid = std::nullopt;
+  unrollConvert(fGrid, delegate, GridAxisGenerators::PossibleAxes{});
+  return fGrid;
+}
+
+Acts::DetrayFlatConverter::Detector Acts::DetrayFlatConverter::convert(
+    const GeometryContext& gctx, const Experimental::Detector& detector) {
+  Detector fDetector;
+  const auto volumes = detector.volumes();
+  fDetector.volumeSurfaceOffsets.reserve(volumes.size() + 1u);
+  for (const auto [iv, volume] : enumerate(volumes)) {
+    for (const auto* surface : volume->surfaces()) {
+      Surface fSurface;
+      const Transform3& transform = surface->transform(gctx);
+      const Vector3 translation = transform.translation();
+      const RotationMatrix3 rotation = transform.rotation();
+      std::copy(translation.data(), translation.data() + 3u,
+                fSurface.transform.begin());
+      // Eigen stores the rotation column by column
+      std::copy(rotation.data(), rotation.data() + 9u,
+                fSurface.transform.begin() + 3u);
+      auto [shape, boundaries] =
+          DetrayJsonHelper::maskFromBounds(surface->bounds());
+      fSurface.shape = shape;
+      fSurface.maskOffset = fDetector.maskValues.size();
+      fSurface.maskSize = boundaries.size();
+      fDetector.maskValues.insert(fDetector.maskValues.end(),
+                                  boundaries.begin(), boundaries.end());
+      fSurface.volumeLink = iv;
+      fSurface.type = surface->geometryId().sensitive() > 0 ? 1u : 2u;
+      fSurface.source = surface->geometryId().value();
+      fDetector.surfaces.push_back(fSurface);
+    }
+    fDetector.volumeSurfaceOffsets.push_back(fDetector.surfaces.size());
+
+    auto fGrid = convertIndexedSurfaces(volume->internalNavigation());
+    if (fGrid.has_value()) {
+      fGrid->ownerLink = iv;
+      fDetector.surfaceGrids.push_back(std::move(fGrid.value()));
+    }
+  }
+  return fDetector;
+}
@@ -0,0 +1,213 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/Json/JsonFileReader.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+bool hasExtension(const std::string& path, const std::string& extension) {
+  return (path.size() >= extension.size()) &&
+         (path.compare(path.size() - extension.size(), extension.size(),
+                       extension) == 0);
+}
+
+nlohmann::json::input_format_t inputFormat(
+    Acts::JsonFileReader::Encoding encoding) {
+  using Encoding = Acts::JsonFileReader::Encoding;
+  using Format = nlohmann::json::input_format_t;
+  switch (encoding) {
+    case Encoding::Cbor:
+      return Format::cbor;
+    case Encoding::MessagePack:
+      return Format::msgpack;
+    case Encoding::Ubjson:
+      return Format::ubjson;
+    case Encoding::Bson:
+      return Format::bson;
+    default:
+      return Format::json;
+  }
+}
+
+/// SAX handler that builds the json object of a single entry
+///
+/// The values outside of the entry are dropped as they are parsed. Parsing
+/// is aborted once the entry is complete.
+class EntrySax : public nlohmann::json_sax<nlohmann::json> {
+ public:
+  EntrySax(const std::vector<std::string>& entryPath, nlohmann::json& entry)
+      : m_entryPath(entryPath), m_entry(entry) {}
+
+  bool found() const { return m_found; }
+
+  bool null() override { return value(nullptr); }
+  bool boolean(bool val) override { return value(val); }
+  bool number_integer(number_integer_t val) override { return value(val); }
+  bool number_unsigned(number_unsigned_t val) override { return value(val); }
+  bool number_float(number_float_t val, const string_t& /*s*/) override {
+    return value(val);
+  }
+  bool string(string_t& val) override { return value(std::move(val)); }
+  bool binary(binary_t& val) override {
+    return value(nlohmann::json::binary(std::move(val)));
+  }
+
+  bool start_object(std::size_t /*elements*/) override {
+    return start(nlohmann::json::object());
+  }
+  bool start_array(std::size_t /*elements*/) override {
+    // the entry path only leads through objects
+    return start(nlohmann::json::array());
+  }
+  bool end_object() override { return end(); }
+  bool end_array() override { return end(); }
+
+  bool key(string_t& val) override {
+    m_key = std::move(val);
+    return true;
+  }
+
+  bool parse_error(std::size_t /*position*/, const std::string& /*token*/,
+                   const nlohmann::detail::exception& ex) override {
+    throw ex;
+  }
+
+ private:
+  /// Whether the next value is the requested entry
+  bool atEntry() const {
+    const std::size_t depth = m_onPath.size();
+    if (depth == 0) {
+      return m_entryPath.empty();
+    }
+    return m_onPath.back() && (depth == m_entryPath.size()) &&
+           (m_key == m_entryPath[depth - 1]);
+  }
+
+  /// Whether the next value is an object on the way to the entry
+  bool onPath() const {
+    const std::size_t depth = m_onPath.size();
+    if (depth == 0) {
+      return true;
+    }
+    return m_onPath.back() && (depth < m_entryPath.size()) &&
+           (m_key == m_entryPath[depth - 1]);
+  }
+
+  /// Insert a value into the innermost container of the entry
+  nlohmann::json* insert(nlohmann::json&& val) {
+    nlohmann::json& parent = *m_stack.back();
+    if (parent.is_array()) {
+      parent.push_back(std::move(val));
+      return &parent.back();
+    }
+    nlohmann::json& slot = parent[m_key];
+    slot = std::move(val);
+    return &slot;
+  }
+
+  bool value(nlohmann::json&& val) {
+    if (!m_stack.empty()) {
+      insert(std::move(val));
+    } else if (atEntry()) {
+      m_entry = std::move(val);
+      m_found = true;
+      return false;
+    }
+    return true;
+  }
+
+  bool start(nlohmann::json&& container) {
+    if (!m_stack.empty()) {
+      m_stack.push_back(insert(std::move(container)));
+    } else if (atEntry()) {
+      m_entry = std::move(container);
+      m_stack.push_back(&m_entry);
+    } else {
+      m_onPath.push_back(container.is_object() && onPath());
+    }
+    return true;
+  }
+
+  bool end() {
+    if (m_stack.empty()) {
+      m_onPath.pop_back();
+      return true;
+    }
+    m_stack.pop_back();
+    if (m_stack.empty()) {
+      m_found = true;
+      return false;
+    }
+    return true;
+  }
+
+  const std::vector<std::string>& m_entryPath;
+  nlohmann::json& m_entry;
+  bool m_found = false;
+  string_t m_key;
+  /// For the open containers outside the entry, whether they are on the path
+  std::vector<bool> m_onPath;
+  /// The open containers inside the entry
+  std::vector<nlohmann::json*> m_stack;
+};
+
+}  // namespace
+
+Acts::JsonFileReader::Encoding Acts::JsonFileReader::encodingFromPath(
+    const std::string& path) {
+  if (hasExtension(path, ".cbor")) {
+    return Encoding::Cbor;
+  }
+  if (hasExtension(path, ".msgpack")) {
+    return Encoding::MessagePack;
+  }
+  if (hasExtension(path, ".ubjson")) {
+    return Encoding::Ubjson;
+  }
+  if (hasExtension(path, ".bson")) {
+    return Encoding::Bson;
+  }
+  return Encoding::Json;
+}
+
+nlohmann::json Acts::JsonFileReader::read(
+    const std::string& path, const std::vector<std::string>& entryPath) {
+  std::ifstream in(path, std::ifstream::in | std::ifstream::binary);
+  if (!in.good()) {
+    throw std::runtime_error{"Unable to open input JSON file: " + path};
+  }
+
+  const Encoding encoding = encodingFromPath(path);
+  if (entryPath.empty()) {
+    switch (encoding) {
+      case Encoding::Cbor:
+        return nlohmann::json::from_cbor(in);
+      case Encoding::MessagePack:
+        return nlohmann::json::from_msgpack(in);
+      case Encoding::Ubjson:
+        return nlohmann::json::from_ubjson(in);
+      case Encoding::Bson:
+        return nlohmann::json::from_bson(in);
+      default:
+        return nlohmann::json::parse(in);
+    }
+  }
+
+  nlohmann::json entry;
+  EntrySax sax(entryPath, entry);
+  // the parsing is aborted by the handler once the entry is complete
+  nlohmann::json::sax_parse(in, &sax, inputFormat(encoding), false);
+  if (!sax.found()) {
+    throw std::invalid_argument{"Entry not found in JSON file: " + path};
+  }
+  return entry;
+}
@@ -16,6 +16,8 @@
 
 #include "Acts/Plugins/Json/JsonMaterialDecorator.hpp"
 
+#include "Acts/Plugins/Json/JsonFileReader.hpp"
+
 namespace Acts {
 
 JsonMaterialDecorator::JsonMaterialDecorator(
@@ -30,20 +32,7 @@ JsonMaterialDecorator::JsonMaterialDecorator(
   Acts::MaterialMapJsonConverter jmConverter(rConfig, level);
 
   ACTS_VERBOSE("Reading JSON material description from: " << jFileName);
-  std::ifstream ifj(jFileName.c_str());
-  if (!ifj.good()) {
-    throw std::runtime_error{"Unable to open input JSON material file: " +
-                             jFileName};
-  }
-  nlohmann::json jin;
-
-  if (jFileName.find(".cbor") != std::string::npos) {
-    std::vector<std::uint8_t> iCbor((std::istreambuf_iterator<char>(ifj)),
-                                    std::istreambuf_iterator<char>());
-    jin = nlohmann::json::from_cbor(iCbor);
-  } else {
-    ifj >> jin;
-  }
+  nlohmann::json jin = JsonFileReader::read(jFileName);
 
   auto maps = jmConverter.jsonToMaterialMaps(jin);
   m_surfaceMaterialMap = maps.first;
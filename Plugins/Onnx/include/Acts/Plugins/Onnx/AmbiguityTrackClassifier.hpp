@@ -27,9 +27,10 @@ class AmbiguityTrackClassifier {
   /// Construct the ambiguity scoring algorithm.
   ///
   /// @param modelPath path to the model file
-  AmbiguityTrackClassifier(const char* modelPath)
+  /// @param useCuda run the model with the CUDA execution provider
+  AmbiguityTrackClassifier(const char* modelPath, bool useCuda = false)
       : m_env(ORT_LOGGING_LEVEL_WARNING, "MLClassifier"),
-        m_duplicateClassifier(m_env, modelPath) {}
+        m_duplicateClassifier(m_env, modelPath, useCuda) {}
 
   /// Compute a score for each track to be used in the track selection
   ///
@@ -7,6 +7,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #pragma once
+#include <memory>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -26,9 +27,19 @@ class OnnxRuntimeBase {
 
   /// @brief Parametrized constructor
   ///
+  /// The session is shared between all instances that load the same model
+  /// with the same settings, sessions can be run concurrently.
+  ///
   /// @param env the ONNX runtime environment
   /// @param modelPath the path to the ML model in *.onnx format
-  OnnxRuntimeBase(Ort::Env& env, const char* modelPath);
+  /// @param useCuda run the model with the CUDA execution provider, the
+  ///        inputs are then staged in pinned host memory and the session is
+  ///        run with IO binding
+  /// @param intraOpThreads number of threads used within one inference, by
+  ///        default one as the events are already processed in parallel,
+  ///        0 lets the runtime pick
+  OnnxRuntimeBase(Ort::Env& env, const char* modelPath, bool useCuda = false,
+                  int intraOpThreads = 1);
 
   /// @brief Default destructor
   ~OnnxRuntimeBase() = default;
@@ -59,13 +70,15 @@ class OnnxRuntimeBase {
 
  private:
   /// ONNX runtime session / model properties
-  std::unique_ptr<Ort::Session> m_session;
+  std::shared_ptr<Ort::Session> m_session;
   std::vector<Ort::AllocatedStringPtr> m_inputNodeNamesAllocated;
   std::vector<const char*> m_inputNodeNames;
   std::vector<int64_t> m_inputNodeDims;
   std::vector<Ort::AllocatedStringPtr> m_outputNodeNamesAllocated;
   std::vector<const char*> m_outputNodeNames;
   std::vector<std::vector<int64_t>> m_outputNodeDims;
+  /// Run with the CUDA execution provider
+  bool m_useCuda = false;
 };
 
 }  // namespace Acts
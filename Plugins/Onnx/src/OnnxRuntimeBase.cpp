@@ -8,18 +8,66 @@
 
 #include "Acts/Plugins/Onnx/OnnxRuntimeBase.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <map>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <tuple>
+
+namespace {
+
+/// Sessions by model path, execution provider and number of threads
+using SessionKey = std::tuple<std::string, bool, int>;
+
+std::shared_ptr<Ort::Session> getSession(Ort::Env& env, const char* modelPath,
+                                         bool useCuda, int intraOpThreads) {
+  static std::mutex mutex;
+  static std::map<SessionKey, std::weak_ptr<Ort::Session>> sessions;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& cached = sessions[SessionKey{modelPath, useCuda, intraOpThreads}];
+  if (auto session = cached.lock()) {
+    return session;
+  }
 
-// Parametrized constructor
-Acts::OnnxRuntimeBase::OnnxRuntimeBase(Ort::Env& env, const char* modelPath) {
   // Set the ONNX runtime session options
   Ort::SessionOptions sessionOptions;
   // Set graph optimization level
   sessionOptions.SetGraphOptimizationLevel(
       GraphOptimizationLevel::ORT_ENABLE_BASIC);
+  if (intraOpThreads > 0) {
+    sessionOptions.SetIntraOpNumThreads(intraOpThreads);
+  }
+  if (useCuda) {
+    OrtCUDAProviderOptions cudaOptions{};
+    cudaOptions.device_id = 0;
+    // Grow the arena by what is requested instead of by powers of two, the
+    // device is usually shared with the other GPU plugins
+    cudaOptions.arena_extend_strategy = 1;
+    try {
+      sessionOptions.AppendExecutionProvider_CUDA(cudaOptions);
+    } catch (const Ort::Exception& e) {
+      throw std::runtime_error(
+          std::string("OnnxRuntimeBase: CUDA execution provider not "
+                      "available: ") +
+          e.what());
+    }
+  }
   // Create the Ort session
-  m_session = std::make_unique<Ort::Session>(env, modelPath, sessionOptions);
+  auto session = std::make_shared<Ort::Session>(env, modelPath, sessionOptions);
+  cached = session;
+  return session;
+}
+
+}  // namespace
+
+// Parametrized constructor
+Acts::OnnxRuntimeBase::OnnxRuntimeBase(Ort::Env& env, const char* modelPath,
+                                       bool useCuda, int intraOpThreads)
+    : m_session(getSession(env, modelPath, useCuda, intraOpThreads)),
+      m_useCuda(useCuda) {
   // Default allocator
   Ort::AllocatorWithDefaultOptions allocator;
 
@@ -99,23 +147,48 @@ Acts::OnnxRuntimeBase::runONNXInferenceMultiOutput(
         "size");
   }
 
-  // Create input tensor object from data values
   Ort::MemoryInfo memoryInfo =
       Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
-  Ort::Value inputTensor = Ort::Value::CreateTensor<float>(
-      memoryInfo, inputTensorValues.data(), inputTensorValues.size(),
-      inputNodeDims.data(), inputNodeDims.size());
-  // Double-check that inputTensor is a Tensor
-  if (!inputTensor.IsTensor()) {
-    throw std::runtime_error(
-        "runONNXInference: conversion of input to Tensor failed. ");
+  std::vector<Ort::Value> outputTensors;
+  if (m_useCuda) {
+    // Stage the input in pinned host memory, such that it is copied to the
+    // device asynchronously, and let the runtime copy the outputs back
+    Ort::MemoryInfo pinnedInfo("CudaPinned", OrtDeviceAllocator, 0,
+                               OrtMemTypeCPUOutput);
+    Ort::Allocator pinnedAllocator(*m_session, pinnedInfo);
+    Ort::Value inputTensor = Ort::Value::CreateTensor<float>(
+        pinnedAllocator, inputNodeDims.data(), inputNodeDims.size());
+    if (!inputTensor.IsTensor()) {
+      throw std::runtime_error(
+          "runONNXInference: conversion of input to Tensor failed. ");
+    }
+    std::copy_n(inputTensorValues.data(), inputTensorValues.size(),
+                inputTensor.GetTensorMutableData<float>());
+
+    Ort::IoBinding ioBinding(*m_session);
+    ioBinding.BindInput(m_inputNodeNames.front(), inputTensor);
+    for (const char* outputName : m_outputNodeNames) {
+      ioBinding.BindOutput(outputName, memoryInfo);
+    }
+    m_session->Run(Ort::RunOptions{nullptr}, ioBinding);
+    outputTensors = ioBinding.GetOutputValues();
+  } else {
+    // Create input tensor object from data values
+    Ort::Value inputTensor = Ort::Value::CreateTensor<float>(
+        memoryInfo, inputTensorValues.data(), inputTensorValues.size(),
+        inputNodeDims.data(), inputNodeDims.size());
+    // Double-check that inputTensor is a Tensor
+    if (!inputTensor.IsTensor()) {
+      throw std::runtime_error(
+          "runONNXInference: conversion of input to Tensor failed. ");
+    }
+    // Score model on input tensors, get back output tensors
+    Ort::RunOptions run_options;
+    outputTensors =
+        m_session->Run(run_options, m_inputNodeNames.data(), &inputTensor,
+                       m_inputNodeNames.size(), m_outputNodeNames.data(),
+                       m_outputNodeNames.size());
   }
-  // Score model on input tensors, get back output tensors
-  Ort::RunOptions run_options;
-  std::vector<Ort::Value> outputTensors =
-      m_session->Run(run_options, m_inputNodeNames.data(), &inputTensor,
-                     m_inputNodeNames.size(), m_outputNodeNames.data(),
-                     m_outputNodeNames.size());
 
   // Double-check that outputTensors contains Tensors and that the count matches
   // that of output nodes
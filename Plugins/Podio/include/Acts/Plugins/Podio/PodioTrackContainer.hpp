@@ -311,7 +311,7 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
                            const ActsPodioEdm::TrackCollection& collection)
       : PodioTrackContainerBase{helper}, m_collection{&collection} {
     // Not much we can do to recover dynamic columns here
-    populateSurfaceBuffer(m_helper, *m_collection, m_surfaces);
+    m_surfaceBuffer.reset(m_collection->size());
   }
 
   ConstPodioTrackContainer(const PodioUtil::ConversionHelper& helper,
@@ -338,7 +338,7 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
       throw std::runtime_error{"Unable to get collection " + tracksKey};
     }
 
-    populateSurfaceBuffer(m_helper, *m_collection, m_surfaces);
+    m_surfaceBuffer.reset(m_collection->size());
 
     podio_detail::recoverDynamicColumns(frame, tracksKey, m_dynamic);
   }
@@ -354,7 +354,7 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
   std::size_t size_impl() const { return m_collection->size(); }
 
   const Surface* referenceSurface_impl(IndexType itrack) const {
-    return m_surfaces.at(itrack).get();
+    return m_surfaceBuffer.get(m_helper, *m_collection, itrack);
   }
 
   ParticleHypothesis particleHypothesis_impl(IndexType itrack) const {
@@ -384,6 +384,7 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
   friend PodioTrackContainerBase;
 
   const ActsPodioEdm::TrackCollection* m_collection;
+  podio_detail::ConstSurfaceBuffer m_surfaceBuffer;
   std::unordered_map<HashedString,
                      std::unique_ptr<podio_detail::ConstDynamicColumnBase>>
       m_dynamic;
@@ -198,7 +198,7 @@ class ConstPodioTrackStateContainer final
         m_params{&params},
         m_jacs{&jacs} {
     // Not much we can do to recover dynamic columns here
-    populateSurfaceBuffer(m_helper, *m_collection, m_surfaces);
+    m_surfaceBuffer.reset(m_collection->size());
   }
 
   /// Construct a const track state container from a mutable
@@ -246,7 +246,7 @@ class ConstPodioTrackStateContainer final
                                                             paramsKey);
     loadCollection<ActsPodioEdm::JacobianCollection>(m_jacs, frame, jacsKey);
 
-    populateSurfaceBuffer(m_helper, *m_collection, m_surfaces);
+    m_surfaceBuffer.reset(m_collection->size());
 
     podio_detail::recoverDynamicColumns(frame, trackStatesKey, m_dynamic);
   }
@@ -324,7 +324,7 @@ class ConstPodioTrackStateContainer final
   }
 
   const Surface* referenceSurface_impl(IndexType istate) const {
-    return m_surfaces.at(istate).get();
+    return m_surfaceBuffer.get(m_helper, *m_collection, istate);
   }
 
  private:
@@ -334,7 +334,7 @@ class ConstPodioTrackStateContainer final
   const ActsPodioEdm::TrackStateCollection* m_collection;
   const ActsPodioEdm::BoundParametersCollection* m_params;
   const ActsPodioEdm::JacobianCollection* m_jacs;
-  std::vector<std::shared_ptr<const Surface>> m_surfaces;
+  podio_detail::ConstSurfaceBuffer m_surfaceBuffer;
 
   std::unordered_map<HashedString,
                      std::unique_ptr<podio_detail::ConstDynamicColumnBase>>
@@ -705,7 +705,7 @@ ConstPodioTrackStateContainer::ConstPodioTrackStateContainer(
       m_collection{other.m_collection.get()},
       m_params{other.m_params.get()},
       m_jacs{other.m_jacs.get()},
-      m_surfaces{other.m_surfaces} {
+      m_surfaceBuffer{other.m_surfaces} {
   for (const auto& [key, col] : other.m_dynamic) {
     m_dynamic.insert({key, col->asConst()});
   }
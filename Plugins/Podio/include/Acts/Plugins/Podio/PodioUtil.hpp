@@ -17,6 +17,9 @@
 
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 #include <podio/Frame.h>
 
@@ -50,6 +53,47 @@ ActsPodioEdm::Surface convertSurfaceToPodio(const ConversionHelper& helper,
 }  // namespace PodioUtil
 
 namespace podio_detail {
+/// Reference surfaces of the elements of a read-only podio collection
+///
+/// The surfaces are only converted when they are first accessed. Every
+/// surface that is not known to the conversion helper is allocated anew, which
+/// is avoided for the elements whose reference surface is never used.
+class ConstSurfaceBuffer {
+ public:
+  ConstSurfaceBuffer() = default;
+
+  /// Construct from already converted surfaces
+  explicit ConstSurfaceBuffer(
+      const std::vector<std::shared_ptr<const Surface>>& surfaces)
+      : m_surfaces(surfaces.begin(), surfaces.end()) {}
+
+  /// Drop the converted surfaces and size the buffer for a collection
+  void reset(std::size_t size) {
+    m_surfaces.clear();
+    m_surfaces.resize(size);
+  }
+
+  /// Return the reference surface of an element, converting it if needed
+  template <typename collection_t>
+  const Surface* get(const PodioUtil::ConversionHelper& helper,
+                     const collection_t& collection, std::size_t index) const {
+    std::lock_guard<std::mutex> lock{*m_mutex};
+    std::optional<std::shared_ptr<const Surface>>& surface =
+        m_surfaces.at(index);
+    if (!surface.has_value()) {
+      surface = PodioUtil::convertSurfaceFromPodio(
+          helper, collection.at(index).getReferenceSurface());
+    }
+    return surface->get();
+  }
+
+ private:
+  mutable std::vector<std::optional<std::shared_ptr<const Surface>>>
+      m_surfaces;
+  // held by pointer to keep the owning containers movable
+  std::unique_ptr<std::mutex> m_mutex = std::make_unique<std::mutex>();
+};
+
 /// This is used by both the track and track state container, so the
 /// implementation is shared here
 void recoverDynamicColumns(
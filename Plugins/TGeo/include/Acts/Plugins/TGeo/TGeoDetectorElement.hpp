@@ -20,6 +20,7 @@
 
 namespace Acts {
 
+class GeometryComponentRegistry;
 class ISurfaceMaterial;
 class SurfaceBounds;
 class PlanarBounds;
@@ -74,11 +75,13 @@ class TGeoDetectorElement : public Acts::DetectorElementBase {
   ///       should be translated to a disc surface. Per default it will be
   ///       translated into a cylindrical surface.
   /// @param material Possible material of detector element
+  /// @param componentRegistry Optional registry to share identical bounds
   TGeoDetectorElement(
       const Identifier& identifier, const TGeoNode& tGeoNode,
       const TGeoMatrix& tGeoMatrix = TGeoIdentity(),
       const std::string& axes = "XYZ", double scalor = 10.,
-      std::shared_ptr<const Acts::ISurfaceMaterial> material = nullptr);
+      std::shared_ptr<const Acts::ISurfaceMaterial> material = nullptr,
+      GeometryComponentRegistry* componentRegistry = nullptr);
 
   /// Constructor with pre-computed surface
   ///
@@ -35,6 +35,7 @@ class TGeoNode;
 
 namespace Acts {
 
+class GeometryComponentRegistry;
 class TGeoDetectorElement;
 class ITGeoDetectorElementSplitter;
 class Surface;
@@ -100,6 +101,13 @@ class TGeoLayerBuilder : public ILayerBuilder {
       const std::string& axes, double scalor,
       std::shared_ptr<const Acts::ISurfaceMaterial> material);
 
+  /// Element factory sharing the bounds of identical modules
+  ///
+  /// @param componentRegistry the registry interning the bounds, it is kept
+  ///        alive by the returned factory
+  static ElementFactory sharedElementFactory(
+      std::shared_ptr<GeometryComponentRegistry> componentRegistry);
+
   /// @struct Config
   /// @brief nested configuration struct for steering of the layer builder
   struct Config {
@@ -114,6 +122,11 @@ class TGeoLayerBuilder : public ILayerBuilder {
         detectorElementSplitter = nullptr;
     /// Factory for creating detector elements based on TGeoNodes
     ElementFactory elementFactory = defaultElementFactory;
+    /// Convert the selected nodes of a layer concurrently within the
+    /// @c Acts::maxThreads budget
+    /// @note the element factory, the identifier provider and the splitter
+    ///       are then called concurrently and have to be thread-safe
+    bool convertConcurrently = false;
     /// Layer creator
     std::shared_ptr<const LayerCreator> layerCreator = nullptr;
     /// ProtoLayer helper
@@ -199,6 +212,14 @@ class TGeoLayerBuilder : public ILayerBuilder {
   void buildLayers(const GeometryContext& gctx, LayerVector& layers,
                    int type = 0);
 
+  /// Private helper method : split the element conversion over the threads
+  ///
+  /// @param nElements the number of elements to convert
+  /// @param convertRange converts the elements in [first, last)
+  void convertElements(
+      std::size_t nElements,
+      const std::function<void(std::size_t, std::size_t)>& convertRange) const;
+
   /// Private helper method : register splitting input
   void registerSplit(std::vector<double>& parameters, double test,
                      double tolerance, std::pair<double, double>& range) const;
@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -54,6 +55,10 @@ struct TGeoParser {
     bool onBranch = false;
     // The currently collected nodes
     std::vector<SelectedNode> selectedNodes = {};
+    // Name matches per volume, many nodes place the same volume
+    std::unordered_map<const TGeoVolume*, bool> volumeMatches = {};
+    // Target name matches per volume
+    std::unordered_map<const TGeoVolume*, bool> targetMatches = {};
   };
 
   /// @brief Nested configuration struct
@@ -9,6 +9,7 @@
 #include "Acts/Plugins/TGeo/TGeoDetectorElement.hpp"
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryComponentRegistry.hpp"
 #include "Acts/Plugins/TGeo/TGeoSurfaceConverter.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/DiscSurface.hpp"
@@ -30,10 +31,26 @@
 
 using Line2D = Eigen::Hyperplane<double, 2>;
 
+namespace {
+
+/// Replace freshly converted bounds by registered ones, if a registry is given
+template <typename bounds_t>
+std::shared_ptr<const bounds_t> shareBounds(
+    Acts::GeometryComponentRegistry* componentRegistry,
+    std::shared_ptr<const bounds_t> bounds) {
+  if (componentRegistry == nullptr) {
+    return bounds;
+  }
+  return componentRegistry->shareBounds(std::move(bounds));
+}
+
+}  // namespace
+
 Acts::TGeoDetectorElement::TGeoDetectorElement(
     const Identifier& identifier, const TGeoNode& tGeoNode,
     const TGeoMatrix& tGeoMatrix, const std::string& axes, double scalor,
-    std::shared_ptr<const Acts::ISurfaceMaterial> material)
+    std::shared_ptr<const Acts::ISurfaceMaterial> material,
+    GeometryComponentRegistry* componentRegistry)
     : Acts::DetectorElementBase(),
       m_detElement(&tGeoNode),
       m_identifier(identifier) {
@@ -49,10 +66,11 @@ Acts::TGeoDetectorElement::TGeoDetectorElement(
       TGeoSurfaceConverter::cylinderComponents(*tgShape, rotation, translation,
                                                axes, scalor);
   if (cBounds != nullptr) {
+    auto sharedBounds = shareBounds(componentRegistry, std::move(cBounds));
     m_transform = cTransform;
-    m_bounds = cBounds;
+    m_bounds = sharedBounds;
     m_thickness = cThickness;
-    m_surface = Surface::makeShared<CylinderSurface>(cBounds, *this);
+    m_surface = Surface::makeShared<CylinderSurface>(sharedBounds, *this);
   }
 
   // Check next if you do not have a surface
@@ -61,10 +79,11 @@ Acts::TGeoDetectorElement::TGeoDetectorElement(
         TGeoSurfaceConverter::discComponents(*tgShape, rotation, translation,
                                              axes, scalor);
     if (dBounds != nullptr) {
-      m_bounds = dBounds;
+      auto sharedBounds = shareBounds(componentRegistry, std::move(dBounds));
+      m_bounds = sharedBounds;
       m_transform = dTransform;
       m_thickness = dThickness;
-      m_surface = Surface::makeShared<DiscSurface>(dBounds, *this);
+      m_surface = Surface::makeShared<DiscSurface>(sharedBounds, *this);
     }
   }
 
@@ -74,10 +93,11 @@ Acts::TGeoDetectorElement::TGeoDetectorElement(
         TGeoSurfaceConverter::planeComponents(*tgShape, rotation, translation,
                                               axes, scalor);
     if (pBounds != nullptr) {
-      m_bounds = pBounds;
+      auto sharedBounds = shareBounds(componentRegistry, std::move(pBounds));
+      m_bounds = sharedBounds;
       m_transform = pTransform;
       m_thickness = pThickness;
-      m_surface = Surface::makeShared<PlaneSurface>(pBounds, *this);
+      m_surface = Surface::makeShared<PlaneSurface>(sharedBounds, *this);
     }
   }
 
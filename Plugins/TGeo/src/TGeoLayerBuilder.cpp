@@ -18,7 +18,9 @@
 #include "Acts/Plugins/TGeo/TGeoParser.hpp"
 #include "Acts/Plugins/TGeo/TGeoPrimitivesHelper.hpp"
 #include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
+#include <algorithm>
 #include <ostream>
 #include <stdexcept>
 
@@ -231,23 +233,31 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
       ACTS_DEBUG("- number of selected nodes found : "
                  << tgpState.selectedNodes.size());
 
-      for (auto& snode : tgpState.selectedNodes) {
-        auto identifier =
-            m_cfg.identifierProvider != nullptr
-                ? m_cfg.identifierProvider->identify(gctx, *snode.node)
-                : TGeoDetectorElement::Identifier();
-
-        auto tgElement =
-            m_cfg.elementFactory(identifier, *snode.node, *snode.transform,
-                                 layerCfg.localAxes, m_cfg.unit, nullptr);
-
-        std::vector<std::shared_ptr<const Acts::TGeoDetectorElement>>
-            tgElements =
-                (m_cfg.detectorElementSplitter == nullptr)
-                    ? std::vector<std::shared_ptr<
-                          const Acts::TGeoDetectorElement>>{tgElement}
-                    : m_cfg.detectorElementSplitter->split(gctx, tgElement);
+      // Convert the selected nodes, possibly split over several threads
+      std::vector<std::vector<std::shared_ptr<const TGeoDetectorElement>>>
+          convertedElements(tgpState.selectedNodes.size());
+      auto convertRange = [&](std::size_t first, std::size_t last) {
+        for (std::size_t in = first; in < last; ++in) {
+          const auto& snode = tgpState.selectedNodes[in];
+          auto identifier =
+              m_cfg.identifierProvider != nullptr
+                  ? m_cfg.identifierProvider->identify(gctx, *snode.node)
+                  : TGeoDetectorElement::Identifier();
+
+          auto tgElement =
+              m_cfg.elementFactory(identifier, *snode.node, *snode.transform,
+                                   layerCfg.localAxes, m_cfg.unit, nullptr);
+
+          convertedElements[in] =
+              (m_cfg.detectorElementSplitter == nullptr)
+                  ? std::vector<std::shared_ptr<
+                        const Acts::TGeoDetectorElement>>{tgElement}
+                  : m_cfg.detectorElementSplitter->split(gctx, tgElement);
+        }
+      };
+      convertElements(tgpState.selectedNodes.size(), convertRange);
 
+      for (const auto& tgElements : convertedElements) {
         for (const auto& tge : tgElements) {
           m_elementStore.push_back(tge);
           layerSurfaces.push_back(tge->surface().getSharedPtr());
@@ -306,3 +316,39 @@ Acts::TGeoLayerBuilder::defaultElementFactory(
   return std::make_shared<TGeoDetectorElement>(
       identifier, tGeoNode, tGeoMatrix, axes, scalor, std::move(material));
 }
+
+void Acts::TGeoLayerBuilder::convertElements(
+    std::size_t nElements,
+    const std::function<void(std::size_t, std::size_t)>& convertRange) const {
+  std::size_t nChunks =
+      m_cfg.convertConcurrently
+          ? std::clamp<std::size_t>(maxThreads(), 1,
+                                    std::max<std::size_t>(nElements, 1))
+          : 1;
+  if (nChunks == 1) {
+    convertRange(0, nElements);
+    return;
+  }
+  ACTS_VERBOSE("- converting " << nElements << " elements in " << nChunks
+                               << " chunks.");
+  // Contiguous ranges of elements, the calling thread converts the first one
+  std::size_t chunk = (nElements + nChunks - 1) / nChunks;
+  parallelFor(nChunks, [&](std::size_t it) {
+    convertRange(std::min(it * chunk, nElements),
+                 std::min((it + 1) * chunk, nElements));
+  });
+}
+
+Acts::TGeoLayerBuilder::ElementFactory
+Acts::TGeoLayerBuilder::sharedElementFactory(
+    std::shared_ptr<GeometryComponentRegistry> componentRegistry) {
+  return [componentRegistry = std::move(componentRegistry)](
+             const TGeoDetectorElement::Identifier& identifier,
+             const TGeoNode& tGeoNode, const TGeoMatrix& tGeoMatrix,
+             const std::string& axes, double scalor,
+             std::shared_ptr<const Acts::ISurfaceMaterial> material) {
+    return std::make_shared<TGeoDetectorElement>(
+        identifier, tGeoNode, tGeoMatrix, axes, scalor, std::move(material),
+        componentRegistry.get());
+  };
+}
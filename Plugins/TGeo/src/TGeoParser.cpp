@@ -20,16 +20,30 @@
 #include "TObjArray.h"
 #include "TObject.h"
 
+namespace {
+
+/// Match the volume name against the patterns, once per volume
+bool matchVolume(std::unordered_map<const TGeoVolume*, bool>& matches,
+                 const std::vector<std::string>& patterns,
+                 const TGeoVolume& volume) {
+  auto [it, inserted] = matches.try_emplace(&volume, false);
+  if (inserted) {
+    it->second = Acts::TGeoPrimitivesHelper::match(patterns, volume.GetName());
+  }
+  return it->second;
+}
+
+}  // namespace
+
 void Acts::TGeoParser::select(Acts::TGeoParser::State& state,
                               const Acts::TGeoParser::Options& options,
                               const TGeoMatrix& gmatrix) {
   // Volume is present
   if (state.volume != nullptr) {
-    std::string volumeName = state.volume->GetName();
     // If you are on branch, you stay on branch
     state.onBranch =
         state.onBranch ||
-        TGeoPrimitivesHelper::match(options.volumeNames, volumeName.c_str());
+        matchVolume(state.volumeMatches, options.volumeNames, *state.volume);
     // Loop over the daughters and collect them
     auto daughters = state.volume->GetNodes();
     // Daughter node iteration
@@ -45,15 +59,14 @@ void Acts::TGeoParser::select(Acts::TGeoParser::State& state,
   } else if (state.node != nullptr) {
     // The node name for checking
     std::string nodeName = state.node->GetName();
-    std::string nodeVolName = state.node->GetVolume()->GetName();
     // Get the matrix of the current node for positioning
     const TGeoMatrix* nmatrix = state.node->GetMatrix();
     TGeoHMatrix transform = TGeoCombiTrans(gmatrix) * TGeoCombiTrans(*nmatrix);
     std::string suffix = "_transform";
     transform.SetName((nodeName + suffix).c_str());
     // Check if you had found the target node
-    if (state.onBranch &&
-        TGeoPrimitivesHelper::match(options.targetNames, nodeVolName.c_str())) {
+    if (state.onBranch && matchVolume(state.targetMatches, options.targetNames,
+                                      *state.node->GetVolume())) {
       // Get the placement and orientation in respect to its mother
       const Double_t* rotation = transform.GetRotationMatrix();
       const Double_t* translation = transform.GetTranslation();
@@ -0,0 +1,22 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+
+namespace Acts::Test {
+
+/// The number of heap allocations done through the global operator new
+///
+/// The counting operator new is defined in AllocationCounter.cpp, which has
+/// to be compiled into the benchmark executable for the replacement to take
+/// effect.
+std::size_t allocationCount();
+
+}  // namespace Acts::Test
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -162,6 +163,17 @@ int main(int /*argc*/, char** /*argv[]*/) {
     run_bench_with_inputs(
         [&](const auto& point) { return aBounds.inside(point, check); }, points,
         "Random");
+
+    // The same points as one batch, one iteration checks all points
+    std::unique_ptr<bool[]> results(new bool[points.size()]);
+    auto batch_result = Acts::Test::microBenchmark(
+        [&] {
+          aBounds.insideBatch(points.data(), points.size(), check,
+                              results.get());
+          return results[0];
+        },
+        1, NTESTS_SLOW);
+    print_bench_result("Random batch", batch_result);
   };
 
   // Benchmark scenarios
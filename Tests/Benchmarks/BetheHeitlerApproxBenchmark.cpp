@@ -0,0 +1,78 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Acts::Logging::INFO;
+  unsigned int toys = 1;
+  std::size_t nBins = 1;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("toys",po::value<unsigned int>(&toys)->default_value(1000000),"number of mixtures to evaluate")
+      ("bins",po::value<std::size_t>(&nBins)->default_value(1000),"number of lookup table bins per range")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("BetheHeitlerApprox", Acts::Logging::Level(lvl)));
+
+  // typical material of a silicon layer up to a few layers at once
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(0.002, 0.2);
+  std::vector<double> xOverX0(1024);
+  for (auto& x : xOverX0) {
+    x = uniform(rng);
+  }
+
+  const auto approx = makeDefaultBetheHeitlerApprox();
+  auto tabulated = approx;
+  tabulated.useLookupTable(nBins);
+
+  std::size_t index = 0;
+  const auto polynomials = Acts::Test::microBenchmark(
+      [&] { return approx.mixture(xOverX0[index++ % xOverX0.size()]); }, 1,
+      toys);
+  ACTS_INFO("Execution stats polynomials: " << polynomials);
+
+  index = 0;
+  const auto table = Acts::Test::microBenchmark(
+      [&] { return tabulated.mixture(xOverX0[index++ % xOverX0.size()]); }, 1,
+      toys);
+  ACTS_INFO("Execution stats lookup table: " << table);
+
+  return 0;
+}
@@ -9,12 +9,15 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 
 #include <algorithm>
 #include <chrono>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -129,5 +132,49 @@ int main(int /*argc*/, char** /*argv[]*/) {
                   Mode::SlowOutside);
   run_all_benches(BoundaryCheck(cov, 3.0), "Cov. tolerance", Mode::SlowOutside);
 
+  // The same trapezoid and its bounding box as surface bounds, checked one
+  // position at a time and as a batch of positions
+  const TrapezoidBounds trapezoid(0.1, 0.3, 0.25);
+  const RectangleBounds rectangle(0.3, 0.25);
+  constexpr std::size_t NBATCH = 1'000;
+  std::vector<Vector2> batch(NBATCH);
+  std::generate(batch.begin(), batch.end(),
+                [&] { return random_point() - center; });
+  std::unique_ptr<bool[]> batchResults(new bool[NBATCH]);
+
+  auto run_batch_benches = [&](const SurfaceBounds& bounds,
+                               const BoundaryCheck& check,
+                               const std::string& check_name) {
+    print_bench_header(check_name);
+    // one iteration checks all positions
+    auto single_result = Acts::Test::microBenchmark(
+        [&] {
+          std::size_t nInside = 0;
+          for (const auto& point : batch) {
+            nInside += bounds.inside(point, check) ? 1 : 0;
+          }
+          return nInside;
+        },
+        1, NTESTS_SLOW);
+    print_bench_result("Single positions", single_result);
+    auto batch_result = Acts::Test::microBenchmark(
+        [&] {
+          bounds.insideBatch(batch.data(), batch.size(), check,
+                             batchResults.get());
+          return batchResults[0];
+        },
+        1, NTESTS_SLOW);
+    print_bench_result("Batch", batch_result);
+  };
+
+  run_batch_benches(rectangle, BoundaryCheck(true), "Rectangle no tolerance");
+  run_batch_benches(rectangle, BoundaryCheck(true, true, 0.1, 0.1),
+                    "Rectangle abs. tolerance");
+  run_batch_benches(trapezoid, BoundaryCheck(true), "Trapezoid no tolerance");
+  run_batch_benches(trapezoid, BoundaryCheck(true, true, 0.1, 0.1),
+                    "Trapezoid abs. tolerance");
+  run_batch_benches(trapezoid, BoundaryCheck(cov, 3.0),
+                    "Trapezoid cov. tolerance");
+
   return 0;
 }
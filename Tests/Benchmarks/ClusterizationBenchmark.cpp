@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Clusterization/Clusterization.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+namespace {
+
+struct Cell {
+  Cell(int rowv, int colv) : row(rowv), col(colv) {}
+  int row, col;
+  Acts::Ccl::Label label{Acts::Ccl::NO_LABEL};
+};
+
+int getCellRow(const Cell& cell) {
+  return cell.row;
+}
+
+int getCellColumn(const Cell& cell) {
+  return cell.col;
+}
+
+Acts::Ccl::Label& getCellLabel(Cell& cell) {
+  return cell.label;
+}
+
+using Cluster = std::vector<Cell>;
+
+void clusterAddCell(Cluster& cl, const Cell& cell) {
+  cl.push_back(cell);
+}
+
+// Same connectivity as the default, but takes the generic labelling path
+struct GenericConnect {
+  Acts::Ccl::Connect2D<Cell> connect;
+  Acts::Ccl::ConnectResult operator()(const Cell& ref,
+                                      const Cell& iter) const {
+    return connect(ref, iter);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int size = 1000;
+  unsigned int nClusters = 500;
+  unsigned int clusterSize = 20;
+  unsigned int runs = 500;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("size", po::value<int>(&size)->default_value(1000), "number of rows and columns of the sensor")
+      ("clusters", po::value<unsigned int>(&nClusters)->default_value(500), "number of clusters per sensor")
+      ("cluster-size", po::value<unsigned int>(&clusterSize)->default_value(20), "number of cells per cluster")
+      ("runs", po::value<unsigned int>(&runs)->default_value(500), "number of benchmark runs");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  // Clusters grown as random walks from random seeds, every cell once
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> coord(0, size - 1);
+  std::uniform_int_distribution<int> step(-1, 1);
+  std::set<std::pair<int, int>> occupied;
+  for (unsigned int ic = 0; ic < nClusters; ++ic) {
+    int row = coord(rng);
+    int col = coord(rng);
+    for (unsigned int is = 0; is < clusterSize; ++is) {
+      occupied.emplace(row, col);
+      row = std::clamp(row + step(rng), 0, size - 1);
+      col = std::clamp(col + step(rng), 0, size - 1);
+    }
+  }
+  std::vector<Cell> cells;
+  cells.reserve(occupied.size());
+  for (const auto& [row, col] : occupied) {
+    cells.emplace_back(row, col);
+  }
+  std::shuffle(cells.begin(), cells.end(), rng);
+
+  std::cout << "Clustering " << cells.size() << " cells on a " << size << "x"
+            << size << " sensor" << std::endl;
+
+  for (bool commonCorner : {true, false}) {
+    std::cout << (commonCorner ? "8" : "4") << "-cell connectivity"
+              << std::endl;
+
+    const auto runLabelling = Acts::Test::microBenchmark(
+        [&] {
+          std::vector<Cell> input = cells;
+          return Acts::Ccl::createClusters<std::vector<Cell>,
+                                           std::vector<Cluster>>(
+                     input, Acts::Ccl::DefaultConnect<Cell>(commonCorner))
+              .size();
+        },
+        1, runs);
+    std::cout << "- run labelling: " << runLabelling << std::endl;
+
+    const auto genericLabelling = Acts::Test::microBenchmark(
+        [&] {
+          std::vector<Cell> input = cells;
+          return Acts::Ccl::createClusters<std::vector<Cell>,
+                                           std::vector<Cluster>, 2>(
+                     input,
+                     GenericConnect{Acts::Ccl::Connect2D<Cell>(commonCorner)})
+              .size();
+        },
+        1, runs);
+    std::cout << "- generic labelling: " << genericLabelling << std::endl;
+  }
+
+  return 0;
+}
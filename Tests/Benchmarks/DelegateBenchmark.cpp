@@ -0,0 +1,145 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Delegate.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace Acts::Test {
+
+using namespace Acts::detail::Test;
+
+namespace {
+
+const unsigned int nReps = 100;
+
+/// Stand-in for a cheap per candidate call like a selection cut
+struct Cut {
+  double maxValue = 0.5;
+
+  bool accept(double value) const { return value < maxValue; }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(benchmark_delegate_cut) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  std::vector<double> values(1000);
+  for (auto& value : values) {
+    value = uniform(rng);
+  }
+
+  Cut cut;
+  Delegate<bool(double)> runtime;
+  runtime.connect<&Cut::accept>(&cut);
+  StaticDelegate<bool(double), &Cut::accept, Cut> bound(&cut);
+
+  // Count the accepted values of all candidates of a surface
+  auto count = [&](const auto& accept) {
+    std::size_t n = 0;
+    for (double value : values) {
+      n += accept(value) ? 1 : 0;
+    }
+    return n;
+  };
+
+  std::cout << "Cut " << values.size() << " candidates" << std::endl;
+  std::cout << "- direct: "
+            << microBenchmark(
+                   [&] {
+                     return count(
+                         [&](double value) { return cut.accept(value); });
+                   },
+                   nReps / 10)
+            << std::endl;
+  std::cout << "- Delegate: "
+            << microBenchmark([&] { return count(runtime); }, nReps / 10)
+            << std::endl;
+  std::cout << "- StaticDelegate: "
+            << microBenchmark([&] { return count(bound); }, nReps / 10)
+            << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_delegate_updater) {
+  using TrackStateProxy = VectorMultiTrajectory::TrackStateProxy;
+
+  const GeometryContext gctx;
+  const Logger& logger = getDummyLogger();
+
+  // One predicted state with a two dimensional measurement
+  VectorMultiTrajectory traj;
+  auto ts = traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+  BoundVector parameters;
+  parameters << 0.3, 0.5, 0.5 * M_PI, 0.3 * M_PI, 0.01, 0.;
+  BoundSquareMatrix covariance = BoundSquareMatrix::Zero();
+  covariance.diagonal() << 0.08, 0.3, 1, 1, 1, 1;
+  ts.predicted() = parameters;
+  ts.predictedCovariance() = covariance;
+  testSourceLinkCalibrator<VectorMultiTrajectory>(
+      gctx, CalibrationContext{},
+      SourceLink{TestSourceLink(eBoundLoc0, eBoundLoc1, Vector2(-0.1, 0.45),
+                                Vector2(0.04, 0.1).asDiagonal())},
+      ts);
+
+  using Signature = Result<void>(const GeometryContext&, TrackStateProxy,
+                                 Direction, const Logger&);
+  GainMatrixUpdater updater;
+  Delegate<Signature> runtime;
+  runtime.connect<&GainMatrixUpdater::operator()<VectorMultiTrajectory>>(
+      &updater);
+  StaticDelegate<Signature,
+                 &GainMatrixUpdater::operator()<VectorMultiTrajectory>,
+                 GainMatrixUpdater>
+      bound(&updater);
+
+  std::cout << "GainMatrixUpdater" << std::endl;
+  std::cout << "- direct: "
+            << microBenchmark(
+                   [&] {
+                     return updater
+                         .operator()<VectorMultiTrajectory>(
+                             gctx, ts, Direction::Forward, logger)
+                         .ok();
+                   },
+                   nReps)
+            << std::endl;
+  std::cout << "- Delegate: "
+            << microBenchmark(
+                   [&] {
+                     return runtime(gctx, ts, Direction::Forward, logger).ok();
+                   },
+                   nReps)
+            << std::endl;
+  std::cout << "- StaticDelegate: "
+            << microBenchmark(
+                   [&] {
+                     return bound(gctx, ts, Direction::Forward, logger).ok();
+                   },
+                   nReps)
+            << std::endl;
+}
+
+}  // namespace Acts::Test
@@ -0,0 +1,340 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MultiEigenStepperLoop.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+#include "Acts/TrackFitting/FitterTimers.hpp"
+#include "Acts/TrackFitting/GainMatrixSmoother.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/TrackFitting/GaussianSumFitter.hpp"
+#include "Acts/TrackFitting/GlobalChiSquareFitter.hpp"
+#include "Acts/TrackFitting/GsfMixtureReduction.hpp"
+#include "Acts/TrackFitting/KalmanFitter.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+using namespace Acts::Test;
+using namespace Acts::detail::Test;
+
+namespace {
+
+using Trajectory = VectorMultiTrajectory;
+using Tracks =
+    TrackContainer<VectorTrackContainer, Trajectory, detail::ValueHolder>;
+
+/// A truth track with its measurements and smeared start parameters
+struct FitInput {
+  std::vector<SourceLink> sourceLinks;
+  BoundTrackParameters start;
+};
+
+/// Fit all inputs a number of times and print the throughput and the time
+/// per fit spent in the timed phases.
+///
+/// The fitter phases are only filled if the fitters were compiled with
+/// ACTS_ENABLE_FITTER_TIMERS. The phases run by the propagation actors are
+/// given in @p nested and subtracted from the propagation time.
+template <typename fit_t>
+void runFits(const std::string& name, const std::vector<FitInput>& inputs,
+             unsigned int runs, std::initializer_list<FitterPhase> nested,
+             const fit_t& fit, const Logger& logger) {
+  Tracks tracks{VectorTrackContainer{}, Trajectory{}};
+
+  // warm up the caches and the allocations of the track container
+  for (const auto& input : inputs) {
+    tracks.clear();
+    fit(input, tracks);
+  }
+  FitterTimers::local().clear();
+
+  std::size_t nFits = 0;
+  std::size_t nFailures = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int run = 0; run < runs; ++run) {
+    for (const auto& input : inputs) {
+      tracks.clear();
+      if (!fit(input, tracks)) {
+        ++nFailures;
+      }
+      ++nFits;
+    }
+  }
+  const std::chrono::duration<double, std::milli> total =
+      std::chrono::steady_clock::now() - start;
+
+  const FitterTimers& timers = FitterTimers::local();
+  ACTS_INFO(name << ": " << nFits << " fits, " << nFailures << " failed");
+  ACTS_INFO(name << ": fits per second = " << 1e3 * nFits / total.count());
+  ACTS_INFO(name << ": time per fit = " << total.count() / nFits << " ms");
+
+  for (auto phase : {FitterPhase::eCalibration, FitterPhase::eUpdate,
+                     FitterPhase::eSmoothing, FitterPhase::eMixtureReduction}) {
+    const auto& timer = timers[phase];
+    if (timer.calls == 0) {
+      continue;
+    }
+    ACTS_INFO(name << ":   " << FitterTimers::name(phase) << " = "
+                   << 1e-6 * timer.time.count() / nFits << " ms per fit, "
+                   << 1. * timer.calls / nFits << " calls per fit");
+  }
+  const auto& propagation = timers[FitterPhase::ePropagation];
+  if (propagation.calls != 0) {
+    auto exclusive = propagation.time;
+    for (auto phase : nested) {
+      exclusive -= timers[phase].time;
+    }
+    ACTS_INFO(name << ":   " << FitterTimers::name(FitterPhase::ePropagation)
+                   << " (exclusive) = " << 1e-6 * exclusive.count() / nFits
+                   << " ms per fit, " << 1. * propagation.calls / nFits
+                   << " calls per fit");
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int nTracks = 0;
+  unsigned int runs = 0;
+  double ptInGeV = 0;
+  double etaMax = 0;
+  bool runKf = false;
+  bool runGsf = false;
+  bool runGx2f = false;
+  unsigned int lvl = 0;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("tracks",po::value<unsigned int>(&nTracks)->default_value(100),"number of distinct tracks")
+      ("runs",po::value<unsigned int>(&runs)->default_value(10),"number of times each track is fitted")
+      ("pT",po::value<double>(&ptInGeV)->default_value(10),"transverse momentum in GeV")
+      ("eta-max",po::value<double>(&etaMax)->default_value(1),"maximum absolute pseudorapidity")
+      ("kf",po::value<bool>(&runKf)->default_value(true),"run the Kalman fitter")
+      ("gsf",po::value<bool>(&runGsf)->default_value(true),"run the Gaussian sum fitter")
+      ("gx2f",po::value<bool>(&runGx2f)->default_value(true),"run the global chi square fitter")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Fitter", Logging::Level(lvl)));
+
+#ifndef ACTS_ENABLE_FITTER_TIMERS
+  ACTS_WARNING("compiled without ACTS_ENABLE_FITTER_TIMERS, only the total "
+               "fit time is measured");
+#endif
+
+  GeometryContext tgContext;
+  MagneticFieldContext mfContext;
+  CalibrationContext calContext;
+
+  // The cylindrical test detector with silicon modules and material
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, 2_T));
+
+  using Stepper = EigenStepper<>;
+  using KfPropagator = Propagator<Stepper, Navigator>;
+  using MultiStepper = MultiEigenStepperLoop<>;
+  using GsfPropagator = Propagator<MultiStepper, Navigator>;
+
+  KfPropagator propagator(Stepper(bField), Navigator({tGeometry}));
+
+  // Pixel measurements on all sensitive surfaces
+  MeasurementResolutionMap resolutions = {
+      {GeometryIdentifier(), {MeasurementType::eLoc01, {25_um, 50_um}}}};
+
+  BoundVector stddev;
+  stddev[eBoundLoc0] = 50_um;
+  stddev[eBoundLoc1] = 50_um;
+  stddev[eBoundPhi] = 1_degree;
+  stddev[eBoundTheta] = 1_degree;
+  stddev[eBoundQOverP] = 0.05 / (ptInGeV * 1_GeV);
+  stddev[eBoundTime] = 1_ns;
+  const BoundSquareMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+
+  // Draw the tracks with a fixed seed, so that different configurations see
+  // the same sample
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<double> uniform(-1, 1);
+  std::normal_distribution<double> normal(0, 1);
+  std::vector<FitInput> pions;
+  std::vector<FitInput> electrons;
+  std::size_t nMeasurements = 0;
+  for (unsigned int i = 0; i < nTracks; ++i) {
+    const double phi = M_PI * uniform(rng);
+    const double theta = 2 * std::atan(std::exp(-etaMax * uniform(rng)));
+    const double charge = uniform(rng) < 0 ? -1 : 1;
+    BoundVector truth = BoundVector::Zero();
+    truth[eBoundPhi] = phi;
+    truth[eBoundTheta] = theta;
+    truth[eBoundQOverP] = charge * std::sin(theta) / (ptInGeV * 1_GeV);
+
+    BoundTrackParameters truthPars(perigee, truth, cov,
+                                   ParticleHypothesis::pion());
+    auto measurements = createMeasurements(propagator, tgContext, mfContext,
+                                           truthPars, resolutions, rng);
+    nMeasurements += measurements.sourceLinks.size();
+
+    BoundVector smeared = truth;
+    for (std::size_t j = 0; j < eBoundSize; ++j) {
+      smeared[j] += stddev[j] * normal(rng);
+    }
+
+    FitInput input{{}, BoundTrackParameters(perigee, smeared, cov,
+                                            ParticleHypothesis::pion())};
+    for (const auto& sl : measurements.sourceLinks) {
+      input.sourceLinks.emplace_back(sl);
+    }
+    pions.push_back(input);
+    input.start = BoundTrackParameters(perigee, smeared, cov,
+                                       ParticleHypothesis::electron());
+    electrons.push_back(std::move(input));
+  }
+
+  ACTS_INFO("fitting " << nTracks << " tracks " << runs << " times with pT = "
+                       << ptInGeV << "GeV and |eta| < " << etaMax
+                       << " through the cylindrical detector");
+  ACTS_INFO("average number of measurements = " << 1. * nMeasurements /
+                                                       nTracks);
+
+  TestSourceLink::SurfaceAccessor surfaceAccessor{*tGeometry};
+  GainMatrixUpdater updater;
+  GainMatrixSmoother smoother;
+
+  if (runKf) {
+    KalmanFitterExtensions<Trajectory> extensions;
+    extensions.calibrator.connect<&testSourceLinkCalibrator<Trajectory>>();
+    extensions.updater.connect<&GainMatrixUpdater::operator()<Trajectory>>(
+        &updater);
+    extensions.smoother.connect<&GainMatrixSmoother::operator()<Trajectory>>(
+        &smoother);
+    extensions.surfaceAccessor
+        .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+            &surfaceAccessor);
+    KalmanFitterOptions<Trajectory> options(tgContext, mfContext, calContext,
+                                            extensions,
+                                            PropagatorPlainOptions(),
+                                            perigee.get());
+
+    KalmanFitter<KfPropagator, Trajectory> fitter(propagator);
+    runFits(
+        "KF", pions, runs,
+        {FitterPhase::eCalibration, FitterPhase::eUpdate,
+         FitterPhase::eSmoothing},
+        [&](const FitInput& input, Tracks& tracks) {
+          return fitter
+              .fit(input.sourceLinks.begin(), input.sourceLinks.end(),
+                   input.start, options, tracks)
+              .ok();
+        },
+        logger());
+  }
+
+  if (runGsf) {
+    GsfExtensions<Trajectory> extensions;
+    extensions.calibrator.connect<&testSourceLinkCalibrator<Trajectory>>();
+    extensions.updater.connect<&GainMatrixUpdater::operator()<Trajectory>>(
+        &updater);
+    extensions.surfaceAccessor
+        .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+            &surfaceAccessor);
+    extensions.mixtureReducer.connect<&reduceMixtureWithKLDistance>();
+    GsfOptions<Trajectory> options{tgContext, mfContext, calContext,
+                                   extensions, PropagatorPlainOptions()};
+    options.referenceSurface = perigee.get();
+
+    GaussianSumFitter<GsfPropagator, AtlasBetheHeitlerApprox<6, 5>, Trajectory>
+        fitter(GsfPropagator(MultiStepper(bField), Navigator({tGeometry})),
+               makeDefaultBetheHeitlerApprox());
+    runFits(
+        "GSF", electrons, runs,
+        {FitterPhase::eCalibration, FitterPhase::eUpdate,
+         FitterPhase::eSmoothing, FitterPhase::eMixtureReduction},
+        [&](const FitInput& input, Tracks& tracks) {
+          return fitter
+              .fit(input.sourceLinks.begin(), input.sourceLinks.end(),
+                   input.start, options, tracks)
+              .ok();
+        },
+        logger());
+  }
+
+  if (runGx2f) {
+    Experimental::Gx2FitterExtensions<Trajectory> extensions;
+    extensions.calibrator.connect<&testSourceLinkCalibrator<Trajectory>>();
+    extensions.surfaceAccessor
+        .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+            &surfaceAccessor);
+    Experimental::Gx2FitterOptions<Trajectory> options(
+        tgContext, mfContext, calContext, extensions, PropagatorPlainOptions(),
+        perigee.get());
+
+    // the GX2F reports every surface without a measurement at INFO level
+    Experimental::Gx2Fitter<KfPropagator, Trajectory> fitter(
+        propagator, getDefaultLogger("Gx2Fitter", Logging::WARNING));
+    runFits(
+        "GX2F", pions, runs, {FitterPhase::eCalibration},
+        [&](const FitInput& input, Tracks& tracks) {
+          return fitter
+              .fit(input.sourceLinks.begin(), input.sourceLinks.end(),
+                   input.start, options, tracks)
+              .ok();
+        },
+        logger());
+  }
+
+  return 0;
+}
@@ -0,0 +1,187 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Holders.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+namespace {
+
+using Tracks = TrackContainer<VectorTrackContainer, VectorMultiTrajectory,
+                              detail::ValueHolder>;
+
+struct MeasurementLink {
+  std::size_t index = 0;
+};
+
+std::size_t sourceLinkHash(const SourceLink& a) {
+  return a.get<MeasurementLink>().index;
+}
+
+bool sourceLinkEquality(const SourceLink& a, const SourceLink& b) {
+  return a.get<MeasurementLink>().index == b.get<MeasurementLink>().index;
+}
+
+/// Emulate the CKF output of an event with pile-up. Each particle leaves
+/// `nHits` measurements and is found by a few candidates, which are
+/// duplicates picking up measurements of neighbouring particles. A fraction
+/// of fakes is combined from random measurements.
+Tracks makeEvent(std::size_t nParticles, std::size_t nHits,
+                 double fakeFraction, std::mt19937& rng) {
+  Tracks tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+
+  std::uniform_real_distribution<float> chi2(0.5, 3.);
+  std::uniform_int_distribution<std::size_t> nCandidates(1, 4);
+  std::uniform_int_distribution<std::size_t> nReplaced(0, nHits / 3);
+  std::uniform_int_distribution<std::size_t> position(0, nHits - 1);
+  std::uniform_int_distribution<std::size_t> neighbour(0, 20);
+  std::uniform_int_distribution<std::size_t> hit(0, nParticles * nHits - 1);
+
+  auto addTrack = [&](std::vector<std::size_t> measurements) {
+    std::sort(measurements.begin(), measurements.end());
+    measurements.erase(std::unique(measurements.begin(), measurements.end()),
+                       measurements.end());
+    auto track = tracks.makeTrack();
+    for (auto index : measurements) {
+      auto ts = track.appendTrackState(TrackStatePropMask::None);
+      ts.typeFlags().set(TrackStateFlag::MeasurementFlag);
+      ts.setUncalibratedSourceLink(SourceLink{MeasurementLink{index}});
+    }
+    track.nMeasurements() = measurements.size();
+    track.nDoF() = 2 * measurements.size();
+    track.chi2() = chi2(rng) * track.nDoF();
+  };
+
+  std::vector<std::size_t> measurements(nHits);
+  for (std::size_t iParticle = 0; iParticle < nParticles; ++iParticle) {
+    for (std::size_t n = nCandidates(rng); n > 0; --n) {
+      for (std::size_t i = 0; i < nHits; ++i) {
+        measurements[i] = iParticle * nHits + i;
+      }
+      for (std::size_t i = nReplaced(rng); i > 0; --i) {
+        std::size_t other = (iParticle + neighbour(rng)) % nParticles;
+        std::size_t layer = position(rng);
+        measurements[layer] = other * nHits + layer;
+      }
+      addTrack(measurements);
+    }
+  }
+
+  const auto nFakes = static_cast<std::size_t>(fakeFraction * tracks.size());
+  for (std::size_t iFake = 0; iFake < nFakes; ++iFake) {
+    for (auto& index : measurements) {
+      index = hit(rng);
+    }
+    addTrack(measurements);
+  }
+
+  return tracks;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Acts::Logging::INFO;
+  std::size_t nParticles = 0;
+  std::size_t nHits = 0;
+  double fakeFraction = 0;
+  std::size_t runs = 0;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "produce help message")
+        ("particles",po::value<std::size_t>(&nParticles)->default_value(10000),"number of reconstructable particles in the event")
+        ("hits",po::value<std::size_t>(&nHits)->default_value(12),"number of measurements per particle")
+        ("fakes",po::value<double>(&fakeFraction)->default_value(0.1),"fraction of fake candidates")
+        ("runs",po::value<std::size_t>(&runs)->default_value(10),"number of benchmark runs")
+        ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("GreedyAmbiguityResolution", Acts::Logging::Level(lvl)));
+
+  std::mt19937 rng(2024);
+  const auto tracks = makeEvent(nParticles, nHits, fakeFraction, rng);
+
+  GreedyAmbiguityResolution::Config cfg;
+  cfg.maximumSharedHits = 1;
+  cfg.maximumIterations = tracks.size();
+  cfg.nMeasurementsMin = nHits / 2;
+  GreedyAmbiguityResolution greedy(
+      cfg, getDefaultLogger("Greedy", Acts::Logging::Level(lvl)));
+
+  GreedyAmbiguityResolution::State initialState;
+  greedy.computeInitialState(tracks, initialState, &sourceLinkHash,
+                             &sourceLinkEquality);
+  GreedyAmbiguityResolution::State resolvedState = initialState;
+  greedy.resolve(resolvedState);
+  ACTS_INFO("Resolved " << initialState.numberOfTracks << " candidates to "
+                        << resolvedState.selectedTracks.size()
+                        << " tracks for " << nParticles << " particles");
+
+  const auto initialStateBenchmark = Acts::Test::microBenchmark(
+      [&] {
+        GreedyAmbiguityResolution::State state;
+        greedy.computeInitialState(tracks, state, &sourceLinkHash,
+                                   &sourceLinkEquality);
+        return state.numberOfTracks;
+      },
+      1, runs, std::chrono::milliseconds(0));
+  ACTS_INFO("Execution stats initial state: " << initialStateBenchmark);
+
+  const auto copyBenchmark = Acts::Test::microBenchmark(
+      [&] {
+        GreedyAmbiguityResolution::State state = initialState;
+        return state.selectedTracks.size();
+      },
+      1, runs, std::chrono::milliseconds(0));
+  ACTS_INFO("Execution stats state copy: " << copyBenchmark);
+
+  const auto resolveBenchmark = Acts::Test::microBenchmark(
+      [&] {
+        GreedyAmbiguityResolution::State state = initialState;
+        greedy.resolve(state);
+        return state.selectedTracks.size();
+      },
+      1, runs, std::chrono::milliseconds(0));
+  ACTS_INFO("Execution stats state copy and resolve: " << resolveBenchmark);
+
+  return 0;
+}
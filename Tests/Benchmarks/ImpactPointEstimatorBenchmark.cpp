@@ -0,0 +1,180 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/VoidNavigator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// Emulate the tracks of an event with pile-up, which are expressed wrt
+/// the beam line and originate from vertices spread along it
+std::vector<BoundTrackParameters> makeTracks(std::size_t nTracks,
+                                             std::mt19937& rng) {
+  std::uniform_real_distribution<double> d0(-0.1_mm, 0.1_mm);
+  std::uniform_real_distribution<double> z0(-50_mm, 50_mm);
+  std::uniform_real_distribution<double> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<double> theta(0.2, M_PI - 0.2);
+  std::uniform_real_distribution<double> pT(0.4_GeV, 10_GeV);
+  std::uniform_int_distribution<int> charge(0, 1);
+
+  auto beamLine = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+
+  BoundVector stddev;
+  stddev << 15_um, 100_um, 1_degree, 1_degree, 1_e / 10_GeV, 30_ps;
+  BoundSquareMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+
+  std::vector<BoundTrackParameters> tracks;
+  tracks.reserve(nTracks);
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    BoundVector par;
+    par << d0(rng), z0(rng), phi(rng), theta(rng), 0., 0.;
+    double q = charge(rng) != 0 ? 1_e : -1_e;
+    par[eBoundQOverP] = q * std::sin(par[eBoundTheta]) / pT(rng);
+    tracks.emplace_back(beamLine, par, cov, ParticleHypothesis::pion());
+  }
+  return tracks;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Acts::Logging::INFO;
+  std::size_t nTracks = 0;
+  std::size_t runs = 0;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "produce help message")
+        ("tracks",po::value<std::size_t>(&nTracks)->default_value(1000),"number of tracks compared to the vertex")
+        ("runs",po::value<std::size_t>(&runs)->default_value(20),"number of benchmark runs")
+        ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("ImpactPointEstimator", Acts::Logging::Level(lvl)));
+
+  GeometryContext geoContext;
+  MagneticFieldContext magFieldContext;
+
+  auto field = std::make_shared<ConstantBField>(Vector3(0., 0., 2_T));
+  EigenStepper<> stepper(field);
+  auto propagator = std::make_shared<Propagator<EigenStepper<>>>(
+      std::move(stepper), VoidNavigator(),
+      getDefaultLogger("Propagator", Acts::Logging::WARNING));
+  ImpactPointEstimator::Config cfg(field, propagator);
+  ImpactPointEstimator ipEstimator(
+      cfg, getDefaultLogger("IPEstimator", Acts::Logging::Level(lvl)));
+  ImpactPointEstimator::State state{field->makeCache(magFieldContext)};
+
+  std::mt19937 rng(2024);
+  const auto tracks = makeTracks(nTracks, rng);
+  const Vector4 vtxPos(10_um, -10_um, 5_mm, 0_ns);
+
+  std::vector<BoundTrackParameters> ipParams;
+  if (!ipEstimator
+           .estimate3DImpactParameters(geoContext, magFieldContext, tracks,
+                                       vtxPos.head<3>(), state, ipParams)
+           .ok()) {
+    ACTS_ERROR("Could not estimate the impact parameters");
+    return 1;
+  }
+
+  const auto singleImpactParametersBenchmark = Acts::Test::microBenchmark(
+      [&] {
+        std::size_t nValid = 0;
+        for (const auto& track : tracks) {
+          nValid += ipEstimator
+                        .estimate3DImpactParameters(geoContext,
+                                                    magFieldContext, track,
+                                                    vtxPos.head<3>(), state)
+                        .ok();
+        }
+        return nValid;
+      },
+      1, runs, std::chrono::milliseconds(0));
+  ACTS_INFO("Execution stats single track impact parameters: "
+            << singleImpactParametersBenchmark);
+
+  const auto batchImpactParametersBenchmark = Acts::Test::microBenchmark(
+      [&] {
+        std::vector<BoundTrackParameters> result;
+        return ipEstimator
+            .estimate3DImpactParameters(geoContext, magFieldContext, tracks,
+                                        vtxPos.head<3>(), state, result)
+            .ok();
+      },
+      1, runs, std::chrono::milliseconds(0));
+  ACTS_INFO("Execution stats batch impact parameters: "
+            << batchImpactParametersBenchmark);
+
+  const auto singleCompatibilityBenchmark = Acts::Test::microBenchmark(
+      [&] {
+        double sum = 0.;
+        for (const auto& params : ipParams) {
+          sum += ipEstimator.getVertexCompatibility(geoContext, &params, vtxPos)
+                     .value();
+        }
+        return sum;
+      },
+      1, runs, std::chrono::milliseconds(0));
+  ACTS_INFO("Execution stats single track compatibility: "
+            << singleCompatibilityBenchmark);
+
+  const auto batchCompatibilityBenchmark = Acts::Test::microBenchmark(
+      [&] {
+        std::vector<double> compatibilities;
+        return ipEstimator
+            .getVertexCompatibilities(geoContext, ipParams, vtxPos,
+                                      compatibilities)
+            .ok();
+      },
+      1, runs, std::chrono::milliseconds(0));
+  ACTS_INFO("Execution stats batch compatibility: "
+            << batchCompatibilityBenchmark);
+
+  return 0;
+}
@@ -0,0 +1,187 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MaterialInteractor.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "AllocationCounter.hpp"
+
+namespace po = boost::program_options;
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  unsigned int toys = 0;
+  unsigned int nTracks = 0;
+  double ptInGeV = 0;
+  double etaMax = 0;
+  bool withCov = false;
+  bool withMaterial = false;
+  unsigned int lvl = 0;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("toys",po::value<unsigned int>(&toys)->default_value(1000),"number of tracks to propagate")
+      ("tracks",po::value<unsigned int>(&nTracks)->default_value(100),"number of distinct track parameters, cycled through by the toys")
+      ("pT",po::value<double>(&ptInGeV)->default_value(1),"transverse momentum in GeV")
+      ("eta-max",po::value<double>(&etaMax)->default_value(1),"maximum absolute pseudorapidity")
+      ("cov",po::value<bool>(&withCov)->default_value(true),"propagation with covariance matrix")
+      ("material",po::value<bool>(&withMaterial)->default_value(true),"apply the material interactions")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Propagation", Logging::Level(lvl)));
+
+  GeometryContext tgContext;
+  MagneticFieldContext mfContext;
+
+  // The cylindrical test detector with silicon modules
+  Test::CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  // A solenoid field map covering the detector
+  SolenoidBField solenoid({1.2_m, 5.8_m, 1154, 2_T});
+  auto bField = std::make_shared<const InterpolatedBFieldMap<
+      Grid<Vector2, detail::EquidistantAxis, detail::EquidistantAxis>>>(
+      solenoidFieldMap({0, 0.5_m}, {-1.5_m, 1.5_m}, {50, 300}, solenoid));
+
+  using Stepper = EigenStepper<>;
+  using NavigatedPropagator = Propagator<Stepper, Navigator>;
+  using SteppingPropagator = Propagator<Stepper>;
+
+  NavigatedPropagator navigatedPropagator(
+      Stepper(bField), Navigator({tGeometry}),
+      getDefaultLogger("Propagator", Logging::Level(lvl)));
+  SteppingPropagator steppingPropagator{Stepper(bField)};
+
+  using ActionList = Acts::ActionList<MaterialInteractor>;
+  using AbortList = Acts::AbortList<EndOfWorldReached>;
+  PropagatorOptions<ActionList, AbortList> options(tgContext, mfContext);
+  auto& interactor = options.actionList.get<MaterialInteractor>();
+  interactor.multipleScattering = withMaterial;
+  interactor.energyLoss = withMaterial;
+
+  BoundSquareMatrix cov = BoundSquareMatrix::Identity();
+  cov(eBoundLoc0, eBoundLoc0) = 10_um * 10_um;
+  cov(eBoundLoc1, eBoundLoc1) = 10_um * 10_um;
+  cov(eBoundPhi, eBoundPhi) = 1e-6;
+  cov(eBoundTheta, eBoundTheta) = 1e-6;
+  cov(eBoundQOverP, eBoundQOverP) = 1e-6 / (1_GeV * 1_GeV);
+  std::optional<BoundSquareMatrix> covOpt = std::nullopt;
+  if (withCov) {
+    covOpt = cov;
+  }
+
+  // Draw the tracks with a fixed seed, so that different configurations see
+  // the same sample
+  std::vector<CurvilinearTrackParameters> pars;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-1, 1);
+  for (unsigned int i = 0; i < nTracks; ++i) {
+    double phi = M_PI * uniform(rng);
+    double theta = 2 * std::atan(std::exp(-etaMax * uniform(rng)));
+    double charge = uniform(rng) < 0 ? -1 : 1;
+    Vector3 dir(std::cos(phi) * std::sin(theta),
+                std::sin(phi) * std::sin(theta), std::cos(theta));
+    pars.emplace_back(Vector4::Zero(), dir,
+                      charge * std::sin(theta) / (ptInGeV * 1_GeV), covOpt,
+                      ParticleHypothesis::pion());
+  }
+
+  ACTS_INFO("propagating " << toys << " tracks with pT = " << ptInGeV
+                           << "GeV and |eta| < " << etaMax
+                           << " through the cylindrical detector");
+
+  // The full propagation with navigation and material
+  std::vector<double> pathLengths(pars.size(), 0.);
+  std::size_t numSteps = 0;
+  std::size_t numIters = 0;
+  std::size_t numAllocations = 0;
+  const auto navigatedResult = Acts::Test::microBenchmark(
+      [&] {
+        std::size_t iTrack = numIters % pars.size();
+        std::size_t allocationsBefore = Acts::Test::allocationCount();
+        auto r = navigatedPropagator.propagate(pars[iTrack], options);
+        numAllocations += Acts::Test::allocationCount() - allocationsBefore;
+        if (r.ok()) {
+          pathLengths[iTrack] = r.value().pathLength;
+          numSteps += r.value().steps;
+        }
+        ++numIters;
+        return r.ok();
+      },
+      1, toys);
+
+  // The same path lengths without navigation, to estimate the share of the
+  // stepping in the total time
+  PropagatorOptions<> steppingOptions(tgContext, mfContext);
+  std::size_t numSteppingIters = 0;
+  const auto steppingResult = Acts::Test::microBenchmark(
+      [&] {
+        std::size_t iTrack = numSteppingIters % pars.size();
+        steppingOptions.pathLimit = pathLengths[iTrack];
+        auto r = steppingPropagator.propagate(pars[iTrack], steppingOptions);
+        ++numSteppingIters;
+        return r.ok();
+      },
+      1, toys);
+
+  const double trackTime = navigatedResult.iterTimeAverage().count();
+  const double steppingTime = steppingResult.iterTimeAverage().count();
+
+  ACTS_INFO("Execution stats: " << navigatedResult);
+  ACTS_INFO("tracks per second = " << 1e9 / trackTime);
+  ACTS_INFO("average number of steps = " << 1.0 * numSteps / numIters);
+  ACTS_INFO("average number of allocations = " << 1.0 * numAllocations /
+                                                      numIters);
+  ACTS_INFO("Stepping only stats: " << steppingResult);
+  ACTS_INFO("approximate navigation and material share = "
+            << 1 - steppingTime / trackTime);
+
+  return 0;
+}
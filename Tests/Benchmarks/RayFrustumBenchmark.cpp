@@ -15,11 +15,16 @@
 #include "Acts/Utilities/Ray.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <chrono>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
 using namespace Acts;
@@ -415,5 +420,76 @@ int main(int /*argc*/, char** /*argv[]*/) {
 
     std::cout << std::endl;
   }
+
+  std::cout << "\n==== HIERARCHY ====\n" << std::endl;
+
+  // boxes on barrel like layers, the octree is split around the center and
+  // the bounding volume hierarchy follows the distribution
+  O object;
+  std::vector<std::unique_ptr<Box>> boxes;
+  std::vector<Box*> prims;
+  for (std::size_t l = 0; l < 10; l++) {
+    for (std::size_t i = 0; i < 2000; i++) {
+      float phi = 2 * M_PI * i / 2000.;
+      float r = 3 + l;
+      Vector3F ctr{r * std::cos(phi), r * std::sin(phi), loc(rng)};
+      boxes.push_back(std::make_unique<Box>(
+          &object, ctr, Box::Size{Vector3F{0.05, 0.05, 0.2}}));
+      prims.push_back(boxes.back().get());
+    }
+  }
+
+  using Builder = std::function<Box*(std::vector<std::unique_ptr<Box>>&)>;
+  std::vector<std::pair<std::string, Builder>> builders = {
+      {"Octree, depth 8",
+       [&](auto& store) { return make_octree(store, prims, 8); }},
+      {"BVH", [&](auto& store) { return make_bvh(store, prims, 4); }},
+      {"BVH, 4 threads",
+       [&](auto& store) {
+         setMaxThreads(4);
+         Box* top = make_bvh(store, prims, 4);
+         setMaxThreads(1);
+         return top;
+       }},
+  };
+
+  auto count = [](const Box* node, const auto& volume) {
+    std::size_t selected = 0;
+    while (node != nullptr) {
+      if (!node->intersect(volume)) {
+        node = node->getSkip();
+      } else if (node->hasEntity()) {
+        selected++;
+        node = node->getSkip();
+      } else {
+        node = node->getLeftChild();
+      }
+    }
+    return selected;
+  };
+
+  std::cout << "Run benchmarks with " << prims.size() << " boxes: "
+            << std::endl;
+  for (const auto& [name, build] : builders) {
+    std::cout << "- Benchmarking hierarchy: '" << name << "'" << std::endl;
+    auto build_result = Acts::Test::microBenchmark(
+        [&, &build = build]() {
+          std::vector<std::unique_ptr<Box>> store;
+          return build(store);
+        },
+        1, 20);
+    std::cout << "  build: " << build_result << std::endl;
+
+    std::vector<std::unique_ptr<Box>> store;
+    const Box* top = build(store);
+    std::cout << "  nodes: " << store.size() << std::endl;
+    auto ray_result = Acts::Test::microBenchmark(
+        [&](const auto& ray) { return count(top, ray); }, rays, 100);
+    std::cout << "  rays: " << ray_result << std::endl;
+    auto frustum_result = Acts::Test::microBenchmark(
+        [&](const auto& fr) { return count(top, fr); }, frustums, 100);
+    std::cout << "  frustums: " << frustum_result << std::endl;
+  }
+
   return 0;
 }
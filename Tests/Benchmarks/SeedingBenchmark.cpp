@@ -0,0 +1,490 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Seeding/BinnedGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Seeding/SeedFinder.hpp"
+#include "Acts/Seeding/SeedFinderConfig.hpp"
+#include "Acts/Seeding/SeedFinderOrthogonal.hpp"
+#include "Acts/Seeding/SeedFinderOrthogonalConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/GridBinFinder.hpp"
+#include "Acts/Utilities/RangeXD.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "AllocationCounter.hpp"
+
+#ifdef ACTS_BENCHMARK_LEGACY_SEEDING
+#include "Acts/Seeding/AtlasSeedFinder.hpp"
+#endif
+
+namespace po = boost::program_options;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+struct SpacePoint {
+  float m_x{};
+  float m_y{};
+  float m_z{};
+  float m_r{};
+  float varianceR{};
+  float varianceZ{};
+  float x() const { return m_x; }
+  float y() const { return m_y; }
+  float z() const { return m_z; }
+  float r() const { return m_r; }
+  std::optional<float> t() const { return std::nullopt; }
+};
+
+#ifdef ACTS_BENCHMARK_LEGACY_SEEDING
+// The legacy seed finder accesses the space point members directly
+struct LegacySpacePoint {
+  float x = 0;
+  float y = 0;
+  float z = 0;
+  float r = 0;
+  float covr = 0.03;
+  float covz = 0.03;
+  int surface = 0;
+  std::pair<int, int> clusterList() const { return {1, 0}; }
+};
+#endif
+
+/// The space points of one event to run the seed finders on
+struct Sample {
+  std::string name;
+  std::vector<SpacePoint> spacePoints;
+};
+
+/// The outcome of benchmarking one seed finder on one sample
+struct Measurement {
+  std::size_t nSeeds = 0;
+  std::size_t nAllocations = 0;
+  Acts::Test::MicroBenchmarkResult result;
+};
+
+// Radii of the barrel pixel layers of the generated events, within the
+// seeding region of the legacy seed finder
+const std::vector<float> layerRadii = {33_mm, 50_mm, 88_mm, 122_mm, 150_mm};
+
+// Space points of helices from the beam line, one per crossed layer
+std::vector<SpacePoint> generateSpacePoints(unsigned int nTracks,
+                                            unsigned int seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<float> etaDist(-2., 2.);
+  std::uniform_real_distribution<float> invPtDist(1 / 10_GeV, 1 / 0.5_GeV);
+  std::normal_distribution<float> z0Dist(0., 50_mm);
+  std::bernoulli_distribution chargeDist(0.5);
+
+  const float bFieldInZ = 2_T;
+  const float variance = 0.01_mm * 0.01_mm;
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(nTracks * layerRadii.size());
+  for (unsigned int it = 0; it < nTracks; ++it) {
+    const float phi0 = phiDist(rng);
+    const float cotTheta = std::sinh(etaDist(rng));
+    const float z0 = z0Dist(rng);
+    const float charge = chargeDist(rng) ? 1. : -1.;
+    // radius of curvature in the transverse plane
+    const float radius = 1 / (invPtDist(rng) * bFieldInZ);
+
+    for (float r : layerRadii) {
+      if (r >= 2 * radius) {
+        break;
+      }
+      const float halfAngle = std::asin(r / (2 * radius));
+      const float phi = phi0 + charge * halfAngle;
+      const float z = z0 + 2 * radius * halfAngle * cotTheta;
+      if (std::abs(z) > 500_mm) {
+        break;
+      }
+      spacePoints.push_back({r * std::cos(phi), r * std::sin(phi), z, r,
+                             variance, variance});
+    }
+  }
+  return spacePoints;
+}
+
+// Space points in the format written by the CSV space point writer of the
+// examples, only the position and variance columns are used
+std::vector<SpacePoint> readSpacePoints(const std::string& path) {
+  std::ifstream file(path);
+  if (!file) {
+    throw std::runtime_error("Could not open " + path);
+  }
+
+  std::string line;
+  std::getline(file, line);
+  std::map<std::string, std::size_t> columns;
+  {
+    std::stringstream header(line);
+    std::string name;
+    while (std::getline(header, name, ',')) {
+      columns.emplace(name, columns.size());
+    }
+  }
+  std::vector<std::size_t> indices;
+  for (const char* name :
+       {"sp_x", "sp_y", "sp_z", "sp_radius", "sp_covr", "sp_covz"}) {
+    auto it = columns.find(name);
+    if (it == columns.end()) {
+      throw std::runtime_error("Missing column " + std::string(name) +
+                               " in " + path);
+    }
+    indices.push_back(it->second);
+  }
+
+  std::vector<SpacePoint> spacePoints;
+  std::vector<float> values(columns.size());
+  while (std::getline(file, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    std::stringstream row(line);
+    std::string value;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      std::getline(row, value, ',');
+      values[i] = std::strtof(value.c_str(), nullptr);
+    }
+    spacePoints.push_back({values[indices[0]], values[indices[1]],
+                           values[indices[2]], values[indices[3]],
+                           values[indices[4]], values[indices[5]]});
+  }
+  return spacePoints;
+}
+
+// Run the benchmark, and count the allocations of one extra iteration
+Measurement measure(const std::function<std::size_t()>& iteration,
+                    unsigned int runs) {
+  Measurement measurement;
+  measurement.result = Acts::Test::microBenchmark(iteration, 1, runs);
+  const std::size_t allocationsBefore = Acts::Test::allocationCount();
+  measurement.nSeeds = iteration();
+  measurement.nAllocations = Acts::Test::allocationCount() - allocationsBefore;
+  return measurement;
+}
+
+// Configuration shared by both seed finders
+template <typename config_t>
+config_t finderConfig(float rMax) {
+  config_t config;
+  config.rMax = rMax;
+  config.deltaRMinTopSP = 5_mm;
+  config.deltaRMinBottomSP = 5_mm;
+  config.deltaRMaxTopSP = 160_mm;
+  config.deltaRMaxBottomSP = 160_mm;
+  config.collisionRegionMin = -250_mm;
+  config.collisionRegionMax = 250_mm;
+  config.zMin = -2800_mm;
+  config.zMax = 2800_mm;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.;
+  config.minPt = 500_MeV;
+  config.impactMax = 10_mm;
+  config.useVariableMiddleSPRange = false;
+  return config;
+}
+
+Acts::SeedFilterConfig filterConfig() {
+  Acts::SeedFilterConfig config;
+  config.maxSeedsPerSpM = 5;
+  return config.toInternalUnits();
+}
+
+Acts::SeedFinderOptions finderOptions() {
+  Acts::SeedFinderOptions options;
+  options.beamPos = {0_mm, 0_mm};
+  options.bFieldInZ = 2_T;
+  return options;
+}
+
+// Default seed finder on the cylindrical space point grid, with the groups
+// of the grid distributed over the given number of threads
+Measurement runDefault(const std::vector<const SpacePoint*>& spacePointPtrs,
+                       float rMax, unsigned int nThreads, unsigned int runs) {
+  using Grid = Acts::CylindricalSpacePointGrid<SpacePoint>;
+  using Finder = Acts::SeedFinder<SpacePoint, Grid>;
+
+  auto config = finderConfig<Acts::SeedFinderConfig<SpacePoint>>(rMax);
+  config.deltaRMin = 5_mm;
+  config.deltaRMax = 160_mm;
+
+  // the grid is configured in the same units as the seed finder
+  Acts::CylindricalSpacePointGridConfig gridConfig;
+  gridConfig.minPt = config.minPt;
+  gridConfig.rMax = config.rMax;
+  gridConfig.zMax = config.zMax;
+  gridConfig.zMin = config.zMin;
+  gridConfig.deltaRMax = config.deltaRMax;
+  gridConfig.cotThetaMax = config.cotThetaMax;
+  gridConfig = gridConfig.toInternalUnits();
+  Acts::CylindricalSpacePointGridOptions gridOptions;
+  gridOptions.bFieldInZ = finderOptions().bFieldInZ;
+  gridOptions = gridOptions.toInternalUnits();
+
+  config.seedFilter =
+      std::make_unique<Acts::SeedFilter<SpacePoint>>(filterConfig());
+  config = config.toInternalUnits().calculateDerivedQuantities();
+  const Acts::SeedFinderOptions options =
+      finderOptions().toInternalUnits().calculateDerivedQuantities(config);
+
+  const std::vector<std::pair<int, int>> zBinNeighbors;
+  const Acts::GridBinFinder<2ul> bottomBinFinder(1, zBinNeighbors);
+  const Acts::GridBinFinder<2ul> topBinFinder(1, zBinNeighbors);
+  const Finder finder(config);
+
+  auto extractGlobalQuantities = [](const SpacePoint& sp, float, float,
+                                    float) {
+    Acts::Vector3 position(sp.x(), sp.y(), sp.z());
+    Acts::Vector2 covariance(sp.varianceR, sp.varianceZ);
+    return std::make_tuple(position, covariance, sp.t());
+  };
+
+  std::vector<Finder::SeedingState> states(nThreads);
+  return measure(
+      [&] {
+        Acts::Extent rRangeSPExtent;
+        Grid grid = Acts::CylindricalSpacePointGridCreator::createGrid<
+            SpacePoint>(gridConfig, gridOptions);
+        Acts::CylindricalSpacePointGridCreator::fillGrid(
+            config, options, grid, spacePointPtrs.begin(),
+            spacePointPtrs.end(), extractGlobalQuantities, rRangeSPExtent);
+        Acts::CylindricalBinnedGroup<SpacePoint> spGroup(
+            std::move(grid), bottomBinFinder, topBinFinder);
+        const Acts::Range1D<float> rMiddleSPRange;
+
+        // materialize the groups so they can be distributed over the threads
+        using Group = decltype(*spGroup.begin());
+        std::vector<Group> groups;
+        for (auto [bottom, middle, top] : spGroup) {
+          groups.emplace_back(std::move(bottom), middle, std::move(top));
+        }
+
+        std::vector<std::vector<Acts::Seed<SpacePoint>>> seeds(nThreads);
+        auto work = [&](unsigned int iThread) {
+          Finder::SeedingState& state = states[iThread];
+          state.spacePointData.resize(spacePointPtrs.size());
+          for (std::size_t i = iThread; i < groups.size(); i += nThreads) {
+            const auto& [bottom, middle, top] = groups[i];
+            finder.createSeedsForGroup(options, state, spGroup.grid(),
+                                       std::back_inserter(seeds[iThread]),
+                                       bottom, middle, top, rMiddleSPRange);
+          }
+        };
+        std::vector<std::thread> threads;
+        for (unsigned int iThread = 1; iThread < nThreads; ++iThread) {
+          threads.emplace_back(work, iThread);
+        }
+        work(0);
+        for (auto& thread : threads) {
+          thread.join();
+        }
+
+        std::size_t nSeeds = 0;
+        for (const auto& threadSeeds : seeds) {
+          nSeeds += threadSeeds.size();
+        }
+        return nSeeds;
+      },
+      runs);
+}
+
+// Orthogonal seed finder on a k-d tree
+Measurement runOrthogonal(
+    const std::vector<const SpacePoint*>& spacePointPtrs, float rMax,
+    unsigned int runs) {
+  auto config =
+      finderConfig<Acts::SeedFinderOrthogonalConfig<SpacePoint>>(rMax);
+  config.seedFilter =
+      std::make_unique<Acts::SeedFilter<SpacePoint>>(filterConfig());
+  config = config.toInternalUnits().calculateDerivedQuantities();
+  const Acts::SeedFinderOptions options =
+      finderOptions().toInternalUnits().calculateDerivedQuantities(config);
+
+  const Acts::SeedFinderOrthogonal<SpacePoint> finder(config);
+
+  auto extractGlobalQuantities = [](const SpacePoint* sp) {
+    Acts::Vector3 position(sp->x(), sp->y(), sp->z());
+    Acts::Vector2 covariance(sp->varianceR, sp->varianceZ);
+    return std::make_tuple(position, covariance, sp->t());
+  };
+
+  return measure(
+      [&] {
+        return finder
+            .createSeeds(options, spacePointPtrs, extractGlobalQuantities)
+            .size();
+      },
+      runs);
+}
+
+#ifdef ACTS_BENCHMARK_LEGACY_SEEDING
+// Legacy ATLAS seed finder with its built-in configuration
+Measurement runLegacy(const std::vector<SpacePoint>& spacePoints,
+                      unsigned int runs) {
+  std::vector<LegacySpacePoint> legacySpacePoints;
+  legacySpacePoints.reserve(spacePoints.size());
+  for (const auto& sp : spacePoints) {
+    LegacySpacePoint& legacy = legacySpacePoints.emplace_back();
+    legacy.x = sp.x();
+    legacy.y = sp.y();
+    legacy.z = sp.z();
+    legacy.r = sp.r();
+    // only used to skip pairs on the same surface, approximated by the layer
+    legacy.surface = static_cast<int>(sp.r());
+  }
+  std::vector<LegacySpacePoint*> legacySpacePointPtrs;
+  legacySpacePointPtrs.reserve(legacySpacePoints.size());
+  for (auto& sp : legacySpacePoints) {
+    legacySpacePointPtrs.push_back(&sp);
+  }
+
+  Acts::Legacy::AtlasSeedFinder<LegacySpacePoint> finder;
+  return measure(
+      [&] {
+        finder.newEvent(0, legacySpacePointPtrs.begin(),
+                        legacySpacePointPtrs.end());
+        finder.find3Sp();
+        std::size_t nSeeds = 0;
+        while (finder.next() != nullptr) {
+          ++nSeeds;
+        }
+        return nSeeds;
+      },
+      runs);
+}
+#endif
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<std::string> inputs;
+  std::vector<unsigned int> nTracks;
+  std::vector<unsigned int> nThreads;
+  unsigned int runs = 10;
+  unsigned int seed = 42;
+  float rMax = 200_mm;
+  std::string output;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("input", po::value<std::vector<std::string>>(&inputs)->multitoken(), "CSV space point files, e.g. one per pile-up level. Generated events are used if none are given")
+      ("tracks", po::value<std::vector<unsigned int>>(&nTracks)->multitoken()->default_value({1000, 5000}, "1000 5000"), "number of tracks of each generated event")
+      ("threads", po::value<std::vector<unsigned int>>(&nThreads)->multitoken()->default_value({1}, "1"), "numbers of threads to run the default seed finder with")
+      ("runs", po::value<unsigned int>(&runs)->default_value(10), "number of benchmark runs")
+      ("seed", po::value<unsigned int>(&seed)->default_value(42), "random seed of the event generation")
+      ("r-max", po::value<float>(&rMax)->default_value(200_mm), "maximum radius of the seeding region in mm")
+      ("output", po::value<std::string>(&output), "CSV file to write the measurements to");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  std::vector<Sample> samples;
+  try {
+    for (const auto& input : inputs) {
+      samples.push_back({input, readSpacePoints(input)});
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+  if (inputs.empty()) {
+    for (unsigned int n : nTracks) {
+      samples.push_back(
+          {std::to_string(n) + " tracks", generateSpacePoints(n, seed)});
+    }
+  }
+
+  std::ofstream csv;
+  if (!output.empty()) {
+    csv.open(output);
+    csv << "sample,finder,threads,spacepoints,seeds,allocations,time_ms,"
+           "seeds_per_s,time_per_sp_us\n";
+  }
+
+  auto report = [&](const Sample& sample, const std::string& finder,
+                    unsigned int threads, const Measurement& m) {
+    const double seconds = m.result.runTimeMedian().count() * 1e-9;
+    const double nSpacePoints = sample.spacePoints.size();
+    std::cout << "- " << finder << " (" << threads << " thread(s), "
+              << m.nSeeds << " seeds, " << m.nAllocations
+              << " allocations): " << m.result << ", " << m.nSeeds / seconds
+              << " seeds/s, " << seconds * 1e6 / nSpacePoints
+              << "µs per space point" << std::endl;
+    if (csv.is_open()) {
+      csv << '"' << sample.name << "\"," << finder << ',' << threads << ','
+          << sample.spacePoints.size() << ',' << m.nSeeds << ','
+          << m.nAllocations << ',' << seconds * 1e3 << ','
+          << m.nSeeds / seconds << ',' << seconds * 1e6 / nSpacePoints
+          << '\n';
+    }
+  };
+
+  for (const Sample& sample : samples) {
+    std::vector<const SpacePoint*> spacePointPtrs;
+    spacePointPtrs.reserve(sample.spacePoints.size());
+    for (const auto& sp : sample.spacePoints) {
+      spacePointPtrs.push_back(&sp);
+    }
+    std::cout << "Seeding " << sample.name << ": "
+              << sample.spacePoints.size() << " space points" << std::endl;
+
+    for (unsigned int threads : nThreads) {
+      report(sample, "default", threads,
+             runDefault(spacePointPtrs, rMax, std::max(threads, 1u), runs));
+    }
+    report(sample, "orthogonal", 1, runOrthogonal(spacePointPtrs, rMax, runs));
+#ifdef ACTS_BENCHMARK_LEGACY_SEEDING
+    report(sample, "legacy", 1, runLegacy(sample.spacePoints, runs));
+#endif
+  }
+
+  return 0;
+}
@@ -19,6 +19,7 @@
 #include <iostream>
 #include <random>
 #include <string>
+#include <vector>
 
 using namespace Acts::UnitLiterals;
 
@@ -183,5 +184,20 @@ int main(int argc, char* argv[]) {
         steps);
     std::cout << map_adv_result_cache << std::endl;
     csv("interp_cache_adv", map_adv_result_cache);
+
+    // - The same positions in one batch, which reuses the last grid cell like
+    //   the cache but skips the per-position result handling. Every run
+    //   processes all positions.
+
+    std::cout << "Benchmarking batched advancing interpolated field lookup: "
+              << std::flush;
+    std::vector<Acts::Vector3> fields(steps.size());
+    const auto map_adv_result_batch = Acts::Test::microBenchmark(
+        [&] {
+          return bFieldMap.getFields(steps.data(), steps.size(), fields.data());
+        },
+        1, 100);
+    std::cout << map_adv_result_batch << std::endl;
+    csv("interp_batch_adv", map_adv_result_batch);
   }
 }
@@ -19,7 +19,10 @@
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cmath>
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -31,7 +34,10 @@ using namespace Acts::UnitLiterals;
 
 struct BenchmarkStepper {
   unsigned int toys{};
+  unsigned int nTracks{};
   double ptInGeV{};
+  double ptSpread{};
+  double etaMax{};
   double BzInT{};
   double maxPathInM{};
   unsigned int lvl{};
@@ -44,7 +50,10 @@ struct BenchmarkStepper {
       desc.add_options()
         ("help", "produce help message")
         ("toys",po::value<unsigned int>(&toys)->default_value(20000),"number of tracks to propagate")
+        ("tracks",po::value<unsigned int>(&nTracks)->default_value(1),"number of distinct track parameters, cycled through by the toys")
         ("pT",po::value<double>(&ptInGeV)->default_value(1),"transverse momentum in GeV")
+        ("pT-spread",po::value<double>(&ptSpread)->default_value(0),"relative spread of the transverse momentum if tracks > 1, in [0, 1)")
+        ("eta-max",po::value<double>(&etaMax)->default_value(0),"maximum absolute pseudorapidity if tracks > 1")
         ("B",po::value<double>(&BzInT)->default_value(2),"z-component of B-field in T")
         ("path",po::value<double>(&maxPathInM)->default_value(5),"maximum path length in m")
         ("cov",po::value<bool>(&withCov)->default_value(true),"propagation with covariance matrix")
@@ -58,6 +67,11 @@ struct BenchmarkStepper {
         std::cout << desc << std::endl;
         return 0;
       }
+      // the sampled pT has to stay positive
+      if (ptSpread < 0 || ptSpread >= 1) {
+        std::cerr << "error: the pT spread has to be in [0, 1)" << std::endl;
+        return 1;
+      }
     } catch (std::exception& e) {
       std::cerr << "error: " << e.what() << std::endl;
       return 1;
@@ -85,6 +99,10 @@ struct BenchmarkStepper {
     // print information about profiling setup
     ACTS_INFO("propagating " << toys << " tracks with pT = " << ptInGeV
                              << "GeV in a " << BzInT << "T B-field");
+    if (nTracks > 1) {
+      ACTS_INFO("cycling through " << nTracks << " tracks with a pT spread of "
+                                   << ptSpread << " and |eta| < " << etaMax);
+    }
 
     Propagator propagator(std::move(stepper));
 
@@ -107,8 +125,24 @@ struct BenchmarkStepper {
     if (withCov) {
       covOpt = cov;
     }
-    CurvilinearTrackParameters pars(pos4, dir, +1 / ptInGeV, covOpt,
-                                    ParticleHypothesis::pion());
+    // The first track always uses the nominal parameters. Further tracks are
+    // drawn with a fixed seed, so that different steppers see the same sample
+    // and the cost of a realistic mix of tracks can be compared.
+    std::vector<CurvilinearTrackParameters> pars;
+    pars.emplace_back(pos4, dir, +1 / ptInGeV, covOpt,
+                      ParticleHypothesis::pion());
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> uniform(-1, 1);
+    for (unsigned int i = 1; i < nTracks; ++i) {
+      double phi = M_PI * uniform(rng);
+      double theta = 2 * std::atan(std::exp(-etaMax * uniform(rng)));
+      double pT = ptInGeV * (1 + ptSpread * uniform(rng));
+      double charge = uniform(rng) < 0 ? -1 : 1;
+      Vector3 trackDir(std::cos(phi) * std::sin(theta),
+                       std::sin(phi) * std::sin(theta), std::cos(theta));
+      pars.emplace_back(pos4, trackDir, charge * std::sin(theta) / pT, covOpt,
+                        ParticleHypothesis::pion());
+    }
 
     double totalPathLength = 0;
     std::size_t numSteps = 0;
@@ -116,7 +150,8 @@ struct BenchmarkStepper {
     std::size_t numIters = 0;
     const auto propagationBenchResult = Acts::Test::microBenchmark(
         [&] {
-          auto state = propagator.makeState(pars, options);
+          auto state =
+              propagator.makeState(pars[numIters % pars.size()], options);
           auto tmp = propagator.propagate(state);
           auto r = propagator.makeResult(state, tmp, options, true).value();
           if (totalPathLength == 0.) {
@@ -0,0 +1,188 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/RegularSurface.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts::Test {
+
+namespace {
+
+// Number of positions converted per batch, about a module worth of hits
+const std::size_t nPositions = 1000;
+const std::size_t nRuns = 1000;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+// Some random transform
+Transform3 at = Transform3::Identity() * Translation3(0_m, 0_m, 10_m) *
+                AngleAxis3(0.15, Vector3(1.2, 1.2, 0.12).normalized());
+
+/// Compare the single position conversions in a loop with the batch ones
+void transformTest(const std::string& name, const RegularSurface& surface,
+                   const std::vector<Vector2>& lpositions) {
+  std::vector<Vector3> positions;
+  std::vector<Vector2> converted;
+  surface.localToGlobalBatch(tgContext, lpositions, positions);
+
+  std::cout << name << " " << lpositions.size() << " positions" << std::endl;
+  std::cout << "- localToGlobal: "
+            << microBenchmark(
+                   [&] {
+                     for (std::size_t i = 0; i < lpositions.size(); ++i) {
+                       positions[i] =
+                           surface.localToGlobal(tgContext, lpositions[i]);
+                     }
+                     return positions.back();
+                   },
+                   1, nRuns)
+            << std::endl;
+  std::cout << "- localToGlobalBatch: "
+            << microBenchmark(
+                   [&] {
+                     surface.localToGlobalBatch(tgContext, lpositions,
+                                                positions);
+                     return positions.back();
+                   },
+                   1, nRuns)
+            << std::endl;
+  converted.resize(positions.size());
+  std::cout << "- globalToLocal: "
+            << microBenchmark(
+                   [&] {
+                     bool ok = true;
+                     for (std::size_t i = 0; i < positions.size(); ++i) {
+                       auto lposition =
+                           surface.globalToLocal(tgContext, positions[i]);
+                       ok = ok && lposition.ok();
+                       converted[i] = *lposition;
+                     }
+                     return ok;
+                   },
+                   1, nRuns)
+            << std::endl;
+  std::cout << "- globalToLocalBatch: "
+            << microBenchmark(
+                   [&] {
+                     return surface
+                         .globalToLocalBatch(tgContext, positions, converted)
+                         .ok();
+                   },
+                   1, nRuns)
+            << std::endl;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(benchmark_surface_transforms) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+
+  std::vector<Vector2> cartesian(nPositions);
+  std::vector<Vector2> polar(nPositions);
+  std::vector<Vector2> cylindrical(nPositions);
+  std::vector<Vector3> directions(nPositions);
+  for (std::size_t i = 0; i < nPositions; ++i) {
+    cartesian[i] = Vector2(uniform(rng), uniform(rng)) * 1_m;
+    polar[i] = Vector2(0.7_m + 0.5_m * uniform(rng), M_PI * uniform(rng));
+    cylindrical[i] = Vector2(10_m * M_PI * uniform(rng), 100_m * uniform(rng));
+    directions[i] = makeDirectionFromPhiTheta(M_PI * uniform(rng),
+                                              M_PI_2 + uniform(rng));
+  }
+
+  auto aPlane = Surface::makeShared<PlaneSurface>(
+      at, std::make_shared<RectangleBounds>(1_m, 1_m));
+  auto aDisc = Surface::makeShared<DiscSurface>(
+      at, std::make_shared<RadialBounds>(0.2_m, 1.2_m));
+  auto aCylinder = Surface::makeShared<CylinderSurface>(
+      at, std::make_shared<CylinderBounds>(10_m, 100_m));
+  auto aStraw = Surface::makeShared<StrawSurface>(at, 50_cm, 2_m);
+
+  transformTest("Plane", *aPlane, cartesian);
+  transformTest("Disc", *aDisc, polar);
+  transformTest("Cylinder", *aCylinder, cylindrical);
+
+  std::vector<Vector2> drift(nPositions);
+  for (std::size_t i = 0; i < nPositions; ++i) {
+    drift[i] = Vector2(50_cm * uniform(rng), 2_m * uniform(rng));
+  }
+  std::vector<Vector3> positions;
+  std::vector<Vector2> converted(nPositions);
+  aStraw->localToGlobalBatch(tgContext, drift, directions, positions);
+
+  std::cout << "Straw " << nPositions << " positions" << std::endl;
+  std::cout << "- localToGlobal: "
+            << microBenchmark(
+                   [&] {
+                     for (std::size_t i = 0; i < nPositions; ++i) {
+                       positions[i] = aStraw->localToGlobal(
+                           tgContext, drift[i], directions[i]);
+                     }
+                     return positions.back();
+                   },
+                   1, nRuns)
+            << std::endl;
+  std::cout << "- localToGlobalBatch: "
+            << microBenchmark(
+                   [&] {
+                     aStraw->localToGlobalBatch(tgContext, drift, directions,
+                                                positions);
+                     return positions.back();
+                   },
+                   1, nRuns)
+            << std::endl;
+  std::cout << "- globalToLocal: "
+            << microBenchmark(
+                   [&] {
+                     bool ok = true;
+                     for (std::size_t i = 0; i < nPositions; ++i) {
+                       auto lposition = aStraw->globalToLocal(
+                           tgContext, positions[i], directions[i]);
+                       ok = ok && lposition.ok();
+                       converted[i] = *lposition;
+                     }
+                     return ok;
+                   },
+                   1, nRuns)
+            << std::endl;
+  std::cout << "- globalToLocalBatch: "
+            << microBenchmark(
+                   [&] {
+                     return aStraw
+                         ->globalToLocalBatch(tgContext, positions, directions,
+                                              converted)
+                         .ok();
+                   },
+                   1, nRuns)
+            << std::endl;
+}
+
+}  // namespace Acts::Test
@@ -0,0 +1,391 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/BoundTrackParametersBatch.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/VoidNavigator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/AnnealingUtility.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Vertexing/AdaptiveGridDensityVertexFinder.hpp"
+#include "Acts/Vertexing/AdaptiveGridTrackDensity.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
+#include "Acts/Vertexing/FullBilloirVertexFitter.hpp"
+#include "Acts/Vertexing/GaussianTrackDensity.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/IVertexFinder.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/IterativeVertexFinder.hpp"
+#include "Acts/Vertexing/LinearizedTrack.hpp"
+#include "Acts/Vertexing/SingleSeedVertexFinder.hpp"
+#include "Acts/Vertexing/TrackAtVertex.hpp"
+#include "Acts/Vertexing/TrackDensityVertexFinder.hpp"
+#include "Acts/Vertexing/Vertex.hpp"
+#include "Acts/Vertexing/VertexingOptions.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+using HelixPropagator = Acts::Propagator<EigenStepper<>>;
+
+struct SpacePoint {
+  double m_x = 0;
+  double m_y = 0;
+  double m_z = 0;
+  double x() const { return m_x; }
+  double y() const { return m_y; }
+  double z() const { return m_z; }
+  double r() const { return std::hypot(m_x, m_y); }
+};
+
+/// A simulated event. The tracks are expressed wrt the beam line and are
+/// stored vertex by vertex, the tracks of vertex i are in the range
+/// [vertexOffsets[i], vertexOffsets[i + 1]).
+struct Event {
+  std::vector<Vector3> vertices;
+  std::vector<std::size_t> vertexOffsets;
+  std::vector<BoundTrackParameters> tracks;
+  std::vector<InputTrack> inputTracks;
+  /// Straight line hits of the tracks in the near, middle and far layers of
+  /// the default SingleSeedVertexFinder configuration
+  std::vector<SpacePoint> spacepoints;
+};
+
+/// Emulate an event with pile-up. The vertices are spread along the beam
+/// line and the transverse impact parameter resolution degrades with
+/// decreasing pT.
+Event makeEvent(std::size_t nVertices, std::size_t nTracksPerVertex,
+                std::mt19937& rng) {
+  std::normal_distribution<double> vXY(0., 10_um);
+  std::normal_distribution<double> vZ(0., 50_mm);
+  std::uniform_int_distribution<std::size_t> nTracks(nTracksPerVertex / 2,
+                                                     3 * nTracksPerVertex / 2);
+  std::uniform_real_distribution<double> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<double> theta(1.0, M_PI - 1.0);
+  std::uniform_real_distribution<double> invPt(1 / 10_GeV, 1 / 0.4_GeV);
+  std::uniform_int_distribution<int> charge(0, 1);
+  std::normal_distribution<double> normal(0., 1.);
+
+  auto beamLine = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  const std::vector<double> layerRadii = {40_mm, 170_mm, 300_mm};
+
+  Event event;
+  event.vertexOffsets.push_back(0);
+  for (std::size_t iVertex = 0; iVertex < nVertices; ++iVertex) {
+    Vector3 vertex(vXY(rng), vXY(rng), vZ(rng));
+    event.vertices.push_back(vertex);
+
+    for (std::size_t n = nTracks(rng); n > 0; --n) {
+      double trkPhi = phi(rng);
+      double trkTheta = theta(rng);
+      double trkInvPt = invPt(rng);
+
+      BoundVector stddev;
+      stddev << 20_um + 50_um * trkInvPt * 1_GeV,
+          40_um + 80_um * trkInvPt * 1_GeV, 1_mrad, 1_mrad,
+          0.01 * trkInvPt * std::sin(trkTheta), 1_ns;
+      BoundSquareMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+
+      BoundVector par;
+      par[eBoundLoc0] = -vertex.x() * std::sin(trkPhi) +
+                        vertex.y() * std::cos(trkPhi) +
+                        stddev[eBoundLoc0] * normal(rng);
+      par[eBoundLoc1] = vertex.z() + stddev[eBoundLoc1] * normal(rng);
+      par[eBoundPhi] = trkPhi;
+      par[eBoundTheta] = trkTheta;
+      par[eBoundQOverP] =
+          (charge(rng) != 0 ? 1_e : -1_e) * std::sin(trkTheta) * trkInvPt;
+      par[eBoundTime] = 0.;
+      event.tracks.emplace_back(beamLine, par, cov,
+                                ParticleHypothesis::pion());
+
+      Vector3 dir(std::cos(trkPhi), std::sin(trkPhi),
+                  1 / std::tan(trkTheta));
+      for (double r : layerRadii) {
+        Vector3 hit = vertex + r * dir;
+        event.spacepoints.push_back({hit.x(), hit.y(), hit.z()});
+      }
+    }
+    event.vertexOffsets.push_back(event.tracks.size());
+  }
+
+  for (const auto& track : event.tracks) {
+    event.inputTracks.emplace_back(&track);
+  }
+  return event;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Acts::Logging::INFO;
+  std::vector<std::size_t> pileups;
+  std::size_t nTracksPerVertex = 0;
+  std::size_t nEvents = 0;
+  std::size_t runs = 0;
+  bool runIvf = false;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "produce help message")
+        ("pileup",po::value<std::vector<std::size_t>>(&pileups)->multitoken()->default_value({20, 50, 100}, "20 50 100"),"numbers of vertices per event to scan")
+        ("tracks",po::value<std::size_t>(&nTracksPerVertex)->default_value(10),"average number of tracks per vertex")
+        ("events",po::value<std::size_t>(&nEvents)->default_value(5),"number of events per pile-up")
+        ("runs",po::value<std::size_t>(&runs)->default_value(3),"number of benchmark runs over the events")
+        ("ivf",po::value<bool>(&runIvf)->default_value(true),"run the iterative vertex finder")
+        ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Vertexing", Acts::Logging::Level(lvl)));
+
+  GeometryContext geoContext;
+  MagneticFieldContext magFieldContext;
+
+  auto field = std::make_shared<ConstantBField>(Vector3(0., 0., 2_T));
+  auto propagator = std::make_shared<HelixPropagator>(
+      EigenStepper<>(field), VoidNavigator(),
+      getDefaultLogger("Propagator", Acts::Logging::WARNING));
+
+  ImpactPointEstimator::Config ipEstimatorCfg(field, propagator);
+  ImpactPointEstimator ipEstimator(ipEstimatorCfg);
+
+  HelicalTrackLinearizer::Config linearizerCfg;
+  linearizerCfg.bField = field;
+  linearizerCfg.propagator = propagator;
+  HelicalTrackLinearizer linearizer(linearizerCfg);
+
+  // Seed finders
+  GaussianTrackDensity::Config densityCfg;
+  densityCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  auto densitySeedFinder = std::make_shared<TrackDensityVertexFinder>(
+      TrackDensityVertexFinder::Config{densityCfg});
+
+  AdaptiveGridTrackDensity::Config gridDensityCfg;
+  gridDensityCfg.spatialBinExtent = 0.05_mm;
+  AdaptiveGridDensityVertexFinder::Config gridSeedFinderCfg(
+      AdaptiveGridTrackDensity{gridDensityCfg});
+  gridSeedFinderCfg.cacheGridStateForTrackRemoval = true;
+  gridSeedFinderCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  auto gridSeedFinder =
+      std::make_shared<AdaptiveGridDensityVertexFinder>(gridSeedFinderCfg);
+
+  // Fitters
+  FullBilloirVertexFitter::Config billoirCfg;
+  billoirCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  billoirCfg.trackLinearizer.connect<&HelicalTrackLinearizer::linearizeTrack>(
+      &linearizer);
+  FullBilloirVertexFitter billoirFitter(billoirCfg);
+
+  AnnealingUtility::Config annealingCfg;
+  annealingCfg.setOfTemperatures = {8.0, 4.0, 2.0, 1.4142136, 1.2247449, 1.0};
+  AdaptiveMultiVertexFitter::Config amvFitterCfg(ipEstimator);
+  amvFitterCfg.annealingTool = AnnealingUtility(annealingCfg);
+  amvFitterCfg.doSmoothing = true;
+  amvFitterCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  amvFitterCfg.trackLinearizer
+      .connect<&HelicalTrackLinearizer::linearizeTrack>(&linearizer);
+
+  // Vertex finders
+  IterativeVertexFinder::Config ivfCfg(
+      FullBilloirVertexFitter(billoirCfg), densitySeedFinder, ipEstimator);
+  ivfCfg.field = field;
+  ivfCfg.trackLinearizer.connect<&HelicalTrackLinearizer::linearizeTrack>(
+      &linearizer);
+  ivfCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  IterativeVertexFinder ivf(
+      std::move(ivfCfg),
+      getDefaultLogger("IVF", Acts::Logging::WARNING));
+
+  AdaptiveMultiVertexFinder::Config amvfDensityCfg(
+      AdaptiveMultiVertexFitter(amvFitterCfg), densitySeedFinder, ipEstimator,
+      field);
+  amvfDensityCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  AdaptiveMultiVertexFinder amvfDensity(
+      std::move(amvfDensityCfg),
+      getDefaultLogger("AMVF", Acts::Logging::WARNING));
+
+  AdaptiveMultiVertexFinder::Config amvfGridCfg(
+      AdaptiveMultiVertexFitter(amvFitterCfg), gridSeedFinder, ipEstimator,
+      field);
+  amvfGridCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  AdaptiveMultiVertexFinder amvfGrid(
+      std::move(amvfGridCfg),
+      getDefaultLogger("AMVF", Acts::Logging::WARNING));
+
+  SingleSeedVertexFinder<SpacePoint>::Config ssvfCfg;
+  SingleSeedVertexFinder<SpacePoint> ssvf(
+      ssvfCfg,
+      getDefaultLogger("SSVF", Acts::Logging::WARNING));
+
+  Vertex beamSpot(Vector4(0., 0., 0., 0.));
+  beamSpot.setFullCovariance(
+      Vector4(10_um * 10_um, 10_um * 10_um, 50_mm * 50_mm, 1_ns * 1_ns)
+          .asDiagonal());
+  VertexingOptions vertexingOptions(geoContext, magFieldContext, beamSpot);
+  auto fieldCache = field->makeCache(magFieldContext);
+
+  std::mt19937 rng(2024);
+  for (std::size_t pileup : pileups) {
+    std::vector<Event> events;
+    std::size_t nTracks = 0;
+    for (std::size_t i = 0; i < nEvents; ++i) {
+      events.push_back(makeEvent(pileup, nTracksPerVertex, rng));
+      nTracks += events.back().tracks.size();
+    }
+    ACTS_INFO("pile-up " << pileup << ": " << nEvents << " events with "
+                         << 1. * nTracks / nEvents << " tracks on average");
+
+    // Runs the finder on all events and returns the number of vertices found
+    auto runFinder = [&](const IVertexFinder& finder) {
+      std::size_t nVertices = 0;
+      for (const auto& event : events) {
+        auto state = finder.makeState(magFieldContext);
+        auto result = finder.find(event.inputTracks, vertexingOptions, state);
+        if (result.ok()) {
+          nVertices += result->size();
+        }
+      }
+      return nVertices;
+    };
+
+    auto report = [&](const std::string& stage,
+                      const Acts::Test::MicroBenchmarkResult& result,
+                      std::size_t nVertices) {
+      const double seconds = 1e-9 * result.iterTimeAverage().count();
+      ACTS_INFO("pile-up " << pileup << ": " << stage << ": "
+                           << nEvents / seconds << " events/s, "
+                           << 1e3 * seconds / nEvents << " ms per event, "
+                           << 1. * nVertices / nEvents
+                           << " vertices per event");
+      ACTS_DEBUG("pile-up " << pileup << ": " << stage << ": " << result);
+    };
+
+    auto finderTiming = [&](const std::string& stage,
+                            const IVertexFinder& finder) {
+      std::size_t nVertices = runFinder(finder);
+      report(stage,
+             Acts::Test::microBenchmark([&] { return runFinder(finder); }, 1,
+                                        runs, std::chrono::milliseconds(0)),
+             nVertices);
+    };
+    // Single stages on the truth association
+    finderTiming("seeding (track density)", *densitySeedFinder);
+    finderTiming("seeding (adaptive grid)", *gridSeedFinder);
+
+    std::size_t nTruthVertices = 0;
+    for (const auto& event : events) {
+      nTruthVertices += event.vertices.size();
+    }
+    report("linearization at the true vertices",
+           Acts::Test::microBenchmark(
+               [&] {
+                 std::size_t nLinearized = 0;
+                 std::vector<LinearizedTrack> linTracks;
+                 BoundTrackParametersBatch params;
+                 for (const auto& event : events) {
+                   for (std::size_t i = 0; i < event.vertices.size(); ++i) {
+                     auto perigee = Surface::makeShared<PerigeeSurface>(
+                         event.vertices[i]);
+                     params.clear();
+                     for (std::size_t j = event.vertexOffsets[i];
+                          j < event.vertexOffsets[i + 1]; ++j) {
+                       params.push_back(event.tracks[j]);
+                     }
+                     if (linearizer
+                             .linearizeTracks(params, 0., *perigee, geoContext,
+                                              magFieldContext, fieldCache,
+                                              linTracks)
+                             .ok()) {
+                       nLinearized += linTracks.size();
+                     }
+                   }
+                 }
+                 return nLinearized;
+               },
+               1, runs, std::chrono::milliseconds(0)),
+           nTruthVertices);
+
+    auto fitTruthVertices = [&] {
+      std::size_t nFitted = 0;
+      std::vector<InputTrack> vertexTracks;
+      for (const auto& event : events) {
+        for (std::size_t i = 0; i < event.vertices.size(); ++i) {
+          vertexTracks.assign(
+              event.inputTracks.begin() + event.vertexOffsets[i],
+              event.inputTracks.begin() + event.vertexOffsets[i + 1]);
+          nFitted +=
+              billoirFitter.fit(vertexTracks, vertexingOptions, fieldCache)
+                  .ok();
+        }
+      }
+      return nFitted;
+    };
+    report("fitting of the true vertices (Billoir)",
+           Acts::Test::microBenchmark(fitTruthVertices, 1, runs,
+                                      std::chrono::milliseconds(0)),
+           fitTruthVertices());
+
+    // Full vertex finding
+    if (runIvf) {
+      finderTiming("IVF (track density seeds)", ivf);
+    }
+    finderTiming("AMVF (track density seeds)", amvfDensity);
+    finderTiming("AMVF (adaptive grid seeds)", amvfGrid);
+
+    auto runSsvf = [&] {
+      std::size_t nVertices = 0;
+      for (const auto& event : events) {
+        nVertices += ssvf.findVertex(event.spacepoints).ok();
+      }
+      return nVertices;
+    };
+    report("SSVF (space points)",
+           Acts::Test::microBenchmark(runSsvf, 1, runs,
+                                      std::chrono::milliseconds(0)),
+           runSsvf());
+  }
+
+  return 0;
+}
@@ -207,6 +207,26 @@ BOOST_DATA_TEST_CASE(FatrasSimulation, dataset, pdg, phi, eta, p,
   // should always succeed
   BOOST_CHECK(result.ok());
 
+  // simulating the particles one-by-one with the same generator sequence
+  // must give the same output
+  {
+    Generator particleGenerator;
+    std::vector<ActsFatras::Particle> particleInitial;
+    std::vector<ActsFatras::Particle> particleFinal;
+    std::vector<ActsFatras::Hit> particleHits;
+    std::vector<ActsFatras::FailedParticle> failed;
+    for (const auto& particle : input) {
+      auto particleResult = simulator.simulateParticle(
+          geoCtx, magCtx, particleGenerator, particle, particleInitial,
+          particleFinal, particleHits, failed);
+      BOOST_CHECK(particleResult.ok());
+    }
+    BOOST_CHECK_EQUAL(failed.size(), result.value().size());
+    BOOST_CHECK_EQUAL(particleInitial.size(), simulatedInitial.size());
+    BOOST_CHECK_EQUAL(particleFinal.size(), simulatedFinal.size());
+    BOOST_CHECK_EQUAL(particleHits.size(), hits.size());
+  }
+
   // ensure simulated particle containers have consistent content
   BOOST_CHECK_EQUAL(simulatedInitial.size(), simulatedFinal.size());
   for (std::size_t i = 0; i < simulatedInitial.size(); ++i) {
@@ -40,6 +40,7 @@
 #include "Acts/TrackFitting/KalmanFitter.hpp"
 #include "Acts/TrackFitting/detail/KalmanGlobalCovariance.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "ActsAlignment/Kernel/Alignment.hpp"
 
 #include <cmath>
@@ -382,5 +383,47 @@ BOOST_AUTO_TEST_CASE(ZeroFieldKalmanAlignment) {
   auto alignRes =
       alignZero.align(trajCollection, sParametersCollection, alignOptions);
 
+  // The chi2 derivatives accumulated in several threads give the same result
+  AlignmentResult serialResult;
+  serialResult.idxedAlignSurfaces = idxedAlignSurfaces;
+  alignZero.calculateAlignmentParameters(trajCollection, sParametersCollection,
+                                         kfOptions, serialResult);
+  AlignmentResult threadedResult;
+  threadedResult.idxedAlignSurfaces = idxedAlignSurfaces;
+  Acts::setMaxThreads(3);
+  alignZero.calculateAlignmentParameters(trajCollection, sParametersCollection,
+                                         kfOptions, threadedResult);
+  Acts::setMaxThreads(1);
+  BOOST_CHECK_EQUAL(threadedResult.numTracks, serialResult.numTracks);
+  BOOST_CHECK_EQUAL(threadedResult.measurementDim, serialResult.measurementDim);
+  CHECK_CLOSE_REL(threadedResult.chi2, serialResult.chi2, 1e-10);
+  CHECK_CLOSE_REL(threadedResult.averageChi2ONdf, serialResult.averageChi2ONdf,
+                  1e-10);
+  BOOST_CHECK_EQUAL(threadedResult.deltaAlignmentParameters.size(),
+                    serialResult.deltaAlignmentParameters.size());
+  // The telescope leaves some global modes unconstrained, the parameter
+  // changes along them depend on the rounding, but the chi2 change does not
+  CHECK_CLOSE_REL(threadedResult.deltaChi2, serialResult.deltaChi2, 1e-6);
+
+  // The sparse solvers agree with the dense one. As above, only the chi2
+  // change is unique for the unconstrained modes.
+  for (auto solver : {AlignmentSolver::SparseCholesky,
+                      AlignmentSolver::ConjugateGradient}) {
+    AlignmentSolverOptions solverOptions;
+    solverOptions.solver = solver;
+    AlignmentResult sparseResult;
+    sparseResult.idxedAlignSurfaces = idxedAlignSurfaces;
+    alignZero.calculateAlignmentParameters(
+        trajCollection, sParametersCollection, kfOptions, sparseResult,
+        AlignmentMask::All, solverOptions);
+    BOOST_CHECK(sparseResult.result.ok());
+    BOOST_CHECK(sparseResult.alignmentCovariance.size() == 0);
+    BOOST_CHECK_EQUAL(sparseResult.alignmentCovarianceBlocks.size(),
+                      idxedAlignSurfaces.size());
+    BOOST_CHECK_EQUAL(sparseResult.deltaAlignmentParameters.size(),
+                      serialResult.deltaAlignmentParameters.size());
+    CHECK_CLOSE_REL(sparseResult.deltaChi2, serialResult.deltaChi2, 1e-4);
+  }
+
   // BOOST_CHECK(alignRes.ok());
 }
@@ -0,0 +1,276 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Utilities/Holders.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <boost/container/flat_map.hpp>
+#include <boost/container/flat_set.hpp>
+
+namespace {
+
+using namespace Acts;
+
+using Tracks = TrackContainer<VectorTrackContainer, VectorMultiTrajectory,
+                              detail::ValueHolder>;
+
+struct MeasurementLink {
+  std::size_t index = 0;
+};
+
+std::size_t sourceLinkHash(const SourceLink& a) {
+  return a.get<MeasurementLink>().index;
+}
+
+bool sourceLinkEquality(const SourceLink& a, const SourceLink& b) {
+  return a.get<MeasurementLink>().index == b.get<MeasurementLink>().index;
+}
+
+/// Create the tracks of a number of particles with 10 measurements each.
+/// Each particle has up to two duplicates, in which some measurements are
+/// replaced by the ones of other particles, and there are a few fakes.
+Tracks makeTracks(std::size_t nParticles, std::mt19937& rng) {
+  constexpr std::size_t nHits = 10;
+  Tracks tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+
+  std::uniform_real_distribution<float> chi2(5., 30.);
+  std::uniform_int_distribution<std::size_t> hit(0, nParticles * nHits - 1);
+  std::uniform_int_distribution<std::size_t> nReplaced(0, 4);
+  std::uniform_int_distribution<std::size_t> nDuplicates(0, 2);
+
+  auto addTrack = [&](const std::vector<std::size_t>& measurements) {
+    auto track = tracks.makeTrack();
+    for (auto index : measurements) {
+      auto ts = track.appendTrackState(TrackStatePropMask::None);
+      ts.typeFlags().set(TrackStateFlag::MeasurementFlag);
+      ts.setUncalibratedSourceLink(SourceLink{MeasurementLink{index}});
+    }
+    track.nMeasurements() = measurements.size();
+    track.nDoF() = 2 * measurements.size();
+    track.chi2() = chi2(rng);
+  };
+
+  for (std::size_t iParticle = 0; iParticle < nParticles; ++iParticle) {
+    std::vector<std::size_t> measurements(nHits);
+    for (std::size_t i = 0; i < nHits; ++i) {
+      measurements[i] = iParticle * nHits + i;
+    }
+    addTrack(measurements);
+
+    for (std::size_t iDuplicate = nDuplicates(rng); iDuplicate > 0;
+         --iDuplicate) {
+      auto duplicate = measurements;
+      for (std::size_t i = nReplaced(rng); i > 0; --i) {
+        duplicate[hit(rng) % nHits] = hit(rng);
+      }
+      // drop the replacements which are already on the track
+      std::sort(duplicate.begin(), duplicate.end());
+      duplicate.erase(std::unique(duplicate.begin(), duplicate.end()),
+                      duplicate.end());
+      addTrack(duplicate);
+    }
+  }
+
+  for (std::size_t iFake = 0; iFake < nParticles / 10; ++iFake) {
+    std::vector<std::size_t> measurements;
+    while (measurements.size() < nHits) {
+      auto index = hit(rng);
+      if (std::find(measurements.begin(), measurements.end(), index) ==
+          measurements.end()) {
+        measurements.push_back(index);
+      }
+    }
+    addTrack(measurements);
+  }
+
+  return tracks;
+}
+
+/// Reference implementation rescanning all selected tracks in every
+/// iteration
+boost::container::flat_set<std::size_t> resolveReference(
+    const GreedyAmbiguityResolution::Config& cfg,
+    const GreedyAmbiguityResolution::State& state) {
+  std::vector<std::vector<std::size_t>> measurementsPerTrack;
+  boost::container::flat_map<std::size_t,
+                             boost::container::flat_set<std::size_t>>
+      tracksPerMeasurement;
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    measurementsPerTrack.emplace_back(
+        state.measurementsPerTrack.begin() + state.measurementOffsets[iTrack],
+        state.measurementsPerTrack.begin() +
+            state.measurementOffsets[iTrack + 1]);
+    for (auto iMeasurement : measurementsPerTrack.back()) {
+      tracksPerMeasurement[iMeasurement].insert(iTrack);
+    }
+  }
+  std::vector<std::size_t> shared(state.numberOfTracks, 0);
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    for (auto iMeasurement : measurementsPerTrack[iTrack]) {
+      shared[iTrack] += tracksPerMeasurement[iMeasurement].size() > 1;
+    }
+  }
+
+  auto selected = state.selectedTracks;
+  auto relativeShared = [&](std::size_t i) {
+    return 1.0 * shared[i] / measurementsPerTrack[i].size();
+  };
+  for (std::size_t i = 0; i < cfg.maximumIterations && !selected.empty();
+       ++i) {
+    auto maxShared = *std::max_element(
+        selected.begin(), selected.end(),
+        [&](std::size_t a, std::size_t b) { return shared[a] < shared[b]; });
+    if (shared[maxShared] < cfg.maximumSharedHits) {
+      break;
+    }
+    auto badTrack = *std::max_element(
+        selected.begin(), selected.end(), [&](std::size_t a, std::size_t b) {
+          if (relativeShared(a) != relativeShared(b)) {
+            return relativeShared(a) < relativeShared(b);
+          }
+          return state.trackChi2[a] < state.trackChi2[b];
+        });
+    for (auto iMeasurement : measurementsPerTrack[badTrack]) {
+      tracksPerMeasurement[iMeasurement].erase(badTrack);
+      if (tracksPerMeasurement[iMeasurement].size() == 1) {
+        --shared[*tracksPerMeasurement[iMeasurement].begin()];
+      }
+    }
+    selected.erase(badTrack);
+  }
+  return selected;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(GreedyAmbiguityResolutionTests)
+
+BOOST_AUTO_TEST_CASE(InitialState) {
+  std::mt19937 rng(42);
+  auto tracks = makeTracks(20, rng);
+
+  GreedyAmbiguityResolution::Config cfg;
+  cfg.nMeasurementsMin = 9;
+  GreedyAmbiguityResolution greedy(cfg);
+
+  GreedyAmbiguityResolution::State state;
+  greedy.computeInitialState(tracks, state, &sourceLinkHash,
+                             &sourceLinkEquality);
+
+  std::size_t nTracks = 0;
+  for (const auto& track : tracks) {
+    nTracks += track.nMeasurements() >= cfg.nMeasurementsMin;
+  }
+  BOOST_REQUIRE_EQUAL(state.numberOfTracks, nTracks);
+  BOOST_CHECK_EQUAL(state.selectedTracks.size(), nTracks);
+  BOOST_REQUIRE_EQUAL(state.measurementOffsets.size(), nTracks + 1);
+
+  // Both directions of the relation contain the same pairs
+  const std::size_t nMeasurements = state.trackOffsets.size() - 1;
+  std::size_t nRelations = 0;
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    BOOST_CHECK_EQUAL(state.nMeasurements(iTrack),
+                      tracks.getTrack(state.trackTips[iTrack]).nMeasurements());
+    std::size_t nShared = 0;
+    for (std::size_t i = state.measurementOffsets[iTrack];
+         i < state.measurementOffsets[iTrack + 1]; ++i) {
+      auto iMeasurement = state.measurementsPerTrack[i];
+      BOOST_REQUIRE_LT(iMeasurement, nMeasurements);
+      auto begin = state.tracksPerMeasurement.begin() +
+                   state.trackOffsets[iMeasurement];
+      auto end = state.tracksPerMeasurement.begin() +
+                 state.trackOffsets[iMeasurement + 1];
+      BOOST_CHECK(std::is_sorted(begin, end));
+      BOOST_CHECK(std::binary_search(begin, end, iTrack));
+      BOOST_CHECK_EQUAL(state.selectedTracksPerMeasurement[iMeasurement],
+                        end - begin);
+      nShared += (end - begin) > 1;
+      ++nRelations;
+    }
+    BOOST_CHECK_EQUAL(state.sharedMeasurementsPerTrack[iTrack], nShared);
+  }
+  BOOST_CHECK_EQUAL(state.tracksPerMeasurement.size(), nRelations);
+}
+
+BOOST_AUTO_TEST_CASE(InitialStateThreads) {
+  std::mt19937 rng(7);
+  auto tracks = makeTracks(2000, rng);
+
+  GreedyAmbiguityResolution::Config cfg;
+  cfg.nMeasurementsMin = 9;
+  GreedyAmbiguityResolution greedy(cfg);
+
+  GreedyAmbiguityResolution::State serial;
+  greedy.computeInitialState(tracks, serial, &sourceLinkHash,
+                             &sourceLinkEquality);
+
+  Acts::setMaxThreads(4);
+  GreedyAmbiguityResolution::State threaded;
+  greedy.computeInitialState(tracks, threaded, &sourceLinkHash,
+                             &sourceLinkEquality);
+  Acts::setMaxThreads(1);
+
+  BOOST_CHECK_EQUAL(threaded.numberOfTracks, serial.numberOfTracks);
+  BOOST_CHECK(threaded.trackTips == serial.trackTips);
+  BOOST_CHECK(threaded.trackChi2 == serial.trackChi2);
+  BOOST_CHECK(threaded.measurementOffsets == serial.measurementOffsets);
+  BOOST_CHECK(threaded.measurementsPerTrack == serial.measurementsPerTrack);
+  BOOST_CHECK(threaded.trackOffsets == serial.trackOffsets);
+  BOOST_CHECK(threaded.tracksPerMeasurement == serial.tracksPerMeasurement);
+  BOOST_CHECK(threaded.sharedMeasurementsPerTrack ==
+              serial.sharedMeasurementsPerTrack);
+  BOOST_CHECK(threaded.selectedTracks == serial.selectedTracks);
+}
+
+BOOST_AUTO_TEST_CASE(ResolveAsReference) {
+  std::mt19937 rng(1234);
+  auto tracks = makeTracks(200, rng);
+
+  for (std::uint32_t maximumSharedHits : {0u, 1u, 2u}) {
+    for (std::uint32_t maximumIterations : {10u, 1000u}) {
+      GreedyAmbiguityResolution::Config cfg;
+      cfg.maximumSharedHits = maximumSharedHits;
+      cfg.maximumIterations = maximumIterations;
+      GreedyAmbiguityResolution greedy(cfg);
+
+      GreedyAmbiguityResolution::State state;
+      greedy.computeInitialState(tracks, state, &sourceLinkHash,
+                                 &sourceLinkEquality);
+      auto expected = resolveReference(cfg, state);
+
+      greedy.resolve(state);
+      BOOST_CHECK_LT(state.selectedTracks.size(), state.numberOfTracks);
+      BOOST_CHECK_EQUAL_COLLECTIONS(
+          state.selectedTracks.begin(), state.selectedTracks.end(),
+          expected.begin(), expected.end());
+
+      // A complete resolution leaves no track above the limit
+      if (maximumIterations == 1000u && maximumSharedHits > 0) {
+        for (auto iTrack : state.selectedTracks) {
+          BOOST_CHECK_LT(state.sharedMeasurementsPerTrack[iTrack],
+                         maximumSharedHits);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -21,9 +21,14 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/TrackFinding/TrackSelector.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <map>
+#include <vector>
 
 using Acts::MultiTrajectoryTraits::IndexType;
 
@@ -125,6 +130,162 @@ BOOST_FIXTURE_TEST_CASE(GetCleanedOutTracksTest, Fixture) {
   }
 }
 
+using Tracks = TrackContainer<VectorTrackContainer, VectorMultiTrajectory,
+                              detail::ValueHolder>;
+using TrackFeatures = ScoreBasedAmbiguityResolution::TrackFeatures;
+
+// Create four tracks: the first one passes all cuts, the second one fails the
+// detector cuts, the third one the pT cut and the fourth one the optional cut
+Tracks createScoringInput(
+    std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors) {
+  Tracks tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  for (double pT : {10., 10., 0.1, 10.}) {
+    auto track = tracks.makeTrack();
+    BoundVector parameters = BoundVector::Zero();
+    parameters[eBoundTheta] = M_PI_2;
+    parameters[eBoundQOverP] = 1. / pT;
+    track.parameters() = parameters;
+  }
+
+  trackFeaturesVectors = {{{10, 1, 0, 0}, {3, 0, 0, 0}},
+                          {{10, 5, 0, 0}, {3, 0, 0, 0}},
+                          {{10, 1, 0, 0}, {3, 0, 0, 0}},
+                          {{10, 1, 0, 0}, {3, 0, 0, 0}}};
+  return tracks;
+}
+
+ScoreBasedAmbiguityResolution::Config createScoringConfig() {
+  ScoreBasedAmbiguityResolution::Config config;
+  config.volumeMap = {{8, 0}, {22, 1}};
+
+  ScoreBasedAmbiguityResolution::DetectorConfig pixel;
+  pixel.hitsScoreWeight = 20;
+  pixel.holesScoreWeight = -10;
+  pixel.outliersScoreWeight = -5;
+  pixel.minHits = 1;
+  pixel.maxHits = 20;
+  pixel.maxHoles = 3;
+  pixel.maxOutliers = 3;
+  pixel.factorHits.clear();
+  for (std::size_t i = 0; i <= pixel.maxHits; ++i) {
+    pixel.factorHits.push_back(0.5 + 0.02 * i);
+  }
+  pixel.factorHoles = {1., 0.9, 0.8, 0.7};
+
+  // too few factors, this detector is skipped by the ambiguity function
+  ScoreBasedAmbiguityResolution::DetectorConfig strip;
+  strip.hitsScoreWeight = 10;
+  strip.holesScoreWeight = -20;
+  strip.maxHits = 10;
+  strip.maxHoles = 2;
+
+  config.detectorConfigs = {pixel, strip};
+  config.pTMin = 1;
+  config.pTMax = 100;
+  return config;
+}
+
+BOOST_AUTO_TEST_CASE(SimpleScoreTest) {
+  std::vector<std::vector<TrackFeatures>> trackFeaturesVectors;
+  auto tracks = createScoringInput(trackFeaturesVectors);
+  ScoreBasedAmbiguityResolution tester(createScoringConfig());
+
+  std::size_t nCalls = 0;
+  ScoreBasedAmbiguityResolution::OptionalCuts<
+      VectorTrackContainer, VectorMultiTrajectory, detail::ValueHolder, true>
+      optionalCuts;
+  optionalCuts.cuts.push_back([&](const auto& track) {
+    ++nCalls;
+    return track.index() == 3;
+  });
+
+  auto scores = tester.simpleScore(tracks, trackFeaturesVectors, optionalCuts);
+  BOOST_REQUIRE_EQUAL(scores.size(), 4u);
+  // the negative weights are subtracted
+  CHECK_CLOSE_REL(scores[0], 100. + 10 * 20 - 1 * 10 + 3 * 10, 1e-12);
+  BOOST_CHECK_EQUAL(scores[1], 0.);
+  BOOST_CHECK_EQUAL(scores[2], 0.);
+  BOOST_CHECK_EQUAL(scores[3], 0.);
+  // the optional cuts are only evaluated for the tracks passing the others
+  BOOST_CHECK_EQUAL(nCalls, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(AmbiguityScoreTest) {
+  std::vector<std::vector<TrackFeatures>> trackFeaturesVectors;
+  auto tracks = createScoringInput(trackFeaturesVectors);
+  auto config = createScoringConfig();
+  config.useAmbiguityFunction = true;
+  ScoreBasedAmbiguityResolution tester(config);
+
+  auto scores = tester.ambiguityScore(
+      tracks, trackFeaturesVectors,
+      ScoreBasedAmbiguityResolution::OptionalCuts<
+          VectorTrackContainer, VectorMultiTrajectory, detail::ValueHolder,
+          true>{});
+  BOOST_REQUIRE_EQUAL(scores.size(), 4u);
+  const double pT = 10. / UnitConstants::MeV;
+  CHECK_CLOSE_REL(scores[0], (std::log10(pT) - 1.) * (0.5 + 0.02 * 10) * 0.9,
+                  1e-12);
+  BOOST_CHECK_EQUAL(scores[1], 0.);
+  BOOST_CHECK_EQUAL(scores[2], 0.);
+  CHECK_CLOSE_REL(scores[3], scores[0], 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(ScoreThreads) {
+  // repeat the scoring input, such that the tracks are split into ranges
+  Tracks tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  std::vector<std::vector<TrackFeatures>> trackFeaturesVectors;
+  for (std::size_t i = 0; i < 2000; ++i) {
+    std::vector<std::vector<TrackFeatures>> features;
+    auto input = createScoringInput(features);
+    for (const auto& track : input) {
+      auto copy = tracks.makeTrack();
+      copy.parameters() = track.parameters();
+      copy.chi2() = 1. + 0.01 * (tracks.size() % 7);
+      copy.nDoF() = 5;
+    }
+    trackFeaturesVectors.insert(trackFeaturesVectors.end(), features.begin(),
+                                features.end());
+  }
+
+  // the user functions are called in track order
+  std::vector<std::size_t> calls;
+  ScoreBasedAmbiguityResolution::OptionalCuts<
+      VectorTrackContainer, VectorMultiTrajectory, detail::ValueHolder, true>
+      optionalCuts;
+  optionalCuts.weights.push_back([&](const auto& track, double& score) {
+    calls.push_back(track.index());
+    score += 1.;
+  });
+  optionalCuts.scores.push_back([&](const auto& track, double& score) {
+    calls.push_back(track.index());
+    score *= 2.;
+  });
+
+  for (bool useAmbiguityFunction : {false, true}) {
+    auto config = createScoringConfig();
+    config.useAmbiguityFunction = useAmbiguityFunction;
+    ScoreBasedAmbiguityResolution tester(config);
+    auto score = [&]() {
+      calls.clear();
+      return useAmbiguityFunction
+                 ? tester.ambiguityScore(tracks, trackFeaturesVectors,
+                                         optionalCuts)
+                 : tester.simpleScore(tracks, trackFeaturesVectors,
+                                      optionalCuts);
+    };
+
+    auto serial = score();
+    BOOST_CHECK(std::is_sorted(calls.begin(), calls.end()));
+    Acts::setMaxThreads(4);
+    auto threaded = score();
+    Acts::setMaxThreads(1);
+    BOOST_CHECK(std::is_sorted(calls.begin(), calls.end()));
+    BOOST_CHECK_EQUAL(calls.size(), 2 * 2000u);
+    BOOST_CHECK(threaded == serial);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace Acts::Test
@@ -247,4 +247,59 @@ BOOST_AUTO_TEST_CASE(Grid_2D_rand) {
   }
 }
 
+// Forwards to the default connectivity, but is not recognised as such by
+// labelClusters and hence takes the generic neighbour search
+struct GenericConnect2D {
+  Ccl::Connect2D<Cell2D> connect;
+  Ccl::ConnectResult operator()(const Cell2D& ref, const Cell2D& iter) const {
+    return connect(ref, iter);
+  }
+};
+
+std::vector<std::vector<std::pair<int, int>>> sortedClusters(
+    const std::vector<Cluster2D>& clusters) {
+  std::vector<std::vector<std::pair<int, int>>> out;
+  for (const Cluster2D& cl : clusters) {
+    std::vector<std::pair<int, int>> cells;
+    for (const Cell2D& c : cl.cells) {
+      cells.emplace_back(c.row, c.col);
+    }
+    std::sort(cells.begin(), cells.end());
+    out.push_back(std::move(cells));
+  }
+  std::sort(out.begin(), out.end());
+  return out;
+}
+
+BOOST_AUTO_TEST_CASE(Grid_2D_runs_vs_generic) {
+  using CellC = std::vector<Cell2D>;
+  using ClusterC = std::vector<Cluster2D>;
+
+  std::mt19937_64 rnd(3179);
+  std::uniform_int_distribution<int> coord(0, 60);
+
+  for (bool commonCorner : {true, false}) {
+    for (std::size_t itry = 0; itry < 50; ++itry) {
+      // Dense random occupancy, every cell at most once
+      CellC cells;
+      for (std::size_t i = 0; i < 1500; ++i) {
+        cells.emplace_back(coord(rnd), coord(rnd));
+      }
+      std::sort(cells.begin(), cells.end(), cellComp);
+      cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+      std::shuffle(cells.begin(), cells.end(), rnd);
+      CellC cellsGeneric = cells;
+
+      ClusterC runCls = Ccl::createClusters<CellC, ClusterC>(
+          cells, Ccl::DefaultConnect<Cell2D>(commonCorner));
+      ClusterC genericCls = Ccl::createClusters<CellC, ClusterC, 2>(
+          cellsGeneric,
+          GenericConnect2D{Ccl::Connect2D<Cell2D>(commonCorner)});
+
+      BOOST_CHECK_EQUAL(runCls.size(), genericCls.size());
+      BOOST_CHECK(sortedClusters(runCls) == sortedClusters(genericCls));
+    }
+  }
+}
+
 }  // namespace Acts::Test
@@ -24,8 +24,17 @@
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/DiscSurface.hpp"
 #include "Acts/Utilities/BinningData.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <thread>
+
+// The number of internal structures built at the same time, and its maximum
+std::atomic<std::size_t> s_activeBuilds{0};
+std::atomic<std::size_t> s_maxActiveBuilds{0};
 
 template <typename surface_type>
 class SurfaceBuilder : public Acts::Experimental::IInternalStructureBuilder {
@@ -40,6 +49,15 @@ class SurfaceBuilder : public Acts::Experimental::IInternalStructureBuilder {
   /// @return a consistent set of detector volume internals
   Acts::Experimental::InternalStructure construct(
       [[maybe_unused]] const Acts::GeometryContext& gctx) const final {
+    std::size_t active = ++s_activeBuilds;
+    std::size_t maxActive = s_maxActiveBuilds;
+    while (active > maxActive &&
+           !s_maxActiveBuilds.compare_exchange_weak(maxActive, active)) {
+    }
+    // give the other branches the time to overlap
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    --s_activeBuilds;
+
     // Trivialities first: internal volumes
     std::vector<std::shared_ptr<Acts::Experimental::DetectorVolume>>
         internalVolumes = {};
@@ -278,6 +296,31 @@ BOOST_AUTO_TEST_CASE(CylindricalDetectorFromBlueprintTest) {
   BOOST_CHECK_EQUAL(detector->volumes()[11]->name(), "pixel_pec_layer");
   BOOST_CHECK_EQUAL(detector->volumes()[12]->name(), "pixel_pec_gap_1");
   BOOST_CHECK_EQUAL(detector->volumes()[13]->name(), "detector_gap_1");
+
+  // Building the branches concurrently gives the same detector, the nested
+  // containers share the thread budget
+  s_maxActiveBuilds = 0;
+  Acts::setMaxThreads(4);
+  dCfg.builder =
+      std::make_shared<Acts::Experimental::CylindricalContainerBuilder>(
+          *detectorBpr, Acts::Logging::INFO, true);
+  auto threadedDetector =
+      Acts::Experimental::DetectorBuilder(dCfg).construct(tContext);
+  Acts::setMaxThreads(1);
+  BOOST_REQUIRE_NE(threadedDetector, nullptr);
+  BOOST_REQUIRE_EQUAL(threadedDetector->volumes().size(),
+                      detector->volumes().size());
+  for (std::size_t iv = 0; iv < detector->volumes().size(); ++iv) {
+    const auto& volume = *detector->volumes()[iv];
+    const auto& threadedVolume = *threadedDetector->volumes()[iv];
+    BOOST_CHECK_EQUAL(threadedVolume.name(), volume.name());
+    BOOST_CHECK_EQUAL(threadedVolume.geometryId(), volume.geometryId());
+    BOOST_CHECK_EQUAL(threadedVolume.surfaces().size(),
+                      volume.surfaces().size());
+    BOOST_CHECK_EQUAL(threadedVolume.portals().size(), volume.portals().size());
+  }
+  BOOST_CHECK_GT(s_maxActiveBuilds, 1u);
+  BOOST_CHECK_LE(s_maxActiveBuilds, 4u);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -120,6 +120,12 @@ BOOST_AUTO_TEST_CASE(KdtSurfacesProvider) {
   auto b1 = ba1.surfaces(tContext);
   refNumber = 32u * 14u;
   BOOST_CHECK_EQUAL(b1.size(), refNumber);
+
+  // query: both regions in one go
+  auto both = skdt->surfaces(std::vector<Acts::Extent>{regionND3, regionB1});
+  BOOST_REQUIRE_EQUAL(both.size(), 2u);
+  BOOST_CHECK(both[0] == nd3);
+  BOOST_CHECK(both[1] == b1);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/BoundTrackParametersBatch.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Delegate.hpp"
+#include "Acts/Vertexing/TrackAtVertex.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+using namespace Acts;
+
+BOOST_AUTO_TEST_SUITE(EventDataBoundTrackParametersBatch)
+
+BOOST_AUTO_TEST_CASE(FillAndAccess) {
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  auto other = Surface::makeShared<PerigeeSurface>(Vector3::UnitZ());
+
+  std::vector<BoundTrackParameters> input;
+  for (int i = 0; i < 5; ++i) {
+    std::optional<BoundSquareMatrix> cov;
+    if (i % 2 == 0) {
+      cov = BoundSquareMatrix::Identity() * (i + 1.);
+    }
+    input.emplace_back(i < 4 ? perigee : other,
+                       BoundVector::Constant(0.1 * i), cov,
+                       ParticleHypothesis::pion());
+  }
+
+  BoundTrackParametersBatch batch;
+  batch.reserve(input.size());
+  long useCount = perigee.use_count();
+  for (const auto& params : input) {
+    batch.push_back(params);
+  }
+  BOOST_CHECK_EQUAL(batch.size(), input.size());
+  // every surface is kept once, independent of the number of entries
+  BOOST_CHECK_EQUAL(batch.surfaces().size(), 2u);
+  BOOST_CHECK_EQUAL(perigee.use_count(), useCount + 1);
+  BOOST_CHECK_EQUAL(batch.surfaceIndices()[3], 0u);
+  BOOST_CHECK_EQUAL(batch.surfaceIndices()[4], 1u);
+
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    BOOST_CHECK_EQUAL(batch.parameters(i), input[i].parameters());
+    BOOST_CHECK_EQUAL(&batch.parameters(i), &batch.parameters()[i]);
+    BOOST_CHECK_EQUAL(batch.hasCovariance(i),
+                      input[i].covariance().has_value());
+    BOOST_CHECK_EQUAL(&batch.referenceSurface(i),
+                      &input[i].referenceSurface());
+    BOOST_CHECK_EQUAL(batch.index(batch.parameters(i)), i);
+
+    BoundTrackParameters params = batch.at(i);
+    BOOST_CHECK_EQUAL(params.parameters(), input[i].parameters());
+    BOOST_CHECK(params.covariance() == input[i].covariance());
+    BOOST_CHECK(params.particleHypothesis() == input[i].particleHypothesis());
+  }
+  BOOST_CHECK_EQUAL(batch.covariances()[1], BoundSquareMatrix::Zero());
+
+  batch.clear();
+  BOOST_CHECK(batch.empty());
+  BOOST_CHECK(batch.surfaces().empty());
+  BOOST_CHECK_EQUAL(perigee.use_count(), useCount);
+}
+
+BOOST_AUTO_TEST_CASE(VertexingInput) {
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  BoundTrackParametersBatch batch;
+  for (int i = 0; i < 3; ++i) {
+    batch.emplace_back(perigee, BoundVector::Constant(i + 1.),
+                       BoundSquareMatrix::Identity(),
+                       ParticleHypothesis::pion());
+  }
+
+  BoundTrackParametersBatchInput input(batch);
+  std::vector<InputTrack> tracks = input.inputTracks();
+  BOOST_REQUIRE_EQUAL(tracks.size(), 3u);
+
+  InputTrack::Extractor extractor;
+  extractor.connect<&BoundTrackParametersBatchInput::extractParameters>(
+      &input);
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    BOOST_CHECK_EQUAL(input.index(tracks[i]), i);
+    BOOST_CHECK_EQUAL(extractor(tracks[i]).parameters(), batch.parameters(i));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
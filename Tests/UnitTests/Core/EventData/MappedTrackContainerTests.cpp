@@ -0,0 +1,221 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MappedTrackContainer.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::HashedStringLiteral;
+
+namespace {
+
+const GeometryContext gctx;
+
+std::string tempPath(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventDataMappedTrackContainer)
+
+BOOST_AUTO_TEST_CASE(RoundTrip) {
+  std::vector<std::shared_ptr<PlaneSurface>> planes;
+  for (int i = 0; i < 3; ++i) {
+    auto plane = Surface::makeShared<PlaneSurface>(
+        Vector3{10. * (i + 1), 0, 0}, Vector3::UnitX());
+    plane->assignGeometryId(GeometryIdentifier().setVolume(1).setSensitive(
+        static_cast<GeometryIdentifier::Value>(i + 1)));
+    planes.push_back(plane);
+  }
+  MappedSurfaceLookup lookup =
+      [&](const GeometryIdentifier& geoId) -> const Surface* {
+    for (const auto& plane : planes) {
+      if (plane->geometryId() == geoId) {
+        return plane.get();
+      }
+    }
+    return nullptr;
+  };
+
+  TrackContainer tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  for (int itrack = 0; itrack < 2; ++itrack) {
+    auto track = tracks.makeTrack();
+    for (std::size_t i = 0; i < planes.size(); ++i) {
+      auto ts = track.appendTrackState(TrackStatePropMask::Predicted |
+                                       TrackStatePropMask::Jacobian);
+      ts.predicted() = BoundVector::Constant(itrack + i + 1.);
+      ts.predictedCovariance() = BoundMatrix::Identity() * (i + 2.);
+      ts.jacobian() = BoundMatrix::Constant(i + 3.);
+      ts.allocateCalibrated(2);
+      ts.calibrated<2>() = Vector2{i + 0.5, itrack + 0.25};
+      ts.calibratedCovariance<2>() = SquareMatrix2::Identity() * (i + 1.);
+      ts.chi2() = 1.5f * i;
+      ts.pathLength() = 100. * i;
+      ts.typeFlags().set(TrackStateFlag::MeasurementFlag);
+      ts.setReferenceSurface(planes[i]);
+      if (i == 0) {
+        // shares the prediction as its filtered parameters
+        ts.shareFrom(TrackStatePropMask::Predicted,
+                     TrackStatePropMask::Filtered);
+      }
+    }
+    track.parameters() = BoundVector::Constant(7. + itrack);
+    track.covariance() = BoundMatrix::Identity() * 0.5;
+    track.setReferenceSurface(
+        Surface::makeShared<PerigeeSurface>(Vector3{0, 0, itrack * 1.}));
+    track.particleHypothesis() = ParticleHypothesis::pionLike(2);
+    track.nMeasurements() = 3;
+    track.nHoles() = itrack;
+    track.chi2() = 4.5f;
+    track.nDoF() = 4;
+  }
+
+  const std::string path = tempPath("MappedTrackContainerRoundTrip.trk");
+  {
+    std::ofstream os(path, std::ios::binary);
+    writeMappedTracks(os, gctx, tracks);
+  }
+
+  auto file = std::make_shared<const MappedTrackFile>(path);
+  BOOST_CHECK_EQUAL(file->nTracks(), 2u);
+  BOOST_CHECK_EQUAL(file->nTrackStates(), 6u);
+
+  TrackContainer mapped{ConstMappedTrackContainer{file, lookup},
+                        ConstMappedMultiTrajectory{file, lookup}};
+  BOOST_REQUIRE_EQUAL(mapped.size(), tracks.size());
+
+  for (std::size_t itrack = 0; itrack < tracks.size(); ++itrack) {
+    auto expected = tracks.getTrack(itrack);
+    auto actual = mapped.getTrack(itrack);
+    BOOST_CHECK_EQUAL(actual.tipIndex(), expected.tipIndex());
+    BOOST_CHECK_EQUAL(actual.nMeasurements(), expected.nMeasurements());
+    BOOST_CHECK_EQUAL(actual.nHoles(), expected.nHoles());
+    BOOST_CHECK_EQUAL(actual.nDoF(), expected.nDoF());
+    BOOST_CHECK_EQUAL(actual.chi2(), expected.chi2());
+    BOOST_CHECK_EQUAL(actual.parameters(), expected.parameters());
+    BOOST_CHECK_EQUAL(actual.covariance(), expected.covariance());
+    BOOST_CHECK(actual.particleHypothesis() == expected.particleHypothesis());
+    BOOST_REQUIRE(actual.hasReferenceSurface());
+    BOOST_CHECK_EQUAL(actual.referenceSurface().type(), Surface::Perigee);
+    BOOST_CHECK_EQUAL(actual.referenceSurface().center(gctx),
+                      expected.referenceSurface().center(gctx));
+    BOOST_CHECK_EQUAL(actual.nTrackStates(), expected.nTrackStates());
+
+    auto expectedStates = expected.trackStatesReversed();
+    auto it = expectedStates.begin();
+    for (const auto& ts : actual.trackStatesReversed()) {
+      const auto& exp = *it;
+      ++it;
+      BOOST_CHECK_EQUAL(ts.index(), exp.index());
+      BOOST_CHECK_EQUAL(ts.predicted(), exp.predicted());
+      BOOST_CHECK_EQUAL(ts.predictedCovariance(), exp.predictedCovariance());
+      BOOST_CHECK_EQUAL(ts.hasFiltered(), exp.hasFiltered());
+      BOOST_CHECK(!ts.hasSmoothed());
+      BOOST_CHECK_EQUAL(ts.jacobian(), exp.jacobian());
+      BOOST_CHECK_EQUAL(ts.calibratedSize(), 2u);
+      BOOST_CHECK_EQUAL(ts.calibrated<2>(), exp.calibrated<2>());
+      BOOST_CHECK_EQUAL(ts.calibratedCovariance<2>(),
+                        exp.calibratedCovariance<2>());
+      BOOST_CHECK_EQUAL(ts.chi2(), exp.chi2());
+      BOOST_CHECK_EQUAL(ts.pathLength(), exp.pathLength());
+      BOOST_CHECK(ts.typeFlags().test(TrackStateFlag::MeasurementFlag));
+      BOOST_CHECK_EQUAL(&ts.referenceSurface(), &exp.referenceSurface());
+      BOOST_CHECK(!ts.hasUncalibratedSourceLink());
+      if (ts.hasFiltered()) {
+        // sharing survives the round trip
+        BOOST_CHECK_EQUAL(ts.filtered().data(), ts.predicted().data());
+      }
+    }
+  }
+
+  // the states can be iterated without the tracks
+  std::size_t nMeasurements = 0;
+  const auto& states = mapped.trackStateContainer();
+  for (MultiTrajectoryTraits::IndexType i = 0; i < states.size(); ++i) {
+    nMeasurements += states.getTrackState(i).typeFlags().test(
+        TrackStateFlag::MeasurementFlag);
+  }
+  BOOST_CHECK_EQUAL(nMeasurements, 6u);
+
+  // surfaces missing from the geometry are reported
+  MappedSurfaceLookup noSurfaces = [](const GeometryIdentifier&) {
+    return static_cast<const Surface*>(nullptr);
+  };
+  BOOST_CHECK_THROW(ConstMappedMultiTrajectory(file, noSurfaces),
+                    std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidFile) {
+  BOOST_CHECK_THROW(MappedTrackFile(tempPath("MappedTrackContainerMissing")),
+                    std::runtime_error);
+
+  const std::string path = tempPath("MappedTrackContainerInvalid.trk");
+  {
+    std::ofstream os(path, std::ios::binary);
+    os << std::string(512, 'x');
+  }
+  BOOST_CHECK_THROW(MappedTrackFile{path}, std::runtime_error);
+
+  // a truncated file fails the section bounds check
+  TrackContainer tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  auto track = tracks.makeTrack();
+  track.appendTrackState();
+  {
+    std::ofstream os(path, std::ios::binary);
+    writeMappedTracks(os, gctx, tracks);
+  }
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 32);
+  BOOST_CHECK_THROW(MappedTrackFile{path}, std::runtime_error);
+
+  // an index of a record outside of its section is reported
+  {
+    std::ofstream os(path, std::ios::binary);
+    writeMappedTracks(os, gctx, tracks);
+  }
+  BOOST_CHECK_NO_THROW(MappedTrackFile{path});
+  {
+    std::fstream fs(path, std::ios::binary | std::ios::in | std::ios::out);
+    detail_mtc::FileHeader header;
+    fs.read(reinterpret_cast<char*>(&header), sizeof(header));
+    detail_mtc::StateRecord state;
+    fs.seekg(header.sections[detail_mtc::eStates].offset);
+    fs.read(reinterpret_cast<char*>(&state), sizeof(state));
+    state.ipredicted = 1000;
+    fs.seekp(header.sections[detail_mtc::eStates].offset);
+    fs.write(reinterpret_cast<const char*>(&state), sizeof(state));
+  }
+  BOOST_CHECK_THROW(MappedTrackFile{path}, std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -14,19 +14,26 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/PackedCovariance.hpp"
 #include "Acts/EventData/ProxyAccessor.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
 #include "Acts/EventData/detail/MultiTrajectoryTestsCommon.hpp"
 #include "Acts/EventData/detail/TestSourceLink.hpp"
 #include "Acts/EventData/detail/TestTrackState.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/DetectorElementStub.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <memory_resource>
 #include <ostream>
 #include <random>
 #include <stdexcept>
@@ -63,6 +70,30 @@ struct Factory {
 
 using CommonTests = MultiTrajectoryTestsCommon<Factory>;
 
+/// Memory resource that counts the allocations it forwards upstream
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t allocations = 0;
+  std::size_t deallocations = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes,
+                     std::size_t alignment) override {
+    ++deallocations;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
 }  // namespace
 
 BOOST_AUTO_TEST_SUITE(EventDataMultiTrajectory)
@@ -251,6 +282,155 @@ BOOST_AUTO_TEST_CASE(MemoryStats) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(Footprint) {
+  VectorMultiTrajectory mt;
+  mt.addColumn<float>("residual");
+
+  auto footprint = mt.footprint();
+  BOOST_CHECK_EQUAL(footprint.bytes(), 0u);
+  BOOST_CHECK_EQUAL(footprint.growthEvents, 0u);
+
+  auto column = [&](const std::string& name) {
+    auto it = std::find_if(
+        footprint.columns.begin(), footprint.columns.end(),
+        [&](const auto& c) { return c.name == name; });
+    BOOST_REQUIRE(it != footprint.columns.end());
+    return *it;
+  };
+
+  for (int i = 0; i < 5; ++i) {
+    mt.addTrackState(TrackStatePropMask::Predicted);
+  }
+  footprint = mt.footprint();
+  BOOST_CHECK_EQUAL(column("index").size, 5u);
+  BOOST_CHECK_GE(column("index").capacity, 5u);
+  BOOST_CHECK_EQUAL(column("params").size, 5u);
+  BOOST_CHECK_EQUAL(column("params").elementSize, sizeof(BoundVector));
+  BOOST_CHECK_EQUAL(column("jac").size, 0u);
+  BOOST_CHECK_EQUAL(
+      column("dynamic:" + std::to_string(hashString("residual"))).bytes(),
+      5 * sizeof(float));
+  BOOST_CHECK_GT(footprint.bytes(), 0u);
+  BOOST_CHECK_GE(footprint.capacityBytes(), footprint.bytes());
+  // the empty index grows on the first state and at least once more
+  BOOST_CHECK_GE(footprint.growthEvents, 2u);
+
+  // reserving up front avoids the growth
+  mt.clear();
+  mt.reserve(10);
+  BOOST_CHECK_EQUAL(mt.footprint().growthEvents, 0u);
+  for (int i = 0; i < 10; ++i) {
+    mt.addTrackState(TrackStatePropMask::Predicted);
+  }
+  BOOST_CHECK_EQUAL(mt.footprint().growthEvents, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(MemoryResource) {
+  CountingResource counting;
+  {
+    VectorMultiTrajectory mt(&counting);
+    BOOST_CHECK_EQUAL(mt.memoryResource(), &counting);
+    mt.addColumn<double>("extra");
+
+    TestTrackState pc(rng, 2u);
+    auto ts = mt.makeTrackState();
+    fillTrackState<VectorMultiTrajectory>(pc, TrackStatePropMask::All, ts);
+    ts.component<double, "extra"_hash>() = 42.;
+    BOOST_CHECK_GT(counting.allocations, 0u);
+
+    // clearing keeps the capacity
+    std::size_t allocations = counting.allocations;
+    std::size_t deallocations = counting.deallocations;
+    mt.clear();
+    ts = mt.makeTrackState();
+    fillTrackState<VectorMultiTrajectory>(pc, TrackStatePropMask::All, ts);
+    BOOST_CHECK_EQUAL(counting.allocations, allocations);
+    BOOST_CHECK_EQUAL(counting.deallocations, deallocations);
+
+    // copies do not borrow the resource
+    VectorMultiTrajectory copy(mt);
+    BOOST_CHECK_EQUAL(copy.memoryResource(),
+                      std::pmr::get_default_resource());
+    BOOST_CHECK_EQUAL(counting.allocations, allocations);
+  }
+  BOOST_CHECK_EQUAL(counting.allocations, counting.deallocations);
+
+  // per event arena over a buffer that is reused after each event
+  std::vector<std::byte> buffer(1 << 20);
+  std::pmr::monotonic_buffer_resource arena(
+      buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+  for (int event = 0; event < 3; ++event) {
+    {
+      VectorMultiTrajectory mt(&arena);
+      mt.addColumn<double>("extra");
+      for (int i = 0; i < 10; ++i) {
+        TestTrackState pc(rng, 2u);
+        auto ts = mt.makeTrackState();
+        fillTrackState<VectorMultiTrajectory>(pc, TrackStatePropMask::All,
+                                              ts);
+        ts.component<double, "extra"_hash>() = i;
+      }
+      BOOST_CHECK_EQUAL(mt.size(), 10u);
+    }
+    arena.release();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ReferenceSurfaceOwnership) {
+  DetectorElementStub element(Transform3::Identity(),
+                              std::make_shared<RectangleBounds>(1., 1.), 1.);
+  std::weak_ptr<const Surface> weakDetSurface =
+      element.surface().getSharedPtr();
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  std::weak_ptr<const Surface> weakPerigee = perigee;
+
+  // by default all reference surfaces are shared
+  VectorMultiTrajectory mt;
+  auto ts = mt.makeTrackState();
+  ts.setReferenceSurface(element.surface().getSharedPtr());
+  BOOST_CHECK_EQUAL(weakDetSurface.use_count(), 2);
+  BOOST_CHECK_EQUAL(&ts.referenceSurface(), &element.surface());
+  mt.clear();
+  BOOST_CHECK_EQUAL(weakDetSurface.use_count(), 1);
+
+  // surfaces of detector elements are not owned if requested, free-standing
+  // surfaces still are
+  mt.setNonOwningDetectorSurfaces(true);
+  ts = mt.makeTrackState();
+  ts.setReferenceSurface(element.surface().getSharedPtr());
+  BOOST_CHECK_EQUAL(weakDetSurface.use_count(), 1);
+  BOOST_CHECK_EQUAL(&ts.referenceSurface(), &element.surface());
+  auto ts2 = mt.makeTrackState();
+  ts2.setReferenceSurface(std::move(perigee));
+  BOOST_CHECK_EQUAL(weakPerigee.use_count(), 1);
+  BOOST_CHECK_EQUAL(&ts2.referenceSurface(), weakPerigee.lock().get());
+
+  // copies keep the free-standing surfaces alive and the mode
+  VectorMultiTrajectory copy(mt);
+  mt.clear();
+  BOOST_CHECK_EQUAL(weakDetSurface.use_count(), 1);
+  BOOST_CHECK_EQUAL(weakPerigee.use_count(), 1);
+  BOOST_CHECK_EQUAL(&copy.getTrackState(0).referenceSurface(),
+                    &element.surface());
+  BOOST_CHECK_EQUAL(&copy.getTrackState(1).referenceSurface(),
+                    weakPerigee.lock().get());
+  copy.getTrackState(0).setReferenceSurface(element.surface().getSharedPtr());
+  BOOST_CHECK_EQUAL(weakDetSurface.use_count(), 1);
+
+  copy.clear();
+  BOOST_CHECK(weakPerigee.expired());
+
+  // the same for the track container
+  VectorTrackContainer vtc;
+  vtc.addTrack_impl();
+  vtc.setReferenceSurface_impl(0, element.surface().getSharedPtr());
+  BOOST_CHECK_EQUAL(weakDetSurface.use_count(), 2);
+  vtc.setNonOwningDetectorSurfaces(true);
+  vtc.setReferenceSurface_impl(0, element.surface().getSharedPtr());
+  BOOST_CHECK_EQUAL(weakDetSurface.use_count(), 1);
+  BOOST_CHECK_EQUAL(vtc.referenceSurface_impl(0), &element.surface());
+}
+
 BOOST_AUTO_TEST_CASE(Accessors) {
   VectorMultiTrajectory mtj;
   mtj.addColumn<unsigned int>("ndof");
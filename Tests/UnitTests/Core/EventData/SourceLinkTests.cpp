@@ -10,10 +10,12 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/SourceLinkTable.hpp"
 #include "Acts/EventData/detail/TestSourceLink.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 
 #include <any>
+#include <cstdint>
 #include <sstream>
 
 using namespace Acts::UnitLiterals;
@@ -51,4 +53,38 @@ BOOST_AUTO_TEST_CASE(Construct) {
   }
 }
 
+// larger than the small buffer of the source link
+struct ClusterSourceLink {
+  std::uint64_t moduleHash = 0;
+  std::uint32_t cluster = 0;
+  const void* calibration = nullptr;
+};
+
+BOOST_AUTO_TEST_CASE(Table) {
+  using Table = Acts::SourceLinkTable<ClusterSourceLink>;
+  static_assert(sizeof(ClusterSourceLink) > ACTS_SOURCELINK_SBO_SIZE);
+
+  Table table;
+  table.reserve(10);
+  for (std::uint32_t i = 0; i < 10; ++i) {
+    BOOST_CHECK_EQUAL(table.emplace_back(ClusterSourceLink{100u + i, i}), i);
+  }
+  BOOST_CHECK_EQUAL(table.size(), 10u);
+
+  Acts::SourceLink sl = table.sourceLink(3);
+  BOOST_CHECK_EQUAL(Table::payload(sl).moduleHash, 103u);
+  BOOST_CHECK_EQUAL(&Table::payload(sl), &table[3]);
+  BOOST_CHECK_EQUAL(sl.get<Table::Link>().index(), 3u);
+  BOOST_CHECK(sl.get<Table::Link>() == Table::Link(table, 3));
+  BOOST_CHECK(sl.get<Table::Link>() != Table::Link(table, 4));
+  BOOST_CHECK_THROW(sl.get<ClusterSourceLink>(), std::bad_any_cast);
+
+  // changes to the table are seen through the link
+  table[3].cluster = 42;
+  BOOST_CHECK_EQUAL(Table::payload(sl).cluster, 42u);
+
+  table.clear();
+  BOOST_CHECK(table.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -571,6 +571,66 @@ BOOST_AUTO_TEST_CASE(EnsureDynamicColumns) {
   BOOST_CHECK(tc2.hasColumn("odd"));
 }
 
+BOOST_AUTO_TEST_CASE(DynamicColumnHandles) {
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  tc.addColumn<unsigned int>("hits");
+  tc.addColumn<bool>("odd");
+  tc.trackStateContainer().addColumn<float>("residual");
+
+  auto hits = tc.container().dynamicColumnHandle<unsigned int>("hits"_hash);
+  auto odd = ProxyAccessor<bool>("odd").resolve(tc.container());
+  auto residual = tc.trackStateContainer().dynamicColumnHandle<float>(
+      "residual"_hash);
+
+  for (unsigned int i = 0; i < 4; ++i) {
+    auto t = tc.makeTrack();
+    for (unsigned int j = 0; j <= i; ++j) {
+      // the handle stays valid while states are added
+      auto ts = t.appendTrackState();
+      residual(ts) = 0.5f * j;
+    }
+    hits(t) = i + 1;
+    odd[t.index()] = i % 2 == 1;
+  }
+  BOOST_CHECK_EQUAL(hits.size(), 4u);
+  BOOST_CHECK_EQUAL(residual.size(), 10u);
+
+  ConstProxyAccessor<float> caccResidual("residual");
+  auto cresidual = caccResidual.resolve(tc.trackStateContainer());
+  static_assert(std::is_same_v<decltype(cresidual(tc.getTrack(0))),
+                               const float&>);
+  for (auto t : tc) {
+    BOOST_CHECK_EQUAL(t.component<unsigned int>("hits"), hits(t));
+    BOOST_CHECK_EQUAL(t.component<bool>("odd"), odd(t));
+    for (auto ts : t.trackStatesReversed()) {
+      BOOST_CHECK_EQUAL(ts.component<float>("residual"), cresidual(ts));
+      BOOST_CHECK_EQUAL(&ts.component<float>("residual"), &residual(ts));
+    }
+  }
+
+  BOOST_CHECK_THROW(tc.container().dynamicColumnHandle<float>("hits"_hash),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(
+      tc.trackStateContainer().dynamicColumnHandle<float>("missing"_hash),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Footprint) {
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  tc.container().reserve(4);
+  for (int i = 0; i < 4; ++i) {
+    tc.makeTrack();
+  }
+  auto footprint = tc.container().footprint();
+  BOOST_CHECK_EQUAL(footprint.growthEvents, 0u);
+  BOOST_REQUIRE_EQUAL(footprint.columns.front().name, "tipIndex");
+  BOOST_CHECK_EQUAL(footprint.columns.front().size, 4u);
+  BOOST_CHECK_EQUAL(footprint.columns.front().bytes(), 4 * sizeof(IndexType));
+
+  tc.makeTrack();
+  BOOST_CHECK_EQUAL(tc.container().footprint().growthEvents, 1u);
+}
+
 BOOST_AUTO_TEST_CASE(AppendTrackState) {
   TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
   auto t = tc.makeTrack();
@@ -646,6 +706,148 @@ BOOST_AUTO_TEST_CASE(ForwardIteration) {
                                 act.end());
 }
 
+BOOST_AUTO_TEST_CASE(AppendContainers) {
+  auto fill = [](auto& tc, std::size_t nTracks) {
+    tc.template addColumn<std::size_t>("counter");
+    tc.trackStateContainer().template addColumn<float>("weight");
+    for (std::size_t i = 0; i < nTracks; i++) {
+      auto t = tc.makeTrack();
+      t.nMeasurements() = 3 + i;
+      t.template component<std::size_t>("counter") = 10 * i;
+      for (std::size_t j = 0; j < 3 + i; j++) {
+        auto ts = t.appendTrackState(TrackStatePropMask::Predicted);
+        ts.predicted().setRandom();
+        ts.template component<float>("weight") = i + 0.1f * j;
+      }
+    }
+  };
+
+  TrackContainer a{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  TrackContainer b{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  fill(a, 2);
+  fill(b, 3);
+
+  TrackContainer merged{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  merged.addColumn<std::size_t>("counter");
+  merged.trackStateContainer().addColumn<float>("weight");
+  // this column is missing in the inputs and gets default values
+  merged.addColumn<bool>("extra");
+
+  for (const auto* tc : {&a, &b}) {
+    IndexType stateOffset =
+        merged.trackStateContainer().append(tc->trackStateContainer());
+    IndexType trackOffset =
+        merged.container().append(tc->container(), stateOffset);
+    BOOST_CHECK_EQUAL(trackOffset + tc->size(), merged.size());
+  }
+  BOOST_CHECK_EQUAL(merged.size(), a.size() + b.size());
+
+  auto checkTrack = [](const auto& expected, const auto& actual) {
+    BOOST_CHECK_EQUAL(actual.nMeasurements(), expected.nMeasurements());
+    BOOST_CHECK_EQUAL(actual.template component<std::size_t>("counter"),
+                      expected.template component<std::size_t>("counter"));
+    BOOST_CHECK(!actual.template component<bool>("extra"));
+    BOOST_CHECK_EQUAL(actual.nTrackStates(), expected.nTrackStates());
+
+    std::vector<float> expectedWeights;
+    for (const auto& ts : expected.trackStatesReversed()) {
+      expectedWeights.push_back(ts.template component<float>("weight"));
+    }
+    std::vector<float> actualWeights;
+    auto it = expected.trackStatesReversed().begin();
+    for (const auto& ts : actual.trackStatesReversed()) {
+      actualWeights.push_back(ts.template component<float>("weight"));
+      BOOST_CHECK_EQUAL(ts.predicted(), (*it).predicted());
+      ++it;
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedWeights.begin(),
+                                  expectedWeights.end(), actualWeights.begin(),
+                                  actualWeights.end());
+  };
+
+  for (std::size_t i = 0; i < a.size(); i++) {
+    checkTrack(a.getTrack(i), merged.getTrack(i));
+  }
+  for (std::size_t i = 0; i < b.size(); i++) {
+    checkTrack(b.getTrack(i), merged.getTrack(a.size() + i));
+  }
+
+  // all dynamic columns of the input have to exist in the destination
+  TrackContainer plain{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  BOOST_CHECK_THROW(plain.trackStateContainer().append(a.trackStateContainer()),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(AppendSelectedTracks) {
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  tc.addColumn<std::size_t>("counter");
+  tc.trackStateContainer().addColumn<float>("weight");
+  for (std::size_t i = 0; i < 4; i++) {
+    auto t = tc.makeTrack();
+    t.nMeasurements() = i;
+    t.component<std::size_t>("counter") = 10 * i;
+    for (std::size_t j = 0; j < 2 + i; j++) {
+      auto ts = t.appendTrackState(TrackStatePropMask::Predicted |
+                                   TrackStatePropMask::Filtered);
+      ts.predicted().setRandom();
+      ts.filtered().setRandom();
+      ts.allocateCalibrated(2);
+      ts.calibrated<2>().setRandom();
+      ts.component<float>("weight") = i + 0.1f * j;
+    }
+    // share a component within the track
+    auto last = tc.trackStateContainer().getTrackState(t.tipIndex());
+    last.shareFrom(TrackStatePropMask::Predicted, TrackStatePropMask::Filtered);
+  }
+
+  std::vector<IndexType> itracks = {3, 1};
+  std::vector<IndexType> istates;
+  for (IndexType itrack : itracks) {
+    for (const auto& ts : tc.getTrack(itrack).trackStatesReversed()) {
+      istates.push_back(ts.index());
+    }
+  }
+
+  TrackContainer selected{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  selected.ensureDynamicColumns(tc);
+  selected.trackStateContainer().addColumn<float>("weight");
+  auto stateMap =
+      selected.trackStateContainer().append(tc.trackStateContainer(), istates);
+  selected.container().append(tc.container(), itracks, stateMap);
+
+  BOOST_CHECK_EQUAL(selected.size(), itracks.size());
+  BOOST_CHECK_EQUAL(selected.trackStateContainer().size(), istates.size());
+  for (std::size_t i = 0; i < itracks.size(); i++) {
+    auto expected = tc.getTrack(itracks[i]);
+    auto actual = selected.getTrack(i);
+    BOOST_CHECK_EQUAL(actual.nMeasurements(), expected.nMeasurements());
+    BOOST_CHECK_EQUAL(actual.component<std::size_t>("counter"),
+                      expected.component<std::size_t>("counter"));
+    BOOST_CHECK_EQUAL(actual.nTrackStates(), expected.nTrackStates());
+
+    auto it = expected.trackStatesReversed().begin();
+    for (const auto& ts : actual.trackStatesReversed()) {
+      auto ets = *it;
+      BOOST_CHECK_EQUAL(ts.component<float>("weight"),
+                        ets.component<float>("weight"));
+      BOOST_CHECK_EQUAL(ts.predicted(), ets.predicted());
+      BOOST_CHECK_EQUAL(ts.filtered(), ets.filtered());
+      BOOST_CHECK_EQUAL(ts.calibrated<2>(), ets.calibrated<2>());
+      ++it;
+    }
+    auto last = selected.trackStateContainer().getTrackState(actual.tipIndex());
+    BOOST_CHECK_EQUAL(last.predicted().data(), last.filtered().data());
+  }
+
+  // keep the track states of the source and only compact the tracks
+  VectorTrackContainer tracksOnly;
+  tracksOnly.addColumn_impl<std::size_t>("counter");
+  tracksOnly.append(tc.container(), itracks);
+  BOOST_CHECK_EQUAL(tracksOnly.size_impl(), 2u);
+  BOOST_CHECK_EQUAL(tracksOnly.m_tipIndex[0], tc.getTrack(3).tipIndex());
+  BOOST_CHECK_EQUAL(tracksOnly.m_tipIndex[1], tc.getTrack(1).tipIndex());
+}
+
 BOOST_AUTO_TEST_CASE(CalculateQuantities) {
   TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
   auto t = tc.makeTrack();
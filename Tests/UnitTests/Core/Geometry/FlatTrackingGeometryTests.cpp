@@ -0,0 +1,99 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/FlatTrackingGeometry.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <cstddef>
+#include <set>
+
+namespace Acts::Test {
+
+GeometryContext tgContext = GeometryContext();
+
+BOOST_AUTO_TEST_SUITE(Geometry)
+
+BOOST_AUTO_TEST_CASE(FlatTrackingGeometryLookup) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  FlatTrackingGeometry flat(tgContext, *tGeometry);
+
+  // every surface of the tracking geometry is found with its transform
+  // shared boundary surfaces are visited once per volume
+  std::set<const Surface*> surfaces;
+  tGeometry->visitSurfaces(
+      [&](const Surface* surface) { surfaces.insert(surface); }, false);
+  BOOST_CHECK_EQUAL(flat.surfaces().size(), surfaces.size());
+  BOOST_CHECK_EQUAL(flat.transforms().size(), flat.surfaces().size());
+  for (const auto& [id, surface] : tGeometry->geoIdSurfaceMap()) {
+    const auto* entry = flat.findSurface(id);
+    BOOST_REQUIRE_NE(entry, nullptr);
+    BOOST_CHECK_EQUAL(entry->surface, surface);
+    BOOST_CHECK_EQUAL(entry->type, surface->type());
+    BOOST_CHECK_EQUAL(entry->bounds, &surface->bounds());
+    BOOST_CHECK(flat.transform(*entry).isApprox(surface->transform(tgContext)));
+  }
+
+  // the volumes are found with their layer and surface ranges
+  std::size_t nVolumeSurfaces = 0;
+  std::size_t nVolumeLayers = 0;
+  tGeometry->visitVolumes([&](const TrackingVolume* volume) {
+    const auto* entry = flat.findVolume(volume->geometryId());
+    BOOST_REQUIRE_NE(entry, nullptr);
+    BOOST_CHECK_EQUAL(entry->volume, volume);
+    BOOST_CHECK_EQUAL(tGeometry->findVolume(volume->geometryId()), volume);
+    for (std::size_t i = entry->surfaces.begin; i < entry->surfaces.end; ++i) {
+      BOOST_CHECK_EQUAL(flat.surfaces()[i].geometryId.volume(),
+                        volume->geometryId().volume());
+    }
+    nVolumeSurfaces += entry->surfaces.size();
+    nVolumeLayers += entry->layers.size();
+  });
+  BOOST_CHECK_EQUAL(nVolumeSurfaces, flat.surfaces().size());
+  BOOST_CHECK_EQUAL(nVolumeLayers, flat.layers().size());
+
+  // the surfaces of a layer are consecutive and contain the sensitives
+  std::size_t nSensitives = 0;
+  for (const auto& layer : flat.layers()) {
+    BOOST_CHECK_EQUAL(flat.findLayer(layer.geometryId), &layer);
+    BOOST_CHECK(!layer.surfaces.empty());
+    for (std::size_t i = layer.surfaces.begin; i < layer.surfaces.end; ++i) {
+      const GeometryIdentifier id = flat.surfaces()[i].geometryId;
+      BOOST_CHECK_EQUAL(id.volume(), layer.geometryId.volume());
+      BOOST_CHECK_EQUAL(id.layer(), layer.geometryId.layer());
+      BOOST_CHECK_EQUAL(id.boundary(), 0u);
+      if (id.sensitive() != 0) {
+        ++nSensitives;
+      }
+    }
+  }
+  std::size_t nExpectedSensitives = 0;
+  tGeometry->visitSurfaces([&](const Surface* /*surface*/) {
+    ++nExpectedSensitives;
+  });
+  BOOST_CHECK_GT(nSensitives, 0u);
+  BOOST_CHECK_EQUAL(nSensitives, nExpectedSensitives);
+
+  // unknown identifiers
+  const GeometryIdentifier unknown = GeometryIdentifier().setVolume(250);
+  BOOST_CHECK_EQUAL(flat.findVolume(unknown), nullptr);
+  BOOST_CHECK_EQUAL(flat.findLayer(unknown), nullptr);
+  BOOST_CHECK_EQUAL(flat.findSurface(unknown), nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
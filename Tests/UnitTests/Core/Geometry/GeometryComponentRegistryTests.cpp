@@ -0,0 +1,103 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryComponentRegistry.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Surfaces/ConvexPolygonBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Acts {
+
+using namespace UnitLiterals;
+
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Geometry)
+
+BOOST_AUTO_TEST_CASE(GeometryComponentRegistryBounds) {
+  GeometryComponentRegistry registry;
+
+  auto rectangle = registry.makeBounds<RectangleBounds>(10_mm, 20_mm);
+  auto sameRectangle = registry.shareBounds(
+      std::make_shared<const RectangleBounds>(10_mm, 20_mm));
+  auto otherRectangle = registry.makeBounds<RectangleBounds>(10_mm, 21_mm);
+  BOOST_CHECK_EQUAL(rectangle, sameRectangle);
+  BOOST_CHECK_NE(rectangle, otherRectangle);
+
+  // Same values, but different bounds types
+  auto trapezoid = registry.makeBounds<TrapezoidBounds>(10_mm, 10_mm, 20_mm);
+  BOOST_CHECK_EQUAL(registry.makeBounds<TrapezoidBounds>(10_mm, 10_mm, 20_mm),
+                    trapezoid);
+  std::vector<Vector2> vertices = {
+      {0., 0.}, {1_mm, 0.}, {1_mm, 1_mm}, {0., 1_mm}};
+  auto quad = registry.makeBounds<ConvexPolygonBounds<4>>(vertices);
+  auto polygon =
+      registry.makeBounds<ConvexPolygonBounds<PolygonDynamic>>(vertices);
+  BOOST_CHECK_NE(std::static_pointer_cast<const SurfaceBounds>(quad),
+                 std::static_pointer_cast<const SurfaceBounds>(polygon));
+  BOOST_CHECK_EQUAL(registry.numberOfBounds(), 5u);
+
+  std::shared_ptr<const RectangleBounds> none = nullptr;
+  BOOST_CHECK_EQUAL(registry.shareBounds(none), nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(GeometryComponentRegistryMaterial) {
+  GeometryComponentRegistry registry;
+
+  MaterialSlab silicon(makeSilicon(), 0.15_mm);
+  auto material = registry.makeHomogeneousMaterial(silicon);
+  BOOST_CHECK_EQUAL(registry.makeHomogeneousMaterial(silicon), material);
+  BOOST_CHECK_EQUAL(material->materialSlab(Vector2(0., 0.)), silicon);
+  BOOST_CHECK_NE(registry.makeHomogeneousMaterial(silicon, 0.5), material);
+  BOOST_CHECK_NE(registry.makeHomogeneousMaterial(
+                     MaterialSlab(makeSilicon(), 0.3_mm)),
+                 material);
+  BOOST_CHECK_NE(registry.makeHomogeneousMaterial(
+                     MaterialSlab(makeBeryllium(), 0.15_mm)),
+                 material);
+  BOOST_CHECK_EQUAL(registry.numberOfMaterials(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(GeometryComponentRegistryThreads) {
+  GeometryComponentRegistry registry;
+
+  // Several threads registering the same modules end up with one object
+  const std::size_t nThreads = 4;
+  std::vector<std::shared_ptr<const RectangleBounds>> bounds(nThreads);
+  std::vector<std::thread> threads;
+  for (std::size_t it = 0; it < nThreads; ++it) {
+    threads.emplace_back([&registry, &bounds, it]() {
+      for (int ib = 0; ib < 100; ++ib) {
+        bounds[it] = registry.makeBounds<RectangleBounds>(5_mm, 5_mm);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& b : bounds) {
+    BOOST_CHECK_EQUAL(b, bounds.front());
+  }
+  BOOST_CHECK_EQUAL(registry.numberOfBounds(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+
+}  // namespace Acts
@@ -11,7 +11,9 @@
 #include "Acts/Geometry/GeometryHierarchyMap.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 
+#include <algorithm>
 #include <iterator>
+#include <random>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -194,4 +196,91 @@ BOOST_AUTO_TEST_CASE(FindWithGlobalDefault) {
   CHECK_ENTRY(c, makeId(5), makeId());
 }
 
+BOOST_AUTO_TEST_CASE(FindDirectLookup) {
+  // random hierarchy with boundary and approach levels in use as well
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> level(0, 4);
+  auto randomId = [&]() {
+    return GeometryIdentifier()
+        .setVolume(level(rng))
+        .setBoundary(level(rng) / 3)
+        .setLayer(level(rng))
+        .setApproach(level(rng) / 3)
+        .setSensitive(level(rng));
+  };
+  std::vector<std::pair<GeometryIdentifier, Thing>> elements;
+  for (int i = 0; i < 100; ++i) {
+    // only leading levels are set for part of the elements
+    auto id = randomId();
+    switch (i % 4) {
+      case 0:
+        id.setSensitive(0u).setApproach(0u);
+        break;
+      case 1:
+        id.setSensitive(0u).setApproach(0u).setLayer(0u);
+        break;
+      default:
+        break;
+    }
+    auto found = std::find_if(elements.begin(), elements.end(),
+                              [&](const auto& e) { return e.first == id; });
+    if (found == elements.end()) {
+      elements.emplace_back(id, Thing{static_cast<double>(i)});
+    }
+  }
+  Container c(elements);
+  BOOST_CHECK(c.hasDirectLookup());
+
+  // reference: the matching element with the most leading levels
+  auto depth = [](GeometryIdentifier id) {
+    if (id.sensitive() != 0u) {
+      return 5;
+    } else if (id.approach() != 0u) {
+      return 4;
+    } else if (id.layer() != 0u) {
+      return 3;
+    } else if (id.boundary() != 0u) {
+      return 2;
+    }
+    return id.volume() != 0u ? 1 : 0;
+  };
+  auto matches = [&](GeometryIdentifier stored, GeometryIdentifier query) {
+    const int d = depth(stored);
+    return (d < 1 || stored.volume() == query.volume()) &&
+           (d < 2 || stored.boundary() == query.boundary()) &&
+           (d < 3 || stored.layer() == query.layer()) &&
+           (d < 4 || stored.approach() == query.approach()) &&
+           (d < 5 || stored.sensitive() == query.sensitive());
+  };
+  for (int i = 0; i < 1000; ++i) {
+    auto query = randomId();
+    const std::pair<GeometryIdentifier, Thing>* expected = nullptr;
+    for (const auto& e : elements) {
+      if (matches(e.first, query) &&
+          (expected == nullptr || depth(expected->first) < depth(e.first))) {
+        expected = &e;
+      }
+    }
+    if (expected == nullptr) {
+      BOOST_CHECK_EQUAL(c.find(query), c.end());
+    } else {
+      CHECK_ENTRY(c, query, expected->first);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FindWithoutDirectLookup) {
+  // elements that only differ in the extra level use the binary search
+  Container c = {
+      {makeId(2), {2.0}},
+      {makeId(2, 3, 4).setExtra(1u), {3.0}},
+      {makeId(2, 3, 4).setExtra(2u), {4.0}},
+  };
+  BOOST_CHECK(!c.hasDirectLookup());
+
+  CHECK_ENTRY(c, makeId(2, 3, 4).setExtra(2u), makeId(2, 3, 4).setExtra(2u));
+  CHECK_ENTRY(c, makeId(2, 3, 5), makeId(2));
+  BOOST_CHECK_EQUAL(c.find(makeId(3)), c.end());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,7 @@
 #include "Acts/Geometry/CylinderVolumeBuilder.hpp"
 #include "Acts/Geometry/CylinderVolumeHelper.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Geometry/LayerArrayCreator.hpp"
 #include "Acts/Geometry/LayerCreator.hpp"
 #include "Acts/Geometry/PassiveLayerBuilder.hpp"
@@ -19,8 +20,11 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingGeometryBuilder.hpp"
 #include "Acts/Geometry/TrackingVolumeArrayCreator.hpp"
+#include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
@@ -120,4 +124,85 @@ BOOST_AUTO_TEST_CASE(SimpleGeometryTest) {
 
   BOOST_CHECK(tGeometry != nullptr);
 }
+
+/// @brief Unit test for building the layers of a volume concurrently
+///
+/// The geometry identifiers and placements have to agree with the serial
+/// build
+BOOST_AUTO_TEST_CASE(ConcurrentLayerBuildingTest) {
+  auto buildGeometry = [](bool concurrently) {
+    LayerArrayCreator::Config lacConfig;
+    auto layerArrayCreator = std::make_shared<const LayerArrayCreator>(
+        lacConfig, getDefaultLogger("LayerArrayCreator", Logging::INFO));
+    TrackingVolumeArrayCreator::Config tvacConfig;
+    auto tVolumeArrayCreator =
+        std::make_shared<const TrackingVolumeArrayCreator>(
+            tvacConfig,
+            getDefaultLogger("TrackingVolumeArrayCreator", Logging::INFO));
+    CylinderVolumeHelper::Config cvhConfig;
+    cvhConfig.layerArrayCreator = layerArrayCreator;
+    cvhConfig.trackingVolumeArrayCreator = tVolumeArrayCreator;
+    auto cylinderVolumeHelper = std::make_shared<const CylinderVolumeHelper>(
+        cvhConfig, getDefaultLogger("CylinderVolumeHelper", Logging::INFO));
+
+    PassiveLayerBuilder::Config layerBuilderConfig;
+    layerBuilderConfig.layerIdentification = "Tracker";
+    layerBuilderConfig.centralLayerRadii = {10_mm, 20_mm, 30_mm};
+    layerBuilderConfig.centralLayerHalflengthZ = {40_mm, 40_mm, 40_mm};
+    layerBuilderConfig.centralLayerThickness = {1_mm, 1_mm, 1_mm};
+    layerBuilderConfig.posnegLayerPositionZ = {60_mm, 80_mm};
+    layerBuilderConfig.posnegLayerRmin = {5_mm, 5_mm};
+    layerBuilderConfig.posnegLayerRmax = {30_mm, 30_mm};
+    layerBuilderConfig.posnegLayerThickness = {1_mm, 1_mm};
+    auto layerBuilder = std::make_shared<const PassiveLayerBuilder>(
+        layerBuilderConfig, getDefaultLogger("TrackerBuilder", Logging::INFO));
+
+    CylinderVolumeBuilder::Config cvbConfig;
+    cvbConfig.trackingVolumeHelper = cylinderVolumeHelper;
+    cvbConfig.volumeName = "Tracker";
+    cvbConfig.layerBuilder = layerBuilder;
+    cvbConfig.layerEnvelopeR = {1_mm, 1_mm};
+    cvbConfig.buildToRadiusZero = true;
+    cvbConfig.buildLayersConcurrently = concurrently;
+    auto volumeBuilder = std::make_shared<const CylinderVolumeBuilder>(
+        cvbConfig, getDefaultLogger("TrackerVolumeBuilder", Logging::INFO));
+
+    TrackingGeometryBuilder::Config tgbConfig;
+    tgbConfig.trackingVolumeBuilders.push_back(
+        [=](const auto& context, const auto& inner, const auto&) {
+          return volumeBuilder->trackingVolume(context, inner);
+        });
+    tgbConfig.trackingVolumeHelper = cylinderVolumeHelper;
+    TrackingGeometryBuilder tgBuilder(tgbConfig);
+    return tgBuilder.trackingGeometry(tgContext);
+  };
+
+  auto collect = [](const TrackingGeometry& tGeometry) {
+    std::vector<std::pair<GeometryIdentifier, Vector3>> surfaces;
+    tGeometry.visitSurfaces(
+        [&](const Surface* surface) {
+          surfaces.emplace_back(surface->geometryId(),
+                                surface->center(tgContext));
+        },
+        false);
+    return surfaces;
+  };
+
+  auto serial = buildGeometry(false);
+  setMaxThreads(3);
+  auto concurrent = buildGeometry(true);
+  setMaxThreads(1);
+  BOOST_REQUIRE(serial != nullptr);
+  BOOST_REQUIRE(concurrent != nullptr);
+
+  auto serialSurfaces = collect(*serial);
+  auto concurrentSurfaces = collect(*concurrent);
+  BOOST_REQUIRE_EQUAL(serialSurfaces.size(), concurrentSurfaces.size());
+  for (std::size_t i = 0; i < serialSurfaces.size(); ++i) {
+    BOOST_CHECK_EQUAL(serialSurfaces[i].first, concurrentSurfaces[i].first);
+    BOOST_CHECK(
+        serialSurfaces[i].second.isApprox(concurrentSurfaces[i].second));
+  }
+}
+
 }  // namespace Acts::Test
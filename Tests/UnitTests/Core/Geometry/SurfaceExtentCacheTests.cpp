@@ -0,0 +1,107 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Polyhedron.hpp"
+#include "Acts/Geometry/SurfaceBinningMatcher.hpp"
+#include "Acts/Geometry/SurfaceExtentCache.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Acts::Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+BOOST_AUTO_TEST_SUITE(Geometry)
+
+BOOST_AUTO_TEST_CASE(SurfaceExtentCacheFill) {
+  auto bounds = std::make_shared<RectangleBounds>(2., 5.);
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  for (std::size_t i = 0; i < 50; ++i) {
+    double phi = 2 * M_PI * i / 50.;
+    Transform3 transform = Transform3::Identity();
+    transform.translate(Vector3(30. * std::cos(phi), 30. * std::sin(phi), i));
+    transform.rotate(AngleAxis3(phi, Vector3::UnitZ()));
+    surfaces.push_back(Surface::makeShared<PlaneSurface>(transform, bounds));
+  }
+  std::vector<const Surface*> surfacesRaw = unpack_shared_vector(surfaces);
+
+  SurfaceExtentCache cache;
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+  // The cached and the directly computed extents agree
+  const Extent& first = cache.extent(tgContext, *surfacesRaw.front());
+  BOOST_CHECK(first ==
+              surfacesRaw.front()->polyhedronRepresentation(tgContext, 1)
+                  .extent());
+  BOOST_CHECK_EQUAL(&first, &cache.extent(tgContext, *surfacesRaw.front()));
+  BOOST_CHECK_EQUAL(cache.size(), 1u);
+
+  // Filling on several threads only adds the missing surfaces
+  setMaxThreads(4);
+  cache.fill(tgContext, surfacesRaw);
+  setMaxThreads(1);
+  BOOST_CHECK_EQUAL(cache.size(), surfacesRaw.size());
+  BOOST_CHECK_EQUAL(&first, &cache.extent(tgContext, *surfacesRaw.front()));
+  for (const Surface* surface : surfacesRaw) {
+    BOOST_CHECK(cache.extent(tgContext, *surface) ==
+                SurfaceExtentCache::compute(tgContext, *surface));
+  }
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(SurfaceExtentCacheMatcher) {
+  auto identity = Transform3::Identity();
+
+  auto oneSurface = Surface::makeShared<DiscSurface>(
+      identity, std::make_shared<RadialBounds>(5., 10., M_PI / 16, 0.));
+  auto otherSurface = Surface::makeShared<DiscSurface>(
+      identity, std::make_shared<RadialBounds>(20., 40., M_PI / 16, 0.));
+  auto similarSurface = Surface::makeShared<DiscSurface>(
+      identity,
+      std::make_shared<RadialBounds>(4.95, 10.25, M_PI / 16, 0.5 * M_PI));
+
+  std::vector<SurfaceBinningMatcher::Range> tolerances(
+      static_cast<std::size_t>(binValues), {0., 0.});
+  tolerances[binR] = {0.1, 0.5};
+  SurfaceBinningMatcher matcher(tolerances);
+  auto cache = std::make_shared<SurfaceExtentCache>();
+  SurfaceBinningMatcher cachedMatcher(tolerances, cache);
+
+  // Repeated checks give the same result as without the cache
+  for (std::size_t i = 0; i < 2; ++i) {
+    BOOST_CHECK(!cachedMatcher(tgContext, binR, oneSurface.get(),
+                               otherSurface.get()));
+    BOOST_CHECK(cachedMatcher(tgContext, binR, oneSurface.get(),
+                              similarSurface.get()));
+  }
+  BOOST_CHECK(!matcher(tgContext, binR, oneSurface.get(), otherSurface.get()));
+  BOOST_CHECK(matcher(tgContext, binR, oneSurface.get(), similarSurface.get()));
+  BOOST_CHECK_EQUAL(cache->size(), 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
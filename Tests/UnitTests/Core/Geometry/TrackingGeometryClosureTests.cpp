@@ -20,6 +20,7 @@
 #include "Acts/Surfaces/SurfaceArray.hpp"
 #include "Acts/Utilities/BinnedArray.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <unordered_map>
@@ -320,4 +321,47 @@ BOOST_AUTO_TEST_CASE(TrackingGeometry_testVisitSurfaces) {
   BOOST_CHECK_EQUAL(nVolumes, 5u);
 }
 
+BOOST_AUTO_TEST_CASE(TrackingGeometry_testFindSurfaceAndVolume) {
+  auto hookImpl = [](GeometryIdentifier orig, const Surface& /*srf*/) {
+    return orig.setExtra(orig.sensitive());
+  };
+  CallableHook<decltype(hookImpl)> extraHook{hookImpl};
+
+  for (const GeometryIdentifierHook* hook :
+       {static_cast<const GeometryIdentifierHook*>(nullptr),
+        static_cast<const GeometryIdentifierHook*>(&extraHook)}) {
+    TrackingGeometry tGeometry = makeTrackingGeometry(
+        hook != nullptr ? *hook : GeometryIdentifierHook{});
+
+    // every surface is found through the dense lookup
+    for (const auto& [id, surface] : tGeometry.geoIdSurfaceMap()) {
+      BOOST_CHECK_EQUAL(tGeometry.findSurface(id), surface);
+    }
+    const auto& [sensitiveId, sensitive] = *std::find_if(
+        tGeometry.geoIdSurfaceMap().begin(), tGeometry.geoIdSurfaceMap().end(),
+        [](const auto& entry) { return entry.first.sensitive() != 0u; });
+    // higher hierarchy levels or other extra values are not a match
+    BOOST_CHECK_EQUAL(
+        tGeometry.findSurface(GeometryIdentifier(sensitiveId).setExtra(99u)),
+        nullptr);
+    BOOST_CHECK_EQUAL(tGeometry.findSurface(
+                          GeometryIdentifier(sensitiveId).setSensitive(99u)),
+                      nullptr);
+    BOOST_CHECK_NE(sensitive, nullptr);
+
+    // volumes are found by their identifier only
+    for (GeometryIdentifier::Value vol = 1; vol <= 5; ++vol) {
+      const auto* volume =
+          tGeometry.findVolume(GeometryIdentifier().setVolume(vol));
+      BOOST_REQUIRE_NE(volume, nullptr);
+      BOOST_CHECK_EQUAL(volume->geometryId().volume(), vol);
+    }
+    BOOST_CHECK_EQUAL(tGeometry.findVolume(GeometryIdentifier().setVolume(6)),
+                      nullptr);
+    BOOST_CHECK_EQUAL(
+        tGeometry.findVolume(GeometryIdentifier().setVolume(2).setLayer(2)),
+        nullptr);
+  }
+}
+
 }  //  namespace Acts::Test
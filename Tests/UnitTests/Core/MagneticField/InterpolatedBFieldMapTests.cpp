@@ -23,6 +23,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <tuple>
 #include <utility>
@@ -167,4 +168,63 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(c.isInside(transformPos((pos << 0, 2, -4.7).finished())));
   BOOST_CHECK(!c.isInside(transformPos((pos << 5, 2, 14.).finished())));
 }
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_getFields) {
+  // map (x,y,z) -> (r,z)
+  auto transformPos = [](const Vector3& pos) {
+    return Vector2(perp(pos), pos.z());
+  };
+
+  // map (Br,Bz) -> (Bx,By,Bz), which depends on the position
+  auto transformBField = [](const Vector2& field, const Vector3& pos) {
+    double r = perp(pos);
+    double cosPhi = r > 0 ? pos.x() / r : 1.;
+    double sinPhi = r > 0 ? pos.y() / r : 0.;
+    return Vector3(field[0] * cosPhi, field[0] * sinPhi, field[1]);
+  };
+
+  detail::EquidistantAxis r(0.0, 4.0, 4u);
+  detail::EquidistantAxis z(-5, 7, 6u);
+
+  using Grid_t =
+      Grid<Vector2, detail::EquidistantAxis, detail::EquidistantAxis>;
+  using BField_t = InterpolatedBFieldMap<Grid_t>;
+
+  Grid_t g(std::make_tuple(std::move(r), std::move(z)));
+  for (std::size_t i = 0; i < g.size(); ++i) {
+    g.at(i) = Vector2(0.1 * i, 1. - 0.05 * i);
+  }
+  BField_t b{{transformPos, transformBField, std::move(g)}};
+
+  // a scan along z through a few cells, and positions outside of the grid
+  std::vector<Vector3> positions;
+  for (int iz = -12; iz <= 16; ++iz) {
+    positions.emplace_back(1.1, 0.7, 0.5 * iz);
+  }
+  positions.emplace_back(-2.5, 1., 3.3);
+  positions.emplace_back(10., 0., 0.);
+  positions.emplace_back(0.3, -0.2, -4.9);
+
+  std::vector<Vector3> fields(positions.size());
+  std::unique_ptr<bool[]> inside(new bool[positions.size()]);
+  std::size_t nInside = static_cast<const InterpolatedMagneticField&>(b)
+                            .getFields(positions.data(), positions.size(),
+                                       fields.data(), inside.get());
+
+  std::size_t nExpected = 0;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    auto field = b.getField(positions[i]);
+    BOOST_CHECK_EQUAL(inside[i], field.ok());
+    if (field.ok()) {
+      ++nExpected;
+      BOOST_CHECK_EQUAL(fields[i], *field);
+    } else {
+      BOOST_CHECK_EQUAL(fields[i], Vector3::Zero());
+    }
+  }
+  BOOST_CHECK_EQUAL(nInside, nExpected);
+  BOOST_CHECK_LT(nInside, positions.size());
+  BOOST_CHECK_EQUAL(
+      b.getFields(positions.data(), positions.size(), fields.data()), nInside);
+}
 }  // namespace Acts::Test
@@ -0,0 +1,125 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/MappedFieldMap.hpp"
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string tempPath(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+}  // namespace
+
+namespace Acts::Test {
+
+BOOST_AUTO_TEST_CASE(MappedFieldMap_round_trip) {
+  std::vector<double> xPos = {0., 1., 2., 3.};
+  std::vector<double> yPos = {0., 0.5, 1., 1.5, 2.};
+  std::vector<double> zPos = {0., 2., 4.};
+
+  auto localToGlobalBin_rz = [](std::array<std::size_t, 2> binsRZ,
+                                std::array<std::size_t, 2> nBinsRZ) {
+    return (binsRZ.at(1) * nBinsRZ.at(0) + binsRZ.at(0));
+  };
+  auto localToGlobalBin_xyz = [](std::array<std::size_t, 3> binsXYZ,
+                                 std::array<std::size_t, 3> nBinsXYZ) {
+    return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+            binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+  };
+
+  std::vector<Vector2> bField_rz;
+  for (std::size_t i = 0; i < xPos.size() * zPos.size(); i++) {
+    bField_rz.push_back(Vector2(0.1 * i, 2. - 0.3 * i));
+  }
+  std::vector<Vector3> bField_xyz;
+  for (std::size_t i = 0; i < xPos.size() * yPos.size() * zPos.size(); i++) {
+    bField_xyz.push_back(Vector3(0.1 * i, -0.2 * i, 1. + 0.05 * i));
+  }
+  auto map_rz =
+      fieldMapRZ(localToGlobalBin_rz, xPos, zPos, bField_rz, 1, 1, true);
+  auto map_xyz = fieldMapXYZ(localToGlobalBin_xyz, xPos, yPos, zPos,
+                             bField_xyz, 1, 1, true);
+
+  const std::string path_rz = tempPath("MappedFieldMapRoundTripRZ.bfield");
+  const std::string path_xyz = tempPath("MappedFieldMapRoundTripXYZ.bfield");
+  {
+    std::ofstream os_rz(path_rz, std::ios::binary);
+    writeMappedFieldMap(os_rz, map_rz);
+    std::ofstream os_xyz(path_xyz, std::ios::binary);
+    writeMappedFieldMap(os_xyz, map_xyz);
+  }
+
+  auto mapped_rz = readMappedFieldMap(path_rz);
+  auto mapped_xyz = readMappedFieldMap(path_xyz);
+  BOOST_REQUIRE(dynamic_cast<const MappedFieldMapRZ*>(mapped_rz.get()) !=
+                nullptr);
+  BOOST_REQUIRE(dynamic_cast<const MappedFieldMapXYZ*>(mapped_xyz.get()) !=
+                nullptr);
+  BOOST_CHECK(mapped_rz->getNBins() == map_rz.getNBins());
+  BOOST_CHECK(mapped_rz->getMin() == map_rz.getMin());
+  BOOST_CHECK(mapped_rz->getMax() == map_rz.getMax());
+  BOOST_CHECK(mapped_xyz->getNBins() == map_xyz.getNBins());
+  BOOST_CHECK(mapped_xyz->getMin() == map_xyz.getMin());
+  BOOST_CHECK(mapped_xyz->getMax() == map_xyz.getMax());
+
+  // the same values are interpolated in the same way
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+  for (int i = 0; i < 100; ++i) {
+    Vector3 pos(dist(rng) * 2.9, dist(rng) * 1.9, dist(rng) * 3.9);
+
+    BOOST_CHECK_EQUAL(map_xyz.isInside(pos), mapped_xyz->isInside(pos));
+    if (map_xyz.isInside(pos)) {
+      BOOST_CHECK_EQUAL(map_xyz.getField(pos).value(),
+                        mapped_xyz->getFieldUnchecked(pos));
+    }
+    Vector3 posRZ(pos.x() * 0.7, pos.y() * 0.7, pos.z());
+    BOOST_CHECK_EQUAL(map_rz.isInside(posRZ), mapped_rz->isInside(posRZ));
+    if (map_rz.isInside(posRZ)) {
+      BOOST_CHECK_EQUAL(map_rz.getField(posRZ).value(),
+                        mapped_rz->getFieldUnchecked(posRZ));
+    }
+  }
+
+  // the typed maps check the dimensions of the file
+  auto file_rz = std::make_shared<const MappedFieldMapFile>(path_rz);
+  BOOST_CHECK_THROW(mappedFieldMapXYZ(file_rz), std::invalid_argument);
+
+  std::filesystem::remove(path_rz);
+  std::filesystem::remove(path_xyz);
+}
+
+BOOST_AUTO_TEST_CASE(MappedFieldMap_errors) {
+  BOOST_CHECK_THROW(MappedFieldMapFile(tempPath("MappedFieldMapMissing")),
+                    std::runtime_error);
+
+  const std::string path = tempPath("MappedFieldMapInvalid.bfield");
+  {
+    std::ofstream invalid(path, std::ios::binary);
+    invalid << std::string(512, 'x');
+  }
+  BOOST_CHECK_THROW(MappedFieldMapFile{path}, std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+}  // namespace Acts::Test
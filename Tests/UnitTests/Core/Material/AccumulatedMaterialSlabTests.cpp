@@ -14,8 +14,10 @@
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
 
+#include <cstddef>
 #include <limits>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -198,4 +200,49 @@ BOOST_AUTO_TEST_CASE(MultipleDifferentTracks) {
   }
 }
 
+// merging accumulators of parts of the tracks is the same as averaging all
+BOOST_AUTO_TEST_CASE(MergeParts) {
+  MaterialSlab unit = makeUnitSlab();
+  MaterialSlab vac(2 * unit.thickness());
+  MaterialSlab silicon(makeSilicon(), 0.5 * unit.thickness());
+  std::vector<std::vector<MaterialSlab>> tracks = {
+      {unit}, {unit, unit}, {vac}, {silicon, unit}, {silicon}};
+
+  AccumulatedMaterialSlab all;
+  AccumulatedMaterialSlab first;
+  AccumulatedMaterialSlab second;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    AccumulatedMaterialSlab& part = i < 2 ? first : second;
+    for (const auto& slab : tracks[i]) {
+      all.accumulate(slab, 1.2);
+      part.accumulate(slab, 1.2);
+    }
+    all.trackVariance(unit);
+    all.trackAverage();
+    part.trackVariance(unit);
+    part.trackAverage();
+  }
+
+  // merging an empty accumulator does not change anything
+  AccumulatedMaterialSlab empty;
+  empty.merge(first);
+  first.merge(AccumulatedMaterialSlab());
+  BOOST_CHECK_EQUAL(empty.totalAverage().second, 2u);
+  BOOST_CHECK_EQUAL(empty.totalAverage().first.material(),
+                    first.totalAverage().first.material());
+
+  first.merge(second);
+  auto [average, trackCount] = first.totalAverage();
+  auto [expected, expectedCount] = all.totalAverage();
+  BOOST_CHECK_EQUAL(trackCount, expectedCount);
+  CHECK_CLOSE_REL(average.thickness(), expected.thickness(), 8 * eps);
+  CHECK_CLOSE_REL(average.material().X0(), expected.material().X0(), 8 * eps);
+  CHECK_CLOSE_REL(average.material().L0(), expected.material().L0(), 8 * eps);
+  CHECK_CLOSE_REL(average.material().Ar(), expected.material().Ar(), 8 * eps);
+  CHECK_CLOSE_REL(average.material().Z(), expected.material().Z(), 8 * eps);
+  CHECK_CLOSE_REL(average.material().molarDensity(),
+                  expected.material().molarDensity(), 8 * eps);
+  BOOST_CHECK_EQUAL(first.totalVariance().second, expectedCount);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
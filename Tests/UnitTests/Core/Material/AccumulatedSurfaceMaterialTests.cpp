@@ -13,12 +13,14 @@
 #include "Acts/Material/AccumulatedSurfaceMaterial.hpp"
 #include "Acts/Material/Material.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 namespace Acts::Test {
@@ -185,4 +187,37 @@ BOOST_AUTO_TEST_CASE(AccumulatedSurfaceMaterial_variance_0D) {
   BOOST_CHECK_EQUAL(trackCount, 2u);
 }
 
+/// Test the merging of materials accumulated separately
+BOOST_AUTO_TEST_CASE(AccumulatedSurfaceMaterial_merge) {
+  Material mat = Material::fromMolarDensity(1., 1., 1., 1., 1.);
+  MaterialSlab one(mat, 1.);
+  MaterialSlab two(mat, 2.);
+
+  BinUtility binUtility1D(2, -1., 1., open, binX);
+  AccumulatedSurfaceMaterial material1D{binUtility1D};
+  AccumulatedSurfaceMaterial other1D{binUtility1D};
+  const std::vector<std::array<std::size_t, 3>> bin;
+
+  material1D.accumulate(Vector2{-0.5, 0.}, one);
+  material1D.trackVariance(bin, one);
+  material1D.trackAverage();
+  other1D.accumulate(Vector2{-0.5, 0.}, two);
+  other1D.accumulate(Vector2{0.5, 0.}, two);
+  other1D.trackVariance(bin, one);
+  other1D.trackAverage();
+  material1D.merge(other1D);
+
+  const auto& accMat1D = material1D.accumulatedMaterial();
+  auto [matProp0, trackCount0] = accMat1D[0][0].totalAverage();
+  auto [matProp1, trackCount1] = accMat1D[0][1].totalAverage();
+  BOOST_CHECK_EQUAL(trackCount0, 2u);
+  BOOST_CHECK_EQUAL(trackCount1, 1u);
+  CHECK_CLOSE_REL(matProp0.thickness(), 1.5, 1e-6);
+  CHECK_CLOSE_REL(matProp1.thickness(), 2., 1e-6);
+
+  // the binnings have to match
+  AccumulatedSurfaceMaterial material0D{};
+  BOOST_CHECK_THROW(material0D.merge(other1D), std::invalid_argument);
+}
+
 }  // namespace Acts::Test
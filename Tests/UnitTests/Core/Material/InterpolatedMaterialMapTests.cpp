@@ -164,4 +164,29 @@ BOOST_AUTO_TEST_CASE(InterpolatedMaterialMap_test) {
   BOOST_CHECK_EQUAL(ipolMatMap.isInside(Vector3(0., 4., 0.)), false);
   BOOST_CHECK_EQUAL(ipolMatMap.isInside(Vector3(0., 0., 4.)), true);
 }
+
+BOOST_AUTO_TEST_CASE(InterpolatedMaterialMap_cache_test) {
+  detail::EquidistantAxis axisX(0, 3, 4);
+  detail::EquidistantAxis axisY(0, 3, 4);
+
+  // A material grid with different values in every bin
+  auto grid = grid_t(std::make_tuple(std::move(axisX), std::move(axisY)));
+  for (std::size_t i = 0; i < grid.size(); i++) {
+    Acts::Material::ParametersVector mat;
+    mat << 1. + i, 2. + i, 3. + 0.5 * i, 4. + 0.5 * i, 5. + 2. * i;
+    grid.at(i) = mat;
+  }
+  InterpolatedMaterialMap ipolMatMap(
+      MaterialMapper<grid_t>(trafoGlobalToLocal, grid));
+
+  // Step through the map, crossing cells, with and without cache
+  InterpolatedMaterialMap<MaterialMapper<grid_t>>::Cache cache;
+  for (double s = 0.; s < 2.9; s += 0.05) {
+    const Vector3 position(s, 0.3 + 0.8 * s, 1.);
+    CHECK_CLOSE_REL(ipolMatMap.getMaterial(position, cache),
+                    ipolMatMap.getMaterial(position), 1e-6);
+  }
+  BOOST_CHECK(cache.initialized);
+}
+
 }  // namespace Acts::Test
@@ -19,8 +19,10 @@
 #include "Acts/Material/IntersectionMaterialAssigner.hpp"
 #include "Acts/Navigation/InternalNavigation.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
 #include "Acts/Utilities/Enumerate.hpp"
 
+#include <cmath>
 #include <limits>
 
 namespace Acts::Test {
@@ -51,6 +53,47 @@ BOOST_AUTO_TEST_CASE(FindSurfaceIntersections) {
   BOOST_CHECK_EQUAL(volumeCandidates.size(), 0u);
 }
 
+BOOST_AUTO_TEST_CASE(FindSurfaceIntersectionsWithBoundingBoxes) {
+  // Create cylinders and discs of a barrel and endcap like setup
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  for (double r : {30.0, 70.0, 120.0, 180.0}) {
+    surfaces.push_back(Surface::makeShared<CylinderSurface>(
+        Transform3::Identity(), r, 400.0));
+  }
+  for (double z : {-900.0, -600.0, 600.0, 900.0}) {
+    surfaces.push_back(Surface::makeShared<DiscSurface>(
+        Transform3(Translation3(0., 0., z)), 40.0, 200.0));
+  }
+
+  IntersectionMaterialAssigner::Config imCfg;
+  for (const auto &surface : surfaces) {
+    imCfg.surfaces.push_back(surface.get());
+  }
+  IntersectionMaterialAssigner imAssigner(imCfg);
+  imCfg.useBoundingBoxes = true;
+  IntersectionMaterialAssigner imBoxAssigner(imCfg);
+
+  // The pre-selection does not change the candidates
+  for (double eta = -3.; eta <= 3.; eta += 0.25) {
+    const double theta = 2. * std::atan(std::exp(-eta));
+    const Vector3 direction =
+        Vector3(std::sin(theta), 0.2 * std::sin(theta), std::cos(theta))
+            .normalized();
+    auto [surfaceCandidates, volumeCandidates] =
+        imAssigner.assignmentCandidates(tContext, mContext, Vector3(0, 0, 0),
+                                        direction);
+    auto [boxCandidates, boxVolumeCandidates] =
+        imBoxAssigner.assignmentCandidates(tContext, mContext,
+                                           Vector3(0, 0, 0), direction);
+    BOOST_CHECK(!surfaceCandidates.empty());
+    BOOST_REQUIRE_EQUAL(boxCandidates.size(), surfaceCandidates.size());
+    for (auto [i, candidate] : enumerate(surfaceCandidates)) {
+      BOOST_CHECK_EQUAL(boxCandidates[i].surface, candidate.surface);
+      BOOST_CHECK(boxCandidates[i].position.isApprox(candidate.position));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(FindTrackingVolumeIntersections) {
   auto cylinerVolumeBounds =
       std::make_shared<CylinderVolumeBounds>(20.0, 100.0, 400.0);
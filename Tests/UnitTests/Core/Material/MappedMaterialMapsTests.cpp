@@ -0,0 +1,141 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/MappedMaterialMaps.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string tempPath(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+}  // namespace
+
+namespace Acts::Test {
+
+BOOST_AUTO_TEST_CASE(MappedMaterialMaps_round_trip) {
+  GeometryIdentifier homogeneousId = GeometryIdentifier().setSensitive(1);
+  GeometryIdentifier binnedId = GeometryIdentifier().setSensitive(2);
+  GeometryIdentifier volumeId = GeometryIdentifier().setVolume(3);
+
+  // one equidistant and one arbitrary binning, with a shifted transform
+  BinUtility xyBinning(Transform3(Translation3(1., 2., 3.)));
+  xyBinning += BinUtility(2, -1., 1., open, binX);
+  std::vector<float> yBoundaries = {-3., -1., 2., 3.};
+  xyBinning += BinUtility(yBoundaries, open, binY);
+  MaterialSlabMatrix slabs;
+  for (std::size_t bin1 = 0; bin1 < 3; ++bin1) {
+    MaterialSlabVector row;
+    for (std::size_t bin0 = 0; bin0 < 2; ++bin0) {
+      float i = 1 + bin0 + 2 * bin1;
+      row.emplace_back(Material::fromMolarDensity(i, 2 * i, 3., 4., 5.), i);
+    }
+    slabs.push_back(std::move(row));
+  }
+
+  MappedMaterialMaps maps;
+  maps.first[homogeneousId] = std::make_shared<HomogeneousSurfaceMaterial>(
+      MaterialSlab(Material::fromMolarDensity(1., 2., 3., 4., 5.), 6.), 1.,
+      MappingType::PreMapping);
+  maps.first[binnedId] = std::make_shared<BinnedSurfaceMaterial>(
+      xyBinning, slabs, 0., MappingType::PostMapping);
+  maps.second[volumeId] = std::make_shared<HomogeneousVolumeMaterial>(
+      Material::fromMolarDensity(7., 8., 9., 10., 11.));
+
+  const std::string path = tempPath("MappedMaterialMapsRoundTrip.mat");
+  {
+    std::ofstream os(path, std::ios::binary);
+    writeMappedMaterialMaps(os, maps);
+  }
+
+  auto file = std::make_shared<const MappedMaterialFile>(path);
+  MappedMaterialMaps read = readMappedMaterialMaps(file);
+  BOOST_REQUIRE_EQUAL(read.first.size(), 2u);
+  BOOST_REQUIRE_EQUAL(read.second.size(), 1u);
+
+  const auto& homogeneous = *read.first.at(homogeneousId);
+  BOOST_CHECK(dynamic_cast<const HomogeneousSurfaceMaterial*>(&homogeneous) !=
+              nullptr);
+  BOOST_CHECK(homogeneous.mappingType() == MappingType::PreMapping);
+  BOOST_CHECK_EQUAL(homogeneous.materialSlab(Vector2(0., 0.)),
+                    maps.first[homogeneousId]->materialSlab(Vector2(0., 0.)));
+
+  const auto* binned = dynamic_cast<const MappedBinnedSurfaceMaterial*>(
+      read.first.at(binnedId).get());
+  BOOST_REQUIRE(binned != nullptr);
+  BOOST_CHECK(binned->mappingType() == MappingType::PostMapping);
+  BOOST_CHECK(binned->binUtility() == xyBinning);
+  const auto& original = *maps.first[binnedId];
+  for (const Vector3& position :
+       {Vector3(0.5, 0., 3.), Vector3(1.5, 0., 3.), Vector3(0.5, 3.5, 3.),
+        Vector3(1.5, 4.5, 3.), Vector3(-5., -5., 3.), Vector3(5., 5., 3.)}) {
+    BOOST_CHECK_EQUAL(binned->materialSlab(position),
+                      original.materialSlab(position));
+  }
+  for (const Vector2& position :
+       {Vector2(-0.5, -2.), Vector2(0.5, 0.), Vector2(0.5, 2.5)}) {
+    BOOST_CHECK_EQUAL(binned->materialSlab(position),
+                      original.materialSlab(position));
+  }
+  MappedBinnedSurfaceMaterial scaled(*binned);
+  BOOST_CHECK_THROW(scaled *= 2., std::logic_error);
+
+  BOOST_CHECK_EQUAL(read.second.at(volumeId)->material(Vector3::Zero()),
+                    maps.second[volumeId]->material(Vector3::Zero()));
+
+  // the mapped material can be written again
+  std::ostringstream rewritten;
+  writeMappedMaterialMaps(rewritten, read);
+  std::ostringstream written;
+  writeMappedMaterialMaps(written, maps);
+  BOOST_CHECK(rewritten.str() == written.str());
+
+  std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(MappedMaterialMaps_errors) {
+  MappedMaterialMaps maps;
+  maps.first[GeometryIdentifier().setSensitive(1)] =
+      std::make_shared<ProtoSurfaceMaterial>(
+          BinUtility(2, -1., 1., open, binX));
+  std::ostringstream os;
+  BOOST_CHECK_THROW(writeMappedMaterialMaps(os, maps), std::invalid_argument);
+
+  BOOST_CHECK_THROW(MappedMaterialFile(tempPath("MappedMaterialMapsMissing")),
+                    std::runtime_error);
+
+  const std::string path = tempPath("MappedMaterialMapsInvalid.mat");
+  {
+    std::ofstream invalid(path, std::ios::binary);
+    invalid << std::string(512, 'x');
+  }
+  BOOST_CHECK_THROW(MappedMaterialFile{path}, std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+}  // namespace Acts::Test
@@ -21,7 +21,9 @@
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 
+#include <cmath>
 #include <limits>
+#include <stdexcept>
 
 namespace Acts::Test {
 
@@ -131,6 +133,42 @@ BOOST_AUTO_TEST_CASE(MaterialValidaterFlowTest) {
   CHECK_CLOSE_ABS(rMaterial2.materialInL0,
                   pathCorrection * (2. / 22. + 4. / 42. + 6. / 62.), 1e-6);
   BOOST_CHECK_EQUAL(rMaterial2.materialInteractions.size(), 3u);
+
+  // The integrated material matches the recorded one
+  auto [inX0, inL0] = materialValidater.integrateMaterial(
+      tContext, MagneticFieldContext(), Vector3(0, 0, 0),
+      Vector3(1, 0, 1).normalized());
+  CHECK_CLOSE_REL(inX0, rMaterial2.materialInX0, 1e-6);
+  CHECK_CLOSE_REL(inL0, rMaterial2.materialInL0, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(MaterialProfileTest) {
+  MaterialProfile profile(4, {-2., 2.}, 2, {-M_PI, M_PI});
+  BOOST_CHECK_EQUAL(profile.entries.size(), 8u);
+
+  profile.fill(-1.5, -1., 0.1, 0.01);
+  profile.fill(-1.2, -2., 0.3, 0.03);
+  profile.fill(1.5, 1., 0.5, 0.05);
+  // outside of the eta range
+  profile.fill(2.5, 1., 1., 1.);
+
+  BOOST_CHECK_EQUAL(profile.entries[profile.bin(0, 0)], 2u);
+  CHECK_CLOSE_ABS(profile.sumInX0[profile.bin(0, 0)], 0.4, 1e-12);
+  CHECK_CLOSE_ABS(profile.sumInL0[profile.bin(0, 0)], 0.04, 1e-12);
+  BOOST_CHECK_EQUAL(profile.entries[profile.bin(3, 1)], 1u);
+  CHECK_CLOSE_ABS(profile.sumInX0[profile.bin(3, 1)], 0.5, 1e-12);
+
+  MaterialProfile other(4, {-2., 2.}, 2, {-M_PI, M_PI});
+  other.fill(1.5, 1., 0.5, 0.05);
+  profile.merge(other);
+  BOOST_CHECK_EQUAL(profile.entries[profile.bin(3, 1)], 2u);
+  CHECK_CLOSE_ABS(profile.sumInX0[profile.bin(3, 1)], 1., 1e-12);
+  CHECK_CLOSE_ABS(profile.sumInL0[profile.bin(3, 1)], 0.1, 1e-12);
+
+  MaterialProfile different(2, {-2., 2.}, 2, {-M_PI, M_PI});
+  BOOST_CHECK_THROW(profile.merge(different), std::invalid_argument);
+  BOOST_CHECK_THROW(MaterialProfile(0, {-2., 2.}, 2, {-M_PI, M_PI}),
+                    std::invalid_argument);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -150,4 +150,40 @@ BOOST_AUTO_TEST_CASE(IndexedDetectorVolumeFinder) {
   BOOST_CHECK_THROW(idv.update(tContext, nState), std::runtime_error);
 }
 
+// Test finding detectors with a bounding volume hierarchy
+BOOST_AUTO_TEST_CASE(BoundingBoxVolumeFinder) {
+  std::vector<const Acts::Experimental::DetectorVolume*> volumes = {
+      cyl0.get(), cyl1.get(), cyl2.get()};
+  Acts::Experimental::BoundingBoxVolumeFinder bbvf(volumes);
+
+  // Cylinder 0
+  nState.position = Acts::Vector3(5., 0., 0.);
+  bbvf.update(tContext, nState);
+  BOOST_CHECK_EQUAL(nState.currentVolume, cyl0.get());
+  // Cylinder 1
+  nState.position = Acts::Vector3(0., -50., 100.);
+  bbvf.update(tContext, nState);
+  BOOST_CHECK_EQUAL(nState.currentVolume, cyl1.get());
+  // Cylinder 2, the corner of its box is outside
+  nState.position = Acts::Vector3(150., 0., -150.);
+  bbvf.update(tContext, nState);
+  BOOST_CHECK_EQUAL(nState.currentVolume, cyl2.get());
+  nState.position = Acts::Vector3(190., 190., 0.);
+  bbvf.update(tContext, nState);
+  BOOST_CHECK_EQUAL(nState.currentVolume, nullptr);
+  // Outside of all volumes
+  nState.position = Acts::Vector3(0., 0., 500.);
+  bbvf.update(tContext, nState);
+  BOOST_CHECK_EQUAL(nState.currentVolume, nullptr);
+
+  // The bounding boxes do not contain the origin unless the volume does
+  auto offBounds = std::make_unique<Acts::CylinderVolumeBounds>(r0, r1, 10.);
+  auto off = Acts::Experimental::DetectorVolumeFactory::construct(
+      portalGenerator, tContext, "Off",
+      Acts::Transform3(Acts::Translation3(0., 0., 100.)), std::move(offBounds),
+      Acts::Experimental::tryAllPortals());
+  BOOST_CHECK(!off->getBoundingBox().intersect(Acts::Vector3::Zero()));
+  BOOST_CHECK(off->getBoundingBox().intersect(Acts::Vector3(0., 0., 100.)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Detector/DetectorVolume.hpp"
+#include "Acts/Detector/PortalGenerators.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Navigation/DetectorVolumeFinders.hpp"
+#include "Acts/Navigation/InternalNavigation.hpp"
+#include "Acts/Navigation/NavigationState.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+Acts::GeometryContext tContext;
+
+BOOST_AUTO_TEST_SUITE(Experimental)
+
+BOOST_AUTO_TEST_CASE(BoundingBoxSurfacesNavigation) {
+  // planes along the x axis and one plane off the axis
+  Acts::Transform3 toX = Acts::Transform3::Identity();
+  toX.linear() =
+      Acts::AngleAxis3(0.5 * M_PI, Acts::Vector3::UnitY()).toRotationMatrix();
+  auto rBounds = std::make_shared<Acts::RectangleBounds>(10_mm, 10_mm);
+
+  std::vector<std::shared_ptr<Acts::Surface>> surfaces;
+  for (int i = 1; i < 10; ++i) {
+    surfaces.push_back(Acts::Surface::makeShared<Acts::PlaneSurface>(
+        Acts::Transform3(Acts::Translation3(i * 100_mm, 0, 0) * toX),
+        rBounds));
+  }
+  auto offAxis = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Transform3(Acts::Translation3(500_mm, 600_mm, 0) * toX), rBounds);
+  surfaces.push_back(offAxis);
+
+  std::vector<const Acts::Surface*> rawSurfaces;
+  for (const auto& s : surfaces) {
+    rawSurfaces.push_back(s.get());
+  }
+  Acts::Experimental::BoundingBoxSurfacesNavigation navigation(
+      tContext, rawSurfaces,
+      Acts::Experimental::BoundingBoxSurfacesNavigation::Config());
+
+  Acts::Experimental::NavigationState nState;
+  nState.position = Acts::Vector3(-500_mm, 0, 0);
+  nState.direction = Acts::Vector3::UnitX();
+  nState.absMomentum = 1_GeV;
+  nState.absCharge = 1_e;
+
+  // a straight track only sees the planes along the axis
+  auto selected = navigation.select(nState);
+  BOOST_CHECK_EQUAL(selected.size(), 9u);
+  BOOST_CHECK(std::find(selected.begin(), selected.end(), offAxis.get()) ==
+              selected.end());
+
+  // nothing is selected backwards
+  nState.direction = -Acts::Vector3::UnitX();
+  BOOST_CHECK(navigation.select(nState).empty());
+
+  // a track bending in the field opens the frustum
+  nState.direction = Acts::Vector3::UnitX();
+  nState.magneticField = Acts::Vector3(0, 0, 2_T);
+  nState.absMomentum = 500_MeV;
+  selected = navigation.select(nState);
+  BOOST_CHECK_EQUAL(selected.size(), 10u);
+
+  // a low momentum track takes all surfaces
+  nState.absMomentum = 10_MeV;
+  BOOST_CHECK_EQUAL(navigation.select(nState).size(), surfaces.size());
+
+  // the bounding volume hierarchy selects the same surfaces
+  Acts::Experimental::BoundingBoxSurfacesNavigation::Config bvhConfig;
+  bvhConfig.bvhLeafSize = 2;
+  Acts::Experimental::BoundingBoxSurfacesNavigation bvhNavigation(
+      tContext, rawSurfaces, bvhConfig);
+  for (double p : {10_MeV, 500_MeV}) {
+    nState.absMomentum = p;
+    auto octreeSelected = navigation.select(nState);
+    auto bvhSelected = bvhNavigation.select(nState);
+    std::sort(octreeSelected.begin(), octreeSelected.end());
+    std::sort(bvhSelected.begin(), bvhSelected.end());
+    BOOST_CHECK(octreeSelected == bvhSelected);
+  }
+  nState.magneticField = Acts::Vector3::Zero();
+  nState.absMomentum = 1_GeV;
+  BOOST_CHECK_EQUAL(bvhNavigation.select(nState).size(), 9u);
+
+  // the delegate fills the portals and the selected surfaces of the volume
+  auto volume = Acts::Experimental::DetectorVolumeFactory::construct(
+      Acts::Experimental::defaultPortalAndSubPortalGenerator(), tContext,
+      "Cube", Acts::Transform3::Identity(),
+      std::make_unique<Acts::CuboidVolumeBounds>(1_m, 1_m, 1_m), surfaces, {},
+      Acts::Experimental::tryNoVolumes(),
+      Acts::Experimental::tryBoundingBoxSurfaces(tContext, rawSurfaces));
+
+  nState.magneticField = Acts::Vector3::Zero();
+  nState.absMomentum = 1_GeV;
+  nState.currentVolume = volume.get();
+  volume->internalNavigation()(tContext, nState);
+  // the straight line hits the planes along the axis and the exit portal
+  BOOST_CHECK_EQUAL(nState.surfaceCandidates.size(), 10u);
+  std::size_t nPortals = std::count_if(
+      nState.surfaceCandidates.begin(), nState.surfaceCandidates.end(),
+      [](const auto& c) { return c.portal != nullptr; });
+  BOOST_CHECK_EQUAL(nPortals, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
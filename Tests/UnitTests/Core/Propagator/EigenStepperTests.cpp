@@ -311,7 +311,12 @@ BOOST_AUTO_TEST_CASE(eigen_stepper_test) {
   PropState ps(navDir, std::move(esState));
 
   ps.stepping.covTransport = false;
+  const std::size_t nLookupsBefore = ps.stepping.nFieldLookups;
+  const std::size_t nTrialsBefore = ps.stepping.nStepTrials;
   es.step(ps, mockNavigator).value();
+  // the field at the start position is only looked up once per step
+  BOOST_CHECK_EQUAL(ps.stepping.nFieldLookups - nLookupsBefore,
+                    1 + 2 * (ps.stepping.nStepTrials - nTrialsBefore));
   CHECK_CLOSE_COVARIANCE(ps.stepping.cov, cov, eps);
   BOOST_CHECK_NE(es.position(ps.stepping).norm(), newPos.norm());
   BOOST_CHECK_NE(es.direction(ps.stepping), newMom.normalized());
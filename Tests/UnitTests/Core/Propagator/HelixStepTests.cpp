@@ -0,0 +1,122 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/VoidNavigator.hpp"
+#include "Acts/Propagator/detail/HelixStep.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+#include <memory>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts::Test {
+
+BOOST_AUTO_TEST_SUITE(HelixStepTests)
+
+BOOST_AUTO_TEST_CASE(helix_step_jacobian) {
+  const Vector3 bField(0.1_T, -0.2_T, 2_T);
+  const double mass = 0.1_GeV;
+  const double h = 250_mm;
+
+  FreeVector pars = FreeVector::Zero();
+  pars.segment<3>(eFreePos0) = Vector3(1_mm, -2_mm, 3_mm);
+  pars.segment<3>(eFreeDir0) = Vector3(1, 0.5, 0.3).normalized();
+  pars[eFreeQOverP] = -1 / 1.5_GeV;
+  const auto absMomentum = [](const FreeVector& p) {
+    return std::abs(1 / p[eFreeQOverP]);
+  };
+
+  FreeVector end = pars;
+  FreeMatrix D;
+  Vector3 dTds;
+  detail::helixStep(end, bField, h, mass, absMomentum(pars), &D, &dTds);
+
+  // the direction stays normalized and the path derivative matches the
+  // equation of motion
+  CHECK_CLOSE_REL(end.segment<3>(eFreeDir0).norm(), 1, 1e-12);
+  CHECK_CLOSE_ABS(dTds,
+                  Vector3(pars[eFreeQOverP] *
+                          end.segment<3>(eFreeDir0).cross(bField)),
+                  1e-12);
+
+  // compare the analytic transport matrix to finite differences of the
+  // direction and q/p columns
+  const double eps = 1e-7;
+  for (unsigned int col : {eFreeDir0, eFreeDir1, eFreeDir2, eFreeQOverP}) {
+    FreeVector up = pars;
+    FreeVector down = pars;
+    up[col] += eps;
+    down[col] -= eps;
+    detail::helixStep(up, bField, h, mass, absMomentum(up));
+    detail::helixStep(down, bField, h, mass, absMomentum(down));
+    // the helix step normalizes the direction, the Jacobian does not
+    for (unsigned int row = eFreePos0; row <= eFreePos2; ++row) {
+      CHECK_CLOSE_ABS(D(row, col), (up[row] - down[row]) / (2 * eps), 1e-3);
+    }
+    if (col == eFreeQOverP) {
+      CHECK_CLOSE_ABS(D(eFreeTime, col),
+                      (up[eFreeTime] - down[eFreeTime]) / (2 * eps), 1e-3);
+      for (unsigned int row = eFreeDir0; row <= eFreeDir2; ++row) {
+        CHECK_CLOSE_ABS(D(row, col), (up[row] - down[row]) / (2 * eps), 1e-5);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(eigen_stepper_helix_mode) {
+  GeometryContext gctx;
+  MagneticFieldContext mctx;
+
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, 2_T));
+  // accept the helix for field changes up to 1e-4 along the step
+  Propagator helixPropagator{EigenStepper<>{bField, 100_um, 1e-4},
+                             VoidNavigator{}};
+  Propagator eigenPropagator{EigenStepper<>{bField}, VoidNavigator{}};
+
+  auto startSurface =
+      Surface::makeShared<PlaneSurface>(Vector3::Zero(), Vector3::UnitX());
+  auto targetSurface = Surface::makeShared<PlaneSurface>(
+      Vector3(800_mm, 0, 0), Vector3::UnitX());
+
+  BoundVector startPars;
+  startPars << 1_mm, -2_mm, 0.1, M_PI / 2 - 0.2, 1 / 2_GeV, 0;
+  BoundSquareMatrix cov = BoundSquareMatrix::Identity() * 1e-4;
+  BoundTrackParameters start(startSurface, startPars, cov,
+                             ParticleHypothesis::pion());
+
+  PropagatorOptions<> options(gctx, mctx);
+
+  auto helixResult = helixPropagator.propagate(start, *targetSurface, options);
+  auto eigenResult = eigenPropagator.propagate(start, *targetSurface, options);
+  BOOST_REQUIRE(helixResult.ok());
+  BOOST_REQUIRE(eigenResult.ok());
+
+  const auto& helixEnd = *helixResult.value().endParameters;
+  const auto& eigenEnd = *eigenResult.value().endParameters;
+  CHECK_CLOSE_ABS(helixEnd.parameters(), eigenEnd.parameters(), 1e-4);
+  CHECK_CLOSE_ABS(*helixEnd.covariance(), *eigenEnd.covariance(), 1e-7);
+  // without material the helix reaches the target in few steps
+  BOOST_CHECK_LE(helixResult.value().steps, eigenResult.value().steps);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
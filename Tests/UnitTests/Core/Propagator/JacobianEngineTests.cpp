@@ -13,8 +13,15 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Propagator/detail/JacobianEngine.hpp"
 #include "Acts/Surfaces/CurvilinearSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <memory>
+#include <vector>
 
 namespace Acts::Test {
 
@@ -191,4 +198,82 @@ BOOST_AUTO_TEST_CASE(jacobian_engine_to_free) {
   BOOST_CHECK(newFreeCovariance1.isApprox(newFreeCovariance2));
 }
 
+/// The engines only evaluate the non-zero blocks of the surface jacobians,
+/// compare them to the dense products for the different surface types.
+BOOST_AUTO_TEST_CASE(jacobian_engine_dense_reference) {
+  GeometryContext tgContext = GeometryContext();
+
+  Vector3 direction = Vector3(5., 2., 7.).normalized();
+  Transform3 transform = Transform3::Identity();
+  transform.translation() = Vector3(1., 2., 3.);
+  transform.rotate(AngleAxis3(0.3, Vector3(1., 1., 0.).normalized()));
+
+  std::vector<std::shared_ptr<Surface>> surfaces = {
+      Surface::makeShared<PlaneSurface>(transform),
+      Surface::makeShared<DiscSurface>(transform,
+                                       std::make_shared<RadialBounds>(0., 10.)),
+      Surface::makeShared<StrawSurface>(transform, 1., 10.)};
+
+  // Dense transport jacobian and path derivatives
+  FreeMatrix transportJacobian = FreeMatrix::Identity();
+  transportJacobian.col(0) << 0.9, 0.1, -0.2, 0.3, 0.05, -0.1, 0.2, 0.01;
+  transportJacobian.col(4) << 2., 0.5, -0.3, 0.1, 0.8, 0.2, -0.1, 0.;
+  transportJacobian.col(7) << 0.3, -0.4, 0.2, 1.5, 0.1, 0.2, 0.3, 0.9;
+  FreeVector derivatives;
+  derivatives << 0.2, 0.5, 0.8, 1.1, -0.1, 0.03, 0.02, -0.01;
+
+  for (const auto& surface : surfaces) {
+    const Vector3 position =
+        surface->localToGlobal(tgContext, Vector2(0.5, 1.), direction);
+    FreeVector freeParameters;
+    freeParameters << position, 4., direction, 0.125;
+
+    const BoundToFreeMatrix boundToFreeJacobian =
+        surface->boundToFreeJacobian(tgContext, position, direction);
+    const FreeToBoundMatrix freeToBoundJacobian =
+        surface->freeToBoundJacobian(tgContext, position, direction);
+    const FreeToPathMatrix freeToPath =
+        surface->freeToPathDerivative(tgContext, position, direction);
+
+    BoundMatrix b2bTransportJacobian;
+    detail::boundToBoundTransportJacobian(
+        tgContext, *surface, freeParameters, boundToFreeJacobian,
+        transportJacobian, derivatives, b2bTransportJacobian);
+    BoundMatrix b2bReference =
+        freeToBoundJacobian *
+        (FreeMatrix::Identity() + derivatives * freeToPath) *
+        transportJacobian * boundToFreeJacobian;
+    CHECK_CLOSE_ABS(b2bTransportJacobian, b2bReference, 1e-12);
+
+    FreeToBoundMatrix f2bTransportJacobian;
+    detail::freeToBoundTransportJacobian(tgContext, *surface, freeParameters,
+                                         transportJacobian, derivatives,
+                                         f2bTransportJacobian);
+    FreeToBoundMatrix f2bReference =
+        freeToBoundJacobian *
+        (FreeMatrix::Identity() + derivatives * freeToPath) *
+        transportJacobian;
+    CHECK_CLOSE_ABS(f2bTransportJacobian, f2bReference, 1e-12);
+
+    CHECK_CLOSE_ABS(detail::boundToFreeTransportJacobian(boundToFreeJacobian,
+                                                         transportJacobian),
+                    BoundToFreeMatrix(transportJacobian * boundToFreeJacobian),
+                    1e-12);
+
+    BoundMatrix b2cTransportJacobian;
+    detail::boundToCurvilinearTransportJacobian(
+        direction, boundToFreeJacobian, transportJacobian, derivatives,
+        b2cTransportJacobian);
+    FreeToBoundMatrix freeToCurvilinearJacobian =
+        CurvilinearSurface(direction).freeToBoundJacobian();
+    FreeToPathMatrix freeToCurvilinearPath = FreeToPathMatrix::Zero();
+    freeToCurvilinearPath.segment<3>(eFreePos0) = -direction.transpose();
+    BoundMatrix b2cReference =
+        freeToCurvilinearJacobian *
+        (FreeMatrix::Identity() + derivatives * freeToCurvilinearPath) *
+        transportJacobian * boundToFreeJacobian;
+    CHECK_CLOSE_ABS(b2cTransportJacobian, b2cReference, 1e-12);
+  }
+}
+
 }  // namespace Acts::Test
@@ -198,7 +198,7 @@ BOOST_AUTO_TEST_CASE(multi_eigen_stepper_state_invalid) {
 // Compare the Multi-Stepper against the Eigen-Stepper for consistency
 ////////////////////////////////////////////////////////////////////////
 template <typename multi_stepper_t>
-void test_multi_stepper_vs_eigen_stepper() {
+void test_multi_stepper_vs_eigen_stepper(double helixFieldTolerance = 0) {
   using MultiState = typename multi_stepper_t::State;
   using MultiStepper = multi_stepper_t;
 
@@ -220,8 +220,9 @@ void test_multi_stepper_vs_eigen_stepper() {
   SingleStepper::State single_state(geoCtx, defaultBField->makeCache(magCtx),
                                     single_pars, defaultStepSize);
 
-  MultiStepper multi_stepper(defaultBField);
-  SingleStepper single_stepper(defaultBField);
+  MultiStepper multi_stepper(defaultBField, helixFieldTolerance);
+  SingleStepper single_stepper(defaultBField, 100 * UnitConstants::um,
+                               helixFieldTolerance);
 
   for (auto cmp : multi_stepper.componentIterable(multi_state)) {
     cmp.status() = Acts::Intersection3D::Status::reachable;
@@ -260,6 +261,10 @@ BOOST_AUTO_TEST_CASE(multi_eigen_vs_single_eigen) {
   test_multi_stepper_vs_eigen_stepper<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(multi_eigen_vs_single_eigen_helix) {
+  test_multi_stepper_vs_eigen_stepper<MultiStepperLoop>(1e-4);
+}
+
 /////////////////////////////
 // Test stepsize accessors
 /////////////////////////////
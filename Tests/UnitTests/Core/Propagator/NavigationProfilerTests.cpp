@@ -0,0 +1,116 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/NavigationProfiler.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts::Test {
+
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+CylindricalTrackingGeometry cGeometry(tgContext);
+auto tGeometry = cGeometry();
+
+auto bField = std::make_shared<ConstantBField>(Vector3{0, 0, 2_T});
+
+BOOST_AUTO_TEST_CASE(navigation_profiler_threads) {
+  NavigationProfiler profiler;
+  const auto volume = GeometryIdentifier().setVolume(2);
+  const auto layer = GeometryIdentifier().setVolume(2).setLayer(4);
+
+  auto fill = [&]() {
+    for (int i = 0; i < 100; ++i) {
+      ++profiler.counters(volume).intersections;
+      profiler.counters(layer).candidates += 2;
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back(fill);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto summary = profiler.summary();
+  BOOST_CHECK_EQUAL(summary.size(), 2u);
+  BOOST_CHECK_EQUAL(summary[volume].intersections, 400u);
+  BOOST_CHECK_EQUAL(summary[layer].candidates, 800u);
+
+  // the layer is summed into its volume
+  auto volumeSummary = profiler.volumeSummary();
+  BOOST_CHECK_EQUAL(volumeSummary.size(), 1u);
+  BOOST_CHECK_EQUAL(volumeSummary[volume].intersections, 400u);
+  BOOST_CHECK_EQUAL(volumeSummary[volume].candidates, 800u);
+
+  profiler.clear();
+  BOOST_CHECK_EQUAL(profiler.summary()[volume].intersections, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(navigation_profiler_navigator) {
+  auto profiler = std::make_shared<NavigationProfiler>();
+
+  Navigator::Config navCfg{tGeometry};
+  navCfg.profiler = profiler;
+  using Stepper = EigenStepper<>;
+  Propagator propagator{Stepper{bField}, Navigator{navCfg}};
+
+  CurvilinearTrackParameters start(Vector4::Zero(), 0.3, M_PI / 2 - 0.2,
+                                   1 / 1_GeV, std::nullopt,
+                                   ParticleHypothesis::pion());
+  PropagatorOptions<> options(tgContext, mfContext);
+  auto result = propagator.propagate(start, options);
+  BOOST_REQUIRE(result.ok());
+
+  NavigationProfiler::Counters total;
+  for (const auto& [geoId, counters] : profiler->summary()) {
+    BOOST_CHECK_NE(geoId.volume(), 0u);
+    total += counters;
+  }
+  // at most a pre- and a post-step call for every step
+  BOOST_CHECK_GT(total.calls, 0u);
+  BOOST_CHECK_LE(total.calls, 2 * result.value().steps);
+  BOOST_CHECK_GT(total.candidates, 0u);
+  BOOST_CHECK_GT(total.intersections, 0u);
+  BOOST_CHECK_GT(total.time.count(), 0);
+
+  // the propagation crosses several volumes
+  BOOST_CHECK_GT(profiler->volumeSummary().size(), 1u);
+
+  // without profiler nothing is recorded
+  profiler->clear();
+  Propagator plainPropagator{Stepper{bField}, Navigator{{tGeometry}}};
+  BOOST_REQUIRE(plainPropagator.propagate(start, options).ok());
+  NavigationProfiler::Counters after;
+  for (const auto& [geoId, counters] : profiler->summary()) {
+    after += counters;
+  }
+  BOOST_CHECK_EQUAL(after.calls, 0u);
+}
+
+}  // namespace Acts::Test
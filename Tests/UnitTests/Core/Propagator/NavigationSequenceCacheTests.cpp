@@ -0,0 +1,130 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/AbortList.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/DirectNavigator.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/NavigationSequenceCache.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Propagator/SurfaceCollector.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts::Test {
+
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+CylindricalTrackingGeometry cGeometry(tgContext);
+auto tGeometry = cGeometry();
+
+auto bField = std::make_shared<ConstantBField>(Vector3{0, 0, 2_T});
+
+BOOST_AUTO_TEST_CASE(navigation_sequence_cache_bins) {
+  NavigationSequenceCache cache;
+  const GeometryIdentifier volumeId = GeometryIdentifier().setVolume(1);
+  const Vector3 dir = Vector3(1, 1, 0.5).normalized();
+
+  BOOST_CHECK_EQUAL(cache.find(volumeId, dir, 1 / 1_GeV), nullptr);
+
+  auto surface =
+      Surface::makeShared<PlaneSurface>(Vector3::Zero(), Vector3::UnitX());
+  NavigationSequenceCache::SurfaceSequence sequence = {surface.get()};
+  cache.record(volumeId, dir, 1 / 1_GeV, sequence);
+  BOOST_CHECK_EQUAL(cache.size(), 1u);
+  BOOST_REQUIRE_NE(cache.find(volumeId, dir, 1 / 1_GeV), nullptr);
+  BOOST_CHECK(*cache.find(volumeId, dir, 1 / 1_GeV) == sequence);
+
+  // different direction, charge or volume
+  BOOST_CHECK_EQUAL(cache.find(volumeId, -dir, 1 / 1_GeV), nullptr);
+  BOOST_CHECK_EQUAL(cache.find(volumeId, dir, -1 / 1_GeV), nullptr);
+  BOOST_CHECK_EQUAL(
+      cache.find(GeometryIdentifier().setVolume(2), dir, 1 / 1_GeV), nullptr);
+
+  // the first recorded sequence is kept
+  cache.record(volumeId, dir, 1 / 1_GeV, {});
+  BOOST_CHECK(*cache.find(volumeId, dir, 1 / 1_GeV) == sequence);
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(navigation_sequence_cache_replay) {
+  using Stepper = EigenStepper<>;
+  Propagator propagator{Stepper{bField}, Navigator{{tGeometry}}};
+  Propagator directPropagator{Stepper{bField}, DirectNavigator{}};
+
+  CurvilinearTrackParameters start(Vector4::Zero(), 0.3, M_PI / 2 - 0.2,
+                                   1 / 1_GeV, std::nullopt,
+                                   ParticleHypothesis::pion());
+
+  NavigationSequenceCache cache;
+
+  using ActionList =
+      Acts::ActionList<NavigationSequenceRecorder, SurfaceCollector<>>;
+  using AbortList = Acts::AbortList<EndOfWorldReached>;
+  PropagatorOptions<ActionList, AbortList> options(tgContext, mfContext);
+  options.actionList.get<NavigationSequenceRecorder>().cache = &cache;
+  auto& collector = options.actionList.get<SurfaceCollector<>>();
+  collector.selector.selectSensitive = true;
+  collector.selector.selectMaterial = true;
+
+  auto result = propagator.propagate(start, options);
+  BOOST_REQUIRE(result.ok());
+  const auto& collected =
+      result.value().get<SurfaceCollector<>::result_type>().collected;
+  BOOST_REQUIRE(!collected.empty());
+  BOOST_CHECK_EQUAL(cache.size(), 1u);
+
+  const TrackingVolume* startVolume =
+      tGeometry->lowestTrackingVolume(tgContext, start.position(tgContext));
+  BOOST_REQUIRE_NE(startVolume, nullptr);
+  const auto* sequence = cache.find(startVolume->geometryId(),
+                                    start.direction(), start.qOverP());
+  BOOST_REQUIRE_NE(sequence, nullptr);
+  BOOST_CHECK_EQUAL(sequence->size(), collected.size());
+
+  // replay the recorded sequence with the direct navigator
+  using DirectActionList =
+      Acts::ActionList<DirectNavigator::Initializer, SurfaceCollector<>>;
+  PropagatorOptions<DirectActionList, Acts::AbortList<>> directOptions(
+      tgContext, mfContext);
+  directOptions.actionList.get<DirectNavigator::Initializer>().navSurfaces =
+      *sequence;
+  auto& directCollector = directOptions.actionList.get<SurfaceCollector<>>();
+  directCollector.selector.selectSensitive = true;
+  directCollector.selector.selectMaterial = true;
+
+  auto directResult = directPropagator.propagate(start, directOptions);
+  BOOST_REQUIRE(directResult.ok());
+  const auto& directCollected =
+      directResult.value().get<SurfaceCollector<>::result_type>().collected;
+  BOOST_REQUIRE_EQUAL(directCollected.size(), collected.size());
+  for (std::size_t i = 0; i < collected.size(); ++i) {
+    BOOST_CHECK_EQUAL(directCollected[i].surface, collected[i].surface);
+  }
+}
+
+}  // namespace Acts::Test
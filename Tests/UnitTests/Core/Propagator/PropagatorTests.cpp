@@ -23,6 +23,7 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Propagator/AbortList.hpp"
 #include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/ActorTrigger.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
 #include "Acts/Propagator/DenseEnvironmentExtension.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
@@ -31,6 +32,7 @@
 #include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Propagator/StepperExtensionList.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Propagator/VoidNavigator.hpp"
 #include "Acts/Surfaces/CylinderBounds.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
@@ -50,6 +52,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace Acts {
 class Logger;
@@ -485,4 +488,131 @@ BOOST_AUTO_TEST_CASE(BasicPropagatorInterface) {
                   "Propagator unexpectedly inherits from BasePropagator");
   }
 }
+
+/// Records the position after each step, with a reusable result
+struct PositionRecorder {
+  struct this_result {
+    std::vector<Vector3> positions;
+
+    void reset() { positions.clear(); }
+  };
+  using result_type = this_result;
+
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t>
+  void operator()(propagator_state_t& state, const stepper_t& stepper,
+                  const navigator_t& /*navigator*/, result_type& result,
+                  const Logger& /*logger*/) const {
+    result.positions.push_back(stepper.position(state.stepping));
+  }
+};
+
+BOOST_AUTO_TEST_CASE(ReusablePropagatorState) {
+  auto field = std::make_shared<ConstantBField>(Vector3{0, 0, 2_T});
+  Propagator propagator{EigenStepper<>{field}, VoidNavigator{}};
+
+  auto startSurface =
+      Surface::makeShared<PlaneSurface>(Vector3::Zero(), Vector3::UnitX());
+  auto targetSurface = Surface::makeShared<PlaneSurface>(
+      Vector3::UnitX() * 200_mm, Vector3::UnitX());
+
+  BoundVector startPars1;
+  startPars1 << 0, 0, 0, M_PI / 2, 1 / 1_GeV, 0;
+  BoundVector startPars2;
+  startPars2 << 1_mm, 2_mm, 0.1, M_PI / 2 - 0.1, -1 / 2_GeV, 0;
+  BoundTrackParameters start1{startSurface, startPars1, std::nullopt,
+                              ParticleHypothesis::pion()};
+  BoundTrackParameters start2{startSurface, startPars2, std::nullopt,
+                              ParticleHypothesis::pion()};
+
+  GeometryContext gctx;
+  MagneticFieldContext mctx;
+  PropagatorOptions<ActionList<PositionRecorder>> options{gctx, mctx};
+  options.maxStepSize = 10_mm;
+
+  using StepsResult = PositionRecorder::result_type;
+
+  auto state = propagator.makeState(start1, *targetSurface, options);
+  BOOST_REQUIRE(propagator.propagate(state).ok());
+  const std::size_t nSteps1 = state.template get<StepsResult>().positions.size();
+  BOOST_CHECK_GT(nSteps1, 0u);
+  const auto* stepsData = state.template get<StepsResult>().positions.data();
+
+  // propagating again from a reset state gives the same result as a fresh
+  // propagation and reuses the memory of the actor result
+  propagator.resetState(state, start2, *targetSurface);
+  BOOST_CHECK_EQUAL(state.steps, 0u);
+  BOOST_CHECK(state.template get<StepsResult>().positions.empty());
+  BOOST_REQUIRE(propagator.propagate(state).ok());
+
+  auto fresh = propagator.propagate(start2, *targetSurface, options);
+  BOOST_REQUIRE(fresh.ok());
+  BOOST_CHECK_EQUAL(state.steps, fresh.value().steps);
+  BOOST_CHECK_EQUAL(state.pathLength, fresh.value().pathLength);
+  BOOST_CHECK_EQUAL(state.template get<StepsResult>().positions.size(),
+                    fresh.value().template get<StepsResult>().positions.size());
+  if (state.template get<StepsResult>().positions.size() <= nSteps1) {
+    BOOST_CHECK_EQUAL(state.template get<StepsResult>().positions.data(),
+                      stepsData);
+  }
+
+  auto result =
+      propagator.makeResult(std::move(state), Result<void>::success(),
+                            *targetSurface, options);
+  BOOST_REQUIRE(result.ok());
+  BOOST_CHECK_EQUAL(result.value().endParameters->parameters(),
+                    fresh.value().endParameters->parameters());
+}
+
+/// Counts its calls, with a configurable trigger
+template <ActorTrigger T>
+struct TriggerCounter {
+  static constexpr ActorTrigger trigger = T;
+
+  struct this_result {
+    int calls = 0;
+  };
+  using result_type = this_result;
+
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t>
+  void operator()(propagator_state_t& /*state*/, const stepper_t& /*stepper*/,
+                  const navigator_t& /*navigator*/, result_type& result,
+                  const Logger& /*logger*/) const {
+    ++result.calls;
+  }
+};
+
+using AlwaysCounter = TriggerCounter<ActorTrigger::always>;
+using SurfaceCounter = TriggerCounter<ActorTrigger::onSurface>;
+
+/// Minimal propagator state holding the counter results
+struct TriggerTestState {
+  VoidNavigator::State navigation;
+  std::tuple<AlwaysCounter::result_type, SurfaceCounter::result_type> results;
+
+  template <typename result_t>
+  result_t& get() {
+    return std::get<result_t>(results);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(ActionListTriggers) {
+  ActionList<AlwaysCounter, SurfaceCounter> actions;
+  StraightLineStepper stepper;
+  VoidNavigator navigator;
+  TriggerTestState state;
+
+  actions(state, stepper, navigator, getDummyLogger());
+  BOOST_CHECK_EQUAL(state.get<AlwaysCounter::result_type>().calls, 1);
+  BOOST_CHECK_EQUAL(state.get<SurfaceCounter::result_type>().calls, 0);
+
+  auto surface =
+      Surface::makeShared<PlaneSurface>(Vector3::Zero(), Vector3::UnitX());
+  state.navigation.currentSurface = surface.get();
+  actions(state, stepper, navigator, getDummyLogger());
+  BOOST_CHECK_EQUAL(state.get<AlwaysCounter::result_type>().calls, 2);
+  BOOST_CHECK_EQUAL(state.get<SurfaceCounter::result_type>().calls, 1);
+}
+
 }  // namespace Acts::Test
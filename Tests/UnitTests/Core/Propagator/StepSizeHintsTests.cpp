@@ -0,0 +1,93 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StepSizeHints.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <memory>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts::Test {
+
+BOOST_AUTO_TEST_SUITE(StepSizeHints)
+
+BOOST_AUTO_TEST_CASE(StepSizeHintCacheBinning) {
+  StepSizeHintCache cache;
+  const GeometryIdentifier volumeA = GeometryIdentifier().setVolume(1);
+  const GeometryIdentifier volumeB = GeometryIdentifier().setVolume(2);
+
+  BOOST_CHECK(!cache.hint(volumeA, 1_GeV).has_value());
+
+  cache.record(volumeA, 1_GeV, 5_mm);
+  BOOST_CHECK_EQUAL(cache.size(), 1u);
+  BOOST_CHECK_EQUAL(cache.hint(volumeA, 1_GeV).value(), 5_mm);
+  // same momentum bin
+  BOOST_CHECK_EQUAL(cache.hint(volumeA, 1.1_GeV).value(), 5_mm);
+  // different momentum bin or volume
+  BOOST_CHECK(!cache.hint(volumeA, 2_GeV).has_value());
+  BOOST_CHECK(!cache.hint(volumeB, 1_GeV).has_value());
+
+  // the latest value is kept
+  cache.record(volumeA, 1_GeV, 7_mm);
+  BOOST_CHECK_EQUAL(cache.size(), 1u);
+  BOOST_CHECK_EQUAL(cache.hint(volumeA, 1_GeV).value(), 7_mm);
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(StepSizeHintActorPropagation) {
+  GeometryContext gctx;
+  MagneticFieldContext mctx;
+
+  CylindricalTrackingGeometry cGeometry(gctx);
+  auto tGeometry = cGeometry();
+
+  using Stepper = EigenStepper<>;
+  using TestPropagator = Propagator<Stepper, Navigator>;
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, 2_T));
+  TestPropagator propagator(Stepper(bField), Navigator({tGeometry}));
+
+  StepSizeHintCache cache;
+  PropagatorOptions<ActionList<StepSizeHintActor>> options(gctx, mctx);
+  options.actionList.get<StepSizeHintActor>().cache = &cache;
+
+  CurvilinearTrackParameters start(Vector4(0, 0, 0, 0), 0.2, M_PI_2, 1 / 1_GeV,
+                                   std::nullopt, ParticleHypothesis::pion());
+
+  auto first = propagator.propagate(start, options);
+  BOOST_REQUIRE(first.ok());
+  BOOST_CHECK_GT(cache.size(), 0u);
+  const std::size_t nHints = cache.size();
+
+  // the same trajectory visits the same volumes and momentum bins
+  auto second = propagator.propagate(start, options);
+  BOOST_REQUIRE(second.ok());
+  BOOST_CHECK_EQUAL(cache.size(), nHints);
+  CHECK_CLOSE_ABS((*first).endParameters->position(gctx),
+                  (*second).endParameters->position(gctx), 10_um);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
@@ -310,7 +310,12 @@ BOOST_AUTO_TEST_CASE(sympy_stepper_test) {
   PropState ps(navDir, std::move(esState));
 
   ps.stepping.covTransport = false;
+  const std::size_t nLookupsBefore = ps.stepping.nFieldLookups;
+  const std::size_t nTrialsBefore = ps.stepping.nStepTrials;
   es.step(ps, mockNavigator).value();
+  // the constant field is only looked up once per step
+  BOOST_CHECK_GT(ps.stepping.nStepTrials, nTrialsBefore);
+  BOOST_CHECK_EQUAL(ps.stepping.nFieldLookups - nLookupsBefore, 1u);
   CHECK_CLOSE_COVARIANCE(ps.stepping.cov, cov, eps);
   BOOST_CHECK_NE(es.position(ps.stepping).norm(), newPos.norm());
   BOOST_CHECK_NE(es.direction(ps.stepping), newMom.normalized());
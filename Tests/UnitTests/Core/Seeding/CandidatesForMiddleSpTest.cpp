@@ -0,0 +1,60 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/CandidatesForMiddleSp.hpp"
+
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace Acts::Test {
+
+BOOST_AUTO_TEST_CASE(candidates_for_middle_sp_top_k) {
+  std::vector<SpacePoint> sps(3);
+  for (std::size_t i = 0; i < sps.size(); ++i) {
+    sps[i].m_x = i;
+    sps[i].m_y = i;
+    sps[i].m_z = i;
+  }
+
+  Acts::CandidatesForMiddleSp<const SpacePoint> collector;
+  collector.setMaxElements(3, 2);
+
+  // only the best candidates of each quality are kept
+  const std::vector<float> weights = {1., 5., 3., 4., 2., 6.};
+  for (const float w : weights) {
+    collector.push(sps[0], sps[1], sps[2], w, 0., false);
+    collector.push(sps[0], sps[1], sps[2], w + 0.5, 0., true);
+  }
+
+  auto& sorted = collector.sortedStorage();
+  const std::vector<float> expected = {6.5, 6., 5.5, 5., 4.};
+  BOOST_REQUIRE_EQUAL(sorted.size(), expected.size());
+  for (std::size_t i = 0; i < sorted.size(); ++i) {
+    BOOST_CHECK_EQUAL(sorted[i].weight, expected[i]);
+    BOOST_CHECK_EQUAL(sorted[i].isQuality, i % 2 == 0 && i < 4);
+  }
+
+  // the collection is emptied and the buffer is reused
+  const auto* data = sorted.data();
+  const auto capacity = sorted.capacity();
+  BOOST_CHECK(collector.storage().empty());
+  for (const float w : weights) {
+    collector.push(sps[0], sps[1], sps[2], w, 0., false);
+  }
+  auto& sortedAgain = collector.sortedStorage();
+  BOOST_CHECK_EQUAL(&sortedAgain, &sorted);
+  BOOST_CHECK_EQUAL(sortedAgain.size(), 3u);
+  BOOST_CHECK_EQUAL(sortedAgain.front().weight, 6.);
+  BOOST_CHECK_EQUAL(sortedAgain.data(), data);
+  BOOST_CHECK_EQUAL(sortedAgain.capacity(), capacity);
+}
+
+}  // namespace Acts::Test
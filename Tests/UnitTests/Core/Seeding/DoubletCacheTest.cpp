@@ -0,0 +1,103 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/DoubletCache.hpp"
+
+#include <limits>
+
+#include "SpacePoint.hpp"
+
+namespace Acts::Test {
+
+namespace {
+Acts::DoubletCuts makeCuts() {
+  Acts::DoubletCuts cuts;
+  cuts.deltaRMin = 5;
+  cuts.deltaRMax = 270;
+  cuts.collisionRegionMin = -150;
+  cuts.collisionRegionMax = 150;
+  cuts.cotThetaMax = 7.4;
+  cuts.deltaZMax = 500;
+  cuts.impactMax = 3;
+  cuts.minHelixDiameter2 = 1e5;
+  cuts.interactionPointCut = false;
+  return cuts;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(doublet_cuts_contains) {
+  const Acts::DoubletCuts loose = makeCuts();
+  BOOST_CHECK(loose.contains(loose));
+
+  Acts::DoubletCuts tight = loose;
+  tight.deltaRMin = 10;
+  tight.deltaRMax = 100;
+  tight.collisionRegionMin = -50;
+  tight.collisionRegionMax = 50;
+  tight.cotThetaMax = 3;
+  tight.deltaZMax = 200;
+  BOOST_CHECK(loose.contains(tight));
+  BOOST_CHECK(!tight.contains(loose));
+
+  // the deltaZ cut is dropped when the interaction point cut is applied
+  Acts::DoubletCuts ipCut = loose;
+  ipCut.interactionPointCut = true;
+  BOOST_CHECK(!loose.contains(ipCut));
+  BOOST_CHECK(!ipCut.contains(loose));
+  Acts::DoubletCuts noDeltaZ = loose;
+  noDeltaZ.deltaZMax = std::numeric_limits<float>::infinity();
+  BOOST_CHECK(noDeltaZ.contains(ipCut));
+
+  // the impact parameter has to match with the interaction point cut
+  Acts::DoubletCuts ipCutTight = ipCut;
+  ipCutTight.minHelixDiameter2 = 2e5;
+  BOOST_CHECK(ipCut.contains(ipCutTight));
+  BOOST_CHECK(!ipCutTight.contains(ipCut));
+  ipCutTight.impactMax = 1;
+  BOOST_CHECK(!ipCut.contains(ipCutTight));
+}
+
+BOOST_AUTO_TEST_CASE(doublet_cache_entries) {
+  Acts::DoubletCache<SpacePoint> cache;
+  BOOST_CHECK(!cache.isEnabled());
+
+  const Acts::DoubletCuts cuts = makeCuts();
+  BOOST_CHECK_EQUAL(cache.entry(0, true), nullptr);
+  BOOST_CHECK_EQUAL(cache.find(0, true, cuts), nullptr);
+
+  cache.reset(3);
+  BOOST_CHECK(cache.isEnabled());
+  BOOST_CHECK_EQUAL(cache.entry(3, true), nullptr);
+  BOOST_CHECK_EQUAL(cache.find(1, true, cuts), nullptr);
+
+  auto* entry = cache.entry(1, true);
+  BOOST_REQUIRE_NE(entry, nullptr);
+  entry->valid = true;
+  entry->cuts = cuts;
+  entry->doublets.resize(2);
+
+  BOOST_CHECK_EQUAL(cache.find(1, true, cuts), entry);
+  // top and bottom doublets are stored separately
+  BOOST_CHECK_EQUAL(cache.find(1, false, cuts), nullptr);
+
+  Acts::DoubletCuts looser = cuts;
+  looser.deltaRMax = 300;
+  BOOST_CHECK_EQUAL(cache.find(1, true, looser), nullptr);
+
+  cache.reset(3);
+  BOOST_CHECK_EQUAL(cache.find(1, true, cuts), nullptr);
+  BOOST_CHECK(cache.entry(1, true)->doublets.empty());
+
+  cache.clear();
+  BOOST_CHECK(!cache.isEnabled());
+  BOOST_CHECK_EQUAL(cache.entry(1, true), nullptr);
+}
+
+}  // namespace Acts::Test
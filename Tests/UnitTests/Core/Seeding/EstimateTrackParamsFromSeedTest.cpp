@@ -25,6 +25,7 @@
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Seeding/EstimateTrackParamsFromSeed.hpp"
+#include "Acts/Seeding/Seed.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
@@ -218,6 +219,27 @@ BOOST_AUTO_TEST_CASE(trackparameters_estimation_test) {
                           1e-2);
           // time is not estimated so we check if it is default zero
           CHECK_CLOSE_ABS(estFullParams[eBoundTime], 0, 1e-6);
+
+          // Test the batch estimator, which has to give identical results. The
+          // seed without a surface is skipped.
+          const Seed<SpacePoint> seed(*spacePointPtrs[0], *spacePointPtrs[1],
+                                      *spacePointPtrs[2], 0.);
+          const std::vector<Seed<SpacePoint>> seeds = {seed, seed, seed};
+          const std::vector<const Surface*> surfaces = {bottomSurface, nullptr,
+                                                        bottomSurface};
+          ConstantBField batchField(Vector3(0, 0, 2._T));
+          auto bCache = batchField.makeCache(magCtx);
+          SeedTrackParamsBatch batch;
+          auto batchRes = estimateTrackParamsFromSeeds(
+              geoCtx, seeds, surfaces, batchField, bCache, 0.1_T, batch,
+              *logger);
+          BOOST_REQUIRE(batchRes.ok());
+          BOOST_REQUIRE_EQUAL(batch.params.size(), seeds.size());
+          BOOST_CHECK(batch.valid[0]);
+          BOOST_CHECK(!batch.valid[1]);
+          BOOST_CHECK(batch.valid[2]);
+          BOOST_CHECK_EQUAL(batch.params[0], estFullParams);
+          BOOST_CHECK_EQUAL(batch.params[2], estFullParams);
         }
       }
     }
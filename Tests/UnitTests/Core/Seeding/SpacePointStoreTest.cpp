@@ -0,0 +1,261 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SpacePointData.hpp"
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Seeding/BinnedGroup.hpp"
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Seeding/SeedFinder.hpp"
+#include "Acts/Seeding/SeedFinderConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Seeding/SpacePointStore.hpp"
+#include "Acts/Utilities/Grid.hpp"
+#include "Acts/Utilities/GridBinFinder.hpp"
+
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace Acts::Test {
+
+using InternalSP = Acts::InternalSpacePoint<SpacePoint>;
+using TestGrid = Acts::Grid<std::vector<std::unique_ptr<InternalSP>>,
+                            Acts::detail::EquidistantAxis>;
+
+BOOST_AUTO_TEST_CASE(space_point_store_fill) {
+  // three bins in x, the middle one is left empty
+  TestGrid grid(std::make_tuple(Acts::detail::EquidistantAxis(0., 30., 3)));
+
+  std::vector<SpacePoint> externalSPs(5);
+  const std::vector<Acts::Vector3> positions = {
+      {5., 1., 10.}, {6., 2., 20.}, {25., 1., 30.}, {26., 3., 40.},
+      {27., 5., 50.}};
+  for (std::size_t i = 0; i < externalSPs.size(); ++i) {
+    externalSPs[i].m_x = positions[i].x();
+    externalSPs[i].m_y = positions[i].y();
+    externalSPs[i].m_z = positions[i].z();
+    externalSPs[i].varianceR = 0.1 * i;
+    externalSPs[i].varianceZ = 0.2 * i;
+  }
+
+  const Acts::Vector2 offset(0., 0.);
+  for (std::size_t i = 0; i < externalSPs.size(); ++i) {
+    const SpacePoint& sp = externalSPs[i];
+    Acts::Vector3 position(sp.x(), sp.y(), sp.z());
+    Acts::Vector2 variance(sp.varianceR, sp.varianceZ);
+    auto isp = std::make_unique<InternalSP>(i, sp, position, offset, variance,
+                                            std::nullopt);
+    grid.atPosition(Acts::ActsVector<1>(sp.x())).push_back(std::move(isp));
+  }
+
+  Acts::SpacePointStore<SpacePoint> store;
+  store.fill(grid);
+
+  BOOST_CHECK_EQUAL(store.size(), externalSPs.size());
+  // one range per bin, including under- and overflow
+  BOOST_CHECK_EQUAL(store.nBins(), grid.size());
+
+  using Point = Acts::ActsVector<1>;
+  const std::size_t bin0 = grid.globalBinFromPosition(Point(5.));
+  const std::size_t bin1 = grid.globalBinFromPosition(Point(15.));
+  const std::size_t bin2 = grid.globalBinFromPosition(Point(25.));
+
+  auto [first0, last0] = store.binRange(bin0);
+  auto [first1, last1] = store.binRange(bin1);
+  auto [first2, last2] = store.binRange(bin2);
+  BOOST_CHECK_EQUAL(last0 - first0, 2u);
+  BOOST_CHECK_EQUAL(last1 - first1, 0u);
+  BOOST_CHECK_EQUAL(last2 - first2, 3u);
+  BOOST_CHECK_EQUAL(last0, first1);
+  BOOST_CHECK_EQUAL(last1, first2);
+
+  // content is copied in grid order
+  for (std::size_t i = first2; i < last2; ++i) {
+    const InternalSP& isp = *grid.at(bin2)[i - first2];
+    BOOST_CHECK_EQUAL(store.x(i), isp.x());
+    BOOST_CHECK_EQUAL(store.y(i), isp.y());
+    BOOST_CHECK_EQUAL(store.z(i), isp.z());
+    BOOST_CHECK_EQUAL(store.radius(i), isp.radius());
+    BOOST_CHECK_EQUAL(store.phi(i), isp.phi());
+    BOOST_CHECK_EQUAL(store.varianceR(i), isp.varianceR());
+    BOOST_CHECK_EQUAL(store.varianceZ(i), isp.varianceZ());
+    BOOST_CHECK_EQUAL(store.index(i), isp.index());
+    BOOST_CHECK_EQUAL(&store.sp(i), &isp.sp());
+    BOOST_CHECK(!store.t(i).has_value());
+  }
+  BOOST_CHECK_EQUAL(store.radii().size(), store.size());
+
+  // radius lookup inside a bin
+  BOOST_CHECK_EQUAL(store.lowerBoundRadius(bin2, 0.), first2);
+  BOOST_CHECK_EQUAL(store.lowerBoundRadius(bin2, store.radius(first2 + 1)),
+                    first2 + 1);
+  BOOST_CHECK_EQUAL(store.lowerBoundRadius(bin2, 1000.), last2);
+  BOOST_CHECK_EQUAL(store.lowerBoundRadius(bin1, 0.), last1);
+
+  // strip information is only copied if available
+  Acts::SpacePointData spacePointData;
+  spacePointData.resize(externalSPs.size());
+  store.fillStripInfo(spacePointData);
+  BOOST_CHECK(!store.hasStripInfo());
+
+  spacePointData.resize(externalSPs.size(), true);
+  for (std::size_t i = 0; i < externalSPs.size(); ++i) {
+    spacePointData.setTopStripVector(i, Acts::Vector3(i, 0., 0.));
+  }
+  store.fillStripInfo(spacePointData);
+  BOOST_CHECK(store.hasStripInfo());
+  for (std::size_t i = 0; i < store.size(); ++i) {
+    BOOST_CHECK_EQUAL(store.topStripVector(i).x(), store.index(i));
+  }
+
+  store.clear();
+  BOOST_CHECK_EQUAL(store.size(), 0u);
+  BOOST_CHECK_EQUAL(store.nBins(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(space_point_store_seed_finder) {
+  using namespace Acts::UnitLiterals;
+  using Grid = Acts::CylindricalSpacePointGrid<SpacePoint>;
+  using Finder = Acts::SeedFinder<SpacePoint, Grid>;
+
+  // straight tracks from the beam line crossing four layers
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<float> cotThetaDist(-2., 2.);
+  std::uniform_real_distribution<float> z0Dist(-50., 50.);
+  std::vector<SpacePoint> externalSPs;
+  for (int track = 0; track < 200; ++track) {
+    const float phi = phiDist(rng);
+    const float cotTheta = cotThetaDist(rng);
+    const float z0 = z0Dist(rng);
+    for (int layer = 0; layer < 4; ++layer) {
+      const float r = 40. + 30. * layer;
+      externalSPs.push_back({r * std::cos(phi), r * std::sin(phi),
+                             z0 + r * cotTheta, r, layer, 0.01, 0.04,
+                             std::nullopt, std::nullopt});
+    }
+  }
+
+  Acts::SeedFilterConfig filterConfig;
+  filterConfig = filterConfig.toInternalUnits();
+  Acts::SeedFinderConfig<SpacePoint> config;
+  config.rMax = 160._mm;
+  config.deltaRMin = 5._mm;
+  config.deltaRMax = 160._mm;
+  config.deltaRMinTopSP = config.deltaRMin;
+  config.deltaRMinBottomSP = config.deltaRMin;
+  config.deltaRMaxTopSP = config.deltaRMax;
+  config.deltaRMaxBottomSP = config.deltaRMax;
+  config.collisionRegionMin = -250._mm;
+  config.collisionRegionMax = 250._mm;
+  config.zMin = -2800._mm;
+  config.zMax = 2800._mm;
+  config.cotThetaMax = 7.40627;
+  config.minPt = 500._MeV;
+  config.impactMax = 10._mm;
+  config.seedFilter =
+      std::make_unique<Acts::SeedFilter<SpacePoint>>(filterConfig);
+  config = config.toInternalUnits().calculateDerivedQuantities();
+  Acts::SeedFinderOptions options;
+  options.bFieldInZ = 2_T;
+  options = options.toInternalUnits().calculateDerivedQuantities(config);
+
+  Acts::CylindricalSpacePointGridConfig gridConfig;
+  gridConfig.minPt = 500._MeV;
+  gridConfig.rMax = 160._mm;
+  gridConfig.zMax = 2800._mm;
+  gridConfig.zMin = -2800._mm;
+  gridConfig.deltaRMax = 160._mm;
+  gridConfig.cotThetaMax = config.cotThetaMax;
+  Acts::CylindricalSpacePointGridOptions gridOptions;
+  gridOptions.bFieldInZ = 2_T;
+  Grid grid = Acts::CylindricalSpacePointGridCreator::createGrid<SpacePoint>(
+      gridConfig.toInternalUnits(), gridOptions.toInternalUnits());
+  std::vector<const SpacePoint*> spacePointPtrs;
+  for (const SpacePoint& sp : externalSPs) {
+    spacePointPtrs.push_back(&sp);
+  }
+  auto toGlobal = [](const SpacePoint& sp, float, float, float) {
+    return std::make_tuple(Acts::Vector3(sp.x(), sp.y(), sp.z()),
+                           Acts::Vector2(sp.varianceR, sp.varianceZ), sp.t());
+  };
+  Acts::Extent rRangeSPExtent;
+  Acts::CylindricalSpacePointGridCreator::fillGrid(
+      config, options, grid, spacePointPtrs.begin(), spacePointPtrs.end(),
+      toGlobal, rRangeSPExtent);
+
+  Acts::GridBinFinder<2ul> binFinder(1, std::vector<std::pair<int, int>>{});
+  Acts::CylindricalBinnedGroup<SpacePoint> groups(std::move(grid), binFinder,
+                                                  binFinder);
+  const Grid& groupedGrid = groups.grid();
+
+  Acts::SpacePointStore<SpacePoint> store;
+  store.fill(groupedGrid);
+
+  Finder finder(config);
+  Finder::SeedingState state;
+  state.spacePointData.resize(externalSPs.size());
+  Finder::SeedingState storeState;
+  storeState.spacePointData.resize(externalSPs.size());
+  storeState.spacePointStore = &store;
+
+  const Acts::Range1D<float> rMiddleSPRange;
+  std::size_t nSeeds = 0;
+  for (auto [bottom, middle, top] : groups) {
+    std::vector<Acts::Seed<SpacePoint>> seeds;
+    finder.createSeedsForGroup(options, state, groupedGrid,
+                               std::back_inserter(seeds), bottom, middle, top,
+                               rMiddleSPRange);
+    std::vector<Acts::Seed<SpacePoint>> storeSeeds;
+    finder.createSeedsForGroup(options, storeState, groupedGrid,
+                               std::back_inserter(storeSeeds), bottom, middle,
+                               top, rMiddleSPRange);
+
+    // reading the candidates from the store finds the same seeds
+    BOOST_REQUIRE_EQUAL(seeds.size(), storeSeeds.size());
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+      BOOST_CHECK(seeds[i].sp() == storeSeeds[i].sp());
+    }
+    nSeeds += seeds.size();
+  }
+  BOOST_CHECK_GT(nSeeds, 0u);
+
+  // a store that was filled from a different grid is rejected
+  Acts::SpacePointStore<SpacePoint> emptyStore;
+  emptyStore.fill(Grid(groupedGrid.axesTuple()));
+  storeState.spacePointStore = &emptyStore;
+  std::vector<Acts::Seed<SpacePoint>> seeds;
+  bool thrown = false;
+  for (auto [bottom, middle, top] : groups) {
+    try {
+      finder.createSeedsForGroup(options, storeState, groupedGrid,
+                                 std::back_inserter(seeds), bottom, middle,
+                                 top, rMiddleSPRange);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+      break;
+    }
+  }
+  BOOST_CHECK(thrown);
+}
+
+}  // namespace Acts::Test
@@ -18,7 +18,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -95,6 +97,35 @@ BOOST_AUTO_TEST_CASE(RectangleBoundsProperties) {
   BoundaryCheck bcheck(true, true);
   BOOST_CHECK(rect.inside(pointA, bcheck));
 }
+
+/// Unit test for the batched inside check, it has to agree with the single
+/// position check for all boundary check types
+BOOST_AUTO_TEST_CASE(RectangleBoundsInsideBatch) {
+  const RectangleBounds rect(Vector2(-2., -1.), Vector2(3., 4.));
+
+  std::vector<Vector2> points;
+  for (int ix = -8; ix <= 8; ++ix) {
+    for (int iy = -6; iy <= 10; ++iy) {
+      points.emplace_back(0.5 * ix + 0.25, 0.5 * iy + 0.25);
+    }
+  }
+
+  SquareMatrix2 cov;
+  cov << 0.5, 0., 0., 0.2;
+  std::vector<BoundaryCheck> checks = {
+      BoundaryCheck(false), BoundaryCheck(true),
+      BoundaryCheck(true, false, 0.5, 0.), BoundaryCheck(true, true, 0.5, 1.),
+      BoundaryCheck(cov, 1.)};
+
+  std::unique_ptr<bool[]> results(new bool[points.size()]);
+  for (const auto& bcheck : checks) {
+    rect.insideBatch(points.data(), points.size(), bcheck, results.get());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      BOOST_CHECK_EQUAL(results[i], rect.inside(points[i], bcheck));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(RectangleBoundsAssignment) {
   const double halfX(10.), halfY(2.);
   RectangleBounds rectA(halfX, halfY);
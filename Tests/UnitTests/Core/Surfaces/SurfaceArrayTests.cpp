@@ -11,6 +11,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/DetectorElementBase.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/PlanarBounds.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
@@ -21,10 +22,12 @@
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 #include "Acts/Utilities/detail/AxisFwd.hpp"
 #include "Acts/Utilities/detail/grid_helper.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <fstream>
@@ -178,6 +181,30 @@ struct SurfaceArrayFixture {
   }
 };
 
+/// Detector element which can be moved after the surface array is built
+class MovableElement : public DetectorElementBase {
+ public:
+  MovableElement(const Transform3& transform,
+                 std::shared_ptr<const PlanarBounds> bounds)
+      : m_transform(transform),
+        m_surface(Surface::makeShared<PlaneSurface>(std::move(bounds), *this)) {
+  }
+
+  const Transform3& transform(const GeometryContext& /*gctx*/) const override {
+    return m_transform;
+  }
+  const Surface& surface() const override { return *m_surface; }
+  Surface& surface() override { return *m_surface; }
+  double thickness() const override { return 0.; }
+
+  const std::shared_ptr<Surface>& surfacePtr() const { return m_surface; }
+
+  Transform3 m_transform;
+
+ private:
+  std::shared_ptr<Surface> m_surface;
+};
+
 BOOST_AUTO_TEST_SUITE(Surfaces)
 
 BOOST_FIXTURE_TEST_CASE(SurfaceArray_create, SurfaceArrayFixture) {
@@ -241,6 +268,170 @@ BOOST_FIXTURE_TEST_CASE(SurfaceArray_create, SurfaceArrayFixture) {
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(SurfaceArray_uniqueNeighbors, SurfaceArrayFixture) {
+  GeometryContext tgContext = GeometryContext();
+
+  SrfVec brl = makeBarrel(30, 7, 2, 1);
+  std::vector<const Surface*> brlRaw = unpack_shared_vector(brl);
+
+  // twice as many phi bins as surfaces, every surface fills two bins
+  detail::Axis<detail::AxisType::Equidistant, detail::AxisBoundaryType::Closed>
+      phiAxis(-M_PI, M_PI, 60u);
+  detail::Axis<detail::AxisType::Equidistant, detail::AxisBoundaryType::Bound>
+      zAxis(-14, 14, 7u);
+
+  double angleShift = 2 * M_PI / 30. / 2.;
+  auto transform = [angleShift](const Vector3& pos) {
+    return Vector2(phi(pos) + angleShift, pos.z());
+  };
+  double R = 10;
+  auto itransform = [angleShift, R](const Vector2& loc) {
+    return Vector3(R * std::cos(loc[0] - angleShift),
+                   R * std::sin(loc[0] - angleShift), loc[1]);
+  };
+
+  auto sl = std::make_unique<
+      SurfaceArray::SurfaceGridLookup<decltype(phiAxis), decltype(zAxis)>>(
+      transform, itransform,
+      std::make_tuple(std::move(phiAxis), std::move(zAxis)));
+  sl->completeBinning(tgContext, brlRaw);
+  SurfaceArray sa(std::move(sl), brl);
+
+  std::vector<const Surface*> neighbors =
+      sa.neighbors(itransform(Vector2(0, 0)));
+  std::vector<const Surface*> unique = neighbors;
+  std::sort(unique.begin(), unique.end());
+  unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+  BOOST_CHECK_EQUAL(neighbors.size(), unique.size());
+  BOOST_CHECK_LT(neighbors.size(), 9u);
+}
+
+BOOST_FIXTURE_TEST_CASE(SurfaceArray_parallelFill, SurfaceArrayFixture) {
+  GeometryContext tgContext = GeometryContext();
+
+  SrfVec brl = makeBarrel(30, 7, 2, 1);
+  std::vector<const Surface*> brlRaw = unpack_shared_vector(brl);
+
+  // a fine binning with mostly completed bins, split over several threads
+  double angleShift = 2 * M_PI / 30. / 2.;
+  auto transform = [angleShift](const Vector3& pos) {
+    return Vector2(phi(pos) + angleShift, pos.z());
+  };
+  double R = 10;
+  auto itransform = [angleShift, R](const Vector2& loc) {
+    return Vector3(R * std::cos(loc[0] - angleShift),
+                   R * std::sin(loc[0] - angleShift), loc[1]);
+  };
+  auto makeArray = [&](std::size_t numThreads) {
+    setMaxThreads(numThreads);
+    detail::Axis<detail::AxisType::Equidistant,
+                 detail::AxisBoundaryType::Closed>
+        phiAxis(-M_PI, M_PI, 120u);
+    detail::Axis<detail::AxisType::Equidistant, detail::AxisBoundaryType::Bound>
+        zAxis(-14, 14, 28u);
+    auto sl = std::make_unique<
+        SurfaceArray::SurfaceGridLookup<decltype(phiAxis), decltype(zAxis)>>(
+        transform, itransform,
+        std::make_tuple(std::move(phiAxis), std::move(zAxis)),
+        std::vector<BinningValue>{});
+    sl->fill(tgContext, brlRaw);
+    sl->completeBinning(tgContext, brlRaw);
+    setMaxThreads(1);
+    return SurfaceArray(std::move(sl), brl);
+  };
+  SurfaceArray serial = makeArray(1);
+  SurfaceArray parallel = makeArray(4);
+
+  BOOST_CHECK_EQUAL(serial.size(), parallel.size());
+  for (std::size_t bin = 0; bin < serial.size(); ++bin) {
+    BOOST_CHECK(serial.at(bin) == parallel.at(bin));
+    if (!serial.isValidBin(bin)) {
+      continue;
+    }
+    SurfaceSpan expected = serial.neighbors(serial.getBinCenter(bin));
+    SurfaceSpan neighbors = parallel.neighbors(parallel.getBinCenter(bin));
+    BOOST_CHECK_EQUAL_COLLECTIONS(neighbors.begin(), neighbors.end(),
+                                  expected.begin(), expected.end());
+    BOOST_CHECK(!neighbors.empty());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SurfaceArray_update) {
+  GeometryContext tgContext = GeometryContext();
+
+  // 10 surfaces along z in 12 bins, two bins are completed
+  auto bounds = std::make_shared<const RectangleBounds>(2, 1);
+  std::vector<std::unique_ptr<MovableElement>> elements;
+  SrfVec surfaces;
+  for (std::size_t i = 0; i < 10; ++i) {
+    Transform3 trans = Transform3::Identity();
+    trans.translate(Vector3(10, 0, -16.5 + 3. * i));
+    elements.push_back(std::make_unique<MovableElement>(trans, bounds));
+    surfaces.push_back(elements.back()->surfacePtr());
+  }
+  std::vector<const Surface*> surfacesRaw = unpack_shared_vector(surfaces);
+
+  using Lookup = SurfaceArray::SurfaceGridLookup<
+      detail::Axis<detail::AxisType::Equidistant,
+                   detail::AxisBoundaryType::Bound>>;
+  auto makeLookup = [&]() {
+    detail::Axis<detail::AxisType::Equidistant,
+                 detail::AxisBoundaryType::Bound>
+        zAxis(-18, 18, 12u);
+    auto transform = [](const Vector3& pos) {
+      return std::array<double, 1>({pos.z()});
+    };
+    auto itransform = [](const std::array<double, 1>& loc) {
+      return Vector3(10, 0, loc[0]);
+    };
+    auto sl = std::make_unique<Lookup>(transform, itransform,
+                                       std::make_tuple(std::move(zAxis)));
+    sl->fill(tgContext, surfacesRaw);
+    sl->completeBinning(tgContext, surfacesRaw);
+    return sl;
+  };
+  SurfaceArray sa(makeLookup(), surfaces);
+
+  auto checkAgainstRebuilt = [&]() {
+    SurfaceArray rebuilt(makeLookup(), surfaces);
+    for (std::size_t bin = 0; bin < sa.size(); ++bin) {
+      if (!sa.isValidBin(bin)) {
+        continue;
+      }
+      std::vector<const Surface*> content = sa.at(bin);
+      std::vector<const Surface*> expected = rebuilt.at(bin);
+      std::sort(content.begin(), content.end());
+      std::sort(expected.begin(), expected.end());
+      BOOST_CHECK(content == expected);
+
+      std::vector<const Surface*> neighbors =
+          sa.neighbors(sa.getBinCenter(bin));
+      std::vector<const Surface*> expectedNeighbors =
+          rebuilt.neighbors(rebuilt.getBinCenter(bin));
+      std::sort(neighbors.begin(), neighbors.end());
+      std::sort(expectedNeighbors.begin(), expectedNeighbors.end());
+      BOOST_CHECK(neighbors == expectedNeighbors);
+    }
+  };
+
+  // A small shift keeps the surface in its bin
+  elements[3]->m_transform.translate(Vector3(0, 0, 0.1));
+  BOOST_CHECK_EQUAL(sa.update(tgContext, {surfacesRaw[3]}), 0u);
+  checkAgainstRebuilt();
+
+  // Move one surface into a completed bin and empty its own bin
+  elements[0]->m_transform.translate(Vector3(0, 0, 30));
+  BOOST_CHECK_EQUAL(sa.update(tgContext, {surfacesRaw[0]}), 1u);
+  checkAgainstRebuilt();
+
+  // Move two surfaces at once, one of them into an occupied bin
+  elements[5]->m_transform.translate(Vector3(0, 0, -6));
+  elements[9]->m_transform.translate(Vector3(0, 0, 3));
+  BOOST_CHECK_EQUAL(sa.update(tgContext, {surfacesRaw[5], surfacesRaw[9]}),
+                    2u);
+  checkAgainstRebuilt();
+}
+
 BOOST_AUTO_TEST_CASE(SurfaceArray_singleElement) {
   double w = 3, h = 4;
   auto bounds = std::make_shared<const RectangleBounds>(w, h);
@@ -19,8 +19,10 @@
 #include "Acts/Surfaces/ConeSurface.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/LineSurface.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RegularSurface.hpp"
 #include "Acts/Surfaces/StrawSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
@@ -28,9 +30,11 @@
 #include "Acts/Utilities/UnitVectors.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <memory>
 #include <ostream>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -71,6 +75,54 @@ void runTest(const Surface& surface, double l0, double l1, double phi,
   CHECK_CLOSE_OR_SMALL(lpResult.value()[ePos1], l1, eps, eps);
 }
 
+// the batch conversions must agree with the single position ones
+void runBatchTest(const RegularSurface& surface,
+                  const std::vector<Vector2>& lpositions) {
+  std::vector<Vector3> positions;
+  surface.localToGlobalBatch(geoCtx, lpositions, positions);
+  BOOST_CHECK_EQUAL(positions.size(), lpositions.size());
+  std::vector<Vector2> converted;
+  BOOST_CHECK(surface.globalToLocalBatch(geoCtx, positions, converted).ok());
+  BOOST_CHECK_EQUAL(converted.size(), positions.size());
+  for (std::size_t i = 0; i < lpositions.size(); ++i) {
+    Vector3 pos = surface.localToGlobal(geoCtx, lpositions[i]);
+    CHECK_CLOSE_OR_SMALL(positions[i], pos, eps, eps);
+    auto lpResult = surface.globalToLocal(geoCtx, pos);
+    BOOST_CHECK(lpResult.ok());
+    CHECK_CLOSE_OR_SMALL(converted[i], lpResult.value(), eps, eps);
+  }
+
+  // a single position off the surface fails the whole batch
+  positions.push_back(positions.front() +
+                      surface.normal(geoCtx, lpositions.front()));
+  BOOST_CHECK(!surface.globalToLocalBatch(geoCtx, positions, converted).ok());
+}
+
+void runBatchTest(const LineSurface& surface,
+                  const std::vector<Vector2>& lpositions,
+                  const std::vector<Vector3>& directions) {
+  std::vector<Vector3> positions;
+  surface.localToGlobalBatch(geoCtx, lpositions, directions, positions);
+  BOOST_CHECK_EQUAL(positions.size(), lpositions.size());
+  std::vector<Vector2> converted;
+  BOOST_CHECK(
+      surface.globalToLocalBatch(geoCtx, positions, directions, converted)
+          .ok());
+  BOOST_CHECK_EQUAL(converted.size(), positions.size());
+  for (std::size_t i = 0; i < lpositions.size(); ++i) {
+    Vector3 pos = surface.localToGlobal(geoCtx, lpositions[i], directions[i]);
+    CHECK_CLOSE_OR_SMALL(positions[i], pos, eps, eps);
+    auto lpResult = surface.globalToLocal(geoCtx, pos, directions[i]);
+    BOOST_CHECK(lpResult.ok());
+    CHECK_CLOSE_OR_SMALL(converted[i], lpResult.value(), eps, eps);
+  }
+
+  std::vector<Vector3> tooFew(directions.begin(), directions.end() - 1);
+  BOOST_CHECK_THROW(
+      surface.localToGlobalBatch(geoCtx, lpositions, tooFew, positions),
+      std::invalid_argument);
+}
+
 // test datasets
 
 // local positions
@@ -159,4 +211,43 @@ BOOST_DATA_TEST_CASE(
   runTest(*surface, lr, lz, phi, theta);
 }
 
+BOOST_AUTO_TEST_CASE(BatchConversion) {
+  std::vector<Vector2> symmetric;
+  std::vector<Vector2> polar;
+  std::vector<Vector3> directions;
+  for (double l0 = -1.0; l0 < 1.0; l0 += 0.25) {
+    for (double l1 = -1.0; l1 < 1.0; l1 += 0.25) {
+      symmetric.emplace_back(l0, l1);
+      polar.emplace_back(l0 + 1.25, M_PI * l1);
+      directions.push_back(makeDirectionFromPhiTheta(M_PI * l0, M_PI_2 + l1));
+    }
+  }
+
+  // the test case names of this suite hide the surface types
+  runBatchTest(*Surface::makeShared<Acts::PlaneSurface>(Vector3(1, 2, 3),
+                                                        Vector3::UnitX()),
+               symmetric);
+  runBatchTest(*Surface::makeShared<Acts::PlaneSurface>(
+                   Vector3(-2, -3, -4), Vector3(1, 1, 1).normalized()),
+               symmetric);
+  Transform3 shifted(Translation3(Vector3(1, -2, 3)) *
+                     AngleAxis3(0.3, Vector3(1, 1, 0).normalized()));
+  runBatchTest(*Surface::makeShared<Acts::DiscSurface>(shifted, 0, 100),
+               polar);
+  runBatchTest(*Surface::makeShared<Acts::CylinderSurface>(shifted, 10., 100),
+               symmetric);
+  runBatchTest(*Surface::makeShared<Acts::StrawSurface>(shifted, 2., 200.),
+               symmetric, directions);
+
+  // empty batches never access the positions
+  std::vector<Vector3> positions(3);
+  std::vector<Vector2> lpositions(3);
+  auto plane = Surface::makeShared<Acts::PlaneSurface>(Vector3(1, 2, 3),
+                                                       Vector3::UnitX());
+  plane->localToGlobalBatch(geoCtx, {}, positions);
+  BOOST_CHECK(positions.empty());
+  BOOST_CHECK(plane->globalToLocalBatch(geoCtx, {}, lpositions).ok());
+  BOOST_CHECK(lpositions.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
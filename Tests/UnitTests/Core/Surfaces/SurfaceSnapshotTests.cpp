@@ -0,0 +1,120 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/AnnulusBounds.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/LineBounds.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceSnapshot.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts::Test {
+
+GeometryContext tgContext = GeometryContext();
+
+namespace {
+void checkEqual(const Surface& written, const Surface& read) {
+  BOOST_CHECK_EQUAL(written.geometryId(), read.geometryId());
+  BOOST_CHECK_EQUAL(written.type(), read.type());
+  BOOST_CHECK(written.bounds() == read.bounds());
+  BOOST_CHECK(
+      written.transform(tgContext).isApprox(read.transform(tgContext)));
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Surfaces)
+
+BOOST_AUTO_TEST_CASE(SurfaceSnapshotRoundTrip) {
+  Transform3 transform(Translation3(1_mm, 2_mm, 3_mm) *
+                       AngleAxis3(0.3, Vector3(1, 1, 0).normalized()));
+  auto rBounds = std::make_shared<RectangleBounds>(10_mm, 20_mm);
+
+  std::vector<std::shared_ptr<Surface>> written = {
+      Surface::makeShared<PlaneSurface>(transform, rBounds),
+      Surface::makeShared<PlaneSurface>(Transform3::Identity(), rBounds),
+      Surface::makeShared<PlaneSurface>(transform),
+      Surface::makeShared<DiscSurface>(
+          transform, std::make_shared<AnnulusBounds>(50_mm, 100_mm, -0.1,
+                                                     0.1, Vector2(1_mm, 0))),
+      Surface::makeShared<CylinderSurface>(
+          transform, std::make_shared<CylinderBounds>(30_mm, 100_mm)),
+      Surface::makeShared<StrawSurface>(
+          transform, std::make_shared<LineBounds>(1_mm, 500_mm)),
+      Surface::makeShared<PerigeeSurface>(Vector3(0, 0, 1_mm))};
+  std::vector<const Surface*> writtenPtrs;
+  for (std::size_t i = 0; i < written.size(); ++i) {
+    written[i]->assignGeometryId(GeometryIdentifier().setVolume(1).setSensitive(
+        static_cast<GeometryIdentifier::Value>(i + 1)));
+    writtenPtrs.push_back(written[i].get());
+  }
+
+  std::stringstream snapshot;
+  SurfaceSnapshot::write(snapshot, tgContext, writtenPtrs);
+  auto read = SurfaceSnapshot::read(snapshot);
+
+  BOOST_REQUIRE_EQUAL(read.size(), written.size());
+  for (std::size_t i = 0; i < written.size(); ++i) {
+    checkEqual(*written[i], *read[i]);
+  }
+  // the shared bounds are shared again
+  BOOST_CHECK_EQUAL(&read[0]->bounds(), &read[1]->bounds());
+
+  // a snapshot of a different version is refused
+  std::string data = snapshot.str();
+  data[8] = static_cast<char>(SurfaceSnapshot::s_version + 1);
+  BOOST_CHECK_THROW(SurfaceSnapshot::read(data.data(), data.size()),
+                    std::runtime_error);
+  // a truncated snapshot is refused
+  data = snapshot.str();
+  BOOST_CHECK_THROW(SurfaceSnapshot::read(data.data(), data.size() - 1),
+                    std::runtime_error);
+  BOOST_CHECK_THROW(SurfaceSnapshot::read("ACTS", 4), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(SurfaceSnapshotTrackingGeometry) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  std::vector<const Surface*> written;
+  tGeometry->visitSurfaces(
+      [&](const Surface* surface) { written.push_back(surface); }, false);
+
+  std::stringstream snapshot;
+  SurfaceSnapshot::write(snapshot, tgContext, written);
+  auto read = SurfaceSnapshot::read(snapshot);
+
+  BOOST_REQUIRE_EQUAL(read.size(), written.size());
+  for (std::size_t i = 0; i < written.size(); ++i) {
+    checkEqual(*written[i], *read[i]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
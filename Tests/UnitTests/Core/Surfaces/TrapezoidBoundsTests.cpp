@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <ostream>
 #include <random>
 #include <stdexcept>
@@ -204,6 +205,34 @@ BOOST_DATA_TEST_CASE(
                     trapezoidBoundsObject.inside({x, y}, bc));
 }
 
+/// Unit test for the batched inside check, it has to agree with the single
+/// position check for all boundary check types
+BOOST_AUTO_TEST_CASE(TrapezoidBoundsInsideBatch) {
+  const TrapezoidBounds trapezoid(1., 6., 2., 0.3);
+
+  std::mt19937 rng(23);
+  std::uniform_real_distribution<double> xDist(-7, 7);
+  std::uniform_real_distribution<double> yDist(-3, 3);
+  std::vector<Vector2> points(1000);
+  std::generate(points.begin(), points.end(),
+                [&] { return Vector2(xDist(rng), yDist(rng)); });
+
+  SquareMatrix2 cov;
+  cov << 0.5, 0., 0., 0.2;
+  std::vector<BoundaryCheck> checks = {
+      BoundaryCheck(false), BoundaryCheck(true),
+      BoundaryCheck(true, true, 0.2, 0.1), BoundaryCheck(cov, 1.)};
+
+  std::array<bool, 1000> results{};
+  for (const auto& bcheck : checks) {
+    trapezoid.insideBatch(points.data(), points.size(), bcheck,
+                          results.data());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      BOOST_CHECK_EQUAL(results[i], trapezoid.inside(points[i], bcheck));
+    }
+  }
+}
+
 /// Unit test for testing TrapezoidBounds assignment
 BOOST_AUTO_TEST_CASE(TrapezoidBoundsAssignment) {
   double minHalfX(1.), maxHalfX(6.), halfY(2.);
@@ -34,6 +34,7 @@
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/LineSurfaceStub.hpp"
 #include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
@@ -148,6 +149,49 @@ struct TestContainerAccessor {
   }
 };
 
+/// Window which keeps the source link closest to the prediction in the first
+/// measured coordinate
+struct TestSourceLinkWindow {
+  mutable std::size_t nCalls = 0;
+
+  template <typename iterator_t>
+  std::pair<iterator_t, iterator_t> window(
+      const Acts::BoundTrackParameters& predicted, iterator_t begin,
+      iterator_t end) const {
+    ++nCalls;
+    auto distance = [&](const iterator_t& it) {
+      const auto& sl = (*it).template get<TestSourceLink>();
+      return std::abs(sl.parameters[0] - predicted.parameters()[sl.indices[0]]);
+    };
+    iterator_t closest = begin;
+    for (iterator_t it = begin; it != end; ++it) {
+      if (distance(it) < distance(closest)) {
+        closest = it;
+      }
+    }
+    iterator_t next = closest;
+    return {closest, ++next};
+  }
+};
+
+/// Pre-selector which accepts the source links close to the prediction in the
+/// first measured coordinate
+struct TestSourceLinkPreSelector {
+  double maxDistance = 0;
+  mutable std::size_t nAccepted = 0;
+  mutable std::size_t nRejected = 0;
+
+  bool isCompatible(const Acts::BoundTrackParameters& predicted,
+                    const Acts::SourceLink& sourceLink) const {
+    const auto& sl = sourceLink.template get<TestSourceLink>();
+    bool compatible =
+        std::abs(sl.parameters[0] - predicted.parameters()[sl.indices[0]]) <
+        maxDistance;
+    ++(compatible ? nAccepted : nRejected);
+    return compatible;
+  }
+};
+
 struct Fixture {
   using StraightPropagator =
       Acts::Propagator<Acts::StraightLineStepper, Acts::Navigator>;
@@ -410,4 +454,222 @@ BOOST_AUTO_TEST_CASE(ZeroFieldBackward) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(SourceLinkWindow) {
+  Fixture f(0_T);
+
+  auto options = f.makeCkfOptions();
+  options.propagatorPlainOptions.direction = Acts::Direction::Forward;
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+  options.sourcelinkAccessor.connect<&Fixture::TestSourceLinkAccessor::range>(
+      &slAccessor);
+
+  TestSourceLinkWindow slWindow;
+  options.sourceLinkWindow.connect<
+      &TestSourceLinkWindow::window<Fixture::TestSourceLinkAccessor::Iterator>>(
+      &slWindow);
+
+  Acts::TrackContainer tc{Acts::VectorTrackContainer{},
+                          Acts::VectorMultiTrajectory{}};
+
+  for (std::size_t trackId = 0u; trackId < f.startParameters.size();
+       ++trackId) {
+    auto res = f.ckf.findTracks(f.startParameters.at(trackId), options, tc);
+    BOOST_REQUIRE(res.ok());
+  }
+
+  // The window is applied on every surface with source links
+  BOOST_CHECK_EQUAL(slWindow.nCalls,
+                    f.startParameters.size() * f.detector.numMeasurements);
+
+  // Only the source link within the window is calibrated, which is the one
+  // of the right track
+  BOOST_REQUIRE_EQUAL(tc.size(), 3u);
+  for (std::size_t trackId = 0u; trackId < f.startParameters.size();
+       ++trackId) {
+    const auto track = tc.getTrack(trackId);
+    BOOST_CHECK_EQUAL(track.nTrackStates(), f.detector.numMeasurements);
+    for (const auto trackState : track.trackStatesReversed()) {
+      auto sl =
+          trackState.getUncalibratedSourceLink().template get<TestSourceLink>();
+      BOOST_CHECK_EQUAL(sl.sourceId, trackId);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SourceLinkPreSelector) {
+  Fixture f(0_T);
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  // Without compatible source links all of them are calibrated
+  for (double maxDistance : {1_mm, 0.}) {
+    auto options = f.makeCkfOptions();
+    options.propagatorPlainOptions.direction = Acts::Direction::Forward;
+    options.sourcelinkAccessor
+        .connect<&Fixture::TestSourceLinkAccessor::range>(&slAccessor);
+
+    TestSourceLinkPreSelector preSelector{maxDistance};
+    options.extensions.sourceLinkPreSelector
+        .connect<&TestSourceLinkPreSelector::isCompatible>(&preSelector);
+
+    Acts::TrackContainer tc{Acts::VectorTrackContainer{},
+                            Acts::VectorMultiTrajectory{}};
+
+    for (std::size_t trackId = 0u; trackId < f.startParameters.size();
+         ++trackId) {
+      auto res = f.ckf.findTracks(f.startParameters.at(trackId), options, tc);
+      BOOST_REQUIRE(res.ok());
+    }
+
+    if (maxDistance > 0) {
+      BOOST_CHECK_EQUAL(preSelector.nAccepted,
+                        f.startParameters.size() * f.detector.numMeasurements);
+    } else {
+      BOOST_CHECK_EQUAL(preSelector.nAccepted, 0u);
+    }
+    BOOST_CHECK_GT(preSelector.nRejected, 0u);
+
+    BOOST_REQUIRE_EQUAL(tc.size(), 3u);
+    for (std::size_t trackId = 0u; trackId < f.startParameters.size();
+         ++trackId) {
+      const auto track = tc.getTrack(trackId);
+      BOOST_CHECK_EQUAL(track.nTrackStates(), f.detector.numMeasurements);
+      for (const auto trackState : track.trackStatesReversed()) {
+        auto sl = trackState.getUncalibratedSourceLink()
+                      .template get<TestSourceLink>();
+        BOOST_CHECK_EQUAL(sl.sourceId, trackId);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CompactTrackStates) {
+  Fixture f(0_T);
+
+  // Allow two branches per surface with a chi2 cut such that most of them
+  // are dropped again
+  f.measSel = Acts::MeasurementSelector(Acts::MeasurementSelector::Config{
+      {Acts::GeometryIdentifier(), {{}, {100.}, {2u}}}});
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  auto findTracks = [&](bool compact) {
+    auto options = f.makeCkfOptions();
+    options.compactTrackStates = compact;
+    options.sourcelinkAccessor
+        .connect<&Fixture::TestSourceLinkAccessor::range>(&slAccessor);
+
+    Acts::TrackContainer tc{Acts::VectorTrackContainer{},
+                            Acts::VectorMultiTrajectory{}};
+    for (const auto& parameters : f.startParameters) {
+      auto res = f.ckf.findTracks(parameters, options, tc);
+      BOOST_REQUIRE(res.ok());
+    }
+    return tc;
+  };
+
+  auto expected = findTracks(false);
+  auto compacted = findTracks(true);
+
+  BOOST_CHECK_GT(expected.size(), f.startParameters.size());
+  BOOST_REQUIRE_EQUAL(compacted.size(), expected.size());
+  BOOST_CHECK_LT(compacted.trackStateContainer().size(),
+                 expected.trackStateContainer().size());
+
+  for (std::size_t itrack = 0; itrack < expected.size(); ++itrack) {
+    const auto track = compacted.getTrack(itrack);
+    const auto expectedTrack = expected.getTrack(itrack);
+    BOOST_CHECK_EQUAL(track.nTrackStates(), expectedTrack.nTrackStates());
+    BOOST_CHECK_EQUAL(track.nMeasurements(), expectedTrack.nMeasurements());
+    CHECK_CLOSE_REL(track.chi2(), expectedTrack.chi2(), 1e-6);
+
+    auto states = track.trackStatesReversed();
+    auto expectedStates = expectedTrack.trackStatesReversed();
+    auto it = states.begin();
+    for (const auto expectedState : expectedStates) {
+      BOOST_REQUIRE(it != states.end());
+      BOOST_CHECK(
+          (*it).getUncalibratedSourceLink().template get<TestSourceLink>() ==
+          expectedState.getUncalibratedSourceLink()
+              .template get<TestSourceLink>());
+      CHECK_CLOSE_REL((*it).filtered(), expectedState.filtered(), 1e-9);
+      ++it;
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(StaticExtensions) {
+  Fixture f(0_T);
+
+  using Trajectory = Fixture::Trajectory;
+  using TrackStateProxy = Trajectory::TrackStateProxy;
+  using Candidates = std::vector<TrackStateProxy>;
+  using DefaultExtensions =
+      Acts::CombinatorialKalmanFilterExtensions<Trajectory>;
+
+  // Same components as the fixture, but bound at compile time
+  struct Extensions {
+    Acts::StaticDelegate<void(const Acts::GeometryContext&,
+                              const Acts::CalibrationContext&,
+                              const Acts::SourceLink&, TrackStateProxy),
+                         &testSourceLinkCalibrator<Trajectory>>
+        calibrator;
+    Acts::StaticDelegate<Acts::Result<void>(const Acts::GeometryContext&,
+                                            TrackStateProxy, Acts::Direction,
+                                            const Acts::Logger&),
+                         &Fixture::KalmanUpdater::operator()<Trajectory>,
+                         Fixture::KalmanUpdater>
+        updater;
+    Acts::StaticDelegate<
+        Acts::Result<std::pair<Candidates::iterator, Candidates::iterator>>(
+            Candidates&, bool&, const Acts::Logger&),
+        &Acts::MeasurementSelector::select<Trajectory>,
+        Acts::MeasurementSelector>
+        measurementSelector;
+    DefaultExtensions::BranchStopper branchStopper;
+    DefaultExtensions::SourceLinkPreSelector sourceLinkPreSelector;
+  };
+  Extensions extensions{{},
+                        decltype(Extensions::updater)(&f.kfUpdater),
+                        decltype(Extensions::measurementSelector)(&f.measSel),
+                        DefaultExtensions{}.branchStopper,
+                        {}};
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  Acts::CombinatorialKalmanFilterOptions<
+      Fixture::TestSourceLinkAccessor::Iterator, Trajectory, Extensions>
+      options(f.geoCtx, f.magCtx, f.calCtx, {}, extensions,
+              Acts::PropagatorPlainOptions());
+  options.sourcelinkAccessor.connect<&Fixture::TestSourceLinkAccessor::range>(
+      &slAccessor);
+  auto expectedOptions = f.makeCkfOptions();
+  expectedOptions.sourcelinkAccessor
+      .connect<&Fixture::TestSourceLinkAccessor::range>(&slAccessor);
+
+  Acts::TrackContainer tc{Acts::VectorTrackContainer{},
+                          Acts::VectorMultiTrajectory{}};
+  Acts::TrackContainer expected{Acts::VectorTrackContainer{},
+                                Acts::VectorMultiTrajectory{}};
+  for (const auto& parameters : f.startParameters) {
+    BOOST_REQUIRE(f.ckf.findTracks(parameters, options, tc).ok());
+    BOOST_REQUIRE(
+        f.ckf.findTracks(parameters, expectedOptions, expected).ok());
+  }
+
+  BOOST_REQUIRE_EQUAL(tc.size(), expected.size());
+  for (std::size_t itrack = 0; itrack < expected.size(); ++itrack) {
+    const auto track = tc.getTrack(itrack);
+    const auto expectedTrack = expected.getTrack(itrack);
+    BOOST_CHECK_EQUAL(track.nTrackStates(), f.detector.numMeasurements);
+    BOOST_CHECK_EQUAL(track.nTrackStates(), expectedTrack.nTrackStates());
+    BOOST_CHECK_EQUAL(track.chi2(), expectedTrack.chi2());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
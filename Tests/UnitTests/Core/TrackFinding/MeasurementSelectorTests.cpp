@@ -0,0 +1,175 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::detail::Test;
+
+using TrackStateProxy = VectorMultiTrajectory::TrackStateProxy;
+
+std::mt19937 rng(42);
+std::uniform_real_distribution<double> uniform(0.1, 1.);
+
+/// Create candidates on one surface which share the predicted state, as
+/// the CKF does. The measurement dimension of each candidate is given.
+std::vector<TrackStateProxy> makeCandidates(
+    VectorMultiTrajectory& traj, const std::vector<std::size_t>& sizes) {
+  auto surface =
+      Surface::makeShared<PlaneSurface>(Vector3::Zero(), Vector3::UnitZ());
+
+  BoundVector predicted;
+  BoundSquareMatrix predictedCovariance = BoundSquareMatrix::Zero();
+  for (std::size_t i = 0; i < eBoundSize; ++i) {
+    predicted[i] = uniform(rng);
+    predictedCovariance(i, i) = uniform(rng);
+  }
+  predictedCovariance(eBoundLoc0, eBoundLoc1) =
+      predictedCovariance(eBoundLoc1, eBoundLoc0) = 0.02;
+
+  std::vector<TrackStateProxy> candidates;
+  for (std::size_t size : sizes) {
+    SourceLink sl{TestSourceLink{}};
+    auto ts = traj.getTrackState(traj.addTrackState(
+        candidates.empty() ? TrackStatePropMask::Predicted |
+                                 TrackStatePropMask::Calibrated
+                           : TrackStatePropMask::Calibrated));
+    if (candidates.empty()) {
+      ts.predicted() = predicted;
+      ts.predictedCovariance() = predictedCovariance;
+    } else {
+      ts.shareFrom(candidates.front(), TrackStatePropMask::Predicted);
+    }
+    ts.setReferenceSurface(surface);
+
+    if (size == 1) {
+      ts.setCalibrated(makeMeasurement(sl, ActsVector<1>{uniform(rng)},
+                                       ActsSquareMatrix<1>{uniform(rng)},
+                                       eBoundLoc0));
+    } else if (size == 2) {
+      SquareMatrix2 cov = SquareMatrix2::Identity() * uniform(rng);
+      cov(0, 1) = cov(1, 0) = 0.01;
+      ts.setCalibrated(makeMeasurement(sl, Vector2{uniform(rng), uniform(rng)},
+                                       cov, eBoundLoc0, eBoundLoc1));
+    } else {
+      SquareMatrix3 cov = SquareMatrix3::Identity() * uniform(rng);
+      ts.setCalibrated(makeMeasurement(
+          sl, Vector3{uniform(rng), uniform(rng), uniform(rng)}, cov,
+          eBoundLoc0, eBoundLoc1, eBoundTime));
+    }
+    candidates.push_back(ts);
+  }
+  return candidates;
+}
+
+/// Compute the chi2 of a candidate with the full matrix inversion
+double expectedChi2(const TrackStateProxy& ts) {
+  const auto H = ts.effectiveProjector();
+  const auto res = (ts.effectiveCalibrated() - H * ts.predicted()).eval();
+  const auto S = (ts.effectiveCalibratedCovariance() +
+                  H * ts.predictedCovariance() * H.transpose())
+                     .eval();
+  return res.dot(S.inverse() * res);
+}
+
+void checkSelection(const std::vector<std::size_t>& sizes,
+                    std::size_t numMeasurementsCut) {
+  VectorMultiTrajectory traj;
+  auto candidates = makeCandidates(traj, sizes);
+  std::vector<double> expected;
+  for (const auto& ts : candidates) {
+    expected.push_back(expectedChi2(ts));
+  }
+  std::sort(expected.begin(), expected.end());
+
+  MeasurementSelectorCuts cuts;
+  cuts.chi2CutOff = {1e6};
+  cuts.numMeasurementsCutOff = {numMeasurementsCut};
+  MeasurementSelector selector(cuts);
+
+  bool isOutlier = true;
+  auto result = selector.select<VectorMultiTrajectory>(candidates, isOutlier,
+                                                       getDummyLogger());
+  BOOST_REQUIRE(result.ok());
+  BOOST_CHECK(!isOutlier);
+
+  auto [begin, end] = *result;
+  const std::size_t nSelected = std::min(numMeasurementsCut, sizes.size());
+  BOOST_REQUIRE_EQUAL(static_cast<std::size_t>(end - begin), nSelected);
+
+  // the best candidates come first in ascending order, the chi2 is stored
+  // in single precision
+  for (std::size_t i = 0; i < nSelected; ++i) {
+    CHECK_CLOSE_REL((begin + i)->chi2(), expected[i], 1e-6);
+  }
+  for (const auto& ts : candidates) {
+    CHECK_CLOSE_REL(ts.chi2(), expectedChi2(ts), 1e-6);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TrackFindingMeasurementSelector)
+
+BOOST_AUTO_TEST_CASE(SameDimensionCandidates) {
+  // These share the projected prediction and are computed in one batch
+  for (std::size_t size : {1u, 2u, 3u}) {
+    checkSelection(std::vector<std::size_t>(30, size), 4);
+    checkSelection(std::vector<std::size_t>(3, size), 4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MixedDimensionCandidates) {
+  checkSelection({2, 1, 2, 3, 1, 2, 2, 3}, 3);
+  checkSelection({1, 2}, 1);
+}
+
+BOOST_AUTO_TEST_CASE(OutlierCandidate) {
+  VectorMultiTrajectory traj;
+  auto candidates = makeCandidates(traj, std::vector<std::size_t>(10, 2));
+
+  MeasurementSelectorCuts cuts;
+  cuts.chi2CutOff = {0.};
+  cuts.numMeasurementsCutOff = {3};
+  MeasurementSelector selector(cuts);
+
+  bool isOutlier = false;
+  auto result = selector.select<VectorMultiTrajectory>(candidates, isOutlier,
+                                                       getDummyLogger());
+  BOOST_REQUIRE(result.ok());
+  BOOST_CHECK(isOutlier);
+
+  // the candidate with the smallest chi2 is returned as outlier
+  auto [begin, end] = *result;
+  BOOST_REQUIRE_EQUAL(end - begin, 1);
+  for (const auto& ts : candidates) {
+    BOOST_CHECK_LE(begin->chi2(), ts.chi2());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,6 +20,7 @@
 #include "Acts/TrackFinding/TrackSelector.hpp"
 
 #include <limits>
+#include <vector>
 
 using namespace Acts;
 namespace bdata = boost::unit_test::data;
@@ -742,4 +743,50 @@ BOOST_AUTO_TEST_CASE(SubsetHitCountCut) {
   BOOST_CHECK(selectorVol7And8.isValidTrack(trackVol7));
 }
 
+BOOST_AUTO_TEST_CASE(SelectTracks) {
+  using namespace Acts::UnitLiterals;
+
+  TrackContainer input{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  for (std::size_t i = 0; i < 20; ++i) {
+    auto track = input.makeTrack();
+    track.parameters() << 0, 0, M_PI / 2, M_PI / 2, 1 / (1_GeV * (i % 4)), 0;
+    track.setReferenceSurface(perigee);
+    track.nMeasurements() = i % 7;
+    track.chi2() = i;
+    track.appendTrackState();
+  }
+
+  TrackSelector::Config cfg;
+  cfg.pt(1.5_GeV, 10_GeV);
+  cfg.minMeasurements = 3;
+  TrackSelector selector{cfg};
+
+  auto selected = selector.selectTrackIndices(input);
+  std::vector<TrackIndexType> expected;
+  for (const auto& track : input) {
+    if (selector.isValidTrack(track)) {
+      expected.push_back(track.index());
+    }
+  }
+  BOOST_CHECK(!expected.empty());
+  BOOST_CHECK_LT(expected.size(), input.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(selected.begin(), selected.end(),
+                                expected.begin(), expected.end());
+
+  // The selected tracks keep pointing to the input track states
+  TrackContainer output{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  selector.selectTracks(input, output);
+  BOOST_REQUIRE_EQUAL(output.size(), selected.size());
+  for (std::size_t i = 0; i < selected.size(); ++i) {
+    auto track = output.getTrack(i);
+    auto original = input.getTrack(selected[i]);
+    BOOST_CHECK_EQUAL(track.tipIndex(), original.tipIndex());
+    BOOST_CHECK_EQUAL(track.nMeasurements(), original.nMeasurements());
+    BOOST_CHECK_EQUAL(track.chi2(), original.chi2());
+    BOOST_CHECK_EQUAL(track.qOverP(), original.qOverP());
+    BOOST_CHECK(track.hasReferenceSurface());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
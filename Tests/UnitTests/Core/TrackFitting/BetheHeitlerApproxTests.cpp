@@ -0,0 +1,51 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+
+#include <cstddef>
+
+using namespace Acts;
+
+BOOST_AUTO_TEST_SUITE(TrackFittingBetheHeitlerApprox)
+
+BOOST_AUTO_TEST_CASE(LookupTable) {
+  const auto approx = makeDefaultBetheHeitlerApprox();
+  auto tabulated = approx;
+  BOOST_CHECK(!tabulated.usesLookupTable());
+  tabulated.useLookupTable(2000);
+  BOOST_CHECK(tabulated.usesLookupTable());
+
+  for (double x = 0.; x < 0.25; x += 0.000731) {
+    const auto expected = approx.mixture(x);
+    const auto result = tabulated.mixture(x);
+    BOOST_REQUIRE_EQUAL(result.size(), expected.size());
+
+    double weightSum = 0;
+    for (std::size_t i = 0; i < result.size(); ++i) {
+      BOOST_CHECK_SMALL(result[i].weight - expected[i].weight, 1e-4);
+      BOOST_CHECK_SMALL(result[i].mean - expected[i].mean, 1e-4);
+      BOOST_CHECK_SMALL(result[i].var - expected[i].var, 1e-4);
+      weightSum += result[i].weight;
+    }
+    BOOST_CHECK_CLOSE(weightSum, 1., 1e-8);
+  }
+
+  // exact on the grid points, e.g. at the upper limit
+  const auto expected = approx.mixture(0.3);
+  const auto result = tabulated.mixture(0.3);
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    BOOST_CHECK_CLOSE(result[i].weight, expected[i].weight, 1e-8);
+    BOOST_CHECK_CLOSE(result[i].mean, expected[i].mean, 1e-8);
+    BOOST_CHECK_CLOSE(result[i].var, expected[i].var, 1e-8);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
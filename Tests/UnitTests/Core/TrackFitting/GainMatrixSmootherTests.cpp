@@ -20,6 +20,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <random>
 
 namespace {
 
@@ -123,4 +124,77 @@ BOOST_AUTO_TEST_CASE(Smooth) {
   CHECK_CLOSE_ABS(ts3.smoothedCovariance(), expCov, tol);
 }
 
+BOOST_AUTO_TEST_CASE(SmoothSinglePrecision) {
+  std::mt19937 rng(42);
+  std::normal_distribution<double> normal(0., 1.);
+
+  // Realistic scales of the bound parameters
+  BoundVector sigma;
+  sigma << 50e-3, 80e-3, 1e-3, 1e-3, 1e-5, 1.;
+  auto randomCovariance = [&]() {
+    BoundMatrix a;
+    for (auto& v : a.reshaped()) {
+      v = normal(rng);
+    }
+    CovarianceMatrix correlation =
+        a * a.transpose() + CovarianceMatrix::Identity();
+    const BoundVector scale = sigma.cwiseProduct(
+        correlation.diagonal().cwiseSqrt().cwiseInverse());
+    return CovarianceMatrix(scale.asDiagonal() * correlation *
+                            scale.asDiagonal());
+  };
+
+  VectorMultiTrajectory traj;
+  std::size_t ts_idx = kTrackIndexInvalid;
+  CovarianceMatrix previousFiltered = randomCovariance();
+  for (std::size_t i = 0; i < 10; ++i) {
+    ts_idx = traj.addTrackState(TrackStatePropMask::All, ts_idx);
+    auto ts = traj.getTrackState(ts_idx);
+
+    Jacobian jac = Jacobian::Identity();
+    jac(eBoundLoc0, eBoundPhi) = 20.;
+    jac(eBoundLoc1, eBoundTheta) = 20.;
+    jac(eBoundPhi, eBoundQOverP) = 5.;
+    ts.jacobian() = jac;
+
+    BoundVector predicted;
+    BoundVector filtered;
+    for (std::size_t j = 0; j < eBoundSize; ++j) {
+      predicted[j] = sigma[j] * normal(rng);
+      filtered[j] = sigma[j] * normal(rng);
+    }
+    ts.predicted() = predicted;
+    ts.predictedCovariance() =
+        jac * previousFiltered * jac.transpose() + randomCovariance();
+    ts.filtered() = filtered;
+    ts.filteredCovariance() = randomCovariance();
+    ts.pathLength() = i;
+    previousFiltered = ts.filteredCovariance();
+  }
+
+  VectorMultiTrajectory floatTraj = traj;
+
+  GainMatrixSmoother smoother;
+  BOOST_CHECK(
+      smoother.operator()<VectorMultiTrajectory>(tgContext, traj, ts_idx).ok());
+  BOOST_CHECK((smoother.operator()<VectorMultiTrajectory, float>(
+                   tgContext, floatTraj, ts_idx)
+                   .ok()));
+
+  for (std::size_t i = 0; i < traj.size(); ++i) {
+    auto ts = traj.getTrackState(i);
+    auto floatTs = floatTraj.getTrackState(i);
+    // compare relative to the smoothed uncertainties
+    const BoundVector dInv =
+        ts.smoothedCovariance().diagonal().cwiseSqrt().cwiseInverse();
+    CHECK_CLOSE_ABS(dInv.cwiseProduct(floatTs.smoothed() - ts.smoothed()),
+                    BoundVector::Zero(), 1e-4);
+    CHECK_CLOSE_ABS(
+        dInv.asDiagonal() *
+            (floatTs.smoothedCovariance() - ts.smoothedCovariance()) *
+            dInv.asDiagonal(),
+        CovarianceMatrix::Zero(), 1e-4);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
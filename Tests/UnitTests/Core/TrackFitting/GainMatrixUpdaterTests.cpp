@@ -17,13 +17,17 @@
 #include "Acts/EventData/detail/TestSourceLink.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/TrackFitting/BatchedGainMatrixUpdater.hpp"
 #include "Acts/TrackFitting/GainMatrixUpdater.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Result.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <random>
+#include <system_error>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -94,4 +98,166 @@ BOOST_AUTO_TEST_CASE(Update) {
   CHECK_CLOSE_ABS(ts.chi2(), 1.33958, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(BatchedUpdate) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(0.1, 1.);
+
+  VectorMultiTrajectory batchTraj;
+  VectorMultiTrajectory singleTraj;
+  std::vector<VectorMultiTrajectory::TrackStateProxy> batchStates;
+  std::vector<VectorMultiTrajectory::TrackStateProxy> singleStates;
+
+  auto setCalibrated = [&](auto ts, std::size_t i) {
+    SourceLink sl{TestSourceLink{}};
+    if (i % 4 == 0) {
+      ts.setCalibrated(makeMeasurement(sl, ActsVector<1>{uniform(rng)},
+                                       ActsSquareMatrix<1>{uniform(rng)},
+                                       eBoundLoc1));
+    } else if (i % 4 == 1) {
+      SquareMatrix2 cov = SquareMatrix2::Identity() * uniform(rng);
+      cov(0, 1) = cov(1, 0) = 0.01;
+      ts.setCalibrated(makeMeasurement(sl, Vector2{uniform(rng), uniform(rng)},
+                                       cov, eBoundLoc0, eBoundLoc1));
+    } else if (i % 4 == 2) {
+      SquareMatrix2 cov = SquareMatrix2::Identity() * uniform(rng);
+      ts.setCalibrated(makeMeasurement(sl, Vector2{uniform(rng), uniform(rng)},
+                                       cov, eBoundPhi, eBoundQOverP));
+    } else {
+      // not batched, passed to the single state updater
+      SquareMatrix3 cov = SquareMatrix3::Identity() * uniform(rng);
+      ts.setCalibrated(makeMeasurement(
+          sl, Vector3{uniform(rng), uniform(rng), uniform(rng)}, cov,
+          eBoundLoc0, eBoundLoc1, eBoundTime));
+    }
+  };
+
+  for (std::size_t i = 0; i < 20; ++i) {
+    ParametersVector trkPar;
+    CovarianceMatrix trkCov = CovarianceMatrix::Zero();
+    for (std::size_t j = 0; j < eBoundSize; ++j) {
+      trkPar[j] = uniform(rng);
+      trkCov(j, j) = uniform(rng);
+    }
+    trkCov(0, 1) = trkCov(1, 0) = 0.02;
+    trkCov(2, 4) = trkCov(4, 2) = 0.01;
+
+    auto batchState = batchTraj.getTrackState(
+        batchTraj.addTrackState(TrackStatePropMask::All));
+    auto singleState = singleTraj.getTrackState(
+        singleTraj.addTrackState(TrackStatePropMask::All));
+    for (auto ts : {batchState, singleState}) {
+      ts.predicted() = trkPar;
+      ts.predictedCovariance() = trkCov;
+    }
+    std::mt19937 state = rng;
+    setCalibrated(batchState, i);
+    rng = state;
+    setCalibrated(singleState, i);
+
+    batchStates.push_back(batchState);
+    singleStates.push_back(singleState);
+  }
+
+  // a singular measurement fails the update
+  auto failed =
+      batchTraj.getTrackState(batchTraj.addTrackState(TrackStatePropMask::All));
+  failed.predicted() = ParametersVector::Zero();
+  failed.predictedCovariance() = CovarianceMatrix::Zero();
+  failed.setCalibrated(makeMeasurement(SourceLink{TestSourceLink{}},
+                                       ActsVector<1>{1.},
+                                       ActsSquareMatrix<1>{0.}, eBoundLoc0));
+  batchStates.push_back(failed);
+
+  BatchedGainMatrixUpdater batchUpdater;
+  std::vector<std::error_code> errors;
+  batchUpdater.operator()<VectorMultiTrajectory>(tgContext, batchStates,
+                                                  errors);
+  BOOST_REQUIRE_EQUAL(errors.size(), batchStates.size());
+
+  for (std::size_t i = 0; i < singleStates.size(); ++i) {
+    BOOST_CHECK(!errors[i]);
+    BOOST_CHECK(GainMatrixUpdater()
+                    .
+                    operator()<VectorMultiTrajectory>(tgContext,
+                                                      singleStates[i])
+                    .ok());
+    CHECK_CLOSE_ABS(batchStates[i].filtered(), singleStates[i].filtered(),
+                    tol);
+    CHECK_CLOSE_ABS(batchStates[i].filteredCovariance(),
+                    singleStates[i].filteredCovariance(), tol);
+    CHECK_CLOSE_ABS(batchStates[i].chi2(), singleStates[i].chi2(), tol);
+  }
+  BOOST_CHECK(errors.back() == KalmanFitterError::ForwardUpdateFailed);
+}
+
+BOOST_AUTO_TEST_CASE(SinglePrecisionUpdate) {
+  // Realistic scales of the bound parameters with strong correlations
+  BoundVector sigma;
+  sigma << 50e-3, 80e-3, 1e-3, 1e-3, 1e-5, 1.;
+  CovarianceMatrix correlation = CovarianceMatrix::Identity();
+  correlation(eBoundLoc0, eBoundPhi) = correlation(eBoundPhi, eBoundLoc0) =
+      0.9;
+  correlation(eBoundLoc1, eBoundTheta) = correlation(eBoundTheta, eBoundLoc1) =
+      -0.8;
+  correlation(eBoundPhi, eBoundQOverP) = correlation(eBoundQOverP, eBoundPhi) =
+      0.5;
+  CovarianceMatrix trkCov =
+      sigma.asDiagonal() * correlation * sigma.asDiagonal();
+  ParametersVector trkPar;
+  trkPar << 0.3, 0.5, 0.5 * M_PI, 0.3 * M_PI, 1e-3, 0.;
+
+  SquareMatrix2 measCov = Vector2(10e-3, 40e-3).cwiseAbs2().asDiagonal();
+  auto sourceLink = TestSourceLink(eBoundLoc0, eBoundLoc1,
+                                   Vector2(0.32, 0.45), measCov);
+
+  VectorMultiTrajectory traj;
+  auto doubleState =
+      traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+  auto floatState =
+      traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+  for (auto ts : {doubleState, floatState}) {
+    ts.predicted() = trkPar;
+    ts.predictedCovariance() = trkCov;
+    testSourceLinkCalibrator<VectorMultiTrajectory>(
+        tgContext, CalibrationContext{}, SourceLink{sourceLink}, ts);
+  }
+
+  GainMatrixUpdater updater;
+  BOOST_CHECK(
+      updater.operator()<VectorMultiTrajectory>(tgContext, doubleState).ok());
+  BOOST_CHECK((updater.operator()<VectorMultiTrajectory, float>(tgContext,
+                                                                 floatState)
+                   .ok()));
+
+  // compare relative to the filtered uncertainties
+  const BoundVector dInv =
+      doubleState.filteredCovariance().diagonal().cwiseSqrt().cwiseInverse();
+  CHECK_CLOSE_ABS(
+      dInv.cwiseProduct(floatState.filtered() - doubleState.filtered()),
+      BoundVector::Zero(), 1e-5);
+  CHECK_CLOSE_ABS(dInv.asDiagonal() *
+                      (floatState.filteredCovariance() -
+                       doubleState.filteredCovariance()) *
+                      dInv.asDiagonal(),
+                  CovarianceMatrix::Zero(), 1e-5);
+  BOOST_CHECK(floatState.filteredCovariance().isApprox(
+      floatState.filteredCovariance().transpose()));
+  CHECK_CLOSE_REL(floatState.chi2(), doubleState.chi2(), 1e-5);
+
+  // A parameter without uncertainty cannot be scaled, the update falls back
+  // to double precision
+  trkCov(eBoundTime, eBoundTime) = 0;
+  for (auto ts : {doubleState, floatState}) {
+    ts.predictedCovariance() = trkCov;
+  }
+  BOOST_CHECK(
+      updater.operator()<VectorMultiTrajectory>(tgContext, doubleState).ok());
+  BOOST_CHECK((updater.operator()<VectorMultiTrajectory, float>(tgContext,
+                                                                 floatState)
+                   .ok()));
+  BOOST_CHECK_EQUAL(floatState.filtered(), doubleState.filtered());
+  BOOST_CHECK_EQUAL(floatState.filteredCovariance(),
+                    doubleState.filteredCovariance());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -17,8 +17,10 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -100,6 +102,49 @@ BOOST_AUTO_TEST_CASE(test_distance_matrix_recompute_distance) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_distance_matrix_matches_full_scan) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> uniform(0.1, 1.0);
+
+  std::vector<GsfComponent> cmps;
+  for (auto i = 0ul; i < 72; ++i) {
+    GsfComponent cmp{1. / 72., BoundVector::Zero(),
+                     BoundSquareMatrix::Identity()};
+    cmp.boundPars[eBoundQOverP] = uniform(rng);
+    cmp.boundCov(eBoundQOverP, eBoundQOverP) = uniform(rng);
+    cmps.push_back(cmp);
+  }
+
+  const auto proj = [](auto &a) -> decltype(auto) { return a; };
+  detail::SymmetricKLDistanceMatrix mat(cmps, proj);
+  std::vector<bool> active(cmps.size(), true);
+
+  for (auto step = 0ul; step < 60; ++step) {
+    // reference: scan all pairs of active components
+    auto min = std::numeric_limits<double>::max();
+    std::pair<std::size_t, std::size_t> expected;
+    for (auto i = 1ul; i < cmps.size(); ++i) {
+      for (auto j = 0ul; j < i; ++j) {
+        const auto d = detail::computeSymmetricKlDivergence(cmps[i], cmps[j],
+                                                            proj);
+        if (active[i] && active[j] && d < min) {
+          min = d;
+          expected = {i, j};
+        }
+      }
+    }
+
+    const auto [i, j] = mat.minDistancePair();
+    BOOST_CHECK_EQUAL(i, expected.first);
+    BOOST_CHECK_EQUAL(j, expected.second);
+
+    cmps[i].boundPars[eBoundQOverP] = uniform(rng);
+    mat.recomputeAssociatedDistances(i, cmps, proj);
+    mat.maskAssociatedDistances(j);
+    active[j] = false;
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_mixture_reduction) {
   auto meanAndSumOfWeights = [](const auto &cmps) {
     const auto mean = std::accumulate(
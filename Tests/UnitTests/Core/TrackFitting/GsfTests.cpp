@@ -251,4 +251,21 @@ BOOST_AUTO_TEST_CASE(WithFinalMultiComponentState) {
                   .has_value());
 }
 
+BOOST_AUTO_TEST_CASE(SharedComponentPool) {
+  auto multi_pars = makeParameters();
+  auto options = makeDefaultGsfOptions();
+  GsfComponentPool<VectorMultiTrajectory> pool;
+  options.componentPool = &pool;
+
+  tester.test_ZeroFieldWithSurfaceForward(gsfZero, options, multi_pars, rng,
+                                          true, false, false);
+  const std::size_t capacity = pool.capacity();
+  BOOST_CHECK_GT(capacity, 0u);
+
+  // The buffers of the first fit are large enough for the second one
+  tester.test_ZeroFieldWithSurfaceForward(gsfZero, options, multi_pars, rng,
+                                          true, false, false);
+  BOOST_CHECK_EQUAL(pool.capacity(), capacity);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/TrackFitting/Gx2fBandedSystem.hpp"
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Cholesky>
+
+using namespace Acts;
+using namespace Acts::Experimental;
+
+namespace {
+
+using Vector = Gx2fBandedSystem::Vector;
+
+struct Setup {
+  std::size_t nBlocks = 40;
+  std::size_t blockSize = 3;
+  std::size_t bandwidth = 2;
+};
+
+/// Fill a system with random measurements on all possible block ranges,
+/// such that the matrix is positive definite
+/// @return The number of blocks of each measurement
+std::vector<std::size_t> fill(Gx2fBandedSystem& system, std::mt19937& rng) {
+  std::normal_distribution<double> normal(0., 1.);
+  std::uniform_real_distribution<double> variance(0.5, 2.);
+  std::vector<std::size_t> spans;
+  for (std::size_t first = 0; first < system.nBlocks(); ++first) {
+    for (std::size_t span = 1; span <= system.bandwidth() + 1; ++span) {
+      if (first + span > system.nBlocks()) {
+        break;
+      }
+      for (std::size_t m = 0; m < system.blockSize(); ++m) {
+        Vector jacobian(span * system.blockSize());
+        for (auto& v : jacobian) {
+          v = normal(rng);
+        }
+        system.addMeasurement(first, jacobian, normal(rng), variance(rng));
+        spans.push_back(span);
+      }
+    }
+  }
+  return spans;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TrackFittingGx2fBandedSystem)
+
+BOOST_AUTO_TEST_CASE(SolveMatchesDense) {
+  Setup setup;
+  std::mt19937 rng(42);
+  Gx2fBandedSystem system(setup.nBlocks, setup.blockSize, setup.bandwidth);
+  fill(system, rng);
+
+  const auto dense = system.denseMatrix();
+  BOOST_CHECK_EQUAL(dense.rows(), 120);
+  BOOST_CHECK(dense.isApprox(dense.transpose()));
+
+  // nothing outside of the band
+  const auto n = static_cast<Eigen::Index>(setup.blockSize);
+  const auto w = static_cast<Eigen::Index>(setup.bandwidth);
+  for (Eigen::Index i = 0; i < dense.rows(); ++i) {
+    for (Eigen::Index j = 0; j < dense.cols(); ++j) {
+      if (i / n - j / n > w || j / n - i / n > w) {
+        BOOST_CHECK_EQUAL(dense(i, j), 0.);
+      }
+    }
+  }
+
+  const Vector expected = dense.ldlt().solve(system.vector());
+  const auto solution = system.solve();
+  BOOST_REQUIRE(solution.has_value());
+  BOOST_CHECK(solution->isApprox(expected, 1e-10));
+}
+
+BOOST_AUTO_TEST_CASE(UpdateMatchesRebuild) {
+  Setup setup;
+  std::mt19937 rng(1234);
+  std::normal_distribution<double> normal(0., 1.);
+  Gx2fBandedSystem system(setup.nBlocks, setup.blockSize, setup.bandwidth);
+  const auto spans = fill(system, rng);
+
+  // change a part of the measurements as in a new iteration and drop some
+  // outliers
+  for (std::size_t k = 0; k < spans.size(); k += 3) {
+    Vector jacobian(spans[k] * setup.blockSize);
+    for (auto& v : jacobian) {
+      v = normal(rng);
+    }
+    system.updateMeasurement(k, jacobian, normal(rng), 1.5);
+  }
+  for (std::size_t k = 1; k < spans.size(); k += 17) {
+    system.removeMeasurement(k);
+  }
+
+  const auto dense = system.denseMatrix();
+  const Vector b = system.vector();
+  const double chi2 = system.chi2();
+  const auto solution = system.solve();
+
+  system.rebuild();
+  BOOST_CHECK(system.denseMatrix().isApprox(dense, 1e-12));
+  BOOST_CHECK(system.vector().isApprox(b, 1e-12));
+  BOOST_CHECK_CLOSE(system.chi2(), chi2, 1e-9);
+  BOOST_REQUIRE(solution.has_value());
+  BOOST_CHECK(system.solve()->isApprox(*solution, 1e-9));
+}
+
+BOOST_AUTO_TEST_CASE(InvalidInput) {
+  Gx2fBandedSystem system(4, 2, 1);
+  BOOST_CHECK_EQUAL(system.size(), 8u);
+
+  // three blocks do not fit into a band of width one
+  BOOST_CHECK_THROW(system.addMeasurement(0, Vector::Ones(6), 0., 1.),
+                    std::invalid_argument);
+  // incomplete block
+  BOOST_CHECK_THROW(system.addMeasurement(0, Vector::Ones(3), 0., 1.),
+                    std::invalid_argument);
+  // beyond the last block
+  BOOST_CHECK_THROW(system.addMeasurement(3, Vector::Ones(4), 0., 1.),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(system.addMeasurement(0, Vector::Ones(2), 0., 0.),
+                    std::invalid_argument);
+
+  // unconstrained unknowns make the system singular
+  system.addMeasurement(0, Vector::Ones(2), 1., 1.);
+  BOOST_CHECK(!system.solve().has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
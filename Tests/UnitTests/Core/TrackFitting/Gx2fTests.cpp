@@ -375,6 +375,83 @@ BOOST_AUTO_TEST_CASE(Fit5Iterations) {
   ACTS_INFO("*** Test: Fit5Iterations -- Finish");
 }
 
+BOOST_AUTO_TEST_CASE(BandedSystem) {
+  ACTS_INFO("*** Test: BandedSystem -- Start");
+
+  std::default_random_engine rng(42);
+
+  ACTS_DEBUG("Create the detector");
+  const std::size_t nSurfaces = 5;
+  Detector detector;
+  detector.geometry = makeToyDetector(geoCtx, nSurfaces);
+
+  ACTS_DEBUG("Set the start parameters for measurement creation and fit");
+  const auto parametersMeasurements = makeParameters();
+  const auto startParametersFit = makeParameters(
+      7_mm, 11_mm, 15_mm, 42_ns, 10_degree, 80_degree, 1_GeV, 1_e);
+
+  ACTS_DEBUG("Create the measurements");
+  using SimPropagator =
+      Acts::Propagator<Acts::StraightLineStepper, Acts::Navigator>;
+  const SimPropagator simPropagator = makeStraightPropagator(detector.geometry);
+  const auto measurements =
+      createMeasurements(simPropagator, geoCtx, magCtx, parametersMeasurements,
+                         resMapAllPixel, rng);
+  const auto sourceLinks = prepareSourceLinks(measurements.sourceLinks);
+
+  BOOST_REQUIRE_EQUAL(sourceLinks.size(), nSurfaces);
+
+  ACTS_DEBUG("Set up the fitter");
+  const Surface* rSurface = &parametersMeasurements.referenceSurface();
+
+  using RecoStepper = EigenStepper<>;
+  const auto recoPropagator =
+      makeConstantFieldPropagator<RecoStepper>(detector.geometry, 0_T);
+
+  using RecoPropagator = decltype(recoPropagator);
+  using Gx2Fitter =
+      Experimental::Gx2Fitter<RecoPropagator, VectorMultiTrajectory>;
+  const Gx2Fitter fitter(recoPropagator, gx2fLogger->clone());
+
+  Experimental::Gx2FitterExtensions<VectorMultiTrajectory> extensions;
+  extensions.calibrator
+      .connect<&testSourceLinkCalibrator<VectorMultiTrajectory>>();
+  TestSourceLink::SurfaceAccessor surfaceAccessor{*detector.geometry};
+  extensions.surfaceAccessor
+      .connect<&TestSourceLink::SurfaceAccessor::operator()>(&surfaceAccessor);
+
+  Experimental::Gx2FitterOptions gx2fOptions(
+      geoCtx, magCtx, calCtx, extensions, PropagatorPlainOptions(), rSurface,
+      false, false, FreeToBoundCorrection(false), 5, true, 0);
+
+  ACTS_DEBUG("Fit the track with the dense and the banded system");
+  Acts::TrackContainer denseTracks{Acts::VectorTrackContainer{},
+                                   Acts::VectorMultiTrajectory{}};
+  const auto denseRes = fitter.fit(sourceLinks.begin(), sourceLinks.end(),
+                                   startParametersFit, gx2fOptions, denseTracks);
+  BOOST_REQUIRE(denseRes.ok());
+
+  gx2fOptions.useBandedSystem = true;
+  Acts::TrackContainer bandedTracks{Acts::VectorTrackContainer{},
+                                    Acts::VectorMultiTrajectory{}};
+  const auto bandedRes =
+      fitter.fit(sourceLinks.begin(), sourceLinks.end(), startParametersFit,
+                 gx2fOptions, bandedTracks);
+  BOOST_REQUIRE(bandedRes.ok());
+
+  const auto& dense = *denseRes;
+  const auto& banded = *bandedRes;
+
+  BOOST_CHECK_EQUAL(banded.tipIndex(), dense.tipIndex());
+  BOOST_CHECK_EQUAL(banded.nMeasurements(), dense.nMeasurements());
+  CHECK_CLOSE_REL(banded.chi2(), dense.chi2(), 1e-6);
+  CHECK_CLOSE_ABS(banded.parameters(), dense.parameters(), 1e-6);
+  CHECK_CLOSE_REL(banded.covariance().determinant(),
+                  dense.covariance().determinant(), 1e-6);
+
+  ACTS_INFO("*** Test: BandedSystem -- Finish");
+}
+
 BOOST_AUTO_TEST_CASE(MixedDetector) {
   ACTS_INFO("*** Test: MixedDetector -- Start");
 
@@ -36,6 +36,7 @@
 #include <optional>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "FitterTestsCommon.hpp"
 
@@ -246,6 +247,54 @@ BOOST_AUTO_TEST_CASE(ZeroFieldWithReverseFiltering) {
   test(0.1_GeV, true, true, false);
 }
 
+BOOST_AUTO_TEST_CASE(FusedSmoothing) {
+  auto start = makeParameters();
+  auto measurements =
+      createMeasurements(tester.simPropagator, tester.geoCtx, tester.magCtx,
+                         start, tester.resolutions, rng);
+  auto sourceLinks = FitterTester::prepareSourceLinks(measurements.sourceLinks);
+
+  auto kfOptions = makeDefaultKalmanFitterOptions();
+  kfOptions.referenceSurface = &start.referenceSurface();
+
+  Acts::TrackContainer tracks{Acts::VectorTrackContainer{},
+                              Acts::VectorMultiTrajectory{}};
+  auto res = kfZero.fit(sourceLinks.begin(), sourceLinks.end(), start,
+                        kfOptions, tracks);
+  BOOST_REQUIRE(res.ok());
+
+  kfOptions.fusedSmoothing = true;
+  kfOptions.storeJacobians = false;
+  auto fusedRes = kfZero.fit(sourceLinks.begin(), sourceLinks.end(), start,
+                             kfOptions, tracks);
+  BOOST_REQUIRE(fusedRes.ok());
+
+  const auto& track = res.value();
+  const auto& fusedTrack = fusedRes.value();
+  BOOST_CHECK_EQUAL(fusedTrack.nMeasurements(), track.nMeasurements());
+  BOOST_CHECK_EQUAL(fusedTrack.nTrackStates(), track.nTrackStates());
+  BOOST_CHECK(fusedTrack.parameters().isApprox(track.parameters()));
+  BOOST_CHECK(fusedTrack.covariance().isApprox(track.covariance()));
+
+  std::vector<VectorMultiTrajectory::ConstTrackStateProxy> states;
+  for (const auto ts : track.trackStatesReversed()) {
+    states.push_back(ts);
+  }
+  std::size_t i = 0;
+  for (const auto ts : fusedTrack.trackStatesReversed()) {
+    BOOST_REQUIRE_LT(i, states.size());
+    const auto& expected = states[i++];
+    BOOST_CHECK(!ts.hasJacobian());
+    BOOST_CHECK_EQUAL(ts.hasSmoothed(), expected.hasSmoothed());
+    if (ts.hasSmoothed()) {
+      BOOST_CHECK(ts.smoothed().isApprox(expected.smoothed()));
+      BOOST_CHECK(
+          ts.smoothedCovariance().isApprox(expected.smoothedCovariance()));
+    }
+  }
+  BOOST_CHECK_EQUAL(i, states.size());
+}
+
 // TODO this is not really Kalman fitter specific. is probably better tested
 // with a synthetic trajectory.
 BOOST_AUTO_TEST_CASE(GlobalCovariance) {
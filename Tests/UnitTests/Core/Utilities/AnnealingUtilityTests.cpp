@@ -12,6 +12,7 @@
 
 #include "Acts/Utilities/AnnealingUtility.hpp"
 
+#include <cstddef>
 #include <iostream>
 #include <vector>
 
@@ -175,4 +176,29 @@ BOOST_AUTO_TEST_CASE(annealing_tool_multiChi2_tests) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(annealing_tool_batchChi2_tests) {
+  // compatibilities of three tracks wrt their vertices
+  std::vector<double> allChi2{1.3, 4.5, 8.4, 0.4, 10.3, 12.3, 3.5};
+  std::vector<std::size_t> offsets{0, 3, 4, 7};
+
+  AnnealingUtility annealingTool;
+  AnnealingUtility::State state;
+
+  std::vector<double> weights;
+  while (!state.equilibriumReached) {
+    annealingTool.getWeights(state, allChi2, offsets, weights);
+    BOOST_REQUIRE_EQUAL(weights.size(), allChi2.size());
+
+    for (std::size_t iTrack = 0; iTrack + 1 < offsets.size(); ++iTrack) {
+      std::vector<double> trackChi2(allChi2.begin() + offsets[iTrack],
+                                    allChi2.begin() + offsets[iTrack + 1]);
+      for (std::size_t i = offsets[iTrack]; i < offsets[iTrack + 1]; ++i) {
+        BOOST_CHECK_EQUAL(weights[i], annealingTool.getWeight(
+                                          state, allChi2[i], trackChi2));
+      }
+    }
+    annealingTool.anneal(state);
+  }
+}
+
 }  // namespace Acts::Test
@@ -368,5 +368,68 @@ BOOST_DATA_TEST_CASE(
   CHECK_CLOSE_REL(value0_xyz, value3_xyz, 1e-10);
   CHECK_CLOSE_REL(value0_xyz, value4_xyz, 1e-10);
 }
+
+BOOST_AUTO_TEST_CASE(bfield_compact) {
+  std::vector<double> rPos = {0., 1., 2., 3.};
+  std::vector<double> xPos = {0., 1., 2., 3.};
+  std::vector<double> yPos = {0., 0.5, 1., 1.5, 2.};
+  std::vector<double> zPos = {0., 2., 4.};
+
+  auto localToGlobalBin_rz = [](std::array<std::size_t, 2> binsRZ,
+                                std::array<std::size_t, 2> nBinsRZ) {
+    return (binsRZ.at(1) * nBinsRZ.at(0) + binsRZ.at(0));
+  };
+  auto localToGlobalBin_xyz = [](std::array<std::size_t, 3> binsXYZ,
+                                 std::array<std::size_t, 3> nBinsXYZ) {
+    return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+            binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+  };
+
+  std::vector<Acts::Vector2> bField_rz;
+  for (std::size_t i = 0; i < rPos.size() * zPos.size(); i++) {
+    bField_rz.push_back(Acts::Vector2(0.1 * i, 2. - 0.3 * i));
+  }
+  std::vector<Acts::Vector3> bField_xyz;
+  for (std::size_t i = 0; i < xPos.size() * yPos.size() * zPos.size(); i++) {
+    bField_xyz.push_back(Acts::Vector3(0.1 * i, -0.2 * i, 1. + 0.05 * i));
+  }
+
+  for (bool symmetric : {false, true}) {
+    auto map_rz = Acts::fieldMapRZ(localToGlobalBin_rz, rPos, zPos, bField_rz,
+                                   1, 1, symmetric);
+    auto compact_rz = Acts::compactFieldMapRZ(
+        localToGlobalBin_rz, rPos, zPos, bField_rz, 1, 1, symmetric);
+    auto map_xyz = Acts::fieldMapXYZ(localToGlobalBin_xyz, xPos, yPos, zPos,
+                                     bField_xyz, 1, 1, symmetric);
+    auto compact_xyz = Acts::compactFieldMapXYZ(
+        localToGlobalBin_xyz, xPos, yPos, zPos, bField_xyz, 1, 1, symmetric);
+
+    // the symmetric compact grids only cover the given quadrant / octant
+    BOOST_CHECK(compact_rz.getNBins() ==
+                std::vector<std::size_t>({rPos.size(), zPos.size()}));
+    BOOST_CHECK(compact_xyz.getNBins() ==
+                std::vector<std::size_t>(
+                    {xPos.size(), yPos.size(), zPos.size()}));
+
+    // positions in the quadrant / octant or in all of them
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(symmetric ? -1. : 0., 1.);
+    for (int i = 0; i < 100; ++i) {
+      Acts::Vector3 pos(dist(rng) * 2.9, dist(rng) * 1.9, dist(rng) * 3.9);
+
+      BOOST_CHECK_EQUAL(map_xyz.isInside(pos), compact_xyz.isInside(pos));
+      if (map_xyz.isInside(pos)) {
+        CHECK_CLOSE_ABS(map_xyz.getField(pos).value(),
+                        compact_xyz.getField(pos).value(), 1e-5);
+      }
+      Acts::Vector3 posRZ(pos.x() * 0.7, pos.y() * 0.7, pos.z());
+      BOOST_CHECK_EQUAL(map_rz.isInside(posRZ), compact_rz.isInside(posRZ));
+      if (map_rz.isInside(posRZ)) {
+        CHECK_CLOSE_ABS(map_rz.getField(posRZ).value(),
+                        compact_rz.getField(posRZ).value(), 1e-5);
+      }
+    }
+  }
+}
 }  // namespace Test
 }  // namespace Acts
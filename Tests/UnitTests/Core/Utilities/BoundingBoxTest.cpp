@@ -1244,6 +1244,89 @@ BOOST_AUTO_TEST_CASE(frustum_intersect) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(bvh_construction) {
+  using Frustum3 = Frustum<BoundingBoxScalar, 3, 4>;
+  using Ray3 = Ray<BoundingBoxScalar, 3>;
+
+  // boxes on a few cylinders, similar to barrel layers
+  Object o;
+  std::vector<std::unique_ptr<ObjectBBox>> boxes;
+  std::vector<ObjectBBox*> prims;
+  for (std::size_t l = 0; l < 4; l++) {
+    for (std::size_t i = 0; i < 300; i++) {
+      double phi = 2 * M_PI * i / 300.;
+      double r = 30. + 20. * l;
+      Vector3F ctr(r * std::cos(phi), r * std::sin(phi), (i % 10) * 10. - 50.);
+      boxes.push_back(std::make_unique<ObjectBBox>(
+          &o, ctr, ObjectBBox::Size(Vector3F(1., 1., 9.))));
+      prims.push_back(boxes.back().get());
+    }
+  }
+  // some identical boxes, which cannot be separated
+  for (std::size_t i = 0; i < 10; i++) {
+    boxes.push_back(std::make_unique<ObjectBBox>(
+        &o, Vector3F(0., 0., 0.), ObjectBBox::Size(Vector3F(1., 1., 1.))));
+    prims.push_back(boxes.back().get());
+  }
+
+  // collect the leaves that pass the check
+  auto traverse = [](const ObjectBBox* node, const auto& check) {
+    std::set<const ObjectBBox*> selected;
+    while (node != nullptr) {
+      if (!check(*node)) {
+        node = node->getSkip();
+      } else if (node->hasEntity()) {
+        selected.insert(node);
+        node = node->getSkip();
+      } else {
+        node = node->getLeftChild();
+      }
+    }
+    return selected;
+  };
+  auto brute = [&](const auto& check) {
+    std::set<const ObjectBBox*> selected;
+    for (const auto* prim : prims) {
+      if (check(*prim)) {
+        selected.insert(prim);
+      }
+    }
+    return selected;
+  };
+
+  std::vector<std::unique_ptr<ObjectBBox>> store;
+  ObjectBBox* top = make_bvh(store, prims, 4);
+  std::vector<std::unique_ptr<ObjectBBox>> parallelStore;
+  setMaxThreads(4);
+  ObjectBBox* parallelTop = make_bvh(parallelStore, prims, 4);
+  setMaxThreads(1);
+  BOOST_CHECK_EQUAL(store.size(), parallelStore.size());
+  BOOST_CHECK_EQUAL(top->min(), parallelTop->min());
+  BOOST_CHECK_EQUAL(top->max(), parallelTop->max());
+
+  // every box is reached exactly once
+  auto all = [](const ObjectBBox&) { return true; };
+  BOOST_CHECK_EQUAL(traverse(top, all).size(), prims.size());
+  BOOST_CHECK_EQUAL(traverse(parallelTop, all).size(), prims.size());
+
+  for (const auto& fr : {Frustum3({0, 0, 0}, {1, 0, 0}, M_PI / 8.),
+                         Frustum3({0, 0, -100}, {0, 0, 1}, M_PI / 4.),
+                         Frustum3({60, 0, 0}, {0, 1, 0.2}, M_PI / 10.)}) {
+    auto check = [&](const ObjectBBox& box) { return box.intersect(fr); };
+    auto expected = brute(check);
+    BOOST_CHECK(traverse(top, check) == expected);
+    BOOST_CHECK(traverse(parallelTop, check) == expected);
+  }
+  for (const auto& ray : {Ray3({0, 0, 0}, {1, 0, 0}),
+                          Ray3({-100, -70, 3}, {1, 1, 0.01}),
+                          Ray3({0, 0, -100}, {0.2, 0.3, 1})}) {
+    auto check = [&](const ObjectBBox& box) { return box.intersect(ray); };
+    auto expected = brute(check);
+    BOOST_CHECK(traverse(top, check) == expected);
+    BOOST_CHECK(traverse(parallelTop, check) == expected);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ostream_operator) {
   Object o;
   using Box = Acts::AxisAlignedBoundingBox<Object, BoundingBoxScalar, 2>;
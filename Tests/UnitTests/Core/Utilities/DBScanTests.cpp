@@ -9,11 +9,13 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Utilities/DBScan.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <iterator>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -72,6 +74,65 @@ std::vector<std::array<double, 2>> test_vector{
     {6.92208545, -8.46326386},  {4.58953972, -3.22764749},
     {-3.36912131, 2.58470911},  {5.28526348, -2.55723196},
     {6.55276593, -7.81387909},  {-1.79854507, -2.10170986}};
+
+// Reference DBScan checking all the pairs of points
+template <std::size_t kDims>
+int bruteForceClustering(const std::vector<std::array<double, kDims>>& points,
+                         double eps, std::size_t minPoints,
+                         std::vector<int>& clusteredPoints) {
+  const std::size_t n = points.size();
+  auto close = [&](std::size_t a, std::size_t b) {
+    double distance = 0;
+    for (std::size_t dim = 0; dim < kDims; dim++) {
+      distance += (points[a][dim] - points[b][dim]) *
+                  (points[a][dim] - points[b][dim]);
+    }
+    return distance <= eps * eps;
+  };
+  std::vector<bool> isCore(n, false);
+  for (std::size_t a = 0; a < n; ++a) {
+    std::size_t nNeighbours = 0;
+    for (std::size_t b = 0; b < n; ++b) {
+      nNeighbours += close(a, b) ? 1 : 0;
+    }
+    isCore[a] = nNeighbours >= minPoints;
+  }
+  // Flood fill the core points, in the order of their first core point
+  clusteredPoints = std::vector<int>(n, -1);
+  int clusterID = 0;
+  for (std::size_t a = 0; a < n; ++a) {
+    if (!isCore[a] || clusteredPoints[a] != -1) {
+      continue;
+    }
+    std::vector<std::size_t> stack{a};
+    clusteredPoints[a] = clusterID;
+    while (!stack.empty()) {
+      std::size_t c = stack.back();
+      stack.pop_back();
+      for (std::size_t b = 0; b < n; ++b) {
+        if (isCore[b] && clusteredPoints[b] == -1 && close(c, b)) {
+          clusteredPoints[b] = clusterID;
+          stack.push_back(b);
+        }
+      }
+    }
+    clusterID++;
+  }
+  // The other points join the lowest numbered cluster of a core neighbour
+  for (std::size_t a = 0; a < n; ++a) {
+    if (isCore[a]) {
+      continue;
+    }
+    for (std::size_t b = 0; b < n; ++b) {
+      if (isCore[b] && close(a, b) &&
+          (clusteredPoints[a] == -1 ||
+           clusteredPoints[b] < clusteredPoints[a])) {
+        clusteredPoints[a] = clusteredPoints[b];
+      }
+    }
+  }
+  return clusterID;
+}
 }  // namespace
 
 namespace Acts::Test {
@@ -103,4 +164,52 @@ BOOST_AUTO_TEST_CASE(ClusteringTest2D) {
   clusteredPoints.clear();
 }
 
+BOOST_AUTO_TEST_CASE(ClusteringTestReference) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> uniform(-5., 5.);
+  std::normal_distribution<double> normal(0., 0.2);
+
+  // Blobs on top of a uniform background, with negative coordinates too
+  std::vector<std::array<double, 3>> points;
+  for (std::size_t blob = 0; blob < 20; ++blob) {
+    std::array<double, 3> center{uniform(gen), uniform(gen), uniform(gen)};
+    for (std::size_t i = 0; i < 150; ++i) {
+      points.push_back({center[0] + normal(gen), center[1] + normal(gen),
+                        center[2] + normal(gen)});
+    }
+  }
+  for (std::size_t i = 0; i < 2000; ++i) {
+    points.push_back({uniform(gen), uniform(gen), uniform(gen)});
+  }
+
+  std::vector<int> expected;
+  int expectedNb = bruteForceClustering(points, 0.15, 4, expected);
+  BOOST_CHECK_GT(expectedNb, 1);
+
+  for (std::size_t numThreads : {1u, 2u, 7u}) {
+    Acts::setMaxThreads(numThreads);
+    Acts::DBScan<3> dbscan(0.15, 4, false);
+    std::vector<int> clusteredPoints;
+    int clusterNb = dbscan.cluster(points, clusteredPoints);
+    BOOST_CHECK_EQUAL(clusterNb, expectedNb);
+    BOOST_CHECK(clusteredPoints == expected);
+  }
+
+  // The noise points become one point clusters after the real ones
+  Acts::setMaxThreads(4);
+  Acts::DBScan<3> dbscan_onePoint(0.15, 4, true);
+  std::vector<int> clusteredPoints;
+  int clusterNb = dbscan_onePoint.cluster(points, clusteredPoints);
+  Acts::setMaxThreads(1);
+  int nNoise = std::count(expected.begin(), expected.end(), -1);
+  BOOST_CHECK_EQUAL(clusterNb, expectedNb + nNoise);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (expected[i] != -1) {
+      BOOST_CHECK_EQUAL(clusteredPoints[i], expected[i]);
+    } else {
+      BOOST_CHECK_GE(clusteredPoints[i], expectedNb);
+    }
+  }
+}
+
 }  // namespace Acts::Test
@@ -459,4 +459,41 @@ BOOST_AUTO_TEST_CASE(NonVoidDelegateTest) {
   { OwningDelegate<std::string(), DelegateInterface> d; }
 }
 
+struct StaticSignatures {
+  int offset = 0;
+
+  int sum(int a, int b) const { return a + b + offset; }
+};
+
+BOOST_AUTO_TEST_CASE(StaticDelegateTest) {
+  {
+    StaticDelegate<int(int, int), &sumImpl> sum;
+    BOOST_CHECK(sum);
+    BOOST_CHECK(sum.connected());
+    BOOST_CHECK_EQUAL(sum(2, 5), 7);
+
+    // The runtime delegate calls the same function
+    Delegate<int(int, int)> runtime = sum.toDelegate();
+    BOOST_CHECK(runtime.connected());
+    BOOST_CHECK_EQUAL(runtime(2, 5), 7);
+  }
+
+  {
+    StaticSignatures s{10};
+    StaticDelegate<int(int, int), &StaticSignatures::sum, StaticSignatures>
+        sum(&s);
+    BOOST_CHECK(sum.connected());
+    BOOST_CHECK_EQUAL(sum(2, 5), 17);
+    s.offset = 20;
+    BOOST_CHECK_EQUAL(sum(2, 5), 27);
+
+    Delegate<int(int, int)> runtime = sum.toDelegate();
+    BOOST_CHECK_EQUAL(runtime(2, 5), 27);
+
+    StaticDelegate<int(int, int), &StaticSignatures::sum, StaticSignatures>
+        empty(nullptr);
+    BOOST_CHECK(!empty);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
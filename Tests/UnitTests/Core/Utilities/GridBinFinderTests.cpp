@@ -491,4 +491,65 @@ BOOST_AUTO_TEST_CASE(grid_binfinder_test_2d_mixed) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(grid_binfinder_test_2d_precomputed) {
+  const std::size_t nBinsX = 5ul;
+  const std::size_t nBinsY = 3ul;
+  Acts::detail::EquidistantAxis xAxis(0, 100, nBinsX);
+  Acts::detail::Axis<Acts::detail::AxisType::Equidistant,
+                     Acts::detail::AxisBoundaryType::Closed>
+      yAxis(0, 100, nBinsY);
+  Acts::Grid<double, Acts::detail::EquidistantAxis,
+             Acts::detail::Axis<Acts::detail::AxisType::Equidistant,
+                                Acts::detail::AxisBoundaryType::Closed>>
+      grid(std::make_tuple(std::move(xAxis), std::move(yAxis)));
+
+  std::array<std::vector<std::size_t>, 2ul> navigation;
+  navigation[0ul].resize(nBinsX);
+  navigation[1ul].resize(nBinsY);
+  std::iota(navigation[0ul].begin(), navigation[0ul].end(), 1ul);
+  std::iota(navigation[1ul].begin(), navigation[1ul].end(), 1ul);
+
+  std::vector<std::pair<int, int>> neighboursX = {
+      {0, 2}, {-1, 1}, {-1, 2}, {-2, 1}, {-1, 0}};
+
+  Acts::GridBinFinder<2ul> binFinder(neighboursX, 1);
+  Acts::GridBinFinder<2ul> precomputedBinFinder(neighboursX, 1);
+  precomputedBinFinder.precomputeBins(grid);
+
+  auto startGrid = grid.begin(navigation);
+  auto stopGrid = grid.end(navigation);
+  for (; startGrid != stopGrid; startGrid++) {
+    std::array<std::size_t, 2ul> locPosition = startGrid.localBinsIndices();
+    auto expected = binFinder.findBins(locPosition, grid);
+    auto precomputed = precomputedBinFinder.findBins(locPosition, grid);
+    BOOST_CHECK_EQUAL_COLLECTIONS(precomputed.begin(), precomputed.end(),
+                                  expected.begin(), expected.end());
+
+    std::vector<std::size_t> iterated;
+    for (std::size_t bin : binFinder.neighborHoodIndices(locPosition, grid)) {
+      iterated.push_back(bin);
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(iterated.begin(), iterated.end(),
+                                  expected.begin(), expected.end());
+  }
+
+  // a grid with a different binning does not use the table
+  Acts::detail::EquidistantAxis xAxisOther(0, 100, nBinsX + 1ul);
+  Acts::detail::Axis<Acts::detail::AxisType::Equidistant,
+                     Acts::detail::AxisBoundaryType::Closed>
+      yAxisOther(0, 100, nBinsY);
+  Acts::Grid<double, Acts::detail::EquidistantAxis,
+             Acts::detail::Axis<Acts::detail::AxisType::Equidistant,
+                                Acts::detail::AxisBoundaryType::Closed>>
+      gridOther(std::make_tuple(std::move(xAxisOther), std::move(yAxisOther)));
+  Acts::GridBinFinder<2ul> intBinFinder(1, 1);
+  Acts::GridBinFinder<2ul> precomputedIntBinFinder(1, 1);
+  precomputedIntBinFinder.precomputeBins(grid);
+  std::array<std::size_t, 2ul> lastBin = {nBinsX + 1ul, 2ul};
+  auto expected = intBinFinder.findBins(lastBin, gridOther);
+  auto found = precomputedIntBinFinder.findBins(lastBin, gridOther);
+  BOOST_CHECK_EQUAL_COLLECTIONS(found.begin(), found.end(), expected.begin(),
+                                expected.end());
+}
+
 }  // namespace Acts::Test
@@ -9,6 +9,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Utilities/KDTree.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/RangeXD.hpp"
 
 #include <algorithm>
@@ -630,6 +631,86 @@ BOOST_AUTO_TEST_CASE(range_search_many_same) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(range_search_multi) {
+  int q = 0;
+
+  std::vector<std::pair<std::array<double, 3>, int>> points;
+
+  for (double x = -10.0; x < 10.0; x += 0.5) {
+    for (double y = -10.0; y < 10.0; y += 0.5) {
+      for (double z = -10.0; z < 10.0; z += 0.5) {
+        points.push_back({{x, y, z}, q++});
+      }
+    }
+  }
+
+  Acts::KDTree<3, int, double> tree(std::move(points));
+
+  // Overlapping, disjoint, empty and all-containing ranges
+  std::vector<RangeXD<3, double>> ranges;
+  for (double min = -12.0; min <= 10.0; min += 1.5) {
+    for (double size : {0.2, 1.0, 4.0, 25.0}) {
+      RangeXD<3, double> range;
+      range[0].shrink(min, min + size);
+      range[1].shrink(-min - size, -min);
+      range[2].shrink(min, min + 2 * size);
+      ranges.push_back(range);
+    }
+  }
+
+  std::vector<std::vector<int>> results(ranges.size());
+  tree.rangeSearchMultiMapDiscard(
+      ranges, [&](std::size_t ir, const std::array<double, 3>& /*c*/, int v) {
+        results[ir].push_back(v);
+      });
+
+  // Same result and order as the individual searches
+  for (std::size_t ir = 0; ir < ranges.size(); ++ir) {
+    std::vector<int> expected = tree.rangeSearch(ranges[ir]);
+    BOOST_CHECK(results[ir] == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(range_search_parallel_build) {
+  int q = 0;
+
+  std::vector<std::pair<std::array<double, 3>, int>> points;
+
+  for (double x = -10.0; x < 10.0; x += 0.5) {
+    for (double y = -10.0; y < 10.0; y += 0.5) {
+      for (double z = -10.0; z < 10.0; z += 0.5) {
+        points.push_back({{x, y, z}, q++});
+      }
+    }
+  }
+
+  std::vector<std::pair<std::array<double, 3>, int>> pointsCopy = points;
+
+  Acts::KDTree<3, int, double> tree(std::move(points));
+  Acts::setMaxThreads(4);
+  Acts::KDTree<3, int, double> parallelTree(std::move(pointsCopy));
+  Acts::setMaxThreads(1);
+
+  BOOST_CHECK_EQUAL(parallelTree.size(), tree.size());
+
+  // The tree does not depend on the number of threads
+  for (double min = -12.0; min <= 10.0; min += 1.5) {
+    RangeXD<3, double> range;
+    range[0].shrink(min, min + 4.0);
+    range[1].shrink(-min - 2.0, -min);
+    range[2].shrink(min, min + 25.0);
+
+    std::vector<int> expected = tree.rangeSearch(range);
+    std::vector<int> result = parallelTree.rangeSearch(range);
+    BOOST_CHECK(result == expected);
+
+    std::size_t nInside = std::count_if(
+        tree.begin(), tree.end(),
+        [&range](const auto& e) { return range.contains(e.first); });
+    BOOST_CHECK_EQUAL(result.size(), nInside);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -8,13 +8,17 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Acts/Utilities/AsyncPrintPolicy.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <chrono>
 #include <cstddef>
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -143,4 +147,105 @@ BOOST_AUTO_TEST_CASE(DEBUG_test) {
 BOOST_AUTO_TEST_CASE(VERBOSE_test) {
   debug_level_test("verbose_log.txt", VERBOSE);
 }
+
+/// @brief unit test for the asynchronous print policy
+///
+/// Messages of several threads have to arrive complete and in the order of
+/// each thread.
+BOOST_AUTO_TEST_CASE(AsyncPrintPolicy_test) {
+  std::ostringstream os;
+  AsyncPrintPolicy::Config cfg;
+  cfg.nBuffers = 3;
+  cfg.bufferSize = 16;
+  auto asyncOutput = std::make_unique<AsyncPrintPolicy>(
+      std::make_unique<DefaultPrintPolicy>(&os), cfg);
+  const AsyncPrintPolicy& async = *asyncOutput;
+  const Logger log(std::make_unique<NamedOutputDecorator>(
+                       std::move(asyncOutput), "Async", 10),
+                   std::make_unique<DefaultFilterPolicy>(INFO));
+  BOOST_CHECK_EQUAL(log.name(), "Async");
+
+  const std::size_t nThreads = 5;
+  const std::size_t nMessages = 500;
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < nThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      const Logger& logger = log;
+      for (std::size_t i = 0; i < nMessages; ++i) {
+        ACTS_INFO(t << " " << i);
+        ACTS_DEBUG("filtered");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  async.waitForFlush();
+  BOOST_CHECK_EQUAL(async.nDropped(), 0u);
+
+  std::vector<std::size_t> next(nThreads, 0);
+  std::istringstream is(os.str());
+  std::size_t nLines = 0;
+  for (std::string line; std::getline(is, line); ++nLines) {
+    std::istringstream ls(line);
+    std::string name;
+    std::size_t t = 0;
+    std::size_t i = 0;
+    ls >> name >> t >> i;
+    BOOST_CHECK_EQUAL(name, "Async");
+    BOOST_REQUIRE_LT(t, nThreads);
+    BOOST_CHECK_EQUAL(i, next[t]++);
+  }
+  BOOST_CHECK_EQUAL(nLines, nThreads * nMessages);
+
+  // A clone shares the sink thread and flushes on destruction
+  {
+    auto clone = log.clone("Clone");
+    const Logger& logger = *clone;
+    ACTS_INFO("from clone");
+  }
+  BOOST_CHECK(os.str().find("Clone     from clone") != std::string::npos);
+}
+
+/// @brief unit test for dropping messages with full ring buffers
+BOOST_AUTO_TEST_CASE(AsyncPrintPolicy_drop_test) {
+  std::ostringstream os;
+  AsyncPrintPolicy::Config cfg;
+  cfg.nBuffers = 1;
+  cfg.bufferSize = 1;
+  cfg.dropWhenFull = true;
+  AsyncPrintPolicy async(std::make_unique<DefaultPrintPolicy>(&os), cfg);
+
+  const std::size_t nMessages = 1000;
+  for (std::size_t i = 0; i < nMessages; ++i) {
+    async.flush(INFO, "message");
+  }
+  async.waitForFlush();
+
+  std::istringstream is(os.str());
+  std::size_t nLines = 0;
+  for (std::string line; std::getline(is, line);) {
+    BOOST_CHECK_EQUAL(line, "message");
+    ++nLines;
+  }
+  BOOST_CHECK_GT(nLines, 0u);
+  BOOST_CHECK_EQUAL(nLines + async.nDropped(), nMessages);
+}
+
+/// @brief unit test for the sampled and throttled logging macros
+BOOST_AUTO_TEST_CASE(SampledLogging_test) {
+  std::ostringstream os;
+  const Logger log(std::make_unique<DefaultPrintPolicy>(&os),
+                   std::make_unique<DefaultFilterPolicy>(INFO));
+  const Logger& logger = log;
+
+  for (std::size_t i = 0; i < 10; ++i) {
+    ACTS_LOG_SAMPLED(INFO, 3, "sampled " << i);
+    ACTS_LOG_SAMPLED(DEBUG, 3, "filtered " << i);
+    ACTS_LOG_THROTTLED(INFO, std::chrono::hours(1), "throttled " << i);
+  }
+  BOOST_CHECK_EQUAL(os.str(),
+                    "sampled 0\nthrottled 0\nsampled 3\nsampled 6\n"
+                    "sampled 9\n");
+}
 }  // namespace Acts::Test
@@ -0,0 +1,88 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/MappedFile.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+std::string tempPath(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+}  // namespace
+
+namespace Acts::Test {
+
+BOOST_AUTO_TEST_SUITE(MappedFileTests)
+
+BOOST_AUTO_TEST_CASE(map_content) {
+  const std::string content = "mapped file content";
+  std::string path = tempPath("MappedFileContent");
+  {
+    std::ofstream os(path, std::ios::binary);
+    os << content;
+  }
+
+  MappedFile file(path);
+  BOOST_CHECK_EQUAL(file.size(), content.size());
+  BOOST_REQUIRE(file.data() != nullptr);
+  file.prefetch();
+  BOOST_CHECK_EQUAL(
+      std::string(reinterpret_cast<const char*>(file.data()), file.size()),
+      content);
+
+  // the mapping moves with the object
+  const std::byte* data = file.data();
+  MappedFile moved(std::move(file));
+  BOOST_CHECK_EQUAL(moved.data(), data);
+  BOOST_CHECK_EQUAL(moved.size(), content.size());
+  BOOST_CHECK(file.data() == nullptr);
+  BOOST_CHECK_EQUAL(file.size(), 0u);
+
+  MappedFile assigned;
+  assigned = std::move(moved);
+  BOOST_CHECK_EQUAL(assigned.data(), data);
+  BOOST_CHECK(moved.data() == nullptr);
+
+  std::filesystem::remove(path);
+  // the mapping stays valid after the file is removed
+  BOOST_CHECK_EQUAL(
+      std::string(reinterpret_cast<const char*>(assigned.data()),
+                  assigned.size()),
+      content);
+}
+
+BOOST_AUTO_TEST_CASE(map_empty) {
+  std::string path = tempPath("MappedFileEmpty");
+  std::ofstream(path, std::ios::binary).close();
+
+  MappedFile file(path);
+  BOOST_CHECK(file.data() == nullptr);
+  BOOST_CHECK_EQUAL(file.size(), 0u);
+  file.prefetch();
+
+  std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(map_missing) {
+  BOOST_CHECK_THROW(MappedFile(tempPath("MappedFileMissing")),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
@@ -0,0 +1,165 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Restore the default thread budget at the end of a test
+struct MaxThreadsGuard {
+  explicit MaxThreadsGuard(std::size_t maxThreads) {
+    Acts::setMaxThreads(maxThreads);
+  }
+  ~MaxThreadsGuard() { Acts::setMaxThreads(1); }
+};
+
+/// Run the tasks and record the thread of every index
+std::vector<std::thread::id> threadOfIndex(std::size_t n) {
+  std::vector<std::thread::id> ids(n);
+  Acts::parallelFor(n, [&](std::size_t i) {
+    ids[i] = std::this_thread::get_id();
+    // keep the threads alive, such that their ids are distinct
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  });
+  return ids;
+}
+
+std::size_t nDistinct(const std::vector<std::thread::id>& ids) {
+  return std::set<std::thread::id>(ids.begin(), ids.end()).size();
+}
+
+}  // namespace
+
+namespace Acts::Test {
+
+BOOST_AUTO_TEST_SUITE(ParallelFor)
+
+BOOST_AUTO_TEST_CASE(max_threads) {
+  BOOST_CHECK_EQUAL(maxThreads(), 1u);
+  {
+    MaxThreadsGuard guard(0);
+    BOOST_CHECK_GE(maxThreads(), 1u);
+  }
+  {
+    MaxThreadsGuard guard(5);
+    BOOST_CHECK_EQUAL(maxThreads(), 5u);
+  }
+  BOOST_CHECK_EQUAL(maxThreads(), 1u);
+
+  // The default budget runs everything in place
+  for (const auto& id : threadOfIndex(5)) {
+    BOOST_CHECK(id == std::this_thread::get_id());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(every_index_once) {
+  for (std::size_t numThreads : {0u, 1u, 3u, 8u, 100u}) {
+    MaxThreadsGuard guard(numThreads);
+    for (std::size_t n : {0u, 1u, 5u, 17u, 1000u}) {
+      std::vector<std::atomic<int>> calls(n);
+      parallelFor(n, [&](std::size_t i) { ++calls.at(i); });
+      for (const auto& c : calls) {
+        BOOST_CHECK_EQUAL(c, 1);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(threads) {
+  MaxThreadsGuard guard(4);
+  std::vector<std::thread::id> ids = threadOfIndex(12);
+  BOOST_CHECK_EQUAL(nDistinct(ids), 4u);
+  // The first block runs on the calling thread, the blocks are contiguous
+  for (std::size_t i = 0; i < 3; ++i) {
+    BOOST_CHECK(ids[i] == std::this_thread::get_id());
+  }
+  for (std::size_t i = 3; i < 12; ++i) {
+    BOOST_CHECK(ids[i] == ids[i - i % 3]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(fewer_tasks_than_threads) {
+  MaxThreadsGuard guard(8);
+  // One thread per task, the others stay in the budget
+  std::vector<std::thread::id> ids = threadOfIndex(3);
+  BOOST_CHECK_EQUAL(nDistinct(ids), 3u);
+  BOOST_CHECK(ids[0] == std::this_thread::get_id());
+
+  ids = threadOfIndex(1);
+  BOOST_CHECK(ids[0] == std::this_thread::get_id());
+}
+
+BOOST_AUTO_TEST_CASE(nested_calls_share_the_budget) {
+  MaxThreadsGuard guard(3);
+  std::atomic<std::size_t> active{0};
+  std::atomic<std::size_t> maxActive{0};
+  std::atomic<std::size_t> calls{0};
+  parallelFor(4, [&](std::size_t) {
+    parallelFor(4, [&](std::size_t) {
+      std::size_t nActive = ++active;
+      std::size_t expected = maxActive;
+      while (nActive > expected &&
+             !maxActive.compare_exchange_weak(expected, nActive)) {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      --active;
+      ++calls;
+    });
+  });
+  BOOST_CHECK_EQUAL(calls, 16u);
+  BOOST_CHECK_GT(maxActive, 1u);
+  BOOST_CHECK_LE(maxActive, 3u);
+
+  // All threads are given back to the budget
+  BOOST_CHECK_EQUAL(nDistinct(threadOfIndex(3)), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(exceptions) {
+  struct IndexError : std::runtime_error {
+    std::size_t index;
+    explicit IndexError(std::size_t i)
+        : std::runtime_error("task failed"), index(i) {}
+  };
+
+  for (std::size_t numThreads : {1u, 4u}) {
+    MaxThreadsGuard guard(numThreads);
+    std::vector<std::atomic<int>> calls(20);
+    try {
+      parallelFor(20, [&](std::size_t i) {
+        ++calls[i];
+        if (i == 7 || i == 8 || i == 16) {
+          throw IndexError(i);
+        }
+      });
+      BOOST_FAIL("No exception rethrown");
+    } catch (const IndexError& e) {
+      // The lowest failing index, its block stopped after it
+      BOOST_CHECK_EQUAL(e.index, 7u);
+    }
+    BOOST_CHECK_EQUAL(calls[8], 0);
+    BOOST_CHECK_EQUAL(calls[0], 1);
+
+    // The threads of the failed call are given back to the budget
+    BOOST_CHECK_EQUAL(nDistinct(threadOfIndex(numThreads)), numThreads);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
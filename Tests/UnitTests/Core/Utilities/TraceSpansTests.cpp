@@ -0,0 +1,112 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/TraceSpans.hpp"
+
+#include <cstddef>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Acts::Test {
+
+BOOST_AUTO_TEST_SUITE(TraceSpans)
+
+BOOST_AUTO_TEST_CASE(record_threads) {
+  SpanRecorder recorder;
+  auto start = SpanRecorder::Clock::now();
+  recorder.record("main", start, start + std::chrono::microseconds(5), 3);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&recorder] {
+      for (int j = 0; j < 10; ++j) {
+        auto now = SpanRecorder::Clock::now();
+        recorder.record("worker", now, now);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto spans = recorder.spans();
+  BOOST_REQUIRE_EQUAL(spans.size(), 41u);
+  BOOST_CHECK_EQUAL(spans.front().name, "main");
+  BOOST_CHECK_EQUAL(spans.front().thread, 0u);
+  BOOST_CHECK_EQUAL(spans.front().event, 3);
+  BOOST_CHECK(spans.front().duration == std::chrono::microseconds(5));
+  std::set<std::size_t> workerThreads;
+  for (std::size_t i = 1; i < spans.size(); ++i) {
+    BOOST_CHECK(spans[i - 1].start <= spans[i].start);
+    BOOST_CHECK_EQUAL(spans[i].name, "worker");
+    BOOST_CHECK_EQUAL(spans[i].event, -1);
+    workerThreads.insert(spans[i].thread);
+  }
+  BOOST_CHECK(workerThreads == std::set<std::size_t>({1, 2, 3, 4}));
+}
+
+BOOST_AUTO_TEST_CASE(chrome_trace) {
+  SpanRecorder recorder;
+  auto start = SpanRecorder::Clock::now();
+  recorder.record("a \"quoted\" name", start,
+                  start + std::chrono::microseconds(2), 7);
+
+  std::ostringstream os;
+  recorder.writeChromeTrace(os);
+  std::string trace = os.str();
+  BOOST_CHECK_EQUAL(trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["),
+                    0u);
+  BOOST_CHECK(trace.find("\"ph\":\"M\",\"pid\":0,\"tid\":0") !=
+              std::string::npos);
+  BOOST_CHECK(trace.find("{\"name\":\"a \\\"quoted\\\" name\",\"ph\":\"X\"") !=
+              std::string::npos);
+  BOOST_CHECK(trace.find("\"dur\":2.000,\"args\":{\"event\":7}}") !=
+              std::string::npos);
+  BOOST_CHECK_EQUAL(trace.substr(trace.size() - 4), "\n]}\n");
+}
+
+BOOST_AUTO_TEST_CASE(scoped_spans) {
+  BOOST_CHECK(SpanRecorder::global() == nullptr);
+  {
+    // nothing is recorded without a global recorder
+    ScopedSpan span("unrecorded");
+    ACTS_TRACE_SPAN("unrecorded");
+  }
+
+  {
+    SpanRecorder recorder;
+    BOOST_CHECK(SpanRecorder::setGlobal(&recorder) == nullptr);
+    {
+      ScopedSpan outer("outer", 1);
+      ACTS_TRACE_SPAN("inner");
+    }
+    auto spans = recorder.spans();
+#ifdef ACTS_ENABLE_TRACE_SPANS
+    BOOST_REQUIRE_EQUAL(spans.size(), 2u);
+    // the inner span ends first, but starts later
+    BOOST_CHECK_EQUAL(spans[0].name, "outer");
+    BOOST_CHECK_EQUAL(spans[1].name, "inner");
+    BOOST_CHECK(spans[0].duration >= spans[1].duration);
+#else
+    BOOST_REQUIRE_EQUAL(spans.size(), 1u);
+    BOOST_CHECK_EQUAL(spans[0].name, "outer");
+#endif
+    BOOST_CHECK_EQUAL(spans[0].event, 1);
+  }
+  // the destroyed recorder uninstalls itself
+  BOOST_CHECK(SpanRecorder::global() == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
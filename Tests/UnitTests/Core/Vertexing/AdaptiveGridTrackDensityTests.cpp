@@ -23,6 +23,7 @@
 #include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 
 namespace bdata = boost::unit_test::data;
 using namespace Acts::UnitLiterals;
@@ -648,4 +649,98 @@ BOOST_AUTO_TEST_CASE(track_removing) {
   CHECK_CLOSE_ABS(0., sixthDensitySum2D, 1e-4);
 }
 
+BOOST_DATA_TEST_CASE(accumulate_many_tracks, bdata::make({false, true}),
+                     useTime) {
+  AdaptiveGridTrackDensity::Config cfg;
+  cfg.spatialBinExtent = 0.05;
+  cfg.temporalBinExtent = 0.05;
+  cfg.temporalTrkGridSizeRange = {5, 5};
+  cfg.useTime = useTime;
+  AdaptiveGridTrackDensity grid(cfg);
+
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3(0., 0., 0.));
+  Covariance covMat = makeRandomCovariance();
+
+  // Overlapping tracks, partially extending the map on both sides
+  AdaptiveGridTrackDensity::DensityMap mainDensityMap;
+  AdaptiveGridTrackDensity::DensityMap expectedDensityMap;
+  std::vector<AdaptiveGridTrackDensity::DensityMap> trackDensityMaps;
+  for (int i = 0; i < 50; ++i) {
+    BoundVector paramVec;
+    paramVec << 0.01, 0.3 * std::sin(3. * i) + 0.002 * i, 0, 0, 0,
+        0.1 * std::cos(5. * i);
+    BoundTrackParameters params(perigeeSurface, paramVec, covMat,
+                                ParticleHypothesis::pion());
+    trackDensityMaps.push_back(grid.addTrack(params, mainDensityMap));
+    for (const auto& [bin, density] : trackDensityMaps.back()) {
+      expectedDensityMap[bin] += density;
+    }
+  }
+
+  BOOST_CHECK_EQUAL(mainDensityMap.size(), expectedDensityMap.size());
+  BOOST_CHECK(mainDensityMap == expectedDensityMap);
+
+  // Remove every second track
+  for (std::size_t i = 0; i < trackDensityMaps.size(); i += 2) {
+    grid.subtractTrack(trackDensityMaps[i], mainDensityMap);
+    for (const auto& [bin, density] : trackDensityMaps[i]) {
+      expectedDensityMap[bin] -= density;
+    }
+  }
+  BOOST_CHECK(mainDensityMap == expectedDensityMap);
+}
+
+BOOST_AUTO_TEST_CASE(elliptical_track_grid) {
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3(0., 0., 0.));
+  Covariance covMat = makeRandomCovariance();
+  BoundVector paramVec;
+  paramVec << -0.1, -0.2, 0, 0, 0, 0.1;
+  BoundTrackParameters params(perigeeSurface, paramVec, covMat,
+                              ParticleHypothesis::pion());
+  Vector3 impactParams = params.impactParameters();
+  SquareMatrix3 ipWeights = params.impactParameterCovariance()->inverse();
+
+  AdaptiveGridTrackDensity::Config cfg;
+  cfg.spatialBinExtent = 0.01;
+  cfg.temporalBinExtent = 0.01;
+  cfg.useTime = true;
+  AdaptiveGridTrackDensity rectangularGrid(cfg);
+  cfg.useEllipticalTrkGrid = true;
+  AdaptiveGridTrackDensity ellipticalGrid(cfg);
+
+  AdaptiveGridTrackDensity::DensityMap rectangularMap;
+  AdaptiveGridTrackDensity::DensityMap ellipticalMap;
+  auto rectangularTrackMap = rectangularGrid.addTrack(params, rectangularMap);
+  auto ellipticalTrackMap = ellipticalGrid.addTrack(params, ellipticalMap);
+  BOOST_CHECK(ellipticalMap == ellipticalTrackMap);
+  BOOST_CHECK_LT(ellipticalMap.size(), rectangularMap.size());
+
+  // The elliptical grid contains exactly the bins of the rectangular grid
+  // which are within 3 standard deviations, with the same densities
+  std::size_t nInside = 0;
+  for (const auto& [bin, density] : rectangularMap) {
+    Vector3 diff = Vector3(0., bin.first * cfg.spatialBinExtent,
+                           bin.second * cfg.temporalBinExtent) -
+                   impactParams;
+    double distance2 = diff.dot(ipWeights * diff);
+    auto it = ellipticalMap.find(bin);
+    if (distance2 < 9. - 1e-6) {
+      BOOST_REQUIRE(it != ellipticalMap.end());
+      BOOST_CHECK_EQUAL(it->second, density);
+      ++nInside;
+    } else if (distance2 > 9. + 1e-6) {
+      BOOST_CHECK(it == ellipticalMap.end());
+    }
+  }
+  BOOST_CHECK_GE(ellipticalMap.size(), nInside);
+
+  // The maximum is unaffected
+  auto rectangularMax = rectangularGrid.getMaxZTPosition(rectangularMap);
+  auto ellipticalMax = ellipticalGrid.getMaxZTPosition(ellipticalMap);
+  BOOST_REQUIRE(rectangularMax.ok() && ellipticalMax.ok());
+  BOOST_CHECK(*rectangularMax == *ellipticalMax);
+}
+
 }  // namespace Acts::Test
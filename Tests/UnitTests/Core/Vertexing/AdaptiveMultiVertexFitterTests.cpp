@@ -28,6 +28,7 @@
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/AnnealingUtility.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Vertexing/AMVFInfo.hpp"
 #include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
@@ -314,6 +315,96 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
                                         << vtxList.at(2).fullPosition());
 }
 
+/// @brief Unit test comparing the fit with concurrent linearizations to the
+/// sequential one
+///
+BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_concurrent_linearization) {
+  std::mt19937 gen(2718);
+
+  auto bField = std::make_shared<ConstantBField>(Vector3{0.0, 0.0, 2_T});
+  EigenStepper<> stepper(bField);
+  auto propagator = std::make_shared<Propagator>(stepper);
+
+  VertexingOptions vertexingOptions(geoContext, magFieldContext);
+
+  ImpactPointEstimator::Config ip3dEstCfg(bField, propagator);
+  ImpactPointEstimator ip3dEst(ip3dEstCfg);
+
+  Linearizer::Config ltConfig;
+  ltConfig.bField = bField;
+  ltConfig.propagator = propagator;
+  Linearizer linearizer(ltConfig);
+
+  // Vertices with enough tracks to split the linearizations into ranges
+  const std::size_t nVertices = 4;
+  const std::size_t nTracksPerVtx = 25;
+  std::vector<Vector3> vtxPosVec;
+  std::vector<BoundTrackParameters> allTracks;
+  for (std::size_t iVtx = 0; iVtx < nVertices; ++iVtx) {
+    vtxPosVec.emplace_back(vXYDist(gen), vXYDist(gen), vZDist(gen));
+    auto perigeeSurface = Surface::makeShared<PerigeeSurface>(vtxPosVec[iVtx]);
+    for (std::size_t iTrack = 0; iTrack < nTracksPerVtx; ++iTrack) {
+      double q = qDist(gen) < 0 ? -1. : 1.;
+      BoundVector paramVec;
+      paramVec << d0Dist(gen), z0Dist(gen), phiDist(gen), thetaDist(gen),
+          q / pTDist(gen), 0.;
+      BoundVector resolutions;
+      resolutions << resIPDist(gen), resIPDist(gen), resAngDist(gen),
+          resAngDist(gen), 0.01 * std::abs(paramVec[eBoundQOverP]), 1.;
+      Covariance covMat = resolutions.cwiseAbs2().asDiagonal();
+      allTracks.emplace_back(perigeeSurface, paramVec, covMat,
+                             ParticleHypothesis::pion());
+    }
+  }
+
+  auto fit = [&](bool linearizeConcurrently) {
+    AdaptiveMultiVertexFitter::Config fitterCfg(ip3dEst);
+    fitterCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(
+        &linearizer);
+    fitterCfg.extractParameters.connect<&InputTrack::extractParameters>();
+    fitterCfg.linearizeConcurrently = linearizeConcurrently;
+    AdaptiveMultiVertexFitter fitter(std::move(fitterCfg));
+
+    std::vector<Vertex> vtxList;
+    for (const auto& vtxPos : vtxPosVec) {
+      Vertex vtx(vtxPos);
+      vtx.setFullCovariance(SquareMatrix4::Identity());
+      vtxList.push_back(vtx);
+    }
+
+    AdaptiveMultiVertexFitter::State state(*bField, magFieldContext);
+    for (std::size_t iTrack = 0; iTrack < allTracks.size(); ++iTrack) {
+      Vertex* vtx = &vtxList[iTrack / nTracksPerVtx];
+      InputTrack inputTrack{&allTracks[iTrack]};
+      state.vtxInfoMap[vtx].trackLinks.push_back(inputTrack);
+      state.tracksAtVerticesMap.insert(
+          std::make_pair(std::make_pair(inputTrack, vtx),
+                         TrackAtVertex(1., allTracks[iTrack], inputTrack)));
+    }
+    for (auto& vtx : vtxList) {
+      state.addVertexToMultiMap(vtx);
+    }
+    for (auto& vtx : vtxList) {
+      BOOST_CHECK(fitter.addVtxToFit(state, vtx, vertexingOptions).ok());
+    }
+    return vtxList;
+  };
+
+  auto serial = fit(false);
+  Acts::setMaxThreads(4);
+  auto concurrent = fit(true);
+  Acts::setMaxThreads(1);
+
+  for (std::size_t iVtx = 0; iVtx < nVertices; ++iVtx) {
+    BOOST_CHECK_NE(serial[iVtx].fullPosition(),
+                   Vertex(vtxPosVec[iVtx]).fullPosition());
+    BOOST_CHECK_EQUAL(concurrent[iVtx].fullPosition(),
+                      serial[iVtx].fullPosition());
+    BOOST_CHECK_EQUAL(concurrent[iVtx].fullCovariance(),
+                      serial[iVtx].fullCovariance());
+  }
+}
+
 /// @brief Unit test for fitting a 4D vertex position
 ///
 BOOST_AUTO_TEST_CASE(time_fitting) {
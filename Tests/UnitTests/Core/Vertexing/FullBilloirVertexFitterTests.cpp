@@ -148,6 +148,14 @@ BOOST_AUTO_TEST_CASE(billoir_vertex_fitter_defaulttrack_test) {
   vertexFitterCfg.trackLinearizer
       .connect<&HelicalTrackLinearizer::linearizeTrack>(&linearizer);
   VertexFitter billoirFitter(vertexFitterCfg);
+
+  // Set up Billoir vertex fitter linearizing all tracks at once
+  VertexFitter::Config batchVertexFitterCfg;
+  batchVertexFitterCfg.extractParameters
+      .connect<&InputTrack::extractParameters>();
+  batchVertexFitterCfg.trackBatchLinearizer
+      .connect<&HelicalTrackLinearizer::linearizeTracks>(&linearizer);
+  VertexFitter batchBilloirFitter(batchVertexFitterCfg);
   auto fieldCache = bField->makeCache(magFieldContext);
   // Vertexing options for default tracks
   VertexingOptions vfOptions(geoContext, magFieldContext);
@@ -284,6 +292,21 @@ BOOST_AUTO_TEST_CASE(billoir_vertex_fitter_defaulttrack_test) {
         "Testing FullBilloirVertexFitter with vertex constraint.") {
       fit(billoirFitter, inputTracks, vfOptionsConstr);
     }
+    BOOST_TEST_CONTEXT(
+        "Testing FullBilloirVertexFitter with batch linearization.") {
+      // The field is homogeneous, so the shared field lookup of the batch
+      // linearization does not change the result
+      Vertex vertex =
+          billoirFitter.fit(inputTracks, vfOptionsConstr, fieldCache).value();
+      Vertex batchVertex =
+          batchBilloirFitter.fit(inputTracks, vfOptionsConstr, fieldCache)
+              .value();
+      CHECK_CLOSE_ABS(batchVertex.fullPosition(), vertex.fullPosition(),
+                      1e-9);
+      CHECK_CLOSE_ABS(batchVertex.fullCovariance(), vertex.fullCovariance(),
+                      1e-9);
+      BOOST_CHECK_EQUAL(batchVertex.tracks().size(), vertex.tracks().size());
+    }
     BOOST_TEST_CONTEXT(
         "Testing FullBilloirVertexFitter with custom tracks (no vertex "
         "constraint).") {
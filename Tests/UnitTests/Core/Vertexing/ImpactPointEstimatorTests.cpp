@@ -40,6 +40,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -536,4 +537,123 @@ BOOST_DATA_TEST_CASE(SingeTrackImpactParameters, tracks* vertices, d0, l0, t0,
   // restricted further?
 }
 
+// Check that the batch versions of `estimate3DImpactParameters` and
+// `getVertexCompatibility` give the same results as the single track ones.
+BOOST_AUTO_TEST_CASE(MultipleTracksImpactParametersCompatibility) {
+  Estimator ipEstimator = makeEstimator(2_T);
+  Estimator::State state{magFieldCache()};
+
+  auto perigeeSurface = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  auto otherSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3(0., 0., 10_mm));
+
+  std::vector<BoundTrackParameters> trkParams;
+  for (double phi : {0_degree, -45_degree, 45_degree}) {
+    for (double theta : {90_degree, 20_degree, 160_degree}) {
+      for (double p : {0.4_GeV, 10_GeV}) {
+        for (double q : {-1_e, 0_e, 1_e}) {
+          auto particleHypothesis = q == 0 ? ParticleHypothesis::pion0()
+                                           : ParticleHypothesis::pion();
+          BoundVector par;
+          par[eBoundLoc0] = 25_um;
+          par[eBoundLoc1] = -1_mm;
+          par[eBoundTime] = 1_ns;
+          par[eBoundPhi] = phi;
+          par[eBoundTheta] = theta;
+          par[eBoundQOverP] = particleHypothesis.qOverP(p, q);
+          trkParams.emplace_back(trkParams.size() % 4 == 0 ? otherSurface
+                                                           : perigeeSurface,
+                                 par, makeBoundParametersCovariance(),
+                                 particleHypothesis);
+        }
+      }
+    }
+  }
+
+  Vector4 vtxPos(10_um, -10_um, 2_mm, 1_ns);
+  std::vector<BoundTrackParameters> ipParams;
+  BOOST_REQUIRE(ipEstimator
+                    .estimate3DImpactParameters(
+                        geoContext, magFieldContext, trkParams,
+                        vtxPos.head<3>(), state, ipParams)
+                    .ok());
+  BOOST_REQUIRE_EQUAL(ipParams.size(), trkParams.size());
+
+  std::vector<double> compatibilities;
+  BOOST_REQUIRE(ipEstimator
+                    .getVertexCompatibilities(geoContext, ipParams, vtxPos,
+                                              compatibilities)
+                    .ok());
+  BOOST_REQUIRE_EQUAL(compatibilities.size(), trkParams.size());
+
+  for (std::size_t i = 0; i < trkParams.size(); ++i) {
+    auto expected =
+        ipEstimator
+            .estimate3DImpactParameters(geoContext, magFieldContext,
+                                        trkParams[i], vtxPos.head<3>(), state)
+            .value();
+    BOOST_CHECK_EQUAL(ipParams[i].parameters(), expected.parameters());
+    BOOST_CHECK_EQUAL(*ipParams[i].covariance(), *expected.covariance());
+    BOOST_CHECK_EQUAL(
+        ipParams[i].referenceSurface().transform(geoContext).matrix(),
+        expected.referenceSurface().transform(geoContext).matrix());
+
+    double compatibility =
+        ipEstimator.getVertexCompatibility(geoContext, &expected, vtxPos)
+            .value();
+    BOOST_CHECK_EQUAL(compatibilities[i], compatibility);
+  }
+}
+
+
+// Check the batch versions for an empty set of tracks and that they fail like
+// the single track ones if the Newton optimization does not converge.
+BOOST_AUTO_TEST_CASE(MultipleTracksEmptyAndNotConverged) {
+  Estimator ipEstimator = makeEstimator(2_T);
+  Estimator::State state{magFieldCache()};
+  Vector4 vtxPos(10_um, -10_um, 2_mm, 1_ns);
+
+  auto perigeeSurface = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  BoundVector par;
+  par << 25_um, -1_mm, 20_degree, 70_degree, 1_e / 2_GeV, 1_ns;
+  BoundTrackParameters track(perigeeSurface, par,
+                             makeBoundParametersCovariance(),
+                             ParticleHypothesis::pion());
+
+  std::vector<BoundTrackParameters> ipParams(1, track);
+  BOOST_CHECK(ipEstimator
+                  .estimate3DImpactParameters(geoContext, magFieldContext, {},
+                                              vtxPos.head<3>(), state,
+                                              ipParams)
+                  .ok());
+  BOOST_CHECK(ipParams.empty());
+  std::vector<double> compatibilities(1, 1.);
+  BOOST_CHECK(ipEstimator
+                  .getVertexCompatibilities(geoContext, {}, vtxPos,
+                                            compatibilities)
+                  .ok());
+  BOOST_CHECK(compatibilities.empty());
+
+  // a single iteration does not reach the precision
+  auto field = std::make_shared<MagneticField>(Vector3(0, 0, 2_T));
+  Stepper stepper(field);
+  Estimator::Config cfg(field,
+                        std::make_shared<::Propagator>(
+                            std::move(stepper), VoidNavigator(),
+                            getDefaultLogger("Prop", Logging::Level::WARNING)));
+  cfg.maxIterations = 1;
+  cfg.precision = 0.;
+  Estimator failingEstimator(cfg, getDefaultLogger("IPEst", Logging::FATAL));
+
+  std::vector<BoundTrackParameters> trkParams(2, track);
+  auto single = failingEstimator.estimate3DImpactParameters(
+      geoContext, magFieldContext, track, vtxPos.head<3>(), state);
+  auto batch = failingEstimator.estimate3DImpactParameters(
+      geoContext, magFieldContext, trkParams, vtxPos.head<3>(), state,
+      ipParams);
+  BOOST_REQUIRE(!single.ok());
+  BOOST_REQUIRE(!batch.ok());
+  BOOST_CHECK_EQUAL(batch.error(), single.error());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
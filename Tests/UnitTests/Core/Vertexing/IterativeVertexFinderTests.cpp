@@ -161,6 +161,16 @@ BOOST_AUTO_TEST_CASE(iterative_finder_test) {
 
     // Vertex Finder
 
+    // Same finder adding the reassigned tracks with Kalman updates
+    IterativeVertexFinder::Config kalmanCfg(BilloirFitter(vertexFitterCfg),
+                                            sFinder, ipEstimator);
+    kalmanCfg.field = bField;
+    kalmanCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(
+        &linearizer);
+    kalmanCfg.reassignTracksAfterFirstFit = true;
+    kalmanCfg.reassignWithKalmanUpdate = true;
+    kalmanCfg.extractParameters.connect<&InputTrack::extractParameters>();
+
     IterativeVertexFinder::Config cfg(std::move(bFitter), std::move(sFinder),
                                       ipEstimator);
     cfg.field = bField;
@@ -173,6 +183,10 @@ BOOST_AUTO_TEST_CASE(iterative_finder_test) {
     IVertexFinder::State state{
         IterativeVertexFinder::State(*bField, magFieldContext)};
 
+    IterativeVertexFinder kalmanFinder(std::move(kalmanCfg));
+    IVertexFinder::State kalmanState{
+        IterativeVertexFinder::State(*bField, magFieldContext)};
+
     // Vector to be filled with all tracks in current event
     std::vector<std::unique_ptr<const BoundTrackParameters>> tracks;
 
@@ -322,6 +336,21 @@ BOOST_AUTO_TEST_CASE(iterative_finder_test) {
 
     // check if found vertices have compatible z values
     BOOST_CHECK(allVerticesFound);
+
+    // The Kalman updates find vertices of the same quality
+    auto kalmanRes = kalmanFinder.find(inputTracks, vertexingOptions,
+                                       kalmanState);
+    if (!kalmanRes.ok()) {
+      BOOST_FAIL(kalmanRes.error().message());
+    }
+    CHECK_CLOSE_ABS(kalmanRes->size(), nVertices, 2);
+    for (const auto& trueVertex : trueVertices) {
+      BOOST_CHECK(std::any_of(
+          kalmanRes->begin(), kalmanRes->end(), [&](const Vertex& recoVertex) {
+            return std::abs(trueVertex.position()[eZ] -
+                            recoVertex.position()[eZ]) < 2_mm;
+          }));
+    }
   }
 }
 
@@ -14,6 +14,7 @@
 #include "Acts/Definitions/Direction.hpp"
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/BoundTrackParametersBatch.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
@@ -35,6 +36,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <memory>
 #include <random>
 #include <tuple>
@@ -276,4 +278,67 @@ BOOST_AUTO_TEST_CASE(linearized_track_factory_test) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(linearized_track_factory_batch_test) {
+  std::mt19937 gen(2718);
+
+  auto constField = std::make_shared<ConstantBField>(Vector3{0.0, 0.0, 2_T});
+  EigenStepper<> stepper(constField);
+  auto propagator = std::make_shared<HelicalPropagator>(stepper);
+
+  std::shared_ptr<PerigeeSurface> perigeeSurface{
+      Surface::makeShared<PerigeeSurface>(Vector3{0., 0., 0.})};
+
+  std::vector<BoundTrackParameters> tracks;
+  for (unsigned int iTrack = 0; iTrack < 20; iTrack++) {
+    double q = qDist(gen) < 0 ? -1. : 1.;
+    BoundVector paramVec;
+    paramVec << d0Dist(gen), z0Dist(gen), phiDist(gen), thetaDist(gen),
+        q / pTDist(gen), tDist(gen);
+    Covariance covMat = Covariance::Identity() * 1e-4;
+    tracks.emplace_back(perigeeSurface, paramVec, std::move(covMat),
+                        ParticleHypothesis::pion());
+  }
+
+  AnalyticalLinearizer::Config linConfig;
+  linConfig.bField = constField;
+  linConfig.propagator = propagator;
+  AnalyticalLinearizer linFactory(linConfig);
+
+  MagneticFieldProvider::Cache fieldCache =
+      constField->makeCache(magFieldContext);
+
+  Vector4 linPoint(vXYDist(gen), vXYDist(gen), vZDist(gen), vTDist(gen));
+  std::shared_ptr<PerigeeSurface> perigee =
+      Surface::makeShared<PerigeeSurface>(VectorHelpers::position(linPoint));
+
+  BoundTrackParametersBatch batch;
+  for (const auto& trk : tracks) {
+    batch.push_back(trk);
+  }
+
+  std::vector<LinearizedTrack> linTracks;
+  BOOST_REQUIRE(linFactory
+                    .linearizeTracks(batch, linPoint[3], *perigee, geoContext,
+                                     magFieldContext, fieldCache, linTracks)
+                    .ok());
+  BOOST_REQUIRE_EQUAL(linTracks.size(), tracks.size());
+
+  // The batch gives the same result as the individual linearizations
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    const LinearizedTrack linTrack =
+        linFactory
+            .linearizeTrack(tracks[i], linPoint[3], *perigee, geoContext,
+                            magFieldContext, fieldCache)
+            .value();
+    BOOST_CHECK_EQUAL(linTracks[i].parametersAtPCA, linTrack.parametersAtPCA);
+    BOOST_CHECK_EQUAL(linTracks[i].covarianceAtPCA, linTrack.covarianceAtPCA);
+    BOOST_CHECK_EQUAL(linTracks[i].linearizationPoint, linPoint);
+    BOOST_CHECK_EQUAL(linTracks[i].positionJacobian,
+                      linTrack.positionJacobian);
+    BOOST_CHECK_EQUAL(linTracks[i].momentumJacobian,
+                      linTrack.momentumJacobian);
+    BOOST_CHECK_EQUAL(linTracks[i].constantTerm, linTrack.constantTerm);
+  }
+}
+
 }  // namespace Acts::Test
@@ -23,6 +23,7 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/UnitVectors.hpp"
 #include "Acts/Vertexing/DummyVertexFitter.hpp"
@@ -281,6 +282,105 @@ BOOST_AUTO_TEST_CASE(track_density_finder_random_test) {
   }
 }
 
+///
+/// @brief Unit test for TrackDensityVertexFinder with a coarse pre-scan of
+/// the density, which needs to find the same maximum as the search starting
+/// from every track
+///
+BOOST_AUTO_TEST_CASE(track_density_finder_prescan_test) {
+  Covariance covMat = Covariance::Identity();
+
+  // Perigee surface for track parameters
+  Vector3 pos0{0, 0, 0};
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(pos0);
+
+  VertexingOptions vertexingOptions(geoContext, magFieldContext);
+  GaussianTrackDensity::Config densityCfg;
+  densityCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  TrackDensityVertexFinder finder{{{densityCfg}}};
+  auto state = finder.makeState(magFieldContext);
+
+  GaussianTrackDensity::Config preScanCfg = densityCfg;
+  preScanCfg.preScanBinSize = 0.5_mm;
+  TrackDensityVertexFinder preScanFinder{{{preScanCfg}}};
+
+  int mySeed = 27182;
+  std::mt19937 gen(mySeed);
+  unsigned int nTracks = 200;
+
+  std::vector<BoundTrackParameters> trackVec;
+  trackVec.reserve(nTracks);
+
+  // Create nTracks tracks for test case
+  for (unsigned int i = 0; i < nTracks; i++) {
+    // The position of the particle
+    Vector3 pos(xdist(gen), ydist(gen), 0);
+
+    // Create momentum and charge of track
+    double pt = pTDist(gen);
+    double phi = phiDist(gen);
+    double eta = etaDist(gen);
+    double charge = etaDist(gen) > 0 ? 1 : -1;
+
+    // project the position on the surface
+    Vector3 direction = makeDirectionFromPhiEta(phi, eta);
+    auto intersection =
+        perigeeSurface->intersect(geoContext, pos, direction).closest();
+    pos = intersection.position();
+
+    // Produce most of the tracks at near z1 position,
+    // some near z2. Highest track density then expected at z1
+    pos[eZ] = ((i % 4) == 0) ? z2dist(gen) : z1dist(gen);
+
+    trackVec.push_back(BoundTrackParameters::create(
+                           perigeeSurface, geoContext, makeVector4(pos, 0),
+                           direction, charge / pt, covMat,
+                           ParticleHypothesis::pion())
+                           .value());
+  }
+
+  std::vector<InputTrack> inputTracks;
+  for (const auto& trk : trackVec) {
+    inputTracks.emplace_back(&trk);
+  }
+
+  auto res = finder.find(inputTracks, vertexingOptions, state);
+  auto preScanRes = preScanFinder.find(inputTracks, vertexingOptions, state);
+  BOOST_REQUIRE(res.ok());
+  BOOST_REQUIRE(preScanRes.ok());
+  BOOST_REQUIRE(!(*res).empty());
+  BOOST_REQUIRE(!(*preScanRes).empty());
+
+  Vector3 result = (*res).back().position();
+  Vector3 preScanResult = (*preScanRes).back().position();
+  CHECK_CLOSE_ABS(preScanResult[eZ], result[eZ], 1_um);
+  CHECK_CLOSE_ABS(preScanResult[eZ], zVertexPos, 1_mm);
+
+  // The searches and the pre-scan split into ranges find the same maximum
+  GaussianTrackDensity::Config finePreScanCfg = densityCfg;
+  finePreScanCfg.preScanBinSize = 1_um;
+  TrackDensityVertexFinder finePreScanFinder{{{finePreScanCfg}}};
+  auto finePreScanRes =
+      finePreScanFinder.find(inputTracks, vertexingOptions, state);
+  BOOST_REQUIRE(finePreScanRes.ok());
+  BOOST_REQUIRE(!(*finePreScanRes).empty());
+
+  Acts::setMaxThreads(4);
+  auto threadedRes = finder.find(inputTracks, vertexingOptions, state);
+  auto threadedFinePreScanRes =
+      finePreScanFinder.find(inputTracks, vertexingOptions, state);
+  Acts::setMaxThreads(1);
+  BOOST_REQUIRE(threadedRes.ok());
+  BOOST_REQUIRE(threadedFinePreScanRes.ok());
+  BOOST_REQUIRE(!(*threadedRes).empty());
+  BOOST_REQUIRE(!(*threadedFinePreScanRes).empty());
+  BOOST_CHECK_EQUAL((*threadedRes).back().fullPosition(),
+                    (*res).back().fullPosition());
+  BOOST_CHECK_EQUAL((*threadedFinePreScanRes).back().fullPosition(),
+                    (*finePreScanRes).back().fullPosition());
+}
+
 // Dummy user-defined InputTrackStub type
 struct InputTrackStub {
   InputTrackStub(const BoundTrackParameters& params) : m_parameters(params) {}
@@ -0,0 +1,163 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/TrackFindingML/SeedFilterMLAlgorithm.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace ActsExamples;
+using namespace Acts::Test;
+
+namespace {
+
+struct TestEvent {
+  SimSpacePointContainer spacePoints;
+  SimSeedContainer seeds;
+  TrackParametersContainer params;
+};
+
+/// Make an event with groups of nearby seeds, such that the clustering finds
+/// duplicates to choose from
+TestEvent makeEvent(std::mt19937& gen, std::size_t nGroups) {
+  std::uniform_real_distribution<double> distPhi(-M_PI, M_PI);
+  std::uniform_real_distribution<double> distTheta(0.5, 2.6);
+  std::uniform_real_distribution<double> distQOverP(-1., 1.);
+  std::uniform_real_distribution<double> distZ(-50., 50.);
+  std::uniform_real_distribution<double> distSmear(-0.001, 0.001);
+  std::uniform_int_distribution<std::size_t> distSize(1, 4);
+
+  auto perigee =
+      Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3::Zero());
+
+  TestEvent event;
+  std::vector<std::size_t> groupSizes;
+  for (std::size_t i = 0; i < nGroups; ++i) {
+    groupSizes.push_back(distSize(gen));
+  }
+  std::size_t nSeeds = 0;
+  for (std::size_t size : groupSizes) {
+    nSeeds += size;
+  }
+  // the seeds point to the space points, which must not be reallocated
+  event.spacePoints.reserve(3 * nSeeds);
+
+  for (std::size_t size : groupSizes) {
+    const double phi = distPhi(gen);
+    const double theta = distTheta(gen);
+    const double qOverP = distQOverP(gen);
+    const double z = distZ(gen);
+    for (std::size_t j = 0; j < size; ++j) {
+      Acts::BoundVector params = Acts::BoundVector::Zero();
+      params[Acts::eBoundPhi] = phi + distSmear(gen);
+      params[Acts::eBoundTheta] = theta + distSmear(gen);
+      params[Acts::eBoundQOverP] = qOverP;
+      event.params.emplace_back(perigee, params, std::nullopt,
+                                Acts::ParticleHypothesis::pion());
+
+      for (double r : {30., 70., 110.}) {
+        Acts::Vector3 position(r * std::cos(phi), r * std::sin(phi),
+                               z + r / std::tan(theta) + distSmear(gen));
+        event.spacePoints.emplace_back(position, std::nullopt, 0.01, 0.01,
+                                       std::nullopt,
+                                       boost::container::static_vector<
+                                           Acts::SourceLink, 2>{});
+      }
+      const auto* sp = &event.spacePoints[event.spacePoints.size() - 3];
+      event.seeds.emplace_back(sp[0], sp[1], sp[2], z + distSmear(gen),
+                               static_cast<float>(j));
+    }
+  }
+  return event;
+}
+
+SeedFilterMLAlgorithm::Config makeConfig() {
+  SeedFilterMLAlgorithm::Config cfg;
+  cfg.inputTrackParameters = "parameters";
+  cfg.inputSimSeeds = "seeds";
+  cfg.inputSeedFilterNN = ACTS_SEED_FILTER_NN;
+  cfg.outputTrackParameters = "filtered-parameters";
+  cfg.outputSimSeeds = "filtered-seeds";
+  cfg.maxBatchSize = 3;
+  return cfg;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedFilterMLAlgorithmTests)
+
+BOOST_AUTO_TEST_CASE(BatchEqualsSingleEvents) {
+  std::mt19937 gen(42);
+  std::vector<TestEvent> events;
+  for (std::size_t nGroups : {5u, 0u, 12u}) {
+    events.push_back(makeEvent(gen, nGroups));
+  }
+
+  SeedFilterMLAlgorithm algorithm(makeConfig(), Acts::Logging::WARNING);
+  BOOST_CHECK_EQUAL(algorithm.maxBatchSize(), 3u);
+
+  auto fillBoard = [](const TestEvent& event, WhiteBoard& board) {
+    addToWhiteBoard("seeds", event.seeds, board);
+    addToWhiteBoard("parameters", event.params, board);
+  };
+
+  std::vector<WhiteBoard> singleBoards(events.size());
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    fillBoard(events[i], singleBoards[i]);
+    AlgorithmContext ctx(0, i, singleBoards[i]);
+    BOOST_CHECK(algorithm.execute(ctx) == ProcessCode::SUCCESS);
+  }
+
+  std::vector<WhiteBoard> batchBoards(events.size());
+  std::vector<AlgorithmContext> contexts;
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    fillBoard(events[i], batchBoards[i]);
+    contexts.emplace_back(0, i, batchBoards[i]);
+  }
+  BOOST_CHECK(algorithm.executeBatch(contexts) == ProcessCode::SUCCESS);
+
+  std::size_t nSelected = 0;
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    auto singleSeeds =
+        getFromWhiteBoard<SimSeedContainer>("filtered-seeds", singleBoards[i]);
+    auto batchSeeds =
+        getFromWhiteBoard<SimSeedContainer>("filtered-seeds", batchBoards[i]);
+    auto singleParams = getFromWhiteBoard<TrackParametersContainer>(
+        "filtered-parameters", singleBoards[i]);
+    auto batchParams = getFromWhiteBoard<TrackParametersContainer>(
+        "filtered-parameters", batchBoards[i]);
+
+    BOOST_REQUIRE_EQUAL(singleSeeds.size(), batchSeeds.size());
+    BOOST_REQUIRE_EQUAL(singleParams.size(), batchParams.size());
+    BOOST_CHECK_EQUAL(singleSeeds.size(), singleParams.size());
+    for (std::size_t j = 0; j < singleSeeds.size(); ++j) {
+      BOOST_CHECK_EQUAL(singleSeeds[j].sp()[0], batchSeeds[j].sp()[0]);
+      BOOST_CHECK_EQUAL(singleSeeds[j].z(), batchSeeds[j].z());
+      BOOST_CHECK_EQUAL(singleParams[j].parameters(),
+                        batchParams[j].parameters());
+    }
+    nSelected += singleSeeds.size();
+  }
+  // the duplicates are removed, but not all seeds
+  BOOST_CHECK_GT(nSelected, 0u);
+  BOOST_CHECK_LT(nSelected, events[0].seeds.size() + events[2].seeds.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
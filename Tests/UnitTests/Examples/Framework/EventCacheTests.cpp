@@ -0,0 +1,115 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/EventCache.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace ActsExamples::Test {
+
+namespace {
+
+/// Provides the handles to the cached proto tracks
+class TrackHandles final : public IAlgorithm {
+ public:
+  TrackHandles() : IAlgorithm("TrackHandles") {
+    write.initialize("tracks");
+    read.initialize("tracks");
+  }
+
+  ProcessCode execute(const AlgorithmContext& /*ctx*/) const override {
+    return ProcessCode::SUCCESS;
+  }
+
+  WriteDataHandle<ProtoTrackContainer> write{this, "Output"};
+  ReadDataHandle<ProtoTrackContainer> read{this, "Input"};
+};
+
+EventCache makeCache() {
+  EventCache::Config cfg;
+  cfg.directory =
+      (std::filesystem::temp_directory_path() / "acts_event_cache_test")
+          .string();
+  cfg.key = "key";
+  cfg.collections = {"tracks"};
+  return EventCache(cfg, Acts::Logging::WARNING);
+}
+
+// the payload of two proto tracks with two and one index is at the end of
+// the file: the number of tracks, then the size and the indices of each
+constexpr std::int64_t kPayloadSize =
+    3 * sizeof(std::uint64_t) + 3 * sizeof(Index);
+
+void overwrite(const std::string& file, std::int64_t offsetInPayload,
+               std::uint64_t value) {
+  std::int64_t fileSize = std::filesystem::file_size(file);
+  std::fstream fs(file, std::ios::binary | std::ios::in | std::ios::out);
+  fs.seekp(fileSize - kPayloadSize + offsetInPayload);
+  fs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventCacheTests)
+
+BOOST_AUTO_TEST_CASE(RoundTrip) {
+  auto cache = makeCache();
+  TrackHandles handles;
+  WhiteBoard wb;
+  handles.write(wb, ProtoTrackContainer{{1, 2}, {3}});
+  cache.store(7, wb);
+  BOOST_CHECK(cache.contains(7));
+
+  WhiteBoard loaded;
+  cache.load(7, loaded, {"tracks"});
+  const auto& tracks = handles.read(loaded);
+  BOOST_REQUIRE_EQUAL(tracks.size(), 2u);
+  BOOST_CHECK(tracks[0] == ProtoTrack({1, 2}));
+  BOOST_CHECK(tracks[1] == ProtoTrack({3}));
+
+  std::filesystem::remove_all(cache.config().directory);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidSizes) {
+  auto cache = makeCache();
+  TrackHandles handles;
+  WhiteBoard wb;
+  handles.write(wb, ProtoTrackContainer{{1, 2}, {3}});
+
+  // sizes of the payload, the track container and a track, which do not fit
+  // into the file, are rejected instead of being allocated
+  for (std::int64_t offset : {0, 8}) {
+    cache.store(7, wb);
+    overwrite(cache.path(7), offset, std::uint64_t{1} << 40);
+    WhiteBoard loaded;
+    BOOST_CHECK_THROW(cache.load(7, loaded, {"tracks"}), std::runtime_error);
+  }
+  // the size of the payload string precedes it
+  cache.store(7, wb);
+  overwrite(cache.path(7), -8, ~std::uint64_t{0});
+  WhiteBoard loaded;
+  BOOST_CHECK_THROW(cache.load(7, loaded, {"tracks"}), std::runtime_error);
+
+  std::filesystem::remove_all(cache.config().directory);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsExamples::Test
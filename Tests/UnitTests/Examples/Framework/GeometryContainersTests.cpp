@@ -0,0 +1,58 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace ActsExamples::Test {
+
+BOOST_AUTO_TEST_SUITE(GeometryContainersTests)
+
+BOOST_AUTO_TEST_CASE(GeometryIdRangeTableLookup) {
+  IndexSourceLinkContainer sourceLinks;
+  Index index = 0;
+  for (Acts::GeometryIdentifier::Value volume : {2u, 4u}) {
+    for (Acts::GeometryIdentifier::Value sensitive = 1; sensitive < 20;
+         ++sensitive) {
+      auto geoId = Acts::GeometryIdentifier().setVolume(volume).setLayer(2u);
+      geoId.setSensitive(sensitive);
+      for (std::size_t i = 0; i < sensitive % 4; ++i) {
+        sourceLinks.insert(IndexSourceLink(geoId, index++));
+      }
+    }
+  }
+
+  GeometryIdRangeTable<IndexSourceLink> table(sourceLinks);
+  // every fourth module has no source links
+  BOOST_CHECK_EQUAL(table.size(), 2u * 15u);
+
+  for (auto&& [geoId, elements] : groupByModule(sourceLinks)) {
+    auto [begin, end] = table.equal_range(sourceLinks, geoId);
+    BOOST_CHECK(begin == elements.begin());
+    BOOST_CHECK(end == elements.end());
+  }
+
+  auto missing = Acts::GeometryIdentifier().setVolume(2u).setLayer(2u);
+  missing.setSensitive(4u);
+  auto [begin, end] = table.equal_range(sourceLinks, missing);
+  BOOST_CHECK(begin == end);
+  auto expected = sourceLinks.equal_range(missing);
+  BOOST_CHECK_EQUAL(std::distance(expected.first, expected.second), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsExamples::Test
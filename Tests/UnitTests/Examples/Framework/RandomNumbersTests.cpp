@@ -0,0 +1,123 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/PhiloxEngine.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace ActsExamples::Test {
+
+BOOST_AUTO_TEST_SUITE(RandomNumbersTests)
+
+BOOST_AUTO_TEST_CASE(PhiloxKnownAnswers) {
+  // reference values of the Random123 library for Philox4x32-10
+  PhiloxEngine zero(0u, 0u);
+  const std::array<std::uint32_t, 4> zeroExpected = {0x6627e8d5, 0xe169c58d,
+                                                     0xbc57ac4c, 0x9b00dbd8};
+  for (auto expected : zeroExpected) {
+    BOOST_CHECK_EQUAL(zero(), expected);
+  }
+
+  PhiloxEngine ones(0xffffffffffffffff, 0xffffffffffffffff);
+  // skip to the last block of the stream
+  for (int i = 0; i < 4; ++i) {
+    ones.discard(0xfffffffffffffffc);
+  }
+  ones.discard(12);
+  const std::array<std::uint32_t, 4> onesExpected = {0x408f276d, 0x41c83b0e,
+                                                     0xa20bc7c6, 0x6d5451fd};
+  for (auto expected : onesExpected) {
+    BOOST_CHECK_EQUAL(ones(), expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PhiloxBatches) {
+  PhiloxEngine single(1234u, 5u);
+  PhiloxEngine batch(1234u, 5u);
+
+  // the batches are consistent with single draws at any buffer offset
+  std::vector<std::uint32_t> values(37);
+  for (std::size_t n : {1u, 3u, 8u, 37u, 2u}) {
+    batch.generate(values.data(), n);
+    for (std::size_t i = 0; i < n; ++i) {
+      BOOST_CHECK_EQUAL(values[i], single());
+    }
+  }
+  BOOST_CHECK(single == batch);
+
+  single.discard(11);
+  for (std::size_t i = 0; i < 11; ++i) {
+    batch();
+  }
+  BOOST_CHECK(single == batch);
+  BOOST_CHECK_EQUAL(single(), batch());
+}
+
+BOOST_AUTO_TEST_CASE(PhiloxDistributions) {
+  PhiloxEngine rng(42u, 0u);
+
+  const std::size_t n = 100000;
+  std::vector<double> values(n);
+
+  rng.uniform(values.data(), n);
+  double sum = 0;
+  for (double value : values) {
+    BOOST_CHECK(0 <= value && value < 1);
+    sum += value;
+  }
+  BOOST_CHECK_SMALL(sum / n - 0.5, 0.01);
+
+  rng.normal(values.data(), n);
+  double mean = 0;
+  double var = 0;
+  for (double value : values) {
+    mean += value;
+    var += value * value;
+  }
+  mean /= n;
+  var = var / n - mean * mean;
+  BOOST_CHECK_SMALL(mean, 0.01);
+  BOOST_CHECK_SMALL(var - 1, 0.02);
+
+  // usable with the standard distributions
+  std::normal_distribution<double> stdNormal(0., 1.);
+  BOOST_CHECK(std::isfinite(stdNormal(rng)));
+}
+
+BOOST_AUTO_TEST_CASE(SpawnStream) {
+  RandomNumbers random(RandomNumbers::Config{});
+  WhiteBoard store;
+  AlgorithmContext ctx(1, 12, store);
+
+  auto a = random.spawnStream(ctx, 7);
+  auto b = random.spawnStream(ctx, 7);
+  BOOST_CHECK(a == b);
+  BOOST_CHECK_EQUAL(a(), b());
+
+  // other streams, algorithms and events are independent
+  BOOST_CHECK(random.spawnStream(ctx, 8).stream() == 8);
+  AlgorithmContext otherAlgorithm(2, 12, store);
+  AlgorithmContext otherEvent(1, 13, store);
+  BOOST_CHECK_NE(random.spawnStream(otherAlgorithm, 7).key(), a.key());
+  BOOST_CHECK_NE(random.spawnStream(otherEvent, 7).key(), a.key());
+  BOOST_CHECK_NE(random.spawnStream(ctx, 8)(), random.spawnStream(ctx, 7)());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsExamples::Test
@@ -0,0 +1,246 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples::Test {
+
+namespace {
+
+class NumberReader final : public IReader {
+ public:
+  NumberReader() { m_output.initialize("number"); }
+
+  std::string name() const override { return "NumberReader"; }
+
+  std::pair<std::size_t, std::size_t> availableEvents() const override {
+    return {0, 20};
+  }
+
+  ProcessCode read(const AlgorithmContext& ctx) override {
+    m_output(ctx, static_cast<int>(ctx.eventNumber));
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  WriteDataHandle<int> m_output{this, "Output"};
+};
+
+/// Writes the input number times a factor
+class ScaleAlgorithm final : public IAlgorithm {
+ public:
+  ScaleAlgorithm(const std::string& output, int factor)
+      : IAlgorithm("Scale" + output), m_factor(factor) {
+    m_input.initialize("number");
+    m_output.initialize(output);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    m_output(ctx, m_factor * m_input(ctx));
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  int m_factor;
+  ReadDataHandle<int> m_input{this, "Input"};
+  WriteDataHandle<int> m_output{this, "Output"};
+};
+
+/// Records the sum of the scaled numbers of every event
+class SumAlgorithm final : public IAlgorithm {
+ public:
+  SumAlgorithm() : IAlgorithm("Sum") {
+    m_first.initialize("double");
+    m_second.initialize("triple");
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    sums[ctx.eventNumber].push_back(m_first(ctx) + m_second(ctx));
+    return ProcessCode::SUCCESS;
+  }
+
+  mutable std::map<std::size_t, std::vector<int>> sums;
+
+ private:
+  mutable std::mutex m_mutex;
+  ReadDataHandle<int> m_first{this, "First"};
+  ReadDataHandle<int> m_second{this, "Second"};
+};
+
+/// Writes the input number times a factor for batches of events
+class BatchScaleAlgorithm final : public IAlgorithm {
+ public:
+  BatchScaleAlgorithm(const std::string& output, int factor)
+      : IAlgorithm("BatchScale" + output), m_factor(factor) {
+    m_input.initialize("number");
+    m_output.initialize(output);
+  }
+
+  std::size_t maxBatchSize() const override { return 3; }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    return executeBatch({ctx});
+  }
+
+  ProcessCode executeBatch(
+      const std::vector<AlgorithmContext>& contexts) const override {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      batchSizes.push_back(contexts.size());
+    }
+    for (const AlgorithmContext& ctx : contexts) {
+      m_output(ctx, m_factor * m_input(ctx));
+    }
+    return ProcessCode::SUCCESS;
+  }
+
+  mutable std::vector<std::size_t> batchSizes;
+
+ private:
+  int m_factor;
+  mutable std::mutex m_mutex;
+  ReadDataHandle<int> m_input{this, "Input"};
+  WriteDataHandle<int> m_output{this, "Output"};
+};
+
+void checkEventLoop(Sequencer::Config cfg) {
+  cfg.events = 20;
+  cfg.logLevel = Acts::Logging::WARNING;
+  Sequencer sequencer(cfg);
+  sequencer.addReader(std::make_shared<NumberReader>());
+  sequencer.addAlgorithm(std::make_shared<ScaleAlgorithm>("double", 2));
+  sequencer.addAlgorithm(std::make_shared<ScaleAlgorithm>("triple", 3));
+  auto sum = std::make_shared<SumAlgorithm>();
+  sequencer.addAlgorithm(sum);
+
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+  // every event is processed exactly once
+  BOOST_CHECK_EQUAL(sum->sums.size(), 20u);
+  for (const auto& [event, values] : sum->sums) {
+    BOOST_REQUIRE_EQUAL(values.size(), 1u);
+    BOOST_CHECK_EQUAL(values.front(), 5 * static_cast<int>(event));
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SequencerTests)
+
+BOOST_AUTO_TEST_CASE(SingleThreaded) {
+  Sequencer::Config cfg;
+  cfg.numThreads = 1;
+  checkEventLoop(cfg);
+}
+
+BOOST_AUTO_TEST_CASE(MultiThreaded) {
+  Sequencer::Config cfg;
+  cfg.numThreads = 4;
+  checkEventLoop(cfg);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentElements) {
+  Sequencer::Config cfg;
+  cfg.numThreads = 4;
+  cfg.concurrentElements = true;
+  checkEventLoop(cfg);
+}
+
+BOOST_AUTO_TEST_CASE(Pipelined) {
+  Sequencer::Config cfg;
+  cfg.numThreads = 4;
+  cfg.maxEventsInFlight = 3;
+  cfg.concurrentElements = true;
+  checkEventLoop(cfg);
+}
+
+BOOST_AUTO_TEST_CASE(ReadAhead) {
+  Sequencer::Config cfg;
+  cfg.numThreads = 4;
+  cfg.readAheadEvents = 5;
+  cfg.concurrentElements = true;
+  checkEventLoop(cfg);
+}
+
+BOOST_AUTO_TEST_CASE(NumaArenas) {
+  // one arena per node if TBB knows the topology, the single arena of the
+  // event loop otherwise
+  Sequencer::Config cfg;
+  cfg.numThreads = 4;
+  cfg.numaArenas = true;
+  checkEventLoop(cfg);
+  cfg.numThreads = -1;
+  checkEventLoop(cfg);
+}
+
+BOOST_AUTO_TEST_CASE(EventBatches) {
+  for (int numThreads : {1, 4}) {
+    Sequencer::Config cfg;
+    cfg.numThreads = numThreads;
+    cfg.events = 20;
+    cfg.eventBatchSize = 4;
+    cfg.logLevel = Acts::Logging::WARNING;
+    Sequencer sequencer(cfg);
+    sequencer.addReader(std::make_shared<NumberReader>());
+    auto scale = std::make_shared<BatchScaleAlgorithm>("double", 2);
+    sequencer.addAlgorithm(scale);
+    sequencer.addAlgorithm(std::make_shared<ScaleAlgorithm>("triple", 3));
+    auto sum = std::make_shared<SumAlgorithm>();
+    sequencer.addAlgorithm(sum);
+
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+    // every event keeps its own white board
+    BOOST_CHECK_EQUAL(sum->sums.size(), 20u);
+    for (const auto& [event, values] : sum->sums) {
+      BOOST_REQUIRE_EQUAL(values.size(), 1u);
+      BOOST_CHECK_EQUAL(values.front(), 5 * static_cast<int>(event));
+    }
+    // every batch of four events is split by the algorithm into three and one
+    std::sort(scale->batchSizes.begin(), scale->batchSizes.end());
+    std::vector<std::size_t> expected(5, 1);
+    expected.resize(10, 3);
+    BOOST_CHECK_EQUAL_COLLECTIONS(scale->batchSizes.begin(),
+                                  scale->batchSizes.end(), expected.begin(),
+                                  expected.end());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(EventBatchesWithPipeline) {
+  Sequencer::Config cfg;
+  cfg.eventBatchSize = 4;
+  cfg.maxEventsInFlight = 2;
+  BOOST_CHECK_THROW(Sequencer{cfg}, std::invalid_argument);
+  cfg.maxEventsInFlight = 0;
+  cfg.eventBatchSize = 0;
+  BOOST_CHECK_THROW(Sequencer{cfg}, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsExamples::Test
@@ -18,11 +18,13 @@
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "ActsFatras/Digitization/Segmentizer.hpp"
 
 #include <cmath>
+#include <cstdlib>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -82,6 +84,48 @@ BOOST_AUTO_TEST_CASE(SegmentizerCartesian) {
   BOOST_CHECK_EQUAL(ixySegments.size(), 18);
 }
 
+BOOST_AUTO_TEST_CASE(SegmentizerCartesianContiguous) {
+  Acts::GeometryContext geoCtx;
+
+  auto rectangleBounds = std::make_shared<Acts::RectangleBounds>(1., 1.);
+  auto planeSurface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Transform3::Identity(), rectangleBounds);
+
+  Acts::BinUtility pixelated(20, -1., 1., Acts::open, Acts::binX);
+  pixelated += Acts::BinUtility(20, -1., 1., Acts::open, Acts::binY);
+
+  Segmentizer cl;
+
+  // Long inclined hit crossing many channels in both directions
+  Acts::Vector2 start(0.93, -0.88);
+  Acts::Vector2 end(-0.71, 0.64);
+  auto segments = cl.segments(geoCtx, *planeSurface, pixelated, {start, end});
+  BOOST_CHECK_EQUAL(segments.size(), 33);
+
+  // The segments are ordered along the hit, adjacent and cover it fully
+  double pathSum = 0.;
+  for (std::size_t is = 0; is < segments.size(); ++is) {
+    const auto& seg = segments[is];
+    pathSum += seg.activation;
+    CHECK_CLOSE_ABS(seg.activation, (seg.path2D[1] - seg.path2D[0]).norm(),
+                    1e-9);
+    if (is > 0) {
+      const auto& previous = segments[is - 1];
+      CHECK_CLOSE_ABS((seg.path2D[0] - previous.path2D[1]).norm(), 0., 1e-9);
+      int binDistance = std::abs(static_cast<int>(seg.bin[0]) -
+                                 static_cast<int>(previous.bin[0])) +
+                        std::abs(static_cast<int>(seg.bin[1]) -
+                                 static_cast<int>(previous.bin[1]));
+      BOOST_CHECK_EQUAL(binDistance, 1);
+    }
+  }
+  CHECK_CLOSE_ABS(pathSum, (end - start).norm(), 1e-9);
+  BOOST_CHECK_EQUAL(segments.front().bin[0], 19u);
+  BOOST_CHECK_EQUAL(segments.front().bin[1], 1u);
+  BOOST_CHECK_EQUAL(segments.back().bin[0], 2u);
+  BOOST_CHECK_EQUAL(segments.back().bin[1], 16u);
+}
+
 BOOST_AUTO_TEST_CASE(SegmentizerPolarRadial) {
   Acts::GeometryContext geoCtx;
 
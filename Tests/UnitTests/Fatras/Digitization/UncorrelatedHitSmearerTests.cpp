@@ -40,6 +40,7 @@
 #include <ostream>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
@@ -219,6 +220,42 @@ BOOST_AUTO_TEST_CASE(BoundAll) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(BoundBatch) {
+  Fixture<ActsExamples::RandomEngine> f(
+      4321, Acts::Surface::makeShared<Acts::PlaneSurface>(
+                Acts::Transform3(Acts::Translation3(3, 2, 1))));
+  ActsFatras::BoundParametersSmearer<ActsExamples::RandomEngine, 2u> s;
+  s.indices = {Acts::eBoundLoc0, Acts::eBoundTime};
+  s.smearFunctions[0] = ActsExamples::Digitization::Gauss(0.1);
+  const double time = f.boundParams[Acts::eBoundTime];
+  s.smearFunctions[1] =
+      ActsExamples::Digitization::GaussTrunc(1., {time - 10., time});
+
+  // the truncation lets some of the hits fail
+  std::vector<ActsFatras::Hit> hits(100, f.hit);
+
+  ActsExamples::RandomEngine rngBatch(987);
+  std::vector<decltype(s)::Result> results;
+  s(rngBatch, hits, *f.surface, f.geoCtx, results);
+  BOOST_REQUIRE_EQUAL(results.size(), hits.size());
+
+  // identical to smearing the hits one by one
+  ActsExamples::RandomEngine rngSingle(987);
+  std::size_t nFailed = 0;
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    auto ret = s(rngSingle, hits[i], *f.surface, f.geoCtx);
+    BOOST_REQUIRE_EQUAL(ret.ok(), results[i].ok());
+    if (!ret.ok()) {
+      ++nFailed;
+      continue;
+    }
+    BOOST_CHECK_EQUAL(ret.value().first, results[i].value().first);
+    BOOST_CHECK_EQUAL(ret.value().second, results[i].value().second);
+  }
+  BOOST_CHECK_GT(nFailed, 0u);
+  BOOST_CHECK_LT(nFailed, hits.size());
+}
+
 BOOST_DATA_TEST_CASE(Free1, bd::make(freeIndices), index) {
   Fixture<RandomGenerator> f(
       1234, Acts::Surface::makeShared<Acts::PlaneSurface>(
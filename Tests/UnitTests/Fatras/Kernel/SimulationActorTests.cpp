@@ -480,6 +480,29 @@ BOOST_AUTO_TEST_CASE(NoHitsMaterialSurface) {
   BOOST_CHECK_EQUAL(f.result.particle.mass(), f.m);
 }
 
+BOOST_AUTO_TEST_CASE(RecycledContainers) {
+  Fixture<EverySurface> f(125_MeV, makeEmptySurface());
+
+  ActsFatras::SimulationResult recycled;
+  recycled.hits.reserve(64u);
+  recycled.generatedParticles.reserve(8u);
+  const auto* hitsData = recycled.hits.data();
+  const auto* particlesData = recycled.generatedParticles.data();
+  f.actor.recycled = &recycled;
+
+  // the first step adopts the containers of the recycled result
+  f.actor(f.state, f.stepper, f.navigator, f.result, Acts::getDummyLogger());
+  BOOST_CHECK_EQUAL(f.result.hits.size(), 1u);
+  BOOST_CHECK_EQUAL(f.result.hits.data(), hitsData);
+  BOOST_CHECK_EQUAL(f.result.generatedParticles.data(), particlesData);
+  BOOST_CHECK_GE(f.result.hits.capacity(), 64u);
+
+  // later steps keep using them
+  f.actor(f.state, f.stepper, f.navigator, f.result, Acts::getDummyLogger());
+  BOOST_CHECK_EQUAL(f.result.hits.size(), 2u);
+  BOOST_CHECK_EQUAL(f.result.hits.data(), hitsData);
+}
+
 BOOST_AUTO_TEST_CASE(Decay) {
   // configure no energy loss for the decay tests
   Fixture<NoSurface> f(0_GeV, makeEmptySurface());
@@ -0,0 +1,149 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Clusterization/Clusterization.hpp"
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Plugins/Cuda/Clusterization/PixelSpacePointMaker.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace Acts::Test {
+
+namespace {
+
+struct HostCell {
+  int bin0 = 0;
+  int bin1 = 0;
+  float activation = 0.f;
+  Ccl::Label label{Ccl::NO_LABEL};
+};
+
+int getCellRow(const HostCell& cell) {
+  return cell.bin1;
+}
+
+int getCellColumn(const HostCell& cell) {
+  return cell.bin0;
+}
+
+Ccl::Label& getCellLabel(HostCell& cell) {
+  return cell.label;
+}
+
+using HostCluster = std::vector<HostCell>;
+
+void clusterAddCell(HostCluster& cl, const HostCell& cell) {
+  cl.push_back(cell);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(CudaPixelSpacePointMakerAsHost) {
+  Acts::BinUtility segmentation(100, -10., 10., Acts::open, Acts::binX);
+  segmentation += Acts::BinUtility(200, -20., 20., Acts::open, Acts::binY);
+
+  std::mt19937 gen(2718);
+  std::uniform_real_distribution<double> angleDist(-M_PI, M_PI);
+  std::uniform_int_distribution<int> bin0Dist(0, 99);
+  std::uniform_int_distribution<int> bin1Dist(0, 199);
+  std::uniform_real_distribution<float> activationDist(0.1f, 1.f);
+
+  // Barrel-like modules at different radii and azimuths
+  const std::size_t nModules = 20;
+  std::vector<Cuda::PixelSpacePointMaker::Module> modules;
+  std::vector<Transform3> transforms;
+  for (std::size_t m = 0; m < nModules; ++m) {
+    const double phi = angleDist(gen);
+    const double r = 30. + 10. * (m % 4);
+    Transform3 transform = Transform3::Identity();
+    transform.translation() =
+        Vector3(r * std::cos(phi), r * std::sin(phi), 25. * (m % 5) - 50.);
+    RotationMatrix3 rotation;
+    rotation.col(0) = Vector3(-std::sin(phi), std::cos(phi), 0.);
+    rotation.col(1) = Vector3(0., 0., 1.);
+    rotation.col(2) = Vector3(std::cos(phi), std::sin(phi), 0.);
+    transform.linear() = rotation;
+    transforms.push_back(transform);
+    modules.push_back(
+        Cuda::PixelSpacePointMaker::Module::create(transform, segmentation));
+  }
+
+  // Random occupancy, every cell at most once, the second module is empty
+  std::vector<Cuda::PixelSpacePointMaker::Cell> cells;
+  std::vector<std::vector<HostCell>> hostCells(nModules);
+  for (std::size_t m = 0; m < nModules; ++m) {
+    if (m == 1) {
+      continue;
+    }
+    std::set<std::pair<int, int>> occupied;
+    for (std::size_t i = 0; i < 300; ++i) {
+      occupied.emplace(bin0Dist(gen), bin1Dist(gen));
+    }
+    for (const auto& [bin0, bin1] : occupied) {
+      const float activation = activationDist(gen);
+      cells.push_back({static_cast<unsigned int>(m), bin0, bin1, activation});
+      hostCells[m].push_back({bin0, bin1, activation});
+    }
+  }
+
+  Cuda::PixelSpacePointMaker::Config cfg;
+  Cuda::PixelSpacePointMaker maker(cfg);
+  const auto result = maker.makeSpacePoints(modules, cells);
+  const auto spacePoints = maker.copyToHost(result);
+  BOOST_REQUIRE_EQUAL(spacePoints.size(), result.nSpacePoints);
+
+  // Host reference: the clusters of each module, ordered by their first cell
+  std::vector<Vector3> expected;
+  for (std::size_t m = 0; m < nModules; ++m) {
+    std::vector<HostCell> moduleCells = hostCells[m];
+    auto clusters =
+        Ccl::createClusters<std::vector<HostCell>, std::vector<HostCluster>>(
+            moduleCells, Ccl::DefaultConnect<HostCell>(cfg.commonCorner));
+    std::vector<std::pair<std::pair<int, int>, Vector3>> moduleSpacePoints;
+    for (const HostCluster& cl : clusters) {
+      double weight = 0.;
+      Vector2 local = Vector2::Zero();
+      std::pair<int, int> first{100, 200};
+      for (const HostCell& c : cl) {
+        weight += c.activation;
+        local += c.activation * Vector2(-10. + (c.bin0 + 0.5) * 0.2,
+                                        -20. + (c.bin1 + 0.5) * 0.2);
+        first = std::min(first, std::make_pair(c.bin0, c.bin1));
+      }
+      local /= weight;
+      moduleSpacePoints.emplace_back(
+          first, transforms[m] * Vector3(local.x(), local.y(), 0.));
+    }
+    // The device numbers the clusters by their first cell in input order
+    std::sort(moduleSpacePoints.begin(), moduleSpacePoints.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (const auto& sp : moduleSpacePoints) {
+      expected.push_back(sp.second);
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(spacePoints.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    CHECK_CLOSE_ABS(spacePoints[i].x, expected[i].x(), 1e-3);
+    CHECK_CLOSE_ABS(spacePoints[i].y, expected[i].y(), 1e-3);
+    CHECK_CLOSE_ABS(spacePoints[i].z, expected[i].z(), 1e-3);
+    CHECK_CLOSE_ABS(spacePoints[i].radius, expected[i].head<2>().norm(), 1e-3);
+  }
+}
+
+}  // namespace Acts::Test
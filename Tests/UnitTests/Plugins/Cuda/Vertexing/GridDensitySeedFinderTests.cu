@@ -0,0 +1,114 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Plugins/Cuda/Vertexing/GridDensitySeedFinder.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
+#include "Acts/Vertexing/GaussianGridTrackDensity.hpp"
+#include "Acts/Vertexing/GridDensityVertexFinder.hpp"
+#include "Acts/Vertexing/IVertexFinder.hpp"
+#include "Acts/Vertexing/VertexingOptions.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+using Acts::VectorHelpers::makeVector4;
+
+namespace Acts::Test {
+
+BOOST_AUTO_TEST_CASE(CudaGridDensitySeedFinderAsHost) {
+  GeometryContext geoContext;
+  MagneticFieldContext magFieldContext;
+
+  const GaussianGridTrackDensity::Config densityCfg(100, 3001, 35);
+
+  GridDensityVertexFinder::Config hostCfg{{densityCfg}};
+  hostCfg.cacheGridStateForTrackRemoval = false;
+  hostCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  GridDensityVertexFinder hostFinder(hostCfg);
+
+  Cuda::GridDensitySeedFinder::Config cudaCfg(densityCfg);
+  Cuda::GridDensitySeedFinder cudaFinder(cudaCfg);
+
+  std::mt19937 gen(31415);
+  std::normal_distribution<double> xyDist(0_mm, 0.1_mm);
+  std::normal_distribution<double> zDist(0_mm, 1_mm);
+  std::uniform_real_distribution<double> vertexZDist(-50_mm, 50_mm);
+  std::uniform_real_distribution<double> pTDist(0.1_GeV, 100_GeV);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(-4., 4.);
+
+  auto perigeeSurface = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  const BoundSquareMatrix covMat = BoundSquareMatrix::Identity();
+
+  // Events with tracks from two vertices, and one without any track
+  const std::size_t nEvents = 10;
+  std::vector<std::vector<BoundTrackParameters>> eventTracks(nEvents);
+  for (std::size_t iEvent = 0; iEvent + 1 < nEvents; ++iEvent) {
+    const double z1 = vertexZDist(gen);
+    const double z2 = vertexZDist(gen);
+    for (unsigned int i = 0; i < 200; i++) {
+      Vector3 pos(xyDist(gen), xyDist(gen), 0);
+      double pt = pTDist(gen);
+      double charge = etaDist(gen) > 0 ? 1 : -1;
+      Vector3 direction = makeDirectionFromPhiEta(phiDist(gen), etaDist(gen));
+      pos = perigeeSurface->intersect(geoContext, pos, direction)
+                .closest()
+                .position();
+      pos[eZ] = ((i % 4) == 0 ? z2 : z1) + zDist(gen);
+      eventTracks[iEvent].push_back(
+          BoundTrackParameters::create(perigeeSurface, geoContext,
+                                       makeVector4(pos, 0), direction,
+                                       charge / pt, covMat,
+                                       ParticleHypothesis::pion())
+              .value());
+    }
+  }
+
+  std::vector<std::vector<const BoundTrackParameters*>> events(nEvents);
+  for (std::size_t iEvent = 0; iEvent < nEvents; ++iEvent) {
+    for (const auto& trk : eventTracks[iEvent]) {
+      events[iEvent].push_back(&trk);
+    }
+  }
+
+  const auto seeds = cudaFinder.findSeeds(events);
+  BOOST_REQUIRE_EQUAL(seeds.size(), nEvents);
+  BOOST_CHECK(!seeds.back().has_value());
+
+  VertexingOptions vertexingOptions(geoContext, magFieldContext);
+  for (std::size_t iEvent = 0; iEvent + 1 < nEvents; ++iEvent) {
+    std::vector<InputTrack> inputTracks;
+    for (const auto* trk : events[iEvent]) {
+      inputTracks.emplace_back(trk);
+    }
+    auto state = hostFinder.makeState(magFieldContext);
+    auto res = hostFinder.find(inputTracks, vertexingOptions, state);
+    BOOST_REQUIRE(res.ok());
+    BOOST_REQUIRE(!res->empty());
+
+    // The densities only differ by the float rounding of the summation
+    BOOST_REQUIRE(seeds[iEvent].has_value());
+    CHECK_CLOSE_ABS(*seeds[iEvent], res->back().position()[eZ],
+                    densityCfg.binSize);
+  }
+}
+
+}  // namespace Acts::Test
@@ -156,6 +156,19 @@ BOOST_AUTO_TEST_CASE(test_random_graph_edge_building_kdtree) {
   test_random_graph(emb_dim, n_nodes, r, knn, cpuEdgeBuilder);
 }
 
+BOOST_AUTO_TEST_CASE(test_random_graph_edge_building_grid) {
+  torch::manual_seed(seed);
+
+  auto gridEdgeBuilder = [](auto &features, auto radius, auto k) {
+    auto features_cpu = features.to(torch::kCPU);
+    return Acts::detail::buildEdgesGrid(features_cpu, radius, k);
+  };
+
+  test_random_graph(emb_dim, n_nodes, r, knn, gridEdgeBuilder);
+  // more than three dimensions, only three of them are gridded
+  test_random_graph(8, 100, 2.f, knn, gridEdgeBuilder);
+}
+
 BOOST_AUTO_TEST_CASE(test_self_loop_removal) {
   // clang-format off
   std::vector<int64_t> edges = {
@@ -251,6 +251,59 @@ BOOST_AUTO_TEST_CASE(ScopedSuppression) {
   BOOST_CHECK_EQUAL(mon.result().count(FpeType::FLTDIV), 0);
 }
 
+BOOST_AUTO_TEST_CASE(Counting) {
+  FpeMonitor mon{FpeMonitor::Mode::Count};
+  BOOST_CHECK(mon.mode() == FpeMonitor::Mode::Count);
+  BOOST_CHECK(!mon.result().encountered(FpeType::FLTINV));
+
+  // the flags are sticky, repeated FPEs are only counted once per query
+  invalid();
+  invalid();
+  divbyzero();
+
+  BOOST_CHECK_EQUAL(mon.result().count(FpeType::FLTINV), 1);
+  BOOST_CHECK_EQUAL(mon.result().count(FpeType::FLTDIV), 1);
+  BOOST_CHECK_EQUAL(mon.result().count(FpeType::FLTOVF), 0);
+  // no traps, no stack traces
+  BOOST_CHECK_EQUAL(mon.result().numStackTraces(), 0);
+
+  invalid();
+  BOOST_CHECK_EQUAL(mon.result().count(FpeType::FLTINV), 2);
+
+  mon.rearm();
+  overflow();
+  BOOST_CHECK_EQUAL(mon.result().count(FpeType::FLTOVF), 1);
+  BOOST_CHECK_EQUAL(mon.result().numStackTraces(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CountingScoping) {
+  FpeMonitor mon;
+  {
+    FpeMonitor mon2{FpeMonitor::Mode::Count};
+    invalid();
+    BOOST_CHECK_EQUAL(mon2.result().count(FpeType::FLTINV), 1);
+
+    {
+      // raised before the nested monitor, still counted by mon2
+      divbyzero();
+      FpeMonitor mon3;
+      overflow();
+      BOOST_CHECK_EQUAL(mon3.result().count(FpeType::FLTOVF), 1);
+      BOOST_CHECK_EQUAL(mon3.result().numStackTraces(), 1);
+    }
+
+    BOOST_CHECK_EQUAL(mon2.result().count(FpeType::FLTDIV), 1);
+    BOOST_CHECK_EQUAL(mon2.result().count(FpeType::FLTOVF), 0);
+    BOOST_CHECK_EQUAL(mon2.result().numStackTraces(), 0);
+  }
+
+  // the trapping outer monitor is restored
+  BOOST_CHECK(!mon.result().encountered(FpeType::FLTINV));
+  invalid();
+  BOOST_CHECK_EQUAL(mon.result().count(FpeType::FLTINV), 1);
+  BOOST_CHECK_EQUAL(mon.result().numStackTraces(), 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace Acts::Test
@@ -0,0 +1,104 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Plugins/Json/DetrayFlatConverter.hpp"
+#include "Acts/Plugins/Json/GridJsonConverter.hpp"
+#include "Acts/Utilities/GridAxisGenerators.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace {
+
+/// Check the flat grid against the detray json grid
+void checkAgainstJson(const Acts::DetrayFlatConverter::SurfaceGrid& fGrid,
+                      const nlohmann::json& jGrid) {
+  const auto& jAxes = jGrid["axes"];
+  BOOST_REQUIRE_EQUAL(fGrid.axes.size(), jAxes.size());
+  for (std::size_t ia = 0u; ia < fGrid.axes.size(); ++ia) {
+    BOOST_CHECK_EQUAL(fGrid.axes[ia].bounds, jAxes[ia]["bounds"]);
+    BOOST_CHECK_EQUAL(fGrid.axes[ia].binning, jAxes[ia]["binning"]);
+    BOOST_CHECK_EQUAL(fGrid.axes[ia].bins, jAxes[ia]["bins"]);
+    BOOST_CHECK(fGrid.axes[ia].edges ==
+                jAxes[ia]["edges"].get<std::vector<Acts::ActsScalar>>());
+  }
+  const auto& jBins = jGrid["bins"];
+  BOOST_REQUIRE_EQUAL(fGrid.binOffsets.size(), jBins.size() + 1u);
+  for (std::size_t ib = 0u; ib < jBins.size(); ++ib) {
+    std::vector<std::size_t> content(
+        fGrid.entries.begin() + fGrid.binOffsets[ib],
+        fGrid.entries.begin() + fGrid.binOffsets[ib + 1u]);
+    BOOST_CHECK(content ==
+                jBins[ib]["content"].get<std::vector<std::size_t>>());
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(DetrayFlatConversion)
+
+BOOST_AUTO_TEST_CASE(FlatGrid1D) {
+  using EqBound = Acts::GridAxisGenerators::EqBound;
+  EqBound eqBound{{0., 5.}, 5};
+  using GridType = EqBound::template grid_type<std::vector<std::size_t>>;
+  GridType grid(eqBound());
+  grid.at(1u) = {0u, 1u};
+  grid.at(3u) = {2u};
+  grid.at(5u) = {3u, 4u, 5u};
+
+  auto fGrid = Acts::DetrayFlatConverter::convertGrid(grid);
+  BOOST_CHECK(fGrid.binOffsets ==
+              std::vector<std::size_t>({0u, 2u, 2u, 3u, 3u, 6u}));
+  BOOST_CHECK(fGrid.entries ==
+              std::vector<std::size_t>({0u, 1u, 2u, 3u, 4u, 5u}));
+
+  checkAgainstJson(fGrid, Acts::GridJsonConverter::toJsonDetray(grid));
+}
+
+BOOST_AUTO_TEST_CASE(FlatGrid2DSwapped) {
+  using EqBoundEqClosed = Acts::GridAxisGenerators::EqBoundEqClosed;
+  EqBoundEqClosed eqBoundEqClosed{{-2., 2.}, 2, {-M_PI, M_PI}, 4};
+  using GridType =
+      EqBoundEqClosed::template grid_type<std::vector<std::size_t>>;
+  GridType grid(eqBoundEqClosed());
+  std::size_t index = 0u;
+  for (std::size_t ib0 = 1u; ib0 <= 2u; ++ib0) {
+    for (std::size_t ib1 = 1u; ib1 <= 4u; ++ib1) {
+      grid.atLocalBins({ib0, ib1}) = {index++};
+    }
+  }
+
+  for (bool swapAxes : {false, true}) {
+    auto fGrid = Acts::DetrayFlatConverter::convertGrid(grid, swapAxes);
+    BOOST_CHECK_EQUAL(fGrid.axes[0u].bins, swapAxes ? 4u : 2u);
+    BOOST_CHECK_EQUAL(fGrid.axes[1u].bounds, swapAxes ? 1u : 2u);
+    BOOST_CHECK_EQUAL(fGrid.entries.size(), 8u);
+    BOOST_CHECK_EQUAL(fGrid.entries[1u], swapAxes ? 4u : 1u);
+    checkAgainstJson(fGrid,
+                     Acts::GridJsonConverter::toJsonDetray(grid, swapAxes));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FlatAxisVariable) {
+  using VarBound = Acts::GridAxisGenerators::VarBound;
+  VarBound varBound{{0., 1., 3., 7.}};
+  using GridType = VarBound::template grid_type<std::vector<std::size_t>>;
+  GridType grid(varBound());
+
+  auto fAxis = Acts::DetrayFlatConverter::convertAxis(*grid.axes()[0u]);
+  BOOST_CHECK_EQUAL(fAxis.bounds, 1u);
+  BOOST_CHECK_EQUAL(fAxis.binning, 1u);
+  BOOST_CHECK_EQUAL(fAxis.bins, 3u);
+  BOOST_CHECK(fAxis.edges == std::vector<Acts::ActsScalar>({0., 1., 3., 7.}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,85 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2024 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Plugins/Json/JsonFileReader.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+using namespace Acts;
+
+namespace {
+
+nlohmann::json makeDocument() {
+  return nlohmann::json::parse(R"({
+    "header": {"version": 1},
+    "a": {"x": 1, "b": {"c": [1, 2, {"b": 5}]}},
+    "b": {"c": 7.5},
+    "z": "end"
+  })");
+}
+
+void writeBinary(const std::string& fileName,
+                 const std::vector<std::uint8_t>& bytes) {
+  std::ofstream out(fileName, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(JsonFileReaderTests)
+
+BOOST_AUTO_TEST_CASE(EncodingFromPath) {
+  using Encoding = JsonFileReader::Encoding;
+  BOOST_CHECK(JsonFileReader::encodingFromPath("map.json") == Encoding::Json);
+  BOOST_CHECK(JsonFileReader::encodingFromPath("map.cbor") == Encoding::Cbor);
+  BOOST_CHECK(JsonFileReader::encodingFromPath("map.msgpack") ==
+              Encoding::MessagePack);
+  BOOST_CHECK(JsonFileReader::encodingFromPath("map.ubjson") ==
+              Encoding::Ubjson);
+  BOOST_CHECK(JsonFileReader::encodingFromPath("map.bson") == Encoding::Bson);
+  BOOST_CHECK(JsonFileReader::encodingFromPath("map.cbor.json") ==
+              Encoding::Json);
+}
+
+BOOST_AUTO_TEST_CASE(ReadEntries) {
+  nlohmann::json document = makeDocument();
+
+  std::ofstream("JsonFileReader.json") << document.dump(2);
+  writeBinary("JsonFileReader.cbor", nlohmann::json::to_cbor(document));
+  writeBinary("JsonFileReader.msgpack", nlohmann::json::to_msgpack(document));
+  writeBinary("JsonFileReader.ubjson", nlohmann::json::to_ubjson(document));
+  writeBinary("JsonFileReader.bson", nlohmann::json::to_bson(document));
+
+  for (const std::string extension :
+       {".json", ".cbor", ".msgpack", ".ubjson", ".bson"}) {
+    std::string fileName = "JsonFileReader" + extension;
+    BOOST_TEST_CONTEXT(fileName) {
+      BOOST_CHECK_EQUAL(JsonFileReader::read(fileName), document);
+      BOOST_CHECK_EQUAL(JsonFileReader::read(fileName, {"a", "b"}),
+                        document["a"]["b"]);
+      // the same keys at other places of the document are ignored
+      BOOST_CHECK_EQUAL(JsonFileReader::read(fileName, {"b", "c"}), 7.5);
+      BOOST_CHECK_EQUAL(JsonFileReader::read(fileName, {"z"}), "end");
+      BOOST_CHECK_THROW(JsonFileReader::read(fileName, {"a", "c"}),
+                        std::invalid_argument);
+    }
+  }
+
+  BOOST_CHECK_THROW(JsonFileReader::read("JsonFileReader.missing"),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -271,6 +271,8 @@ BOOST_AUTO_TEST_CASE(ConvertTrack) {
     const auto& freeRecreated = t.referenceSurface();
     // Not the exact same surface, it's recreated from values
     BOOST_CHECK_NE(free.get(), &freeRecreated);
+    // Recreated on first access only, and reused afterwards
+    BOOST_CHECK_EQUAL(&freeRecreated, &tc.getTrack(0).referenceSurface());
 
     BOOST_CHECK_EQUAL(t.particleHypothesis(), pHypo);
 